@@ -78,11 +78,43 @@ def ComputeOutputPath(inputFiles, projectDir, outputDir):
     inputRelativePath = os.path.relpath(commonInputPath, commonPath) # Computes the relative path for the project source directory (Code/Framework/AzCore/AutoGen/)
     return os.path.join(outputDir, inputRelativePath) # Returns a suitable output directory (//depot/dev/Generated/Code/Framework/AzCore/AutoGen/)
 
-def ProcessTemplateConversion(dataInputSet, dataInputFiles, templateFile, outputFile, templateCache, dryrun, verbose):
+def ComputeFilesDigest(files):
+    hash = hashlib.new('md5')
+    for file in files:
+        hash.update(SanitizePath(file).encode('utf-8'))
+        with open(file, 'rb') as fileData:
+            hash.update(fileData.read())
+    return hash.hexdigest()
+
+def GetInputDigestFile(cacheDir, outputFile):
+    # The cache directory is shared by every target, so each output gets its own digest file named after its path
+    return os.path.join(cacheDir, hashlib.new('md5', outputFile.encode('utf-8')).hexdigest() + '.digest')
+
+def IsOutputUpToDate(outputFile, digestFile, inputDigest):
+    if not os.path.isfile(outputFile) or not os.path.isfile(digestFile):
+        return False
+    # The modification time of the output is part of the digest as well, so an output edited by hand is generated again
+    with open(digestFile, 'r') as digestFD:
+        return digestFD.read() == '%s:%r' % (inputDigest, os.path.getmtime(outputFile))
+
+def ProcessTemplateConversion(dataInputSet, dataInputFiles, templateFile, outputFile, templateCache, cacheDir, templateDigest, dryrun, verbose):
     if dryrun or not dataInputFiles:
         return
+    outputFile = os.path.abspath(outputFile)
+    # Skip rendering when neither the data inputs, the templates nor this script changed since the output was generated
+    inputDigest = None
+    digestFile = None
+    try:
+        inputDigest = templateDigest + ComputeFilesDigest(sorted(dataInputFiles)) + hashlib.new('md5', (templateFile + outputFile).encode('utf-8')).hexdigest()
+        digestFile = GetInputDigestFile(cacheDir, outputFile)
+        if IsOutputUpToDate(outputFile, digestFile, inputDigest):
+            if verbose == True:
+                print('Inputs of generated file %s are unchanged, skipping' % (outputFile))
+            return
+    except IOError:
+        # Fall back to rendering, which reports the error for the missing input
+        inputDigest = None
     try:
-        outputFile = os.path.abspath(outputFile)
         outputPath = os.path.dirname(outputFile)
         treeRoots = []
         for dataInputFile in sorted(dataInputFiles):
@@ -234,8 +266,15 @@ def ProcessTemplateConversion(dataInputSet, dataInputFiles, templateFile, output
         PrintUnhandledExcptionInfo()
         raise
     compareFD.close()
+    if inputDigest and errorCount == 0:
+        try:
+            with open(digestFile, 'w') as digestFD:
+                digestFD.write('%s:%r' % (inputDigest, os.path.getmtime(outputFile)))
+        except IOError as e:
+            # Not fatal, the output is simply generated again on the next run
+            print('Unable to write the input digest %s for %s : %s' % (digestFile, outputFile, e.strerror))
 
-def ProcessExpansionRule(sourceFiles, templateFiles, templateCache, outputDir, projectDir, expansionRule, dryrun, verbose, dataInputSet, outputFiles):
+def ProcessExpansionRule(sourceFiles, templateFiles, templateCache, cacheDir, templateDigest, outputDir, projectDir, expansionRule, dryrun, verbose, dataInputSet, outputFiles):
     try:
         # should be of the format inputFile(s),templateFile,outputFile, where inputFile and outputFile are subject to wildcarding and substitutions
         expansionRuleSet = expansionRule.split(",")
@@ -270,7 +309,7 @@ def ProcessExpansionRule(sourceFiles, templateFiles, templateCache, outputDir, p
             outputFileAbsolute = outputFileAbsolute.replace("$fileprefix", os.path.splitext(os.path.basename(testSingle))[0].split(".")[0])
             outputFileAbsolute = outputFileAbsolute.replace("$file", os.path.splitext(os.path.basename(testSingle))[0])
             outputFileAbsolute = SanitizePath(outputFileAbsolute)
-            ProcessTemplateConversion(dataInputSet, dataInputFiles, templateFile, outputFileAbsolute, templateCache, dryrun, verbose)
+            ProcessTemplateConversion(dataInputSet, dataInputFiles, templateFile, outputFileAbsolute, templateCache, cacheDir, templateDigest, dryrun, verbose)
             outputFiles.append(outputFileAbsolute)
         else:
             # We've wildcarded the data input field, so we may have to handle one-to-one mapping of data files to output, or many-to-one mapping of data files to output
@@ -282,7 +321,7 @@ def ProcessExpansionRule(sourceFiles, templateFiles, templateCache, outputDir, p
                     outputFileAbsolute = outputFileAbsolute.replace("$fileprefix", os.path.splitext(os.path.basename(filename))[0].split(".")[0])
                     outputFileAbsolute = outputFileAbsolute.replace("$file", os.path.splitext(os.path.basename(filename))[0])
                     outputFileAbsolute = SanitizePath(outputFileAbsolute)
-                    ProcessTemplateConversion(dataInputSet, dataInputFiles, templateFile, outputFileAbsolute, templateCache, dryrun, verbose)
+                    ProcessTemplateConversion(dataInputSet, dataInputFiles, templateFile, outputFileAbsolute, templateCache, cacheDir, templateDigest, dryrun, verbose)
                     outputFiles.append(outputFileAbsolute)
             else:
                 # Process all matches in one batch
@@ -291,7 +330,7 @@ def ProcessExpansionRule(sourceFiles, templateFiles, templateCache, outputDir, p
                     dataInputFiles = [os.path.abspath(file) for file in fnmatch.filter(sourceFiles, inputFiles)]
                 outputFileAbsolute = outputFile.replace("$path", ComputeOutputPath(dataInputFiles, projectDir, outputDir))
                 outputFileAbsolute = SanitizePath(outputFileAbsolute)
-                ProcessTemplateConversion(dataInputSet, dataInputFiles, templateFile, outputFileAbsolute, templateCache, dryrun, verbose)
+                ProcessTemplateConversion(dataInputSet, dataInputFiles, templateFile, outputFileAbsolute, templateCache, cacheDir, templateDigest, dryrun, verbose)
                 outputFiles.append(outputFileAbsolute)
     except IOError as e:
         PrintError('%s : error I/O(%s) accessing %s : %s' % (expansionRule, e.errno, e.filename, e.strerror))
@@ -322,8 +361,10 @@ def ExecuteExpansionRules(cacheDir, outputDir, projectDir, inputFiles, expansion
         elif inputFile.endswith(".jinja"):
             templateFiles.append(os.path.join(projectDir, inputFile))
     templateCache = jinja2.FileSystemBytecodeCache(cacheDir)
+    # Templates include each other, so a change to any of them, or to this script, invalidates every output
+    templateDigest = ComputeFilesDigest(sorted(templateFiles) + [os.path.abspath(__file__)]) if not dryrun else ''
     for expansionRule in expansionRules:
-        ProcessExpansionRule(sourceFiles, templateFiles, templateCache, outputDir, projectDir, expansionRule, dryrun, verbose, dataInputSet, outputFiles)
+        ProcessExpansionRule(sourceFiles, templateFiles, templateCache, cacheDir, templateDigest, outputDir, projectDir, expansionRule, dryrun, verbose, dataInputSet, outputFiles)
     if not dryrun:
         elapsedTime = time.time() - startTime
         millis = int(round(elapsedTime * 10))
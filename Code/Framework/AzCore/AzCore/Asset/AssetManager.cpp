@@ -37,6 +37,8 @@ namespace AZ
                 "Number of milliseconds that AssetHandler::LoadAssetData can execute for before printing a warning.");
         AZ_CVAR(int, cl_assetLoadDelay, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
             "Number of milliseconds to artifically delay an asset load.");
+        AZ_CVAR(uint32_t, cl_assetLoadMaxActiveStreamerRequests, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Maximum number of asset data streams that are read at the same time, 0 for no limit. Additional loads wait in priority order.");
         AZ_CVAR(bool, cl_assetLoadError, false, nullptr, AZ::ConsoleFunctorFlags::Null,
             "Enable failure of all asset loads.");
 
@@ -848,16 +850,24 @@ namespace AZ
             // If the catalog is not available, use the original assetId
             const AssetId& assetToFind(assetInfo.m_assetId.IsValid() ? assetInfo.m_assetId : assetId);
 
-            AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_assetMutex);
-            AssetMap::iterator it = m_assets.find(assetToFind);
+            return FindRegisteredAsset(assetToFind, assetReferenceLoadBehavior);
+        }
+
+        //=========================================================================
+        // FindRegisteredAsset
+        //=========================================================================
+        Asset<AssetData> AssetManager::FindRegisteredAsset(const AssetId& assetId, AssetLoadBehavior assetReferenceLoadBehavior)
+        {
+            // Releasing the last reference removes the asset from the map under the exclusive lock, so the reference taken
+            // here either keeps the asset alive or the asset isn't found.
+            AZStd::shared_lock<AZStd::shared_mutex> mapLock(m_assetMapMutex);
+            Asset<AssetData> asset(assetReferenceLoadBehavior);
+            AssetMap::iterator it = m_assets.find(assetId);
             if (it != m_assets.end())
             {
-                Asset<AssetData> asset(assetReferenceLoadBehavior);
                 asset.SetData(it->second);
-
-                return asset;
             }
-            return Asset<AssetData>(assetReferenceLoadBehavior);
+            return asset;
         }
 
         AZStd::pair<AZStd::chrono::milliseconds, AZ::IO::IStreamerTypes::Priority> GetEffectiveDeadlineAndPriority(
@@ -977,6 +987,20 @@ namespace AZ
             AZ_PROFILE_SCOPE_DYNAMIC(AZ::Debug::ProfileCategory::AzCore, "GetAsset: %s", assetInfo.m_relativePath.c_str());
             AZ_ASSET_NAMED_SCOPE("GetAsset: %s", assetInfo.m_relativePath.c_str());
 
+            // Most requests are for assets that are already loaded or loading, those don't need to lock m_assetMutex.
+            {
+                Asset<AssetData> existingAsset = FindRegisteredAsset(assetInfo.m_assetId, assetReferenceLoadBehavior);
+                const AssetData::AssetStatus existingStatus = existingAsset.GetStatus();
+                if (existingAsset && existingStatus != AssetData::AssetStatus::NotLoaded && existingStatus != AssetData::AssetStatus::Queued)
+                {
+                    if (!assetInfo.m_relativePath.empty())
+                    {
+                        existingAsset.m_assetHint = assetInfo.m_relativePath;
+                    }
+                    return existingAsset;
+                }
+            }
+
             AZStd::shared_ptr<AssetDataStream> dataStream;
             AssetStreamInfo loadInfo;
             bool triggerAssetErrorNotification = false;
@@ -1044,6 +1068,7 @@ namespace AZ
                     if (isNewEntry && assetData->IsRegisterReadonlyAndShareable())
                     {
                         AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzCore, "GetAsset: RegisterAsset");
+                        AZStd::unique_lock<AZStd::shared_mutex> mapLock(m_assetMapMutex);
                         m_assets.insert(AZStd::make_pair(assetInfo.m_assetId, assetData));
                     }
                     if (assetData->GetStatus() == AssetData::AssetStatus::NotLoaded)
@@ -1168,6 +1193,7 @@ namespace AZ
                         assetData->RegisterWithHandler(handler);
                         if (assetData->IsRegisterReadonlyAndShareable())
                         {
+                            AZStd::unique_lock<AZStd::shared_mutex> mapLock(m_assetMapMutex);
                             m_assets.insert(AZStd::make_pair(assetId, assetData));
                         }
 
@@ -1203,6 +1229,8 @@ namespace AZ
             if (removeAssetFromHash)
             {
                 AZStd::scoped_lock<AZStd::recursive_mutex> asset_lock(m_assetMutex);
+                // The exclusive lock keeps FindRegisteredAsset from taking a reference between the check below and the erase.
+                AZStd::unique_lock<AZStd::shared_mutex> mapLock(m_assetMapMutex);
                 AssetMap::iterator it = m_assets.find(assetId);
                 // need to check the count again in here in case
                // someone was trying to get the asset on another thread
@@ -1543,7 +1571,10 @@ namespace AZ
 
                     // Held references to old data are retained, but replace the entry in the DB for future requests.
                     // Fire an OnAssetReloaded message so listeners can react to the new data.
-                    m_assets[assetId] = asset.Get();
+                    {
+                        AZStd::unique_lock<AZStd::shared_mutex> mapLock(m_assetMapMutex);
+                        m_assets[assetId] = asset.Get();
+                    }
 
                     // Release the reload reference.
                     auto reloadInfo = m_reloads.find(assetId);
@@ -1675,13 +1706,58 @@ namespace AZ
 
             auto&& [deadline, priority] = GetEffectiveDeadlineAndPriority(*handler, asset.GetType(), loadParams);
 
-            // Track the load request and queue the asset data stream load.
-            AddActiveStreamerRequest(asset.GetId(), dataStream);
-            dataStream->Open(
-                streamInfo.m_streamName,
-                streamInfo.m_dataOffset,
-                streamInfo.m_dataLen,
-                deadline, priority, assetDataStreamCallback);
+            // Track the load request and queue the asset data stream load. The stream is opened once there's room for another
+            // streamer request in flight, so that a large dependency graph doesn't queue all of its reads at once.
+            {
+                AZStd::scoped_lock<AZStd::recursive_mutex> lock(m_activeJobOrRequestMutex);
+                AddActiveStreamerRequest(asset.GetId(), dataStream);
+                m_pendingStreamerRequests.push_back({ asset.GetId(), dataStream, streamInfo, deadline, priority,
+                    AZStd::move(assetDataStreamCallback) });
+            }
+            IssuePendingStreamerRequests();
+        }
+
+        //=========================================================================
+        // IssuePendingStreamerRequests
+        //=========================================================================
+        void AssetManager::IssuePendingStreamerRequests()
+        {
+            while (true)
+            {
+                PendingStreamerRequest request;
+                {
+                    AZStd::scoped_lock<AZStd::recursive_mutex> lock(m_activeJobOrRequestMutex);
+                    if (m_pendingStreamerRequests.empty())
+                    {
+                        return;
+                    }
+
+                    const size_t maxActiveRequests = cl_assetLoadMaxActiveStreamerRequests;
+                    const size_t numActiveRequests = m_activeAssetDataStreamRequests.size() - m_pendingStreamerRequests.size();
+                    if (maxActiveRequests > 0 && numActiveRequests >= maxActiveRequests)
+                    {
+                        return;
+                    }
+
+                    // Open the most urgent request first: the highest priority, then the earliest deadline.
+                    auto next = m_pendingStreamerRequests.begin();
+                    for (auto it = next + 1; it != m_pendingStreamerRequests.end(); ++it)
+                    {
+                        if (it->m_priority > next->m_priority || (it->m_priority == next->m_priority && it->m_deadline < next->m_deadline))
+                        {
+                            next = it;
+                        }
+                    }
+                    request = AZStd::move(*next);
+                    m_pendingStreamerRequests.erase(next);
+                }
+
+                request.m_dataStream->Open(
+                    request.m_streamInfo.m_streamName,
+                    request.m_streamInfo.m_dataOffset,
+                    request.m_streamInfo.m_dataLen,
+                    request.m_deadline, request.m_priority, AZStd::move(request.m_callback));
+            }
         }
 
         //=========================================================================
@@ -1835,6 +1911,16 @@ namespace AZ
         {
             AZStd::scoped_lock lock(m_activeJobOrRequestMutex);
 
+            for (PendingStreamerRequest& pendingRequest : m_pendingStreamerRequests)
+            {
+                if (pendingRequest.m_assetId == assetId)
+                {
+                    pendingRequest.m_deadline = AZStd::GetMin(pendingRequest.m_deadline, newDeadline);
+                    pendingRequest.m_priority = AZStd::GetMax(pendingRequest.m_priority, newPriority);
+                    return;
+                }
+            }
+
             auto iterator = m_activeAssetDataStreamRequests.find(assetId);
 
             if (iterator != m_activeAssetDataStreamRequests.end())
@@ -1848,8 +1934,13 @@ namespace AZ
         //=========================================================================
         void AssetManager::RemoveActiveStreamerRequest(AssetId assetData)
         {
-            AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_activeJobOrRequestMutex);
-            m_activeAssetDataStreamRequests.erase(assetData);
+            {
+                AZStd::scoped_lock<AZStd::recursive_mutex> assetLock(m_activeJobOrRequestMutex);
+                m_activeAssetDataStreamRequests.erase(assetData);
+            }
+
+            // A streamer request finished, which makes room for the next pending one.
+            IssuePendingStreamerRequests();
         }
 
         //=========================================================================
@@ -16,6 +16,7 @@
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/SystemAllocator.h> // used as allocator for most components
 #include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/shared_mutex.h>
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/containers/unordered_map.h>
@@ -346,6 +347,8 @@ namespace AZ
             void AddActiveStreamerRequest(AssetId assetId, AZStd::shared_ptr<AssetDataStream> readRequest);
             void RescheduleStreamerRequest(AssetId assetId, AZStd::chrono::milliseconds newDeadline, AZ::IO::IStreamerTypes::Priority newPriority);
             void RemoveActiveStreamerRequest(AssetId assetId);
+            //! Open the data streams of the pending streamer requests while there's room for them in cl_assetLoadMaxActiveStreamerRequests.
+            void IssuePendingStreamerRequests();
             void AddBlockingRequest(AssetId assetId, WaitForAsset* blockingRequest);
             void RemoveBlockingRequest(AssetId assetId, WaitForAsset* blockingRequest);
 
@@ -396,6 +399,9 @@ namespace AZ
             //! Get the load stream info for an asset, including missing-asset substitution and custom AssetHandler overrides.
             AssetStreamInfo GetModifiedLoadStreamInfoForAsset(const Asset<AssetData>& asset, AssetHandler* handler);
 
+            //! Find a registered asset and take a reference to it, using only a shared lock on the asset map.
+            Asset<AssetData> FindRegisteredAsset(const AssetId& assetId, AssetLoadBehavior assetReferenceLoadBehavior);
+
             //! Queue an async file load with the AssetDataStream as the first step in an asset load
             void QueueAsyncStreamLoad(Asset<AssetData> asset, AZStd::shared_ptr<AssetDataStream> dataStream,
                 const AZ::Data::AssetStreamInfo& streamInfo, bool isReload,
@@ -406,6 +412,10 @@ namespace AZ
             AZStd::recursive_mutex  m_catalogMutex;     // lock when accessing the catalog map
             AssetMap                m_assets;
             AZStd::recursive_mutex  m_assetMutex;       // lock when accessing the asset map
+            //! Guards the structure of m_assets for the lookups that don't lock m_assetMutex, so that getting a reference to an
+            //! asset that is already loaded doesn't contend with the loads. Changes to m_assets hold m_assetMutex and lock this
+            //! exclusively only around the change itself.
+            AZStd::shared_mutex     m_assetMapMutex;
 
             WeakAssetContainerMap   m_assetContainers;
             OwnedAssetContainerMap  m_ownedAssetContainers;
@@ -427,7 +437,20 @@ namespace AZ
             using AssetRequestMap = AZStd::unordered_map<AssetId, AZStd::shared_ptr<AssetDataStream>>;
             AssetRequestMap m_activeAssetDataStreamRequests;
 
-            // Lock when accessing the list of active jobs or streamer requests
+            //! A streamer request that is tracked as active, but whose data stream isn't opened yet because the maximum number of
+            //! streamer requests in flight was reached. The pending requests are opened by priority as the in-flight ones complete.
+            struct PendingStreamerRequest
+            {
+                AssetId m_assetId;
+                AZStd::shared_ptr<AssetDataStream> m_dataStream;
+                AssetStreamInfo m_streamInfo;
+                AZStd::chrono::milliseconds m_deadline{ AZ::IO::IStreamerTypes::s_noDeadline };
+                AZ::IO::IStreamerTypes::Priority m_priority{ AZ::IO::IStreamerTypes::s_priorityMedium };
+                AssetDataStream::OnCompleteCallback m_callback;
+            };
+            AZStd::vector<PendingStreamerRequest> m_pendingStreamerRequests;
+
+            // Lock when accessing the list of active jobs, streamer requests or pending streamer requests
             AZStd::recursive_mutex  m_activeJobOrRequestMutex;
 
             //! The set of all blocking requests that currently exist, grouped by AssetId.
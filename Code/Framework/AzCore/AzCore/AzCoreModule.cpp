@@ -24,6 +24,7 @@
 #include <AzCore/Time/TimeSystemComponent.h>
 #include <AzCore/Console/LoggerSystemComponent.h>
 #include <AzCore/EBus/EventSchedulerSystemComponent.h>
+#include <AzCore/Component/ScheduledTickSystemComponent.h>
 
 namespace AZ
 {
@@ -44,6 +45,7 @@ namespace AZ
             TimeSystemComponent::CreateDescriptor(),
             LoggerSystemComponent::CreateDescriptor(),
             EventSchedulerSystemComponent::CreateDescriptor(),
+            ScheduledTickSystemComponent::CreateDescriptor(),
 
 #if !defined(_RELEASE)
             Statistics::StatisticalProfilerProxySystemComponent::CreateDescriptor(),
@@ -61,6 +63,7 @@ namespace AZ
             azrtti_typeid<TimeSystemComponent>(),
             azrtti_typeid<LoggerSystemComponent>(),
             azrtti_typeid<EventSchedulerSystemComponent>(),
+            azrtti_typeid<ScheduledTickSystemComponent>(),
 
 #if !defined(_RELEASE)
             azrtti_typeid<AZ::Statistics::StatisticalProfilerProxySystemComponent>(),
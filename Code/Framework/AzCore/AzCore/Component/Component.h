@@ -145,6 +145,15 @@ namespace AZ
          */
         bool GetConfiguration(AZ::ComponentConfig& outConfig) const;
 
+        /**
+         * Returns whether the component's Activate() function can be called from a job thread, at the same time as the
+         * Activate() functions of components on other entities.
+         * Entity contexts only activate an entity on the job system if all of its components return true. Components that
+         * do so may only connect to thread safe buses and must not depend on other entities being active during activation.
+         * @return True if the component supports parallel activation. False by default.
+         */
+        virtual bool IsActivationThreadSafe() const { return false; }
+
     protected:
         /**
          * Initializes a component's resources.
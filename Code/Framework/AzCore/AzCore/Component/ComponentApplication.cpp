@@ -19,9 +19,11 @@
 #include <AzCore/Debug/LocalFileEventLogger.h>
 
 #include <AzCore/Memory/AllocationRecords.h>
+#include <AzCore/Memory/AllocationSampler.h>
 
 #include <AzCore/Memory/OverrunDetectionAllocator.h>
 #include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Memory/FrameArenaAllocator.h>
 #include <AzCore/Memory/MallocSchema.h>
 
 #include <AzCore/NativeUI/NativeUIRequests.h>
@@ -95,6 +97,37 @@ static void PrintEntityName(const AZ::ConsoleCommandContainer& arguments)
 AZ_CONSOLEFREEFUNC(
     PrintEntityName, AZ::ConsoleFunctorFlags::Null, "Parameter: EntityId value, Prints the name of the entity to the console");
 
+static void SetAllocationSamplingInterval(const AZ::ConsoleCommandContainer& arguments)
+{
+    if (arguments.empty() || !AZ::AllocatorManager::IsReady())
+    {
+        return;
+    }
+
+    const auto samplingInterval = AZStd::stoull(AZStd::string(arguments.front()));
+    AZ::AllocatorManager::Instance().SetAllocationSamplingInterval(aznumeric_cast<size_t>(samplingInterval));
+}
+
+AZ_CONSOLEFREEFUNC(
+    SetAllocationSamplingInterval, AZ::ConsoleFunctorFlags::Null,
+    "Parameter: average number of bytes between allocation samples, 0 stops sampling. Samples allocations with their call stack to find heap growth");
+
+static void PrintAllocationSamples(const AZ::ConsoleCommandContainer& arguments)
+{
+    AZ::Debug::AllocationSampler* sampler = AZ::AllocatorManager::IsReady() ? AZ::AllocatorManager::Instance().GetAllocationSampler() : nullptr;
+    if (!sampler)
+    {
+        AZ_Printf("Memory", "Allocation sampling isn't enabled, use SetAllocationSamplingInterval first.\n");
+        return;
+    }
+
+    const auto maxNumStacks = arguments.empty() ? 20 : AZStd::stoul(AZStd::string(arguments.front()));
+    sampler->PrintSamples(aznumeric_cast<unsigned int>(maxNumStacks));
+}
+
+AZ_CONSOLEFREEFUNC(
+    PrintAllocationSamples, AZ::ConsoleFunctorFlags::Null, "Parameter: optional number of call stacks, Prints the call stacks that hold the most sampled memory");
+
 namespace AZ
 {
     static EnvironmentVariable<OverrunDetectionSchema> s_overrunDetectionSchema;
@@ -614,6 +647,13 @@ namespace AZ
     //=========================================================================
     void ComponentApplication::CreateCommon()
     {
+        // The frame arena is reset at the end of every Tick.
+        if (!AZ::AllocatorInstance<AZ::FrameArenaAllocator>::IsReady())
+        {
+            AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Create();
+            m_isFrameArenaAllocatorOwner = true;
+        }
+
         {
             AZ::IO::FixedMaxPath outputPath;
             m_settingsRegistry->Get(outputPath.Native(), AZ::SettingsRegistryMergeUtils::FilePathKey_DevWriteStorage);
@@ -689,18 +729,36 @@ namespace AZ
         AZ::UserSettingsComponentRequestBus::Broadcast(&AZ::UserSettingsComponentRequests::Finalize);
 
         // deactivate all entities
+        // The ids are gathered up front because finding the first element of the flat entity map scans its slots. Deleting an
+        // entity can remove other entities from the map, so the ids are gathered again until the map is empty.
+        AZStd::vector<EntityId> entityIds;
         while (!m_entities.empty())
         {
-            Entity* entity = m_entities.begin()->second;
-            m_entities.erase(m_entities.begin());
-
-            if (entity->GetId() == SystemEntityId)
+            entityIds.clear();
+            entityIds.reserve(m_entities.size());
+            for (const auto& entityIter : m_entities)
             {
-                AZ_Assert(m_systemEntity.get() == entity, "Activated system entity does not match the system entity created in Create().");
+                entityIds.push_back(entityIter.first);
             }
-            else
+
+            for (const EntityId& entityId : entityIds)
             {
-                delete entity;
+                auto entityIter = m_entities.find(entityId);
+                if (entityIter == m_entities.end())
+                {
+                    continue;
+                }
+                Entity* entity = entityIter->second;
+                m_entities.erase(entityIter);
+
+                if (entity->GetId() == SystemEntityId)
+                {
+                    AZ_Assert(m_systemEntity.get() == entity, "Activated system entity does not match the system entity created in Create().");
+                }
+                else
+                {
+                    delete entity;
+                }
             }
         }
 
@@ -756,6 +814,12 @@ namespace AZ
         // Clear the descriptor to deallocate all strings (owned by ModuleDescriptor)
         m_descriptor = Descriptor();
 
+        if (m_isFrameArenaAllocatorOwner)
+        {
+            AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Destroy();
+            m_isFrameArenaAllocatorOwner = false;
+        }
+
         m_isStarted = false;
 
 #if defined(AZ_ENABLE_DEBUG_TOOLS)
@@ -1173,7 +1237,10 @@ namespace AZ
         ReflectionEnvironment::Init();
 
         ReflectionEnvironment::GetReflectionManager()->AddReflectContext<SerializeContext>();
-        ReflectionEnvironment::GetReflectionManager()->AddReflectContext<BehaviorContext>();
+        if (m_startupParameters.m_createBehaviorContext)
+        {
+            ReflectionEnvironment::GetReflectionManager()->AddReflectContext<BehaviorContext>();
+        }
         ReflectionEnvironment::GetReflectionManager()->AddReflectContext<JsonRegistrationContext>();
     }
 
@@ -1420,6 +1487,12 @@ namespace AZ
         {
             m_drillerManager->FrameUpdate();
         }
+
+        // Release all temporary memory used during this frame.
+        if (AZ::AllocatorInstance<AZ::FrameArenaAllocator>::IsReady())
+        {
+            static_cast<AZ::FrameArenaAllocator&>(AZ::AllocatorInstance<AZ::FrameArenaAllocator>::GetAllocator()).ResetFrame();
+        }
     }
 
     //=========================================================================
@@ -24,6 +24,7 @@
 #include <AzCore/Settings/CommandLine.h>
 #include <AzCore/Settings/SettingsRegistry.h>
 #include <AzCore/Settings/SettingsRegistryConsoleUtils.h>
+#include <AzCore/std/containers/flat_hash_map.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/string/conversions.h>
@@ -79,7 +80,7 @@ namespace AZ
         , public TickRequestBus::Handler
     {
         // or try to use unordered set if we store the ID internally
-        typedef AZStd::unordered_map<EntityId, Entity*>  EntitySetType;
+        typedef AZStd::flat_hash_map<EntityId, Entity*>  EntitySetType;
 
     public:
         AZ_RTTI(ComponentApplication, "{1F3B070F-89F7-4C3D-B5A3-8832D5BC81D7}");
@@ -174,6 +175,9 @@ namespace AZ
             bool m_loadDynamicModules = true;
             //! Used by test fixtures to ensure reflection occurs to edit context.
             bool m_createEditContext = false;
+            //! Applications that never run script, such as headless tools, can clear this to skip reflecting every
+            //! registered type into a BehaviorContext at startup. GetBehaviorContext() then returns nullptr.
+            bool m_createBehaviorContext = true;
         };
 
         ComponentApplication();
@@ -389,6 +393,7 @@ namespace AZ
         bool                                        m_isStarted{ false };
         bool                                        m_isSystemAllocatorOwner{ false };
         bool                                        m_isOSAllocatorOwner{ false };
+        bool                                        m_isFrameArenaAllocatorOwner{ false };
         bool                                        m_ownsConsole{};
         void*                                       m_fixedMemoryBlock{ nullptr }; //!< Pointer to the memory block allocator, so we can free it OnDestroy.
         IAllocatorAllocate*                         m_osAllocator{ nullptr };
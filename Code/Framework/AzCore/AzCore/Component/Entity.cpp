@@ -191,16 +191,31 @@ namespace AZ
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
 
+        if (BeginActivation())
+        {
+            ActivateComponents();
+            EndActivation();
+        }
+    }
+
+    bool Entity::BeginActivation()
+    {
         AZ_Assert(m_state == State::Init, "Entity should be in Init state to be Activated!");
 
         const DependencySortOutcome sortOutcome = EvaluateDependenciesGetDetails();
         if (!sortOutcome.IsSuccess())
         {
             AZ_Error("Entity", false, "Entity '%s' %s cannot be activated. %s", m_name.c_str(), m_id.ToString().c_str(), sortOutcome.GetError().m_message.c_str());
-            return;
+            return false;
         }
 
         SetState(State::Activating);
+        return true;
+    }
+
+    void Entity::ActivateComponents()
+    {
+        AZ_Assert(m_state == State::Activating, "Entity should be in Activating state to activate its components!");
 
         for (ComponentArrayType::iterator it = m_components.begin(); it != m_components.end(); ++it)
         {
@@ -212,6 +227,11 @@ namespace AZ
         // As we have a guarantee (by design) that components can't change during active state)
         // Even though technically they can connect disconnect from the bus.
         m_transform = TransformBus::FindFirstHandler(m_id);
+    }
+
+    void Entity::EndActivation()
+    {
+        AZ_Assert(m_state == State::Activating, "Entity should be in Activating state to finish its activation!");
 
         SetState(State::Active);
 
@@ -224,6 +244,24 @@ namespace AZ
         }
     }
 
+    bool Entity::IsActivationThreadSafe() const
+    {
+        // Entities that override Activate() may do more than activate their components.
+        if (RTTI_GetType() != AzTypeInfo<Entity>::Uuid())
+        {
+            return false;
+        }
+
+        for (const Component* component : m_components)
+        {
+            if (!component->IsActivationThreadSafe())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
     void Entity::Deactivate()
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
@@ -159,6 +159,22 @@ namespace AZ
         //! of each component.
         virtual void Activate();
 
+        //! Activation split up into its steps, so entity contexts can activate the components of multiple entities in parallel.
+        //! BeginActivation() and EndActivation() must be called from the main thread, ActivateComponents() can be called from
+        //! a job thread if IsActivationThreadSafe() returns true. Activate() runs all three steps.
+        //! @{
+        //! Verifies and sorts the component dependencies, and puts the entity in the activating state.
+        //! @return True if the components can be activated, otherwise false and the entity stays in the init state.
+        bool BeginActivation();
+        void ActivateComponents();
+        //! Puts the entity in the active state and notifies the listeners that the entity was activated.
+        void EndActivation();
+        //! @}
+
+        //! Finds whether the components of the entity can be activated on a job thread.
+        //! @return True if the entity is a plain entity and all of its components support parallel activation.
+        bool IsActivationThreadSafe() const;
+
         //! Deactivates the entity and its components.
         //! This function can be called multiple times throughout the lifetime of an
         //! entity. This function calls the Deactivate function of each component.
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Component/ScheduledTick.h>
+#include <AzCore/Debug/Trace.h>
+#include <AzCore/Interface/Interface.h>
+
+namespace AZ
+{
+    ScheduledTickHandler::~ScheduledTickHandler()
+    {
+        ScheduledTickDisconnect();
+    }
+
+    void ScheduledTickHandler::ScheduledTickConnect(float frequency, ScheduledTickImportance importance)
+    {
+        if (IScheduledTickSystem* scheduledTickSystem = Interface<IScheduledTickSystem>::Get())
+        {
+            ScheduledTickDisconnect();
+            m_importance = importance;
+            m_frequency = frequency;
+            scheduledTickSystem->Connect(*this);
+        }
+        else
+        {
+            AZ_Warning("ScheduledTick", false, "Unable to connect to the scheduled tick system as it's not available.");
+        }
+    }
+
+    void ScheduledTickHandler::ScheduledTickDisconnect()
+    {
+        if (IsScheduledTickConnected())
+        {
+            if (IScheduledTickSystem* scheduledTickSystem = Interface<IScheduledTickSystem>::Get())
+            {
+                scheduledTickSystem->Disconnect(*this);
+            }
+            m_slot = InvalidSlot;
+        }
+    }
+
+    bool ScheduledTickHandler::IsScheduledTickConnected() const
+    {
+        return m_slot != InvalidSlot;
+    }
+
+    void ScheduledTickHandler::SetScheduledTickFrequency(float frequency)
+    {
+        AZ_Assert(frequency > 0.0f, "Scheduled tick frequency needs to be larger than zero.");
+        if (m_frequency != frequency)
+        {
+            m_frequency = frequency;
+            if (IsScheduledTickConnected())
+            {
+                if (IScheduledTickSystem* scheduledTickSystem = Interface<IScheduledTickSystem>::Get())
+                {
+                    scheduledTickSystem->Reschedule(*this);
+                }
+            }
+        }
+    }
+
+    float ScheduledTickHandler::GetScheduledTickFrequency() const
+    {
+        return m_frequency;
+    }
+
+    float ScheduledTickHandler::GetScheduledTickInterval() const
+    {
+        return 1.0f / m_frequency;
+    }
+
+    void ScheduledTickHandler::SetScheduledTickImportance(ScheduledTickImportance importance)
+    {
+        m_importance = importance;
+    }
+
+    ScheduledTickImportance ScheduledTickHandler::GetScheduledTickImportance() const
+    {
+        return m_importance;
+    }
+} // namespace AZ
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/Script/ScriptTimePoint.h>
+#include <AzCore/std/function/function_fwd.h>
+
+namespace AZ
+{
+    class ScheduledTickHandler;
+
+    //! How important it is for a scheduled tick handler to tick on time.
+    //! When more scheduled ticks are due in a frame than sys_scheduledTickMaxPerFrame allows, the most important handlers tick
+    //! first and the others are postponed to the next frame. Critical handlers are never postponed.
+    enum class ScheduledTickImportance : u8
+    {
+        Low,
+        Normal,
+        High,
+        Critical
+    };
+
+    //! @class IScheduledTickSystem
+    //! @brief This is an AZ::Interface<> for ticking handlers at a reduced frequency.
+    //! Users should not require any direct interaction with this interface, ScheduledTickHandler connects and disconnects itself.
+    class IScheduledTickSystem
+    {
+    public:
+        AZ_RTTI(IScheduledTickSystem, "{5B8A3F0E-2C41-4D7A-9E63-A17F0B4C8D25}");
+
+        using HandlerCallback = AZStd::function<bool(const ScheduledTickHandler& handler)>;
+
+        IScheduledTickSystem() = default;
+        virtual ~IScheduledTickSystem() = default;
+
+        //! Starts ticking the handler at its frequency.
+        //! The first tick of each newly connected handler is offset by a different fraction of its interval, so handlers that
+        //! connect at the same time don't all tick in the same frame.
+        virtual void Connect(ScheduledTickHandler& handler) = 0;
+        //! Stops ticking the handler. Safe to call from within a scheduled tick.
+        virtual void Disconnect(ScheduledTickHandler& handler) = 0;
+        //! Recalculates when the handler ticks next after its frequency changed.
+        virtual void Reschedule(ScheduledTickHandler& handler) = 0;
+
+        //! Calls the callback for every connected handler until the callback returns false.
+        virtual void EnumerateHandlers(const HandlerCallback& callback) const = 0;
+        //! Returns the number of handlers that ticked during the last tick.
+        virtual u32 GetNumTickedLastFrame() const = 0;
+        //! Returns the number of handlers that were due during the last tick but were postponed because of the per-frame limit.
+        virtual u32 GetNumPostponedLastFrame() const = 0;
+
+        AZ_DISABLE_COPY_MOVE(IScheduledTickSystem);
+    };
+
+    //! @class ScheduledTickHandler
+    //! @brief Base class for objects that need to be ticked regularly, but not every frame.
+    //! Unlike AZ::TickBus handlers, which are called every frame, scheduled tick handlers are called at the frequency they
+    //! connected with, for instance 10 times per second. The ticks of all handlers are spread out over frames, so thousands of
+    //! low frequency handlers don't cost anything in the frames they are not due in. Scheduled ticks are dispatched on the
+    //! main thread at AZ::TICK_GAME.
+    class ScheduledTickHandler
+    {
+    public:
+        AZ_RTTI(ScheduledTickHandler, "{E3C90D47-8B16-4F2A-A5D1-6C0E9B7F3A84}");
+
+        ScheduledTickHandler() = default;
+        virtual ~ScheduledTickHandler();
+
+        //! Called at roughly the frequency the handler is connected with.
+        //! @param deltaTime The time in seconds since the handler last ticked, or since it connected.
+        //! @param time The current time.
+        virtual void OnScheduledTick(float deltaTime, ScriptTimePoint time) = 0;
+
+        //! Starts ticking this handler the given number of times per second.
+        void ScheduledTickConnect(float frequency, ScheduledTickImportance importance = ScheduledTickImportance::Normal);
+        void ScheduledTickDisconnect();
+        bool IsScheduledTickConnected() const;
+
+        //! Changes how often the handler ticks, for instance based on its distance to the camera.
+        void SetScheduledTickFrequency(float frequency);
+        float GetScheduledTickFrequency() const;
+        //! Returns the time in seconds between two ticks of this handler.
+        float GetScheduledTickInterval() const;
+
+        void SetScheduledTickImportance(ScheduledTickImportance importance);
+        ScheduledTickImportance GetScheduledTickImportance() const;
+
+        AZ_DISABLE_COPY_MOVE(ScheduledTickHandler);
+
+    private:
+        friend class ScheduledTickSystemComponent;
+
+        static constexpr u32 InvalidSlot = static_cast<u32>(-1);
+
+        double m_lastTickTime = 0.0; //!< Time of the last tick, in the time line of the scheduled tick system.
+        float m_frequency = 1.0f;
+        u32 m_slot = InvalidSlot; //!< Index into the handler list of the scheduled tick system while connected.
+        ScheduledTickImportance m_importance = ScheduledTickImportance::Normal;
+    };
+} // namespace AZ
@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Component/ScheduledTickSystemComponent.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+
+namespace AZ
+{
+    AZ_CVAR(uint32_t, sys_scheduledTickMaxPerFrame, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The maximum number of scheduled tick handlers to tick per frame. Handlers that are due beyond this limit are postponed to the "
+        "next frame, less important ones first. Critical handlers always tick. 0 means unlimited.");
+
+    void ScheduledTickSystemComponent::Reflect(ReflectContext* context)
+    {
+        if (SerializeContext* serializeContext = azrtti_cast<SerializeContext*>(context))
+        {
+            serializeContext->Class<ScheduledTickSystemComponent, Component>()
+                ->Version(1);
+        }
+    }
+
+    void ScheduledTickSystemComponent::GetProvidedServices(ComponentDescriptor::DependencyArrayType& provided)
+    {
+        provided.push_back(AZ_CRC_CE("ScheduledTickService"));
+    }
+
+    void ScheduledTickSystemComponent::GetIncompatibleServices(ComponentDescriptor::DependencyArrayType& incompatible)
+    {
+        incompatible.push_back(AZ_CRC_CE("ScheduledTickService"));
+    }
+
+    ScheduledTickSystemComponent::ScheduledTickSystemComponent()
+    {
+        AZ::Interface<IScheduledTickSystem>::Register(this);
+    }
+
+    ScheduledTickSystemComponent::~ScheduledTickSystemComponent()
+    {
+        // Handlers that are still connected can't reach this system anymore, so mark them as disconnected.
+        for (HandlerSlot& slot : m_slots)
+        {
+            if (slot.m_handler)
+            {
+                slot.m_handler->m_slot = ScheduledTickHandler::InvalidSlot;
+            }
+        }
+        Interface<IScheduledTickSystem>::Unregister(this);
+    }
+
+    void ScheduledTickSystemComponent::Activate()
+    {
+        TickBus::Handler::BusConnect();
+    }
+
+    void ScheduledTickSystemComponent::Deactivate()
+    {
+        TickBus::Handler::BusDisconnect();
+    }
+
+    void ScheduledTickSystemComponent::OnTick(float deltaTime, AZ::ScriptTimePoint time)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+
+        m_currentTime += deltaTime;
+
+        m_dueEntries.clear();
+        while (!m_queue.empty() && m_queue.front().m_dueTime <= m_currentTime)
+        {
+            AZStd::pop_heap(m_queue.begin(), m_queue.end(), CompareQueueEntries());
+            if (IsCurrent(m_queue.back()))
+            {
+                m_dueEntries.push_back(m_queue.back());
+            }
+            m_queue.pop_back();
+        }
+
+        const uint32_t maxTicks = sys_scheduledTickMaxPerFrame;
+        if (maxTicks != 0 && m_dueEntries.size() > maxTicks)
+        {
+            // Entries were collected in order of their due time, so the longest overdue of equally important handlers go first.
+            AZStd::stable_sort(m_dueEntries.begin(), m_dueEntries.end(),
+                [this](const QueueEntry& lhs, const QueueEntry& rhs)
+                {
+                    return m_slots[lhs.m_slot].m_handler->m_importance > m_slots[rhs.m_slot].m_handler->m_importance;
+                });
+        }
+
+        m_numTickedLastFrame = 0;
+        m_numPostponedLastFrame = 0;
+        uint32_t numLimitedTicks = 0; // Critical handlers don't count towards the limit.
+        for (const QueueEntry& entry : m_dueEntries)
+        {
+            // A handler that ticked earlier in this loop can disconnect or reschedule other handlers.
+            if (!IsCurrent(entry))
+            {
+                continue;
+            }
+
+            ScheduledTickHandler* handler = m_slots[entry.m_slot].m_handler;
+            if (handler->m_importance != ScheduledTickImportance::Critical)
+            {
+                if (maxTicks != 0 && numLimitedTicks >= maxTicks)
+                {
+                    Enqueue(entry.m_slot, m_currentTime);
+                    ++m_numPostponedLastFrame;
+                    continue;
+                }
+                ++numLimitedTicks;
+            }
+
+            // Queue the next tick before calling the handler so it can disconnect or change its frequency from within its tick.
+            // When falling behind by more than a full interval, skip the missed ticks instead of catching up on them.
+            const double interval = handler->GetScheduledTickInterval();
+            double nextDueTime = entry.m_dueTime + interval;
+            if (nextDueTime <= m_currentTime)
+            {
+                nextDueTime = m_currentTime + interval;
+            }
+            Enqueue(entry.m_slot, nextDueTime);
+
+            const float handlerDeltaTime = aznumeric_cast<float>(m_currentTime - handler->m_lastTickTime);
+            handler->m_lastTickTime = m_currentTime;
+            ++m_numTickedLastFrame;
+            handler->OnScheduledTick(handlerDeltaTime, time);
+        }
+    }
+
+    int ScheduledTickSystemComponent::GetTickOrder()
+    {
+        return AZ::TICK_GAME;
+    }
+
+    void ScheduledTickSystemComponent::Connect(ScheduledTickHandler& handler)
+    {
+        AZ_Assert(!handler.IsScheduledTickConnected(), "Scheduled tick handler is already connected.");
+        AZ_Assert(handler.m_frequency > 0.0f, "Scheduled tick frequency needs to be larger than zero.");
+
+        u32 slot;
+        if (!m_freeSlots.empty())
+        {
+            slot = m_freeSlots.back();
+            m_freeSlots.pop_back();
+        }
+        else
+        {
+            slot = aznumeric_cast<u32>(m_slots.size());
+            m_slots.emplace_back();
+        }
+        m_slots[slot].m_handler = &handler;
+        handler.m_slot = slot;
+        handler.m_lastTickTime = m_currentTime;
+        ++m_numHandlers;
+
+        // Offset the first tick by a fraction of the interval following the golden ratio sequence. This spreads any number of
+        // handlers with the same frequency evenly over the frames in their interval.
+        constexpr float GoldenRatioConjugate = 0.6180339887f;
+        Enqueue(slot, m_currentTime + m_nextPhase * handler.GetScheduledTickInterval());
+        m_nextPhase += GoldenRatioConjugate;
+        if (m_nextPhase >= 1.0f)
+        {
+            m_nextPhase -= 1.0f;
+        }
+    }
+
+    void ScheduledTickSystemComponent::Disconnect(ScheduledTickHandler& handler)
+    {
+        const u32 slot = handler.m_slot;
+        if (slot < m_slots.size() && m_slots[slot].m_handler == &handler)
+        {
+            // The queued entry of the handler is discarded when it reaches the top of the queue.
+            m_slots[slot].m_handler = nullptr;
+            m_slots[slot].m_generation++;
+            m_freeSlots.push_back(slot);
+            handler.m_slot = ScheduledTickHandler::InvalidSlot;
+            --m_numHandlers;
+        }
+    }
+
+    void ScheduledTickSystemComponent::Reschedule(ScheduledTickHandler& handler)
+    {
+        const u32 slot = handler.m_slot;
+        if (slot < m_slots.size() && m_slots[slot].m_handler == &handler)
+        {
+            m_slots[slot].m_generation++;
+            Enqueue(slot, AZStd::max(handler.m_lastTickTime + handler.GetScheduledTickInterval(), m_currentTime));
+        }
+    }
+
+    void ScheduledTickSystemComponent::EnumerateHandlers(const HandlerCallback& callback) const
+    {
+        for (const HandlerSlot& slot : m_slots)
+        {
+            if (slot.m_handler && !callback(*slot.m_handler))
+            {
+                return;
+            }
+        }
+    }
+
+    u32 ScheduledTickSystemComponent::GetNumTickedLastFrame() const
+    {
+        return m_numTickedLastFrame;
+    }
+
+    u32 ScheduledTickSystemComponent::GetNumPostponedLastFrame() const
+    {
+        return m_numPostponedLastFrame;
+    }
+
+    void ScheduledTickSystemComponent::DumpStats([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        AZLOG_INFO("ScheduledTickSystemComponent::HandlerCount = %u", m_numHandlers);
+        AZLOG_INFO("ScheduledTickSystemComponent::QueueSize = %u", aznumeric_cast<uint32_t>(m_queue.size()));
+        AZLOG_INFO("ScheduledTickSystemComponent::TickedLastFrame = %u", m_numTickedLastFrame);
+        AZLOG_INFO("ScheduledTickSystemComponent::PostponedLastFrame = %u", m_numPostponedLastFrame);
+    }
+
+    void ScheduledTickSystemComponent::Enqueue(u32 slot, double dueTime)
+    {
+        m_queue.push_back(QueueEntry{ dueTime, slot, m_slots[slot].m_generation });
+        AZStd::push_heap(m_queue.begin(), m_queue.end(), CompareQueueEntries());
+    }
+
+    bool ScheduledTickSystemComponent::IsCurrent(const QueueEntry& entry) const
+    {
+        const HandlerSlot& slot = m_slots[entry.m_slot];
+        return slot.m_handler != nullptr && slot.m_generation == entry.m_generation;
+    }
+} // namespace AZ
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/Component.h>
+#include <AzCore/Component/ScheduledTick.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    //! @class ScheduledTickSystemComponent
+    //! @brief Ticks all ScheduledTickHandlers at their requested frequency.
+    //! Every connected handler has a single entry in a priority queue sorted by the time it's due next, so a tick only touches
+    //! the handlers that are due in that frame.
+    class ScheduledTickSystemComponent
+        : public Component
+        , public TickBus::Handler
+        , public IScheduledTickSystem
+    {
+    public:
+        AZ_COMPONENT(ScheduledTickSystemComponent, "{0A6E3B59-F1D4-4C87-8B2E-94D7C5A13F60}", Component, IScheduledTickSystem);
+
+        static void Reflect(ReflectContext* context);
+        static void GetProvidedServices(ComponentDescriptor::DependencyArrayType& provided);
+        static void GetIncompatibleServices(ComponentDescriptor::DependencyArrayType& incompatible);
+
+        ScheduledTickSystemComponent();
+        ~ScheduledTickSystemComponent() override;
+
+        //! AZ::Component overrides.
+        //! @{
+        void Activate() override;
+        void Deactivate() override;
+        //! @}
+
+        //! AZ::TickBus::Handler overrides.
+        //! @{
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+        int GetTickOrder() override;
+        //! @}
+
+        //! IScheduledTickSystem interface
+        //! @{
+        void Connect(ScheduledTickHandler& handler) override;
+        void Disconnect(ScheduledTickHandler& handler) override;
+        void Reschedule(ScheduledTickHandler& handler) override;
+        void EnumerateHandlers(const HandlerCallback& callback) const override;
+        u32 GetNumTickedLastFrame() const override;
+        u32 GetNumPostponedLastFrame() const override;
+        //! @}
+
+        void DumpStats(const AZ::ConsoleCommandContainer& arguments);
+
+    private:
+        struct HandlerSlot
+        {
+            ScheduledTickHandler* m_handler = nullptr;
+            u32 m_generation = 0; //!< Incremented every time the queued entry of this slot becomes outdated.
+        };
+
+        struct QueueEntry
+        {
+            double m_dueTime;
+            u32 m_slot;
+            u32 m_generation;
+        };
+
+        struct CompareQueueEntries
+        {
+            bool operator()(const QueueEntry& lhs, const QueueEntry& rhs) const
+            {
+                return lhs.m_dueTime > rhs.m_dueTime;
+            }
+        };
+
+        void Enqueue(u32 slot, double dueTime);
+        bool IsCurrent(const QueueEntry& entry) const;
+
+        // Bind the DumpStats member function to the console as 'ScheduledTickSystemComponent.DumpStats'
+        AZ_CONSOLEFUNC(ScheduledTickSystemComponent, DumpStats, AZ::ConsoleFunctorFlags::Null, "Dump ScheduledTickSystemComponent stats to the console window");
+
+        AZStd::vector<HandlerSlot> m_slots;
+        AZStd::vector<u32> m_freeSlots;
+        AZStd::vector<QueueEntry> m_queue; //!< Min-heap on the due time. Outdated entries are skipped when they reach the top.
+        AZStd::vector<QueueEntry> m_dueEntries;
+        double m_currentTime = 0.0; //!< Accumulated delta time of all ticks.
+        float m_nextPhase = 0.0f;
+        u32 m_numHandlers = 0;
+        u32 m_numTickedLastFrame = 0;
+        u32 m_numPostponedLastFrame = 0;
+    };
+} // namespace AZ
@@ -17,7 +17,6 @@
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/IO/SystemFile.h>
-#include <cctype>
 
 namespace AZ
 {
@@ -113,6 +112,51 @@ namespace AZ
         return DispatchCommand(command, commandArgs, silentMode, invokedFrom, requiredSet, requiredClear);
     }
 
+    size_t Console::PerformCommands
+    (
+        AZStd::string_view commands,
+        ConsoleSilentMode silentMode,
+        ConsoleInvokedFrom invokedFrom,
+        ConsoleFunctorFlags requiredSet,
+        ConsoleFunctorFlags requiredClear
+    )
+    {
+        size_t executedCount = 0;
+        ConsoleCommandContainer commandArgsView;
+        constexpr AZStd::string_view lineSeparators = "\n\r";
+        constexpr AZStd::string_view commandSeparators = " \t";
+        while (AZStd::optional<AZStd::string_view> line = StringFunc::TokenizeNext(commands, lineSeparators))
+        {
+            // The tokens reference the commands buffer, so the lines are split without copying them
+            AZStd::string_view commandView;
+            commandArgsView.clear();
+            auto ConvertCommandStringToArray = [&commandView, &commandArgsView](AZStd::string_view token)
+            {
+                if (commandView.empty())
+                {
+                    commandView = token;
+                }
+                else
+                {
+                    commandArgsView.emplace_back(token);
+                }
+            };
+            StringFunc::TokenizeVisitor(*line, ConvertCommandStringToArray, commandSeparators);
+
+            if (commandView.empty() || commandView.starts_with('#'))
+            {
+                continue;
+            }
+
+            if (DispatchCommand(commandView, commandArgsView, silentMode, invokedFrom, requiredSet, requiredClear))
+            {
+                ++executedCount;
+            }
+        }
+
+        return executedCount;
+    }
+
     void Console::ExecuteConfigFile(AZStd::string_view configFileName)
     {
         auto settingsRegistry = AZ::SettingsRegistry::Get();
@@ -181,10 +225,7 @@ namespace AZ
 
     ConsoleFunctorBase* Console::FindCommand(const char* command)
     {
-        CVarFixedString lowerName(command);
-        AZStd::transform(lowerName.begin(), lowerName.end(), lowerName.begin(), [](char value) { return std::tolower(value); });
-
-        CommandMap::iterator iter = m_commands.find(lowerName);
+        CommandMap::iterator iter = m_commands.find(GetCommandKey(command));
         if (iter != m_commands.end())
         {
             for (ConsoleFunctorBase* curr : iter->second)
@@ -194,6 +235,12 @@ namespace AZ
                     // Filter functors marked as invisible
                     continue;
                 }
+
+                if (!StringFunc::Equal(curr->GetName(), command, false))
+                {
+                    // Filter functors whose name only shares the command key
+                    continue;
+                }
                 return curr;
             }
         }
@@ -257,7 +304,19 @@ namespace AZ
     {
         for (auto& curr : m_commands)
         {
-            visitor(curr.second.front());
+            // Visit the first functor of every name in the bucket
+            for (auto functorIter = curr.second.begin(); functorIter != curr.second.end(); ++functorIter)
+            {
+                const char* functorName = (*functorIter)->GetName();
+                auto FunctorHasSameName = [functorName](const ConsoleFunctorBase* functor)
+                {
+                    return StringFunc::Equal(functor->GetName(), functorName, false);
+                };
+                if (AZStd::find_if(curr.second.begin(), functorIter, FunctorHasSameName) == functorIter)
+                {
+                    visitor(*functorIter);
+                }
+            }
         }
     }
 
@@ -269,9 +328,8 @@ namespace AZ
             return;
         }
 
-        CVarFixedString lowerName = functor->GetName();
-        AZStd::transform(lowerName.begin(), lowerName.end(), lowerName.begin(), [](char value) { return std::tolower(value); });
-        CommandMap::iterator iter = m_commands.find(lowerName);
+        const Crc32 commandKey = GetCommandKey(functor->GetName());
+        CommandMap::iterator iter = m_commands.find(commandKey);
         if (iter != m_commands.end())
         {
             // Validate we haven't already added this cvar
@@ -283,9 +341,14 @@ namespace AZ
             }
 
             // If multiple cvars are registered with the same name, validate that the types and flags match
-            if (!iter->second.empty())
+            auto FunctorHasSameName = [functor](const ConsoleFunctorBase* curr)
             {
-                ConsoleFunctorBase* front = iter->second.front();
+                return StringFunc::Equal(curr->GetName(), functor->GetName(), false);
+            };
+            iter2 = AZStd::find_if(iter->second.begin(), iter->second.end(), FunctorHasSameName);
+            if (iter2 != iter->second.end())
+            {
+                ConsoleFunctorBase* front = *iter2;
                 if (front->GetFlags() != functor->GetFlags() || front->GetTypeId() != functor->GetTypeId())
                 {
                     AZ_Assert(false, "Mismatched console functor types registered under the same name");
@@ -299,7 +362,7 @@ namespace AZ
                 }
             }
         }
-        m_commands[lowerName].emplace_back(functor);
+        m_commands[commandKey].emplace_back(functor);
         functor->Link(m_head);
         functor->m_console = this;
     }
@@ -312,9 +375,7 @@ namespace AZ
             return;
         }
 
-        CVarFixedString lowerName = functor->GetName();
-        AZStd::transform(lowerName.begin(), lowerName.end(), lowerName.begin(), [](char value) { return std::tolower(value); });
-        CommandMap::iterator iter = m_commands.find(lowerName);
+        CommandMap::iterator iter = m_commands.find(GetCommandKey(functor->GetName()));
         if (iter != m_commands.end())
         {
             AZStd::vector<ConsoleFunctorBase*>::iterator iter2 = AZStd::find(iter->second.begin(), iter->second.end(), functor);
@@ -322,6 +383,11 @@ namespace AZ
             {
                 iter->second.erase(iter2);
             }
+
+            if (iter->second.empty())
+            {
+                m_commands.erase(iter);
+            }
         }
         functor->Unlink(m_head);
         functor->m_console = nullptr;
@@ -388,14 +454,17 @@ namespace AZ
         bool result = false;
         ConsoleFunctorFlags flags = ConsoleFunctorFlags::Null;
 
-        CVarFixedString lowerName(command);
-        AZStd::transform(lowerName.begin(), lowerName.end(), lowerName.begin(), [](char value) { return std::tolower(value); });
-
-        CommandMap::iterator iter = m_commands.find(lowerName);
+        CommandMap::iterator iter = m_commands.find(GetCommandKey(command));
         if (iter != m_commands.end())
         {
             for (ConsoleFunctorBase* curr : iter->second)
             {
+                if (!StringFunc::Equal(curr->GetName(), command, false))
+                {
+                    // Skip functors whose name only shares the command key
+                    continue;
+                }
+
                 if ((curr->GetFlags() & requiredSet) != requiredSet)
                 {
                     AZLOG_WARN("%s failed required set flag check\n", curr->m_name);
@@ -452,6 +521,11 @@ namespace AZ
         return result;
     }
 
+    Crc32 Console::GetCommandKey(AZStd::string_view command)
+    {
+        return Crc32(command.data(), command.size(), true);
+    }
+
     struct ConsoleCommandKeyNotificationHandler
     {
         ConsoleCommandKeyNotificationHandler(AZ::SettingsRegistryInterface& registry, Console& console)
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzCore/Console/IConsole.h>
+#include <AzCore/Math/Crc.h>
 #include <AzCore/Memory/OSAllocator.h>
 #include <AzCore/Settings/SettingsRegistry.h>
 #include <AzCore/std/functional.h>
@@ -58,6 +59,14 @@ namespace AZ
             ConsoleFunctorFlags requiredSet = ConsoleFunctorFlags::Null,
             ConsoleFunctorFlags requiredClear = ConsoleFunctorFlags::ReadOnly
         ) override;
+        size_t PerformCommands
+        (
+            AZStd::string_view commands,
+            ConsoleSilentMode silentMode = ConsoleSilentMode::NotSilent,
+            ConsoleInvokedFrom invokedFrom = ConsoleInvokedFrom::AzConsole,
+            ConsoleFunctorFlags requiredSet = ConsoleFunctorFlags::Null,
+            ConsoleFunctorFlags requiredClear = ConsoleFunctorFlags::ReadOnly
+        ) override;
         void ExecuteConfigFile(AZStd::string_view configFileName) override;
         void ExecuteCommandLine(const AZ::CommandLine& commandLine) override;
         bool HasCommand(const char* command) override;
@@ -74,6 +83,10 @@ namespace AZ
 
         void MoveFunctorsToDeferredHead(ConsoleFunctorBase*& deferredHead);
 
+        //! Returns the key of a command in the command map, the case insensitive crc of the command name.
+        //! Computing the key doesn't copy the name, so lookups from string views don't allocate.
+        static Crc32 GetCommandKey(AZStd::string_view command);
+
         //! Invokes a single console command, optionally returning the command output.
         //! @param command       the function to invoke
         //! @param inputs        the set of inputs to provide the function
@@ -95,7 +108,8 @@ namespace AZ
         AZ_DISABLE_COPY_MOVE(Console);
 
         ConsoleFunctorBase* m_head;
-        using CommandMap = AZStd::unordered_map<CVarFixedString, AZStd::vector<ConsoleFunctorBase*>>;
+        //! Functors by command key, functors with different names whose keys collide share a bucket and are told apart by name
+        using CommandMap = AZStd::unordered_map<Crc32, AZStd::vector<ConsoleFunctorBase*>>;
         CommandMap m_commands;
         AZ::SettingsRegistryInterface::NotifyEventHandler m_consoleCommandKeyHandler;
 
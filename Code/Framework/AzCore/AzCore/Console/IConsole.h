@@ -86,6 +86,24 @@ namespace AZ
             ConsoleFunctorFlags requiredClear = ConsoleFunctorFlags::ReadOnly
         ) = 0;
 
+        //! Invokes every command in a buffer containing one command per line, such as a script or a batch of commands
+        //! received from a remote tool. The buffer is tokenized in place and each line is dispatched in order,
+        //! empty lines and lines starting with '#' are skipped.
+        //! @param commands      the buffer of newline separated commands to execute
+        //! @param silentMode    if true, logs will be suppressed during command execution
+        //! @param invokedFrom   the source point that initiated console invocation
+        //! @param requiredSet   a set of flags that must be set on the functor for it to execute
+        //! @param requiredClear a set of flags that must *NOT* be set on the functor for it to execute
+        //! @return the number of commands that were executed successfully
+        virtual size_t PerformCommands
+        (
+            AZStd::string_view commands,
+            ConsoleSilentMode silentMode = ConsoleSilentMode::NotSilent,
+            ConsoleInvokedFrom invokedFrom = ConsoleInvokedFrom::AzConsole,
+            ConsoleFunctorFlags requiredSet = ConsoleFunctorFlags::Null,
+            ConsoleFunctorFlags requiredClear = ConsoleFunctorFlags::ReadOnly
+        ) = 0;
+
         //! Loads and executes the specified config file.
         //! @param configFileName the filename of the config file to load and execute
         virtual void ExecuteConfigFile(AZStd::string_view configFileName) = 0;
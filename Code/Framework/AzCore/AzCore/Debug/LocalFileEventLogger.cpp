@@ -116,6 +116,11 @@ namespace AZ::Debug
         {
             m_threadDataBlocks.back()->Reset(nullptr);
         }
+
+        for (ThreadData* threadData : m_freeThreadData)
+        {
+            delete threadData;
+        }
     }
 
     bool LocalFileEventLogger::Start(const AZ::IO::Path& filePath)
@@ -127,6 +132,15 @@ namespace AZ::Debug
         {
             LogHeader defaultHeader;
             m_file.Write(&defaultHeader, sizeof(LogHeader));
+
+            AZStd::lock_guard<AZStd::mutex> writerLock(m_writerMutex);
+            if (!m_isWriterEnabled)
+            {
+                m_isWriterEnabled = true;
+                AZStd::thread_desc td;
+                td.m_name = "LocalFileEventLogger Writer Thread";
+                m_writerThread = AZStd::thread(AZStd::bind(&LocalFileEventLogger::AsyncWritePump, this), &td);
+            }
             return true;
         }
         return false;
@@ -173,6 +187,16 @@ namespace AZ::Debug
     void LocalFileEventLogger::Stop()
     {
         Flush();
+
+        if (m_writerThread.joinable())
+        {
+            m_writerMutex.lock();
+            m_isWriterEnabled = false;
+            m_signal.notify_all();
+            m_writerMutex.unlock();
+            m_writerThread.join();
+        }
+
         m_file.Close();
     }
 
@@ -181,7 +205,7 @@ namespace AZ::Debug
         // Create new storage for a thread to write to. This will replace the storage already on the thread
         // so it can continue to write and is not blocked during a flush. The data that was swapped in can
         // then again be used for the next thread.
-        ThreadData* replacementData = new ThreadData();
+        ThreadData* replacementData = AcquireThreadData(0);
         bool flushedThread[MaxThreadCount] = {};
 
         {
@@ -222,18 +246,22 @@ namespace AZ::Debug
                         continue;
                     }
 
-                    {
-                        AZStd::scoped_lock fileWriteGuardLock(m_fileWriteGuard);
-                        WriteCacheToDisk(*threadData);
-                    }
-                    replacementData = threadData;
+                    QueueWrite(threadData);
+                    replacementData = AcquireThreadData(0);
                     flushedThread[i] = true;
                 }
             } while (!allFlushed);
+
+            // Wait for the writer thread to write everything queued so far, which includes the buffers swapped out above.
+            {
+                AZStd::unique_lock<AZStd::mutex> writerLock(m_writerMutex);
+                m_writesDoneSignal.wait(writerLock, [this]() { return m_writeQueue.empty() && !m_isWriting; });
+                m_freeThreadData.push_back(replacementData);
+            }
+
+            AZStd::scoped_lock fileWriteGuardLock(m_fileWriteGuard);
             m_file.Flush();
         }
-
-        delete replacementData;
     }
 
     void* LocalFileEventLogger::RecordEventBegin(EventNameHash id, uint16_t size, uint16_t flags)
@@ -247,8 +275,10 @@ namespace AZ::Debug
         uint32_t writeSize = AZ_SIZE_ALIGN_UP(sizeof(EventHeader) + size, EventBoundary);
         if (threadData->m_usedBytes + writeSize >= ThreadData::BufferSize)
         {
-            AZStd::scoped_lock lock(m_fileWriteGuard);
-            WriteCacheToDisk(*threadData);
+            // Continue in a fresh buffer while the full one is written
+            ThreadData* freshData = AcquireThreadData(threadData->m_threadId);
+            QueueWrite(threadData);
+            threadData = freshData;
         }
 
         char* eventBuffer = (threadData->m_buffer + threadData->m_usedBytes);
@@ -304,6 +334,83 @@ namespace AZ::Debug
         threadData.m_usedBytes = sizeof(Prolog); // keep enough room for the next chunk's prolog
     }
 
+    void LocalFileEventLogger::QueueWrite(ThreadData* threadData)
+    {
+        {
+            AZStd::lock_guard<AZStd::mutex> writerLock(m_writerMutex);
+            if (m_isWriterEnabled)
+            {
+                m_writeQueue.push_back(threadData);
+                m_signal.notify_one();
+                return;
+            }
+        }
+
+        {
+            AZStd::scoped_lock fileWriteGuardLock(m_fileWriteGuard);
+            WriteCacheToDisk(*threadData);
+        }
+
+        AZStd::lock_guard<AZStd::mutex> writerLock(m_writerMutex);
+        m_freeThreadData.push_back(threadData);
+    }
+
+    auto LocalFileEventLogger::AcquireThreadData(uint64_t threadId) -> ThreadData*
+    {
+        ThreadData* threadData = nullptr;
+        {
+            AZStd::lock_guard<AZStd::mutex> writerLock(m_writerMutex);
+            if (!m_freeThreadData.empty())
+            {
+                threadData = m_freeThreadData.back();
+                m_freeThreadData.pop_back();
+            }
+        }
+
+        if (!threadData)
+        {
+            // Deliberately using system memory instead of regular allocators. If debug allocators
+            // are available in the future those should be used instead.
+            threadData = new ThreadData();
+        }
+        threadData->m_threadId = threadId;
+        return threadData;
+    }
+
+    void LocalFileEventLogger::AsyncWritePump()
+    {
+        AZStd::unique_lock<AZStd::mutex> signalLock(m_writerMutex);
+        while (true)
+        {
+            if (!m_writeQueue.empty())
+            {
+                m_writeBatch.swap(m_writeQueue);
+                m_isWriting = true;
+                signalLock.unlock();
+
+                {
+                    AZStd::scoped_lock fileWriteGuardLock(m_fileWriteGuard);
+                    for (ThreadData* threadData : m_writeBatch)
+                    {
+                        WriteCacheToDisk(*threadData);
+                    }
+                }
+
+                signalLock.lock();
+                m_freeThreadData.insert(m_freeThreadData.end(), m_writeBatch.begin(), m_writeBatch.end());
+                m_writeBatch.clear();
+                m_isWriting = false;
+                m_writesDoneSignal.notify_all();
+                continue;
+            }
+            if (!m_isWriterEnabled)
+            {
+                break;
+            }
+            m_signal.wait(signalLock);
+        }
+    }
+
     auto LocalFileEventLogger::GetThreadStorage()->ThreadStorage&
     {
         thread_local static ThreadStorage s_storage;
@@ -333,29 +440,20 @@ namespace AZ::Debug
 
             // Save to access thread data because of the lock.
             ThreadData* data = m_data;
-            if (data->m_usedBytes > 0)
-            {
-                m_owner->WriteCacheToDisk(*data);
-            }
+            m_owner->QueueWrite(data);
 
             auto it = AZStd::find(m_owner->m_threadDataBlocks.begin(), m_owner->m_threadDataBlocks.end(), this);
             if (it != m_owner->m_threadDataBlocks.end())
             {
                 m_owner->m_threadDataBlocks.erase(it);
             }
-
-            delete data;
         }
 
         m_owner = owner;
 
         if (m_owner)
         {
-            // Deliberately using system memory instead of regular allocators. If debug allocators
-            // are available in the future those should be used instead.
-            ThreadData* data = new ThreadData();
-            data->m_threadId = azlossy_caster(AZStd::hash<AZStd::thread_id>{}(AZStd::this_thread::get_id()));
-            m_data = data;
+            m_data = m_owner->AcquireThreadData(azlossy_caster(AZStd::hash<AZStd::thread_id>{}(AZStd::this_thread::get_id())));
 
             AZStd::scoped_lock guard(m_owner->m_fileGuard);
             m_owner->m_threadDataBlocks.push_back(this);
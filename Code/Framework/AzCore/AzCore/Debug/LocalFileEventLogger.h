@@ -13,10 +13,13 @@
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/IO/SystemFile.h>
+#include <AzCore/Memory/OSAllocator.h>
 #include <AzCore/std/containers/fixed_vector.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/condition_variable.h>
 #include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/string/string_view.h>
 
 namespace AZ::Debug
@@ -52,6 +55,8 @@ namespace AZ::Debug
     };
 
 
+    //! Records events into per thread buffers. Filled buffers are written to the log file by a writer thread
+    //! while the logger is started, so recording threads don't wait on the file or on each other.
     class LocalFileEventLogger
         : public Interface<IEventLogger>::Registrar
     {
@@ -95,6 +100,15 @@ namespace AZ::Debug
 
         void WriteCacheToDisk(ThreadData& threadData);
 
+        //! Hands a buffer to the writer thread, or writes it right away when the writer thread isn't running.
+        //! Buffers are written in the order they are queued and recycled afterwards.
+        void QueueWrite(ThreadData* threadData);
+
+        //! Returns a recycled buffer, or a new one when none are available.
+        ThreadData* AcquireThreadData(uint64_t threadId);
+
+        void AsyncWritePump();
+
         ThreadStorage& GetThreadStorage();
 
         AZStd::fixed_vector<ThreadStorage*, MaxThreadCount> m_threadDataBlocks;
@@ -102,5 +116,16 @@ namespace AZ::Debug
         AZ::IO::SystemFile m_file;
         AZStd::recursive_mutex m_fileGuard;
         AZStd::recursive_mutex m_fileWriteGuard;
+
+        using ThreadDataList = AZStd::vector<ThreadData*, AZ::OSStdAllocator>;
+        ThreadDataList m_writeQueue;
+        ThreadDataList m_writeBatch; // only used by the writer thread
+        ThreadDataList m_freeThreadData;
+        AZStd::mutex m_writerMutex; // guards m_writeQueue, m_freeThreadData, m_isWriterEnabled and m_isWriting
+        AZStd::condition_variable m_signal;
+        AZStd::condition_variable m_writesDoneSignal;
+        AZStd::thread m_writerThread;
+        bool m_isWriterEnabled = false;
+        bool m_isWriting = false;
     };
 } // namespace AZ::Debug
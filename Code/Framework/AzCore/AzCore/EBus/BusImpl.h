@@ -228,6 +228,32 @@ namespace AZ
              * @param id The ID of the EBus address that the pointer will be bound to.
              */
             static void Bind(BusPtr& ptr, const BusIdType& id);
+
+            /**
+             * Sends an event directly to the handler at a cached address.
+             * Only available on buses with AZ::EBusHandlerPolicy::Single. The handler is read from the
+             * address, so the call costs little more than a virtual function call: there's no address
+             * lookup, and no callstack tracking. The context is only locked if the bus has a MutexType
+             * and doesn't use LocklessDispatch.
+             * Because the callstack isn't tracked, GetCurrentBusId() can't be used by the handler.
+             * Falls back to Event() while routers are connected to the bus.
+             * @param ptr Cached address ID, see Bind().
+             * @param func Function pointer of the event to dispatch.
+             * @param args Function arguments that are passed to the handler.
+             */
+            template <class Function, class... ArgsT>
+            static void EventDirect(const BusPtr& ptr, Function&& func, ArgsT&&... args);
+
+            /**
+             * Sends an event directly to the handler at a cached address and receives the result.
+             * @see EventDirect()
+             * @param results Variable that will receive the result of the event.
+             * @param ptr Cached address ID, see Bind().
+             * @param func Function pointer of the event to dispatch.
+             * @param args Function arguments that are passed to the handler.
+             */
+            template <class Results, class Function, class... ArgsT>
+            static void EventResultDirect(Results& results, const BusPtr& ptr, Function&& func, ArgsT&&... args);
         };
 
         /**
@@ -414,6 +440,18 @@ namespace AZ
             template <class Function, class ... InputArgs>
             static void QueueBroadcastReverse(Function&& func, InputArgs&& ... args);
 
+            /**
+             * Enqueues an asynchronous event to dispatch to all handlers, replacing the arguments of the same event
+             * if it's already queued. Use this for high frequency notifications where only the latest value matters.
+             * The event keeps the position of the first queued call, but is sent with the arguments of the latest call.
+             * Coalesced events are stored in reusable buffers instead of functions, so the arguments must be trivially
+             * copyable. They are executed after the other queued events when ExecuteQueuedEvents() is called.
+             * @param func          Function pointer of the event to dispatch.
+             * @param args          Function arguments that are passed to each handler.
+             */
+            template <class Function, class ... InputArgs>
+            static void QueueBroadcastCoalesced(Function&& func, InputArgs&& ... args);
+
             /**
              * Enqueues an arbitrary callable function to be executed asynchronously.
              * The function is not executed until ExecuteQueuedEvents() is called.
@@ -497,6 +535,20 @@ namespace AZ
             template <class Function, class ... InputArgs>
             static void QueueEvent(const BusPtr& ptr, Function&& func, InputArgs&& ... args);
 
+            /**
+             * Enqueues an asynchronous event to dispatch to handlers at a specific address, replacing the arguments of
+             * the same event if it's already queued for that address. Use this for high frequency notifications where
+             * only the latest value matters, such as transform changes.
+             * The event keeps the position of the first queued call, but is sent with the arguments of the latest call.
+             * Coalesced events are stored in reusable buffers instead of functions, so the address ID and arguments
+             * must be trivially copyable. They are executed after the other queued events when ExecuteQueuedEvents() is called.
+             * @param id            Address ID. Handlers that are connected to this ID will receive the event.
+             * @param func          Function pointer of the event to dispatch.
+             * @param args          Function arguments that are passed to each handler.
+             */
+            template <class Function, class ... InputArgs>
+            static void QueueEventCoalesced(const BusIdType& id, Function&& func, InputArgs&& ... args);
+
             /**
              * Helper to queue an event in reverse by BusIdType only when funciton queueing is enabled
              * @param id            Address ID. Handlers that are connected to this ID will receive the event.
@@ -611,6 +663,52 @@ namespace AZ
             context.m_buses.Bind(ptr, id);
         }
 
+        template <class Bus, class Traits>
+        template <class Function, class... ArgsT>
+        inline void EBusEventer<Bus, Traits>::EventDirect(const BusPtr& ptr, Function&& func, ArgsT&&... args)
+        {
+            static_assert(Traits::Traits::HandlerPolicy == EBusHandlerPolicy::Single, "EventDirect is only supported on buses with a single handler per address");
+            if (ptr)
+            {
+                auto* context = Bus::GetContext(false);
+                EBUS_ASSERT(context, "Internal error: context deleted with bind ptr outstanding.");
+                if (context->m_routing.m_routers.size())
+                {
+                    Bus::Event(ptr, AZStd::forward<Function>(func), AZStd::forward<ArgsT>(args)...);
+                    return;
+                }
+
+                typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                if (auto* handler = ptr->m_interface)
+                {
+                    Traits::Traits::EventProcessingPolicy::Call(AZStd::forward<Function>(func), handler, AZStd::forward<ArgsT>(args)...);
+                }
+            }
+        }
+
+        template <class Bus, class Traits>
+        template <class Results, class Function, class... ArgsT>
+        inline void EBusEventer<Bus, Traits>::EventResultDirect(Results& results, const BusPtr& ptr, Function&& func, ArgsT&&... args)
+        {
+            static_assert(Traits::Traits::HandlerPolicy == EBusHandlerPolicy::Single, "EventResultDirect is only supported on buses with a single handler per address");
+            if (ptr)
+            {
+                auto* context = Bus::GetContext(false);
+                EBUS_ASSERT(context, "Internal error: context deleted with bind ptr outstanding.");
+                if (context->m_routing.m_routers.size())
+                {
+                    Bus::EventResult(results, ptr, AZStd::forward<Function>(func), AZStd::forward<ArgsT>(args)...);
+                    return;
+                }
+
+                typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
+                if (auto* handler = ptr->m_interface)
+                {
+                    Traits::Traits::EventProcessingPolicy::CallResult(results, AZStd::forward<Function>(func), handler, AZStd::forward<ArgsT>(args)...);
+                }
+            }
+        }
+
         template <class Bus, class Traits>
         typename Traits::InterfaceType * EBusEventEnumerator<Bus, Traits>::FindFirstHandler(const BusIdType& id)
         {
@@ -690,6 +788,48 @@ namespace AZ
                     Validator::Validate();
                 }
             };
+
+            // Calls a coalesced broadcast stored as [function][arguments]
+            template <class Bus, class Function, class... Args>
+            struct CoalescedBroadcastInvoker
+            {
+                using Packer = AZ::Internal::CoalescedEventPacker<Function, Args...>;
+                static constexpr size_t KeySize = sizeof(Function);
+
+                static void Invoke(const AZ::u8* payload)
+                {
+                    InvokeImpl(payload, AZStd::make_index_sequence<sizeof...(Args)>());
+                }
+
+                template <size_t... ArgIndices>
+                static void InvokeImpl([[maybe_unused]] const AZ::u8* payload, AZStd::index_sequence<ArgIndices...>)
+                {
+                    AZ::Internal::CoalescedEventValue<Function> func(payload);
+                    Bus::Broadcast(func.Get(), AZ::Internal::CoalescedEventValue<Args>(payload + Packer::template GetOffset<ArgIndices + 1>()).Get()...);
+                }
+            };
+
+            // Calls a coalesced event stored as [function][address id][arguments]
+            template <class Bus, class Function, class... Args>
+            struct CoalescedEventInvoker
+            {
+                using BusIdType = typename Bus::BusIdType;
+                using Packer = AZ::Internal::CoalescedEventPacker<Function, BusIdType, Args...>;
+                static constexpr size_t KeySize = sizeof(Function) + sizeof(BusIdType);
+
+                static void Invoke(const AZ::u8* payload)
+                {
+                    InvokeImpl(payload, AZStd::make_index_sequence<sizeof...(Args)>());
+                }
+
+                template <size_t... ArgIndices>
+                static void InvokeImpl(const AZ::u8* payload, AZStd::index_sequence<ArgIndices...>)
+                {
+                    AZ::Internal::CoalescedEventValue<Function> func(payload);
+                    AZ::Internal::CoalescedEventValue<BusIdType> id(payload + sizeof(Function));
+                    Bus::Event(id.Get(), func.Get(), AZ::Internal::CoalescedEventValue<Args>(payload + Packer::template GetOffset<ArgIndices + 2>()).Get()...);
+                }
+            };
         }
 
         template <class Bus, class Traits>
@@ -818,6 +958,52 @@ namespace AZ
             Bus::QueueFunction(static_cast<Broadcaster>(&Bus::BroadcastReverse), AZStd::forward<Function>(func), AZStd::forward<InputArgs>(args)...);
         }
 
+        template <class Bus, class Traits>
+        template <class Function, class ... InputArgs>
+        inline void EBusBroadcastQueue<Bus, Traits>::QueueBroadcastCoalesced(Function&& func, InputArgs&& ... args)
+        {
+            Internal::QueueFunctionArgumentValidator<AZStd::decay_t<Function>, false>::Validate();
+            using Invoker = Internal::CoalescedBroadcastInvoker<Bus, AZStd::decay_t<Function>, AZStd::decay_t<InputArgs>...>;
+
+            auto& context = Bus::GetOrCreateContext(false);
+            if (context.m_queue.IsActive())
+            {
+                AZ::u8 payload[Invoker::Packer::Size];
+                Invoker::Packer::Write(payload, func, args...);
+
+                AZStd::scoped_lock<decltype(context.m_queue.m_messagesMutex)> messageLock(context.m_queue.m_messagesMutex);
+                context.m_queue.m_coalescedMessages.Queue(&Invoker::Invoke, payload, sizeof(payload), Invoker::KeySize);
+            }
+            else
+            {
+                AZ_Warning("EBus", false, "Unable to queue event onto EBus.  This may be due to a previous call to AllowFunctionQueuing(false)."
+                    "  Hint: This is often disabled during shutdown of a ComponentApplication");
+            }
+        }
+
+        template <class Bus, class Traits>
+        template <class Function, class ... InputArgs>
+        inline void EBusEventQueue<Bus, Traits>::QueueEventCoalesced(const BusIdType& id, Function&& func, InputArgs&& ... args)
+        {
+            Internal::QueueFunctionArgumentValidator<AZStd::decay_t<Function>, false>::Validate();
+            using Invoker = Internal::CoalescedEventInvoker<Bus, AZStd::decay_t<Function>, AZStd::decay_t<InputArgs>...>;
+
+            auto& context = Bus::GetOrCreateContext(false);
+            if (context.m_queue.IsActive())
+            {
+                AZ::u8 payload[Invoker::Packer::Size];
+                Invoker::Packer::Write(payload, func, id, args...);
+
+                AZStd::scoped_lock<decltype(context.m_queue.m_messagesMutex)> messageLock(context.m_queue.m_messagesMutex);
+                context.m_queue.m_coalescedMessages.Queue(&Invoker::Invoke, payload, sizeof(payload), Invoker::KeySize);
+            }
+            else
+            {
+                AZ_Warning("EBus", false, "Unable to queue event onto EBus.  This may be due to a previous call to AllowFunctionQueuing(false)."
+                    "  Hint: This is often disabled during shutdown of a ComponentApplication");
+            }
+        }
+
 #undef EBUS_DO_ROUTING
 
         template <class Bus, class Traits>
@@ -63,16 +63,7 @@ namespace AZ
         TimeMs startTime = GetElapsedTimeMs();
         bool usingTimeslice = bg_maxScheduledEventProcessTimeMs != TimeMs{ 0 };
 
-        while (!m_queue.empty())
-        {
-            ScheduledEventHandle* handle = m_queue.top();
-            if (handle->GetExecuteTimeMs() > startTime)
-            {
-                break;
-            }
-            m_queue.pop();
-            m_pendingQueue.push(handle);
-        }
+        AdvanceWheel(startTime);
 
         while (!m_pendingQueue.empty())
         {
@@ -111,7 +102,7 @@ namespace AZ
         const bool ownsScheduledEvent = false;
         *(timedEvent->m_handle) = ScheduledEventHandle(TimeMs(currentMilliseconds + durationMs), durationMs, timedEvent, ownsScheduledEvent);
         timedEvent->m_timeInserted = currentMilliseconds;
-        m_queue.push(timedEvent->m_handle);
+        ScheduleHandle(timedEvent->m_handle, currentMilliseconds);
         return timedEvent->m_handle;
     }
 
@@ -127,7 +118,7 @@ namespace AZ
         const bool ownsScheduledEvent = true;
         *(timedEvent->m_handle) = ScheduledEventHandle(TimeMs(currentMilliseconds + durationMs), durationMs, timedEvent, ownsScheduledEvent);
         timedEvent->m_timeInserted = currentMilliseconds;
-        m_queue.push(timedEvent->m_handle);
+        ScheduleHandle(timedEvent->m_handle, currentMilliseconds);
     }
 
     AZStd::size_t EventSchedulerSystemComponent::GetHandleCount() const
@@ -142,7 +133,7 @@ namespace AZ
 
     AZStd::size_t EventSchedulerSystemComponent::GetQueueSize() const
     {
-        return m_queue.size();
+        return m_wheelSize;
     }
 
     void EventSchedulerSystemComponent::DumpStats([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
@@ -197,4 +188,81 @@ namespace AZ
         }
         m_freeHandles.push_back(handle);
     }
+
+    void EventSchedulerSystemComponent::ScheduleHandle(ScheduledEventHandle* handle, TimeMs currentTimeMs)
+    {
+        if (m_wheelSize == 0 && currentTimeMs > m_wheelTimeMs)
+        {
+            m_wheelTimeMs = currentTimeMs;
+        }
+        ++m_wheelSize;
+        InsertIntoWheel(handle);
+    }
+
+    void EventSchedulerSystemComponent::InsertIntoWheel(ScheduledEventHandle* handle)
+    {
+        const uint64_t wheelTime = static_cast<uint64_t>(m_wheelTimeMs);
+        // Events that are already due expire with the next slot
+        const uint64_t executeTime = AZStd::max(static_cast<uint64_t>(handle->GetExecuteTimeMs()), wheelTime);
+        for (uint32_t level = 0; level < WheelLevelCount; ++level)
+        {
+            const uint32_t revolutionShift = WheelSlotBits * (level + 1);
+            if ((executeTime >> revolutionShift) == (wheelTime >> revolutionShift))
+            {
+                m_wheel[level][(executeTime >> (WheelSlotBits * level)) & WheelSlotMask].push_back(handle);
+                return;
+            }
+        }
+        m_wheelOverflow.push_back(handle);
+    }
+
+    void EventSchedulerSystemComponent::AdvanceWheel(TimeMs currentTimeMs)
+    {
+        while (m_wheelTimeMs <= currentTimeMs)
+        {
+            if (m_wheelSize == 0)
+            {
+                // Nothing left to expire, so the empty slots don't need to be visited
+                m_wheelTimeMs = currentTimeMs + TimeMs{ 1 };
+                break;
+            }
+
+            const uint64_t wheelTime = static_cast<uint64_t>(m_wheelTimeMs);
+            if ((wheelTime & WheelSlotMask) == 0)
+            {
+                CascadeWheel(1);
+            }
+
+            AZStd::vector<ScheduledEventHandle*>& slot = m_wheel[0][wheelTime & WheelSlotMask];
+            for (ScheduledEventHandle* handle : slot)
+            {
+                m_pendingQueue.push(handle);
+            }
+            m_wheelSize -= slot.size();
+            slot.clear();
+            m_wheelTimeMs += TimeMs{ 1 };
+        }
+    }
+
+    void EventSchedulerSystemComponent::CascadeWheel(uint32_t level)
+    {
+        AZStd::vector<ScheduledEventHandle*>* source = &m_wheelOverflow;
+        if (level < WheelLevelCount)
+        {
+            const uint64_t slotIndex = (static_cast<uint64_t>(m_wheelTimeMs) >> (WheelSlotBits * level)) & WheelSlotMask;
+            if (slotIndex == 0)
+            {
+                // This level wraps around as well, so the level above is redistributed first
+                CascadeWheel(level + 1);
+            }
+            source = &m_wheel[level][slotIndex];
+        }
+
+        m_cascadeScratch.swap(*source);
+        for (ScheduledEventHandle* handle : m_cascadeScratch)
+        {
+            InsertIntoWheel(handle);
+        }
+        m_cascadeScratch.clear();
+    }
 }
@@ -19,16 +19,6 @@
 
 namespace AZ
 {
-    //! @struct CompareScheduledEventPtrs
-    //! Comparison of scheduled events to add in the priority queue.
-    struct CompareScheduledEventPtrs
-    {
-        bool operator() (const ScheduledEventHandle* lhs, const ScheduledEventHandle* rhs) const
-        {
-            return (*lhs) > (*rhs);
-        }
-    };
-
     //! @struct PrioritizeScheduledEventPtrs
     //! Prioritization operator for scheduled events to add in the priority queue.
     struct PrioritizeScheduledEventPtrs
@@ -93,11 +83,34 @@ namespace AZ
 
         void FreeHandle(ScheduledEventHandle* handle);
 
+        //! Adds a handle to the timing wheel, the wheel time is synchronized first when the wheel is empty.
+        void ScheduleHandle(ScheduledEventHandle* handle, TimeMs currentTimeMs);
+
+        //! Places a handle in the lowest level of the timing wheel whose current revolution contains its execute time.
+        void InsertIntoWheel(ScheduledEventHandle* handle);
+
+        //! Moves the handles of every wheel slot up to currentTimeMs to the pending queue.
+        void AdvanceWheel(TimeMs currentTimeMs);
+
+        //! Redistributes the current slot of a wheel level to the levels below, called when the levels below wrap around.
+        void CascadeWheel(uint32_t level);
+
         // Bind the DumpStats member function to the console as 'EventSchedulerSystemComponent.DumpStats'
         AZ_CONSOLEFUNC(EventSchedulerSystemComponent, DumpStats, AZ::ConsoleFunctorFlags::Null, "Dump EventSchedulerSystemComponent stats to the console window");
 
-        // Priority queues of scheduled events sorted by execution time
-        AZStd::priority_queue<ScheduledEventHandle*, AZStd::vector<ScheduledEventHandle*>, CompareScheduledEventPtrs> m_queue;
+        // Hierarchical timing wheel of scheduled events, with a resolution of 1ms at the lowest level.
+        // Each level covers WheelSlotCount times the range of the level below; events past the top level wait in the overflow.
+        static constexpr uint32_t WheelSlotBits = 6;
+        static constexpr uint64_t WheelSlotCount = 1 << WheelSlotBits;
+        static constexpr uint64_t WheelSlotMask = WheelSlotCount - 1;
+        static constexpr uint32_t WheelLevelCount = 4;
+        AZStd::vector<ScheduledEventHandle*> m_wheel[WheelLevelCount][WheelSlotCount];
+        AZStd::vector<ScheduledEventHandle*> m_wheelOverflow;
+        AZStd::vector<ScheduledEventHandle*> m_cascadeScratch;
+        TimeMs m_wheelTimeMs = TimeMs{ 0 }; // the next time slot of the wheel to expire
+        AZStd::size_t m_wheelSize = 0;
+
+        // Priority queue of the expired events, in the order they are notified
         AZStd::priority_queue<ScheduledEventHandle*, AZStd::vector<ScheduledEventHandle*>, PrioritizeScheduledEventPtrs> m_pendingQueue;
         AZStd::deque<ScheduledEvent> m_ownedEvents;
         AZStd::vector<ScheduledEvent*> m_freeEvents;
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/typetraits/is_trivially_copyable.h>
+#include <AzCore/std/utils.h>
+
+namespace AZ
+{
+    namespace Internal
+    {
+        /**
+         * Storage for coalesced queued events, see EBusEventQueue::QueueEventCoalesced.
+         * Every event is stored as a block of bytes that starts with a key (the event function and address) followed
+         * by the arguments. Queuing an event with a key that's already queued overwrites the arguments of the queued
+         * event, so it keeps its place in the queue but is called with the latest arguments. The buffers are kept
+         * between executions, so once they've grown to the number of events in a frame queuing doesn't allocate.
+         * This class isn't thread safe, the queue policy locks around it.
+         */
+        template <class Allocator>
+        class CoalescedEventQueue
+        {
+        public:
+            /// Calls the event stored in the payload.
+            using InvokeFunction = void(*)(const AZ::u8* payload);
+
+            CoalescedEventQueue() = default;
+            CoalescedEventQueue(const CoalescedEventQueue&) = delete;
+            CoalescedEventQueue& operator=(const CoalescedEventQueue&) = delete;
+
+            /// Queues the payload, or overwrites the payload of the queued event with the same invoke function and key.
+            void Queue(InvokeFunction invoke, const AZ::u8* payload, size_t payloadSize, size_t keySize)
+            {
+                AZ_Assert(keySize <= payloadSize, "Coalesced event key can't be larger than the payload.");
+                const size_t hash = HashKey(invoke, payload, keySize);
+                if (m_index.size() < (m_entries.size() + 1) * 2)
+                {
+                    Rehash(AZStd::max<size_t>(m_index.size() * 2, MinIndexSize));
+                }
+
+                const size_t mask = m_index.size() - 1;
+                for (size_t slot = hash & mask; ; slot = (slot + 1) & mask)
+                {
+                    const AZ::u32 entryIndex = m_index[slot];
+                    if (entryIndex == 0)
+                    {
+                        Entry entry;
+                        entry.m_invoke = invoke;
+                        entry.m_hash = hash;
+                        entry.m_offset = m_payloads.size();
+                        entry.m_size = payloadSize;
+                        entry.m_keySize = keySize;
+                        m_payloads.insert(m_payloads.end(), payload, payload + payloadSize);
+                        m_entries.push_back(entry);
+                        m_index[slot] = static_cast<AZ::u32>(m_entries.size());
+                        return;
+                    }
+
+                    const Entry& entry = m_entries[entryIndex - 1];
+                    if (entry.m_hash == hash && entry.m_invoke == invoke && entry.m_keySize == keySize &&
+                        memcmp(m_payloads.data() + entry.m_offset, payload, keySize) == 0)
+                    {
+                        AZ_Assert(entry.m_size == payloadSize, "Coalesced events with the same key must have the same arguments.");
+                        memcpy(m_payloads.data() + entry.m_offset + keySize, payload + keySize, payloadSize - keySize);
+                        return;
+                    }
+                }
+            }
+
+            /// Calls all events in the order they were first queued and clears the queue. The buffers are kept for reuse.
+            void Execute()
+            {
+                for (const Entry& entry : m_entries)
+                {
+                    entry.m_invoke(m_payloads.data() + entry.m_offset);
+                }
+                Clear();
+            }
+
+            /// Removes all events without calling them. The buffers are kept for reuse.
+            void Clear()
+            {
+                if (!m_entries.empty())
+                {
+                    m_entries.clear();
+                    m_payloads.clear();
+                    AZStd::fill(m_index.begin(), m_index.end(), 0u);
+                }
+            }
+
+            void Swap(CoalescedEventQueue& other)
+            {
+                m_entries.swap(other.m_entries);
+                m_payloads.swap(other.m_payloads);
+                m_index.swap(other.m_index);
+            }
+
+            bool IsEmpty() const
+            {
+                return m_entries.empty();
+            }
+
+            size_t Count() const
+            {
+                return m_entries.size();
+            }
+
+        private:
+            struct Entry
+            {
+                InvokeFunction m_invoke;
+                size_t m_hash;
+                size_t m_offset;
+                size_t m_size;
+                size_t m_keySize;
+            };
+
+            static constexpr size_t MinIndexSize = 64;
+
+            static size_t HashKey(InvokeFunction invoke, const AZ::u8* key, size_t keySize)
+            {
+                // FNV-1a
+                AZ::u64 hash = 14695981039346656037ull ^ static_cast<AZ::u64>(reinterpret_cast<uintptr_t>(invoke));
+                for (size_t i = 0; i < keySize; ++i)
+                {
+                    hash = (hash ^ key[i]) * 1099511628211ull;
+                }
+                return static_cast<size_t>(hash ^ (hash >> 32));
+            }
+
+            void Rehash(size_t indexSize)
+            {
+                m_index.clear();
+                m_index.resize(indexSize, 0u);
+                const size_t mask = indexSize - 1;
+                for (size_t i = 0; i < m_entries.size(); ++i)
+                {
+                    size_t slot = m_entries[i].m_hash & mask;
+                    while (m_index[slot] != 0)
+                    {
+                        slot = (slot + 1) & mask;
+                    }
+                    m_index[slot] = static_cast<AZ::u32>(i + 1);
+                }
+            }
+
+            AZStd::vector<Entry, Allocator> m_entries;
+            AZStd::vector<AZ::u8, Allocator> m_payloads;
+            AZStd::vector<AZ::u32, Allocator> m_index;      ///< Open addressing table of entry index + 1, 0 is an empty slot.
+        };
+
+        /**
+         * Packs trivially copyable values back to back into a byte buffer and reads them back. Used to store the key
+         * and arguments of coalesced events without padding, so keys can be compared byte by byte.
+         */
+        template <class... Types>
+        struct CoalescedEventPacker
+        {
+            static_assert(AZStd::conjunction_v<AZStd::is_trivially_copyable<Types>...>, "Coalesced events only support trivially copyable addresses and arguments.");
+
+            static constexpr size_t Size = (sizeof(Types) + ... + 0);
+
+            static void Write(AZ::u8* buffer, const Types&... values)
+            {
+                size_t offset = 0;
+                ((memcpy(buffer + offset, &values, sizeof(Types)), offset += sizeof(Types)), ...);
+            }
+
+            template <size_t Index>
+            static constexpr size_t GetOffset()
+            {
+                constexpr size_t sizes[] = { sizeof(Types)..., 0 };
+                size_t offset = 0;
+                for (size_t i = 0; i < Index; ++i)
+                {
+                    offset += sizes[i];
+                }
+                return offset;
+            }
+        };
+
+        /// Copies a trivially copyable value out of a possibly unaligned position in a buffer.
+        template <class T>
+        struct CoalescedEventValue
+        {
+            explicit CoalescedEventValue(const AZ::u8* source)
+            {
+                memcpy(m_storage, source, sizeof(T));
+            }
+
+            T& Get()
+            {
+                return *reinterpret_cast<T*>(m_storage);
+            }
+
+            alignas(T) AZ::u8 m_storage[sizeof(T)];
+        };
+    } // namespace Internal
+} // namespace AZ
@@ -21,6 +21,7 @@
 
 #include <AzCore/Module/Environment.h>
 #include <AzCore/EBus/Environment.h>
+#include <AzCore/EBus/Internal/CoalescedEventQueue.h>
 
 namespace AZ
 {
@@ -241,11 +242,15 @@ namespace AZ
 
         typedef AZStd::deque<BusMessageCall, typename Bus::AllocatorType> DequeType;
         typedef AZStd::queue<BusMessageCall, DequeType > MessageQueueType;
+        typedef AZ::Internal::CoalescedEventQueue<typename Bus::AllocatorType> CoalescedQueueType;
 
         EBusQueuePolicy() = default;
 
         bool                        m_isActive = Bus::Traits::EventQueueingActiveByDefault;
         MessageQueueType            m_messages;
+        CoalescedQueueType          m_coalescedMessages;    ///< Events queued with QueueEventCoalesced/QueueBroadcastCoalesced.
+        CoalescedQueueType          m_executingCoalescedMessages; ///< Second buffer so coalesced events can be queued while the previous ones execute.
+        bool                        m_isExecutingCoalescedMessages = false;
         MutexType                   m_messagesMutex;        ///< Used to control access to the m_messages. Make sure you never interlock with the EBus mutex. Otherwise, a deadlock can occur.
 
         void Execute()
@@ -275,12 +280,15 @@ namespace AZ
 
                 invoke();
             }
+
+            ExecuteCoalesced();
         }
 
         void Clear()
         {
             AZStd::lock_guard<MutexType> lock(m_messagesMutex);
             m_messages.get_container().clear();
+            m_coalescedMessages.Clear();
         }
 
         void SetActive(bool isActive)
@@ -290,6 +298,7 @@ namespace AZ
             if (!m_isActive)
             {
                 m_messages.get_container().clear();
+                m_coalescedMessages.Clear();
             }
         };
 
@@ -301,7 +310,40 @@ namespace AZ
         size_t Count()
         {
             AZStd::lock_guard<MutexType> lock(m_messagesMutex);
-            return m_messages.size();
+            return m_messages.size() + m_coalescedMessages.Count();
+        }
+
+    private:
+        void ExecuteCoalesced()
+        {
+            while (true)
+            {
+                // Swap the queued events into the executing buffer so the handlers can queue new events. If another
+                // thread is executing already, a temporary buffer is used instead.
+                CoalescedQueueType temporaryMessages;
+                CoalescedQueueType* messages = &m_executingCoalescedMessages;
+                {
+                    AZStd::lock_guard<MutexType> lock(m_messagesMutex);
+                    if (m_coalescedMessages.IsEmpty())
+                    {
+                        break;
+                    }
+                    if (m_isExecutingCoalescedMessages)
+                    {
+                        messages = &temporaryMessages;
+                    }
+                    m_isExecutingCoalescedMessages = true;
+                    messages->Swap(m_coalescedMessages);
+                }
+
+                messages->Execute();
+
+                if (messages == &m_executingCoalescedMessages)
+                {
+                    AZStd::lock_guard<MutexType> lock(m_messagesMutex);
+                    m_isExecutingCoalescedMessages = false;
+                }
+            }
         }
     };
 
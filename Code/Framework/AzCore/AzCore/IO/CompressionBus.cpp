@@ -20,6 +20,7 @@ namespace AZ
         CompressionInfo& CompressionInfo::operator=(CompressionInfo&& rhs)
         {
             m_decompressor = AZStd::move(rhs.m_decompressor);
+            m_chunkLayout = AZStd::move(rhs.m_chunkLayout);
             m_archiveFilename = AZStd::move(rhs.m_archiveFilename);
             m_compressionTag = rhs.m_compressionTag;
             m_offset = rhs.m_offset;
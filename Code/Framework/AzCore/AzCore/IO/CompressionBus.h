@@ -10,6 +10,7 @@
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/IO/Streamer/RequestPath.h>
 #include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/functional.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/string/string_view.h>
@@ -31,8 +32,21 @@ namespace AZ
             UseArchiveOnly
         };
 
+        //! Location of a block of a compressed file that can be decompressed independently from the rest of the file.
+        struct CompressedChunk
+        {
+            //! Offset of the chunk relative to the start of the compressed file.
+            size_t m_compressedOffset = 0;
+            size_t m_compressedSize = 0;
+            //! Offset of the decompressed chunk relative to the start of the decompressed file.
+            size_t m_uncompressedOffset = 0;
+            size_t m_uncompressedSize = 0;
+        };
+
         struct CompressionInfo;
         using DecompressionFunc = AZStd::function<bool(const CompressionInfo& info, const void* compressed, size_t compressedSize, void* uncompressed, size_t uncompressedBufferSize)>;
+        //! Fills in the independently compressed chunks of a file. Returns false if the compressed data isn't stored in chunks.
+        using ChunkLayoutFunc = AZStd::function<bool(const CompressionInfo& info, const void* compressed, size_t compressedSize, AZStd::vector<CompressedChunk>& chunks)>;
 
         struct CompressionInfo
         {
@@ -47,6 +61,9 @@ namespace AZ
             RequestPath m_archiveFilename;
             //< The function to use to decompress the data.
             DecompressionFunc m_decompressor;
+            //< Optional function that retrieves the chunks the file was compressed in. If the file is stored in chunks, the
+            //< decompressor is called for every chunk individually, which allows chunks to be decompressed in parallel.
+            ChunkLayoutFunc m_chunkLayout;
             //< Tag that uniquely identifies the compressor responsible for decompressing the referenced data.
             CompressionTag m_compressionTag{ 0 };
             //! Offset into the archive file for the found file.
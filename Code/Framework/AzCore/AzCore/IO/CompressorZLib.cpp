@@ -12,6 +12,7 @@
 #include <AzCore/IO/CompressorStream.h>
 #include <AzCore/Math/Crc.h>
 #include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/limits.h>
 
 namespace AZ
 {
@@ -317,6 +318,29 @@ namespace AZ
                 {
                     // if we have data in the cache move to the next offset, we always move forward by default.
                     zlibData->m_decompressedCacheOffset += zlibData->m_decompressedCacheDataSize;
+                    zlibData->m_decompressedCacheDataSize = 0;
+
+                    // when the decompressor is at the requested offset and the request is at least a cache in size, decompress
+                    // straight into the output buffer instead of going through the cache.
+                    if (offset == zlibData->m_decompressedCacheOffset && byteSize >= m_decompressionCachePerStream)
+                    {
+                        const u32 outputSize = static_cast<u32>(AZStd::min<SizeType>(byteSize, AZStd::numeric_limits<u32>::max()));
+                        u32 availOutputSize = outputSize;
+                        unsigned int processed = zlibData->m_zlib.Decompress(&m_compressedDataBuffer[processedCompressedData], static_cast<unsigned int>(compressedDataSize) - processedCompressedData, buffer, availOutputSize);
+                        const u32 decompressedSize = outputSize - availOutputSize;
+                        if (processed == 0 && decompressedSize == 0)
+                        {
+                            break; // we processed everything we could, load more compressed data.
+                        }
+                        processedCompressedData += processed;
+                        // the cache stays empty, positioned after the data that was decompressed into the buffer
+                        zlibData->m_decompressedCacheOffset += decompressedSize;
+                        buffer = reinterpret_cast<char*>(buffer) + decompressedSize;
+                        byteSize -= decompressedSize;
+                        offset += decompressedSize;
+                        numRead += decompressedSize;
+                        continue;
+                    }
 
                     // decompress in the cache buffer
                     u32 availDecompressedCacheSize = m_decompressionCachePerStream; // reset buffer size
@@ -8,6 +8,7 @@
 
 #include <AzCore/IO/IStreamerTypes.h>
 #include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/algorithm.h>
 
 namespace AZ::IO::IStreamerTypes
 {
@@ -17,6 +18,26 @@ namespace AZ::IO::IStreamerTypes
         return AZ_SIZE_ALIGN_UP((readSize + offsetAdjustment), m_sizeAlignment);
     }
 
+    AZStd::chrono::system_clock::time_point Recommendations::PredictCompletionTime(u64 readSize) const
+    {
+        auto now = AZStd::chrono::system_clock::now();
+        if (!m_schedulingPrediction)
+        {
+            return now;
+        }
+
+        auto queueCompletion = AZStd::chrono::system_clock::time_point(
+            AZStd::chrono::microseconds(m_schedulingPrediction->m_queueCompletionTime.load(AZStd::memory_order_relaxed)));
+        auto start = AZStd::max(now, queueCompletion);
+
+        u64 bandwidth = m_schedulingPrediction->m_bandwidth.load(AZStd::memory_order_relaxed);
+        if (bandwidth == 0)
+        {
+            return start;
+        }
+        return start + AZStd::chrono::microseconds((readSize * 1000000) / bandwidth);
+    }
+
     DefaultRequestMemoryAllocator::DefaultRequestMemoryAllocator()
         : m_allocator(AZ::AllocatorInstance<AZ::SystemAllocator>::Get())
     {}
@@ -13,6 +13,7 @@
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 
  // The user defined literals have to be in the header because there were linking issues with CrySystem.
 
@@ -35,6 +36,20 @@ namespace AZ::IO::IStreamerTypes
     inline constexpr static Priority s_priorityLowest = 0;
 
     //! Provides configuration recommendations for using the file streaming system.
+    //! Predictions made by the scheduler during its last scheduling pass. The values are updated from the scheduling thread
+    //! and can be read from any thread.
+    struct SchedulingPrediction
+    {
+        //! The time at which all requests that are currently known to the scheduler are estimated to have completed, in
+        //! microseconds since the epoch of the system clock.
+        AZStd::atomic<s64> m_queueCompletionTime{ 0 };
+        //! The effective bandwidth in bytes per second, based on the throughput estimates of the stream stack for the
+        //! requests in the last scheduling pass that included reads. Zero if no reads have been scheduled yet.
+        AZStd::atomic<u64> m_bandwidth{ 0 };
+        //! The number of read requests in the last scheduling pass that are estimated to complete after their deadline.
+        AZStd::atomic<u32> m_predictedDeadlineMisses{ 0 };
+    };
+
     struct Recommendations
     {
         //! The minimal memory alignment that's required to avoid intermediate buffers. If the memory
@@ -64,6 +79,18 @@ namespace AZ::IO::IStreamerTypes
         //! @param readOffset The number of bytes to offset into the file to start reading from.
         //! @return The recommended amount of memory to reserve, taking size, offset and alignment into account.
         AZ::u64 CalculateRecommendedMemorySize(u64 readSize, u64 readOffset = 0);
+
+        //! Live predictions from the scheduler. This is shared with the scheduler so it stays up to date after the
+        //! recommendations have been retrieved. Can be null if the recommendations didn't come from a scheduler.
+        AZStd::shared_ptr<const SchedulingPrediction> m_schedulingPrediction;
+
+        //! Predicts when a read of the given size would complete if it was queued now behind all requests that are already
+        //! known to the scheduler. Because the scheduler orders requests by priority and deadline this is a conservative
+        //! estimate for high priority requests. Systems such as texture streaming can use this to decide which requests will
+        //! no longer be able to meet their deadline and can be skipped.
+        //! @param readSize The number of bytes that will be read.
+        //! @return The predicted completion time, or the current time if no prediction is available yet.
+        AZStd::chrono::system_clock::time_point PredictCompletionTime(u64 readSize) const;
     };
 
     enum class RequestStatus
@@ -11,11 +11,13 @@
 #include <AzCore/IO/Streamer/FileRequest.h>
 #include <AzCore/IO/Streamer/FullFileDecompressor.h>
 #include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/Jobs/JobCompletion.h>
 #include <AzCore/Jobs/JobContext.h>
 #include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Math/MathUtils.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/typetraits/decay.h>
@@ -617,18 +619,18 @@ namespace AZ
 
                     if (data->m_readOffset == 0 && data->m_readSize == data->m_compressionInfo.m_uncompressedSize)
                     {
-                        auto job = [this, &info]()
+                        auto job = [this, &info, chunkJobContext = GetChunkJobContext()]()
                         {
-                            FullDecompression(m_context, info);
+                            FullDecompression(m_context, info, chunkJobContext);
                         };
                         decompressionJob = AZ::CreateJobFunction(job, true, m_decompressionjobContext.get());
                     }
                     else
                     {
                         m_memoryUsage += data->m_compressionInfo.m_uncompressedSize;
-                        auto job = [this, &info]()
+                        auto job = [this, &info, chunkJobContext = GetChunkJobContext()]()
                         {
-                            PartialDecompression(m_context, info);
+                            PartialDecompression(m_context, info, chunkJobContext);
                         };
                         decompressionJob = AZ::CreateJobFunction(job, true, m_decompressionjobContext.get());
                     }
@@ -686,7 +688,15 @@ namespace AZ
             return;
         }
 
-        void FullFileDecompressor::FullDecompression(StreamerContext* context, DecompressionInformation& info)
+        JobContext* FullFileDecompressor::GetChunkJobContext() const
+        {
+            // Prefer the main job system so chunks are spread across all cores. The dedicated job system is used as a fallback
+            // if there's no main job system, such as in tools that only run the streamer.
+            JobContext* globalContext = JobContext::GetGlobalContext();
+            return globalContext ? globalContext : m_decompressionjobContext.get();
+        }
+
+        void FullFileDecompressor::FullDecompression(StreamerContext* context, DecompressionInformation& info, JobContext* chunkJobContext)
         {
             info.m_jobStartTime = AZStd::chrono::high_resolution_clock::now();
 
@@ -702,16 +712,28 @@ namespace AZ
             AZ_Assert(compressionInfo.m_uncompressedSize == request->m_readSize,
                 "FullFileDecompressor is doing a full decompression, but the target buffer size (%llu) doesn't match the decompressed size (%zu).",
                 request->m_readSize, compressionInfo.m_uncompressedSize);
-            
-            bool success = compressionInfo.m_decompressor(compressionInfo, info.m_compressedData + info.m_alignmentOffset,
-                compressionInfo.m_compressedSize, request->m_output, compressionInfo.m_uncompressedSize);
+
+            const u8* compressed = info.m_compressedData + info.m_alignmentOffset;
+            AZStd::vector<CompressedChunk> chunks;
+            bool success;
+            if (compressionInfo.m_chunkLayout &&
+                compressionInfo.m_chunkLayout(compressionInfo, compressed, compressionInfo.m_compressedSize, chunks) && chunks.size() > 1)
+            {
+                success = DecompressChunks(compressionInfo, compressed, compressionInfo.m_compressedSize, chunks.data(), chunks.size(),
+                    reinterpret_cast<u8*>(request->m_output), compressionInfo.m_uncompressedSize, 0, chunkJobContext);
+            }
+            else
+            {
+                success = compressionInfo.m_decompressor(compressionInfo, compressed,
+                    compressionInfo.m_compressedSize, request->m_output, compressionInfo.m_uncompressedSize);
+            }
             info.m_waitRequest->SetStatus(success ? IStreamerTypes::RequestStatus::Completed : IStreamerTypes::RequestStatus::Failed);
             
             context->MarkRequestAsCompleted(info.m_waitRequest);
             context->WakeUpSchedulingThread();
         }
 
-        void FullFileDecompressor::PartialDecompression(StreamerContext* context, DecompressionInformation& info)
+        void FullFileDecompressor::PartialDecompression(StreamerContext* context, DecompressionInformation& info, JobContext* chunkJobContext)
         {
             info.m_jobStartTime = AZStd::chrono::high_resolution_clock::now();
 
@@ -722,15 +744,106 @@ namespace AZ
             CompressionInfo& compressionInfo = request->m_compressionInfo;
             AZ_Assert(compressionInfo.m_decompressor, "Partial decompressor job started, but there's no decompressor callback assigned.");
 
-            AZStd::unique_ptr<u8[]> decompressionBuffer = AZStd::unique_ptr<u8[]>(new u8[compressionInfo.m_uncompressedSize]);
-            bool success = compressionInfo.m_decompressor(compressionInfo, info.m_compressedData + info.m_alignmentOffset,
-                compressionInfo.m_compressedSize, decompressionBuffer.get(), compressionInfo.m_uncompressedSize);
+            const u8* compressed = info.m_compressedData + info.m_alignmentOffset;
+            AZStd::vector<CompressedChunk> chunks;
+            bool success;
+            if (compressionInfo.m_chunkLayout &&
+                compressionInfo.m_chunkLayout(compressionInfo, compressed, compressionInfo.m_compressedSize, chunks) && !chunks.empty())
+            {
+                // Only the chunks that overlap with the requested range need to be decompressed.
+                const u64 readEnd = request->m_readOffset + request->m_readSize;
+                size_t first = 0;
+                while (first < chunks.size() && chunks[first].m_uncompressedOffset + chunks[first].m_uncompressedSize <= request->m_readOffset)
+                {
+                    ++first;
+                }
+                size_t last = first;
+                while (last < chunks.size() && chunks[last].m_uncompressedOffset < readEnd)
+                {
+                    ++last;
+                }
+
+                if (first < last)
+                {
+                    const size_t rangeStart = chunks[first].m_uncompressedOffset;
+                    const size_t rangeSize = chunks[last - 1].m_uncompressedOffset + chunks[last - 1].m_uncompressedSize - rangeStart;
+                    AZStd::unique_ptr<u8[]> decompressionBuffer = AZStd::unique_ptr<u8[]>(new u8[rangeSize]);
+                    success = DecompressChunks(compressionInfo, compressed, compressionInfo.m_compressedSize, chunks.data() + first,
+                        last - first, decompressionBuffer.get(), rangeSize, rangeStart, chunkJobContext);
+                    success = success && rangeStart <= request->m_readOffset && readEnd <= rangeStart + rangeSize;
+                    if (success)
+                    {
+                        memcpy(request->m_output, decompressionBuffer.get() + (request->m_readOffset - rangeStart), request->m_readSize);
+                    }
+                }
+                else
+                {
+                    success = false;
+                }
+            }
+            else
+            {
+                AZStd::unique_ptr<u8[]> decompressionBuffer = AZStd::unique_ptr<u8[]>(new u8[compressionInfo.m_uncompressedSize]);
+                success = compressionInfo.m_decompressor(compressionInfo, compressed,
+                    compressionInfo.m_compressedSize, decompressionBuffer.get(), compressionInfo.m_uncompressedSize);
+                memcpy(request->m_output, decompressionBuffer.get() + request->m_readOffset, request->m_readSize);
+            }
             info.m_waitRequest->SetStatus(success ? IStreamerTypes::RequestStatus::Completed : IStreamerTypes::RequestStatus::Failed);
-            
-            memcpy(request->m_output, decompressionBuffer.get() + request->m_readOffset, request->m_readSize);
 
             context->MarkRequestAsCompleted(info.m_waitRequest);
             context->WakeUpSchedulingThread();
         }
+
+        bool FullFileDecompressor::DecompressChunks(const CompressionInfo& info, const u8* compressed, size_t compressedSize,
+            const CompressedChunk* chunks, size_t chunkCount, u8* output, size_t outputSize, size_t outputOffset,
+            JobContext* chunkJobContext)
+        {
+            for (size_t i = 0; i < chunkCount; ++i)
+            {
+                const CompressedChunk& chunk = chunks[i];
+                if (chunk.m_compressedOffset + chunk.m_compressedSize > compressedSize ||
+                    chunk.m_uncompressedOffset < outputOffset ||
+                    chunk.m_uncompressedOffset + chunk.m_uncompressedSize > outputOffset + outputSize)
+                {
+                    AZ_Error("Streamer", false, "The chunk layout of '%s' points outside of the file.", info.m_archiveFilename.GetRelativePath());
+                    return false;
+                }
+            }
+
+            AZStd::atomic_bool success{ true };
+            auto decompressChunk = [&info, compressed, output, outputOffset, &success](const CompressedChunk& chunk)
+            {
+                if (!info.m_decompressor(info, compressed + chunk.m_compressedOffset, chunk.m_compressedSize,
+                    output + (chunk.m_uncompressedOffset - outputOffset), chunk.m_uncompressedSize))
+                {
+                    success = false;
+                }
+            };
+
+            if (chunkCount > 1 && chunkJobContext)
+            {
+                JobCompletion completion(chunkJobContext);
+                for (size_t i = 1; i < chunkCount; ++i)
+                {
+                    const CompressedChunk& chunk = chunks[i];
+                    Job* job = CreateJobFunction([&decompressChunk, &chunk]()
+                        {
+                            decompressChunk(chunk);
+                        }, true, chunkJobContext);
+                    job->SetDependent(&completion);
+                    job->Start();
+                }
+                decompressChunk(chunks[0]);
+                completion.StartAndWaitForCompletion();
+            }
+            else
+            {
+                for (size_t i = 0; i < chunkCount; ++i)
+                {
+                    decompressChunk(chunks[i]);
+                }
+            }
+            return success;
+        }
     } // namespace IO
 } // namespace AZ
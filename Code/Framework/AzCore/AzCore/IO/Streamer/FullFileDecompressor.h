@@ -49,6 +49,9 @@ namespace AZ
         //! Finally, the lack of an upper limit also means that the duration of the decompression job
         //! can vary largely so a dedicated job system is used to decompress on to avoid blocking
         //! the main job system from working.
+        //! Files that are stored in independently compressed chunks are the exception. The chunks of these are decompressed
+        //! in parallel on the main job system, as the duration per chunk is bounded, so a single large file can make use of
+        //! all available cores. Partial reads of these files only decompress the chunks that overlap with the read.
         class FullFileDecompressor
             : public StreamStackEntry
         {
@@ -101,8 +104,15 @@ namespace AZ
             bool StartDecompressions();
             void FinishDecompression(FileRequest* waitRequest, u32 jobSlot);
             
-            static void FullDecompression(StreamerContext* context, DecompressionInformation& info);
-            static void PartialDecompression(StreamerContext* context, DecompressionInformation& info);
+            JobContext* GetChunkJobContext() const;
+
+            static void FullDecompression(StreamerContext* context, DecompressionInformation& info, JobContext* chunkJobContext);
+            static void PartialDecompression(StreamerContext* context, DecompressionInformation& info, JobContext* chunkJobContext);
+            //! Decompresses the given chunks into output, where output starts at outputOffset in the decompressed file. All but
+            //! the first chunk are decompressed on jobs, the first chunk is decompressed on the calling thread.
+            static bool DecompressChunks(const CompressionInfo& info, const u8* compressed, size_t compressedSize,
+                const CompressedChunk* chunks, size_t chunkCount, u8* output, size_t outputSize, size_t outputOffset,
+                JobContext* chunkJobContext);
 
             AZStd::deque<FileRequest*> m_pendingReads;
             AZStd::deque<FileRequest*> m_pendingFileExistChecks;
@@ -0,0 +1,497 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/CompressionBus.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/PersistentCache.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/typetraits/decay.h>
+#include <stdlib.h>
+
+namespace AZ
+{
+    namespace IO
+    {
+        AZStd::shared_ptr<StreamStackEntry> PersistentCacheConfig::AddStreamStackEntry(
+            [[maybe_unused]] const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent)
+        {
+            if (m_cachePath.empty())
+            {
+                return parent;
+            }
+
+            AZStd::string cachePath = m_cachePath;
+            if (FileIOBase* fileIO = FileIOBase::GetInstance(); fileIO != nullptr)
+            {
+                char resolvedPath[AZ_MAX_PATH_LEN];
+                if (fileIO->ResolvePath(m_cachePath.c_str(), resolvedPath, AZ_ARRAY_SIZE(resolvedPath)))
+                {
+                    cachePath = resolvedPath;
+                }
+            }
+
+            auto stackEntry = AZStd::make_shared<PersistentCache>(AZStd::move(cachePath),
+                aznumeric_cast<u64>(m_cacheSizeMib) * 1_mib, aznumeric_cast<u64>(m_maxPendingWritesMib) * 1_mib);
+            stackEntry->SetNext(AZStd::move(parent));
+            return stackEntry;
+        }
+
+        void PersistentCacheConfig::Reflect(AZ::ReflectContext* context)
+        {
+            if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context); serializeContext != nullptr)
+            {
+                serializeContext->Class<PersistentCacheConfig, IStreamerStackConfig>()
+                    ->Version(1)
+                    ->Field("CachePath", &PersistentCacheConfig::m_cachePath)
+                    ->Field("CacheSizeMib", &PersistentCacheConfig::m_cacheSizeMib)
+                    ->Field("MaxPendingWritesMib", &PersistentCacheConfig::m_maxPendingWritesMib);
+            }
+        }
+
+        static constexpr char CacheHitRateName[] = "Cache hit rate";
+        static constexpr char CachedFilesName[] = "Cached files";
+        static constexpr char CachedSizeName[] = "Cached size (MiB)";
+        static constexpr char CacheFileExtension[] = ".azcache";
+        static constexpr char TempFileExtension[] = ".tmp";
+        // Cache files are named after their key as a 64-bit hexadecimal value.
+        static constexpr size_t KeyNameLength = 16;
+
+        PersistentCache::PersistentCache(AZStd::string cachePath, u64 cacheSize, u64 maxPendingWriteSize)
+            : StreamStackEntry("Persistent cache")
+            , m_cachePath(AZStd::move(cachePath))
+            , m_cacheSize(cacheSize)
+            , m_maxPendingWriteSize(maxPendingWriteSize)
+        {
+            if (!m_cachePath.empty() && m_cachePath.back() != '/' && m_cachePath.back() != '\\')
+            {
+                m_cachePath += '/';
+            }
+
+            m_writeThreadDesc.m_name = "Streamer persistent cache";
+            m_writeThread = AZStd::thread([this]()
+                {
+                    WriteThread();
+                }, &m_writeThreadDesc);
+        }
+
+        PersistentCache::~PersistentCache()
+        {
+            {
+                AZStd::scoped_lock guard(m_writeGuard);
+                m_shutdown = true;
+                // Any writes that haven't started yet are dropped, they'll be added again the next time the file is read.
+                m_pendingWrites.clear();
+            }
+            m_writeSignal.notify_one();
+            m_writeThread.join();
+        }
+
+        void PersistentCache::QueueRequest(FileRequest* request)
+        {
+            AZ_Assert(request, "QueueRequest was provided a null request.");
+
+            AZStd::visit([this, request](auto&& args)
+            {
+                using Command = AZStd::decay_t<decltype(args)>;
+                if constexpr (AZStd::is_same_v<Command, FileRequest::CompressedReadData>)
+                {
+                    CompressedRead(request, args);
+                    return;
+                }
+                else
+                {
+                    if constexpr (AZStd::is_same_v<Command, FileRequest::FlushData>)
+                    {
+                        FlushCache(args.m_path);
+                    }
+                    else if constexpr (AZStd::is_same_v<Command, FileRequest::FlushAllData>)
+                    {
+                        FlushEntireCache();
+                    }
+                    StreamStackEntry::QueueRequest(request);
+                }
+            }, request->GetCommand());
+        }
+
+        bool PersistentCache::ExecuteRequests()
+        {
+            ProcessCompletedWrites();
+            return StreamStackEntry::ExecuteRequests();
+        }
+
+        void PersistentCache::CollectStatistics(AZStd::vector<Statistic>& statistics) const
+        {
+            statistics.push_back(Statistic::CreatePercentage(m_name, CacheHitRateName, m_hitRateStat.GetAverage()));
+            statistics.push_back(Statistic::CreateInteger(m_name, CachedFilesName, aznumeric_caster(m_entries.size())));
+            statistics.push_back(Statistic::CreateFloat(m_name, CachedSizeName, aznumeric_cast<double>(m_cachedSize) / 1_mib));
+            StreamStackEntry::CollectStatistics(statistics);
+        }
+
+        size_t PersistentCache::GetNumCachedFiles() const
+        {
+            return m_entries.size();
+        }
+
+        u64 PersistentCache::GetCachedSize() const
+        {
+            return m_cachedSize;
+        }
+
+        bool PersistentCache::HasPendingWrites() const
+        {
+            return !m_inFlightWrites.empty();
+        }
+
+        void PersistentCache::CompressedRead(FileRequest* request, FileRequest::CompressedReadData& data)
+        {
+            // Uncompressed files are read directly from the archive, so there's nothing to gain from caching them.
+            Key key;
+            if (!data.m_compressionInfo.m_isCompressed || !CalculateKey(key, data.m_compressionInfo))
+            {
+                StreamStackEntry::QueueRequest(request);
+                return;
+            }
+
+            if (!m_indexLoaded)
+            {
+                LoadIndex();
+            }
+            ProcessCompletedWrites();
+
+            if (auto entry = m_entryLookup.find(key); entry != m_entryLookup.end())
+            {
+                m_hitRateStat.PushSample(1.0);
+                // Move to the front to mark the file as the most recently used.
+                m_entries.splice(m_entries.begin(), m_entries, entry->second);
+                ReadFromCache(request, key);
+                return;
+            }
+
+            m_hitRateStat.PushSample(0.0);
+            const bool isFullRead = data.m_readOffset == 0 && data.m_readSize == data.m_compressionInfo.m_uncompressedSize;
+            if (isFullRead && data.m_readSize <= m_maxPendingWriteSize && data.m_readSize <= m_cacheSize &&
+                m_inFlightWrites.find(key) == m_inFlightWrites.end())
+            {
+                ReadAndStore(request, data, key);
+            }
+            else
+            {
+                StreamStackEntry::QueueRequest(request);
+            }
+        }
+
+        void PersistentCache::ReadFromCache(FileRequest* request, Key key)
+        {
+            auto& data = AZStd::get<FileRequest::CompressedReadData>(request->GetCommand());
+
+            AZStd::string path;
+            BuildPath(path, key, CacheFileExtension);
+            RequestPath cachedFile;
+            cachedFile.InitFromAbsolutePath(AZStd::move(path));
+
+            // The read isn't a child of the original request because in case the cached file is missing or can't be read
+            // the original request is passed on to the decompressor instead of failing it.
+            FileRequest* cacheRead = m_context->GetNewInternalRequest();
+            cacheRead->CreateRead(nullptr, data.m_output, data.m_readSize, cachedFile, data.m_readOffset, data.m_readSize);
+            cacheRead->SetCompletionCallback([this, request, key](FileRequest& cacheRead)
+                {
+                    AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+                    IStreamerTypes::RequestStatus status = cacheRead.GetStatus();
+                    if (status == IStreamerTypes::RequestStatus::Failed)
+                    {
+                        if (auto entry = m_entryLookup.find(key); entry != m_entryLookup.end())
+                        {
+                            RemoveEntry(entry->second);
+                        }
+                        StreamStackEntry::QueueRequest(request);
+                    }
+                    else
+                    {
+                        request->SetStatus(status);
+                        m_context->MarkRequestAsCompleted(request);
+                    }
+                });
+            StreamStackEntry::QueueRequest(cacheRead);
+        }
+
+        void PersistentCache::ReadAndStore(FileRequest* request, FileRequest::CompressedReadData& data, Key key)
+        {
+            m_inFlightWrites.insert(key);
+
+            // Use a child request so the decompressed data can be copied before the original request is completed and its
+            // output potentially released.
+            FileRequest* decompressRequest = m_context->GetNewInternalRequest();
+            decompressRequest->CreateCompressedRead(request, data.m_compressionInfo, data.m_output, data.m_readOffset, data.m_readSize);
+            decompressRequest->SetCompletionCallback([this, key](FileRequest& decompressRequest)
+                {
+                    AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+                    auto& data = AZStd::get<FileRequest::CompressedReadData>(decompressRequest.GetCommand());
+                    if (decompressRequest.GetStatus() == IStreamerTypes::RequestStatus::Completed)
+                    {
+                        AZStd::scoped_lock guard(m_writeGuard);
+                        if (m_pendingWriteSize + data.m_readSize <= m_maxPendingWriteSize)
+                        {
+                            const u8* output = reinterpret_cast<const u8*>(data.m_output);
+                            m_pendingWrites.emplace_back();
+                            PendingWrite& write = m_pendingWrites.back();
+                            write.m_data.assign(output, output + data.m_readSize);
+                            write.m_key = key;
+                            m_pendingWriteSize += data.m_readSize;
+                            m_writeSignal.notify_one();
+                            return;
+                        }
+                    }
+                    m_inFlightWrites.erase(key);
+                });
+            StreamStackEntry::QueueRequest(decompressRequest);
+        }
+
+        void PersistentCache::FlushCache(const RequestPath& filePath)
+        {
+            // The archive might have been replaced, so get a new stamp the next time it's used. Entries for the old version of
+            // the archive will no longer be found and eventually be evicted.
+            m_archiveStamps.erase(filePath.GetHash());
+        }
+
+        void PersistentCache::FlushEntireCache()
+        {
+            m_archiveStamps.clear();
+        }
+
+        bool PersistentCache::CalculateKey(Key& key, const CompressionInfo& info)
+        {
+            const RequestPath& archive = info.m_archiveFilename;
+            if (!archive.IsValid())
+            {
+                return false;
+            }
+            const char* archivePath = archive.GetAbsolutePath();
+            size_t pathHash = archive.GetHash();
+
+            auto stamp = m_archiveStamps.find(pathHash);
+            if (stamp == m_archiveStamps.end())
+            {
+                size_t archiveStamp = 0;
+                u64 archiveSize = SystemFile::Length(archivePath);
+                if (archiveSize != 0)
+                {
+                    AZStd::hash_combine(archiveStamp, archiveSize, SystemFile::ModificationTime(archivePath));
+                }
+                stamp = m_archiveStamps.emplace(pathHash, archiveStamp).first;
+            }
+            if (stamp->second == 0)
+            {
+                // The archive couldn't be found, let the decompressor deal with the request.
+                return false;
+            }
+
+            size_t hash = pathHash;
+            AZStd::hash_combine(hash, stamp->second, info.m_offset, info.m_compressedSize, info.m_uncompressedSize,
+                info.m_compressionTag.m_code);
+            key = aznumeric_cast<Key>(hash);
+            return true;
+        }
+
+        void PersistentCache::BuildPath(AZStd::string& path, Key key, const char* extension) const
+        {
+            path = AZStd::string::format("%s%016llx%s", m_cachePath.c_str(), static_cast<unsigned long long>(key), extension);
+        }
+
+        void PersistentCache::LoadIndex()
+        {
+            AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+
+            m_indexLoaded = true;
+            if (!SystemFile::Exists(m_cachePath.c_str()) && !SystemFile::CreateDir(m_cachePath.c_str()))
+            {
+                AZ_Warning("Streamer", false, "Unable to create the persistent cache folder '%s'.", m_cachePath.c_str());
+                return;
+            }
+
+            // Temporary files are left behind if the application closed while writing, these are never complete.
+            AZStd::vector<AZStd::string> tempFiles;
+            AZStd::string filter = AZStd::string::format("%s*%s", m_cachePath.c_str(), TempFileExtension);
+            SystemFile::FindFiles(filter.c_str(), [&tempFiles](const char* fileName, bool isFile)
+                {
+                    if (isFile)
+                    {
+                        tempFiles.emplace_back(fileName);
+                    }
+                    return true;
+                });
+            for (const AZStd::string& tempFile : tempFiles)
+            {
+                SystemFile::Delete((m_cachePath + tempFile).c_str());
+            }
+
+            struct FoundEntry
+            {
+                Entry m_entry;
+                u64 m_modificationTime;
+            };
+            AZStd::vector<FoundEntry> foundEntries;
+            AZStd::string path;
+            filter = AZStd::string::format("%s*%s", m_cachePath.c_str(), CacheFileExtension);
+            SystemFile::FindFiles(filter.c_str(), [this, &foundEntries, &path](const char* fileName, bool isFile)
+                {
+                    if (!isFile || strlen(fileName) != KeyNameLength + AZ_ARRAY_SIZE(CacheFileExtension) - 1)
+                    {
+                        return true;
+                    }
+                    char* end = nullptr;
+                    Key key = strtoull(fileName, &end, 16);
+                    if (end != fileName + KeyNameLength)
+                    {
+                        return true;
+                    }
+                    path = m_cachePath;
+                    path += fileName;
+                    u64 size = SystemFile::Length(path.c_str());
+                    if (size > 0)
+                    {
+                        foundEntries.push_back({ { key, size }, SystemFile::ModificationTime(path.c_str()) });
+                    }
+                    return true;
+                });
+
+            // The write time is the best available approximation of when a file was last used in a previous run.
+            AZStd::sort(foundEntries.begin(), foundEntries.end(), [](const FoundEntry& lhs, const FoundEntry& rhs)
+                {
+                    return lhs.m_modificationTime > rhs.m_modificationTime;
+                });
+            for (const FoundEntry& found : foundEntries)
+            {
+                m_entryLookup[found.m_entry.m_key] = m_entries.insert(m_entries.end(), found.m_entry);
+                m_cachedSize += found.m_entry.m_size;
+            }
+            // The cache size may have been reduced since the last run.
+            EvictEntries();
+        }
+
+        void PersistentCache::ProcessCompletedWrites()
+        {
+            AZStd::vector<CompletedWrite> completedWrites;
+            {
+                AZStd::scoped_lock guard(m_writeGuard);
+                if (m_completedWrites.empty())
+                {
+                    return;
+                }
+                completedWrites.swap(m_completedWrites);
+            }
+
+            for (const CompletedWrite& write : completedWrites)
+            {
+                m_inFlightWrites.erase(write.m_key);
+                if (write.m_succeeded)
+                {
+                    AddEntry(write.m_key, write.m_size);
+                }
+            }
+            EvictEntries();
+        }
+
+        void PersistentCache::AddEntry(Key key, u64 size)
+        {
+            if (auto existing = m_entryLookup.find(key); existing != m_entryLookup.end())
+            {
+                // The file was rewritten, which can happen if a read from the cache failed.
+                m_cachedSize -= existing->second->m_size;
+                m_entries.erase(existing->second);
+            }
+            m_entries.push_front({ key, size });
+            m_entryLookup[key] = m_entries.begin();
+            m_cachedSize += size;
+        }
+
+        void PersistentCache::RemoveEntry(EntryList::iterator entry)
+        {
+            AZStd::string path;
+            BuildPath(path, entry->m_key, CacheFileExtension);
+
+            m_cachedSize -= entry->m_size;
+            m_entryLookup.erase(entry->m_key);
+            m_entries.erase(entry);
+
+            // Entries further down the stack may still have the file open or cached, so flush it before deleting. Reads from
+            // this file that are still in flight will fail and fall back to decompressing.
+            RequestPath cachedFile;
+            cachedFile.InitFromAbsolutePath(path);
+            FileRequest* flush = m_context->GetNewInternalRequest();
+            flush->CreateFlush(AZStd::move(cachedFile));
+            flush->SetCompletionCallback([path = AZStd::move(path)](FileRequest&)
+                {
+                    SystemFile::Delete(path.c_str());
+                });
+            StreamStackEntry::QueueRequest(flush);
+        }
+
+        void PersistentCache::EvictEntries()
+        {
+            while (m_cachedSize > m_cacheSize && !m_entries.empty())
+            {
+                RemoveEntry(AZStd::prev(m_entries.end()));
+            }
+        }
+
+        void PersistentCache::WriteThread()
+        {
+            AZStd::string targetPath;
+            AZStd::string tempPath;
+            while (true)
+            {
+                PendingWrite write;
+                {
+                    AZStd::unique_lock<AZStd::mutex> lock(m_writeGuard);
+                    m_writeSignal.wait(lock, [this]() { return m_shutdown || !m_pendingWrites.empty(); });
+                    if (m_shutdown)
+                    {
+                        return;
+                    }
+                    write = AZStd::move(m_pendingWrites.front());
+                    m_pendingWrites.pop_front();
+                }
+
+                AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzCore, "PersistentCache::Write");
+
+                // Write to a temporary file first so a partially written file is never picked up as a cached file.
+                BuildPath(targetPath, write.m_key, CacheFileExtension);
+                BuildPath(tempPath, write.m_key, TempFileExtension);
+                bool succeeded = false;
+                SystemFile file;
+                if (file.Open(tempPath.c_str(),
+                    SystemFile::SF_OPEN_CREATE | SystemFile::SF_OPEN_CREATE_PATH | SystemFile::SF_OPEN_WRITE_ONLY))
+                {
+                    succeeded = file.Write(write.m_data.data(), write.m_data.size()) == write.m_data.size();
+                    file.Close();
+                    succeeded = succeeded && SystemFile::Rename(tempPath.c_str(), targetPath.c_str(), true);
+                    if (!succeeded)
+                    {
+                        SystemFile::Delete(tempPath.c_str());
+                    }
+                }
+                AZ_Warning("Streamer", succeeded, "Unable to write '%s' to the persistent cache.", targetPath.c_str());
+
+                {
+                    AZStd::scoped_lock guard(m_writeGuard);
+                    m_pendingWriteSize -= write.m_data.size();
+                    m_completedWrites.push_back({ write.m_key, write.m_data.size(), succeeded });
+                }
+                // The scheduling thread isn't woken up for this as cache writes aren't tied to any request. The file will be
+                // added to the cache the next time requests are processed.
+            }
+        }
+    } // namespace IO
+} // namespace AZ
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Streamer/Statistics.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Statistics/RunningStatistic.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/list.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ
+{
+    namespace IO
+    {
+        struct PersistentCacheConfig final :
+            public IStreamerStackConfig
+        {
+            AZ_RTTI(AZ::IO::PersistentCacheConfig, "{0C5B1E3A-6E4D-4F8A-9B39-2D7A0C8E51F4}", IStreamerStackConfig);
+            AZ_CLASS_ALLOCATOR(PersistentCacheConfig, AZ::SystemAllocator, 0);
+
+            ~PersistentCacheConfig() override = default;
+            AZStd::shared_ptr<StreamStackEntry> AddStreamStackEntry(
+                const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent) override;
+            static void Reflect(AZ::ReflectContext* context);
+
+            //! Folder the decompressed files are stored in. Aliases are supported. If left empty the cache is disabled
+            //! and no entry is added to the stack.
+            AZStd::string m_cachePath;
+            //! The maximum size of all cached files combined in megabytes. When the cache grows beyond this size the least
+            //! recently used files are removed.
+            u32 m_cacheSizeMib{ 2048 };
+            //! The maximum amount of decompressed data in megabytes that can be waiting to be written to the cache. Files
+            //! that would exceed this limit are not cached.
+            u32 m_maxPendingWritesMib{ 64 };
+        };
+
+        //! Entry in the streaming stack that keeps decompressed files on disk so they don't need to be decompressed again,
+        //! including on subsequent runs. This entry needs to be placed directly above an entry that decompresses, such
+        //! as the FullFileDecompressor, as it intercepts the compressed reads on their way to the decompressor.
+        //! Cached files are keyed by the archive, its size and modification time and the location of the file in the
+        //! archive so rebuilding an archive invalidates its entries.
+        //! Only reads of complete files are added to the cache as the decompressor has to process the entire file anyway,
+        //! but partial reads are served from the cache once a file has been added. Writing to the cache is done on a
+        //! separate thread so the scheduling thread doesn't wait for the cache.
+        class PersistentCache
+            : public StreamStackEntry
+        {
+        public:
+            PersistentCache(AZStd::string cachePath, u64 cacheSize, u64 maxPendingWriteSize);
+            ~PersistentCache() override;
+
+            PersistentCache(const PersistentCache&) = delete;
+            PersistentCache& operator=(const PersistentCache&) = delete;
+
+            void QueueRequest(FileRequest* request) override;
+            bool ExecuteRequests() override;
+
+            void CollectStatistics(AZStd::vector<Statistic>& statistics) const override;
+
+            //! Returns the number of files currently in the cache. Files that are still being written are not included until
+            //! the next time requests are queued or executed.
+            size_t GetNumCachedFiles() const;
+            //! Returns the combined size of the files currently in the cache.
+            u64 GetCachedSize() const;
+            //! Returns true if there are files that are waiting to be written to the cache or have been written but not added yet.
+            bool HasPendingWrites() const;
+
+        private:
+            using Key = u64;
+
+            struct Entry
+            {
+                Key m_key;
+                u64 m_size;
+            };
+            using EntryList = AZStd::list<Entry>;
+
+            struct PendingWrite
+            {
+                AZStd::vector<u8> m_data;
+                Key m_key;
+            };
+
+            struct CompletedWrite
+            {
+                Key m_key;
+                u64 m_size;
+                bool m_succeeded;
+            };
+
+            void CompressedRead(FileRequest* request, FileRequest::CompressedReadData& data);
+            void ReadFromCache(FileRequest* request, Key key);
+            void ReadAndStore(FileRequest* request, FileRequest::CompressedReadData& data, Key key);
+
+            void FlushCache(const RequestPath& filePath);
+            void FlushEntireCache();
+
+            bool CalculateKey(Key& key, const CompressionInfo& info);
+            void BuildPath(AZStd::string& path, Key key, const char* extension) const;
+
+            void LoadIndex();
+            void ProcessCompletedWrites();
+            void AddEntry(Key key, u64 size);
+            void RemoveEntry(EntryList::iterator entry);
+            void EvictEntries();
+
+            void WriteThread();
+
+            //! Archive stamps based on size and modification time, keyed by the hash of the archive path.
+            AZStd::unordered_map<size_t, u64> m_archiveStamps;
+
+            //! Cached files with the most recently used at the front.
+            EntryList m_entries;
+            AZStd::unordered_map<Key, EntryList::iterator> m_entryLookup;
+            //! Keys of files that have been handed to the write thread but haven't been completed yet.
+            AZStd::unordered_set<Key> m_inFlightWrites;
+
+            AZStd::string m_cachePath;
+
+            AZ::Statistics::RunningStatistic m_hitRateStat;
+
+            AZStd::thread_desc m_writeThreadDesc;
+            AZStd::thread m_writeThread;
+            AZStd::mutex m_writeGuard;
+            AZStd::condition_variable m_writeSignal;
+            AZStd::deque<PendingWrite> m_pendingWrites;
+            AZStd::vector<CompletedWrite> m_completedWrites;
+            u64 m_pendingWriteSize{ 0 };
+
+            u64 m_cacheSize;
+            u64 m_cachedSize{ 0 };
+            u64 m_maxPendingWriteSize;
+            bool m_indexLoaded{ false };
+            bool m_shutdown{ false };
+        };
+    } // namespace IO
+} // namespace AZ
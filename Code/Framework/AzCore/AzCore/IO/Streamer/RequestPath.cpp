@@ -80,7 +80,7 @@ namespace AZ
         {
             m_path = AZStd::move(path);
             m_relativePathOffset = 0;
-            m_absolutePathHash = AZStd::hash<AZStd::string>{}(m_path);
+            m_absolutePathHash = AZStd::fast_string_hash{}(m_path);
         }
 
         bool RequestPath::IsValid() const
@@ -130,7 +130,7 @@ namespace AZ
 
                 size_t relativePathLength = m_path.length() - m_relativePathOffset;
                 m_path = fullPath;
-                m_absolutePathHash = AZStd::hash<AZStd::string>{}(m_path);
+                m_absolutePathHash = AZStd::fast_string_hash{}(m_path);
                 if (m_path.length() >= relativePathLength)
                 {
                     m_relativePathOffset = m_path.length() - relativePathLength;
@@ -9,12 +9,15 @@
 #include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/IO/Streamer/Scheduler.h>
 #include <AzCore/std/containers/deque.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/sort.h>
 
 namespace AZ::IO
 {
     static constexpr char SchedulerName[] = "Scheduler";
     static constexpr char ImmediateReadsName[] = "Immediate reads";
+    static constexpr char PredictedBandwidthName[] = "Predicted bandwidth (avg. mbps)";
+    static constexpr char PredictedDeadlineMissesName[] = "Predicted deadline misses";
 
     Scheduler::Scheduler(AZStd::shared_ptr<StreamStackEntry> streamStack, u64 memoryAlignment, u64 sizeAlignment, u64 granularity)
     {
@@ -28,6 +31,8 @@ namespace AZ::IO
         m_recommendations.m_sizeAlignment = sizeAlignment;
         m_recommendations.m_maxConcurrentRequests = aznumeric_caster(status.m_numAvailableSlots);
         m_recommendations.m_granularity = granularity;
+        m_prediction = AZStd::make_shared<IStreamerTypes::SchedulingPrediction>();
+        m_recommendations.m_schedulingPrediction = m_prediction;
 
         m_threadData.m_streamStack = AZStd::move(streamStack);
     }
@@ -70,33 +75,57 @@ namespace AZ::IO
     {
         AZ_Assert(m_isRunning, "Trying to queue a request when Streamer's scheduler isn't running.");
 
+        if (!m_pendingRequestsRing.try_push(AZStd::move(request)))
         {
             AZStd::scoped_lock lock(m_pendingRequestsLock);
             m_pendingRequests.push_back(AZStd::move(request));
+            m_hasOverflowRequests.store(true, AZStd::memory_order_release);
         }
-        m_context.WakeUpSchedulingThread();
+        WakeUpForPendingRequests();
     }
 
     void Scheduler::QueueRequestBatch(const AZStd::vector<FileRequestPtr>& requests)
     {
         AZ_Assert(m_isRunning, "Trying to queue a batch of requests when Streamer's scheduler isn't running.");
 
+        for (auto it = requests.begin(); it != requests.end(); ++it)
         {
-            AZStd::scoped_lock lock(m_pendingRequestsLock);
-            m_pendingRequests.insert(m_pendingRequests.end(), requests.begin(), requests.end());
+            if (!m_pendingRequestsRing.try_push(*it))
+            {
+                AZStd::scoped_lock lock(m_pendingRequestsLock);
+                m_pendingRequests.insert(m_pendingRequests.end(), it, requests.end());
+                m_hasOverflowRequests.store(true, AZStd::memory_order_release);
+                break;
+            }
         }
-        m_context.WakeUpSchedulingThread();
+        WakeUpForPendingRequests();
     }
 
     void Scheduler::QueueRequestBatch(AZStd::vector<FileRequestPtr>&& requests)
     {
         AZ_Assert(m_isRunning, "Trying to queue a batch of requests when Streamer's scheduler isn't running.");
 
+        for (auto it = requests.begin(); it != requests.end(); ++it)
         {
-            AZStd::scoped_lock lock(m_pendingRequestsLock);
-            AZStd::move(requests.begin(), requests.end(), AZStd::back_inserter(m_pendingRequests));
+            if (!m_pendingRequestsRing.try_push(AZStd::move(*it)))
+            {
+                AZStd::scoped_lock lock(m_pendingRequestsLock);
+                AZStd::move(it, requests.end(), AZStd::back_inserter(m_pendingRequests));
+                m_hasOverflowRequests.store(true, AZStd::memory_order_release);
+                break;
+            }
+        }
+        WakeUpForPendingRequests();
+    }
+
+    void Scheduler::WakeUpForPendingRequests()
+    {
+        // The scheduling thread clears the flag before collecting requests, so any request queued after that point
+        // either gets collected in the same pass or issues a new wake up.
+        if (!m_wakeUpPending.exchange(true, AZStd::memory_order_acq_rel))
+        {
+            m_context.WakeUpSchedulingThread();
         }
-        m_context.WakeUpSchedulingThread();
     }
 
     void Scheduler::SuspendProcessing()
@@ -121,6 +150,10 @@ namespace AZ::IO
         statistics.push_back(Statistic::CreateFloat(SchedulerName, "Processing speed (avg. mbps)", m_processingSpeedStat.CalculateAverage()));
         statistics.push_back(Statistic::CreatePercentage(SchedulerName, ImmediateReadsName, m_immediateReadsPercentageStat.GetAverage()));
 #endif
+        statistics.push_back(Statistic::CreateFloat(SchedulerName, PredictedBandwidthName,
+            m_predictedBandwidthStat.CalculateAverage() / 1_mib));
+        statistics.push_back(Statistic::CreateInteger(SchedulerName, PredictedDeadlineMissesName,
+            m_prediction->m_predictedDeadlineMisses.load(AZStd::memory_order_relaxed)));
         m_context.CollectStatistics(statistics);
         m_threadData.m_streamStack->CollectStatistics(statistics);
     }
@@ -320,16 +353,23 @@ namespace AZ::IO
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
 
+        m_wakeUpPending.store(false, AZStd::memory_order_release);
+
+        FileRequestPtr pendingRequest;
+        while (m_pendingRequestsRing.try_pop(pendingRequest))
+        {
+            outstandingRequests.push_back(AZStd::move(pendingRequest));
+        }
+        if (m_hasOverflowRequests.load(AZStd::memory_order_acquire))
         {
             AZStd::scoped_lock lock(m_pendingRequestsLock);
-            if (!m_pendingRequests.empty())
-            {
-                outstandingRequests.swap(m_pendingRequests);
-            }
-            else
-            {
-                return false;
-            }
+            m_hasOverflowRequests.store(false, AZStd::memory_order_relaxed);
+            AZStd::move(m_pendingRequests.begin(), m_pendingRequests.end(), AZStd::back_inserter(outstandingRequests));
+            m_pendingRequests.clear();
+        }
+        if (outstandingRequests.empty())
+        {
+            return false;
         }
 
 #if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
@@ -476,10 +516,20 @@ namespace AZ::IO
             // Let the one with the highest priority go first.
             if (firstRead->m_priority != secondRead->m_priority)
             {
-                return firstRead->m_priority < secondRead->m_priority ? Order::FirstRequest : Order::SecondRequest;
+                return firstRead->m_priority > secondRead->m_priority ? Order::FirstRequest : Order::SecondRequest;
             }
 
-            // If neither has started and have the same priority, prefer to start the closest deadline.
+            // A request that's already past its deadline can no longer be on time, so prefer the request that can still
+            // make its deadline if it's started first. This avoids a single late request causing all following requests
+            // to be late as well.
+            bool firstIsLate = firstRead->m_deadline <= m_threadData.m_scheduleTime;
+            bool secondIsLate = secondRead->m_deadline <= m_threadData.m_scheduleTime;
+            if (firstIsLate != secondIsLate)
+            {
+                return secondIsLate ? Order::FirstRequest : Order::SecondRequest;
+            }
+
+            // Otherwise use earliest deadline first.
             return firstRead->m_deadline <= secondRead->m_deadline ? Order::FirstRequest : Order::SecondRequest;
         }
 
@@ -546,6 +596,7 @@ namespace AZ::IO
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
 
         AZStd::chrono::system_clock::time_point now = AZStd::chrono::system_clock::now();
+        m_threadData.m_scheduleTime = now;
         auto& pendingQueue = m_context.GetPreparedRequests();
 
         m_threadData.m_streamStack->UpdateCompletionEstimates(now, m_threadData.m_internalPendingRequests,
@@ -576,6 +627,77 @@ namespace AZ::IO
             };
 
             AZStd::sort(pendingQueue.begin(), pendingQueue.end(), sorter);
+
+            // The estimates were calculated for the order before sorting, so update them to match the order the requests
+            // will be processed in. This keeps the estimated completion times reported for requests and the predictions
+            // accurate.
+            m_threadData.m_streamStack->UpdateCompletionEstimates(now, m_threadData.m_internalPendingRequests,
+                pendingQueue.begin(), pendingQueue.end());
+            m_threadData.m_internalPendingRequests.clear();
+        }
+
+        Thread_UpdatePredictions(now);
+    }
+
+    void Scheduler::Thread_UpdatePredictions(AZStd::chrono::system_clock::time_point now)
+    {
+        auto readSize = [](auto&& args) -> u64
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData>)
+            {
+                return args.m_size;
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::CompressedReadData>)
+            {
+                return args.m_readSize;
+            }
+            else
+            {
+                return 0;
+            }
+        };
+
+        AZStd::chrono::system_clock::time_point queueCompletion = now;
+        AZStd::chrono::system_clock::time_point previousCompletion;
+        AZStd::chrono::microseconds readDuration{ 0 };
+        u64 bytesRead = 0;
+        u32 deadlineMisses = 0;
+        bool isFirst = true;
+        for (const FileRequest* request : m_context.GetPreparedRequests())
+        {
+            AZStd::chrono::system_clock::time_point completion = request->GetEstimatedCompletion();
+            queueCompletion = AZStd::max(queueCompletion, completion);
+
+            const FileRequest::ReadRequestData* read = request->GetCommandFromChain<FileRequest::ReadRequestData>();
+            if (read && completion > read->m_deadline)
+            {
+                deadlineMisses++;
+            }
+
+            // The time between two consecutive requests is the time the stream stack estimates it needs for the second
+            // request, which gives the bandwidth without including the work that's already in progress in the stack.
+            if (!isFirst && completion > previousCompletion)
+            {
+                u64 size = AZStd::visit(readSize, request->GetCommand());
+                if (size > 0)
+                {
+                    bytesRead += size;
+                    readDuration += AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(completion - previousCompletion);
+                }
+            }
+            previousCompletion = completion;
+            isFirst = false;
+        }
+
+        if (bytesRead > 0 && readDuration.count() > 0)
+        {
+            m_predictedBandwidthStat.PushEntry((bytesRead * 1000000) / aznumeric_cast<u64>(readDuration.count()));
+            m_prediction->m_bandwidth.store(aznumeric_cast<u64>(m_predictedBandwidthStat.CalculateAverage()), AZStd::memory_order_relaxed);
         }
+        m_prediction->m_queueCompletionTime.store(
+            AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(queueCompletion.time_since_epoch()).count(),
+            AZStd::memory_order_relaxed);
+        m_prediction->m_predictedDeadlineMisses.store(deadlineMisses, AZStd::memory_order_relaxed);
     }
 } // namespace AZ::IO
@@ -15,6 +15,7 @@
 #include <AzCore/IO/Streamer/StreamStackEntry.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/containers/lock_free_mpsc_ring.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
@@ -73,6 +74,9 @@ namespace AZ::IO
         //! Determine which of the two provided requests is more important to process next.
         Order Thread_PrioritizeRequests(const FileRequest* first, const FileRequest* second) const;
         void Thread_ScheduleRequests();
+        //! Updates the shared scheduling predictions from the completion estimates of the requests in the stack and the
+        //! prepared queue.
+        void Thread_UpdatePredictions(AZStd::chrono::system_clock::time_point now);
 
         // Stores data that's unguarded and should only be changed by the scheduling thread.
         struct ThreadData final
@@ -83,11 +87,17 @@ namespace AZ::IO
             RequestPath m_lastFilePath; //!< Path of the last file queued for reading.
             AZStd::shared_ptr<StreamStackEntry> m_streamStack;
             u64 m_lastFileOffset{ 0 }; //!< Offset of into the last file queued after reading has completed.
+            //! Time at which the current scheduling pass started.
+            AZStd::chrono::system_clock::time_point m_scheduleTime;
         };
         ThreadData m_threadData;
         StreamerContext m_context;
 
         IStreamerTypes::Recommendations m_recommendations;
+        //! Predictions shared with the recommendations so they can be read while the scheduler updates them.
+        AZStd::shared_ptr<IStreamerTypes::SchedulingPrediction> m_prediction;
+        //! Effective bandwidth of the stream stack according to its own estimates, in bytes per second.
+        AverageWindow<u64, double, s_statisticsWindowSize> m_predictedBandwidthStat;
 
         StreamStackEntry::Status m_stackStatus;
 #if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
@@ -104,8 +114,21 @@ namespace AZ::IO
         AZ::Statistics::RunningStatistic m_immediateReadsPercentageStat;
 #endif
 
+        //! Wakes the scheduling thread unless a wake up has already been issued since it last collected requests.
+        void WakeUpForPendingRequests();
+
+        //! Number of requests that can be queued from other threads between two scheduler passes before queuing
+        //! falls back to the locked overflow list.
+        inline static constexpr size_t PendingRequestsRingSize = 4096;
+        AZStd::lock_free_mpsc_ring<FileRequestPtr, PendingRequestsRingSize> m_pendingRequestsRing;
+
+        //! Overflow for requests that didn't fit in the ring. Only touched when the ring is full.
         AZStd::mutex m_pendingRequestsLock;
         AZStd::vector<FileRequestPtr> m_pendingRequests;
+        AZStd::atomic_bool m_hasOverflowRequests{ false };
+        //! Set by the first producer after the scheduling thread collected requests, so a burst of queued requests
+        //! results in a single wake up.
+        AZStd::atomic_bool m_wakeUpPending{ false };
 
         AZStd::thread m_mainLoop;
         AZStd::atomic_bool m_isRunning{ false };
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Jobs/CpuTopology.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace AZ
+{
+    CpuTopology CpuTopology::Discover()
+    {
+        CpuTopology topology;
+        if (!Platform::DiscoverCpuTopology(topology) || topology.m_processors.empty())
+        {
+            return CreateFlat(AZStd::thread::hardware_concurrency());
+        }
+
+        // Platforms report the raw ids, count the distinct groups here so every platform gets the same behavior.
+        for (const LogicalProcessor& processor : topology.m_processors)
+        {
+            topology.m_numCoreClusters = AZStd::max(topology.m_numCoreClusters, processor.m_coreCluster + 1);
+            topology.m_numNumaNodes = AZStd::max(topology.m_numNumaNodes, processor.m_numaNode + 1);
+        }
+        return topology;
+    }
+
+    CpuTopology CpuTopology::CreateFlat(AZ::u32 processorCount)
+    {
+        CpuTopology topology;
+        topology.m_processors.resize(AZStd::max(processorCount, 1u));
+        for (AZ::u32 i = 0; i < topology.m_processors.size(); ++i)
+        {
+            topology.m_processors[i].m_id = i;
+        }
+        topology.m_numCoreClusters = 1;
+        topology.m_numNumaNodes = 1;
+        return topology;
+    }
+
+    AZ::u32 CpuTopology::GetDistance(AZ::u32 clusterA, AZ::u32 nodeA, AZ::u32 clusterB, AZ::u32 nodeB)
+    {
+        const bool sameNode = nodeA == Unknown || nodeB == Unknown || nodeA == nodeB;
+        if (!sameNode)
+        {
+            return 2;
+        }
+        const bool sameCluster = clusterA == Unknown || clusterB == Unknown || clusterA == clusterB;
+        return sameCluster ? 0 : 1;
+    }
+}
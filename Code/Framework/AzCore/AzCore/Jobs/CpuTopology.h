@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    /**
+     * Description of how the logical processors of the machine are grouped. Two levels are tracked: the core
+     * cluster (logical processors sharing a last level cache, e.g. a CCX or a socket on older CPUs) and the NUMA
+     * node. Used to place job workers and to keep work stealing local.
+     */
+    struct CpuTopology
+    {
+        static constexpr AZ::u32 Unknown = static_cast<AZ::u32>(-1);
+
+        struct LogicalProcessor
+        {
+            AZ::u32 m_id = 0;                   ///< OS logical processor index.
+            AZ::u32 m_coreCluster = 0;          ///< Index of the group of processors sharing the last level cache.
+            AZ::u32 m_numaNode = 0;             ///< NUMA node the processor belongs to.
+        };
+
+        AZStd::vector<LogicalProcessor> m_processors;
+        AZ::u32 m_numCoreClusters = 0;
+        AZ::u32 m_numNumaNodes = 0;
+
+        //! Queries the OS for the processor layout. Platforms without topology support report every processor
+        //! in a single cluster on a single node, which is equivalent to the flat worker placement.
+        static CpuTopology Discover();
+
+        //! Builds a topology where all processorCount processors share one cluster and one node.
+        static CpuTopology CreateFlat(AZ::u32 processorCount);
+
+        //! True if there is more than one cluster or node, i.e. if worker placement makes a difference.
+        bool IsHierarchical() const { return m_numCoreClusters > 1 || m_numNumaNodes > 1; }
+
+        //! Stealing distance between two workers described by their cluster and node. 0 is the same cluster,
+        //! 1 the same node, 2 a remote node. Unknown groups are treated as the same group.
+        static AZ::u32 GetDistance(AZ::u32 clusterA, AZ::u32 nodeA, AZ::u32 clusterB, AZ::u32 nodeB);
+    };
+
+    namespace Platform
+    {
+        //! Fills the processor list from the OS. Returns false if it isn't supported on this platform.
+        bool DiscoverCpuTopology(CpuTopology& topology);
+    }
+}
@@ -14,6 +14,7 @@
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/functional.h>
+#include <AzCore/std/sort.h>
 
 #include <AzCore/Debug/Profiler.h>
 
@@ -85,6 +86,8 @@ JobManagerWorkStealing::JobManagerWorkStealing(const JobManagerDesc& desc)
     : m_isAsynchronous(!desc.m_workerThreads.empty())
     , m_workerThreads(AZStd::move(CreateWorkerThreads(desc.m_workerThreads)))
 {
+    BuildStealOrders();
+
     //allow workers to begin processing after they have all been created, needed to wait since they may access each others queues
     m_initSemaphore.release(static_cast<unsigned int>(desc.m_workerThreads.size()));
 }
@@ -327,7 +330,8 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
 
     //get thread local job queue
     WorkQueue* pendingJobs = info->m_isWorker ? &info->m_pendingJobs : nullptr;
-    unsigned int victim = ((m_workerThreads.size() > 1) && (m_workerThreads[0] == info)) ? 1 : 0;
+    const AZStd::vector<unsigned int>& stealOrder = info->m_isWorker ? info->m_stealOrder : m_defaultStealOrder;
+    size_t victimSlot = 0;
 
     while (true)
     {
@@ -450,7 +454,7 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
             AZStd::sys_time_t jobEndTime = AZStd::GetTimeNowTicks();
             info->m_jobTime += jobEndTime - jobStartTime;
 #endif
-            if (m_workerThreads.size() < 2)
+            if (m_workerThreads.size() < 2 || stealOrder.empty())
             {
                 isTerminated = true;
             }
@@ -460,7 +464,7 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                 AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzCore, "JobManagerWorkStealing::ProcessJobsInternal:WorkStealing");
 
                 unsigned int numStealAttempts = 0;
-                const unsigned int maxStealAttempts = (unsigned int)m_workerThreads.size() * 3; //try every thread a few times before giving up
+                const unsigned int maxStealAttempts = (unsigned int)stealOrder.size() * 3; //try every thread a few times before giving up
                 while (!job)
                 {
                     //check if our suspended job is ready, before we try stealing a new job
@@ -471,7 +475,7 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                     }
 
                     //select a victim thread, using the same victim as the previous successful steal if possible
-                    WorkQueue* victimQueue = &m_workerThreads[victim]->m_pendingJobs;
+                    WorkQueue* victimQueue = &m_workerThreads[stealOrder[victimSlot]]->m_pendingJobs;
 
                     //attempt the steal
                     job = victimQueue->TryStealFront();
@@ -499,13 +503,9 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                         break;
                     }
 
-                    //steal failed, choose a new victim for next time
-                    victim = (victim + 1) % m_workerThreads.size();
-                    if (m_workerThreads[victim] == info)
-                    {
-                        //don't steal from ourselves
-                        victim = (victim + 1) % m_workerThreads.size();
-                    }
+                    //steal failed, choose the next nearest victim for next time. The order already excludes this thread and
+                    //wraps back to the closest workers, so remote nodes are only visited once the local ones came up empty.
+                    victimSlot = (victimSlot + 1) % stealOrder.size();
                 }
             }
 #ifdef JOBMANAGER_ENABLE_STATS
@@ -633,6 +633,8 @@ JobManagerWorkStealing::ThreadList JobManagerWorkStealing::CreateWorkerThreads(c
         info->m_isWorker = true;
         info->m_owningManager = this;
         info->m_workerId = iThread;
+        info->m_coreCluster = desc.m_coreCluster;
+        info->m_numaNode = desc.m_numaNode;
 
         AZStd::thread_desc threadDesc;
         threadDesc.m_name = "AZ JobManager worker thread";
@@ -660,6 +662,38 @@ JobManagerWorkStealing::ThreadList JobManagerWorkStealing::CreateWorkerThreads(c
     return workerThreads;
 }
 
+void JobManagerWorkStealing::BuildStealOrders()
+{
+    const unsigned int numWorkers = static_cast<unsigned int>(m_workerThreads.size());
+
+    m_defaultStealOrder.resize(numWorkers);
+    for (unsigned int i = 0; i < numWorkers; ++i)
+    {
+        m_defaultStealOrder[i] = i;
+    }
+
+    for (ThreadInfo* info : m_workerThreads)
+    {
+        info->m_stealOrder.clear();
+        info->m_stealOrder.reserve(numWorkers > 0 ? numWorkers - 1 : 0);
+
+        //start each list right after the owning worker so the workers of a cluster don't all target the same victim
+        for (unsigned int offset = 1; offset < numWorkers; ++offset)
+        {
+            info->m_stealOrder.push_back((info->m_workerId + offset) % numWorkers);
+        }
+
+        AZStd::stable_sort(info->m_stealOrder.begin(), info->m_stealOrder.end(),
+            [this, info](unsigned int lhs, unsigned int rhs)
+            {
+                const ThreadInfo* lhsInfo = m_workerThreads[lhs];
+                const ThreadInfo* rhsInfo = m_workerThreads[rhs];
+                return CpuTopology::GetDistance(info->m_coreCluster, info->m_numaNode, lhsInfo->m_coreCluster, lhsInfo->m_numaNode) <
+                    CpuTopology::GetDistance(info->m_coreCluster, info->m_numaNode, rhsInfo->m_coreCluster, rhsInfo->m_numaNode);
+            });
+    }
+}
+
 inline void JobManagerWorkStealing::ActivateWorker()
 {
     // find an available worker thread (we do it brute force because the number of threads is small)
@@ -99,6 +99,9 @@ namespace AZ
                 AZStd::binary_semaphore m_waitEvent;
                 WorkQueue m_pendingJobs;
                 unsigned int m_workerId = JobManagerBase::InvalidWorkerThreadId;
+                AZ::u32 m_coreCluster = CpuTopology::Unknown;
+                AZ::u32 m_numaNode = CpuTopology::Unknown;
+                AZStd::vector<unsigned int> m_stealOrder; //worker indices to steal from, nearest (same cluster, then same node) first
 
 #ifdef JOBMANAGER_ENABLE_STATS
                 unsigned int m_globalJobs = 0;
@@ -116,6 +119,7 @@ namespace AZ
             void ProcessJobsSynchronous(ThreadInfo* info, Job* suspendedJob, AZStd::atomic<bool>* notifyFlag);
             void ProcessJobsInternal(ThreadInfo* info, Job* suspendedJob, AZStd::atomic<bool>* notifyFlag);
             ThreadList CreateWorkerThreads(const JobManagerDesc::DescList& workerDescList);
+            void BuildStealOrders();
 #ifndef AZ_MONOLITHIC_BUILD
             ThreadInfo* CrossModuleFindAndSetWorkerThreadInfo() const;
 #endif
@@ -130,6 +134,7 @@ namespace AZ
             AZStd::semaphore m_initSemaphore;
 
             const ThreadList m_workerThreads; //no mutex required for this list, it's only assigned during startup, must be declared after m_threads and m_initSemaphore
+            AZStd::vector<unsigned int> m_defaultStealOrder; //used by non-worker threads assisting with jobs
 
             using GlobalJobQueue = AZStd::deque<Job*>;
             using GlobalQueueMutexType = AZStd::mutex;
@@ -9,6 +9,7 @@
 #include <AzCore/Jobs/JobManager.h>
 
 #include <AzCore/Jobs/Job.h>
+#include <AzCore/std/sort.h>
 
 using namespace AZ;
 
@@ -22,3 +23,49 @@ JobManager::JobManager(const JobManagerDesc& desc)
 JobManager::~JobManager()
 {
 }
+
+void JobManagerDesc::AddWorkersFromTopology(const CpuTopology& topology, AZ::u32 numWorkers, int priority, int stackSize)
+{
+    if (topology.m_processors.empty())
+    {
+        return;
+    }
+
+    // Bucket the processors per node, sorted by cluster so consecutive workers of a node share caches.
+    AZStd::vector<AZStd::vector<const CpuTopology::LogicalProcessor*>> perNode(AZStd::max(topology.m_numNumaNodes, 1u));
+    for (const CpuTopology::LogicalProcessor& processor : topology.m_processors)
+    {
+        const size_t node = AZStd::min<size_t>(processor.m_numaNode, perNode.size() - 1);
+        perNode[node].push_back(&processor);
+    }
+    for (auto& processors : perNode)
+    {
+        AZStd::stable_sort(processors.begin(), processors.end(),
+            [](const CpuTopology::LogicalProcessor* lhs, const CpuTopology::LogicalProcessor* rhs)
+            {
+                return lhs->m_coreCluster < rhs->m_coreCluster;
+            });
+    }
+
+    // Interleave the nodes so a partial worker set is balanced between sockets.
+    AZStd::vector<const CpuTopology::LogicalProcessor*> placement;
+    placement.reserve(topology.m_processors.size());
+    for (size_t index = 0; placement.size() < topology.m_processors.size(); ++index)
+    {
+        for (const auto& processors : perNode)
+        {
+            if (index < processors.size())
+            {
+                placement.push_back(processors[index]);
+            }
+        }
+    }
+
+    for (AZ::u32 i = 0; i < numWorkers && !m_workerThreads.full(); ++i)
+    {
+        // Oversubscribing wraps around in the same order.
+        const CpuTopology::LogicalProcessor& processor = *placement[i % placement.size()];
+        const int cpuId = processor.m_id < (sizeof(int) * 8 - 1) ? (1 << processor.m_id) : -1;
+        m_workerThreads.push_back(JobManagerThreadDesc(cpuId, priority, stackSize, processor.m_coreCluster, processor.m_numaNode));
+    }
+}
@@ -14,6 +14,8 @@
 
 #include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/CpuTopology.h>
+#include <AzCore/Task/TaskExecutor.h>
 
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/Math/MathUtils.h>
@@ -27,8 +29,10 @@ namespace AZ
     JobManagerComponent::JobManagerComponent()
         : m_jobManager(nullptr)
         , m_jobGlobalContext(nullptr)
+        , m_taskExecutor(nullptr)
         , m_numberOfWorkerThreads(0)
         , m_firstThreadCPU(-1)
+        , m_useCpuTopology(true)
     {
     }
 
@@ -54,10 +58,20 @@ namespace AZ
         #endif // (AZ_TRAIT_MAX_JOB_MANAGER_WORKER_THREADS)
         }
 
-        threadDesc.m_cpuId = AFFINITY_MASK_USERTHREADS;
-        for (int i = 0; i < numberOfWorkerThreads; ++i)
+        // On multi-socket or multi-cluster machines place the workers explicitly so work stealing can stay local.
+        // Flat machines keep the OS placement.
+        const CpuTopology topology = m_useCpuTopology ? CpuTopology::Discover() : CpuTopology{};
+        if (topology.IsHierarchical())
         {
-            desc.m_workerThreads.push_back(threadDesc);
+            desc.AddWorkersFromTopology(topology, numberOfWorkerThreads);
+        }
+        else
+        {
+            threadDesc.m_cpuId = AFFINITY_MASK_USERTHREADS;
+            for (int i = 0; i < numberOfWorkerThreads; ++i)
+            {
+                desc.m_workerThreads.push_back(threadDesc);
+            }
         }
 
         m_jobManager = aznew JobManager(desc);
@@ -65,6 +79,10 @@ namespace AZ
 
         JobContext::SetGlobalContext(m_jobGlobalContext);
         AZ_Assert(JobContext::GetGlobalContext(), "Global context must be created");
+
+        // Frame level task graphs run on their own workers, sized like the job manager.
+        m_taskExecutor = aznew TaskExecutor(numberOfWorkerThreads, AFFINITY_MASK_USERTHREADS);
+        TaskExecutor::SetInstance(m_taskExecutor);
     }
 
     //=========================================================================
@@ -75,6 +93,10 @@ namespace AZ
     {
         JobManagerBus::Handler::BusDisconnect();
 
+        TaskExecutor::SetInstance(nullptr);
+        delete m_taskExecutor;
+        m_taskExecutor = nullptr;
+
         JobContext::SetGlobalContext(nullptr);
 
         delete m_jobGlobalContext;
@@ -119,6 +141,7 @@ namespace AZ
                 ->Version(1)
                 ->Field("NumberOfWorkerThreads", &JobManagerComponent::m_numberOfWorkerThreads)
                 ->Field("FirstThreadCPUID", &JobManagerComponent::m_firstThreadCPU)
+                ->Field("UseCpuTopology", &JobManagerComponent::m_useCpuTopology)
                 ;
 
             if (EditContext* editContext = serializeContext->GetEditContext())
@@ -134,6 +157,7 @@ namespace AZ
                     ->DataElement(AZ::Edit::UIHandlers::SpinBox, &JobManagerComponent::m_firstThreadCPU, "CPU ID", "First CPU ID for a worker thread, each consecutive thread will use the next CPU ID. -1 Will not assign CPU Ids")
                         ->Attribute(AZ::Edit::Attributes::Min, -1)
                         ->Attribute(AZ::Edit::Attributes::Max, 16)
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &JobManagerComponent::m_useCpuTopology, "Use CPU topology", "Place worker threads by core cluster and NUMA node and keep work stealing local on machines with more than one of either.")
                     ;
             }
         }
@@ -14,6 +14,8 @@
 
 namespace AZ
 {
+    class TaskExecutor;
+
     /**
      *
      */
@@ -50,8 +52,10 @@ namespace AZ
 
         JobManager*  m_jobManager;
         JobContext*  m_jobGlobalContext;
+        TaskExecutor* m_taskExecutor;
         int          m_numberOfWorkerThreads;   ///< Number of worked threads to spawn for this process. If <= 0 we will use all cores.
         int          m_firstThreadCPU;          ///< ID of the first thread, afterwards we just increment. If == -1, no CPU will be set.(TODO: We can have a full array)
+        bool         m_useCpuTopology;          ///< If true, workers are placed using the discovered CpuTopology on NUMA / multi-cluster machines.
     };
 }
 
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <AzCore/base.h>
+#include <AzCore/Jobs/CpuTopology.h>
 #include <AzCore/std/containers/fixed_vector.h>
 
 namespace AZ
@@ -36,10 +37,25 @@ namespace AZ
         */
         int     m_stackSize;
 
-        JobManagerThreadDesc(int cpuId = -1, int priority = -100000, int stackSize = -1)
+        /**
+         *  Index of the group of cores sharing a last level cache this thread runs on, see \ref CpuTopology.
+         *  Workers prefer stealing from workers in the same cluster, then the same NUMA node, then remote nodes.
+         *  Default is CpuTopology::Unknown, which treats all workers as local to each other.
+         */
+        AZ::u32 m_coreCluster;
+
+        /**
+         *  NUMA node this thread runs on, see \ref CpuTopology.
+         *  Default is CpuTopology::Unknown.
+         */
+        AZ::u32 m_numaNode;
+
+        JobManagerThreadDesc(int cpuId = -1, int priority = -100000, int stackSize = -1, AZ::u32 coreCluster = CpuTopology::Unknown, AZ::u32 numaNode = CpuTopology::Unknown)
             : m_cpuId(cpuId)
             , m_priority(priority)
             , m_stackSize(stackSize)
+            , m_coreCluster(coreCluster)
+            , m_numaNode(numaNode)
         {
         }
     };
@@ -53,5 +69,13 @@ namespace AZ
 
         using DescList = AZStd::fixed_vector<JobManagerThreadDesc, 64>;
         DescList m_workerThreads; ///< List of worker threads to create
+
+        /**
+         * Appends numWorkers worker descriptors placed on the processors of the topology. Workers are spread
+         * round-robin across NUMA nodes, filling the clusters of a node in order, so a partial set of workers is
+         * balanced between sockets. Each worker is pinned to its processor when the processor id fits in
+         * JobManagerThreadDesc::m_cpuId, otherwise only its cluster and node are recorded for work stealing.
+         */
+        void AddWorkersFromTopology(const CpuTopology& topology, AZ::u32 numWorkers, int priority = -100000, int stackSize = -1);
     };
 }
@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/BatchMath.h>
+#include <AzCore/Math/TransformWide.h>
+#include <AzCore/Utils/CpuFeatures.h>
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+#include <immintrin.h>
+#endif
+
+namespace AZ::BatchMath
+{
+    namespace
+    {
+        //! Calls the kernel for every batch of lanes, passing the offset of the batch and the number of elements in it.
+        //! Only the last batch can be partial.
+        template<typename Kernel>
+        void ForEachBatch(size_t count, Kernel&& kernel)
+        {
+            constexpr size_t LaneCount = Vector3Wide::LaneCount;
+            for (size_t offset = 0; offset < count; offset += LaneCount)
+            {
+                const size_t batchCount = AZStd::min(count - offset, LaneCount);
+                kernel(offset, batchCount);
+            }
+        }
+
+        //! Implementations using the wide math types, available on every platform.
+        namespace Wide
+        {
+            void TransformPoints(const Transform& transform, const Vector3* points, Vector3* result, size_t count)
+            {
+                const TransformWide transformWide = TransformWide::CreateSplat(transform);
+                ForEachBatch(count, [&](size_t offset, size_t batchCount)
+                {
+                    transformWide.TransformPoint(Vector3Wide::Load(points + offset, batchCount)).Store(result + offset, batchCount);
+                });
+            }
+
+            void TransformVectors(const Transform& transform, const Vector3* vectors, Vector3* result, size_t count)
+            {
+                const TransformWide transformWide = TransformWide::CreateSplat(transform);
+                ForEachBatch(count, [&](size_t offset, size_t batchCount)
+                {
+                    transformWide.TransformVector(Vector3Wide::Load(vectors + offset, batchCount)).Store(result + offset, batchCount);
+                });
+            }
+
+            void NormalizeVectors(const Vector3* vectors, Vector3* result, size_t count)
+            {
+                ForEachBatch(count, [&](size_t offset, size_t batchCount)
+                {
+                    Vector3Wide::Load(vectors + offset, batchCount).GetNormalized().Store(result + offset, batchCount);
+                });
+            }
+
+            void DotProducts(const Vector3* lhs, const Vector3* rhs, float* result, size_t count)
+            {
+                ForEachBatch(count, [&](size_t offset, size_t batchCount)
+                {
+                    const FloatWide dot = Vector3Wide::Load(lhs + offset, batchCount).Dot(Vector3Wide::Load(rhs + offset, batchCount));
+                    alignas(16) float dots[Vector3Wide::LaneCount];
+                    Simd::Vec4::StoreAligned(dots, dot);
+                    for (size_t lane = 0; lane < batchCount; ++lane)
+                    {
+                        result[offset + lane] = dots[lane];
+                    }
+                });
+            }
+        } // namespace Wide
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+        //! Implementations processing 8 elements at once with AVX2 and FMA, selected at runtime on CPUs that support them.
+        //! The elements that don't fill a whole batch of 8 are handed to the Wide implementations.
+        namespace Avx2
+        {
+            constexpr CpuFeature RequiredFeatures = CpuFeature::Avx2 | CpuFeature::Fma;
+            constexpr size_t LaneCount = 8;
+
+            //! Transposes 8 vectors into a register per component.
+            AZ_CPU_TARGET_AVX2 void LoadVectors(const Vector3* vectors, __m256& x, __m256& y, __m256& z)
+            {
+                const __m256 v04 = _mm256_insertf128_ps(_mm256_castps128_ps256(vectors[0].GetSimdValue()), vectors[4].GetSimdValue(), 1);
+                const __m256 v15 = _mm256_insertf128_ps(_mm256_castps128_ps256(vectors[1].GetSimdValue()), vectors[5].GetSimdValue(), 1);
+                const __m256 v26 = _mm256_insertf128_ps(_mm256_castps128_ps256(vectors[2].GetSimdValue()), vectors[6].GetSimdValue(), 1);
+                const __m256 v37 = _mm256_insertf128_ps(_mm256_castps128_ps256(vectors[3].GetSimdValue()), vectors[7].GetSimdValue(), 1);
+                const __m256 xy01 = _mm256_unpacklo_ps(v04, v15);
+                const __m256 xy23 = _mm256_unpacklo_ps(v26, v37);
+                const __m256 zw01 = _mm256_unpackhi_ps(v04, v15);
+                const __m256 zw23 = _mm256_unpackhi_ps(v26, v37);
+                x = _mm256_shuffle_ps(xy01, xy23, _MM_SHUFFLE(1, 0, 1, 0));
+                y = _mm256_shuffle_ps(xy01, xy23, _MM_SHUFFLE(3, 2, 3, 2));
+                z = _mm256_shuffle_ps(zw01, zw23, _MM_SHUFFLE(1, 0, 1, 0));
+            }
+
+            //! Transposes a register per component back into 8 vectors.
+            AZ_CPU_TARGET_AVX2 void StoreVectors(__m256 x, __m256 y, __m256 z, Vector3* vectors)
+            {
+                const __m256 zero = _mm256_setzero_ps();
+                const __m256 xy01 = _mm256_unpacklo_ps(x, y);
+                const __m256 xy23 = _mm256_unpackhi_ps(x, y);
+                const __m256 zw01 = _mm256_unpacklo_ps(z, zero);
+                const __m256 zw23 = _mm256_unpackhi_ps(z, zero);
+                const __m256 v04 = _mm256_shuffle_ps(xy01, zw01, _MM_SHUFFLE(1, 0, 1, 0));
+                const __m256 v15 = _mm256_shuffle_ps(xy01, zw01, _MM_SHUFFLE(3, 2, 3, 2));
+                const __m256 v26 = _mm256_shuffle_ps(xy23, zw23, _MM_SHUFFLE(1, 0, 1, 0));
+                const __m256 v37 = _mm256_shuffle_ps(xy23, zw23, _MM_SHUFFLE(3, 2, 3, 2));
+                vectors[0] = Vector3(_mm256_castps256_ps128(v04));
+                vectors[1] = Vector3(_mm256_castps256_ps128(v15));
+                vectors[2] = Vector3(_mm256_castps256_ps128(v26));
+                vectors[3] = Vector3(_mm256_castps256_ps128(v37));
+                vectors[4] = Vector3(_mm256_extractf128_ps(v04, 1));
+                vectors[5] = Vector3(_mm256_extractf128_ps(v15, 1));
+                vectors[6] = Vector3(_mm256_extractf128_ps(v26, 1));
+                vectors[7] = Vector3(_mm256_extractf128_ps(v37, 1));
+            }
+
+            //! Rotates and scales the vectors like QuaternionWide::TransformVector, then adds the translation.
+            AZ_CPU_TARGET_AVX2 void TransformBatches(
+                const Transform& transform, const Vector3& translation, const Vector3* vectors, Vector3* result, size_t batchCount)
+            {
+                const Quaternion& rotation = transform.GetRotation();
+                const float scale = transform.GetUniformScale();
+                const __m256 qx = _mm256_set1_ps(rotation.GetX());
+                const __m256 qy = _mm256_set1_ps(rotation.GetY());
+                const __m256 qz = _mm256_set1_ps(rotation.GetZ());
+                // The scale is applied to the vector terms of the rotation, which is the same as scaling the input.
+                const __m256 dotScale = _mm256_set1_ps(2.0f * scale);
+                const __m256 vectorScale = _mm256_set1_ps(scale * (rotation.GetW() * rotation.GetW() - rotation.GetImaginary().GetLengthSq()));
+                const __m256 crossScale = _mm256_set1_ps(2.0f * scale * rotation.GetW());
+                const __m256 tx = _mm256_set1_ps(translation.GetX());
+                const __m256 ty = _mm256_set1_ps(translation.GetY());
+                const __m256 tz = _mm256_set1_ps(translation.GetZ());
+
+                for (size_t batch = 0; batch < batchCount; ++batch)
+                {
+                    __m256 vx, vy, vz;
+                    LoadVectors(vectors + batch * LaneCount, vx, vy, vz);
+                    const __m256 dot = _mm256_mul_ps(_mm256_fmadd_ps(qz, vz, _mm256_fmadd_ps(qy, vy, _mm256_mul_ps(qx, vx))), dotScale);
+                    const __m256 cx = _mm256_fmsub_ps(qy, vz, _mm256_mul_ps(qz, vy));
+                    const __m256 cy = _mm256_fmsub_ps(qz, vx, _mm256_mul_ps(qx, vz));
+                    const __m256 cz = _mm256_fmsub_ps(qx, vy, _mm256_mul_ps(qy, vx));
+                    const __m256 rx = _mm256_fmadd_ps(cx, crossScale, _mm256_fmadd_ps(vx, vectorScale, _mm256_fmadd_ps(qx, dot, tx)));
+                    const __m256 ry = _mm256_fmadd_ps(cy, crossScale, _mm256_fmadd_ps(vy, vectorScale, _mm256_fmadd_ps(qy, dot, ty)));
+                    const __m256 rz = _mm256_fmadd_ps(cz, crossScale, _mm256_fmadd_ps(vz, vectorScale, _mm256_fmadd_ps(qz, dot, tz)));
+                    StoreVectors(rx, ry, rz, result + batch * LaneCount);
+                }
+            }
+
+            AZ_CPU_TARGET_AVX2 void TransformPoints(const Transform& transform, const Vector3* points, Vector3* result, size_t count)
+            {
+                const size_t batchCount = count / LaneCount;
+                TransformBatches(transform, transform.GetTranslation(), points, result, batchCount);
+                const size_t done = batchCount * LaneCount;
+                Wide::TransformPoints(transform, points + done, result + done, count - done);
+            }
+
+            AZ_CPU_TARGET_AVX2 void TransformVectors(const Transform& transform, const Vector3* vectors, Vector3* result, size_t count)
+            {
+                const size_t batchCount = count / LaneCount;
+                TransformBatches(transform, Vector3::CreateZero(), vectors, result, batchCount);
+                const size_t done = batchCount * LaneCount;
+                Wide::TransformVectors(transform, vectors + done, result + done, count - done);
+            }
+
+            AZ_CPU_TARGET_AVX2 void NormalizeVectors(const Vector3* vectors, Vector3* result, size_t count)
+            {
+                const __m256 one = _mm256_set1_ps(1.0f);
+                const __m256 minLengthSq = _mm256_set1_ps(Constants::FloatEpsilon * Constants::FloatEpsilon);
+                const size_t batchCount = count / LaneCount;
+                for (size_t batch = 0; batch < batchCount; ++batch)
+                {
+                    __m256 x, y, z;
+                    LoadVectors(vectors + batch * LaneCount, x, y, z);
+                    const __m256 lengthSq = _mm256_fmadd_ps(z, z, _mm256_fmadd_ps(y, y, _mm256_mul_ps(x, x)));
+                    const __m256 isNonZero = _mm256_cmp_ps(lengthSq, minLengthSq, _CMP_GT_OQ);
+                    const __m256 invLength = _mm256_and_ps(_mm256_div_ps(one, _mm256_sqrt_ps(lengthSq)), isNonZero);
+                    StoreVectors(_mm256_mul_ps(x, invLength), _mm256_mul_ps(y, invLength), _mm256_mul_ps(z, invLength), result + batch * LaneCount);
+                }
+                const size_t done = batchCount * LaneCount;
+                Wide::NormalizeVectors(vectors + done, result + done, count - done);
+            }
+
+            AZ_CPU_TARGET_AVX2 void DotProducts(const Vector3* lhs, const Vector3* rhs, float* result, size_t count)
+            {
+                const size_t batchCount = count / LaneCount;
+                for (size_t batch = 0; batch < batchCount; ++batch)
+                {
+                    __m256 lx, ly, lz, rx, ry, rz;
+                    LoadVectors(lhs + batch * LaneCount, lx, ly, lz);
+                    LoadVectors(rhs + batch * LaneCount, rx, ry, rz);
+                    _mm256_storeu_ps(result + batch * LaneCount, _mm256_fmadd_ps(lz, rz, _mm256_fmadd_ps(ly, ry, _mm256_mul_ps(lx, rx))));
+                }
+                const size_t done = batchCount * LaneCount;
+                Wide::DotProducts(lhs + done, rhs + done, result + done, count - done);
+            }
+        } // namespace Avx2
+
+        //! Picks the AVX2 implementation when the CPU supports it, and the wide one otherwise.
+#define AZ_BATCH_MATH_SELECT(Function) CpuFeatures::Select(Avx2::RequiredFeatures, &Avx2::Function, &Wide::Function)
+#else
+#define AZ_BATCH_MATH_SELECT(Function) &Wide::Function
+#endif
+    } // namespace
+
+    void TransformPoints(const Transform& transform, const Vector3* points, Vector3* result, size_t count)
+    {
+        static const auto s_function = AZ_BATCH_MATH_SELECT(TransformPoints);
+        s_function(transform, points, result, count);
+    }
+
+    void TransformVectors(const Transform& transform, const Vector3* vectors, Vector3* result, size_t count)
+    {
+        static const auto s_function = AZ_BATCH_MATH_SELECT(TransformVectors);
+        s_function(transform, vectors, result, count);
+    }
+
+    void MultiplyTransforms(const Transform* lhs, const Transform* rhs, Transform* result, size_t count)
+    {
+        ForEachBatch(count, [&](size_t offset, size_t batchCount)
+        {
+            const TransformWide lhsWide = TransformWide::Load(lhs + offset, batchCount);
+            const TransformWide rhsWide = TransformWide::Load(rhs + offset, batchCount);
+            (lhsWide * rhsWide).Store(result + offset, batchCount);
+        });
+    }
+
+    void NormalizeVectors(const Vector3* vectors, Vector3* result, size_t count)
+    {
+        static const auto s_function = AZ_BATCH_MATH_SELECT(NormalizeVectors);
+        s_function(vectors, result, count);
+    }
+
+    void DotProducts(const Vector3* lhs, const Vector3* rhs, float* result, size_t count)
+    {
+        static const auto s_function = AZ_BATCH_MATH_SELECT(DotProducts);
+        s_function(lhs, rhs, result, count);
+    }
+
+    void SlerpQuaternions(const Quaternion* from, const Quaternion* to, float t, Quaternion* result, size_t count)
+    {
+        const FloatWide tWide = Simd::Vec4::Splat(t);
+        ForEachBatch(count, [&](size_t offset, size_t batchCount)
+        {
+            const QuaternionWide fromWide = QuaternionWide::Load(from + offset, batchCount);
+            const QuaternionWide toWide = QuaternionWide::Load(to + offset, batchCount);
+            fromWide.Slerp(toWide, tWide).Store(result + offset, batchCount);
+        });
+    }
+} // namespace AZ::BatchMath
+
+#undef AZ_BATCH_MATH_SELECT
@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Math/Vector3.h>
+
+//! Kernels that apply the same math operation to whole arrays, using the wide math types to process several elements at once.
+//! The results match calling the scalar operation on every element, within floating point precision.
+//! The output arrays may be the same as the input arrays, to update the elements in place.
+namespace AZ::BatchMath
+{
+    //! Transforms count points by the same transform, see Transform::TransformPoint.
+    void TransformPoints(const Transform& transform, const Vector3* points, Vector3* result, size_t count);
+
+    //! Rotates and scales count vectors by the same transform, see Transform::TransformVector.
+    void TransformVectors(const Transform& transform, const Vector3* vectors, Vector3* result, size_t count);
+
+    //! Concatenates count pairs of transforms, so that result[i] = lhs[i] * rhs[i].
+    void MultiplyTransforms(const Transform* lhs, const Transform* rhs, Transform* result, size_t count);
+
+    //! Normalizes count vectors, zero length vectors are left at zero.
+    void NormalizeVectors(const Vector3* vectors, Vector3* result, size_t count);
+
+    //! Computes the dot products of count pairs of vectors.
+    void DotProducts(const Vector3* lhs, const Vector3* rhs, float* result, size_t count);
+
+    //! Spherically interpolates count pairs of quaternions by the same amount, see Quaternion::Slerp.
+    void SlerpQuaternions(const Quaternion* from, const Quaternion* to, float t, Quaternion* result, size_t count);
+} // namespace AZ::BatchMath
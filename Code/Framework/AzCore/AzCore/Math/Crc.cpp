@@ -8,11 +8,209 @@
 
 #include <AzCore/Math/Crc.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Utils/CpuFeatures.h>
 
 #include <string.h>
 
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+#include <immintrin.h>
+#elif defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#endif
+
 namespace AZ
 {
+    namespace Internal
+    {
+        namespace
+        {
+            //! Tables for processing 8 bytes per step (slicing-by-8). Table 0 is the regular byte table, each following table
+            //! advances the crc of its byte by one more zero byte, so the 8 lookups of a step are independent of each other.
+            struct Crc32SlicingTables
+            {
+                AZ::u32 m_tables[8][256] = {};
+            };
+
+            constexpr Crc32SlicingTables CreateCrc32SlicingTables()
+            {
+                Crc32SlicingTables result;
+                for (AZ::u32 n = 0; n < 256; ++n)
+                {
+                    result.m_tables[0][n] = crc_table[n];
+                }
+                for (AZ::u32 slice = 1; slice < 8; ++slice)
+                {
+                    for (AZ::u32 n = 0; n < 256; ++n)
+                    {
+                        const AZ::u32 previous = result.m_tables[slice - 1][n];
+                        result.m_tables[slice][n] = (previous >> 8) ^ crc_table[previous & 0xff];
+                    }
+                }
+                return result;
+            }
+
+            constexpr Crc32SlicingTables Crc32Tables = CreateCrc32SlicingTables();
+
+            AZ::u32 Crc32UpdateSliced(AZ::u32 crc, const uint8_t* data, size_t size)
+            {
+                const auto& tables = Crc32Tables.m_tables;
+                for (; size >= 8; data += 8, size -= 8)
+                {
+                    AZ::u32 low;
+                    AZ::u32 high;
+                    memcpy(&low, data, sizeof(low));
+                    memcpy(&high, data + 4, sizeof(high));
+                    low ^= crc;
+                    crc = tables[7][low & 0xff] ^ tables[6][(low >> 8) & 0xff] ^ tables[5][(low >> 16) & 0xff] ^ tables[4][low >> 24] ^
+                        tables[3][high & 0xff] ^ tables[2][(high >> 8) & 0xff] ^ tables[1][(high >> 16) & 0xff] ^ tables[0][high >> 24];
+                }
+                for (; size > 0; ++data, --size)
+                {
+                    crc = ComputeCrc32Octet(crc, *data);
+                }
+                return crc;
+            }
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+            //! Folds a block of 16 bytes into the next one.
+            AZ_CPU_TARGET_PCLMUL __m128i Crc32Fold(__m128i value, __m128i next, __m128i k)
+            {
+                const __m128i low = _mm_clmulepi64_si128(value, k, 0x00);
+                const __m128i high = _mm_clmulepi64_si128(value, k, 0x11);
+                return _mm_xor_si128(_mm_xor_si128(high, next), low);
+            }
+
+            //! Folds the data with carry-less multiplications, following "Fast CRC Computation for Generic Polynomials Using
+            //! PCLMULQDQ Instruction" by Intel. The constants are the bit-reflected ones of the CRC-32 polynomial given in the paper.
+            //! The crc32 instruction of SSE4.2 can't be used, it implements the CRC-32C polynomial, which gives different values.
+            //! Requires at least 64 bytes and a size that is a multiple of 16.
+            AZ_CPU_TARGET_PCLMUL AZ::u32 Crc32UpdateFolded(AZ::u32 crc, const uint8_t* data, size_t size)
+            {
+                alignas(16) static constexpr AZ::u64 k1k2[] = { 0x0154442bd4, 0x01c6e41596 };
+                alignas(16) static constexpr AZ::u64 k3k4[] = { 0x01751997d0, 0x00ccaa009e };
+                alignas(16) static constexpr AZ::u64 k5k0[] = { 0x0163cd6124, 0x0000000000 };
+                alignas(16) static constexpr AZ::u64 poly[] = { 0x01db710641, 0x01f7011641 };
+
+                __m128i x1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x00));
+                __m128i x2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x10));
+                __m128i x3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x20));
+                __m128i x4 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x30));
+                x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(static_cast<int>(crc)));
+                __m128i k = _mm_load_si128(reinterpret_cast<const __m128i*>(k1k2));
+                data += 64;
+                size -= 64;
+
+                // Fold 4 blocks of 16 bytes in parallel.
+                for (; size >= 64; data += 64, size -= 64)
+                {
+                    const __m128i x5 = _mm_clmulepi64_si128(x1, k, 0x00);
+                    const __m128i x6 = _mm_clmulepi64_si128(x2, k, 0x00);
+                    const __m128i x7 = _mm_clmulepi64_si128(x3, k, 0x00);
+                    const __m128i x8 = _mm_clmulepi64_si128(x4, k, 0x00);
+                    x1 = _mm_clmulepi64_si128(x1, k, 0x11);
+                    x2 = _mm_clmulepi64_si128(x2, k, 0x11);
+                    x3 = _mm_clmulepi64_si128(x3, k, 0x11);
+                    x4 = _mm_clmulepi64_si128(x4, k, 0x11);
+                    x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x00)));
+                    x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x10)));
+                    x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x20)));
+                    x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x30)));
+                }
+
+                // Fold the 4 blocks into 1.
+                k = _mm_load_si128(reinterpret_cast<const __m128i*>(k3k4));
+                x1 = Crc32Fold(x1, x2, k);
+                x1 = Crc32Fold(x1, x3, k);
+                x1 = Crc32Fold(x1, x4, k);
+
+                // Fold the remaining blocks of 16 bytes one at a time.
+                for (; size >= 16; data += 16, size -= 16)
+                {
+                    x1 = Crc32Fold(x1, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data)), k);
+                }
+
+                // Fold 128 bits to 64 bits.
+                const __m128i mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+                x2 = _mm_clmulepi64_si128(x1, k, 0x10);
+                x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+                k = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(k5k0));
+                x2 = _mm_srli_si128(x1, 4);
+                x1 = _mm_and_si128(x1, mask32);
+                x1 = _mm_xor_si128(_mm_clmulepi64_si128(x1, k, 0x00), x2);
+
+                // Barrett reduction to 32 bits.
+                k = _mm_load_si128(reinterpret_cast<const __m128i*>(poly));
+                x2 = _mm_and_si128(x1, mask32);
+                x2 = _mm_clmulepi64_si128(x2, k, 0x10);
+                x2 = _mm_and_si128(x2, mask32);
+                x2 = _mm_clmulepi64_si128(x2, k, 0x00);
+                x1 = _mm_xor_si128(x1, x2);
+                return static_cast<AZ::u32>(_mm_extract_epi32(x1, 1));
+            }
+
+            AZ::u32 Crc32UpdateBytes(AZ::u32 crc, const uint8_t* data, size_t size)
+            {
+                static const bool s_canFold = CpuFeatures::IsSupported(CpuFeature::Pclmul | CpuFeature::Sse41);
+                if (s_canFold && size >= 64)
+                {
+                    const size_t foldedSize = size & ~size_t(15);
+                    crc = Crc32UpdateFolded(crc, data, foldedSize);
+                    data += foldedSize;
+                    size -= foldedSize;
+                }
+                return Crc32UpdateSliced(crc, data, size);
+            }
+#elif defined(__ARM_FEATURE_CRC32)
+            //! The CRC32 instructions of ARMv8 implement the same polynomial as the tables.
+            AZ::u32 Crc32UpdateBytes(AZ::u32 crc, const uint8_t* data, size_t size)
+            {
+                for (; size >= 8; data += 8, size -= 8)
+                {
+                    uint64_t value;
+                    memcpy(&value, data, sizeof(value));
+                    crc = __crc32d(crc, value);
+                }
+                for (; size > 0; ++data, --size)
+                {
+                    crc = __crc32b(crc, *data);
+                }
+                return crc;
+            }
+#else
+            AZ::u32 Crc32UpdateBytes(AZ::u32 crc, const uint8_t* data, size_t size)
+            {
+                return Crc32UpdateSliced(crc, data, size);
+            }
+#endif
+        } // namespace
+
+        AZ::u32 Crc32Update(AZ::u32 crc, const void* data, size_t size, bool forceLowerCase)
+        {
+            const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+            if (!forceLowerCase)
+            {
+                return Crc32UpdateBytes(crc, bytes, size);
+            }
+
+            // Lower the case in chunks, so the chunks can go through the same fast path as the raw data.
+            constexpr size_t ChunkSize = 256;
+            uint8_t chunk[ChunkSize];
+            while (size > 0)
+            {
+                const size_t chunkSize = AZStd::min(size, ChunkSize);
+                for (size_t i = 0; i < chunkSize; ++i)
+                {
+                    const uint8_t value = bytes[i];
+                    chunk[i] = (value >= 'A' && value <= 'Z') ? static_cast<uint8_t>(value + 'a' - 'A') : value;
+                }
+                crc = Crc32UpdateBytes(crc, chunk, chunkSize);
+                bytes += chunkSize;
+                size -= chunkSize;
+            }
+            return crc;
+        }
+    } // namespace Internal
+
     //=========================================================================
     //
     // Crc32 constructor
@@ -10,6 +10,7 @@
 #include <AzCore/base.h>
 
 #include <AzCore/std/string/string_view.h>
+#include <AzCore/std/typetraits/is_constant_evaluated.h>
 
 //////////////////////////////////////////////////////////////////////////
 // Macros for pre-processor Crc32 conversion
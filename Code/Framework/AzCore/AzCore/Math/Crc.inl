@@ -115,6 +115,10 @@ namespace AZ
             return crc_table[(static_cast<int>(currentCrc) ^ dataOctet) & 0xff] ^ (currentCrc >> 8);
         }
 
+        //! Runtime version of the byte loop below, which processes several bytes at once and uses the CRC instructions of the
+        //! CPU where available. Takes and returns the running crc before the final inversion.
+        AZ::u32 Crc32Update(AZ::u32 crc, const void* data, size_t size, bool forceLowerCase);
+
         template<typename CharType>
         constexpr void Crc32Set(const CharType* data, size_t size, bool forceLowerCase, AZ::u32& value)
         {
@@ -126,7 +130,11 @@ namespace AZ
             else
             {
                 unsigned int crc = 0xffffffffL;
-                if (size)
+                if (!AZStd::is_constant_evaluated())
+                {
+                    crc = Crc32Update(crc, buf, size, forceLowerCase);
+                }
+                else if (size)
                 {
                     if (forceLowerCase)
                     {
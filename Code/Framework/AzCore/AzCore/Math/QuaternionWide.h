@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Vector3Wide.h>
+
+namespace AZ
+{
+    //! A batch of quaternions stored as a structure of arrays, see Vector3Wide.
+    class QuaternionWide
+    {
+    public:
+        static constexpr size_t LaneCount = Vector3Wide::LaneCount;
+
+        //! Default constructor, components are uninitialized.
+        QuaternionWide() = default;
+
+        QuaternionWide(FloatWideArgType x, FloatWideArgType y, FloatWideArgType z, FloatWideArgType w);
+
+        //! Creates a batch with all lanes set to the same quaternion.
+        static QuaternionWide CreateSplat(const Quaternion& q);
+
+        static QuaternionWide CreateIdentity();
+
+        //! Loads the first count quaternions of the array into the lanes. Unused lanes repeat the last quaternion.
+        static QuaternionWide Load(const Quaternion* quaternions, size_t count = LaneCount);
+
+        //! Stores the first count lanes into the array.
+        void Store(Quaternion* quaternions, size_t count = LaneCount) const;
+
+        Quaternion GetLane(size_t lane) const;
+
+        FloatWide GetX() const;
+        FloatWide GetY() const;
+        FloatWide GetZ() const;
+        FloatWide GetW() const;
+
+        //! Concatenates the rotations of every lane, the same as Quaternion::operator*.
+        QuaternionWide operator*(const QuaternionWide& rhs) const;
+
+        QuaternionWide operator+(const QuaternionWide& rhs) const;
+
+        //! Multiplies every lane by the scalar of the same lane.
+        QuaternionWide operator*(FloatWideArgType multiplier) const;
+
+        QuaternionWide GetConjugate() const;
+
+        FloatWide Dot(const QuaternionWide& rhs) const;
+        FloatWide GetLengthSq() const;
+
+        QuaternionWide GetNormalized() const;
+
+        //! Rotates the vector of every lane by the quaternion of the same lane.
+        Vector3Wide TransformVector(const Vector3Wide& v) const;
+
+        //! Normalized linear interpolation along the shortest path, cheaper than Slerp and accurate enough for nearby rotations.
+        QuaternionWide Nlerp(const QuaternionWide& dest, FloatWideArgType t) const;
+
+        //! Spherical linear interpolation along the shortest path, the same as Quaternion::Slerp.
+        QuaternionWide Slerp(const QuaternionWide& dest, FloatWideArgType t) const;
+
+    private:
+        FloatWide m_x;
+        FloatWide m_y;
+        FloatWide m_z;
+        FloatWide m_w;
+    };
+} // namespace AZ
+
+#include <AzCore/Math/QuaternionWide.inl>
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+namespace AZ
+{
+    AZ_MATH_INLINE QuaternionWide::QuaternionWide(FloatWideArgType x, FloatWideArgType y, FloatWideArgType z, FloatWideArgType w)
+        : m_x(x)
+        , m_y(y)
+        , m_z(z)
+        , m_w(w)
+    {
+        ;
+    }
+
+
+    AZ_MATH_INLINE QuaternionWide QuaternionWide::CreateSplat(const Quaternion& q)
+    {
+        return QuaternionWide(Simd::Vec4::Splat(q.GetX()), Simd::Vec4::Splat(q.GetY()), Simd::Vec4::Splat(q.GetZ()), Simd::Vec4::Splat(q.GetW()));
+    }
+
+
+    AZ_MATH_INLINE QuaternionWide QuaternionWide::CreateIdentity()
+    {
+        const FloatWide zero = Simd::Vec4::ZeroFloat();
+        return QuaternionWide(zero, zero, zero, Simd::Vec4::Splat(1.0f));
+    }
+
+
+    AZ_MATH_INLINE QuaternionWide QuaternionWide::Load(const Quaternion* quaternions, size_t count)
+    {
+        AZ_MATH_ASSERT(count > 0 && count <= LaneCount, "Invalid number of quaternions to load into a wide quaternion");
+        alignas(16) float x[LaneCount];
+        alignas(16) float y[LaneCount];
+        alignas(16) float z[LaneCount];
+        alignas(16) float w[LaneCount];
+        for (size_t lane = 0; lane < LaneCount; ++lane)
+        {
+            const Quaternion& q = quaternions[lane < count ? lane : count - 1];
+            x[lane] = q.GetX();
+            y[lane] = q.GetY();
+            z[lane] = q.GetZ();
+            w[lane] = q.GetW();
+        }
+        return QuaternionWide(Simd::Vec4::LoadAligned(x), Simd::Vec4::LoadAligned(y), Simd::Vec4::LoadAligned(z), Simd::Vec4::LoadAligned(w));
+    }
+
+
+    AZ_MATH_INLINE void QuaternionWide::Store(Quaternion* quaternions, size_t count) const
+    {
+        AZ_MATH_ASSERT(count <= LaneCount, "Invalid number of quaternions to store from a wide quaternion");
+        alignas(16) float x[LaneCount];
+        alignas(16) float y[LaneCount];
+        alignas(16) float z[LaneCount];
+        alignas(16) float w[LaneCount];
+        Simd::Vec4::StoreAligned(x, m_x);
+        Simd::Vec4::StoreAligned(y, m_y);
+        Simd::Vec4::StoreAligned(z, m_z);
+        Simd::Vec4::StoreAligned(w, m_w);
+        for (size_t lane = 0; lane < count; ++lane)
+        {
+            quaternions[lane].Set(x[lane], y[lane], z[lane], w[lane]);
+        }
+    }
+
+
+    AZ_MATH_INLINE Quaternion QuaternionWide::GetLane(size_t lane) const
+    {
+        AZ_MATH_ASSERT(lane < LaneCount, "Invalid lane");
+        Quaternion result[LaneCount];
+        Store(result);
+        return result[lane];
+    }
+
+
+    AZ_MATH_INLINE FloatWide QuaternionWide::GetX() const
+    {
+        return m_x;
+    }
+
+
+    AZ_MATH_INLINE FloatWide QuaternionWide::GetY() const
+    {
+        return m_y;
+    }
+
+
+    AZ_MATH_INLINE FloatWide QuaternionWide::GetZ() const
+    {
+        return m_z;
+    }
+
+
+    AZ_MATH_INLINE FloatWide QuaternionWide::GetW() const
+    {
+        return m_w;
+    }
+
+
+    AZ_MATH_INLINE QuaternionWide QuaternionWide::operator*(const QuaternionWide& rhs) const
+    {
+        // x = w1 * x2 + x1 * w2 + y1 * z2 - z1 * y2
+        // y = w1 * y2 - x1 * z2 + y1 * w2 + z1 * x2
+        // z = w1 * z2 + x1 * y2 - y1 * x2 + z1 * w2
+        // w = w1 * w2 - x1 * x2 - y1 * y2 - z1 * z2
+        const FloatWide x = Simd::Vec4::Sub(
+            Simd::Vec4::Madd(m_y, rhs.m_z, Simd::Vec4::Madd(m_x, rhs.m_w, Simd::Vec4::Mul(m_w, rhs.m_x))), Simd::Vec4::Mul(m_z, rhs.m_y));
+        const FloatWide y = Simd::Vec4::Sub(
+            Simd::Vec4::Madd(m_z, rhs.m_x, Simd::Vec4::Madd(m_y, rhs.m_w, Simd::Vec4::Mul(m_w, rhs.m_y))), Simd::Vec4::Mul(m_x, rhs.m_z));
+        const FloatWide z = Simd::Vec4::Sub(
+            Simd::Vec4::Madd(m_z, rhs.m_w, Simd::Vec4::Madd(m_x, rhs.m_y, Simd::Vec4::Mul(m_w, rhs.m_z))), Simd::Vec4::Mul(m_y, rhs.m_x));
+        const FloatWide w = Simd::Vec4::Sub(
+            Simd::Vec4::Mul(m_w, rhs.m_w), Simd::Vec4::Madd(m_z, rhs.m_z, Simd::Vec4::Madd(m_y, rhs.m_y, Simd::Vec4::Mul(m_x, rhs.m_x))));
+        return QuaternionWide(x, y, z, w);
+    }
+
+
+    AZ_MATH_INLINE QuaternionWide QuaternionWide::operator+(const QuaternionWide& rhs) const
+    {
+        return QuaternionWide(
+            Simd::Vec4::Add(m_x, rhs.m_x), Simd::Vec4::Add(m_y, rhs.m_y), Simd::Vec4::Add(m_z, rhs.m_z), Simd::Vec4::Add(m_w, rhs.m_w));
+    }
+
+
+    AZ_MATH_INLINE QuaternionWide QuaternionWide::operator*(FloatWideArgType multiplier) const
+    {
+        return QuaternionWide(
+            Simd::Vec4::Mul(m_x, multiplier), Simd::Vec4::Mul(m_y, multiplier), Simd::Vec4::Mul(m_z, multiplier),
+            Simd::Vec4::Mul(m_w, multiplier));
+    }
+
+
+    AZ_MATH_INLINE QuaternionWide QuaternionWide::GetConjugate() const
+    {
+        const FloatWide zero = Simd::Vec4::ZeroFloat();
+        return QuaternionWide(Simd::Vec4::Sub(zero, m_x), Simd::Vec4::Sub(zero, m_y), Simd::Vec4::Sub(zero, m_z), m_w);
+    }
+
+
+    AZ_MATH_INLINE FloatWide QuaternionWide::Dot(const QuaternionWide& rhs) const
+    {
+        return Simd::Vec4::Madd(m_w, rhs.m_w, Simd::Vec4::Madd(m_z, rhs.m_z, Simd::Vec4::Madd(m_y, rhs.m_y, Simd::Vec4::Mul(m_x, rhs.m_x))));
+    }
+
+
+    AZ_MATH_INLINE FloatWide QuaternionWide::GetLengthSq() const
+    {
+        return Dot(*this);
+    }
+
+
+    AZ_MATH_INLINE QuaternionWide QuaternionWide::GetNormalized() const
+    {
+        const FloatWide lengthSq = GetLengthSq();
+        const FloatWide isNonZero = Simd::Vec4::CmpGt(lengthSq, Simd::Vec4::Splat(Constants::FloatEpsilon * Constants::FloatEpsilon));
+        const FloatWide invLength = Simd::Vec4::Select(Simd::Vec4::SqrtInv(lengthSq), Simd::Vec4::ZeroFloat(), isNonZero);
+        return (*this) * invLength;
+    }
+
+
+    AZ_MATH_INLINE Vector3Wide QuaternionWide::TransformVector(const Vector3Wide& v) const
+    {
+        // v' = 2 * dot(q, v) * q + (w * w - dot(q, q)) * v + 2 * w * cross(q, v), with q the imaginary part.
+        const Vector3Wide imaginary(m_x, m_y, m_z);
+        const FloatWide two = Simd::Vec4::Splat(2.0f);
+        const FloatWide dotTwice = Simd::Vec4::Mul(imaginary.Dot(v), two);
+        const FloatWide scale = Simd::Vec4::Sub(Simd::Vec4::Mul(m_w, m_w), imaginary.GetLengthSq());
+        const FloatWide wTwice = Simd::Vec4::Mul(m_w, two);
+        return imaginary * dotTwice + v * scale + imaginary.Cross(v) * wTwice;
+    }
+
+
+    AZ_MATH_INLINE QuaternionWide QuaternionWide::Nlerp(const QuaternionWide& dest, FloatWideArgType t) const
+    {
+        // Flip the destination of the lanes that are more than 90 degrees apart, to take the shortest path.
+        const FloatWide signMask = Simd::Vec4::And(Dot(dest), Simd::Vec4::Splat(-0.0f));
+        const FloatWide destT = Simd::Vec4::Xor(t, signMask);
+        const FloatWide thisT = Simd::Vec4::Sub(Simd::Vec4::Splat(1.0f), t);
+        return ((*this) * thisT + dest * destT).GetNormalized();
+    }
+
+
+    AZ_MATH_INLINE QuaternionWide QuaternionWide::Slerp(const QuaternionWide& dest, FloatWideArgType t) const
+    {
+        const FloatWide one = Simd::Vec4::Splat(1.0f);
+        const FloatWide destDot = Dot(dest);
+        const FloatWide signMask = Simd::Vec4::And(destDot, Simd::Vec4::Splat(-0.0f));
+        const FloatWide cosom = Simd::Vec4::Abs(destDot);
+
+        // Lanes that are very close fall back to a linear interpolation, where the sine of the angle gets too small to divide by.
+        const FloatWide isFar = Simd::Vec4::CmpLt(cosom, Simd::Vec4::Splat(0.9999f));
+        const FloatWide omega = Simd::Vec4::Acos(Simd::Vec4::Min(cosom, one));
+        const FloatWide invSinom = Simd::Vec4::Reciprocal(Simd::Vec4::Select(Simd::Vec4::Sin(omega), one, isFar));
+        const FloatWide oneMinusT = Simd::Vec4::Sub(one, t);
+        const FloatWide slerpA = Simd::Vec4::Mul(Simd::Vec4::Sin(Simd::Vec4::Mul(oneMinusT, omega)), invSinom);
+        const FloatWide slerpB = Simd::Vec4::Mul(Simd::Vec4::Sin(Simd::Vec4::Mul(t, omega)), invSinom);
+        const FloatWide sclA = Simd::Vec4::Xor(Simd::Vec4::Select(slerpA, oneMinusT, isFar), signMask);
+        const FloatWide sclB = Simd::Vec4::Select(slerpB, t, isFar);
+        return (*this) * sclA + dest * sclB;
+    }
+} // namespace AZ
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/QuaternionWide.h>
+#include <AzCore/Math/Transform.h>
+
+namespace AZ
+{
+    //! A batch of transforms stored as a structure of arrays, see Vector3Wide.
+    //! Like Transform, every lane holds a rotation, a uniform scale and a translation.
+    class TransformWide
+    {
+    public:
+        static constexpr size_t LaneCount = Vector3Wide::LaneCount;
+
+        //! Default constructor, components are uninitialized.
+        TransformWide() = default;
+
+        TransformWide(const Vector3Wide& translation, const QuaternionWide& rotation, FloatWideArgType scale);
+
+        //! Creates a batch with all lanes set to the same transform.
+        static TransformWide CreateSplat(const Transform& transform);
+
+        static TransformWide CreateIdentity();
+
+        //! Loads the first count transforms of the array into the lanes. Unused lanes repeat the last transform.
+        static TransformWide Load(const Transform* transforms, size_t count = LaneCount);
+
+        //! Stores the first count lanes into the array.
+        void Store(Transform* transforms, size_t count = LaneCount) const;
+
+        Transform GetLane(size_t lane) const;
+
+        const Vector3Wide& GetTranslation() const;
+        const QuaternionWide& GetRotation() const;
+        FloatWide GetUniformScale() const;
+
+        //! Concatenates the transforms of every lane, the same as Transform::operator*.
+        TransformWide operator*(const TransformWide& rhs) const;
+
+        Vector3Wide TransformPoint(const Vector3Wide& rhs) const;
+        Vector3Wide TransformVector(const Vector3Wide& rhs) const;
+
+    private:
+        QuaternionWide m_rotation;
+        FloatWide m_scale;
+        Vector3Wide m_translation;
+    };
+} // namespace AZ
+
+#include <AzCore/Math/TransformWide.inl>
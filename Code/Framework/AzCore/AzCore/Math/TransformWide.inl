@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+namespace AZ
+{
+    AZ_MATH_INLINE TransformWide::TransformWide(const Vector3Wide& translation, const QuaternionWide& rotation, FloatWideArgType scale)
+        : m_rotation(rotation)
+        , m_scale(scale)
+        , m_translation(translation)
+    {
+        ;
+    }
+
+
+    AZ_MATH_INLINE TransformWide TransformWide::CreateSplat(const Transform& transform)
+    {
+        return TransformWide(
+            Vector3Wide::CreateSplat(transform.GetTranslation()), QuaternionWide::CreateSplat(transform.GetRotation()),
+            Simd::Vec4::Splat(transform.GetUniformScale()));
+    }
+
+
+    AZ_MATH_INLINE TransformWide TransformWide::CreateIdentity()
+    {
+        return TransformWide(Vector3Wide::CreateZero(), QuaternionWide::CreateIdentity(), Simd::Vec4::Splat(1.0f));
+    }
+
+
+    AZ_MATH_INLINE TransformWide TransformWide::Load(const Transform* transforms, size_t count)
+    {
+        AZ_MATH_ASSERT(count > 0 && count <= LaneCount, "Invalid number of transforms to load into a wide transform");
+        Vector3 translations[LaneCount];
+        Quaternion rotations[LaneCount];
+        alignas(16) float scales[LaneCount];
+        for (size_t lane = 0; lane < LaneCount; ++lane)
+        {
+            const Transform& transform = transforms[lane < count ? lane : count - 1];
+            translations[lane] = transform.GetTranslation();
+            rotations[lane] = transform.GetRotation();
+            scales[lane] = transform.GetUniformScale();
+        }
+        return TransformWide(Vector3Wide::Load(translations), QuaternionWide::Load(rotations), Simd::Vec4::LoadAligned(scales));
+    }
+
+
+    AZ_MATH_INLINE void TransformWide::Store(Transform* transforms, size_t count) const
+    {
+        AZ_MATH_ASSERT(count <= LaneCount, "Invalid number of transforms to store from a wide transform");
+        Vector3 translations[LaneCount];
+        Quaternion rotations[LaneCount];
+        alignas(16) float scales[LaneCount];
+        m_translation.Store(translations);
+        m_rotation.Store(rotations);
+        Simd::Vec4::StoreAligned(scales, m_scale);
+        for (size_t lane = 0; lane < count; ++lane)
+        {
+            transforms[lane] = Transform(translations[lane], rotations[lane], scales[lane]);
+        }
+    }
+
+
+    AZ_MATH_INLINE Transform TransformWide::GetLane(size_t lane) const
+    {
+        AZ_MATH_ASSERT(lane < LaneCount, "Invalid lane");
+        Transform result[LaneCount];
+        Store(result);
+        return result[lane];
+    }
+
+
+    AZ_MATH_INLINE const Vector3Wide& TransformWide::GetTranslation() const
+    {
+        return m_translation;
+    }
+
+
+    AZ_MATH_INLINE const QuaternionWide& TransformWide::GetRotation() const
+    {
+        return m_rotation;
+    }
+
+
+    AZ_MATH_INLINE FloatWide TransformWide::GetUniformScale() const
+    {
+        return m_scale;
+    }
+
+
+    AZ_MATH_INLINE TransformWide TransformWide::operator*(const TransformWide& rhs) const
+    {
+        return TransformWide(TransformPoint(rhs.m_translation), m_rotation * rhs.m_rotation, Simd::Vec4::Mul(m_scale, rhs.m_scale));
+    }
+
+
+    AZ_MATH_INLINE Vector3Wide TransformWide::TransformPoint(const Vector3Wide& rhs) const
+    {
+        return TransformVector(rhs) + m_translation;
+    }
+
+
+    AZ_MATH_INLINE Vector3Wide TransformWide::TransformVector(const Vector3Wide& rhs) const
+    {
+        return m_rotation.TransformVector(rhs * m_scale);
+    }
+} // namespace AZ
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Vector3.h>
+
+namespace AZ
+{
+    //! A float per lane of the wide math types.
+    using FloatWide = Simd::Vec4::FloatType;
+    using FloatWideArgType = Simd::Vec4::FloatArgType;
+
+    //! A batch of 3-dimensional vectors stored as a structure of arrays, with a register per component.
+    //! All operations work on every lane at once, which makes processing many vectors several times faster than going through
+    //! them one by one with Vector3. The lane count matches the widest SIMD register the math library uses on the platform.
+    class Vector3Wide
+    {
+    public:
+        static constexpr size_t LaneCount = Simd::Vec4::ElementCount;
+
+        //! Default constructor, components are uninitialized.
+        Vector3Wide() = default;
+
+        Vector3Wide(FloatWideArgType x, FloatWideArgType y, FloatWideArgType z);
+
+        //! Creates a batch with all lanes set to the same vector.
+        static Vector3Wide CreateSplat(const Vector3& v);
+
+        static Vector3Wide CreateZero();
+
+        //! Loads the first count vectors of the array into the lanes. Unused lanes repeat the last vector, so they stay finite.
+        static Vector3Wide Load(const Vector3* vectors, size_t count = LaneCount);
+
+        //! Loads LaneCount values per component from separate float arrays.
+        static Vector3Wide LoadSoa(const float* x, const float* y, const float* z);
+
+        //! Stores the first count lanes into the array.
+        void Store(Vector3* vectors, size_t count = LaneCount) const;
+
+        //! Stores LaneCount values per component into separate float arrays.
+        void StoreSoa(float* x, float* y, float* z) const;
+
+        Vector3 GetLane(size_t lane) const;
+
+        FloatWide GetX() const;
+        FloatWide GetY() const;
+        FloatWide GetZ() const;
+
+        Vector3Wide operator+(const Vector3Wide& rhs) const;
+        Vector3Wide operator-(const Vector3Wide& rhs) const;
+        Vector3Wide operator-() const;
+
+        //! Component-wise multiplication.
+        Vector3Wide operator*(const Vector3Wide& rhs) const;
+
+        //! Multiplies every lane by the scalar of the same lane.
+        Vector3Wide operator*(FloatWideArgType multiplier) const;
+
+        FloatWide Dot(const Vector3Wide& rhs) const;
+        Vector3Wide Cross(const Vector3Wide& rhs) const;
+
+        FloatWide GetLengthSq() const;
+        FloatWide GetLength() const;
+
+        //! Returns the normalized vectors, zero length vectors are left at zero.
+        Vector3Wide GetNormalized() const;
+
+        //! Returns the normalized vectors with roughly half precision on supported platforms. Zero length vectors are undefined.
+        Vector3Wide GetNormalizedEstimate() const;
+
+        //! Linear interpolation between this and dest, per lane.
+        Vector3Wide Lerp(const Vector3Wide& dest, FloatWideArgType t) const;
+
+    private:
+        FloatWide m_x;
+        FloatWide m_y;
+        FloatWide m_z;
+    };
+} // namespace AZ
+
+#include <AzCore/Math/Vector3Wide.inl>
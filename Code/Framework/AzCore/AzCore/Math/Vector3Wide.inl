@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+namespace AZ
+{
+    AZ_MATH_INLINE Vector3Wide::Vector3Wide(FloatWideArgType x, FloatWideArgType y, FloatWideArgType z)
+        : m_x(x)
+        , m_y(y)
+        , m_z(z)
+    {
+        ;
+    }
+
+
+    AZ_MATH_INLINE Vector3Wide Vector3Wide::CreateSplat(const Vector3& v)
+    {
+        return Vector3Wide(Simd::Vec4::Splat(v.GetX()), Simd::Vec4::Splat(v.GetY()), Simd::Vec4::Splat(v.GetZ()));
+    }
+
+
+    AZ_MATH_INLINE Vector3Wide Vector3Wide::CreateZero()
+    {
+        const FloatWide zero = Simd::Vec4::ZeroFloat();
+        return Vector3Wide(zero, zero, zero);
+    }
+
+
+    AZ_MATH_INLINE Vector3Wide Vector3Wide::Load(const Vector3* vectors, size_t count)
+    {
+        AZ_MATH_ASSERT(count > 0 && count <= LaneCount, "Invalid number of vectors to load into a wide vector");
+        alignas(16) float x[LaneCount];
+        alignas(16) float y[LaneCount];
+        alignas(16) float z[LaneCount];
+        for (size_t lane = 0; lane < LaneCount; ++lane)
+        {
+            const Vector3& v = vectors[lane < count ? lane : count - 1];
+            x[lane] = v.GetX();
+            y[lane] = v.GetY();
+            z[lane] = v.GetZ();
+        }
+        return Vector3Wide(Simd::Vec4::LoadAligned(x), Simd::Vec4::LoadAligned(y), Simd::Vec4::LoadAligned(z));
+    }
+
+
+    AZ_MATH_INLINE Vector3Wide Vector3Wide::LoadSoa(const float* x, const float* y, const float* z)
+    {
+        return Vector3Wide(Simd::Vec4::LoadUnaligned(x), Simd::Vec4::LoadUnaligned(y), Simd::Vec4::LoadUnaligned(z));
+    }
+
+
+    AZ_MATH_INLINE void Vector3Wide::Store(Vector3* vectors, size_t count) const
+    {
+        AZ_MATH_ASSERT(count <= LaneCount, "Invalid number of vectors to store from a wide vector");
+        alignas(16) float x[LaneCount];
+        alignas(16) float y[LaneCount];
+        alignas(16) float z[LaneCount];
+        Simd::Vec4::StoreAligned(x, m_x);
+        Simd::Vec4::StoreAligned(y, m_y);
+        Simd::Vec4::StoreAligned(z, m_z);
+        for (size_t lane = 0; lane < count; ++lane)
+        {
+            vectors[lane].Set(x[lane], y[lane], z[lane]);
+        }
+    }
+
+
+    AZ_MATH_INLINE void Vector3Wide::StoreSoa(float* x, float* y, float* z) const
+    {
+        Simd::Vec4::StoreUnaligned(x, m_x);
+        Simd::Vec4::StoreUnaligned(y, m_y);
+        Simd::Vec4::StoreUnaligned(z, m_z);
+    }
+
+
+    AZ_MATH_INLINE Vector3 Vector3Wide::GetLane(size_t lane) const
+    {
+        AZ_MATH_ASSERT(lane < LaneCount, "Invalid lane");
+        Vector3 result[LaneCount];
+        Store(result);
+        return result[lane];
+    }
+
+
+    AZ_MATH_INLINE FloatWide Vector3Wide::GetX() const
+    {
+        return m_x;
+    }
+
+
+    AZ_MATH_INLINE FloatWide Vector3Wide::GetY() const
+    {
+        return m_y;
+    }
+
+
+    AZ_MATH_INLINE FloatWide Vector3Wide::GetZ() const
+    {
+        return m_z;
+    }
+
+
+    AZ_MATH_INLINE Vector3Wide Vector3Wide::operator+(const Vector3Wide& rhs) const
+    {
+        return Vector3Wide(Simd::Vec4::Add(m_x, rhs.m_x), Simd::Vec4::Add(m_y, rhs.m_y), Simd::Vec4::Add(m_z, rhs.m_z));
+    }
+
+
+    AZ_MATH_INLINE Vector3Wide Vector3Wide::operator-(const Vector3Wide& rhs) const
+    {
+        return Vector3Wide(Simd::Vec4::Sub(m_x, rhs.m_x), Simd::Vec4::Sub(m_y, rhs.m_y), Simd::Vec4::Sub(m_z, rhs.m_z));
+    }
+
+
+    AZ_MATH_INLINE Vector3Wide Vector3Wide::operator-() const
+    {
+        const FloatWide zero = Simd::Vec4::ZeroFloat();
+        return Vector3Wide(Simd::Vec4::Sub(zero, m_x), Simd::Vec4::Sub(zero, m_y), Simd::Vec4::Sub(zero, m_z));
+    }
+
+
+    AZ_MATH_INLINE Vector3Wide Vector3Wide::operator*(const Vector3Wide& rhs) const
+    {
+        return Vector3Wide(Simd::Vec4::Mul(m_x, rhs.m_x), Simd::Vec4::Mul(m_y, rhs.m_y), Simd::Vec4::Mul(m_z, rhs.m_z));
+    }
+
+
+    AZ_MATH_INLINE Vector3Wide Vector3Wide::operator*(FloatWideArgType multiplier) const
+    {
+        return Vector3Wide(Simd::Vec4::Mul(m_x, multiplier), Simd::Vec4::Mul(m_y, multiplier), Simd::Vec4::Mul(m_z, multiplier));
+    }
+
+
+    AZ_MATH_INLINE FloatWide Vector3Wide::Dot(const Vector3Wide& rhs) const
+    {
+        return Simd::Vec4::Madd(m_z, rhs.m_z, Simd::Vec4::Madd(m_y, rhs.m_y, Simd::Vec4::Mul(m_x, rhs.m_x)));
+    }
+
+
+    AZ_MATH_INLINE Vector3Wide Vector3Wide::Cross(const Vector3Wide& rhs) const
+    {
+        return Vector3Wide(
+            Simd::Vec4::Sub(Simd::Vec4::Mul(m_y, rhs.m_z), Simd::Vec4::Mul(m_z, rhs.m_y)),
+            Simd::Vec4::Sub(Simd::Vec4::Mul(m_z, rhs.m_x), Simd::Vec4::Mul(m_x, rhs.m_z)),
+            Simd::Vec4::Sub(Simd::Vec4::Mul(m_x, rhs.m_y), Simd::Vec4::Mul(m_y, rhs.m_x)));
+    }
+
+
+    AZ_MATH_INLINE FloatWide Vector3Wide::GetLengthSq() const
+    {
+        return Dot(*this);
+    }
+
+
+    AZ_MATH_INLINE FloatWide Vector3Wide::GetLength() const
+    {
+        return Simd::Vec4::Sqrt(GetLengthSq());
+    }
+
+
+    AZ_MATH_INLINE Vector3Wide Vector3Wide::GetNormalized() const
+    {
+        const FloatWide lengthSq = GetLengthSq();
+        const FloatWide isNonZero = Simd::Vec4::CmpGt(lengthSq, Simd::Vec4::Splat(Constants::FloatEpsilon * Constants::FloatEpsilon));
+        const FloatWide invLength = Simd::Vec4::Select(Simd::Vec4::SqrtInv(lengthSq), Simd::Vec4::ZeroFloat(), isNonZero);
+        return (*this) * invLength;
+    }
+
+
+    AZ_MATH_INLINE Vector3Wide Vector3Wide::GetNormalizedEstimate() const
+    {
+        return (*this) * Simd::Vec4::SqrtInvEstimate(GetLengthSq());
+    }
+
+
+    AZ_MATH_INLINE Vector3Wide Vector3Wide::Lerp(const Vector3Wide& dest, FloatWideArgType t) const
+    {
+        return Vector3Wide(
+            Simd::Vec4::Madd(Simd::Vec4::Sub(dest.m_x, m_x), t, m_x),
+            Simd::Vec4::Madd(Simd::Vec4::Sub(dest.m_y, m_y), t, m_y),
+            Simd::Vec4::Madd(Simd::Vec4::Sub(dest.m_z, m_z), t, m_z));
+    }
+} // namespace AZ
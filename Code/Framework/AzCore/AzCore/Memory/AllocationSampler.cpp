@@ -0,0 +1,373 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/AllocationSampler.h>
+#include <AzCore/Memory/IAllocator.h>
+#include <AzCore/Debug/Trace.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/sort.h>
+
+#include <math.h>
+
+namespace AZ::Debug
+{
+    namespace AllocationSamplerInternal
+    {
+        struct ThreadState
+        {
+            AZ::s64 m_bytesUntilSample;
+            AZ::u64 m_random;
+            size_t m_samplingInterval;  ///< Interval the countdown was started with, restarts the countdown when it changes.
+            bool m_isSampling;          ///< Guards against sampling allocations made while taking a sample.
+        };
+
+        // Every module has its own copy since AzCore is linked statically, which only affects where the countdowns start.
+        static AZ_THREAD_LOCAL ThreadState s_threadState = { 0, 0, 0, false };
+        static AZStd::atomic<AZ::u64> s_nextSeed{ 0x9E3779B97F4A7C15ull };
+
+        static AZ::u64 NextRandom(ThreadState& state)
+        {
+            // xorshift64*
+            AZ::u64 x = state.m_random;
+            x ^= x >> 12;
+            x ^= x << 25;
+            x ^= x >> 27;
+            state.m_random = x;
+            return x * 0x2545F4914F6CDD1Dull;
+        }
+
+        /// Picks the number of bytes until the next sample from an exponential distribution with the sampling interval as mean.
+        static AZ::s64 NextSampleDistance(ThreadState& state, size_t samplingInterval)
+        {
+            // Uses the top 53 bits for a uniform value in (0, 1].
+            const double uniform = (static_cast<double>(NextRandom(state) >> 11) + 1.0) * (1.0 / 9007199254740992.0);
+            const double distance = -log(uniform) * static_cast<double>(samplingInterval);
+            // Limit the distance so a single unlucky draw can't disable sampling for a thread.
+            const double maxDistance = static_cast<double>(samplingInterval) * 64.0;
+            return static_cast<AZ::s64>(distance < maxDistance ? distance : maxDistance) + 1;
+        }
+
+        static bool IsSameStack(const AllocationSample& lhs, const AllocationSample& rhs)
+        {
+            if (lhs.m_numStackLevels != rhs.m_numStackLevels)
+            {
+                return false;
+            }
+            for (unsigned char i = 0; i < lhs.m_numStackLevels; ++i)
+            {
+                if (lhs.m_stackFrames[i].m_programCounter != rhs.m_stackFrames[i].m_programCounter)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        static bool IsStackLess(const AllocationSample& lhs, const AllocationSample& rhs)
+        {
+            if (lhs.m_numStackLevels != rhs.m_numStackLevels)
+            {
+                return lhs.m_numStackLevels < rhs.m_numStackLevels;
+            }
+            for (unsigned char i = 0; i < lhs.m_numStackLevels; ++i)
+            {
+                if (lhs.m_stackFrames[i].m_programCounter != rhs.m_stackFrames[i].m_programCounter)
+                {
+                    return lhs.m_stackFrames[i].m_programCounter < rhs.m_stackFrames[i].m_programCounter;
+                }
+            }
+            return false;
+        }
+
+        struct StackSummary
+        {
+            AllocationSample m_sample;  ///< First sample with the stack, m_estimatedBytes holds the total of all samples.
+            size_t m_numSamples;
+        };
+    } // namespace AllocationSamplerInternal
+
+    AllocationSampler::AllocationSampler(IAllocatorAllocate* allocator, unsigned int maxNumSamples)
+        : m_allocator(allocator)
+    {
+        AZ_Assert(m_allocator, "AllocationSampler requires an allocator for the sample table!");
+        size_t numSlots = MaxProbes;
+        while (numSlots < maxNumSamples)
+        {
+            numSlots <<= 1;
+        }
+        m_slotMask = numSlots - 1;
+        m_slots = reinterpret_cast<Slot*>(m_allocator->Allocate(sizeof(Slot) * numSlots, alignof(Slot), 0, "AllocationSampler", __FILE__, __LINE__));
+        for (size_t i = 0; i < numSlots; ++i)
+        {
+            new(&m_slots[i]) Slot();
+        }
+    }
+
+    AllocationSampler::~AllocationSampler()
+    {
+        for (size_t i = 0; i <= m_slotMask; ++i)
+        {
+            m_slots[i].~Slot();
+        }
+        m_allocator->DeAllocate(m_slots, sizeof(Slot) * (m_slotMask + 1), alignof(Slot));
+    }
+
+    void AllocationSampler::SetSamplingInterval(size_t samplingInterval)
+    {
+        m_samplingInterval.store(samplingInterval, AZStd::memory_order_relaxed);
+    }
+
+    size_t AllocationSampler::GetSamplingInterval() const
+    {
+        return m_samplingInterval.load(AZStd::memory_order_relaxed);
+    }
+
+    void AllocationSampler::RegisterAllocation(IAllocator* allocator, void* address, size_t byteSize, unsigned int stackSuppressCount)
+    {
+        using namespace AllocationSamplerInternal;
+
+        const size_t samplingInterval = m_samplingInterval.load(AZStd::memory_order_relaxed);
+        if (samplingInterval == 0 || address == nullptr)
+        {
+            return;
+        }
+
+        ThreadState& state = s_threadState;
+        if (state.m_samplingInterval != samplingInterval)
+        {
+            if (state.m_random == 0)
+            {
+                state.m_random = s_nextSeed.fetch_add(0x9E3779B97F4A7C15ull, AZStd::memory_order_relaxed) | 1;
+            }
+            state.m_samplingInterval = samplingInterval;
+            state.m_bytesUntilSample = NextSampleDistance(state, samplingInterval);
+        }
+
+        // This is the only work done for allocations that aren't sampled.
+        state.m_bytesUntilSample -= static_cast<AZ::s64>(byteSize);
+        if (state.m_bytesUntilSample > 0 || state.m_isSampling)
+        {
+            return;
+        }
+
+        state.m_isSampling = true;
+        do
+        {
+            state.m_bytesUntilSample += NextSampleDistance(state, samplingInterval);
+        } while (state.m_bytesUntilSample <= 0);
+        AddSample(allocator, address, byteSize, samplingInterval, stackSuppressCount + 1);
+        state.m_isSampling = false;
+    }
+
+    void AllocationSampler::UnregisterAllocation(void* address)
+    {
+        if (m_numSamples.load(AZStd::memory_order_relaxed) == 0)
+        {
+            return;
+        }
+
+        const uintptr_t key = reinterpret_cast<uintptr_t>(address);
+        size_t index = GetSlotIndex(address);
+        for (unsigned int probe = 0; probe < MaxProbes; ++probe, index = (index + 1) & m_slotMask)
+        {
+            Slot& slot = m_slots[index];
+            uintptr_t slotKey = slot.m_key.load(AZStd::memory_order_acquire);
+            if (slotKey == key)
+            {
+                if (slot.m_key.compare_exchange_strong(slotKey, BusyKey, AZStd::memory_order_acquire))
+                {
+                    RemoveSample(slot);
+                }
+                return;
+            }
+            if (slotKey == EmptyKey)
+            {
+                return;
+            }
+        }
+    }
+
+    void AllocationSampler::UnregisterAllocator(IAllocator* allocator)
+    {
+        for (size_t i = 0; i <= m_slotMask; ++i)
+        {
+            Slot& slot = m_slots[i];
+            uintptr_t key = slot.m_key.load(AZStd::memory_order_acquire);
+            if (key > RemovedKey && slot.m_key.compare_exchange_strong(key, BusyKey, AZStd::memory_order_acquire))
+            {
+                if (slot.m_sample.m_allocator == allocator)
+                {
+                    RemoveSample(slot);
+                }
+                else
+                {
+                    slot.m_key.store(key, AZStd::memory_order_release);
+                }
+            }
+        }
+    }
+
+    void AllocationSampler::EnumerateSamples(const AllocationSampleCBType& cb, AZ::u64 sinceSequence) const
+    {
+        AllocationSample sample;
+        for (size_t i = 0; i <= m_slotMask; ++i)
+        {
+            const Slot& slot = m_slots[i];
+            const uintptr_t key = slot.m_key.load(AZStd::memory_order_acquire);
+            if (key <= RemovedKey)
+            {
+                continue;
+            }
+            sample = slot.m_sample;
+            AZStd::atomic_thread_fence(AZStd::memory_order_acquire);
+            // Skip the sample if it was removed while it was being copied.
+            if (slot.m_key.load(AZStd::memory_order_relaxed) != key || sample.m_sequence <= sinceSequence)
+            {
+                continue;
+            }
+            if (!cb(sample))
+            {
+                return;
+            }
+        }
+    }
+
+    void AllocationSampler::PrintSamples(unsigned int maxNumStacks, AZ::u64 sinceSequence) const
+    {
+        using namespace AllocationSamplerInternal;
+
+        // The summaries are allocated from the table allocator so printing doesn't add samples of its own.
+        const size_t maxNumSummaries = m_slotMask + 1;
+        StackSummary* summaries = reinterpret_cast<StackSummary*>(m_allocator->Allocate(sizeof(StackSummary) * maxNumSummaries, alignof(StackSummary), 0, "AllocationSampler", __FILE__, __LINE__));
+        if (!summaries)
+        {
+            return;
+        }
+
+        size_t numSummaries = 0;
+        size_t totalBytes = 0;
+        EnumerateSamples([summaries, maxNumSummaries, &numSummaries, &totalBytes](const AllocationSample& sample)
+            {
+                summaries[numSummaries].m_sample = sample;
+                summaries[numSummaries].m_numSamples = 1;
+                totalBytes += sample.m_estimatedBytes;
+                return ++numSummaries < maxNumSummaries;
+            }, sinceSequence);
+
+        // Merge the samples with the same call stack.
+        AZStd::sort(summaries, summaries + numSummaries, [](const StackSummary& lhs, const StackSummary& rhs)
+            {
+                return IsStackLess(lhs.m_sample, rhs.m_sample);
+            });
+        size_t numStacks = 0;
+        for (size_t i = 0; i < numSummaries; ++i)
+        {
+            if (numStacks > 0 && IsSameStack(summaries[numStacks - 1].m_sample, summaries[i].m_sample))
+            {
+                summaries[numStacks - 1].m_sample.m_estimatedBytes += summaries[i].m_sample.m_estimatedBytes;
+                summaries[numStacks - 1].m_numSamples++;
+            }
+            else
+            {
+                summaries[numStacks++] = summaries[i];
+            }
+        }
+        AZStd::sort(summaries, summaries + numStacks, [](const StackSummary& lhs, const StackSummary& rhs)
+            {
+                return lhs.m_sample.m_estimatedBytes > rhs.m_sample.m_estimatedBytes;
+            });
+
+        AZ_Printf("Memory", "Allocation samples: %zu samples in %zu call stacks, estimated %zu bytes. Sampling interval: %zu bytes, dropped samples: %zu\n",
+            numSummaries, numStacks, totalBytes, GetSamplingInterval(), GetNumDroppedSamples());
+
+        const size_t numToPrint = AZStd::GetMin(numStacks, static_cast<size_t>(maxNumStacks));
+        for (size_t i = 0; i < numToPrint; ++i)
+        {
+            const AllocationSample& sample = summaries[i].m_sample;
+            AZ_Printf("Memory", "Estimated %zu bytes in %zu samples from allocator \"%s\":\n", sample.m_estimatedBytes, summaries[i].m_numSamples,
+                sample.m_allocatorName ? sample.m_allocatorName : "Unknown");
+
+            SymbolStorage::StackLine lines[AllocationSample::MaxStackLevels];
+            SymbolStorage::DecodeFrames(sample.m_stackFrames, sample.m_numStackLevels, lines);
+            for (unsigned char line = 0; line < sample.m_numStackLevels; ++line)
+            {
+                AZ_Printf("Memory", " %s\n", lines[line]);
+            }
+        }
+
+        m_allocator->DeAllocate(summaries, sizeof(StackSummary) * maxNumSummaries, alignof(StackSummary));
+    }
+
+    AZ::u64 AllocationSampler::GetSequence() const
+    {
+        return m_sequence.load(AZStd::memory_order_relaxed);
+    }
+
+    size_t AllocationSampler::GetNumSamples() const
+    {
+        return m_numSamples.load(AZStd::memory_order_relaxed);
+    }
+
+    size_t AllocationSampler::GetEstimatedBytes() const
+    {
+        return m_estimatedBytes.load(AZStd::memory_order_relaxed);
+    }
+
+    size_t AllocationSampler::GetNumDroppedSamples() const
+    {
+        return m_numDroppedSamples.load(AZStd::memory_order_relaxed);
+    }
+
+    size_t AllocationSampler::GetSlotIndex(void* address) const
+    {
+        AZ::u64 hash = static_cast<AZ::u64>(reinterpret_cast<uintptr_t>(address));
+        hash ^= hash >> 33;
+        hash *= 0xFF51AFD7ED558CCDull;
+        hash ^= hash >> 33;
+        return static_cast<size_t>(hash) & m_slotMask;
+    }
+
+    void AllocationSampler::AddSample(IAllocator* allocator, void* address, size_t byteSize, size_t samplingInterval, unsigned int stackSuppressCount)
+    {
+        size_t index = GetSlotIndex(address);
+        for (unsigned int probe = 0; probe < MaxProbes; ++probe, index = (index + 1) & m_slotMask)
+        {
+            Slot& slot = m_slots[index];
+            uintptr_t key = slot.m_key.load(AZStd::memory_order_relaxed);
+            if ((key == EmptyKey || key == RemovedKey) && slot.m_key.compare_exchange_strong(key, BusyKey, AZStd::memory_order_acquire))
+            {
+                // An allocation of byteSize bytes is sampled with a probability of 1 - e^(-byteSize / interval), so each
+                // sample stands for byteSize divided by that probability.
+                const double probability = 1.0 - exp(-static_cast<double>(byteSize) / static_cast<double>(samplingInterval));
+                const size_t estimatedBytes = probability > 0.0 ? static_cast<size_t>(static_cast<double>(byteSize) / probability) : samplingInterval;
+
+                AllocationSample& sample = slot.m_sample;
+                sample.m_address = address;
+                sample.m_allocator = allocator;
+                sample.m_allocatorName = allocator ? allocator->GetName() : nullptr;
+                sample.m_byteSize = byteSize;
+                sample.m_estimatedBytes = estimatedBytes;
+                sample.m_sequence = m_sequence.fetch_add(1, AZStd::memory_order_relaxed) + 1;
+                sample.m_numStackLevels = static_cast<unsigned char>(StackRecorder::Record(sample.m_stackFrames, AllocationSample::MaxStackLevels, stackSuppressCount + 1));
+
+                m_numSamples.fetch_add(1, AZStd::memory_order_relaxed);
+                m_estimatedBytes.fetch_add(estimatedBytes, AZStd::memory_order_relaxed);
+                slot.m_key.store(reinterpret_cast<uintptr_t>(address), AZStd::memory_order_release);
+                return;
+            }
+        }
+        m_numDroppedSamples.fetch_add(1, AZStd::memory_order_relaxed);
+    }
+
+    void AllocationSampler::RemoveSample(Slot& slot)
+    {
+        m_numSamples.fetch_sub(1, AZStd::memory_order_relaxed);
+        m_estimatedBytes.fetch_sub(slot.m_sample.m_estimatedBytes, AZStd::memory_order_relaxed);
+        slot.m_key.store(RemovedKey, AZStd::memory_order_release);
+    }
+} // namespace AZ::Debug
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Debug/StackTracer.h>
+#include <AzCore/std/function/function_fwd.h> // for callbacks
+#include <AzCore/std/parallel/atomic.h>
+
+namespace AZ
+{
+    class IAllocator;
+    class IAllocatorAllocate;
+
+    namespace Debug
+    {
+        /**
+        * Information about a sampled allocation.
+        */
+        struct AllocationSample
+        {
+            static const unsigned int MaxStackLevels = 16;
+
+            void*           m_address{};
+            IAllocator*     m_allocator{};
+            const char*     m_allocatorName{};
+            size_t          m_byteSize{};
+            size_t          m_estimatedBytes{}; ///< Number of allocated bytes this sample represents.
+            AZ::u64         m_sequence{};       ///< Increases with every sample, see AllocationSampler::GetSequence.
+            unsigned char   m_numStackLevels{};
+            StackFrame      m_stackFrames[MaxStackLevels];
+        };
+
+        /**
+         * Sample enumeration callback.
+         * \returns true to continue the enumeration and false to stop.
+         */
+        typedef AZStd::function<bool (const AllocationSample&)> AllocationSampleCBType;
+
+        /**
+        * Low overhead alternative to the AllocationRecords for finding heap growth, for example during soak tests.
+        * Instead of recording every allocation, on average one allocation is sampled for every sampling interval
+        * bytes. The distance between two samples follows an exponential distribution (Poisson sampling), so
+        * allocations of every size are sampled in proportion to the number of bytes they allocate. Each sample
+        * stores the call stack and an estimate of the number of bytes it represents.
+        *
+        * Samples are stored in a fixed size, lock free hash table keyed by address, so threads sample without
+        * locking and a deallocation on any thread removes its sample. Allocations that don't fit in the table
+        * are counted as dropped. Everything is allocated up front with the given allocator, no AZ allocator is
+        * used after that.
+        *
+        * Enable sampling through AllocatorManager::SetAllocationSamplingInterval. Like the other allocation profiling
+        * this isn't available in release builds.
+        */
+        class AllocationSampler
+        {
+        public:
+            AllocationSampler(IAllocatorAllocate* allocator, unsigned int maxNumSamples = 16 * 1024);
+            ~AllocationSampler();
+
+            AllocationSampler(const AllocationSampler&) = delete;
+            AllocationSampler& operator=(const AllocationSampler&) = delete;
+
+            /// Average number of bytes allocated between two samples. 0 disables sampling.
+            void SetSamplingInterval(size_t samplingInterval);
+            size_t GetSamplingInterval() const;
+
+            /// Called for every allocation, samples it if the current thread has allocated enough bytes since its last sample.
+            void RegisterAllocation(IAllocator* allocator, void* address, size_t byteSize, unsigned int stackSuppressCount);
+            /// Called for every deallocation, removes the sample of the allocation if there's one.
+            void UnregisterAllocation(void* address);
+            /// Removes all samples of an allocator that's being destroyed.
+            void UnregisterAllocator(IAllocator* allocator);
+
+            /// Calls the callback for every live sample with a sequence number larger than sinceSequence. Safe to call while
+            /// other threads allocate, but samples added or removed during the enumeration might be missed.
+            void EnumerateSamples(const AllocationSampleCBType& cb, AZ::u64 sinceSequence = 0) const;
+            /// Prints the call stacks that hold the most sampled memory. Use the sequence to only include samples taken
+            /// after that point, for example to find the memory that was allocated but not released during a soak test.
+            void PrintSamples(unsigned int maxNumStacks = 20, AZ::u64 sinceSequence = 0) const;
+
+            /// Returns the sequence number of the latest sample.
+            AZ::u64 GetSequence() const;
+            /// Returns the number of sampled allocations that are still alive.
+            size_t GetNumSamples() const;
+            /// Returns the estimated number of live bytes the current samples represent.
+            size_t GetEstimatedBytes() const;
+            /// Returns the number of samples that were skipped because the table was full.
+            size_t GetNumDroppedSamples() const;
+
+        private:
+            struct Slot
+            {
+                AZStd::atomic<uintptr_t> m_key{ 0 };
+                AllocationSample m_sample;
+            };
+
+            static const uintptr_t EmptyKey = 0;
+            static const uintptr_t BusyKey = 1;
+            static const uintptr_t RemovedKey = 2;
+            static const unsigned int MaxProbes = 16;
+
+            size_t GetSlotIndex(void* address) const;
+            void AddSample(IAllocator* allocator, void* address, size_t byteSize, size_t samplingInterval, unsigned int stackSuppressCount);
+            void RemoveSample(Slot& slot);
+
+            IAllocatorAllocate* m_allocator;
+            Slot* m_slots;
+            size_t m_slotMask;
+
+            AZStd::atomic<size_t> m_samplingInterval{ 0 };
+            AZStd::atomic<AZ::u64> m_sequence{ 0 };
+            AZStd::atomic<size_t> m_numSamples{ 0 };
+            AZStd::atomic<size_t> m_estimatedBytes{ 0 };
+            AZStd::atomic<size_t> m_numDroppedSamples{ 0 };
+        };
+    } // namespace Debug
+} // namespace AZ
@@ -8,6 +8,7 @@
 
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Memory/AllocationSampler.h>
 #include <AzCore/Memory/MemoryDrillerBus.h>
 
 using namespace AZ;
@@ -112,6 +113,11 @@ bool AllocatorBase::IsProfilingActive() const
     return m_isProfilingActive;
 }
 
+void AllocatorBase::SetAllocationSampler(Debug::AllocationSampler* sampler)
+{
+    m_sampler = sampler;
+}
+
 void AllocatorBase::DisableOverriding()
 {
     m_canBeOverridden = false;
@@ -136,10 +142,20 @@ void AllocatorBase::ProfileAllocation(void* ptr, size_t byteSize, size_t alignme
         EBUS_EVENT(AZ::Debug::MemoryDrillerBus, RegisterAllocation, this, ptr, byteSize, alignment, name, fileName, lineNum, suppressStackRecord);
 #endif
     }
+
+    if (m_sampler)
+    {
+        m_sampler->RegisterAllocation(this, ptr, byteSize, static_cast<unsigned int>(suppressStackRecord) + 1);
+    }
 }
 
 void AllocatorBase::ProfileDeallocation(void* ptr, size_t byteSize, size_t alignment, Debug::AllocationInfo* info)
 {
+    if (m_sampler)
+    {
+        m_sampler->UnregisterAllocation(ptr);
+    }
+
     if (m_isProfilingActive)
     {
 #if PLATFORM_MEMORY_INSTRUMENTATION_ENABLED
@@ -166,6 +182,12 @@ void AllocatorBase::ProfileReallocationBegin(void* ptr, size_t newSize)
 
 void AllocatorBase::ProfileReallocationEnd(void* ptr, void* newPtr, size_t newSize, size_t newAlignment)
 {
+    if (m_sampler)
+    {
+        m_sampler->UnregisterAllocation(ptr);
+        m_sampler->RegisterAllocation(this, newPtr, newSize, 1);
+    }
+
     if (m_isProfilingActive)
     {
 #if PLATFORM_MEMORY_INSTRUMENTATION_ENABLED
@@ -44,6 +44,7 @@ namespace AZ
         bool IsLazilyCreated() const final;
         void SetProfilingActive(bool active) final;
         bool IsProfilingActive() const final;
+        void SetAllocationSampler(Debug::AllocationSampler* sampler) final;
         //---------------------------------------------------------------------
 
     protected:
@@ -104,6 +105,7 @@ namespace AZ
         const char* m_name = nullptr;
         const char* m_desc = nullptr;
         Debug::AllocationRecords* m_records = nullptr;  // Cached pointer to allocation records. Works together with the MemoryDriller.
+        Debug::AllocationSampler* m_sampler = nullptr;  // Set by the AllocatorManager while allocation sampling is enabled.
         size_t m_memoryGuardSize = 0;
         bool m_isLazilyCreated = false;
         bool m_isProfilingActive = false;
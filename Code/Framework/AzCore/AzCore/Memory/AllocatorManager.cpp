@@ -12,6 +12,7 @@
 
 #include <AzCore/Memory/OSAllocator.h>
 #include <AzCore/Memory/AllocationRecords.h>
+#include <AzCore/Memory/AllocationSampler.h>
 #include <AzCore/Memory/AllocatorOverrideShim.h>
 #include <AzCore/Memory/MallocSchema.h>
 #include <AzCore/Memory/MemoryDrillerBus.h>
@@ -168,6 +169,7 @@ AZ::MallocSchema* AllocatorManager::CreateMallocSchema()
 //=========================================================================
 AllocatorManager::AllocatorManager()
     : m_profilingRefcount(0)
+    , m_sampler(nullptr)
     , m_mallocSchema(CreateMallocSchema(), [](AZ::MallocSchema* schema)
     {
         if (schema)
@@ -211,6 +213,7 @@ AllocatorManager::RegisterAllocator(class IAllocator* alloc)
     }
 
     alloc->SetProfilingActive(m_profilingRefcount.load() > 0);
+    alloc->SetAllocationSampler(m_sampler);
 
     m_allocators[m_numAllocators++] = alloc;
 
@@ -228,6 +231,18 @@ AllocatorManager::RegisterAllocator(class IAllocator* alloc)
 void
 AllocatorManager::InternalDestroy()
 {
+    if (m_sampler)
+    {
+        // Lazy allocators outlive the manager, make sure they stop sampling first.
+        for (int i = 0; i < m_numAllocators; ++i)
+        {
+            m_allocators[i]->SetAllocationSampler(nullptr);
+        }
+        m_sampler->~AllocationSampler();
+        m_mallocSchema->DeAllocate(m_sampler);
+        m_sampler = nullptr;
+    }
+
     while (m_numAllocators > 0)
     {
         IAllocator* allocator = m_allocators[m_numAllocators - 1];
@@ -326,6 +341,12 @@ AllocatorManager::UnRegisterAllocator(class IAllocator* alloc)
         EBUS_EVENT(Debug::MemoryDrillerBus, UnregisterAllocator, alloc);
     }
 
+    if (m_sampler)
+    {
+        m_sampler->UnregisterAllocator(alloc);
+        alloc->SetAllocationSampler(nullptr);
+    }
+
     for (int i = 0; i < m_numAllocators; ++i)
     {
         if (m_allocators[i] == alloc)
@@ -544,6 +565,29 @@ AllocatorManager::ExitProfilingMode()
     AZ_Assert(m_profilingRefcount.load() >= 0, "ExitProfilingMode called without matching EnterProfilingMode");
 }
 
+void
+AllocatorManager::SetAllocationSamplingInterval(size_t samplingInterval)
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_allocatorListMutex);
+
+    if (!m_sampler)
+    {
+        if (samplingInterval == 0)
+        {
+            return;
+        }
+
+        // The sampler is kept until shutdown so the samples stay available after sampling is stopped.
+        m_sampler = new (m_mallocSchema->Allocate(sizeof(Debug::AllocationSampler), AZStd::alignment_of<Debug::AllocationSampler>::value, 0)) Debug::AllocationSampler(m_mallocSchema.get());
+        for (int i = 0; i < m_numAllocators; ++i)
+        {
+            m_allocators[i]->SetAllocationSampler(m_sampler);
+        }
+    }
+
+    m_sampler->SetSamplingInterval(samplingInterval);
+}
+
 void
 AllocatorManager::DumpAllocators()
 {
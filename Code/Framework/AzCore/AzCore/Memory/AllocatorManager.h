@@ -23,6 +23,11 @@ namespace AZ
     class IAllocator;
     class MallocSchema;
 
+    namespace Debug
+    {
+        class AllocationSampler;
+    }
+
     /**
     * Global allocation manager. It has access to all
     * created allocators IAllocator interface. And control
@@ -97,6 +102,12 @@ namespace AZ
         void EnterProfilingMode();
         void ExitProfilingMode();
 
+        /// Samples allocations from all allocators, on average one every samplingInterval bytes, see AllocationSampler.
+        /// Unlike the allocation records this is cheap enough to leave enabled. 0 stops sampling but keeps the existing samples.
+        void SetAllocationSamplingInterval(size_t samplingInterval);
+        /// Returns the allocation sampler, or nullptr if sampling was never enabled.
+        Debug::AllocationSampler* GetAllocationSampler() const { return m_sampler; }
+
         /// Outputs allocator useage to the console, and also stores the values in m_dumpInfo for viewing in the crash dump
         void DumpAllocators();
 
@@ -179,6 +190,7 @@ namespace AZ
         InternalData*       m_data;
         bool                m_configurationFinalized;
         AZStd::atomic<int>  m_profilingRefcount;
+        Debug::AllocationSampler* m_sampler;
 
         AZ::Debug::AllocationRecords::Mode m_defaultTrackingRecordMode;
         AZStd::unique_ptr<AZ::MallocSchema, void(*)(AZ::MallocSchema*)> m_mallocSchema;
@@ -0,0 +1,441 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/FrameArenaAllocator.h>
+#include <AzCore/Memory/OSAllocator.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/lock.h>
+
+namespace AZ
+{
+    //=========================================================================
+    // FrameArenaSchema
+    //=========================================================================
+    FrameArenaSchema::FrameArenaSchema(const Descriptor& desc)
+        : m_desc(desc)
+        , m_arenas(nullptr)
+        , m_numArenas(desc.m_maxNumThreads)
+    {
+        AZ_Assert(m_desc.m_chunkSize > sizeof(Chunk), "Chunk size of the frame arena is too small.");
+        if (m_numArenas > 0)
+        {
+            m_arenas = reinterpret_cast<ThreadArena*>(SystemAlloc(sizeof(ThreadArena) * m_numArenas, alignof(ThreadArena)));
+            for (unsigned int i = 0; i < m_numArenas; ++i)
+            {
+                new (&m_arenas[i]) ThreadArena();
+            }
+        }
+    }
+
+    //=========================================================================
+    // ~FrameArenaSchema
+    //=========================================================================
+    FrameArenaSchema::~FrameArenaSchema()
+    {
+        ResetFrame();
+        for (unsigned int i = 0; i < m_numArenas; ++i)
+        {
+            // ResetFrame keeps the current chunk of every arena around for the next frame.
+            if (m_arenas[i].m_chunks)
+            {
+                ReleaseChunk(m_arenas[i].m_chunks);
+            }
+            m_arenas[i].~ThreadArena();
+        }
+        if (m_sharedArena.m_chunks)
+        {
+            ReleaseChunk(m_sharedArena.m_chunks);
+        }
+        GarbageCollect();
+
+        if (m_arenas)
+        {
+            SystemFree(m_arenas);
+            m_arenas = nullptr;
+        }
+        AZ_Assert(m_capacity == 0, "The frame arena didn't release all of its chunks.");
+    }
+
+    //=========================================================================
+    // Allocate
+    //=========================================================================
+    FrameArenaSchema::pointer_type FrameArenaSchema::Allocate(size_type byteSize, size_type alignment, int flags, const char* name, const char* fileName, int lineNum, unsigned int suppressStackRecord)
+    {
+        (void)flags;
+        (void)name;
+        (void)fileName;
+        (void)lineNum;
+        (void)suppressStackRecord;
+
+        if (ThreadArena* arena = FindThreadArena())
+        {
+            return AllocateFromArena(*arena, byteSize, alignment);
+        }
+        AZStd::lock_guard<AZStd::mutex> lock(m_sharedArenaMutex);
+        return AllocateFromArena(m_sharedArena, byteSize, alignment);
+    }
+
+    //=========================================================================
+    // DeAllocate
+    //=========================================================================
+    void FrameArenaSchema::DeAllocate(pointer_type ptr, size_type byteSize, size_type alignment)
+    {
+        (void)alignment;
+        // Without the size there's no way to tell if this is the latest allocation. Everything is released by ResetFrame anyway.
+        if (!ptr || byteSize == 0)
+        {
+            return;
+        }
+
+        if (ThreadArena* arena = FindThreadArena())
+        {
+            DeAllocateFromArena(*arena, ptr, byteSize);
+            return;
+        }
+        AZStd::lock_guard<AZStd::mutex> lock(m_sharedArenaMutex);
+        DeAllocateFromArena(m_sharedArena, ptr, byteSize);
+    }
+
+    //=========================================================================
+    // Resize
+    //=========================================================================
+    FrameArenaSchema::size_type FrameArenaSchema::Resize(pointer_type ptr, size_type newSize)
+    {
+        if (ThreadArena* arena = FindThreadArena())
+        {
+            return ResizeInArena(*arena, ptr, newSize);
+        }
+        AZStd::lock_guard<AZStd::mutex> lock(m_sharedArenaMutex);
+        return ResizeInArena(m_sharedArena, ptr, newSize);
+    }
+
+    //=========================================================================
+    // ReAllocate
+    //=========================================================================
+    FrameArenaSchema::pointer_type FrameArenaSchema::ReAllocate(pointer_type ptr, size_type newSize, size_type newAlignment)
+    {
+        if (!ptr)
+        {
+            return Allocate(newSize, newAlignment);
+        }
+        if ((reinterpret_cast<size_t>(ptr) & (newAlignment - 1)) == 0 && Resize(ptr, newSize) == newSize)
+        {
+            return ptr;
+        }
+        AZ_Assert(false, "The frame arena can only reallocate the latest allocation of a thread in place.");
+        return nullptr;
+    }
+
+    //=========================================================================
+    // AllocationSize
+    //=========================================================================
+    FrameArenaSchema::size_type FrameArenaSchema::AllocationSize(pointer_type ptr)
+    {
+        (void)ptr;
+        return 0;
+    }
+
+    //=========================================================================
+    // GarbageCollect
+    //=========================================================================
+    void FrameArenaSchema::GarbageCollect()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_chunkMutex);
+        while (m_freeChunks)
+        {
+            Chunk* chunk = m_freeChunks;
+            m_freeChunks = chunk->m_next;
+            m_capacity -= sizeof(Chunk) + chunk->m_size;
+            SystemFree(chunk);
+        }
+    }
+
+    //=========================================================================
+    // NumAllocatedBytes
+    //=========================================================================
+    FrameArenaSchema::size_type FrameArenaSchema::NumAllocatedBytes() const
+    {
+        size_t allocatedBytes = m_sharedArena.m_allocatedBytes.load(AZStd::memory_order_relaxed);
+        for (unsigned int i = 0; i < m_numArenas; ++i)
+        {
+            allocatedBytes += m_arenas[i].m_allocatedBytes.load(AZStd::memory_order_relaxed);
+        }
+        return allocatedBytes;
+    }
+
+    //=========================================================================
+    // Capacity
+    //=========================================================================
+    FrameArenaSchema::size_type FrameArenaSchema::Capacity() const
+    {
+        return m_capacity;
+    }
+
+    //=========================================================================
+    // GetMaxAllocationSize
+    //=========================================================================
+    FrameArenaSchema::size_type FrameArenaSchema::GetMaxAllocationSize() const
+    {
+        // Anything larger than a chunk gets a chunk of its own.
+        return AZ_CORE_MAX_ALLOCATOR_SIZE;
+    }
+
+    //=========================================================================
+    // GetUnAllocatedMemory
+    //=========================================================================
+    FrameArenaSchema::size_type FrameArenaSchema::GetUnAllocatedMemory(bool isPrint) const
+    {
+        (void)isPrint;
+        const size_t capacity = Capacity();
+        const size_t allocated = NumAllocatedBytes();
+        return capacity > allocated ? capacity - allocated : 0;
+    }
+
+    //=========================================================================
+    // GetSubAllocator
+    //=========================================================================
+    IAllocatorAllocate* FrameArenaSchema::GetSubAllocator()
+    {
+        return m_desc.m_subAllocator;
+    }
+
+    //=========================================================================
+    // ResetFrame
+    //=========================================================================
+    void FrameArenaSchema::ResetFrame()
+    {
+        for (unsigned int i = 0; i < m_numArenas; ++i)
+        {
+            ResetArena(m_arenas[i]);
+        }
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_sharedArenaMutex);
+            ResetArena(m_sharedArena);
+        }
+        m_frameIndex.fetch_add(1, AZStd::memory_order_release);
+    }
+
+    //=========================================================================
+    // GetFrameIndex
+    //=========================================================================
+    AZ::u64 FrameArenaSchema::GetFrameIndex() const
+    {
+        return m_frameIndex.load(AZStd::memory_order_acquire);
+    }
+
+    //=========================================================================
+    // FindThreadArena
+    //=========================================================================
+    FrameArenaSchema::ThreadArena* FrameArenaSchema::FindThreadArena()
+    {
+        // Thread local storage isn't shared between modules, so the arenas are found through a lock free hash table instead.
+        // Threads never give up their arena. If a thread exits, a new thread with the same id reuses the arena.
+        const AZStd::thread_id threadId = AZStd::this_thread::get_id();
+        unsigned int index = static_cast<unsigned int>(AZStd::hash<AZStd::thread_id>{}(threadId) % AZStd::GetMax(m_numArenas, 1u));
+        for (unsigned int probe = 0; probe < m_numArenas; ++probe)
+        {
+            ThreadArena& arena = m_arenas[index];
+            AZStd::native_thread_id_type owner = arena.m_threadId.load(AZStd::memory_order_acquire);
+            if (owner == threadId.m_id)
+            {
+                return &arena;
+            }
+            if (owner == AZStd::native_thread_invalid_id &&
+                arena.m_threadId.compare_exchange_strong(owner, threadId.m_id, AZStd::memory_order_acq_rel))
+            {
+                return &arena;
+            }
+            index = (index + 1) % m_numArenas;
+        }
+        return nullptr;
+    }
+
+    //=========================================================================
+    // AllocateFromArena
+    //=========================================================================
+    FrameArenaSchema::pointer_type FrameArenaSchema::AllocateFromArena(ThreadArena& arena, size_type byteSize, size_type alignment)
+    {
+        alignment = AZStd::GetMax<size_type>(alignment, 1);
+        char* address = AZ::PointerAlignUp(arena.m_current, alignment);
+        if (!arena.m_current || address + byteSize > arena.m_end)
+        {
+            return AllocateFromNewChunk(arena, byteSize, alignment);
+        }
+        arena.m_current = address + byteSize;
+        arena.m_lastAllocation = address;
+        arena.m_allocatedBytes.store(arena.m_allocatedBytes.load(AZStd::memory_order_relaxed) + byteSize, AZStd::memory_order_relaxed);
+        return address;
+    }
+
+    //=========================================================================
+    // AllocateFromNewChunk
+    //=========================================================================
+    FrameArenaSchema::pointer_type FrameArenaSchema::AllocateFromNewChunk(ThreadArena& arena, size_type byteSize, size_type alignment)
+    {
+        const size_t requiredSize = byteSize + alignment - 1;
+        const size_t standardSize = m_desc.m_chunkSize - sizeof(Chunk);
+        Chunk* chunk = AcquireChunk(AZStd::GetMax(requiredSize, standardSize));
+        if (!chunk)
+        {
+            return nullptr;
+        }
+
+        char* address = AZ::PointerAlignUp(chunk->GetBegin(), alignment);
+        if (requiredSize > standardSize && arena.m_chunks)
+        {
+            // Large allocations get a dedicated chunk, which is inserted behind the current chunk so the remaining
+            // space in the current chunk can still be used.
+            chunk->m_next = arena.m_chunks->m_next;
+            arena.m_chunks->m_next = chunk;
+        }
+        else
+        {
+            chunk->m_next = arena.m_chunks;
+            arena.m_chunks = chunk;
+            arena.m_current = address + byteSize;
+            arena.m_end = chunk->GetEnd();
+            arena.m_lastAllocation = address;
+        }
+        arena.m_allocatedBytes.store(arena.m_allocatedBytes.load(AZStd::memory_order_relaxed) + byteSize, AZStd::memory_order_relaxed);
+        return address;
+    }
+
+    //=========================================================================
+    // DeAllocateFromArena
+    //=========================================================================
+    void FrameArenaSchema::DeAllocateFromArena(ThreadArena& arena, pointer_type ptr, size_type byteSize)
+    {
+        char* address = reinterpret_cast<char*>(ptr);
+        if (address == arena.m_lastAllocation && address + byteSize == arena.m_current)
+        {
+            arena.m_current = address;
+            arena.m_lastAllocation = nullptr;
+            arena.m_allocatedBytes.store(arena.m_allocatedBytes.load(AZStd::memory_order_relaxed) - byteSize, AZStd::memory_order_relaxed);
+        }
+    }
+
+    //=========================================================================
+    // ResizeInArena
+    //=========================================================================
+    FrameArenaSchema::size_type FrameArenaSchema::ResizeInArena(ThreadArena& arena, pointer_type ptr, size_type newSize)
+    {
+        char* address = reinterpret_cast<char*>(ptr);
+        if (!address || address != arena.m_lastAllocation || address + newSize > arena.m_end)
+        {
+            return 0;
+        }
+        const size_t oldSize = arena.m_current - address;
+        arena.m_current = address + newSize;
+        arena.m_allocatedBytes.store(arena.m_allocatedBytes.load(AZStd::memory_order_relaxed) - oldSize + newSize, AZStd::memory_order_relaxed);
+        return newSize;
+    }
+
+    //=========================================================================
+    // ResetArena
+    //=========================================================================
+    void FrameArenaSchema::ResetArena(ThreadArena& arena)
+    {
+        Chunk* kept = nullptr;
+        Chunk* chunk = arena.m_chunks;
+        while (chunk)
+        {
+            Chunk* next = chunk->m_next;
+            // Keep one regular chunk, so the next frame can start allocating without locking.
+            if (!kept && sizeof(Chunk) + chunk->m_size == m_desc.m_chunkSize)
+            {
+                kept = chunk;
+                kept->m_next = nullptr;
+            }
+            else
+            {
+                ReleaseChunk(chunk);
+            }
+            chunk = next;
+        }
+
+        arena.m_chunks = kept;
+        arena.m_current = kept ? kept->GetBegin() : nullptr;
+        arena.m_end = kept ? kept->GetEnd() : nullptr;
+        arena.m_lastAllocation = nullptr;
+        arena.m_allocatedBytes.store(0, AZStd::memory_order_relaxed);
+    }
+
+    //=========================================================================
+    // AcquireChunk
+    //=========================================================================
+    FrameArenaSchema::Chunk* FrameArenaSchema::AcquireChunk(size_t size)
+    {
+        const bool isRegularChunk = sizeof(Chunk) + size == m_desc.m_chunkSize;
+        if (isRegularChunk)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_chunkMutex);
+            if (m_freeChunks)
+            {
+                Chunk* chunk = m_freeChunks;
+                m_freeChunks = chunk->m_next;
+                chunk->m_next = nullptr;
+                return chunk;
+            }
+        }
+
+        void* memory = SystemAlloc(sizeof(Chunk) + size, alignof(Chunk));
+        if (!memory)
+        {
+            return nullptr;
+        }
+        m_capacity += sizeof(Chunk) + size;
+        Chunk* chunk = new (memory) Chunk;
+        chunk->m_next = nullptr;
+        chunk->m_size = size;
+        return chunk;
+    }
+
+    //=========================================================================
+    // ReleaseChunk
+    //=========================================================================
+    void FrameArenaSchema::ReleaseChunk(Chunk* chunk)
+    {
+        if (sizeof(Chunk) + chunk->m_size == m_desc.m_chunkSize)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_chunkMutex);
+            chunk->m_next = m_freeChunks;
+            m_freeChunks = chunk;
+        }
+        else
+        {
+            // Dedicated chunks for large allocations are unlikely to be the right size again, so they're not kept.
+            m_capacity -= sizeof(Chunk) + chunk->m_size;
+            SystemFree(chunk);
+        }
+    }
+
+    //=========================================================================
+    // SystemAlloc
+    //=========================================================================
+    void* FrameArenaSchema::SystemAlloc(size_t size, size_t alignment)
+    {
+        if (m_desc.m_subAllocator)
+        {
+            return m_desc.m_subAllocator->Allocate(size, alignment, 0, "FrameArenaSchema sub allocation", __FILE__, __LINE__);
+        }
+        return AZ_OS_MALLOC(size, alignment);
+    }
+
+    //=========================================================================
+    // SystemFree
+    //=========================================================================
+    void FrameArenaSchema::SystemFree(void* ptr)
+    {
+        if (m_desc.m_subAllocator)
+        {
+            m_desc.m_subAllocator->DeAllocate(ptr);
+            return;
+        }
+        AZ_OS_FREE(ptr);
+    }
+} // namespace AZ
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/Memory/SimpleSchemaAllocator.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace AZ
+{
+    /**
+     * Frame arena allocator schema
+     * Linear allocator for scratch memory that only needs to live for a single frame. Every thread allocates from its
+     * own chunks by moving a pointer forward, so allocating doesn't lock unless a thread needs a new chunk. Deallocating
+     * only returns memory if it's the latest allocation of the thread, which allows containers to grow in place.
+     * All memory is released at once with ResetFrame and the chunks are kept for the next frame.
+     * IMPORTANT: ResetFrame must be called when no thread uses memory from the arena anymore, usually at the end of the tick.
+     */
+    class FrameArenaSchema
+        : public IAllocatorAllocate
+    {
+    public:
+        struct Descriptor
+        {
+            Descriptor()
+                : m_chunkSize(256 * 1024)
+                , m_maxNumThreads(64)
+                , m_subAllocator(nullptr)
+            {}
+
+            size_t                  m_chunkSize;        ///< Size of the chunks the threads allocate from. Larger allocations get a chunk of their own.
+            unsigned int            m_maxNumThreads;    ///< Number of threads that get their own chunks. Any additional threads share a single arena protected by a mutex.
+            IAllocatorAllocate*     m_subAllocator;     ///< Allocator for the chunks, if NULL the OS allocation functions are used.
+        };
+
+        FrameArenaSchema(const Descriptor& desc = Descriptor());
+        ~FrameArenaSchema() override;
+
+        pointer_type Allocate(size_type byteSize, size_type alignment, int flags = 0, const char* name = 0, const char* fileName = 0, int lineNum = 0, unsigned int suppressStackRecord = 0) override;
+        void DeAllocate(pointer_type ptr, size_type byteSize = 0, size_type alignment = 0) override;
+        /// Grows or shrinks the latest allocation of the calling thread in place. Returns 0 for any other allocation.
+        size_type Resize(pointer_type ptr, size_type newSize) override;
+        /// Only supports resizing in place, see Resize.
+        pointer_type ReAllocate(pointer_type ptr, size_type newSize, size_type newAlignment) override;
+        /// The arena doesn't track the size of individual allocations, this always returns 0.
+        size_type AllocationSize(pointer_type ptr) override;
+
+        /// Releases the chunks that weren't needed during the last frame.
+        void GarbageCollect() override;
+
+        size_type NumAllocatedBytes() const override;
+        size_type Capacity() const override;
+        size_type GetMaxAllocationSize() const override;
+        size_type GetUnAllocatedMemory(bool isPrint = false) const override;
+        IAllocatorAllocate* GetSubAllocator() override;
+
+        /// Releases all memory allocated since the previous call. No allocations from the arena can be used after this call.
+        void ResetFrame();
+        /// Returns the number of times ResetFrame has been called.
+        AZ::u64 GetFrameIndex() const;
+
+    private:
+        struct Chunk
+        {
+            Chunk* m_next;
+            size_t m_size;      ///< Number of bytes available after the header.
+
+            char* GetBegin()    { return reinterpret_cast<char*>(this + 1); }
+            char* GetEnd()      { return GetBegin() + m_size; }
+        };
+
+        struct alignas(64) ThreadArena
+        {
+            AZStd::atomic<AZStd::native_thread_id_type> m_threadId{ AZStd::native_thread_invalid_id };
+            char* m_current = nullptr;
+            char* m_end = nullptr;
+            char* m_lastAllocation = nullptr;
+            Chunk* m_chunks = nullptr;                      ///< Chunks in use this frame with the current chunk at the front.
+            AZStd::atomic<size_t> m_allocatedBytes{ 0 };    ///< Only written by the thread that owns the arena.
+        };
+
+        FrameArenaSchema(const FrameArenaSchema&) = delete;
+        FrameArenaSchema& operator=(const FrameArenaSchema&) = delete;
+
+        ThreadArena* FindThreadArena();
+        pointer_type AllocateFromArena(ThreadArena& arena, size_type byteSize, size_type alignment);
+        pointer_type AllocateFromNewChunk(ThreadArena& arena, size_type byteSize, size_type alignment);
+        void DeAllocateFromArena(ThreadArena& arena, pointer_type ptr, size_type byteSize);
+        size_type ResizeInArena(ThreadArena& arena, pointer_type ptr, size_type newSize);
+        void ResetArena(ThreadArena& arena);
+
+        Chunk* AcquireChunk(size_t size);
+        void ReleaseChunk(Chunk* chunk);
+        void* SystemAlloc(size_t size, size_t alignment);
+        void SystemFree(void* ptr);
+
+        Descriptor m_desc;
+        ThreadArena* m_arenas;
+        unsigned int m_numArenas;
+        ThreadArena m_sharedArena;
+        AZStd::mutex m_sharedArenaMutex;
+
+        Chunk* m_freeChunks = nullptr;
+        AZStd::mutex m_chunkMutex;
+        AZStd::atomic<size_t> m_capacity{ 0 };
+        AZStd::atomic<AZ::u64> m_frameIndex{ 0 };
+    };
+
+    /**
+     * Allocator for temporary memory that's released at the end of every frame. The ComponentApplication creates this
+     * allocator and resets it at the end of each tick. Use it through FrameArenaStdAllocator to build temporary AZStd
+     * containers during a frame, e.g. AZStd::vector<Entity*, FrameArenaStdAllocator>. The containers must not be used
+     * after the frame ends, including their destructors releasing the memory.
+     */
+    class FrameArenaAllocator final
+        : public SimpleSchemaAllocator<FrameArenaSchema, FrameArenaSchema::Descriptor, /* ProfileAllocations */ false, /* ReportOutOfMemory */ true>
+    {
+    public:
+        AZ_TYPE_INFO(FrameArenaAllocator, "{7C9B5D4E-2F1A-4E8C-9B3D-6A5F0E1C8D27}");
+
+        using Base = SimpleSchemaAllocator<FrameArenaSchema, FrameArenaSchema::Descriptor, false, true>;
+        using Descriptor = Base::Descriptor;
+
+        FrameArenaAllocator()
+            : Base("FrameArenaAllocator", "Linear allocator for memory that's released at the end of the frame")
+        {
+        }
+
+        AllocatorDebugConfig GetDebugConfig() override
+        {
+            // Allocations are released in bulk, so there's nothing to track for individual allocations.
+            return AllocatorDebugConfig().ExcludeFromDebugging();
+        }
+
+        /// Releases all memory allocated during the frame, see FrameArenaSchema::ResetFrame.
+        void ResetFrame()
+        {
+            static_cast<FrameArenaSchema*>(m_schema)->ResetFrame();
+        }
+
+        AZ::u64 GetFrameIndex() const
+        {
+            return static_cast<const FrameArenaSchema*>(m_schema)->GetFrameIndex();
+        }
+    };
+
+    using FrameArenaStdAllocator = AZStdAlloc<FrameArenaAllocator>;
+} // namespace AZ
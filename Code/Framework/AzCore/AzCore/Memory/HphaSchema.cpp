@@ -11,8 +11,10 @@
 
 #include <AzCore/Math/Random.h>
 #include <AzCore/Memory/OSAllocator.h> // required by certain platforms
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/containers/intrusive_set.h>
 
 #ifdef _DEBUG
@@ -56,6 +58,11 @@ namespace AZ {
 // Enabled mutex per bucket
 #define USE_MUTEX_PER_BUCKET
 
+#ifdef MULTITHREADED
+// Enable per thread caches in front of the buckets
+#   define USE_THREAD_CACHES
+#endif
+
     //////////////////////////////////////////////////////////////////////////
     // TODO: Replace with AZStd::intrusive_list
     class intrusive_list_base
@@ -467,6 +474,69 @@ namespace AZ {
         size_t bucket_get_max_allocation() const;
         size_t bucket_get_unused_memory(bool isPrint) const;
         void bucket_purge();
+        // allocates up to count elements from a bucket with a single lock and links them through their free links
+        unsigned bucket_alloc_batch(unsigned bi, free_link*& head, unsigned count);
+        // returns a linked list of elements to a bucket with a single lock
+        void bucket_free_batch(unsigned bi, free_link* head);
+
+#if defined(USE_THREAD_CACHES)
+        // thread caches keep a small number of free elements per bucket for every thread that uses the HpAllocator,
+        // so most small allocations and frees don't need to take the bucket lock. elements are cached by the thread
+        // that frees them and move between the caches and the buckets in batches. a cache that grows beyond its limit
+        // returns half of it to the bucket and every cache periodically returns the elements it hasn't needed.
+        struct thread_cache
+        {
+            struct magazine
+            {
+                free_link* mHead = nullptr;
+                unsigned mCount = 0;
+                unsigned mLowWater = 0; // lowest number of cached elements since the last rebalance
+            };
+            magazine mMagazines[NUM_BUCKETS];
+            thread_cache* mNext = nullptr;
+            unsigned mOperations = 0; // allocations and frees since the last rebalance
+            // set while the cache is in use, so another thread can drain the cache during a purge
+            AZStd::atomic_bool mInUse{ false };
+        };
+        struct thread_cache_slot
+        {
+            size_t mAllocatorId;
+            thread_cache* mCache;
+        };
+        // the number of HpAllocators a single thread can have a cache for
+        static const unsigned NUM_THREAD_CACHE_SLOTS = 4;
+        // the number of allocations and frees from a thread cache between two rebalances
+        static const unsigned THREAD_CACHE_REBALANCE_INTERVAL = 4096;
+        // the upper limit for the number of bytes cached per bucket per thread
+        static const size_t THREAD_CACHE_MAGAZINE_SIZE = 4096;
+
+        static inline unsigned thread_cache_capacity(unsigned bi)
+        {
+            const unsigned count = (unsigned)(THREAD_CACHE_MAGAZINE_SIZE / bucket_spacing_function_inverse(bi));
+            return AZStd::GetMax(4u, AZStd::GetMin(64u, count));
+        }
+
+        thread_cache* thread_cache_acquire();
+        void thread_cache_release(thread_cache* cache);
+        thread_cache* thread_cache_create();
+        void* thread_cache_alloc(thread_cache* cache, unsigned bi);
+        void thread_cache_free(thread_cache* cache, void* ptr, unsigned bi);
+        void thread_cache_flush(thread_cache::magazine& m, unsigned bi, unsigned count);
+        void thread_cache_rebalance(thread_cache* cache);
+        // returns the content of all thread caches to the buckets
+        void thread_cache_drain();
+        void thread_cache_destroy();
+
+        static AZ_THREAD_LOCAL thread_cache_slot s_threadCacheSlots[NUM_THREAD_CACHE_SLOTS];
+        static AZStd::atomic<size_t> s_nextAllocatorId;
+
+        // ids are never reused, so a thread can't mistake the cache of a destroyed allocator for the one of a new
+        // allocator created at the same address
+        size_t mAllocatorId;
+        thread_cache* mThreadCaches = nullptr;
+        AZStd::mutex mThreadCacheMutex;
+#endif
+        bool m_isThreadCaching = false;
 
         // locate the page information from a pointer
         inline page* ptr_get_page(void* ptr) const
@@ -719,8 +789,9 @@ namespace AZ {
 
 #endif // DEBUG_ALLOCATOR
 
-        size_t mTotalAllocatedSizeBuckets = 0;
-        size_t mTotalCapacitySizeBuckets = 0;
+        // atomic because these are updated under the different bucket locks and by the thread caches
+        AZStd::atomic<size_t> mTotalAllocatedSizeBuckets{ 0 };
+        AZStd::atomic<size_t> mTotalCapacitySizeBuckets{ 0 };
         size_t mTotalAllocatedSizeTree = 0;
         size_t mTotalCapacitySizeTree = 0;
     public:
@@ -1047,6 +1118,10 @@ namespace AZ {
         // in all cases memory is never automatically returned to the OS
         void purge()
         {
+#if defined(USE_THREAD_CACHES)
+            // Return cached elements first so their pages can be released
+            thread_cache_drain();
+#endif
             // Purge buckets first since they use tree pages
             bucket_purge();
             tree_purge();
@@ -1150,6 +1225,10 @@ namespace AZ {
         m_fixedBlock = desc.m_fixedMemoryBlock;
         m_fixedBlockSize = desc.m_fixedMemoryBlockByteSize;
         m_isPoolAllocations = desc.m_isPoolAllocations;
+        m_isThreadCaching = desc.m_isPoolAllocations && desc.m_isThreadCaching;
+#if defined(USE_THREAD_CACHES)
+        mAllocatorId = s_nextAllocatorId.fetch_add(1, AZStd::memory_order_relaxed);
+#endif
         if (desc.m_fixedMemoryBlock)
         {
             block_header* bl = tree_add_block(m_fixedBlock, m_fixedBlockSize);
@@ -1175,6 +1254,11 @@ namespace AZ {
 
     HpAllocator::~HpAllocator()
     {
+#if defined(USE_THREAD_CACHES)
+        // Return the cached elements first so they're not reported as leaks
+        thread_cache_destroy();
+#endif
+
 #ifdef DEBUG_ALLOCATOR
         // Check if there are not-freed allocations
         report();
@@ -1371,6 +1455,14 @@ namespace AZ {
     void* HpAllocator::bucket_alloc_direct(unsigned bi)
     {
         HPPA_ASSERT(bi < NUM_BUCKETS);
+#if defined(USE_THREAD_CACHES)
+        if (thread_cache* cache = thread_cache_acquire())
+        {
+            void* ptr = thread_cache_alloc(cache, bi);
+            thread_cache_release(cache);
+            return ptr;
+        }
+#endif
 #ifdef MULTITHREADED
     #if defined (USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1438,6 +1530,14 @@ namespace AZ {
         page* p = ptr_get_page(ptr);
         unsigned bi = p->bucket_index();
         HPPA_ASSERT(bi < NUM_BUCKETS);
+#if defined(USE_THREAD_CACHES)
+        if (thread_cache* cache = thread_cache_acquire())
+        {
+            thread_cache_free(cache, ptr, bi);
+            thread_cache_release(cache);
+            return;
+        }
+#endif
 #ifdef MULTITHREADED
     #if defined (USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1456,6 +1556,14 @@ namespace AZ {
         // if this asserts, the free size doesn't match the allocated size
         // most likely a class needs a base virtual destructor
         HPPA_ASSERT(bi == p->bucket_index());
+#if defined(USE_THREAD_CACHES)
+        if (thread_cache* cache = thread_cache_acquire())
+        {
+            thread_cache_free(cache, ptr, bi);
+            thread_cache_release(cache);
+            return;
+        }
+#endif
 #ifdef MULTITHREADED
     #if defined (USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1570,6 +1678,273 @@ namespace AZ {
         }
     }
 
+    unsigned HpAllocator::bucket_alloc_batch(unsigned bi, free_link*& head, unsigned count)
+    {
+        HPPA_ASSERT(bi < NUM_BUCKETS);
+#ifdef MULTITHREADED
+    #if defined (USE_MUTEX_PER_BUCKET)
+        AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
+    #else
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    #endif
+#endif
+        unsigned numAllocated = 0;
+        for (; numAllocated < count; ++numAllocated)
+        {
+            page* p = mBuckets[bi].get_free_page();
+            if (!p)
+            {
+                size_t bsize = bucket_spacing_function_inverse(bi);
+                p = bucket_grow(bsize, mBuckets[bi].marker());
+                if (!p)
+                {
+                    break;
+                }
+                mBuckets[bi].add_free_page(p);
+            }
+            free_link* element = (free_link*)mBuckets[bi].alloc(p);
+            element->mNext = head;
+            head = element;
+        }
+        return numAllocated;
+    }
+
+    void HpAllocator::bucket_free_batch(unsigned bi, free_link* head)
+    {
+        HPPA_ASSERT(bi < NUM_BUCKETS);
+#ifdef MULTITHREADED
+    #if defined (USE_MUTEX_PER_BUCKET)
+        AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
+    #else
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    #endif
+#endif
+        while (head)
+        {
+            free_link* next = head->mNext;
+            page* p = ptr_get_page(head);
+            HPPA_ASSERT(bi == p->bucket_index());
+            mBuckets[bi].free(p, head);
+            head = next;
+        }
+    }
+
+#if defined(USE_THREAD_CACHES)
+    AZ_THREAD_LOCAL HpAllocator::thread_cache_slot HpAllocator::s_threadCacheSlots[HpAllocator::NUM_THREAD_CACHE_SLOTS];
+    AZStd::atomic<size_t> HpAllocator::s_nextAllocatorId{ 1 };
+
+    HpAllocator::thread_cache* HpAllocator::thread_cache_acquire()
+    {
+        if (!m_isThreadCaching)
+        {
+            return nullptr;
+        }
+
+        thread_cache* cache = nullptr;
+        unsigned freeSlot = NUM_THREAD_CACHE_SLOTS;
+        for (unsigned i = 0; i < NUM_THREAD_CACHE_SLOTS; ++i)
+        {
+            if (s_threadCacheSlots[i].mAllocatorId == mAllocatorId)
+            {
+                cache = s_threadCacheSlots[i].mCache;
+                break;
+            }
+            if (s_threadCacheSlots[i].mAllocatorId == 0 && freeSlot == NUM_THREAD_CACHE_SLOTS)
+            {
+                freeSlot = i;
+            }
+        }
+
+        if (!cache)
+        {
+            if (freeSlot == NUM_THREAD_CACHE_SLOTS)
+            {
+                // this thread already has caches for the maximum number of allocators, fall back to the buckets
+                return nullptr;
+            }
+            cache = thread_cache_create();
+            if (!cache)
+            {
+                return nullptr;
+            }
+            s_threadCacheSlots[freeSlot].mAllocatorId = mAllocatorId;
+            s_threadCacheSlots[freeSlot].mCache = cache;
+        }
+
+        // this only fails if another thread is draining the cache during a purge
+        if (cache->mInUse.exchange(true, AZStd::memory_order_acquire))
+        {
+            return nullptr;
+        }
+        return cache;
+    }
+
+    void HpAllocator::thread_cache_release(thread_cache* cache)
+    {
+        cache->mInUse.store(false, AZStd::memory_order_release);
+    }
+
+    HpAllocator::thread_cache* HpAllocator::thread_cache_create()
+    {
+        void* mem;
+        {
+#ifdef MULTITHREADED
+            AZStd::lock_guard<AZStd::recursive_mutex> treeLock(mTreeMutex);
+#endif
+            mem = tree_alloc(sizeof(thread_cache));
+            if (!mem)
+            {
+                return nullptr;
+            }
+            // the caches are bookkeeping of the allocator and not reported as allocated memory
+            mTotalAllocatedSizeTree -= tree_ptr_size(mem);
+        }
+        thread_cache* cache = new (mem) thread_cache();
+
+        AZStd::lock_guard<AZStd::mutex> lock(mThreadCacheMutex);
+        cache->mNext = mThreadCaches;
+        mThreadCaches = cache;
+        return cache;
+    }
+
+    void* HpAllocator::thread_cache_alloc(thread_cache* cache, unsigned bi)
+    {
+        HPPA_ASSERT(bi < NUM_BUCKETS);
+        thread_cache::magazine& m = cache->mMagazines[bi];
+        if (!m.mHead)
+        {
+            m.mCount = bucket_alloc_batch(bi, m.mHead, thread_cache_capacity(bi) / 2);
+            if (!m.mHead)
+            {
+                return nullptr;
+            }
+        }
+
+        free_link* element = m.mHead;
+        m.mHead = element->mNext;
+        m.mCount--;
+        m.mLowWater = AZStd::GetMin(m.mLowWater, m.mCount);
+        mTotalAllocatedSizeBuckets.fetch_add(bucket_spacing_function_inverse(bi), AZStd::memory_order_relaxed);
+
+        if (++cache->mOperations >= THREAD_CACHE_REBALANCE_INTERVAL)
+        {
+            thread_cache_rebalance(cache);
+        }
+        return element;
+    }
+
+    void HpAllocator::thread_cache_free(thread_cache* cache, void* ptr, unsigned bi)
+    {
+        HPPA_ASSERT(bi < NUM_BUCKETS);
+        thread_cache::magazine& m = cache->mMagazines[bi];
+        free_link* element = (free_link*)ptr;
+        element->mNext = m.mHead;
+        m.mHead = element;
+        m.mCount++;
+        mTotalAllocatedSizeBuckets.fetch_sub(bucket_spacing_function_inverse(bi), AZStd::memory_order_relaxed);
+
+        const unsigned capacity = thread_cache_capacity(bi);
+        if (m.mCount > capacity)
+        {
+            thread_cache_flush(m, bi, capacity / 2);
+        }
+
+        if (++cache->mOperations >= THREAD_CACHE_REBALANCE_INTERVAL)
+        {
+            thread_cache_rebalance(cache);
+        }
+    }
+
+    void HpAllocator::thread_cache_flush(thread_cache::magazine& m, unsigned bi, unsigned count)
+    {
+        HPPA_ASSERT(count <= m.mCount);
+        if (count == 0)
+        {
+            return;
+        }
+
+        free_link* head = m.mHead;
+        free_link* last = head;
+        for (unsigned i = 1; i < count; ++i)
+        {
+            last = last->mNext;
+        }
+        m.mHead = last->mNext;
+        last->mNext = nullptr;
+        m.mCount -= count;
+        m.mLowWater = AZStd::GetMin(m.mLowWater, m.mCount);
+
+        bucket_free_batch(bi, head);
+    }
+
+    void HpAllocator::thread_cache_rebalance(thread_cache* cache)
+    {
+        // elements that stayed in the cache for the entire interval weren't needed, so return half of them to the
+        // buckets where other threads can use them
+        for (unsigned bi = 0; bi < NUM_BUCKETS; ++bi)
+        {
+            thread_cache::magazine& m = cache->mMagazines[bi];
+            thread_cache_flush(m, bi, (m.mLowWater + 1) / 2);
+            m.mLowWater = m.mCount;
+        }
+        cache->mOperations = 0;
+    }
+
+    void HpAllocator::thread_cache_drain()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(mThreadCacheMutex);
+        for (thread_cache* cache = mThreadCaches; cache; cache = cache->mNext)
+        {
+            // the owning thread only holds on to its cache for the duration of a single allocation or free
+            while (cache->mInUse.exchange(true, AZStd::memory_order_acquire))
+            {
+                AZStd::this_thread::yield();
+            }
+            for (unsigned bi = 0; bi < NUM_BUCKETS; ++bi)
+            {
+                thread_cache::magazine& m = cache->mMagazines[bi];
+                thread_cache_flush(m, bi, m.mCount);
+                m.mLowWater = 0;
+            }
+            cache->mInUse.store(false, AZStd::memory_order_release);
+        }
+    }
+
+    void HpAllocator::thread_cache_destroy()
+    {
+        thread_cache_drain();
+
+        AZStd::lock_guard<AZStd::mutex> lock(mThreadCacheMutex);
+        // other threads may still have a slot with this allocator's id, but as ids are never reused those slots won't
+        // be used again. only the slot of the calling thread can be cleared so it's available for new allocators.
+        for (unsigned i = 0; i < NUM_THREAD_CACHE_SLOTS; ++i)
+        {
+            if (s_threadCacheSlots[i].mAllocatorId == mAllocatorId)
+            {
+                s_threadCacheSlots[i].mAllocatorId = 0;
+                s_threadCacheSlots[i].mCache = nullptr;
+            }
+        }
+        m_isThreadCaching = false;
+
+        thread_cache* cache = mThreadCaches;
+        while (cache)
+        {
+            thread_cache* next = cache->mNext;
+            cache->~thread_cache();
+            {
+#ifdef MULTITHREADED
+                AZStd::lock_guard<AZStd::recursive_mutex> treeLock(mTreeMutex);
+#endif
+                mTotalAllocatedSizeTree += tree_ptr_size(cache);
+                tree_free(cache);
+            }
+            cache = next;
+        }
+        mThreadCaches = nullptr;
+    }
+#endif // USE_THREAD_CACHES
+
     void HpAllocator::split_block(block_header* bl, size_t size)
     {
         HPPA_ASSERT(size + sizeof(block_header) + sizeof(free_node) <= bl->size());
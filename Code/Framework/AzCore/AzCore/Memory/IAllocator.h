@@ -14,6 +14,7 @@ namespace AZ
     namespace Debug
     {
         class AllocationRecords;
+        class AllocationSampler;
         class MemoryDriller;
     }
 
@@ -184,6 +185,9 @@ namespace AZ
         /// Returns true if profiling calls will be made.
         virtual bool IsProfilingActive() const = 0;
 
+        /// Sets the sampler that allocations are reported to, independent of profiling. Set by the AllocatorManager, nullptr disables sampling.
+        virtual void SetAllocationSampler(Debug::AllocationSampler* sampler) = 0;
+
         /// All conforming allocators must call PostCreate() after their custom Create() method in order to be properly registered.
         virtual void PostCreate() = 0;
 
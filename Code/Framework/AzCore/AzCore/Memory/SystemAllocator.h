@@ -59,6 +59,7 @@ namespace AZ
                     : m_pageSize(m_defaultPageSize)
                     , m_poolPageSize(m_defaultPoolPageSize)
                     , m_isPoolAllocations(true)
+                    , m_isThreadCaching(true)
                     , m_numFixedMemoryBlocks(0)
                     , m_subAllocator(nullptr)
                     , m_systemChunkSize(0)
@@ -70,6 +71,7 @@ namespace AZ
                 unsigned int            m_pageSize;                                 ///< Page allocation size must be 1024 bytes aligned. (default m_defaultPageSize)
                 unsigned int            m_poolPageSize;                             ///< Page size used to small memory allocations. Must be less or equal to m_pageSize and a multiple of it. (default m_defaultPoolPageSize)
                 bool                    m_isPoolAllocations;                        ///< True (default) if we use pool for small allocations (< 256 bytes), otherwise false. IMPORTANT: Changing this to false will degrade performance!
+                bool                    m_isThreadCaching;                          ///< True (default) to keep small per thread caches of freed pool allocations so most small allocations don't need to lock. Only used when m_isPoolAllocations is true.
                 int                     m_numFixedMemoryBlocks;                     ///< Number of memory blocks to use.
                 void*                   m_fixedMemoryBlocks[m_maxNumFixedBlocks];   ///< Pointers to provided memory blocks or NULL if you want the system to allocate them for you with the System Allocator.
                 size_t                  m_fixedMemoryBlocksByteSize[m_maxNumFixedBlocks]; ///< Sizes of different memory blocks (MUST be multiple of m_pageSize), if m_memoryBlock is 0 the block will be allocated for you with the System Allocator.
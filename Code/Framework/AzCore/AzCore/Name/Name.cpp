@@ -33,6 +33,17 @@ namespace AZ
         *this = NameDictionary::Instance().FindName(hash);
     }
 
+    Name Name::FromStringLiteral(AZStd::string_view name, Hash hash)
+    {
+        if (name.empty())
+        {
+            return Name();
+        }
+
+        AZ_Assert(NameDictionary::IsReady(), "Attempted to initialize Name '%.*s' before the NameDictionary is ready.", AZ_STRING_ARG(name));
+        return NameDictionary::Instance().MakeName(name, hash);
+    }
+
     Name::Name(Internal::NameData* data)
         : m_data{data}
         , m_view{data->GetName()}
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzCore/Name/Internal/NameData.h>
+#include <AzCore/std/typetraits/integral_constant.h>
 
 namespace AZ
 {
@@ -26,6 +27,8 @@ namespace AZ
     //!
     //! The dictionary must be initialized before Name objects are created.
     //! A Name instance must not be statically declared.
+    //!
+    //! For names known at compile time, use AZ_NAME_LITERAL to calculate the hash at compile time.
     class Name
     {
         friend NameDictionary;
@@ -52,6 +55,18 @@ namespace AZ
         //! The hash will be used to find an existing name in the dictionary. If there is no
         //! name with this hash, the resulting name will be empty.
         explicit Name(Hash hash);
+
+        //! Creates an instance of a name from a string and its precomputed hash, which must match CalcHash(name).
+        //! Use AZ_NAME_LITERAL instead of calling this directly.
+        static Name FromStringLiteral(AZStd::string_view name, Hash hash);
+
+        //! Calculates the hash of a name string. Doesn't resolve hash collisions, that's handled by the NameDictionary.
+        static constexpr Hash CalcHash(AZStd::string_view name)
+        {
+            // AZStd::hash<AZStd::string_view> returns 64 bits but we want 32 bit hashes for the sake
+            // of network synchronization. So just take the low 32 bits.
+            return static_cast<Hash>(AZStd::hash<AZStd::string_view>()(name) & 0xFFFFFFFF);
+        }
         
         //! Assigns a new name.  
         //! The name string is used as a key to lookup an entry in the dictionary, and is not 
@@ -118,6 +133,11 @@ namespace AZ
 
 } // namespace AZ
 
+//! Creates an AZ::Name from a string literal with the hash calculated at compile time, so only the
+//! dictionary lookup is left at runtime. Use it for well known names that are looked up often.
+//! Example: const AZ::Name baseColor = AZ_NAME_LITERAL("baseColor");
+#define AZ_NAME_LITERAL(str) AZ::Name::FromStringLiteral(str, AZStd::integral_constant<AZ::Name::Hash, AZ::Name::CalcHash(str)>::value)
+
 namespace AZStd
 {
     template <typename T>
@@ -83,33 +83,59 @@ namespace AZ
     {
         bool leaksDetected = false;
 
-        for (const auto& keyValue : m_dictionary)
+        for (const Shard& shard : m_shards)
         {
-            Internal::NameData* nameData = keyValue.second;
-            const int useCount = keyValue.second->m_useCount;
-            const bool hadCollision = keyValue.second->m_hashCollision;
-
-            if (useCount == 0)
-            {
-                // Entries that had resolved hash collisions are allowed to remain in the dictionary until shutdown.
-                AZ_Assert(hadCollision, "Only colliding names are allowed to remain in the dictionary");
-                delete nameData;
-            }
-            else
+            for (const auto& keyValue : shard.m_dictionary)
             {
-                leaksDetected = true;
-                AZ_TracePrintf("NameDictionary", "\tLeaked Name [%3d reference(s)]: hash 0x%08X, '%.*s'\n", useCount, keyValue.first, AZ_STRING_ARG(keyValue.second->GetName()));
+                Internal::NameData* nameData = keyValue.second;
+                const int useCount = keyValue.second->m_useCount;
+                const bool hadCollision = keyValue.second->m_hashCollision;
+
+                if (useCount == 0)
+                {
+                    // Entries that had resolved hash collisions are allowed to remain in the dictionary until shutdown.
+                    AZ_Assert(hadCollision, "Only colliding names are allowed to remain in the dictionary");
+                    delete nameData;
+                }
+                else
+                {
+                    leaksDetected = true;
+                    AZ_TracePrintf("NameDictionary", "\tLeaked Name [%3d reference(s)]: hash 0x%08X, '%.*s'\n", useCount, keyValue.first, AZ_STRING_ARG(keyValue.second->GetName()));
+                }
             }
         }
 
         AZ_Assert(!leaksDetected, "AZ::NameDictionary still has active name references. See debug output for the list of leaked names.");
     }
 
+    NameDictionary::Shard& NameDictionary::GetShard(Name::Hash hash)
+    {
+        static_assert((ShardCount & (ShardCount - 1)) == 0, "ShardCount must be a power of two");
+        return m_shards[(hash >> 16) & (ShardCount - 1)];
+    }
+
+    const NameDictionary::Shard& NameDictionary::GetShard(Name::Hash hash) const
+    {
+        return m_shards[(hash >> 16) & (ShardCount - 1)];
+    }
+
+    size_t NameDictionary::GetEntryCount() const
+    {
+        size_t count = 0;
+        for (const Shard& shard : m_shards)
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(shard.m_sharedMutex);
+            count += shard.m_dictionary.size();
+        }
+        return count;
+    }
+
     Name NameDictionary::FindName(Name::Hash hash) const
     {
-        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
-        auto iter = m_dictionary.find(hash);
-        if (iter != m_dictionary.end())
+        const Shard& shard = GetShard(hash);
+        AZStd::shared_lock<AZStd::shared_mutex> lock(shard.m_sharedMutex);
+        auto iter = shard.m_dictionary.find(hash);
+        if (iter != shard.m_dictionary.end())
         {
             return Name(iter->second);
         }
@@ -124,7 +150,17 @@ namespace AZ
             return Name();
         }
 
-        Name::Hash hash = CalcHash(nameString);
+        return MakeName(nameString, CalcHash(nameString));
+    }
+
+    Name NameDictionary::MakeName(AZStd::string_view nameString, Name::Hash hash)
+    {
+        if (nameString.empty())
+        {
+            return Name();
+        }
+
+        AZ_Assert(hash == CalcHash(nameString), "Hash 0x%08X doesn't match name '%.*s'.", hash, AZ_STRING_ARG(nameString));
 
         // If we find the same name with the same hash, just return it. 
         // This path is faster than the loop below because FindName() takes a shared_lock whereas the
@@ -136,18 +172,19 @@ namespace AZ
         }
 
         // The name doesn't exist in the dictionary, so we have to lock and add it
-        AZStd::unique_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        Shard* shard = &GetShard(hash);
+        AZStd::unique_lock<AZStd::shared_mutex> lock(shard->m_sharedMutex);
 
-        auto iter = m_dictionary.find(hash);
+        auto iter = shard->m_dictionary.find(hash);
         bool collisionDetected = false;
         while (true)
         {
             // No existing entry, add a new one and we're done
-            if (iter == m_dictionary.end())
+            if (iter == shard->m_dictionary.end())
             {
                 Internal::NameData* nameData = aznew Internal::NameData(nameString, hash);
                 nameData->m_hashCollision = collisionDetected;
-                m_dictionary.emplace(hash, nameData);
+                shard->m_dictionary.emplace(hash, nameData);
                 return Name(nameData);
             }
             // Found the desired entry, return it
@@ -161,7 +198,17 @@ namespace AZ
                 collisionDetected = true;
                 iter->second->m_hashCollision = true; // Make sure the existing entry is flagged as colliding too
                 ++hash;
-                iter = m_dictionary.find(hash);
+
+                // The next hash can belong to another shard. Colliding entries are never removed, so every
+                // thread adding this name follows the same sequence and adds it in the same shard.
+                Shard* nextShard = &GetShard(hash);
+                if (nextShard != shard)
+                {
+                    lock.unlock();
+                    shard = nextShard;
+                    lock = AZStd::unique_lock<AZStd::shared_mutex>(shard->m_sharedMutex);
+                }
+                iter = shard->m_dictionary.find(hash);
             }
         }
     }
@@ -185,24 +232,27 @@ namespace AZ
             return;
         }
 
-        AZStd::unique_lock<AZStd::shared_mutex> lock(m_sharedMutex);
-
-        // Check m_hashCollision again inside the m_sharedMutex because a new collision could have happened
-        // on another thread before taking the lock.
-        if (nameData->m_hashCollision)
         {
-            return;
-        }
+            Shard& shard = GetShard(nameData->GetHash());
+            AZStd::unique_lock<AZStd::shared_mutex> lock(shard.m_sharedMutex);
 
-        // We need to check the count again in here in case
-        // someone was trying to get the name on another thread.
-        // Set it to -1 so only this thread will attempt to clean up the
-        // dictionary and delete the name.
-        int32_t expectedRefCount = 0;
-        if (nameData->m_useCount.compare_exchange_strong(expectedRefCount, -1))
-        {
-            m_dictionary.erase(nameData->GetHash());
-            delete nameData;
+            // Check m_hashCollision again inside the m_sharedMutex because a new collision could have happened
+            // on another thread before taking the lock.
+            if (nameData->m_hashCollision)
+            {
+                return;
+            }
+
+            // We need to check the count again in here in case
+            // someone was trying to get the name on another thread.
+            // Set it to -1 so only this thread will attempt to clean up the
+            // dictionary and delete the name.
+            int32_t expectedRefCount = 0;
+            if (nameData->m_useCount.compare_exchange_strong(expectedRefCount, -1))
+            {
+                shard.m_dictionary.erase(nameData->GetHash());
+                delete nameData;
+            }
         }
 
         ReportStats();
@@ -223,34 +273,46 @@ namespace AZ
             Internal::NameData* longestName = nullptr;
             Internal::NameData* mostRepeatedName = nullptr;
 
-            for (auto& iter : m_dictionary)
+            size_t nameCount = 0;
+
+            // Hold all locks so the reported entries can't be released while printing.
+            for (const Shard& shard : m_shards)
             {
-                const size_t nameLength = iter.second->m_name.size();
-                actualStringMemoryUsed += nameLength;
-                potentialStringMemoryUsed += (nameLength * iter.second->m_useCount);
+                shard.m_sharedMutex.lock_shared();
+            }
 
-                if (!longestName || longestName->m_name.size() < nameLength)
+            for (const Shard& shard : m_shards)
+            {
+                nameCount += shard.m_dictionary.size();
+                for (auto& iter : shard.m_dictionary)
                 {
-                    longestName = iter.second;
-                }
+                    const size_t nameLength = iter.second->m_name.size();
+                    actualStringMemoryUsed += nameLength;
+                    potentialStringMemoryUsed += (nameLength * iter.second->m_useCount);
 
-                if (!mostRepeatedName)
-                {
-                    mostRepeatedName = iter.second;
-                }
-                else
-                {
-                    const size_t mostIndividualSavings = mostRepeatedName->m_name.size() * (mostRepeatedName->m_useCount - 1);
-                    const size_t currentIndividualSavings = nameLength * (iter.second->m_useCount - 1);
-                    if (currentIndividualSavings > mostIndividualSavings)
+                    if (!longestName || longestName->m_name.size() < nameLength)
+                    {
+                        longestName = iter.second;
+                    }
+
+                    if (!mostRepeatedName)
                     {
                         mostRepeatedName = iter.second;
                     }
+                    else
+                    {
+                        const size_t mostIndividualSavings = mostRepeatedName->m_name.size() * (mostRepeatedName->m_useCount - 1);
+                        const size_t currentIndividualSavings = nameLength * (iter.second->m_useCount - 1);
+                        if (currentIndividualSavings > mostIndividualSavings)
+                        {
+                            mostRepeatedName = iter.second;
+                        }
+                    }
                 }
             }
 
             AZ_TracePrintf("NameDictionary", "NameDictionary Stats\n");
-            AZ_TracePrintf("NameDictionary", "Names:              %d\n", m_dictionary.size());
+            AZ_TracePrintf("NameDictionary", "Names:              %d\n", nameCount);
             AZ_TracePrintf("NameDictionary", "Total chars:        %d\n", actualStringMemoryUsed);
             AZ_TracePrintf("NameDictionary", "Logical chars:      %d\n", potentialStringMemoryUsed);
             AZ_TracePrintf("NameDictionary", "Memory saved:       %d\n", potentialStringMemoryUsed - actualStringMemoryUsed);
@@ -267,17 +329,14 @@ namespace AZ
                 AZ_TracePrintf("NameDictionary", "Most repeated name count:  %d\n", refCount);
             }
 
+            for (const Shard& shard : m_shards)
+            {
+                shard.m_sharedMutex.unlock_shared();
+            }
+
             reportUsage = false;
         }
 
 #endif // AZ_DEBUG_BUILD
     }
-
-    Name::Hash NameDictionary::CalcHash(AZStd::string_view name)
-    {
-        // AZStd::hash<AZStd::string_view> returns 64 bits but we want 32 bit hashes for the sake
-        // of network synchronization. So just take the low 32 bits.
-        const uint32_t hash = AZStd::hash<AZStd::string_view>()(name) & 0xFFFFFFFF;
-        return hash;
-    }
 }
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/string/string_view.h>
@@ -43,6 +44,10 @@ namespace AZ
     //! Benchmarks have shown that creating a new Name object can be quite slow when the name doesn't 
     //! already exist in the NameDictionary, but is comparable to creating an AZStd::string for names 
     //! that already exist.
+    //!
+    //! The entries are split into shards by hash, each with its own lock, so threads creating names
+    //! rarely wait on each other. Use AZ_NAME_LITERAL for names known at compile time to also skip
+    //! hashing the string.
     class NameDictionary final
     {
         AZ_CLASS_ALLOCATOR(NameDictionary, AZ::OSAllocator, 0);
@@ -67,17 +72,41 @@ namespace AZ
         //! @return A Name instance holding a dictionary entry associated with the provided raw string.
         Name MakeName(AZStd::string_view name);
 
+        //! Makes a Name from the provided raw string and its hash, which must be Name::CalcHash(name).
+        //! This skips hashing the string, see AZ_NAME_LITERAL.
+        //! 
+        //! @param name The name to resolve against the dictionary.
+        //! @param hash The hash of the name.
+        //! @return A Name instance holding a dictionary entry associated with the provided raw string.
+        Name MakeName(AZStd::string_view name, Name::Hash hash);
+
         //! Search for an existing name in the dictionary by hash.
         //! @param hash The key by which to search for the name.
         //! @return A Name instance. If the hash was not found, the Name will be empty.
         Name FindName(Name::Hash hash) const;
 
     private:
+        //! Number of independently locked parts of the dictionary, must be a power of two.
+        static constexpr size_t ShardCount = 16;
+
+        struct Shard
+        {
+            AZStd::unordered_map<Name::Hash, Internal::NameData*> m_dictionary;
+            mutable AZStd::shared_mutex m_sharedMutex;
+        };
+
         NameDictionary();
         ~NameDictionary();
 
         void ReportStats() const;
 
+        // The shard is selected with the upper bits of the hash, so the linear probing used for
+        // hash collisions almost always stays in the same shard.
+        Shard& GetShard(Name::Hash hash);
+        const Shard& GetShard(Name::Hash hash) const;
+
+        size_t GetEntryCount() const;
+
         //////////////////////////////////////////////////////////////////////////
         // Private API for NameData
 
@@ -89,9 +118,11 @@ namespace AZ
 
         // Calculates a hash for the provided name string.
         // Does not attempt to resolve hash collisions; that is handled elsewhere.
-        Name::Hash CalcHash(AZStd::string_view name);
-                
-        AZStd::unordered_map<Name::Hash, Internal::NameData*> m_dictionary;
-        mutable AZStd::shared_mutex m_sharedMutex;
+        static constexpr Name::Hash CalcHash(AZStd::string_view name)
+        {
+            return Name::CalcHash(name);
+        }
+
+        AZStd::array<Shard, ShardCount> m_shards;
     };
 }
@@ -15,6 +15,7 @@
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/Script/lua/lua.h>
 #include <AzCore/IO/GenericStreams.h>
+#include <AzCore/Memory/PoolSchema.h>
 #include <AzCore/RTTI/AttributeReader.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 
@@ -1449,29 +1450,116 @@ using namespace AZ;
         _varName = "?";                                                       \
         }
 
+// Strings, tables, closures and most userdata fit in this size, and make up most of the allocations of a Lua VM
+#define LUA_SMALL_OBJECT_MAX_SIZE 128
+
+//=========================================================================
+// What the Lua memory hook of a context allocates from, and what it counts
+//=========================================================================
+struct LuaMemoryState
+{
+    IAllocatorAllocate* m_allocator = nullptr;
+    PoolSchema* m_smallObjectAllocator = nullptr; ///< Optional, small objects go to the allocator when not set
+    ScriptContext::MemoryStatistics m_statistics;
+
+    bool IsSmallObject(size_t size) const
+    {
+        return m_smallObjectAllocator && size <= LUA_SMALL_OBJECT_MAX_SIZE;
+    }
+
+    void* Allocate(size_t size)
+    {
+        void* address = IsSmallObject(size) ? m_smallObjectAllocator->Allocate(size, LUA_DEFAULT_ALIGNMENT, 0, "Script", __FILE__, __LINE__, 1)
+                                            : m_allocator->Allocate(size, LUA_DEFAULT_ALIGNMENT, 0, "Script", __FILE__, __LINE__, 1);
+        if (address)
+        {
+            OnAllocated(size);
+        }
+        return address;
+    }
+
+    void DeAllocate(void* address, size_t size)
+    {
+        if (IsSmallObject(size))
+        {
+            m_smallObjectAllocator->DeAllocate(address);
+        }
+        else
+        {
+            m_allocator->DeAllocate(address);
+        }
+        OnDeAllocated(size);
+    }
+
+    void* ReAllocate(void* address, size_t oldSize, size_t newSize)
+    {
+        if (!IsSmallObject(oldSize) && !IsSmallObject(newSize))
+        {
+            void* newAddress = m_allocator->ReAllocate(address, newSize, LUA_DEFAULT_ALIGNMENT);
+            if (newAddress)
+            {
+                OnDeAllocated(oldSize);
+                OnAllocated(newSize);
+            }
+            return newAddress;
+        }
+
+        // the pool can't resize blocks, move them unless they stay in the same bucket
+        if (IsSmallObject(oldSize) && IsSmallObject(newSize) && AZ::SizeAlignUp(oldSize, LUA_DEFAULT_ALIGNMENT) == AZ::SizeAlignUp(newSize, LUA_DEFAULT_ALIGNMENT))
+        {
+            OnDeAllocated(oldSize);
+            OnAllocated(newSize);
+            return address;
+        }
+
+        void* newAddress = Allocate(newSize);
+        if (newAddress)
+        {
+            memcpy(newAddress, address, AZStd::GetMin(oldSize, newSize));
+            DeAllocate(address, oldSize);
+        }
+        return newAddress; // on failure Lua expects the old block to be left as it is
+    }
+
+    void OnAllocated(size_t size)
+    {
+        m_statistics.m_usedBytes += size;
+        m_statistics.m_peakUsedBytes = AZStd::GetMax(m_statistics.m_peakUsedBytes, m_statistics.m_usedBytes);
+        m_statistics.m_smallObjectBytes += IsSmallObject(size) ? size : 0;
+        ++m_statistics.m_numAllocations;
+        m_statistics.m_allocatedBytes += size;
+    }
+
+    void OnDeAllocated(size_t size)
+    {
+        m_statistics.m_usedBytes -= size;
+        m_statistics.m_smallObjectBytes -= IsSmallObject(size) ? size : 0;
+    }
+};
+
 //=========================================================================
 // Lua Memory manager hook
 // [3/19/2012]
 //=========================================================================
 static void* LuaMemoryHook(void* userData, void* ptr, size_t osize, size_t nsize)
 {
-    (void)osize;
-    IAllocatorAllocate* allocator = reinterpret_cast<IAllocatorAllocate*>(userData);
+    // osize is the size of the block when ptr is set, otherwise it is the type of the object that is allocated
+    LuaMemoryState* memoryState = reinterpret_cast<LuaMemoryState*>(userData);
     if (nsize == 0)
     {
         if (ptr)
         {
-            allocator->DeAllocate(ptr);
+            memoryState->DeAllocate(ptr, osize);
         }
         return NULL;
     }
     else if (ptr == NULL)
     {
-        return allocator->Allocate(nsize, LUA_DEFAULT_ALIGNMENT, 0, "Script", __FILE__, __LINE__, 1);
+        return memoryState->Allocate(nsize);
     }
     else
     {
-        return allocator->ReAllocate(ptr, nsize, LUA_DEFAULT_ALIGNMENT);
+        return memoryState->ReAllocate(ptr, osize, nsize);
     }
 }
 
@@ -3402,8 +3490,13 @@ LUA_API const Node* lua_getDummyNode()
             {
                 (void)context;
                 m_method = method;
+                m_numArguments = static_cast<int>(m_method->GetNumArguments());
+                m_minNumArguments = static_cast<int>(m_method->GetMinNumberOfArguments());
+
+                // the arguments and the result of the native call need to fit in its fixed storage
+                bool isNativeCall = m_numArguments <= NativeCallMaxArguments;
 
-                for (int iArg = 0; iArg < static_cast<int>(m_method->GetNumArguments()); ++iArg)
+                for (int iArg = 0; iArg < m_numArguments; ++iArg)
                 {
                     const BehaviorParameter* arg = method->GetArgument(iArg);
                     BehaviorClass* argClass = nullptr;
@@ -3411,21 +3504,27 @@ LUA_API const Node* lua_getDummyNode()
                     AZ_Assert(fromStack, "Argument %s for Method %s doesn't have support to be converted to Lua!", arg->m_name, method->m_name.c_str());
 
                     m_fromLua.push_back(AZStd::make_pair(fromStack, argClass));
+                    isNativeCall = isNativeCall && IsNativeValue(*arg, argClass);
                 }
 
                 if (method->HasResult())
                 {
                     m_resultToLua = ToLuaStack(context, method->GetResult(), &m_prepareResult, m_resultClass);
+                    isNativeCall = isNativeCall && IsNativeValue(*method->GetResult(), m_resultClass)
+                        && (method->GetResult()->m_traits & BehaviorParameter::TR_REFERENCE) == 0;
                 }
                 else
                 {
                     m_resultToLua = nullptr;
                 }
+
+                // the thunk is picked once here, instead of working out what each call needs every time it's made
+                m_call = isNativeCall ? &LuaScriptCaller::CallNative : &LuaScriptCaller::Call;
             }
 
             int ManualCall(lua_State* lua) override
             {
-                return Call(lua);
+                return m_call(lua);
             }
 
             void PushClosure(lua_State* lua, const char* debugDescription) override
@@ -3435,7 +3534,114 @@ LUA_API const Node* lua_getDummyNode()
                 lua_pushlightuserdata(lua, this); // if there is no reason to keep the data in the "methods" we can use full user data and rely on __gc to clean it
                 lua_pushstring(lua, debugDescription);
                 lua_pushcclosure(lua, &Internal::LuaMethodTagHelper, 0);
-                lua_pushcclosure(lua, &LuaScriptCaller::Call, 3);
+                lua_pushcclosure(lua, m_call, 3);
+            }
+
+            static bool CheckNumArguments(lua_State* lua, LuaScriptCaller* thisPtr, int numElementsOnStack)
+            {
+                if (numElementsOnStack < thisPtr->m_minNumArguments)
+                {
+                    // we can here load default parameters 
+                    ScriptContext::FromNativeContext(lua)->Error(ScriptContext::ErrorType::Error, true, "Not enough arguments for %s(%s) method, we expected %d arguments (left to right), provided %d!", thisPtr->m_method->m_name.c_str(), lua_tostring(lua, lua_upvalueindex(2)), thisPtr->m_minNumArguments, numElementsOnStack);
+                    return false;
+                }
+
+                return true;
+            }
+
+            //! Numbers and booleans, by value or by reference, which Lua reads and writes without temporary storage or destructors.
+            static bool IsNativeValue(const BehaviorParameter& parameter, BehaviorClass* parameterClass)
+            {
+                if (parameterClass || (parameter.m_traits & BehaviorParameter::TR_POINTER))
+                {
+                    return false;
+                }
+
+                const AZ::Uuid& typeId = parameter.m_typeId;
+                return typeId == AzTypeInfo<bool>::Uuid()
+                    || typeId == AzTypeInfo<char>::Uuid()
+                    || typeId == AzTypeInfo<AZ::s8>::Uuid()
+                    || typeId == AzTypeInfo<short>::Uuid()
+                    || typeId == AzTypeInfo<int>::Uuid()
+                    || typeId == AzTypeInfo<long>::Uuid()
+                    || typeId == AzTypeInfo<AZ::s64>::Uuid()
+                    || typeId == AzTypeInfo<unsigned char>::Uuid()
+                    || typeId == AzTypeInfo<unsigned short>::Uuid()
+                    || typeId == AzTypeInfo<unsigned int>::Uuid()
+                    || typeId == AzTypeInfo<unsigned long>::Uuid()
+                    || typeId == AzTypeInfo<AZ::u64>::Uuid()
+                    || typeId == AzTypeInfo<float>::Uuid()
+                    || typeId == AzTypeInfo<double>::Uuid();
+            }
+
+            //! Pushes the result when the method assigns it, which EBus events do once per handler, and not at all without one.
+            //! The AZStd::function calling it only captures a pointer to it, so it fits in the small object buffer of the function,
+            //! instead of being allocated on every call.
+            struct ResultToLua
+            {
+                lua_State* m_lua;
+                LuaScriptCaller* m_caller;
+                BehaviorValueParameter* m_result;
+                int m_numResults = 0;
+
+                void operator()()
+                {
+                    if (m_result->m_value)
+                    {
+                        m_caller->m_resultToLua(m_lua, *m_result);
+                        ++m_numResults;
+                    }
+                }
+            };
+
+            //! Calls methods that only take and return native values. Their arguments and result live in fixed storage on the stack,
+            //! which skips the temporary allocators and the destructor passes of Call.
+            static int CallNative(lua_State* lua)
+            {
+                LuaScriptCaller* thisPtr = reinterpret_cast<LuaScriptCaller*>(lua_touserdata(lua, lua_upvalueindex(1)));
+
+                int numElementsOnStack = lua_gettop(lua);
+                if (!CheckNumArguments(lua, thisPtr, numElementsOnStack))
+                {
+                    return 0;
+                }
+
+                using NativeValueStorage = AZStd::aligned_storage_t<sizeof(AZ::u64), alignof(AZ::u64)>;
+                BehaviorValueParameter arguments[NativeCallMaxArguments];
+                NativeValueStorage argumentValues[NativeCallMaxArguments];
+                BehaviorValueParameter result;
+                NativeValueStorage resultValue;
+
+                const int numArguments = GetMin(thisPtr->m_numArguments, numElementsOnStack);
+                for (int i = 0; i < numArguments; ++i)
+                {
+                    arguments[i].Set(*thisPtr->m_method->GetArgument(i));
+                    arguments[i].m_value = &argumentValues[i];
+                    // reading native values can't fail, they are converted the same way lua_tonumber converts them
+                    thisPtr->m_fromLua[i].first(lua, i + 1, arguments[i], nullptr, nullptr);
+                }
+
+                ResultToLua resultToLua{ lua, thisPtr, &result };
+                if (thisPtr->m_resultToLua)
+                {
+                    result.Set(*thisPtr->m_method->GetResult());
+                    memset(&resultValue, 0, sizeof(resultValue));
+                    result.m_value = &resultValue;
+                    result.m_onAssignedResult = [resultToLuaPtr = &resultToLua]() { (*resultToLuaPtr)(); };
+                }
+
+                if (!thisPtr->m_method->Call(arguments, numArguments, thisPtr->m_resultToLua ? &result : nullptr))
+                {
+                    ScriptContext::FromNativeContext(lua)->Error(ScriptContext::ErrorType::Error, true, "Lua failed to call %s method!", thisPtr->m_method->m_name.c_str());
+                }
+
+                if (thisPtr->m_resultToLua && resultToLua.m_numResults == 0)
+                {
+                    lua_pushnil(lua);
+                    ++resultToLua.m_numResults;
+                }
+
+                return resultToLua.m_numResults;
             }
 
             static int Call(lua_State* lua)
@@ -3444,10 +3650,8 @@ LUA_API const Node* lua_getDummyNode()
 
                 // check number of arguments
                 int numElementsOnStack = lua_gettop(lua);
-                if (numElementsOnStack < static_cast<int>(thisPtr->m_method->GetMinNumberOfArguments()))
+                if (!CheckNumArguments(lua, thisPtr, numElementsOnStack))
                 {
-                    // we can here load default parameters 
-                    ScriptContext::FromNativeContext(lua)->Error(ScriptContext::ErrorType::Error, true, "Not enough arguments for %s(%s) method, we expected %d arguments (left to right), provided %d!", thisPtr->m_method->m_name.c_str(), lua_tostring(lua, lua_upvalueindex(2)), thisPtr->m_method->GetMinNumberOfArguments(), numElementsOnStack);
                     return 0;
                 }
 
@@ -3459,7 +3663,7 @@ LUA_API const Node* lua_getDummyNode()
                 AZStd::allocator backupAllocator;
                 bool usedBackupAlloc  = false;
 
-                int numArguments = GetMin(static_cast<int>(thisPtr->m_method->GetNumArguments()), numElementsOnStack);
+                int numArguments = GetMin(thisPtr->m_numArguments, numElementsOnStack);
                 AZ_Assert(static_cast<int>(AZ_ARRAY_SIZE(arguments)) >= numArguments, "Increase the argument array size!");
 
                 // for each argument read a variable from the stack to a BehaviorValueParameter
@@ -3482,7 +3686,9 @@ LUA_API const Node* lua_getDummyNode()
                     ScriptContext::FromNativeContext(lua)->Error(ScriptContext::ErrorType::Error, true, "Cannot pass nil as 'this' ptr to member function %s.", thisPtr->m_method->m_name.c_str());
                     return 0;
                 }
-                int numResults = 0;
+
+                ResultToLua resultToLua{ lua, thisPtr, &result };
+                int& numResults = resultToLua.m_numResults;
 
                 if (thisPtr->m_resultToLua)
                 {
@@ -3493,15 +3699,7 @@ LUA_API const Node* lua_getDummyNode()
                         usedBackupAlloc  = thisPtr->m_prepareResult(result, thisPtr->m_resultClass, tempData, &backupAllocator); // pass temp memory and class info
                     }
 
-                    // TODO: Make it optional for EBuses only, make it light weight too, probably a virtual function for the store result.
-                    result.m_onAssignedResult = AZStd::function<void()>([&]()
-                    {
-                        if (result.m_value)
-                        {
-                            thisPtr->m_resultToLua(lua, result);
-                            ++numResults;
-                        }
-                    });
+                    result.m_onAssignedResult = [resultToLuaPtr = &resultToLua]() { (*resultToLuaPtr)(); };
                 }
 
                 bool isCalled = thisPtr->m_method->Call(arguments, numArguments, thisPtr->m_resultToLua ? &result : nullptr);
@@ -3560,10 +3758,15 @@ LUA_API const Node* lua_getDummyNode()
                 return numResults;
             }
 
+            static constexpr int NativeCallMaxArguments = 8;
+
             AZStd::vector<AZStd::pair<LuaLoadFromStack, BehaviorClass*>> m_fromLua;
             LuaPushToStack m_resultToLua;
             LuaPrepareValue m_prepareResult;
             BehaviorClass* m_resultClass;
+            lua_CFunction m_call;
+            int m_numArguments;
+            int m_minNumArguments;
 
             bool m_isResult;
         };
@@ -4309,8 +4512,18 @@ LUA_API const Node* lua_getDummyNode()
                         desc.m_heap.m_systemChunkSize = 1024 * 1024;
                         m_luaAllocator.Create(desc);
                         allocator = m_luaAllocator.Get();
-                    }
-                    m_lua = lua_newstate(&LuaMemoryHook, allocator);
+
+                        // the small objects are pooled, the VM runs on one thread at a time so the pool doesn't need to be thread safe
+                        PoolSchema::Descriptor poolDesc;
+                        poolDesc.m_pageSize = 64 * 1024;
+                        poolDesc.m_minAllocationSize = LUA_DEFAULT_ALIGNMENT;
+                        poolDesc.m_maxAllocationSize = LUA_SMALL_OBJECT_MAX_SIZE;
+                        poolDesc.m_pageAllocator = allocator;
+                        m_smallObjectAllocator.Create(poolDesc);
+                        m_memoryState.m_smallObjectAllocator = &m_smallObjectAllocator;
+                    }
+                    m_memoryState.m_allocator = allocator;
+                    m_lua = lua_newstate(&LuaMemoryHook, &m_memoryState);
                     AZ_Assert(m_lua, "Failed to create new LUA state!");
                 }
 
@@ -4422,6 +4635,11 @@ LUA_API const Node* lua_getDummyNode()
                     lua_pop(m_lua, 1);
                     lua_close(m_lua);
                 }
+
+                if (m_memoryState.m_smallObjectAllocator)
+                {
+                    m_smallObjectAllocator.Destroy();
+                }
             }
 
             //////////////////////////////////////////////////////////////////////////
@@ -5803,6 +6021,8 @@ LUA_API const Node* lua_getDummyNode()
             AZStd::vector< ScriptTypeFactory >  m_scriptPropertyArrayFactories;
             ScriptTypeFactory                   m_scriptPropertyTableFactory;
             AllocatorWrapper<Internal::LuaSystemAllocator> m_luaAllocator;
+            PoolSchema m_smallObjectAllocator;
+            LuaMemoryState m_memoryState;
             AZStd::thread::id m_ownerThreadId; // Check if Lua methods (including EBus handlers) are called from background threads.
         };
     } // namespace AZ
@@ -5845,9 +6065,22 @@ LUA_API const Node* lua_getDummyNode()
     }
 
     //////////////////////////////////////////////////////////////////////////
-    void ScriptContext::GarbageCollectStep(int numberOfSteps)
+    bool ScriptContext::GarbageCollectStep(int numberOfSteps)
+    {
+        return lua_gc(m_impl->m_lua, LUA_GCSTEP, numberOfSteps) != 0;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    void ScriptContext::SetGarbageCollectorParameters(int pause, int stepMultiplier)
+    {
+        lua_gc(m_impl->m_lua, LUA_GCSETPAUSE, pause);
+        lua_gc(m_impl->m_lua, LUA_GCSETSTEPMUL, stepMultiplier);
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    const ScriptContext::MemoryStatistics& ScriptContext::GetMemoryStatistics() const
     {
-        lua_gc(m_impl->m_lua, LUA_GCSTEP, numberOfSteps);
+        return m_impl->m_memoryState.m_statistics;
     }
 
     //////////////////////////////////////////////////////////////////////////
@@ -861,8 +861,28 @@ namespace AZ
         /**
          *  Step the garbage collector. There is no exact number that works in all cases, tune this number for optimal 
          * performance in your app.
+         * eturns true if the step finished a collection cycle.
          */ 
-        void GarbageCollectStep(int numberOfSteps = 2);
+        bool GarbageCollectStep(int numberOfSteps = 2);
+
+        /**
+         * Tunes the incremental garbage collector, see the Lua manual for the details.
+         * \param pause             how much the memory grows, in percent, before a new collection cycle starts (Lua default is 200).
+         * \param stepMultiplier    how much work each step does relative to the memory allocated, in percent (Lua default is 200).
+         */
+        void SetGarbageCollectorParameters(int pause, int stepMultiplier);
+
+        /// Allocations made by the Lua VM of this context. Contexts that run on a custom Lua VM don't track them.
+        struct MemoryStatistics
+        {
+            size_t m_usedBytes = 0; ///< Memory in use right now.
+            size_t m_peakUsedBytes = 0;
+            size_t m_smallObjectBytes = 0; ///< The part of the memory in use that comes from the small object pool.
+            AZ::u64 m_numAllocations = 0; ///< Number of blocks allocated since the context was created.
+            AZ::u64 m_allocatedBytes = 0; ///< Bytes allocated since the context was created, the difference between two frames is the allocation rate.
+        };
+
+        const MemoryStatistics& GetMemoryStatistics() const;
 
         lua_State* NativeContext();
 
@@ -16,6 +16,7 @@
 #include <AzCore/Component/ComponentApplication.h>
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/TraceReflection.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/Math/MathReflection.h>
@@ -26,6 +27,7 @@
 #include <AzCore/Script/ScriptContextDebug.h>
 #include <AzCore/Script/ScriptDebug.h>
 
+#include <AzCore/std/chrono/clocks.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/Script/lua/lua.h>
 
@@ -42,6 +44,14 @@ using namespace AZ;
  *      If the script was loaded by a ScriptComponent, Load will be called once reload is complete.
  */
 
+AZ_CVAR(int, script_gcFrameBudgetUs, 1000, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Time in microseconds the garbage collector of each script context may take per frame, to keep up with what the scripts "
+    "allocated since the last frame. 0 runs a single step of the configured size per frame.");
+AZ_CVAR(int, script_gcPause, 200, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "How much memory grows, in percent, before the garbage collector of a Lua context starts a new cycle. Applies to contexts added afterwards.");
+AZ_CVAR(int, script_gcStepMultiplier, 200, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "How much work each garbage collector step does relative to the memory allocated, in percent. Applies to contexts added afterwards.");
+
 namespace
 {
     // Called when a module has already been loaded
@@ -142,6 +152,7 @@ ScriptContext*  ScriptSystemComponent::AddContext(ScriptContext* context, int ga
         cc.m_context = context;
         cc.m_isOwner = false;
         cc.m_garbageCollectorSteps = garbageCollectorStep < 1 ? m_defaultGarbageCollectorSteps : garbageCollectorStep;
+        context->SetGarbageCollectorParameters(script_gcPause, script_gcStepMultiplier);
 
         if (context->GetId() != ScriptContextIds::CryScriptContextId)
         {
@@ -173,6 +184,7 @@ ScriptContext* ScriptSystemComponent::AddContextWithId(ScriptContextId id)
         cc.m_context = aznew ScriptContext(id);
         cc.m_isOwner = true;
         cc.m_garbageCollectorSteps = m_defaultGarbageCollectorSteps;
+        cc.m_context->SetGarbageCollectorParameters(script_gcPause, script_gcStepMultiplier);
 
         cc.m_context->SetRequireHook(AZStd::bind(&ScriptSystemComponent::DefaultRequireHook, this, AZStd::placeholders::_1, AZStd::placeholders::_2, AZStd::placeholders::_3));
 
@@ -294,7 +306,38 @@ void    ScriptSystemComponent::OnSystemTick()
         }
 #endif // AZ_PROFILE_TELEMETRY
 
-        contextContainer.m_context->GarbageCollectStep(contextContainer.m_garbageCollectorSteps);
+        StepGarbageCollector(contextContainer);
+    }
+}
+
+//=========================================================================
+// StepGarbageCollector
+//=========================================================================
+void ScriptSystemComponent::StepGarbageCollector(ContextContainer& contextContainer)
+{
+    ScriptContext* context = contextContainer.m_context;
+    const int stepSize = contextContainer.m_garbageCollectorSteps;
+    const int budgetUs = script_gcFrameBudgetUs;
+    if (budgetUs <= 0)
+    {
+        context->GarbageCollectStep(stepSize);
+        return;
+    }
+
+    // Keep pace with the allocation rate: collect as many kilobytes as the scripts allocated since the last frame, in steps of the configured
+    // size, until the cycle finishes or the budget runs out. Frames that don't allocate much still take one step.
+    const AZ::u64 allocatedBytes = context->GetMemoryStatistics().m_allocatedBytes;
+    const AZ::s64 allocatedKB = static_cast<AZ::s64>((allocatedBytes - contextContainer.m_allocatedBytesAtLastStep) / 1024);
+    contextContainer.m_allocatedBytesAtLastStep = allocatedBytes;
+
+    const auto deadline = AZStd::chrono::high_resolution_clock::now() + AZStd::chrono::microseconds(budgetUs);
+    const AZ::s64 stepKB = AZStd::GetMax(stepSize, 1);
+    for (AZ::s64 remainingKB = AZStd::GetMax(allocatedKB, stepKB); remainingKB > 0; remainingKB -= stepKB)
+    {
+        if (context->GarbageCollectStep(stepSize) || AZStd::chrono::high_resolution_clock::now() >= deadline)
+        {
+            break;
+        }
     }
 }
 
@@ -130,6 +130,7 @@ namespace AZ
             ScriptContext* m_context = nullptr;
             bool m_isOwner = true;
             int m_garbageCollectorSteps = 0;
+            AZ::u64 m_allocatedBytesAtLastStep = 0;
             AZStd::unordered_map<Uuid, LoadedScriptInfo> m_loadedScripts;
             AZStd::recursive_mutex m_loadedScriptsMutex;
 
@@ -146,6 +147,7 @@ namespace AZ
                 m_context = rhs.m_context;
                 m_isOwner = rhs.m_isOwner;
                 m_garbageCollectorSteps = rhs.m_garbageCollectorSteps;
+                m_allocatedBytesAtLastStep = rhs.m_allocatedBytesAtLastStep;
 
                 {
                     AZStd::lock_guard<AZStd::recursive_mutex> myLock(m_loadedScriptsMutex);
@@ -159,6 +161,9 @@ namespace AZ
 
         ContextContainer*       GetContextContainer(ScriptContextId id);
 
+        /// Steps the garbage collector of the context within the per frame budget of script_gcFrameBudgetUs.
+        void StepGarbageCollector(ContextContainer& contextContainer);
+
         /// Default require hook installed on new contexts, looks for a compiled asset in the asset system corresponding to the module path and name.
         /// If found, loads the module if not done previously, leaves it on the stack, otherwise pushes string error.
         /// Additionally connects to the script id to reload the script if the script changes
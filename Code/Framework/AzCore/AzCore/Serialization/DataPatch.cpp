@@ -19,6 +19,7 @@
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/Math/MathUtils.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 
 namespace AZ
 {
@@ -1686,6 +1687,25 @@ namespace AZ
         return flags;
     }
 
+    struct DataPatch::PreparedPatch
+    {
+        SerializeContext* m_context = nullptr;
+        PatchMap m_patch;
+        ChildPatchMap m_childPatchMap;
+    };
+
+    /**
+     * Drops the prepared patch when a data patch is loaded in place, since its patch is replaced.
+     */
+    class DataPatchSerializationEvents
+        : public SerializeContext::IEventHandler
+    {
+        void OnWriteBegin(void* classPtr) override
+        {
+            reinterpret_cast<DataPatch*>(classPtr)->ResetPreparedPatch();
+        }
+    };
+
     //=========================================================================
     // DataPatch
     //=========================================================================
@@ -1703,6 +1723,10 @@ namespace AZ
         m_patch = rhs.m_patch;
         m_targetClassId = rhs.m_targetClassId;
         m_targetClassVersion = rhs.m_targetClassVersion;
+
+        // The copy has the same patch, so it can share the prepared patch.
+        AZStd::lock_guard<AZStd::mutex> lock(rhs.m_preparedPatchMutex);
+        m_preparedPatch = rhs.m_preparedPatch;
     }
 
     //=========================================================================
@@ -1713,6 +1737,9 @@ namespace AZ
         m_patch = AZStd::move(rhs.m_patch);
         m_targetClassId = AZStd::move(rhs.m_targetClassId);
         m_targetClassVersion = AZStd::move(rhs.m_targetClassVersion);
+
+        AZStd::lock_guard<AZStd::mutex> lock(rhs.m_preparedPatchMutex);
+        m_preparedPatch = AZStd::move(rhs.m_preparedPatch);
     }
 
     //=========================================================================
@@ -1723,6 +1750,14 @@ namespace AZ
         m_patch = AZStd::move(rhs.m_patch);
         m_targetClassId = AZStd::move(rhs.m_targetClassId);
         m_targetClassVersion = AZStd::move(rhs.m_targetClassVersion);
+
+        AZStd::shared_ptr<PreparedPatch> preparedPatch;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(rhs.m_preparedPatchMutex);
+            preparedPatch = AZStd::move(rhs.m_preparedPatch);
+        }
+        AZStd::lock_guard<AZStd::mutex> lock(m_preparedPatchMutex);
+        m_preparedPatch = AZStd::move(preparedPatch);
         return *this;
     }
 
@@ -1734,9 +1769,26 @@ namespace AZ
         m_patch = rhs.m_patch;
         m_targetClassId = rhs.m_targetClassId;
         m_targetClassVersion = rhs.m_targetClassVersion;
+
+        AZStd::shared_ptr<PreparedPatch> preparedPatch;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(rhs.m_preparedPatchMutex);
+            preparedPatch = rhs.m_preparedPatch;
+        }
+        AZStd::lock_guard<AZStd::mutex> lock(m_preparedPatchMutex);
+        m_preparedPatch = AZStd::move(preparedPatch);
         return *this;
     }
 
+    //=========================================================================
+    // ResetPreparedPatch
+    //=========================================================================
+    void DataPatch::ResetPreparedPatch()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_preparedPatchMutex);
+        m_preparedPatch.reset();
+    }
+
     //=========================================================================
     // Create
     //=========================================================================
@@ -1780,6 +1832,7 @@ namespace AZ
             return false;
         }
 
+        ResetPreparedPatch();
         m_patch.clear();
         m_targetClassId = targetClassId;
         m_targetClassVersion = targetClassData->m_version;
@@ -1865,69 +1918,95 @@ namespace AZ
         AZStd::vector<AZ::u8> tmpSourceBuffer;
         void* result;
 
-        // Copy the patch so we can repair it before application.
-        decltype(m_patch) fixedPatch;
-
+        AZStd::shared_ptr<PreparedPatch> preparedPatch;
         {
-            // Loop over the original data patch and make a copy of the key value pair
-            AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzCore, "DataPatch::Apply:UpgradeDataPatch");
-            // Copy of the patch element is purposefully being created here(notice no ampersand) so that the UpgradeDataPatch
-            // function can modify the key and insert it into the fixed patch map
-            for (PatchMap::value_type patch : m_patch)
+            AZStd::lock_guard<AZStd::mutex> lock(m_preparedPatchMutex);
+            if (m_preparedPatch && m_preparedPatch->m_context == context)
             {
-                DataPatchUpgradeManager::UpgradeDataPatch(context, m_targetClassId, m_targetClassVersion, patch.first, patch.second);
-                fixedPatch.insert(AZStd::move(patch));
+                preparedPatch = m_preparedPatch;
             }
         }
 
-        // Build a mapping of child patches for quick look-up: [parent patch address] -> [list of patches for child elements (parentAddress + one more address element)]
-            ChildPatchMap childPatchMap;
+        if (!preparedPatch)
         {
-            AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzCore, "DataPatch::Apply:GenerateChildPatchMap");
-            for (auto& patch : fixedPatch)
+            preparedPatch = AZStd::make_shared<PreparedPatch>();
+            preparedPatch->m_context = context;
+
+            // Copy the patch so we can repair it before application.
+            PatchMap& fixedPatch = preparedPatch->m_patch;
+            // Patches from legacy data patches are loaded from their stream during application, which depends on the filter
+            // and changes the patch, so those aren't kept for reuse.
+            bool hasLegacyStreams = false;
+
             {
-                AddressType parentAddress = patch.first;
-                if (parentAddress.empty())
-                {
-                    const char* sourceClassName = sourceTree.m_root.m_classData && sourceTree.m_root.m_classData->m_name
-                        ? sourceTree.m_root.m_classData->m_name : "Unknown Class Name";
-                    AZ_UNUSED(sourceClassName);
-                    AZ_Error("Serialization", false, "Attempting to apply DataPatch has been aborted. The Patch contains an empty address so there is nothing to patch."
-                        " The source object(Class: %s) has not been modified", sourceClassName);
-                    return nullptr;
-                }
-                if (!parentAddress.IsValid())
+                // Loop over the original data patch and make a copy of the key value pair
+                AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzCore, "DataPatch::Apply:UpgradeDataPatch");
+                // Copy of the patch element is purposefully being created here(notice no ampersand) so that the UpgradeDataPatch
+                // function can modify the key and insert it into the fixed patch map
+                for (PatchMap::value_type patch : m_patch)
                 {
-                    const char* sourceClassName = sourceTree.m_root.m_classData && sourceTree.m_root.m_classData->m_name
-                        ? sourceTree.m_root.m_classData->m_name : "Unknown Class Name";
-                    AZ_UNUSED(sourceClassName);
-                    AZ_Error("Serialization", false, "Attempting to apply DataPatch has been aborted . The Patch contains an invalid address to the patch data."
-                        " The source object(Class: %s) has not been modified", sourceClassName);
-                    return nullptr;
+                    DataPatchUpgradeManager::UpgradeDataPatch(context, m_targetClassId, m_targetClassVersion, patch.first, patch.second);
+                    hasLegacyStreams = hasLegacyStreams || patch.second.type() == azrtti_typeid<LegacyStreamWrapper>();
+                    fixedPatch.insert(AZStd::move(patch));
                 }
+            }
 
-                parentAddress.pop_back();
-                auto foundIt = childPatchMap.find(parentAddress);
-                if (foundIt != childPatchMap.end())
-                {
-                    foundIt->second.push_back(patch.first);
-                }
-                else
+            // Build a mapping of child patches for quick look-up: [parent patch address] -> [list of patches for child elements (parentAddress + one more address element)]
+            ChildPatchMap& childPatchMap = preparedPatch->m_childPatchMap;
+            {
+                AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzCore, "DataPatch::Apply:GenerateChildPatchMap");
+                for (auto& patch : fixedPatch)
                 {
-                    AZStd::vector<AddressType> newChildPatchCollection;
-                    newChildPatchCollection.push_back(patch.first);
-                    childPatchMap[parentAddress] = AZStd::move(newChildPatchCollection);
+                    AddressType parentAddress = patch.first;
+                    if (parentAddress.empty())
+                    {
+                        const char* sourceClassName = sourceTree.m_root.m_classData && sourceTree.m_root.m_classData->m_name
+                            ? sourceTree.m_root.m_classData->m_name : "Unknown Class Name";
+                        AZ_UNUSED(sourceClassName);
+                        AZ_Error("Serialization", false, "Attempting to apply DataPatch has been aborted. The Patch contains an empty address so there is nothing to patch."
+                            " The source object(Class: %s) has not been modified", sourceClassName);
+                        return nullptr;
+                    }
+                    if (!parentAddress.IsValid())
+                    {
+                        const char* sourceClassName = sourceTree.m_root.m_classData && sourceTree.m_root.m_classData->m_name
+                            ? sourceTree.m_root.m_classData->m_name : "Unknown Class Name";
+                        AZ_UNUSED(sourceClassName);
+                        AZ_Error("Serialization", false, "Attempting to apply DataPatch has been aborted . The Patch contains an invalid address to the patch data."
+                            " The source object(Class: %s) has not been modified", sourceClassName);
+                        return nullptr;
+                    }
+
+                    parentAddress.pop_back();
+                    auto foundIt = childPatchMap.find(parentAddress);
+                    if (foundIt != childPatchMap.end())
+                    {
+                        foundIt->second.push_back(patch.first);
+                    }
+                    else
+                    {
+                        AZStd::vector<AddressType> newChildPatchCollection;
+                        newChildPatchCollection.push_back(patch.first);
+                        childPatchMap[parentAddress] = AZStd::move(newChildPatchCollection);
+                    }
                 }
             }
+
+            if (!hasLegacyStreams)
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_preparedPatchMutex);
+                m_preparedPatch = preparedPatch;
+            }
         }
+
         {
             AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzCore, "DataPatch::Apply:RecursiveCallToApplyToElements");
             int rootContainerElementCounter = 0;
 
             result = DataNodeTree::ApplyToElements(
                 &sourceTree.m_root,
-                fixedPatch,
-                childPatchMap,
+                preparedPatch->m_patch,
+                preparedPatch->m_childPatchMap,
                 sourceFlagsMap,
                 targetFlagsMap,
                 0,
@@ -2138,6 +2217,7 @@ namespace AZ
             serializeContext->ClassDeprecate("OldDataPatch", GetLegacyDataPatchTypeId(), &LegacyDataPatchConverter);
 
             serializeContext->Class<DataPatch>()->
+                EventHandler<DataPatchSerializationEvents>()->
                 Field("m_targetClassId", &DataPatch::m_targetClassId)->
                 Field("m_targetClassVersion", &DataPatch::m_targetClassVersion)->
                 Field("m_patch", &DataPatch::m_patch);
@@ -9,6 +9,8 @@
 #define AZCORE_DATA_PATCH_FIELD_H
 
 #include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 
 #include "ObjectStream.h"
 
@@ -376,9 +378,22 @@ namespace AZ
         }
 
     protected:
+        friend class DataPatchSerializationEvents;
+
+        /// The patch upgraded to the current class versions and its child patch lookup, see Apply.
+        struct PreparedPatch;
+
+        /// Drops the prepared patch, needs to be called whenever m_patch changes.
+        void ResetPreparedPatch();
+
         Uuid     m_targetClassId;
         unsigned int m_targetClassVersion;
         mutable PatchMap m_patch;
+
+        /// Only depends on the patch and the serialize context, so it's prepared the first time the patch is applied and
+        /// reused by every later application, for example when a slice is instantiated many times.
+        mutable AZStd::shared_ptr<PreparedPatch> m_preparedPatch;
+        mutable AZStd::mutex m_preparedPatchMutex;
     };
 
     /**
@@ -209,6 +209,26 @@ namespace AZ
         return OperationFlags::None;
     }
 
+    JsonSerializationResult::Result BaseJsonSerializer::LoadStreamedBegin(void*, const Uuid&, JsonDeserializerContext& context)
+    {
+        return context.Report(JsonSerializationResult::Tasks::ReadField, JsonSerializationResult::Outcomes::Unsupported,
+            "Serializer doesn't support streamed loading.");
+    }
+
+    JsonSerializationResult::Result BaseJsonSerializer::LoadStreamedElement(void*, const Uuid&, const rapidjson::Value&,
+        JsonDeserializerContext& context)
+    {
+        return context.Report(JsonSerializationResult::Tasks::ReadField, JsonSerializationResult::Outcomes::Unsupported,
+            "Serializer doesn't support streamed loading.");
+    }
+
+    JsonSerializationResult::Result BaseJsonSerializer::LoadStreamedEnd(void*, const Uuid&, JsonSerializationResult::ResultCode,
+        size_t, size_t, JsonDeserializerContext& context)
+    {
+        return context.Report(JsonSerializationResult::Tasks::ReadField, JsonSerializationResult::Outcomes::Unsupported,
+            "Serializer doesn't support streamed loading.");
+    }
+
     JsonSerializationResult::ResultCode BaseJsonSerializer::ContinueLoading(
         void* object, const Uuid& typeId, const rapidjson::Value& value, JsonDeserializerContext& context, ContinuationFlags flags)
     {
@@ -171,8 +171,10 @@ namespace AZ
         {
             None = 0,                       //! No flags that control how the custom json serializer is used.
             ManualDefault = 1 << 0,         //! Even if an (explicit) default is found the custom json serializer will still be called.
-            InitializeNewInstance = 1 << 1  //! If set, the custom json serializer will be called with an explicit default if a new
+            InitializeNewInstance = 1 << 1, //! If set, the custom json serializer will be called with an explicit default if a new
                                             //! instance of its target type is created.
+            StreamedLoad = 1 << 2           //! If set, the streaming deserializer will load json arrays for this serializer one
+                                            //! element at a time through LoadStreamedBegin, LoadStreamedElement and LoadStreamedEnd.
         };
 
         virtual ~BaseJsonSerializer() = default;
@@ -190,6 +192,22 @@ namespace AZ
         //! Returns the operation flags which tells the Json Serialization how this custom json serializer can be used.
         virtual OperationFlags GetOperationsFlags() const;
 
+        //! Called by the streaming deserializer (see JsonSerialization::Load for streams) when it encounters a json array for
+        //! a serializer with OperationFlags::StreamedLoad, before any of the elements are read. Serializers without this flag
+        //! are called with the fully read json value through Load instead.
+        virtual JsonSerializationResult::Result LoadStreamedBegin(void* outputValue, const Uuid& outputValueTypeId,
+            JsonDeserializerContext& context);
+        //! Called by the streaming deserializer for every element in the json array with the fully read value of that element.
+        //! Returning a result that's altered means the element was not added to the output value.
+        virtual JsonSerializationResult::Result LoadStreamedElement(void* outputValue, const Uuid& outputValueTypeId,
+            const rapidjson::Value& element, JsonDeserializerContext& context);
+        //! Called by the streaming deserializer after the last element of the json array.
+        //! @param result The combined result of LoadStreamedBegin and all calls to LoadStreamedElement.
+        //! @param elementCount The number of elements in the json array.
+        //! @param loadedCount The number of elements that were loaded without being altered.
+        virtual JsonSerializationResult::Result LoadStreamedEnd(void* outputValue, const Uuid& outputValueTypeId,
+            JsonSerializationResult::ResultCode result, size_t elementCount, size_t loadedCount, JsonDeserializerContext& context);
+
     protected:
         //! Continues loading of a (sub)value. Use this function to load member variables for instance. This is more optimal than 
         //! directly calling the json serialization.
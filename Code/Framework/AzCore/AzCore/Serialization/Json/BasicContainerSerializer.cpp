@@ -138,59 +138,96 @@ namespace AZ
         }
     }
 
-    JsonSerializationResult::Result JsonBasicContainerSerializer::LoadContainer(void* outputValue, const Uuid& outputValueTypeId,
-        const rapidjson::Value& inputValue, JsonDeserializerContext& context)
+    BaseJsonSerializer::OperationFlags JsonBasicContainerSerializer::GetOperationsFlags() const
+    {
+        return OperationFlags::StreamedLoad;
+    }
+
+    JsonSerializationResult::Result JsonBasicContainerSerializer::LoadStreamedBegin(void* outputValue, const Uuid& outputValueTypeId,
+        JsonDeserializerContext& context)
     {
         namespace JSR = JsonSerializationResult; // Used to remove name conflicts in AzCore in uber builds.
 
-        const SerializeContext::ClassData* containerClass = context.GetSerializeContext()->FindClassData(outputValueTypeId);
-        if (!containerClass)
+        const char* errorMessage = nullptr;
+        SerializeContext::IDataContainer* container = GetContainer(outputValueTypeId, errorMessage, context);
+        if (!container)
         {
-            return context.Report(JSR::Tasks::RetrieveInfo, JSR::Outcomes::Unsupported,
-                "Unable to retrieve information for definition of the basic container.");
+            return context.Report(JSR::Tasks::RetrieveInfo, JSR::Outcomes::Unsupported, errorMessage);
+        }
+        if (container->Size(outputValue) == 0 || !context.ShouldClearContainers())
+        {
+            return context.Report(JSR::ResultCode(JSR::Tasks::ReadField), "Starting streamed loading of basic container.");
         }
+        return ClearContainer(outputValue, *container, context);
+    }
 
-        SerializeContext::IDataContainer* container = containerClass->m_container;
+    JsonSerializationResult::Result JsonBasicContainerSerializer::LoadStreamedElement(void* outputValue, const Uuid& outputValueTypeId,
+        const rapidjson::Value& element, JsonDeserializerContext& context)
+    {
+        namespace JSR = JsonSerializationResult; // Used to remove name conflicts in AzCore in uber builds.
+
+        const char* errorMessage = nullptr;
+        SerializeContext::IDataContainer* container = GetContainer(outputValueTypeId, errorMessage, context);
         if (!container)
         {
-            return context.Report(JSR::Tasks::RetrieveInfo, JSR::Outcomes::Unsupported,
-                "Unable to retrieve container meta information for the basic container.");
+            return context.Report(JSR::Tasks::RetrieveInfo, JSR::Outcomes::Unsupported, errorMessage);
         }
+        const SerializeContext::ClassElement* classElement = GetClassElement(*container);
 
-        const SerializeContext::ClassElement* classElement = nullptr;
-        auto typeEnumCallback = [&classElement](const Uuid&, const SerializeContext::ClassElement* genericClassElement)
+        size_t expectedSize = container->Size(outputValue) + 1;
+        if (container->IsFixedCapacity() && expectedSize > container->Capacity(outputValue))
         {
-            AZ_Assert(!classElement, "There are multiple class elements registered for a basic container where only one was expected.");
-            classElement = genericClassElement;
-            return true;
-        };
-        container->EnumTypes(typeEnumCallback);
-        AZ_Assert(classElement, "No class element found for the type in the basic container.");
+            return context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Skipped,
+                "Unable to load more entries in basic container because it's full.");
+        }
 
-        ContinuationFlags flags = classElement->m_flags & SerializeContext::ClassElement::Flags::FLG_POINTER
-            ? ContinuationFlags::ResolvePointer
-            : ContinuationFlags::None;
-        flags |= ContinuationFlags::LoadAsNewInstance;
+        void* elementAddress = container->ReserveElement(outputValue, classElement);
+        if (!elementAddress)
+        {
+            return context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Catastrophic,
+                "Failed to allocate an item in the basic container.");
+        }
 
-        const size_t capacity = container->IsFixedCapacity() ? container->Capacity(outputValue) : std::numeric_limits<size_t>::max();
+        JSR::ResultCode result = LoadElement(outputValue, elementAddress, expectedSize, *container, *classElement, element, context);
+        return context.Report(result, result.GetProcessing() == JSR::Processing::Halted
+            ? "Failed to read element for basic container."
+            : "Read element for basic container.");
+    }
+
+    JsonSerializationResult::Result JsonBasicContainerSerializer::LoadStreamedEnd(void*, const Uuid&,
+        JsonSerializationResult::ResultCode result, size_t elementCount, size_t loadedCount, JsonDeserializerContext& context)
+    {
+        return ReportLoadResult(result, elementCount, loadedCount, context);
+    }
+
+    JsonSerializationResult::Result JsonBasicContainerSerializer::LoadContainer(void* outputValue, const Uuid& outputValueTypeId,
+        const rapidjson::Value& inputValue, JsonDeserializerContext& context)
+    {
+        namespace JSR = JsonSerializationResult; // Used to remove name conflicts in AzCore in uber builds.
+
+        const char* errorMessage = nullptr;
+        SerializeContext::IDataContainer* container = GetContainer(outputValueTypeId, errorMessage, context);
+        if (!container)
+        {
+            return context.Report(JSR::Tasks::RetrieveInfo, JSR::Outcomes::Unsupported, errorMessage);
+        }
 
         JSR::ResultCode retVal(JSR::Tasks::ReadField);
+
+        const SerializeContext::ClassElement* classElement = GetClassElement(*container);
+
+        const size_t capacity = container->IsFixedCapacity() ? container->Capacity(outputValue) : std::numeric_limits<size_t>::max();
+
         size_t containerSize = container->Size(outputValue);
         if (containerSize > 0 && context.ShouldClearContainers())
         {
-            JSR::Result result = context.Report(JSR::Tasks::Clear, JSR::Outcomes::Success, "Clearing basic container.");
-            if (result.GetResultCode().GetOutcome() == JSR::Outcomes::Success)
-            {
-                container->ClearElements(outputValue, context.GetSerializeContext());
-                containerSize = container->Size(outputValue);
-                result = context.Report(JSR::Tasks::Clear, containerSize == 0 ? JSR::Outcomes::Success : JSR::Outcomes::Unsupported,
-                    containerSize == 0 ? "Cleared basic container." : "Failed to clear basic container.");
-            }
+            JSR::Result result = ClearContainer(outputValue, *container, context);
             if (result.GetResultCode().GetProcessing() != JSR::Processing::Completed)
             {
                 return result;
             }
             retVal.Combine(result);
+            containerSize = container->Size(outputValue);
         }
         rapidjson::SizeType arraySize = inputValue.Size();
         for (rapidjson::SizeType i = 0; i < arraySize; ++i)
@@ -212,52 +249,115 @@ namespace AZ
                 return context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Catastrophic,
                     "Failed to allocate an item in the basic container.");
             }
-            if (classElement->m_flags & SerializeContext::ClassElement::Flags::FLG_POINTER)
-            {
-                *reinterpret_cast<void**>(elementAddress) = nullptr;
-            }
-            
-            JSR::ResultCode result = ContinueLoading(elementAddress, classElement->m_typeId, inputValue[i], context, flags);
+
+            JSR::ResultCode result = LoadElement(outputValue, elementAddress, expectedSize, *container, *classElement, inputValue[i], context);
             if (result.GetProcessing() == JSR::Processing::Halted)
             {
-                container->FreeReservedElement(outputValue, elementAddress, context.GetSerializeContext());
                 return context.Report(retVal, "Failed to read element for basic container.");
             }
-            else if (result.GetProcessing() == JSR::Processing::Altered)
-            {
-                container->FreeReservedElement(outputValue, elementAddress, context.GetSerializeContext());
-                retVal.Combine(result);
-            }
-            else
-            {
-                container->StoreElement(outputValue, elementAddress);
-                if (container->Size(outputValue) != expectedSize)
-                {
-                    retVal.Combine(context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Unavailable,
-                        "Unable to store element to basic container."));
-                }
-                else
-                {
-                    retVal.Combine(result);
-                }
-            } 
+            retVal.Combine(result);
+        }
+
+        return ReportLoadResult(retVal, arraySize, container->Size(outputValue) - containerSize, context);
+    }
+
+    SerializeContext::IDataContainer* JsonBasicContainerSerializer::GetContainer(const Uuid& outputValueTypeId,
+        const char*& errorMessage, JsonDeserializerContext& context)
+    {
+        const SerializeContext::ClassData* containerClass = context.GetSerializeContext()->FindClassData(outputValueTypeId);
+        if (!containerClass)
+        {
+            errorMessage = "Unable to retrieve information for definition of the basic container.";
+            return nullptr;
+        }
+
+        if (!containerClass->m_container)
+        {
+            errorMessage = "Unable to retrieve container meta information for the basic container.";
         }
+        return containerClass->m_container;
+    }
+
+    const SerializeContext::ClassElement* JsonBasicContainerSerializer::GetClassElement(SerializeContext::IDataContainer& container)
+    {
+        const SerializeContext::ClassElement* classElement = nullptr;
+        auto typeEnumCallback = [&classElement](const Uuid&, const SerializeContext::ClassElement* genericClassElement)
+        {
+            AZ_Assert(!classElement, "There are multiple class elements registered for a basic container where only one was expected.");
+            classElement = genericClassElement;
+            return true;
+        };
+        container.EnumTypes(typeEnumCallback);
+        AZ_Assert(classElement, "No class element found for the type in the basic container.");
+        return classElement;
+    }
+
+    JsonSerializationResult::Result JsonBasicContainerSerializer::ClearContainer(void* outputValue,
+        SerializeContext::IDataContainer& container, JsonDeserializerContext& context)
+    {
+        namespace JSR = JsonSerializationResult; // Used to remove name conflicts in AzCore in uber builds.
+
+        JSR::Result result = context.Report(JSR::Tasks::Clear, JSR::Outcomes::Success, "Clearing basic container.");
+        if (result.GetResultCode().GetOutcome() == JSR::Outcomes::Success)
+        {
+            container.ClearElements(outputValue, context.GetSerializeContext());
+            const size_t containerSize = container.Size(outputValue);
+            result = context.Report(JSR::Tasks::Clear, containerSize == 0 ? JSR::Outcomes::Success : JSR::Outcomes::Unsupported,
+                containerSize == 0 ? "Cleared basic container." : "Failed to clear basic container.");
+        }
+        return result;
+    }
+
+    JsonSerializationResult::ResultCode JsonBasicContainerSerializer::LoadElement(void* outputValue, void* elementAddress,
+        size_t expectedSize, SerializeContext::IDataContainer& container, const SerializeContext::ClassElement& classElement,
+        const rapidjson::Value& inputValue, JsonDeserializerContext& context)
+    {
+        namespace JSR = JsonSerializationResult; // Used to remove name conflicts in AzCore in uber builds.
+
+        ContinuationFlags flags = classElement.m_flags & SerializeContext::ClassElement::Flags::FLG_POINTER
+            ? ContinuationFlags::ResolvePointer
+            : ContinuationFlags::None;
+        flags |= ContinuationFlags::LoadAsNewInstance;
+
+        if (classElement.m_flags & SerializeContext::ClassElement::Flags::FLG_POINTER)
+        {
+            *reinterpret_cast<void**>(elementAddress) = nullptr;
+        }
+
+        JSR::ResultCode result = ContinueLoading(elementAddress, classElement.m_typeId, inputValue, context, flags);
+        if (result.GetProcessing() == JSR::Processing::Halted || result.GetProcessing() == JSR::Processing::Altered)
+        {
+            container.FreeReservedElement(outputValue, elementAddress, context.GetSerializeContext());
+            return result;
+        }
+
+        container.StoreElement(outputValue, elementAddress);
+        if (container.Size(outputValue) != expectedSize)
+        {
+            return context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Unavailable, "Unable to store element to basic container.");
+        }
+        return result;
+    }
+
+    JsonSerializationResult::Result JsonBasicContainerSerializer::ReportLoadResult(JsonSerializationResult::ResultCode result,
+        size_t elementCount, size_t addedCount, JsonDeserializerContext& context)
+    {
+        namespace JSR = JsonSerializationResult; // Used to remove name conflicts in AzCore in uber builds.
 
-        if (!retVal.HasDoneWork() && inputValue.Empty())
+        if (!result.HasDoneWork() && elementCount == 0)
         {
             return context.Report(JSR::Tasks::ReadField, JSR::Outcomes::Success, "No values provided for basic container.");
         }
 
-        size_t addedCount = container->Size(outputValue) - containerSize;
         if (addedCount > 0)
         {
             // Values were added which means the container is no longer in its default state of being empty.
-            retVal.Combine(JSR::ResultCode(JSR::Tasks::ReadField, JSR::Outcomes::Success));
+            result.Combine(JSR::ResultCode(JSR::Tasks::ReadField, JSR::Outcomes::Success));
         }
         AZStd::string_view message =
-            addedCount >= arraySize ? "Successfully read basic container.":
+            addedCount >= elementCount ? "Successfully read basic container.":
             addedCount == 0 ? "Unable to read data for basic container." :
             "Partially read data for basic container.";
-        return context.Report(retVal, message);
+        return context.Report(result, message);
     }
 } // namespace AZ
@@ -10,6 +10,7 @@
 
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Serialization/Json/BaseJsonSerializer.h>
+#include <AzCore/Serialization/SerializeContext.h>
 
 namespace AZ
 {
@@ -23,9 +24,29 @@ namespace AZ
             JsonDeserializerContext& context) override;
         JsonSerializationResult::Result Store(rapidjson::Value& outputValue, const void* inputValue, const void* defaultValue,
             const Uuid& valueTypeId, JsonSerializerContext& context) override;
+        OperationFlags GetOperationsFlags() const override;
+
+        JsonSerializationResult::Result LoadStreamedBegin(void* outputValue, const Uuid& outputValueTypeId,
+            JsonDeserializerContext& context) override;
+        JsonSerializationResult::Result LoadStreamedElement(void* outputValue, const Uuid& outputValueTypeId,
+            const rapidjson::Value& element, JsonDeserializerContext& context) override;
+        JsonSerializationResult::Result LoadStreamedEnd(void* outputValue, const Uuid& outputValueTypeId,
+            JsonSerializationResult::ResultCode result, size_t elementCount, size_t loadedCount, JsonDeserializerContext& context) override;
 
     private:
         JsonSerializationResult::Result LoadContainer(void* outputValue, const Uuid& outputValueTypeId, const rapidjson::Value& inputValue,
             JsonDeserializerContext& context);
+        //! Retrieves the container for the type, or returns null and sets the error message if it's not available.
+        SerializeContext::IDataContainer* GetContainer(const Uuid& outputValueTypeId, const char*& errorMessage,
+            JsonDeserializerContext& context);
+        const SerializeContext::ClassElement* GetClassElement(SerializeContext::IDataContainer& container);
+        JsonSerializationResult::Result ClearContainer(void* outputValue, SerializeContext::IDataContainer& container,
+            JsonDeserializerContext& context);
+        //! Loads the element in the reserved element address and either stores it or frees the reserved element.
+        JsonSerializationResult::ResultCode LoadElement(void* outputValue, void* elementAddress, size_t expectedSize,
+            SerializeContext::IDataContainer& container, const SerializeContext::ClassElement& classElement,
+            const rapidjson::Value& inputValue, JsonDeserializerContext& context);
+        JsonSerializationResult::Result ReportLoadResult(JsonSerializationResult::ResultCode result, size_t elementCount,
+            size_t addedCount, JsonDeserializerContext& context);
     };
 } // namespace AZ
@@ -17,6 +17,11 @@
 
 namespace AZ
 {
+    namespace IO
+    {
+        class GenericStream;
+    }
+
     class BaseJsonSerializer;
     
     enum class JsonMergeApproach
@@ -153,6 +158,43 @@ namespace AZ
         static JsonSerializationResult::ResultCode Load(
             void* object, const Uuid& objectType, const rapidjson::Value& root, JsonDeserializerSettings& settings);
 
+        //! Loads the data from the provided stream into the supplied object without first reading the full json document into memory.
+        //! The object is expected to be created before calling load. Members of reflected classes are loaded while they're read from
+        //! the stream and arrays for serializers with BaseJsonSerializer::OperationFlags::StreamedLoad are loaded one element at a
+        //! time. All other values are read into a json value first and loaded the same way as the other Load functions, so the
+        //! loaded object is the same as when the document is loaded with those.
+        //! Note: if the stream doesn't contain valid json the object may already be partially loaded when the error is found.
+        //! @param object Object where the data will be loaded into.
+        //! @param stream The stream to read the json text from, starting at its current position.
+        //! @param settings Optional additional settings to control the way document is deserialized.
+        template<typename T>
+        static JsonSerializationResult::ResultCode Load(
+            T& object, IO::GenericStream& stream, const JsonDeserializerSettings& settings = JsonDeserializerSettings{});
+        //! Loads the data from the provided stream into the supplied object without first reading the full json document into memory.
+        //! See the other version of Load for streams for more details.
+        //! @param object Object where the data will be loaded into.
+        //! @param stream The stream to read the json text from, starting at its current position.
+        //! @param settings Additional settings to control the way document is deserialized.
+        template<typename T>
+        static JsonSerializationResult::ResultCode Load(T& object, IO::GenericStream& stream, JsonDeserializerSettings& settings);
+        //! Loads the data from the provided stream into the supplied object without first reading the full json document into memory.
+        //! See the other version of Load for streams for more details.
+        //! @param object Pointer to the object where the data will be loaded into.
+        //! @param objectType Type id of the object passed in.
+        //! @param stream The stream to read the json text from, starting at its current position.
+        //! @param settings Optional additional settings to control the way document is deserialized.
+        static JsonSerializationResult::ResultCode Load(
+            void* object, const Uuid& objectType, IO::GenericStream& stream,
+            const JsonDeserializerSettings& settings = JsonDeserializerSettings{});
+        //! Loads the data from the provided stream into the supplied object without first reading the full json document into memory.
+        //! See the other version of Load for streams for more details.
+        //! @param object Pointer to the object where the data will be loaded into.
+        //! @param objectType Type id of the object passed in.
+        //! @param stream The stream to read the json text from, starting at its current position.
+        //! @param settings Additional settings to control the way document is deserialized.
+        static JsonSerializationResult::ResultCode Load(
+            void* object, const Uuid& objectType, IO::GenericStream& stream, JsonDeserializerSettings& settings);
+
         //! Loads the type id from the provided input.
         //! Note: it's not recommended to use this function (frequently) as it requires users of the json file to have knowledge of the internal
         //!     type structure and is therefore harder to use.
@@ -312,6 +354,18 @@ namespace AZ
         return Load(&object, azrtti_typeid(object), root, settings);
     }
 
+    template<typename T>
+    JsonSerializationResult::ResultCode JsonSerialization::Load(T& object, IO::GenericStream& stream, const JsonDeserializerSettings& settings)
+    {
+        return Load(&object, azrtti_typeid(object), stream, settings);
+    }
+
+    template<typename T>
+    JsonSerializationResult::ResultCode JsonSerialization::Load(T& object, IO::GenericStream& stream, JsonDeserializerSettings& settings)
+    {
+        return Load(&object, azrtti_typeid(object), stream, settings);
+    }
+
     template<typename T>
     JsonSerializationResult::ResultCode JsonSerialization::Store(
         rapidjson::Value& output, rapidjson::Document::AllocatorType& allocator, const T& object, const JsonSerializerSettings& settings)
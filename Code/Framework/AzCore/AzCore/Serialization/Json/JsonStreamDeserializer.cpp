@@ -0,0 +1,610 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/JSON/error/en.h>
+#include <AzCore/JSON/reader.h>
+#include <AzCore/Serialization/Json/BaseJsonSerializer.h>
+#include <AzCore/Serialization/Json/JsonDeserializer.h>
+#include <AzCore/Serialization/Json/JsonStreamDeserializer.h>
+#include <AzCore/Serialization/Json/RegistrationContext.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ
+{
+    namespace JsonStreamDeserializerInternal
+    {
+        //! Input stream for the rapidjson reader that reads from a GenericStream in blocks.
+        class InputStream
+        {
+        public:
+            using Ch = char;
+
+            explicit InputStream(IO::GenericStream& stream)
+                : m_stream(stream)
+            {
+                Read();
+            }
+
+            Ch Peek() const
+            {
+                return *m_current;
+            }
+
+            Ch Take()
+            {
+                Ch c = *m_current;
+                Read();
+                return c;
+            }
+
+            size_t Tell() const
+            {
+                return m_count + static_cast<size_t>(m_current - m_buffer);
+            }
+
+            // Writing is not supported.
+            Ch* PutBegin() { AZ_Assert(false, "Json input stream doesn't support writing."); return nullptr; }
+            void Put(Ch) { AZ_Assert(false, "Json input stream doesn't support writing."); }
+            void Flush() { AZ_Assert(false, "Json input stream doesn't support writing."); }
+            size_t PutEnd(Ch*) { AZ_Assert(false, "Json input stream doesn't support writing."); return 0; }
+
+        private:
+            void Read()
+            {
+                if (m_current < m_last)
+                {
+                    ++m_current;
+                }
+                else if (!m_isEndOfStream)
+                {
+                    m_count += m_readCount;
+                    m_readCount = static_cast<size_t>(m_stream.Read(BufferSize, m_buffer));
+                    m_last = m_buffer + m_readCount - 1;
+                    m_current = m_buffer;
+
+                    if (m_readCount < BufferSize)
+                    {
+                        // The reader stops at the terminating zero.
+                        m_buffer[m_readCount] = '\0';
+                        ++m_last;
+                        m_isEndOfStream = true;
+                    }
+                }
+            }
+
+            static constexpr size_t BufferSize = 16 * 1024;
+
+            IO::GenericStream& m_stream;
+            Ch m_buffer[BufferSize + 1];
+            Ch* m_current{ m_buffer };
+            Ch* m_last{ m_buffer };
+            size_t m_readCount{ 0 };
+            size_t m_count{ 0 };
+            bool m_isEndOfStream{ false };
+        };
+    } // namespace JsonStreamDeserializerInternal
+
+    //! Handler for the rapidjson reader that tracks the objects that are being loaded. Values that can't be streamed are
+    //! captured into a json value and loaded through the JsonDeserializer once fully read.
+    class JsonStreamDeserializer::Handler
+    {
+    public:
+        Handler(void* object, const Uuid& typeId, JsonDeserializerContext& context)
+            : m_rootObject(object)
+            , m_rootTypeId(typeId)
+            , m_context(context)
+        {
+        }
+
+        JsonSerializationResult::ResultCode GetResult() const
+        {
+            return m_result;
+        }
+
+        bool Null()
+        {
+            return ScalarValue(rapidjson::Value());
+        }
+
+        bool Bool(bool value)
+        {
+            return ScalarValue(rapidjson::Value(value));
+        }
+
+        bool Int(int value)
+        {
+            return ScalarValue(rapidjson::Value(value));
+        }
+
+        bool Uint(unsigned value)
+        {
+            return ScalarValue(rapidjson::Value(value));
+        }
+
+        bool Int64(int64_t value)
+        {
+            return ScalarValue(rapidjson::Value(value));
+        }
+
+        bool Uint64(uint64_t value)
+        {
+            return ScalarValue(rapidjson::Value(value));
+        }
+
+        bool Double(double value)
+        {
+            return ScalarValue(rapidjson::Value(value));
+        }
+
+        bool RawNumber(const char*, rapidjson::SizeType, bool)
+        {
+            AZ_Assert(false, "Numbers are not expected to be parsed as strings by the json stream deserializer.");
+            return false;
+        }
+
+        bool String(const char* value, rapidjson::SizeType length, bool)
+        {
+            if (m_skipDepth > 0)
+            {
+                return true;
+            }
+            if (m_captureDepth == 0)
+            {
+                // The string is loaded immediately so a reference to the parser's copy is enough.
+                return ScalarValue(rapidjson::Value(rapidjson::StringRef(value, length)));
+            }
+            return ScalarValue(rapidjson::Value(value, length, m_captureAllocator));
+        }
+
+        bool StartObject()
+        {
+            if (m_skipDepth > 0)
+            {
+                ++m_skipDepth;
+                return true;
+            }
+            if (m_captureDepth > 0)
+            {
+                ++m_captureDepth;
+                m_captureStack.emplace_back(rapidjson::kObjectType);
+                return true;
+            }
+
+            BeginValue();
+            const Target& target = GetTarget();
+            switch (target.m_type)
+            {
+            case TargetType::Skip:
+                m_skipDepth = 1;
+                return true;
+            case TargetType::Root:
+                [[fallthrough]];
+            case TargetType::ClassElement:
+                if (const SerializeContext::ClassData* classData = FindStreamableClass(target))
+                {
+                    Frame frame;
+                    frame.m_type = FrameType::Class;
+                    frame.m_object = GetTargetObject(target);
+                    frame.m_typeId = classData->m_typeId;
+                    frame.m_classData = classData;
+                    m_frames.push_back(frame);
+                    return true;
+                }
+                break;
+            default:
+                break;
+            }
+
+            m_captureDepth = 1;
+            m_captureStack.emplace_back(rapidjson::kObjectType);
+            return true;
+        }
+
+        bool Key(const char* name, rapidjson::SizeType length, bool)
+        {
+            if (m_skipDepth > 0)
+            {
+                return true;
+            }
+            if (m_captureDepth > 0)
+            {
+                m_captureStack.emplace_back(name, length, m_captureAllocator);
+                return true;
+            }
+
+            using namespace JsonSerializationResult;
+
+            AZ_Assert(!m_frames.empty() && m_frames.back().m_type == FrameType::Class, "Json stream handler received a key outside of a class.");
+            Frame& frame = m_frames.back();
+            AZStd::string_view memberName(name, length);
+            m_context.PushPath(memberName);
+            if (memberName == JsonSerialization::TypeIdFieldIdentifier)
+            {
+                frame.m_target = Target{ TargetType::Skip };
+                return true;
+            }
+
+            JsonDeserializer::ElementDataResult foundElementData = JsonDeserializer::FindElementByNameCrc(
+                *m_context.GetSerializeContext(), frame.m_object, *frame.m_classData, Crc32(memberName));
+            if (foundElementData.m_found)
+            {
+                frame.m_target = Target{ TargetType::ClassElement, foundElementData.m_data, foundElementData.m_info };
+            }
+            else
+            {
+                frame.m_result.Combine(m_context.Report(Tasks::ReadField, Outcomes::Skipped,
+                    "Skipping field as there's no matching variable in the target."));
+                frame.m_target = Target{ TargetType::Skip };
+            }
+            return true;
+        }
+
+        bool EndObject(rapidjson::SizeType memberCount)
+        {
+            if (m_skipDepth > 0)
+            {
+                return --m_skipDepth > 0 || FinishValue(m_skipResult);
+            }
+            if (m_captureDepth > 0)
+            {
+                const size_t objectIndex = m_captureStack.size() - (2 * memberCount) - 1;
+                rapidjson::Value& object = m_captureStack[objectIndex];
+                for (size_t i = objectIndex + 1; i < m_captureStack.size(); i += 2)
+                {
+                    object.AddMember(m_captureStack[i], m_captureStack[i + 1], m_captureAllocator);
+                }
+                m_captureStack.resize(objectIndex + 1);
+                return --m_captureDepth > 0 || FinishCapture();
+            }
+
+            using namespace JsonSerializationResult;
+
+            AZ_Assert(!m_frames.empty() && m_frames.back().m_type == FrameType::Class, "Json stream handler received an unexpected end of object.");
+            Frame frame = m_frames.back();
+            m_frames.pop_back();
+
+            // Same as JsonDeserializer::Load and JsonDeserializer::LoadClass.
+            if (memberCount == 0)
+            {
+                return FinishValue(m_context.Report(Tasks::ReadField, Outcomes::DefaultsUsed, "Value has an explicit default."));
+            }
+            size_t elementCount = JsonDeserializer::CountElements(*m_context.GetSerializeContext(), *frame.m_classData);
+            if (elementCount > frame.m_loadedCount)
+            {
+                frame.m_result.Combine(ResultCode(Tasks::ReadField, frame.m_loadedCount == 0 ? Outcomes::DefaultsUsed : Outcomes::PartialDefaults));
+            }
+            return FinishValue(frame.m_result);
+        }
+
+        bool StartArray()
+        {
+            if (m_skipDepth > 0)
+            {
+                ++m_skipDepth;
+                return true;
+            }
+            if (m_captureDepth > 0)
+            {
+                ++m_captureDepth;
+                m_captureStack.emplace_back(rapidjson::kArrayType);
+                return true;
+            }
+
+            using namespace JsonSerializationResult;
+
+            BeginValue();
+            const Target& target = GetTarget();
+            switch (target.m_type)
+            {
+            case TargetType::Skip:
+                m_skipDepth = 1;
+                return true;
+            case TargetType::Root:
+                [[fallthrough]];
+            case TargetType::ClassElement:
+                if (BaseJsonSerializer* serializer = FindStreamingSerializer(target))
+                {
+                    Frame frame;
+                    frame.m_type = FrameType::StreamedArray;
+                    frame.m_object = GetTargetObject(target);
+                    frame.m_typeId = GetTargetTypeId(target);
+                    frame.m_serializer = serializer;
+                    frame.m_target = Target{ TargetType::ArrayElement };
+
+                    Result result = serializer->LoadStreamedBegin(frame.m_object, frame.m_typeId, m_context);
+                    if (result.GetResultCode().GetProcessing() != Processing::Completed)
+                    {
+                        // The serializer can't load the array so skip over it, the same as when it returns early from Load.
+                        m_skipResult = result;
+                        m_skipDepth = 1;
+                        return true;
+                    }
+                    frame.m_result.Combine(result);
+                    m_frames.push_back(frame);
+                    return true;
+                }
+                break;
+            default:
+                break;
+            }
+
+            m_captureDepth = 1;
+            m_captureStack.emplace_back(rapidjson::kArrayType);
+            return true;
+        }
+
+        bool EndArray(rapidjson::SizeType elementCount)
+        {
+            if (m_skipDepth > 0)
+            {
+                return --m_skipDepth > 0 || FinishValue(m_skipResult);
+            }
+            if (m_captureDepth > 0)
+            {
+                const size_t arrayIndex = m_captureStack.size() - elementCount - 1;
+                rapidjson::Value& array = m_captureStack[arrayIndex];
+                array.Reserve(elementCount, m_captureAllocator);
+                for (size_t i = arrayIndex + 1; i < m_captureStack.size(); ++i)
+                {
+                    array.PushBack(m_captureStack[i], m_captureAllocator);
+                }
+                m_captureStack.resize(arrayIndex + 1);
+                return --m_captureDepth > 0 || FinishCapture();
+            }
+
+            AZ_Assert(!m_frames.empty() && m_frames.back().m_type == FrameType::StreamedArray,
+                "Json stream handler received an unexpected end of array.");
+            Frame frame = m_frames.back();
+            m_frames.pop_back();
+            return FinishValue(frame.m_serializer->LoadStreamedEnd(
+                frame.m_object, frame.m_typeId, frame.m_result, frame.m_elementCount, frame.m_loadedCount, m_context));
+        }
+
+    private:
+        enum class TargetType : u8
+        {
+            Root,           //!< The next value is the root value of the document.
+            ClassElement,   //!< The next value is loaded into a member of a class.
+            ArrayElement,   //!< The next value is passed to a streaming serializer as an array element.
+            Skip            //!< The next value is skipped.
+        };
+
+        //! Where the next value in the stream will be loaded to.
+        struct Target
+        {
+            TargetType m_type{ TargetType::Skip };
+            void* m_object{ nullptr };
+            const SerializeContext::ClassElement* m_element{ nullptr };
+        };
+
+        enum class FrameType : u8
+        {
+            Class,          //!< A reflected class that's loaded member by member.
+            StreamedArray   //!< An array that's loaded element by element by a streaming serializer.
+        };
+
+        //! An object or array that's currently being loaded.
+        struct Frame
+        {
+            Target m_target;
+            void* m_object{ nullptr };
+            Uuid m_typeId{ Uuid::CreateNull() };
+            const SerializeContext::ClassData* m_classData{ nullptr };
+            BaseJsonSerializer* m_serializer{ nullptr };
+            JsonSerializationResult::ResultCode m_result{ JsonSerializationResult::Tasks::ReadField };
+            size_t m_elementCount{ 0 };     //!< The number of array elements that were read.
+            size_t m_loadedCount{ 0 };      //!< The number of members or elements that were loaded without alterations.
+            FrameType m_type{ FrameType::Class };
+        };
+
+        const Target& GetTarget() const
+        {
+            static const Target rootTarget{ TargetType::Root };
+            return m_frames.empty() ? rootTarget : m_frames.back().m_target;
+        }
+
+        const Uuid& GetTargetTypeId(const Target& target) const
+        {
+            return target.m_type == TargetType::Root ? m_rootTypeId : target.m_element->m_typeId;
+        }
+
+        void* GetTargetObject(const Target& target) const
+        {
+            return target.m_type == TargetType::Root ? m_rootObject : target.m_object;
+        }
+
+        //! Returns the class data if the target is a reflected class without a custom serializer, these can be loaded member by
+        //! member. This follows the checks in JsonDeserializer::Load, anything else is loaded from a captured value instead.
+        const SerializeContext::ClassData* FindStreamableClass(const Target& target) const
+        {
+            if (!GetTargetObject(target) ||
+                (target.m_element && (target.m_element->m_flags & SerializeContext::ClassElement::Flags::FLG_POINTER)))
+            {
+                return nullptr;
+            }
+
+            const Uuid& typeId = GetTargetTypeId(target);
+            if (m_context.GetRegistrationContext()->GetSerializerForType(typeId))
+            {
+                return nullptr;
+            }
+            const SerializeContext::ClassData* classData = m_context.GetSerializeContext()->FindClassData(typeId);
+            if (!classData || classData->m_container)
+            {
+                return nullptr;
+            }
+            if (classData->m_azRtti &&
+                (classData->m_azRtti->GetGenericTypeId() != typeId ||
+                 (classData->m_azRtti->GetTypeTraits() & AZ::TypeTraits::is_enum) == AZ::TypeTraits::is_enum))
+            {
+                return nullptr;
+            }
+            return classData;
+        }
+
+        //! Returns the serializer for the target if it supports loading arrays element by element.
+        BaseJsonSerializer* FindStreamingSerializer(const Target& target) const
+        {
+            if (!GetTargetObject(target) ||
+                (target.m_element && (target.m_element->m_flags & SerializeContext::ClassElement::Flags::FLG_POINTER)))
+            {
+                return nullptr;
+            }
+
+            const Uuid& typeId = GetTargetTypeId(target);
+            BaseJsonSerializer* serializer = m_context.GetRegistrationContext()->GetSerializerForType(typeId);
+            if (!serializer)
+            {
+                const SerializeContext::ClassData* classData = m_context.GetSerializeContext()->FindClassData(typeId);
+                if (classData && classData->m_azRtti && classData->m_azRtti->GetGenericTypeId() != typeId)
+                {
+                    serializer = m_context.GetRegistrationContext()->GetSerializerForType(classData->m_azRtti->GetGenericTypeId());
+                }
+            }
+            return serializer &&
+                (serializer->GetOperationsFlags() & BaseJsonSerializer::OperationFlags::StreamedLoad) == BaseJsonSerializer::OperationFlags::StreamedLoad
+                ? serializer
+                : nullptr;
+        }
+
+        //! Called at the start of every value that isn't part of a captured or skipped value.
+        void BeginValue()
+        {
+            if (!m_frames.empty() && m_frames.back().m_type == FrameType::StreamedArray)
+            {
+                m_context.PushPath(m_frames.back().m_elementCount);
+            }
+        }
+
+        bool ScalarValue(rapidjson::Value&& value)
+        {
+            if (m_skipDepth > 0)
+            {
+                return true;
+            }
+            if (m_captureDepth > 0)
+            {
+                m_captureStack.push_back(AZStd::move(value));
+                return true;
+            }
+            BeginValue();
+            return LoadValue(value);
+        }
+
+        bool FinishCapture()
+        {
+            AZ_Assert(m_captureStack.size() == 1, "Json stream handler captured more than one value.");
+            bool result = LoadValue(m_captureStack.back());
+            m_captureStack.clear();
+            m_captureAllocator.Clear();
+            return result;
+        }
+
+        //! Loads a fully read value into the current target.
+        bool LoadValue(const rapidjson::Value& value)
+        {
+            using namespace JsonSerializationResult;
+
+            const Target& target = GetTarget();
+            switch (target.m_type)
+            {
+            case TargetType::Root:
+                return FinishValue(JsonDeserializer::Load(m_rootObject, m_rootTypeId, value, false, m_context));
+            case TargetType::ClassElement:
+                return FinishValue(JsonDeserializer::LoadWithClassElement(target.m_object, value, *target.m_element, m_context));
+            case TargetType::ArrayElement:
+            {
+                Frame& frame = m_frames.back();
+                return FinishValue(frame.m_serializer->LoadStreamedElement(frame.m_object, frame.m_typeId, value, m_context));
+            }
+            default:
+                return FinishValue(ResultCode(Tasks::ReadField));
+            }
+        }
+
+        //! Updates the parent with the result of a fully loaded value. Returns false if loading has to stop.
+        bool FinishValue(JsonSerializationResult::ResultCode result)
+        {
+            using namespace JsonSerializationResult;
+
+            if (m_frames.empty())
+            {
+                m_result = result;
+                return true;
+            }
+
+            Frame& frame = m_frames.back();
+            switch (frame.m_target.m_type)
+            {
+            case TargetType::ClassElement:
+                frame.m_result.Combine(result);
+                if (result.GetProcessing() == Processing::Halted)
+                {
+                    m_result = m_context.Report(result, "Loading of element has failed.");
+                    return false;
+                }
+                if (result.GetProcessing() != Processing::Altered)
+                {
+                    frame.m_loadedCount++;
+                }
+                break;
+            case TargetType::ArrayElement:
+                frame.m_result.Combine(result);
+                if (result.GetProcessing() == Processing::Halted)
+                {
+                    m_result = result;
+                    return false;
+                }
+                if (result.GetProcessing() != Processing::Altered)
+                {
+                    frame.m_loadedCount++;
+                }
+                frame.m_elementCount++;
+                break;
+            default:
+                break;
+            }
+            m_context.PopPath();
+            return true;
+        }
+
+        AZStd::vector<Frame> m_frames;
+        void* m_rootObject;
+        Uuid m_rootTypeId;
+        JsonDeserializerContext& m_context;
+        JsonSerializationResult::ResultCode m_result{ JsonSerializationResult::Tasks::ReadField };
+
+        //! Values that can't be streamed are captured into json values held by this stack.
+        AZStd::vector<rapidjson::Value> m_captureStack;
+        rapidjson::Document::AllocatorType m_captureAllocator;
+        size_t m_captureDepth{ 0 };
+
+        size_t m_skipDepth{ 0 };
+        JsonSerializationResult::ResultCode m_skipResult{ JsonSerializationResult::Tasks::ReadField };
+    };
+
+    JsonSerializationResult::ResultCode JsonStreamDeserializer::Load(void* object, const Uuid& typeId, IO::GenericStream& stream,
+        JsonDeserializerContext& context)
+    {
+        using namespace JsonSerializationResult;
+
+        JsonStreamDeserializerInternal::InputStream inputStream(stream);
+        Handler handler(object, typeId, context);
+        rapidjson::Reader reader;
+        rapidjson::ParseResult parseResult = reader.Parse<rapidjson::kParseCommentsFlag>(inputStream, handler);
+        if (parseResult.IsError() && parseResult.Code() != rapidjson::kParseErrorTermination)
+        {
+            return context.Report(Tasks::ReadField, Outcomes::Catastrophic,
+                AZStd::string::format("Failed to parse json at offset %zu: %s", parseResult.Offset(),
+                    rapidjson::GetParseError_En(parseResult.Code())));
+        }
+        return handler.GetResult();
+    }
+} // namespace AZ
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Serialization/Json/JsonSerialization.h>
+
+namespace AZ
+{
+    struct Uuid;
+    class JsonDeserializerContext;
+
+    namespace IO
+    {
+        class GenericStream;
+    }
+
+    //! Loads json text from a stream without building a document for the entire stream first. Reflected classes are loaded member
+    //! by member as the members are read and json arrays are passed element by element to serializers that have the
+    //! BaseJsonSerializer::OperationFlags::StreamedLoad flag set. All other values are read into a json value that only
+    //! holds that value, which is then loaded with the JsonDeserializer. This keeps peak memory to roughly the largest value that
+    //! can't be streamed instead of the full document.
+    class JsonStreamDeserializer final
+    {
+        friend class JsonSerialization;
+
+    private:
+        class Handler;
+
+        JsonStreamDeserializer() = delete;
+        ~JsonStreamDeserializer() = delete;
+        JsonStreamDeserializer& operator=(const JsonStreamDeserializer& rhs) = delete;
+        JsonStreamDeserializer& operator=(JsonStreamDeserializer&& rhs) = delete;
+        JsonStreamDeserializer(const JsonStreamDeserializer& rhs) = delete;
+        JsonStreamDeserializer(JsonStreamDeserializer&& rhs) = delete;
+
+        static JsonSerializationResult::ResultCode Load(void* object, const Uuid& typeId, IO::GenericStream& stream,
+            JsonDeserializerContext& context);
+    };
+} // namespace AZ
@@ -15,9 +15,11 @@
 #include <AzCore/Asset/AssetManager.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/Slice/SliceAsset.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/functional.h>
 #include <AzCore/std/bind/bind.h>
 #include <AzCore/std/containers/list.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/XML/rapidxml.h>
 #include <AzCore/XML/rapidxml_print.h>
 #include <AzCore/IO/GenericStreams.h>
@@ -122,6 +124,23 @@ namespace AZ
             // used during load to skip the rest of the element including any subelements
             void SkipElement();
 
+            /**
+             * Class element of a reflected class with the class data of its reflected type resolved up front, so loading
+             * a member doesn't have to search the class elements and the SerializeContext for every data element.
+             */
+            struct CompiledClassElement
+            {
+                const SerializeContext::ClassElement* m_classElement;
+                const SerializeContext::ClassData* m_classData; ///< Result of FindClassData for the reflected type of the element, can be null.
+                Uuid m_specializedTypeId; ///< Id the data element gets when it's stored with the reflected type.
+            };
+            using CompiledClassLayout = AZStd::vector<CompiledClassElement>;
+
+            // returns the compiled class element with the name crc, or null if the class is a container or has no such element
+            const CompiledClassElement* FindCompiledClassElement(SerializeContext& sc, const SerializeContext::ClassData* classData, u32 nameCrc);
+            // finds the class data of a data element that was just read and updates the element id to the specialized type id
+            const SerializeContext::ClassData* FindElementClassData(SerializeContext& sc, SerializeContext::DataElement& element, const SerializeContext::ClassData* parent);
+
             bool WriteClass(const void* classPtr, const Uuid& classId, const SerializeContext::ClassData* classData) override;
             bool WriteElement(const void* elemPtr, const SerializeContext::ClassData* classData, const SerializeContext::ClassElement* classElement);
             bool CloseElement();
@@ -225,6 +244,9 @@ namespace AZ
             // completed successfully to make sure the equivalent amount
             // of CloseElements are called
             AZStd::vector<bool>                           m_writeElementResultStack;
+
+            // compiled layouts of the classes that have been loaded so far, built the first time a member of the class is read
+            AZStd::unordered_map<const SerializeContext::ClassData*, CompiledClassLayout> m_compiledClassLayouts;
         };
 
         //=========================================================================
@@ -597,7 +619,14 @@ namespace AZ
                     }
                     else
                     {
-                        for (size_t i = 0; i < parentClassInfo->m_elements.size(); ++i)
+                        // an element with the reflected type of its class element needs no cast or conversion checks
+                        const CompiledClassElement* compiledElement = FindCompiledClassElement(*m_sc, parentClassInfo, element.m_nameCrc);
+                        if (compiledElement && compiledElement->m_classElement->m_typeId == element.m_id)
+                        {
+                            classElement = compiledElement->m_classElement;
+                        }
+
+                        for (size_t i = 0; classElement == nullptr && i < parentClassInfo->m_elements.size(); ++i)
                         {
                             const SerializeContext::ClassElement* childElement = &parentClassInfo->m_elements[i];
                             if (childElement->m_nameCrc == element.m_nameCrc)
@@ -1106,16 +1135,7 @@ namespace AZ
                 }
  
                 // find the registered class data
-                cd = sc.FindClassData(element.m_id, parent, element.m_nameCrc);
-
-                if (cd)
-                {
-                    // Lookup the SpecializedTypeId from the class if it has GenericClassInfo registered with it
-                    if (GenericClassInfo* genericClassInfo = sc.FindGenericClassInfo(cd->m_typeId))
-                    {
-                        element.m_id = genericClassInfo->GetSpecializedTypeId();
-                    }
-                }
+                cd = FindElementClassData(sc, element, parent);
 
                 // Root elements may require classInfo to be provided by the in-place load callback.
                 if (!cd && isTopElement && m_inplaceLoadInfoCB)
@@ -1234,15 +1254,7 @@ namespace AZ
                 }
 
                 // find the registered class data
-                cd = sc.FindClassData(element.m_id, parent, element.m_nameCrc);
-                if (cd)
-                {
-                    // Lookup the SpecializedTypeId from the class if it has GenericClassInfo registered with it
-                    if (GenericClassInfo* genericClassInfo = sc.FindGenericClassInfo(cd->m_typeId))
-                    {
-                        element.m_id = genericClassInfo->GetSpecializedTypeId();
-                    }
-                }
+                cd = FindElementClassData(sc, element, parent);
                 // Root elements may require classInfo to be provided by the in-place load callback.
                 if (!cd && isTopElement && m_inplaceLoadInfoCB)
                 {
@@ -1342,15 +1354,7 @@ namespace AZ
 
 
                 // find the registered class data
-                cd = sc.FindClassData(element.m_id, parent, element.m_nameCrc);
-                if (cd)
-                {
-                    // Lookup the SpecializedTypeId from the class if it has GenericClassInfo registered with it
-                    if (GenericClassInfo* genericClassInfo = sc.FindGenericClassInfo(cd->m_typeId))
-                    {
-                        element.m_id = genericClassInfo->GetSpecializedTypeId();
-                    }
-                }
+                cd = FindElementClassData(sc, element, parent);
 
                 // Root elements may require classInfo to be provided by the in-place load callback.
                 if (!cd && isTopElement && m_inplaceLoadInfoCB)
@@ -1399,6 +1403,14 @@ namespace AZ
 
                     element.m_dataSize = valueBytes;
                     element.m_stream->Seek(0, IO::GenericStream::ST_SEEK_BEGIN);
+                    if (element.m_stream == &m_inStream && valueBytes > m_buffer1.capacity())
+                    {
+                        // The value overwrites the scratch buffer from the start, so drop the previous value instead of copying it
+                        // into the grown buffer, and size it exactly. Large values (like model buffer assets) would otherwise be
+                        // copied on every growth and over-allocated by up to the stream's maximum grow size.
+                        m_buffer1.clear();
+                        m_buffer1.reserve(valueBytes);
+                    }
                     if (element.m_dataSize)
                     {
                         // Directly copy data from m_stream into element.m_stream
@@ -1414,6 +1426,85 @@ namespace AZ
             return true;
         }
 
+        //=========================================================================
+        // FindCompiledClassElement
+        //=========================================================================
+        const ObjectStreamImpl::CompiledClassElement* ObjectStreamImpl::FindCompiledClassElement(SerializeContext& sc, const SerializeContext::ClassData* classData, u32 nameCrc)
+        {
+            // container elements are resolved through the container itself
+            if (!classData || classData->m_container)
+            {
+                return nullptr;
+            }
+
+            auto layoutIt = m_compiledClassLayouts.find(classData);
+            if (layoutIt == m_compiledClassLayouts.end())
+            {
+                CompiledClassLayout layout;
+                layout.reserve(classData->m_elements.size());
+                for (const SerializeContext::ClassElement& classElement : classData->m_elements)
+                {
+                    // only the first element with a name is ever matched, the same as a search of the class elements
+                    auto sameName = [&classElement](const CompiledClassElement& compiledElement) { return compiledElement.m_classElement->m_nameCrc == classElement.m_nameCrc; };
+                    if (AZStd::find_if(layout.begin(), layout.end(), sameName) != layout.end())
+                    {
+                        continue;
+                    }
+
+                    CompiledClassElement compiledElement;
+                    compiledElement.m_classElement = &classElement;
+                    compiledElement.m_classData = sc.FindClassData(classElement.m_typeId, classData, classElement.m_nameCrc);
+                    compiledElement.m_specializedTypeId = classElement.m_typeId;
+                    if (compiledElement.m_classData)
+                    {
+                        if (GenericClassInfo* genericClassInfo = sc.FindGenericClassInfo(compiledElement.m_classData->m_typeId))
+                        {
+                            compiledElement.m_specializedTypeId = genericClassInfo->GetSpecializedTypeId();
+                        }
+                    }
+                    layout.push_back(compiledElement);
+                }
+                layoutIt = m_compiledClassLayouts.emplace(classData, AZStd::move(layout)).first;
+            }
+
+            for (const CompiledClassElement& compiledElement : layoutIt->second)
+            {
+                if (compiledElement.m_classElement->m_nameCrc == nameCrc)
+                {
+                    return &compiledElement;
+                }
+            }
+            return nullptr;
+        }
+
+        //=========================================================================
+        // FindElementClassData
+        //=========================================================================
+        const SerializeContext::ClassData* ObjectStreamImpl::FindElementClassData(SerializeContext& sc, SerializeContext::DataElement& element, const SerializeContext::ClassData* parent)
+        {
+            // Most data elements are stored with the reflected type of their class element, use the class data resolved for it.
+            // Elements of other types, for example derived classes stored in pointers, are looked up in the SerializeContext.
+            if (const CompiledClassElement* compiledElement = FindCompiledClassElement(sc, parent, element.m_nameCrc))
+            {
+                if (compiledElement->m_classElement->m_typeId == element.m_id)
+                {
+                    element.m_id = compiledElement->m_specializedTypeId;
+                    return compiledElement->m_classData;
+                }
+            }
+
+            const SerializeContext::ClassData* cd = sc.FindClassData(element.m_id, parent, element.m_nameCrc);
+            if (cd)
+            {
+                // Lookup the SpecializedTypeId from the class if it has GenericClassInfo registered with it
+                if (GenericClassInfo* genericClassInfo = sc.FindGenericClassInfo(cd->m_typeId))
+                {
+                    element.m_id = genericClassInfo->GetSpecializedTypeId();
+                }
+            }
+            return cd;
+        }
+
         //=========================================================================
         // SkipElement
         // [1/19/2013]
@@ -26,6 +26,8 @@
 #include <AzCore/Math/MathUtils.h>
 
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
 
 #if defined(AZ_ENABLE_TRACING) && !defined(AZ_DISABLE_SERIALIZER_DEBUG)
 #   define AZ_ENABLE_SERIALIZER_DEBUG
@@ -2112,6 +2114,47 @@ namespace AZ
         }
     }
 
+    //=========================================================================
+    // CloneObjects
+    //=========================================================================
+    void SerializeContext::CloneObjects(const void* const* objects, const Uuid* classIds, void** clonedObjects, size_t count, JobContext* jobContext)
+    {
+        // Every job clones a batch of objects, so jobs are only spawned for batches large enough to be worth it.
+        constexpr size_t minObjectsPerJob = 16;
+
+        auto cloneRange = [this, objects, classIds, clonedObjects](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                clonedObjects[i] = objects[i] ? CloneObject(objects[i], classIds[i]) : nullptr;
+            }
+        };
+
+        if (!jobContext || count < minObjectsPerJob * 2)
+        {
+            cloneRange(0, count);
+            return;
+        }
+
+        // A few batches per worker balance out objects that take longer to clone than others.
+        const size_t numWorkers = AZStd::max<size_t>(jobContext->GetJobManager().GetNumWorkerThreads(), 1);
+        const size_t objectsPerJob = AZStd::max(minObjectsPerJob, (count + numWorkers * 4 - 1) / (numWorkers * 4));
+
+        JobCompletion completion(jobContext);
+        for (size_t begin = objectsPerJob; begin < count; begin += objectsPerJob)
+        {
+            const size_t end = AZStd::min(begin + objectsPerJob, count);
+            Job* job = CreateJobFunction([&cloneRange, begin, end]()
+                {
+                    cloneRange(begin, end);
+                }, true, jobContext);
+            job->SetDependent(&completion);
+            job->Start();
+        }
+        cloneRange(0, objectsPerJob);
+        completion.StartAndWaitForCompletion();
+    }
+
     AZ::SerializeContext::DataPatchUpgrade::DataPatchUpgrade(AZStd::string_view fieldName, unsigned int fromVersion, unsigned int toVersion)
         : m_targetFieldName(fieldName)
         , m_targetFieldCRC(m_targetFieldName.data(), m_targetFieldName.size(), true)
@@ -47,6 +47,7 @@ namespace AZ
 
     class ObjectStream;
     class GenericClassInfo;
+    class JobContext;
 
     struct DataPatchNodeInfo;
 
@@ -315,6 +316,18 @@ namespace AZ
         void CloneObjectInplace(T& dest, const T* obj);
         void CloneObjectInplace(void* dest, const void* ptr, const Uuid& classId);
 
+        /**
+         * Makes a copy of each of count independent objects, the same as calling CloneObject for every object. The objects are
+         * split into batches that are cloned in parallel on the jobs of jobContext. A clone only reads the reflected class data,
+         * so no classes may be reflected or removed until this returns. Without a job context the objects are cloned on the
+         * calling thread.
+         * \param objects The objects to clone.
+         * \param clonedObjects Receives the copy of every object at the same index, nullptr if the object couldn't be cloned.
+         */
+        template<class T>
+        void CloneObjects(const T* const* objects, T** clonedObjects, size_t count, JobContext* jobContext);
+        void CloneObjects(const void* const* objects, const Uuid* classIds, void** clonedObjects, size_t count, JobContext* jobContext);
+
         // Types listed earlier here will have higher priority
         enum DataPatchUpgradeType
         {
@@ -1812,6 +1825,30 @@ namespace AZ
         CloneObjectInplace(&dest, classPtr, classId);
     }
 
+    // CloneObjects
+    template<class T>
+    void SerializeContext::CloneObjects(const T* const* objects, T** clonedObjects, size_t count, JobContext* jobContext)
+    {
+        AZStd::vector<const void*> classPtrs;
+        AZStd::vector<Uuid> classIds;
+        AZStd::vector<void*> clonedPtrs(count, nullptr);
+        classPtrs.reserve(count);
+        classIds.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            // Clone the actual type of every object, see CloneObject.
+            classPtrs.push_back(SerializeTypeInfo<T>::RttiCast(objects[i], SerializeTypeInfo<T>::GetRttiTypeId(objects[i])));
+            classIds.push_back(SerializeTypeInfo<T>::GetUuid(objects[i]));
+        }
+
+        CloneObjects(classPtrs.data(), classIds.data(), clonedPtrs.data(), count, jobContext);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            clonedObjects[i] = Cast<T*>(clonedPtrs[i], classIds[i]);
+        }
+    }
+
     //=========================================================================
     // EnumerateDerived
     // [11/13/2012]
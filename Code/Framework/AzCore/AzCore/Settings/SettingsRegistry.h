@@ -35,6 +35,7 @@ namespace AZ
 
         static constexpr char Extension[] = "setreg";
         static constexpr char PatchExtension[] = "setregpatch";
+        static constexpr char CompiledExtension[] = "setregbin";
         static constexpr char RegistryFolder[] = "Registry";
 
         static constexpr char DevUserRegistryFolder[] = "user" AZ_CORRECT_FILESYSTEM_SEPARATOR_STRING "Registry";
@@ -116,7 +117,35 @@ namespace AZ
         enum class Format
         {
             JsonPatch,      //!< Using the json patch format to merge JSON data into the Settings Registry.
-            JsonMergePatch  //!< Using the json merge patch format to merge JSON data into the Settings Registry.
+            JsonMergePatch, //!< Using the json merge patch format to merge JSON data into the Settings Registry.
+            Compiled        //!< Using the binary format written by SettingsRegistryMergeUtils::DumpSettingsRegistryToCompiledStream.
+                            //!< Objects are merged and all other values, including arrays, are replaced. Null values are kept.
+        };
+
+        //! Layout of settings stored in the Format::Compiled format. The data starts with the Magic and Version as u32
+        //! values, followed by the root value. Every value starts with a ValueTag byte followed by the payload of the type:
+        //! - Int64, Uint64 and Double store 8 bytes.
+        //! - String stores a u32 length followed by the characters.
+        //! - Array stores a u32 count followed by the values.
+        //! - Object stores a u32 count followed by the members, each is a u32 name length, the name and the value.
+        //! All numbers are stored in the native (little endian) byte order.
+        struct CompiledFormat
+        {
+            static constexpr u32 Magic = 0x42525353; // "SSRB"
+            static constexpr u32 Version = 1;
+
+            enum class ValueTag : u8
+            {
+                Null,
+                False,
+                True,
+                Int64,
+                Uint64,
+                Double,
+                String,
+                Array,
+                Object
+            };
         };
 
         using NotifyCallback = AZStd::function<void(AZStd::string_view path, Type type)>;
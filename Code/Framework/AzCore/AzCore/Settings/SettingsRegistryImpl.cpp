@@ -19,6 +19,212 @@
 
 namespace AZ
 {
+    namespace SettingsRegistryImplInternal
+    {
+        using CompiledValueTag = SettingsRegistryInterface::CompiledFormat::ValueTag;
+
+        // Reads values from data in the Format::Compiled format with bounds checks.
+        class CompiledReader
+        {
+        public:
+            explicit CompiledReader(AZStd::string_view data)
+                : m_data(data)
+            {
+            }
+
+            template<typename T>
+            bool Read(T& value)
+            {
+                if (m_data.size() - m_offset < sizeof(T))
+                {
+                    return false;
+                }
+                memcpy(&value, m_data.data() + m_offset, sizeof(T));
+                m_offset += sizeof(T);
+                return true;
+            }
+
+            bool ReadString(AZStd::string_view& value)
+            {
+                u32 length;
+                if (!Read(length) || m_data.size() - m_offset < length)
+                {
+                    return false;
+                }
+                value = m_data.substr(m_offset, length);
+                m_offset += length;
+                return true;
+            }
+
+            bool IsAtEnd() const
+            {
+                return m_offset == m_data.size();
+            }
+
+            size_t GetOffset() const
+            {
+                return m_offset;
+            }
+
+            void SetOffset(size_t offset)
+            {
+                m_offset = offset;
+            }
+
+        private:
+            AZStd::string_view m_data;
+            size_t m_offset{ 0 };
+        };
+
+        // Reads a value from the reader and merges it into the target. Objects are merged member by member and all other
+        // values replace the target. If the target is null the value is only validated.
+        bool MergeCompiledValue(CompiledReader& reader, rapidjson::Value* target, rapidjson::Document::AllocatorType& allocator, int depth)
+        {
+            constexpr int MaxDepth = 256;
+            CompiledValueTag tag;
+            if (depth > MaxDepth || !reader.Read(tag))
+            {
+                return false;
+            }
+
+            switch (tag)
+            {
+            case CompiledValueTag::Null:
+                if (target)
+                {
+                    target->SetNull();
+                }
+                return true;
+            case CompiledValueTag::False:
+            case CompiledValueTag::True:
+                if (target)
+                {
+                    target->SetBool(tag == CompiledValueTag::True);
+                }
+                return true;
+            case CompiledValueTag::Int64:
+            {
+                s64 value;
+                if (!reader.Read(value))
+                {
+                    return false;
+                }
+                if (target)
+                {
+                    target->SetInt64(value);
+                }
+                return true;
+            }
+            case CompiledValueTag::Uint64:
+            {
+                u64 value;
+                if (!reader.Read(value))
+                {
+                    return false;
+                }
+                if (target)
+                {
+                    target->SetUint64(value);
+                }
+                return true;
+            }
+            case CompiledValueTag::Double:
+            {
+                double value;
+                if (!reader.Read(value))
+                {
+                    return false;
+                }
+                if (target)
+                {
+                    target->SetDouble(value);
+                }
+                return true;
+            }
+            case CompiledValueTag::String:
+            {
+                AZStd::string_view value;
+                if (!reader.ReadString(value))
+                {
+                    return false;
+                }
+                if (target)
+                {
+                    target->SetString(value.data(), aznumeric_caster(value.size()), allocator);
+                }
+                return true;
+            }
+            case CompiledValueTag::Array:
+            {
+                u32 count;
+                if (!reader.Read(count))
+                {
+                    return false;
+                }
+                if (target)
+                {
+                    target->SetArray();
+                    target->Reserve(count, allocator);
+                }
+                for (u32 i = 0; i < count; ++i)
+                {
+                    rapidjson::Value* element = nullptr;
+                    if (target)
+                    {
+                        target->PushBack(rapidjson::Value(), allocator);
+                        element = &(*target)[target->Size() - 1];
+                    }
+                    if (!MergeCompiledValue(reader, element, allocator, depth + 1))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+            case CompiledValueTag::Object:
+            {
+                u32 count;
+                if (!reader.Read(count))
+                {
+                    return false;
+                }
+                if (target && !target->IsObject())
+                {
+                    target->SetObject();
+                }
+                for (u32 i = 0; i < count; ++i)
+                {
+                    AZStd::string_view name;
+                    if (!reader.ReadString(name))
+                    {
+                        return false;
+                    }
+                    rapidjson::Value* member = nullptr;
+                    if (target)
+                    {
+                        rapidjson::Value nameValue(rapidjson::StringRef(name.data(), aznumeric_caster(name.size())));
+                        auto memberIt = target->FindMember(nameValue);
+                        if (memberIt == target->MemberEnd())
+                        {
+                            target->AddMember(rapidjson::Value(name.data(), aznumeric_caster(name.size()), allocator),
+                                rapidjson::Value(), allocator);
+                            memberIt = target->MemberEnd() - 1;
+                        }
+                        member = &memberIt->value;
+                    }
+                    if (!MergeCompiledValue(reader, member, allocator, depth + 1))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+            default:
+                return false;
+            }
+        }
+    } // namespace SettingsRegistryImplInternal
+
     template<typename T>
     bool SettingsRegistryImpl::SetValueInternal(AZStd::string_view path, T value, SettingsRegistryInterface::Type type)
     {
@@ -506,6 +712,18 @@ namespace AZ
 
     bool SettingsRegistryImpl::MergeSettings(AZStd::string_view data, Format format)
     {
+        if (format == Format::Compiled)
+        {
+            AZStd::scoped_lock lock(m_settingMutex);
+            if (!MergeCompiledSettingsInternal(data, ""))
+            {
+                return false;
+            }
+
+            m_notifiers.Signal("", Type::Object);
+            return true;
+        }
+
         rapidjson::Document jsonPatch;
         constexpr int flags = rapidjson::kParseStopWhenDoneFlag | rapidjson::kParseCommentsFlag | rapidjson::kParseTrailingCommasFlag;
         jsonPatch.Parse<flags>(data.data(), data.length());
@@ -1053,6 +1271,22 @@ namespace AZ
         }
         scratchBuffer[fileSize] = 0;
 
+        if (format == Format::Compiled)
+        {
+            if (!MergeCompiledSettingsInternal(AZStd::string_view(scratchBuffer.data(), fileSize), rootKey))
+            {
+                AZ_Error("Settings Registry", false, R"(Failed to merge compiled registry file "%s".)", path);
+                pointer.Create(m_settings, m_settings.GetAllocator()).SetObject()
+                    .AddMember(StringRef("Error"), StringRef("Failed to merge compiled registry file."), m_settings.GetAllocator())
+                    .AddMember(StringRef("Path"), Value(path, m_settings.GetAllocator()), m_settings.GetAllocator());
+                return false;
+            }
+
+            pointer.Create(m_settings, m_settings.GetAllocator()).SetString(path, m_settings.GetAllocator());
+            m_notifiers.Signal("", Type::Object);
+            return true;
+        }
+
         rapidjson::Document jsonPatch;
         constexpr int flags = rapidjson::kParseStopWhenDoneFlag | rapidjson::kParseCommentsFlag | rapidjson::kParseTrailingCommasFlag;
         jsonPatch.ParseInsitu<flags>(scratchBuffer.data());
@@ -1154,6 +1388,58 @@ namespace AZ
         return true;
     }
 
+    bool SettingsRegistryImpl::MergeCompiledSettingsInternal(AZStd::string_view data, AZStd::string_view rootKey)
+    {
+        using namespace SettingsRegistryImplInternal;
+
+        CompiledReader reader(data);
+        u32 magic;
+        u32 version;
+        if (!reader.Read(magic) || magic != CompiledFormat::Magic)
+        {
+            AZ_Error("Settings Registry", false, "Compiled settings don't start with the expected header.");
+            return false;
+        }
+        if (!reader.Read(version) || version != CompiledFormat::Version)
+        {
+            AZ_Error("Settings Registry", false, "Compiled settings have version %u, but only version %u is supported.",
+                version, CompiledFormat::Version);
+            return false;
+        }
+
+        // Validate all data first so corrupted data doesn't leave the registry partially merged.
+        const size_t rootOffset = reader.GetOffset();
+        if (!MergeCompiledValue(reader, nullptr, m_settings.GetAllocator(), 0) || !reader.IsAtEnd())
+        {
+            AZ_Error("Settings Registry", false, "Compiled settings are corrupted.");
+            return false;
+        }
+        reader.SetOffset(rootOffset);
+
+        rapidjson::Value* rootValue = &m_settings;
+        if (rootKey.empty())
+        {
+            // Same as for the JSON Merge Patch, a root that isn't an object would overwrite all settings.
+            if (static_cast<CompiledValueTag>(data[rootOffset]) != CompiledValueTag::Object)
+            {
+                AZ_Error("Settings Registry", false, "Compiled settings with a root which isn't an object can only be merged under a root key.");
+                return false;
+            }
+        }
+        else
+        {
+            rapidjson::Pointer root(rootKey.data(), rootKey.length());
+            if (!root.IsValid())
+            {
+                AZ_Error("Settings Registry", false, R"(Failed to root path "%.*s" is invalid.)", AZ_STRING_ARG(rootKey));
+                return false;
+            }
+            rootValue = &root.Create(m_settings, m_settings.GetAllocator());
+        }
+
+        return MergeCompiledValue(reader, rootValue, m_settings.GetAllocator(), 0);
+    }
+
     void SettingsRegistryImpl::SetApplyPatchSettings(const AZ::JsonApplyPatchSettings& applyPatchSettings)
     {
         m_applyPatchSettings = applyPatchSettings;
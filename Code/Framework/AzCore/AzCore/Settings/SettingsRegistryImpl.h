@@ -100,6 +100,8 @@ namespace AZ
             const rapidjson::Pointer& historyPointer, AZStd::string_view folderPath);
         bool ExtractFileDescription(RegistryFile& output, const char* filename, const Specializations& specializations);
         bool MergeSettingsFileInternal(const char* path, Format format, AZStd::string_view rootKey, AZStd::vector<char>& scratchBuffer);
+        // Merges data in the Format::Compiled format. The data is validated before anything is merged. Expects the settings lock to be held.
+        bool MergeCompiledSettingsInternal(AZStd::string_view data, AZStd::string_view rootKey);
         
         mutable AZStd::recursive_mutex m_settingMutex;
         NotifyEvent m_notifiers;
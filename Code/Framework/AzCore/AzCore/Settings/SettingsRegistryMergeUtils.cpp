@@ -1141,6 +1141,140 @@ namespace AZ::SettingsRegistryMergeUtils
         return visitor.Finalize();
     }
 
+    bool DumpSettingsRegistryToCompiledStream(SettingsRegistryInterface& registry, AZStd::string_view key,
+        AZ::IO::GenericStream& stream, const AZStd::function<bool(AZStd::string_view path)>& includeFilter)
+    {
+        using CompiledFormat = SettingsRegistryInterface::CompiledFormat;
+        using ValueTag = CompiledFormat::ValueTag;
+
+        struct CompiledExportVisitor
+            : SettingsRegistryInterface::Visitor
+        {
+            explicit CompiledExportVisitor(const AZStd::function<bool(AZStd::string_view path)>& includeFilter)
+                : m_includeFilter{ includeFilter }
+            {
+                const AZ::u32 header[] = { CompiledFormat::Magic, CompiledFormat::Version };
+                Write(header, sizeof(header));
+            }
+
+            void Write(const void* value, size_t size)
+            {
+                const char* bytes = reinterpret_cast<const char*>(value);
+                m_buffer.insert(m_buffer.end(), bytes, bytes + size);
+            }
+
+            void WriteString(AZStd::string_view value)
+            {
+                const AZ::u32 length = aznumeric_cast<AZ::u32>(value.size());
+                Write(&length, sizeof(length));
+                m_buffer.insert(m_buffer.end(), value.begin(), value.end());
+            }
+
+            // Writes the member name if the parent is an object and counts the value in the parent.
+            void BeginValue(AZStd::string_view valueName, ValueTag tag)
+            {
+                if (!m_containers.empty())
+                {
+                    Container& parent = m_containers.back();
+                    ++parent.m_count;
+                    if (parent.m_isObject)
+                    {
+                        WriteString(valueName);
+                    }
+                }
+                Write(&tag, sizeof(tag));
+            }
+
+            AZ::SettingsRegistryInterface::VisitResponse Traverse(
+                AZStd::string_view path, AZStd::string_view valueName, AZ::SettingsRegistryInterface::VisitAction action,
+                AZ::SettingsRegistryInterface::Type type) override
+            {
+                if (action != AZ::SettingsRegistryInterface::VisitAction::End && m_includeFilter && !m_includeFilter(path))
+                {
+                    return AZ::SettingsRegistryInterface::VisitResponse::Skip;
+                }
+
+                if (action == AZ::SettingsRegistryInterface::VisitAction::Begin)
+                {
+                    const bool isObject = type == AZ::SettingsRegistryInterface::Type::Object;
+                    BeginValue(valueName, isObject ? ValueTag::Object : ValueTag::Array);
+                    // The count is written when the container ends.
+                    m_containers.push_back({ m_buffer.size(), 0, isObject });
+                    const AZ::u32 count = 0;
+                    Write(&count, sizeof(count));
+                }
+                else if (action == AZ::SettingsRegistryInterface::VisitAction::End)
+                {
+                    AZ_Assert(!m_containers.empty(), "Attempting to close a json array or object that wasn't started.");
+                    const Container& container = m_containers.back();
+                    memcpy(m_buffer.data() + container.m_countOffset, &container.m_count, sizeof(container.m_count));
+                    m_containers.pop_back();
+                }
+                else if (type == AZ::SettingsRegistryInterface::Type::Null)
+                {
+                    BeginValue(valueName, ValueTag::Null);
+                }
+                return AZ::SettingsRegistryInterface::VisitResponse::Continue;
+            }
+
+            void Visit(AZStd::string_view, AZStd::string_view valueName, AZ::SettingsRegistryInterface::Type, bool value) override
+            {
+                BeginValue(valueName, value ? ValueTag::True : ValueTag::False);
+            }
+
+            void Visit(AZStd::string_view, AZStd::string_view valueName, AZ::SettingsRegistryInterface::Type, AZ::s64 value) override
+            {
+                BeginValue(valueName, ValueTag::Int64);
+                Write(&value, sizeof(value));
+            }
+
+            void Visit(AZStd::string_view, AZStd::string_view valueName, AZ::SettingsRegistryInterface::Type, AZ::u64 value) override
+            {
+                BeginValue(valueName, ValueTag::Uint64);
+                Write(&value, sizeof(value));
+            }
+
+            void Visit(AZStd::string_view, AZStd::string_view valueName, AZ::SettingsRegistryInterface::Type, double value) override
+            {
+                BeginValue(valueName, ValueTag::Double);
+                Write(&value, sizeof(value));
+            }
+
+            void Visit(AZStd::string_view, AZStd::string_view valueName, AZ::SettingsRegistryInterface::Type, AZStd::string_view value) override
+            {
+                BeginValue(valueName, ValueTag::String);
+                WriteString(value);
+            }
+
+            struct Container
+            {
+                size_t m_countOffset;
+                AZ::u32 m_count;
+                bool m_isObject;
+            };
+
+            const AZStd::function<bool(AZStd::string_view path)>& m_includeFilter;
+            AZStd::vector<char> m_buffer;
+            AZStd::vector<Container> m_containers;
+        };
+
+        CompiledExportVisitor visitor(includeFilter);
+        if (!registry.Visit(visitor, key))
+        {
+            AZ_Warning("SettingsRegistryMergeUtils", false, "Unable to visit Settings Registry at key %.*s.",
+                aznumeric_cast<int>(key.size()), key.data());
+            return false;
+        }
+
+        if (!visitor.m_containers.empty())
+        {
+            AZ_Assert(false, "All objects and arrays are expected to be closed after visiting the Settings Registry.");
+            return false;
+        }
+
+        return stream.Write(visitor.m_buffer.size(), visitor.m_buffer.data()) == visitor.m_buffer.size();
+    }
+
     bool IsPathAncestorDescendantOrEqual(AZStd::string_view candidatePath, AZStd::string_view inputPath)
     {
         AZ::IO::PathView candidateView{ candidatePath, AZ::IO::PosixPathSeparator };
@@ -256,6 +256,17 @@ namespace AZ::SettingsRegistryMergeUtils
     bool DumpSettingsRegistryToStream(SettingsRegistryInterface& registry, AZStd::string_view key,
         AZ::IO::GenericStream& stream, const DumperSettings& dumperSettings);
 
+    //! Dumps supplied settings registry from the path specified by key in the binary SettingsRegistryInterface::Format::Compiled
+    //! format. Compiled settings are merged without parsing JSON or applying patches, so merging settings once into a
+    //! compiled file and loading that at runtime reduces startup time.
+    //! Merge the output with SettingsRegistryInterface::MergeSettingsFile using the same key as root key to restore the settings.
+    //! @param key is a JSON pointer to recursively dump settings from
+    //! @param stream is an AZ::IO::GenericStream that supports writing
+    //! @param includeFilter is invoked for the JSON pointer of every value and only values for which it returns true are dumped.
+    //!        All values are included if no filter is supplied.
+    bool DumpSettingsRegistryToCompiledStream(SettingsRegistryInterface& registry, AZStd::string_view key,
+        AZ::IO::GenericStream& stream, const AZStd::function<bool(AZStd::string_view path)>& includeFilter = {});
+
     //! Do not use this function for anything other than bootstrap settings. It is only here to provide compatibility
     //! with current functionality. Proper settings per platform should use the MergeSettingsFolder functionality.
     //! Gets the value using the provided rootPath + platform + keyName, if the platform key does not exist
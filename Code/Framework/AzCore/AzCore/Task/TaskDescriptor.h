@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+
+namespace AZ
+{
+    /**
+     * Priority class of a task. Workers always drain higher priority classes before looking at lower ones,
+     * tasks within the same class run in the order they became ready.
+     */
+    enum class TaskPriority : AZ::u8
+    {
+        CRITICAL = 0,
+        HIGH = 1,
+        MEDIUM = 2,
+        LOW = 3,
+        PRIORITY_COUNT = 4,
+    };
+
+    /**
+     * Static description of a task. Descriptors are usually declared once (as constants) and shared by every
+     * task of the same kind.
+     */
+    struct TaskDescriptor
+    {
+        //! Value of m_affinity when the task may run on any worker.
+        static constexpr AZ::u32 AnyWorker = static_cast<AZ::u32>(-1);
+
+        TaskDescriptor(const char* taskName, const char* taskGroup, TaskPriority priority = TaskPriority::MEDIUM, AZ::u32 affinity = AnyWorker)
+            : m_taskName{ taskName }
+            , m_taskGroup{ taskGroup }
+            , m_priority{ priority }
+            , m_affinity{ affinity }
+        {
+        }
+
+        const char* m_taskName;     ///< Debug name of the task, used for profiling.
+        const char* m_taskGroup;    ///< Debug name of the group (system) the task belongs to.
+        TaskPriority m_priority;    ///< Priority class the task is scheduled with.
+        AZ::u32 m_affinity;         ///< Preferred worker index (modulo the worker count) or AnyWorker. This is a hint, not a guarantee.
+    };
+}
@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Module/Environment.h>
+
+namespace AZ
+{
+    namespace Internal
+    {
+        void TaskQueue::Push(const Entry& entry)
+        {
+            if (m_size == m_entries.size())
+            {
+                // Grow and unwrap the ring so the live entries start at index 0.
+                AZStd::vector<Entry> entries;
+                entries.resize(AZStd::max<size_t>(m_entries.size() * 2, 64));
+                for (size_t i = 0; i < m_size; ++i)
+                {
+                    entries[i] = m_entries[(m_head + i) % m_entries.size()];
+                }
+                m_entries.swap(entries);
+                m_head = 0;
+            }
+            m_entries[(m_head + m_size) % m_entries.size()] = entry;
+            ++m_size;
+        }
+
+        TaskQueue::Entry TaskQueue::Pop()
+        {
+            AZ_Assert(m_size > 0, "Pop called on an empty TaskQueue.");
+            Entry entry = m_entries[m_head];
+            m_head = (m_head + 1) % m_entries.size();
+            --m_size;
+            return entry;
+        }
+    }
+
+    static EnvironmentVariable<TaskExecutor*> s_taskExecutor;
+    static const char* s_taskExecutorName = "GlobalTaskExecutor";
+    static AZ_THREAD_LOCAL TaskExecutor* s_currentExecutor = nullptr;
+
+    TaskExecutor& TaskExecutor::Instance()
+    {
+        if (!s_taskExecutor)
+        {
+            s_taskExecutor = Environment::FindVariable<TaskExecutor*>(s_taskExecutorName);
+        }
+        AZ_Assert(s_taskExecutor && *s_taskExecutor, "TaskExecutor::Instance called before TaskExecutor::SetInstance()");
+
+        return **s_taskExecutor;
+    }
+
+    void TaskExecutor::SetInstance(TaskExecutor* executor)
+    {
+        if (!s_taskExecutor)
+        {
+            s_taskExecutor = Environment::CreateVariable<TaskExecutor*>(s_taskExecutorName);
+        }
+        else if (executor && *s_taskExecutor)
+        {
+            AZ_Error("TaskExecutor", false, "TaskExecutor::SetInstance was called without first setting the old executor to nullptr");
+        }
+
+        s_taskExecutor.Set(executor);
+    }
+
+    TaskExecutor::TaskExecutor(AZ::u32 threadCount, int cpuId)
+    {
+        if (threadCount == 0)
+        {
+            threadCount = AZStd::max(1u, AZStd::thread::hardware_concurrency());
+        }
+
+        AZStd::thread_desc threadDesc;
+        threadDesc.m_name = "AZ TaskExecutor worker thread";
+        threadDesc.m_cpuId = cpuId;
+
+        m_workers.reserve(threadCount);
+        for (AZ::u32 i = 0; i < threadCount; ++i)
+        {
+            m_workers.push_back(aznew Worker);
+        }
+        // Start the threads only once the worker list is complete, workers look at each other's queues.
+        for (AZ::u32 i = 0; i < threadCount; ++i)
+        {
+            m_workers[i]->m_thread = AZStd::thread(
+                [this, i]()
+                {
+                    WorkerLoop(i);
+                },
+                &threadDesc);
+        }
+    }
+
+    TaskExecutor::~TaskExecutor()
+    {
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_queueMutex);
+            AZ_Assert(m_pendingCount.load(AZStd::memory_order_acquire) == 0, "TaskExecutor destroyed with tasks still queued.");
+            m_quitRequested = true;
+        }
+        m_queueSignal.notify_all();
+
+        for (Worker* worker : m_workers)
+        {
+            worker->m_thread.join();
+            delete worker;
+        }
+        m_workers.clear();
+    }
+
+    bool TaskExecutor::IsWorkerThread() const
+    {
+        return s_currentExecutor == this;
+    }
+
+    void TaskExecutor::Enqueue(TaskGraph& graph, AZ::u32 taskIndex)
+    {
+        const TaskDescriptor& descriptor = graph.m_tasks[taskIndex].m_descriptor;
+        const size_t priority = static_cast<size_t>(descriptor.m_priority);
+        AZ_Assert(priority < PriorityCount, "Invalid task priority %zu for task %s.", priority, descriptor.m_taskName);
+
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_queueMutex);
+            if (descriptor.m_affinity != TaskDescriptor::AnyWorker)
+            {
+                Worker& worker = *m_workers[descriptor.m_affinity % m_workers.size()];
+                worker.m_affinityQueues[priority].Push({ &graph, taskIndex });
+                worker.m_hasAffinityWork = true;
+            }
+            else
+            {
+                m_queues[priority].Push({ &graph, taskIndex });
+            }
+            m_pendingCount.fetch_add(1, AZStd::memory_order_release);
+        }
+        // Affinity work may be stolen by any idle worker, so a single wake up is enough in both cases.
+        m_queueSignal.notify_one();
+    }
+
+    bool TaskExecutor::IsEmpty(const PriorityQueues& queues)
+    {
+        for (const Internal::TaskQueue& queue : queues)
+        {
+            if (!queue.IsEmpty())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool TaskExecutor::TryPopFrom(PriorityQueues& queues, Internal::TaskQueue::Entry& entry)
+    {
+        for (Internal::TaskQueue& queue : queues)
+        {
+            if (!queue.IsEmpty())
+            {
+                entry = queue.Pop();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool TaskExecutor::TryPop(AZ::u32 workerIndex, Internal::TaskQueue::Entry& entry)
+    {
+        Worker& self = *m_workers[workerIndex];
+
+        // Work pinned to this worker first, then shared work by priority class. Both are checked per priority
+        // so a critical shared task isn't delayed by low priority pinned work.
+        for (size_t priority = 0; priority < PriorityCount; ++priority)
+        {
+            if (!self.m_affinityQueues[priority].IsEmpty())
+            {
+                entry = self.m_affinityQueues[priority].Pop();
+                self.m_hasAffinityWork = !IsEmpty(self.m_affinityQueues);
+                return true;
+            }
+            if (!m_queues[priority].IsEmpty())
+            {
+                entry = m_queues[priority].Pop();
+                return true;
+            }
+        }
+
+        // Affinity is only a hint, help other workers rather than going idle.
+        for (Worker* other : m_workers)
+        {
+            if (other->m_hasAffinityWork && TryPopFrom(other->m_affinityQueues, entry))
+            {
+                other->m_hasAffinityWork = !IsEmpty(other->m_affinityQueues);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void TaskExecutor::WorkerLoop(AZ::u32 workerIndex)
+    {
+        s_currentExecutor = this;
+
+        while (true)
+        {
+            Internal::TaskQueue::Entry entry;
+            {
+                AZStd::unique_lock<AZStd::mutex> lock(m_queueMutex);
+                m_queueSignal.wait(lock, [this]()
+                {
+                    return m_quitRequested || m_pendingCount.load(AZStd::memory_order_acquire) > 0;
+                });
+
+                if (!TryPop(workerIndex, entry))
+                {
+                    if (m_quitRequested)
+                    {
+                        break;
+                    }
+                    continue;
+                }
+                m_pendingCount.fetch_sub(1, AZStd::memory_order_acq_rel);
+            }
+
+            TaskGraph& graph = *entry.m_graph;
+            {
+                const TaskDescriptor& descriptor = graph.m_tasks[entry.m_taskIndex].m_descriptor;
+                AZ_PROFILE_SCOPE_DYNAMIC(AZ::Debug::ProfileCategory::AzCore, "Task %s:%s", descriptor.m_taskGroup, descriptor.m_taskName);
+                graph.m_tasks[entry.m_taskIndex].m_function();
+            }
+            graph.OnTaskCompleted(entry.m_taskIndex, *this);
+        }
+
+        s_currentExecutor = nullptr;
+    }
+}
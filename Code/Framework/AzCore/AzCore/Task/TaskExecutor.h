@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Task/TaskDescriptor.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace AZ
+{
+    class TaskGraph;
+
+    namespace Internal
+    {
+        //! Growable ring buffer of ready tasks. Storage is kept between frames so steady state scheduling
+        //! does not touch the heap.
+        class TaskQueue final
+        {
+        public:
+            struct Entry
+            {
+                TaskGraph* m_graph = nullptr;
+                AZ::u32 m_taskIndex = 0;
+            };
+
+            bool IsEmpty() const { return m_size == 0; }
+            void Push(const Entry& entry);
+            Entry Pop();
+
+        private:
+            AZStd::vector<Entry> m_entries;
+            size_t m_head = 0;
+            size_t m_size = 0;
+        };
+    }
+
+    /**
+     * Runs the tasks of submitted TaskGraphs on a fixed set of worker threads. Ready tasks are queued by priority
+     * class; tasks with an affinity hint are queued on the preferred worker and only picked up by other workers
+     * when those have nothing else to do.
+     */
+    class TaskExecutor final
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(TaskExecutor, SystemAllocator, 0);
+
+        //! Returns the global executor, see SetInstance.
+        static TaskExecutor& Instance();
+
+        //! Sets the global executor used by TaskGraph::Submit when no executor is provided. Set to nullptr
+        //! before destroying the registered executor.
+        static void SetInstance(TaskExecutor* executor);
+
+        //! \param threadCount Number of workers to create, 0 creates one per hardware thread.
+        //! \param cpuId Affinity mask given to every worker thread, see AZStd::thread_desc::m_cpuId.
+        explicit TaskExecutor(AZ::u32 threadCount = 0, int cpuId = AFFINITY_MASK_ALL);
+        ~TaskExecutor();
+
+        TaskExecutor(const TaskExecutor&) = delete;
+        TaskExecutor& operator=(const TaskExecutor&) = delete;
+
+        AZ::u32 GetWorkerCount() const { return static_cast<AZ::u32>(m_workers.size()); }
+
+        //! Returns true if the calling thread is one of this executor's workers.
+        bool IsWorkerThread() const;
+
+    private:
+        friend class TaskGraph;
+
+        static constexpr size_t PriorityCount = static_cast<size_t>(TaskPriority::PRIORITY_COUNT);
+        using PriorityQueues = Internal::TaskQueue[PriorityCount];
+
+        struct Worker
+        {
+            AZ_CLASS_ALLOCATOR(Worker, SystemAllocator, 0);
+
+            AZStd::thread m_thread;
+            PriorityQueues m_affinityQueues; ///< Tasks that prefer this worker, guarded by the executor mutex.
+            bool m_hasAffinityWork = false;
+        };
+
+        //! Queues a ready task. Called by TaskGraph when submitting roots and by workers as successors become ready.
+        void Enqueue(TaskGraph& graph, AZ::u32 taskIndex);
+
+        void WorkerLoop(AZ::u32 workerIndex);
+        bool TryPop(AZ::u32 workerIndex, Internal::TaskQueue::Entry& entry);
+        static bool TryPopFrom(PriorityQueues& queues, Internal::TaskQueue::Entry& entry);
+        static bool IsEmpty(const PriorityQueues& queues);
+
+        AZStd::vector<Worker*> m_workers;
+        PriorityQueues m_queues;
+        AZStd::mutex m_queueMutex;
+        AZStd::condition_variable m_queueSignal;
+        AZStd::atomic<AZ::u32> m_pendingCount{ 0 };
+        bool m_quitRequested = false;
+    };
+}
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/Task/TaskExecutor.h>
+
+#include <AzCore/std/sort.h>
+
+namespace AZ
+{
+    void TaskToken::PrecedesInternal(TaskToken& other)
+    {
+        AZ_Assert(&m_parent == &other.m_parent, "Dependencies can only be declared between tasks of the same TaskGraph.");
+        m_parent.AddLink(m_index, other.m_index);
+    }
+
+    bool TaskGraphEvent::IsSignaled() const
+    {
+        return m_signaled.load(AZStd::memory_order_acquire);
+    }
+
+    void TaskGraphEvent::Wait()
+    {
+        // Always go through the semaphore, even if already signaled, so Wait can't return while Signal is still
+        // touching this event.
+        m_semaphore.acquire();
+    }
+
+    void TaskGraphEvent::Reset()
+    {
+        AZ_Assert(m_signaled.load(AZStd::memory_order_acquire), "TaskGraphEvent reused while the previous graph is still in flight.");
+        // Drain a release that was never waited on so the next Wait blocks correctly.
+        m_semaphore.try_acquire_for(AZStd::chrono::milliseconds(0));
+        m_signaled.store(false, AZStd::memory_order_release);
+    }
+
+    void TaskGraphEvent::Signal()
+    {
+        m_signaled.store(true, AZStd::memory_order_release);
+        m_semaphore.release();
+    }
+
+    TaskGraph::~TaskGraph()
+    {
+        AZ_Assert(!IsInFlight(), "TaskGraph destroyed while its tasks are still running.");
+    }
+
+    void TaskGraph::AddLink(AZ::u32 from, AZ::u32 to)
+    {
+        AZ_Assert(!m_frozen, "Dependencies can't be added to a frozen TaskGraph, call Reset first.");
+        AZ_Assert(from != to, "A task can't depend on itself.");
+        m_links.emplace_back(from, to);
+    }
+
+    void TaskGraph::Freeze()
+    {
+        if (m_frozen)
+        {
+            return;
+        }
+
+        const AZ::u32 taskCount = static_cast<AZ::u32>(m_tasks.size());
+
+        // Pack the successors of each task contiguously so completing a task walks a single array.
+        AZStd::sort(m_links.begin(), m_links.end());
+        m_links.erase(AZStd::unique(m_links.begin(), m_links.end()), m_links.end());
+
+        m_successors.clear();
+        m_successors.reserve(m_links.size());
+        for (const AZStd::pair<AZ::u32, AZ::u32>& link : m_links)
+        {
+            Task& predecessor = m_tasks[link.first];
+            if (predecessor.m_successorCount == 0)
+            {
+                predecessor.m_successorOffset = static_cast<AZ::u32>(m_successors.size());
+            }
+            ++predecessor.m_successorCount;
+            ++m_tasks[link.second].m_predecessorCount;
+            m_successors.push_back(link.second);
+        }
+        m_links.clear();
+
+        m_roots.clear();
+        for (AZ::u32 i = 0; i < taskCount; ++i)
+        {
+            if (m_tasks[i].m_predecessorCount == 0)
+            {
+                m_roots.push_back(i);
+            }
+        }
+        AZ_Assert(taskCount == 0 || !m_roots.empty(), "TaskGraph has a dependency cycle, no task can start.");
+
+        m_pendingPredecessors.resize(taskCount);
+        m_frozen = true;
+    }
+
+    void TaskGraph::Reset()
+    {
+        AZ_Assert(!IsInFlight(), "TaskGraph reset while its tasks are still running.");
+        m_tasks.clear();
+        m_links.clear();
+        m_successors.clear();
+        m_roots.clear();
+        m_pendingPredecessors.clear();
+        m_frozen = false;
+    }
+
+    void TaskGraph::Submit(TaskGraphEvent* waitEvent, TaskExecutor* executor)
+    {
+        AZ_Assert(!IsInFlight(), "TaskGraph submitted again before the previous submission completed.");
+        Freeze();
+
+        TaskExecutor& targetExecutor = executor ? *executor : TaskExecutor::Instance();
+
+        if (waitEvent)
+        {
+            waitEvent->Reset();
+        }
+
+        if (m_tasks.empty())
+        {
+            if (waitEvent)
+            {
+                waitEvent->Signal();
+            }
+            return;
+        }
+
+        m_waitEvent = waitEvent;
+        const AZ::u32 taskCount = static_cast<AZ::u32>(m_tasks.size());
+        for (AZ::u32 i = 0; i < taskCount; ++i)
+        {
+            m_pendingPredecessors[i].m_value.store(m_tasks[i].m_predecessorCount, AZStd::memory_order_relaxed);
+        }
+        m_remaining.store(taskCount, AZStd::memory_order_release);
+
+        for (AZ::u32 root : m_roots)
+        {
+            targetExecutor.Enqueue(*this, root);
+        }
+    }
+
+    bool TaskGraph::OnTaskCompleted(AZ::u32 taskIndex, TaskExecutor& executor)
+    {
+        const Task& task = m_tasks[taskIndex];
+        for (AZ::u32 i = 0; i < task.m_successorCount; ++i)
+        {
+            const AZ::u32 successor = m_successors[task.m_successorOffset + i];
+            if (m_pendingPredecessors[successor].m_value.fetch_sub(1, AZStd::memory_order_acq_rel) == 1)
+            {
+                executor.Enqueue(*this, successor);
+            }
+        }
+
+        // The graph may be resubmitted or destroyed as soon as the last task is accounted for, so the event
+        // has to be read before decrementing.
+        TaskGraphEvent* waitEvent = m_waitEvent;
+        if (m_remaining.fetch_sub(1, AZStd::memory_order_acq_rel) == 1)
+        {
+            if (waitEvent)
+            {
+                waitEvent->Signal();
+            }
+            return true;
+        }
+        return false;
+    }
+}
@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Task/TaskDescriptor.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/binary_semaphore.h>
+#include <AzCore/std/utils.h>
+
+namespace AZ
+{
+    class TaskExecutor;
+    class TaskGraph;
+
+    /**
+     * Handle to a task added to a TaskGraph, used to declare the dependencies between tasks.
+     * Tokens are only valid for the graph that created them, and only until the graph is reset.
+     */
+    class TaskToken final
+    {
+    public:
+        //! Declares that this task must complete before any of the given tasks can start.
+        template<typename... Tokens>
+        void Precedes(TaskToken& first, Tokens&... rest);
+
+        //! Declares that all of the given tasks must complete before this task can start.
+        template<typename... Tokens>
+        void Follows(TaskToken& first, Tokens&... rest);
+
+        AZ::u32 GetIndex() const { return m_index; }
+
+    private:
+        friend class TaskGraph;
+
+        TaskToken(TaskGraph& parent, AZ::u32 index)
+            : m_parent{ parent }
+            , m_index{ index }
+        {
+        }
+
+        void PrecedesInternal(TaskToken& other);
+
+        TaskGraph& m_parent;
+        AZ::u32 m_index;
+    };
+
+    /**
+     * Signaled once every task of a submitted graph has run. An event can be reused across submissions once it
+     * has been waited on.
+     */
+    class TaskGraphEvent final
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(TaskGraphEvent, SystemAllocator, 0);
+
+        //! Returns true if the graph this event was submitted with has finished.
+        bool IsSignaled() const;
+
+        //! Blocks the calling thread until the graph this event was submitted with has finished. Only one thread
+        //! may wait on an event, and Wait must be called before a signaled event is destroyed.
+        //! Must not be called from a task running on a TaskExecutor worker.
+        void Wait();
+
+    private:
+        friend class TaskGraph;
+
+        void Reset();
+        void Signal();
+
+        AZStd::binary_semaphore m_semaphore;
+        AZStd::atomic_bool m_signaled{ true };
+    };
+
+    /**
+     * A directed acyclic graph of tasks. The graph is declared once (tasks + dependencies), then frozen and
+     * submitted to a TaskExecutor as many times as needed, typically once per frame. Submitting a frozen graph
+     * does not allocate: the dependency counters are reset in place from the values computed at freeze time.
+     *
+     * \code{.cpp}
+     * AZ::TaskGraph graph;
+     * AZ::TaskToken cull = graph.AddTask(s_cullDesc, [&]{ Cull(); });
+     * AZ::TaskToken draw = graph.AddTask(s_drawDesc, [&]{ Draw(); });
+     * cull.Precedes(draw);
+     * graph.Freeze();
+     *
+     * AZ::TaskGraphEvent finished;
+     * graph.Submit(&finished); // every frame
+     * finished.Wait();
+     * \endcode
+     */
+    class TaskGraph final
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(TaskGraph, SystemAllocator, 0);
+
+        TaskGraph() = default;
+        ~TaskGraph();
+
+        TaskGraph(const TaskGraph&) = delete;
+        TaskGraph& operator=(const TaskGraph&) = delete;
+
+        //! Adds a task to the graph. The graph must not be frozen.
+        template<typename Lambda>
+        TaskToken AddTask(const TaskDescriptor& descriptor, Lambda&& lambda);
+
+        //! Compiles the dependency information. After this call no tasks or dependencies can be added,
+        //! but the graph can be submitted any number of times. Submit will freeze the graph if needed.
+        void Freeze();
+
+        //! Removes all tasks so the graph can be declared again. The graph must not be in flight.
+        void Reset();
+
+        //! Queues all the tasks without predecessors. The graph must not already be in flight.
+        //! \param waitEvent Optional event signaled when the last task completes.
+        //! \param executor Executor to run on, the global TaskExecutor is used when null.
+        void Submit(TaskGraphEvent* waitEvent = nullptr, TaskExecutor* executor = nullptr);
+
+        bool IsEmpty() const { return m_tasks.empty(); }
+        bool IsFrozen() const { return m_frozen; }
+        bool IsInFlight() const { return m_remaining.load(AZStd::memory_order_acquire) != 0; }
+        size_t GetTaskCount() const { return m_tasks.size(); }
+
+    private:
+        friend class TaskToken;
+        friend class TaskExecutor;
+
+        struct Task
+        {
+            Task(const TaskDescriptor& descriptor, AZStd::function<void()>&& function)
+                : m_descriptor{ descriptor }
+                , m_function{ AZStd::move(function) }
+            {
+            }
+
+            TaskDescriptor m_descriptor;
+            AZStd::function<void()> m_function;
+            AZ::u32 m_predecessorCount = 0; ///< Number of tasks that must complete before this one, fixed at freeze time.
+            AZ::u32 m_successorOffset = 0;  ///< Offset of the first successor in m_successors.
+            AZ::u32 m_successorCount = 0;
+        };
+
+        // Atomics are not copyable, wrap them so the counters can live in a vector sized at freeze time.
+        struct Counter
+        {
+            Counter() = default;
+            Counter(const Counter& rhs)
+                : m_value{ rhs.m_value.load(AZStd::memory_order_relaxed) }
+            {
+            }
+            Counter& operator=(const Counter& rhs)
+            {
+                m_value.store(rhs.m_value.load(AZStd::memory_order_relaxed), AZStd::memory_order_relaxed);
+                return *this;
+            }
+            AZStd::atomic<AZ::u32> m_value{ 0 };
+        };
+
+        void AddLink(AZ::u32 from, AZ::u32 to);
+
+        // Called by the executor once the task at taskIndex has run. Returns true if this was the last task.
+        bool OnTaskCompleted(AZ::u32 taskIndex, TaskExecutor& executor);
+
+        AZStd::vector<Task> m_tasks;
+        AZStd::vector<AZStd::pair<AZ::u32, AZ::u32>> m_links;  ///< Dependencies declared before freezing.
+        AZStd::vector<AZ::u32> m_successors;                   ///< Successor indices of all tasks, packed per task.
+        AZStd::vector<AZ::u32> m_roots;                        ///< Tasks without predecessors.
+        AZStd::vector<Counter> m_pendingPredecessors;          ///< Per task runtime counters, reset on submit.
+        AZStd::atomic<AZ::u32> m_remaining{ 0 };
+        TaskGraphEvent* m_waitEvent = nullptr;
+        bool m_frozen = false;
+    };
+
+    template<typename... Tokens>
+    void TaskToken::Precedes(TaskToken& first, Tokens&... rest)
+    {
+        PrecedesInternal(first);
+        (PrecedesInternal(rest), ...);
+    }
+
+    template<typename... Tokens>
+    void TaskToken::Follows(TaskToken& first, Tokens&... rest)
+    {
+        first.PrecedesInternal(*this);
+        (rest.PrecedesInternal(*this), ...);
+    }
+
+    template<typename Lambda>
+    TaskToken TaskGraph::AddTask(const TaskDescriptor& descriptor, Lambda&& lambda)
+    {
+        AZ_Assert(!m_frozen, "Tasks can't be added to a frozen TaskGraph, call Reset first.");
+        const AZ::u32 index = static_cast<AZ::u32>(m_tasks.size());
+        m_tasks.emplace_back(descriptor, AZStd::function<void()>(AZStd::forward<Lambda>(lambda)));
+        return TaskToken{ *this, index };
+    }
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Utils/CpuFeatures.h>
+
+namespace AZ::CpuFeatures
+{
+    CpuFeature GetSupported()
+    {
+        static const CpuFeature s_supported = Platform::DetectCpuFeatures();
+        return s_supported;
+    }
+
+    bool IsSupported(CpuFeature features)
+    {
+        return (GetSupported() & features) == features;
+    }
+
+    namespace Internal
+    {
+        CpuFeature DecodeX86Features(AZ::u32 leaf1Ecx, AZ::u32 leaf7Ebx, AZ::u64 xcr0)
+        {
+            auto hasBit = [](AZ::u32 reg, AZ::u32 bit)
+            {
+                return (reg & (1u << bit)) != 0;
+            };
+
+            CpuFeature features = CpuFeature::None;
+            features |= hasBit(leaf1Ecx, 19) ? CpuFeature::Sse41 : CpuFeature::None;
+            features |= hasBit(leaf1Ecx, 20) ? CpuFeature::Sse42 : CpuFeature::None;
+            features |= hasBit(leaf1Ecx, 23) ? CpuFeature::Popcnt : CpuFeature::None;
+            features |= hasBit(leaf1Ecx, 1) ? CpuFeature::Pclmul : CpuFeature::None;
+            features |= hasBit(leaf7Ebx, 3) ? CpuFeature::Bmi1 : CpuFeature::None;
+            features |= hasBit(leaf7Ebx, 8) ? CpuFeature::Bmi2 : CpuFeature::None;
+
+            // The AVX registers can only be used if the OS saves them, which it reports through XCR0.
+            constexpr AZ::u64 AvxState = 0x6; // SSE and AVX state
+            constexpr AZ::u64 Avx512State = 0xe0; // opmask and upper ZMM state
+            const bool osSavesAvx = hasBit(leaf1Ecx, 27) && (xcr0 & AvxState) == AvxState;
+            if (osSavesAvx && hasBit(leaf1Ecx, 28))
+            {
+                features |= CpuFeature::Avx;
+                features |= hasBit(leaf1Ecx, 12) ? CpuFeature::Fma : CpuFeature::None;
+                features |= hasBit(leaf1Ecx, 29) ? CpuFeature::F16c : CpuFeature::None;
+                features |= hasBit(leaf7Ebx, 5) ? CpuFeature::Avx2 : CpuFeature::None;
+
+                if ((xcr0 & Avx512State) == Avx512State && hasBit(leaf7Ebx, 16))
+                {
+                    features |= CpuFeature::Avx512F;
+                    features |= hasBit(leaf7Ebx, 17) ? CpuFeature::Avx512Dq : CpuFeature::None;
+                    features |= hasBit(leaf7Ebx, 30) ? CpuFeature::Avx512Bw : CpuFeature::None;
+                    features |= hasBit(leaf7Ebx, 31) ? CpuFeature::Avx512Vl : CpuFeature::None;
+                }
+            }
+            return features;
+        }
+    } // namespace Internal
+} // namespace AZ::CpuFeatures
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/typetraits/underlying_type.h>
+
+//! Compiles a single function for a newer instruction set than the rest of the engine, so it can use the intrinsics of the
+//! instruction set while the rest of the binary still runs on older CPUs. The function must only be called after checking
+//! the features with AZ::CpuFeatures::IsSupported. MSVC allows the intrinsics of every instruction set without a flag.
+#if defined(AZ_COMPILER_MSVC)
+#   define AZ_CPU_TARGET_AVX2
+#   define AZ_CPU_TARGET_PCLMUL
+#else
+#   define AZ_CPU_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#   define AZ_CPU_TARGET_PCLMUL __attribute__((target("pclmul,sse4.1")))
+#endif
+
+namespace AZ
+{
+    //! Instruction set extensions that can be checked for at runtime, on top of the baseline the engine is compiled for.
+    enum class CpuFeature : AZ::u32
+    {
+        None = 0,
+        Sse41 = 1 << 0,
+        Sse42 = 1 << 1,
+        Popcnt = 1 << 2,
+        Pclmul = 1 << 3,
+        Avx = 1 << 4,
+        Avx2 = 1 << 5,
+        Fma = 1 << 6,
+        F16c = 1 << 7,
+        Bmi1 = 1 << 8,
+        Bmi2 = 1 << 9,
+        Avx512F = 1 << 10,
+        Avx512Dq = 1 << 11,
+        Avx512Bw = 1 << 12,
+        Avx512Vl = 1 << 13,
+        Neon = 1 << 14,
+    };
+    AZ_DEFINE_ENUM_BITWISE_OPERATORS(CpuFeature);
+
+    namespace CpuFeatures
+    {
+        //! Returns all features supported by both the CPU and the OS. The features are detected on the first call, and the
+        //! AVX features are only reported if the OS saves the wider registers on context switches.
+        CpuFeature GetSupported();
+
+        //! True if all of the given features are supported.
+        bool IsSupported(CpuFeature features);
+
+        //! Returns the implementation to use out of an optimized one and a fallback, based on the features the optimized one
+        //! needs. Meant to initialize a function pointer once, e.g. in a function local static, so the check isn't repeated.
+        template<typename Function>
+        Function Select(CpuFeature features, Function optimized, Function fallback)
+        {
+            return IsSupported(features) ? optimized : fallback;
+        }
+    } // namespace CpuFeatures
+
+    namespace CpuFeatures::Internal
+    {
+        //! Turns the x86 CPUID feature registers into features. leaf1Ecx is ECX of leaf 1, leaf7Ebx is EBX of leaf 7
+        //! sub-leaf 0, and xcr0 is the extended control register the OS sets up, or 0 if the OS doesn't support XSAVE.
+        CpuFeature DecodeX86Features(AZ::u32 leaf1Ecx, AZ::u32 leaf7Ebx, AZ::u64 xcr0);
+    }
+
+    namespace Platform
+    {
+        //! Queries the CPU for its features. Returns None on platforms without runtime detection.
+        CpuFeature DetectCpuFeatures();
+    }
+} // namespace AZ
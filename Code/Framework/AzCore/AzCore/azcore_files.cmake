@@ -56,6 +56,10 @@ set(FILES
     Component/NamedEntityId.h
     Component/NonUniformScaleBus.cpp
     Component/NonUniformScaleBus.h
+    Component/ScheduledTick.cpp
+    Component/ScheduledTick.h
+    Component/ScheduledTickSystemComponent.cpp
+    Component/ScheduledTickSystemComponent.h
     Component/TickBus.h
     Component/TransformBus.h
     Console/Console.cpp
@@ -149,6 +153,7 @@ set(FILES
     EBus/ScheduledEventHandle.h
     EBus/Internal/BusContainer.h
     EBus/Internal/CallstackEntry.h
+    EBus/Internal/CoalescedEventQueue.h
     EBus/Internal/Debug.h
     EBus/Internal/Handlers.h
     EBus/Internal/StoragePolicies.h
@@ -193,6 +198,8 @@ set(FILES
     IO/Streamer/FileRequest.cpp
     IO/Streamer/FullFileDecompressor.h
     IO/Streamer/FullFileDecompressor.cpp
+    IO/Streamer/PersistentCache.h
+    IO/Streamer/PersistentCache.cpp
     IO/Streamer/ReadSplitter.h
     IO/Streamer/ReadSplitter.cpp
     IO/Streamer/RequestPath.h
@@ -216,6 +223,8 @@ set(FILES
     IPC/SharedMemory.cpp
     IPC/SharedMemory.h
     Jobs/Algorithms.h
+    Jobs/CpuTopology.cpp
+    Jobs/CpuTopology.h
     Jobs/Internal/JobManagerBase.cpp
     Jobs/Internal/JobManagerBase.h
     Jobs/Internal/JobManagerWorkStealing.cpp
@@ -241,6 +250,8 @@ set(FILES
     Math/Aabb.cpp
     Math/Aabb.h
     Math/Aabb.inl
+    Math/BatchMath.cpp
+    Math/BatchMath.h
     Math/Color.cpp
     Math/Color.h
     Math/Color.inl
@@ -313,6 +324,8 @@ set(FILES
     Math/Quaternion.cpp
     Math/Quaternion.inl
     Math/Quaternion.h
+    Math/QuaternionWide.h
+    Math/QuaternionWide.inl
     Math/Random.h
     Math/Sfmt.cpp
     Math/Sfmt.h
@@ -333,6 +346,8 @@ set(FILES
     Math/Transform.inl
     Math/TransformSerializer.cpp
     Math/TransformSerializer.h
+    Math/TransformWide.h
+    Math/TransformWide.inl
     Math/Uuid.cpp
     Math/Uuid.h
     Math/UuidSerializer.h
@@ -343,6 +358,8 @@ set(FILES
     Math/Vector3.cpp
     Math/Vector3.h
     Math/Vector3.inl
+    Math/Vector3Wide.h
+    Math/Vector3Wide.inl
     Math/Vector4.cpp
     Math/Vector4.h
     Math/Vector4.inl
@@ -359,6 +376,8 @@ set(FILES
     Math/ToString.cpp
     Memory/AllocationRecords.cpp
     Memory/AllocationRecords.h
+    Memory/AllocationSampler.cpp
+    Memory/AllocationSampler.h
     Memory/AllocatorBase.cpp
     Memory/AllocatorBase.h
     Memory/AllocatorManager.cpp
@@ -373,6 +392,8 @@ set(FILES
     Memory/BestFitExternalMapSchema.h
     Memory/Config.h
     Memory/dlmalloc.inl
+    Memory/FrameArenaAllocator.cpp
+    Memory/FrameArenaAllocator.h
     Memory/HeapSchema.h
     Memory/HphaSchema.cpp
     Memory/HphaSchema.h
@@ -524,6 +545,8 @@ set(FILES
     Serialization/Json/JsonSerializationSettings.h
     Serialization/Json/JsonSerializer.h
     Serialization/Json/JsonSerializer.cpp
+    Serialization/Json/JsonStreamDeserializer.h
+    Serialization/Json/JsonStreamDeserializer.cpp
     Serialization/Json/JsonStringConversionUtils.h
     Serialization/Json/JsonSystemComponent.h
     Serialization/Json/JsonSystemComponent.cpp
@@ -570,6 +593,11 @@ set(FILES
     Statistics/TimeDataStatisticsManager.h
     StringFunc/StringFunc.cpp
     StringFunc/StringFunc.h
+    Task/TaskDescriptor.h
+    Task/TaskExecutor.cpp
+    Task/TaskExecutor.h
+    Task/TaskGraph.cpp
+    Task/TaskGraph.h
     UserSettings/UserSettings.cpp
     UserSettings/UserSettings.h
     UserSettings/UserSettingsComponent.cpp
@@ -602,6 +630,8 @@ set(FILES
     JSON/writer.h
     JSON/error/en.h
     JSON/error/error.h
+    Utils/CpuFeatures.cpp
+    Utils/CpuFeatures.h
     Utils/TypeHash.cpp
     Utils/TypeHash.h
     Utils/Utils.cpp
@@ -51,6 +51,10 @@ set(FILES
     containers/fixed_unordered_map.h
     containers/fixed_unordered_set.h
     containers/fixed_vector.h
+    containers/flat_hash_map.h
+    containers/flat_hash_set.h
+    containers/flat_hash_table.h
+    containers/flat_map.h
     containers/forward_list.h
     containers/intrusive_list.h
     containers/intrusive_set.h
@@ -93,6 +97,7 @@ set(FILES
     parallel/containers/concurrent_vector.h
     parallel/containers/lock_free_intrusive_stack.h
     parallel/containers/lock_free_intrusive_stamped_stack.h
+    parallel/containers/lock_free_mpsc_ring.h
     parallel/containers/lock_free_queue.h
     parallel/containers/lock_free_stack.h
     parallel/containers/lock_free_stamped_queue.h
@@ -103,6 +108,7 @@ set(FILES
     delegate/delegate_fwd.h
     function/function_base.h
     function/function_fwd.h
+    function/function_ref.h
     function/function_template.h
     function/identity.h
     function/invoke.h
@@ -162,6 +168,7 @@ set(FILES
     typetraits/is_base_of.h
     typetraits/is_class.h
     typetraits/is_compound.h
+    typetraits/is_constant_evaluated.h
     typetraits/is_constructible.h
     typetraits/is_const.h
     typetraits/is_convertible.h
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/containers/flat_hash_table.h>
+#include <AzCore/std/tuple.h>
+
+namespace AZStd
+{
+    namespace Internal
+    {
+        template<class Key, class MappedType, class Hasher, class EqualKey, class Allocator>
+        struct FlatHashMapTraits
+        {
+            using key_type = Key;
+            using mapped_type = MappedType;
+            using value_type = AZStd::pair<Key, MappedType>;
+            using hasher = Hasher;
+            using key_equal = EqualKey;
+            using allocator_type = Allocator;
+
+            static const key_type& key_from_value(const value_type& value)
+            {
+                return value.first;
+            }
+        };
+    } // namespace Internal
+
+    /**
+     * Hash map that stores its elements in a single flat array with open addressing, see \ref flat_hash_table for the details.
+     *
+     * Compared to \ref unordered_map, there's no allocation per element and lookups touch far less memory, so it's a better fit
+     * for maps with small keys and values that are filled and searched a lot, such as id remap tables.
+     * The trade off is that, unlike \ref unordered_map, inserting elements invalidates all iterators, pointers and references
+     * to the elements when the map grows. Erasing elements only invalidates the iterators to the erased elements.
+     * Iteration is in no particular order.
+     */
+    template<class Key, class MappedType, class Hasher = AZStd::hash<Key>, class EqualKey = AZStd::equal_to<Key>, class Allocator = AZStd::allocator>
+    class flat_hash_map
+        : public flat_hash_table<Internal::FlatHashMapTraits<Key, MappedType, Hasher, EqualKey, Allocator>>
+    {
+        using base_type = flat_hash_table<Internal::FlatHashMapTraits<Key, MappedType, Hasher, EqualKey, Allocator>>;
+
+    public:
+        using key_type = typename base_type::key_type;
+        using mapped_type = MappedType;
+        using value_type = typename base_type::value_type;
+        using size_type = typename base_type::size_type;
+        using iterator = typename base_type::iterator;
+        using const_iterator = typename base_type::const_iterator;
+
+        using base_type::base_type;
+
+        template<class... Args>
+        AZStd::pair<iterator, bool> try_emplace(const key_type& key, Args&&... args)
+        {
+            return TryEmplaceImpl(key, AZStd::forward<Args>(args)...);
+        }
+
+        template<class... Args>
+        AZStd::pair<iterator, bool> try_emplace(key_type&& key, Args&&... args)
+        {
+            return TryEmplaceImpl(AZStd::move(key), AZStd::forward<Args>(args)...);
+        }
+
+        template<class M>
+        AZStd::pair<iterator, bool> insert_or_assign(const key_type& key, M&& value)
+        {
+            AZStd::pair<iterator, bool> result = TryEmplaceImpl(key, AZStd::forward<M>(value));
+            if (!result.second)
+            {
+                result.first->second = AZStd::forward<M>(value);
+            }
+            return result;
+        }
+
+        template<class M>
+        AZStd::pair<iterator, bool> insert_or_assign(key_type&& key, M&& value)
+        {
+            AZStd::pair<iterator, bool> result = TryEmplaceImpl(AZStd::move(key), AZStd::forward<M>(value));
+            if (!result.second)
+            {
+                result.first->second = AZStd::forward<M>(value);
+            }
+            return result;
+        }
+
+        mapped_type& operator[](const key_type& key)
+        {
+            return TryEmplaceImpl(key).first->second;
+        }
+
+        mapped_type& operator[](key_type&& key)
+        {
+            return TryEmplaceImpl(AZStd::move(key)).first->second;
+        }
+
+        mapped_type& at(const key_type& key)
+        {
+            iterator it = this->find(key);
+            AZSTD_CONTAINER_ASSERT(it != this->end(), "Element with key is not present");
+            return it->second;
+        }
+
+        const mapped_type& at(const key_type& key) const
+        {
+            const_iterator it = this->find(key);
+            AZSTD_CONTAINER_ASSERT(it != this->end(), "Element with key is not present");
+            return it->second;
+        }
+
+    private:
+        template<class K, class... Args>
+        AZStd::pair<iterator, bool> TryEmplaceImpl(K&& key, Args&&... args)
+        {
+            return this->EmplaceWithKey(key, AZStd::piecewise_construct,
+                AZStd::forward_as_tuple(AZStd::forward<K>(key)), AZStd::forward_as_tuple(AZStd::forward<Args>(args)...));
+        }
+    };
+
+    template<class Key, class MappedType, class Hasher, class EqualKey, class Allocator>
+    void swap(
+        flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& lhs,
+        flat_hash_map<Key, MappedType, Hasher, EqualKey, Allocator>& rhs)
+    {
+        lhs.swap(rhs);
+    }
+} // namespace AZStd
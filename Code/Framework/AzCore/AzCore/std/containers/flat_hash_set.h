@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/containers/flat_hash_table.h>
+
+namespace AZStd
+{
+    namespace Internal
+    {
+        template<class Key, class Hasher, class EqualKey, class Allocator>
+        struct FlatHashSetTraits
+        {
+            using key_type = Key;
+            using value_type = Key;
+            using hasher = Hasher;
+            using key_equal = EqualKey;
+            using allocator_type = Allocator;
+
+            static const key_type& key_from_value(const value_type& value)
+            {
+                return value;
+            }
+        };
+    } // namespace Internal
+
+    /**
+     * Hash set that stores its elements in a single flat array with open addressing, see \ref flat_hash_table for the details.
+     * Like \ref flat_hash_map, inserting elements invalidates all iterators, pointers and references to the elements when the set
+     * grows, and iteration is in no particular order.
+     */
+    template<class Key, class Hasher = AZStd::hash<Key>, class EqualKey = AZStd::equal_to<Key>, class Allocator = AZStd::allocator>
+    class flat_hash_set
+        : public flat_hash_table<Internal::FlatHashSetTraits<Key, Hasher, EqualKey, Allocator>>
+    {
+        using base_type = flat_hash_table<Internal::FlatHashSetTraits<Key, Hasher, EqualKey, Allocator>>;
+
+    public:
+        using base_type::base_type;
+    };
+
+    template<class Key, class Hasher, class EqualKey, class Allocator>
+    void swap(flat_hash_set<Key, Hasher, EqualKey, Allocator>& lhs, flat_hash_set<Key, Hasher, EqualKey, Allocator>& rhs)
+    {
+        lhs.swap(rhs);
+    }
+} // namespace AZStd
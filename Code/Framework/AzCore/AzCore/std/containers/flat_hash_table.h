@@ -0,0 +1,941 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Math/MathIntrinsics.h>
+#include <AzCore/std/allocator.h>
+#include <AzCore/std/functional_basic.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/iterator.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/typetraits/alignment_of.h>
+#include <AzCore/std/typetraits/conditional.h>
+#include <AzCore/std/typetraits/is_destructible.h>
+#include <AzCore/std/utils.h>
+
+#include <initializer_list>
+#include <string.h>
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+#   include <emmintrin.h>
+#endif
+
+namespace AZStd
+{
+    namespace Internal
+    {
+        namespace FlatHashTable
+        {
+            //! Every slot of the table has a control byte. Full slots store the lower 7 bits of the hash of their key, which leaves the
+            //! high bit for the empty and deleted markers.
+            using ctrl_t = AZ::s8;
+            static constexpr ctrl_t CtrlEmpty = -128; // 0b10000000
+            static constexpr ctrl_t CtrlDeleted = -2; // 0b11111110
+
+            inline bool IsFull(ctrl_t control)
+            {
+                return control >= 0;
+            }
+
+            //! Set of control bytes in a group. Every control byte in the group has Shift bits in the mask, of which the highest one
+            //! is raised for the control bytes in the set.
+            template<size_t Width, size_t Shift>
+            class BitMask
+            {
+            public:
+                explicit BitMask(AZ::u64 mask)
+                    : m_mask(mask)
+                {
+                }
+
+                explicit operator bool() const
+                {
+                    return m_mask != 0;
+                }
+
+                //! Index in the group of the first control byte in the set.
+                size_t LowestIndex() const
+                {
+                    return az_ctz_u64(m_mask) >> Shift;
+                }
+
+                void ClearLowest()
+                {
+                    m_mask &= m_mask - 1;
+                }
+
+                //! Number of control bytes before the first one in the set.
+                size_t NumBeforeFirst() const
+                {
+                    return az_ctz_u64(m_mask) >> Shift;
+                }
+
+                //! Number of control bytes after the last one in the set.
+                size_t NumAfterLast() const
+                {
+                    constexpr size_t UnusedBits = 64 - (Width << Shift);
+                    return (az_clz_u64(m_mask) - UnusedBits) >> Shift;
+                }
+
+            private:
+                AZ::u64 m_mask;
+            };
+
+#if AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+            //! Matches a group of 16 control bytes at once with SSE2 instructions.
+            class Group
+            {
+            public:
+                static constexpr size_t Width = 16;
+                using Mask = BitMask<Width, 0>;
+
+                explicit Group(const ctrl_t* position)
+                    : m_control(_mm_loadu_si128(reinterpret_cast<const __m128i*>(position)))
+                {
+                }
+
+                //! Control bytes of full slots with the given hash bits. This can contain false positives, which are rejected when the
+                //! keys are compared.
+                Mask Match(ctrl_t hashBits) const
+                {
+                    return Mask(static_cast<AZ::u16>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(hashBits), m_control))));
+                }
+
+                Mask MatchEmpty() const
+                {
+                    return Mask(static_cast<AZ::u16>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(CtrlEmpty), m_control))));
+                }
+
+                Mask MatchEmptyOrDeleted() const
+                {
+                    // Empty and deleted are the only control values with the high bit set.
+                    return Mask(static_cast<AZ::u16>(_mm_movemask_epi8(m_control)));
+                }
+
+            private:
+                __m128i m_control;
+            };
+#else
+            //! Matches a group of 8 control bytes at once using the bits of a 64-bit integer. The control bytes are loaded in little
+            //! endian order, so lower bits belong to the control bytes of lower slots.
+            class Group
+            {
+            public:
+                static constexpr size_t Width = 8;
+                using Mask = BitMask<Width, 3>;
+
+                explicit Group(const ctrl_t* position)
+                {
+                    memcpy(&m_control, position, sizeof(m_control));
+                }
+
+                //! Control bytes of full slots with the given hash bits. This can contain false positives, which are rejected when the
+                //! keys are compared.
+                Mask Match(ctrl_t hashBits) const
+                {
+                    const AZ::u64 x = m_control ^ (LowBits * static_cast<AZ::u8>(hashBits));
+                    return Mask((x - LowBits) & ~x & HighBits);
+                }
+
+                Mask MatchEmpty() const
+                {
+                    // Empty is the only control value with the high bit set and the second bit cleared.
+                    return Mask((m_control & (~m_control << 6)) & HighBits);
+                }
+
+                Mask MatchEmptyOrDeleted() const
+                {
+                    // Empty and deleted are the only control values with the high bit set and the lowest bit cleared.
+                    return Mask((m_control & (~m_control << 7)) & HighBits);
+                }
+
+            private:
+                static constexpr AZ::u64 LowBits = 0x0101010101010101ull;
+                static constexpr AZ::u64 HighBits = 0x8080808080808080ull;
+
+                AZ::u64 m_control;
+            };
+#endif
+
+            //! Number of control bytes that are checked at once.
+            static constexpr size_t GroupWidth = Group::Width;
+        } // namespace FlatHashTable
+    } // namespace Internal
+
+    /**
+     * Open addressing hash table that stores its elements in a single flat array, based on the design of the
+     * <a href="https://abseil.io/about/design/swisstables">Swiss tables</a>. This is the shared implementation of
+     * \ref flat_hash_map and \ref flat_hash_set.
+     * Next to the elements there's an array with a control byte per element that holds 7 bits of the hash of its key, which
+     * allows a lookup to check a group of elements at once without touching the elements themselves. The group is 16 control
+     * bytes checked with SSE2 instructions where available, and 8 control bytes checked with 64-bit integer math otherwise.
+     *
+     * Traits need to provide the key_type, value_type, hasher, key_equal and allocator_type types, as well as a static
+     * key_from_value function that returns the key of an element.
+     */
+    template<class Traits>
+    class flat_hash_table
+    {
+        using ctrl_t = Internal::FlatHashTable::ctrl_t;
+        using Group = Internal::FlatHashTable::Group;
+        using BitMask = typename Group::Mask;
+        static constexpr size_t GroupWidth = Internal::FlatHashTable::GroupWidth;
+
+    public:
+        using traits_type = Traits;
+        using key_type = typename Traits::key_type;
+        using value_type = typename Traits::value_type;
+        using size_type = AZStd::size_t;
+        using difference_type = AZStd::ptrdiff_t;
+        using hasher = typename Traits::hasher;
+        using key_equal = typename Traits::key_equal;
+        using allocator_type = typename Traits::allocator_type;
+        using reference = value_type&;
+        using const_reference = const value_type&;
+        using pointer = value_type*;
+        using const_pointer = const value_type*;
+
+        template<bool IsConst>
+        class iterator_impl
+        {
+            friend class flat_hash_table;
+            friend class iterator_impl<!IsConst>;
+
+        public:
+            using iterator_category = AZStd::forward_iterator_tag;
+            using value_type = typename flat_hash_table::value_type;
+            using difference_type = AZStd::ptrdiff_t;
+            using pointer = AZStd::conditional_t<IsConst, const value_type*, value_type*>;
+            using reference = AZStd::conditional_t<IsConst, const value_type&, value_type&>;
+
+            iterator_impl() = default;
+
+            //! Converts an iterator into a const_iterator.
+            template<bool OtherIsConst, class = AZStd::enable_if_t<IsConst && !OtherIsConst>>
+            iterator_impl(const iterator_impl<OtherIsConst>& rhs)
+                : m_control(rhs.m_control)
+                , m_slot(rhs.m_slot)
+                , m_controlEnd(rhs.m_controlEnd)
+            {
+            }
+
+            reference operator*() const
+            {
+                return *m_slot;
+            }
+
+            pointer operator->() const
+            {
+                return m_slot;
+            }
+
+            iterator_impl& operator++()
+            {
+                ++m_control;
+                ++m_slot;
+                SkipEmptySlots();
+                return *this;
+            }
+
+            iterator_impl operator++(int)
+            {
+                iterator_impl result = *this;
+                ++(*this);
+                return result;
+            }
+
+            friend bool operator==(const iterator_impl& lhs, const iterator_impl& rhs)
+            {
+                return lhs.m_slot == rhs.m_slot;
+            }
+
+            friend bool operator!=(const iterator_impl& lhs, const iterator_impl& rhs)
+            {
+                return lhs.m_slot != rhs.m_slot;
+            }
+
+        private:
+            iterator_impl(const ctrl_t* control, value_type* slot, const ctrl_t* controlEnd)
+                : m_control(control)
+                , m_slot(slot)
+                , m_controlEnd(controlEnd)
+            {
+            }
+
+            void SkipEmptySlots()
+            {
+                while (m_control != m_controlEnd && !Internal::FlatHashTable::IsFull(*m_control))
+                {
+                    ++m_control;
+                    ++m_slot;
+                }
+            }
+
+            const ctrl_t* m_control = nullptr;
+            value_type* m_slot = nullptr;
+            const ctrl_t* m_controlEnd = nullptr;
+        };
+
+        using iterator = iterator_impl<false>;
+        using const_iterator = iterator_impl<true>;
+
+        flat_hash_table() = default;
+
+        explicit flat_hash_table(
+            size_type bucketCount, const hasher& hash = hasher(), const key_equal& keyEqual = key_equal(),
+            const allocator_type& allocator = allocator_type())
+            : m_hasher(hash)
+            , m_keyEqual(keyEqual)
+            , m_allocator(allocator)
+        {
+            reserve(bucketCount);
+        }
+
+        explicit flat_hash_table(const allocator_type& allocator)
+            : m_allocator(allocator)
+        {
+        }
+
+        template<class InputIterator>
+        flat_hash_table(
+            InputIterator first, InputIterator last, size_type bucketCount = 0, const hasher& hash = hasher(),
+            const key_equal& keyEqual = key_equal(), const allocator_type& allocator = allocator_type())
+            : flat_hash_table(bucketCount, hash, keyEqual, allocator)
+        {
+            insert(first, last);
+        }
+
+        flat_hash_table(
+            std::initializer_list<value_type> list, size_type bucketCount = 0, const hasher& hash = hasher(),
+            const key_equal& keyEqual = key_equal(), const allocator_type& allocator = allocator_type())
+            : flat_hash_table(list.begin(), list.end(), bucketCount, hash, keyEqual, allocator)
+        {
+        }
+
+        flat_hash_table(const flat_hash_table& rhs)
+            : m_hasher(rhs.m_hasher)
+            , m_keyEqual(rhs.m_keyEqual)
+            , m_allocator(rhs.m_allocator)
+        {
+            CopyElementsFrom(rhs);
+        }
+
+        flat_hash_table(const flat_hash_table& rhs, const allocator_type& allocator)
+            : m_hasher(rhs.m_hasher)
+            , m_keyEqual(rhs.m_keyEqual)
+            , m_allocator(allocator)
+        {
+            CopyElementsFrom(rhs);
+        }
+
+        flat_hash_table(flat_hash_table&& rhs)
+            : m_hasher(AZStd::move(rhs.m_hasher))
+            , m_keyEqual(AZStd::move(rhs.m_keyEqual))
+            , m_allocator(AZStd::move(rhs.m_allocator))
+        {
+            StealElementsFrom(rhs);
+        }
+
+        ~flat_hash_table()
+        {
+            DestroyElements();
+            Deallocate();
+        }
+
+        flat_hash_table& operator=(const flat_hash_table& rhs)
+        {
+            if (this != &rhs)
+            {
+                clear();
+                m_hasher = rhs.m_hasher;
+                m_keyEqual = rhs.m_keyEqual;
+                CopyElementsFrom(rhs);
+            }
+            return *this;
+        }
+
+        flat_hash_table& operator=(flat_hash_table&& rhs)
+        {
+            if (this != &rhs)
+            {
+                DestroyElements();
+                Deallocate();
+                m_hasher = AZStd::move(rhs.m_hasher);
+                m_keyEqual = AZStd::move(rhs.m_keyEqual);
+                m_allocator = AZStd::move(rhs.m_allocator);
+                StealElementsFrom(rhs);
+            }
+            return *this;
+        }
+
+        flat_hash_table& operator=(std::initializer_list<value_type> list)
+        {
+            clear();
+            insert(list);
+            return *this;
+        }
+
+        iterator begin()
+        {
+            iterator result(m_control, m_slots, m_control + m_capacity);
+            result.SkipEmptySlots();
+            return result;
+        }
+        const_iterator begin() const
+        {
+            const_iterator result(m_control, m_slots, m_control + m_capacity);
+            result.SkipEmptySlots();
+            return result;
+        }
+        const_iterator cbegin() const
+        {
+            return begin();
+        }
+        iterator end()
+        {
+            return iterator(m_control + m_capacity, m_slots + m_capacity, m_control + m_capacity);
+        }
+        const_iterator end() const
+        {
+            return const_iterator(m_control + m_capacity, m_slots + m_capacity, m_control + m_capacity);
+        }
+        const_iterator cend() const
+        {
+            return end();
+        }
+
+        bool empty() const
+        {
+            return m_size == 0;
+        }
+        size_type size() const
+        {
+            return m_size;
+        }
+        size_type max_size() const
+        {
+            return AZStd::numeric_limits<difference_type>::max() / (sizeof(value_type) + 1);
+        }
+        //! Number of elements the table has memory for, including the ones that need to stay empty to keep lookups fast.
+        size_type bucket_count() const
+        {
+            return m_capacity;
+        }
+        float load_factor() const
+        {
+            return m_capacity != 0 ? static_cast<float>(m_size) / static_cast<float>(m_capacity) : 0.0f;
+        }
+        float max_load_factor() const
+        {
+            return 7.0f / 8.0f;
+        }
+
+        hasher hash_function() const
+        {
+            return m_hasher;
+        }
+        key_equal key_eq() const
+        {
+            return m_keyEqual;
+        }
+        allocator_type& get_allocator()
+        {
+            return m_allocator;
+        }
+        const allocator_type& get_allocator() const
+        {
+            return m_allocator;
+        }
+
+        //! Destroys all elements but keeps the memory. Use rehash(0) afterwards to release the memory as well.
+        void clear()
+        {
+            DestroyElements();
+            if (m_capacity != 0)
+            {
+                ResetControl();
+            }
+            m_growthLeft = MaxLoad(m_capacity);
+        }
+
+        //! Makes sure count elements can be stored without the table growing.
+        void reserve(size_type count)
+        {
+            if (count > m_size + m_growthLeft)
+            {
+                Resize(CapacityFor(count));
+            }
+        }
+
+        //! Resizes the table to the smallest capacity that fits the given number of elements and the elements in the table.
+        //! A count of 0 on an empty table releases all memory.
+        void rehash(size_type count)
+        {
+            const size_type newCapacity = CapacityFor(AZStd::max(count, m_size));
+            if (newCapacity == 0)
+            {
+                Deallocate();
+            }
+            else if (newCapacity != m_capacity)
+            {
+                Resize(newCapacity);
+            }
+        }
+
+        AZStd::pair<iterator, bool> insert(const value_type& value)
+        {
+            return EmplaceWithKey(Traits::key_from_value(value), value);
+        }
+
+        AZStd::pair<iterator, bool> insert(value_type&& value)
+        {
+            return EmplaceWithKey(Traits::key_from_value(value), AZStd::move(value));
+        }
+
+        template<class InputIterator>
+        void insert(InputIterator first, InputIterator last)
+        {
+            for (; first != last; ++first)
+            {
+                insert(*first);
+            }
+        }
+
+        void insert(std::initializer_list<value_type> list)
+        {
+            reserve(m_size + list.size());
+            insert(list.begin(), list.end());
+        }
+
+        template<class... Args>
+        AZStd::pair<iterator, bool> emplace(Args&&... args)
+        {
+            // The key is needed to find out if the element is already in the table, so the element is constructed up front.
+            value_type value(AZStd::forward<Args>(args)...);
+            return insert(AZStd::move(value));
+        }
+
+        //! Erases the element and returns the iterator to the next element. Other iterators stay valid.
+        iterator erase(const_iterator position)
+        {
+            const size_type index = position.m_slot - m_slots;
+            EraseAt(index);
+            iterator result(m_control + index, m_slots + index, m_control + m_capacity);
+            result.SkipEmptySlots();
+            return result;
+        }
+
+        iterator erase(iterator position)
+        {
+            return erase(const_iterator(position));
+        }
+
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            while (first != last)
+            {
+                first = erase(first);
+            }
+            return iterator(last.m_control, last.m_slot, last.m_controlEnd);
+        }
+
+        size_type erase(const key_type& key)
+        {
+            const size_type index = FindIndex(key, HashKey(key));
+            if (index == InvalidIndex)
+            {
+                return 0;
+            }
+            EraseAt(index);
+            return 1;
+        }
+
+        iterator find(const key_type& key)
+        {
+            const size_type index = FindIndex(key, HashKey(key));
+            return index != InvalidIndex ? IteratorAt(index) : end();
+        }
+
+        const_iterator find(const key_type& key) const
+        {
+            const size_type index = FindIndex(key, HashKey(key));
+            return index != InvalidIndex ? ConstIteratorAt(index) : end();
+        }
+
+        bool contains(const key_type& key) const
+        {
+            return FindIndex(key, HashKey(key)) != InvalidIndex;
+        }
+
+        size_type count(const key_type& key) const
+        {
+            return contains(key) ? 1 : 0;
+        }
+
+        //! Lookups with types other than the key type, if both the hasher and the key equal functor are transparent.
+        //! @{
+        template<class ComparableToKey>
+        auto find(const ComparableToKey& key)
+            -> enable_if_t<Internal::is_transparent<key_equal, ComparableToKey>::value && Internal::is_transparent<hasher, ComparableToKey>::value, iterator>
+        {
+            const size_type index = FindIndex(key, HashKey(key));
+            return index != InvalidIndex ? IteratorAt(index) : end();
+        }
+
+        template<class ComparableToKey>
+        auto find(const ComparableToKey& key) const
+            -> enable_if_t<Internal::is_transparent<key_equal, ComparableToKey>::value && Internal::is_transparent<hasher, ComparableToKey>::value, const_iterator>
+        {
+            const size_type index = FindIndex(key, HashKey(key));
+            return index != InvalidIndex ? ConstIteratorAt(index) : end();
+        }
+
+        template<class ComparableToKey>
+        auto contains(const ComparableToKey& key) const
+            -> enable_if_t<Internal::is_transparent<key_equal, ComparableToKey>::value && Internal::is_transparent<hasher, ComparableToKey>::value, bool>
+        {
+            return FindIndex(key, HashKey(key)) != InvalidIndex;
+        }
+
+        template<class ComparableToKey>
+        auto count(const ComparableToKey& key) const
+            -> enable_if_t<Internal::is_transparent<key_equal, ComparableToKey>::value && Internal::is_transparent<hasher, ComparableToKey>::value, size_type>
+        {
+            return contains(key) ? 1 : 0;
+        }
+        //! @}
+
+        void swap(flat_hash_table& rhs)
+        {
+            AZStd::swap(m_control, rhs.m_control);
+            AZStd::swap(m_slots, rhs.m_slots);
+            AZStd::swap(m_capacity, rhs.m_capacity);
+            AZStd::swap(m_size, rhs.m_size);
+            AZStd::swap(m_growthLeft, rhs.m_growthLeft);
+            AZStd::swap(m_hasher, rhs.m_hasher);
+            AZStd::swap(m_keyEqual, rhs.m_keyEqual);
+            AZStd::swap(m_allocator, rhs.m_allocator);
+        }
+
+    protected:
+        //! Constructs a new element from the arguments if no element with the key is in the table yet. The key is only used for the
+        //! lookup, so it needs to match the key of the element the arguments construct.
+        template<class K, class... Args>
+        AZStd::pair<iterator, bool> EmplaceWithKey(const K& key, Args&&... args)
+        {
+            const size_t hash = HashKey(key);
+            size_type index = FindIndex(key, hash);
+            if (index != InvalidIndex)
+            {
+                return { IteratorAt(index), false };
+            }
+
+            index = PrepareInsert(hash);
+            ::new (static_cast<void*>(m_slots + index)) value_type(AZStd::forward<Args>(args)...);
+            return { IteratorAt(index), true };
+        }
+
+    private:
+        static constexpr size_type InvalidIndex = static_cast<size_type>(-1);
+
+        //! The maximum number of elements for a capacity, which keeps at least one empty slot so lookups always end.
+        static size_type MaxLoad(size_type capacity)
+        {
+            return capacity - capacity / 8;
+        }
+
+        //! The capacity is always a power of two of at least the group width, or zero when nothing is allocated.
+        static size_type CapacityFor(size_type count)
+        {
+            if (count == 0)
+            {
+                return 0;
+            }
+            size_type capacity = GroupWidth;
+            while (MaxLoad(capacity) < count)
+            {
+                capacity *= 2;
+            }
+            return capacity;
+        }
+
+        static size_type AllocationSize(size_type capacity)
+        {
+            // The control bytes of the first group are repeated after the last slot, so a group can be loaded at any slot.
+            return capacity * sizeof(value_type) + capacity + GroupWidth;
+        }
+
+        //! Spreads the bits of the hash, as the hash of integer types is often the value itself.
+        template<class K>
+        size_t HashKey(const K& key) const
+        {
+            const AZ::u64 product = static_cast<AZ::u64>(m_hasher(key)) * 0x9E3779B97F4A7C15ull;
+            return static_cast<size_t>(product ^ (product >> 32));
+        }
+
+        //! Where the probe for a hash starts.
+        static size_t HashPosition(size_t hash)
+        {
+            return hash >> 7;
+        }
+
+        //! The hash bits stored in the control byte.
+        static ctrl_t HashBits(size_t hash)
+        {
+            return static_cast<ctrl_t>(hash & 0x7F);
+        }
+
+        iterator IteratorAt(size_type index)
+        {
+            return iterator(m_control + index, m_slots + index, m_control + m_capacity);
+        }
+
+        const_iterator ConstIteratorAt(size_type index) const
+        {
+            return const_iterator(m_control + index, m_slots + index, m_control + m_capacity);
+        }
+
+        void SetControl(size_type index, ctrl_t control)
+        {
+            m_control[index] = control;
+            if (index < GroupWidth)
+            {
+                m_control[index + m_capacity] = control;
+            }
+        }
+
+        void ResetControl()
+        {
+            memset(m_control, static_cast<AZ::u8>(Internal::FlatHashTable::CtrlEmpty), m_capacity + GroupWidth);
+        }
+
+        template<class K>
+        size_type FindIndex(const K& key, size_t hash) const
+        {
+            if (m_capacity == 0)
+            {
+                return InvalidIndex;
+            }
+
+            // Groups are probed with increasing steps, which visits every group once the capacity is a power of two.
+            const size_type mask = m_capacity - 1;
+            const ctrl_t hashBits = HashBits(hash);
+            size_type position = HashPosition(hash) & mask;
+            size_type step = 0;
+            while (true)
+            {
+                Group group(m_control + position);
+                for (BitMask match = group.Match(hashBits); match; match.ClearLowest())
+                {
+                    const size_type index = (position + match.LowestIndex()) & mask;
+                    if (m_keyEqual(Traits::key_from_value(m_slots[index]), key))
+                    {
+                        return index;
+                    }
+                }
+                if (group.MatchEmpty())
+                {
+                    return InvalidIndex;
+                }
+                step += GroupWidth;
+                position = (position + step) & mask;
+            }
+        }
+
+        size_type FindFirstNonFull(size_t hash) const
+        {
+            const size_type mask = m_capacity - 1;
+            size_type position = HashPosition(hash) & mask;
+            size_type step = 0;
+            while (true)
+            {
+                BitMask match = Group(m_control + position).MatchEmptyOrDeleted();
+                if (match)
+                {
+                    return (position + match.LowestIndex()) & mask;
+                }
+                step += GroupWidth;
+                position = (position + step) & mask;
+            }
+        }
+
+        //! Claims a slot for a new element with the given hash. The element still needs to be constructed in the slot.
+        size_type PrepareInsert(size_t hash)
+        {
+            size_type index = m_capacity != 0 ? FindFirstNonFull(hash) : InvalidIndex;
+            if (index == InvalidIndex || (m_growthLeft == 0 && m_control[index] != Internal::FlatHashTable::CtrlDeleted))
+            {
+                Grow();
+                index = FindFirstNonFull(hash);
+            }
+            ++m_size;
+            if (m_control[index] == Internal::FlatHashTable::CtrlEmpty)
+            {
+                --m_growthLeft;
+            }
+            SetControl(index, HashBits(hash));
+            return index;
+        }
+
+        void EraseAt(size_type index)
+        {
+            AZSTD_CONTAINER_ASSERT(index < m_capacity && Internal::FlatHashTable::IsFull(m_control[index]), "Erasing an invalid element");
+            m_slots[index].~value_type();
+            --m_size;
+
+            // If this slot is part of a run of less than a group of non-empty slots, no probe went past it, and it can be marked
+            // as empty instead of deleted.
+            const size_type indexBefore = (index - GroupWidth) & (m_capacity - 1);
+            const BitMask emptyAfter = Group(m_control + index).MatchEmpty();
+            const BitMask emptyBefore = Group(m_control + indexBefore).MatchEmpty();
+            const bool wasNeverFull =
+                emptyBefore && emptyAfter && (emptyAfter.NumBeforeFirst() + emptyBefore.NumAfterLast()) < GroupWidth;
+            if (wasNeverFull)
+            {
+                SetControl(index, Internal::FlatHashTable::CtrlEmpty);
+                ++m_growthLeft;
+            }
+            else
+            {
+                SetControl(index, Internal::FlatHashTable::CtrlDeleted);
+            }
+        }
+
+        void Grow()
+        {
+            // When many of the claimed slots are deleted elements, reclaim those instead of growing.
+            if (m_capacity != 0 && m_size * 16 <= m_capacity * 7)
+            {
+                Resize(m_capacity);
+            }
+            else
+            {
+                Resize(m_capacity != 0 ? m_capacity * 2 : GroupWidth);
+            }
+        }
+
+        void Resize(size_type newCapacity)
+        {
+            ctrl_t* oldControl = m_control;
+            value_type* oldSlots = m_slots;
+            const size_type oldCapacity = m_capacity;
+
+            m_slots = reinterpret_cast<value_type*>(
+                m_allocator.allocate(AllocationSize(newCapacity), AZStd::alignment_of<value_type>::value));
+            m_control = reinterpret_cast<ctrl_t*>(m_slots + newCapacity);
+            m_capacity = newCapacity;
+            ResetControl();
+
+            for (size_type i = 0; i < oldCapacity; ++i)
+            {
+                if (Internal::FlatHashTable::IsFull(oldControl[i]))
+                {
+                    const size_t hash = HashKey(Traits::key_from_value(oldSlots[i]));
+                    const size_type index = FindFirstNonFull(hash);
+                    SetControl(index, HashBits(hash));
+                    ::new (static_cast<void*>(m_slots + index)) value_type(AZStd::move(oldSlots[i]));
+                    oldSlots[i].~value_type();
+                }
+            }
+            m_growthLeft = MaxLoad(m_capacity) - m_size;
+
+            if (oldSlots)
+            {
+                m_allocator.deallocate(oldSlots, AllocationSize(oldCapacity), AZStd::alignment_of<value_type>::value);
+            }
+        }
+
+        //! Destroys the elements without updating the control bytes.
+        void DestroyElements()
+        {
+            if constexpr (!AZStd::is_trivially_destructible_v<value_type>)
+            {
+                for (size_type i = 0; i < m_capacity; ++i)
+                {
+                    if (Internal::FlatHashTable::IsFull(m_control[i]))
+                    {
+                        m_slots[i].~value_type();
+                    }
+                }
+            }
+            m_size = 0;
+        }
+
+        void Deallocate()
+        {
+            AZSTD_CONTAINER_ASSERT(m_size == 0, "Elements need to be destroyed before the memory is released");
+            if (m_slots)
+            {
+                m_allocator.deallocate(m_slots, AllocationSize(m_capacity), AZStd::alignment_of<value_type>::value);
+            }
+            m_control = nullptr;
+            m_slots = nullptr;
+            m_capacity = 0;
+            m_growthLeft = 0;
+        }
+
+        void CopyElementsFrom(const flat_hash_table& rhs)
+        {
+            reserve(rhs.m_size);
+            for (const value_type& value : rhs)
+            {
+                const size_type index = PrepareInsert(HashKey(Traits::key_from_value(value)));
+                ::new (static_cast<void*>(m_slots + index)) value_type(value);
+            }
+        }
+
+        void StealElementsFrom(flat_hash_table& rhs)
+        {
+            m_control = rhs.m_control;
+            m_slots = rhs.m_slots;
+            m_capacity = rhs.m_capacity;
+            m_size = rhs.m_size;
+            m_growthLeft = rhs.m_growthLeft;
+            rhs.m_control = nullptr;
+            rhs.m_slots = nullptr;
+            rhs.m_capacity = 0;
+            rhs.m_size = 0;
+            rhs.m_growthLeft = 0;
+        }
+
+        ctrl_t* m_control = nullptr;
+        value_type* m_slots = nullptr; //!< Start of the allocation, which holds the slots followed by the control bytes.
+        size_type m_capacity = 0;
+        size_type m_size = 0;
+        size_type m_growthLeft = 0; //!< Number of empty slots that can be filled before the table needs to grow.
+        hasher m_hasher;
+        key_equal m_keyEqual;
+        allocator_type m_allocator;
+    };
+
+    //! Tables are equal when they contain equal elements, regardless of the order the elements are stored in.
+    template<class Traits>
+    bool operator==(const flat_hash_table<Traits>& lhs, const flat_hash_table<Traits>& rhs)
+    {
+        if (lhs.size() != rhs.size())
+        {
+            return false;
+        }
+        for (const auto& element : lhs)
+        {
+            auto rhsIter = rhs.find(Traits::key_from_value(element));
+            if (rhsIter == rhs.end() || !(*rhsIter == element))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template<class Traits>
+    bool operator!=(const flat_hash_table<Traits>& lhs, const flat_hash_table<Traits>& rhs)
+    {
+        return !(lhs == rhs);
+    }
+} // namespace AZStd
@@ -0,0 +1,428 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional_basic.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/tuple.h>
+
+#include <initializer_list>
+
+namespace AZStd
+{
+    /**
+     * Ordered map that keeps its elements sorted by key in a single \ref vector.
+     * Lookups are a binary search over contiguous memory, and iteration is as fast as iterating a vector, which makes it a good fit
+     * for maps that are filled once and searched or iterated a lot. Inserting and erasing moves all elements after the position,
+     * so for maps that change a lot \ref map or \ref flat_hash_map are a better fit. To fill a map with many elements at once,
+     * insert them as a range, which sorts them once instead of moving the elements for every insertion.
+     * Like a vector, inserting and erasing elements invalidates the iterators, pointers and references to the elements.
+     */
+    template<class Key, class MappedType, class Compare = AZStd::less<Key>, class Allocator = AZStd::allocator>
+    class flat_map
+    {
+        using container_type = AZStd::vector<AZStd::pair<Key, MappedType>, Allocator>;
+
+    public:
+        using key_type = Key;
+        using mapped_type = MappedType;
+        using value_type = AZStd::pair<Key, MappedType>;
+        using key_compare = Compare;
+        using allocator_type = Allocator;
+        using size_type = typename container_type::size_type;
+        using difference_type = typename container_type::difference_type;
+        using reference = value_type&;
+        using const_reference = const value_type&;
+        using pointer = value_type*;
+        using const_pointer = const value_type*;
+        using iterator = typename container_type::iterator;
+        using const_iterator = typename container_type::const_iterator;
+        using reverse_iterator = typename container_type::reverse_iterator;
+        using const_reverse_iterator = typename container_type::const_reverse_iterator;
+
+        class value_compare
+        {
+            friend class flat_map;
+
+        public:
+            bool operator()(const value_type& lhs, const value_type& rhs) const
+            {
+                return m_compare(lhs.first, rhs.first);
+            }
+
+        protected:
+            explicit value_compare(const Compare& compare)
+                : m_compare(compare)
+            {
+            }
+
+            Compare m_compare;
+        };
+
+        flat_map() = default;
+
+        explicit flat_map(const Compare& compare, const allocator_type& allocator = allocator_type())
+            : m_elements(allocator)
+            , m_compare(compare)
+        {
+        }
+
+        explicit flat_map(const allocator_type& allocator)
+            : m_elements(allocator)
+        {
+        }
+
+        template<class InputIterator>
+        flat_map(InputIterator first, InputIterator last, const Compare& compare = Compare(), const allocator_type& allocator = allocator_type())
+            : flat_map(compare, allocator)
+        {
+            insert(first, last);
+        }
+
+        flat_map(std::initializer_list<value_type> list, const Compare& compare = Compare(), const allocator_type& allocator = allocator_type())
+            : flat_map(list.begin(), list.end(), compare, allocator)
+        {
+        }
+
+        flat_map& operator=(std::initializer_list<value_type> list)
+        {
+            clear();
+            insert(list);
+            return *this;
+        }
+
+        iterator begin()
+        {
+            return m_elements.begin();
+        }
+        const_iterator begin() const
+        {
+            return m_elements.begin();
+        }
+        const_iterator cbegin() const
+        {
+            return m_elements.begin();
+        }
+        iterator end()
+        {
+            return m_elements.end();
+        }
+        const_iterator end() const
+        {
+            return m_elements.end();
+        }
+        const_iterator cend() const
+        {
+            return m_elements.end();
+        }
+        reverse_iterator rbegin()
+        {
+            return m_elements.rbegin();
+        }
+        const_reverse_iterator rbegin() const
+        {
+            return m_elements.rbegin();
+        }
+        reverse_iterator rend()
+        {
+            return m_elements.rend();
+        }
+        const_reverse_iterator rend() const
+        {
+            return m_elements.rend();
+        }
+
+        bool empty() const
+        {
+            return m_elements.empty();
+        }
+        size_type size() const
+        {
+            return m_elements.size();
+        }
+        size_type max_size() const
+        {
+            return m_elements.max_size();
+        }
+        size_type capacity() const
+        {
+            return m_elements.capacity();
+        }
+        void reserve(size_type count)
+        {
+            m_elements.reserve(count);
+        }
+        void shrink_to_fit()
+        {
+            m_elements.shrink_to_fit();
+        }
+
+        key_compare key_comp() const
+        {
+            return m_compare;
+        }
+        value_compare value_comp() const
+        {
+            return value_compare(m_compare);
+        }
+        allocator_type& get_allocator()
+        {
+            return m_elements.get_allocator();
+        }
+        const allocator_type& get_allocator() const
+        {
+            return m_elements.get_allocator();
+        }
+
+        void clear()
+        {
+            m_elements.clear();
+        }
+
+        AZStd::pair<iterator, bool> insert(const value_type& value)
+        {
+            return TryEmplaceImpl(value.first, value);
+        }
+
+        AZStd::pair<iterator, bool> insert(value_type&& value)
+        {
+            return TryEmplaceImpl(value.first, AZStd::move(value));
+        }
+
+        //! Inserts all elements in the range and sorts them once. When the range contains multiple elements with the same key, or
+        //! a key that's already in the map, the first one is kept.
+        template<class InputIterator>
+        void insert(InputIterator first, InputIterator last)
+        {
+            const size_type oldSize = m_elements.size();
+            for (; first != last; ++first)
+            {
+                m_elements.emplace_back(*first);
+            }
+            if (m_elements.size() != oldSize)
+            {
+                // The stable sort keeps equal keys in the order they were added in, so the unique pass keeps the first one.
+                AZStd::stable_sort(m_elements.begin(), m_elements.end(), value_compare(m_compare));
+                iterator newEnd = AZStd::unique(m_elements.begin(), m_elements.end(),
+                    [this](const value_type& lhs, const value_type& rhs)
+                    {
+                        return !m_compare(lhs.first, rhs.first) && !m_compare(rhs.first, lhs.first);
+                    });
+                m_elements.erase(newEnd, m_elements.end());
+            }
+        }
+
+        void insert(std::initializer_list<value_type> list)
+        {
+            insert(list.begin(), list.end());
+        }
+
+        template<class... Args>
+        AZStd::pair<iterator, bool> emplace(Args&&... args)
+        {
+            // The key is needed to find the position of the element, so the element is constructed up front.
+            value_type value(AZStd::forward<Args>(args)...);
+            return insert(AZStd::move(value));
+        }
+
+        template<class... Args>
+        AZStd::pair<iterator, bool> try_emplace(const key_type& key, Args&&... args)
+        {
+            return TryEmplaceImpl(key, AZStd::piecewise_construct, AZStd::forward_as_tuple(key),
+                AZStd::forward_as_tuple(AZStd::forward<Args>(args)...));
+        }
+
+        template<class... Args>
+        AZStd::pair<iterator, bool> try_emplace(key_type&& key, Args&&... args)
+        {
+            return TryEmplaceImpl(key, AZStd::piecewise_construct, AZStd::forward_as_tuple(AZStd::move(key)),
+                AZStd::forward_as_tuple(AZStd::forward<Args>(args)...));
+        }
+
+        template<class M>
+        AZStd::pair<iterator, bool> insert_or_assign(const key_type& key, M&& value)
+        {
+            AZStd::pair<iterator, bool> result = try_emplace(key, AZStd::forward<M>(value));
+            if (!result.second)
+            {
+                result.first->second = AZStd::forward<M>(value);
+            }
+            return result;
+        }
+
+        template<class M>
+        AZStd::pair<iterator, bool> insert_or_assign(key_type&& key, M&& value)
+        {
+            AZStd::pair<iterator, bool> result = try_emplace(AZStd::move(key), AZStd::forward<M>(value));
+            if (!result.second)
+            {
+                result.first->second = AZStd::forward<M>(value);
+            }
+            return result;
+        }
+
+        mapped_type& operator[](const key_type& key)
+        {
+            return try_emplace(key).first->second;
+        }
+
+        mapped_type& operator[](key_type&& key)
+        {
+            return try_emplace(AZStd::move(key)).first->second;
+        }
+
+        mapped_type& at(const key_type& key)
+        {
+            iterator it = find(key);
+            AZSTD_CONTAINER_ASSERT(it != end(), "Element with key is not present");
+            return it->second;
+        }
+
+        const mapped_type& at(const key_type& key) const
+        {
+            const_iterator it = find(key);
+            AZSTD_CONTAINER_ASSERT(it != end(), "Element with key is not present");
+            return it->second;
+        }
+
+        iterator erase(const_iterator position)
+        {
+            return m_elements.erase(position);
+        }
+
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            return m_elements.erase(first, last);
+        }
+
+        size_type erase(const key_type& key)
+        {
+            iterator it = find(key);
+            if (it == end())
+            {
+                return 0;
+            }
+            m_elements.erase(it);
+            return 1;
+        }
+
+        iterator find(const key_type& key)
+        {
+            iterator it = lower_bound(key);
+            return (it != end() && !m_compare(key, it->first)) ? it : end();
+        }
+
+        const_iterator find(const key_type& key) const
+        {
+            const_iterator it = lower_bound(key);
+            return (it != end() && !m_compare(key, it->first)) ? it : end();
+        }
+
+        bool contains(const key_type& key) const
+        {
+            return find(key) != end();
+        }
+
+        size_type count(const key_type& key) const
+        {
+            return contains(key) ? 1 : 0;
+        }
+
+        iterator lower_bound(const key_type& key)
+        {
+            return AZStd::lower_bound(m_elements.begin(), m_elements.end(), key, KeyCompare{ m_compare });
+        }
+
+        const_iterator lower_bound(const key_type& key) const
+        {
+            return AZStd::lower_bound(m_elements.begin(), m_elements.end(), key, KeyCompare{ m_compare });
+        }
+
+        iterator upper_bound(const key_type& key)
+        {
+            return AZStd::upper_bound(m_elements.begin(), m_elements.end(), key, KeyCompare{ m_compare });
+        }
+
+        const_iterator upper_bound(const key_type& key) const
+        {
+            return AZStd::upper_bound(m_elements.begin(), m_elements.end(), key, KeyCompare{ m_compare });
+        }
+
+        AZStd::pair<iterator, iterator> equal_range(const key_type& key)
+        {
+            iterator first = lower_bound(key);
+            iterator last = (first != end() && !m_compare(key, first->first)) ? first + 1 : first;
+            return { first, last };
+        }
+
+        AZStd::pair<const_iterator, const_iterator> equal_range(const key_type& key) const
+        {
+            const_iterator first = lower_bound(key);
+            const_iterator last = (first != end() && !m_compare(key, first->first)) ? first + 1 : first;
+            return { first, last };
+        }
+
+        void swap(flat_map& rhs)
+        {
+            m_elements.swap(rhs.m_elements);
+            AZStd::swap(m_compare, rhs.m_compare);
+        }
+
+    private:
+        //! Compares elements with keys in both orders, for the lower and upper bound searches.
+        struct KeyCompare
+        {
+            bool operator()(const value_type& lhs, const key_type& rhs) const
+            {
+                return m_compare(lhs.first, rhs);
+            }
+
+            bool operator()(const key_type& lhs, const value_type& rhs) const
+            {
+                return m_compare(lhs, rhs.first);
+            }
+
+            const Compare& m_compare;
+        };
+
+        //! Constructs a new element from the arguments at its sorted position, if no element with the key is in the map yet.
+        template<class... Args>
+        AZStd::pair<iterator, bool> TryEmplaceImpl(const key_type& key, Args&&... args)
+        {
+            iterator it = lower_bound(key);
+            if (it != end() && !m_compare(key, it->first))
+            {
+                return { it, false };
+            }
+            return { m_elements.emplace(it, AZStd::forward<Args>(args)...), true };
+        }
+
+        container_type m_elements;
+        Compare m_compare;
+    };
+
+    template<class Key, class MappedType, class Compare, class Allocator>
+    bool operator==(const flat_map<Key, MappedType, Compare, Allocator>& lhs, const flat_map<Key, MappedType, Compare, Allocator>& rhs)
+    {
+        return lhs.size() == rhs.size() && AZStd::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    template<class Key, class MappedType, class Compare, class Allocator>
+    bool operator!=(const flat_map<Key, MappedType, Compare, Allocator>& lhs, const flat_map<Key, MappedType, Compare, Allocator>& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    template<class Key, class MappedType, class Compare, class Allocator>
+    void swap(flat_map<Key, MappedType, Compare, Allocator>& lhs, flat_map<Key, MappedType, Compare, Allocator>& rhs)
+    {
+        lhs.swap(rhs);
+    }
+} // namespace AZStd
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/std/function/invoke.h>
+#include <AzCore/std/typetraits/is_function.h>
+#include <AzCore/std/typetraits/is_same.h>
+#include <AzCore/std/typetraits/is_void.h>
+#include <AzCore/std/typetraits/remove_cvref.h>
+#include <AzCore/std/typetraits/remove_reference.h>
+#include <AzCore/std/utils.h>
+
+namespace AZStd
+{
+    template<class Signature>
+    class function_ref;
+
+    /// Non-owning reference to a callable, after the C++26 std::function_ref.
+    /// It is two pointers wide, never allocates and can be copied freely, but it doesn't extend the lifetime of the callable
+    /// it refers to. Use it for callbacks that are only invoked for the duration of the call they are passed to, and
+    /// AZStd::function for callbacks that are stored.
+    template<class R, class... Args>
+    class function_ref<R(Args...)>
+    {
+    public:
+        template<class F, class = enable_if_t<!is_same_v<remove_cvref_t<F>, function_ref> && is_invocable_r_v<R, F&, Args...>>>
+        function_ref(F&& f) noexcept
+        {
+            using FunctionType = remove_reference_t<F>;
+            if constexpr (is_function_v<FunctionType>)
+            {
+                m_storage.m_function = reinterpret_cast<void (*)()>(&f);
+            }
+            else
+            {
+                m_storage.m_object = const_cast<void*>(static_cast<const volatile void*>(AZStd::addressof(f)));
+            }
+            m_invoker = &Invoke<FunctionType>;
+        }
+
+        function_ref(const function_ref&) noexcept = default;
+        function_ref& operator=(const function_ref&) noexcept = default;
+
+        R operator()(Args... args) const
+        {
+            return m_invoker(m_storage, AZStd::forward<Args>(args)...);
+        }
+
+    private:
+        union Storage
+        {
+            void* m_object;
+            void (*m_function)();
+        };
+
+        template<class F>
+        static R Invoke(Storage storage, Args... args)
+        {
+            F* callable;
+            if constexpr (is_function_v<F>)
+            {
+                callable = reinterpret_cast<F*>(storage.m_function);
+            }
+            else
+            {
+                callable = static_cast<F*>(storage.m_object);
+            }
+
+            if constexpr (is_void_v<R>)
+            {
+                AZStd::invoke(*callable, AZStd::forward<Args>(args)...);
+            }
+            else
+            {
+                return AZStd::invoke(*callable, AZStd::forward<Args>(args)...);
+            }
+        }
+
+        Storage m_storage;
+        R (*m_invoker)(Storage, Args...);
+    };
+}
@@ -9,6 +9,12 @@
 #include <AzCore/std/hash.h>
 #include <AzCore/std/algorithm.h>
 
+#include <string.h>
+
+#if defined(AZ_COMPILER_MSVC) && (defined(_M_X64) || defined(_M_ARM64))
+#include <intrin.h>
+#endif
+
 namespace AZStd
 {
     static constexpr AZStd::size_t prime_list[] = {
@@ -28,4 +34,125 @@ namespace AZStd
         const AZStd::size_t* pos = AZStd::lower_bound(first, last, n);
         return (pos == last ? *(last - 1) : *pos);
     }
+
+    namespace HashBytesInternal
+    {
+        static constexpr AZ::u64 Secret[4] = { 0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull, 0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull };
+
+        //! Multiplies a and b to 128 bits, returning the low half in a and the high half in b.
+        static inline void Multiply(AZ::u64& a, AZ::u64& b)
+        {
+#if defined(__SIZEOF_INT128__)
+            const __uint128_t result = static_cast<__uint128_t>(a) * b;
+            a = static_cast<AZ::u64>(result);
+            b = static_cast<AZ::u64>(result >> 64);
+#elif defined(AZ_COMPILER_MSVC) && defined(_M_X64)
+            a = _umul128(a, b, &b);
+#elif defined(AZ_COMPILER_MSVC) && defined(_M_ARM64)
+            const AZ::u64 high = __umulh(a, b);
+            a = a * b;
+            b = high;
+#else
+            const AZ::u64 aHigh = a >> 32;
+            const AZ::u64 aLow = static_cast<AZ::u32>(a);
+            const AZ::u64 bHigh = b >> 32;
+            const AZ::u64 bLow = static_cast<AZ::u32>(b);
+            const AZ::u64 highHigh = aHigh * bHigh;
+            const AZ::u64 highLow = aHigh * bLow;
+            const AZ::u64 lowHigh = aLow * bHigh;
+            const AZ::u64 lowLow = aLow * bLow;
+            const AZ::u64 middle = (lowLow >> 32) + static_cast<AZ::u32>(highLow) + static_cast<AZ::u32>(lowHigh);
+            a = (middle << 32) | static_cast<AZ::u32>(lowLow);
+            b = highHigh + (highLow >> 32) + (lowHigh >> 32) + (middle >> 32);
+#endif
+        }
+
+        static inline AZ::u64 Mix(AZ::u64 a, AZ::u64 b)
+        {
+            Multiply(a, b);
+            return a ^ b;
+        }
+
+        static inline AZ::u64 Read64(const AZ::u8* data)
+        {
+            AZ::u64 value;
+            memcpy(&value, data, sizeof(value));
+            return value;
+        }
+
+        static inline AZ::u64 Read32(const AZ::u8* data)
+        {
+            AZ::u32 value;
+            memcpy(&value, data, sizeof(value));
+            return value;
+        }
+
+        //! Reads 1 to 3 bytes, using every byte at least once.
+        static inline AZ::u64 ReadSmall(const AZ::u8* data, AZStd::size_t size)
+        {
+            return (static_cast<AZ::u64>(data[0]) << 16) | (static_cast<AZ::u64>(data[size >> 1]) << 8) | data[size - 1];
+        }
+    } // namespace HashBytesInternal
+
+    AZ::u64 hash_bytes(const void* data, AZStd::size_t size, AZ::u64 seed)
+    {
+        using namespace HashBytesInternal;
+
+        const AZ::u8* bytes = reinterpret_cast<const AZ::u8*>(data);
+        seed ^= Mix(seed ^ Secret[0], Secret[1]);
+        AZ::u64 a;
+        AZ::u64 b;
+        if (size <= 16)
+        {
+            if (size >= 4)
+            {
+                // Two overlapping reads of 4 bytes from each end cover every byte.
+                const AZStd::size_t middle = (size >> 3) << 2;
+                a = (Read32(bytes) << 32) | Read32(bytes + middle);
+                b = (Read32(bytes + size - 4) << 32) | Read32(bytes + size - 4 - middle);
+            }
+            else if (size > 0)
+            {
+                a = ReadSmall(bytes, size);
+                b = 0;
+            }
+            else
+            {
+                a = 0;
+                b = 0;
+            }
+        }
+        else
+        {
+            AZStd::size_t remaining = size;
+            if (remaining > 48)
+            {
+                // Three independent lanes, so the multiplications of a step don't wait on each other.
+                AZ::u64 seed1 = seed;
+                AZ::u64 seed2 = seed;
+                do
+                {
+                    seed = Mix(Read64(bytes) ^ Secret[1], Read64(bytes + 8) ^ seed);
+                    seed1 = Mix(Read64(bytes + 16) ^ Secret[2], Read64(bytes + 24) ^ seed1);
+                    seed2 = Mix(Read64(bytes + 32) ^ Secret[3], Read64(bytes + 40) ^ seed2);
+                    bytes += 48;
+                    remaining -= 48;
+                } while (remaining > 48);
+                seed ^= seed1 ^ seed2;
+            }
+            while (remaining > 16)
+            {
+                seed = Mix(Read64(bytes) ^ Secret[1], Read64(bytes + 8) ^ seed);
+                bytes += 16;
+                remaining -= 16;
+            }
+            // The last 16 bytes, which may overlap the bytes already processed.
+            a = Read64(bytes + remaining - 16);
+            b = Read64(bytes + remaining - 8);
+        }
+        a ^= Secret[1];
+        b ^= seed;
+        Multiply(a, b);
+        return Mix(a ^ Secret[0] ^ size, b ^ Secret[1]);
+    }
 }
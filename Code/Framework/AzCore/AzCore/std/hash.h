@@ -213,6 +213,11 @@ namespace AZStd
 
     // Bucket size suitable to hold n elements.
     AZStd::size_t hash_next_bucket_size(AZStd::size_t n);
+
+    //! Fast non-cryptographic 64 bit hash of a block of memory, in the style of wyhash. Processes 48 bytes per step with
+    //! 64x64 to 128 bit multiplications and mixes well enough for hash tables that use the low and the high bits.
+    //! The values may change between versions, so they shouldn't be stored or sent over the network.
+    AZ::u64 hash_bytes(const void* data, AZStd::size_t size, AZ::u64 seed = 0);
 }
 
 #endif // AZSTD_HASH_H
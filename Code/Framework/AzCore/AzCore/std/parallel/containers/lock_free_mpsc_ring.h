@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/createdestroy.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/typetraits/aligned_storage.h>
+#include <AzCore/std/utils.h>
+
+namespace AZStd
+{
+    /**
+     * Bounded lock-free ring buffer for multiple producers and a single consumer. Producers claim a slot with a
+     * single compare-and-swap and never block each other on a lock; the consumer pops without any atomic
+     * read-modify-write. Storage is inline and fixed, so the ring never allocates.
+     *
+     * try_push fails when the ring is full so the caller can decide how to handle overflow (for instance spill to
+     * a locked container), it never spins waiting for the consumer.
+     *
+     * Based on the per-slot sequence number design by Dmitry Vyukov.
+     */
+    template<typename T, size_t Capacity>
+    class lock_free_mpsc_ring
+    {
+        static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "lock_free_mpsc_ring capacity must be a power of two.");
+
+    public:
+        typedef T       value_type;
+        typedef size_t  size_type;
+
+        lock_free_mpsc_ring()
+        {
+            for (size_type i = 0; i < Capacity; ++i)
+            {
+                m_slots[i].m_sequence.store(i, memory_order_relaxed);
+            }
+        }
+
+        ~lock_free_mpsc_ring()
+        {
+            T discard;
+            while (try_pop(discard))
+            {
+            }
+        }
+
+        lock_free_mpsc_ring(const lock_free_mpsc_ring&) = delete;
+        lock_free_mpsc_ring& operator=(const lock_free_mpsc_ring&) = delete;
+
+        //! Pushes a value, safe to call from any number of threads. Returns false if the ring is full, in which case
+        //! value is left untouched.
+        template<typename U>
+        bool try_push(U&& value)
+        {
+            size_type position = m_enqueuePosition.load(memory_order_relaxed);
+            while (true)
+            {
+                slot& target = m_slots[position & Mask];
+                const size_type sequence = target.m_sequence.load(memory_order_acquire);
+                const ptrdiff_t difference = static_cast<ptrdiff_t>(sequence) - static_cast<ptrdiff_t>(position);
+                if (difference == 0)
+                {
+                    if (m_enqueuePosition.compare_exchange_weak(position, position + 1, memory_order_relaxed))
+                    {
+                        AZStd::construct_at(target.value_ptr(), AZStd::forward<U>(value));
+                        target.m_sequence.store(position + 1, memory_order_release);
+                        return true;
+                    }
+                    // position was reloaded by the failed compare_exchange, try again.
+                }
+                else if (difference < 0)
+                {
+                    // The consumer hasn't freed this slot yet, the ring is full.
+                    return false;
+                }
+                else
+                {
+                    position = m_enqueuePosition.load(memory_order_relaxed);
+                }
+            }
+        }
+
+        //! Pops the oldest value. Must only be called from the single consumer thread. Returns false if the ring is
+        //! empty or the oldest value is still being written by a producer.
+        bool try_pop(T& value)
+        {
+            slot& target = m_slots[m_dequeuePosition & Mask];
+            const size_type sequence = target.m_sequence.load(memory_order_acquire);
+            if (sequence != m_dequeuePosition + 1)
+            {
+                return false;
+            }
+
+            value = AZStd::move(*target.value_ptr());
+            AZStd::destroy_at(target.value_ptr());
+            target.m_sequence.store(m_dequeuePosition + Capacity, memory_order_release);
+            ++m_dequeuePosition;
+            return true;
+        }
+
+        //! Approximate check, only reliable from the consumer thread when no producers are active.
+        bool empty() const
+        {
+            return m_enqueuePosition.load(memory_order_acquire) == m_dequeuePosition;
+        }
+
+        static constexpr size_type capacity() { return Capacity; }
+
+    private:
+        static constexpr size_type Mask = Capacity - 1;
+
+        struct slot
+        {
+            T* value_ptr() { return reinterpret_cast<T*>(&m_storage); }
+
+            atomic<size_type> m_sequence;
+            aligned_storage_t<sizeof(T), alignof(T)> m_storage;
+        };
+
+        slot m_slots[Capacity];
+        // Producers and the consumer work on opposite ends, keep them on separate cache lines.
+        atomic<size_type> m_enqueuePosition{ 0 };
+        char m_padding[64 - sizeof(atomic<size_type>)];
+        size_type m_dequeuePosition{ 0 };
+    };
+}
@@ -0,0 +1,18 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+namespace AZStd
+{
+    //! C++20 std::is_constant_evaluated. Returns true when called during constant evaluation, which lets constexpr functions
+    //! use a faster implementation at runtime that couldn't be evaluated at compile time.
+    constexpr bool is_constant_evaluated() noexcept
+    {
+        return __builtin_is_constant_evaluated();
+    }
+}
@@ -45,6 +45,7 @@
 #include <AzCore/std/typetraits/is_compound.h>
 #include <AzCore/std/typetraits/is_const.h>
 #include <AzCore/std/typetraits/is_convertible.h>
+#include <AzCore/std/typetraits/is_constant_evaluated.h>
 #include <AzCore/std/typetraits/is_constructible.h>
 #include <AzCore/std/typetraits/is_destructible.h>
 #include <AzCore/std/typetraits/is_empty.h>
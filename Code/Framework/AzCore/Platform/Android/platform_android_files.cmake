@@ -40,6 +40,7 @@ set(FILES
     AzCore/IO/SystemFile_Android.cpp
     AzCore/IO/SystemFile_Android.h
     AzCore/IO/SystemFile_Platform.h
+    ../Common/Default/AzCore/Jobs/CpuTopology_Default.cpp
     AzCore/IPC/SharedMemory_Platform.h
     ../Common/Unimplemented/AzCore/Memory/OverrunDetectionAllocator_Unimplemented.h
     ../Common/UnixLike/AzCore/Memory/OSAllocator_UnixLike.h
@@ -60,6 +61,7 @@ set(FILES
     AzCore/Socket/AzSocket_fwd_Platform.h
     AzCore/Socket/AzSocket_Platform.h
     ../Common/UnixLike/AzCore/std/time_UnixLike.cpp
+    ../Common/Default/AzCore/Utils/CpuFeatures_Default.cpp
     AzCore/Utils/Utils_Android.cpp
     ../Common/Unimplemented/AzCore/Utils/Utils_Unimplemented.cpp
     ../../AzCore/Android/AndroidEnv.cpp
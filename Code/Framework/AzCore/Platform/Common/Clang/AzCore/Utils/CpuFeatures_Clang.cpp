@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Utils/CpuFeatures.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
+
+namespace AZ::Platform
+{
+    CpuFeature DetectCpuFeatures()
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+        if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+        {
+            return CpuFeature::None;
+        }
+        const AZ::u32 leaf1Ecx = ecx;
+
+        AZ::u32 leaf7Ebx = 0;
+        if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx))
+        {
+            leaf7Ebx = ebx;
+        }
+
+        // XGETBV is only available when the OS enabled XSAVE, reading it through inline assembly avoids requiring -mxsave.
+        AZ::u64 xcr0 = 0;
+        if (leaf1Ecx & (1u << 27))
+        {
+            unsigned int xcr0Low = 0, xcr0High = 0;
+            __asm__ volatile("xgetbv" : "=a"(xcr0Low), "=d"(xcr0High) : "c"(0));
+            xcr0 = (static_cast<AZ::u64>(xcr0High) << 32) | xcr0Low;
+        }
+        return CpuFeatures::Internal::DecodeX86Features(leaf1Ecx, leaf7Ebx, xcr0);
+#elif defined(__ARM_NEON)
+        return CpuFeature::Neon;
+#else
+        return CpuFeature::None;
+#endif
+    }
+}
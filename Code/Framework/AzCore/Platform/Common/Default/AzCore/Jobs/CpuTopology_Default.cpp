@@ -0,0 +1,17 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Jobs/CpuTopology.h>
+
+namespace AZ::Platform
+{
+    bool DiscoverCpuTopology([[maybe_unused]] CpuTopology& topology)
+    {
+        return false;
+    }
+}
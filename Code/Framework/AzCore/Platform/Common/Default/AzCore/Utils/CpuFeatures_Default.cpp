@@ -0,0 +1,22 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Utils/CpuFeatures.h>
+
+namespace AZ::Platform
+{
+    CpuFeature DetectCpuFeatures()
+    {
+#if AZ_TRAIT_USE_PLATFORM_SIMD_NEON
+        // NEON is part of the baseline of the platforms that use it, there is nothing to detect.
+        return CpuFeature::Neon;
+#else
+        return CpuFeature::None;
+#endif
+    }
+}
@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Utils/CpuFeatures.h>
+
+#include <intrin.h>
+#include <immintrin.h>
+
+namespace AZ::Platform
+{
+    CpuFeature DetectCpuFeatures()
+    {
+        int regs[4] = {};
+        __cpuid(regs, 0);
+        const int maxLeaf = regs[0];
+        if (maxLeaf < 1)
+        {
+            return CpuFeature::None;
+        }
+
+        __cpuid(regs, 1);
+        const AZ::u32 leaf1Ecx = static_cast<AZ::u32>(regs[2]);
+
+        AZ::u32 leaf7Ebx = 0;
+        if (maxLeaf >= 7)
+        {
+            __cpuidex(regs, 7, 0);
+            leaf7Ebx = static_cast<AZ::u32>(regs[1]);
+        }
+
+        const AZ::u64 xcr0 = (leaf1Ecx & (1u << 27)) ? _xgetbv(0) : 0;
+        return CpuFeatures::Internal::DecodeX86Features(leaf1Ecx, leaf7Ebx, xcr0);
+    }
+}
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/IO/Streamer/StorageDriveConfig_Linux.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace AZ::IO
+{
+    AZStd::shared_ptr<StreamStackEntry> LinuxStorageDriveConfig::AddStreamStackEntry(
+        const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent)
+    {
+        if (!StorageDriveLinux::IsSupported())
+        {
+            // Leave the reads to the previous entry in the stack, which is expected to be the generic storage drive.
+            AZ_Warning("Streamer", false, "io_uring isn't available on this system. The io_uring storage drive won't be used.\n");
+            return parent;
+        }
+
+        StorageDriveLinux::ConstructionOptions options;
+        options.m_enableUnbufferedReads = m_enableUnbufferedReads;
+        options.m_enableRegisteredBuffers = m_enableRegisteredBuffers;
+        options.m_minimalReporting = m_minimalReporting;
+
+        auto stackEntry = AZStd::make_shared<StorageDriveLinux>(
+            m_maxFileHandles, m_maxMetaDataCache, hardware.m_maxPhysicalSectorSize, hardware.m_maxLogicalSectorSize,
+            hardware.m_maxTransfer, m_queueDepth, m_overcommit, options);
+        stackEntry->SetNext(AZStd::move(parent));
+        return stackEntry;
+    }
+
+    void LinuxStorageDriveConfig::Reflect(ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<SerializeContext*>(context); serializeContext != nullptr)
+        {
+            serializeContext->Class<LinuxStorageDriveConfig, IStreamerStackConfig>()
+                ->Version(1)
+                ->Field("MaxFileHandles", &LinuxStorageDriveConfig::m_maxFileHandles)
+                ->Field("MaxMetaDataCache", &LinuxStorageDriveConfig::m_maxMetaDataCache)
+                ->Field("QueueDepth", &LinuxStorageDriveConfig::m_queueDepth)
+                ->Field("Overcommit", &LinuxStorageDriveConfig::m_overcommit)
+                ->Field("EnableUnbufferedReads", &LinuxStorageDriveConfig::m_enableUnbufferedReads)
+                ->Field("EnableRegisteredBuffers", &LinuxStorageDriveConfig::m_enableRegisteredBuffers)
+                ->Field("MinimalReporting", &LinuxStorageDriveConfig::m_minimalReporting);
+        }
+    }
+} // namespace AZ::IO
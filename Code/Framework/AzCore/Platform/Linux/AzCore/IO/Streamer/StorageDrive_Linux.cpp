@@ -0,0 +1,1319 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/std/typetraits/decay.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace AZ::IO
+{
+    namespace IoUring
+    {
+        // The io_uring system calls are used directly rather than through liburing to avoid an additional
+        // dependency. Only the small subset needed for reading is wrapped.
+
+        static int Setup(u32 entries, io_uring_params* params)
+        {
+            return aznumeric_cast<int>(::syscall(__NR_io_uring_setup, entries, params));
+        }
+
+        static int Enter(int ring, u32 toSubmit, u32 minComplete, u32 flags)
+        {
+            return aznumeric_cast<int>(::syscall(__NR_io_uring_enter, ring, toSubmit, minComplete, flags, nullptr, 0));
+        }
+
+        static int Register(int ring, u32 opcode, const void* arguments, u32 argumentCount)
+        {
+            return aznumeric_cast<int>(::syscall(__NR_io_uring_register, ring, opcode, arguments, argumentCount));
+        }
+    } // namespace IoUring
+
+    const AZStd::chrono::microseconds StorageDriveLinux::s_averageSeekTime =
+        AZStd::chrono::milliseconds(9) + // Common average seek time for desktop hdd drives.
+        AZStd::chrono::milliseconds(3); // Rotational latency for a 7200RPM disk
+
+    //
+    // ConstructionOptions
+    //
+
+    StorageDriveLinux::ConstructionOptions::ConstructionOptions()
+        : m_hasSeekPenalty(true)
+        , m_enableUnbufferedReads(false)
+        , m_enableRegisteredBuffers(true)
+        , m_minimalReporting(false)
+    {}
+
+    //
+    // Ring
+    //
+
+    bool StorageDriveLinux::Ring::Initialize(u32 entries)
+    {
+        io_uring_params params{};
+        m_fd = IoUring::Setup(entries, &params);
+        if (m_fd < 0)
+        {
+            return false;
+        }
+
+        m_submissionRingSize = params.sq_off.array + params.sq_entries * sizeof(u32);
+        m_completionRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        const bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (singleMap)
+        {
+            m_submissionRingSize = AZStd::max(m_submissionRingSize, m_completionRingSize);
+            m_completionRingSize = m_submissionRingSize;
+        }
+
+        void* submissionRing = ::mmap(nullptr, m_submissionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+            m_fd, IORING_OFF_SQ_RING);
+        if (submissionRing == MAP_FAILED)
+        {
+            Shutdown();
+            return false;
+        }
+        m_submissionRing = submissionRing;
+
+        if (singleMap)
+        {
+            m_completionRing = m_submissionRing;
+        }
+        else
+        {
+            void* completionRing = ::mmap(nullptr, m_completionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                m_fd, IORING_OFF_CQ_RING);
+            if (completionRing == MAP_FAILED)
+            {
+                Shutdown();
+                return false;
+            }
+            m_completionRing = completionRing;
+        }
+
+        m_submissionEntriesSize = params.sq_entries * sizeof(io_uring_sqe);
+        void* submissionEntries = ::mmap(nullptr, m_submissionEntriesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+            m_fd, IORING_OFF_SQES);
+        if (submissionEntries == MAP_FAILED)
+        {
+            Shutdown();
+            return false;
+        }
+        m_submissionEntries = reinterpret_cast<io_uring_sqe*>(submissionEntries);
+
+        u8* submission = reinterpret_cast<u8*>(m_submissionRing);
+        m_submissionHead = reinterpret_cast<u32*>(submission + params.sq_off.head);
+        m_submissionTail = reinterpret_cast<u32*>(submission + params.sq_off.tail);
+        m_submissionArray = reinterpret_cast<u32*>(submission + params.sq_off.array);
+        m_submissionMask = *reinterpret_cast<u32*>(submission + params.sq_off.ring_mask);
+
+        u8* completion = reinterpret_cast<u8*>(m_completionRing);
+        m_completionHead = reinterpret_cast<u32*>(completion + params.cq_off.head);
+        m_completionTail = reinterpret_cast<u32*>(completion + params.cq_off.tail);
+        m_completionMask = *reinterpret_cast<u32*>(completion + params.cq_off.ring_mask);
+        m_completionEntries = reinterpret_cast<io_uring_cqe*>(completion + params.cq_off.cqes);
+
+        m_entryCount = params.sq_entries;
+        return true;
+    }
+
+    void StorageDriveLinux::Ring::Shutdown()
+    {
+        if (m_submissionEntries)
+        {
+            ::munmap(m_submissionEntries, m_submissionEntriesSize);
+        }
+        if (m_completionRing && m_completionRing != m_submissionRing)
+        {
+            ::munmap(m_completionRing, m_completionRingSize);
+        }
+        if (m_submissionRing)
+        {
+            ::munmap(m_submissionRing, m_submissionRingSize);
+        }
+        if (m_fd >= 0)
+        {
+            ::close(m_fd);
+        }
+        *this = Ring{};
+    }
+
+    io_uring_sqe* StorageDriveLinux::Ring::GetSubmissionEntry()
+    {
+        const u32 head = __atomic_load_n(m_submissionHead, __ATOMIC_ACQUIRE);
+        const u32 tail = *m_submissionTail + m_queuedCount;
+        if (tail - head >= m_entryCount)
+        {
+            return nullptr;
+        }
+
+        const u32 index = tail & m_submissionMask;
+        io_uring_sqe* entry = &m_submissionEntries[index];
+        ::memset(entry, 0, sizeof(io_uring_sqe));
+        m_submissionArray[index] = index;
+        m_queuedCount++;
+        return entry;
+    }
+
+    bool StorageDriveLinux::Ring::Submit()
+    {
+        if (m_queuedCount > 0)
+        {
+            __atomic_store_n(m_submissionTail, *m_submissionTail + m_queuedCount, __ATOMIC_RELEASE);
+            m_unsubmittedCount += m_queuedCount;
+            m_queuedCount = 0;
+        }
+
+        while (m_unsubmittedCount > 0)
+        {
+            int result = IoUring::Enter(m_fd, m_unsubmittedCount, 0, 0);
+            if (result >= 0)
+            {
+                m_unsubmittedCount -= aznumeric_cast<u32>(result);
+            }
+            else if (errno == EAGAIN || errno == EBUSY)
+            {
+                // The kernel is temporarily out of resources or the completion queue needs to be drained first.
+                // The remaining entries stay in the ring and will be submitted on the next call.
+                return true;
+            }
+            else if (errno != EINTR)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    //
+    // FileReadInformation
+    //
+
+    void StorageDriveLinux::FileReadInformation::AllocateAlignedBuffer(size_t size, size_t sectorSize)
+    {
+        AZ_Assert(m_sectorAlignedOutput == nullptr, "Assign a sector aligned buffer when one is already assigned.");
+        m_sectorAlignedOutput = azmalloc(size, sectorSize, AZ::SystemAllocator);
+    }
+
+    void StorageDriveLinux::FileReadInformation::Clear()
+    {
+        if (m_sectorAlignedOutput)
+        {
+            azfree(m_sectorAlignedOutput, AZ::SystemAllocator);
+        }
+        *this = FileReadInformation{};
+    }
+
+    //
+    // StorageDriveLinux
+    //
+
+    bool StorageDriveLinux::IsSupported()
+    {
+        static const bool isSupported = []()
+        {
+            io_uring_params params{};
+            int ring = IoUring::Setup(1, &params);
+            if (ring < 0)
+            {
+                // Either the kernel is too old or io_uring has been disabled, for instance by a container's seccomp profile.
+                return false;
+            }
+            ::close(ring);
+            // IORING_FEAT_NODROP was introduced in the same kernel version (5.5) as asynchronous cancellation and updating
+            // registered files, which are the newest features this drive needs.
+            return (params.features & IORING_FEAT_NODROP) != 0;
+        }();
+        return isSupported;
+    }
+
+    StorageDriveLinux::StorageDriveLinux(u32 maxFileHandles, u32 maxMetaDataCacheEntries, size_t physicalSectorSize,
+        size_t logicalSectorSize, size_t maxTransferSize, u32 queueDepth, s32 overCommit, ConstructionOptions options)
+        : StreamStackEntry("Storage drive (io_uring)")
+        , m_physicalSectorSize(physicalSectorSize)
+        , m_logicalSectorSize(logicalSectorSize)
+        , m_maxTransferSize(maxTransferSize)
+        , m_maxFileHandles(maxFileHandles)
+        , m_queueDepth(queueDepth)
+        , m_overCommit(overCommit)
+        , m_constructionOptions(options)
+    {
+        if (m_physicalSectorSize == 0)
+        {
+            m_physicalSectorSize = 4_kib;
+            AZ_Error("StorageDriveLinux", false,
+                "Received physical sector size of 0 for %s. Picking a sector size of %zu instead.\n", m_name.c_str(), m_physicalSectorSize);
+        }
+        if (m_logicalSectorSize == 0)
+        {
+            m_logicalSectorSize = 512;
+            AZ_Error("StorageDriveLinux", false,
+                "Received logical sector size of 0 for %s. Picking a sector size of %zu instead.\n", m_name.c_str(), m_logicalSectorSize);
+        }
+        AZ_Error("StorageDriveLinux", IStreamerTypes::IsPowerOf2(m_physicalSectorSize) && IStreamerTypes::IsPowerOf2(m_logicalSectorSize),
+            "StorageDriveLinux requires power-of-2 sector sizes. Received physical: %zu and logical: %zu",
+            m_physicalSectorSize, m_logicalSectorSize);
+
+        if (m_queueDepth == 0)
+        {
+            m_queueDepth = 32;
+            AZ_Warning("StorageDriveLinux", false,
+                "Received queue depth of 0 for %s. Picking a depth of %u instead.\n", m_name.c_str(), m_queueDepth);
+        }
+        // Make sure that the overCommit isn't so small that no slots are ever reported.
+        if (aznumeric_cast<s32>(m_queueDepth) + m_overCommit <= 0)
+        {
+            AZ_Error("StorageDriveLinux", false,
+                "Received overcommit (%i) for %s that subtracts more than the queue depth (%u). Setting combined count to 1.\n",
+                m_overCommit, m_name.c_str(), m_queueDepth);
+            m_overCommit = 1 - aznumeric_cast<s32>(m_queueDepth);
+        }
+
+        // Add initial dummy values to the stats to avoid division by zero later on and avoid needing branches.
+        m_readSizeAverage.PushEntry(1);
+        m_readTimeAverage.PushEntry(AZStd::chrono::microseconds(1));
+
+        AZ_Assert(IStreamerTypes::IsPowerOf2(maxMetaDataCacheEntries),
+            "StorageDriveLinux requires a power-of-2 for maxMetaDataCacheEntries. Received %zu", maxMetaDataCacheEntries);
+        m_metaDataCache_paths.resize(maxMetaDataCacheEntries);
+        m_metaDataCache_fileSize.resize(maxMetaDataCacheEntries);
+
+        // Every read slot can have a read and a cancellation in the submission queue at the same time.
+        u32 ringEntries = 1;
+        while (ringEntries < m_queueDepth * 2)
+        {
+            ringEntries <<= 1;
+        }
+        m_ringInitialized = m_ring.Initialize(ringEntries);
+        if (!m_ringInitialized)
+        {
+            AZ_Warning("StorageDriveLinux", false, "Failed to set up io_uring for %s (Error: %i). All requests will be forwarded.\n",
+                m_name.c_str(), errno);
+            return;
+        }
+
+        // Register a sparse file table so reads can use fixed files, which avoids the kernel looking up the file
+        // descriptor for every read. File descriptors are inserted as files get opened.
+        AZStd::vector<int> sparseFiles(m_maxFileHandles, -1);
+        m_hasRegisteredFiles =
+            IoUring::Register(m_ring.m_fd, IORING_REGISTER_FILES, sparseFiles.data(), aznumeric_cast<u32>(sparseFiles.size())) == 0;
+
+        if (m_constructionOptions.m_enableUnbufferedReads && m_constructionOptions.m_enableRegisteredBuffers && m_maxTransferSize > 0)
+        {
+            const size_t bufferSize = AZ_SIZE_ALIGN_UP(m_maxTransferSize, m_physicalSectorSize);
+            m_registeredBuffers.resize(m_queueDepth);
+            for (iovec& buffer : m_registeredBuffers)
+            {
+                buffer.iov_base = azmalloc(bufferSize, m_physicalSectorSize, AZ::SystemAllocator);
+                buffer.iov_len = bufferSize;
+            }
+            if (IoUring::Register(m_ring.m_fd, IORING_REGISTER_BUFFERS, m_registeredBuffers.data(),
+                aznumeric_cast<u32>(m_registeredBuffers.size())) != 0)
+            {
+                AZ_Warning("StorageDriveLinux", false,
+                    "Unable to register %zu read buffers of %zu bytes for %s (Error: %i). Falling back to unregistered buffers. "
+                    "Raising the limit for locked memory (ulimit -l) may be needed.\n",
+                    m_registeredBuffers.size(), bufferSize, m_name.c_str(), errno);
+                for (iovec& buffer : m_registeredBuffers)
+                {
+                    azfree(buffer.iov_base, AZ::SystemAllocator);
+                }
+                m_registeredBuffers.clear();
+            }
+        }
+
+        if (!m_constructionOptions.m_minimalReporting)
+        {
+            AZ_Printf("Streamer", "%s created with a queue depth of %u.\n", m_name.c_str(), m_queueDepth);
+        }
+    }
+
+    StorageDriveLinux::~StorageDriveLinux()
+    {
+        // Closing the ring cancels outstanding reads, which have all completed at this point as the scheduler keeps
+        // processing until the stack is idle before it shuts down.
+        m_ring.Shutdown();
+
+        for (int file : m_fileCache_handles)
+        {
+            if (file >= 0)
+            {
+                ::close(file);
+            }
+        }
+        for (iovec& buffer : m_registeredBuffers)
+        {
+            azfree(buffer.iov_base, AZ::SystemAllocator);
+        }
+        for (FileReadInformation& readInfo : m_readSlots_readInfo)
+        {
+            readInfo.Clear();
+        }
+        if (m_ringInitialized && !m_constructionOptions.m_minimalReporting)
+        {
+            AZ_Printf("Streamer", "%s destroyed.\n", m_name.c_str());
+        }
+    }
+
+    void StorageDriveLinux::PrepareRequest(FileRequest* request)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+        AZ_Assert(request, "PrepareRequest was provided a null request.");
+
+        if (m_ringInitialized && AZStd::holds_alternative<FileRequest::ReadRequestData>(request->GetCommand()))
+        {
+            auto& readRequest = AZStd::get<FileRequest::ReadRequestData>(request->GetCommand());
+            FileRequest* read = m_context->GetNewInternalRequest();
+            read->CreateRead(request, readRequest.m_output, readRequest.m_outputSize, readRequest.m_path,
+                readRequest.m_offset, readRequest.m_size);
+            m_context->PushPreparedRequest(read);
+            return;
+        }
+        StreamStackEntry::PrepareRequest(request);
+    }
+
+    void StorageDriveLinux::QueueRequest(FileRequest* request)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+        AZ_Assert(request, "QueueRequest was provided a null request.");
+
+        if (!m_ringInitialized)
+        {
+            StreamStackEntry::QueueRequest(request);
+            return;
+        }
+
+        AZStd::visit([this, request](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData>)
+            {
+                m_pendingReadRequests.push_back(request);
+                return;
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::FileExistsCheckData> ||
+                AZStd::is_same_v<Command, FileRequest::FileMetaDataRetrievalData>)
+            {
+                m_pendingRequests.push_back(request);
+                return;
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::CancelData>)
+            {
+                if (CancelRequest(request, args.m_target))
+                {
+                    // Only forward if this isn't part of the request chain, otherwise the storage device should
+                    // be the last step as it doesn't forward any (sub)requests.
+                    return;
+                }
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::FlushData>)
+            {
+                FlushCache(args.m_path);
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::FlushAllData>)
+            {
+                FlushEntireCache();
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::ReportData>)
+            {
+                Report(args);
+            }
+            StreamStackEntry::QueueRequest(request);
+        }, request->GetCommand());
+    }
+
+    bool StorageDriveLinux::ExecuteRequests()
+    {
+        if (!m_ringInitialized)
+        {
+            return StreamStackEntry::ExecuteRequests();
+        }
+
+        bool hasFinalizedReads = FinalizeReads();
+        bool hasWorked = false;
+
+        // Fill all available read slots before submitting so the kernel receives the entire batch in a single call.
+        while (!m_pendingReadRequests.empty())
+        {
+            FileRequest* request = m_pendingReadRequests.front();
+            if (!ReadRequest(request))
+            {
+                break;
+            }
+            m_pendingReadRequests.pop_front();
+            hasWorked = true;
+        }
+
+        if (!m_pendingRequests.empty())
+        {
+            FileRequest* request = m_pendingRequests.front();
+            hasWorked = AZStd::visit([this, request](auto&& args)
+            {
+                using Command = AZStd::decay_t<decltype(args)>;
+                if constexpr (AZStd::is_same_v<Command, FileRequest::FileExistsCheckData>)
+                {
+                    FileExistsRequest(request);
+                    m_pendingRequests.pop_front();
+                    return true;
+                }
+                else if constexpr (AZStd::is_same_v<Command, FileRequest::FileMetaDataRetrievalData>)
+                {
+                    FileMetaDataRetrievalRequest(request);
+                    m_pendingRequests.pop_front();
+                    return true;
+                }
+                else
+                {
+                    AZ_Assert(false, "A request was added to StorageDriveLinux's pending queue that isn't supported.");
+                    return false;
+                }
+            }, request->GetCommand()) || hasWorked;
+        }
+
+        if (!m_ring.Submit())
+        {
+            AZ_Error("StorageDriveLinux", false, "Failed to submit reads for %s (Error: %i).\n", m_name.c_str(), errno);
+        }
+
+        if (!hasFinalizedReads && !hasWorked && m_activeReads_Count > 0 && m_completionEvent < 0)
+        {
+            // Without a completion event the scheduler thread can't be woken up when reads complete, so wait for at
+            // least one read to complete before reporting that there's no more work.
+            AZ_PROFILE_SCOPE_IDLE(AZ::Debug::ProfileCategory::AzCore, "StorageDriveLinux waiting for completion.");
+            IoUring::Enter(m_ring.m_fd, 0, 1, IORING_ENTER_GETEVENTS);
+            hasFinalizedReads = FinalizeReads();
+        }
+
+        return StreamStackEntry::ExecuteRequests() || hasFinalizedReads || hasWorked;
+    }
+
+    void StorageDriveLinux::UpdateStatus(Status& status) const
+    {
+        StreamStackEntry::UpdateStatus(status);
+        if (m_ringInitialized)
+        {
+            status.m_numAvailableSlots = AZStd::min(status.m_numAvailableSlots, CalculateNumAvailableSlots());
+            status.m_isIdle = status.m_isIdle && m_pendingReadRequests.empty() && m_pendingRequests.empty() && (m_activeReads_Count == 0);
+        }
+    }
+
+    void StorageDriveLinux::UpdateCompletionEstimates(AZStd::chrono::system_clock::time_point now, AZStd::vector<FileRequest*>& internalPending,
+        StreamerContext::PreparedQueue::iterator pendingBegin, StreamerContext::PreparedQueue::iterator pendingEnd)
+    {
+        StreamStackEntry::UpdateCompletionEstimates(now, internalPending, pendingBegin, pendingEnd);
+        if (!m_ringInitialized)
+        {
+            return;
+        }
+
+        const RequestPath* activeFile = nullptr;
+        if (m_activeCacheSlot != InvalidFileCacheIndex)
+        {
+            activeFile = &m_fileCache_paths[m_activeCacheSlot];
+        }
+        u64 activeOffset = m_activeOffset;
+
+        // Determine the time of the first available slot
+        AZStd::chrono::system_clock::time_point earliestSlot = AZStd::chrono::system_clock::time_point::max();
+        for (size_t i = 0; i < m_readSlots_readInfo.size(); ++i)
+        {
+            if (m_readSlots_active[i])
+            {
+                const FileReadInformation& read = m_readSlots_readInfo[i];
+                u64 totalBytesRead = m_readSizeAverage.GetTotal();
+                double totalReadTimeUSec = aznumeric_caster(m_readTimeAverage.GetTotal().count());
+                auto readCommand = AZStd::get_if<FileRequest::ReadData>(&read.m_request->GetCommand());
+                AZ_Assert(readCommand, "Request currently reading doesn't contain a read command.");
+                auto endTime = read.m_startTime + AZStd::chrono::microseconds(aznumeric_cast<u64>((readCommand->m_size * totalReadTimeUSec) / totalBytesRead));
+                earliestSlot = AZStd::min(earliestSlot, endTime);
+                read.m_request->SetEstimatedCompletion(endTime);
+            }
+        }
+        if (earliestSlot != AZStd::chrono::system_clock::time_point::max())
+        {
+            now = earliestSlot;
+        }
+
+        // Estimate requests in this stack entry.
+        for (FileRequest* request : m_pendingReadRequests)
+        {
+            EstimateCompletionTimeForRequest(request, now, activeFile, activeOffset);
+        }
+        for (FileRequest* request : m_pendingRequests)
+        {
+            EstimateCompletionTimeForRequest(request, now, activeFile, activeOffset);
+        }
+
+        // Estimate internally pending requests. Because this call will go from the top of the stack to the bottom,
+        // but estimation is calculated from the bottom to the top, this list should be processed in reverse order.
+        for (auto requestIt = internalPending.rbegin(); requestIt != internalPending.rend(); ++requestIt)
+        {
+            EstimateCompletionTimeForRequestChecked(*requestIt, now, activeFile, activeOffset);
+        }
+
+        // Estimate pending requests that have not been queued yet.
+        for (auto requestIt = pendingBegin; requestIt != pendingEnd; ++requestIt)
+        {
+            EstimateCompletionTimeForRequestChecked(*requestIt, now, activeFile, activeOffset);
+        }
+    }
+
+    void StorageDriveLinux::EstimateCompletionTimeForRequest(FileRequest* request, AZStd::chrono::system_clock::time_point& startTime,
+        const RequestPath*& activeFile, u64& activeOffset) const
+    {
+        u64 readSize = 0;
+        u64 offset = 0;
+        const RequestPath* targetFile = nullptr;
+
+        AZStd::visit([&](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData>)
+            {
+                targetFile = &args.m_path;
+                readSize = args.m_size;
+                offset = args.m_offset;
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::CompressedReadData>)
+            {
+                targetFile = &args.m_compressionInfo.m_archiveFilename;
+                readSize = args.m_compressionInfo.m_compressedSize;
+                offset = args.m_compressionInfo.m_offset;
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::FileExistsCheckData>)
+            {
+                readSize = 0;
+                startTime += m_getFileExistsTimeAverage.CalculateAverage();
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::FileMetaDataRetrievalData>)
+            {
+                readSize = 0;
+                startTime += m_getFileMetaDataRetrievalTimeAverage.CalculateAverage();
+            }
+        }, request->GetCommand());
+
+        if (readSize > 0)
+        {
+            if (activeFile && activeFile != targetFile)
+            {
+                if (FindInFileHandleCache(*targetFile) == InvalidFileCacheIndex)
+                {
+                    startTime += m_fileOpenCloseTimeAverage.CalculateAverage();
+                }
+                activeOffset = std::numeric_limits<u64>::max();
+            }
+
+            if (activeOffset != offset && m_constructionOptions.m_hasSeekPenalty)
+            {
+                startTime += s_averageSeekTime;
+            }
+
+            u64 totalBytesRead = m_readSizeAverage.GetTotal();
+            double totalReadTimeUSec = aznumeric_caster(m_readTimeAverage.GetTotal().count());
+            startTime += AZStd::chrono::microseconds(aznumeric_cast<u64>((readSize * totalReadTimeUSec) / totalBytesRead));
+            activeOffset = offset + readSize;
+        }
+        request->SetEstimatedCompletion(startTime);
+    }
+
+    void StorageDriveLinux::EstimateCompletionTimeForRequestChecked(FileRequest* request,
+        AZStd::chrono::system_clock::time_point startTime, const RequestPath*& activeFile, u64& activeOffset) const
+    {
+        AZStd::visit([&, this](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData> ||
+                          AZStd::is_same_v<Command, FileRequest::FileExistsCheckData> ||
+                          AZStd::is_same_v<Command, FileRequest::CompressedReadData>)
+            {
+                EstimateCompletionTimeForRequest(request, startTime, activeFile, activeOffset);
+            }
+        }, request->GetCommand());
+    }
+
+    s32 StorageDriveLinux::CalculateNumAvailableSlots() const
+    {
+        return (m_overCommit + aznumeric_cast<s32>(m_queueDepth)) - aznumeric_cast<s32>(m_pendingReadRequests.size()) -
+            aznumeric_cast<s32>(m_pendingRequests.size()) - m_activeReads_Count;
+    }
+
+    void StorageDriveLinux::InitializeCaches()
+    {
+        m_fileCache_lastTimeUsed.resize(m_maxFileHandles, AZStd::chrono::system_clock::time_point::min());
+        m_fileCache_paths.resize(m_maxFileHandles);
+        m_fileCache_handles.resize(m_maxFileHandles, -1);
+        m_fileCache_activeReads.resize(m_maxFileHandles, 0);
+
+        m_readSlots_readInfo.resize(m_queueDepth);
+        m_readSlots_active.resize(m_queueDepth);
+
+        // Have the kernel signal the scheduler thread when reads complete so it doesn't go to sleep with completions pending.
+        AZ::Platform::StreamerContextThreadSync& threadSync = m_context->GetStreamerThreadSynchronizer();
+        if (threadSync.AreEventHandlesAvailable())
+        {
+            int event = threadSync.CreateEventHandle();
+            if (event >= 0)
+            {
+                if (IoUring::Register(m_ring.m_fd, IORING_REGISTER_EVENTFD, &event, 1) == 0)
+                {
+                    m_completionEvent = event;
+                }
+                else
+                {
+                    threadSync.DestroyEventHandle(event);
+                }
+            }
+        }
+        AZ_Warning("StorageDriveLinux", m_completionEvent >= 0,
+            "%s was unable to register a completion event. The scheduler thread will block while waiting for reads.\n",
+            m_name.c_str());
+
+        m_cachesInitialized = true;
+    }
+
+    auto StorageDriveLinux::OpenFile(size_t& cacheSlot, FileRequest* request, const FileRequest::ReadData& data) -> OpenFileResult
+    {
+        // If the file is already opened for use, use that file handle and update it's last touched time.
+        size_t cacheIndex = FindInFileHandleCache(data.m_path);
+        if (cacheIndex == InvalidFileCacheIndex)
+        {
+            // If the file is not already found in the cache, attempt to claim an available cache entry.
+            cacheIndex = FindAvailableFileHandleCacheIndex();
+            if (cacheIndex == InvalidFileCacheIndex)
+            {
+                // No files ready to be evicted.
+                return OpenFileResult::CacheFull;
+            }
+
+            int file = -1;
+            // Adding explicit scope here for profiling file Open & Close
+            {
+                AZ_PROFILE_SCOPE_DYNAMIC(AZ::Debug::ProfileCategory::AzCore, "StorageDriveLinux::ReadRequest OpenFile %s", m_name.c_str());
+                TIMED_AVERAGE_WINDOW_SCOPE(m_fileOpenCloseTimeAverage);
+
+                int flags = O_RDONLY | O_CLOEXEC;
+                if (m_constructionOptions.m_enableUnbufferedReads)
+                {
+                    flags |= O_DIRECT;
+                }
+                file = ::open(data.m_path.GetAbsolutePath(), flags);
+                if (file < 0 && m_constructionOptions.m_enableUnbufferedReads && errno == EINVAL)
+                {
+                    // Not all file systems (e.g. tmpfs) support O_DIRECT.
+                    file = ::open(data.m_path.GetAbsolutePath(), O_RDONLY | O_CLOEXEC);
+                }
+
+                if (file < 0)
+                {
+                    // Failed to open the file, so let the next entry in the stack try.
+                    StreamStackEntry::QueueRequest(request);
+                    return OpenFileResult::RequestForwarded;
+                }
+
+                CloseCachedFile(cacheIndex);
+            }
+
+            // Fill the cache entry with data about the new file.
+            m_fileCache_handles[cacheIndex] = file;
+            m_fileCache_activeReads[cacheIndex] = 0;
+            m_fileCache_paths[cacheIndex] = data.m_path;
+            SetRegisteredFile(cacheIndex, file);
+        }
+
+        AZ_Assert(m_fileCache_handles[cacheIndex] >= 0, "Found the file '%s' in cache, but file handle is invalid.\n",
+            data.m_path.GetRelativePath());
+
+        // Set the current request and update timestamp, regardless of cache hit or miss.
+        m_fileCache_lastTimeUsed[cacheIndex] = AZStd::chrono::system_clock::now();
+        cacheSlot = cacheIndex;
+        return OpenFileResult::FileOpened;
+    }
+
+    void StorageDriveLinux::SetRegisteredFile(size_t cacheIndex, int file)
+    {
+        if (m_hasRegisteredFiles)
+        {
+            io_uring_files_update update{};
+            update.offset = aznumeric_cast<u32>(cacheIndex);
+            update.fds = reinterpret_cast<u64>(&file);
+            if (IoUring::Register(m_ring.m_fd, IORING_REGISTER_FILES_UPDATE, &update, 1) < 0)
+            {
+                AZ_Warning("StorageDriveLinux", false, "Failed to update the registered files for %s (Error: %i). "
+                    "Falling back to regular file descriptors.\n", m_name.c_str(), errno);
+                m_hasRegisteredFiles = false;
+            }
+        }
+    }
+
+    void StorageDriveLinux::CloseCachedFile(size_t cacheIndex)
+    {
+        if (m_fileCache_handles[cacheIndex] >= 0)
+        {
+            SetRegisteredFile(cacheIndex, -1);
+            ::close(m_fileCache_handles[cacheIndex]);
+            m_fileCache_handles[cacheIndex] = -1;
+        }
+    }
+
+    bool StorageDriveLinux::ReadRequest(FileRequest* request)
+    {
+        AZ_PROFILE_SCOPE_DYNAMIC(AZ::Debug::ProfileCategory::AzCore, "StorageDriveLinux::ReadRequest %s", m_name.c_str());
+
+        if (!m_cachesInitialized)
+        {
+            InitializeCaches();
+        }
+
+        if (m_activeReads_Count >= m_queueDepth)
+        {
+            return false;
+        }
+
+        size_t readSlot = FindAvailableReadSlot();
+        AZ_Assert(readSlot != InvalidReadSlotIndex, "Active read slot count indicates there's a read slot available, but no read slot was found.");
+
+        return ReadRequest(request, readSlot);
+    }
+
+    bool StorageDriveLinux::ReadRequest(FileRequest* request, size_t readSlot)
+    {
+        auto data = AZStd::get_if<FileRequest::ReadData>(&request->GetCommand());
+        AZ_Assert(data, "Read request in StorageDriveLinux doesn't contain read data.");
+
+        size_t fileCacheSlot = InvalidFileCacheIndex;
+        switch (OpenFile(fileCacheSlot, request, *data))
+        {
+        case OpenFileResult::FileOpened:
+            break;
+        case OpenFileResult::RequestForwarded:
+            return true;
+        case OpenFileResult::CacheFull:
+            return false;
+        default:
+            AZ_Assert(false, "Unsupported OpenFileRequest returned.");
+        }
+
+        u64 readSize = data->m_size;
+        u64 readOffs = data->m_offset;
+        u8* output = reinterpret_cast<u8*>(data->m_output);
+
+        FileReadInformation& readInfo = m_readSlots_readInfo[readSlot];
+        readInfo.m_request = request;
+
+        if (m_constructionOptions.m_enableUnbufferedReads)
+        {
+            // Check alignment of the file read information: size, offset, and address. If any are unaligned to the sector
+            // sizes, read the enclosing sectors into an aligned buffer and copy the requested part out on completion.
+            // See StorageDriveWin::ReadRequest for a detailed description.
+            const bool alignedAddr = IStreamerTypes::IsAlignedTo(data->m_output, aznumeric_caster(m_physicalSectorSize));
+            const bool alignedOffs = IStreamerTypes::IsAlignedTo(data->m_offset, aznumeric_caster(m_logicalSectorSize));
+            if (!alignedOffs)
+            {
+                readOffs = AZ_SIZE_ALIGN_DOWN(readOffs, m_logicalSectorSize);
+                u64 offsetCorrection = data->m_offset - readOffs;
+                readInfo.m_copyBackOffset = offsetCorrection;
+                readSize = data->m_size + offsetCorrection;
+            }
+
+            bool alignedSize = IStreamerTypes::IsAlignedTo(readSize, aznumeric_caster(m_logicalSectorSize));
+            if (!alignedSize)
+            {
+                u64 alignedReadSize = AZ_SIZE_ALIGN_UP(readSize, m_logicalSectorSize);
+                if (alignedReadSize <= data->m_outputSize)
+                {
+                    alignedSize = true;
+                    readSize = alignedReadSize;
+                }
+            }
+
+            if (!(alignedAddr && alignedSize && alignedOffs))
+            {
+                readSize = AZ_SIZE_ALIGN_UP(readSize, m_logicalSectorSize);
+                if (readSlot < m_registeredBuffers.size() && readSize <= m_registeredBuffers[readSlot].iov_len)
+                {
+                    output = reinterpret_cast<u8*>(m_registeredBuffers[readSlot].iov_base);
+                    readInfo.m_usesRegisteredBuffer = true;
+                }
+                else
+                {
+                    readInfo.AllocateAlignedBuffer(readSize, m_physicalSectorSize);
+                    output = reinterpret_cast<u8*>(readInfo.m_sectorAlignedOutput);
+                }
+            }
+        }
+
+        readInfo.m_target = output;
+        readInfo.m_offset = readOffs;
+        readInfo.m_bytesRequested = readSize;
+        readInfo.m_fileHandleIndex = fileCacheSlot;
+
+        if (!QueueRead(readSlot))
+        {
+            // The submission ring is full, try again after the kernel has picked up the queued entries.
+            readInfo.Clear();
+            return false;
+        }
+
+        auto now = AZStd::chrono::system_clock::now();
+        if (m_activeReads_Count++ == 0)
+        {
+            m_activeReads_startTime = now;
+        }
+        readInfo.m_startTime = now;
+        m_readSlots_active[readSlot] = true;
+
+        m_fileCache_activeReads[fileCacheSlot]++;
+        m_activeCacheSlot = fileCacheSlot;
+        m_activeOffset = readOffs + readSize;
+
+        return true;
+    }
+
+    bool StorageDriveLinux::QueueRead(size_t readSlot)
+    {
+        io_uring_sqe* entry = m_ring.GetSubmissionEntry();
+        if (!entry)
+        {
+            return false;
+        }
+
+        FileReadInformation& readInfo = m_readSlots_readInfo[readSlot];
+        const size_t remaining = readInfo.m_bytesRequested - readInfo.m_bytesRead;
+        if (readInfo.m_usesRegisteredBuffer)
+        {
+            entry->opcode = IORING_OP_READ_FIXED;
+            entry->addr = reinterpret_cast<u64>(readInfo.m_target);
+            entry->len = aznumeric_cast<u32>(remaining);
+            entry->buf_index = aznumeric_cast<u16>(readSlot);
+        }
+        else
+        {
+            readInfo.m_ioVector.iov_base = readInfo.m_target;
+            readInfo.m_ioVector.iov_len = remaining;
+            entry->opcode = IORING_OP_READV;
+            entry->addr = reinterpret_cast<u64>(&readInfo.m_ioVector);
+            entry->len = 1;
+        }
+        entry->off = readInfo.m_offset;
+        entry->user_data = readSlot;
+        if (m_hasRegisteredFiles)
+        {
+            entry->fd = aznumeric_cast<s32>(readInfo.m_fileHandleIndex);
+            entry->flags |= IOSQE_FIXED_FILE;
+        }
+        else
+        {
+            entry->fd = m_fileCache_handles[readInfo.m_fileHandleIndex];
+        }
+        return true;
+    }
+
+    bool StorageDriveLinux::CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target)
+    {
+        bool ownsRequestChain = false;
+        for (auto it = m_pendingReadRequests.begin(); it != m_pendingReadRequests.end();)
+        {
+            if ((*it)->WorksOn(target))
+            {
+                (*it)->SetStatus(IStreamerTypes::RequestStatus::Canceled);
+                m_context->MarkRequestAsCompleted(*it);
+                it = m_pendingReadRequests.erase(it);
+                ownsRequestChain = true;
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        // Pending requests have been accounted for, now ask the kernel to cancel any active reads. Reads that can no longer
+        // be canceled will complete as normal.
+        bool hasQueuedCancels = false;
+        for (size_t readSlot = 0; readSlot < m_readSlots_active.size(); ++readSlot)
+        {
+            if (m_readSlots_active[readSlot] && m_readSlots_readInfo[readSlot].m_request->WorksOn(target))
+            {
+                ownsRequestChain = true;
+                if (io_uring_sqe* entry = m_ring.GetSubmissionEntry(); entry != nullptr)
+                {
+                    entry->opcode = IORING_OP_ASYNC_CANCEL;
+                    entry->fd = -1;
+                    entry->addr = readSlot;
+                    entry->user_data = InternalUserData;
+                    hasQueuedCancels = true;
+                }
+            }
+        }
+        if (hasQueuedCancels && !m_ring.Submit())
+        {
+            AZ_Error("StorageDriveLinux", false, "Failed to submit cancellations for %s (Error: %i).\n", m_name.c_str(), errno);
+        }
+
+        if (ownsRequestChain)
+        {
+            cancelRequest->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(cancelRequest);
+        }
+
+        return ownsRequestChain;
+    }
+
+    void StorageDriveLinux::FileExistsRequest(FileRequest* request)
+    {
+        auto& fileExists = AZStd::get<FileRequest::FileExistsCheckData>(request->GetCommand());
+
+        AZ_PROFILE_SCOPE_DYNAMIC(AZ::Debug::ProfileCategory::AzCore, "StorageDriveLinux::FileExistsRequest %s : %s",
+            m_name.c_str(), fileExists.m_path.GetRelativePath());
+        TIMED_AVERAGE_WINDOW_SCOPE(m_getFileExistsTimeAverage);
+
+        if (FindInFileHandleCache(fileExists.m_path) != InvalidFileCacheIndex ||
+            FindInMetaDataCache(fileExists.m_path) != InvalidMetaDataCacheIndex)
+        {
+            fileExists.m_found = true;
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        struct stat attributes;
+        if (::stat(fileExists.m_path.GetAbsolutePath(), &attributes) == 0 && S_ISREG(attributes.st_mode))
+        {
+            size_t cacheIndex = GetNextMetaDataCacheSlot();
+            m_metaDataCache_paths[cacheIndex] = fileExists.m_path;
+            m_metaDataCache_fileSize[cacheIndex] = aznumeric_caster(attributes.st_size);
+            fileExists.m_found = true;
+
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        StreamStackEntry::QueueRequest(request);
+    }
+
+    void StorageDriveLinux::FileMetaDataRetrievalRequest(FileRequest* request)
+    {
+        auto& command = AZStd::get<FileRequest::FileMetaDataRetrievalData>(request->GetCommand());
+
+        AZ_PROFILE_SCOPE_DYNAMIC(AZ::Debug::ProfileCategory::AzCore, "StorageDriveLinux::FileMetaDataRetrievalRequest %s : %s",
+            m_name.c_str(), command.m_path.GetRelativePath());
+        TIMED_AVERAGE_WINDOW_SCOPE(m_getFileMetaDataRetrievalTimeAverage);
+
+        size_t cacheIndex = FindInMetaDataCache(command.m_path);
+        if (cacheIndex != InvalidMetaDataCacheIndex)
+        {
+            command.m_fileSize = m_metaDataCache_fileSize[cacheIndex];
+            command.m_found = true;
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        struct stat attributes;
+        cacheIndex = FindInFileHandleCache(command.m_path);
+        const bool hasAttributes = (cacheIndex != InvalidFileCacheIndex)
+            ? ::fstat(m_fileCache_handles[cacheIndex], &attributes) == 0
+            : ::stat(command.m_path.GetAbsolutePath(), &attributes) == 0;
+        if (!hasAttributes || !S_ISREG(attributes.st_mode))
+        {
+            StreamStackEntry::QueueRequest(request);
+            return;
+        }
+
+        command.m_fileSize = aznumeric_caster(attributes.st_size);
+        command.m_found = true;
+
+        cacheIndex = GetNextMetaDataCacheSlot();
+        m_metaDataCache_paths[cacheIndex] = command.m_path;
+        m_metaDataCache_fileSize[cacheIndex] = command.m_fileSize;
+
+        request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+        m_context->MarkRequestAsCompleted(request);
+    }
+
+    void StorageDriveLinux::FlushCache(const RequestPath& filePath)
+    {
+        if (m_cachesInitialized)
+        {
+            size_t cacheIndex = FindInFileHandleCache(filePath);
+            if (cacheIndex != InvalidFileCacheIndex)
+            {
+                AZ_Assert(m_fileCache_activeReads[cacheIndex] == 0, "Flushing '%s' but it has %u active reads\n",
+                    filePath.GetRelativePath(), m_fileCache_activeReads[cacheIndex]);
+                CloseCachedFile(cacheIndex);
+                m_fileCache_activeReads[cacheIndex] = 0;
+                m_fileCache_lastTimeUsed[cacheIndex] = AZStd::chrono::system_clock::time_point();
+                m_fileCache_paths[cacheIndex].Clear();
+            }
+        }
+
+        size_t cacheIndex = FindInMetaDataCache(filePath);
+        if (cacheIndex != InvalidMetaDataCacheIndex)
+        {
+            m_metaDataCache_paths[cacheIndex].Clear();
+            m_metaDataCache_fileSize[cacheIndex] = 0;
+        }
+    }
+
+    void StorageDriveLinux::FlushEntireCache()
+    {
+        if (m_cachesInitialized)
+        {
+            for (size_t cacheIndex = 0; cacheIndex < m_maxFileHandles; ++cacheIndex)
+            {
+                AZ_Assert(m_fileCache_activeReads[cacheIndex] == 0, "Flushing '%s' but it has %u active reads\n",
+                    m_fileCache_paths[cacheIndex].GetRelativePath(), m_fileCache_activeReads[cacheIndex]);
+                CloseCachedFile(cacheIndex);
+                m_fileCache_activeReads[cacheIndex] = 0;
+                m_fileCache_lastTimeUsed[cacheIndex] = AZStd::chrono::system_clock::time_point();
+                m_fileCache_paths[cacheIndex].Clear();
+            }
+        }
+
+        auto metaDataCacheSize = m_metaDataCache_paths.size();
+        m_metaDataCache_paths.clear();
+        m_metaDataCache_fileSize.clear();
+        m_metaDataCache_front = 0;
+        m_metaDataCache_paths.resize(metaDataCacheSize);
+        m_metaDataCache_fileSize.resize(metaDataCacheSize);
+    }
+
+    bool StorageDriveLinux::FinalizeReads()
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+
+        bool hasWorked = false;
+        u32 head = *m_ring.m_completionHead;
+        const u32 tail = __atomic_load_n(m_ring.m_completionTail, __ATOMIC_ACQUIRE);
+        while (head != tail)
+        {
+            const io_uring_cqe& completion = m_ring.m_completionEntries[head & m_ring.m_completionMask];
+            const u64 userData = completion.user_data;
+            const s32 result = completion.res;
+            // Release the completion entry before processing it as finalizing a read can queue the next one.
+            ++head;
+            __atomic_store_n(m_ring.m_completionHead, head, __ATOMIC_RELEASE);
+
+            if (userData == InternalUserData)
+            {
+                continue;
+            }
+
+            hasWorked = true;
+            const size_t readSlot = aznumeric_cast<size_t>(userData);
+            AZ_Assert(readSlot < m_readSlots_active.size() && m_readSlots_active[readSlot],
+                "Received a completion for read slot %zu in %s, but that slot isn't active.", readSlot, m_name.c_str());
+            FileReadInformation& readInfo = m_readSlots_readInfo[readSlot];
+
+            if (result == -ECANCELED)
+            {
+                FinalizeSingleRequest(readSlot, true, false);
+            }
+            else if (result < 0)
+            {
+                AZ_Error("StorageDriveLinux", false, "Async file read operation completed with error code %i\n", -result);
+                FinalizeSingleRequest(readSlot, false, true);
+            }
+            else
+            {
+                readInfo.m_bytesRead += aznumeric_cast<size_t>(result);
+
+                auto readCommand = AZStd::get_if<FileRequest::ReadData>(&readInfo.m_request->GetCommand());
+                AZ_Assert(readCommand != nullptr, "Request stored with the read slot did not contain a read request.");
+                const size_t bytesNeeded = readInfo.m_copyBackOffset + readCommand->m_size;
+
+                // Reads can be cut short, for instance when interrupted. Queue the remainder unless the end of the
+                // file has been reached.
+                if (result > 0 && readInfo.m_bytesRead < bytesNeeded)
+                {
+                    readInfo.m_target += result;
+                    readInfo.m_offset += result;
+                    if (QueueRead(readSlot))
+                    {
+                        continue;
+                    }
+                }
+                FinalizeSingleRequest(readSlot, false, false);
+            }
+        }
+        return hasWorked;
+    }
+
+    void StorageDriveLinux::FinalizeSingleRequest(size_t readSlot, bool isCanceled, bool encounteredError)
+    {
+        FileReadInformation& fileReadInfo = m_readSlots_readInfo[readSlot];
+
+        m_activeReads_ByteCount += fileReadInfo.m_bytesRead;
+        if (--m_activeReads_Count == 0)
+        {
+            // Update read stats now that the operation is done.
+            m_readSizeAverage.PushEntry(m_activeReads_ByteCount);
+            m_readTimeAverage.PushEntry(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
+                AZStd::chrono::system_clock::now() - m_activeReads_startTime));
+
+            m_activeReads_ByteCount = 0;
+        }
+
+        auto readCommand = AZStd::get_if<FileRequest::ReadData>(&fileReadInfo.m_request->GetCommand());
+        AZ_Assert(readCommand != nullptr, "Request stored with the read slot did not contain a read request.");
+
+        // The request could be reading more due to alignment requirements. It should however never read less that the amount of
+        // requested data.
+        const bool isSuccess = !encounteredError && (fileReadInfo.m_copyBackOffset + readCommand->m_size <= fileReadInfo.m_bytesRead);
+        if (isSuccess)
+        {
+            void* alignedBuffer = fileReadInfo.m_usesRegisteredBuffer ? m_registeredBuffers[readSlot].iov_base : fileReadInfo.m_sectorAlignedOutput;
+            if (alignedBuffer)
+            {
+                auto offsetAddress = reinterpret_cast<u8*>(alignedBuffer) + fileReadInfo.m_copyBackOffset;
+                ::memcpy(readCommand->m_output, offsetAddress, readCommand->m_size);
+            }
+        }
+
+        fileReadInfo.m_request->SetStatus(
+            isCanceled
+                ? IStreamerTypes::RequestStatus::Canceled
+                : isSuccess
+                    ? IStreamerTypes::RequestStatus::Completed
+                    : IStreamerTypes::RequestStatus::Failed
+        );
+        m_context->MarkRequestAsCompleted(fileReadInfo.m_request);
+
+        m_fileCache_activeReads[fileReadInfo.m_fileHandleIndex]--;
+        m_readSlots_active[readSlot] = false;
+        fileReadInfo.Clear();
+
+        // There's now a slot available to queue the next request, if there is one.
+        if (!m_pendingReadRequests.empty())
+        {
+            FileRequest* request = m_pendingReadRequests.front();
+            if (ReadRequest(request, readSlot))
+            {
+                m_pendingReadRequests.pop_front();
+            }
+        }
+    }
+
+    size_t StorageDriveLinux::FindInFileHandleCache(const RequestPath& filePath) const
+    {
+        size_t numFiles = m_fileCache_paths.size();
+        for (size_t i = 0; i < numFiles; ++i)
+        {
+            if (m_fileCache_paths[i] == filePath)
+            {
+                return i;
+            }
+        }
+        return InvalidFileCacheIndex;
+    }
+
+    size_t StorageDriveLinux::FindAvailableFileHandleCacheIndex() const
+    {
+        AZ_Assert(m_cachesInitialized, "Using file cache before it has been (lazily) initialized\n");
+
+        // This needs to look for files with no active reads, and the oldest file among those.
+        size_t cacheIndex = InvalidFileCacheIndex;
+        AZStd::chrono::system_clock::time_point oldest = AZStd::chrono::system_clock::time_point::max();
+        for (size_t index = 0; index < m_maxFileHandles; ++index)
+        {
+            if (m_fileCache_activeReads[index] == 0 && m_fileCache_lastTimeUsed[index] < oldest)
+            {
+                oldest = m_fileCache_lastTimeUsed[index];
+                cacheIndex = index;
+            }
+        }
+
+        return cacheIndex;
+    }
+
+    size_t StorageDriveLinux::FindAvailableReadSlot()
+    {
+        for (size_t i = 0; i < m_readSlots_active.size(); ++i)
+        {
+            if (!m_readSlots_active[i])
+            {
+                return i;
+            }
+        }
+        return InvalidReadSlotIndex;
+    }
+
+    size_t StorageDriveLinux::FindInMetaDataCache(const RequestPath& filePath) const
+    {
+        size_t numFiles = m_metaDataCache_paths.size();
+        for (size_t i = 0; i < numFiles; ++i)
+        {
+            if (m_metaDataCache_paths[i] == filePath)
+            {
+                return i;
+            }
+        }
+        return InvalidMetaDataCacheIndex;
+    }
+
+    size_t StorageDriveLinux::GetNextMetaDataCacheSlot()
+    {
+        m_metaDataCache_front = (m_metaDataCache_front + 1) & (m_metaDataCache_paths.size() - 1);
+        return m_metaDataCache_front;
+    }
+
+    void StorageDriveLinux::CollectStatistics(AZStd::vector<Statistic>& statistics) const
+    {
+        if (m_cachesInitialized)
+        {
+            constexpr double bytesToMB = aznumeric_cast<double>(1_mib);
+            using DoubleSeconds = AZStd::chrono::duration<double>;
+
+            double totalBytesReadMB = m_readSizeAverage.GetTotal() / bytesToMB;
+            double totalReadTimeSec = AZStd::chrono::duration_cast<DoubleSeconds>(m_readTimeAverage.GetTotal()).count();
+            statistics.push_back(Statistic::CreateFloat(m_name, "Read Speed (avg. mbps)", totalBytesReadMB / totalReadTimeSec));
+            statistics.push_back(Statistic::CreateInteger(m_name, "File Open & Close (avg. us)", m_fileOpenCloseTimeAverage.CalculateAverage().count()));
+            statistics.push_back(Statistic::CreateInteger(m_name, "Get file exists (avg. us)", m_getFileExistsTimeAverage.CalculateAverage().count()));
+            statistics.push_back(Statistic::CreateInteger(m_name, "Get file meta data (avg. us)", m_getFileMetaDataRetrievalTimeAverage.CalculateAverage().count()));
+
+            statistics.push_back(Statistic::CreateInteger(m_name, "Available slots", CalculateNumAvailableSlots()));
+            statistics.push_back(Statistic::CreateInteger(m_name, "Active reads", m_activeReads_Count));
+        }
+        StreamStackEntry::CollectStatistics(statistics);
+    }
+
+    void StorageDriveLinux::Report(const FileRequest::ReportData& data) const
+    {
+        switch (data.m_reportType)
+        {
+        case FileRequest::ReportData::ReportType::FileLocks:
+            if (m_cachesInitialized)
+            {
+                for (u32 i = 0; i < m_maxFileHandles; ++i)
+                {
+                    if (m_fileCache_handles[i] >= 0)
+                    {
+                        AZ_Printf("Streamer", "File lock in %s : '%s'.\n", m_name.c_str(), m_fileCache_paths[i].GetRelativePath());
+                    }
+                }
+            }
+            else
+            {
+                AZ_Printf("Streamer", "File lock in %s : No files have been streamed.\n", m_name.c_str());
+            }
+            break;
+        default:
+            break;
+        }
+    }
+} // namespace AZ::IO
@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Streamer/Statistics.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/chrono/clocks.h>
+#include <AzCore/std/string/string.h>
+
+#include <sys/uio.h>
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+namespace AZ::IO
+{
+    //! Storage drive for Linux that issues reads through io_uring. Reads are queued in the submission ring as slots
+    //! become available and submitted in a single call per tick, so the device sees a deep queue rather than one
+    //! blocking read at a time. Completions are signaled through an event registered with the scheduler thread's
+    //! synchronizer and picked up in ExecuteRequests.
+    //! Requests for files this drive can't open are forwarded to the next entry, which typically is the generic
+    //! StorageDrive.
+    class StorageDriveLinux
+        : public StreamStackEntry
+    {
+    public:
+        struct ConstructionOptions
+        {
+            ConstructionOptions();
+
+            //! Whether or not the device has a cost for seeking, such as happens on platter disks. This
+            //! will be accounted for when predicting file reads.
+            u8 m_hasSeekPenalty : 1;
+            //! Use unbuffered (O_DIRECT) reads, bypassing the page cache. This results in a faster read the first time
+            //! a file is read, but subsequent reads will possibly be slower as those could have been serviced from the
+            //! page cache. Unbuffered reads have alignment restrictions, reads that don't meet those are read into
+            //! an intermediate sector aligned buffer.
+            u8 m_enableUnbufferedReads : 1;
+            //! Register the intermediate buffers used for unaligned unbuffered reads with the kernel so they don't
+            //! need to be mapped for every read. Registration requires enough locked memory (RLIMIT_MEMLOCK), if
+            //! registration fails regular buffers are used instead.
+            u8 m_enableRegisteredBuffers : 1;
+            //! If true, only information that's explicitly requested or issues are reported. If false, status information
+            //! such as when drives are created and destroyed is reported as well.
+            u8 m_minimalReporting : 1;
+        };
+
+        //! Returns true if the running kernel supports the io_uring features this drive needs.
+        static bool IsSupported();
+
+        //! Creates an instance of a storage device that's optimized for use on Linux.
+        //! @param maxFileHandles The maximum number of file handles that are cached. Only a small number are needed when
+        //!     running from archives, but it's recommended that a larger number are kept open when reading from loose files.
+        //! @param maxMetaDataCacheEntires The maximum number of files to keep meta data, such as the file size, to cache.
+        //!     Needs to be a power of 2.
+        //! @param physicalSectorSize The minimal sector size as instructed by the device. When unbuffered reads are used the output
+        //!     buffer needs to be aligned to this value.
+        //! @param logicalSectorSize The minimal sector size as instructed by the device. When unbuffered reads are used the
+        //!     file size and read offset need to be aligned to this value.
+        //! @param maxTransferSize The size of the intermediate buffer per read slot for unaligned unbuffered reads.
+        //! @param queueDepth The maximum number of reads that are kept in flight.
+        //! @param overCommit The number of additional slots that will be reported as available. This makes sure that there are
+        //!     always a few requests pending to avoid starvation. A negative value will under-commit.
+        //! @param options Additional configuration options. See ConstructionOptions for more details.
+        StorageDriveLinux(u32 maxFileHandles, u32 maxMetaDataCacheEntries, size_t physicalSectorSize, size_t logicalSectorSize,
+            size_t maxTransferSize, u32 queueDepth, s32 overCommit, ConstructionOptions options);
+        ~StorageDriveLinux() override;
+
+        StorageDriveLinux(const StorageDriveLinux&) = delete;
+        StorageDriveLinux& operator=(const StorageDriveLinux&) = delete;
+
+        void PrepareRequest(FileRequest* request) override;
+        void QueueRequest(FileRequest* request) override;
+        bool ExecuteRequests() override;
+
+        void UpdateStatus(Status& status) const override;
+        void UpdateCompletionEstimates(AZStd::chrono::system_clock::time_point now, AZStd::vector<FileRequest*>& internalPending,
+            StreamerContext::PreparedQueue::iterator pendingBegin, StreamerContext::PreparedQueue::iterator pendingEnd) override;
+
+        void CollectStatistics(AZStd::vector<Statistic>& statistics) const override;
+
+    protected:
+        static const AZStd::chrono::microseconds s_averageSeekTime;
+
+        inline static constexpr size_t InvalidFileCacheIndex = std::numeric_limits<size_t>::max();
+        inline static constexpr size_t InvalidReadSlotIndex = std::numeric_limits<size_t>::max();
+        inline static constexpr size_t InvalidMetaDataCacheIndex = std::numeric_limits<size_t>::max();
+        //! User data for submissions that don't belong to a read slot, such as cancellations.
+        inline static constexpr u64 InternalUserData = std::numeric_limits<u64>::max();
+
+        //! Memory mapped submission and completion rings shared with the kernel.
+        struct Ring
+        {
+            bool Initialize(u32 entries);
+            void Shutdown();
+
+            //! Returns the next free submission entry or nullptr if the submission ring is full.
+            io_uring_sqe* GetSubmissionEntry();
+            //! Hands all queued submission entries to the kernel. Returns false if the kernel rejected the call.
+            bool Submit();
+
+            void* m_submissionRing{ nullptr };
+            void* m_completionRing{ nullptr };
+            io_uring_sqe* m_submissionEntries{ nullptr };
+            io_uring_cqe* m_completionEntries{ nullptr };
+            u32* m_submissionHead{ nullptr };
+            u32* m_submissionTail{ nullptr };
+            u32* m_submissionArray{ nullptr };
+            u32* m_completionHead{ nullptr };
+            u32* m_completionTail{ nullptr };
+            size_t m_submissionRingSize{ 0 };
+            size_t m_completionRingSize{ 0 };
+            size_t m_submissionEntriesSize{ 0 };
+            u32 m_submissionMask{ 0 };
+            u32 m_completionMask{ 0 };
+            u32 m_entryCount{ 0 };
+            u32 m_queuedCount{ 0 };      //!< Entries filled in but not yet made visible to the kernel.
+            u32 m_unsubmittedCount{ 0 }; //!< Entries visible to the kernel but not yet consumed by it.
+            int m_fd{ -1 };
+        };
+
+        struct FileReadInformation
+        {
+            AZStd::chrono::system_clock::time_point m_startTime;
+            FileRequest* m_request{ nullptr };
+            void* m_sectorAlignedOutput{ nullptr };    // Internally allocated buffer that is sector aligned.
+            u8* m_target{ nullptr };                   // Address the kernel is currently writing to.
+            iovec m_ioVector{};
+            u64 m_offset{ 0 };                         // File offset the kernel is currently reading from.
+            size_t m_copyBackOffset{ 0 };
+            size_t m_bytesRead{ 0 };
+            size_t m_bytesRequested{ 0 };
+            size_t m_fileHandleIndex{ InvalidFileCacheIndex };
+            bool m_usesRegisteredBuffer{ false };
+
+            void AllocateAlignedBuffer(size_t size, size_t sectorSize);
+            void Clear();
+        };
+
+        enum class OpenFileResult
+        {
+            FileOpened,
+            RequestForwarded,
+            CacheFull
+        };
+
+        void InitializeCaches();
+        OpenFileResult OpenFile(size_t& cacheSlot, FileRequest* request, const FileRequest::ReadData& data);
+        bool ReadRequest(FileRequest* request);
+        bool ReadRequest(FileRequest* request, size_t readSlot);
+        bool QueueRead(size_t readSlot);
+        bool CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target);
+        void FileExistsRequest(FileRequest* request);
+        void FileMetaDataRetrievalRequest(FileRequest* request);
+        size_t FindInFileHandleCache(const RequestPath& filePath) const;
+        size_t FindAvailableFileHandleCacheIndex() const;
+        size_t FindAvailableReadSlot();
+        size_t FindInMetaDataCache(const RequestPath& filePath) const;
+        size_t GetNextMetaDataCacheSlot();
+        void SetRegisteredFile(size_t cacheIndex, int file);
+        void CloseCachedFile(size_t cacheIndex);
+
+        void EstimateCompletionTimeForRequest(FileRequest* request, AZStd::chrono::system_clock::time_point& startTime,
+            const RequestPath*& activeFile, u64& activeOffset) const;
+        void EstimateCompletionTimeForRequestChecked(FileRequest* request,
+            AZStd::chrono::system_clock::time_point startTime, const RequestPath*& activeFile, u64& activeOffset) const;
+        s32 CalculateNumAvailableSlots() const;
+
+        void FlushCache(const RequestPath& filePath);
+        void FlushEntireCache();
+
+        bool FinalizeReads();
+        void FinalizeSingleRequest(size_t readSlot, bool isCanceled, bool encounteredError);
+
+        void Report(const FileRequest::ReportData& data) const;
+
+        TimedAverageWindow<s_statisticsWindowSize> m_fileOpenCloseTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_getFileExistsTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_getFileMetaDataRetrievalTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_readTimeAverage;
+        AverageWindow<u64, float, s_statisticsWindowSize> m_readSizeAverage;
+        AZStd::chrono::system_clock::time_point m_activeReads_startTime;
+
+        Ring m_ring;
+
+        AZStd::deque<FileRequest*> m_pendingReadRequests;
+        AZStd::deque<FileRequest*> m_pendingRequests;
+
+        AZStd::vector<FileReadInformation> m_readSlots_readInfo;
+        AZStd::vector<bool> m_readSlots_active;
+        //! Sector aligned buffers, one per read slot, registered with the kernel for unaligned unbuffered reads.
+        AZStd::vector<iovec> m_registeredBuffers;
+
+        AZStd::vector<AZStd::chrono::system_clock::time_point> m_fileCache_lastTimeUsed;
+        AZStd::vector<RequestPath> m_fileCache_paths;
+        AZStd::vector<int> m_fileCache_handles;
+        AZStd::vector<u16> m_fileCache_activeReads;
+
+        AZStd::vector<RequestPath> m_metaDataCache_paths;
+        AZStd::vector<u64> m_metaDataCache_fileSize;
+
+        size_t m_activeReads_ByteCount{ 0 };
+
+        size_t m_physicalSectorSize{ 0 };
+        size_t m_logicalSectorSize{ 0 };
+        size_t m_maxTransferSize{ 0 };
+        size_t m_activeCacheSlot{ InvalidFileCacheIndex };
+        size_t m_metaDataCache_front{ 0 };
+        u64 m_activeOffset{ 0 };
+        u32 m_maxFileHandles{ 1 };
+        u32 m_queueDepth{ 1 };
+        s32 m_overCommit{ 0 };
+
+        u16 m_activeReads_Count{ 0 };
+
+        //! Event owned by the scheduler thread's synchronizer that's signaled by the kernel on completions.
+        int m_completionEvent{ -1 };
+
+        ConstructionOptions m_constructionOptions;
+        bool m_cachesInitialized{ false };
+        bool m_ringInitialized{ false };
+        bool m_hasRegisteredFiles{ false };
+    };
+} // namespace AZ::IO
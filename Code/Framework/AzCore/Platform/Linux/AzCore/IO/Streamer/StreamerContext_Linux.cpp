@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/StreamerContext_Linux.h>
+#include <AzCore/std/utils.h>
+
+#include <errno.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+namespace AZ::Platform
+{
+    StreamerContextThreadSync::StreamerContextThreadSync()
+    {
+        m_events[0] = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        AZ_Assert(m_events[0] >= 0, "Failed to create a required event for IO Scheduler (Error: %i).", errno);
+        for (size_t i = 1; i <= MaxIoEvents; ++i)
+        {
+            m_events[i] = -1;
+        }
+    }
+
+    StreamerContextThreadSync::~StreamerContextThreadSync()
+    {
+        for (size_t i = 0; i < m_handleCount; ++i)
+        {
+            if (m_events[i] >= 0)
+            {
+                ::close(m_events[i]);
+            }
+        }
+    }
+
+    void StreamerContextThreadSync::Suspend()
+    {
+        AZ_Assert(m_events[0] >= 0, "There is no synchronization event created for the main streamer thread to use to suspend.");
+
+        pollfd fds[MaxIoEvents + 1];
+        for (size_t i = 0; i < m_handleCount; ++i)
+        {
+            fds[i].fd = m_events[i];
+            fds[i].events = POLLIN;
+            fds[i].revents = 0;
+        }
+
+        int result;
+        do
+        {
+            result = ::poll(fds, static_cast<nfds_t>(m_handleCount), -1);
+        } while (result < 0 && errno == EINTR);
+        AZ_Assert(result > 0, "Unexpected poll result: %i (Error: %i).", result, errno);
+
+        // Reset every event that fired. The caller will pick up the work for all of them when it resumes.
+        for (size_t i = 0; i < m_handleCount; ++i)
+        {
+            if (fds[i].revents & POLLIN)
+            {
+                eventfd_t value;
+                [[maybe_unused]] int readResult = ::eventfd_read(fds[i].fd, &value);
+            }
+        }
+    }
+
+    void StreamerContextThreadSync::Resume()
+    {
+        AZ_Assert(m_events[0] >= 0, "There is no synchronization event created for the main streamer thread to use to resume.");
+        ::eventfd_write(m_events[0], 1);
+    }
+
+    int StreamerContextThreadSync::CreateEventHandle()
+    {
+        AZ_Assert(m_handleCount <= MaxIoEvents, "There are no more slots available to allocate a new IO event in.");
+        int event = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        AZ_Error("StreamerContext", event >= 0, "Failed to create an IO event (Error: %i).", errno);
+        if (event >= 0)
+        {
+            m_events[m_handleCount++] = event;
+        }
+        return event;
+    }
+
+    void StreamerContextThreadSync::DestroyEventHandle(int event)
+    {
+        AZ_Assert(m_handleCount > 1, "There are no more IO events that can be destroyed.");
+
+        for (size_t i = 1; i < m_handleCount; ++i)
+        {
+            if (m_events[i] == event)
+            {
+                ::close(event);
+                m_handleCount--;
+                m_events[i] = m_events[m_handleCount];
+                m_events[m_handleCount] = -1;
+                return;
+            }
+        }
+
+        AZ_Assert(false, "IO event couldn't be destroyed as it wasn't found.");
+    }
+
+    size_t StreamerContextThreadSync::GetEventHandleCount() const
+    {
+        return m_handleCount - 1;
+    }
+
+    bool StreamerContextThreadSync::AreEventHandlesAvailable() const
+    {
+        return m_handleCount <= MaxIoEvents;
+    }
+} // namespace AZ::Platform
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+
+namespace AZ::Platform
+{
+    //! Suspends the scheduler thread on a set of eventfds. The first event is used to wake the thread up from
+    //! the rest of the engine, the remaining events can be handed out to stream stack entries (such as io_uring
+    //! completion notifications) so asynchronous work completing also wakes the scheduler thread.
+    class StreamerContextThreadSync
+    {
+    public:
+        static constexpr size_t MaxIoEvents = 8;
+
+        StreamerContextThreadSync();
+        ~StreamerContextThreadSync();
+
+        void Suspend();
+        void Resume();
+
+        //! Returns an eventfd that wakes up the scheduler thread when written to. The event is owned by the
+        //! thread synchronizer and will be closed when it's destroyed or passed to DestroyEventHandle.
+        int CreateEventHandle();
+        void DestroyEventHandle(int event);
+        size_t GetEventHandleCount() const;
+        bool AreEventHandlesAvailable() const;
+
+    private:
+        // Note: The first event handle is reserved for the synchronization of the
+        // scheduler thread with the rest of the engine.
+        int m_events[MaxIoEvents + 1];
+        size_t m_handleCount{ 1 }; // The first event is for external wake up calls.
+    };
+
+} // namespace AZ::Platform
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Jobs/CpuTopology.h>
+#include <AzCore/std/containers/unordered_map.h>
+
+#include <stdio.h>
+#include <unistd.h>
+
+namespace AZ::Platform
+{
+    namespace
+    {
+        bool ReadSysfsValue(const char* path, AZ::u32& value)
+        {
+            FILE* file = fopen(path, "r");
+            if (!file)
+            {
+                return false;
+            }
+            const bool success = fscanf(file, "%u", &value) == 1;
+            fclose(file);
+            return success;
+        }
+
+        // Maps sparse ids reported by the kernel (cache ids, package ids) to dense indices.
+        AZ::u32 Densify(AZStd::unordered_map<AZ::u64, AZ::u32>& ids, AZ::u64 rawId)
+        {
+            auto inserted = ids.emplace(rawId, static_cast<AZ::u32>(ids.size()));
+            return inserted.first->second;
+        }
+    }
+
+    bool DiscoverCpuTopology(CpuTopology& topology)
+    {
+        constexpr AZ::u32 MaxNumaNodes = 64;
+        char path[128];
+
+        AZStd::unordered_map<AZ::u64, AZ::u32> clusterIds;
+        AZStd::unordered_map<AZ::u64, AZ::u32> nodeIds;
+
+        const long configuredProcessors = sysconf(_SC_NPROCESSORS_CONF);
+        for (AZ::u32 cpu = 0; configuredProcessors > 0 && cpu < static_cast<AZ::u32>(configuredProcessors); ++cpu)
+        {
+            AZ::u32 online = 1;
+            azsnprintf(path, AZ_ARRAY_SIZE(path), "/sys/devices/system/cpu/cpu%u/online", cpu);
+            if (ReadSysfsValue(path, online) && online == 0)
+            {
+                continue;
+            }
+
+            AZ::u32 package = 0;
+            azsnprintf(path, AZ_ARRAY_SIZE(path), "/sys/devices/system/cpu/cpu%u/topology/physical_package_id", cpu);
+            if (!ReadSysfsValue(path, package))
+            {
+                // No topology information exposed (containers without sysfs for instance).
+                return false;
+            }
+
+            // The L3 (index3) is the last level cache on all the x64 and arm64 server parts we ship on. If it is not
+            // reported fall back to the package, which is what the cache was shared by on older CPUs.
+            AZ::u64 clusterKey = static_cast<AZ::u64>(package) << 32;
+            AZ::u32 l3Id = 0;
+            azsnprintf(path, AZ_ARRAY_SIZE(path), "/sys/devices/system/cpu/cpu%u/cache/index3/id", cpu);
+            if (ReadSysfsValue(path, l3Id))
+            {
+                clusterKey |= l3Id;
+            }
+
+            AZ::u32 node = 0;
+            for (AZ::u32 candidate = 0; candidate < MaxNumaNodes; ++candidate)
+            {
+                azsnprintf(path, AZ_ARRAY_SIZE(path), "/sys/devices/system/cpu/cpu%u/node%u", cpu, candidate);
+                if (access(path, F_OK) == 0)
+                {
+                    node = candidate;
+                    break;
+                }
+            }
+
+            CpuTopology::LogicalProcessor processor;
+            processor.m_id = cpu;
+            processor.m_coreCluster = Densify(clusterIds, clusterKey);
+            processor.m_numaNode = Densify(nodeIds, node);
+            topology.m_processors.push_back(processor);
+        }
+
+        return !topology.m_processors.empty();
+    }
+}
@@ -45,6 +45,7 @@ set(FILES
     AzCore/IO/Streamer/StreamerConfiguration_Windows.h
     AzCore/IO/Streamer/StreamerConfiguration_Windows.cpp
     AzCore/IO/Streamer/StreamerContext_Platform.h
+    ../Common/Default/AzCore/Jobs/CpuTopology_Default.cpp
     AzCore/IPC/SharedMemory_Platform.h
     AzCore/IPC/SharedMemory_Windows.h
     AzCore/IPC/SharedMemory_Windows.cpp
@@ -70,6 +71,7 @@ set(FILES
     AzCore/Socket/AzSocket_fwd_Platform.h
     AzCore/Socket/AzSocket_fwd_Windows.h
     AzCore/std/time_Windows.cpp
+    ../Common/MSVC/AzCore/Utils/CpuFeatures_MSVC.cpp
     ../Common/WinAPI/AzCore/Utils/Utils_WinAPI.cpp
     AzCore/Utils/Utils_Windows.cpp
 )
@@ -9,6 +9,7 @@
 #include "UserTypes.h"
 
 #include <AzCore/std/functional_basic.h>
+#include <AzCore/std/function/function_ref.h>
 #include <AzCore/std/tuple.h>
 
 
@@ -217,4 +218,34 @@ namespace UnitTest
         Internal::FunctionalOperatorConfig::PerformOperation<void>(Internal::IntWrapper{ 45 }, 34, AZStd::make_tuple(79, 11, 1530, 1, 11, -45, false, true, true, false, true, false, true, true, false, 32, 47, 15, ~45));
         Internal::FunctionalOperatorConfig::PerformOperation<void>(24, Internal::IntWrapper{ 24 }, AZStd::make_tuple(48, 0, 576, 1, 0, -24, true, false, false, false, true, true, true, true, false, 24, 24, 0, ~24));
     }
+
+    namespace Internal
+    {
+        int32_t AddOne(int32_t value)
+        {
+            return value + 1;
+        }
+
+        int32_t CallWithTwo(AZStd::function_ref<int32_t(int32_t)> callback)
+        {
+            return callback(2);
+        }
+    }
+
+    TEST_F(FunctionalBasicTest, FunctionRef_InvokesReferencedCallable)
+    {
+        EXPECT_EQ(3, Internal::CallWithTwo(&Internal::AddOne));
+        EXPECT_EQ(3, Internal::CallWithTwo(Internal::AddOne));
+
+        int32_t multiplier = 5;
+        EXPECT_EQ(10, Internal::CallWithTwo([&multiplier](int32_t value) { return value * multiplier; }));
+
+        // The lambda is referenced, not copied, so its captures can be changed between calls
+        int32_t callCount = 0;
+        auto counter = [&callCount, multiplier](int32_t value) mutable { ++callCount; return value * multiplier++; };
+        AZStd::function_ref<int32_t(int32_t)> counterRef(counter);
+        EXPECT_EQ(10, counterRef(2));
+        EXPECT_EQ(12, counterRef(2));
+        EXPECT_EQ(2, callCount);
+    }
 }
@@ -12,6 +12,9 @@
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/fixed_unordered_set.h>
 #include <AzCore/std/containers/fixed_unordered_map.h>
+#include <AzCore/std/containers/flat_hash_map.h>
+#include <AzCore/std/containers/flat_hash_set.h>
+#include <AzCore/std/containers/flat_map.h>
 #include <AzCore/std/string/string.h>
 
 #if defined(HAVE_BENCHMARK)
@@ -132,6 +135,47 @@ namespace UnitTest
         static_assert(TestHashCombine(42) != 0);
     }
 
+    TEST_F(HashedContainers, HashBytes_SameInput_SameHash)
+    {
+        const char text[] = "The quick brown fox jumps over the lazy dog, several times over to get past the 48 byte blocks";
+        char copy[sizeof(text)];
+        memcpy(copy, text, sizeof(text));
+        for (size_t size = 0; size < sizeof(text); ++size)
+        {
+            EXPECT_EQ(hash_bytes(text, size), hash_bytes(copy, size));
+        }
+        EXPECT_NE(hash_bytes(text, sizeof(text), 0), hash_bytes(text, sizeof(text), 1));
+    }
+
+    TEST_F(HashedContainers, HashBytes_EveryLengthAndByte_ChangesHash)
+    {
+        AZStd::array<AZ::u8, 100> bytes{};
+        unordered_set<AZ::u64> hashes;
+        for (size_t size = 0; size <= bytes.size(); ++size)
+        {
+            EXPECT_TRUE(hashes.insert(hash_bytes(bytes.data(), size)).second) << "size " << size;
+        }
+        for (size_t i = 0; i < bytes.size(); ++i)
+        {
+            bytes[i] = 1;
+            EXPECT_TRUE(hashes.insert(hash_bytes(bytes.data(), bytes.size())).second) << "byte " << i;
+            bytes[i] = 0;
+        }
+    }
+
+    TEST_F(HashedContainers, FastStringHash_StringTypes_SameHash)
+    {
+        const char* text = "Objects/Characters/Jack.fbx";
+        fast_string_hash hasher;
+        EXPECT_EQ(hasher(string(text)), hasher(string_view(text)));
+        EXPECT_EQ(hasher(text), hasher(string_view(text)));
+        EXPECT_NE(hasher("Objects/Characters/Jack.fbx"), hasher("Objects/Characters/Jill.fbx"));
+
+        unordered_set<string, fast_string_hash, equal_to<>> set;
+        set.emplace(text);
+        EXPECT_NE(set.end(), set.find(string_view(text)));
+    }
+
     /**
      * HashTableSetTraits
      */
@@ -1108,6 +1152,179 @@ namespace UnitTest
         EXPECT_EQ(idx, map.size());
     }
 
+    TEST_F(HashedContainers, FlatHashMapBasic)
+    {
+        AZStd::flat_hash_map<int, int> map;
+        EXPECT_TRUE(map.empty());
+        EXPECT_EQ(map.end(), map.find(1));
+
+        EXPECT_TRUE(map.emplace(1, 10).second);
+        EXPECT_FALSE(map.emplace(1, 20).second);
+        EXPECT_EQ(10, map[1]);
+        map[2] = 20;
+        EXPECT_FALSE(map.insert_or_assign(2, 30).second);
+        EXPECT_EQ(30, map.at(2));
+        EXPECT_EQ(2, map.size());
+        EXPECT_TRUE(map.contains(1));
+        EXPECT_EQ(1, map.count(2));
+
+        EXPECT_EQ(1, map.erase(1));
+        EXPECT_EQ(0, map.erase(1));
+        EXPECT_FALSE(map.contains(1));
+        EXPECT_EQ(1, map.size());
+    }
+
+    TEST_F(HashedContainers, FlatHashMapGrowth_ElementsRemainFindable)
+    {
+        constexpr int NumElements = 10000;
+        AZStd::flat_hash_map<int, int> map;
+        for (int i = 0; i < NumElements; ++i)
+        {
+            map.emplace(i, i * 2);
+        }
+        EXPECT_EQ(NumElements, map.size());
+        EXPECT_LE(map.size(), map.bucket_count());
+
+        for (int i = 0; i < NumElements; ++i)
+        {
+            auto it = map.find(i);
+            ASSERT_NE(map.end(), it);
+            EXPECT_EQ(i * 2, it->second);
+        }
+        EXPECT_EQ(map.end(), map.find(NumElements));
+    }
+
+    TEST_F(HashedContainers, FlatHashMapEraseWhileIterating_VisitsEveryElementOnce)
+    {
+        AZStd::flat_hash_map<int, int> map;
+        for (int i = 0; i < 100; ++i)
+        {
+            map.emplace(i, i);
+        }
+
+        int numVisited = 0;
+        for (auto it = map.begin(); it != map.end();)
+        {
+            ++numVisited;
+            it = (it->first % 2 == 0) ? map.erase(it) : AZStd::next(it);
+        }
+        EXPECT_EQ(100, numVisited);
+        EXPECT_EQ(50, map.size());
+        for (const auto& item : map)
+        {
+            EXPECT_EQ(1, item.first % 2);
+        }
+    }
+
+    TEST_F(HashedContainers, FlatHashMapReuseAfterErase_DoesNotGrow)
+    {
+        AZStd::flat_hash_map<int, int> map;
+        map.reserve(64);
+        const size_t bucketCount = map.bucket_count();
+
+        // Continuously replacing elements leaves deleted slots behind, which need to be reclaimed instead of growing the table.
+        for (int i = 0; i < 10000; ++i)
+        {
+            map.emplace(i, i);
+            if (i >= 32)
+            {
+                map.erase(i - 32);
+            }
+        }
+        EXPECT_EQ(32, map.size());
+        EXPECT_EQ(bucketCount, map.bucket_count());
+    }
+
+    TEST_F(HashedContainers, FlatHashMapCopyAndMove)
+    {
+        AZStd::flat_hash_map<int, AZStd::string> map{ { 1, "one" }, { 2, "two" }, { 3, "three" } };
+
+        AZStd::flat_hash_map<int, AZStd::string> copy(map);
+        EXPECT_EQ(map, copy);
+        copy[4] = "four";
+        EXPECT_NE(map, copy);
+
+        AZStd::flat_hash_map<int, AZStd::string> moved(AZStd::move(copy));
+        EXPECT_TRUE(copy.empty());
+        EXPECT_EQ(4, moved.size());
+        EXPECT_EQ("four", moved[4]);
+
+        moved = map;
+        EXPECT_EQ(map, moved);
+    }
+
+    TEST_F(HashedContainers, FlatHashMapClearAndRehash)
+    {
+        AZStd::flat_hash_map<int, AZStd::string> map;
+        for (int i = 0; i < 100; ++i)
+        {
+            map.emplace(i, "value");
+        }
+
+        const size_t bucketCount = map.bucket_count();
+        map.clear();
+        EXPECT_TRUE(map.empty());
+        EXPECT_EQ(bucketCount, map.bucket_count());
+        EXPECT_EQ(map.begin(), map.end());
+
+        map.rehash(0);
+        EXPECT_EQ(0, map.bucket_count());
+        map.emplace(1, "value");
+        EXPECT_EQ(1, map.size());
+    }
+
+    TEST_F(HashedContainers, FlatHashMapExplicitAllocatorSucceeds)
+    {
+        AZ::OSAllocator customAllocator;
+        AZStd::flat_hash_map<int, int, AZStd::hash<int>, AZStd::equal_to<int>, AZ::AZStdIAllocator> mapWithCustomAllocator{
+            AZ::AZStdIAllocator(&customAllocator)
+        };
+        for (int i = 0; i < 100; ++i)
+        {
+            mapWithCustomAllocator.emplace(i, i);
+        }
+        EXPECT_FALSE(mapWithCustomAllocator.emplace(1, 2).second);
+        EXPECT_EQ(100, mapWithCustomAllocator.size());
+    }
+
+    TEST_F(HashedContainers, FlatHashSetBasic)
+    {
+        AZStd::flat_hash_set<int> set{ 5, 3, 5, 1 };
+        EXPECT_EQ(3, set.size());
+        EXPECT_TRUE(set.contains(3));
+        EXPECT_FALSE(set.contains(4));
+
+        EXPECT_TRUE(set.insert(4).second);
+        EXPECT_FALSE(set.insert(4).second);
+        EXPECT_TRUE(set.emplace(6).second);
+        EXPECT_EQ(1, set.erase(5));
+        EXPECT_EQ(0, set.erase(5));
+        EXPECT_EQ(set.end(), set.find(5));
+
+        int sum = 0;
+        for (int value : set)
+        {
+            sum += value;
+        }
+        EXPECT_EQ(1 + 3 + 4 + 6, sum);
+    }
+
+    TEST_F(HashedContainers, FlatHashSetManyElements_CopyIsEqual)
+    {
+        AZStd::flat_hash_set<AZStd::string> set;
+        for (int i = 0; i < 1000; ++i)
+        {
+            set.emplace(AZStd::string::format("%d", i));
+        }
+        EXPECT_EQ(1000, set.size());
+
+        AZStd::flat_hash_set<AZStd::string> copy(set);
+        EXPECT_EQ(set, copy);
+        copy.erase("500");
+        EXPECT_NE(set, copy);
+        EXPECT_TRUE(set.contains("500"));
+    }
+
     template<typename ContainerType>
     class HashedSetContainers
         : public AllocatorsFixture
@@ -2173,6 +2390,98 @@ namespace UnitTest
         Benchmark_Thrash<AZStd::unordered_map>(state);
     }
     BENCHMARK(Benchmark_UnorderedMapThrash);
+
+    void Benchmark_FlatHashMapLookup(benchmark::State& state)
+    {
+        Benchmark_Lookup<AZStd::flat_hash_map>(state);
+    }
+    BENCHMARK(Benchmark_FlatHashMapLookup);
+
+    void Benchmark_FlatHashMapInsert(benchmark::State& state)
+    {
+        Benchmark_Insert<AZStd::flat_hash_map>(state);
+    }
+    BENCHMARK(Benchmark_FlatHashMapInsert);
+
+    void Benchmark_FlatHashMapErase(benchmark::State& state)
+    {
+        Benchmark_Erase<AZStd::flat_hash_map>(state);
+    }
+    BENCHMARK(Benchmark_FlatHashMapErase);
+
+    void Benchmark_FlatHashMapThrash(benchmark::State& state)
+    {
+        Benchmark_Thrash<AZStd::flat_hash_map>(state);
+    }
+    BENCHMARK(Benchmark_FlatHashMapThrash);
+
+    void Benchmark_FlatMapLookup(benchmark::State& state)
+    {
+        const int count = 1024;
+        AZStd::flat_map<int, int> map;
+        for (int i = 0; i < count; ++i)
+        {
+            map.emplace(i, i);
+        }
+        int val = 0;
+        while (state.KeepRunning())
+        {
+            val += map[rand() % count];
+        }
+    }
+    BENCHMARK(Benchmark_FlatMapLookup);
+
+    template <class Set>
+    void Benchmark_SetLookup(benchmark::State& state)
+    {
+        const int count = 1024;
+        Set set;
+        for (int i = 0; i < count; ++i)
+        {
+            set.emplace(i);
+        }
+        size_t found = 0;
+        while (state.KeepRunning())
+        {
+            found += set.count(rand() % (count * 2));
+        }
+    }
+
+    void Benchmark_UnorderedSetLookup(benchmark::State& state)
+    {
+        Benchmark_SetLookup<AZStd::unordered_set<int>>(state);
+    }
+    BENCHMARK(Benchmark_UnorderedSetLookup);
+
+    void Benchmark_FlatHashSetLookup(benchmark::State& state)
+    {
+        Benchmark_SetLookup<AZStd::flat_hash_set<int>>(state);
+    }
+    BENCHMARK(Benchmark_FlatHashSetLookup);
+
+    template<class Hasher>
+    void Benchmark_StringHash(benchmark::State& state)
+    {
+        const string text(static_cast<size_t>(state.range(0)), 'a');
+        Hasher hasher;
+        for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(hasher(string_view(text)));
+        }
+        state.SetBytesProcessed(state.iterations() * state.range(0));
+    }
+
+    void Benchmark_HashStringView(benchmark::State& state)
+    {
+        Benchmark_StringHash<hash<string_view>>(state);
+    }
+    BENCHMARK(Benchmark_HashStringView)->Arg(8)->Arg(32)->Arg(256)->Arg(4096);
+
+    void Benchmark_FastStringHash(benchmark::State& state)
+    {
+        Benchmark_StringHash<fast_string_hash>(state);
+    }
+    BENCHMARK(Benchmark_FastStringHash)->Arg(8)->Arg(32)->Arg(256)->Arg(4096);
 #endif
 } // namespace UnitTest
 
@@ -2276,5 +2585,36 @@ namespace Benchmark
     }
     BENCHMARK(BM_UnorderedMap_InsertDuplicatesViaBracket);
 
+    using FlatHashMap = AZStd::flat_hash_map<int, A>;
+
+    // BM_FlatHashMap_XXX: the same workloads on the open addressing map
+    static void BM_FlatHashMap_InsertUniqueViaBracket(::benchmark::State& state)
+    {
+        while (state.KeepRunning())
+        {
+            FlatHashMap map;
+            for (int mapKey = 0; mapKey < kNumInsertions; ++mapKey)
+            {
+                A& a = map[mapKey];
+                a.m_int += 1;
+            }
+        }
+    }
+    BENCHMARK(BM_FlatHashMap_InsertUniqueViaBracket);
+
+    static void BM_FlatHashMap_InsertDuplicatesViaBracket(::benchmark::State& state)
+    {
+        while (state.KeepRunning())
+        {
+            FlatHashMap map;
+            for (int mapKey = 0; mapKey < kNumInsertions; ++mapKey)
+            {
+                A& a = map[mapKey % kModuloForDuplicates];
+                a.m_int += 1;
+            }
+        }
+    }
+    BENCHMARK(BM_FlatHashMap_InsertDuplicatesViaBracket);
+
 } // namespace Benchmark
 #endif // HAVE_BENCHMARK
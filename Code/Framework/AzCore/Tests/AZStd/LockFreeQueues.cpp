@@ -9,6 +9,7 @@
 #include "UserTypes.h"
 
 #include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/parallel/containers/lock_free_mpsc_ring.h>
 #include <AzCore/std/parallel/containers/lock_free_queue.h>
 #include <AzCore/std/parallel/containers/lock_free_stamped_queue.h>
 #include <AzCore/std/functional.h>
@@ -224,4 +225,76 @@ namespace UnitTest
             AZ_TEST_ASSERT(queue.empty());
         }
     }
+
+    TEST_F(LockFreeQueue, LockFreeMpscRing_PushPop_FifoAndBounded)
+    {
+        lock_free_mpsc_ring<SharedInt, 4> ring;
+        SharedInt result;
+        EXPECT_TRUE(ring.empty());
+        EXPECT_FALSE(ring.try_pop(result));
+
+        for (int i = 0; i < 4; ++i)
+        {
+            EXPECT_TRUE(ring.try_push(SharedInt(i)));
+        }
+        EXPECT_FALSE(ring.try_push(SharedInt(4)));
+
+        for (int i = 0; i < 4; ++i)
+        {
+            EXPECT_TRUE(ring.try_pop(result));
+            EXPECT_TRUE(result == SharedInt(i));
+        }
+        EXPECT_TRUE(ring.empty());
+
+        // Wrap around.
+        EXPECT_TRUE(ring.try_push(SharedInt(5)));
+        EXPECT_TRUE(ring.try_pop(result));
+        EXPECT_TRUE(result == SharedInt(5));
+        EXPECT_FALSE(ring.try_pop(result));
+    }
+
+    TEST_F(LockFreeQueue, LockFreeMpscRing_MultipleProducers_AllValuesReceived)
+    {
+        constexpr int numProducers = 4;
+        constexpr int valuesPerProducer = NUM_ITERATIONS / numProducers;
+        lock_free_mpsc_ring<int, 256> ring;
+
+        AZStd::thread producers[numProducers];
+        for (int p = 0; p < numProducers; ++p)
+        {
+            producers[p] = AZStd::thread([&ring, p]()
+            {
+                for (int i = 0; i < valuesPerProducer; ++i)
+                {
+                    while (!ring.try_push(p * valuesPerProducer + i))
+                    {
+                        AZStd::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        // Values of each producer must arrive in the order they were pushed.
+        int nextExpected[numProducers] = {};
+        int received = 0;
+        bool inOrder = true;
+        while (received < numProducers * valuesPerProducer)
+        {
+            int value;
+            if (ring.try_pop(value))
+            {
+                const int producer = value / valuesPerProducer;
+                inOrder = inOrder && (value % valuesPerProducer) == nextExpected[producer];
+                ++nextExpected[producer];
+                ++received;
+            }
+        }
+
+        for (AZStd::thread& producer : producers)
+        {
+            producer.join();
+        }
+        EXPECT_TRUE(inOrder);
+        EXPECT_TRUE(ring.empty());
+    }
 }
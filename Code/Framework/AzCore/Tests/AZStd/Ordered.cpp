@@ -9,6 +9,7 @@
 
 #include <AzCore/std/containers/set.h>
 #include <AzCore/std/containers/map.h>
+#include <AzCore/std/containers/flat_map.h>
 
 #include <AzCore/std/containers/intrusive_set.h>
 
@@ -685,6 +686,98 @@ namespace UnitTest
         EXPECT_EQ(74, *findIter->second);
     }
 
+    class FlatMap
+        : public AllocatorsFixture
+    {
+    };
+
+    TEST_F(FlatMap, Insert_ElementsAreSortedByKey)
+    {
+        AZStd::flat_map<int, int> map;
+        EXPECT_TRUE(map.empty());
+        EXPECT_TRUE(map.emplace(5, 50).second);
+        EXPECT_TRUE(map.insert(AZStd::make_pair(1, 10)).second);
+        EXPECT_TRUE(map.try_emplace(3, 30).second);
+        EXPECT_FALSE(map.emplace(3, 31).second);
+        map[4] = 40;
+        EXPECT_FALSE(map.insert_or_assign(4, 41).second);
+
+        ASSERT_EQ(4, map.size());
+        const int expectedKeys[] = { 1, 3, 4, 5 };
+        const int expectedValues[] = { 10, 30, 41, 50 };
+        size_t index = 0;
+        for (const auto& element : map)
+        {
+            EXPECT_EQ(expectedKeys[index], element.first);
+            EXPECT_EQ(expectedValues[index], element.second);
+            ++index;
+        }
+    }
+
+    TEST_F(FlatMap, InsertRange_DuplicateKeys_KeepsFirstElement)
+    {
+        AZStd::flat_map<int, int> map{ { 3, 1 }, { 1, 2 }, { 3, 3 } };
+        EXPECT_EQ(2, map.size());
+        EXPECT_EQ(1, map.at(3));
+
+        map.insert({ { 1, 4 }, { 0, 5 }, { 7, 6 } });
+        EXPECT_EQ(4, map.size());
+        EXPECT_EQ(2, map.at(1));
+        EXPECT_EQ(0, map.begin()->first);
+        EXPECT_EQ(7, AZStd::prev(map.end())->first);
+    }
+
+    TEST_F(FlatMap, FindAndBounds)
+    {
+        AZStd::flat_map<int, int> map{ { 2, 20 }, { 4, 40 }, { 6, 60 } };
+        EXPECT_EQ(40, map.find(4)->second);
+        EXPECT_EQ(map.end(), map.find(5));
+        EXPECT_TRUE(map.contains(6));
+        EXPECT_EQ(0, map.count(1));
+
+        EXPECT_EQ(4, map.lower_bound(3)->first);
+        EXPECT_EQ(4, map.lower_bound(4)->first);
+        EXPECT_EQ(6, map.upper_bound(4)->first);
+        EXPECT_EQ(map.end(), map.upper_bound(6));
+
+        auto range = map.equal_range(4);
+        EXPECT_EQ(1, AZStd::distance(range.first, range.second));
+        range = map.equal_range(5);
+        EXPECT_EQ(range.first, range.second);
+    }
+
+    TEST_F(FlatMap, Erase)
+    {
+        AZStd::flat_map<int, int> map{ { 1, 1 }, { 2, 2 }, { 3, 3 }, { 4, 4 } };
+        EXPECT_EQ(1, map.erase(2));
+        EXPECT_EQ(0, map.erase(2));
+        auto next = map.erase(map.find(3));
+        EXPECT_EQ(4, next->first);
+        map.erase(map.begin(), map.end());
+        EXPECT_TRUE(map.empty());
+    }
+
+    TEST_F(FlatMap, ExplicitAllocatorSucceeds)
+    {
+        AZ::OSAllocator customAllocator;
+        AZStd::flat_map<int, int, AZStd::less<int>, AZ::AZStdIAllocator> mapWithCustomAllocator{ AZ::AZStdIAllocator(&customAllocator) };
+        auto insertIter = mapWithCustomAllocator.emplace(1, 1);
+        EXPECT_TRUE(insertIter.second);
+        insertIter = mapWithCustomAllocator.emplace(1, 2);
+        EXPECT_FALSE(insertIter.second);
+        EXPECT_EQ(1, mapWithCustomAllocator.size());
+    }
+
+    TEST_F(FlatMap, IndexOperatorCompilesWithMoveOnlyType)
+    {
+        AZStd::flat_map<int, AZStd::unique_ptr<int>> uniquePtrIntMap;
+        uniquePtrIntMap[4] = AZStd::make_unique<int>(74);
+        uniquePtrIntMap[2] = AZStd::make_unique<int>(72);
+        auto findIter = uniquePtrIntMap.find(4);
+        EXPECT_NE(uniquePtrIntMap.end(), findIter);
+        EXPECT_EQ(74, *findIter->second);
+    }
+
     class Tree_MultiMap
         : public AllocatorsFixture
     {
@@ -2557,6 +2557,29 @@ namespace UnitTest
         }
     }
 
+#if AZ_TRAIT_DISABLE_FAILED_ASSET_MANAGER_TESTS
+    TEST_F(AssetManagerTests, DISABLED_MaxActiveStreamerRequests_QueuedLoadsStillComplete)
+#else
+    TEST_F(AssetManagerTests, MaxActiveStreamerRequests_QueuedLoadsStillComplete)
+#endif // AZ_TRAIT_DISABLE_FAILED_ASSET_MANAGER_TESTS
+    {
+        // With only one streamer request in flight, the other loads wait for their turn but still all finish.
+        m_console->PerformCommand("cl_assetLoadMaxActiveStreamerRequests 1");
+        {
+            auto asset1 = AssetManager::Instance().GetAsset<AssetWithCustomData>(MyAsset1Id, AZ::Data::AssetLoadBehavior::Default);
+            auto asset2 = AssetManager::Instance().GetAsset<AssetWithCustomData>(MyAsset2Id, AZ::Data::AssetLoadBehavior::Default);
+            auto asset3 = AssetManager::Instance().GetAsset<AssetWithCustomData>(MyAsset3Id, AZ::Data::AssetLoadBehavior::Default);
+
+            asset3.BlockUntilLoadComplete();
+            asset2.BlockUntilLoadComplete();
+            asset1.BlockUntilLoadComplete();
+            EXPECT_TRUE(asset1.IsReady());
+            EXPECT_TRUE(asset2.IsReady());
+            EXPECT_TRUE(asset3.IsReady());
+        }
+        m_console->PerformCommand("cl_assetLoadMaxActiveStreamerRequests 0");
+    }
+
 #if AZ_TRAIT_DISABLE_FAILED_ASSET_MANAGER_TESTS
     TEST_F(AssetManagerTests, DISABLED_BlockUntilLoadComplete_AlreadyLoaded_ContinuesImmediately)
 #else
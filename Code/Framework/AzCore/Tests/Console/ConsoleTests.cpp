@@ -346,6 +346,39 @@ namespace AZ
             EXPECT_EQ(2, instance.m_classFuncArgs);
         }
     }
+
+    TEST_F(ConsoleTests, ConsoleFunctor_FindCommand_IsCaseInsensitive)
+    {
+        AZ::IConsole* console = m_console.get();
+        ASSERT_TRUE(console);
+
+        ConsoleFunctorBase* foundCommand = console->FindCommand("testfreefunc");
+        ASSERT_NE(nullptr, foundCommand);
+        EXPECT_STREQ("TestFreeFunc", foundCommand->GetName());
+        EXPECT_EQ(foundCommand, console->FindCommand("TESTFREEFUNC"));
+        EXPECT_EQ(nullptr, console->FindCommand("TestFreeFun"));
+    }
+
+    TEST_F(ConsoleTests, PerformCommands_MultipleLines_ExecutesEveryCommand)
+    {
+        AZ::IConsole* console = m_console.get();
+        ASSERT_TRUE(console);
+
+        testInt32 = 0;
+        testString = "default";
+        s_consoleFreeFuncArgs = 0;
+        constexpr AZStd::string_view commands =
+            "testInt32 42\n"
+            "\n"
+            "# testInt32 7\n"
+            "  testString batched  \r\n"
+            "UnknownCommand 1\n"
+            "TestFreeFunc arg1 arg2 arg3";
+        EXPECT_EQ(3, console->PerformCommands(commands));
+        EXPECT_EQ(42, int32_t(testInt32));
+        EXPECT_STREQ("batched", static_cast<AZ::CVarFixedString>(testString).c_str());
+        EXPECT_EQ(3, s_consoleFreeFuncArgs);
+    }
 }
 
 
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Utils/CpuFeatures.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    namespace
+    {
+        constexpr AZ::u32 Leaf1Sse41 = 1u << 19;
+        constexpr AZ::u32 Leaf1Fma = 1u << 12;
+        constexpr AZ::u32 Leaf1OsXsave = 1u << 27;
+        constexpr AZ::u32 Leaf1Avx = 1u << 28;
+        constexpr AZ::u32 Leaf7Avx2 = 1u << 5;
+        constexpr AZ::u32 Leaf7Avx512F = 1u << 16;
+        constexpr AZ::u64 Xcr0Avx = 0x6;
+        constexpr AZ::u64 Xcr0Avx512 = 0xe6;
+    } // namespace
+
+    TEST(CpuFeatures, IsSupported_None_AlwaysTrue)
+    {
+        EXPECT_TRUE(AZ::CpuFeatures::IsSupported(AZ::CpuFeature::None));
+    }
+
+    TEST(CpuFeatures, IsSupported_MatchesGetSupported)
+    {
+        const AZ::CpuFeature supported = AZ::CpuFeatures::GetSupported();
+        EXPECT_TRUE(AZ::CpuFeatures::IsSupported(supported));
+        if (AZ::CpuFeatures::IsSupported(AZ::CpuFeature::Avx2))
+        {
+            EXPECT_TRUE(AZ::CpuFeatures::IsSupported(AZ::CpuFeature::Avx));
+        }
+    }
+
+    TEST(CpuFeatures, Select_PicksFallbackForMissingFeatures)
+    {
+        const AZ::CpuFeature unsupported = ~AZ::CpuFeatures::GetSupported() & (AZ::CpuFeature::Avx512Vl | AZ::CpuFeature::Neon);
+        EXPECT_EQ(2, AZ::CpuFeatures::Select(unsupported, 1, 2));
+        EXPECT_EQ(1, AZ::CpuFeatures::Select(AZ::CpuFeature::None, 1, 2));
+    }
+
+    TEST(CpuFeatures, DecodeX86Features_AvxWithOsSupport_Reported)
+    {
+        const AZ::CpuFeature features = AZ::CpuFeatures::Internal::DecodeX86Features(
+            Leaf1Sse41 | Leaf1Fma | Leaf1OsXsave | Leaf1Avx, Leaf7Avx2, Xcr0Avx);
+        EXPECT_EQ(AZ::CpuFeature::Sse41 | AZ::CpuFeature::Fma | AZ::CpuFeature::Avx | AZ::CpuFeature::Avx2, features);
+    }
+
+    TEST(CpuFeatures, DecodeX86Features_AvxWithoutOsSupport_NotReported)
+    {
+        // The CPU supports AVX, but the OS doesn't save the registers.
+        EXPECT_EQ(AZ::CpuFeature::Sse41, AZ::CpuFeatures::Internal::DecodeX86Features(
+            Leaf1Sse41 | Leaf1Fma | Leaf1Avx, Leaf7Avx2, Xcr0Avx));
+        EXPECT_EQ(AZ::CpuFeature::Sse41, AZ::CpuFeatures::Internal::DecodeX86Features(
+            Leaf1Sse41 | Leaf1Fma | Leaf1OsXsave | Leaf1Avx, Leaf7Avx2, 0x2));
+    }
+
+    TEST(CpuFeatures, DecodeX86Features_Avx512NeedsOsSupport)
+    {
+        const AZ::u32 leaf1 = Leaf1OsXsave | Leaf1Avx;
+        const AZ::u32 leaf7 = Leaf7Avx2 | Leaf7Avx512F;
+        EXPECT_EQ(AZ::CpuFeature::Avx | AZ::CpuFeature::Avx2, AZ::CpuFeatures::Internal::DecodeX86Features(leaf1, leaf7, Xcr0Avx));
+        EXPECT_EQ(AZ::CpuFeature::Avx | AZ::CpuFeature::Avx2 | AZ::CpuFeature::Avx512F,
+            AZ::CpuFeatures::Internal::DecodeX86Features(leaf1, leaf7, Xcr0Avx512));
+    }
+} // namespace UnitTest
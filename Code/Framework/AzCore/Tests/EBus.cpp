@@ -9,6 +9,7 @@
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/EBus/Results.h>
 #include <AzCore/std/sort.h>
+#include <AzCore/std/string/string.h>
 #include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/thread.h>
@@ -3995,6 +3996,288 @@ namespace UnitTest
 
         idTestRequest.Disconnect();
     }
+
+    class DirectDispatchTestRequests
+        : public AZ::EBusTraits
+    {
+    public:
+        static const AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::ById;
+        static const AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Single;
+        using BusIdType = int32_t;
+
+        virtual int GetValue() = 0;
+        virtual void AddValue(int value) = 0;
+    };
+
+    using DirectDispatchTestRequestBus = AZ::EBus<DirectDispatchTestRequests>;
+
+    class DirectDispatchTestHandler
+        : public DirectDispatchTestRequestBus::Handler
+    {
+    public:
+        int GetValue() override
+        {
+            if (m_disconnectOnCall)
+            {
+                BusDisconnect();
+            }
+            return m_value;
+        }
+
+        void AddValue(int value) override
+        {
+            m_value += value;
+        }
+
+        int m_value = 0;
+        bool m_disconnectOnCall = false;
+    };
+
+    class DirectDispatchTestRouter
+        : public DirectDispatchTestRequestBus::Router
+    {
+    public:
+        int GetValue() override
+        {
+            return 0;
+        }
+
+        void AddValue(int) override
+        {
+            ++m_numRoutedEvents;
+        }
+
+        int m_numRoutedEvents = 0;
+    };
+
+    TEST_F(EBus, EventDirect_HandlerConnected_HandlerReceivesEvents)
+    {
+        DirectDispatchTestHandler handler;
+        handler.BusConnect(1);
+
+        DirectDispatchTestRequestBus::BusPtr ptr;
+        DirectDispatchTestRequestBus::Bind(ptr, 1);
+        DirectDispatchTestRequestBus::EventDirect(ptr, &DirectDispatchTestRequests::AddValue, 5);
+        DirectDispatchTestRequestBus::EventDirect(ptr, &DirectDispatchTestRequests::AddValue, 2);
+
+        int result = 0;
+        DirectDispatchTestRequestBus::EventResultDirect(result, ptr, &DirectDispatchTestRequests::GetValue);
+        EXPECT_EQ(7, result);
+
+        handler.BusDisconnect();
+    }
+
+    TEST_F(EBus, EventDirect_HandlerConnectedAfterBind_HandlerReceivesEvents)
+    {
+        DirectDispatchTestRequestBus::BusPtr ptr;
+        DirectDispatchTestRequestBus::Bind(ptr, 1);
+
+        int result = -1;
+        DirectDispatchTestRequestBus::EventResultDirect(result, ptr, &DirectDispatchTestRequests::GetValue);
+        EXPECT_EQ(-1, result);
+
+        DirectDispatchTestHandler handler;
+        handler.m_value = 3;
+        handler.BusConnect(1);
+        DirectDispatchTestRequestBus::EventResultDirect(result, ptr, &DirectDispatchTestRequests::GetValue);
+        EXPECT_EQ(3, result);
+
+        handler.BusDisconnect();
+        result = -1;
+        DirectDispatchTestRequestBus::EventResultDirect(result, ptr, &DirectDispatchTestRequests::GetValue);
+        EXPECT_EQ(-1, result);
+    }
+
+    TEST_F(EBus, EventDirect_HandlerDisconnectsDuringEvent_DoesNotCrash)
+    {
+        DirectDispatchTestHandler handler;
+        handler.m_value = 4;
+        handler.m_disconnectOnCall = true;
+        handler.BusConnect(1);
+
+        DirectDispatchTestRequestBus::BusPtr ptr;
+        DirectDispatchTestRequestBus::Bind(ptr, 1);
+        int result = 0;
+        DirectDispatchTestRequestBus::EventResultDirect(result, ptr, &DirectDispatchTestRequests::GetValue);
+        EXPECT_EQ(4, result);
+        EXPECT_FALSE(handler.BusIsConnected());
+        EXPECT_FALSE(DirectDispatchTestRequestBus::HasHandlers(ptr));
+    }
+
+    TEST_F(EBus, EventDirect_RouterConnected_EventIsRouted)
+    {
+        DirectDispatchTestHandler handler;
+        handler.BusConnect(1);
+        DirectDispatchTestRouter router;
+        router.BusRouterConnect();
+
+        DirectDispatchTestRequestBus::BusPtr ptr;
+        DirectDispatchTestRequestBus::Bind(ptr, 1);
+        DirectDispatchTestRequestBus::EventDirect(ptr, &DirectDispatchTestRequests::AddValue, 5);
+        EXPECT_EQ(1, router.m_numRoutedEvents);
+        EXPECT_EQ(5, handler.m_value);
+
+        router.BusRouterDisconnect();
+        handler.BusDisconnect();
+    }
+
+    class CoalescedQueueTestNotifications
+        : public AZ::EBusTraits
+    {
+    public:
+        static const AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::ById;
+        static const bool EnableEventQueue = true;
+        using BusIdType = int32_t;
+
+        virtual void OnMoved(float x, float y) = 0;
+        virtual void OnScaled(float scale) = 0;
+        virtual void OnReset() = 0;
+    };
+
+    using CoalescedQueueTestNotificationBus = AZ::EBus<CoalescedQueueTestNotifications>;
+
+    class CoalescedQueueTestHandler
+        : public CoalescedQueueTestNotificationBus::MultiHandler
+    {
+    public:
+        void OnMoved(float x, float y) override
+        {
+            m_calls.push_back(AZStd::string::format("%d:OnMoved(%g,%g)", *CoalescedQueueTestNotificationBus::GetCurrentBusId(), x, y));
+            if (m_requeueOnMoved)
+            {
+                m_requeueOnMoved = false;
+                CoalescedQueueTestNotificationBus::QueueEventCoalesced(*CoalescedQueueTestNotificationBus::GetCurrentBusId(),
+                    &CoalescedQueueTestNotifications::OnMoved, x + 1.0f, y + 1.0f);
+            }
+        }
+
+        void OnScaled(float scale) override
+        {
+            m_calls.push_back(AZStd::string::format("%d:OnScaled(%g)", *CoalescedQueueTestNotificationBus::GetCurrentBusId(), scale));
+        }
+
+        void OnReset() override
+        {
+            m_calls.push_back(AZStd::string::format("%d:OnReset", *CoalescedQueueTestNotificationBus::GetCurrentBusId()));
+        }
+
+        AZStd::vector<AZStd::string> m_calls;
+        bool m_requeueOnMoved = false;
+    };
+
+    class CoalescedQueueTestBroadcasts
+        : public AZ::EBusTraits
+    {
+    public:
+        static const bool EnableEventQueue = true;
+
+        virtual void OnValueChanged(int value) = 0;
+    };
+
+    using CoalescedQueueTestBroadcastBus = AZ::EBus<CoalescedQueueTestBroadcasts>;
+
+    class CoalescedQueueTestBroadcastHandler
+        : public CoalescedQueueTestBroadcastBus::Handler
+    {
+    public:
+        void OnValueChanged(int value) override
+        {
+            m_values.push_back(value);
+        }
+
+        AZStd::vector<int> m_values;
+    };
+
+    TEST_F(EBus, QueueEventCoalesced_SameEventQueuedTwice_CalledOnceWithLatestArguments)
+    {
+        CoalescedQueueTestHandler handler;
+        handler.BusConnect(1);
+
+        CoalescedQueueTestNotificationBus::QueueEventCoalesced(1, &CoalescedQueueTestNotifications::OnMoved, 1.0f, 2.0f);
+        CoalescedQueueTestNotificationBus::QueueEventCoalesced(1, &CoalescedQueueTestNotifications::OnMoved, 3.0f, 4.0f);
+        EXPECT_EQ(1, CoalescedQueueTestNotificationBus::QueuedEventCount());
+        EXPECT_TRUE(handler.m_calls.empty());
+
+        CoalescedQueueTestNotificationBus::ExecuteQueuedEvents();
+        ASSERT_EQ(1, handler.m_calls.size());
+        EXPECT_STREQ("1:OnMoved(3,4)", handler.m_calls[0].c_str());
+        EXPECT_EQ(0, CoalescedQueueTestNotificationBus::QueuedEventCount());
+
+        handler.BusDisconnect();
+    }
+
+    TEST_F(EBus, QueueEventCoalesced_DifferentAddressesAndEvents_KeptSeparateInFirstQueuedOrder)
+    {
+        CoalescedQueueTestHandler handler;
+        handler.BusConnect(1);
+        handler.BusConnect(2);
+
+        CoalescedQueueTestNotificationBus::QueueEventCoalesced(1, &CoalescedQueueTestNotifications::OnMoved, 1.0f, 1.0f);
+        CoalescedQueueTestNotificationBus::QueueEventCoalesced(2, &CoalescedQueueTestNotifications::OnMoved, 2.0f, 2.0f);
+        CoalescedQueueTestNotificationBus::QueueEventCoalesced(1, &CoalescedQueueTestNotifications::OnScaled, 5.0f);
+        CoalescedQueueTestNotificationBus::QueueEventCoalesced(2, &CoalescedQueueTestNotifications::OnReset);
+        CoalescedQueueTestNotificationBus::QueueEventCoalesced(1, &CoalescedQueueTestNotifications::OnMoved, 7.0f, 8.0f);
+        CoalescedQueueTestNotificationBus::QueueEventCoalesced(2, &CoalescedQueueTestNotifications::OnReset);
+        EXPECT_EQ(4, CoalescedQueueTestNotificationBus::QueuedEventCount());
+
+        CoalescedQueueTestNotificationBus::ExecuteQueuedEvents();
+        ASSERT_EQ(4, handler.m_calls.size());
+        EXPECT_STREQ("1:OnMoved(7,8)", handler.m_calls[0].c_str());
+        EXPECT_STREQ("2:OnMoved(2,2)", handler.m_calls[1].c_str());
+        EXPECT_STREQ("1:OnScaled(5)", handler.m_calls[2].c_str());
+        EXPECT_STREQ("2:OnReset", handler.m_calls[3].c_str());
+
+        handler.BusDisconnect();
+    }
+
+    TEST_F(EBus, QueueEventCoalesced_QueuedFromHandler_CalledInSameExecute)
+    {
+        CoalescedQueueTestHandler handler;
+        handler.m_requeueOnMoved = true;
+        handler.BusConnect(1);
+
+        CoalescedQueueTestNotificationBus::QueueEventCoalesced(1, &CoalescedQueueTestNotifications::OnMoved, 1.0f, 1.0f);
+        CoalescedQueueTestNotificationBus::ExecuteQueuedEvents();
+        ASSERT_EQ(2, handler.m_calls.size());
+        EXPECT_STREQ("1:OnMoved(1,1)", handler.m_calls[0].c_str());
+        EXPECT_STREQ("1:OnMoved(2,2)", handler.m_calls[1].c_str());
+        EXPECT_EQ(0, CoalescedQueueTestNotificationBus::QueuedEventCount());
+
+        handler.BusDisconnect();
+    }
+
+    TEST_F(EBus, QueueEventCoalesced_ClearQueuedEvents_EventsNotCalled)
+    {
+        CoalescedQueueTestHandler handler;
+        handler.BusConnect(1);
+
+        CoalescedQueueTestNotificationBus::QueueEventCoalesced(1, &CoalescedQueueTestNotifications::OnReset);
+        CoalescedQueueTestNotificationBus::QueueEvent(1, &CoalescedQueueTestNotifications::OnReset);
+        EXPECT_EQ(2, CoalescedQueueTestNotificationBus::QueuedEventCount());
+        CoalescedQueueTestNotificationBus::ClearQueuedEvents();
+        EXPECT_EQ(0, CoalescedQueueTestNotificationBus::QueuedEventCount());
+
+        CoalescedQueueTestNotificationBus::ExecuteQueuedEvents();
+        EXPECT_TRUE(handler.m_calls.empty());
+
+        handler.BusDisconnect();
+    }
+
+    TEST_F(EBus, QueueBroadcastCoalesced_SameEventQueuedManyTimes_CalledOnceWithLatestArguments)
+    {
+        CoalescedQueueTestBroadcastHandler handler;
+        handler.BusConnect();
+
+        for (int i = 0; i < 100; ++i)
+        {
+            CoalescedQueueTestBroadcastBus::QueueBroadcastCoalesced(&CoalescedQueueTestBroadcasts::OnValueChanged, i);
+        }
+        CoalescedQueueTestBroadcastBus::ExecuteQueuedEvents();
+        ASSERT_EQ(1, handler.m_values.size());
+        EXPECT_EQ(99, handler.m_values[0]);
+
+        handler.BusDisconnect();
+    }
 } // namespace UnitTest
 
 #if defined(HAVE_BENCHMARK)
@@ -4165,12 +4448,20 @@ namespace Benchmark
     cb(fn, OneToManyOrdered, OneToMany)         \
     BUS_BENCHMARK_PRIVATE_LIST_ID(cb, fn)
 
+// Internal macro callback for listing all buses requiring ids with a single handler per address
+#define BUS_BENCHMARK_PRIVATE_LIST_ID_SINGLE_HANDLER(cb, fn) \
+    cb(fn, ManyToOne, ManyToOne)                             \
+    cb(fn, ManyOrderedToOne, ManyToOne)
+
 // Internal macro callback for registering a benchmark
 #define BUS_BENCHMARK_PRIVATE_REGISTER(fn, BusDef, SettingsFn) BENCHMARK_TEMPLATE(fn, BusDef)->Apply(&BenchmarkSettings::SettingsFn);
 
 // Register a benchmark for all bus permutations requiring ids
 #define BUS_BENCHMARK_REGISTER_ID(fn) BUS_BENCHMARK_PRIVATE_LIST_ID(BUS_BENCHMARK_PRIVATE_REGISTER, fn)
 
+// Register a benchmark for all bus permutations requiring ids with a single handler per address
+#define BUS_BENCHMARK_REGISTER_ID_SINGLE_HANDLER(fn) BUS_BENCHMARK_PRIVATE_LIST_ID_SINGLE_HANDLER(BUS_BENCHMARK_PRIVATE_REGISTER, fn)
+
 // Register a benchmark for all bus permutations
 #define BUS_BENCHMARK_REGISTER_ALL(fn) BUS_BENCHMARK_PRIVATE_LIST_ALL(BUS_BENCHMARK_PRIVATE_REGISTER, fn)
 
@@ -4336,6 +4627,40 @@ namespace Benchmark
     }
     BUS_BENCHMARK_REGISTER_ID(BM_EBus_EventCachedResult);
 
+    template <typename Bus>
+    static void BM_EBus_EventDirect(::benchmark::State& state)
+    {
+        s_benchmarkEBusEnv<Bus>.Connect(state);
+        typename Bus::BusPtr cachedPtr;
+        constexpr typename Bus::BusIdType firstConnectedAddressId{ 0 };
+        Bus::Bind(cachedPtr, firstConnectedAddressId);
+
+        while (state.KeepRunning())
+        {
+            Bus::EventDirect(cachedPtr, &Bus::Events::OnEvent);
+        }
+        s_benchmarkEBusEnv<Bus>.Disconnect(state);
+    }
+    BUS_BENCHMARK_REGISTER_ID_SINGLE_HANDLER(BM_EBus_EventDirect);
+
+    template <typename Bus>
+    static void BM_EBus_EventDirectResult(::benchmark::State& state)
+    {
+        s_benchmarkEBusEnv<Bus>.Connect(state);
+        typename Bus::BusPtr cachedPtr;
+        constexpr typename Bus::BusIdType firstConnectedAddressId{ 0 };
+        Bus::Bind(cachedPtr, firstConnectedAddressId);
+
+        while (state.KeepRunning())
+        {
+            int result = 0;
+            Bus::EventResultDirect(result, cachedPtr, &Bus::Events::OnEvent);
+            ::benchmark::DoNotOptimize(result);
+        }
+        s_benchmarkEBusEnv<Bus>.Disconnect(state);
+    }
+    BUS_BENCHMARK_REGISTER_ID_SINGLE_HANDLER(BM_EBus_EventDirectResult);
+
     //////////////////////////////////////////////////////////////////////////
     // Broadcast/Event Queuing
     //////////////////////////////////////////////////////////////////////////
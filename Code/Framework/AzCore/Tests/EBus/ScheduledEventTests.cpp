@@ -102,4 +102,33 @@ namespace UnitTest
         // Use EXPECT_GT in case the OS oversleeps long enough to cause unexpected extra timer pops
         EXPECT_GT(m_requeuedEventTriggerCount, 1);
     }
+
+    TEST_F(ScheduledEventTests, TestFireOnceAcrossWheelLevels)
+    {
+        // Durations that land in the first, second and third level of the timing wheel
+        uint32_t triggerCounts[3] = { 0, 0, 0 };
+        AZ::ScheduledEvent shortEvent([&triggerCounts] { ++triggerCounts[0]; }, AZ::Name("UnitTestEvent short"));
+        AZ::ScheduledEvent mediumEvent([&triggerCounts] { ++triggerCounts[1]; }, AZ::Name("UnitTestEvent medium"));
+        AZ::ScheduledEvent longEvent([&triggerCounts] { ++triggerCounts[2]; }, AZ::Name("UnitTestEvent long"));
+        shortEvent.Enqueue(AZ::TimeMs(10));
+        mediumEvent.Enqueue(AZ::TimeMs(150));
+        longEvent.Enqueue(AZ::TimeMs(700));
+        EXPECT_EQ(m_eventSchedulerComponent->GetQueueSize(), 3);
+
+        constexpr AZ::TimeMs TotalIterationTimeMs = AZ::TimeMs{ 1050 };
+        const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+        for (;;)
+        {
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(25));
+            m_eventSchedulerComponent->OnTick(0.0f, AZ::ScriptTimePoint());
+            if (AZ::GetElapsedTimeMs() - startTimeMs > TotalIterationTimeMs)
+            {
+                break;
+            }
+        }
+        EXPECT_EQ(triggerCounts[0], 1);
+        EXPECT_EQ(triggerCounts[1], 1);
+        EXPECT_EQ(triggerCounts[2], 1);
+        EXPECT_EQ(m_eventSchedulerComponent->GetQueueSize(), 0);
+    }
 }
@@ -209,6 +209,32 @@ namespace UnitTest
         }
     };
 
+    // Used to verify that entities can be activated in steps, as is done for parallel activation.
+    class ThreadSafeActivationTestComponent
+        : public AZ::Component
+    {
+    public:
+        AZ_COMPONENT(ThreadSafeActivationTestComponent, "{6B1D3E52-94A7-4C8F-A2E0-5D7F3C9B1A64}");
+
+        ///////////////////////////////////////
+        // Component overrides
+        void Activate() override { m_isActive = true; }
+        void Deactivate() override { m_isActive = false; }
+        bool IsActivationThreadSafe() const override { return true; }
+        ///////////////////////////////////////
+
+        static void Reflect(AZ::ReflectContext* reflection)
+        {
+            AZ::SerializeContext* serializeContext = azrtti_cast<AZ::SerializeContext*>(reflection);
+            if (serializeContext)
+            {
+                serializeContext->Class<ThreadSafeActivationTestComponent, AZ::Component>();
+            }
+        }
+
+        bool m_isActive = false;
+    };
+
     // This component wraps the component base class, like GenericComponentWrapper.
     // GenericComponentWrapper is used in the editor for components that don't have specific editor representations.
     // Its usage depends on other editor systems being setup, so this is meant to simulate its usage.
@@ -460,6 +486,8 @@ namespace UnitTest
             m_sortWrapperDescriptor->Reflect(m_serializeContext);
             m_sortNoServiceDescriptor = SortOrderTestNoService::CreateDescriptor();
             m_sortNoServiceDescriptor->Reflect(m_serializeContext);
+            m_threadSafeActivationDescriptor = ThreadSafeActivationTestComponent::CreateDescriptor();
+            m_threadSafeActivationDescriptor->Reflect(m_serializeContext);
 
             m_duplicateProvidedServiceComponentDescriptor = DuplicateProvidedServiceComponent::CreateDescriptor();
             m_duplicateProvidedServiceComponentDescriptor->Reflect(m_serializeContext);
@@ -477,6 +505,7 @@ namespace UnitTest
             m_dependsOnDuplicateServiceComponentDescriptor->ReleaseDescriptor();
             m_duplicateProvidedServiceComponentDescriptor->ReleaseDescriptor();
 
+            m_threadSafeActivationDescriptor->ReleaseDescriptor();
             m_sortNoServiceDescriptor->ReleaseDescriptor();
             m_sortWrapperDescriptor->ReleaseDescriptor();
             m_sortSecondAndThirdDependencyDescriptor->ReleaseDescriptor();
@@ -512,6 +541,7 @@ namespace UnitTest
         AZ::ComponentDescriptor* m_sortSecondAndThirdDependencyDescriptor = nullptr;
         AZ::ComponentDescriptor* m_sortWrapperDescriptor = nullptr;
         AZ::ComponentDescriptor* m_sortNoServiceDescriptor = nullptr;
+        AZ::ComponentDescriptor* m_threadSafeActivationDescriptor = nullptr;
         AZ::ComponentDescriptor* m_duplicateProvidedServiceComponentDescriptor = nullptr;
         AZ::ComponentDescriptor* m_dependsOnDuplicateServiceComponentDescriptor = nullptr;
         AZ::ComponentDescriptor* m_requiresDuplicateServiceComponentDescriptor = nullptr;
@@ -673,6 +703,37 @@ namespace UnitTest
         entity.EvaluateDependencies();
     }
 
+    TEST_F(EntityTests, EntityActivation_ThreadSafeComponents_EntityIsActivationThreadSafe)
+    {
+        AZ::Entity entity;
+        entity.CreateComponent<ThreadSafeActivationTestComponent>();
+        EXPECT_TRUE(entity.IsActivationThreadSafe());
+
+        entity.CreateComponent<SortOrderTestNoService>();
+        EXPECT_FALSE(entity.IsActivationThreadSafe());
+    }
+
+    TEST_F(EntityTests, EntityActivation_ActivateInSteps_EntityIsActive)
+    {
+        AZ::Entity entity;
+        auto* component = entity.CreateComponent<ThreadSafeActivationTestComponent>();
+        entity.Init();
+
+        ASSERT_TRUE(entity.BeginActivation());
+        EXPECT_EQ(AZ::Entity::State::Activating, entity.GetState());
+        EXPECT_FALSE(component->m_isActive);
+
+        entity.ActivateComponents();
+        EXPECT_TRUE(component->m_isActive);
+        EXPECT_EQ(AZ::Entity::State::Activating, entity.GetState());
+
+        entity.EndActivation();
+        EXPECT_EQ(AZ::Entity::State::Active, entity.GetState());
+
+        entity.Deactivate();
+        EXPECT_FALSE(component->m_isActive);
+    }
+
     TEST_F(EntityTests, EntityIsMoveConstructed)
     {
         static_assert(!AZStd::is_copy_constructible<AZ::Entity>::value, "Entity is dangerous to copy construct.");
@@ -6,6 +6,7 @@
  *
  */
 
+#include <AzCore/Jobs/CpuTopology.h>
 #include <AzCore/Jobs/Job.h>
 #include <AzCore/Jobs/JobCompletion.h>
 #include <AzCore/Jobs/JobCompletionSpin.h>
@@ -1652,6 +1653,95 @@ namespace UnitTest
     {
         RunTest();
     }
+    class JobTopologyTest
+        : public AllocatorsTestFixture
+    {
+    protected:
+        // Two NUMA nodes, two clusters per node, two processors per cluster.
+        static CpuTopology CreateDualSocketTopology()
+        {
+            CpuTopology topology;
+            for (AZ::u32 i = 0; i < 8; ++i)
+            {
+                CpuTopology::LogicalProcessor processor;
+                processor.m_id = i;
+                processor.m_coreCluster = i / 2;
+                processor.m_numaNode = i / 4;
+                topology.m_processors.push_back(processor);
+            }
+            topology.m_numCoreClusters = 4;
+            topology.m_numNumaNodes = 2;
+            return topology;
+        }
+    };
+
+    TEST_F(JobTopologyTest, AddWorkersFromTopology_PartialWorkerSet_BalancedAcrossNodes)
+    {
+        const CpuTopology topology = CreateDualSocketTopology();
+        EXPECT_TRUE(topology.IsHierarchical());
+
+        JobManagerDesc desc;
+        desc.AddWorkersFromTopology(topology, 4);
+        ASSERT_EQ(4, desc.m_workerThreads.size());
+
+        AZ::u32 workersPerNode[2] = { 0, 0 };
+        for (const JobManagerThreadDesc& worker : desc.m_workerThreads)
+        {
+            ASSERT_LT(worker.m_numaNode, 2u);
+            ++workersPerNode[worker.m_numaNode];
+            EXPECT_EQ(worker.m_numaNode, worker.m_coreCluster / 2);
+        }
+        EXPECT_EQ(2u, workersPerNode[0]);
+        EXPECT_EQ(2u, workersPerNode[1]);
+    }
+
+    TEST_F(JobTopologyTest, AddWorkersFromTopology_Oversubscribed_WrapsAround)
+    {
+        JobManagerDesc desc;
+        desc.AddWorkersFromTopology(CreateDualSocketTopology(), 10);
+        ASSERT_EQ(10, desc.m_workerThreads.size());
+        EXPECT_EQ(desc.m_workerThreads[0].m_cpuId, desc.m_workerThreads[8].m_cpuId);
+    }
+
+    TEST_F(JobTopologyTest, GetDistance_OrdersClusterNodeRemote)
+    {
+        EXPECT_EQ(0u, CpuTopology::GetDistance(0, 0, 0, 0));
+        EXPECT_EQ(1u, CpuTopology::GetDistance(0, 0, 1, 0));
+        EXPECT_EQ(2u, CpuTopology::GetDistance(0, 0, 2, 1));
+        EXPECT_EQ(0u, CpuTopology::GetDistance(CpuTopology::Unknown, CpuTopology::Unknown, 2, 1));
+    }
+
+    TEST_F(JobTopologyTest, HierarchicalWorkers_RunForkedJobs)
+    {
+        AllocatorInstance<PoolAllocator>::Create();
+        AllocatorInstance<ThreadPoolAllocator>::Create();
+
+        JobManagerDesc desc;
+        desc.AddWorkersFromTopology(CreateDualSocketTopology(), 8);
+        for (JobManagerThreadDesc& worker : desc.m_workerThreads)
+        {
+            worker.m_cpuId = -1; // keep the group information for stealing, but don't pin on the test machine
+        }
+
+        {
+            JobManager jobManager(desc);
+            JobContext jobContext(jobManager);
+
+            AZStd::atomic<int> counter{ 0 };
+            JobCompletion completion(&jobContext);
+            for (int i = 0; i < 256; ++i)
+            {
+                Job* job = CreateJobFunction([&counter]() { counter.fetch_add(1); }, true, &jobContext);
+                job->SetDependent(&completion);
+                job->Start();
+            }
+            completion.StartAndWaitForCompletion();
+            EXPECT_EQ(256, counter.load());
+        }
+
+        AllocatorInstance<ThreadPoolAllocator>::Destroy();
+        AllocatorInstance<PoolAllocator>::Destroy();
+    }
 } // UnitTest
 
 #if defined(HAVE_BENCHMARK)
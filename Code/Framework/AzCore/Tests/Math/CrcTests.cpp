@@ -8,6 +8,7 @@
 
 #include <AzCore/Math/Crc.h>
 #include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/UnitTest/TestTypes.h>
 
 
@@ -61,6 +62,22 @@ namespace Benchmark
     }
 
     BENCHMARK(MeasureCrc32ConstevalTime);
+
+    static void Crc32RuntimeThroughput(::benchmark::State& state)
+    {
+        AZStd::vector<uint8_t> buffer(static_cast<size_t>(state.range(0)));
+        for (size_t i = 0; i < buffer.size(); ++i)
+        {
+            buffer[i] = static_cast<uint8_t>(i * 31 + 7);
+        }
+        for (auto _ : state)
+        {
+            AZ::Crc32 crc(buffer.data(), buffer.size());
+            benchmark::DoNotOptimize(crc);
+        }
+        state.SetBytesProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(Crc32RuntimeThroughput)->Arg(16)->Arg(64)->Arg(1024)->Arg(64 * 1024);
 }
 
 #endif
@@ -104,6 +121,58 @@ namespace UnitTest
         EXPECT_EQ(AZ::Crc32(0x0d4a1185), addResult);
     }
 
+    namespace
+    {
+        //! Bit by bit CRC-32, to check the table driven and the hardware accelerated implementations against.
+        AZ::u32 ReferenceCrc32(const uint8_t* data, size_t size, bool forceLowerCase)
+        {
+            AZ::u32 crc = 0xffffffff;
+            for (size_t i = 0; i < size; ++i)
+            {
+                uint8_t value = data[i];
+                if (forceLowerCase && value >= 'A' && value <= 'Z')
+                {
+                    value = static_cast<uint8_t>(value + 'a' - 'A');
+                }
+                crc ^= value;
+                for (int bit = 0; bit < 8; ++bit)
+                {
+                    crc = (crc >> 1) ^ (0xedb88320 & (0u - (crc & 1)));
+                }
+            }
+            return crc ^ 0xffffffff;
+        }
+    } // namespace
+
+    TEST_F(Crc32Fixture, Runtime_MatchesCompileTime)
+    {
+        constexpr AZ::Crc32 compileTime("EditorData");
+        AZStd::string_view view("EditorData");
+        EXPECT_EQ(compileTime, AZ::Crc32(view));
+        EXPECT_EQ(AZ::Crc32(0xcb5df48c), AZ::Crc32(view.data(), 6, false));
+    }
+
+    TEST_F(Crc32Fixture, Runtime_LargeBuffers_MatchReference)
+    {
+        AZStd::vector<uint8_t> buffer(4200);
+        for (size_t i = 0; i < buffer.size(); ++i)
+        {
+            buffer[i] = static_cast<uint8_t>((i * 2654435761u) >> 13);
+        }
+        // Sizes around the 8 byte steps, the 16 and 64 byte blocks of the folding path and the 256 byte lowercase chunks,
+        // read from unaligned offsets.
+        constexpr size_t sizes[] = { 1, 7, 8, 9, 15, 16, 63, 64, 65, 127, 128, 129, 255, 256, 257, 1000, 4099 };
+        for (size_t offset = 0; offset < 4; ++offset)
+        {
+            for (size_t size : sizes)
+            {
+                const uint8_t* data = buffer.data() + offset;
+                EXPECT_EQ(ReferenceCrc32(data, size, false), AZ::Crc32(data, size, false)) << "size " << size << " offset " << offset;
+                EXPECT_EQ(ReferenceCrc32(data, size, true), AZ::Crc32(data, size, true)) << "size " << size << " offset " << offset;
+            }
+        }
+    }
+
     TEST_F(Crc32Fixture, CrcConstevalMacro_IsConstexpr)
     {
         AZ::Crc32 constEvalLiteralValue = AZ_CRC_CE("Hello");
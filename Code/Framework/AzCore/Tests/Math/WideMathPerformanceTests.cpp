@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#if defined(HAVE_BENCHMARK)
+
+#include <AzCore/Math/BatchMath.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+#include <random>
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    //! Compares looping over arrays with the scalar math types against the batch kernels, which use the wide math types.
+    class BM_MathWide
+        : public benchmark::Fixture
+    {
+    public:
+        void SetUp([[maybe_unused]] const ::benchmark::State& state) override
+        {
+            constexpr size_t count = 1000;
+
+            const unsigned int seed = 1;
+            std::mt19937_64 rng(seed);
+            std::uniform_real_distribution<float> distFloat(-1.0f, 1.0f);
+
+            auto randomVector = [&distFloat, &rng]()
+            {
+                return AZ::Vector3(distFloat(rng), distFloat(rng), distFloat(rng));
+            };
+            auto randomQuaternion = [&distFloat, &rng]()
+            {
+                return AZ::Quaternion(distFloat(rng), distFloat(rng), distFloat(rng), distFloat(rng)).GetNormalized();
+            };
+
+            m_transform = AZ::Transform(randomVector(), randomQuaternion(), 1.5f);
+            m_vectors1.resize(count);
+            m_vectors2.resize(count);
+            m_quaternions1.resize(count);
+            m_quaternions2.resize(count);
+            m_transforms1.resize(count);
+            m_transforms2.resize(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                m_vectors1[i] = randomVector();
+                m_vectors2[i] = randomVector();
+                m_quaternions1[i] = randomQuaternion();
+                m_quaternions2[i] = randomQuaternion();
+                m_transforms1[i] = AZ::Transform(randomVector(), m_quaternions1[i], 1.0f + distFloat(rng) * 0.5f);
+                m_transforms2[i] = AZ::Transform(randomVector(), m_quaternions2[i], 1.0f + distFloat(rng) * 0.5f);
+            }
+            m_vectorResults.resize(count);
+            m_floatResults.resize(count);
+            m_quaternionResults.resize(count);
+            m_transformResults.resize(count);
+        }
+
+        void TearDown([[maybe_unused]] const ::benchmark::State& state) override
+        {
+            m_vectors1 = {};
+            m_vectors2 = {};
+            m_quaternions1 = {};
+            m_quaternions2 = {};
+            m_transforms1 = {};
+            m_transforms2 = {};
+            m_vectorResults = {};
+            m_floatResults = {};
+            m_quaternionResults = {};
+            m_transformResults = {};
+        }
+
+        AZ::Transform m_transform;
+        std::vector<AZ::Vector3> m_vectors1;
+        std::vector<AZ::Vector3> m_vectors2;
+        std::vector<AZ::Quaternion> m_quaternions1;
+        std::vector<AZ::Quaternion> m_quaternions2;
+        std::vector<AZ::Transform> m_transforms1;
+        std::vector<AZ::Transform> m_transforms2;
+        std::vector<AZ::Vector3> m_vectorResults;
+        std::vector<float> m_floatResults;
+        std::vector<AZ::Quaternion> m_quaternionResults;
+        std::vector<AZ::Transform> m_transformResults;
+    };
+
+    BENCHMARK_F(BM_MathWide, TransformPoints_Scalar)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < m_vectors1.size(); ++i)
+            {
+                m_vectorResults[i] = m_transform.TransformPoint(m_vectors1[i]);
+            }
+            benchmark::DoNotOptimize(m_vectorResults.data());
+        }
+    }
+
+    BENCHMARK_F(BM_MathWide, TransformPoints_Batch)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AZ::BatchMath::TransformPoints(m_transform, m_vectors1.data(), m_vectorResults.data(), m_vectors1.size());
+            benchmark::DoNotOptimize(m_vectorResults.data());
+        }
+    }
+
+    BENCHMARK_F(BM_MathWide, MultiplyTransforms_Scalar)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < m_transforms1.size(); ++i)
+            {
+                m_transformResults[i] = m_transforms1[i] * m_transforms2[i];
+            }
+            benchmark::DoNotOptimize(m_transformResults.data());
+        }
+    }
+
+    BENCHMARK_F(BM_MathWide, MultiplyTransforms_Batch)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AZ::BatchMath::MultiplyTransforms(m_transforms1.data(), m_transforms2.data(), m_transformResults.data(), m_transforms1.size());
+            benchmark::DoNotOptimize(m_transformResults.data());
+        }
+    }
+
+    BENCHMARK_F(BM_MathWide, NormalizeVectors_Scalar)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < m_vectors1.size(); ++i)
+            {
+                m_vectorResults[i] = m_vectors1[i].GetNormalized();
+            }
+            benchmark::DoNotOptimize(m_vectorResults.data());
+        }
+    }
+
+    BENCHMARK_F(BM_MathWide, NormalizeVectors_Batch)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AZ::BatchMath::NormalizeVectors(m_vectors1.data(), m_vectorResults.data(), m_vectors1.size());
+            benchmark::DoNotOptimize(m_vectorResults.data());
+        }
+    }
+
+    BENCHMARK_F(BM_MathWide, DotProducts_Scalar)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < m_vectors1.size(); ++i)
+            {
+                m_floatResults[i] = m_vectors1[i].Dot(m_vectors2[i]);
+            }
+            benchmark::DoNotOptimize(m_floatResults.data());
+        }
+    }
+
+    BENCHMARK_F(BM_MathWide, DotProducts_Batch)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AZ::BatchMath::DotProducts(m_vectors1.data(), m_vectors2.data(), m_floatResults.data(), m_vectors1.size());
+            benchmark::DoNotOptimize(m_floatResults.data());
+        }
+    }
+
+    BENCHMARK_F(BM_MathWide, SlerpQuaternions_Scalar)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < m_quaternions1.size(); ++i)
+            {
+                m_quaternionResults[i] = m_quaternions1[i].Slerp(m_quaternions2[i], 0.3f);
+            }
+            benchmark::DoNotOptimize(m_quaternionResults.data());
+        }
+    }
+
+    BENCHMARK_F(BM_MathWide, SlerpQuaternions_Batch)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AZ::BatchMath::SlerpQuaternions(
+                m_quaternions1.data(), m_quaternions2.data(), 0.3f, m_quaternionResults.data(), m_quaternions1.size());
+            benchmark::DoNotOptimize(m_quaternionResults.data());
+        }
+    }
+} // namespace Benchmark
+
+#endif
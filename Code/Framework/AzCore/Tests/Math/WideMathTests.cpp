@@ -0,0 +1,257 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/BatchMath.h>
+#include <AzCore/Math/TransformWide.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AZTestShared/Math/MathTestHelpers.h>
+
+namespace UnitTest
+{
+    namespace
+    {
+        AZ::Vector3 GetTestVector(size_t index)
+        {
+            const float value = static_cast<float>(index % 11);
+            return AZ::Vector3(0.5f * value - 3.0f, 1.5f - 0.25f * value, 0.1f * value * value - 2.0f);
+        }
+
+        AZ::Quaternion GetTestQuaternion(size_t index)
+        {
+            const float value = static_cast<float>(index % 7);
+            return AZ::Quaternion::CreateFromAxisAngle(GetTestVector(index + 1).GetNormalized(), 0.7f * value - 2.0f);
+        }
+
+        AZ::Transform GetTestTransform(size_t index)
+        {
+            return AZ::Transform(GetTestVector(index + 3), GetTestQuaternion(index + 2), 0.5f + 0.25f * static_cast<float>(index % 5));
+        }
+    } // namespace
+
+    // Counts that cover a partial batch, a full batch and several batches with a partial one at the end, both for the wide
+    // implementations and for the 8 element batches of the AVX2 implementations picked on CPUs that support them.
+    constexpr size_t BatchMathCounts[] = { 1, 3, AZ::Vector3Wide::LaneCount, 2 * AZ::Vector3Wide::LaneCount + 1, 16, 37 };
+
+    TEST(MATH_Vector3Wide, LoadStoreRoundTrips)
+    {
+        AZ::Vector3 vectors[AZ::Vector3Wide::LaneCount];
+        for (size_t i = 0; i < AZ::Vector3Wide::LaneCount; ++i)
+        {
+            vectors[i] = GetTestVector(i);
+        }
+        const AZ::Vector3Wide wide = AZ::Vector3Wide::Load(vectors);
+        for (size_t i = 0; i < AZ::Vector3Wide::LaneCount; ++i)
+        {
+            EXPECT_THAT(wide.GetLane(i), IsClose(vectors[i]));
+        }
+    }
+
+    TEST(MATH_Vector3Wide, PartialLoadRepeatsLastVector)
+    {
+        const AZ::Vector3 vectors[2] = { GetTestVector(0), GetTestVector(1) };
+        const AZ::Vector3Wide wide = AZ::Vector3Wide::Load(vectors, 2);
+        for (size_t i = 1; i < AZ::Vector3Wide::LaneCount; ++i)
+        {
+            EXPECT_THAT(wide.GetLane(i), IsClose(vectors[1]));
+        }
+    }
+
+    TEST(MATH_Vector3Wide, OperationsMatchVector3)
+    {
+        AZ::Vector3 lhs[AZ::Vector3Wide::LaneCount];
+        AZ::Vector3 rhs[AZ::Vector3Wide::LaneCount];
+        for (size_t i = 0; i < AZ::Vector3Wide::LaneCount; ++i)
+        {
+            lhs[i] = GetTestVector(i);
+            rhs[i] = GetTestVector(i + 5);
+        }
+        const AZ::Vector3Wide lhsWide = AZ::Vector3Wide::Load(lhs);
+        const AZ::Vector3Wide rhsWide = AZ::Vector3Wide::Load(rhs);
+        const AZ::Vector3Wide sum = lhsWide + rhsWide;
+        const AZ::Vector3Wide cross = lhsWide.Cross(rhsWide);
+        const AZ::Vector3Wide normalized = lhsWide.GetNormalized();
+        const AZ::Vector3Wide lerped = lhsWide.Lerp(rhsWide, AZ::Simd::Vec4::Splat(0.3f));
+        alignas(16) float dots[AZ::Vector3Wide::LaneCount];
+        AZ::Simd::Vec4::StoreAligned(dots, lhsWide.Dot(rhsWide));
+        for (size_t i = 0; i < AZ::Vector3Wide::LaneCount; ++i)
+        {
+            EXPECT_THAT(sum.GetLane(i), IsClose(lhs[i] + rhs[i]));
+            EXPECT_THAT(cross.GetLane(i), IsClose(lhs[i].Cross(rhs[i])));
+            EXPECT_THAT(normalized.GetLane(i), IsClose(lhs[i].GetNormalized()));
+            EXPECT_THAT(lerped.GetLane(i), IsClose(lhs[i].Lerp(rhs[i], 0.3f)));
+            EXPECT_NEAR(dots[i], lhs[i].Dot(rhs[i]), 1e-4f);
+        }
+    }
+
+    TEST(MATH_Vector3Wide, NormalizeZeroVectorStaysZero)
+    {
+        const AZ::Vector3Wide normalized = AZ::Vector3Wide::CreateZero().GetNormalized();
+        for (size_t i = 0; i < AZ::Vector3Wide::LaneCount; ++i)
+        {
+            EXPECT_THAT(normalized.GetLane(i), IsClose(AZ::Vector3::CreateZero()));
+        }
+    }
+
+    TEST(MATH_QuaternionWide, OperationsMatchQuaternion)
+    {
+        AZ::Quaternion lhs[AZ::QuaternionWide::LaneCount];
+        AZ::Quaternion rhs[AZ::QuaternionWide::LaneCount];
+        AZ::Vector3 vectors[AZ::QuaternionWide::LaneCount];
+        for (size_t i = 0; i < AZ::QuaternionWide::LaneCount; ++i)
+        {
+            lhs[i] = GetTestQuaternion(i);
+            rhs[i] = GetTestQuaternion(i + 7);
+            vectors[i] = GetTestVector(i);
+        }
+        const AZ::QuaternionWide lhsWide = AZ::QuaternionWide::Load(lhs);
+        const AZ::QuaternionWide rhsWide = AZ::QuaternionWide::Load(rhs);
+        const AZ::QuaternionWide product = lhsWide * rhsWide;
+        const AZ::Vector3Wide rotated = lhsWide.TransformVector(AZ::Vector3Wide::Load(vectors));
+        for (size_t i = 0; i < AZ::QuaternionWide::LaneCount; ++i)
+        {
+            EXPECT_THAT(product.GetLane(i), IsClose(lhs[i] * rhs[i]));
+            EXPECT_THAT(rotated.GetLane(i), IsClose(lhs[i].TransformVector(vectors[i])));
+        }
+    }
+
+    TEST(MATH_QuaternionWide, SlerpMatchesQuaternion)
+    {
+        AZ::Quaternion from[AZ::QuaternionWide::LaneCount];
+        AZ::Quaternion to[AZ::QuaternionWide::LaneCount];
+        for (size_t i = 0; i < AZ::QuaternionWide::LaneCount; ++i)
+        {
+            from[i] = GetTestQuaternion(i);
+            to[i] = GetTestQuaternion(i + 3);
+        }
+        // Covers the linear fallback for nearly identical rotations and the shortest path for opposite signs.
+        to[0] = from[0];
+        to[1] = -GetTestQuaternion(9);
+
+        for (const float t : { 0.0f, 0.25f, 0.5f, 1.0f })
+        {
+            const AZ::QuaternionWide slerped = AZ::QuaternionWide::Load(from).Slerp(AZ::QuaternionWide::Load(to), AZ::Simd::Vec4::Splat(t));
+            for (size_t i = 0; i < AZ::QuaternionWide::LaneCount; ++i)
+            {
+                EXPECT_THAT(slerped.GetLane(i), IsClose(from[i].Slerp(to[i], t)));
+            }
+        }
+    }
+
+    TEST(MATH_TransformWide, OperationsMatchTransform)
+    {
+        AZ::Transform lhs[AZ::TransformWide::LaneCount];
+        AZ::Transform rhs[AZ::TransformWide::LaneCount];
+        AZ::Vector3 vectors[AZ::TransformWide::LaneCount];
+        for (size_t i = 0; i < AZ::TransformWide::LaneCount; ++i)
+        {
+            lhs[i] = GetTestTransform(i);
+            rhs[i] = GetTestTransform(i + 4);
+            vectors[i] = GetTestVector(i);
+        }
+        const AZ::TransformWide lhsWide = AZ::TransformWide::Load(lhs);
+        const AZ::TransformWide product = lhsWide * AZ::TransformWide::Load(rhs);
+        const AZ::Vector3Wide points = lhsWide.TransformPoint(AZ::Vector3Wide::Load(vectors));
+        const AZ::Vector3Wide directions = lhsWide.TransformVector(AZ::Vector3Wide::Load(vectors));
+        for (size_t i = 0; i < AZ::TransformWide::LaneCount; ++i)
+        {
+            EXPECT_THAT(product.GetLane(i), IsClose(lhs[i] * rhs[i]));
+            EXPECT_THAT(points.GetLane(i), IsClose(lhs[i].TransformPoint(vectors[i])));
+            EXPECT_THAT(directions.GetLane(i), IsClose(lhs[i].TransformVector(vectors[i])));
+        }
+    }
+
+    TEST(MATH_BatchMath, TransformPointsMatchesTransform)
+    {
+        const AZ::Transform transform = GetTestTransform(2);
+        for (const size_t count : BatchMathCounts)
+        {
+            AZStd::vector<AZ::Vector3> points(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                points[i] = GetTestVector(i);
+            }
+            AZStd::vector<AZ::Vector3> result(count);
+            AZ::BatchMath::TransformPoints(transform, points.data(), result.data(), count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                EXPECT_THAT(result[i], IsClose(transform.TransformPoint(points[i])));
+            }
+        }
+    }
+
+    TEST(MATH_BatchMath, NormalizeVectorsInPlace)
+    {
+        for (const size_t count : BatchMathCounts)
+        {
+            AZStd::vector<AZ::Vector3> vectors(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                vectors[i] = GetTestVector(i);
+            }
+            const AZStd::vector<AZ::Vector3> original = vectors;
+            AZ::BatchMath::NormalizeVectors(vectors.data(), vectors.data(), count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                EXPECT_THAT(vectors[i], IsClose(original[i].GetNormalized()));
+            }
+        }
+    }
+
+    TEST(MATH_BatchMath, DotProductsMatchVector3)
+    {
+        for (const size_t count : BatchMathCounts)
+        {
+            AZStd::vector<AZ::Vector3> lhs(count);
+            AZStd::vector<AZ::Vector3> rhs(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                lhs[i] = GetTestVector(i);
+                rhs[i] = GetTestVector(count - i);
+            }
+            AZStd::vector<float> result(count);
+            AZ::BatchMath::DotProducts(lhs.data(), rhs.data(), result.data(), count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                EXPECT_NEAR(result[i], lhs[i].Dot(rhs[i]), 1e-3f);
+            }
+        }
+    }
+
+    TEST(MATH_BatchMath, MultiplyTransformsAndSlerpQuaternionsMatchScalar)
+    {
+        for (const size_t count : BatchMathCounts)
+        {
+            AZStd::vector<AZ::Transform> lhs(count);
+            AZStd::vector<AZ::Transform> rhs(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                lhs[i] = GetTestTransform(i);
+                rhs[i] = GetTestTransform(i + 11);
+            }
+            AZStd::vector<AZ::Transform> transforms(count);
+            AZ::BatchMath::MultiplyTransforms(lhs.data(), rhs.data(), transforms.data(), count);
+
+            AZStd::vector<AZ::Quaternion> from(count);
+            AZStd::vector<AZ::Quaternion> to(count);
+            for (size_t i = 0; i < count; ++i)
+            {
+                from[i] = lhs[i].GetRotation();
+                to[i] = rhs[i].GetRotation();
+            }
+            AZStd::vector<AZ::Quaternion> rotations(count);
+            AZ::BatchMath::SlerpQuaternions(from.data(), to.data(), 0.4f, rotations.data(), count);
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                EXPECT_THAT(transforms[i], IsClose(lhs[i] * rhs[i]));
+                EXPECT_THAT(rotations[i], IsClose(from[i].Slerp(to[i], 0.4f)));
+            }
+        }
+    }
+} // namespace UnitTest
@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Memory/AllocationSampler.h>
+#include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Memory/MallocSchema.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace UnitTest
+{
+    class AllocationSamplerTest
+        : public AllocatorsFixture
+    {
+    public:
+        static const size_t s_samplingInterval = 4096;
+
+        void SetUp() override
+        {
+            AllocatorsFixture::SetUp();
+            m_sampler = AZStd::make_unique<AZ::Debug::AllocationSampler>(&m_mallocSchema);
+            m_sampler->SetSamplingInterval(s_samplingInterval);
+        }
+
+        void TearDown() override
+        {
+            m_sampler.reset();
+            AllocatorsFixture::TearDown();
+        }
+
+        //! The sampler only uses the addresses as keys, so fake addresses are enough to drive it.
+        static void* GetAddress(size_t index)
+        {
+            return reinterpret_cast<void*>((index + 1) * 64);
+        }
+
+    protected:
+        AZ::MallocSchema m_mallocSchema;
+        AZStd::unique_ptr<AZ::Debug::AllocationSampler> m_sampler;
+    };
+
+    TEST_F(AllocationSamplerTest, RegisterAllocation_ManyAllocations_EstimateMatchesAllocatedBytes)
+    {
+        constexpr size_t numAllocations = 100000;
+        constexpr size_t allocationSize = 64;
+        for (size_t i = 0; i < numAllocations; ++i)
+        {
+            m_sampler->RegisterAllocation(nullptr, GetAddress(i), allocationSize, 0);
+        }
+
+        const size_t expectedBytes = numAllocations * allocationSize;
+        const size_t expectedSamples = expectedBytes / s_samplingInterval;
+        EXPECT_EQ(0, m_sampler->GetNumDroppedSamples());
+        EXPECT_NEAR(static_cast<double>(expectedSamples), static_cast<double>(m_sampler->GetNumSamples()), expectedSamples * 0.2);
+        EXPECT_NEAR(static_cast<double>(expectedBytes), static_cast<double>(m_sampler->GetEstimatedBytes()), expectedBytes * 0.2);
+        EXPECT_EQ(m_sampler->GetNumSamples(), m_sampler->GetSequence());
+    }
+
+    TEST_F(AllocationSamplerTest, RegisterAllocation_SamplingDisabled_NoSamples)
+    {
+        m_sampler->SetSamplingInterval(0);
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            m_sampler->RegisterAllocation(nullptr, GetAddress(i), s_samplingInterval, 0);
+        }
+        EXPECT_EQ(0, m_sampler->GetNumSamples());
+    }
+
+    TEST_F(AllocationSamplerTest, UnregisterAllocation_AllAllocationsFreed_NoSamplesLeft)
+    {
+        constexpr size_t numAllocations = 10000;
+        for (size_t i = 0; i < numAllocations; ++i)
+        {
+            m_sampler->RegisterAllocation(nullptr, GetAddress(i), 256, 0);
+        }
+        EXPECT_LT(0, m_sampler->GetNumSamples());
+
+        for (size_t i = 0; i < numAllocations; ++i)
+        {
+            m_sampler->UnregisterAllocation(GetAddress(i));
+        }
+        EXPECT_EQ(0, m_sampler->GetNumSamples());
+        EXPECT_EQ(0, m_sampler->GetEstimatedBytes());
+    }
+
+    TEST_F(AllocationSamplerTest, EnumerateSamples_SinceSequence_OnlyReturnsNewerSamples)
+    {
+        m_sampler->SetSamplingInterval(1);
+        m_sampler->RegisterAllocation(nullptr, GetAddress(0), 16, 0);
+        const AZ::u64 sequence = m_sampler->GetSequence();
+        m_sampler->RegisterAllocation(nullptr, GetAddress(1), 32, 0);
+
+        size_t numSamples = 0;
+        m_sampler->EnumerateSamples([&numSamples](const AZ::Debug::AllocationSample& sample)
+            {
+                EXPECT_EQ(GetAddress(1), sample.m_address);
+                EXPECT_EQ(32, sample.m_byteSize);
+                EXPECT_LT(0, sample.m_numStackLevels);
+                ++numSamples;
+                return true;
+            }, sequence);
+        EXPECT_EQ(1, numSamples);
+    }
+
+    TEST_F(AllocationSamplerTest, UnregisterAllocator_SamplesFromMultipleAllocators_OnlyRemovesSamplesOfAllocator)
+    {
+        AZ::IAllocator* allocator = &AZ::AllocatorInstance<AZ::SystemAllocator>::GetAllocator();
+        m_sampler->SetSamplingInterval(1);
+        m_sampler->RegisterAllocation(allocator, GetAddress(0), 16, 0);
+        m_sampler->RegisterAllocation(nullptr, GetAddress(1), 16, 0);
+        EXPECT_EQ(2, m_sampler->GetNumSamples());
+
+        m_sampler->UnregisterAllocator(allocator);
+        EXPECT_EQ(1, m_sampler->GetNumSamples());
+        m_sampler->EnumerateSamples([](const AZ::Debug::AllocationSample& sample)
+            {
+                EXPECT_EQ(nullptr, sample.m_allocator);
+                return true;
+            });
+    }
+
+    TEST_F(AllocationSamplerTest, RegisterAllocation_MultipleThreads_SamplesRemovedOnOtherThread)
+    {
+        constexpr size_t numThreads = 8;
+        constexpr size_t numAllocations = 10000;
+        AZStd::vector<AZStd::thread> threads;
+        for (size_t threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+        {
+            threads.emplace_back([this, threadIndex]()
+                {
+                    for (size_t i = 0; i < numAllocations; ++i)
+                    {
+                        m_sampler->RegisterAllocation(nullptr, GetAddress(threadIndex * numAllocations + i), 128, 0);
+                    }
+                });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+        EXPECT_LT(0, m_sampler->GetNumSamples());
+
+        // Free the allocations of every thread from a different thread.
+        threads.clear();
+        for (size_t threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+        {
+            threads.emplace_back([this, threadIndex]()
+                {
+                    const size_t otherThread = (threadIndex + 1) % numThreads;
+                    for (size_t i = 0; i < numAllocations; ++i)
+                    {
+                        m_sampler->UnregisterAllocation(GetAddress(otherThread * numAllocations + i));
+                    }
+                });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+        EXPECT_EQ(0, m_sampler->GetNumSamples());
+        EXPECT_EQ(0, m_sampler->GetEstimatedBytes());
+    }
+
+    TEST_F(AllocationSamplerTest, AllocatorManager_SamplingEnabled_SystemAllocatorAllocationsSampled)
+    {
+        AZ::AllocatorManager& manager = AZ::AllocatorManager::Instance();
+        manager.SetAllocationSamplingInterval(1);
+        AZ::Debug::AllocationSampler* sampler = manager.GetAllocationSampler();
+        ASSERT_NE(nullptr, sampler);
+
+        AZ::IAllocatorAllocate& allocator = AZ::AllocatorInstance<AZ::SystemAllocator>::Get();
+        void* address = allocator.Allocate(100, 8);
+        bool isSampled = false;
+        sampler->EnumerateSamples([address, &isSampled](const AZ::Debug::AllocationSample& sample)
+            {
+                isSampled |= sample.m_address == address;
+                return !isSampled;
+            });
+        manager.SetAllocationSamplingInterval(0);
+        EXPECT_TRUE(isSampled);
+
+        allocator.DeAllocate(address, 100, 8);
+        sampler->EnumerateSamples([address](const AZ::Debug::AllocationSample& sample)
+            {
+                EXPECT_NE(address, sample.m_address);
+                return true;
+            });
+    }
+}
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Memory/FrameArenaAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace UnitTest
+{
+    class FrameArenaSchemaTest
+        : public AllocatorsFixture
+    {
+    public:
+        static const size_t s_chunkSize = 4 * 1024;
+
+        void SetUp() override
+        {
+            AllocatorsFixture::SetUp();
+
+            AZ::FrameArenaSchema::Descriptor desc;
+            desc.m_chunkSize = s_chunkSize;
+            desc.m_maxNumThreads = 4;
+            m_schema = AZStd::make_unique<AZ::FrameArenaSchema>(desc);
+        }
+
+        void TearDown() override
+        {
+            m_schema.reset();
+            AllocatorsFixture::TearDown();
+        }
+
+    protected:
+        AZStd::unique_ptr<AZ::FrameArenaSchema> m_schema;
+    };
+
+    TEST_F(FrameArenaSchemaTest, Allocate_MultipleAllocations_AreAlignedAndDoNotOverlap)
+    {
+        char* first = reinterpret_cast<char*>(m_schema->Allocate(100, 16));
+        char* second = reinterpret_cast<char*>(m_schema->Allocate(30, 64));
+        ASSERT_NE(nullptr, first);
+        ASSERT_NE(nullptr, second);
+        EXPECT_EQ(0, reinterpret_cast<size_t>(first) % 16);
+        EXPECT_EQ(0, reinterpret_cast<size_t>(second) % 64);
+        EXPECT_TRUE(second >= first + 100 || second + 30 <= first);
+        EXPECT_EQ(130, m_schema->NumAllocatedBytes());
+    }
+
+    TEST_F(FrameArenaSchemaTest, DeAllocate_LatestAllocation_MemoryIsReused)
+    {
+        void* first = m_schema->Allocate(64, 8);
+        m_schema->DeAllocate(first, 64, 8);
+        EXPECT_EQ(0, m_schema->NumAllocatedBytes());
+
+        void* second = m_schema->Allocate(64, 8);
+        EXPECT_EQ(first, second);
+    }
+
+    TEST_F(FrameArenaSchemaTest, Resize_LatestAllocation_GrowsInPlace)
+    {
+        void* first = m_schema->Allocate(64, 8);
+        EXPECT_EQ(256, m_schema->Resize(first, 256));
+        EXPECT_EQ(256, m_schema->NumAllocatedBytes());
+
+        m_schema->Allocate(16, 8);
+        EXPECT_EQ(0, m_schema->Resize(first, 512));
+    }
+
+    TEST_F(FrameArenaSchemaTest, Allocate_LargerThanChunk_GetsDedicatedChunk)
+    {
+        void* small = m_schema->Allocate(16, 8);
+        void* large = m_schema->Allocate(s_chunkSize * 4, 16);
+        ASSERT_NE(nullptr, large);
+        EXPECT_LE(s_chunkSize * 5, m_schema->Capacity());
+
+        // The remainder of the current chunk is still used after the large allocation.
+        void* next = m_schema->Allocate(16, 8);
+        EXPECT_EQ(reinterpret_cast<char*>(small) + 16, reinterpret_cast<char*>(next));
+    }
+
+    TEST_F(FrameArenaSchemaTest, ResetFrame_AfterAllocations_AllMemoryReleasedAndChunksReused)
+    {
+        for (int i = 0; i < 100; ++i)
+        {
+            EXPECT_NE(nullptr, m_schema->Allocate(256, 16));
+        }
+        const size_t capacity = m_schema->Capacity();
+        EXPECT_EQ(0, m_schema->GetFrameIndex());
+
+        m_schema->ResetFrame();
+        EXPECT_EQ(0, m_schema->NumAllocatedBytes());
+        EXPECT_EQ(1, m_schema->GetFrameIndex());
+
+        for (int i = 0; i < 100; ++i)
+        {
+            EXPECT_NE(nullptr, m_schema->Allocate(256, 16));
+        }
+        EXPECT_EQ(capacity, m_schema->Capacity());
+
+        m_schema->ResetFrame();
+        m_schema->GarbageCollect();
+        EXPECT_GT(capacity, m_schema->Capacity());
+    }
+
+    TEST_F(FrameArenaSchemaTest, Allocate_MoreThreadsThanArenas_AllAllocationsSucceed)
+    {
+        constexpr size_t numThreads = 8;
+        constexpr size_t numAllocations = 200;
+        AZStd::vector<AZStd::thread> threads;
+        for (size_t threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+        {
+            threads.emplace_back([this, threadIndex]()
+                {
+                    AZStd::vector<unsigned char*> allocations;
+                    for (size_t i = 0; i < numAllocations; ++i)
+                    {
+                        unsigned char* allocation = reinterpret_cast<unsigned char*>(m_schema->Allocate(48, 16));
+                        ASSERT_NE(nullptr, allocation);
+                        memset(allocation, static_cast<int>(threadIndex), 48);
+                        allocations.push_back(allocation);
+                    }
+                    for (unsigned char* allocation : allocations)
+                    {
+                        EXPECT_EQ(threadIndex, allocation[0]);
+                        EXPECT_EQ(threadIndex, allocation[47]);
+                    }
+                });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(numThreads * numAllocations * 48, m_schema->NumAllocatedBytes());
+        m_schema->ResetFrame();
+        EXPECT_EQ(0, m_schema->NumAllocatedBytes());
+    }
+
+    class FrameArenaAllocatorTest
+        : public AllocatorsFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsFixture::SetUp();
+            AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Create();
+        }
+
+        void TearDown() override
+        {
+            AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Destroy();
+            AllocatorsFixture::TearDown();
+        }
+    };
+
+    TEST_F(FrameArenaAllocatorTest, Containers_UsingFrameArena_AllocateFromArena)
+    {
+        auto& allocator = static_cast<AZ::FrameArenaAllocator&>(AZ::AllocatorInstance<AZ::FrameArenaAllocator>::GetAllocator());
+        {
+            AZStd::vector<int, AZ::FrameArenaStdAllocator> values;
+            AZStd::unordered_map<int, int, AZStd::hash<int>, AZStd::equal_to<int>, AZ::FrameArenaStdAllocator> lookup;
+            for (int i = 0; i < 1000; ++i)
+            {
+                values.push_back(i);
+                lookup.emplace(i, i * 2);
+            }
+            EXPECT_EQ(999, values.back());
+            EXPECT_EQ(1998, lookup[999]);
+            EXPECT_LT(0, allocator.NumAllocatedBytes());
+        }
+
+        const AZ::u64 frameIndex = allocator.GetFrameIndex();
+        allocator.ResetFrame();
+        EXPECT_EQ(0, allocator.NumAllocatedBytes());
+        EXPECT_EQ(frameIndex + 1, allocator.GetFrameIndex());
+    }
+}
@@ -9,6 +9,7 @@
 #include <AzCore/PlatformIncl.h>
 #include <AzCore/Memory/HphaSchema.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
 
 #if defined(HAVE_BENCHMARK)
 #include <benchmark/benchmark.h>
@@ -111,6 +112,119 @@ namespace UnitTest
     INSTANTIATE_TEST_CASE_P(Mixed,
         HphaSchemaTestFixture,
         ::testing::ValuesIn(s_mixedInstancesParameters));
+
+    class HphaSchemaThreadCacheTestFixture
+        : public AllocatorsTestFixture
+    {
+    public:
+        static const size_t s_numThreads = 4;
+        static const size_t s_numAllocationsPerThread = 5000;
+
+        void SetUp() override
+        {
+            AZ::AllocatorInstance<HphaSchema_TestAllocator>::Create();
+        }
+
+        void TearDown() override
+        {
+            AZ::AllocatorInstance<HphaSchema_TestAllocator>::Destroy();
+        }
+
+        // Fills each allocation with a pattern based on the thread so overlapping allocations are detected.
+        static void AllocateAndVerify(AZStd::vector<void*, AZ::AZStdAlloc<AZ::OSAllocator>>& allocations, size_t threadIndex)
+        {
+            for (size_t i = 0; i < s_numAllocationsPerThread; ++i)
+            {
+                const size_t allocationSize = s_smallAllocationSizes[i % s_smallAllocationSizes.size()];
+                void* allocation = AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get().Allocate(allocationSize, 0);
+                ASSERT_NE(nullptr, allocation);
+                memset(allocation, static_cast<int>(threadIndex + 1), allocationSize);
+                allocations.emplace_back(allocation);
+            }
+            for (size_t i = 0; i < allocations.size(); ++i)
+            {
+                const size_t allocationSize = s_smallAllocationSizes[i % s_smallAllocationSizes.size()];
+                const unsigned char* bytes = static_cast<const unsigned char*>(allocations[i]);
+                EXPECT_EQ(threadIndex + 1, bytes[0]);
+                EXPECT_EQ(threadIndex + 1, bytes[allocationSize - 1]);
+            }
+        }
+
+        static void DeAllocateAll(AZStd::vector<void*, AZ::AZStdAlloc<AZ::OSAllocator>>& allocations)
+        {
+            for (size_t i = 0; i < allocations.size(); ++i)
+            {
+                const size_t allocationSize = s_smallAllocationSizes[i % s_smallAllocationSizes.size()];
+                AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get().DeAllocate(allocations[i], allocationSize);
+            }
+            allocations.clear();
+        }
+    };
+
+    TEST_F(HphaSchemaThreadCacheTestFixture, Allocate_MultipleThreads_AllocationsAreUnique)
+    {
+        const size_t baseline = AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get().NumAllocatedBytes();
+
+        AZStd::vector<AZStd::thread> threads;
+        for (size_t threadIndex = 0; threadIndex < s_numThreads; ++threadIndex)
+        {
+            threads.emplace_back([threadIndex]()
+                {
+                    AZStd::vector<void*, AZ::AZStdAlloc<AZ::OSAllocator>> allocations;
+                    for (int iteration = 0; iteration < 4; ++iteration)
+                    {
+                        AllocateAndVerify(allocations, threadIndex);
+                        DeAllocateAll(allocations);
+                    }
+                });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(baseline, AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get().NumAllocatedBytes());
+    }
+
+    TEST_F(HphaSchemaThreadCacheTestFixture, DeAllocate_OnDifferentThread_MemoryIsReturned)
+    {
+        const size_t baseline = AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get().NumAllocatedBytes();
+
+        AZStd::vector<void*, AZ::AZStdAlloc<AZ::OSAllocator>> allocations[s_numThreads];
+        AZStd::vector<AZStd::thread> threads;
+        for (size_t threadIndex = 0; threadIndex < s_numThreads; ++threadIndex)
+        {
+            threads.emplace_back([&allocations, threadIndex]()
+                {
+                    AllocateAndVerify(allocations[threadIndex], threadIndex);
+                });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+        threads.clear();
+
+        EXPECT_LT(baseline, AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get().NumAllocatedBytes());
+
+        // Free every allocation on a different thread than the one that allocated it.
+        for (size_t threadIndex = 0; threadIndex < s_numThreads; ++threadIndex)
+        {
+            threads.emplace_back([&allocations, threadIndex]()
+                {
+                    DeAllocateAll(allocations[(threadIndex + 1) % s_numThreads]);
+                });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(baseline, AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get().NumAllocatedBytes());
+        // Memory cached by the threads is returned to the pages and the pages to the system.
+        AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get().GarbageCollect();
+        EXPECT_EQ(baseline, AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get().NumAllocatedBytes());
+    }
 }
 
 
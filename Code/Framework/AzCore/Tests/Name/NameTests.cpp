@@ -48,14 +48,36 @@ namespace UnitTest
             AZ::NameDictionary::Destroy();
         }
 
-        static const AZStd::unordered_map<AZ::Name::Hash, AZ::Internal::NameData*>& GetDictionary()
+        static size_t GetEntryCount()
         {
-            return AZ::NameDictionary::Instance().m_dictionary;
+            return AZ::NameDictionary::Instance().GetEntryCount();
         }
-        
-        static size_t GetEntryCount()
+
+
+        //! Returns the entry with the given string, or null if the dictionary doesn't contain it.
+        static const AZ::Internal::NameData* FindEntry(AZStd::string_view nameString)
+        {
+            for (const auto& shard : AZ::NameDictionary::Instance().m_shards)
+            {
+                for (const auto& entry : shard.m_dictionary)
+                {
+                    if (entry.second->GetName() == nameString)
+                    {
+                        return entry.second;
+                    }
+                }
+            }
+            return nullptr;
+        }
+
+        static size_t GetNonEmptyShardCount()
         {
-            return GetDictionary().size();
+            size_t count = 0;
+            for (const auto& shard : AZ::NameDictionary::Instance().m_shards)
+            {
+                count += shard.m_dictionary.empty() ? 0 : 1;
+            }
+            return count;
         }
 
         //! Directly calculate the hash value for a string without collision resolution
@@ -270,11 +292,7 @@ namespace UnitTest
         // Make sure all entries in the localDictionary got copied into the globalDictionary
         for (const AZStd::string& nameString : localDictionary)
         {
-            auto& globalDictionary = NameDictionaryTester::GetDictionary();
-            auto it = AZStd::find_if(globalDictionary.begin(), globalDictionary.end(), [&nameString](AZStd::pair<AZ::Name::Hash, AZ::Internal::NameData*> entry) {
-                return entry.second->GetName() == nameString;
-            });
-            EXPECT_TRUE(it != globalDictionary.end()) << "Can't find '" << nameString.data() << "' in local dictionary.";
+            EXPECT_TRUE(NameDictionaryTester::FindEntry(nameString) != nullptr) << "Can't find '" << nameString.data() << "' in local dictionary.";
         }
 
         // Make sure all the threads got an accurate Name object
@@ -410,6 +428,43 @@ namespace UnitTest
         }
     }
 
+    TEST_F(NameTest, NameLiteral_MatchesNameFromString)
+    {
+        static_assert(AZ::Name::CalcHash("literal") != 0, "Name hashes must be available at compile time");
+
+        AZ::Name fromString{"literal"};
+        AZ::Name fromLiteral = AZ_NAME_LITERAL("literal");
+        EXPECT_EQ(fromString, fromLiteral);
+        EXPECT_EQ(fromString.GetStringView().data(), fromLiteral.GetStringView().data());
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 1);
+
+        AZ::Name newLiteral = AZ_NAME_LITERAL("newLiteral");
+        EXPECT_TRUE(newLiteral.GetStringView() == "newLiteral");
+        EXPECT_EQ(newLiteral, AZ::Name{"newLiteral"});
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 2);
+
+        EXPECT_TRUE(AZ_NAME_LITERAL("").IsEmpty());
+    }
+
+    TEST_F(NameTest, NameDictionary_ManyNames_EntriesAreSpreadOverShards)
+    {
+        AZStd::vector<AZ::Name> names;
+        for (size_t i = 0; i < 1000; ++i)
+        {
+            names.emplace_back(AZStd::string::format("name %zu", i));
+        }
+
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), names.size());
+        EXPECT_LT(1, NameDictionaryTester::GetNonEmptyShardCount());
+        for (const AZ::Name& name : names)
+        {
+            EXPECT_EQ(name, AZ::Name{name.GetHash()});
+        }
+
+        names.clear();
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 0);
+    }
+
     TEST_F(NameTest, NameComparisonTest)
     {
         AZ::Name a{"a"};
@@ -1408,6 +1408,51 @@ namespace UnitTest
             delete patchedTargetObj;
         }
 
+        TEST_F(PatchingTest, Apply_SamePatchMultipleTimes_PatchIsPreparedOnceAndRecreatedOnChange)
+        {
+            ObjectWithPointer sourceObj;
+            sourceObj.m_int = 1;
+
+            ObjectWithPointer targetObj;
+            targetObj.m_int = 2;
+
+            DataPatch patch;
+            patch.Create(&sourceObj, &targetObj, DataPatch::FlagsMap(), DataPatch::FlagsMap(), m_serializeContext.get());
+
+            ObjectWithPointer* patchedObj = patch.Apply(&sourceObj, m_serializeContext.get());
+            ASSERT_NE(nullptr, patchedObj);
+            EXPECT_EQ(2, patchedObj->m_int);
+            delete patchedObj;
+
+            // The prepared patch is reused for a different source, data that isn't patched comes from that source.
+            ObjectWithPointer otherSourceObj;
+            otherSourceObj.m_int = 1;
+            otherSourceObj.m_pointerInt = new AZ::s32(5);
+            patchedObj = patch.Apply(&otherSourceObj, m_serializeContext.get());
+            ASSERT_NE(nullptr, patchedObj);
+            EXPECT_EQ(2, patchedObj->m_int);
+            ASSERT_NE(nullptr, patchedObj->m_pointerInt);
+            EXPECT_EQ(5, *patchedObj->m_pointerInt);
+            azdestroy(patchedObj->m_pointerInt);
+            delete patchedObj;
+            delete otherSourceObj.m_pointerInt;
+
+            // Recreating the patch drops the prepared patch.
+            targetObj.m_int = 3;
+            patch.Create(&sourceObj, &targetObj, DataPatch::FlagsMap(), DataPatch::FlagsMap(), m_serializeContext.get());
+            patchedObj = patch.Apply(&sourceObj, m_serializeContext.get());
+            ASSERT_NE(nullptr, patchedObj);
+            EXPECT_EQ(3, patchedObj->m_int);
+            delete patchedObj;
+
+            // A copy of the patch applies the same patch.
+            DataPatch patchCopy(patch);
+            patchedObj = patchCopy.Apply(&sourceObj, m_serializeContext.get());
+            ASSERT_NE(nullptr, patchedObj);
+            EXPECT_EQ(3, patchedObj->m_int);
+            delete patchedObj;
+        }
+
         // prove that properly deprecated container elements are removed and do not leave nulls behind.
         TEST_F(PatchingTest, DeprecatedContainerElements_AreRemoved)
         {
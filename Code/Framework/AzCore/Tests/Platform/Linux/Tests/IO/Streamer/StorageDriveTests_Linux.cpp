@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/StringFunc/StringFunc.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Utils/Utils.h>
+
+namespace AZ::IO
+{
+    constexpr AZ::u32 TestMaxFileHandles = 2;
+    constexpr AZ::u32 TestMaxMetaDataEntries = 16;
+    constexpr size_t TestPhysicalSectorSize = 4_kib;
+    constexpr size_t TestLogicalSectorSize = 512;
+    constexpr size_t TestMaxTransferSize = 64_kib;
+    constexpr AZ::u32 TestQueueDepth = 8;
+    constexpr AZ::s32 TestOverCommit = 0;
+
+    class Streamer_StorageDriveLinuxTestFixture
+        : public UnitTest::ScopedAllocatorSetupFixture
+    {
+    public:
+        static constexpr char s_dummyFilename[] = "DummyLinux.bin";
+
+        void SetUp() override
+        {
+            m_isSupported = StorageDriveLinux::IsSupported();
+            if (!m_isSupported)
+            {
+                AZ_Printf("Streamer", "io_uring isn't available, skipping StorageDriveLinux test.\n");
+                return;
+            }
+
+            PrepareTestFilepath();
+            ASSERT_FALSE(m_dummyFilepath.empty());
+            m_dummyRequestPath.InitFromAbsolutePath(m_dummyFilepath);
+
+            m_context = new StreamerContext();
+            SetupStorageDrive(false);
+        }
+
+        void TearDown() override
+        {
+            m_storageDrive.reset();
+            delete m_context;
+            m_context = nullptr;
+            if (!m_dummyFilepath.empty())
+            {
+                SystemFile::Delete(m_dummyFilepath.c_str());
+            }
+        }
+
+        void SetupStorageDrive(bool unbufferedReads)
+        {
+            StorageDriveLinux::ConstructionOptions options;
+            options.m_hasSeekPenalty = false;
+            options.m_enableUnbufferedReads = unbufferedReads;
+            options.m_minimalReporting = true;
+
+            m_storageDrive.reset();
+            m_storageDrive = AZStd::make_shared<StorageDriveLinux>(TestMaxFileHandles, TestMaxMetaDataEntries,
+                TestPhysicalSectorSize, TestLogicalSectorSize, TestMaxTransferSize, TestQueueDepth, TestOverCommit, options);
+            m_storageDrive->SetContext(*m_context);
+        }
+
+        // Creates a file where every byte contains the lower 8 bits of its offset.
+        void CreateDummyFile(size_t fileSize)
+        {
+            SystemFile file;
+            ASSERT_TRUE(file.Open(m_dummyFilepath.c_str(), SystemFile::SF_OPEN_CREATE | SystemFile::SF_OPEN_READ_WRITE));
+            AZStd::unique_ptr<u8[]> buffer(new u8[fileSize]);
+            for (size_t i = 0; i < fileSize; ++i)
+            {
+                buffer[i] = aznumeric_cast<u8>(i & 0xff);
+            }
+            ASSERT_EQ(fileSize, file.Write(buffer.get(), fileSize));
+            file.Close();
+        }
+
+        void WaitTillCompleted()
+        {
+            StreamStackEntry::Status status;
+            auto startTime = AZStd::chrono::system_clock::now();
+            do
+            {
+                m_storageDrive->ExecuteRequests();
+                m_context->FinalizeCompletedRequests();
+
+                status.m_isIdle = true;
+                m_storageDrive->UpdateStatus(status);
+
+                if (AZStd::chrono::system_clock::now() - startTime > AZStd::chrono::seconds(5))
+                {
+                    FAIL();
+                }
+            } while (!status.m_isIdle);
+        }
+
+        FileRequest* QueueRead(void* output, u64 outputSize, u64 offset, u64 size)
+        {
+            FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateRead(nullptr, output, outputSize, m_dummyRequestPath, offset, size);
+            m_storageDrive->QueueRequest(request);
+            return request;
+        }
+
+        static void VerifyContent(const u8* buffer, u64 offset, u64 size)
+        {
+            for (u64 i = 0; i < size; ++i)
+            {
+                if (buffer[i] != aznumeric_cast<u8>((offset + i) & 0xff))
+                {
+                    ADD_FAILURE() << "Mismatch at offset " << (offset + i);
+                    return;
+                }
+            }
+        }
+
+    protected:
+        AZStd::shared_ptr<StorageDriveLinux> m_storageDrive;
+        StreamerContext* m_context{ nullptr };
+        AZStd::string m_dummyFilepath;
+        RequestPath m_dummyRequestPath;
+        bool m_isSupported{ false };
+
+    private:
+        void PrepareTestFilepath()
+        {
+            char exePath[AZ_MAX_PATH_LEN] = { 0 };
+            auto result = AZ::Utils::GetExecutablePath(exePath, AZ_MAX_PATH_LEN);
+            if (result.m_pathStored != AZ::Utils::ExecutablePathResult::Success)
+            {
+                return;
+            }
+
+            AZStd::string filePath(exePath);
+            if (result.m_pathIncludesFilename)
+            {
+                AZ::StringFunc::Path::StripFullName(filePath);
+            }
+            AZ::StringFunc::Path::Join(filePath.c_str(), "TestFiles", filePath);
+            if (!SystemFile::Exists(filePath.c_str()) && !SystemFile::CreateDir(filePath.c_str()))
+            {
+                return;
+            }
+            AZ::StringFunc::Path::Join(filePath.c_str(), s_dummyFilename, m_dummyFilepath);
+        }
+    };
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadRequest_SingleRead_ReadsFullFile)
+    {
+        if (!m_isSupported)
+        {
+            return;
+        }
+
+        constexpr size_t fileSize = 16_kib;
+        CreateDummyFile(fileSize);
+
+        AZStd::unique_ptr<u8[]> buffer(new u8[fileSize]);
+        FileRequest* request = QueueRead(buffer.get(), fileSize, 0, fileSize);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, request.GetStatus());
+            });
+        WaitTillCompleted();
+
+        VerifyContent(buffer.get(), 0, fileSize);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadRequest_MoreReadsThanQueueDepth_AllReadsComplete)
+    {
+        if (!m_isSupported)
+        {
+            return;
+        }
+
+        constexpr size_t chunkSize = 4_kib;
+        constexpr size_t chunkCount = TestQueueDepth * 4;
+        CreateDummyFile(chunkSize * chunkCount);
+
+        AZStd::unique_ptr<u8[]> buffer(new u8[chunkSize * chunkCount]);
+        size_t completedCount = 0;
+        for (size_t i = 0; i < chunkCount; ++i)
+        {
+            FileRequest* request = QueueRead(buffer.get() + i * chunkSize, chunkSize, i * chunkSize, chunkSize);
+            request->SetCompletionCallback([&completedCount](const FileRequest& request)
+                {
+                    EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, request.GetStatus());
+                    completedCount++;
+                });
+        }
+        WaitTillCompleted();
+
+        EXPECT_EQ(chunkCount, completedCount);
+        VerifyContent(buffer.get(), 0, chunkSize * chunkCount);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadRequest_UnalignedUnbufferedRead_ReadsRequestedRange)
+    {
+        if (!m_isSupported)
+        {
+            return;
+        }
+
+        SetupStorageDrive(true);
+
+        constexpr size_t fileSize = 32_kib;
+        constexpr u64 offset = 1000;
+        constexpr u64 size = 5000;
+        CreateDummyFile(fileSize);
+
+        AZStd::unique_ptr<u8[]> buffer(new u8[size + 1]);
+        // Offset the output by a byte so the address isn't aligned either.
+        FileRequest* request = QueueRead(buffer.get() + 1, size, offset, size);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, request.GetStatus());
+            });
+        WaitTillCompleted();
+
+        VerifyContent(buffer.get() + 1, offset, size);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadRequest_ReadPastEndOfFile_RequestFails)
+    {
+        if (!m_isSupported)
+        {
+            return;
+        }
+
+        constexpr size_t fileSize = 4_kib;
+        CreateDummyFile(fileSize);
+
+        AZStd::unique_ptr<u8[]> buffer(new u8[fileSize * 2]);
+        FileRequest* request = QueueRead(buffer.get(), fileSize * 2, 0, fileSize * 2);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                EXPECT_EQ(IStreamerTypes::RequestStatus::Failed, request.GetStatus());
+            });
+        WaitTillCompleted();
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, FileMetaDataRetrievalRequest_FileExists_ReportsAccurateFileSize)
+    {
+        if (!m_isSupported)
+        {
+            return;
+        }
+
+        CreateDummyFile(4_kib);
+
+        FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFileMetaDataRetrieval(m_dummyRequestPath);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                auto& fileMetaData = AZStd::get<FileRequest::FileMetaDataRetrievalData>(request.GetCommand());
+                EXPECT_TRUE(fileMetaData.m_found);
+                EXPECT_EQ(4_kib, fileMetaData.m_fileSize);
+            });
+        m_storageDrive->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, FileExistsRequest_FileDoesNotExist_ReturnsCompletedWithFileNotFound)
+    {
+        if (!m_isSupported)
+        {
+            return;
+        }
+
+        RequestPath path;
+        path.InitFromAbsolutePath(m_dummyFilepath + ".disappear");
+
+        FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFileExistsCheck(path);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                auto& fileExistsCheck = AZStd::get<FileRequest::FileExistsCheckData>(request.GetCommand());
+                EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, request.GetStatus());
+                EXPECT_FALSE(fileExistsCheck.m_found);
+            });
+        m_storageDrive->QueueRequest(request);
+        WaitTillCompleted();
+    }
+} // namespace AZ::IO
@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Component/ScheduledTick.h>
+#include <AzCore/Component/ScheduledTickSystemComponent.h>
+#include <AzCore/Console/Console.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/list.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace UnitTest
+{
+    class TestScheduledTickHandler
+        : public AZ::ScheduledTickHandler
+    {
+    public:
+        void OnScheduledTick(float deltaTime, AZ::ScriptTimePoint) override
+        {
+            ++m_tickCount;
+            m_totalTime += deltaTime;
+            if (m_onTick)
+            {
+                m_onTick();
+            }
+        }
+
+        AZStd::function<void()> m_onTick;
+        float m_totalTime = 0.0f;
+        int m_tickCount = 0;
+    };
+
+    class ScheduledTickTests
+        : public AllocatorsFixture
+    {
+    public:
+        static constexpr float FrameTime = 1.0f / 60.0f;
+
+        void SetUp() override
+        {
+            SetupAllocator();
+            m_console = AZStd::make_unique<AZ::Console>();
+            m_console->LinkDeferredFunctors(AZ::ConsoleFunctorBase::GetDeferredHead());
+            AZ::Interface<AZ::IConsole>::Register(m_console.get());
+
+            m_scheduledTickComponent = AZStd::make_unique<AZ::ScheduledTickSystemComponent>();
+        }
+
+        void TearDown() override
+        {
+            m_console->PerformCommand("sys_scheduledTickMaxPerFrame 0");
+            m_scheduledTickComponent.reset();
+
+            AZ::Interface<AZ::IConsole>::Unregister(m_console.get());
+            m_console.reset();
+            TeardownAllocator();
+        }
+
+        void Tick(float deltaTime = FrameTime)
+        {
+            m_scheduledTickComponent->OnTick(deltaTime, AZ::ScriptTimePoint());
+        }
+
+        AZStd::unique_ptr<AZ::Console> m_console;
+        AZStd::unique_ptr<AZ::ScheduledTickSystemComponent> m_scheduledTickComponent;
+    };
+
+    TEST_F(ScheduledTickTests, OnScheduledTick_TickedForOneSecond_TicksAtRequestedFrequency)
+    {
+        TestScheduledTickHandler handler;
+        handler.ScheduledTickConnect(10.0f);
+
+        for (int frame = 0; frame < 60; ++frame)
+        {
+            Tick();
+        }
+
+        EXPECT_NEAR(10, handler.m_tickCount, 1);
+        EXPECT_LE(handler.m_totalTime, 1.0f + FrameTime);
+    }
+
+    TEST_F(ScheduledTickTests, OnScheduledTick_ManyHandlersWithSameFrequency_TicksSpreadOverFrames)
+    {
+        constexpr int NumHandlers = 600;
+        AZStd::list<TestScheduledTickHandler> handlers;
+        for (int i = 0; i < NumHandlers; ++i)
+        {
+            handlers.emplace_back();
+            handlers.back().ScheduledTickConnect(10.0f);
+        }
+
+        // At 60 frames per second and 10 ticks per second, each frame should tick roughly a sixth of the handlers.
+        AZ::u32 totalTicks = 0;
+        for (int frame = 0; frame < 60; ++frame)
+        {
+            Tick();
+            EXPECT_LT(m_scheduledTickComponent->GetNumTickedLastFrame(), NumHandlers / 3);
+            totalTicks += m_scheduledTickComponent->GetNumTickedLastFrame();
+        }
+        EXPECT_NEAR(NumHandlers * 10, totalTicks, NumHandlers);
+    }
+
+    TEST_F(ScheduledTickTests, OnScheduledTick_DisconnectFromTick_NoLongerTicked)
+    {
+        TestScheduledTickHandler handler;
+        handler.m_onTick = [&handler]()
+        {
+            handler.ScheduledTickDisconnect();
+        };
+        handler.ScheduledTickConnect(10.0f);
+
+        for (int frame = 0; frame < 60; ++frame)
+        {
+            Tick();
+        }
+
+        EXPECT_EQ(1, handler.m_tickCount);
+        EXPECT_FALSE(handler.IsScheduledTickConnected());
+    }
+
+    TEST_F(ScheduledTickTests, OnScheduledTick_HandlerDestroyedByOtherHandler_DestroyedHandlerNotTicked)
+    {
+        auto handlerA = AZStd::make_unique<TestScheduledTickHandler>();
+        auto handlerB = AZStd::make_unique<TestScheduledTickHandler>();
+        handlerA->ScheduledTickConnect(1.0f);
+        handlerB->ScheduledTickConnect(1.0f);
+
+        // Whichever handler ticks first destroys the other one.
+        handlerA->m_onTick = [&handlerB]() { handlerB.reset(); };
+        handlerB->m_onTick = [&handlerA]() { handlerA.reset(); };
+
+        Tick(1.0f);
+
+        EXPECT_EQ(1, m_scheduledTickComponent->GetNumTickedLastFrame());
+        EXPECT_TRUE((handlerA == nullptr) != (handlerB == nullptr));
+    }
+
+    TEST_F(ScheduledTickTests, SetScheduledTickFrequency_IncreasedFrequency_TicksMoreOften)
+    {
+        TestScheduledTickHandler handler;
+        handler.ScheduledTickConnect(1.0f);
+        Tick(1.0f);
+        EXPECT_EQ(1, handler.m_tickCount);
+
+        handler.SetScheduledTickFrequency(10.0f);
+        for (int frame = 0; frame < 60; ++frame)
+        {
+            Tick();
+        }
+
+        EXPECT_NEAR(11, handler.m_tickCount, 1);
+    }
+
+    TEST_F(ScheduledTickTests, OnScheduledTick_MaxPerFrameExceeded_LeastImportantHandlersPostponed)
+    {
+        m_console->PerformCommand("sys_scheduledTickMaxPerFrame 1");
+
+        TestScheduledTickHandler lowHandler;
+        TestScheduledTickHandler highHandler;
+        TestScheduledTickHandler criticalHandler;
+        lowHandler.ScheduledTickConnect(1.0f, AZ::ScheduledTickImportance::Low);
+        highHandler.ScheduledTickConnect(1.0f, AZ::ScheduledTickImportance::High);
+        criticalHandler.ScheduledTickConnect(1.0f, AZ::ScheduledTickImportance::Critical);
+
+        // All handlers are due, the critical one ticks regardless of the limit and the high importance one uses up the limit.
+        Tick(1.0f);
+        EXPECT_EQ(0, lowHandler.m_tickCount);
+        EXPECT_EQ(1, highHandler.m_tickCount);
+        EXPECT_EQ(1, criticalHandler.m_tickCount);
+        EXPECT_EQ(1, m_scheduledTickComponent->GetNumPostponedLastFrame());
+
+        Tick();
+        EXPECT_EQ(1, lowHandler.m_tickCount);
+        EXPECT_EQ(0, m_scheduledTickComponent->GetNumPostponedLastFrame());
+    }
+
+    TEST_F(ScheduledTickTests, ScheduledTickSystem_DestroyedBeforeHandler_HandlerDisconnected)
+    {
+        TestScheduledTickHandler handler;
+        handler.ScheduledTickConnect(10.0f);
+        EXPECT_TRUE(handler.IsScheduledTickConnected());
+
+        m_scheduledTickComponent.reset();
+
+        EXPECT_FALSE(handler.IsScheduledTickConnected());
+    }
+} // namespace UnitTest
@@ -4494,6 +4494,38 @@ ramenShop.handler:Connect(4);
         )LUA");
         m_script->SetErrorHook(oldHook);
     }
+
+    class ScriptMemoryStatisticsTest
+        : public AllocatorsFixture
+    {
+    };
+
+    TEST_F(ScriptMemoryStatisticsTest, LuaAllocations_AreTrackedAndReleasedByTheCollector)
+    {
+        ScriptContext script;
+        script.GarbageCollect();
+        const ScriptContext::MemoryStatistics before = script.GetMemoryStatistics();
+        EXPECT_EQ(before.m_usedBytes, script.GetMemoryUsage());
+        EXPECT_GT(before.m_smallObjectBytes, 0u);
+
+        script.Execute("garbage = {} for i = 1, 1000 do garbage[i] = { i, tostring(i) } end garbage = nil");
+        const ScriptContext::MemoryStatistics allocated = script.GetMemoryStatistics();
+        EXPECT_GT(allocated.m_numAllocations, before.m_numAllocations + 1000);
+        EXPECT_GT(allocated.m_allocatedBytes, before.m_allocatedBytes);
+        EXPECT_GE(allocated.m_peakUsedBytes, allocated.m_usedBytes);
+
+        // the incremental collector finishes the cycle in a bounded number of steps
+        script.SetGarbageCollectorParameters(100, 400);
+        bool isCycleFinished = false;
+        for (int i = 0; i < 10000 && !isCycleFinished; ++i)
+        {
+            isCycleFinished = script.GarbageCollectStep(16);
+        }
+        EXPECT_TRUE(isCycleFinished);
+        script.GarbageCollect();
+        EXPECT_LT(script.GetMemoryStatistics().m_usedBytes, allocated.m_usedBytes);
+        EXPECT_EQ(script.GetMemoryStatistics().m_usedBytes, script.GetMemoryUsage());
+    }
 }
 
 
@@ -59,6 +59,8 @@
 #include <AzCore/IO/ByteContainerStream.h>
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/IO/Streamer/StreamerComponent.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
 
 #include <AzCore/RTTI/AttributeReader.h>
 #include <AzCore/std/string/conversions.h>
@@ -7697,6 +7699,166 @@ namespace UnitTest
         EXPECT_EQ(ClassThatAllocatesMemoryInDefaultCtor::InstanceTracker::s_instanceCount, 0);
     }
 
+    struct CompiledLayoutBase
+    {
+        AZ_RTTI(CompiledLayoutBase, "{5C4D1E0A-8E7B-4F2C-9B3D-2A61C0F4D8E1}");
+        AZ_CLASS_ALLOCATOR(CompiledLayoutBase, AZ::SystemAllocator, 0);
+        virtual ~CompiledLayoutBase() = default;
+        int m_baseValue = 0;
+    };
+
+    struct CompiledLayoutDerived
+        : public CompiledLayoutBase
+    {
+        AZ_RTTI(CompiledLayoutDerived, "{A3B90F6E-1D24-4C7A-8E55-7F0B3C9D2E46}", CompiledLayoutBase);
+        AZ_CLASS_ALLOCATOR(CompiledLayoutDerived, AZ::SystemAllocator, 0);
+        float m_derivedValue = 0.0f;
+    };
+
+    struct CompiledLayoutItem
+    {
+        AZ_TYPE_INFO(CompiledLayoutItem, "{0E6F2B71-94C3-4D5A-B8E2-C17A3F5D9B08}");
+        int m_id = 0;
+        float m_weight = 0.0f;
+        AZStd::string m_name;
+        AZStd::vector<int> m_values;
+        CompiledLayoutBase* m_base = nullptr;
+    };
+
+    struct CompiledLayoutHolder
+    {
+        AZ_TYPE_INFO(CompiledLayoutHolder, "{7D18C4A2-3F6B-4E9D-A05C-E2B8F17C6D34}");
+        AZ_CLASS_ALLOCATOR(CompiledLayoutHolder, AZ::SystemAllocator, 0);
+        ~CompiledLayoutHolder()
+        {
+            for (CompiledLayoutItem& item : m_items)
+            {
+                delete item.m_base;
+            }
+        }
+        AZStd::vector<CompiledLayoutItem> m_items;
+    };
+
+    // Loading many instances of the same class reuses the compiled layout of the class, including for elements that are
+    // stored with a different type than the reflected one.
+    TEST_F(Serialization, ObjectStreamBinary_ManyInstancesOfClass_LoadsAllMembers)
+    {
+        SerializeContext& sc = *GetSerializeContext();
+        sc.Class<CompiledLayoutBase>()
+            ->Field("baseValue", &CompiledLayoutBase::m_baseValue);
+        sc.Class<CompiledLayoutDerived, CompiledLayoutBase>()
+            ->Field("derivedValue", &CompiledLayoutDerived::m_derivedValue);
+        sc.Class<CompiledLayoutItem>()
+            ->Field("id", &CompiledLayoutItem::m_id)
+            ->Field("weight", &CompiledLayoutItem::m_weight)
+            ->Field("name", &CompiledLayoutItem::m_name)
+            ->Field("values", &CompiledLayoutItem::m_values)
+            ->Field("base", &CompiledLayoutItem::m_base);
+        sc.Class<CompiledLayoutHolder>()
+            ->Field("items", &CompiledLayoutHolder::m_items);
+
+        constexpr int numItems = 64;
+        CompiledLayoutHolder source;
+        for (int i = 0; i < numItems; ++i)
+        {
+            CompiledLayoutItem& item = source.m_items.emplace_back();
+            item.m_id = i;
+            item.m_weight = static_cast<float>(i) * 0.5f;
+            item.m_name = AZStd::string::format("Item%d", i);
+            item.m_values = { i, i + 1 };
+            if (i % 2 == 0)
+            {
+                auto derived = aznew CompiledLayoutDerived();
+                derived->m_derivedValue = static_cast<float>(i);
+                item.m_base = derived;
+            }
+            else
+            {
+                item.m_base = aznew CompiledLayoutBase();
+            }
+            item.m_base->m_baseValue = -i;
+        }
+
+        AZStd::vector<char> binaryBuffer;
+        IO::ByteContainerStream<AZStd::vector<char> > binaryStream(&binaryBuffer);
+        ObjectStream* binaryObjStream = ObjectStream::Create(&binaryStream, sc, ObjectStream::ST_BINARY);
+        binaryObjStream->WriteClass(&source);
+        EXPECT_TRUE(binaryObjStream->Finalize());
+        binaryStream.Seek(0, AZ::IO::GenericStream::ST_SEEK_BEGIN);
+
+        CompiledLayoutHolder loaded;
+        ASSERT_TRUE(AZ::Utils::LoadObjectFromStreamInPlace(binaryStream, loaded, &sc));
+        ASSERT_EQ(numItems, loaded.m_items.size());
+        for (int i = 0; i < numItems; ++i)
+        {
+            const CompiledLayoutItem& item = loaded.m_items[i];
+            EXPECT_EQ(i, item.m_id);
+            EXPECT_FLOAT_EQ(static_cast<float>(i) * 0.5f, item.m_weight);
+            EXPECT_STREQ(source.m_items[i].m_name.c_str(), item.m_name.c_str());
+            EXPECT_EQ(source.m_items[i].m_values, item.m_values);
+            ASSERT_NE(nullptr, item.m_base);
+            EXPECT_EQ(-i, item.m_base->m_baseValue);
+            auto derived = azrtti_cast<CompiledLayoutDerived*>(item.m_base);
+            EXPECT_EQ(i % 2 == 0, derived != nullptr);
+            if (derived)
+            {
+                EXPECT_FLOAT_EQ(static_cast<float>(i), derived->m_derivedValue);
+            }
+        }
+    }
+
+    TEST_F(Serialization, CloneObjects_WithAndWithoutJobContext_ClonesActualTypeOfEveryObject)
+    {
+        SerializeContext& sc = *GetSerializeContext();
+        sc.Class<CompiledLayoutBase>()
+            ->Field("baseValue", &CompiledLayoutBase::m_baseValue);
+        sc.Class<CompiledLayoutDerived, CompiledLayoutBase>()
+            ->Field("derivedValue", &CompiledLayoutDerived::m_derivedValue);
+
+        constexpr size_t numObjects = 200;
+        AZStd::vector<AZStd::unique_ptr<CompiledLayoutBase>> objects;
+        AZStd::vector<const CompiledLayoutBase*> objectPtrs;
+        for (size_t i = 0; i < numObjects; ++i)
+        {
+            if (i % 3 == 0)
+            {
+                auto derived = AZStd::make_unique<CompiledLayoutDerived>();
+                derived->m_derivedValue = static_cast<float>(i);
+                objects.emplace_back(AZStd::move(derived));
+            }
+            else
+            {
+                objects.emplace_back(AZStd::make_unique<CompiledLayoutBase>());
+            }
+            objects.back()->m_baseValue = static_cast<int>(i);
+            objectPtrs.push_back(objects.back().get());
+        }
+
+        JobManagerDesc jobDesc;
+        jobDesc.m_workerThreads.resize(4);
+        JobManager jobManager(jobDesc);
+        JobContext jobContext(jobManager);
+
+        for (JobContext* context : { static_cast<JobContext*>(nullptr), &jobContext })
+        {
+            AZStd::vector<CompiledLayoutBase*> clones(numObjects, nullptr);
+            sc.CloneObjects(objectPtrs.data(), clones.data(), numObjects, context);
+            for (size_t i = 0; i < numObjects; ++i)
+            {
+                ASSERT_NE(nullptr, clones[i]);
+                EXPECT_NE(objectPtrs[i], clones[i]);
+                EXPECT_EQ(static_cast<int>(i), clones[i]->m_baseValue);
+                auto derived = azrtti_cast<CompiledLayoutDerived*>(clones[i]);
+                EXPECT_EQ(i % 3 == 0, derived != nullptr);
+                if (derived)
+                {
+                    EXPECT_FLOAT_EQ(static_cast<float>(i), derived->m_derivedValue);
+                }
+                delete clones[i];
+            }
+        }
+    }
+
     // Test that loading containers in-place clears any existing data in the
     // containers (
     template <typename T>
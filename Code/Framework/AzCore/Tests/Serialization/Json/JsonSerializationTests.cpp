@@ -8,6 +8,7 @@
 
 #include <AzCore/PlatformDef.h>
 
+#include <AzCore/IO/GenericStreams.h>
 #include <AzCore/JSON/pointer.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
@@ -205,6 +206,38 @@ namespace JsonSerializationTests
         EXPECT_TRUE(loadInstance.Equals(*description.m_instance, this->m_fullyReflected));
     }
 
+    TYPED_TEST(TypedJsonSerializationTests, LoadFromStream_JsonWithoutDefaults_SucceedsAndMatchesDocumentLoad)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        this->Reflect(true);
+        auto description = TypeParam::GetInstanceWithoutDefaults();
+        AZ::IO::MemoryStream stream(description.m_json, strlen(description.m_json));
+
+        TypeParam loadInstance;
+        ResultCode loadResult = AZ::JsonSerialization::Load(loadInstance, stream, *this->m_deserializationSettings);
+        ASSERT_EQ(Outcomes::Success, loadResult.GetOutcome());
+        EXPECT_TRUE(loadInstance.Equals(*description.m_instance, this->m_fullyReflected));
+    }
+
+    TYPED_TEST(TypedJsonSerializationTests, LoadFromStream_JsonWithSomeDefaults_SucceedsAndMatchesDocumentLoad)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        this->Reflect(true);
+        auto description = TypeParam::GetInstanceWithSomeDefaults();
+        this->m_jsonDocument->Parse(description.m_jsonWithStrippedDefaults);
+        TypeParam documentInstance;
+        ResultCode documentResult = AZ::JsonSerialization::Load(documentInstance, *this->m_jsonDocument, *this->m_deserializationSettings);
+
+        AZ::IO::MemoryStream stream(description.m_jsonWithStrippedDefaults, strlen(description.m_jsonWithStrippedDefaults));
+        TypeParam loadInstance;
+        ResultCode loadResult = AZ::JsonSerialization::Load(loadInstance, stream, *this->m_deserializationSettings);
+        EXPECT_EQ(documentResult.GetOutcome(), loadResult.GetOutcome());
+        EXPECT_EQ(documentResult.GetProcessing(), loadResult.GetProcessing());
+        EXPECT_TRUE(loadInstance.Equals(*description.m_instance, this->m_fullyReflected));
+    }
+
     // Load
 
     TEST_F(JsonSerializationTests, Load_PrimitiveAtTheRoot_SucceedsAndObjectMatches)
@@ -445,6 +478,74 @@ namespace JsonSerializationTests
 
     }
 
+    TEST_F(JsonSerializationTests, LoadFromStream_ArrayAtTheRoot_SucceedsAndObjectMatches)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        auto genericInfo = AZ::SerializeGenericTypeInfo<AZStd::vector<int>>::GetGenericInfo();
+        ASSERT_NE(nullptr, genericInfo);
+        genericInfo->Reflect(m_serializeContext.get());
+
+        constexpr AZStd::string_view json = "[13, 42, /* comment */ 88]";
+        AZ::IO::MemoryStream stream(json.data(), json.size());
+
+        AZStd::vector<int> loadValues;
+        ResultCode loadResult = AZ::JsonSerialization::Load(loadValues, stream, *m_deserializationSettings);
+        ASSERT_EQ(Outcomes::Success, loadResult.GetOutcome());
+        EXPECT_EQ(loadValues, AZStd::vector<int>({ 13, 42, 88 }));
+    }
+
+    TEST_F(JsonSerializationTests, LoadFromStream_InvalidJson_ReturnsCatastrophic)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        constexpr AZStd::string_view json = R"({ "var1": 188, )";
+        AZ::IO::MemoryStream stream(json.data(), json.size());
+
+        TemplatedClass<int>::Reflect(m_serializeContext, true);
+        TemplatedClass<int> instance;
+        ResultCode loadResult = AZ::JsonSerialization::Load(instance, stream, *m_deserializationSettings);
+        EXPECT_EQ(Outcomes::Catastrophic, loadResult.GetOutcome());
+
+        m_serializeContext->EnableRemoveReflection();
+        TemplatedClass<int>::Reflect(m_serializeContext, true);
+        m_serializeContext->DisableRemoveReflection();
+    }
+
+    TEST_F(JsonSerializationTests, LoadFromStream_TemplatedClassWithRegisteredHandler_LoadOnHandlerCalledWithFullValue)
+    {
+        using namespace AZ::JsonSerializationResult;
+        using namespace ::testing;
+
+        constexpr AZStd::string_view json = R"({ "var1": 188, "var2": [ 1, 2, 3 ] })";
+        AZ::IO::MemoryStream stream(json.data(), json.size());
+
+        TemplatedClass<int>::Reflect(m_serializeContext, true);
+        m_jsonRegistrationContext->Serializer<JsonSerializerMock>()->HandlesType<TemplatedClass>();
+        JsonSerializerMock* mock = reinterpret_cast<JsonSerializerMock*>(
+            m_jsonRegistrationContext->GetSerializerForType(azrtti_typeid<TemplatedClass>()));
+        EXPECT_CALL(*mock, Load(_, _, _, _))
+            .Times(Exactly(1))
+            .WillRepeatedly(Invoke([this](void*, const AZ::Uuid&, const rapidjson::Value& inputValue, AZ::JsonDeserializerContext&)
+                {
+                    EXPECT_TRUE(inputValue.IsObject());
+                    EXPECT_EQ(2, inputValue.MemberCount());
+                    EXPECT_EQ(3, inputValue["var2"].Size());
+                    return Result(m_deserializationSettings->m_reporting, "Test", Tasks::ReadField, Outcomes::Success, "");
+                }));
+
+        TemplatedClass<int> instance;
+        AZ::JsonSerialization::Load(instance, stream, *m_deserializationSettings);
+
+        m_serializeContext->EnableRemoveReflection();
+        TemplatedClass<int>::Reflect(m_serializeContext, true);
+        m_serializeContext->DisableRemoveReflection();
+
+        m_jsonRegistrationContext->EnableRemoveReflection();
+        m_jsonRegistrationContext->Serializer<JsonSerializerMock>()->HandlesType<TemplatedClass>();
+        m_jsonRegistrationContext->DisableRemoveReflection();
+    }
+
     TEST_F(JsonSerializationTests, Load_PrimitiveForInheritedClass_LoadsCorrectClass)
     {
         using namespace AZ::JsonSerializationResult;
@@ -16,6 +16,7 @@
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/containers/variant.h>
+#include <AzCore/std/limits.h>
 #include <AzCore/Utils/Utils.h>
 #include <AzCore/UnitTest/TestTypes.h>
 
@@ -539,6 +540,102 @@ tags=tools,renderer,metal)"
         EXPECT_STREQ("Bat", commandLine.GetMiscValue(2).c_str());
     }
 
+    using SettingsRegistryMergeUtilsCompiledFixture = SettingsRegistryMergeUtilsCommandLineFixture;
+
+    TEST_F(SettingsRegistryMergeUtilsCompiledFixture, DumpSettingsToCompiledStream_MergeIntoNewRegistry_RestoresAllValues)
+    {
+        ASSERT_TRUE(m_registry->MergeSettings(
+            R"({ "Test": { "NullType": null, "TrueType": true, "FalseType": false, "IntType": -42, "UIntType": 18446744073709551615,)"
+            R"( "DoubleType": 42.5, "StringType": "Hello world", "Array": [ 1, "two", { "Three": 3 } ] } })",
+            AZ::SettingsRegistryInterface::Format::JsonMergePatch));
+
+        AZStd::vector<char> buffer;
+        AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&buffer);
+        ASSERT_TRUE(AZ::SettingsRegistryMergeUtils::DumpSettingsRegistryToCompiledStream(*m_registry, "", stream));
+        ASSERT_FALSE(buffer.empty());
+
+        AZ::SettingsRegistryImpl compiledRegistry;
+        ASSERT_TRUE(compiledRegistry.MergeSettings(AZStd::string_view(buffer.data(), buffer.size()),
+            AZ::SettingsRegistryInterface::Format::Compiled));
+
+        AZStd::string expectedDump;
+        AZ::IO::ByteContainerStream expectedStream(&expectedDump);
+        AZStd::string compiledDump;
+        AZ::IO::ByteContainerStream compiledStream(&compiledDump);
+        ASSERT_TRUE(AZ::SettingsRegistryMergeUtils::DumpSettingsRegistryToStream(*m_registry, "", expectedStream, {}));
+        ASSERT_TRUE(AZ::SettingsRegistryMergeUtils::DumpSettingsRegistryToStream(compiledRegistry, "", compiledStream, {}));
+        EXPECT_EQ(expectedDump, compiledDump);
+
+        AZ::u64 uintValue{};
+        EXPECT_TRUE(compiledRegistry.Get(uintValue, "/Test/UIntType"));
+        EXPECT_EQ(AZStd::numeric_limits<AZ::u64>::max(), uintValue);
+        AZ::s64 threeValue{};
+        EXPECT_TRUE(compiledRegistry.Get(threeValue, "/Test/Array/2/Three"));
+        EXPECT_EQ(3, threeValue);
+    }
+
+    TEST_F(SettingsRegistryMergeUtilsCompiledFixture, MergeCompiledSettings_ExistingSettings_MergesObjectsAndReplacesValues)
+    {
+        ASSERT_TRUE(m_registry->MergeSettings(R"({ "Test": { "Kept": "old", "Replaced": 1, "Array": [ 1, 2, 3 ] } })",
+            AZ::SettingsRegistryInterface::Format::JsonMergePatch));
+
+        AZ::SettingsRegistryImpl sourceRegistry;
+        ASSERT_TRUE(sourceRegistry.MergeSettings(R"({ "Test": { "Replaced": "new", "Added": true, "Array": [ 4 ] } })",
+            AZ::SettingsRegistryInterface::Format::JsonMergePatch));
+        AZStd::vector<char> buffer;
+        AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&buffer);
+        ASSERT_TRUE(AZ::SettingsRegistryMergeUtils::DumpSettingsRegistryToCompiledStream(sourceRegistry, "", stream));
+
+        ASSERT_TRUE(m_registry->MergeSettings(AZStd::string_view(buffer.data(), buffer.size()),
+            AZ::SettingsRegistryInterface::Format::Compiled));
+
+        AZStd::string dump;
+        AZ::IO::ByteContainerStream dumpStream(&dump);
+        ASSERT_TRUE(AZ::SettingsRegistryMergeUtils::DumpSettingsRegistryToStream(*m_registry, "/Test", dumpStream, {}));
+        EXPECT_STREQ(R"({"Kept":"old","Replaced":"new","Array":[4],"Added":true})", dump.c_str());
+    }
+
+    TEST_F(SettingsRegistryMergeUtilsCompiledFixture, DumpSettingsToCompiledStream_WithIncludeFilter_SkipsExcludedValues)
+    {
+        ASSERT_TRUE(m_registry->MergeSettings(R"({ "Test": { "Included": 1, "Excluded": { "Value": 2 } } })",
+            AZ::SettingsRegistryInterface::Format::JsonMergePatch));
+
+        AZStd::vector<char> buffer;
+        AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&buffer);
+        ASSERT_TRUE(AZ::SettingsRegistryMergeUtils::DumpSettingsRegistryToCompiledStream(*m_registry, "", stream,
+            [](AZStd::string_view path)
+            {
+                constexpr AZStd::string_view excludedPath = "/Test/Excluded";
+                return !path.starts_with(excludedPath) || (path.size() > excludedPath.size() && path[excludedPath.size()] != '/');
+            }));
+
+        AZ::SettingsRegistryImpl compiledRegistry;
+        ASSERT_TRUE(compiledRegistry.MergeSettings(AZStd::string_view(buffer.data(), buffer.size()),
+            AZ::SettingsRegistryInterface::Format::Compiled));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::Integer, compiledRegistry.GetType("/Test/Included"));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::NoType, compiledRegistry.GetType("/Test/Excluded"));
+    }
+
+    TEST_F(SettingsRegistryMergeUtilsCompiledFixture, MergeCompiledSettings_TruncatedData_FailsAndLeavesRegistryUnchanged)
+    {
+        ASSERT_TRUE(m_registry->MergeSettings(R"({ "Test": { "Value": "original", "Other": [ 1, 2, 3 ] } })",
+            AZ::SettingsRegistryInterface::Format::JsonMergePatch));
+
+        AZStd::vector<char> buffer;
+        AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&buffer);
+        ASSERT_TRUE(AZ::SettingsRegistryMergeUtils::DumpSettingsRegistryToCompiledStream(*m_registry, "", stream));
+
+        ASSERT_TRUE(m_registry->Set("/Test/Value", "changed"));
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(m_registry->MergeSettings(AZStd::string_view(buffer.data(), buffer.size() - 1),
+            AZ::SettingsRegistryInterface::Format::Compiled));
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+
+        AZ::SettingsRegistryInterface::FixedValueString value;
+        EXPECT_TRUE(m_registry->Get(value, "/Test/Value"));
+        EXPECT_STREQ("changed", value.c_str());
+    }
+
     using SettingsRegistryAncestorDescendantOrEqualPathFixture = SettingsRegistryMergeUtilsCommandLineFixture;
 
     TEST_F(SettingsRegistryAncestorDescendantOrEqualPathFixture, ValidateThatAncestorOrDescendantOrPathWithTheSameValue_Succeeds)
@@ -56,6 +56,7 @@ namespace AZ::IO
         {
             Uncompressed,
             Compressed,
+            Chunked,
             Corrupted
         };
 
@@ -190,7 +191,7 @@ namespace AZ::IO
         {
             CompressionInfo compressionInfo;
             compressionInfo.m_compressedSize = m_fakeFileLength;
-            compressionInfo.m_isCompressed = (compressionState == CompressionState::Compressed || compressionState == CompressionState::Corrupted);
+            compressionInfo.m_isCompressed = (compressionState != CompressionState::Uncompressed);
             compressionInfo.m_offset = 0;
             compressionInfo.m_uncompressedSize = m_fakeFileLength;
             if (compressionState == CompressionState::Corrupted)
@@ -199,13 +200,31 @@ namespace AZ::IO
             }
             else
             {
-                compressionInfo.m_decompressor = [](const CompressionInfo&, const void* compressed,
+                compressionInfo.m_decompressor = [this](const CompressionInfo&, const void* compressed,
                     size_t compressedSize, void* uncompressed, size_t uncompressedBufferSize) -> bool
                 {
+                    m_numDecompressorCalls++;
                     return Streamer_FullDecompressorTest::Decompressor(false,
                         compressed, compressedSize, uncompressed, uncompressedBufferSize);
                 };
             }
+            if (compressionState == CompressionState::Chunked)
+            {
+                compressionInfo.m_chunkLayout = [](const CompressionInfo& info, const void*, size_t,
+                    AZStd::vector<CompressedChunk>& chunks) -> bool
+                {
+                    // The fake decompressor only copies, so the compressed and decompressed chunks are the same.
+                    for (size_t offset = 0; offset < info.m_uncompressedSize; offset += m_fakeChunkSize)
+                    {
+                        CompressedChunk& chunk = chunks.emplace_back();
+                        chunk.m_compressedOffset = offset;
+                        chunk.m_uncompressedOffset = offset;
+                        chunk.m_compressedSize = AZStd::GetMin(m_fakeChunkSize, info.m_uncompressedSize - offset);
+                        chunk.m_uncompressedSize = chunk.m_compressedSize;
+                    }
+                    return true;
+                };
+            }
 
             FileRequest* request = m_context->GetNewInternalRequest();
             request->CreateCompressedRead(nullptr, AZStd::move(compressionInfo), m_buffer, offset, size);
@@ -316,6 +335,8 @@ namespace AZ::IO
         AZStd::shared_ptr<FullFileDecompressor> m_decompressor;
         AZStd::shared_ptr<StreamStackEntryMock> m_mock;
         u64 m_fakeFileLength{ 1 * 1024 * 1024 };
+        static constexpr size_t m_fakeChunkSize = 64 * 1024;
+        AZStd::atomic<u32> m_numDecompressorCalls{ 0 };
     };
 
     TEST_F(Streamer_FullDecompressorTest, DecompressedRead_FullReadAndDecompressData_SuccessfullyReadData)
@@ -350,6 +371,26 @@ namespace AZ::IO
         VerifyReadBuffer(256, m_fakeFileLength - 512);
     }
 
+    TEST_F(Streamer_FullDecompressorTest, DecompressedRead_FullReadOfChunkedFile_AllChunksDecompressed)
+    {
+        SetupEnvironment();
+        MockReadCalls(ReadResult::Success);
+        ProcessCompressedRead(0, m_fakeFileLength, CompressionState::Chunked, IStreamerTypes::RequestStatus::Completed);
+        VerifyReadBuffer(0, m_fakeFileLength);
+        EXPECT_EQ(m_fakeFileLength / m_fakeChunkSize, m_numDecompressorCalls.load());
+    }
+
+    TEST_F(Streamer_FullDecompressorTest, DecompressedRead_PartialReadOfChunkedFile_OnlyOverlappingChunksDecompressed)
+    {
+        SetupEnvironment();
+        MockReadCalls(ReadResult::Success);
+        // Starts in the second chunk and ends in the fourth chunk.
+        ProcessCompressedRead(m_fakeChunkSize + 256, m_fakeChunkSize * 2, CompressionState::Chunked,
+            IStreamerTypes::RequestStatus::Completed);
+        VerifyReadBuffer(m_fakeChunkSize + 256, m_fakeChunkSize * 2);
+        EXPECT_EQ(3u, m_numDecompressorCalls.load());
+    }
+
     TEST_F(Streamer_FullDecompressorTest, DecompressedRead_FailedRead_FailureIsDetectedAndReported)
     {
         SetupEnvironment();
@@ -0,0 +1,308 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/CompressionBus.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/PersistentCache.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AZTestShared/Utils/Utils.h>
+#include <AzTest/AzTest.h>
+#include <Tests/Streamer/StreamStackEntryMock.h>
+
+namespace AZ::IO
+{
+    class Streamer_PersistentCacheTest
+        : public UnitTest::AllocatorsFixture
+    {
+    public:
+        static constexpr u64 FileSize = 16_kib;
+
+        void SetUp() override
+        {
+            using ::testing::_;
+            using ::testing::AnyNumber;
+            using ::testing::Invoke;
+            using ::testing::Return;
+
+            UnitTest::AllocatorsFixture::SetUp();
+
+            m_cachePath = UnitTest::GetTestFolderPath() + "PersistentCacheTest/";
+            m_archivePath = UnitTest::GetTestFolderPath() + "PersistentCacheTestArchive.pak";
+            ClearCacheFolder();
+
+            SystemFile archive;
+            ASSERT_TRUE(archive.Open(m_archivePath.c_str(), SystemFile::SF_OPEN_CREATE | SystemFile::SF_OPEN_WRITE_ONLY));
+            constexpr char archiveContent[] = "Placeholder archive";
+            archive.Write(archiveContent, sizeof(archiveContent));
+            archive.Close();
+            m_archive.InitFromAbsolutePath(m_archivePath);
+
+            m_context = AZStd::make_unique<StreamerContext>();
+            m_mock = AZStd::make_shared<StreamStackEntryMock>();
+            EXPECT_CALL(*m_mock, ExecuteRequests()).Times(AnyNumber()).WillRepeatedly(Return(false));
+            EXPECT_CALL(*m_mock, UpdateStatus(_)).Times(AnyNumber());
+            EXPECT_CALL(*m_mock, QueueRequest(_)).Times(AnyNumber());
+            ON_CALL(*m_mock, QueueRequest(_)).WillByDefault(Invoke(this, &Streamer_PersistentCacheTest::ProcessRequest));
+
+            CreateCache(FileSize * 8);
+        }
+
+        void TearDown() override
+        {
+            m_cache.reset();
+            m_mock.reset();
+            m_context.reset();
+
+            ClearCacheFolder();
+            SystemFile::DeleteDir(m_cachePath.c_str());
+            SystemFile::Delete(m_archivePath.c_str());
+
+            UnitTest::AllocatorsFixture::TearDown();
+        }
+
+        void CreateCache(u64 cacheSize)
+        {
+            m_cache.reset();
+            m_cache = AZStd::make_shared<PersistentCache>(m_cachePath, cacheSize, cacheSize);
+            m_cache->SetNext(m_mock);
+            m_cache->SetContext(*m_context);
+        }
+
+        void ClearCacheFolder()
+        {
+            AZStd::vector<AZStd::string> files;
+            SystemFile::FindFiles((m_cachePath + "*").c_str(), [&files](const char* fileName, bool isFile)
+                {
+                    if (isFile)
+                    {
+                        files.emplace_back(fileName);
+                    }
+                    return true;
+                });
+            for (const AZStd::string& file : files)
+            {
+                SystemFile::Delete((m_cachePath + file).c_str());
+            }
+        }
+
+        //! Fakes the rest of the stack. Compressed reads are "decompressed" into a pattern based on the archive offset and
+        //! regular reads are served from disk so reads from cached files go through the actual file.
+        void ProcessRequest(FileRequest* request)
+        {
+            if (auto compressedRead = AZStd::get_if<FileRequest::CompressedReadData>(&request->GetCommand()))
+            {
+                m_numDecompressions++;
+                u8* output = reinterpret_cast<u8*>(compressedRead->m_output);
+                for (u64 i = 0; i < compressedRead->m_readSize; ++i)
+                {
+                    output[i] = GetExpectedByte(compressedRead->m_compressionInfo.m_offset, compressedRead->m_readOffset + i);
+                }
+                request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            }
+            else if (auto read = AZStd::get_if<FileRequest::ReadData>(&request->GetCommand()))
+            {
+                m_numCacheReads++;
+                u64 bytesRead = SystemFile::Length(read->m_path.GetAbsolutePath()) >= read->m_offset + read->m_size
+                    ? SystemFile::Read(read->m_path.GetAbsolutePath(), read->m_output, read->m_size, read->m_offset)
+                    : 0;
+                request->SetStatus(bytesRead == read->m_size
+                    ? IStreamerTypes::RequestStatus::Completed : IStreamerTypes::RequestStatus::Failed);
+            }
+            else
+            {
+                request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            }
+            m_context->MarkRequestAsCompleted(request);
+        }
+
+        static u8 GetExpectedByte(size_t archiveOffset, u64 fileOffset)
+        {
+            return aznumeric_cast<u8>((archiveOffset + fileOffset) & 0xff);
+        }
+
+        CompressionInfo CreateCompressionInfo(size_t archiveOffset, bool isCompressed = true)
+        {
+            CompressionInfo info;
+            info.m_archiveFilename = m_archive;
+            info.m_offset = archiveOffset;
+            info.m_compressedSize = FileSize / 2;
+            info.m_uncompressedSize = FileSize;
+            info.m_isCompressed = isCompressed;
+            return info;
+        }
+
+        void Read(size_t archiveOffset, u64 readOffset, u64 readSize, bool isCompressed = true)
+        {
+            AZStd::unique_ptr<u8[]> buffer(new u8[readSize]);
+            bool completed = false;
+
+            FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateCompressedRead(nullptr, CreateCompressionInfo(archiveOffset, isCompressed), buffer.get(), readOffset, readSize);
+            request->SetCompletionCallback([&completed](const FileRequest& request)
+                {
+                    EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, request.GetStatus());
+                    completed = true;
+                });
+            m_cache->QueueRequest(request);
+            while (m_context->FinalizeCompletedRequests() || m_cache->ExecuteRequests())
+            {
+            }
+
+            ASSERT_TRUE(completed);
+            for (u64 i = 0; i < readSize; ++i)
+            {
+                if (buffer[i] != GetExpectedByte(archiveOffset, readOffset + i))
+                {
+                    ADD_FAILURE() << "Mismatch at offset " << (readOffset + i);
+                    return;
+                }
+            }
+        }
+
+        void WaitForWrites()
+        {
+            auto startTime = AZStd::chrono::system_clock::now();
+            do
+            {
+                if (AZStd::chrono::system_clock::now() - startTime > AZStd::chrono::seconds(5))
+                {
+                    FAIL() << "Timed out waiting for files to be written to the persistent cache.";
+                }
+                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+                m_cache->ExecuteRequests();
+                m_context->FinalizeCompletedRequests();
+            } while (m_cache->HasPendingWrites());
+        }
+
+        size_t CountCacheFiles() const
+        {
+            size_t count = 0;
+            SystemFile::FindFiles((m_cachePath + "*.azcache").c_str(), [&count](const char*, bool isFile)
+                {
+                    count += isFile ? 1 : 0;
+                    return true;
+                });
+            return count;
+        }
+
+    protected:
+        AZStd::unique_ptr<StreamerContext> m_context;
+        AZStd::shared_ptr<StreamStackEntryMock> m_mock;
+        AZStd::shared_ptr<PersistentCache> m_cache;
+        AZStd::string m_cachePath;
+        AZStd::string m_archivePath;
+        RequestPath m_archive;
+        size_t m_numDecompressions{ 0 };
+        size_t m_numCacheReads{ 0 };
+    };
+
+    TEST_F(Streamer_PersistentCacheTest, CompressedRead_FirstFullRead_DecompressedAndAddedToCache)
+    {
+        Read(0, 0, FileSize);
+        WaitForWrites();
+
+        EXPECT_EQ(1u, m_numDecompressions);
+        EXPECT_EQ(0u, m_numCacheReads);
+        EXPECT_EQ(FileSize, m_cache->GetCachedSize());
+        EXPECT_EQ(1u, CountCacheFiles());
+    }
+
+    TEST_F(Streamer_PersistentCacheTest, CompressedRead_CachedFile_ReadFromCacheInsteadOfDecompressed)
+    {
+        Read(0, 0, FileSize);
+        WaitForWrites();
+
+        Read(0, 0, FileSize);
+
+        EXPECT_EQ(1u, m_numDecompressions);
+        EXPECT_EQ(1u, m_numCacheReads);
+    }
+
+    TEST_F(Streamer_PersistentCacheTest, CompressedRead_PartialReadOfCachedFile_ReadsRequestedRange)
+    {
+        Read(0, 0, FileSize);
+        WaitForWrites();
+
+        Read(0, 1000, 3000);
+
+        EXPECT_EQ(1u, m_numDecompressions);
+        EXPECT_EQ(1u, m_numCacheReads);
+    }
+
+    TEST_F(Streamer_PersistentCacheTest, CompressedRead_PartialReadOfUncachedFile_NotAddedToCache)
+    {
+        Read(0, 1000, 3000);
+        EXPECT_FALSE(m_cache->HasPendingWrites());
+
+        EXPECT_EQ(1u, m_numDecompressions);
+        EXPECT_EQ(0u, m_cache->GetNumCachedFiles());
+    }
+
+    TEST_F(Streamer_PersistentCacheTest, CompressedRead_UncompressedFile_NotAddedToCache)
+    {
+        Read(0, 0, FileSize, false);
+        EXPECT_FALSE(m_cache->HasPendingWrites());
+
+        EXPECT_EQ(1u, m_numDecompressions);
+        EXPECT_EQ(0u, m_cache->GetNumCachedFiles());
+    }
+
+    TEST_F(Streamer_PersistentCacheTest, CompressedRead_CacheExceedsBudget_LeastRecentlyUsedFileEvicted)
+    {
+        CreateCache(FileSize * 2);
+
+        Read(0, 0, FileSize);
+        WaitForWrites();
+        Read(FileSize, 0, FileSize);
+        WaitForWrites();
+        // Use the first file again so the second one becomes the least recently used.
+        Read(0, 0, FileSize);
+        Read(FileSize * 2, 0, FileSize);
+        WaitForWrites();
+
+        EXPECT_EQ(2u, m_cache->GetNumCachedFiles());
+        EXPECT_EQ(FileSize * 2, m_cache->GetCachedSize());
+        EXPECT_EQ(2u, CountCacheFiles());
+
+        size_t decompressions = m_numDecompressions;
+        Read(0, 0, FileSize);
+        EXPECT_EQ(decompressions, m_numDecompressions);
+        Read(FileSize, 0, FileSize);
+        EXPECT_EQ(decompressions + 1, m_numDecompressions);
+    }
+
+    TEST_F(Streamer_PersistentCacheTest, CompressedRead_NewInstance_UsesFilesCachedByPreviousInstance)
+    {
+        Read(0, 0, FileSize);
+        WaitForWrites();
+
+        CreateCache(FileSize * 8);
+        Read(0, 0, FileSize);
+
+        EXPECT_EQ(1u, m_numDecompressions);
+        EXPECT_EQ(1u, m_numCacheReads);
+        EXPECT_EQ(1u, m_cache->GetNumCachedFiles());
+    }
+
+    TEST_F(Streamer_PersistentCacheTest, CompressedRead_CachedFileMissing_FallsBackToDecompressing)
+    {
+        Read(0, 0, FileSize);
+        WaitForWrites();
+
+        ClearCacheFolder();
+        Read(0, 0, FileSize);
+
+        EXPECT_EQ(2u, m_numDecompressions);
+        EXPECT_EQ(1u, m_numCacheReads);
+    }
+} // namespace AZ::IO
@@ -377,4 +377,35 @@ namespace AZ::IO
 
         EXPECT_EQ(Iterations + 1, counter);
     }
+
+    TEST_F(Streamer_SchedulerTest, GetRecommendations_FromScheduler_ContainsSchedulingPrediction)
+    {
+        const IStreamerTypes::Recommendations& recommendations = m_streamer->GetRecommendations();
+        ASSERT_NE(nullptr, recommendations.m_schedulingPrediction);
+        EXPECT_GE(recommendations.PredictCompletionTime(1_mib), AZStd::chrono::system_clock::now() - AZStd::chrono::seconds(1));
+    }
+
+    using Streamer_RecommendationsTest = UnitTest::AllocatorsFixture;
+
+    TEST_F(Streamer_RecommendationsTest, PredictCompletionTime_QueueAndBandwidthKnown_AddsReadTimeAfterQueue)
+    {
+        auto prediction = AZStd::make_shared<IStreamerTypes::SchedulingPrediction>();
+        auto queueCompletion = AZStd::chrono::system_clock::now() + AZStd::chrono::seconds(10);
+        prediction->m_queueCompletionTime = queueCompletion.time_since_epoch().count();
+        prediction->m_bandwidth = 1_mib;
+
+        IStreamerTypes::Recommendations recommendations;
+        recommendations.m_schedulingPrediction = prediction;
+
+        EXPECT_EQ(queueCompletion + AZStd::chrono::seconds(2), recommendations.PredictCompletionTime(2_mib));
+    }
+
+    TEST_F(Streamer_RecommendationsTest, PredictCompletionTime_NoPrediction_ReturnsCurrentTime)
+    {
+        IStreamerTypes::Recommendations recommendations;
+        auto before = AZStd::chrono::system_clock::now();
+        auto predicted = recommendations.PredictCompletionTime(1_mib);
+        EXPECT_GE(predicted, before);
+        EXPECT_LE(predicted, AZStd::chrono::system_clock::now());
+    }
 } // namespace AZ::IO
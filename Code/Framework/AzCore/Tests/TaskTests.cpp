@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    static const AZ::TaskDescriptor s_defaultDesc{ "Test", "TaskTests" };
+    static const AZ::TaskDescriptor s_criticalDesc{ "Critical", "TaskTests", AZ::TaskPriority::CRITICAL };
+
+    class TaskGraphTestFixture
+        : public AllocatorsTestFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsTestFixture::SetUp();
+            m_executor = aznew AZ::TaskExecutor(4);
+        }
+
+        void TearDown() override
+        {
+            delete m_executor;
+            AllocatorsTestFixture::TearDown();
+        }
+
+    protected:
+        AZ::TaskExecutor* m_executor = nullptr;
+    };
+
+    TEST_F(TaskGraphTestFixture, EmptyGraph_Submit_SignalsImmediately)
+    {
+        AZ::TaskGraph graph;
+        AZ::TaskGraphEvent finished;
+        graph.Submit(&finished, m_executor);
+        EXPECT_TRUE(finished.IsSignaled());
+        finished.Wait();
+    }
+
+    TEST_F(TaskGraphTestFixture, IndependentTasks_AllRun)
+    {
+        AZStd::atomic<int> counter{ 0 };
+        AZ::TaskGraph graph;
+        for (int i = 0; i < 64; ++i)
+        {
+            graph.AddTask(s_defaultDesc, [&counter]() { counter.fetch_add(1); });
+        }
+
+        AZ::TaskGraphEvent finished;
+        graph.Submit(&finished, m_executor);
+        finished.Wait();
+
+        EXPECT_EQ(64, counter.load());
+        EXPECT_FALSE(graph.IsInFlight());
+    }
+
+    TEST_F(TaskGraphTestFixture, Dependencies_RunInOrder)
+    {
+        // a -> (b, c) -> d
+        AZStd::atomic<int> step{ 0 };
+        int a = -1, b = -1, c = -1, d = -1;
+
+        AZ::TaskGraph graph;
+        AZ::TaskToken taskA = graph.AddTask(s_defaultDesc, [&]() { a = step.fetch_add(1); });
+        AZ::TaskToken taskB = graph.AddTask(s_defaultDesc, [&]() { b = step.fetch_add(1); });
+        AZ::TaskToken taskC = graph.AddTask(s_criticalDesc, [&]() { c = step.fetch_add(1); });
+        AZ::TaskToken taskD = graph.AddTask(s_defaultDesc, [&]() { d = step.fetch_add(1); });
+        taskA.Precedes(taskB, taskC);
+        taskD.Follows(taskB, taskC);
+
+        AZ::TaskGraphEvent finished;
+        graph.Submit(&finished, m_executor);
+        finished.Wait();
+
+        EXPECT_EQ(0, a);
+        EXPECT_LT(a, b);
+        EXPECT_LT(a, c);
+        EXPECT_EQ(3, d);
+    }
+
+    TEST_F(TaskGraphTestFixture, FrozenGraph_Resubmitted_RunsEveryTime)
+    {
+        AZStd::atomic<int> counter{ 0 };
+        AZ::TaskGraph graph;
+        AZ::TaskToken first = graph.AddTask(s_defaultDesc, [&counter]() { counter.fetch_add(1); });
+        AZ::TaskToken second = graph.AddTask(s_defaultDesc, [&counter]() { counter.fetch_add(10); });
+        first.Precedes(second);
+        graph.Freeze();
+        EXPECT_TRUE(graph.IsFrozen());
+
+        AZ::TaskGraphEvent finished;
+        constexpr int frameCount = 100;
+        for (int frame = 0; frame < frameCount; ++frame)
+        {
+            graph.Submit(&finished, m_executor);
+            finished.Wait();
+        }
+
+        EXPECT_EQ(11 * frameCount, counter.load());
+    }
+
+    TEST_F(TaskGraphTestFixture, AffinityHint_TaskRuns)
+    {
+        AZStd::atomic<int> counter{ 0 };
+        AZ::TaskGraph graph;
+        for (AZ::u32 i = 0; i < 16; ++i)
+        {
+            AZ::TaskDescriptor pinned{ "Pinned", "TaskTests", AZ::TaskPriority::HIGH, i };
+            graph.AddTask(pinned, [&counter]() { counter.fetch_add(1); });
+        }
+
+        AZ::TaskGraphEvent finished;
+        graph.Submit(&finished, m_executor);
+        finished.Wait();
+
+        EXPECT_EQ(16, counter.load());
+    }
+
+    TEST_F(TaskGraphTestFixture, Reset_AllowsRedeclaringGraph)
+    {
+        int value = 0;
+        AZ::TaskGraph graph;
+        graph.AddTask(s_defaultDesc, [&value]() { value = 1; });
+        AZ::TaskGraphEvent finished;
+        graph.Submit(&finished, m_executor);
+        finished.Wait();
+        EXPECT_EQ(1, value);
+
+        graph.Reset();
+        EXPECT_TRUE(graph.IsEmpty());
+        graph.AddTask(s_defaultDesc, [&value]() { value = 2; });
+        graph.Submit(&finished, m_executor);
+        finished.Wait();
+        EXPECT_EQ(2, value);
+    }
+}
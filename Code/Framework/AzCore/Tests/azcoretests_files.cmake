@@ -27,6 +27,7 @@ set(FILES
     Components.cpp
     Console/LoggerSystemComponentTests.cpp
     Console/ConsoleTests.cpp
+    CpuFeaturesTests.cpp
     Debug.cpp
     DLL.cpp
     Driller.cpp
@@ -54,6 +55,7 @@ set(FILES
     Patching.cpp
     RemappableId.cpp
     Rtti.cpp
+    ScheduledTickTests.cpp
     Script.cpp
     ScriptMath.cpp
     Serialization.cpp
@@ -65,6 +67,7 @@ set(FILES
     StreamerTests.cpp
     StringFunc.cpp
     SystemFile.cpp
+    TaskTests.cpp
     TickBusTest.cpp
     TimeDataStatistics.cpp
     UUIDTests.cpp
@@ -85,6 +88,7 @@ set(FILES
     Streamer/FullDecompressorTests.cpp
     Streamer/IStreamerMock.h
     Streamer/IStreamerTypesMock.h
+    Streamer/PersistentCacheTests.cpp
     Streamer/ReadSplitterTests.cpp
     Streamer/SchedulerTests.cpp
     Streamer/StreamStackEntryConformityTests.h
@@ -165,7 +169,11 @@ set(FILES
     Math/Vector3Tests.cpp
     Math/Vector4PerformanceTests.cpp
     Math/Vector4Tests.cpp
+    Math/WideMathPerformanceTests.cpp
+    Math/WideMathTests.cpp
+    Memory/AllocationSampler.cpp
     Memory/AllocatorManager.cpp
+    Memory/FrameArenaAllocator.cpp
     Memory/HphaSchema.cpp
     Memory/HphaSchemaErrorDetection.cpp
     Memory/LeakDetection.cpp
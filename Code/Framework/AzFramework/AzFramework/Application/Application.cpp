@@ -478,10 +478,11 @@ namespace AzFramework
     {
         // relative file paths wrt AssetRoot are always lowercase
         AZStd::to_lower(fullPath.begin(), fullPath.end());
-        AZStd::string cacheAssetPath;
+        // This runs for every asset lookup by path, so the cache root is read into a stack buffer instead of a heap string
+        AZ::IO::FixedMaxPath cacheAssetPath;
         if (auto settingsRegistry = AZ::SettingsRegistry::Get(); settingsRegistry != nullptr)
         {
-            settingsRegistry->Get(cacheAssetPath, AZ::SettingsRegistryMergeUtils::FilePathKey_CacheRootFolder);
+            settingsRegistry->Get(cacheAssetPath.Native(), AZ::SettingsRegistryMergeUtils::FilePathKey_CacheRootFolder);
         }
         MakePathRelative(fullPath, cacheAssetPath.c_str());
     }
@@ -492,17 +493,21 @@ namespace AzFramework
         AZ_Assert(rootPath, "Provided root path is null.");
 
         NormalizePathKeepCase(fullPath);
-        AZStd::string root(rootPath);
-        NormalizePathKeepCase(root);
+        AZ::IO::FixedMaxPathString root(rootPath);
+        ComponentApplication::NormalizePath(root.begin(), root.end(), false);
+        size_t prefixLength = 0;
         if (!azstrnicmp(fullPath.c_str(), root.c_str(), root.length()))
         {
-            fullPath = fullPath.substr(root.length());
+            prefixLength = AZStd::min(root.length(), fullPath.length());
         }
 
-        while (!fullPath.empty() && fullPath[0] == AZ_CORRECT_DATABASE_SEPARATOR)
+        while (prefixLength < fullPath.length() && fullPath[prefixLength] == AZ_CORRECT_DATABASE_SEPARATOR)
         {
-            fullPath.erase(fullPath.begin());
+            ++prefixLength;
         }
+
+        // Erase the root and the leading separators in one go, in place
+        fullPath.erase(0, prefixLength);
     }
 
     ////////////////////////////////////////////////////////////////////////////
@@ -16,6 +16,9 @@
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/IO/SystemFile.h>
 #include <AzCore/IO/FileIO.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManagerBus.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/Utils.h>
 #include <AzCore/NativeUI/NativeUIRequests.h>
@@ -1404,7 +1407,7 @@ namespace AZ::IO
 
 
     bool Archive::OpenPackCommon(AZStd::string_view szBindRoot, AZStd::string_view szFullPath, uint32_t nArchiveFlags,
-        AZStd::intrusive_ptr<AZ::IO::MemoryBlock> pData, bool addLevels)
+        AZStd::intrusive_ptr<AZ::IO::MemoryBlock> pData, bool addLevels, AZStd::intrusive_ptr<INestedArchive> pOpenedArchive)
     {
         // Note this will replace @devassets@ with @assets@ to provide a proper bind root for the archives
         auto conversionResult = ArchiveInternal::ConvertAbsolutePathToAliasedPath(szBindRoot);
@@ -1448,33 +1451,7 @@ namespace AZ::IO
             }
         }
 
-        int flags = INestedArchive::FLAGS_OPTIMIZED_READ_ONLY | INestedArchive::FLAGS_ABSOLUTE_PATHS;
-        if ((nArchiveFlags & FLAGS_PAK_IN_MEMORY) != 0)
-        {
-            flags |= INestedArchive::FLAGS_IN_MEMORY;
-        }
-        if ((nArchiveFlags & FLAGS_PAK_IN_MEMORY_CPU) != 0)
-        {
-            flags |= INestedArchive::FLAGS_IN_MEMORY_CPU;
-        }
-        if ((nArchiveFlags & FLAGS_FILENAMES_AS_CRC32) != 0)
-        {
-            flags |= INestedArchive::FLAGS_FILENAMES_AS_CRC32;
-        }
-        if ((nArchiveFlags & FLAGS_REDIRECT_TO_DISC) != 0)
-        {
-            flags |= FLAGS_REDIRECT_TO_DISC;
-        }
-        if ((nArchiveFlags & INestedArchive::FLAGS_OVERRIDE_PAK) != 0)
-        {
-            flags |= INestedArchive::FLAGS_OVERRIDE_PAK;
-        }
-        if ((nArchiveFlags & FLAGS_LEVEL_PAK_INSIDE_PAK) != 0)
-        {
-            flags |= INestedArchive::FLAGS_INSIDE_PAK;
-        }
-
-        desc.pArchive = OpenArchive(szFullPath, szBindRoot, flags, pData);
+        desc.pArchive = pOpenedArchive ? AZStd::move(pOpenedArchive) : OpenArchive(szFullPath, szBindRoot, GetNestedArchiveFlags(nArchiveFlags), pData);
         if (!desc.pArchive)
         {
             return false; // couldn't open the archive
@@ -1701,10 +1678,34 @@ namespace AZ::IO
 
             // Open files in alphabet order.
             AZStd::sort(files.begin(), files.end());
+
+            // Reading the central directory of every archive is what waits on the disk, so that runs on the job system for all of
+            // them at once. Adding the archives, which notifies other systems, still happens on this thread in alphabet order.
+            AZStd::vector<AZStd::intrusive_ptr<INestedArchive>> openedArchives(files.size());
+            AZ::JobContext* jobContext = nullptr;
+            AZ::JobManagerBus::BroadcastResult(jobContext, &AZ::JobManagerEvents::GetGlobalContext);
+            if (jobContext && files.size() > 1)
+            {
+                const int flags = GetNestedArchiveFlags(nArchiveFlags);
+                AZ::JobCompletion completion(jobContext);
+                for (size_t i = 1; i < files.size(); ++i)
+                {
+                    AZ::Job* job = AZ::CreateJobFunction([this, &openedArchives, &files, szDir, flags, i]()
+                        {
+                            openedArchives[i] = OpenArchive(files[i], szDir, flags);
+                        }, true, jobContext);
+                    job->SetDependent(&completion);
+                    job->Start();
+                }
+                openedArchives[0] = OpenArchive(files[0], szDir, flags);
+                completion.StartAndWaitForCompletion();
+            }
+
             bool bAllOk = true;
-            for (const AZStd::string& file : files)
+            for (size_t i = 0; i < files.size(); ++i)
             {
-                bAllOk = OpenPackCommon(szDir, file, nArchiveFlags, nullptr, addLevels) && bAllOk;
+                const AZStd::string& file = files[i];
+                bAllOk = OpenPackCommon(szDir, file, nArchiveFlags, nullptr, addLevels, AZStd::move(openedArchives[i])) && bAllOk;
 
                 if (pFullPaths)
                 {
@@ -1949,6 +1950,36 @@ namespace AZ::IO
         return AZ::IO::FileIOBase::GetDirectInstance()->CreatePath(pathStr.c_str());
     }
 
+    int Archive::GetNestedArchiveFlags(uint32_t nArchiveFlags)
+    {
+        int flags = INestedArchive::FLAGS_OPTIMIZED_READ_ONLY | INestedArchive::FLAGS_ABSOLUTE_PATHS;
+        if ((nArchiveFlags & FLAGS_PAK_IN_MEMORY) != 0)
+        {
+            flags |= INestedArchive::FLAGS_IN_MEMORY;
+        }
+        if ((nArchiveFlags & FLAGS_PAK_IN_MEMORY_CPU) != 0)
+        {
+            flags |= INestedArchive::FLAGS_IN_MEMORY_CPU;
+        }
+        if ((nArchiveFlags & FLAGS_FILENAMES_AS_CRC32) != 0)
+        {
+            flags |= INestedArchive::FLAGS_FILENAMES_AS_CRC32;
+        }
+        if ((nArchiveFlags & FLAGS_REDIRECT_TO_DISC) != 0)
+        {
+            flags |= FLAGS_REDIRECT_TO_DISC;
+        }
+        if ((nArchiveFlags & INestedArchive::FLAGS_OVERRIDE_PAK) != 0)
+        {
+            flags |= INestedArchive::FLAGS_OVERRIDE_PAK;
+        }
+        if ((nArchiveFlags & FLAGS_LEVEL_PAK_INSIDE_PAK) != 0)
+        {
+            flags |= INestedArchive::FLAGS_INSIDE_PAK;
+        }
+        return flags;
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // open the physical archive file - creates if it doesn't exist
     // returns nullptr if it's invalid or can't open the file
@@ -2550,6 +2581,11 @@ namespace AZ::IO
                     size_t nSizeUncompressed = uncompressedBufferSize;
                     return ZipDir::ZipRawUncompress(uncompressed, &nSizeUncompressed, compressed, compressedSize) == 0;
                 };
+                info.m_chunkLayout = [](const AZ::IO::CompressionInfo& info, const void* compressed, size_t compressedSize,
+                    AZStd::vector<AZ::IO::CompressedChunk>& chunks)->bool
+                {
+                    return ZipDir::ZipRawGetChunks(compressed, compressedSize, info.m_uncompressedSize, chunks);
+                };
             }
         }
     }
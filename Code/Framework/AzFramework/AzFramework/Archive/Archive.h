@@ -310,8 +310,10 @@ namespace AZ::IO
             ZipDir::CachePtr* pZip = {}, bool bSkipInMemoryArchives = {}) const;
     private:
 
-        bool OpenPackCommon(AZStd::string_view szBindRoot, AZStd::string_view pName, uint32_t nArchiveFlags, AZStd::intrusive_ptr<AZ::IO::MemoryBlock> pData = nullptr, bool addLevels = true);
+        bool OpenPackCommon(AZStd::string_view szBindRoot, AZStd::string_view pName, uint32_t nArchiveFlags, AZStd::intrusive_ptr<AZ::IO::MemoryBlock> pData = nullptr, bool addLevels = true,
+            AZStd::intrusive_ptr<INestedArchive> pOpenedArchive = nullptr);
         bool OpenPacksCommon(AZStd::string_view szDir, AZStd::string_view pWildcardIn, uint32_t nArchiveFlags, AZStd::vector<AZ::IO::FixedMaxPathString>* pFullPaths = nullptr, bool addLevels = true);
+        static int GetNestedArchiveFlags(uint32_t nArchiveFlags);
 
         ZipDir::FileEntry* FindPakFileEntry(AZStd::string_view szPath) const;
 
@@ -66,4 +66,12 @@ namespace CompressionCodec
         return CheckMagic(pCompressedData, zstdMagicNumber, zstdMagicSkippable);
     }
 
+    //! Chunked data is a container of independently compressed chunks rather than a codec of its own, so there's no skippable variant.
+    inline constexpr uint32_t s_chunkedMagicNumber = 0x4B435A41; // "AZCK"
+
+    inline bool TestForChunkedMagic(const void* pCompressedData)
+    {
+        return CheckMagic(pCompressedData, s_chunkedMagicNumber, s_chunkedMagicNumber);
+    }
+
 };
@@ -114,6 +114,13 @@ namespace AZ::IO
         virtual int UpdateFile(AZStd::string_view szRelativePath, const void* pUncompressed, uint64_t nSize, uint32_t nCompressionMethod = 0,
             int nCompressionLevel = -1, CompressionCodec::Codec codec = CompressionCodec::Codec::ZLIB) = 0;
 
+        // Summary:
+        //   Sets the size of the chunks compressed files are split into.
+        // Description:
+        //   Files larger than the chunk size that are added with METHOD_DEFLATE are compressed in independent chunks
+        //   so they can be decompressed in parallel and partially. 0 compresses every file as a single block.
+        virtual void SetCompressionChunkSize(uint64_t nChunkSize) = 0;
+
         // Summary:
         //   Adds a new file to the zip or update an existing one if it is not compressed - just stored  - start a big file
         //   ( name might be misleading as if nOverwriteSeekPos is used the update is not continuous )
@@ -7,6 +7,7 @@
  */
 
 
+#include <AzCore/Casting/numeric_cast.h>
 #include <AzFramework/Archive/NestedArchive.h>
 #include <AzFramework/Archive/ZipDirStructures.h>
 #include <AzFramework/Archive/ZipDirTree.h>
@@ -179,6 +180,11 @@ namespace AZ::IO
         return m_pCache->GetFilePath();
     }
 
+    void NestedArchive::SetCompressionChunkSize(uint64_t nChunkSize)
+    {
+        m_pCache->SetCompressionChunkSize(aznumeric_cast<size_t>(nChunkSize));
+    }
+
     ZipDir::Cache* NestedArchive::GetCache()
     {
         return m_pCache.get();
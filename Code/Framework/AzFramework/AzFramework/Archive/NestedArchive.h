@@ -48,6 +48,9 @@ namespace AZ::IO
         int UpdateFile(AZStd::string_view szRelativePath, const void* pUncompressed, uint64_t nSize, uint32_t nCompressionMethod = ZipFile::METHOD_STORE,
             int nCompressionLevel = -1, CompressionCodec::Codec codec = CompressionCodec::Codec::ZLIB) override;
 
+        // sets the size of the independently compressed chunks files larger than this are split into, 0 disables chunking
+        void SetCompressionChunkSize(uint64_t nChunkSize) override;
+
         // Adds a new file to the zip or update an existing one if it is not compressed - just stored  - start a big file
         int StartContinuousFileUpdate(AZStd::string_view szRelativePath, uint64_t nSize) override;
 
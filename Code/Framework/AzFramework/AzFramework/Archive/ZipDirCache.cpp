@@ -274,6 +274,23 @@ namespace AZ::IO::ZipDir
         switch (nCompressionMethod)
         {
         case ZipFile::METHOD_DEFLATE:
+            if (m_compressionChunkSize != 0 && nSize > m_compressionChunkSize)
+            {
+                const size_t chunkCount = (nSize + m_compressionChunkSize - 1) / m_compressionChunkSize;
+                nSizeCompressed = ZipRawGetChunkedHeaderSize(nSize, m_compressionChunkSize) +
+                    chunkCount * GetCompressedSizeEstimate(m_compressionChunkSize, codec);
+                memoryBlock = ZipDirCacheInternal::CreateMemoryBlock(nSizeCompressed, "Cache::UpdateFile");
+                pCompressed = memoryBlock->m_address.get();
+                dataBuffer = pCompressed;
+
+                nError = ZipRawCompressChunked(pUncompressed, &nSizeCompressed, pCompressed, nSize, nCompressionLevel, codec, m_compressionChunkSize);
+                if (Z_OK != nError)
+                {
+                    return ZD_ERROR_ZLIB_FAILED;
+                }
+                break;
+            }
+
             nSizeCompressed = GetCompressedSizeEstimate(nSize, codec);
             memoryBlock = ZipDirCacheInternal::CreateMemoryBlock(nSizeCompressed, "Cache::UpdateFile");
             pCompressed = memoryBlock->m_address.get();
@@ -54,6 +54,13 @@ namespace AZ::IO::ZipDir
         // adds a directory (creates several nested directories if needed)
         ErrorEnum UpdateFile(AZStd::string_view szRelativePath, const void* pUncompressed, uint64_t nSize, uint32_t nCompressionMethod = ZipFile::METHOD_STORE, int nCompressionLevel = -1, CompressionCodec::Codec codec = CompressionCodec::Codec::ZLIB);
 
+        // Files larger than the chunk size are compressed in independent chunks of this size so they can be decompressed in
+        // parallel and partially. 0 (the default) compresses every file as a single block.
+        void SetCompressionChunkSize(size_t chunkSize)
+        {
+            m_compressionChunkSize = chunkSize;
+        }
+
         //   Adds a new file to the zip or update an existing one if it is not compressed - just stored  - start a big file
         ErrorEnum StartContinuousFileUpdate(AZStd::string_view szRelativePath, uint64_t nSize);
 
@@ -168,6 +175,8 @@ namespace AZ::IO::ZipDir
         ZipFile::CryCustomEncryptionHeader m_headerEncryption;
         ZipFile::CrySignedCDRHeader m_headerSignature;
         ZipFile::CryCustomExtendedHeader m_headerExtended;
+
+        size_t m_compressionChunkSize{ 0 };
     };
 
     using CachePtr = AZStd::intrusive_ptr<Cache>;
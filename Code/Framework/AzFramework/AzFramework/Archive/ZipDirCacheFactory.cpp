@@ -166,9 +166,13 @@ namespace AZ::IO::ZipDir
         }
 
         // since it's open for R/W, we need to know exactly how much space
-        // we have for each file to use the gaps efficiently
-        FileEntryList Adjuster(&m_treeFileEntries, m_CDREnd.lCDROffset);
-        Adjuster.RefreshEOFOffsets();
+        // we have for each file to use the gaps efficiently.
+        // Read only caches never write into the gaps, so they skip sorting all the file entries by offset.
+        if (!(rwCache.m_nFlags & Cache::FLAGS_READ_ONLY))
+        {
+            FileEntryList Adjuster(&m_treeFileEntries, m_CDREnd.lCDROffset);
+            Adjuster.RefreshEOFOffsets();
+        }
 
         m_treeFileEntries.Swap(rwCache.m_treeDir);
         m_CDR_buffer.swap(rwCache.m_CDR_buffer);   // CDR Buffer contain actually the string pool for the tree directory.
@@ -470,6 +474,10 @@ namespace AZ::IO::ZipDir
             return false;
         }
 
+        // Constructing a std::locale for every character of every file name is expensive, get the facet once
+        const std::locale locale;
+        const auto& ctype = std::use_facet<std::ctype<char>>(locale);
+
         // now we've read the complete CDR - parse it.
         ZipFile::CDRFileHeader* pFile = (ZipFile::CDRFileHeader*)(&pBuffer[0]);
         const uint8_t* pEndOfData = &pBuffer[0] + m_CDREnd.lCDRSize;
@@ -529,7 +537,7 @@ namespace AZ::IO::ZipDir
                 char* str = reinterpret_cast<char*>(pFileName);
                 for (int i = 0; i < pFile->nFileNameLength; i++)
                 {
-                    str[i] = std::tolower(str[i], std::locale());
+                    str[i] = ctype.tolower(str[i]);
                     if (str[i] == AZ_WRONG_FILESYSTEM_SEPARATOR)
                     {
                         str[i] = AZ_CORRECT_FILESYSTEM_SEPARATOR;
@@ -9,8 +9,10 @@
 
 #include <AzCore/PlatformIncl.h>
 #include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/CompressionBus.h>
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/Memory/OSAllocator.h>
+#include <AzCore/std/limits.h>
 #include <AzFramework/Archive/Codec.h>
 #include <AzFramework/Archive/IArchive.h>
 #include <AzFramework/Archive/ZipFileFormat.h>
@@ -316,6 +318,68 @@ namespace AZ::IO::ZipDir::ZipDirStructuresInternal
 
         return memoryBlock;
     }
+
+    // Uncompresses data that was compressed as a single block, detecting the codec from the magic at the start of the data.
+    static int ZipRawUncompressChunk(void* pUncompressed, size_t* pDestSize, const void* pCompressed, size_t nSrcSize)
+    {
+        int nReturnCode = Z_OK;
+
+        //check first 4 bytes to see what compression codec was used
+        if (CompressionCodec::TestForZSTDMagic(pCompressed))
+        {
+            size_t result = ZSTD_decompress(pUncompressed, *pDestSize, pCompressed, nSrcSize);
+
+            if (ZSTD_isError(result))
+            {
+                AZ_Error("ZipDirStructures", false, "Error decompressing using zstd: %s", ZSTD_getErrorName(result));
+                nReturnCode = Z_BUF_ERROR;
+            }
+            else
+            {
+                *pDestSize = result;
+            }
+            return nReturnCode;
+        }
+        else if (CompressionCodec::TestForLZ4Magic(pCompressed))
+        {
+            size_t result;
+            LZ4F_decompressionContext_t dctx;
+            result = LZ4F_createDecompressionContext(&dctx, LZ4F_VERSION);
+            if (LZ4F_isError(result))
+            {
+                AZ_Error("ZipDirStructures", false, "Error creating lz4 decompression context: %s", LZ4F_getErrorName(result));
+                return Z_BUF_ERROR;
+            }
+
+            size_t dstSize = *pDestSize;
+            size_t srcSize = nSrcSize;
+            result = LZ4F_decompress(dctx, pUncompressed, &dstSize, pCompressed, &srcSize, nullptr);
+            if (LZ4F_isError(result))
+            {
+                AZ_Error("ZipDirStructures", false, "Error decompressing using lz4: %s", LZ4F_getErrorName(result));
+                nReturnCode = Z_BUF_ERROR;
+            }
+            else
+            {
+                *pDestSize = dstSize;
+            }
+
+            size_t freeCode = LZ4F_freeDecompressionContext(dctx);
+            if (LZ4F_isError(freeCode))
+            {
+                //We are not changing the return code in this case, but it is good to record that releasing the
+                //decompression context failed.
+                AZ_Error("ZipDirStructures", false, "Error releasing lz4 decompression context: %s", LZ4F_getErrorName(freeCode));
+            }
+
+            return nReturnCode;
+        }
+
+        //fallback to zlib
+        ZipDirStructuresInternal::ZlibInflateElement_Impl(pCompressed, pUncompressed, nSrcSize, *pDestSize, pDestSize, &nReturnCode);
+
+        return nReturnCode;
+    }
 }
 
 namespace AZ::IO::ZipDir
@@ -517,63 +581,142 @@ namespace AZ::IO::ZipDir
     // way it's stored into zip file
     int ZipRawUncompress(void* pUncompressed, size_t* pDestSize, const void* pCompressed, size_t nSrcSize)
     {
-        int nReturnCode = Z_OK;
-
-        //check first 4 bytes to see what compression codec was used
-        if (CompressionCodec::TestForZSTDMagic(pCompressed))
+        if (nSrcSize >= sizeof(ChunkedCompressionHeader) && CompressionCodec::TestForChunkedMagic(pCompressed))
         {
-            size_t result = ZSTD_decompress(pUncompressed, *pDestSize, pCompressed, nSrcSize);
-
-            if (ZSTD_isError(result))
+            AZStd::vector<CompressedChunk> chunks;
+            if (!ZipRawGetChunks(pCompressed, nSrcSize, *pDestSize, chunks))
             {
-                AZ_Error("ZipDirStructures", false, "Error decompressing using zstd: %s", ZSTD_getErrorName(result));
-                nReturnCode = Z_BUF_ERROR;
+                AZ_Error("ZipDirStructures", false, "Chunk table of chunked compressed data is invalid.");
+                return Z_DATA_ERROR;
             }
-            else
+
+            const uint8_t* compressed = static_cast<const uint8_t*>(pCompressed);
+            uint8_t* uncompressed = static_cast<uint8_t*>(pUncompressed);
+            size_t totalSize = 0;
+            for (const CompressedChunk& chunk : chunks)
             {
-                *pDestSize = result;
+                size_t chunkSize = chunk.m_uncompressedSize;
+                int nReturnCode = ZipDirStructuresInternal::ZipRawUncompressChunk(uncompressed + chunk.m_uncompressedOffset, &chunkSize,
+                    compressed + chunk.m_compressedOffset, chunk.m_compressedSize);
+                if (nReturnCode != Z_OK)
+                {
+                    return nReturnCode;
+                }
+                totalSize += chunkSize;
             }
-            return nReturnCode;
+            *pDestSize = totalSize;
+            return Z_OK;
         }
-        else if (CompressionCodec::TestForLZ4Magic(pCompressed))
+        return ZipDirStructuresInternal::ZipRawUncompressChunk(pUncompressed, pDestSize, pCompressed, nSrcSize);
+    }
+
+    size_t ZipRawGetChunkedHeaderSize(size_t nSrcSize, size_t nChunkSize)
+    {
+        const size_t chunkCount = (nSrcSize + nChunkSize - 1) / nChunkSize;
+        return sizeof(ChunkedCompressionHeader) + chunkCount * sizeof(uint32_t);
+    }
+
+    int ZipRawCompressChunked(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, int nLevel,
+        CompressionCodec::Codec codec, size_t nChunkSize)
+    {
+        if (nChunkSize == 0 || nSrcSize == 0 || nChunkSize > AZStd::numeric_limits<uint32_t>::max())
         {
-            size_t result;
-            LZ4F_decompressionContext_t dctx;
-            result = LZ4F_createDecompressionContext(&dctx, LZ4F_VERSION);
-            if (LZ4F_isError(result))
-            {
-                AZ_Error("ZipDirStructures", false, "Error creating lz4 decompression context: %s", LZ4F_getErrorName(result));
-                return Z_BUF_ERROR;
-            }
+            return Z_STREAM_ERROR;
+        }
 
-            size_t dstSize = *pDestSize;
-            size_t srcSize = nSrcSize;
-            result = LZ4F_decompress(dctx, pUncompressed, &dstSize, pCompressed, &srcSize, nullptr);
-            if (LZ4F_isError(result))
+        const size_t headerSize = ZipRawGetChunkedHeaderSize(nSrcSize, nChunkSize);
+        if (*pDestSize < headerSize)
+        {
+            return Z_BUF_ERROR;
+        }
+
+        ChunkedCompressionHeader header;
+        header.m_magic = CompressionCodec::s_chunkedMagicNumber;
+        header.m_chunkSize = aznumeric_cast<uint32_t>(nChunkSize);
+        header.m_chunkCount = aznumeric_cast<uint32_t>((nSrcSize + nChunkSize - 1) / nChunkSize);
+        header.m_lastChunkSize = aznumeric_cast<uint32_t>(nSrcSize - (header.m_chunkCount - 1) * nChunkSize);
+
+        uint8_t* compressed = static_cast<uint8_t*>(pCompressed);
+        memcpy(compressed, &header, sizeof(header));
+        uint8_t* chunkTable = compressed + sizeof(header);
+
+        const uint8_t* uncompressed = static_cast<const uint8_t*>(pUncompressed);
+        size_t compressedOffset = headerSize;
+        for (uint32_t i = 0; i < header.m_chunkCount; ++i)
+        {
+            const size_t chunkSize = (i + 1 < header.m_chunkCount) ? nChunkSize : header.m_lastChunkSize;
+            size_t chunkCompressedSize = *pDestSize - compressedOffset;
+            int nError = Z_ERRNO;
+            switch (codec)
             {
-                AZ_Error("ZipDirStructures", false, "Error decompressing using lz4: %s", LZ4F_getErrorName(result));
-                nReturnCode = Z_BUF_ERROR;
+            case CompressionCodec::Codec::ZSTD:
+                nError = ZipRawCompressZSTD(uncompressed + i * nChunkSize, &chunkCompressedSize, compressed + compressedOffset, chunkSize, nLevel);
+                break;
+            case CompressionCodec::Codec::ZLIB:
+                nError = ZipRawCompress(uncompressed + i * nChunkSize, &chunkCompressedSize, compressed + compressedOffset, chunkSize, nLevel);
+                break;
+            case CompressionCodec::Codec::LZ4:
+                nError = ZipRawCompressLZ4(uncompressed + i * nChunkSize, &chunkCompressedSize, compressed + compressedOffset, chunkSize, nLevel);
+                break;
+            default:
+                break;
             }
-            else
+            if (nError != Z_OK)
             {
-                *pDestSize = dstSize;
+                return nError;
             }
 
-            size_t freeCode = LZ4F_freeDecompressionContext(dctx);
-            if (LZ4F_isError(freeCode))
-            {
-                //We are not changing the return code in this case, but it is good to record that releasing the
-                //decompression context failed.
-                AZ_Error("ZipDirStructures", false, "Error releasing lz4 decompression context: %s", LZ4F_getErrorName(freeCode));
-            }
+            const uint32_t chunkCompressedSize32 = aznumeric_cast<uint32_t>(chunkCompressedSize);
+            memcpy(chunkTable + i * sizeof(uint32_t), &chunkCompressedSize32, sizeof(uint32_t));
+            compressedOffset += chunkCompressedSize;
+        }
 
-            return nReturnCode;
+        *pDestSize = compressedOffset;
+        return Z_OK;
+    }
+
+    bool ZipRawGetChunks(const void* pCompressed, size_t nSrcSize, size_t nUncompressedSize, AZStd::vector<CompressedChunk>& chunks)
+    {
+        if (nSrcSize < sizeof(ChunkedCompressionHeader) || !CompressionCodec::TestForChunkedMagic(pCompressed))
+        {
+            return false;
         }
 
-        //fallback to zlib
-        ZipDirStructuresInternal::ZlibInflateElement_Impl(pCompressed, pUncompressed, nSrcSize, *pDestSize, pDestSize, &nReturnCode);
+        const uint8_t* compressed = static_cast<const uint8_t*>(pCompressed);
+        ChunkedCompressionHeader header;
+        memcpy(&header, compressed, sizeof(header));
+        if (header.m_chunkCount == 0 || header.m_chunkSize == 0 || header.m_lastChunkSize == 0 || header.m_lastChunkSize > header.m_chunkSize ||
+            (static_cast<size_t>(header.m_chunkCount) - 1) * header.m_chunkSize + header.m_lastChunkSize != nUncompressedSize)
+        {
+            return false;
+        }
 
-        return nReturnCode;
+        const size_t headerSize = sizeof(header) + static_cast<size_t>(header.m_chunkCount) * sizeof(uint32_t);
+        if (nSrcSize < headerSize)
+        {
+            return false;
+        }
+
+        chunks.clear();
+        chunks.reserve(header.m_chunkCount);
+        size_t compressedOffset = headerSize;
+        for (uint32_t i = 0; i < header.m_chunkCount; ++i)
+        {
+            uint32_t chunkCompressedSize;
+            memcpy(&chunkCompressedSize, compressed + sizeof(header) + i * sizeof(uint32_t), sizeof(uint32_t));
+            if (compressedOffset + chunkCompressedSize > nSrcSize)
+            {
+                return false;
+            }
+
+            CompressedChunk& chunk = chunks.emplace_back();
+            chunk.m_compressedOffset = compressedOffset;
+            chunk.m_compressedSize = chunkCompressedSize;
+            chunk.m_uncompressedOffset = static_cast<size_t>(i) * header.m_chunkSize;
+            chunk.m_uncompressedSize = (i + 1 < header.m_chunkCount) ? header.m_chunkSize : header.m_lastChunkSize;
+            compressedOffset += chunkCompressedSize;
+        }
+        return true;
     }
 
     // compresses the raw data into raw data. The buffer for compressed data itself with the heap passed. Uses method 8 (deflate)
@@ -15,7 +15,9 @@
 #include <AzCore/base.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/intrusive_ptr.h>
+#include <AzFramework/Archive/Codec.h>
 #include <AzFramework/Archive/ZipFileFormat.h>
 
 #if AZ_TRAIT_USE_WINDOWS_FILE_API && AZ_TRAIT_OS_IS_HOST_OS_PLATFORM
@@ -29,6 +31,7 @@ namespace AZ::IO
 {
     class FileIOBase;
     struct MemoryBlock;
+    struct CompressedChunk;
 }
 
 namespace AZ::IO::ZipDir
@@ -146,6 +149,29 @@ namespace AZ::IO::ZipDir
     int ZipRawCompressZSTD(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, int nLevel);
     int ZipRawCompressLZ4(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, int nLevel);
 
+    // Header in front of data that's been compressed in independent chunks. The header is followed by a table with the
+    // compressed size of every chunk and the compressed chunks themselves. Every chunk except the last one holds
+    // m_chunkSize uncompressed bytes and starts with the magic of the codec that was used for it.
+    struct ChunkedCompressionHeader
+    {
+        uint32_t m_magic;
+        uint32_t m_chunkSize;
+        uint32_t m_chunkCount;
+        uint32_t m_lastChunkSize;
+    };
+
+    // Returns the space needed for the chunked compression header and chunk table for data of the given size.
+    size_t ZipRawGetChunkedHeaderSize(size_t nSrcSize, size_t nChunkSize);
+
+    // compresses the raw data in chunks of nChunkSize bytes, with each chunk compressed by the given codec, so the chunks can be
+    // decompressed independently and in parallel. returns one of the Z_* errors (Z_OK upon success), and the size in *pDestSize.
+    int ZipRawCompressChunked(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, int nLevel,
+        CompressionCodec::Codec codec, size_t nChunkSize);
+
+    // Fills in the location of all chunks if the data was compressed with ZipRawCompressChunked. Returns false if the data
+    // isn't chunked or the chunk table doesn't match the sizes.
+    bool ZipRawGetChunks(const void* pCompressed, size_t nSrcSize, size_t nUncompressedSize, AZStd::vector<AZ::IO::CompressedChunk>& chunks);
+
     // fseek wrapper with memory in file support.
     int64_t FSeek(CZipFile* zipFile, int64_t origin, int command);
 
@@ -798,6 +798,9 @@ namespace AzFramework
                 // the lock must expire before we send out notifications to other systems.
                 AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
 
+                // The Asset Processor saves this change into the base catalog, so the cached copy is out of date
+                m_cachedBaseRegistry.reset();
+
                 // is it an add or a change?
                 auto assetInfoPair = m_registry->m_assetIdToInfo.find(assetId);
                 isNewAsset = (assetInfoPair == m_registry->m_assetIdToInfo.end());
@@ -893,6 +896,7 @@ namespace AzFramework
             UnregisterAsset(assetId);
             {
                 AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
+                m_cachedBaseRegistry.reset();
                 for (const auto& mapping : message.m_legacyAssetIds)
                 {
                     m_registry->UnregisterLegacyAssetMapping(mapping);
@@ -954,6 +958,10 @@ namespace AzFramework
             AZStd::lock_guard<AZStd::recursive_mutex> lock(m_baseCatalogNameMutex);
             m_baseCatalogName = catalogRegistryFile;
         }
+        {
+            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
+            m_cachedBaseRegistry.reset();
+        }
         return LoadBaseCatalogInternal();
     }
 
@@ -1112,8 +1120,37 @@ namespace AzFramework
             }
         }
 
-        ResetRegistry();
-        LoadBaseCatalogInternal();
+        bool reusedBaseRegistry = false;
+        {
+            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
+            if (m_cachedBaseRegistry)
+            {
+                *m_registry = *m_cachedBaseRegistry;
+                reusedBaseRegistry = true;
+            }
+        }
+
+        if (reusedBaseRegistry)
+        {
+            // Keep the notification that loading the base catalog sends
+            AZStd::string baseCatalogName;
+            {
+                AZStd::lock_guard<AZStd::recursive_mutex> lock(m_baseCatalogNameMutex);
+                baseCatalogName = m_baseCatalogName;
+            }
+            AZ::TickBus::QueueFunction([baseCatalogName]()
+                {
+                    AssetCatalogEventBus::Broadcast(&AssetCatalogEventBus::Events::OnCatalogLoaded, baseCatalogName.c_str());
+                });
+        }
+        else
+        {
+            ResetRegistry();
+            LoadBaseCatalogInternal();
+
+            AZStd::lock_guard<AZStd::recursive_mutex> lock(m_registryMutex);
+            m_cachedBaseRegistry = AZStd::make_unique<AssetRegistry>(*m_registry);
+        }
 
         for (size_t catalogSlot = 0; catalogSlot < m_deltaCatalogList.size(); ++catalogSlot)
         {
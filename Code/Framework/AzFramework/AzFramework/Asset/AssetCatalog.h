@@ -138,6 +138,10 @@ namespace AzFramework
         AZStd::unordered_set<AZStd::string> m_extensions;           ///< Valid asset extensions.
         mutable AZStd::recursive_mutex m_registryMutex;
         AZStd::unique_ptr<AssetRegistry> m_registry;
+        //! Copy of the base catalog made on the first reload, so that adding or removing delta catalogs (for example when
+        //! mounting bundles) doesn't read and deserialize the whole base catalog again.  Guarded by m_registryMutex.
+        //! Dropped when the base catalog can have changed on disk.
+        AZStd::unique_ptr<AssetRegistry> m_cachedBaseRegistry;
         AZStd::string m_pathBuffer;
         mutable AZStd::recursive_mutex m_baseCatalogNameMutex;
         AZStd::string m_baseCatalogName;
@@ -7,6 +7,7 @@
  */
 
 #include <AzFramework/Components/TransformComponent.h>
+#include <AzFramework/Components/TransformHierarchyUpdateSystem.h>
 #include <AzFramework/Visibility/EntityBoundsUnionBus.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/RTTI/BehaviorContext.h>
@@ -158,6 +159,15 @@ namespace AzFramework
 
     void TransformComponent::Deactivate()
     {
+        if (m_worldTMDirty)
+        {
+            RefreshWorldTM();
+        }
+        if (auto* updateSystem = AZ::Interface<TransformHierarchyUpdateSystem>::Get())
+        {
+            updateSystem->RemoveUpdate(this);
+        }
+
         EBUS_EVENT_ID(m_parentId, AZ::TransformNotificationBus, OnChildRemoved, GetEntityId());
         auto parentTransform = AZ::TransformBus::FindFirstHandler(m_parentId);
         if (parentTransform)
@@ -221,9 +231,30 @@ namespace AzFramework
         SetParentImpl(id, m_isStatic);
     }
 
+    void TransformComponent::ResetForReuse(
+        const AZ::Component& templateComponent, const AZStd::flat_hash_map<AZ::EntityId, AZ::EntityId>& idMap)
+    {
+        AZ_Assert(GetEntity() == nullptr || GetEntity()->GetState() != AZ::Entity::State::Active,
+            "Transform component can only be reset for reuse while its entity is inactive.");
+
+        const auto* source = azrtti_cast<const TransformComponent*>(&templateComponent);
+        AZ_Assert(source, "Transform component can only be reset from another transform component.");
+
+        m_localTM = source->m_localTM;
+        m_worldTM = source->m_worldTM;
+        m_worldTMDirty = false;
+        auto parentIt = idMap.find(source->m_parentId);
+        m_parentId = parentIt != idMap.end() ? parentIt->second : source->m_parentId;
+        m_parentTM = nullptr;
+        m_parentActive = false;
+        m_onNewParentKeepWorldTM = source->m_onNewParentKeepWorldTM;
+        m_parentActivationTransformMode = source->m_parentActivationTransformMode;
+        m_isStatic = source->m_isStatic;
+    }
+
     void TransformComponent::SetWorldTranslation(const AZ::Vector3& newPosition)
     {
-        AZ::Transform newWorldTransform = m_worldTM;
+        AZ::Transform newWorldTransform = GetWorldTM();
         newWorldTransform.SetTranslation(newPosition);
         SetWorldTM(newWorldTransform);
     }
@@ -237,7 +268,7 @@ namespace AzFramework
 
     AZ::Vector3 TransformComponent::GetWorldTranslation()
     {
-        return m_worldTM.GetTranslation();
+        return GetWorldTM().GetTranslation();
     }
 
     AZ::Vector3 TransformComponent::GetLocalTranslation()
@@ -247,25 +278,25 @@ namespace AzFramework
 
     void TransformComponent::MoveEntity(const AZ::Vector3& offset)
     {
-        const AZ::Vector3& worldPosition = m_worldTM.GetTranslation();
+        const AZ::Vector3& worldPosition = GetWorldTM().GetTranslation();
         SetWorldTranslation(worldPosition + offset);
     }
 
     void TransformComponent::SetWorldX(float x)
     {
-        const AZ::Vector3& worldPosition = m_worldTM.GetTranslation();
+        const AZ::Vector3& worldPosition = GetWorldTM().GetTranslation();
         SetWorldTranslation(AZ::Vector3(x, worldPosition.GetY(), worldPosition.GetZ()));
     }
 
     void TransformComponent::SetWorldY(float y)
     {
-        const AZ::Vector3& worldPosition = m_worldTM.GetTranslation();
+        const AZ::Vector3& worldPosition = GetWorldTM().GetTranslation();
         SetWorldTranslation(AZ::Vector3(worldPosition.GetX(), y, worldPosition.GetZ()));
     }
 
     void TransformComponent::SetWorldZ(float z)
     {
-        const AZ::Vector3& worldPosition = m_worldTM.GetTranslation();
+        const AZ::Vector3& worldPosition = GetWorldTM().GetTranslation();
         SetWorldTranslation(AZ::Vector3(worldPosition.GetX(), worldPosition.GetY(), z));
     }
 
@@ -325,19 +356,19 @@ namespace AzFramework
 
     void TransformComponent::SetWorldRotationQuaternion(const AZ::Quaternion& quaternion)
     {
-        AZ::Transform newWorldTransform = m_worldTM;
+        AZ::Transform newWorldTransform = GetWorldTM();
         newWorldTransform.SetRotation(quaternion);
         SetWorldTM(newWorldTransform);
     }
 
     AZ::Vector3 TransformComponent::GetWorldRotation()
     {
-        return m_worldTM.GetRotation().GetEulerRadians();
+        return GetWorldTM().GetRotation().GetEulerRadians();
     }
 
     AZ::Quaternion TransformComponent::GetWorldRotationQuaternion()
     {
-        return m_worldTM.GetRotation();
+        return GetWorldTM().GetRotation();
     }
 
     void TransformComponent::SetLocalRotation(const AZ::Vector3& eulerRadianAngles)
@@ -422,7 +453,7 @@ namespace AzFramework
 
     float TransformComponent::GetWorldUniformScale()
     {
-        return m_worldTM.GetUniformScale();
+        return GetWorldTM().GetUniformScale();
     }
 
     AZStd::vector<AZ::EntityId> TransformComponent::GetChildren()
@@ -520,6 +551,10 @@ namespace AzFramework
     void TransformComponent::OnEntityDeactivated([[maybe_unused]] const AZ::EntityId& parentEntityId)
     {
         AZ_Assert(parentEntityId == m_parentId, "We expect to receive notifications only from the current parent!");
+        if (m_worldTMDirty)
+        {
+            RefreshWorldTM();
+        }
         m_parentTM = nullptr;
         m_parentActive = false;
         ComputeLocalTM();
@@ -533,6 +568,11 @@ namespace AzFramework
             return;
         }
 
+        if (m_worldTMDirty)
+        {
+            RefreshWorldTM();
+        }
+
         AZ::EntityId oldParent = m_parentId;
         if (m_parentId.IsValid())
         {
@@ -605,6 +645,7 @@ namespace AzFramework
     void TransformComponent::SetWorldTMImpl(const AZ::Transform& tm)
     {
         m_worldTM = tm;
+        m_worldTMDirty = false;
         ComputeLocalTM(); // We can user dirty flags and compute it later on demand
     }
 
@@ -614,6 +655,12 @@ namespace AzFramework
         // Ignore the event until we've already derived our local transform.
         if (m_parentTM)
         {
+            if (TransformHierarchyUpdateSystem* updateSystem = TransformHierarchyUpdateSystem::GetIfEnabled())
+            {
+                MarkWorldTMDirty(*updateSystem);
+                return;
+            }
+
             m_worldTM = parentWorldTM * m_localTM;
             EBUS_EVENT_PTR(m_notificationBus, AZ::TransformNotificationBus, OnTransformChanged, m_localTM, m_worldTM);
             m_transformChangedEvent.Signal(m_localTM, m_worldTM);
@@ -651,7 +698,52 @@ namespace AzFramework
         {
             m_worldTM = m_localTM;
         }
+        m_worldTMDirty = false;
+
+        EBUS_EVENT_PTR(m_notificationBus, AZ::TransformNotificationBus, OnTransformChanged, m_localTM, m_worldTM);
+        m_transformChangedEvent.Signal(m_localTM, m_worldTM);
+    }
+
+    void TransformComponent::RefreshWorldTM()
+    {
+        if (m_parentTM)
+        {
+            m_worldTM = m_parentTM->GetWorldTM() * m_localTM;
+        }
+        m_worldTMDirty = false;
+    }
+
+    void TransformComponent::MarkWorldTMDirty(TransformHierarchyUpdateSystem& updateSystem)
+    {
+        // Descendants that are already dirty were marked by an earlier move of an ancestor, so the propagation stops there.
+        if (m_worldTMDirty || !m_parentTM)
+        {
+            return;
+        }
+
+        m_worldTMDirty = true;
+        updateSystem.QueueUpdate(this);
+
+        AZStd::vector<AZ::EntityId> children;
+        AZ::TransformHierarchyInformationBus::Event(GetEntityId(), &AZ::TransformHierarchyInformation::GatherChildren, children);
+        for (const AZ::EntityId& childId : children)
+        {
+            if (auto* childTransform = azrtti_cast<TransformComponent*>(AZ::TransformBus::FindFirstHandler(childId)))
+            {
+                childTransform->MarkWorldTMDirty(updateSystem);
+            }
+        }
+    }
+
+    void TransformComponent::ProcessWorldTMUpdate()
+    {
+        // The world transform may have been set explicitly since it was queued, which already notified the listeners.
+        if (!m_worldTMDirty)
+        {
+            return;
+        }
 
+        RefreshWorldTM();
         EBUS_EVENT_PTR(m_notificationBus, AZ::TransformNotificationBus, OnTransformChanged, m_localTM, m_worldTM);
         m_transformChangedEvent.Signal(m_localTM, m_worldTM);
     }
@@ -13,6 +13,7 @@
 #include <AzCore/Component/EntityBus.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/EBus/Event.h>
+#include <AzFramework/Spawnable/PoolableComponent.h>
 
 namespace AzToolsFramework
 {
@@ -25,6 +26,7 @@ namespace AzToolsFramework
 namespace AzFramework
 {
     class GameEntityContextComponent;
+    class TransformHierarchyUpdateSystem;
 
     /// @deprecated Use AZ::TransformConfig
     using TransformComponentConfiguration = AZ::TransformConfig;
@@ -36,11 +38,13 @@ namespace AzFramework
         , public AZ::TransformBus::Handler
         , public AZ::TransformNotificationBus::Handler
         , private AZ::TransformHierarchyInformationBus::Handler
+        , public PoolableComponent
     {
     public:
-        AZ_COMPONENT(TransformComponent, AZ::TransformComponentTypeId, AZ::TransformInterface);
+        AZ_COMPONENT(TransformComponent, AZ::TransformComponentTypeId, AZ::TransformInterface, PoolableComponent);
 
         friend class AzToolsFramework::Components::TransformComponent;
+        friend class TransformHierarchyUpdateSystem;
 
         using ParentActivationTransformMode = AZ::TransformConfig::ParentActivationTransformMode;
 
@@ -56,9 +60,9 @@ namespace AzFramework
         //! Returns true if the tm was set to the local transform.
         const AZ::Transform& GetLocalTM() override { return m_localTM; }
         //! Returns true if the tm was set to the world transform.
-        const AZ::Transform& GetWorldTM() override { return m_worldTM; }
+        const AZ::Transform& GetWorldTM() override { if (m_worldTMDirty) { RefreshWorldTM(); } return m_worldTM; }
         //! Returns both local and world transforms.
-        void GetLocalAndWorld(AZ::Transform& localTM, AZ::Transform& worldTM) override { localTM = m_localTM; worldTM = m_worldTM; }
+        void GetLocalAndWorld(AZ::Transform& localTM, AZ::Transform& worldTM) override { localTM = m_localTM; worldTM = GetWorldTM(); }
         //! Returns parent EntityId.
         AZ::EntityId GetParentId() override { return m_parentId; }
         //! Returns parent interface if available.
@@ -74,6 +78,10 @@ namespace AzFramework
         //! This will use worldTM as a localTM and move the transform relative to the parent.
         void SetParentRelative(AZ::EntityId id) override;
 
+        // PoolableComponent
+        void ResetForReuse(
+            const AZ::Component& templateComponent, const AZStd::flat_hash_map<AZ::EntityId, AZ::EntityId>& idMap) override;
+
     protected:
 
         // Component
@@ -157,6 +165,16 @@ namespace AzFramework
         void OnTransformChangedImpl(const AZ::Transform& parentLocalTM, const AZ::Transform& parentWorldTM);
         void ComputeLocalTM();
         void ComputeWorldTM();
+
+        //! Batched hierarchy updates, see TransformHierarchyUpdateSystem.
+        //! @{
+        //! Recomputes the dirty world transform from the parent, without notifying the listeners.
+        void RefreshWorldTM();
+        //! Marks the world transform of this transform and its descendants as dirty, and queues them for a batched update.
+        void MarkWorldTMDirty(TransformHierarchyUpdateSystem& updateSystem);
+        //! Updates the dirty world transform and notifies the listeners.
+        void ProcessWorldTMUpdate();
+        //! @}
         //////////////////////////////////////////////////////////////////////////
 
         //! Returns whether external calls are currently allowed to move the transform.
@@ -185,5 +203,6 @@ namespace AzFramework
         bool m_parentActive = false; ///< Keeps track of the state of the parent entity.
         bool m_onNewParentKeepWorldTM = true; ///< If set, recompute localTM instead of worldTM when parent becomes active.
         bool m_isStatic = false; ///< If true, the transform is static and doesn't move while entity is active.
+        bool m_worldTMDirty = false; ///< If set, the parent moved and m_worldTM is waiting for a batched hierarchy update.
     };
 }   // namespace AZ
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/sort.h>
+#include <AzFramework/Components/TransformComponent.h>
+#include <AzFramework/Components/TransformHierarchyUpdateSystem.h>
+
+namespace AzFramework
+{
+    AZ_CVAR(bool, cl_batchTransformHierarchyUpdates, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "If set to true, the transforms of child entities are updated and notified once per tick after their ancestors moved.");
+
+    void TransformHierarchyUpdateSystem::Connect()
+    {
+        AZ::Interface<TransformHierarchyUpdateSystem>::Register(this);
+        AZ::TickBus::Handler::BusConnect();
+    }
+
+    void TransformHierarchyUpdateSystem::Disconnect()
+    {
+        ProcessUpdates();
+
+        AZ::TickBus::Handler::BusDisconnect();
+        AZ::Interface<TransformHierarchyUpdateSystem>::Unregister(this);
+    }
+
+    TransformHierarchyUpdateSystem* TransformHierarchyUpdateSystem::GetIfEnabled()
+    {
+        return cl_batchTransformHierarchyUpdates ? AZ::Interface<TransformHierarchyUpdateSystem>::Get() : nullptr;
+    }
+
+    void TransformHierarchyUpdateSystem::QueueUpdate(TransformComponent* transform)
+    {
+        m_queuedUpdates.push_back(transform);
+    }
+
+    void TransformHierarchyUpdateSystem::RemoveUpdate(TransformComponent* transform)
+    {
+        m_queuedUpdates.erase(AZStd::remove(m_queuedUpdates.begin(), m_queuedUpdates.end(), transform), m_queuedUpdates.end());
+        for (auto& [depth, queuedTransform] : m_processingUpdates)
+        {
+            if (queuedTransform == transform)
+            {
+                queuedTransform = nullptr;
+            }
+        }
+    }
+
+    void TransformHierarchyUpdateSystem::ProcessUpdates()
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzFramework);
+
+        // Listeners can move other entities while they're being notified, which queues more updates.
+        while (!m_queuedUpdates.empty())
+        {
+            m_processingUpdates.clear();
+            m_processingUpdates.reserve(m_queuedUpdates.size());
+            for (TransformComponent* transform : m_queuedUpdates)
+            {
+                size_t depth = 0;
+                for (AZ::TransformInterface* parent = transform->GetParent(); parent != nullptr; parent = parent->GetParent())
+                {
+                    ++depth;
+                }
+                m_processingUpdates.emplace_back(depth, transform);
+            }
+            m_queuedUpdates.clear();
+
+            // Update breadth-first, so each transform is notified after its parent and only once.
+            AZStd::sort(m_processingUpdates.begin(), m_processingUpdates.end(),
+                [](const auto& lhs, const auto& rhs)
+                {
+                    return lhs.first < rhs.first;
+                });
+
+            for (size_t i = 0; i < m_processingUpdates.size(); ++i)
+            {
+                if (TransformComponent* transform = m_processingUpdates[i].second; transform != nullptr)
+                {
+                    transform->ProcessWorldTMUpdate();
+                }
+            }
+            m_processingUpdates.clear();
+        }
+    }
+
+    size_t TransformHierarchyUpdateSystem::GetNumQueuedUpdates() const
+    {
+        return m_queuedUpdates.size();
+    }
+
+    void TransformHierarchyUpdateSystem::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        ProcessUpdates();
+    }
+
+    int TransformHierarchyUpdateSystem::GetTickOrder()
+    {
+        // Right before render-related data gets updated from the transforms.
+        return AZ::ComponentTickBus::TICK_PRE_RENDER - 1;
+    }
+} // namespace AzFramework
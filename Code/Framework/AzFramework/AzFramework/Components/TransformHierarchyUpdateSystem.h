@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/TickBus.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/utils.h>
+
+namespace AzFramework
+{
+    class TransformComponent;
+
+    //! Batches the world transform updates of transforms whose parent moved.
+    //! When enabled through cl_batchTransformHierarchyUpdates, a child transform doesn't recompute its world transform and notify
+    //! its listeners each time an ancestor moves. Instead the child and its descendants are marked dirty, and are updated and
+    //! notified once per tick, breadth-first through the hierarchy. Their world transforms are still computed on demand when queried
+    //! through the TransformBus, so only the change notifications are deferred.
+    class TransformHierarchyUpdateSystem
+        : private AZ::TickBus::Handler
+    {
+    public:
+        AZ_RTTI(AzFramework::TransformHierarchyUpdateSystem, "{8F4B2C61-3D7E-4A95-B0C8-E6A1D2F59347}");
+
+        virtual ~TransformHierarchyUpdateSystem() = default;
+
+        void Connect();
+        void Disconnect();
+
+        //! Returns the registered update system if batched hierarchy updates are enabled, otherwise nullptr.
+        static TransformHierarchyUpdateSystem* GetIfEnabled();
+
+        //! Queues a transform whose world transform became dirty.
+        void QueueUpdate(TransformComponent* transform);
+        //! Removes a transform from the queue, for instance because it got deactivated.
+        void RemoveUpdate(TransformComponent* transform);
+
+        //! Updates and notifies all dirty transforms, parents before their children.
+        //! @note During normal operation this is called every tick but can also be called explicitly (e.g. For testing purposes).
+        void ProcessUpdates();
+
+        size_t GetNumQueuedUpdates() const;
+
+    private:
+        // TickBus overrides ...
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+        int GetTickOrder() override;
+
+        AZStd::vector<TransformComponent*> m_queuedUpdates;
+        AZStd::vector<AZStd::pair<size_t, TransformComponent*>> m_processingUpdates; //!< Sorted by their depth in the hierarchy.
+    };
+} // namespace AzFramework
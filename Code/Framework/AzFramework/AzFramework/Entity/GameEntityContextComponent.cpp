@@ -8,9 +8,15 @@
 
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManagerBus.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/limits.h>
 #include <AzFramework/Entity/EntityContext.h>
 #include <AzFramework/Components/TransformComponent.h>
 #include <AzFramework/API/ApplicationAPI.h>
@@ -19,6 +25,9 @@
 
 namespace AzFramework
 {
+    AZ_CVAR(bool, cl_parallelEntityActivation, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "If set to true, game entities whose components all support parallel activation are activated on the job system.");
+
     //=========================================================================
     // Reflect
     //=========================================================================
@@ -92,6 +101,7 @@ namespace AzFramework
         GameEntityContextRequestBus::Handler::BusConnect();
 
         m_entityVisibilityBoundsUnionSystem.Connect();
+        m_transformHierarchyUpdateSystem.Connect();
     }
 
     //=========================================================================
@@ -99,6 +109,7 @@ namespace AzFramework
     //=========================================================================
     void GameEntityContextComponent::Deactivate()
     {
+        m_transformHierarchyUpdateSystem.Disconnect();
         m_entityVisibilityBoundsUnionSystem.Disconnect();
 
         GameEntityContextRequestBus::Handler::BusDisconnect();
@@ -226,6 +237,12 @@ namespace AzFramework
             }
         }
 
+        if (cl_parallelEntityActivation)
+        {
+            ActivateEntitiesInParallel(entities);
+            return;
+        }
+
         for (AZ::Entity* entity : entities)
         {
             if (entity->GetState() == AZ::Entity::State::Init)
@@ -241,6 +258,113 @@ namespace AzFramework
         }
     }
 
+    //=========================================================================
+    // GameEntityContextComponent::ActivateEntitiesInParallel
+    //=========================================================================
+    void GameEntityContextComponent::ActivateEntitiesInParallel(const EntityList& entities)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzFramework);
+
+        AZStd::unordered_map<AZ::EntityId, size_t> entityIndices;
+        entityIndices.reserve(entities.size());
+        for (size_t i = 0; i < entities.size(); ++i)
+        {
+            AZ::Entity* entity = entities[i];
+            if (entity->GetState() == AZ::Entity::State::Init && entity->IsRuntimeActiveByDefault())
+            {
+                entityIndices.emplace(entity->GetId(), i);
+            }
+        }
+
+        // An entity's depth is the number of its transform ancestors that are activated along with it. Entities at the same
+        // depth don't depend on each other through the transform hierarchy, so they can be activated at the same time.
+        constexpr size_t UnknownDepth = AZStd::numeric_limits<size_t>::max();
+        AZStd::vector<size_t> depths(entities.size(), UnknownDepth);
+        AZStd::vector<size_t> ancestors;
+        size_t maxDepth = 0;
+        for (const auto& [entityId, entityIndex] : entityIndices)
+        {
+            ancestors.clear();
+            size_t index = entityIndex;
+            size_t depth = 0;
+            while (depths[index] == UnknownDepth)
+            {
+                ancestors.push_back(index);
+                auto* transform = entities[index]->FindComponent<TransformComponent>();
+                auto parentIt = transform ? entityIndices.find(transform->GetParentId()) : entityIndices.end();
+                if (parentIt == entityIndices.end() || ancestors.size() > entityIndices.size())
+                {
+                    break;
+                }
+                index = parentIt->second;
+            }
+            if (depths[index] != UnknownDepth)
+            {
+                depth = depths[index] + 1;
+            }
+            for (auto it = ancestors.rbegin(); it != ancestors.rend(); ++it)
+            {
+                depths[*it] = depth++;
+            }
+            maxDepth = AZStd::max(maxDepth, depths[entityIndex]);
+        }
+
+        AZStd::vector<AZStd::vector<AZ::Entity*>> waves(entityIndices.empty() ? 0 : maxDepth + 1);
+        for (size_t i = 0; i < entities.size(); ++i)
+        {
+            if (depths[i] != UnknownDepth)
+            {
+                waves[depths[i]].push_back(entities[i]);
+            }
+        }
+
+        AZ::JobContext* jobContext = nullptr;
+        AZ::JobManagerBus::BroadcastResult(jobContext, &AZ::JobManagerEvents::GetGlobalContext);
+
+        AZStd::vector<AZ::Entity*> parallelEntities;
+        for (const AZStd::vector<AZ::Entity*>& wave : waves)
+        {
+            // Starting and ending the activation notifies other systems, so that's done on this thread for all entities.
+            parallelEntities.clear();
+            for (AZ::Entity* entity : wave)
+            {
+                if (jobContext != nullptr && entity->IsActivationThreadSafe() && entity->BeginActivation())
+                {
+                    parallelEntities.push_back(entity);
+                }
+            }
+
+            if (!parallelEntities.empty())
+            {
+                AZ::JobCompletion completion(jobContext);
+                for (size_t i = 1; i < parallelEntities.size(); ++i)
+                {
+                    AZ::Job* job = AZ::CreateJobFunction([entity = parallelEntities[i]]()
+                        {
+                            entity->ActivateComponents();
+                        }, true, jobContext);
+                    job->SetDependent(&completion);
+                    job->Start();
+                }
+                parallelEntities[0]->ActivateComponents();
+                completion.StartAndWaitForCompletion();
+
+                for (AZ::Entity* entity : parallelEntities)
+                {
+                    entity->EndActivation();
+                }
+            }
+
+            for (AZ::Entity* entity : wave)
+            {
+                if (entity->GetState() == AZ::Entity::State::Init)
+                {
+                    entity->Activate();
+                }
+            }
+        }
+    }
+
     //=========================================================================
     // GameEntityContextComponent::DestroyGameEntityById
     //=========================================================================
@@ -12,6 +12,7 @@
 #include <AzCore/Math/Transform.h>
 #include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/Component/Component.h>
+#include <AzFramework/Components/TransformHierarchyUpdateSystem.h>
 #include <AzFramework/Entity/GameEntityContextBus.h>
 #include <AzFramework/Entity/SliceGameEntityOwnershipService.h>
 #include <AzFramework/Visibility/EntityVisibilityBoundsUnionSystem.h>
@@ -96,7 +97,13 @@ namespace AzFramework
         void DestroyGameEntityAndDescendantsOnlyInSliceMode(const AZ::EntityId&) override;
         /////////////////////////////////////////////////////////////////////////
 
+        //! Activates the entities in waves by their depth in the transform hierarchy, so parents are active before their children.
+        //! The components of the entities in a wave that support parallel activation are activated on the job system, the others
+        //! on the calling thread.
+        void ActivateEntitiesInParallel(const EntityList& entities);
+
         AzFramework::EntityVisibilityBoundsUnionSystem m_entityVisibilityBoundsUnionSystem;
+        AzFramework::TransformHierarchyUpdateSystem m_transformHierarchyUpdateSystem;
     };
 } // namespace AzFramework
 
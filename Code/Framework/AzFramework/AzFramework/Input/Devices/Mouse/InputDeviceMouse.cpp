@@ -288,9 +288,15 @@ namespace AzFramework
         // value of zero when the mouse stops moving, so queueing one here ensures the channels will
         // always correctly transition into the 'ended' state the next time this function is called,
         // unless another movement delta is queued above in which case it will simply be added to 0.
+        // Idle channels are skipped, they are already at zero and queueing for them would recreate
+        // the event queues that were just removed above, allocating on every frame the mouse is still.
         for (const InputChannelId& movementChannelId : Movement::All)
         {
-            QueueRawMovementEvent(movementChannelId, 0.0f);
+            const auto& channelIt = m_inputDevice.m_movementChannelsById.find(movementChannelId);
+            if (channelIt != m_inputDevice.m_movementChannelsById.end() && channelIt->second && !channelIt->second->IsStateIdle())
+            {
+                QueueRawMovementEvent(movementChannelId, 0.0f);
+            }
         }
 
         // Finally, update the cursor position input channel, treating it as active if it has moved
@@ -94,17 +94,70 @@ namespace AzFramework
             m_logFile->AppendLog(LogFile::SEV_NORMAL, loggingHeaderString);
             m_logFile->AppendLog(LogFile::SEV_NORMAL, loggingHelloWorld);
             m_logFile->AppendLog(LogFile::SEV_NORMAL, loggingFooterString);
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_writerMutex);
+            m_isWriterEnabled = true;
+            AZStd::thread_desc td;
+            td.m_name = "LogComponent Writer Thread";
+            m_writerThread = AZStd::thread(AZStd::bind(&LogComponent::AsyncWritePump, this), &td);
         }
     }
     void LogComponent::DeactivateLogFile()
     {
+        if (m_writerThread.joinable())
+        {
+            m_writerMutex.lock();
+            m_isWriterEnabled = false;
+            m_signal.notify_all();
+            m_writerMutex.unlock();
+            m_writerThread.join();
+        }
+
         if (m_logFile)
         {
+            // Messages queued while the writer thread was stopping
+            WriteQueuedMessages();
             delete m_logFile;
             m_logFile = NULL;
         }
     }
 
+    void LogComponent::AsyncWritePump()
+    {
+        AZStd::unique_lock<AZStd::mutex> signalLock(m_writerMutex);
+        while (true)
+        {
+            if (!m_writeQueue.empty())
+            {
+                signalLock.unlock();
+                WriteQueuedMessages();
+                signalLock.lock();
+                continue;
+            }
+            if (!m_isWriterEnabled)
+            {
+                break;
+            }
+            m_signal.wait(signalLock);
+        }
+    }
+
+    void LogComponent::WriteQueuedMessages()
+    {
+        AZStd::lock_guard<AZStd::recursive_mutex> fileLock(m_writeFileMutex);
+
+        AZStd::vector<QueuedMessage> messages;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_writerMutex);
+            messages.swap(m_writeQueue);
+        }
+
+        for (const QueuedMessage& queuedMessage : messages)
+        {
+            m_logFile->AppendLog(queuedMessage.m_severity, queuedMessage.m_window.c_str(), queuedMessage.m_message.c_str());
+        }
+    }
+
     bool LogComponent::OnPrintf(const char* window, const char* message)
     {
         if (azstrnicmp(window, "debug", 5) == 0)
@@ -152,10 +205,25 @@ namespace AzFramework
 
     void LogComponent::OutputMessage(LogFile::SeverityLevel severity, const char* window, const char* message)
     {
-        if (m_logFile)
+        if (!m_logFile)
         {
-            m_logFile->AppendLog(severity, window, message);
+            return;
         }
+
+        if (severity != LogFile::SEV_ASSERT && severity != LogFile::SEV_EXCEPTION)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_writerMutex);
+            if (m_isWriterEnabled)
+            {
+                m_writeQueue.push_back({ severity, window, message });
+                m_signal.notify_one();
+                return;
+            }
+        }
+
+        AZStd::lock_guard<AZStd::recursive_mutex> fileLock(m_writeFileMutex);
+        WriteQueuedMessages();
+        m_logFile->AppendLog(severity, window, message);
     }
 
     void LogComponent::Reflect(AZ::ReflectContext* context)
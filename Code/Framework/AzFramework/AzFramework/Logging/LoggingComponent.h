@@ -11,6 +11,10 @@
 
 #include <AzCore/Component/Component.h>
 #include <AzCore/Debug/TraceMessageBus.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
 
 #include "LogFile.h"
 
@@ -18,6 +22,8 @@ namespace AzFramework
 {
     //! LogComponent
     //! LogComponent listens to AZ trace messages and forwards them to a log file
+    //! Messages are queued and written by a writer thread, so the threads that trace don't wait on the file.
+    //! Asserts and exceptions are written right away, after the queued messages, as the process may not survive them.
     class LogComponent
         : public AZ::Component
         , private AZ::Debug::TraceMessageBus::Handler
@@ -60,13 +66,31 @@ namespace AzFramework
         /// \ref AZ::ComponentDescriptor::GetIncompatibleServices
         static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible);
 
+        struct QueuedMessage
+        {
+            LogFile::SeverityLevel m_severity;
+            AZStd::string m_window;
+            AZStd::string m_message;
+        };
+
         void ActivateLogFile();
         void DeactivateLogFile();
 
+        void AsyncWritePump();
+        //! Writes every queued message to the log file, from the writer thread or from a thread that writes right away.
+        void WriteQueuedMessages();
+
         bool m_machineReadable = true;
         AZStd::string m_logFileBaseName;
         AZ::u64 m_rolloverLength;
         LogFile* m_logFile;
+
+        AZStd::vector<QueuedMessage> m_writeQueue;
+        AZStd::mutex m_writerMutex; // guards m_writeQueue and m_isWriterEnabled
+        AZStd::recursive_mutex m_writeFileMutex; // keeps the messages in order between the writer thread and direct writes
+        AZStd::condition_variable m_signal;
+        AZStd::thread m_writerThread;
+        bool m_isWriterEnabled = false;
     };
 }
 
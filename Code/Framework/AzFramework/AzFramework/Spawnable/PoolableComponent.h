@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/flat_hash_map.h>
+
+namespace AZ
+{
+    class Component;
+}
+
+namespace AzFramework
+{
+    //! Interface for components that can be reused after their entity was despawned, instead of being destroyed and cloned again.
+    //! Entities can only be returned to the entity pool of their spawnable if all of their components implement this interface.
+    //! Add the interface to the list of bases of the AZ_COMPONENT macro so it can be found through azrtti_cast.
+    class PoolableComponent
+    {
+    public:
+        AZ_RTTI(AzFramework::PoolableComponent, "{3C0D4F7E-6A2B-4E59-9B1F-8D2E5A7C4B10}");
+
+        virtual ~PoolableComponent() = default;
+
+        //! Called while the entity is deactivated, before it's spawned again. Restores the state the component would have had if it
+        //! was freshly cloned from the template component, with the entity references mapped through the given template id to
+        //! instance id map.
+        virtual void ResetForReuse(
+            const AZ::Component& templateComponent, const AZStd::flat_hash_map<AZ::EntityId, AZ::EntityId>& idMap) = 0;
+    };
+} // namespace AzFramework
@@ -180,6 +180,10 @@ namespace AzFramework
         AZ::SerializeContext* m_serializeContext { nullptr };
         //! The priority at which this call will be executed.
         SpawnablePriority m_priority { SpawnablePriority_Default };
+        //! If "true", a batch of entities that was returned to the entity pool of the spawnable by DespawnAllEntities is reset and
+        //!     activated again instead of cloning the entities. The pre-insertion callback is still called for the reused entities.
+        //!     Falls back to cloning if the pool is empty.
+        bool m_reusePooledEntities { false };
     };
 
     struct SpawnEntitiesOptionalArgs final
@@ -210,6 +214,11 @@ namespace AzFramework
         EntityDespawnCallback m_completionCallback;
         //! The priority at which this call will be executed.
         SpawnablePriority m_priority { SpawnablePriority_Default };
+        //! If "true", the entities are deactivated and kept in the entity pool of the spawnable instead of being destroyed, so a later
+        //!     SpawnAllEntities call can reuse them. This only happens if the entities were spawned by a single SpawnAllEntities call,
+        //!     no components were added to them and all their components implement PoolableComponent. Otherwise the entities are
+        //!     destroyed as usual.
+        bool m_returnEntitiesToPool { false };
     };
 
     struct ReloadSpawnableOptionalArgs final
@@ -8,18 +8,47 @@
 
 #include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManagerBus.h>
 #include <AzCore/Serialization/IdUtils.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Settings/SettingsRegistry.h>
 #include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/parallel/shared_mutex.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzFramework/Components/TransformComponent.h>
 #include <AzFramework/Entity/GameEntityContextBus.h>
+#include <AzFramework/Spawnable/PoolableComponent.h>
 #include <AzFramework/Spawnable/Spawnable.h>
 #include <AzFramework/Spawnable/SpawnableEntitiesManager.h>
 
 namespace AzFramework
 {
+    namespace SpawnableEntitiesManagerInternal
+    {
+        //! An entity can be reused for its template if it has the same components and all of them can be reset from the template.
+        //! Components are matched by id, because activating an entity sorts its components by their dependencies.
+        static bool CanReuseEntity(const AZ::Entity& entity, const AZ::Entity& templateEntity)
+        {
+            const AZ::Entity::ComponentArrayType& templateComponents = templateEntity.GetComponents();
+            if (entity.GetComponents().size() != templateComponents.size())
+            {
+                return false;
+            }
+            for (const AZ::Component* templateComponent : templateComponents)
+            {
+                AZ::Component* component = entity.FindComponent(templateComponent->GetId());
+                if (component == nullptr || component->RTTI_GetType() != templateComponent->RTTI_GetType() ||
+                    azrtti_cast<PoolableComponent*>(component) == nullptr)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    } // namespace SpawnableEntitiesManagerInternal
+
     template<typename T>
     void SpawnableEntitiesManager::QueueRequest(EntitySpawnTicket& ticket, SpawnablePriority priority, T&& request)
     {
@@ -43,9 +72,27 @@ namespace AzFramework
             AZ::u64 value = aznumeric_caster(m_highPriorityThreshold);
             settingsRegistry->Get(value, "/O3DE/AzFramework/Spawnables/HighPriorityThreshold");
             m_highPriorityThreshold = aznumeric_cast<SpawnablePriority>(AZStd::clamp(value, 0llu, 255llu));
+
+            AZ::u64 budget = 0;
+            if (settingsRegistry->Get(budget, "/O3DE/AzFramework/Spawnables/HighPriorityTimeBudgetUs"))
+            {
+                m_highPriorityQueue.m_timeBudget = AZStd::chrono::microseconds(budget);
+            }
+            budget = 0;
+            if (settingsRegistry->Get(budget, "/O3DE/AzFramework/Spawnables/RegularPriorityTimeBudgetUs"))
+            {
+                m_regularPriorityQueue.m_timeBudget = AZStd::chrono::microseconds(budget);
+            }
+
+            settingsRegistry->Get(m_maxPooledBatches, "/O3DE/AzFramework/Spawnables/MaxPooledBatches");
         }
     }
 
+    SpawnableEntitiesManager::~SpawnableEntitiesManager()
+    {
+        ClearEntityPools();
+    }
+
     void SpawnableEntitiesManager::SpawnAllEntities(EntitySpawnTicket& ticket, SpawnAllEntitiesOptionalArgs optionalArgs)
     {
         AZ_Assert(ticket.IsValid(), "Ticket provided to SpawnAllEntities hasn't been initialized.");
@@ -56,6 +103,7 @@ namespace AzFramework
             optionalArgs.m_serializeContext == nullptr ? m_defaultSerializeContext : optionalArgs.m_serializeContext;
         queueEntry.m_completionCallback = AZStd::move(optionalArgs.m_completionCallback);
         queueEntry.m_preInsertionCallback = AZStd::move(optionalArgs.m_preInsertionCallback);
+        queueEntry.m_reusePooledEntities = optionalArgs.m_reusePooledEntities;
         QueueRequest(ticket, optionalArgs.m_priority, AZStd::move(queueEntry));
     }
 
@@ -82,6 +130,7 @@ namespace AzFramework
         DespawnAllEntitiesCommand queueEntry;
         queueEntry.m_ticketId = ticket.GetId();
         queueEntry.m_completionCallback = AZStd::move(optionalArgs.m_completionCallback);
+        queueEntry.m_returnEntitiesToPool = optionalArgs.m_returnEntitiesToPool;
         QueueRequest(ticket, optionalArgs.m_priority, AZStd::move(queueEntry));
     }
 
@@ -168,6 +217,9 @@ namespace AzFramework
 
     auto SpawnableEntitiesManager::ProcessQueue(Queue& queue) -> CommandQueueStatus
     {
+        m_processDeadline = queue.m_timeBudget.count() > 0 ? AZStd::chrono::system_clock::now() + queue.m_timeBudget
+                                                           : AZStd::chrono::system_clock::time_point::max();
+
         // Process delayed requests first.
         // Only process the requests that are currently in this queue, not the ones that could be re-added if they still can't complete.
         size_t delayedSize = queue.m_delayed.size();
@@ -243,14 +295,286 @@ namespace AzFramework
         }
     }
 
-    AZ::Entity* SpawnableEntitiesManager::CloneSingleEntity(const AZ::Entity& entityTemplate,
-        EntityIdMap& templateToCloneMap, AZ::SerializeContext& serializeContext)
+    void SpawnableEntitiesManager::CloneEntities(
+        AZStd::vector<AZ::Entity*>& clones, const Spawnable::EntityList& entities, const size_t* indices, size_t indexCount,
+        EntityIdMap& idMap, AZStd::unordered_set<AZ::EntityId>& previouslySpawned, AZ::SerializeContext& serializeContext)
     {
+        AZStd::vector<const AZ::Entity*> entityTemplates;
+        entityTemplates.reserve(indexCount);
+        for (size_t i = 0; i < indexCount; ++i)
+        {
+            entityTemplates.push_back(entities[indices[i]].get());
+        }
+
+        // The clones don't depend on each other, so they're spread across the job system if there is one.
+        AZ::JobContext* jobContext = nullptr;
+        AZ::JobManagerBus::BroadcastResult(jobContext, &AZ::JobManagerEvents::GetGlobalContext);
+
+        const size_t firstClone = clones.size();
+        clones.resize(firstClone + indexCount, nullptr);
+        serializeContext.CloneObjects(entityTemplates.data(), clones.data() + firstClone, indexCount, jobContext);
+
+        // If none of the entities has been spawned before, refreshing the id mappings doesn't change the id map. The id fix ups
+        // then don't depend on the order of the entities, so they're spread across the job system as well.
+        constexpr size_t minEntitiesPerJob = 16;
+        bool fixUpInParallel = jobContext != nullptr && indexCount >= minEntitiesPerJob * 2;
+        if (fixUpInParallel)
+        {
+            AZStd::vector<bool> isInBatch(entities.size(), false);
+            for (size_t i = 0; i < indexCount; ++i)
+            {
+                if (isInBatch[indices[i]] || previouslySpawned.contains(entityTemplates[i]->GetId()))
+                {
+                    fixUpInParallel = false;
+                    break;
+                }
+                isInBatch[indices[i]] = true;
+            }
+        }
+
         // If the same ID gets remapped more than once, preserve the original remapping instead of overwriting it.
         constexpr bool allowDuplicateIds = false;
+        if (!fixUpInParallel)
+        {
+            for (size_t i = 0; i < indexCount; ++i)
+            {
+                // If this entity has previously been spawned, give it a new id in the reference map
+                RefreshEntityIdMapping(entityTemplates[i]->GetId(), idMap, previouslySpawned);
+
+                AZ::Entity* clone = clones[firstClone + i];
+                AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
+                if (clone)
+                {
+                    AZ::IdUtils::Remapper<AZ::EntityId, allowDuplicateIds>::GenerateNewIdsAndFixRefs(clone, idMap, &serializeContext);
+                }
+            }
+            return;
+        }
+
+        for (size_t i = 0; i < indexCount; ++i)
+        {
+            RefreshEntityIdMapping(entityTemplates[i]->GetId(), idMap, previouslySpawned);
+        }
+
+        // Same mapping as GenerateNewIdsAndFixRefs. Ids that are missing from the map are rare, so they're added under an exclusive lock.
+        using Remapper = AZ::IdUtils::Remapper<AZ::EntityId, allowDuplicateIds>;
+        AZStd::shared_mutex idMapMutex;
+        Remapper::IdMapper idMapper =
+            [&idMap, &idMapMutex](const AZ::EntityId& originalId, bool replaceId, const Remapper::IdGenerator& idGenerator) -> AZ::EntityId
+        {
+            if (replaceId && !idGenerator)
+            {
+                return originalId;
+            }
+            {
+                AZStd::shared_lock<AZStd::shared_mutex> lock(idMapMutex);
+                auto it = idMap.find(originalId);
+                if (it != idMap.end())
+                {
+                    return it->second;
+                }
+            }
+            if (replaceId)
+            {
+                AZStd::unique_lock<AZStd::shared_mutex> lock(idMapMutex);
+                return idMap.emplace(originalId, idGenerator()).first->second;
+            }
+            return originalId;
+        };
+
+        auto fixUpRange = [&clones, &idMapper, &serializeContext, firstClone](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                AZ::Entity* clone = clones[firstClone + i];
+                AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
+                if (clone)
+                {
+                    Remapper::ReplaceIdsAndIdRefs(clone, idMapper, &serializeContext);
+                }
+            }
+        };
+
+        const size_t numWorkers = AZStd::max<size_t>(jobContext->GetJobManager().GetNumWorkerThreads(), 1);
+        const size_t entitiesPerJob = AZStd::max(minEntitiesPerJob, (indexCount + numWorkers * 4 - 1) / (numWorkers * 4));
+        AZ::JobCompletion completion(jobContext);
+        for (size_t begin = entitiesPerJob; begin < indexCount; begin += entitiesPerJob)
+        {
+            const size_t end = AZStd::min(begin + entitiesPerJob, indexCount);
+            AZ::Job* job = AZ::CreateJobFunction([&fixUpRange, begin, end]()
+                {
+                    fixUpRange(begin, end);
+                }, true, jobContext);
+            job->SetDependent(&completion);
+            job->Start();
+        }
+        fixUpRange(0, entitiesPerJob);
+        completion.StartAndWaitForCompletion();
+    }
+
+    bool SpawnableEntitiesManager::AddSpawnedEntitiesToGameContext(Ticket& ticket, SpawnProgress& progress)
+    {
+        const size_t entityCount = ticket.m_spawnedEntities.size();
+        while (progress.m_nextEntityToAdd < entityCount)
+        {
+            AZ::Entity* entity = ticket.m_spawnedEntities[progress.m_nextEntityToAdd];
+            if (progress.m_entitiesReusedFromPool)
+            {
+                GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::ActivateGameEntity, entity->GetId());
+            }
+            else
+            {
+                GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::AddGameEntity, entity);
+            }
+            ++progress.m_nextEntityToAdd;
+
+            if (progress.m_nextEntityToAdd < entityCount && IsOverTimeBudget())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool SpawnableEntitiesManager::IsOverTimeBudget() const
+    {
+        return m_processDeadline != AZStd::chrono::system_clock::time_point::max() &&
+            AZStd::chrono::system_clock::now() >= m_processDeadline;
+    }
+
+    bool SpawnableEntitiesManager::ReturnEntitiesToPool(Ticket& ticket)
+    {
+        if (!ticket.m_loadAll || !ticket.m_spawnable.IsReady())
+        {
+            return false;
+        }
+
+        const Spawnable::EntityList& templates = ticket.m_spawnable->GetEntities();
+        const size_t entityCount = ticket.m_spawnedEntities.size();
+        if (entityCount == 0 || entityCount != templates.size())
+        {
+            return false;
+        }
+        for (size_t i = 0; i < entityCount; ++i)
+        {
+            AZ::Entity* entity = ticket.m_spawnedEntities[i];
+            if (entity == nullptr || ticket.m_spawnedEntityIndices[i] != i ||
+                !SpawnableEntitiesManagerInternal::CanReuseEntity(*entity, *templates[i]))
+            {
+                return false;
+            }
+        }
 
-        return AZ::IdUtils::Remapper<AZ::EntityId, allowDuplicateIds>::CloneObjectAndGenerateNewIdsAndFixRefs(
-                &entityTemplate, templateToCloneMap, &serializeContext);
+        {
+            AZStd::scoped_lock lock(m_entityPoolsMutex);
+            EntityPool& pool = m_entityPools[ticket.m_spawnable.GetId()];
+            if (pool.size() >= m_maxPooledBatches)
+            {
+                return false;
+            }
+        }
+
+        AZStd::vector<AZ::EntityId> batch;
+        batch.reserve(entityCount);
+        for (AZ::Entity* entity : ticket.m_spawnedEntities)
+        {
+            GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::DeactivateGameEntity, entity->GetId());
+            batch.push_back(entity->GetId());
+        }
+
+        AZStd::scoped_lock lock(m_entityPoolsMutex);
+        m_entityPools[ticket.m_spawnable.GetId()].push_back(AZStd::move(batch));
+        return true;
+    }
+
+    bool SpawnableEntitiesManager::TakeEntitiesFromPool(Ticket& ticket, AZStd::vector<AZ::Entity*>& entities)
+    {
+        const Spawnable::EntityList& templates = ticket.m_spawnable->GetEntities();
+        AZStd::vector<AZ::Entity*> pooledEntities;
+        while (true)
+        {
+            AZStd::vector<AZ::EntityId> batch;
+            {
+                AZStd::scoped_lock lock(m_entityPoolsMutex);
+                auto poolIt = m_entityPools.find(ticket.m_spawnable.GetId());
+                if (poolIt == m_entityPools.end() || poolIt->second.empty())
+                {
+                    return false;
+                }
+                batch = AZStd::move(poolIt->second.back());
+                poolIt->second.pop_back();
+            }
+
+            // The pooled entities are owned by the game context, so they may have been destroyed in the meantime. The spawnable
+            // may also have been reloaded with different entities.
+            bool canReuse = batch.size() == templates.size();
+            pooledEntities.clear();
+            pooledEntities.reserve(batch.size());
+            for (size_t i = 0; i < batch.size(); ++i)
+            {
+                AZ::Entity* entity = nullptr;
+                AZ::ComponentApplicationBus::BroadcastResult(entity, &AZ::ComponentApplicationBus::Events::FindEntity, batch[i]);
+                canReuse = canReuse && entity != nullptr && SpawnableEntitiesManagerInternal::CanReuseEntity(*entity, *templates[i]);
+                pooledEntities.push_back(entity);
+            }
+
+            if (canReuse)
+            {
+                break;
+            }
+
+            for (AZ::Entity* entity : pooledEntities)
+            {
+                if (entity != nullptr)
+                {
+                    GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::DestroyGameEntity, entity->GetId());
+                }
+            }
+        }
+
+        // The reused entities take the place of the ones that would have been cloned, so map the template ids to them.
+        EntityIdMap& idMap = ticket.m_entityIdReferenceMap;
+        idMap.clear();
+        ticket.m_previouslySpawned.clear();
+        idMap.reserve(templates.size());
+        ticket.m_previouslySpawned.reserve(templates.size());
+        for (size_t i = 0; i < templates.size(); ++i)
+        {
+            idMap.emplace(templates[i]->GetId(), pooledEntities[i]->GetId());
+            ticket.m_previouslySpawned.emplace(templates[i]->GetId());
+        }
+
+        for (size_t i = 0; i < templates.size(); ++i)
+        {
+            for (const AZ::Component* templateComponent : templates[i]->GetComponents())
+            {
+                AZ::Component* component = pooledEntities[i]->FindComponent(templateComponent->GetId());
+                azrtti_cast<PoolableComponent*>(component)->ResetForReuse(*templateComponent, idMap);
+            }
+        }
+
+        entities.insert(entities.end(), pooledEntities.begin(), pooledEntities.end());
+        return true;
+    }
+
+    void SpawnableEntitiesManager::ClearEntityPools()
+    {
+        AZStd::unordered_map<AZ::Data::AssetId, EntityPool> pools;
+        {
+            AZStd::scoped_lock lock(m_entityPoolsMutex);
+            pools.swap(m_entityPools);
+        }
+
+        for (const auto& [spawnableId, pool] : pools)
+        {
+            for (const AZStd::vector<AZ::EntityId>& batch : pool)
+            {
+                for (const AZ::EntityId& entityId : batch)
+                {
+                    GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::DestroyGameEntity, entityId);
+                }
+            }
+        }
     }
 
     void SpawnableEntitiesManager::InitializeEntityIdMappings(
@@ -292,61 +616,77 @@ namespace AzFramework
         Ticket& ticket = *request.m_ticket;
         if (ticket.m_spawnable.IsReady() && request.m_requestId == ticket.m_currentRequestId)
         {
-            AZStd::vector<AZ::Entity*>& spawnedEntities = ticket.m_spawnedEntities;
-            AZStd::vector<size_t>& spawnedEntityIndices = ticket.m_spawnedEntityIndices;
+            if (!request.m_progress.m_entitiesCloned)
+            {
+                // Cloning can't be split up, so wait for a later call if other commands already used up the time budget.
+                if (IsOverTimeBudget())
+                {
+                    return false;
+                }
 
-            // Keep track how many entities there were in the array initially
-            size_t spawnedEntitiesInitialCount = spawnedEntities.size();
+                AZStd::vector<AZ::Entity*>& spawnedEntities = ticket.m_spawnedEntities;
+                AZStd::vector<size_t>& spawnedEntityIndices = ticket.m_spawnedEntityIndices;
 
-            // These are 'template' entities we'll be cloning from
-            const Spawnable::EntityList& entitiesToSpawn = ticket.m_spawnable->GetEntities();
-            size_t entitiesToSpawnSize = entitiesToSpawn.size();
+                // Keep track how many entities there were in the array initially
+                size_t spawnedEntitiesInitialCount = spawnedEntities.size();
 
-            // Reserve buffers
-            spawnedEntities.reserve(spawnedEntities.size() + entitiesToSpawnSize);
-            spawnedEntityIndices.reserve(spawnedEntityIndices.size() + entitiesToSpawnSize);
+                // These are 'template' entities we'll be cloning from
+                const Spawnable::EntityList& entitiesToSpawn = ticket.m_spawnable->GetEntities();
+                size_t entitiesToSpawnSize = entitiesToSpawn.size();
 
-            // Pre-generate the full set of entity id to new entity id mappings, so that during the clone operation below,
-            // any entity references that point to a not-yet-cloned entity will still get their ids remapped correctly.
-            // We clear out and regenerate the set of IDs on every SpawnAllEntities call, because presumably every entity reference
-            // in every entity we're about to instantiate is intended to point to an entity in our newly-instantiated batch, regardless
-            // of spawn order.  If we didn't clear out the map, it would be possible for some entities here to have references to
-            // previously-spawned entities from a previous SpawnEntities or SpawnAllEntities call.
-            InitializeEntityIdMappings(entitiesToSpawn, ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+                // Reserve buffers
+                spawnedEntities.reserve(spawnedEntities.size() + entitiesToSpawnSize);
+                spawnedEntityIndices.reserve(spawnedEntityIndices.size() + entitiesToSpawnSize);
 
-            for (size_t i = 0; i < entitiesToSpawnSize; ++i)
-            {
-                // If this entity has previously been spawned, give it a new id in the reference map
-                RefreshEntityIdMapping(entitiesToSpawn[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+                size_t spawnedEntityIndicesInitialCount = spawnedEntityIndices.size();
+                for (size_t i = 0; i < entitiesToSpawnSize; ++i)
+                {
+                    spawnedEntityIndices.push_back(i);
+                }
 
-                AZ::Entity* clone = CloneSingleEntity(*entitiesToSpawn[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
-                AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
+                request.m_progress.m_entitiesReusedFromPool =
+                    request.m_reusePooledEntities && TakeEntitiesFromPool(ticket, spawnedEntities);
+                if (!request.m_progress.m_entitiesReusedFromPool)
+                {
+                    // Pre-generate the full set of entity id to new entity id mappings, so that during the clone operation below,
+                    // any entity references that point to a not-yet-cloned entity will still get their ids remapped correctly.
+                    // We clear out and regenerate the set of IDs on every SpawnAllEntities call, because presumably every entity
+                    // reference in every entity we're about to instantiate is intended to point to an entity in our newly-instantiated
+                    // batch, regardless of spawn order.  If we didn't clear out the map, it would be possible for some entities here to
+                    // have references to previously-spawned entities from a previous SpawnEntities or SpawnAllEntities call.
+                    InitializeEntityIdMappings(entitiesToSpawn, ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+
+                    CloneEntities(
+                        spawnedEntities, entitiesToSpawn, spawnedEntityIndices.data() + spawnedEntityIndicesInitialCount,
+                        entitiesToSpawnSize, ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned, *request.m_serializeContext);
+                }
 
-                spawnedEntities.emplace_back(clone);
-                spawnedEntityIndices.push_back(i);
-            }
+                // loadAll is true if every entity has been spawned only once
+                ticket.m_loadAll = (spawnedEntities.size() == entitiesToSpawnSize);
 
-            // loadAll is true if every entity has been spawned only once
-            ticket.m_loadAll = (spawnedEntities.size() == entitiesToSpawnSize);
-            
-            // Let other systems know about newly spawned entities for any pre-processing before adding to the scene/game context.
-            if (request.m_preInsertionCallback)
-            {
-                request.m_preInsertionCallback(request.m_ticketId, SpawnableEntityContainerView(
-                        ticket.m_spawnedEntities.begin() + spawnedEntitiesInitialCount, ticket.m_spawnedEntities.end()));
+                // Let other systems know about newly spawned entities for any pre-processing before adding to the scene/game context.
+                if (request.m_preInsertionCallback)
+                {
+                    request.m_preInsertionCallback(request.m_ticketId, SpawnableEntityContainerView(
+                            ticket.m_spawnedEntities.begin() + spawnedEntitiesInitialCount, ticket.m_spawnedEntities.end()));
+                }
+
+                request.m_progress.m_firstSpawnedEntity = spawnedEntitiesInitialCount;
+                request.m_progress.m_nextEntityToAdd = spawnedEntitiesInitialCount;
+                request.m_progress.m_entitiesCloned = true;
             }
 
             // Add to the game context, now the entities are active
-            for (auto it = ticket.m_spawnedEntities.begin() + spawnedEntitiesInitialCount; it != ticket.m_spawnedEntities.end(); ++it)
+            if (!AddSpawnedEntitiesToGameContext(ticket, request.m_progress))
             {
-                GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::AddGameEntity, *it);
+                return false;
             }
 
             // Let other systems know about newly spawned entities for any post-processing after adding to the scene/game context.
             if (request.m_completionCallback)
             {
                 request.m_completionCallback(request.m_ticketId, SpawnableConstEntityContainerView(
-                        ticket.m_spawnedEntities.begin() + spawnedEntitiesInitialCount, ticket.m_spawnedEntities.end()));
+                        ticket.m_spawnedEntities.begin() + request.m_progress.m_firstSpawnedEntity, ticket.m_spawnedEntities.end()));
             }
 
             ticket.m_currentRequestId++;
@@ -363,70 +703,79 @@ namespace AzFramework
         Ticket& ticket = *request.m_ticket;
         if (ticket.m_spawnable.IsReady() && request.m_requestId == ticket.m_currentRequestId)
         {
-            AZStd::vector<AZ::Entity*>& spawnedEntities = ticket.m_spawnedEntities;
-            AZStd::vector<size_t>& spawnedEntityIndices = ticket.m_spawnedEntityIndices;
-            AZ_Assert(
-                spawnedEntities.size() == spawnedEntityIndices.size(),
-                "The indices for the spawned entities has gone out of sync with the entities.");
-
-            // Keep track of how many entities there were in the array initially
-            size_t spawnedEntitiesInitialCount = spawnedEntities.size();
+            if (!request.m_progress.m_entitiesCloned)
+            {
+                // Cloning can't be split up, so wait for a later call if other commands already used up the time budget.
+                if (IsOverTimeBudget())
+                {
+                    return false;
+                }
 
-            // These are 'template' entities we'll be cloning from
-            const Spawnable::EntityList& entitiesToSpawn = ticket.m_spawnable->GetEntities();
-            size_t entitiesToSpawnSize = request.m_entityIndices.size();
+                AZStd::vector<AZ::Entity*>& spawnedEntities = ticket.m_spawnedEntities;
+                AZStd::vector<size_t>& spawnedEntityIndices = ticket.m_spawnedEntityIndices;
+                AZ_Assert(
+                    spawnedEntities.size() == spawnedEntityIndices.size(),
+                    "The indices for the spawned entities has gone out of sync with the entities.");
 
-            if (ticket.m_entityIdReferenceMap.empty() || !request.m_referencePreviouslySpawnedEntities)
-            {
-                // This map keeps track of ids from template (spawnable) to clone (instance) allowing patch ups of fields referring
-                // to entityIds outside of a given entity.
-                // We pre-generate the full set of entity id to new entity id mappings, so that during the clone operation below,
-                // any entity references that point to a not-yet-cloned entity will still get their ids remapped correctly.
-                // By default, we only initialize this map once because it needs to persist across multiple SpawnEntities calls, so
-                // that reference fixups work even when the entity being referenced is spawned in a different SpawnEntities
-                // (or SpawnAllEntities) call.
-                // However, the caller can also choose to reset the map by passing in "m_referencePreviouslySpawnedEntities = false".
-                InitializeEntityIdMappings(entitiesToSpawn, ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
-            }
+                // Keep track of how many entities there were in the array initially
+                size_t spawnedEntitiesInitialCount = spawnedEntities.size();
 
-            spawnedEntities.reserve(spawnedEntities.size() + entitiesToSpawnSize);
-            spawnedEntityIndices.reserve(spawnedEntityIndices.size() + entitiesToSpawnSize);
+                // These are 'template' entities we'll be cloning from
+                const Spawnable::EntityList& entitiesToSpawn = ticket.m_spawnable->GetEntities();
+                size_t entitiesToSpawnSize = request.m_entityIndices.size();
 
-            for (size_t index : request.m_entityIndices)
-            {
-                if (index < entitiesToSpawn.size())
+                if (ticket.m_entityIdReferenceMap.empty() || !request.m_referencePreviouslySpawnedEntities)
                 {
-                    // If this entity has previously been spawned, give it a new id in the reference map
-                    RefreshEntityIdMapping(
-                        entitiesToSpawn[index].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+                    // This map keeps track of ids from template (spawnable) to clone (instance) allowing patch ups of fields referring
+                    // to entityIds outside of a given entity.
+                    // We pre-generate the full set of entity id to new entity id mappings, so that during the clone operation below,
+                    // any entity references that point to a not-yet-cloned entity will still get their ids remapped correctly.
+                    // By default, we only initialize this map once because it needs to persist across multiple SpawnEntities calls, so
+                    // that reference fixups work even when the entity being referenced is spawned in a different SpawnEntities
+                    // (or SpawnAllEntities) call.
+                    // However, the caller can also choose to reset the map by passing in "m_referencePreviouslySpawnedEntities = false".
+                    InitializeEntityIdMappings(entitiesToSpawn, ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
+                }
 
-                    AZ::Entity* clone =
-                        CloneSingleEntity(*entitiesToSpawn[index], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
-                    AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
+                spawnedEntities.reserve(spawnedEntities.size() + entitiesToSpawnSize);
+                spawnedEntityIndices.reserve(spawnedEntityIndices.size() + entitiesToSpawnSize);
 
-                    spawnedEntities.push_back(clone);
-                    spawnedEntityIndices.push_back(index);
+                size_t spawnedEntityIndicesInitialCount = spawnedEntityIndices.size();
+                for (size_t index : request.m_entityIndices)
+                {
+                    if (index < entitiesToSpawn.size())
+                    {
+                        spawnedEntityIndices.push_back(index);
+                    }
+                }
+                CloneEntities(
+                    spawnedEntities, entitiesToSpawn, spawnedEntityIndices.data() + spawnedEntityIndicesInitialCount,
+                    spawnedEntityIndices.size() - spawnedEntityIndicesInitialCount, ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned,
+                    *request.m_serializeContext);
+                ticket.m_loadAll = false;
+
+                // Let other systems know about newly spawned entities for any pre-processing before adding to the scene/game context.
+                if (request.m_preInsertionCallback)
+                {
+                    request.m_preInsertionCallback(request.m_ticketId, SpawnableEntityContainerView(
+                            ticket.m_spawnedEntities.begin() + spawnedEntitiesInitialCount, ticket.m_spawnedEntities.end()));
                 }
-            }
-            ticket.m_loadAll = false;
 
-            // Let other systems know about newly spawned entities for any pre-processing before adding to the scene/game context.
-            if (request.m_preInsertionCallback)
-            {
-                request.m_preInsertionCallback(request.m_ticketId, SpawnableEntityContainerView(
-                        ticket.m_spawnedEntities.begin() + spawnedEntitiesInitialCount, ticket.m_spawnedEntities.end()));
+                request.m_progress.m_firstSpawnedEntity = spawnedEntitiesInitialCount;
+                request.m_progress.m_nextEntityToAdd = spawnedEntitiesInitialCount;
+                request.m_progress.m_entitiesCloned = true;
             }
 
             // Add to the game context, now the entities are active
-            for (auto it = ticket.m_spawnedEntities.begin() + spawnedEntitiesInitialCount; it != ticket.m_spawnedEntities.end(); ++it)
+            if (!AddSpawnedEntitiesToGameContext(ticket, request.m_progress))
             {
-                GameEntityContextRequestBus::Broadcast(&GameEntityContextRequestBus::Events::AddGameEntity, *it);
+                return false;
             }
 
             if (request.m_completionCallback)
             {
                 request.m_completionCallback(request.m_ticketId, SpawnableConstEntityContainerView(
-                    ticket.m_spawnedEntities.begin() + spawnedEntitiesInitialCount, ticket.m_spawnedEntities.end()));
+                    ticket.m_spawnedEntities.begin() + request.m_progress.m_firstSpawnedEntity, ticket.m_spawnedEntities.end()));
             }
 
             ticket.m_currentRequestId++;
@@ -443,12 +792,15 @@ namespace AzFramework
         Ticket& ticket = *request.m_ticket;
         if (request.m_requestId == ticket.m_currentRequestId)
         {
-            for (AZ::Entity* entity : ticket.m_spawnedEntities)
+            if (!request.m_returnEntitiesToPool || !ReturnEntitiesToPool(ticket))
             {
-                if (entity != nullptr)
+                for (AZ::Entity* entity : ticket.m_spawnedEntities)
                 {
-                    GameEntityContextRequestBus::Broadcast(
-                        &GameEntityContextRequestBus::Events::DestroyGameEntityAndDescendants, entity->GetId());
+                    if (entity != nullptr)
+                    {
+                        GameEntityContextRequestBus::Broadcast(
+                            &GameEntityContextRequestBus::Events::DestroyGameEntityAndDescendants, entity->GetId());
+                    }
                 }
             }
 
@@ -506,20 +858,18 @@ namespace AzFramework
 
                 for (size_t i = 0; i < entitiesToSpawnSize; ++i)
                 {
-                    // If this entity has previously been spawned, give it a new id in the reference map
-                    RefreshEntityIdMapping(entities[i].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
-
-                    AZ::Entity* clone = CloneSingleEntity(*entities[i], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
-                    AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
-
-                    ticket.m_spawnedEntities.push_back(clone);
                     ticket.m_spawnedEntityIndices.push_back(i);
                 }
+                CloneEntities(
+                    ticket.m_spawnedEntities, entities, ticket.m_spawnedEntityIndices.data(), entitiesToSpawnSize,
+                    ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned, *request.m_serializeContext);
             }
             else
             {
                 size_t entitiesSize = entities.size();
 
+                AZStd::vector<size_t> indicesToSpawn;
+                indicesToSpawn.reserve(ticket.m_spawnedEntityIndices.size());
                 for (size_t index : ticket.m_spawnedEntityIndices)
                 {
                     // It's possible for the new spawnable to have a different number of entities, so guard against this.
@@ -527,14 +877,12 @@ namespace AzFramework
                     // detected and will result in the incorrect entities being spawned.
                     if (index < entitiesSize)
                     {
-                        // If this entity has previously been spawned, give it a new id in the reference map
-                        RefreshEntityIdMapping(entities[index].get()->GetId(), ticket.m_entityIdReferenceMap, ticket.m_previouslySpawned);
-
-                        AZ::Entity* clone = CloneSingleEntity(*entities[index], ticket.m_entityIdReferenceMap, *request.m_serializeContext);
-                        AZ_Assert(clone != nullptr, "Failed to clone spawnable entity.");
-                        ticket.m_spawnedEntities.push_back(clone);
+                        indicesToSpawn.push_back(index);
                     }
                 }
+                CloneEntities(
+                    ticket.m_spawnedEntities, entities, indicesToSpawn.data(), indicesToSpawn.size(), ticket.m_entityIdReferenceMap,
+                    ticket.m_previouslySpawned, *request.m_serializeContext);
             }
             ticket.m_spawnable = AZStd::move(request.m_spawnable);
 
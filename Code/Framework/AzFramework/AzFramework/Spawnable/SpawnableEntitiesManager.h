@@ -9,9 +9,11 @@
 #pragma once
 
 #include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/std/chrono/clocks.h>
 #include <AzCore/std/limits.h>
 #include <AzCore/std/containers/queue.h>
 #include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/flat_hash_map.h>
 #include <AzCore/std/containers/variant.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/parallel/mutex.h>
@@ -32,7 +34,7 @@ namespace AzFramework
         AZ_RTTI(AzFramework::SpawnableEntitiesManager, "{6E14333F-128C-464C-94CA-A63B05A5E51C}");
         AZ_CLASS_ALLOCATOR(SpawnableEntitiesManager, AZ::SystemAllocator, 0);
 
-        using EntityIdMap = AZStd::unordered_map<AZ::EntityId, AZ::EntityId>;
+        using EntityIdMap = AZStd::flat_hash_map<AZ::EntityId, AZ::EntityId>;
         
         enum class CommandQueueStatus : bool
         {
@@ -47,7 +49,7 @@ namespace AzFramework
         };
 
         SpawnableEntitiesManager();
-        ~SpawnableEntitiesManager() override = default;
+        ~SpawnableEntitiesManager() override;
 
         //
         // The following functions are thread safe
@@ -105,6 +107,15 @@ namespace AzFramework
             bool m_loadAll{ true };
         };
 
+        //! Progress of a spawn command that ran out of time budget while adding its entities to the game context.
+        struct SpawnProgress
+        {
+            size_t m_firstSpawnedEntity{ 0 }; //!< Index in Ticket::m_spawnedEntities of the first entity spawned by the command.
+            size_t m_nextEntityToAdd{ 0 }; //!< Index in Ticket::m_spawnedEntities of the next entity to add to the game context.
+            bool m_entitiesCloned{ false };
+            bool m_entitiesReusedFromPool{ false }; //!< Pooled entities are already in the game context and only need to be activated.
+        };
+
         struct SpawnAllEntitiesCommand
         {
             EntitySpawnCallback m_completionCallback;
@@ -113,6 +124,8 @@ namespace AzFramework
             Ticket* m_ticket;
             EntitySpawnTicket::Id m_ticketId;
             uint32_t m_requestId;
+            SpawnProgress m_progress;
+            bool m_reusePooledEntities;
         };
         struct SpawnEntitiesCommand
         {
@@ -124,6 +137,7 @@ namespace AzFramework
             EntitySpawnTicket::Id m_ticketId;
             uint32_t m_requestId;
             bool m_referencePreviouslySpawnedEntities;
+            SpawnProgress m_progress;
         };
         struct DespawnAllEntitiesCommand
         {
@@ -131,6 +145,7 @@ namespace AzFramework
             Ticket* m_ticket;
             EntitySpawnTicket::Id m_ticketId;
             uint32_t m_requestId;
+            bool m_returnEntitiesToPool;
         };
         struct ReloadSpawnableCommand
         {
@@ -184,6 +199,9 @@ namespace AzFramework
             AZStd::deque<Requests> m_delayed; //!< Requests that were processed before, but couldn't be completed.
             AZStd::queue<Requests> m_pendingRequest; //!< Requests waiting to be processed for the first time.
             AZStd::mutex m_pendingRequestMutex;
+            //! Time per call to ProcessQueue after which spawn commands continue adding their entities during a later call.
+            //! Zero for no limit.
+            AZStd::chrono::microseconds m_timeBudget{ 0 };
         };
 
         template<typename T>
@@ -193,8 +211,26 @@ namespace AzFramework
 
         CommandQueueStatus ProcessQueue(Queue& queue);
 
-        AZ::Entity* CloneSingleEntity(
-            const AZ::Entity& entityTemplate, EntityIdMap& templateToCloneMap, AZ::SerializeContext& serializeContext);
+        //! Clones the template entities at the given indices, appends the clones and fixes up their entity ids.
+        //! The entities are cloned in parallel on the job system. Their ids are fixed up afterwards, in the order of the
+        //! indices, because that updates the shared id map.
+        void CloneEntities(
+            AZStd::vector<AZ::Entity*>& clones, const Spawnable::EntityList& entities, const size_t* indices, size_t indexCount,
+            EntityIdMap& idMap, AZStd::unordered_set<AZ::EntityId>& previouslySpawned, AZ::SerializeContext& serializeContext);
+
+        //! Adds the entities of a spawn command to the game context, until the time budget of the queue being processed runs out.
+        //! At least one entity is added per call, so that commands always make progress. Returns true once all entities are added.
+        bool AddSpawnedEntitiesToGameContext(Ticket& ticket, SpawnProgress& progress);
+        bool IsOverTimeBudget() const;
+
+        //! Deactivates the spawned entities of the ticket and stores them in the entity pool of its spawnable. Returns false if the
+        //! entities can't be reused, because they weren't spawned by a single SpawnAllEntities call or have components that don't
+        //! implement PoolableComponent, in which case they still need to be destroyed.
+        bool ReturnEntitiesToPool(Ticket& ticket);
+        //! Takes a batch of entities from the entity pool of the ticket's spawnable, resets their components from the template entities
+        //! and updates the entity id mappings of the ticket. Returns false if there's no usable batch in the pool.
+        bool TakeEntitiesFromPool(Ticket& ticket, AZStd::vector<AZ::Entity*>& entities);
+        void ClearEntityPools();
         
         bool ProcessRequest(SpawnAllEntitiesCommand& request);
         bool ProcessRequest(SpawnEntitiesCommand& request);
@@ -218,12 +254,26 @@ namespace AzFramework
         Queue m_highPriorityQueue;
         Queue m_regularPriorityQueue;
 
+        //! Batches of deactivated entities that can be reused by SpawnAllEntities, stored per spawnable. The entities are stored by id,
+        //! because they remain owned by the game context, which can destroy them at any time.
+        using EntityPool = AZStd::vector<AZStd::vector<AZ::EntityId>>;
+        AZStd::unordered_map<AZ::Data::AssetId, EntityPool> m_entityPools;
+        AZStd::mutex m_entityPoolsMutex;
+        //! The maximum number of batches stored per spawnable. Can be configured through the Settings Registry under the key
+        //! "/O3DE/AzFramework/Spawnables/MaxPooledBatches".
+        AZ::u64 m_maxPooledBatches{ 16 };
+
+        //! The time at which the queue that's currently being processed runs out of its time budget.
+        AZStd::chrono::system_clock::time_point m_processDeadline{ AZStd::chrono::system_clock::time_point::max() };
+
         AZ::SerializeContext* m_defaultSerializeContext { nullptr };
         //! The threshold used to determine if a request goes in the regular (if bigger than the value) or high priority queue (if smaller
         //! or equal to this value). The starting value of 64 is chosen as it's between default values SpawnablePriority_High and
         //! SpawnablePriority_Default which gives users a bit of room to fine tune the priorities as this value can be configured
         //! through the Settings Registry under the key "/O3DE/AzFramework/Spawnables/HighPriorityThreshold".
         SpawnablePriority m_highPriorityThreshold { 64 };
+        //! The time budgets of the queues can be configured through the Settings Registry under the keys
+        //! "/O3DE/AzFramework/Spawnables/HighPriorityTimeBudgetUs" and "/O3DE/AzFramework/Spawnables/RegularPriorityTimeBudgetUs".
     };
 
     AZ_DEFINE_ENUM_BITWISE_OPERATORS(AzFramework::SpawnableEntitiesManager::CommandQueuePriority);
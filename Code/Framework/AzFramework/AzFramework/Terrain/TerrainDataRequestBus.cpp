@@ -57,5 +57,65 @@ namespace AzFramework
 
         }
 
+        void TerrainDataRequests::ProcessHeightsFromList(
+            const AZStd::vector<AZ::Vector3>& inPositions, HeightCallback perPositionCallback, Sampler sampleFilter) const
+        {
+            for (const AZ::Vector3& position : inPositions)
+            {
+                bool terrainExists = false;
+                const float height = GetHeight(position, sampleFilter, &terrainExists);
+                perPositionCallback(AZ::Vector3(position.GetX(), position.GetY(), height), terrainExists);
+            }
+        }
+
+        void TerrainDataRequests::ProcessNormalsFromList(
+            const AZStd::vector<AZ::Vector3>& inPositions, NormalCallback perPositionCallback, Sampler sampleFilter) const
+        {
+            for (const AZ::Vector3& position : inPositions)
+            {
+                bool terrainExists = false;
+                const AZ::Vector3 normal = GetNormal(position, sampleFilter, &terrainExists);
+                perPositionCallback(position, normal, terrainExists);
+            }
+        }
+
+        void TerrainDataRequests::ProcessMaxSurfaceWeightsFromList(
+            const AZStd::vector<AZ::Vector3>& inPositions, SurfaceWeightCallback perPositionCallback, Sampler sampleFilter) const
+        {
+            for (const AZ::Vector3& position : inPositions)
+            {
+                bool terrainExists = false;
+                const SurfaceData::SurfaceTagWeight surfaceWeight = GetMaxSurfaceWeight(position, sampleFilter, &terrainExists);
+                perPositionCallback(position, surfaceWeight, terrainExists);
+            }
+        }
+
+        void TerrainDataRequests::ProcessHeightsFromRegion(
+            const AZ::Aabb& inRegion, const AZ::Vector2& stepSize, HeightCallback perPositionCallback, Sampler sampleFilter) const
+        {
+            if (!inRegion.IsValid() || stepSize.GetX() <= 0.0f || stepSize.GetY() <= 0.0f)
+            {
+                return;
+            }
+
+            // Count the steps instead of accumulating the position, so the grid doesn't drift on large regions.
+            const AZ::Vector3 regionMin = inRegion.GetMin();
+            const AZ::Vector3 regionExtents = inRegion.GetExtents();
+            const size_t numSamplesX = static_cast<size_t>(regionExtents.GetX() / stepSize.GetX()) + 1;
+            const size_t numSamplesY = static_cast<size_t>(regionExtents.GetY() / stepSize.GetY()) + 1;
+
+            for (size_t y = 0; y < numSamplesY; ++y)
+            {
+                const float positionY = regionMin.GetY() + (static_cast<float>(y) * stepSize.GetY());
+                for (size_t x = 0; x < numSamplesX; ++x)
+                {
+                    const float positionX = regionMin.GetX() + (static_cast<float>(x) * stepSize.GetX());
+                    bool terrainExists = false;
+                    const float height = GetHeightFromFloats(positionX, positionY, sampleFilter, &terrainExists);
+                    perPositionCallback(AZ::Vector3(positionX, positionY, height), terrainExists);
+                }
+            }
+        }
+
     } //namespace Terrain
 } // namespace AzFramework
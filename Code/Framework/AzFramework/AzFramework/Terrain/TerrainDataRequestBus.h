@@ -12,6 +12,8 @@
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/Math/Aabb.h>
 #include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
 
 namespace AzFramework
 {
@@ -88,6 +90,23 @@ namespace AzFramework
             //!                  otherwise *terrainExistsPtr will be set to true.
             virtual AZ::Vector3 GetNormal(AZ::Vector3 position, Sampler sampleFilter = Sampler::BILINEAR, bool* terrainExistsPtr = nullptr) const = 0;
             virtual AZ::Vector3 GetNormalFromFloats(float x, float y, Sampler sampleFilter = Sampler::BILINEAR, bool* terrainExistsPtr = nullptr) const = 0;
+
+            //! Callbacks for the batch queries, called once for every queried position in order.
+            //! The position passed to the height callback has its z set to the terrain height.
+            using HeightCallback = AZStd::function<void(const AZ::Vector3& position, bool terrainExists)>;
+            using NormalCallback = AZStd::function<void(const AZ::Vector3& position, const AZ::Vector3& normal, bool terrainExists)>;
+            using SurfaceWeightCallback = AZStd::function<void(const AZ::Vector3& position, const SurfaceData::SurfaceTagWeight& surfaceWeight, bool terrainExists)>;
+
+            //! Batch versions of GetHeight, GetNormal and GetMaxSurfaceWeight. A single request answers the whole list, so callers
+            //! don't pay for a bus dispatch per position, and implementations can share their lookups between the positions.
+            //! The default implementations query the positions one at a time.
+            virtual void ProcessHeightsFromList(const AZStd::vector<AZ::Vector3>& inPositions, HeightCallback perPositionCallback, Sampler sampleFilter = Sampler::BILINEAR) const;
+            virtual void ProcessNormalsFromList(const AZStd::vector<AZ::Vector3>& inPositions, NormalCallback perPositionCallback, Sampler sampleFilter = Sampler::BILINEAR) const;
+            virtual void ProcessMaxSurfaceWeightsFromList(const AZStd::vector<AZ::Vector3>& inPositions, SurfaceWeightCallback perPositionCallback, Sampler sampleFilter = Sampler::BILINEAR) const;
+
+            //! Query the heights on a grid covering the XY extents of inRegion, starting at its min corner and moving by stepSize.
+            //! The positions are enumerated row by row, with x changing fastest.
+            virtual void ProcessHeightsFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2& stepSize, HeightCallback perPositionCallback, Sampler sampleFilter = Sampler::BILINEAR) const;
         };
         using TerrainDataRequestBus = AZ::EBus<TerrainDataRequests>;
 
@@ -18,6 +18,7 @@
 #include <AzCore/Name/Name.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/function/function_ref.h>
 
 namespace AzFramework
 {
@@ -58,7 +59,8 @@ namespace AzFramework
             const AZ::Aabb m_bounds;
             const AZStd::vector<VisibilityEntry*>& m_entries;
         };
-        using EnumerateCallback = AZStd::function<void(const NodeData&)>;
+        //! Enumeration invokes the callback synchronously, so it is only referenced rather than copied into an AZStd::function.
+        using EnumerateCallback = AZStd::function_ref<void(const NodeData&)>;
 
         //! Get the unique scene name, used to look up the scene in the IVisibilitySystem. Duplicate names will assert on creation.
         virtual const AZ::Name& GetName() const = 0;
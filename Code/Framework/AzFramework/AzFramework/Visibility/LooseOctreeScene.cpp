@@ -0,0 +1,557 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzFramework/Visibility/LooseOctreeScene.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/std/containers/fixed_vector.h>
+
+namespace AzFramework
+{
+    AZ_CVAR_EXTERNED(float, bg_octreeMaxWorldExtents);
+    AZ_CVAR_EXTERNED(uint32_t, bg_octreeNodeMaxEntries);
+    AZ_CVAR_EXTERNED(uint32_t, bg_octreeNodeMinEntries);
+
+
+    static float GetHalfSize(const AZ::Aabb& bounds)
+    {
+        return bounds.GetExtents().GetMaxElement() * 0.5f;
+    }
+
+
+    //! Returns the offset of the child of the node whose cell contains the point.
+    static uint32_t GetChildOffset(const LooseOctreeNode& node, const AZ::Vector3& point)
+    {
+        return (point.GetX() >= node.m_center.GetX() ? 0x01 : 0)
+            | (point.GetY() >= node.m_center.GetY() ? 0x02 : 0)
+            | (point.GetZ() >= node.m_center.GetZ() ? 0x04 : 0);
+    }
+
+
+    static void PushBounds(LooseOctreeNode::EntryBounds& entryBounds, const AZ::Aabb& bounds)
+    {
+        entryBounds.m_minX.push_back(bounds.GetMin().GetX());
+        entryBounds.m_minY.push_back(bounds.GetMin().GetY());
+        entryBounds.m_minZ.push_back(bounds.GetMin().GetZ());
+        entryBounds.m_maxX.push_back(bounds.GetMax().GetX());
+        entryBounds.m_maxY.push_back(bounds.GetMax().GetY());
+        entryBounds.m_maxZ.push_back(bounds.GetMax().GetZ());
+    }
+
+
+    static void SetBounds(LooseOctreeNode::EntryBounds& entryBounds, uint32_t index, const AZ::Aabb& bounds)
+    {
+        entryBounds.m_minX[index] = bounds.GetMin().GetX();
+        entryBounds.m_minY[index] = bounds.GetMin().GetY();
+        entryBounds.m_minZ[index] = bounds.GetMin().GetZ();
+        entryBounds.m_maxX[index] = bounds.GetMax().GetX();
+        entryBounds.m_maxY[index] = bounds.GetMax().GetY();
+        entryBounds.m_maxZ[index] = bounds.GetMax().GetZ();
+    }
+
+
+    static AZ::Aabb GetBounds(const LooseOctreeNode::EntryBounds& entryBounds, uint32_t index)
+    {
+        return AZ::Aabb::CreateFromMinMax(
+            AZ::Vector3(entryBounds.m_minX[index], entryBounds.m_minY[index], entryBounds.m_minZ[index]),
+            AZ::Vector3(entryBounds.m_maxX[index], entryBounds.m_maxY[index], entryBounds.m_maxZ[index]));
+    }
+
+
+    static void SwapAndPopBounds(LooseOctreeNode::EntryBounds& entryBounds, uint32_t index)
+    {
+        for (AZStd::vector<float>* values : { &entryBounds.m_minX, &entryBounds.m_minY, &entryBounds.m_minZ,
+                                              &entryBounds.m_maxX, &entryBounds.m_maxY, &entryBounds.m_maxZ })
+        {
+            (*values)[index] = values->back();
+            values->pop_back();
+        }
+    }
+
+
+    static void ClearBounds(LooseOctreeNode::EntryBounds& entryBounds)
+    {
+        for (AZStd::vector<float>* values : { &entryBounds.m_minX, &entryBounds.m_minY, &entryBounds.m_minZ,
+                                              &entryBounds.m_maxX, &entryBounds.m_maxY, &entryBounds.m_maxZ })
+        {
+            values->clear();
+        }
+    }
+
+
+    //! Returns the union of all the bounds, each component is reduced over a contiguous array.
+    static AZ::Aabb ComputeBounds(const LooseOctreeNode::EntryBounds& entryBounds)
+    {
+        const size_t count = entryBounds.m_minX.size();
+        if (count == 0)
+        {
+            return AZ::Aabb::CreateNull();
+        }
+
+        float minX = entryBounds.m_minX[0];
+        float minY = entryBounds.m_minY[0];
+        float minZ = entryBounds.m_minZ[0];
+        float maxX = entryBounds.m_maxX[0];
+        float maxY = entryBounds.m_maxY[0];
+        float maxZ = entryBounds.m_maxZ[0];
+        for (size_t index = 1; index < count; ++index)
+        {
+            minX = AZStd::min(minX, entryBounds.m_minX[index]);
+            minY = AZStd::min(minY, entryBounds.m_minY[index]);
+            minZ = AZStd::min(minZ, entryBounds.m_minZ[index]);
+            maxX = AZStd::max(maxX, entryBounds.m_maxX[index]);
+            maxY = AZStd::max(maxY, entryBounds.m_maxY[index]);
+            maxZ = AZStd::max(maxZ, entryBounds.m_maxZ[index]);
+        }
+        return AZ::Aabb::CreateFromMinMax(AZ::Vector3(minX, minY, minZ), AZ::Vector3(maxX, maxY, maxZ));
+    }
+
+
+    LooseOctreeScene::LooseOctreeScene(const AZ::Name& sceneName)
+        : m_sceneName(sceneName)
+    {
+        AZ_Assert(!sceneName.IsEmpty(), "sceneName must be a valid string");
+
+        m_nodes.emplace_back();
+        LooseOctreeNode& root = m_nodes.back();
+        root.m_nodeIndex = RootNodeIndex;
+        root.m_halfSize = bg_octreeMaxWorldExtents;
+    }
+
+
+    const AZ::Name& LooseOctreeScene::GetName() const
+    {
+        return m_sceneName;
+    }
+
+
+    void LooseOctreeScene::InsertOrUpdateEntry(VisibilityEntry& entry)
+    {
+        AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        if (entry.m_internalNode == nullptr)
+        {
+            Insert(RootNodeIndex, &entry);
+            ++m_entryCount;
+            return;
+        }
+
+        LooseOctreeNode& node = *static_cast<LooseOctreeNode*>(entry.m_internalNode);
+        const AZ::Aabb& boundingVolume = entry.m_boundingVolume;
+        const AZ::Vector3 center = boundingVolume.GetCenter();
+        const float halfSize = GetHalfSize(boundingVolume);
+
+        // Refit the entry in place if it still belongs to its node, and it didn't shrink enough to belong to a child.
+        // The content bounds only grow here, they are recomputed when entries leave the node.
+        if (Fits(node, center, halfSize) &&
+            (node.m_firstChildIndex == LooseOctreeNode::InvalidNodeIndex ||
+             !Fits(m_nodes[node.m_firstChildIndex + GetChildOffset(node, center)], center, halfSize)))
+        {
+            SetBounds(node.m_entryBounds, entry.m_internalNodeIndex, boundingVolume);
+            GrowContentBounds(node.m_nodeIndex, boundingVolume);
+            return;
+        }
+
+        // Traverse up the ancestor nodes to find the first node that fits the entry, the root node fits any entry
+        const uint32_t previousNodeIndex = node.m_nodeIndex;
+        uint32_t insertNodeIndex = previousNodeIndex;
+        while (!Fits(m_nodes[insertNodeIndex], center, halfSize))
+        {
+            insertNodeIndex = m_nodes[insertNodeIndex].m_parentIndex;
+        }
+
+        RemoveFromNode(&entry);
+        Insert(insertNodeIndex, &entry);
+        TryMerge(previousNodeIndex);
+    }
+
+
+    void LooseOctreeScene::RemoveEntry(VisibilityEntry& entry)
+    {
+        AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        if (entry.m_internalNode)
+        {
+            const uint32_t nodeIndex = static_cast<LooseOctreeNode*>(entry.m_internalNode)->m_nodeIndex;
+            RemoveFromNode(&entry);
+            TryMerge(nodeIndex);
+            --m_entryCount;
+        }
+    }
+
+
+    void LooseOctreeScene::Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        EnumerateHelper(aabb, callback);
+    }
+
+
+    void LooseOctreeScene::Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        EnumerateHelper(sphere, callback);
+    }
+
+
+    void LooseOctreeScene::Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        EnumerateHelper(frustum, callback);
+    }
+
+
+    void LooseOctreeScene::EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+
+        // Released nodes don't have any entries, so walking the node storage in order visits every entry once
+        for (const LooseOctreeNode& node : m_nodes)
+        {
+            if (!node.m_entries.empty())
+            {
+                callback({node.m_contentBounds, node.m_entries});
+            }
+        }
+    }
+
+
+    uint32_t LooseOctreeScene::GetEntryCount() const
+    {
+        return m_entryCount;
+    }
+
+
+    uint32_t LooseOctreeScene::GetNodeCount() const
+    {
+        return m_nodeCount;
+    }
+
+
+    uint32_t LooseOctreeScene::GetFreeNodeCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_freeChildNodes.size() * ChildNodeCount);
+    }
+
+
+    uint32_t LooseOctreeScene::GetChildNodeCount() const
+    {
+        return ChildNodeCount;
+    }
+
+
+    void LooseOctreeScene::DumpStats()
+    {
+        AZ_TracePrintf("Console", "LooseOctreeScene[\"%s\"]::EntryCount = %u", GetName().GetCStr(), GetEntryCount());
+        AZ_TracePrintf("Console", "LooseOctreeScene[\"%s\"]::NodeCount = %u", GetName().GetCStr(), GetNodeCount());
+        AZ_TracePrintf("Console", "LooseOctreeScene[\"%s\"]::FreeNodeCount = %u", GetName().GetCStr(), GetFreeNodeCount());
+        AZ_TracePrintf("Console", "LooseOctreeScene[\"%s\"]::ChildNodeCount = %u", GetName().GetCStr(), GetChildNodeCount());
+    }
+
+
+    bool LooseOctreeScene::Fits(const LooseOctreeNode& node, const AZ::Vector3& center, float halfSize) const
+    {
+        // The root node takes any entry, including the ones that are larger than the world or outside of it
+        if (node.m_nodeIndex == RootNodeIndex)
+        {
+            return true;
+        }
+        return halfSize <= node.m_halfSize && (center - node.m_center).GetAbs().IsLessEqualThan(AZ::Vector3(node.m_halfSize));
+    }
+
+
+    void LooseOctreeScene::Insert(uint32_t startNodeIndex, VisibilityEntry* entry)
+    {
+        AZ_Assert(entry->m_internalNode == nullptr, "Double-insertion: Insert invoked for an entry already bound to the LooseOctreeScene");
+
+        const AZ::Aabb& boundingVolume = entry->m_boundingVolume;
+        const AZ::Vector3 center = boundingVolume.GetCenter();
+        const float halfSize = GetHalfSize(boundingVolume);
+
+        // The center of the entry is in the cell of exactly one child, descend while that child is large enough
+        uint32_t nodeIndex = startNodeIndex;
+        while (m_nodes[nodeIndex].m_firstChildIndex != LooseOctreeNode::InvalidNodeIndex)
+        {
+            const LooseOctreeNode& node = m_nodes[nodeIndex];
+            const uint32_t childIndex = node.m_firstChildIndex + GetChildOffset(node, center);
+            if (!Fits(m_nodes[childIndex], center, halfSize))
+            {
+                break;
+            }
+            nodeIndex = childIndex;
+        }
+
+        AddToNode(nodeIndex, entry);
+
+        const LooseOctreeNode& node = m_nodes[nodeIndex];
+        if (node.m_firstChildIndex == LooseOctreeNode::InvalidNodeIndex && node.m_entries.size() > bg_octreeNodeMaxEntries && node.m_depth < MaxDepth)
+        {
+            Split(nodeIndex);
+        }
+    }
+
+
+    void LooseOctreeScene::AddToNode(uint32_t nodeIndex, VisibilityEntry* entry)
+    {
+        LooseOctreeNode& node = m_nodes[nodeIndex];
+        entry->m_internalNode = &node;
+        entry->m_internalNodeIndex = aznumeric_cast<uint32_t>(node.m_entries.size());
+        node.m_entries.push_back(entry);
+        PushBounds(node.m_entryBounds, entry->m_boundingVolume);
+
+        for (uint32_t ancestorIndex = nodeIndex; ancestorIndex != LooseOctreeNode::InvalidNodeIndex; ancestorIndex = m_nodes[ancestorIndex].m_parentIndex)
+        {
+            ++m_nodes[ancestorIndex].m_subtreeEntryCount;
+        }
+        GrowContentBounds(nodeIndex, entry->m_boundingVolume);
+    }
+
+
+    void LooseOctreeScene::RemoveFromNode(VisibilityEntry* entry)
+    {
+        LooseOctreeNode& node = *static_cast<LooseOctreeNode*>(entry->m_internalNode);
+        const uint32_t removeIndex = entry->m_internalNodeIndex;
+        AZ_Assert(node.m_entries[removeIndex] == entry, "Visibility entry data is corrupt");
+
+        // Swap and pop the removed entry
+        node.m_entries[removeIndex] = node.m_entries.back();
+        node.m_entries[removeIndex]->m_internalNodeIndex = removeIndex;
+        node.m_entries.pop_back();
+        SwapAndPopBounds(node.m_entryBounds, removeIndex);
+        entry->m_internalNode = nullptr;
+        entry->m_internalNodeIndex = 0;
+
+        for (uint32_t ancestorIndex = node.m_nodeIndex; ancestorIndex != LooseOctreeNode::InvalidNodeIndex; ancestorIndex = m_nodes[ancestorIndex].m_parentIndex)
+        {
+            --m_nodes[ancestorIndex].m_subtreeEntryCount;
+        }
+        ShrinkContentBounds(node.m_nodeIndex);
+    }
+
+
+    void LooseOctreeScene::GrowContentBounds(uint32_t nodeIndex, const AZ::Aabb& bounds)
+    {
+        for (uint32_t ancestorIndex = nodeIndex; ancestorIndex != LooseOctreeNode::InvalidNodeIndex; ancestorIndex = m_nodes[ancestorIndex].m_parentIndex)
+        {
+            LooseOctreeNode& ancestor = m_nodes[ancestorIndex];
+            if (ancestor.m_contentBounds.Contains(bounds))
+            {
+                // The bounds of all the ancestors contain the bounds of this one
+                return;
+            }
+            ancestor.m_contentBounds.AddAabb(bounds);
+        }
+    }
+
+
+    void LooseOctreeScene::ShrinkContentBounds(uint32_t nodeIndex)
+    {
+        for (uint32_t ancestorIndex = nodeIndex; ancestorIndex != LooseOctreeNode::InvalidNodeIndex; ancestorIndex = m_nodes[ancestorIndex].m_parentIndex)
+        {
+            LooseOctreeNode& ancestor = m_nodes[ancestorIndex];
+            AZ::Aabb contentBounds = ComputeBounds(ancestor.m_entryBounds);
+            if (ancestor.m_firstChildIndex != LooseOctreeNode::InvalidNodeIndex)
+            {
+                for (uint32_t child = 0; child < ChildNodeCount; ++child)
+                {
+                    const LooseOctreeNode& childNode = m_nodes[ancestor.m_firstChildIndex + child];
+                    if (childNode.m_subtreeEntryCount > 0)
+                    {
+                        contentBounds.AddAabb(childNode.m_contentBounds);
+                    }
+                }
+            }
+
+            if (contentBounds == ancestor.m_contentBounds)
+            {
+                return;
+            }
+            ancestor.m_contentBounds = contentBounds;
+        }
+    }
+
+
+    void LooseOctreeScene::Split(uint32_t nodeIndex)
+    {
+        // Allocating nodes doesn't move the existing ones
+        const uint32_t firstChildIndex = AllocateChildNodes();
+        LooseOctreeNode& node = m_nodes[nodeIndex];
+        AZ_Assert(node.m_firstChildIndex == LooseOctreeNode::InvalidNodeIndex, "Split invoked on a LooseOctreeScene node that has already been split");
+        node.m_firstChildIndex = firstChildIndex;
+
+        const float childHalfSize = node.m_halfSize * 0.5f;
+        for (uint32_t child = 0; child < ChildNodeCount; ++child)
+        {
+            LooseOctreeNode& childNode = m_nodes[firstChildIndex + child];
+            childNode.m_center = node.m_center + AZ::Vector3(
+                (child & 0x01) ? childHalfSize : -childHalfSize,
+                (child & 0x02) ? childHalfSize : -childHalfSize,
+                (child & 0x04) ? childHalfSize : -childHalfSize);
+            childNode.m_halfSize = childHalfSize;
+            childNode.m_depth = node.m_depth + 1;
+            childNode.m_parentIndex = nodeIndex;
+        }
+
+        // Re-partition the entry set across this node and its children.
+        // The entries stay in the subtree, so only the children's counts and bounds change.
+        AZStd::vector<VisibilityEntry*> entries(AZStd::move(node.m_entries));
+        LooseOctreeNode::EntryBounds entryBounds(AZStd::move(node.m_entryBounds));
+        node.m_entries.clear();
+        ClearBounds(node.m_entryBounds);
+        for (uint32_t index = 0; index < entries.size(); ++index)
+        {
+            const AZ::Aabb bounds = GetBounds(entryBounds, index);
+            const AZ::Vector3 center = bounds.GetCenter();
+            LooseOctreeNode& childNode = m_nodes[firstChildIndex + GetChildOffset(node, center)];
+
+            LooseOctreeNode* targetNode = &node;
+            if (Fits(childNode, center, GetHalfSize(bounds)))
+            {
+                targetNode = &childNode;
+                ++childNode.m_subtreeEntryCount;
+                childNode.m_contentBounds.AddAabb(bounds);
+            }
+
+            VisibilityEntry* entry = entries[index];
+            entry->m_internalNode = targetNode;
+            entry->m_internalNodeIndex = aznumeric_cast<uint32_t>(targetNode->m_entries.size());
+            targetNode->m_entries.push_back(entry);
+            PushBounds(targetNode->m_entryBounds, bounds);
+        }
+    }
+
+
+    void LooseOctreeScene::Collapse(uint32_t nodeIndex)
+    {
+        LooseOctreeNode& node = m_nodes[nodeIndex];
+        if (node.m_firstChildIndex == LooseOctreeNode::InvalidNodeIndex)
+        {
+            return;
+        }
+
+        // Move all child entries to our own entry set, the subtree count and content bounds don't change
+        for (uint32_t child = 0; child < ChildNodeCount; ++child)
+        {
+            const uint32_t childIndex = node.m_firstChildIndex + child;
+            Collapse(childIndex);
+
+            LooseOctreeNode& childNode = m_nodes[childIndex];
+            for (uint32_t index = 0; index < childNode.m_entries.size(); ++index)
+            {
+                VisibilityEntry* entry = childNode.m_entries[index];
+                entry->m_internalNode = &node;
+                entry->m_internalNodeIndex = aznumeric_cast<uint32_t>(node.m_entries.size());
+                node.m_entries.push_back(entry);
+                PushBounds(node.m_entryBounds, GetBounds(childNode.m_entryBounds, index));
+            }
+            childNode.m_entries.clear();
+            ClearBounds(childNode.m_entryBounds);
+        }
+
+        ReleaseChildNodes(node.m_firstChildIndex);
+        node.m_firstChildIndex = LooseOctreeNode::InvalidNodeIndex;
+    }
+
+
+    void LooseOctreeScene::TryMerge(uint32_t nodeIndex)
+    {
+        // Subtree counts only grow towards the root, so stop at the first ancestor that has too many entries
+        uint32_t mergeNodeIndex = LooseOctreeNode::InvalidNodeIndex;
+        for (uint32_t ancestorIndex = nodeIndex; ancestorIndex != LooseOctreeNode::InvalidNodeIndex; ancestorIndex = m_nodes[ancestorIndex].m_parentIndex)
+        {
+            if (m_nodes[ancestorIndex].m_subtreeEntryCount > bg_octreeNodeMinEntries)
+            {
+                break;
+            }
+            mergeNodeIndex = ancestorIndex;
+        }
+
+        if (mergeNodeIndex != LooseOctreeNode::InvalidNodeIndex)
+        {
+            Collapse(mergeNodeIndex);
+        }
+    }
+
+
+    uint32_t LooseOctreeScene::AllocateChildNodes()
+    {
+        m_nodeCount += ChildNodeCount;
+
+        if (!m_freeChildNodes.empty())
+        {
+            // Take a free block of child nodes from our free list
+            const uint32_t firstChildIndex = m_freeChildNodes.back();
+            m_freeChildNodes.pop_back();
+            return firstChildIndex;
+        }
+
+        const uint32_t firstChildIndex = aznumeric_cast<uint32_t>(m_nodes.size());
+        for (uint32_t child = 0; child < ChildNodeCount; ++child)
+        {
+            m_nodes.emplace_back();
+            m_nodes.back().m_nodeIndex = firstChildIndex + child;
+        }
+        return firstChildIndex;
+    }
+
+
+    void LooseOctreeScene::ReleaseChildNodes(uint32_t firstChildIndex)
+    {
+        for (uint32_t child = 0; child < ChildNodeCount; ++child)
+        {
+            LooseOctreeNode& childNode = m_nodes[firstChildIndex + child];
+            AZ_Assert(childNode.m_entries.empty() && childNode.m_firstChildIndex == LooseOctreeNode::InvalidNodeIndex,
+                "Only empty leaf nodes can be released");
+            childNode.m_subtreeEntryCount = 0;
+            childNode.m_contentBounds = AZ::Aabb::CreateNull();
+        }
+
+        m_nodeCount -= ChildNodeCount;
+        m_freeChildNodes.push_back(firstChildIndex);
+    }
+
+
+    template <typename T>
+    void LooseOctreeScene::EnumerateHelper(const T& boundingVolume, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        // Depth first, each level pushes at most ChildNodeCount nodes after popping one
+        AZStd::fixed_vector<uint32_t, ChildNodeCount * MaxDepth + 1> nodeStack;
+        if (m_nodes[RootNodeIndex].m_subtreeEntryCount > 0)
+        {
+            nodeStack.push_back(RootNodeIndex);
+        }
+
+        while (!nodeStack.empty())
+        {
+            const LooseOctreeNode& node = m_nodes[nodeStack.back()];
+            nodeStack.pop_back();
+
+            if (!AZ::ShapeIntersection::Overlaps(boundingVolume, node.m_contentBounds))
+            {
+                continue;
+            }
+
+            // Invoke the callback for the current node
+            if (!node.m_entries.empty())
+            {
+                callback({node.m_contentBounds, node.m_entries});
+            }
+
+            if (node.m_firstChildIndex != LooseOctreeNode::InvalidNodeIndex)
+            {
+                for (uint32_t child = 0; child < ChildNodeCount; ++child)
+                {
+                    const uint32_t childIndex = node.m_firstChildIndex + child;
+                    if (m_nodes[childIndex].m_subtreeEntryCount > 0)
+                    {
+                        nodeStack.push_back(childIndex);
+                    }
+                }
+            }
+        }
+    }
+}
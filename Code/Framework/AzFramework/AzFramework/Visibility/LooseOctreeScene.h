@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzFramework/Visibility/IVisibilitySystem.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+
+namespace AzFramework
+{
+    //! A node of a LooseOctreeScene.
+    //! The node owns a cubic cell, and holds the entries whose center is inside the cell and whose size is at most the size of the cell.
+    //! Entries never straddle nodes, so the loose bounds of a node are its cell expanded by half a cell on each side.
+    class LooseOctreeNode
+        : public VisibilityNode
+    {
+    public:
+        //! The bounds of the entries of a node, stored as structure of arrays in the same order as the entries.
+        struct EntryBounds
+        {
+            AZStd::vector<float> m_minX;
+            AZStd::vector<float> m_minY;
+            AZStd::vector<float> m_minZ;
+            AZStd::vector<float> m_maxX;
+            AZStd::vector<float> m_maxY;
+            AZStd::vector<float> m_maxZ;
+        };
+
+        static constexpr uint32_t InvalidNodeIndex = 0xFFFFFFFF;
+
+        AZ::Vector3 m_center = AZ::Vector3::CreateZero();
+        float m_halfSize = 0.0f;
+        uint32_t m_depth = 0;
+        uint32_t m_nodeIndex = InvalidNodeIndex; //< Index of this node in the scene
+        uint32_t m_parentIndex = InvalidNodeIndex;
+        uint32_t m_firstChildIndex = InvalidNodeIndex; //< The 8 children of a node are allocated together
+        uint32_t m_subtreeEntryCount = 0; //< Number of entries in this node and all its children
+        AZ::Aabb m_contentBounds = AZ::Aabb::CreateNull(); //< Bounds of the entries of this node and all its children
+        AZStd::vector<VisibilityEntry*> m_entries;
+        EntryBounds m_entryBounds;
+    };
+
+    //! Implementation of the visibility scene interface using a loose octree.
+    //! Compared to OctreeScene, entries are bound to the node that matches their center and size instead of the first node that
+    //! fully contains them, so small entries are never stuck in a large node, and an entry that moves inside the cell of its node
+    //! is refit in place without being removed and inserted again.
+    //! Nodes are addressed by 32-bit indices, and queries are culled against the tight bounds of the content of each node instead of its cell.
+    //! Queries can run from several threads at the same time.
+    class LooseOctreeScene
+        : public IVisibilityScene
+    {
+    public:
+        AZ_RTTI(LooseOctreeScene, "{5B8C3E2D-7A41-4F96-9D0B-E61F42A8C735}", IVisibilityScene);
+        AZ_CLASS_ALLOCATOR(LooseOctreeScene, AZ::SystemAllocator, 0);
+        AZ_DISABLE_COPY_MOVE(LooseOctreeScene);
+
+        explicit LooseOctreeScene(const AZ::Name& sceneName);
+        virtual ~LooseOctreeScene() = default;
+
+        //! IVisibilityScene overrides.
+        //! @{
+        const AZ::Name& GetName() const override;
+        void InsertOrUpdateEntry(VisibilityEntry& entry) override;
+        void RemoveEntry(VisibilityEntry& entry) override;
+        void Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const override;
+        uint32_t GetEntryCount() const override;
+        //! @}
+
+        //! Stats
+        //! @{
+        uint32_t GetNodeCount() const;
+        uint32_t GetFreeNodeCount() const;
+        uint32_t GetChildNodeCount() const;
+        void DumpStats();
+        //! @}
+
+    private:
+        static constexpr uint32_t ChildNodeCount = 8;
+        static constexpr uint32_t MaxDepth = 16;
+        static constexpr uint32_t RootNodeIndex = 0;
+
+        //! Returns true if the entry can be bound to the node.
+        bool Fits(const LooseOctreeNode& node, const AZ::Vector3& center, float halfSize) const;
+
+        //! Binds the entry to the deepest node below startNodeIndex that fits it, splitting that node if it is too full.
+        void Insert(uint32_t startNodeIndex, VisibilityEntry* entry);
+
+        void AddToNode(uint32_t nodeIndex, VisibilityEntry* entry);
+        void RemoveFromNode(VisibilityEntry* entry);
+
+        //! Grows the content bounds of the node and its ancestors to include the bounds.
+        void GrowContentBounds(uint32_t nodeIndex, const AZ::Aabb& bounds);
+
+        //! Recomputes the content bounds of the node and its ancestors after entries were removed.
+        void ShrinkContentBounds(uint32_t nodeIndex);
+
+        void Split(uint32_t nodeIndex);
+
+        //! Moves all the entries of the children of the node into the node and releases the children.
+        void Collapse(uint32_t nodeIndex);
+
+        //! Collapses the highest ancestor of the node that has few enough entries.
+        void TryMerge(uint32_t nodeIndex);
+
+        uint32_t AllocateChildNodes();
+        void ReleaseChildNodes(uint32_t firstChildIndex);
+
+        template <typename T>
+        void EnumerateHelper(const T& boundingVolume, const IVisibilityScene::EnumerateCallback& callback) const;
+
+        mutable AZStd::shared_mutex m_sharedMutex;
+
+        AZ::Name m_sceneName; //< The uniquely identifying name for the visibility scene.
+        AZStd::deque<LooseOctreeNode> m_nodes; //< All nodes, the root first. The addresses of the nodes never change.
+        AZStd::vector<uint32_t> m_freeChildNodes; //< Indices of the first node of released blocks of ChildNodeCount nodes.
+
+        uint32_t m_entryCount = 0; //< Metric tracking the number of entries inserted into the scene.
+        uint32_t m_nodeCount = 1; //< Metric tracking the number of nodes in use, at least one for the root node.
+    };
+}
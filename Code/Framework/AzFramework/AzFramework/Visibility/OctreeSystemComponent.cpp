@@ -7,12 +7,14 @@
  */
 
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
+#include <AzFramework/Visibility/LooseOctreeScene.h>
 #include <AzCore/Math/ShapeIntersection.h>
 #include <AzCore/Serialization/SerializeContext.h>
 
 namespace AzFramework
 {
     AZ_CVAR(bool,     bg_octreeUseQuadtree,        false, nullptr, AZ::ConsoleFunctorFlags::ReadOnly, "If set to true, the visibility octrees will degenerate to a quadtree split along the X/Y plane");
+    AZ_CVAR(bool,     bg_octreeUseLooseOctree,     false, nullptr, AZ::ConsoleFunctorFlags::ReadOnly, "If set to true, new visibility scenes use a loose octree that refits moving entries in place");
     AZ_CVAR(float,    bg_octreeMaxWorldExtents, 16384.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum supported world size by the world octreeSystemComponent");
     AZ_CVAR(uint32_t, bg_octreeNodeMaxEntries,       64, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum number of entries to allow in any node before forcing a split");
     AZ_CVAR(uint32_t, bg_octreeNodeMinEntries,       32, nullptr, AZ::ConsoleFunctorFlags::Null, "Minimum number of entries to allow in a node resulting from a merge operation");
@@ -547,12 +549,22 @@ namespace AzFramework
     }
 
 
+    static IVisibilityScene* CreateScene(const AZ::Name& sceneName)
+    {
+        if (bg_octreeUseLooseOctree)
+        {
+            return aznew LooseOctreeScene(sceneName);
+        }
+        return aznew OctreeScene(sceneName);
+    }
+
+
     OctreeSystemComponent::OctreeSystemComponent()        
     {
         AZ::Interface<IVisibilitySystem>::Register(this);
         IVisibilitySystemRequestBus::Handler::BusConnect();
 
-        m_defaultScene = aznew OctreeScene(AZ::Name("DefaultVisibilityScene"));
+        m_defaultScene = CreateScene(AZ::Name("DefaultVisibilityScene"));
     }
 
 
@@ -586,7 +598,7 @@ namespace AzFramework
     IVisibilityScene* OctreeSystemComponent::CreateVisibilityScene(const AZ::Name& sceneName)
     {
         AZ_Assert(FindVisibilityScene(sceneName) == nullptr, "Scene with same name already created!");
-        OctreeScene* newScene = aznew OctreeScene(sceneName);
+        IVisibilityScene* newScene = CreateScene(sceneName);
         m_scenes.push_back(newScene);
         return newScene;
     }
@@ -609,7 +621,7 @@ namespace AzFramework
 
     IVisibilityScene* OctreeSystemComponent::FindVisibilityScene(const AZ::Name& sceneName)
     {
-        for (OctreeScene* scene : m_scenes)
+        for (IVisibilityScene* scene : m_scenes)
         {
             if(scene->GetName() == sceneName)
             {
@@ -622,10 +634,17 @@ namespace AzFramework
 
     void OctreeSystemComponent::DumpStats([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
     {
-        for (OctreeScene* scene : m_scenes)
+        for (IVisibilityScene* scene : m_scenes)
         {
             AZ_TracePrintf("Console", "============================================");
-            scene->DumpStats();
+            if (OctreeScene* octreeScene = azrtti_cast<OctreeScene*>(scene))
+            {
+                octreeScene->DumpStats();
+            }
+            else if (LooseOctreeScene* looseOctreeScene = azrtti_cast<LooseOctreeScene*>(scene))
+            {
+                looseOctreeScene->DumpStats();
+            }
         }
         AZ_TracePrintf("Console", "============================================");
     }
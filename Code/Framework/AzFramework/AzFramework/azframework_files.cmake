@@ -134,6 +134,8 @@ set(FILES
     Components/EditorEntityEvents.h
     Components/TransformComponent.cpp
     Components/TransformComponent.h
+    Components/TransformHierarchyUpdateSystem.cpp
+    Components/TransformHierarchyUpdateSystem.h
     Components/CameraBus.h
     Components/ConsoleBus.h
     Components/ConsoleBus.cpp
@@ -282,6 +284,7 @@ set(FILES
     Render/Intersector.cpp
     Render/Intersector.h
     Render/IntersectorInterface.h
+    Spawnable/PoolableComponent.h
     Spawnable/RootSpawnableInterface.h
     Spawnable/Spawnable.cpp
     Spawnable/Spawnable.h
@@ -405,6 +408,8 @@ set(FILES
     Visibility/IVisibilitySystem.h
     Visibility/OctreeSystemComponent.h
     Visibility/OctreeSystemComponent.cpp
+    Visibility/LooseOctreeScene.h
+    Visibility/LooseOctreeScene.cpp
     Visibility/BoundsBus.h
     Visibility/BoundsBus.cpp
     Visibility/VisibilityDebug.h
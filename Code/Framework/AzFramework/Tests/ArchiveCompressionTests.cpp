@@ -439,6 +439,66 @@ namespace UnitTest
         EXPECT_TRUE(IsPackValid(testArchivePath.c_str()));
     }
 
+    TEST_P(ArchiveCompressionTestFixture, TestArchivePacking_CompressionInChunks_PackIsValid)
+    {
+        AZStd::string testArchivePath = "@usercache@/archivetest.pak";
+        AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
+
+        auto openFlags = AZStd::get<0>(GetParam());
+        auto compressionMethod = AZStd::get<1>(GetParam());
+        auto compressionLevel = AZStd::get<2>(GetParam());
+        auto stepSize = AZStd::get<3>(GetParam());
+        auto numSteps = AZStd::get<4>(GetParam());
+
+        // Use a chunk size that doesn't line up with the file sizes so the last chunk is partially filled.
+        const int chunkSize = stepSize * 2 + 1;
+        int maxSize = numSteps * stepSize;
+
+        AZStd::vector<uint8_t> checkSums;
+        checkSums.resize_no_construct(maxSize);
+        for (int pos = 0; pos < maxSize; ++pos)
+        {
+            checkSums[pos] = static_cast<uint8_t>(pos % 256);
+        }
+
+        auto pArchive = archive->OpenArchive(testArchivePath.c_str(), nullptr, AZ::IO::INestedArchive::FLAGS_CREATE_NEW);
+        ASSERT_NE(nullptr, pArchive);
+        pArchive->SetCompressionChunkSize(chunkSize);
+
+        for (CompressionCodec::Codec codec : CompressionCodec::s_AllCodecs)
+        {
+            for (int currentSize = maxSize; currentSize >= 0; currentSize -= stepSize)
+            {
+                auto fnBuffer = AZ::StringFunc::Path::FixedString::format("file-%i-%i.dat", currentSize, static_cast<int>(codec));
+                EXPECT_EQ(0, pArchive->UpdateFile(fnBuffer, checkSums.data(), currentSize, compressionMethod, compressionLevel, codec));
+            }
+        }
+
+        pArchive.reset();
+        EXPECT_TRUE(IsPackValid(testArchivePath.c_str()));
+
+        pArchive = archive->OpenArchive(testArchivePath.c_str(), nullptr, openFlags);
+        ASSERT_NE(nullptr, pArchive);
+
+        AZStd::vector<uint8_t> readBuffer;
+        readBuffer.resize_no_construct(maxSize);
+        for (CompressionCodec::Codec codec : CompressionCodec::s_AllCodecs)
+        {
+            for (int currentSize = maxSize; currentSize >= 0; currentSize -= stepSize)
+            {
+                auto fnBuffer = AZ::StringFunc::Path::FixedString::format("file-%i-%i.dat", currentSize, static_cast<int>(codec));
+                AZ::IO::INestedArchive::Handle hand = pArchive->FindFile(fnBuffer);
+                ASSERT_NE(nullptr, hand);
+                EXPECT_EQ(currentSize, pArchive->GetFileSize(hand));
+                EXPECT_EQ(0, pArchive->ReadFile(hand, readBuffer.data()));
+                EXPECT_EQ(0, memcmp(checkSums.data(), readBuffer.data(), currentSize));
+            }
+        }
+
+        pArchive.reset();
+        EXPECT_TRUE(IsPackValid(testArchivePath.c_str()));
+    }
+
     INSTANTIATE_TEST_CASE_P(
         ArchiveCompression,
         ArchiveCompressionTestFixture,
@@ -8,6 +8,7 @@
 
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/Name/NameDictionary.h>
+#include <AzFramework/Visibility/LooseOctreeScene.h>
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
 
 #if defined(HAVE_BENCHMARK)
@@ -35,7 +36,14 @@ namespace Benchmark
                 AZ::NameDictionary::Create();
             }
             m_octreeSystemComponent = new AzFramework::OctreeSystemComponent;
-            m_visScene = m_octreeSystemComponent->CreateVisibilityScene(AZ::Name("OctreeBenchmarkVisibilityScene"));
+            if (m_useLooseOctree)
+            {
+                m_visScene = aznew AzFramework::LooseOctreeScene(AZ::Name("LooseOctreeBenchmarkVisibilityScene"));
+            }
+            else
+            {
+                m_visScene = m_octreeSystemComponent->CreateVisibilityScene(AZ::Name("OctreeBenchmarkVisibilityScene"));
+            }
             m_dataArray.resize(1000000);
             m_queryDataArray.resize(1000);
 
@@ -74,7 +82,15 @@ namespace Benchmark
 
         void TearDown([[maybe_unused]] const ::benchmark::State& state) override
         {
-            m_octreeSystemComponent->DestroyVisibilityScene(m_visScene);
+            if (m_useLooseOctree)
+            {
+                delete m_visScene;
+            }
+            else
+            {
+                m_octreeSystemComponent->DestroyVisibilityScene(m_visScene);
+            }
+            m_visScene = nullptr;
             delete m_octreeSystemComponent;
             AZ::NameDictionary::Destroy();
 
@@ -107,6 +123,17 @@ namespace Benchmark
             }
         }
 
+        //! Moves the entries by a small random offset, as most moving objects do from one frame to the next
+        void UpdateEntries(uint32_t entryCount)
+        {
+            for (uint32_t i = 0; i < entryCount; ++i)
+            {
+                AzFramework::VisibilityEntry& entry = m_dataArray[i];
+                entry.m_boundingVolume.Translate(AZ::Vector3(m_moveDistribution(m_moveRng), m_moveDistribution(m_moveRng), m_moveDistribution(m_moveRng)));
+                m_visScene->InsertOrUpdateEntry(entry);
+            }
+        }
+
         struct QueryData
         {
             AZ::Aabb aabb;
@@ -115,6 +142,9 @@ namespace Benchmark
         };
 
         bool m_ownsSystemAllocator = false;
+        bool m_useLooseOctree = false;
+        std::mt19937_64 m_moveRng{ 2 };
+        std::uniform_real_distribution<float> m_moveDistribution{ -1.0f, 1.0f };
         AZStd::vector<AzFramework::VisibilityEntry> m_dataArray;
         AZStd::vector<QueryData> m_queryDataArray;
         AzFramework::OctreeSystemComponent* m_octreeSystemComponent = nullptr;
@@ -328,6 +358,217 @@ namespace Benchmark
         }
         RemoveEntries(EntryCount);
     }
+
+    BENCHMARK_F(BM_Octree, Update10000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 10000;
+        InsertEntries(EntryCount);
+        for (auto _ : state)
+        {
+            UpdateEntries(EntryCount);
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_Octree, Update100000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 100000;
+        InsertEntries(EntryCount);
+        for (auto _ : state)
+        {
+            UpdateEntries(EntryCount);
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    //! The same benchmarks on a LooseOctreeScene, to compare both implementations of IVisibilityScene
+    class BM_LooseOctree
+        : public BM_Octree
+    {
+    public:
+        BM_LooseOctree()
+        {
+            m_useLooseOctree = true;
+        }
+    };
+
+    BENCHMARK_F(BM_LooseOctree, InsertDelete10000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 10000;
+        for (auto _ : state)
+        {
+            InsertEntries(EntryCount);
+            RemoveEntries(EntryCount);
+        }
+    }
+
+    BENCHMARK_F(BM_LooseOctree, InsertDelete100000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 100000;
+        for (auto _ : state)
+        {
+            InsertEntries(EntryCount);
+            RemoveEntries(EntryCount);
+        }
+    }
+
+    BENCHMARK_F(BM_LooseOctree, InsertDelete1000000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 1000000;
+        for (auto _ : state)
+        {
+            InsertEntries(EntryCount);
+            RemoveEntries(EntryCount);
+        }
+    }
+
+    BENCHMARK_F(BM_LooseOctree, Update10000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 10000;
+        InsertEntries(EntryCount);
+        for (auto _ : state)
+        {
+            UpdateEntries(EntryCount);
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_LooseOctree, Update100000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 100000;
+        InsertEntries(EntryCount);
+        for (auto _ : state)
+        {
+            UpdateEntries(EntryCount);
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_LooseOctree, EnumerateAabb10000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 10000;
+        InsertEntries(EntryCount);
+        for (auto _ : state)
+        {
+            for (auto& queryData : m_queryDataArray)
+            {
+                m_visScene->Enumerate(queryData.aabb, [](const AzFramework::IVisibilityScene::NodeData&) {});
+            }
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_LooseOctree, EnumerateAabb100000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 100000;
+        InsertEntries(EntryCount);
+        for (auto _ : state)
+        {
+            for (auto& queryData : m_queryDataArray)
+            {
+                m_visScene->Enumerate(queryData.aabb, [](const AzFramework::IVisibilityScene::NodeData&) {});
+            }
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_LooseOctree, EnumerateAabb1000000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 1000000;
+        InsertEntries(EntryCount);
+        for (auto _ : state)
+        {
+            for (auto& queryData : m_queryDataArray)
+            {
+                m_visScene->Enumerate(queryData.aabb, [](const AzFramework::IVisibilityScene::NodeData&) {});
+            }
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_LooseOctree, EnumerateSphere10000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 10000;
+        InsertEntries(EntryCount);
+        for (auto _ : state)
+        {
+            for (auto& queryData : m_queryDataArray)
+            {
+                m_visScene->Enumerate(queryData.sphere, [](const AzFramework::IVisibilityScene::NodeData&) {});
+            }
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_LooseOctree, EnumerateSphere100000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 100000;
+        InsertEntries(EntryCount);
+        for (auto _ : state)
+        {
+            for (auto& queryData : m_queryDataArray)
+            {
+                m_visScene->Enumerate(queryData.sphere, [](const AzFramework::IVisibilityScene::NodeData&) {});
+            }
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_LooseOctree, EnumerateSphere1000000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 1000000;
+        InsertEntries(EntryCount);
+        for (auto _ : state)
+        {
+            for (auto& queryData : m_queryDataArray)
+            {
+                m_visScene->Enumerate(queryData.sphere, [](const AzFramework::IVisibilityScene::NodeData&) {});
+            }
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_LooseOctree, EnumerateFrustum10000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 10000;
+        InsertEntries(EntryCount);
+        for (auto _ : state)
+        {
+            for (auto& queryData : m_queryDataArray)
+            {
+                m_visScene->Enumerate(queryData.frustum, [](const AzFramework::IVisibilityScene::NodeData&) {});
+            }
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_LooseOctree, EnumerateFrustum100000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 100000;
+        InsertEntries(EntryCount);
+        for (auto _ : state)
+        {
+            for (auto& queryData : m_queryDataArray)
+            {
+                m_visScene->Enumerate(queryData.frustum, [](const AzFramework::IVisibilityScene::NodeData&) {});
+            }
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_LooseOctree, EnumerateFrustum1000000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 1000000;
+        InsertEntries(EntryCount);
+        for (auto _ : state)
+        {
+            for (auto& queryData : m_queryDataArray)
+            {
+                m_visScene->Enumerate(queryData.frustum, [](const AzFramework::IVisibilityScene::NodeData&) {});
+            }
+        }
+        RemoveEntries(EntryCount);
+    }
 }
 
 #endif
@@ -11,6 +11,7 @@
 #include <AzCore/Console/Console.h>
 #include <AzCore/Name/NameDictionary.h>
 #include <AzCore/Console/IConsole.h>
+#include <AzFramework/Visibility/LooseOctreeScene.h>
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
 #include <random>
 
@@ -420,4 +421,160 @@ namespace UnitTest
         // Expect all the entries to be in the scene
         ValidateEntryCountEqualsExpectedCount(m_octreeScene, visEntries.size());
     }
+
+    class LooseOctreeTests
+        : public OctreeTests
+    {
+    public:
+        void SetUp() override
+        {
+            OctreeTests::SetUp();
+
+            // Created after the octree cvars are configured, so the world is the same -1,-1,-1 to 1,1,1 volume
+            m_looseOctreeScene = aznew LooseOctreeScene(AZ::Name("LooseOctreeUnitTestScene"));
+        }
+
+        void TearDown() override
+        {
+            delete m_looseOctreeScene;
+            m_looseOctreeScene = nullptr;
+
+            OctreeTests::TearDown();
+        }
+
+        LooseOctreeScene* m_looseOctreeScene = nullptr;
+    };
+
+    TEST_F(LooseOctreeTests, InsertDeleteSingleEntry)
+    {
+        AzFramework::VisibilityEntry visEntry;
+        visEntry.m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3::CreateZero(), AZ::Vector3::CreateOne());
+
+        m_looseOctreeScene->InsertOrUpdateEntry(visEntry);
+        EXPECT_TRUE(visEntry.m_internalNode != nullptr);
+        EXPECT_TRUE(visEntry.m_internalNodeIndex == 0);
+        ValidateEntryCountEqualsExpectedCount(m_looseOctreeScene, 1);
+
+        m_looseOctreeScene->RemoveEntry(visEntry);
+        EXPECT_TRUE(visEntry.m_internalNode == nullptr);
+        ValidateEntryCountEqualsExpectedCount(m_looseOctreeScene, 0);
+    }
+
+    TEST_F(LooseOctreeTests, InsertDeleteSplitMerge)
+    {
+        AzFramework::VisibilityEntry visEntry[3];
+        visEntry[0].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.9f), AZ::Vector3(-0.6f));
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3( 0.1f), AZ::Vector3( 0.4f));
+        visEntry[2].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3( 0.6f), AZ::Vector3( 0.9f));
+
+        m_looseOctreeScene->InsertOrUpdateEntry(visEntry[0]);
+        ValidateEntryCountEqualsExpectedCount(m_looseOctreeScene, 1);
+        EXPECT_EQ(m_looseOctreeScene->GetNodeCount(), 1u);
+
+        m_looseOctreeScene->InsertOrUpdateEntry(visEntry[1]); // This should force a split of the root node
+        ValidateEntryCountEqualsExpectedCount(m_looseOctreeScene, 2);
+        EXPECT_EQ(m_looseOctreeScene->GetNodeCount(), 1 + m_looseOctreeScene->GetChildNodeCount());
+        EXPECT_NE(visEntry[0].m_internalNode, visEntry[1].m_internalNode);
+
+        m_looseOctreeScene->InsertOrUpdateEntry(visEntry[2]); // This should force a split of the roots +/+/+ child node
+        ValidateEntryCountEqualsExpectedCount(m_looseOctreeScene, 3);
+        EXPECT_EQ(m_looseOctreeScene->GetNodeCount(), 1 + (2 * m_looseOctreeScene->GetChildNodeCount()));
+        EXPECT_NE(visEntry[1].m_internalNode, visEntry[2].m_internalNode);
+
+        m_looseOctreeScene->RemoveEntry(visEntry[2]);
+        EXPECT_TRUE(visEntry[2].m_internalNode == nullptr);
+        ValidateEntryCountEqualsExpectedCount(m_looseOctreeScene, 2);
+        EXPECT_EQ(m_looseOctreeScene->GetNodeCount(), 1 + m_looseOctreeScene->GetChildNodeCount());
+
+        m_looseOctreeScene->RemoveEntry(visEntry[1]);
+        EXPECT_TRUE(visEntry[1].m_internalNode == nullptr);
+        ValidateEntryCountEqualsExpectedCount(m_looseOctreeScene, 1);
+        EXPECT_EQ(m_looseOctreeScene->GetNodeCount(), 1u);
+
+        m_looseOctreeScene->RemoveEntry(visEntry[0]);
+        EXPECT_TRUE(visEntry[0].m_internalNode == nullptr);
+        ValidateEntryCountEqualsExpectedCount(m_looseOctreeScene, 0);
+    }
+
+    TEST_F(LooseOctreeTests, UpdateInsideNodeCell_RefitsInPlace)
+    {
+        AzFramework::VisibilityEntry visEntry[2];
+        visEntry[0].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.9f), AZ::Vector3(-0.6f));
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3( 0.1f), AZ::Vector3( 0.4f));
+        m_looseOctreeScene->InsertOrUpdateEntry(visEntry[0]);
+        m_looseOctreeScene->InsertOrUpdateEntry(visEntry[1]);
+        const VisibilityNode* node = visEntry[1].m_internalNode;
+
+        // Still in the cell of the +/+/+ child node, the entry doesn't change nodes but the new bounds are visible to queries
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.6f), AZ::Vector3(0.95f));
+        m_looseOctreeScene->InsertOrUpdateEntry(visEntry[1]);
+        EXPECT_EQ(visEntry[1].m_internalNode, node);
+        EXPECT_EQ(m_looseOctreeScene->GetNodeCount(), 1 + m_looseOctreeScene->GetChildNodeCount());
+
+        AZStd::vector<VisibilityEntry*> gatheredEntries;
+        m_looseOctreeScene->Enumerate(AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.9f), AZ::Vector3(1.0f)),
+            [&gatheredEntries](const AzFramework::IVisibilityScene::NodeData& nodeData) { AppendEntries(gatheredEntries, nodeData); });
+        ASSERT_EQ(gatheredEntries.size(), 1u);
+        EXPECT_EQ(gatheredEntries[0], &visEntry[1]);
+
+        // Moved to the cell of the -/-/- child node, which splits
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.4f), AZ::Vector3(-0.1f));
+        m_looseOctreeScene->InsertOrUpdateEntry(visEntry[1]);
+        EXPECT_NE(visEntry[1].m_internalNode, node);
+        ValidateEntryCountEqualsExpectedCount(m_looseOctreeScene, 2);
+
+        gatheredEntries.clear();
+        m_looseOctreeScene->Enumerate(AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.5f), AZ::Vector3(1.0f)),
+            [&gatheredEntries](const AzFramework::IVisibilityScene::NodeData& nodeData) { AppendEntries(gatheredEntries, nodeData); });
+        EXPECT_TRUE(gatheredEntries.empty());
+
+        m_looseOctreeScene->Enumerate(AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.45f), AZ::Vector3(-0.05f)),
+            [&gatheredEntries](const AzFramework::IVisibilityScene::NodeData& nodeData) { AppendEntries(gatheredEntries, nodeData); });
+        ASSERT_EQ(gatheredEntries.size(), 1u);
+        EXPECT_EQ(gatheredEntries[0], &visEntry[1]);
+
+        m_looseOctreeScene->RemoveEntry(visEntry[0]);
+        m_looseOctreeScene->RemoveEntry(visEntry[1]);
+        ValidateEntryCountEqualsExpectedCount(m_looseOctreeScene, 0);
+        EXPECT_EQ(m_looseOctreeScene->GetNodeCount(), 1u);
+    }
+
+    TEST_F(LooseOctreeTests, EnumerateSphereSingleEntry)
+    {
+        AZ::Sphere bounds = AZ::Sphere::CreateUnitSphere();
+        EnumerateSingleEntryHelper(m_looseOctreeScene, bounds);
+    }
+
+    TEST_F(LooseOctreeTests, EnumerateAabbSingleEntry)
+    {
+        AZ::Aabb bounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-1.0f), AZ::Vector3(1.0f));
+        EnumerateSingleEntryHelper(m_looseOctreeScene, bounds);
+    }
+
+    TEST_F(LooseOctreeTests, EnumerateSphereMultipleEntries)
+    {
+        AZ::Sphere bound1 = AZ::Sphere::CreateUnitSphere();
+        AZ::Sphere bound2 = AZ::Sphere(AZ::Vector3(-0.5f), 0.5f);
+        AZ::Sphere bound3 = AZ::Sphere(AZ::Vector3(0.75f), 0.2f);
+        EnumerateMultipleEntriesHelper(m_looseOctreeScene, bound1, bound2, bound3);
+    }
+
+    TEST_F(LooseOctreeTests, EnumerateAabbMultipleEntries)
+    {
+        AZ::Aabb bound1 = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-1.0f), AZ::Vector3( 1.0f));
+        AZ::Aabb bound2 = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-1.0f), AZ::Vector3(-0.5f));
+        AZ::Aabb bound3 = AZ::Aabb::CreateFromMinMax(AZ::Vector3( 0.6f), AZ::Vector3( 0.9f));
+        EnumerateMultipleEntriesHelper(m_looseOctreeScene, bound1, bound2, bound3);
+    }
+
+    TEST_F(LooseOctreeTests, EnumerateFrustumMultipleEntries)
+    {
+        AZ::Vector3 frustumOrigin = AZ::Vector3(0.0f, -2.0f, 0.0f);
+        AZ::Quaternion frustumDirection = AZ::Quaternion::CreateIdentity();
+        AZ::Transform frustumTransform = AZ::Transform::CreateFromQuaternionAndTranslation(frustumDirection, frustumOrigin);
+        AZ::Frustum bound1 = AZ::Frustum(AZ::ViewFrustumAttributes(frustumTransform, 1.0f, 2.0f * atanf(0.5f), 1.0f, 3.0f));
+        AZ::Frustum bound2 = AZ::Frustum(AZ::ViewFrustumAttributes(frustumTransform, 1.0f, 2.0f * atanf(0.5f), 1.0f, 2.0f));
+        AZ::Frustum bound3 = AZ::Frustum(AZ::ViewFrustumAttributes(frustumTransform, 1.0f, 2.0f * atanf(0.5f), 2.6f, 2.9f));
+        EnumerateMultipleEntriesHelper(m_looseOctreeScene, bound1, bound2, bound3);
+    }
 }
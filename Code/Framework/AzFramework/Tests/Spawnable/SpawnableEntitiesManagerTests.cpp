@@ -325,6 +325,33 @@ namespace UnitTest
         }
     }
 
+    TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_ManyEntitiesReferenceOtherEntities_EntityIdsAreMappedCorrectly)
+    {
+        // Enough entities for the ids to get fixed up in parallel batches on the job system.
+        for (EntityReferenceScheme refScheme : {
+                EntityReferenceScheme::AllReferenceFirst, EntityReferenceScheme::AllReferenceLast,
+                EntityReferenceScheme::AllReferenceNextCircular, EntityReferenceScheme::AllReferencePreviousCircular })
+        {
+            constexpr size_t NumEntities = 256;
+            FillSpawnable(NumEntities);
+            CreateEntityReferences(refScheme);
+
+            size_t spawnedEntitiesCount = 0;
+            auto callback = [this, refScheme, NumEntities, &spawnedEntitiesCount]
+                (AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+            {
+                spawnedEntitiesCount += entities.size();
+                ValidateEntityReferences(refScheme, NumEntities, entities);
+            };
+            AzFramework::SpawnAllEntitiesOptionalArgs optionalArgs;
+            optionalArgs.m_completionCallback = AZStd::move(callback);
+            m_manager->SpawnAllEntities(*m_ticket, AZStd::move(optionalArgs));
+            m_manager->ProcessQueue(AzFramework::SpawnableEntitiesManager::CommandQueuePriority::Regular);
+
+            EXPECT_EQ(NumEntities, spawnedEntitiesCount);
+        }
+    }
+
     TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_AllEntitiesReferenceOtherEntities_EntityIdsOnlyReferWithinASingleCall)
     {
         // This tests that entity id references get mapped correctly with multiple SpawnAllEntities calls.  Each call should only map
@@ -380,6 +407,87 @@ namespace UnitTest
     // SpawnEntities
     //
 
+    TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_ReusePooledEntities_DespawnedEntitiesAreReused)
+    {
+        static constexpr size_t NumEntities = 4;
+        FillSpawnable(NumEntities);
+        CreateRecursiveHierarchy();
+
+        AZStd::vector<AZ::Entity*> spawnedEntities;
+        auto callback = [&spawnedEntities](AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+        {
+            spawnedEntities.clear();
+            for (const AZ::Entity* entity : entities)
+            {
+                spawnedEntities.push_back(const_cast<AZ::Entity*>(entity));
+            }
+        };
+
+        AzFramework::SpawnAllEntitiesOptionalArgs spawnArgs;
+        spawnArgs.m_completionCallback = callback;
+        spawnArgs.m_reusePooledEntities = true;
+        m_manager->SpawnAllEntities(*m_ticket, spawnArgs);
+        AzFramework::DespawnAllEntitiesOptionalArgs despawnArgs;
+        despawnArgs.m_returnEntitiesToPool = true;
+        m_manager->DespawnAllEntities(*m_ticket, despawnArgs);
+        m_manager->ProcessQueue(AzFramework::SpawnableEntitiesManager::CommandQueuePriority::Regular);
+        ASSERT_EQ(NumEntities, spawnedEntities.size());
+        const AZStd::vector<AZ::Entity*> firstEntities = spawnedEntities;
+        for (AZ::Entity* entity : firstEntities)
+        {
+            EXPECT_NE(AZ::Entity::State::Active, entity->GetState());
+        }
+
+        // Move an entity, so the reset from the template can be verified.
+        firstEntities[1]->GetTransform()->SetLocalTranslation(AZ::Vector3(1.0f, 2.0f, 3.0f));
+
+        m_manager->SpawnAllEntities(*m_ticket, spawnArgs);
+        m_manager->ProcessQueue(AzFramework::SpawnableEntitiesManager::CommandQueuePriority::Regular);
+        ASSERT_EQ(NumEntities, spawnedEntities.size());
+        for (size_t i = 0; i < NumEntities; ++i)
+        {
+            EXPECT_EQ(firstEntities[i], spawnedEntities[i]);
+            EXPECT_EQ(AZ::Entity::State::Active, spawnedEntities[i]->GetState());
+            if (i > 0)
+            {
+                EXPECT_EQ(spawnedEntities[i - 1]->GetId(), spawnedEntities[i]->GetTransform()->GetParentId());
+            }
+        }
+        EXPECT_TRUE(spawnedEntities[1]->GetTransform()->GetLocalTranslation().IsClose(AZ::Vector3::CreateZero()));
+    }
+
+    TEST_F(SpawnableEntitiesManagerTest, SpawnAllEntities_ReusePooledEntitiesWithNonPoolableComponents_EntitiesAreCloned)
+    {
+        static constexpr size_t NumEntities = 4;
+        FillSpawnable(NumEntities);
+        CreateEntityReferences(EntityReferenceScheme::AllReferenceFirst);
+
+        AZStd::vector<AZ::EntityId> spawnedIds;
+        auto callback = [&spawnedIds](AzFramework::EntitySpawnTicket::Id, AzFramework::SpawnableConstEntityContainerView entities)
+        {
+            for (const AZ::Entity* entity : entities)
+            {
+                spawnedIds.push_back(entity->GetId());
+            }
+        };
+
+        AzFramework::SpawnAllEntitiesOptionalArgs spawnArgs;
+        spawnArgs.m_completionCallback = callback;
+        spawnArgs.m_reusePooledEntities = true;
+        AzFramework::DespawnAllEntitiesOptionalArgs despawnArgs;
+        despawnArgs.m_returnEntitiesToPool = true;
+        m_manager->SpawnAllEntities(*m_ticket, spawnArgs);
+        m_manager->DespawnAllEntities(*m_ticket, despawnArgs);
+        m_manager->SpawnAllEntities(*m_ticket, spawnArgs);
+        m_manager->ProcessQueue(AzFramework::SpawnableEntitiesManager::CommandQueuePriority::Regular);
+
+        ASSERT_EQ(NumEntities * 2, spawnedIds.size());
+        for (size_t i = 0; i < NumEntities; ++i)
+        {
+            EXPECT_NE(spawnedIds[i], spawnedIds[i + NumEntities]);
+        }
+    }
+
     TEST_F(SpawnableEntitiesManagerTest, SpawnEntities_Call_AllEntitiesSpawned)
     {
         static constexpr size_t NumEntities = 4;
@@ -13,6 +13,7 @@
 #include <AzCore/std/string/conversions.h>
 #include <AzFramework/Driller/RemoteDrillerInterface.h>
 #include <AzFramework/Driller/DrillToFileComponent.h>
+#include <AzFramework/Input/System/InputSystemComponent.h>
 #include <GridMate/Drillers/CarrierDriller.h>
 #include <GridMate/Drillers/ReplicaDriller.h>
 #include <AzFramework/TargetManagement/TargetManagementComponent.h>
@@ -34,6 +35,16 @@ namespace AzGameFramework
     {
     }
 
+    void GameApplication::SetHeadless(bool headless)
+    {
+        m_headless = headless;
+    }
+
+    bool GameApplication::IsHeadless() const
+    {
+        return m_headless;
+    }
+
     void GameApplication::StartCommon(AZ::Entity* systemEntity)
     {
         AzFramework::Application::StartCommon(systemEntity);
@@ -66,12 +77,19 @@ namespace AzGameFramework
         // Used the lowercase the platform name since the bootstrap.game.<config>.<platform>.setreg is being loaded
         // from the asset cache root where all the files are in lowercased from regardless of the filesystem case-sensitivity
         static constexpr char filename[] = "bootstrap.game." AZ_BUILD_CONFIGURATION_TYPE "." AZ_TRAIT_OS_PLATFORM_CODENAME_LOWER ".setreg";
+        // The same settings in the compiled format, which is loaded without parsing JSON. Older caches might not have it yet.
+        static constexpr char compiledFilename[] = "bootstrap.game." AZ_BUILD_CONFIGURATION_TYPE "." AZ_TRAIT_OS_PLATFORM_CODENAME_LOWER ".setregbin";
 
         AZ::IO::FixedMaxPath cacheRootPath;
         if (registry.Get(cacheRootPath.Native(), AZ::SettingsRegistryMergeUtils::FilePathKey_CacheRootFolder))
         {
-            cacheRootPath /= filename;
-            registry.MergeSettingsFile(cacheRootPath.Native(), AZ::SettingsRegistryInterface::Format::JsonMergePatch, "", &scratchBuffer);
+            AZ::IO::FixedMaxPath compiledPath = cacheRootPath / compiledFilename;
+            if (!AZ::IO::SystemFile::Exists(compiledPath.c_str()) ||
+                !registry.MergeSettingsFile(compiledPath.Native(), AZ::SettingsRegistryInterface::Format::Compiled, "", &scratchBuffer))
+            {
+                cacheRootPath /= filename;
+                registry.MergeSettingsFile(cacheRootPath.Native(), AZ::SettingsRegistryInterface::Format::JsonMergePatch, "", &scratchBuffer);
+            }
         }
 
 #if defined(AZ_DEBUG_BUILD) || defined(AZ_PROFILE_BUILD)
@@ -88,6 +106,13 @@ namespace AzGameFramework
     {
         AZ::ComponentTypeList components = Application::GetRequiredSystemComponents();
 
+        if (m_headless)
+        {
+            // There are no input devices to poll without a window or a player
+            components.erase(
+                AZStd::remove(components.begin(), components.end(), azrtti_typeid<AzFramework::InputSystemComponent>()), components.end());
+        }
+
 #if !defined(_RELEASE)
         components.emplace_back(azrtti_typeid<AzFramework::TargetManagementComponent>());
 #endif
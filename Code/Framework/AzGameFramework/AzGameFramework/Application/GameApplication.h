@@ -23,6 +23,11 @@ namespace AzGameFramework
         GameApplication(int argc, char** argvS);
         ~GameApplication();
 
+        //! Headless applications, such as dedicated servers, don't create the client only system components like input.
+        //! Must be set before the application is started.
+        void SetHeadless(bool headless);
+        bool IsHeadless() const;
+
         AZ::ComponentTypeList GetRequiredSystemComponents() const override;
         void CreateStaticModules(AZStd::vector<AZ::Module*>& outModules) override;
 
@@ -41,6 +46,9 @@ namespace AzGameFramework
         // game.*.setreg instead. In non-release builds this will still load the dev user settings and the command line settings.
         void MergeSettingsToRegistry(AZ::SettingsRegistryInterface& registry) override;
         //////////////////////////////////////////////////////////////////////////
+
+    private:
+        bool m_headless = false;
     };
 } // namespace AzGameFramework
 
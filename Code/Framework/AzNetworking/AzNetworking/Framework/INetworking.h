@@ -74,12 +74,12 @@ namespace AzNetworking
         //! @return the raw network interfaces owned by the networking instance
         virtual const NetworkInterfaces& GetNetworkInterfaces() const = 0;
 
-        //! Returns the number of sockets monitored by our TcpListenThread.
-        //! @return the number of sockets monitored by our TcpListenThread
+        //! Returns the number of sockets monitored by our TcpListenThreads.
+        //! @return the number of sockets monitored by our TcpListenThreads
         virtual uint32_t GetTcpListenThreadSocketCount() const = 0;
 
-        //! Returns the total time spent updating our TcpListenThread.
-        //! @return the total time spent updating our TcpListenThread
+        //! Returns the total time spent updating our TcpListenThreads.
+        //! @return the total time spent updating our TcpListenThreads
         virtual AZ::TimeMs GetTcpListenThreadUpdateTime() const = 0;
 
         //! Returns the number of sockets monitored by our UdpReaderThread.
@@ -16,6 +16,20 @@
 
 namespace AzNetworking
 {
+    AZ_CVAR(uint32_t, net_TcpListenThreadCount, 1, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "Number of threads accepting incoming Tcp connections, each with its own listen socket sharing the port. Must be set on the command line");
+
+    static UdpNetworkInterface* FindUdpNetworkInterface(const NetworkInterfaces& networkInterfaces, AZStd::string_view name)
+    {
+        const auto iter = networkInterfaces.find(AZ::Name(name));
+        if ((iter == networkInterfaces.end()) || (iter->second->GetType() != ProtocolType::Udp))
+        {
+            AZLOG_WARN("No Udp network interface named %.*s", aznumeric_cast<int32_t>(name.size()), name.data());
+            return nullptr;
+        }
+        return static_cast<UdpNetworkInterface*>(iter->second.get());
+    }
+
     void NetworkingSystemComponent::Reflect(AZ::ReflectContext* context)
     {
         if (AZ::SerializeContext* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
@@ -41,7 +55,18 @@ namespace AzNetworking
         EncryptionLayerInit();
         AZ::Interface<INetworking>::Register(this);
 
-        m_listenThread = AZStd::make_unique<TcpListenThread>();
+        uint32_t listenThreadCount = AZStd::max<uint32_t>(net_TcpListenThreadCount, 1);
+#if !AZ_TRAIT_USE_SOCKET_REUSE_PORT
+        if (listenThreadCount > 1)
+        {
+            AZLOG_WARN("Sharing a listen port between threads is not supported on this platform, using a single TcpListenThread");
+            listenThreadCount = 1;
+        }
+#endif
+        for (uint32_t i = 0; i < listenThreadCount; ++i)
+        {
+            m_listenThreads.emplace_back(AZStd::make_unique<TcpListenThread>());
+        }
         m_readerThread = AZStd::make_unique<UdpReaderThread>();
     }
 
@@ -53,7 +78,7 @@ namespace AzNetworking
         m_compressorFactories.clear();
 
         m_readerThread = nullptr;
-        m_listenThread = nullptr;
+        m_listenThreads.clear();
 
         AZ::Interface<INetworking>::Unregister(this);
         EncryptionLayerShutdown();
@@ -93,7 +118,7 @@ namespace AzNetworking
         switch (protocolType)
         {
         case ProtocolType::Tcp:
-            result = AZStd::make_unique<TcpNetworkInterface>(name, listener, trustZone, *m_listenThread);
+            result = AZStd::make_unique<TcpNetworkInterface>(name, listener, trustZone, m_listenThreads);
             break;
         case ProtocolType::Udp:
             result = AZStd::make_unique<UdpNetworkInterface>(name, listener, trustZone, *m_readerThread);
@@ -152,12 +177,22 @@ namespace AzNetworking
 
     uint32_t NetworkingSystemComponent::GetTcpListenThreadSocketCount() const
     {
-        return m_listenThread->GetSocketCount();
+        uint32_t socketCount = 0;
+        for (const AZStd::unique_ptr<TcpListenThread>& listenThread : m_listenThreads)
+        {
+            socketCount += listenThread->GetSocketCount();
+        }
+        return socketCount;
     }
 
     AZ::TimeMs NetworkingSystemComponent::GetTcpListenThreadUpdateTime() const
     {
-        return m_listenThread->GetUpdateTimeMs();
+        AZ::TimeMs updateTimeMs = AZ::TimeMs{ 0 };
+        for (const AZStd::unique_ptr<TcpListenThread>& listenThread : m_listenThreads)
+        {
+            updateTimeMs += listenThread->GetUpdateTimeMs();
+        }
+        return updateTimeMs;
     }
 
     uint32_t NetworkingSystemComponent::GetUdpReaderThreadSocketCount() const
@@ -201,4 +236,54 @@ namespace AzNetworking
             AZLOG_INFO(" - Total packets discarded due to load: %llu", aznumeric_cast<AZ::u64>(metrics.m_discardedPackets));
         }
     }
+
+    void NetworkingSystemComponent::StartUdpCapture(const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (arguments.size() < 2)
+        {
+            AZLOG_WARN("StartUdpCapture requires a network interface name and a capture file path");
+            return;
+        }
+
+        if (UdpNetworkInterface* networkInterface = FindUdpNetworkInterface(m_networkInterfaces, arguments[0]))
+        {
+            const AZStd::string filePath(arguments[1]);
+            if (networkInterface->GetPacketCapture().StartRecording(filePath.c_str(), AZ::GetElapsedTimeMs()))
+            {
+                AZLOG_INFO("Recording datagrams received by %s to %s", networkInterface->GetName().GetCStr(), filePath.c_str());
+            }
+        }
+    }
+
+    void NetworkingSystemComponent::StopUdpCapture(const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (arguments.empty())
+        {
+            AZLOG_WARN("StopUdpCapture requires a network interface name");
+            return;
+        }
+
+        if (UdpNetworkInterface* networkInterface = FindUdpNetworkInterface(m_networkInterfaces, arguments[0]))
+        {
+            networkInterface->GetPacketCapture().StopRecording();
+        }
+    }
+
+    void NetworkingSystemComponent::ReplayUdpCapture(const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (arguments.size() < 2)
+        {
+            AZLOG_WARN("ReplayUdpCapture requires a network interface name and a capture file path");
+            return;
+        }
+
+        if (UdpNetworkInterface* networkInterface = FindUdpNetworkInterface(m_networkInterfaces, arguments[0]))
+        {
+            const AZStd::string filePath(arguments[1]);
+            if (networkInterface->GetPacketCapture().StartReplay(filePath.c_str(), AZ::GetElapsedTimeMs()))
+            {
+                AZLOG_INFO("Replaying %s into %s", filePath.c_str(), networkInterface->GetName().GetCStr());
+            }
+        }
+    }
 }
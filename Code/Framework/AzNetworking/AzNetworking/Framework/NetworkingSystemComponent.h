@@ -69,14 +69,20 @@ namespace AzNetworking
         //! Console commands.
         //! @{
         void DumpStats(const AZ::ConsoleCommandContainer& arguments);
+        void StartUdpCapture(const AZ::ConsoleCommandContainer& arguments);
+        void StopUdpCapture(const AZ::ConsoleCommandContainer& arguments);
+        void ReplayUdpCapture(const AZ::ConsoleCommandContainer& arguments);
         //! @}
 
     private:
 
         AZ_CONSOLEFUNC(NetworkingSystemComponent, DumpStats, AZ::ConsoleFunctorFlags::Null, "Dumps stats for all instantiated network interfaces");
+        AZ_CONSOLEFUNC(NetworkingSystemComponent, StartUdpCapture, AZ::ConsoleFunctorFlags::DontReplicate, "Records the datagrams received by a Udp network interface to a capture file: StartUdpCapture <interface> <file>");
+        AZ_CONSOLEFUNC(NetworkingSystemComponent, StopUdpCapture, AZ::ConsoleFunctorFlags::DontReplicate, "Stops recording the datagrams received by a Udp network interface: StopUdpCapture <interface>");
+        AZ_CONSOLEFUNC(NetworkingSystemComponent, ReplayUdpCapture, AZ::ConsoleFunctorFlags::DontReplicate, "Replays a capture file into a Udp network interface as if its datagrams were received again: ReplayUdpCapture <interface> <file>");
 
         NetworkInterfaces m_networkInterfaces;
-        AZStd::unique_ptr<TcpListenThread> m_listenThread;
+        TcpListenThreads m_listenThreads;
         AZStd::unique_ptr<UdpReaderThread> m_readerThread;
 
         using CompressionFactories = AZStd::unordered_map<AZ::Name, AZStd::unique_ptr<ICompressorFactory>>;
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzNetworking/Serialization/DeltaSerializer.h>
+#include <AzNetworking/ConnectionLayer/IConnection.h>
+#include <AzNetworking/Utilities/NetworkCommon.h>
+#include <AzCore/Console/ILogger.h>
+#include <AzCore/std/containers/array.h>
+
+namespace AzNetworking
+{
+    //! DeltaBaselineSender
+    //! Serializes successive states of an object as deltas against the newest state the remote endpoint acknowledged.
+    //! The last MAX_BASELINES sent states are kept, and a state only becomes a baseline once the packet it was sent in is
+    //! acked, so a lost packet never leaves the remote endpoint without the baseline a later delta refers to.
+    //! States are sent in full until a baseline is acked, or if the acked baseline has been pushed out of the history.
+    //! The remote endpoint decodes the states with a DeltaBaselineReceiver of the same MAX_BASELINES.
+    //! NOTE: TYPE must satisfy the DeltaSerializerCreate requirements, a consistent serialization footprint
+    template <typename TYPE, AZStd::size_t MAX_BASELINES>
+    class DeltaBaselineSender
+    {
+    public:
+        static_assert(MAX_BASELINES > 0 && MAX_BASELINES <= 0xFFFF, "MAX_BASELINES must fit in a 16 bit state id");
+
+        //! Serializes current as a delta against the newest acked baseline, or in full if there is none.
+        //! current is recorded as a baseline candidate, call OnPacketSent with the packet it ends up in.
+        //! @param current    the state to serialize
+        //! @param serializer the serializer to write to
+        //! @return boolean true on success
+        bool Serialize(TYPE& current, ISerializer& serializer);
+
+        //! Associates the state last passed to Serialize with the packet it was sent in.
+        //! @param packetId the id of the packet carrying the state
+        void OnPacketSent(PacketId packetId);
+
+        //! Makes the state sent in the given packet the baseline if it is newer than the current baseline.
+        //! @param packetId the id of the acked packet
+        void OnPacketAcked(PacketId packetId);
+
+        //! Polls the connection for acks of the states sent since the current baseline.
+        //! @param connection the connection the states are sent on
+        void UpdateAcks(const IConnection& connection);
+
+        //! @return true if there's an acked baseline to delta against
+        bool HasBaseline() const;
+
+        //! Forgets all sent states, the next state is sent in full.
+        void Reset();
+
+    private:
+
+        static constexpr AZStd::size_t InvalidIndex = MAX_BASELINES;
+
+        struct Baseline
+        {
+            TYPE m_state;
+            PacketId m_packetId = InvalidPacketId;
+            uint32_t m_sequence = 0;
+        };
+
+        AZStd::array<Baseline, MAX_BASELINES> m_baselines;
+        AZStd::size_t m_nextIndex = 0;
+        AZStd::size_t m_pendingIndex = InvalidIndex;
+        AZStd::size_t m_ackedIndex = InvalidIndex;
+        uint32_t m_nextSequence = 0;
+    };
+
+    //! DeltaBaselineReceiver
+    //! Deserializes states written by a DeltaBaselineSender of the same MAX_BASELINES, keeping the last MAX_BASELINES
+    //! received states so deltas can be applied to the baseline the sender picked.
+    template <typename TYPE, AZStd::size_t MAX_BASELINES>
+    class DeltaBaselineReceiver
+    {
+    public:
+        static_assert(MAX_BASELINES > 0 && MAX_BASELINES <= 0xFFFF, "MAX_BASELINES must fit in a 16 bit state id");
+
+        //! Deserializes a state and records it as a baseline for later deltas.
+        //! @param serializer the serializer to read from
+        //! @param outState   the deserialized state
+        //! @return boolean true on success, false if the serializer failed or the state refers to an unknown baseline
+        bool Serialize(ISerializer& serializer, TYPE& outState);
+
+        //! Forgets all received states.
+        void Reset();
+
+    private:
+
+        struct Baseline
+        {
+            TYPE m_state;
+            uint16_t m_stateId = 0;
+            bool m_isValid = false;
+        };
+
+        AZStd::array<Baseline, MAX_BASELINES> m_baselines;
+        AZStd::size_t m_nextIndex = 0;
+    };
+}
+
+#include <AzNetworking/Serialization/DeltaBaselineTracker.inl>
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+namespace AzNetworking
+{
+    template <typename TYPE, AZStd::size_t MAX_BASELINES>
+    inline bool DeltaBaselineSender<TYPE, MAX_BASELINES>::Serialize(TYPE& current, ISerializer& serializer)
+    {
+        bool hasBaseline = HasBaseline();
+        uint16_t stateId = static_cast<uint16_t>(m_nextSequence);
+        serializer.Serialize(hasBaseline, "HasBaseline");
+        serializer.Serialize(stateId, "StateId");
+        if (hasBaseline)
+        {
+            Baseline& baseline = m_baselines[m_ackedIndex];
+            uint16_t baselineId = static_cast<uint16_t>(baseline.m_sequence);
+            serializer.Serialize(baselineId, "BaselineId");
+
+            SerializerDelta delta;
+            DeltaSerializerCreate createSerializer(delta);
+            if (!createSerializer.CreateDelta(baseline.m_state, current))
+            {
+                return false;
+            }
+            serializer.Serialize(delta, "Delta");
+        }
+        else
+        {
+            serializer.Serialize(current, "State");
+        }
+
+        if (!serializer.IsValid())
+        {
+            return false;
+        }
+
+        // The oldest state is replaced, if that was the baseline the next states go out in full until a newer one is acked
+        if (m_ackedIndex == m_nextIndex)
+        {
+            m_ackedIndex = InvalidIndex;
+        }
+
+        Baseline& sent = m_baselines[m_nextIndex];
+        sent.m_state = current;
+        sent.m_packetId = InvalidPacketId;
+        sent.m_sequence = m_nextSequence++;
+        m_pendingIndex = m_nextIndex;
+        m_nextIndex = (m_nextIndex + 1) % MAX_BASELINES;
+        return true;
+    }
+
+    template <typename TYPE, AZStd::size_t MAX_BASELINES>
+    inline void DeltaBaselineSender<TYPE, MAX_BASELINES>::OnPacketSent(PacketId packetId)
+    {
+        if (m_pendingIndex != InvalidIndex)
+        {
+            m_baselines[m_pendingIndex].m_packetId = packetId;
+            m_pendingIndex = InvalidIndex;
+        }
+    }
+
+    template <typename TYPE, AZStd::size_t MAX_BASELINES>
+    inline void DeltaBaselineSender<TYPE, MAX_BASELINES>::OnPacketAcked(PacketId packetId)
+    {
+        for (AZStd::size_t index = 0; index < MAX_BASELINES; ++index)
+        {
+            const Baseline& baseline = m_baselines[index];
+            if ((packetId == InvalidPacketId) || (baseline.m_packetId != packetId))
+            {
+                continue;
+            }
+
+            // Sequences only increase, so a newer state always wins over an older ack that arrives late
+            if ((m_ackedIndex == InvalidIndex) || (baseline.m_sequence > m_baselines[m_ackedIndex].m_sequence))
+            {
+                m_ackedIndex = index;
+            }
+        }
+    }
+
+    template <typename TYPE, AZStd::size_t MAX_BASELINES>
+    inline void DeltaBaselineSender<TYPE, MAX_BASELINES>::UpdateAcks(const IConnection& connection)
+    {
+        const uint32_t ackedSequence = (m_ackedIndex != InvalidIndex) ? m_baselines[m_ackedIndex].m_sequence : 0;
+        for (const Baseline& baseline : m_baselines)
+        {
+            const bool isNewer = (m_ackedIndex == InvalidIndex) || (baseline.m_sequence > ackedSequence);
+            if (isNewer && (baseline.m_packetId != InvalidPacketId) && connection.WasPacketAcked(baseline.m_packetId))
+            {
+                OnPacketAcked(baseline.m_packetId);
+            }
+        }
+    }
+
+    template <typename TYPE, AZStd::size_t MAX_BASELINES>
+    inline bool DeltaBaselineSender<TYPE, MAX_BASELINES>::HasBaseline() const
+    {
+        return m_ackedIndex != InvalidIndex;
+    }
+
+    template <typename TYPE, AZStd::size_t MAX_BASELINES>
+    inline void DeltaBaselineSender<TYPE, MAX_BASELINES>::Reset()
+    {
+        for (Baseline& baseline : m_baselines)
+        {
+            baseline.m_packetId = InvalidPacketId;
+        }
+        m_pendingIndex = InvalidIndex;
+        m_ackedIndex = InvalidIndex;
+    }
+
+    template <typename TYPE, AZStd::size_t MAX_BASELINES>
+    inline bool DeltaBaselineReceiver<TYPE, MAX_BASELINES>::Serialize(ISerializer& serializer, TYPE& outState)
+    {
+        bool hasBaseline = false;
+        uint16_t stateId = 0;
+        serializer.Serialize(hasBaseline, "HasBaseline");
+        serializer.Serialize(stateId, "StateId");
+        if (hasBaseline)
+        {
+            uint16_t baselineId = 0;
+            serializer.Serialize(baselineId, "BaselineId");
+
+            const Baseline* baseline = nullptr;
+            for (const Baseline& candidate : m_baselines)
+            {
+                if (candidate.m_isValid && (candidate.m_stateId == baselineId))
+                {
+                    baseline = &candidate;
+                    break;
+                }
+            }
+
+            if (baseline == nullptr)
+            {
+                AZLOG_WARN("Received a delta against unknown baseline %u", aznumeric_cast<uint32_t>(baselineId));
+                return false;
+            }
+
+            SerializerDelta delta;
+            serializer.Serialize(delta, "Delta");
+            if (!serializer.IsValid())
+            {
+                return false;
+            }
+
+            outState = baseline->m_state;
+            DeltaSerializerApply applySerializer(delta);
+            if (!applySerializer.ApplyDelta(outState))
+            {
+                return false;
+            }
+        }
+        else
+        {
+            serializer.Serialize(outState, "State");
+        }
+
+        if (!serializer.IsValid())
+        {
+            return false;
+        }
+
+        // Duplicated packets carry a state we already have
+        for (const Baseline& baseline : m_baselines)
+        {
+            if (baseline.m_isValid && (baseline.m_stateId == stateId))
+            {
+                return true;
+            }
+        }
+
+        Baseline& received = m_baselines[m_nextIndex];
+        received.m_state = outState;
+        received.m_stateId = stateId;
+        received.m_isValid = true;
+        m_nextIndex = (m_nextIndex + 1) % MAX_BASELINES;
+        return true;
+    }
+
+    template <typename TYPE, AZStd::size_t MAX_BASELINES>
+    inline void DeltaBaselineReceiver<TYPE, MAX_BASELINES>::Reset()
+    {
+        for (Baseline& baseline : m_baselines)
+        {
+            baseline.m_isValid = false;
+        }
+        m_nextIndex = 0;
+    }
+}
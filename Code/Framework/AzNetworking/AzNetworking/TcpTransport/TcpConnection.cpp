@@ -124,8 +124,11 @@ namespace AzNetworking
         const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
         GetMetrics().LogPacketRecv(0, startTimeMs);
 
-        // Read new data off the input socket
+        // Edge triggered socket managers only signal once when new data arrives, so keep reading until the socket would block
+        // Received packets are processed between reads so a fast sender can't overflow the receive ringbuffer
+        while (m_state != ConnectionState::Disconnected)
         {
+            // Read new data off the input socket, filling as much of the ringbuffer as is free
             uint8_t* srcData = m_recvRingbuffer.ReserveBlockForWrite(MaxPacketSize);
             if (srcData == nullptr)
             {
@@ -134,11 +137,11 @@ namespace AzNetworking
                 return false;
             }
 
-            const int32_t receivedBytes = m_socket->Receive(srcData, MaxPacketSize);
+            const int32_t receivedBytes = m_socket->Receive(srcData, m_recvRingbuffer.GetWriteBufferSize());
             if (receivedBytes == 0)
             {
-                // No data on the socket, can happen if we're not in select or epoll mode
-                return true;
+                // No more data on the socket
+                break;
             }
 
             const DisconnectReason disconnectReason = GetDisconnectReasonForSocketResult(receivedBytes);
@@ -150,43 +153,43 @@ namespace AzNetworking
             m_recvRingbuffer.AdvanceWriteBuffer(receivedBytes);
             m_networkInterface.GetMetrics().m_recvBytes += receivedBytes;
             m_networkInterface.GetMetrics().m_recvBytesUncompressed += receivedBytes;
-        }
-
-        // Process received packets
-        for (;;)
-        {
-            TcpPacketHeader header(PacketType(0), 0);
-            TcpPacketEncodingBuffer buffer;
 
-            if (!ReceivePacketInternal(header, buffer, startTimeMs))
+            // Process received packets
+            for (;;)
             {
-                break;
-            }
+                TcpPacketHeader header(PacketType(0), 0);
+                TcpPacketEncodingBuffer buffer;
 
-            TimeoutQueue::TimeoutItem* timeoutItem = m_networkInterface.m_connectionTimeoutQueue.RetrieveItem(GetTimeoutId());
-            if (timeoutItem == nullptr)
-            {
-                return true;
-            }
-            timeoutItem->UpdateTimeoutTime(startTimeMs);
+                if (!ReceivePacketInternal(header, buffer, startTimeMs))
+                {
+                    break;
+                }
 
-            NetworkOutputSerializer serializer(buffer.GetBuffer(), buffer.GetSize());
-            if (m_state == ConnectionState::Connecting)
-            {
-                const ConnectResult connectResult = m_networkInterface.GetConnectionListener().ValidateConnect(GetRemoteAddress(), header, serializer);
-                if (connectResult == ConnectResult::Rejected)
+                TimeoutQueue::TimeoutItem* timeoutItem = m_networkInterface.m_connectionTimeoutQueue.RetrieveItem(GetTimeoutId());
+                if (timeoutItem == nullptr)
                 {
-                    Disconnect(DisconnectReason::ConnectionRejected, TerminationEndpoint::Local);
+                    return true;
                 }
-                else
+                timeoutItem->UpdateTimeoutTime(startTimeMs);
+
+                NetworkOutputSerializer serializer(buffer.GetBuffer(), buffer.GetSize());
+                if (m_state == ConnectionState::Connecting)
                 {
-                    m_state = ConnectionState::Connected;
+                    const ConnectResult connectResult = m_networkInterface.GetConnectionListener().ValidateConnect(GetRemoteAddress(), header, serializer);
+                    if (connectResult == ConnectResult::Rejected)
+                    {
+                        Disconnect(DisconnectReason::ConnectionRejected, TerminationEndpoint::Local);
+                    }
+                    else
+                    {
+                        m_state = ConnectionState::Connected;
+                    }
                 }
-            }
 
-            if (m_state == ConnectionState::Connected)
-            {
-                m_networkInterface.GetConnectionListener().OnPacketReceived(this, header, serializer);
+                if (m_state == ConnectionState::Connected)
+                {
+                    m_networkInterface.GetConnectionListener().OnPacketReceived(this, header, serializer);
+                }
             }
         }
 
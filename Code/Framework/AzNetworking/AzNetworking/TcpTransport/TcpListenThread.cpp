@@ -27,7 +27,7 @@ namespace AzNetworking
         Join();
     }
 
-    bool TcpListenThread::Listen(TcpNetworkInterface& tcpNetworkInterface)
+    bool TcpListenThread::Listen(TcpNetworkInterface& tcpNetworkInterface, bool reusePort)
     {
         bool existsCheck = false;
         auto visitor = [&tcpNetworkInterface, &existsCheck](ListenPort& listenPort)
@@ -48,6 +48,7 @@ namespace AzNetworking
         ListenPort listenPort;
         listenPort.m_listenPort = tcpNetworkInterface.GetPort();
         listenPort.m_tcpNetworkInterface = &tcpNetworkInterface;
+        listenPort.m_reusePort = reusePort;
         m_listenPorts.PushBackItem(listenPort);
         AZLOG_INFO("TcpListenThread opening port: %d for incoming traffic", aznumeric_cast<int32_t>(listenPort.m_listenPort));
 
@@ -148,7 +149,7 @@ namespace AzNetworking
         {
             if (listenPort.m_tcpNetworkInterface && !listenPort.m_listenSocket.IsOpen())
             {
-                if (!listenPort.m_listenSocket.Listen(listenPort.m_listenPort))
+                if (!listenPort.m_listenSocket.Listen(listenPort.m_listenPort, listenPort.m_reusePort))
                 {
                     listenPort.m_listenSocket.Close();
                     result = false;
@@ -168,25 +169,32 @@ namespace AzNetworking
         struct sockaddr* newConnectionSockAddr = (struct sockaddr*)newConnection;
         const int32_t socketFdInt = aznumeric_cast<int32_t>(listenPort.m_listenSocket.GetSocketFd());
 
-        socklen_t newConnectionLengthSocklen = aznumeric_cast<socklen_t>(newConnectionLength);
-        const SocketFd newSocketFd = aznumeric_cast<SocketFd>(::accept(socketFdInt, newConnectionSockAddr, &newConnectionLengthSocklen));
-
-        if (newSocketFd <= SocketFd{ 0 })
+        // Edge triggered socket managers only signal once for a burst of incoming connections, so accept until the listen socket would block
+        for (;;)
         {
-            const int32_t error = GetLastNetworkError();
-            AZLOG_WARN("Failed to accept incoming connection (%d:%s)", error, GetNetworkErrorDesc(error));
-            return false;
-        }
+            socklen_t newConnectionLengthSocklen = aznumeric_cast<socklen_t>(newConnectionLength);
+            const SocketFd newSocketFd = aznumeric_cast<SocketFd>(::accept(socketFdInt, newConnectionSockAddr, &newConnectionLengthSocklen));
 
-        // Hand new connection off to a worker thread
-        struct sockaddr_in* newConnectionSockAddrIn = (struct sockaddr_in*)newConnection;
-        TcpNetworkInterface::PendingConnection pendingConnection(
-            newSocketFd,
-            newConnectionSockAddrIn->sin_addr.s_addr,
-            newConnectionSockAddrIn->sin_port,
-            listenPort.m_listenPort
-        );
-        listenPort.m_tcpNetworkInterface->QueueNewConnection(pendingConnection);
-        return true;
+            if (newSocketFd <= SocketFd{ 0 })
+            {
+                const int32_t error = GetLastNetworkError();
+                if (ErrorIsWouldBlock(error))
+                {
+                    return true;
+                }
+                AZLOG_WARN("Failed to accept incoming connection (%d:%s)", error, GetNetworkErrorDesc(error));
+                return false;
+            }
+
+            // Hand new connection off to a worker thread
+            struct sockaddr_in* newConnectionSockAddrIn = (struct sockaddr_in*)newConnection;
+            TcpNetworkInterface::PendingConnection pendingConnection(
+                newSocketFd,
+                newConnectionSockAddrIn->sin_addr.s_addr,
+                newConnectionSockAddrIn->sin_port,
+                listenPort.m_listenPort
+            );
+            listenPort.m_tcpNetworkInterface->QueueNewConnection(pendingConnection);
+        }
     }
 }
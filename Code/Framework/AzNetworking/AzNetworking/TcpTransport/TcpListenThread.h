@@ -13,6 +13,7 @@
 #include <AzNetworking/Framework/INetworkInterface.h>
 #include <AzNetworking/Utilities/TimedThread.h>
 #include <AzCore/Threading/ThreadSafeDeque.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 
 namespace AzNetworking
 {
@@ -30,8 +31,9 @@ namespace AzNetworking
 
         //! Opens a new listen socket capable of accepting incoming connections for the provided TcpNetworkInterface.
         //! @param tcpNetworkInterface the TcpNetworkInterface being opened to incoming connections
+        //! @param reusePort           if true, the port is shared with the listen sockets of other listen threads
         //! @return boolean true if the operation was successful, false if it failed
-        bool Listen(TcpNetworkInterface& tcpNetworkInterface);
+        bool Listen(TcpNetworkInterface& tcpNetworkInterface, bool reusePort);
 
         //! Stops listening for incoming connections for the provided TcpNetworkInterface.
         //! @param tcpNetworkInterface the TcpNetworkInterface being closed to new incoming connections
@@ -55,6 +57,7 @@ namespace AzNetworking
             TcpSocket m_listenSocket;
             TcpNetworkInterface* m_tcpNetworkInterface = nullptr;
             uint16_t m_listenPort;
+            bool m_reusePort = false;
         };
 
         void OnStart() override;
@@ -69,4 +72,6 @@ namespace AzNetworking
         AZ::ThreadSafeDeque<ListenPort> m_listenPorts;
         AZ::TimeMs m_updateTimeMs = AZ::TimeMs{ 0 };
     };
+
+    using TcpListenThreads = AZStd::vector<AZStd::unique_ptr<TcpListenThread>>;
 }
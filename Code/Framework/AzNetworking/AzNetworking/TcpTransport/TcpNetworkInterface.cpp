@@ -25,11 +25,11 @@ namespace AzNetworking
     AZ_CVAR(AZ::TimeMs, net_TcpHearthbeatTimeMs, AZ::TimeMs{  2 * 1000 }, nullptr, AZ::ConsoleFunctorFlags::Null, "Tcp connection heartbeat frequency");
     AZ_CVAR(AZ::TimeMs, net_TcpTimeoutTimeMs,    AZ::TimeMs{ 10 * 1000 }, nullptr, AZ::ConsoleFunctorFlags::Null, "Time in milliseconds before we timeout an idle Tcp connection");
 
-    TcpNetworkInterface::TcpNetworkInterface(AZ::Name name, IConnectionListener& connectionListener, TrustZone trustZone, TcpListenThread& listenThread)
+    TcpNetworkInterface::TcpNetworkInterface(AZ::Name name, IConnectionListener& connectionListener, TrustZone trustZone, TcpListenThreads& listenThreads)
         : m_name(name)
         , m_trustZone(trustZone)
         , m_connectionListener(connectionListener)
-        , m_listenThread(listenThread)
+        , m_listenThreads(listenThreads)
     {
         ;
     }
@@ -37,7 +37,10 @@ namespace AzNetworking
     TcpNetworkInterface::~TcpNetworkInterface()
     {
         FlushQueuedRemoves();
-        m_listenThread.StopListening(*this);
+        for (AZStd::unique_ptr<TcpListenThread>& listenThread : m_listenThreads)
+        {
+            listenThread->StopListening(*this);
+        }
     }
 
     AZ::Name TcpNetworkInterface::GetName() const
@@ -73,7 +76,15 @@ namespace AzNetworking
     bool TcpNetworkInterface::Listen(uint16_t port)
     {
         m_port = port;
-        return m_listenThread.Listen(*this);
+
+        // Each listen thread opens its own socket on the port, if there's more than one the kernel shards incoming connections between them
+        const bool reusePort = (m_listenThreads.size() > 1);
+        bool result = true;
+        for (AZStd::unique_ptr<TcpListenThread>& listenThread : m_listenThreads)
+        {
+            result &= listenThread->Listen(*this, reusePort);
+        }
+        return result;
     }
 
     ConnectionId TcpNetworkInterface::Connect(const IpAddress& remoteAddress)
@@ -161,7 +172,12 @@ namespace AzNetworking
     bool TcpNetworkInterface::StopListening()
     {
         m_port = 0;
-        return m_listenThread.StopListening(*this);
+        bool result = true;
+        for (AZStd::unique_ptr<TcpListenThread>& listenThread : m_listenThreads)
+        {
+            result &= listenThread->StopListening(*this);
+        }
+        return result;
     }
 
     bool TcpNetworkInterface::Disconnect(ConnectionId connectionId, DisconnectReason reason)
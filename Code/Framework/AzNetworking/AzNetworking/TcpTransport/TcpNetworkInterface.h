@@ -79,8 +79,8 @@ namespace AzNetworking
         //! @param name               the name of this network interface instance.
         //! @param connectionListener reference to the connection listener responsible for handling all connection events
         //! @param trustZone          the trust level assigned to this network interface, server to server or client to server
-        //! @param listenThread       the listen thread to bind to this network interface
-        TcpNetworkInterface(AZ::Name name, IConnectionListener& connectionListener, TrustZone trustZone, TcpListenThread& listenThread);
+        //! @param listenThreads      the listen threads to bind to this network interface, incoming connections are shared between them
+        TcpNetworkInterface(AZ::Name name, IConnectionListener& connectionListener, TrustZone trustZone, TcpListenThreads& listenThreads);
         ~TcpNetworkInterface() override;
 
         //! INetworkInterface interface.
@@ -160,7 +160,7 @@ namespace AzNetworking
         AZ::ThreadSafeDeque<PendingConnection> m_pendingConnections;
         AZStd::vector<PendingRemove> m_pendingRemoves;
         TimeoutQueue m_connectionTimeoutQueue;
-        TcpListenThread& m_listenThread;
+        TcpListenThreads& m_listenThreads;
 
         friend class TcpConnection; // For access to private RequestDisconnect() method
     };
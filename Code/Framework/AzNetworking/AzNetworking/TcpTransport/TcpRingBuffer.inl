@@ -23,6 +23,12 @@ namespace AzNetworking
         return m_impl.ReserveBlockForWrite(numBytes);
     }
 
+    template <uint32_t SIZE>
+    inline uint32_t TcpRingBuffer<SIZE>::GetWriteBufferSize() const
+    {
+        return m_impl.GetWriteBufferSize();
+    }
+
     template <uint32_t SIZE>
     inline uint8_t* TcpRingBuffer<SIZE>::GetReadBufferData() const
     {
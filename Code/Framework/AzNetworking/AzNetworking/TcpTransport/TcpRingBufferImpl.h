@@ -31,6 +31,10 @@ namespace AzNetworking
         //! @return pointer to the requested memory, nullptr if the requested size is too large for the ringbuffer to store contiguously
         uint8_t* ReserveBlockForWrite(uint32_t numBytes);
 
+        //! Returns the number of contiguous bytes available at the pointer returned by ReserveBlockForWrite.
+        //! @return the number of contiguous bytes free for writing
+        uint32_t GetWriteBufferSize() const;
+
         //! Returns the start of ringbuffer read memory.
         //! @return pointer to the start of ringbuffer read memory
         uint8_t* GetReadBufferData() const;
@@ -10,6 +10,11 @@
 
 namespace AzNetworking
 {
+    inline uint32_t TcpRingBufferImpl::GetWriteBufferSize() const
+    {
+        return GetFreeBytes();
+    }
+
     inline uint8_t* TcpRingBufferImpl::GetReadBufferData() const
     {
         return m_readPtr;
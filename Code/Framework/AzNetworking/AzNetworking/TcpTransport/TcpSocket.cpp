@@ -49,7 +49,7 @@ namespace AzNetworking
         return result;
     }
 
-    bool TcpSocket::Listen(uint16_t port)
+    bool TcpSocket::Listen(uint16_t port, bool reusePort)
     {
         Close();
 
@@ -58,7 +58,7 @@ namespace AzNetworking
             return false;
         }
 
-        if (!BindSocketForListenInternal(port))
+        if (!BindSocketForListenInternal(port, reusePort))
         {
             return false;
         }
@@ -160,8 +160,13 @@ namespace AzNetworking
         return receivedBytes;
     }
 
-    bool TcpSocket::BindSocketForListenInternal(uint16_t port)
+    bool TcpSocket::BindSocketForListenInternal(uint16_t port, bool reusePort)
     {
+        if (reusePort && !SetSocketReusePort(m_socketFd))
+        {
+            return false;
+        }
+
         // Handle binding
         {
             sockaddr_in hints;
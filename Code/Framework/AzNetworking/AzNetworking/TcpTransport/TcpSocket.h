@@ -37,9 +37,10 @@ namespace AzNetworking
         virtual bool IsEncrypted() const;
 
         //! Opens the TCP socket and binds it in listen mode.
-        //! @param port the port number to open the TCP socket and begin listening on, 0 will bind to any available port
+        //! @param port      the port number to open the TCP socket and begin listening on, 0 will bind to any available port
+        //! @param reusePort if true, other sockets may listen on the same port and incoming connections are shared between them
         //! @return boolean true on success
-        virtual bool Listen(uint16_t port);
+        virtual bool Listen(uint16_t port, bool reusePort = false);
 
         //! Opens the TCP socket and connects to the requested remote address.
         //! @param address the remote endpoint to connect to
@@ -80,7 +81,7 @@ namespace AzNetworking
         virtual int32_t SendInternal(const uint8_t* data, uint32_t size) const;
         virtual int32_t ReceiveInternal(uint8_t* outData, uint32_t size) const;
 
-        bool BindSocketForListenInternal(uint16_t port);
+        bool BindSocketForListenInternal(uint16_t port, bool reusePort);
         bool BindSocketForConnectInternal(const IpAddress& address);
         bool SocketCreateInternal();
 
@@ -52,6 +52,8 @@ namespace AzNetworking
 
     bool TcpSocketManager::ClearSocket(SocketFd socketFd)
     {
+        // Closing the socket would also deregister it, but only once every duplicate of the fd has been closed
+        epoll_ctl(static_cast<int32_t>(m_epollFd), EPOLL_CTL_DEL, static_cast<int32_t>(socketFd), nullptr);
         ClearSocketHelper(socketFd);
         return true;
     }
@@ -59,11 +61,14 @@ namespace AzNetworking
     void TcpSocketManager::ProcessEvents(AZ::TimeMs maxBlockMs, const SocketEventCallback& readCallback, const SocketEventCallback& writeCallback)
     {
         struct epoll_event socketEvents[MaxEpollEvents];
-        const int32_t numEpollEvents = epoll_wait(static_cast<int32_t>(m_epollFd), socketEvents, MaxEpollEvents, -1);
+        const int32_t numEpollEvents = epoll_wait(static_cast<int32_t>(m_epollFd), socketEvents, MaxEpollEvents, static_cast<int32_t>(maxBlockMs));
         if (numEpollEvents < 0)
         {
             const int32_t error = GetLastNetworkError();
-            AZLOG_ERROR("epoll_wait returned an error (%d:%s)", error, GetNetworkErrorDesc(error));
+            if (error != EINTR) // Interrupted by a signal, just try again next update
+            {
+                AZLOG_ERROR("epoll_wait returned an error (%d:%s)", error, GetNetworkErrorDesc(error));
+            }
         }
 
         if (numEpollEvents > 0)
@@ -71,7 +76,8 @@ namespace AzNetworking
             for (int32_t event = 0; event < numEpollEvents; ++event)
             {
                 const SocketFd socketFd = static_cast<SocketFd>(socketEvents[event].data.fd);
-                if (socketEvents[event].events & EPOLLIN)
+                // Errors and hangups are surfaced to the read callback, the following receive reports them
+                if (socketEvents[event].events & (EPOLLIN | EPOLLERR | EPOLLHUP))
                 {
                     readCallback(socketFd);
                 }
@@ -79,7 +79,7 @@ namespace AzNetworking
         return result;
     }
 
-    bool TlsSocket::Listen(uint16_t port)
+    bool TlsSocket::Listen(uint16_t port, bool reusePort)
     {
         Close();
 
@@ -98,7 +98,7 @@ namespace AzNetworking
             return false;
         }
 
-        if (!BindSocketForListenInternal(port))
+        if (!BindSocketForListenInternal(port, reusePort))
         {
             Close();
             return false;
@@ -38,9 +38,10 @@ namespace AzNetworking
         TcpSocket* CloneAndTakeOwnership() override;
 
         //! Opens the TCP socket and binds it in listen mode.
-        //! @param port the port number to open the TCP socket and begin listening on, 0 will bind to any available port
+        //! @param port      the port number to open the TCP socket and begin listening on, 0 will bind to any available port
+        //! @param reusePort if true, other sockets may listen on the same port and incoming connections are shared between them
         //! @return boolean true on success
-        bool Listen(uint16_t port) override;
+        bool Listen(uint16_t port, bool reusePort = false) override;
 
         //! Opens the TCP socket and connects to the requested remote address.
         //! @param address the remote endpoint to connect to
@@ -17,6 +17,11 @@
 #include <AzNetworking/Utilities/NetworkCommon.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Jobs/JobManagerBus.h>
 
 namespace AzNetworking
 {
@@ -30,6 +35,9 @@ namespace AzNetworking
 #endif
 
     AZ_CVAR(bool, net_UdpTimeoutConnections, true, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Boolean value on whether we should timeout Udp connections");
+    AZ_CVAR(bool, net_UdpBatchSends, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "If true, Udp packets are queued and sent together once per network interface update");
+    AZ_CVAR(uint32_t, net_UdpDecodeShardCount, 0, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Number of jobs to split connections across for decoding received Udp packets, 0 decodes all packets on the updating thread");
+    AZ_CVAR(uint32_t, net_UdpDecodeParallelMinPackets, 64, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Minimum number of received Udp packets in an update before they are decoded on multiple jobs");
     AZ_CVAR(AZ::TimeMs, net_UdpPacketTimeSliceMs, AZ::TimeMs{ 8 }, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The number of milliseconds to allow for packet processing");
     AZ_CVAR(AZ::TimeMs, net_UdpHearthbeatTimeMs, AZ::TimeMs{ 2 * 1000 }, nullptr, AZ::ConsoleFunctorFlags::Null, "Udp connection heartbeat frequency");
     AZ_CVAR(AZ::TimeMs, net_UdpTimeoutTimeMs, AZ::TimeMs{ 10 * 1000 }, nullptr, AZ::ConsoleFunctorFlags::Null, "Time in milliseconds before we timeout an idle Udp connection");
@@ -63,8 +71,9 @@ namespace AzNetworking
         , m_readerThread(readerThread)
     {
         const AZ::CVarFixedString compressor = static_cast<AZ::CVarFixedString>(net_UdpCompressor);
-        const AZ::Name compressorName = AZ::Name(compressor);
-        m_compressor = AZ::Interface<INetworking>::Get()->CreateCompressor(compressorName);
+        m_compressorName = AZ::Name(compressor);
+        m_compressor = AZ::Interface<INetworking>::Get()->CreateCompressor(m_compressorName);
+        m_socket->SetSendBatchingEnabled(net_UdpBatchSends);
     }
 
     UdpNetworkInterface::~UdpNetworkInterface()
@@ -171,9 +180,30 @@ namespace AzNetworking
         if (packets == nullptr)
         {
             // Socket is not yet registered with the reader thread and is likely still pending, try again later
+            m_socket->FlushSends();
             return;
         }
 
+        if (m_packetCapture.IsRecording())
+        {
+            for (const UdpReaderThread::ReceivedPacket& packet : *packets)
+            {
+                m_packetCapture.RecordPacket(packet, startTimeMs);
+            }
+        }
+
+        if (m_packetCapture.IsReplaying())
+        {
+            // Replayed datagrams are processed exactly like the ones the reader thread received
+            m_replayedPackets = *packets;
+            m_packetCapture.ReplayPackets(startTimeMs, m_replayedPackets);
+            packets = &m_replayedPackets;
+        }
+
+        m_decodedPackets.clear();
+        m_decodedPackets.resize(packets->size());
+        DecodeReceivedPacketsParallel(*packets);
+
         for (uint32_t i = 0; i < packets->size(); ++i)
         {
             const UdpReaderThread::ReceivedPacket& packet = (*packets)[i];
@@ -208,50 +238,31 @@ namespace AzNetworking
                 continue;
             }
 
-            int32_t decodedPacketSize = 0;
-            m_decryptBuffer.Resize(m_decryptBuffer.GetCapacity());
-            const uint8_t* decodedPacketData = connection->GetDtlsEndpoint().DecodePacket(*connection, packet.m_buffer, packet.m_receivedBytes, m_decryptBuffer.GetBuffer(), decodedPacketSize);
-            m_decryptBuffer.Resize(decodedPacketSize);
-
-            if (decodedPacketSize == 0)
+            DecodedPacket& decodedPacket = m_decodedPackets[i];
+            if (decodedPacket.m_connection != connection)
             {
-                // OpenSSL may have consumed packets during handshake negotiation
-                continue;
+                DecodeReceivedPacket(*connection, packet, m_compressor.get(), m_decryptBuffer, m_decompressBuffer, decodedPacket);
             }
-            else if (decodedPacketSize < 0)
+
+            if (decodedPacket.m_result == DecodeResult::Dropped)
             {
-                // Late unencrypted handshake packets or just random garbage can show up, discard and continue
                 continue;
             }
 
             connection->GetMetrics().LogPacketRecv(packet.m_receivedBytes + UdpPacketHeaderSize, currentTimeMs);
 
-            // Decode the packet flag bitset first since it's always uncompressed
-            UdpPacketHeader header;
+            if (decodedPacket.m_result == DecodeResult::FlagsFailed)
             {
-                NetworkOutputSerializer flagSerializer(decodedPacketData, decodedPacketSize);
-                if (!header.SerializePacketFlags(flagSerializer))
-                {
-                    continue;
-                }
-                // Adjust decoded tracking to represent the payload now that we've grabbed the flags
-                decodedPacketData = flagSerializer.GetUnreadData();
-                decodedPacketSize = flagSerializer.GetUnreadSize();
-                GetMetrics().m_recvBytesUncompressed += flagSerializer.GetReadSize();
+                continue;
             }
+            GetMetrics().m_recvBytesUncompressed += decodedPacket.m_flagsSize;
 
-            if (m_compressor && header.IsPacketFlagSet(PacketFlag::Compressed))
+            if (decodedPacket.m_result == DecodeResult::PayloadFailed)
             {
-                // Only the payload is compressed
-                if (!DecompressPacket(decodedPacketData, decodedPacketSize, m_decompressBuffer))
-                {
-                    AZLOG_WARN("Failed to decompress packet!");
-                    continue;
-                }
-                decodedPacketData = m_decompressBuffer.GetBuffer();
-                decodedPacketSize = m_decompressBuffer.GetSize();
+                AZLOG_WARN("Failed to decompress packet!");
+                continue;
             }
-            GetMetrics().m_recvBytesUncompressed += decodedPacketSize;
+            GetMetrics().m_recvBytesUncompressed += decodedPacket.m_uncompressedSize;
 
             TimeoutQueue::TimeoutItem* timeoutItem = m_connectionTimeoutQueue.RetrieveItem(connection->GetTimeoutId());
             if (timeoutItem == nullptr)
@@ -261,14 +272,14 @@ namespace AzNetworking
             }
             else
             {
-                // Deserialize the packet header
-                NetworkOutputSerializer packetSerializer(decodedPacketData, decodedPacketSize);
-                ISerializer& serializer = packetSerializer; // To get the default typeinfo parameters in ISerializer
-                if (!serializer.Serialize(header, "Header"))
+                if (decodedPacket.m_result == DecodeResult::HeaderFailed)
                 {
                     continue;
                 }
 
+                UdpPacketHeader& header = decodedPacket.m_header;
+                NetworkOutputSerializer packetSerializer(decodedPacket.m_payloadData, decodedPacket.m_payloadSize);
+
                 // Note that the serializer passed in here is unused for UDP
                 if (!connection->ProcessReceived(header, packetSerializer, packet.m_receivedBytes + UdpPacketHeaderSize, currentTimeMs))
                 {
@@ -331,6 +342,9 @@ namespace AzNetworking
         }
         m_removedConnections.clear();
 
+        // Send everything that was queued since the last update, including the acks and resends from this update
+        m_socket->FlushSends();
+
         // Update metrics
         GetMetrics().m_sendPackets = m_socket->GetSentPackets();
         GetMetrics().m_sendBytes = m_socket->GetSentBytes();
@@ -407,6 +421,11 @@ namespace AzNetworking
         return m_socket->IsOpen();
     }
 
+    UdpPacketCapture& UdpNetworkInterface::GetPacketCapture()
+    {
+        return m_packetCapture;
+    }
+
     void UdpNetworkInterface::RegisterWithTimeoutQueue(ConnectionId connectionId, PacketId packetId, ReliabilityType reliability, const ConnectionMetrics& metrics)
     {
         const float avgRtt = metrics.m_connectionRtt.GetRoundTripTimeSeconds(); // Time is in seconds, timeout times are in milliseconds
@@ -416,9 +435,9 @@ namespace AzNetworking
         m_packetTimeoutQueue.RegisterItem(ConstructTimeoutId(connectionId, packetId, reliability), packetTimeoutMs);
     }
 
-    bool UdpNetworkInterface::DecompressPacket(const uint8_t* packetBuffer, size_t packetSize, UdpPacketEncodingBuffer& packetBufferOut) const
+    bool UdpNetworkInterface::DecompressPacket(ICompressor* compressor, const uint8_t* packetBuffer, size_t packetSize, UdpPacketEncodingBuffer& packetBufferOut) const
     {
-        if (!m_compressor) // should probably have some compression handshake than relying on existence of compressor
+        if (!compressor) // should probably have some compression handshake than relying on existence of compressor
         {
             AZLOG_ERROR("Decompress called without a compressor.");
             return false;
@@ -428,7 +447,7 @@ namespace AzNetworking
         AZStd::size_t bytesConsumed = 0;
 
         packetBufferOut.Resize(packetBufferOut.GetCapacity());
-        const CompressorError compErr = m_compressor->Decompress(packetBuffer, packetSize, packetBufferOut.GetBuffer(), packetBufferOut.GetCapacity(), bytesConsumed, uncompSize);
+        const CompressorError compErr = compressor->Decompress(packetBuffer, packetSize, packetBufferOut.GetBuffer(), packetBufferOut.GetCapacity(), bytesConsumed, uncompSize);
         packetBufferOut.Resize(aznumeric_cast<uint32_t>(uncompSize)); // Decompress will fail if larger than buffer size, so this cast is safe
 
         if (compErr != CompressorError::Ok)
@@ -445,6 +464,188 @@ namespace AzNetworking
         return true;
     }
 
+    void UdpNetworkInterface::DecodeReceivedPacket
+    (
+        UdpConnection& connection,
+        const UdpReaderThread::ReceivedPacket& packet,
+        ICompressor* compressor,
+        UdpPacketEncodingBuffer& decryptBuffer,
+        UdpPacketEncodingBuffer& decompressBuffer,
+        DecodedPacket& outPacket
+    ) const
+    {
+        outPacket.m_result = DecodeResult::Dropped;
+
+        int32_t decodedPacketSize = 0;
+        decryptBuffer.Resize(decryptBuffer.GetCapacity());
+        const uint8_t* decodedPacketData = connection.GetDtlsEndpoint().DecodePacket(connection, packet.m_buffer, packet.m_receivedBytes, decryptBuffer.GetBuffer(), decodedPacketSize);
+        decryptBuffer.Resize(decodedPacketSize);
+
+        if (decodedPacketSize == 0)
+        {
+            // OpenSSL may have consumed packets during handshake negotiation
+            return;
+        }
+        else if (decodedPacketSize < 0)
+        {
+            // Late unencrypted handshake packets or just random garbage can show up, discard and continue
+            return;
+        }
+
+        // Decode the packet flag bitset first since it's always uncompressed
+        outPacket.m_result = DecodeResult::FlagsFailed;
+        {
+            NetworkOutputSerializer flagSerializer(decodedPacketData, decodedPacketSize);
+            if (!outPacket.m_header.SerializePacketFlags(flagSerializer))
+            {
+                return;
+            }
+            // Adjust decoded tracking to represent the payload now that we've grabbed the flags
+            decodedPacketData = flagSerializer.GetUnreadData();
+            decodedPacketSize = flagSerializer.GetUnreadSize();
+            outPacket.m_flagsSize = flagSerializer.GetReadSize();
+        }
+
+        if (compressor && outPacket.m_header.IsPacketFlagSet(PacketFlag::Compressed))
+        {
+            // Only the payload is compressed
+            if (!DecompressPacket(compressor, decodedPacketData, decodedPacketSize, decompressBuffer))
+            {
+                outPacket.m_result = DecodeResult::PayloadFailed;
+                return;
+            }
+            decodedPacketData = decompressBuffer.GetBuffer();
+            decodedPacketSize = decompressBuffer.GetSize();
+        }
+        outPacket.m_uncompressedSize = aznumeric_cast<uint32_t>(decodedPacketSize);
+
+        // Deserialize the packet header
+        NetworkOutputSerializer packetSerializer(decodedPacketData, decodedPacketSize);
+        ISerializer& serializer = packetSerializer; // To get the default typeinfo parameters in ISerializer
+        if (!serializer.Serialize(outPacket.m_header, "Header"))
+        {
+            outPacket.m_result = DecodeResult::HeaderFailed;
+            return;
+        }
+
+        outPacket.m_payloadData = packetSerializer.GetUnreadData();
+        outPacket.m_payloadSize = packetSerializer.GetUnreadSize();
+        outPacket.m_result = DecodeResult::Decoded;
+    }
+
+    void UdpNetworkInterface::DecodeReceivedPacketsParallel(const UdpReaderThread::ReceivedPackets& packets)
+    {
+        const uint32_t shardCount = net_UdpDecodeShardCount;
+        if (shardCount == 0 || packets.size() < net_UdpDecodeParallelMinPackets)
+        {
+            return;
+        }
+
+        AZ::JobContext* jobContext = nullptr;
+        AZ::JobManagerBus::BroadcastResult(jobContext, &AZ::JobManagerEvents::GetGlobalContext);
+        if (jobContext == nullptr)
+        {
+            return;
+        }
+
+        while (m_decodeShards.size() < shardCount)
+        {
+            AZStd::unique_ptr<DecodeShard> shard = AZStd::make_unique<DecodeShard>();
+            shard->m_scratchBuffer = AZStd::make_unique<UdpPacketEncodingBuffer>();
+            if (m_compressor)
+            {
+                shard->m_compressor = AZ::Interface<INetworking>::Get()->CreateCompressor(m_compressorName);
+            }
+            m_decodeShards.push_back(AZStd::move(shard));
+        }
+
+        for (AZStd::unique_ptr<DecodeShard>& shard : m_decodeShards)
+        {
+            shard->m_packetIndices.clear();
+            shard->m_usedPacketBuffers = 0;
+        }
+
+        // Only connected connections are decoded ahead of time, packets of connections that are still handshaking can
+        // change how the following packets have to be decrypted, so they're decoded in order during processing.
+        // All the packets of a connection go to the same shard so its DTLS state is only ever used by one job.
+        for (uint32_t i = 0; i < packets.size(); ++i)
+        {
+            const UdpReaderThread::ReceivedPacket& packet = packets[i];
+            UdpConnection* connection = m_connectionSet.GetConnection(packet.m_address);
+            if (connection == nullptr || connection->GetConnectionState() != ConnectionState::Connected ||
+                GetDisconnectReasonForSocketResult(packet.m_receivedBytes) != DisconnectReason::MAX)
+            {
+                continue;
+            }
+
+            m_decodedPackets[i].m_connection = connection;
+            const uint32_t shardIndex = aznumeric_cast<uint32_t>(connection->GetConnectionId()) % shardCount;
+            m_decodeShards[shardIndex]->m_packetIndices.push_back(i);
+        }
+
+        auto decodeShard = [this, &packets](DecodeShard& shard)
+        {
+            for (const uint32_t packetIndex : shard.m_packetIndices)
+            {
+                if (shard.m_usedPacketBuffers == shard.m_packetBuffers.size())
+                {
+                    shard.m_packetBuffers.push_back(AZStd::make_unique<UdpPacketEncodingBuffer>());
+                }
+                AZStd::unique_ptr<UdpPacketEncodingBuffer>& packetBuffer = shard.m_packetBuffers[shard.m_usedPacketBuffers];
+
+                // Decrypt into the pooled buffer and decompress into the scratch buffer, whichever one ends up holding the
+                // payload is kept for the rest of the update so the payload is never copied
+                const UdpReaderThread::ReceivedPacket& packet = packets[packetIndex];
+                DecodedPacket& decodedPacket = m_decodedPackets[packetIndex];
+                DecodeReceivedPacket(*decodedPacket.m_connection, packet, shard.m_compressor.get(), *packetBuffer, *shard.m_scratchBuffer, decodedPacket);
+                if (decodedPacket.m_result != DecodeResult::Decoded)
+                {
+                    continue;
+                }
+
+                const uint8_t* payloadData = decodedPacket.m_payloadData;
+                const uint8_t* scratchData = shard.m_scratchBuffer->GetBuffer();
+                if (payloadData >= scratchData && payloadData < scratchData + shard.m_scratchBuffer->GetCapacity())
+                {
+                    packetBuffer.swap(shard.m_scratchBuffer);
+                    ++shard.m_usedPacketBuffers;
+                }
+                else if (payloadData >= packetBuffer->GetBuffer() && payloadData < packetBuffer->GetBuffer() + packetBuffer->GetCapacity())
+                {
+                    ++shard.m_usedPacketBuffers;
+                }
+            }
+        };
+
+        AZStd::vector<DecodeShard*> activeShards;
+        for (AZStd::unique_ptr<DecodeShard>& shard : m_decodeShards)
+        {
+            if (!shard->m_packetIndices.empty())
+            {
+                activeShards.push_back(shard.get());
+            }
+        }
+
+        if (activeShards.empty())
+        {
+            return;
+        }
+
+        AZ::JobCompletion completion(jobContext);
+        for (size_t shardIndex = 1; shardIndex < activeShards.size(); ++shardIndex)
+        {
+            DecodeShard* shard = activeShards[shardIndex];
+            AZ::Job* job = AZ::CreateJobFunction([&decodeShard, shard]()
+                {
+                    decodeShard(*shard);
+                }, true, jobContext);
+            job->SetDependent(&completion);
+            job->Start();
+        }
+        decodeShard(*activeShards[0]);
+        completion.StartAndWaitForCompletion();
+    }
+
     PacketId UdpNetworkInterface::SendPacket(UdpConnection& connection, const IPacket& packet, SequenceId reliableSequence)
     {
         AZLOG(NET_DebugPacketSend, "Sending packet type %u to remote address %s", aznumeric_cast<uint32_t>(packet.GetPacketType()), connection.GetRemoteAddress().GetString().c_str());
@@ -11,6 +11,7 @@
 #include <AzNetworking/UdpTransport/UdpPacketHeader.h>
 #include <AzNetworking/UdpTransport/UdpConnectionSet.h>
 #include <AzNetworking/UdpTransport/UdpReaderThread.h>
+#include <AzNetworking/UdpTransport/UdpPacketCapture.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzNetworking/ConnectionLayer/ConnectionEnums.h>
 #include <AzNetworking/Framework/INetworkInterface.h>
@@ -114,6 +115,10 @@ namespace AzNetworking
         //! @return boolean true if this connection instance is in an open state
         bool IsOpen() const;
 
+        //! Returns the packet capture used to record received datagrams and to replay recorded ones into this interface.
+        //! @return reference to the packet capture owned by this network interface
+        UdpPacketCapture& GetPacketCapture();
+
     private:
 
         //! Registers a packet with a timeout queue on the provided connection.
@@ -124,11 +129,56 @@ namespace AzNetworking
         void RegisterWithTimeoutQueue(ConnectionId connectionId, PacketId packetId, ReliabilityType reliability, const ConnectionMetrics& metrics);
 
         //! Decompresses an incoming packet data buffer.
+        //! @param compressor      the compressor instance to decompress with
         //! @param packetBuffer    the compressed packet buffer to decode
         //! @param packetSize      the size of the compressed packet buffer
         //! @param packetBufferOut the decoded data
         //! @return boolean true on success, false on failure
-        bool DecompressPacket(const uint8_t* packetBuffer, size_t packetSize, UdpPacketEncodingBuffer& packetBufferOut) const;
+        bool DecompressPacket(ICompressor* compressor, const uint8_t* packetBuffer, size_t packetSize, UdpPacketEncodingBuffer& packetBufferOut) const;
+
+        //! How far a received packet got through decoding.
+        enum class DecodeResult
+        {
+            Dropped,       //!< Consumed by the DTLS handshake or not decodable, the packet isn't tracked at all
+            FlagsFailed,   //!< The packet flags could not be read
+            PayloadFailed, //!< The payload could not be decompressed
+            HeaderFailed,  //!< The packet header could not be read
+            Decoded
+        };
+
+        //! A received packet decrypted, decompressed and with its header read.
+        struct DecodedPacket
+        {
+            UdpConnection* m_connection = nullptr; //!< Connection the packet was decoded ahead of time for, nullptr if it wasn't
+            UdpPacketHeader m_header;
+            const uint8_t* m_payloadData = nullptr; //!< Serialized packet data following the header
+            uint32_t m_payloadSize = 0;
+            uint32_t m_flagsSize = 0;        //!< Size of the uncompressed packet flags
+            uint32_t m_uncompressedSize = 0; //!< Size of the header and payload after decompression
+            DecodeResult m_result = DecodeResult::Dropped;
+        };
+
+        //! Decrypts and decompresses a received packet and reads its header.
+        //! @param connection       the connection the packet was received on
+        //! @param packet           the received packet
+        //! @param compressor       the compressor to decompress the payload with
+        //! @param decryptBuffer    scratch buffer for the decrypted packet
+        //! @param decompressBuffer scratch buffer for the decompressed payload
+        //! @param outPacket        the decoded packet, the payload may point into either scratch buffer
+        void DecodeReceivedPacket
+        (
+            UdpConnection& connection,
+            const UdpReaderThread::ReceivedPacket& packet,
+            ICompressor* compressor,
+            UdpPacketEncodingBuffer& decryptBuffer,
+            UdpPacketEncodingBuffer& decompressBuffer,
+            DecodedPacket& outPacket
+        ) const;
+
+        //! Decodes the received packets of connected connections on the job system.
+        //! The connections are split across shards so every connection's packets are decoded in order by a single job.
+        //! @param packets the packets received this update
+        void DecodeReceivedPacketsParallel(const UdpReaderThread::ReceivedPackets& packets);
 
         //! Sends a packet to the remote connection.
         //! @param connection         the UdpConnection instance to send the packet on
@@ -186,6 +236,8 @@ namespace AzNetworking
         AZStd::unique_ptr<UdpSocket> m_socket;
         AZStd::unique_ptr<ICompressor> m_compressor;
         UdpReaderThread& m_readerThread;
+        UdpPacketCapture m_packetCapture;
+        UdpReaderThread::ReceivedPackets m_replayedPackets; //!< Received packets merged with replayed packets while a capture is replaying
 
         struct RemovedConnection
         {
@@ -198,6 +250,21 @@ namespace AzNetworking
         UdpPacketEncodingBuffer m_decryptBuffer;
         UdpPacketEncodingBuffer m_decompressBuffer;
 
+        //! Scratch state for decoding the packets of a subset of the connections on a job.
+        //! Packets are decoded straight into buffers from a pool owned by the shard, the pool is reused every update
+        //! so decoding only allocates when more packets than ever before need their own buffer.
+        struct DecodeShard
+        {
+            AZStd::unique_ptr<ICompressor> m_compressor; //!< Compressors keep state, so every shard has its own
+            AZStd::unique_ptr<UdpPacketEncodingBuffer> m_scratchBuffer;
+            AZStd::vector<AZStd::unique_ptr<UdpPacketEncodingBuffer>> m_packetBuffers;
+            uint32_t m_usedPacketBuffers = 0; //!< Number of pooled buffers holding a decoded packet this update
+            AZStd::vector<uint32_t> m_packetIndices;
+        };
+        AZ::Name m_compressorName;
+        AZStd::vector<AZStd::unique_ptr<DecodeShard>> m_decodeShards;
+        AZStd::vector<DecodedPacket> m_decodedPackets;
+
         friend class UdpReliableQueue;
         friend class UdpConnection; // For access to private RequestDisconnect() method
     };
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/UdpTransport/UdpPacketCapture.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkOutputSerializer.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Console/ILogger.h>
+
+namespace AzNetworking
+{
+    AZ_CVAR(float, net_UdpReplayTimeScale, 1.0f, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Scalar applied to the speed captured Udp traffic is replayed at, values above 1 replay faster than recorded");
+
+    UdpPacketCapture::~UdpPacketCapture()
+    {
+        StopRecording();
+    }
+
+    bool UdpPacketCapture::StartRecording(const char* filePath, AZ::TimeMs currentTimeMs)
+    {
+        StopRecording();
+
+        m_recordStream = AZStd::make_unique<AZ::IO::FileIOStream>(filePath, AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeBinary);
+        if (!m_recordStream->IsOpen())
+        {
+            AZLOG_ERROR("Failed to open Udp capture file %s for writing", filePath);
+            m_recordStream.reset();
+            return false;
+        }
+
+        uint32_t magic = CaptureMagic;
+        uint32_t version = CaptureVersion;
+        uint8_t fileHeader[sizeof(uint32_t) * 2];
+        NetworkInputSerializer fileSerializer(fileHeader, sizeof(fileHeader));
+        ISerializer& serializer = fileSerializer;
+        serializer.Serialize(magic, "Magic");
+        serializer.Serialize(version, "Version");
+        m_recordStream->Write(serializer.GetSize(), fileHeader);
+
+        m_recordBuffer.clear();
+        m_recordBuffer.reserve(RecordFlushSize * 2);
+        m_recordStartTimeMs = currentTimeMs;
+        return true;
+    }
+
+    void UdpPacketCapture::StopRecording()
+    {
+        if (m_recordStream == nullptr)
+        {
+            return;
+        }
+
+        FlushRecording();
+        m_recordStream->Close();
+        m_recordStream.reset();
+    }
+
+    bool UdpPacketCapture::IsRecording() const
+    {
+        return m_recordStream != nullptr;
+    }
+
+    void UdpPacketCapture::RecordPacket(const UdpReaderThread::ReceivedPacket& packet, AZ::TimeMs currentTimeMs)
+    {
+        if ((m_recordStream == nullptr) || (packet.m_receivedBytes <= 0))
+        {
+            return;
+        }
+
+        int64_t timeOffsetMs = static_cast<int64_t>(currentTimeMs - m_recordStartTimeMs);
+        uint32_t address = packet.m_address.GetAddress(ByteOrder::Host);
+        uint16_t port = packet.m_address.GetPort(ByteOrder::Host);
+        uint32_t receivedBytes = static_cast<uint32_t>(packet.m_receivedBytes);
+
+        uint8_t recordHeader[RecordHeaderSize];
+        NetworkInputSerializer recordSerializer(recordHeader, RecordHeaderSize);
+        ISerializer& serializer = recordSerializer;
+        serializer.Serialize(timeOffsetMs, "TimeOffsetMs");
+        serializer.Serialize(address, "Address");
+        serializer.Serialize(port, "Port");
+        serializer.Serialize(receivedBytes, "ReceivedBytes");
+
+        m_recordBuffer.insert(m_recordBuffer.end(), &recordHeader[0], &recordHeader[0] + serializer.GetSize());
+        m_recordBuffer.insert(m_recordBuffer.end(), packet.m_buffer, packet.m_buffer + receivedBytes);
+        if (m_recordBuffer.size() >= RecordFlushSize)
+        {
+            FlushRecording();
+        }
+    }
+
+    bool UdpPacketCapture::StartReplay(const char* filePath, AZ::TimeMs currentTimeMs)
+    {
+        StopReplay();
+
+        AZ::IO::FileIOStream stream(filePath, AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary);
+        if (!stream.IsOpen())
+        {
+            AZLOG_ERROR("Failed to open Udp capture file %s for reading", filePath);
+            return false;
+        }
+
+        m_replayData.resize_no_construct(stream.GetLength());
+        m_replayData.resize_no_construct(stream.Read(m_replayData.size(), m_replayData.data()));
+        stream.Close();
+
+        const uint32_t dataSize = aznumeric_cast<uint32_t>(m_replayData.size());
+        NetworkOutputSerializer fileSerializer(m_replayData.data(), dataSize);
+        uint32_t magic = 0;
+        uint32_t version = 0;
+        static_cast<ISerializer&>(fileSerializer).Serialize(magic, "Magic");
+        static_cast<ISerializer&>(fileSerializer).Serialize(version, "Version");
+        if (!fileSerializer.IsValid() || (magic != CaptureMagic) || (version != CaptureVersion))
+        {
+            AZLOG_ERROR("%s is not a supported Udp capture file", filePath);
+            StopReplay();
+            return false;
+        }
+
+        // Datagrams are handed out in place from m_replayData, so only their offsets are kept
+        uint32_t readOffset = fileSerializer.GetReadSize();
+        while (dataSize - readOffset >= RecordHeaderSize)
+        {
+            int64_t timeOffsetMs = 0;
+            uint32_t address = 0;
+            uint16_t port = 0;
+            uint32_t receivedBytes = 0;
+            NetworkOutputSerializer recordSerializer(m_replayData.data() + readOffset, RecordHeaderSize);
+            ISerializer& serializer = recordSerializer;
+            serializer.Serialize(timeOffsetMs, "TimeOffsetMs");
+            serializer.Serialize(address, "Address");
+            serializer.Serialize(port, "Port");
+            serializer.Serialize(receivedBytes, "ReceivedBytes");
+            readOffset += RecordHeaderSize;
+            if (!serializer.IsValid() || (receivedBytes > dataSize - readOffset))
+            {
+                break;
+            }
+
+            CapturedPacket& capturedPacket = m_replayPackets.emplace_back();
+            capturedPacket.m_timeOffsetMs = AZ::TimeMs{ timeOffsetMs };
+            capturedPacket.m_address = IpAddress(ByteOrder::Host, address, port);
+            capturedPacket.m_dataOffset = readOffset;
+            capturedPacket.m_receivedBytes = static_cast<int32_t>(receivedBytes);
+            readOffset += receivedBytes;
+        }
+
+        if (readOffset != dataSize)
+        {
+            // A capture that was cut short still replays up to the last complete datagram
+            AZLOG_WARN("Udp capture file %s is truncated, replaying %u datagrams", filePath, aznumeric_cast<uint32_t>(m_replayPackets.size()));
+        }
+
+        m_replayIndex = 0;
+        m_replayStartTimeMs = currentTimeMs;
+        return true;
+    }
+
+    void UdpPacketCapture::StopReplay()
+    {
+        m_replayData.clear();
+        m_replayPackets.clear();
+        m_replayIndex = 0;
+    }
+
+    bool UdpPacketCapture::IsReplaying() const
+    {
+        return m_replayIndex < m_replayPackets.size();
+    }
+
+    void UdpPacketCapture::ReplayPackets(AZ::TimeMs currentTimeMs, UdpReaderThread::ReceivedPackets& outPackets)
+    {
+        const float timeScale = AZStd::max(static_cast<float>(net_UdpReplayTimeScale), 0.0f);
+        const AZ::TimeMs replayTimeMs = AZ::TimeMs{ static_cast<int64_t>(static_cast<float>(currentTimeMs - m_replayStartTimeMs) * timeScale) };
+        while ((m_replayIndex < m_replayPackets.size()) && !outPackets.full())
+        {
+            const CapturedPacket& capturedPacket = m_replayPackets[m_replayIndex];
+            if (capturedPacket.m_timeOffsetMs > replayTimeMs)
+            {
+                break;
+            }
+
+            outPackets.emplace_back(capturedPacket.m_address, m_replayData.data() + capturedPacket.m_dataOffset, capturedPacket.m_receivedBytes);
+            ++m_replayIndex;
+        }
+    }
+
+    void UdpPacketCapture::FlushRecording()
+    {
+        if (!m_recordBuffer.empty())
+        {
+            m_recordStream->Write(m_recordBuffer.size(), m_recordBuffer.data());
+            m_recordBuffer.clear();
+        }
+    }
+}
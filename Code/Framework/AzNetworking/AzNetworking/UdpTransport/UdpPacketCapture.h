@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzNetworking/UdpTransport/UdpReaderThread.h>
+#include <AzNetworking/Utilities/IpAddress.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/Time/ITime.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AzNetworking
+{
+    //! @class UdpPacketCapture
+    //! @brief Records the raw datagrams received by a UdpNetworkInterface to a capture file, and plays a capture back.
+    //! Datagrams are captured exactly as they came off the socket, still compressed and encrypted, together with the
+    //! address they came from and the time they arrived. Replaying a capture feeds the datagrams back to the network
+    //! interface as if they had been received again with their original timing, so a recorded session can be used to
+    //! benchmark a server without any real clients.
+    class UdpPacketCapture
+    {
+    public:
+
+        UdpPacketCapture() = default;
+        ~UdpPacketCapture();
+
+        //! Starts recording received datagrams to a capture file, replacing any existing file.
+        //! @param filePath      path of the capture file to write
+        //! @param currentTimeMs the current process time in milliseconds, capture timestamps are relative to this
+        //! @return boolean true if the capture file could be opened
+        bool StartRecording(const char* filePath, AZ::TimeMs currentTimeMs);
+
+        //! Writes any buffered datagrams and closes the capture file.
+        void StopRecording();
+
+        //! @return true if received datagrams are being recorded
+        bool IsRecording() const;
+
+        //! Records a received datagram, datagrams that reported a socket error are skipped.
+        //! @param packet        the received datagram
+        //! @param currentTimeMs the current process time in milliseconds
+        void RecordPacket(const UdpReaderThread::ReceivedPacket& packet, AZ::TimeMs currentTimeMs);
+
+        //! Loads a capture file for replay, replay starts immediately.
+        //! @param filePath      path of the capture file to read
+        //! @param currentTimeMs the current process time in milliseconds, captured datagrams are due relative to this
+        //! @return boolean true if the capture file could be read
+        bool StartReplay(const char* filePath, AZ::TimeMs currentTimeMs);
+
+        //! Stops replaying and discards the loaded capture.
+        void StopReplay();
+
+        //! @return true if a capture is being replayed
+        bool IsReplaying() const;
+
+        //! Appends the captured datagrams due by currentTimeMs to outPackets, as many as outPackets has room for.
+        //! Datagrams that don't fit are returned by the next call. The returned datagrams point into the loaded capture,
+        //! and remain valid until the replay is stopped.
+        //! @param currentTimeMs the current process time in milliseconds
+        //! @param outPackets    the received datagrams to append the replayed datagrams to
+        void ReplayPackets(AZ::TimeMs currentTimeMs, UdpReaderThread::ReceivedPackets& outPackets);
+
+    private:
+
+        static constexpr uint32_t CaptureMagic = 0x43504455; // "UDPC"
+        static constexpr uint32_t CaptureVersion = 1;
+
+        //! Serialized size of the time offset, address, port and size preceding every captured datagram.
+        static constexpr uint32_t RecordHeaderSize = sizeof(int64_t) + sizeof(uint32_t) + sizeof(uint16_t) + sizeof(uint32_t);
+
+        //! Recorded datagrams are written to the file in chunks of roughly this size.
+        static constexpr AZStd::size_t RecordFlushSize = 64 * 1024;
+
+        struct CapturedPacket
+        {
+            AZ::TimeMs m_timeOffsetMs = AZ::TimeMs{ 0 };
+            IpAddress m_address;
+            uint32_t m_dataOffset = 0;
+            int32_t m_receivedBytes = 0;
+        };
+
+        void FlushRecording();
+
+        AZStd::unique_ptr<AZ::IO::FileIOStream> m_recordStream;
+        AZStd::vector<uint8_t> m_recordBuffer;
+        AZ::TimeMs m_recordStartTimeMs = AZ::TimeMs{ 0 };
+
+        AZStd::vector<uint8_t> m_replayData;
+        AZStd::vector<CapturedPacket> m_replayPackets;
+        AZStd::size_t m_replayIndex = 0;
+        AZ::TimeMs m_replayStartTimeMs = AZ::TimeMs{ 0 };
+    };
+}
@@ -167,6 +167,7 @@ namespace AzNetworking
             }
 
             ReceivedPackets& receivedPackets = socketEntry.m_receivedPackets;
+            UdpSocket::ReceiveDatagram datagrams[UdpSocket::MaxBatchedDatagrams];
             for (;;)
             {
                 AZ::TimeMs elapsedTimeMs = AZ::GetElapsedTimeMs() - startTimeMs;
@@ -176,8 +177,7 @@ namespace AzNetworking
                     break;
                 }
 
-                IpAddress address;
-                const uint32_t bufferHead = receiveBuffer.GetSize();
+                const uint32_t bufferHead = aznumeric_cast<uint32_t>(receiveBuffer.GetSize());
                 if (bufferHead + MaxUdpTransmissionUnit >= receiveBuffer.GetCapacity())
                 {
                     AZLOG_INFO("Receive buffer full, leaving data on the socket. Size exceeded by %d",
@@ -185,18 +185,38 @@ namespace AzNetworking
                     break;
                 }
 
+                if (receivedPackets.full())
+                {
+                    break;
+                }
+
+                // Receive as many datagrams as fit in both the receive buffer and the received packet list in a single call
+                const uint32_t freeSlots = aznumeric_cast<uint32_t>(receiveBuffer.GetCapacity() - bufferHead - 1) / MaxUdpTransmissionUnit;
+                const uint32_t freePackets = aznumeric_cast<uint32_t>(receivedPackets.capacity() - receivedPackets.size());
+                const uint32_t batchCount = AZStd::min(AZStd::min(freeSlots, freePackets), UdpSocket::MaxBatchedDatagrams);
                 uint8_t* dstData = receiveBuffer.GetBufferEnd();
-                receiveBuffer.Resize(bufferHead + MaxUdpTransmissionUnit);
+                for (uint32_t i = 0; i < batchCount; ++i)
+                {
+                    datagrams[i].m_data = dstData + i * MaxUdpTransmissionUnit;
+                    datagrams[i].m_size = MaxUdpTransmissionUnit;
+                }
+                receiveBuffer.Resize(bufferHead + batchCount * MaxUdpTransmissionUnit);
 
-                const int32_t receivedBytes = socket->Receive(address, dstData, MaxUdpTransmissionUnit);
-                if (receivedBytes > 0 && !receivedPackets.full())
+                const int32_t receivedCount = socket->ReceiveMultiple(datagrams, batchCount);
+
+                // Pack the received datagrams back to back so the unused part of each slot can hold the next batch
+                uint32_t bufferEnd = bufferHead;
+                for (int32_t i = 0; i < receivedCount; ++i)
                 {
-                    receivedPackets.push_back(ReceivedPacket(address, dstData, receivedBytes));
-                    receiveBuffer.Resize(bufferHead + receivedBytes);
+                    uint8_t* packetData = receiveBuffer.GetBuffer() + bufferEnd;
+                    memmove(packetData, datagrams[i].m_data, datagrams[i].m_receivedBytes);
+                    receivedPackets.push_back(ReceivedPacket(datagrams[i].m_address, packetData, datagrams[i].m_receivedBytes));
+                    bufferEnd += aznumeric_cast<uint32_t>(datagrams[i].m_receivedBytes);
                 }
-                else
+                receiveBuffer.Resize(bufferEnd);
+
+                if (receivedCount < aznumeric_cast<int32_t>(batchCount))
                 {
-                    receiveBuffer.Resize(bufferHead);
                     break;
                 }
             }
@@ -98,6 +98,7 @@ namespace AzNetworking
 
     void UdpSocket::Close()
     {
+        FlushSends();
         CloseSocket(m_socketFd);
         m_socketFd = InvalidSocketFd;
     }
@@ -175,6 +176,170 @@ namespace AzNetworking
         return sentBytes;
     }
 
+    int32_t UdpSocket::ReceiveMultiple(ReceiveDatagram* outDatagrams, uint32_t count) const
+    {
+        AZ_Assert(outDatagrams != nullptr || count == 0, "NULL datagram pointer passed to receive");
+
+        if (!IsOpen())
+        {
+            return 0;
+        }
+
+#if AZ_TRAIT_USE_SOCKET_MULTIPLE_MESSAGES
+        int32_t receivedCount = 0;
+        while (aznumeric_cast<uint32_t>(receivedCount) < count)
+        {
+            const uint32_t batchCount = AZStd::min(count - aznumeric_cast<uint32_t>(receivedCount), MaxBatchedDatagrams);
+            ReceiveDatagram* datagrams = outDatagrams + receivedCount;
+
+            mmsghdr messages[MaxBatchedDatagrams];
+            iovec buffers[MaxBatchedDatagrams];
+            sockaddr_in from[MaxBatchedDatagrams];
+            memset(messages, 0, sizeof(mmsghdr) * batchCount);
+            for (uint32_t i = 0; i < batchCount; ++i)
+            {
+                AZ_Assert(datagrams[i].m_size > 0, "Invalid data size for receive");
+                AZ_Assert(datagrams[i].m_data != nullptr, "NULL data pointer passed to receive");
+                buffers[i].iov_base = datagrams[i].m_data;
+                buffers[i].iov_len = datagrams[i].m_size;
+                messages[i].msg_hdr.msg_name = &from[i];
+                messages[i].msg_hdr.msg_namelen = sizeof(from[i]);
+                messages[i].msg_hdr.msg_iov = &buffers[i];
+                messages[i].msg_hdr.msg_iovlen = 1;
+            }
+
+            const int32_t batchReceived = recvmmsg(static_cast<int32_t>(m_socketFd), messages, batchCount, 0, nullptr);
+            if (batchReceived < 0)
+            {
+                const int32_t error = GetLastNetworkError();
+                if (!ErrorIsWouldBlock(error)) // Filter would block messages
+                {
+                    bool ignoreForciblyClosedError = false;
+                    if (ErrorIsForciblyClosed(error, ignoreForciblyClosedError))
+                    {
+                        if (!ignoreForciblyClosedError && receivedCount == 0)
+                        {
+                            return SocketOpResultError;
+                        }
+                    }
+                    else
+                    {
+                        AZLOG_ERROR("Failed to read from socket (%d:%s)", error, GetNetworkErrorDesc(error));
+                    }
+                }
+                break;
+            }
+
+            for (int32_t i = 0; i < batchReceived; ++i)
+            {
+                datagrams[i].m_address = IpAddress(ByteOrder::Network, from[i].sin_addr.s_addr, from[i].sin_port);
+                datagrams[i].m_receivedBytes = aznumeric_cast<int32_t>(messages[i].msg_len);
+                m_recvPackets++;
+                m_recvBytes += messages[i].msg_len;
+            }
+            receivedCount += batchReceived;
+
+            if (aznumeric_cast<uint32_t>(batchReceived) < batchCount)
+            {
+                // The socket has no more pending data
+                break;
+            }
+        }
+        return receivedCount;
+#else
+        int32_t receivedCount = 0;
+        for (; aznumeric_cast<uint32_t>(receivedCount) < count; ++receivedCount)
+        {
+            ReceiveDatagram& datagram = outDatagrams[receivedCount];
+            datagram.m_receivedBytes = Receive(datagram.m_address, datagram.m_data, datagram.m_size);
+            if (datagram.m_receivedBytes <= 0)
+            {
+                if (datagram.m_receivedBytes < 0 && receivedCount == 0)
+                {
+                    return datagram.m_receivedBytes;
+                }
+                break;
+            }
+        }
+        return receivedCount;
+#endif
+    }
+
+    void UdpSocket::SetSendBatchingEnabled(bool enabled)
+    {
+        if (!enabled)
+        {
+            FlushSends();
+        }
+        m_sendBatchingEnabled = enabled;
+        m_pendingSendBuffer.resize(enabled ? MaxBatchedDatagrams * MaxUdpTransmissionUnit : 0);
+    }
+
+    void UdpSocket::FlushSends() const
+    {
+        if (m_pendingSends.empty())
+        {
+            return;
+        }
+
+        if (!IsOpen())
+        {
+            m_pendingSends.clear();
+            return;
+        }
+
+#if AZ_TRAIT_USE_SOCKET_MULTIPLE_MESSAGES
+        mmsghdr messages[MaxBatchedDatagrams];
+        iovec buffers[MaxBatchedDatagrams];
+        sockaddr_in destAddrs[MaxBatchedDatagrams];
+        const uint32_t pendingCount = aznumeric_cast<uint32_t>(m_pendingSends.size());
+        memset(messages, 0, sizeof(mmsghdr) * pendingCount);
+        memset(destAddrs, 0, sizeof(sockaddr_in) * pendingCount);
+        for (uint32_t i = 0; i < pendingCount; ++i)
+        {
+            destAddrs[i].sin_family = AF_INET;
+            destAddrs[i].sin_addr.s_addr = m_pendingSends[i].m_address.GetAddress(ByteOrder::Network);
+            destAddrs[i].sin_port = m_pendingSends[i].m_address.GetPort(ByteOrder::Network);
+            buffers[i].iov_base = m_pendingSendBuffer.data() + i * MaxUdpTransmissionUnit;
+            buffers[i].iov_len = m_pendingSends[i].m_size;
+            messages[i].msg_hdr.msg_name = &destAddrs[i];
+            messages[i].msg_hdr.msg_namelen = sizeof(destAddrs[i]);
+            messages[i].msg_hdr.msg_iov = &buffers[i];
+            messages[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        // The call can return before every datagram was sent, in which case the remaining ones are submitted again
+        for (uint32_t sentCount = 0; sentCount < pendingCount;)
+        {
+            const int32_t batchSent = sendmmsg(static_cast<int32_t>(m_socketFd), messages + sentCount, pendingCount - sentCount, 0);
+            if (batchSent <= 0)
+            {
+                const int32_t error = GetLastNetworkError();
+                if (!ErrorIsWouldBlock(error)) // Filter would block messages
+                {
+                    AZLOG_ERROR("Failed to write to socket (%d:%s)", error, GetNetworkErrorDesc(error));
+                }
+                break;
+            }
+            sentCount += aznumeric_cast<uint32_t>(batchSent);
+        }
+#else
+        for (uint32_t i = 0; i < aznumeric_cast<uint32_t>(m_pendingSends.size()); ++i)
+        {
+            const PendingSend& pendingSend = m_pendingSends[i];
+            if (SendImmediate(pendingSend.m_address, m_pendingSendBuffer.data() + i * MaxUdpTransmissionUnit, pendingSend.m_size) < 0)
+            {
+                const int32_t error = GetLastNetworkError();
+                if (!ErrorIsWouldBlock(error)) // Filter would block messages
+                {
+                    AZLOG_ERROR("Failed to write to socket (%d:%s)", error, GetNetworkErrorDesc(error));
+                }
+            }
+        }
+#endif
+        m_pendingSends.clear();
+    }
+
     int32_t UdpSocket::Receive(IpAddress& outAddress, uint8_t* outData, uint32_t size) const
     {
         AZ_Assert(size > 0, "Invalid data size for send");
@@ -229,6 +394,23 @@ namespace AzNetworking
 
     int32_t UdpSocket::SendInternal(const IpAddress& address, const uint8_t* data, uint32_t size,
         [[maybe_unused]] bool encrypt, [[maybe_unused]] DtlsEndpoint& dtlsEndpoint) const
+    {
+        if (!m_sendBatchingEnabled || size > MaxUdpTransmissionUnit)
+        {
+            return SendImmediate(address, data, size);
+        }
+
+        if (m_pendingSends.full())
+        {
+            FlushSends();
+        }
+
+        memcpy(m_pendingSendBuffer.data() + m_pendingSends.size() * MaxUdpTransmissionUnit, data, size);
+        m_pendingSends.push_back(PendingSend{ address, size });
+        return aznumeric_cast<int32_t>(size);
+    }
+
+    int32_t UdpSocket::SendImmediate(const IpAddress& address, const uint8_t* data, uint32_t size) const
     {
         sockaddr_in destAddr;
         memset(&destAddr, 0, sizeof(destAddr));
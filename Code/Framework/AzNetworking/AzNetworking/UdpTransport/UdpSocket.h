@@ -14,6 +14,7 @@
 #include <AzNetworking/UdpTransport/DtlsEndpoint.h>
 #include <AzCore/Math/Random.h>
 #include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/containers/vector.h>
 
 #ifndef _RELEASE
 #   define ENABLE_LATENCY_DEBUG 1
@@ -42,6 +43,18 @@ namespace AzNetworking
             True   // Socket can accept incoming connections and may require a valid certificate and private key file
         };
 
+        //! Maximum number of datagrams that are sent or received with a single system call.
+        static constexpr uint32_t MaxBatchedDatagrams = 64;
+
+        //! A single datagram slot used by ReceiveMultiple.
+        struct ReceiveDatagram
+        {
+            IpAddress m_address;               //!< On success, the address of the endpoint that sent the data
+            uint8_t*  m_data = nullptr;        //!< Address to write the received data to
+            uint32_t  m_size = 0;              //!< Maximum size the buffer supports for receiving
+            int32_t   m_receivedBytes = 0;     //!< On success, number of bytes received
+        };
+
         UdpSocket() = default;
         virtual ~UdpSocket();
 
@@ -93,6 +106,24 @@ namespace AzNetworking
         //! @return number of bytes received, <= 0 on error
         int32_t Receive(IpAddress& outAddress, uint8_t* outData, uint32_t size) const;
 
+        //! Receives multiple payloads from the UDP socket, using a single system call on platforms that support it.
+        //! @param outDatagrams array of datagram slots to receive the payloads into
+        //! @param count        number of datagram slots in the array
+        //! @return number of datagrams received, < 0 on error
+        int32_t ReceiveMultiple(ReceiveDatagram* outDatagrams, uint32_t count) const;
+
+        //! Enables or disables send batching.
+        //! While enabled, sent payloads are queued and transmitted by FlushSends, using a single system call on platforms that support it.
+        //! @param enabled if true, payloads are queued until the next call to FlushSends
+        void SetSendBatchingEnabled(bool enabled);
+
+        //! Returns true if sent payloads are queued until the next call to FlushSends.
+        //! @return boolean true if send batching is enabled
+        bool IsSendBatchingEnabled() const;
+
+        //! Transmits all payloads queued since the last flush, does nothing if send batching is disabled.
+        void FlushSends() const;
+
         //! Returns the underlying socket file descriptor.
         //! @return the underlying socket file descriptor
         SocketFd GetSocketFd() const;
@@ -130,7 +161,20 @@ namespace AzNetworking
 
     private:
 
+        //! Transmits the payload right away, bypassing send batching.
+        int32_t SendImmediate(const IpAddress& address, const uint8_t* data, uint32_t size) const;
+
+        struct PendingSend
+        {
+            IpAddress m_address;
+            uint32_t m_size = 0;
+        };
+
         SocketFd m_socketFd = InvalidSocketFd;
+        bool m_sendBatchingEnabled = false;
+        // Queued payloads, each one is stored at its index * MaxUdpTransmissionUnit in the pending send buffer
+        mutable AZStd::fixed_vector<PendingSend, MaxBatchedDatagrams> m_pendingSends;
+        mutable AZStd::vector<uint8_t> m_pendingSendBuffer;
         mutable uint32_t m_sentPackets = 0;
         mutable uint32_t m_sentBytes = 0;
         mutable uint32_t m_recvPackets = 0;
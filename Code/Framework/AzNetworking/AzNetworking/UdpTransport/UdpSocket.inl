@@ -15,6 +15,11 @@ namespace AzNetworking
         return (m_socketFd > SocketFd{ 0 });
     }
 
+    inline bool UdpSocket::IsSendBatchingEnabled() const
+    {
+        return m_sendBatchingEnabled;
+    }
+
     inline SocketFd UdpSocket::GetSocketFd() const
     {
         return m_socketFd;
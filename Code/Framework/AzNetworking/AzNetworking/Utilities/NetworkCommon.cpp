@@ -71,6 +71,25 @@ namespace AzNetworking
         return true;
     }
 
+    bool SetSocketReusePort([[maybe_unused]] SocketFd socketFd)
+    {
+#if AZ_TRAIT_USE_SOCKET_REUSE_PORT
+        int flag = 1;
+
+        if (setsockopt(int32_t(socketFd), SOL_SOCKET, SO_REUSEPORT, (char *)&flag, sizeof(int)) != SocketOpResultSuccess)
+        {
+            const int32_t error = GetLastNetworkError();
+            AZLOG_ERROR("Failed to enable port sharing for socket (%d:%s)", error, GetNetworkErrorDesc(error));
+            return false;
+        }
+
+        return true;
+#else
+        AZLOG_ERROR("Port sharing is not supported on this platform");
+        return false;
+#endif
+    }
+
     bool SetSocketBufferSizes(SocketFd socketFd, int32_t sendSize, int32_t recvSize)
     {
         if (setsockopt(int32_t(socketFd), SOL_SOCKET, SO_SNDBUF, (const char *)&sendSize, sizeof(sendSize)) != SocketOpResultSuccess)
@@ -75,6 +75,12 @@ namespace AzNetworking
     //! @return boolean true on success
     bool SetSocketNoDelay(SocketFd socketFd);
 
+    //! Allows multiple sockets to bind the same port, the kernel then load balances incoming connections between them.
+    //! Not supported on every platform, see AZ_TRAIT_USE_SOCKET_REUSE_PORT.
+    //! @param socketFd identifier of the socket to allow port sharing for, must be called before binding the socket
+    //! @return boolean true on success
+    bool SetSocketReusePort(SocketFd socketFd);
+
     //! Changes network socket receive buffer size.
     //! @param socketFd identifier of the socket to change the receive buffer size of
     //! @param sendSize requested send buffer size
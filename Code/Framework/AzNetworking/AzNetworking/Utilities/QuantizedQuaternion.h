@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Quaternion.h>
+#include <AzNetworking/Serialization/ISerializer.h>
+
+namespace AzNetworking
+{
+    //! @class QuantizedQuaternion
+    //! @brief Quantizes a unit quaternion using smallest three encoding.
+    //!
+    //! The largest component of a unit quaternion can be reconstructed from the other three, and the other three always lie
+    //! between -1/sqrt(2) and 1/sqrt(2). Only the index of the largest component and the quantized values of the other three are
+    //! serialized, NUM_BYTES = 4 stores 10 bits per component and NUM_BYTES = 8 stores 20 bits per component.
+    //! Since q and -q represent the same rotation, the decoded quaternion may be the negation of the input.
+    template <AZStd::size_t NUM_BYTES>
+    class QuantizedQuaternion
+    {
+    public:
+
+        static_assert(NUM_BYTES == 4 || NUM_BYTES == 8, "QuantizedQuaternion only supports 4 or 8 byte encodings");
+
+        using SelfType = QuantizedQuaternion<NUM_BYTES>;
+        using SerializeType = typename AZ::SizeType<NUM_BYTES, false>::Type;
+
+        static constexpr uint32_t BitsPerComponent = (NUM_BYTES * 8 - 2) / 3;
+        static constexpr uint32_t MaxComponentValue = (1u << BitsPerComponent) - 1;
+
+        //! Default constructor, initializes to the identity rotation.
+        QuantizedQuaternion();
+
+        //! Copy construct from same type.
+        //! @param value instance to construct from
+        QuantizedQuaternion(const SelfType& value) = default;
+
+        //! Construct from a quaternion.
+        //! @param value quaternion to construct from, does not need to be normalized
+        explicit QuantizedQuaternion(const AZ::Quaternion& value);
+
+        //! Assignment from same type.
+        //! @param rhs instance to assign from
+        SelfType& operator =(const SelfType& rhs) = default;
+
+        //! Assignment from a quaternion.
+        //! @param rhs quaternion to assign from, does not need to be normalized
+        SelfType& operator =(const AZ::Quaternion& rhs);
+
+        //! Const underlying type operator.
+        //! @return the quantized quaternion
+        operator AZ::Quaternion() const;
+
+        //! Equality operator.
+        //! @param rhs value to compare against
+        //! @return boolean true if this == rhs
+        bool operator ==(const SelfType& rhs) const;
+
+        //! Inequality operator.
+        //! @param rhs value to compare against
+        //! @return boolean true if this != rhs
+        bool operator !=(const SelfType& rhs) const;
+
+        //! Retrieves the packed integral value used during serialization of this QuantizedQuaternion instance.
+        //! @return the packed integral value used during serialization of this QuantizedQuaternion instance
+        SerializeType GetQuantizedIntegralValue() const;
+
+        //! Base serialize method for all serializable structures or classes to implement.
+        //! @param serializer ISerializer instance to use for serialization
+        //! @return boolean true for success, false for serialization failure
+        bool Serialize(ISerializer& serializer);
+
+    private:
+
+        //! Helper method to convert and store an un-quantized value.
+        //! @param value the input value to convert and store
+        void Set(const AZ::Quaternion& value);
+
+        //! Takes the packed integral value and stores the quaternion it represents.
+        void DecodeQuantizedValue();
+
+        AZ::Quaternion m_quantizedValue;
+        SerializeType m_serializeValue = 0;
+    };
+}
+
+#include <AzNetworking/Utilities/QuantizedQuaternion.inl>
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/math.h>
+
+namespace AzNetworking
+{
+    //! Largest possible magnitude of any but the largest component of a unit quaternion, 1 / sqrt(2).
+    static constexpr float QuantizedQuaternionComponentRange = 0.707106781f;
+
+    template <AZStd::size_t NUM_BYTES>
+    inline QuantizedQuaternion<NUM_BYTES>::QuantizedQuaternion()
+    {
+        Set(AZ::Quaternion::CreateIdentity());
+    }
+
+    template <AZStd::size_t NUM_BYTES>
+    inline QuantizedQuaternion<NUM_BYTES>::QuantizedQuaternion(const AZ::Quaternion& value)
+    {
+        Set(value);
+    }
+
+    template <AZStd::size_t NUM_BYTES>
+    inline QuantizedQuaternion<NUM_BYTES>& QuantizedQuaternion<NUM_BYTES>::operator =(const AZ::Quaternion& rhs)
+    {
+        Set(rhs);
+        return *this;
+    }
+
+    template <AZStd::size_t NUM_BYTES>
+    inline QuantizedQuaternion<NUM_BYTES>::operator AZ::Quaternion() const
+    {
+        return m_quantizedValue;
+    }
+
+    template <AZStd::size_t NUM_BYTES>
+    inline bool QuantizedQuaternion<NUM_BYTES>::operator ==(const SelfType& rhs) const
+    {
+        return m_serializeValue == rhs.m_serializeValue;
+    }
+
+    template <AZStd::size_t NUM_BYTES>
+    inline bool QuantizedQuaternion<NUM_BYTES>::operator !=(const SelfType& rhs) const
+    {
+        return m_serializeValue != rhs.m_serializeValue;
+    }
+
+    template <AZStd::size_t NUM_BYTES>
+    inline typename QuantizedQuaternion<NUM_BYTES>::SerializeType QuantizedQuaternion<NUM_BYTES>::GetQuantizedIntegralValue() const
+    {
+        return m_serializeValue;
+    }
+
+    template <AZStd::size_t NUM_BYTES>
+    inline bool QuantizedQuaternion<NUM_BYTES>::Serialize(ISerializer& serializer)
+    {
+        if (serializer.Serialize(m_serializeValue, "Value") && (serializer.GetSerializerMode() == SerializerMode::WriteToObject))
+        {
+            DecodeQuantizedValue();
+        }
+        return serializer.IsValid();
+    }
+
+    template <AZStd::size_t NUM_BYTES>
+    inline void QuantizedQuaternion<NUM_BYTES>::Set(const AZ::Quaternion& value)
+    {
+        using SimdType = AZ::Simd::Vec4;
+
+        const AZ::Quaternion normalized = value.GetNormalized();
+        SimdType::FloatType components = normalized.GetSimdValue();
+
+        float absComponents[4];
+        SimdType::StoreUnaligned(absComponents, SimdType::Abs(components));
+        uint32_t largestIndex = 0;
+        for (uint32_t i = 1; i < 4; ++i)
+        {
+            if (absComponents[i] > absComponents[largestIndex])
+            {
+                largestIndex = i;
+            }
+        }
+
+        // q and -q are the same rotation, flip the sign so the omitted component is always positive
+        if (normalized.GetElement(largestIndex) < 0.0f)
+        {
+            components = SimdType::Sub(SimdType::ZeroFloat(), components);
+        }
+
+        // Quantize all four lanes at once, the largest component's lane is simply not packed
+        const SimdType::FloatType range = SimdType::Splat(QuantizedQuaternionComponentRange);
+        const SimdType::FloatType convertToInt = SimdType::Splat(static_cast<float>(MaxComponentValue) / (2.0f * QuantizedQuaternionComponentRange));
+        const SimdType::FloatType readjusted = SimdType::Mul(convertToInt, SimdType::Add(components, range));
+        const SimdType::Int32Type quantized = SimdType::ConvertToIntNearest(SimdType::Clamp(readjusted, SimdType::ZeroFloat(), SimdType::Splat(static_cast<float>(MaxComponentValue))));
+
+        int32_t quantizedComponents[4];
+        SimdType::StoreUnaligned(quantizedComponents, quantized);
+        SerializeType packed = static_cast<SerializeType>(largestIndex);
+        for (uint32_t i = 0; i < 4; ++i)
+        {
+            if (i != largestIndex)
+            {
+                packed = (packed << BitsPerComponent) | static_cast<SerializeType>(quantizedComponents[i]);
+            }
+        }
+        m_serializeValue = packed;
+        DecodeQuantizedValue();
+    }
+
+    template <AZStd::size_t NUM_BYTES>
+    inline void QuantizedQuaternion<NUM_BYTES>::DecodeQuantizedValue()
+    {
+        using SimdType = AZ::Simd::Vec4;
+
+        const uint32_t largestIndex = static_cast<uint32_t>(m_serializeValue >> (BitsPerComponent * 3)) & 0x3;
+        int32_t quantizedComponents[4] = { 0, 0, 0, 0 };
+        SerializeType packed = m_serializeValue;
+        for (int32_t i = 3; i >= 0; --i)
+        {
+            if (static_cast<uint32_t>(i) != largestIndex)
+            {
+                quantizedComponents[i] = static_cast<int32_t>(packed & MaxComponentValue);
+                packed >>= BitsPerComponent;
+            }
+        }
+
+        const SimdType::FloatType range = SimdType::Splat(QuantizedQuaternionComponentRange);
+        const SimdType::FloatType convertToFloat = SimdType::Splat((2.0f * QuantizedQuaternionComponentRange) / static_cast<float>(MaxComponentValue));
+        const SimdType::FloatType quantized = SimdType::ConvertToFloat(SimdType::LoadUnaligned(quantizedComponents));
+
+        float components[4];
+        SimdType::StoreUnaligned(components, SimdType::Sub(SimdType::Mul(quantized, convertToFloat), range));
+        components[largestIndex] = 0.0f;
+        const float lengthSq = components[0] * components[0] + components[1] * components[1] + components[2] * components[2] + components[3] * components[3];
+        components[largestIndex] = AZStd::sqrt(AZStd::max(0.0f, 1.0f - lengthSq));
+        m_quantizedValue = AZ::Quaternion(components[0], components[1], components[2], components[3]);
+    }
+}
@@ -49,6 +49,8 @@ set(FILES
     PacketLayer/IPacketHeader.h
     Serialization/AbstractValue.h
     Serialization/AzContainerSerializers.h
+    Serialization/DeltaBaselineTracker.h
+    Serialization/DeltaBaselineTracker.inl
     Serialization/DeltaSerializer.cpp
     Serialization/DeltaSerializer.h
     Serialization/DeltaSerializer.inl
@@ -105,6 +107,8 @@ set(FILES
     UdpTransport/UdpFragmentQueue.h
     UdpTransport/UdpNetworkInterface.cpp
     UdpTransport/UdpNetworkInterface.h
+    UdpTransport/UdpPacketCapture.cpp
+    UdpTransport/UdpPacketCapture.h
     UdpTransport/UdpPacketHeader.cpp
     UdpTransport/UdpPacketHeader.h
     UdpTransport/UdpPacketHeader.inl
@@ -133,6 +137,8 @@ set(FILES
     Utilities/NetworkCommon.h
     Utilities/NetworkCommon.inl
     Utilities/NetworkIncludes.h
+    Utilities/QuantizedQuaternion.h
+    Utilities/QuantizedQuaternion.inl
     Utilities/QuantizedValues.h
     Utilities/QuantizedValues.inl
     Utilities/TimedThread.cpp
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Serialization/DeltaBaselineTracker.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkOutputSerializer.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    struct DeltaBaselineTestState
+    {
+        int32_t m_health = 0;
+        float m_speed = 0.0f;
+        uint32_t m_score = 0;
+        uint64_t m_flags = 0;
+
+        bool Serialize(AzNetworking::ISerializer& serializer)
+        {
+            serializer.Serialize(m_health, "Health");
+            serializer.Serialize(m_speed, "Speed");
+            serializer.Serialize(m_score, "Score");
+            serializer.Serialize(m_flags, "Flags");
+            return serializer.IsValid();
+        }
+
+        bool operator ==(const DeltaBaselineTestState& rhs) const
+        {
+            return (m_health == rhs.m_health) && (m_speed == rhs.m_speed) && (m_score == rhs.m_score) && (m_flags == rhs.m_flags);
+        }
+    };
+
+    using TestSender = AzNetworking::DeltaBaselineSender<DeltaBaselineTestState, 4>;
+    using TestReceiver = AzNetworking::DeltaBaselineReceiver<DeltaBaselineTestState, 4>;
+
+    class DeltaBaselineTrackerTests
+        : public AllocatorsFixture
+    {
+    public:
+        uint32_t SendState(TestSender& sender, TestReceiver& receiver, DeltaBaselineTestState& state, AzNetworking::PacketId packetId, bool delivered = true)
+        {
+            AZStd::array<uint8_t, 2048> buffer;
+            AzNetworking::NetworkInputSerializer inputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+            EXPECT_TRUE(sender.Serialize(state, inputSerializer));
+            sender.OnPacketSent(packetId);
+
+            if (delivered)
+            {
+                DeltaBaselineTestState received;
+                AzNetworking::NetworkOutputSerializer outputSerializer(buffer.data(), inputSerializer.GetSize());
+                EXPECT_TRUE(receiver.Serialize(outputSerializer, received));
+                EXPECT_EQ(received, state);
+            }
+            return inputSerializer.GetSize();
+        }
+    };
+
+    TEST_F(DeltaBaselineTrackerTests, SendsFullStatesUntilAcked)
+    {
+        TestSender sender;
+        TestReceiver receiver;
+        DeltaBaselineTestState state;
+        state.m_health = 100;
+        state.m_speed = 4.5f;
+        state.m_score = 12;
+        state.m_flags = 0xFF00FF00FF00FF00;
+
+        const uint32_t fullSize = SendState(sender, receiver, state, AzNetworking::PacketId{ 1 });
+        EXPECT_FALSE(sender.HasBaseline());
+
+        state.m_health = 90;
+        EXPECT_EQ(SendState(sender, receiver, state, AzNetworking::PacketId{ 2 }), fullSize);
+
+        // Once a state is acked, later states only carry the fields that changed since that baseline
+        sender.OnPacketAcked(AzNetworking::PacketId{ 2 });
+        EXPECT_TRUE(sender.HasBaseline());
+        state.m_score = 13;
+        EXPECT_LT(SendState(sender, receiver, state, AzNetworking::PacketId{ 3 }), fullSize);
+    }
+
+    TEST_F(DeltaBaselineTrackerTests, LostPacketsDoNotBreakDeltas)
+    {
+        TestSender sender;
+        TestReceiver receiver;
+        DeltaBaselineTestState state;
+
+        SendState(sender, receiver, state, AzNetworking::PacketId{ 1 });
+        sender.OnPacketAcked(AzNetworking::PacketId{ 1 });
+
+        // These never arrive, so the following delta must still be against the acked state
+        state.m_health = 50;
+        SendState(sender, receiver, state, AzNetworking::PacketId{ 2 }, false);
+        state.m_speed = 1.0f;
+        SendState(sender, receiver, state, AzNetworking::PacketId{ 3 }, false);
+
+        state.m_score = 7;
+        SendState(sender, receiver, state, AzNetworking::PacketId{ 4 });
+
+        // A late ack for an older packet doesn't move the baseline backwards
+        sender.OnPacketAcked(AzNetworking::PacketId{ 4 });
+        sender.OnPacketAcked(AzNetworking::PacketId{ 1 });
+        state.m_flags = 3;
+        SendState(sender, receiver, state, AzNetworking::PacketId{ 5 });
+    }
+
+    TEST_F(DeltaBaselineTrackerTests, EvictedBaselineFallsBackToFullState)
+    {
+        TestSender sender;
+        TestReceiver receiver;
+        DeltaBaselineTestState state;
+
+        const uint32_t fullSize = SendState(sender, receiver, state, AzNetworking::PacketId{ 1 });
+        sender.OnPacketAcked(AzNetworking::PacketId{ 1 });
+
+        // Sending more unacked states than the history holds pushes the acked baseline out
+        for (uint32_t packetId = 2; packetId <= 5; ++packetId)
+        {
+            state.m_score = packetId;
+            SendState(sender, receiver, state, AzNetworking::PacketId{ packetId });
+        }
+        EXPECT_FALSE(sender.HasBaseline());
+
+        state.m_score = 6;
+        EXPECT_EQ(SendState(sender, receiver, state, AzNetworking::PacketId{ 6 }), fullSize);
+    }
+
+    TEST_F(DeltaBaselineTrackerTests, UnknownBaselineFails)
+    {
+        TestSender sender;
+        TestReceiver receiver;
+        DeltaBaselineTestState state;
+
+        SendState(sender, receiver, state, AzNetworking::PacketId{ 1 });
+        sender.OnPacketAcked(AzNetworking::PacketId{ 1 });
+        receiver.Reset();
+
+        AZStd::array<uint8_t, 2048> buffer;
+        AzNetworking::NetworkInputSerializer inputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+        state.m_health = 1;
+        EXPECT_TRUE(sender.Serialize(state, inputSerializer));
+
+        DeltaBaselineTestState received;
+        AzNetworking::NetworkOutputSerializer outputSerializer(buffer.data(), inputSerializer.GetSize());
+        EXPECT_FALSE(receiver.Serialize(outputSerializer, received));
+    }
+}
@@ -7,6 +7,7 @@
  */
 
 #include <AzNetworking/TcpTransport/TcpNetworkInterface.h>
+#include <AzNetworking/TcpTransport/TcpRingBuffer.h>
 #include <AzNetworking/Framework/NetworkingSystemComponent.h>
 #include <AzNetworking/AutoGen/CorePackets.AutoPackets.h>
 #include <AzCore/Interface/Interface.h>
@@ -185,4 +186,21 @@ namespace UnitTest
             EXPECT_EQ(testClient[i].m_clientNetworkInterface->GetConnectionSet().GetConnectionCount(), 1);
         }
     }
+
+    TEST(TcpRingBufferTests, WriteBufferSizeTracksContiguousSpace)
+    {
+        TcpRingBuffer<64> ringBuffer;
+        EXPECT_EQ(ringBuffer.GetWriteBufferSize(), 64u);
+
+        ASSERT_NE(ringBuffer.ReserveBlockForWrite(48), nullptr);
+        EXPECT_TRUE(ringBuffer.AdvanceWriteBuffer(48));
+        EXPECT_EQ(ringBuffer.GetWriteBufferSize(), 16u);
+
+        // Reserving more than the contiguous tail packs the unread data to the front of the buffer
+        EXPECT_TRUE(ringBuffer.AdvanceReadBuffer(40));
+        ASSERT_NE(ringBuffer.ReserveBlockForWrite(32), nullptr);
+        EXPECT_EQ(ringBuffer.GetReadBufferSize(), 8u);
+        EXPECT_EQ(ringBuffer.GetWriteBufferSize(), 56u);
+        EXPECT_FALSE(ringBuffer.AdvanceWriteBuffer(57));
+    }
 }
@@ -9,6 +9,7 @@
 #include <AzNetworking/UdpTransport/UdpNetworkInterface.h>
 #include <AzNetworking/UdpTransport/UdpPacketTracker.h>
 #include <AzNetworking/UdpTransport/UdpPacketIdWindow.h>
+#include <AzNetworking/UdpTransport/UdpSocket.h>
 #include <AzNetworking/ConnectionLayer/IConnectionListener.h>
 #include <AzNetworking/Framework/NetworkingSystemComponent.h>
 #include <AzNetworking/AutoGen/CorePackets.AutoPackets.h>
@@ -244,6 +245,59 @@ namespace UnitTest
         EXPECT_EQ(ackState, PacketAckState::Nacked); // Testing that PacketId is not flagged as acked
     }
 
+    TEST_F(UdpTransportTests, BatchedSendAndReceive)
+    {
+        constexpr uint16_t SenderPort = 12346;
+        constexpr uint16_t ReceiverPort = 12347;
+        constexpr uint32_t DatagramCount = 10;
+
+        UdpSocket sender;
+        UdpSocket receiver;
+        ASSERT_TRUE(sender.Open(SenderPort, UdpSocket::CanAcceptConnections::False, TrustZone::ExternalClientToServer));
+        ASSERT_TRUE(receiver.Open(ReceiverPort, UdpSocket::CanAcceptConnections::True, TrustZone::ExternalClientToServer));
+        sender.SetSendBatchingEnabled(true);
+
+        DtlsEndpoint dtlsEndpoint;
+        ConnectionQuality connectionQuality;
+        for (uint8_t i = 0; i < DatagramCount; ++i)
+        {
+            const uint8_t payload[4] = { i, i, i, i };
+            EXPECT_EQ(4, sender.Send(IpAddress(127, 0, 0, 1, ReceiverPort), payload, sizeof(payload), false, dtlsEndpoint, connectionQuality));
+        }
+
+        uint8_t receiveBuffer[DatagramCount * MaxUdpTransmissionUnit];
+        UdpSocket::ReceiveDatagram datagrams[DatagramCount];
+        for (uint32_t i = 0; i < DatagramCount; ++i)
+        {
+            datagrams[i].m_data = receiveBuffer + i * MaxUdpTransmissionUnit;
+            datagrams[i].m_size = MaxUdpTransmissionUnit;
+        }
+
+        // Nothing is transmitted until the queued datagrams are flushed
+        EXPECT_EQ(0, receiver.ReceiveMultiple(datagrams, DatagramCount));
+        sender.FlushSends();
+
+        uint32_t receivedCount = 0;
+        const AZ::TimeMs startTimeMs = AZ::GetElapsedTimeMs();
+        while (receivedCount < DatagramCount && (AZ::GetElapsedTimeMs() - startTimeMs) < AZ::TimeMs{ 1000 })
+        {
+            const int32_t received = receiver.ReceiveMultiple(datagrams + receivedCount, DatagramCount - receivedCount);
+            ASSERT_GE(received, 0);
+            receivedCount += aznumeric_cast<uint32_t>(received);
+            AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+        }
+
+        ASSERT_EQ(DatagramCount, receivedCount);
+        for (uint32_t i = 0; i < DatagramCount; ++i)
+        {
+            EXPECT_EQ(4, datagrams[i].m_receivedBytes);
+            EXPECT_EQ(i, aznumeric_cast<uint32_t>(datagrams[i].m_data[0]));
+            EXPECT_EQ(SenderPort, datagrams[i].m_address.GetPort(ByteOrder::Host));
+        }
+        EXPECT_EQ(DatagramCount, sender.GetSentPackets());
+        EXPECT_EQ(DatagramCount, receiver.GetRecvPackets());
+    }
+
     TEST_F(UdpTransportTests, TestSingleClient)
     {
         TestUdpServer testServer;
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzNetworking/Utilities/QuantizedQuaternion.h>
+#include <AzNetworking/Serialization/NetworkInputSerializer.h>
+#include <AzNetworking/Serialization/NetworkOutputSerializer.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    template <AZStd::size_t NUM_BYTES>
+    void TestQuantizedQuaternionHelper(float tolerance)
+    {
+        const AZ::Quaternion testValues[] =
+        {
+            AZ::Quaternion::CreateIdentity(),
+            AZ::Quaternion::CreateRotationX(AZ::Constants::HalfPi),
+            AZ::Quaternion::CreateRotationY(-AZ::Constants::Pi),
+            AZ::Quaternion::CreateRotationZ(0.1f),
+            AZ::Quaternion::CreateFromAxisAngle(AZ::Vector3(1.0f, -2.0f, 0.5f).GetNormalized(), 2.5f),
+            AZ::Quaternion(-0.5f, 0.5f, -0.5f, -0.5f)
+        };
+
+        for (const AZ::Quaternion& value : testValues)
+        {
+            AzNetworking::QuantizedQuaternion<NUM_BYTES> testIn(value), testOut;
+
+            // q and -q are the same rotation, so compare the rotations rather than the components
+            const AZ::Quaternion quantized = testIn;
+            EXPECT_NEAR(AZStd::abs(quantized.Dot(value)), 1.0f, tolerance);
+            EXPECT_NEAR(quantized.GetLength(), 1.0f, tolerance);
+
+            AZStd::array<uint8_t, 64> buffer;
+            AzNetworking::NetworkInputSerializer  inputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+            AzNetworking::NetworkOutputSerializer outputSerializer(buffer.data(), static_cast<uint32_t>(buffer.size()));
+
+            EXPECT_TRUE(testIn.Serialize(inputSerializer));
+            EXPECT_EQ(inputSerializer.GetSize(), NUM_BYTES);
+            EXPECT_TRUE(testOut.Serialize(outputSerializer));
+            EXPECT_EQ(testIn, testOut);
+            EXPECT_TRUE(static_cast<AZ::Quaternion>(testOut).IsClose(quantized, 0.0f));
+        }
+    }
+
+    TEST(QuantizedQuaternion, Test4Bytes)
+    {
+        TestQuantizedQuaternionHelper<4>(0.001f);
+    }
+
+    TEST(QuantizedQuaternion, Test8Bytes)
+    {
+        TestQuantizedQuaternionHelper<8>(0.0001f);
+    }
+}
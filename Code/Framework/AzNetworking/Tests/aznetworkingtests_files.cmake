@@ -15,6 +15,7 @@ set(FILES
     DataStructures/FixedSizeVectorBitsetTests.cpp
     DataStructures/RingBufferBitsetTests.cpp
     DataStructures/TimeoutQueueTests.cpp
+    Serialization/DeltaBaselineTrackerTests.cpp
     Serialization/DeltaSerializerTests.cpp
     Serialization/HashSerializerTests.cpp
     Serialization/NetworkInputSerializerTests.cpp
@@ -25,5 +26,6 @@ set(FILES
     Utilities/CidrAddressTests.cpp
     Utilities/IpAddressTests.cpp
     Utilities/NetworkCommonTests.cpp
+    Utilities/QuantizedQuaternionTests.cpp
     Utilities/QuantizedValuesTests.cpp
 )
@@ -13,6 +13,7 @@
 #include <AzCore/std/string/wildcard.h>
 #include <AzCore/std/string/regex.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/Asset/AssetCommon.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzFramework/StringFunc/StringFunc.h>
@@ -55,12 +56,13 @@ namespace AzToolsFramework
         if (AZ::SerializeContext* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
         {
             serializeContext->Class<AssetBundleSettings>()
-                ->Version(3)
+                ->Version(4)
                 ->Field("AssetFileInfoListPath", &AssetBundleSettings::m_assetFileInfoListPath)
                 ->Field("BundleFilePath", &AssetBundleSettings::m_bundleFilePath)
                 ->Field("BundleVersion", &AssetBundleSettings::m_bundleVersion)
                 ->Field("maxBundleSize", &AssetBundleSettings::m_maxBundleSizeInMB)
-                ->Field("comment", &AssetBundleSettings::m_comment);
+                ->Field("comment", &AssetBundleSettings::m_comment)
+                ->Field("LoadOrderFilePath", &AssetBundleSettings::m_loadOrderFilePath);
         }
     }
 
@@ -429,24 +431,27 @@ namespace AzToolsFramework
 
     AssetFileInfoList AssetFileInfoListComparison::Delta(const AssetFileInfoList& firstAssetFileInfoList, const AssetFileInfoList& secondAssetFileInfoList) const
     {
-        AZStd::unordered_map<AZ::Data::AssetId, AzToolsFramework::AssetFileInfo> assetIdToAssetFileInfoMap;
-
-        // Populate the map with entries from the secondAssetFileInfoList
-        for (const AssetFileInfo& assetFileInfo : secondAssetFileInfoList.m_fileInfoList)
+        // Index the first list only, and walk the second list in order, so the delta keeps the packing order of the second list
+        // and a patch bundle built from it lays out the changed assets the same way the full bundle does.
+        AZStd::unordered_map<AZ::Data::AssetId, const AssetFileInfo*> assetIdToFirstAssetFileInfoMap;
+        assetIdToFirstAssetFileInfoMap.reserve(firstAssetFileInfoList.m_fileInfoList.size());
+        for (const AssetFileInfo& assetFileInfo : firstAssetFileInfoList.m_fileInfoList)
         {
-            assetIdToAssetFileInfoMap[assetFileInfo.m_assetId] = assetFileInfo;
+            assetIdToFirstAssetFileInfoMap[assetFileInfo.m_assetId] = &assetFileInfo;
         }
 
-        for (const AssetFileInfo& assetFileInfo : firstAssetFileInfoList.m_fileInfoList)
+        AZStd::unordered_set<AZ::Data::AssetId> addedAssetIds;
+        AssetFileInfoList assetFileInfoList;
+        for (const AssetFileInfo& assetFileInfo : secondAssetFileInfoList.m_fileInfoList)
         {
-            auto found = assetIdToAssetFileInfoMap.find(assetFileInfo.m_assetId);
-            if (found != assetIdToAssetFileInfoMap.end())
+            auto found = assetIdToFirstAssetFileInfoMap.find(assetFileInfo.m_assetId);
+            if (found != assetIdToFirstAssetFileInfoMap.end())
             {
                 bool isHashEqual = true;
                 // checking the file hash
                 for (int idx = 0; idx < AzToolsFramework::AssetFileInfo::s_arraySize; idx++)
                 {
-                    if (found->second.m_hash[idx] != assetFileInfo.m_hash[idx])
+                    if (found->second->m_hash[idx] != assetFileInfo.m_hash[idx])
                     {
                         isHashEqual = false;
                         break;
@@ -455,15 +460,14 @@ namespace AzToolsFramework
 
                 if (isHashEqual)
                 {
-                    assetIdToAssetFileInfoMap.erase(found);
+                    continue;
                 }
             }
-        }
 
-        AssetFileInfoList assetFileInfoList;
-        for (auto iter = assetIdToAssetFileInfoMap.begin(); iter != assetIdToAssetFileInfoMap.end(); iter++)
-        {
-            assetFileInfoList.m_fileInfoList.emplace_back(AZStd::move(iter->second));
+            if (addedAssetIds.insert(assetFileInfo.m_assetId).second)
+            {
+                assetFileInfoList.m_fileInfoList.emplace_back(assetFileInfo);
+            }
         }
 
         return assetFileInfoList;
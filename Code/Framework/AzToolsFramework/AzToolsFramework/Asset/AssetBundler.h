@@ -59,6 +59,9 @@ namespace AzToolsFramework
         int m_bundleVersion = AzFramework::AssetBundleManifest::CurrentBundleVersion;
         AZ::u64 m_maxBundleSizeInMB = MaxBundleSizeInMB;
         AZStd::string m_comment;
+        //! Optional text file listing asset relative paths, one per line, in the order they were loaded at runtime.
+        //! The listed assets are packed first and in that order, so they are read sequentially from the first bundles.
+        AZStd::string m_loadOrderFilePath;
     };
 
    /*
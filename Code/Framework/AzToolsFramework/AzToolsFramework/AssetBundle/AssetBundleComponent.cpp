@@ -12,7 +12,10 @@
 #include <AzCore/IO/SystemFile.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/Utils.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/sort.h>
+#include <AzCore/std/string/conversions.h>
 #include <AzCore/Utils/Utils.h>
 #include <AzFramework/Asset/AssetBundleManifest.h>
 #include <AzFramework/StringFunc/StringFunc.h>
@@ -59,6 +62,55 @@ namespace AzToolsFramework
         return true;
     }
 
+    AZStd::string GetLoadOrderKey(AZStd::string_view assetRelativePath)
+    {
+        AZStd::string key(assetRelativePath);
+        AZStd::to_lower(key.begin(), key.end());
+        AZStd::replace(key.begin(), key.end(), AZ_WRONG_DATABASE_SEPARATOR, AZ_CORRECT_DATABASE_SEPARATOR);
+        return key;
+    }
+
+    // Moves the assets listed in the load order file to the front of the list, in the order they appear in the file, so that assets
+    // loaded together at runtime end up next to each other in the first bundles. The remaining assets keep their dependency order.
+    bool SortByLoadOrder(const AZ::IO::Path& loadOrderFilePath, AZStd::vector<AssetFileInfo>& fileInfoList)
+    {
+        AZ::Outcome<AZStd::string, AZStd::string> readResult = AZ::Utils::ReadFile<AZStd::string>(loadOrderFilePath.Native());
+        if (!readResult.IsSuccess())
+        {
+            AZ_Error(logWindowName, false, "Unable to read load order file (%s): %s\n", loadOrderFilePath.c_str(), readResult.GetError().c_str());
+            return false;
+        }
+
+        AZStd::vector<AZStd::string> loadOrderEntries;
+        AzFramework::StringFunc::Tokenize(readResult.GetValue(), loadOrderEntries, "\r\n");
+
+        AZStd::unordered_map<AZStd::string, size_t> loadOrder;
+        for (const AZStd::string& entry : loadOrderEntries)
+        {
+            // only the first load of an asset matters for its placement
+            loadOrder.emplace(GetLoadOrderKey(entry), loadOrder.size());
+        }
+
+        const size_t unorderedRank = loadOrder.size();
+        AZStd::vector<AZStd::pair<size_t, size_t>> ranks; // rank, index in the dependency order
+        ranks.reserve(fileInfoList.size());
+        for (size_t idx = 0; idx < fileInfoList.size(); ++idx)
+        {
+            auto loadOrderIter = loadOrder.find(GetLoadOrderKey(fileInfoList[idx].m_assetRelativePath));
+            ranks.emplace_back(loadOrderIter != loadOrder.end() ? loadOrderIter->second : unorderedRank, idx);
+        }
+        AZStd::sort(ranks.begin(), ranks.end());
+
+        AZStd::vector<AssetFileInfo> sortedFileInfoList;
+        sortedFileInfoList.reserve(fileInfoList.size());
+        for (const AZStd::pair<size_t, size_t>& rank : ranks)
+        {
+            sortedFileInfoList.emplace_back(AZStd::move(fileInfoList[rank.second]));
+        }
+        fileInfoList = AZStd::move(sortedFileInfoList);
+        return true;
+    }
+
     //! This helper class can be used to create a temp folder from a filename.
     //! It strips the extension and than adds _temp token to the name and tries to create that directory on disk.
     struct TemporaryDir
@@ -255,6 +307,19 @@ namespace AzToolsFramework
             return false;
         }
 
+        AZStd::vector<AssetFileInfo> sortedFileInfoList;
+        const AZStd::vector<AssetFileInfo>* fileInfoList = &assetFileInfoList.m_fileInfoList;
+        if (!assetBundleSettings.m_loadOrderFilePath.empty())
+        {
+            sortedFileInfoList = assetFileInfoList.m_fileInfoList;
+            AZ::IO::Path loadOrderFilePath = AZ::IO::Path(AZStd::string_view{ AZ::Utils::GetEnginePath() }) / assetBundleSettings.m_loadOrderFilePath;
+            if (!SortByLoadOrder(loadOrderFilePath, sortedFileInfoList))
+            {
+                return false;
+            }
+            fileInfoList = &sortedFileInfoList;
+        }
+
         AZ::u64 maxSizeInBytes = static_cast<AZ::u64>(assetBundleSettings.m_maxBundleSizeInMB * NumOfBytesInMB);
         AZ::u64 assetCatalogFileSizeBuffer = static_cast<AZ::u64>(AssetCatalogFileSizeBufferPercentage * assetBundleSettings.m_maxBundleSizeInMB * NumOfBytesInMB) / 100;
         AZ::u64 bundleSize = 0;
@@ -298,7 +363,7 @@ namespace AzToolsFramework
         AzFramework::ApplicationRequests::Bus::BroadcastResult(
             usePrefabSystemForLevels, &AzFramework::ApplicationRequests::IsPrefabSystemForLevelsEnabled);
 
-        for (const AzToolsFramework::AssetFileInfo& assetFileInfo : assetFileInfoList.m_fileInfoList)
+        for (const AzToolsFramework::AssetFileInfo& assetFileInfo : *fileInfoList)
         {
             AZ::u64 fileSize = 0;
             AZStd::string fullAssetFilePath;
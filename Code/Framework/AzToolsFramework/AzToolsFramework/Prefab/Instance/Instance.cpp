@@ -131,6 +131,8 @@ namespace AzToolsFramework
 
         bool Instance::AddEntity(AZ::Entity& entity, EntityAlias entityAlias)
         {
+            ClearCachedInstanceDom();
+
             if (!RegisterEntity(entity.GetId(), entityAlias))
             {
                 return false;
@@ -164,6 +166,8 @@ namespace AzToolsFramework
 
         AZStd::unique_ptr<AZ::Entity> Instance::DetachEntity(const EntityAlias& entityAlias)
         {
+            ClearCachedInstanceDom();
+
             AZStd::unique_ptr<AZ::Entity> removedEntity;
             auto&& entityIterator = m_entities.find(entityAlias);
             if (entityIterator != m_entities.end())
@@ -187,6 +191,8 @@ namespace AzToolsFramework
 
         void Instance::DetachEntities(const AZStd::function<void(AZStd::unique_ptr<AZ::Entity>)>& callback)
         {
+            ClearCachedInstanceDom();
+
             for (auto&& [entityAlias, entity] : m_entities)
             {
                 m_instanceEntityMapper->UnregisterEntity(entity->GetId());
@@ -229,6 +235,8 @@ namespace AzToolsFramework
         void Instance::RemoveEntities(
             const AZStd::function<bool(const AZStd::unique_ptr<AZ::Entity>&)>& filter)
         {
+            ClearCachedInstanceDom();
+
             AZStd::erase_if(m_entities,
                 [this, &filter](const auto& item)
                 {
@@ -247,6 +255,8 @@ namespace AzToolsFramework
 
         void Instance::ClearEntities()
         {
+            ClearCachedInstanceDom();
+
             if (m_containerEntity)
             {
                 m_instanceEntityMapper->UnregisterEntity(m_containerEntity->GetId());
@@ -306,6 +316,7 @@ namespace AzToolsFramework
             AZ_Assert(
                 m_nestedInstances.find(newInstanceAlias) == m_nestedInstances.end(),
                 "InstanceAlias' unique id collision, this should never happen.");
+            ClearCachedInstanceDom();
             instance->m_parent = this;
             instance->m_alias = newInstanceAlias;
             return *(m_nestedInstances[newInstanceAlias] = std::move(instance));
@@ -313,6 +324,8 @@ namespace AzToolsFramework
 
         void Instance::DetachNestedInstances(const AZStd::function<void(AZStd::unique_ptr<Instance>)>& callback)
         {
+            ClearCachedInstanceDom();
+
             for (auto&& [instanceAlias, instance] : m_nestedInstances)
             {
                 instance->m_parent = nullptr;
@@ -327,6 +340,7 @@ namespace AzToolsFramework
             auto&& nestedInstanceIterator = m_nestedInstances.find(instanceAlias);
             if (nestedInstanceIterator != m_nestedInstances.end())
             {
+                ClearCachedInstanceDom();
                 removedNestedInstance = AZStd::move(nestedInstanceIterator->second);
 
                 removedNestedInstance->m_parent = nullptr;
@@ -542,6 +556,65 @@ namespace AzToolsFramework
             return aliasPathResult;
         }
 
+        void Instance::SetCachedInstanceDom(const PrefabDomValue& instanceDom)
+        {
+            CacheInstanceDom(instanceDom);
+
+            PrefabDomValueConstReference nestedInstancesDom = PrefabDomUtils::FindPrefabDomValue(instanceDom, PrefabDomUtils::InstancesName);
+            for (auto& [instanceAlias, instance] : m_nestedInstances)
+            {
+                PrefabDomValueConstReference nestedInstanceDom = nestedInstancesDom.has_value() ?
+                    PrefabDomUtils::FindPrefabDomValue(nestedInstancesDom->get(), instanceAlias.c_str()) : AZStd::nullopt;
+                if (nestedInstanceDom.has_value())
+                {
+                    instance->SetCachedInstanceDom(nestedInstanceDom->get());
+                }
+                else
+                {
+                    instance->ClearCachedInstanceDomInHierarchy();
+                }
+            }
+        }
+
+        void Instance::ClearCachedInstanceDomInHierarchy()
+        {
+            ClearCachedInstanceDom();
+
+            for (auto& [instanceAlias, instance] : m_nestedInstances)
+            {
+                instance->ClearCachedInstanceDomInHierarchy();
+            }
+        }
+
+        void Instance::CacheInstanceDom(const PrefabDomValue& instanceDom)
+        {
+            if (!instanceDom.IsObject())
+            {
+                ClearCachedInstanceDom();
+                return;
+            }
+
+            // A new document is used every time as the memory of a document's allocator is only released when it's destroyed.
+            auto cachedInstanceDom = AZStd::make_unique<PrefabDom>();
+            cachedInstanceDom->SetObject();
+            for (auto& member : instanceDom.GetObject())
+            {
+                if (member.name != PrefabDomUtils::InstancesName)
+                {
+                    cachedInstanceDom->AddMember(
+                        PrefabDomValue(member.name, cachedInstanceDom->GetAllocator()),
+                        PrefabDomValue(member.value, cachedInstanceDom->GetAllocator()),
+                        cachedInstanceDom->GetAllocator());
+                }
+            }
+            m_cachedInstanceDom = AZStd::move(cachedInstanceDom);
+        }
+
+        void Instance::ClearCachedInstanceDom()
+        {
+            m_cachedInstanceDom.reset();
+        }
+
         EntityAlias Instance::GenerateEntityAlias()
         {
             return AZStd::string::format("Entity_%s", AZ::Entity::MakeId().ToString().c_str());
@@ -645,11 +718,13 @@ namespace AzToolsFramework
 
         void Instance::SetContainerEntity(AZ::Entity& entity)
         {
+            ClearCachedInstanceDom();
             m_containerEntity.reset(&entity);
         }
 
         AZStd::unique_ptr<AZ::Entity> Instance::DetachContainerEntity()
         {
+            ClearCachedInstanceDom();
             m_instanceEntityMapper->UnregisterEntity(m_containerEntity->GetId());
             return AZStd::move(m_containerEntity);
         }
@@ -18,6 +18,7 @@
 #include <AzCore/std/optional.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/string/string.h>
+#include <AzToolsFramework/Prefab/PrefabDomTypes.h>
 #include <AzToolsFramework/Prefab/PrefabIdTypes.h>
 
 namespace AZ
@@ -179,6 +180,20 @@ namespace AzToolsFramework
             static EntityAlias GenerateEntityAlias();
             AliasPath GetAbsoluteInstanceAliasPath() const;
 
+            /**
+            * Remembers that this instance and its nested instances are in sync with the given instance DOM, so the next load with
+            * PrefabDomUtils::LoadInstanceFlags::ReloadChangedOnly only reloads what changed compared to it.
+            * Use this after changing the live entities of the instance first and then updating the template DOM accordingly.
+            * @param instanceDom The DOM of this instance, including its nested instances.
+            */
+            void SetCachedInstanceDom(const PrefabDomValue& instanceDom);
+
+            /**
+            * Forgets the cached instance DOM of this instance and all of its nested instances, so they'll be fully reloaded the
+            * next time they get loaded from a DOM.
+            */
+            void ClearCachedInstanceDomInHierarchy();
+
             static InstanceAlias GenerateInstanceAlias();
 
         private:
@@ -186,6 +201,10 @@ namespace AzToolsFramework
 
             void ClearEntities();
 
+            //! Stores the instance DOM, without its nested instances, this instance was loaded from.
+            void CacheInstanceDom(const PrefabDomValue& instanceDom);
+            void ClearCachedInstanceDom();
+
             void RemoveEntities(const AZStd::function<bool(const AZStd::unique_ptr<AZ::Entity>&)>& filter);
 
             bool GetEntities_Impl(const AZStd::function<bool(AZStd::unique_ptr<AZ::Entity>&)>& callback);
@@ -229,6 +248,10 @@ namespace AzToolsFramework
             // Pointer to the parent instance if nested
             Instance* m_parent = nullptr;
 
+            // The DOM this instance was last loaded from, without the nested instances. Used to only reload the entities that changed
+            // when the template of this instance is propagated again. Null when it's unknown whether the instance is in sync with a DOM.
+            AZStd::unique_ptr<PrefabDom> m_cachedInstanceDom;
+
             // Interface for registering owned entities for external queries
             InstanceEntityMapperInterface* m_instanceEntityMapper = nullptr;
 
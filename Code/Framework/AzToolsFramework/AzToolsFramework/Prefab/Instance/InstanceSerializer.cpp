@@ -7,12 +7,14 @@
  */
 
 #include <AzCore/Component/Entity.h>
+#include <AzCore/Serialization/Json/JsonSerialization.h>
 #include <AzCore/Serialization/Json/RegistrationContext.h>
 #include <AzToolsFramework/Prefab/Instance/Instance.h>
 #include <AzToolsFramework/Prefab/Instance/InstanceEntityScrubber.h>
 #include <AzToolsFramework/Prefab/Instance/InstanceSerializer.h>
 #include <AzToolsFramework/Prefab/Instance/InstanceEntityIdMapper.h>
 #include <AzToolsFramework/Prefab/Instance/InstanceEntityMapperInterface.h>
+#include <AzToolsFramework/Prefab/PrefabDomUtils.h>
 #include <AzToolsFramework/Prefab/PrefabLoaderInterface.h>
 #include <AzToolsFramework/Prefab/PrefabSystemComponentInterface.h>
 
@@ -100,6 +102,15 @@ namespace AzToolsFramework
 
             InstanceEntityIdMapper** idMapper = context.GetMetadata().Find<InstanceEntityIdMapper*>();
 
+            const bool reloadChangedOnly = context.GetMetadata().Find<InstanceReloadChangedOnlySettings>() != nullptr;
+            if (reloadChangedOnly && CanReloadChangedOnly(instance, inputValue))
+            {
+                JSR::ResultCode reloadResult = ReloadChangedOnly(instance, inputValue, context);
+                return context.Report(reloadResult,
+                    reloadResult.GetProcessing() == JSR::Processing::Completed ? "Successfully reloaded changed instance information for prefab." :
+                    "Failed to reload changed instance information for prefab");
+            }
+
             JSR::ResultCode result(JSR::Tasks::ReadField);
             {
                 JSR::ResultCode sourceLoadResult =
@@ -194,6 +205,11 @@ namespace AzToolsFramework
                 result.Combine(ContinueLoadingFromJsonObjectField(&instance->m_linkId, azrtti_typeid<LinkId>(), inputValue, "LinkId", context));
             }
 
+            if (reloadChangedOnly && result.GetProcessing() == JSR::Processing::Completed)
+            {
+                instance->CacheInstanceDom(inputValue);
+            }
+
             return context.Report(result,
                 result.GetProcessing() == JSR::Processing::Completed ? "Successfully loaded instance information for prefab." :
                 "Failed to load instance information for prefab");
@@ -221,5 +237,196 @@ namespace AzToolsFramework
             }
         }
 
+        bool JsonInstanceSerializer::CanReloadChangedOnly(const Instance* instance, const rapidjson::Value& inputValue)
+        {
+            if (!instance->m_cachedInstanceDom || !inputValue.IsObject())
+            {
+                return false;
+            }
+
+            // Everything other than the entities, the container entity and the link id needs to be unchanged. The cached DOM doesn't
+            // contain the nested instances so they are skipped in the member count.
+            const PrefabDom& cachedInstanceDom = *instance->m_cachedInstanceDom;
+            rapidjson::SizeType memberCount = 0;
+            for (auto& member : inputValue.GetObject())
+            {
+                if (member.name == PrefabDomUtils::InstancesName)
+                {
+                    continue;
+                }
+
+                ++memberCount;
+                if (member.name == PrefabDomUtils::EntitiesName || member.name == PrefabDomUtils::ContainerEntityName ||
+                    member.name == PrefabDomUtils::LinkIdName)
+                {
+                    continue;
+                }
+
+                auto cachedMember = cachedInstanceDom.FindMember(member.name);
+                if (cachedMember == cachedInstanceDom.MemberEnd() ||
+                    AZ::JsonSerialization::Compare(member.value, cachedMember->value) != AZ::JsonSerializerCompareResult::Equal)
+                {
+                    return false;
+                }
+            }
+
+            if (memberCount != cachedInstanceDom.MemberCount())
+            {
+                return false;
+            }
+
+            // The existing nested instances can only be updated in place if none were added or removed.
+            auto instancesMemberIter = inputValue.FindMember(PrefabDomUtils::InstancesName);
+            if (instancesMemberIter == inputValue.MemberEnd() || !instancesMemberIter->value.IsObject())
+            {
+                return instance->m_nestedInstances.empty();
+            }
+
+            if (instancesMemberIter->value.MemberCount() != instance->m_nestedInstances.size())
+            {
+                return false;
+            }
+
+            for (auto& instanceIter : instancesMemberIter->value.GetObject())
+            {
+                InstanceAlias instanceAlias(instanceIter.name.GetString(), instanceIter.name.GetStringLength());
+                if (instance->m_nestedInstances.find(instanceAlias) == instance->m_nestedInstances.end())
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        AZ::JsonSerializationResult::ResultCode JsonInstanceSerializer::ReloadChangedOnly(
+            Instance* instance, const rapidjson::Value& inputValue, AZ::JsonDeserializerContext& context)
+        {
+            namespace JSR = AZ::JsonSerializationResult;
+
+            JSR::ResultCode result(JSR::Tasks::ReadField);
+
+            // Take the cached DOM out of the instance because detaching entities below clears it.
+            AZStd::unique_ptr<PrefabDom> cachedInstanceDom = AZStd::move(instance->m_cachedInstanceDom);
+
+            // Nested instances decide for themselves whether they can be partially reloaded.
+            auto instancesMemberIter = inputValue.FindMember(PrefabDomUtils::InstancesName);
+            if (instancesMemberIter != inputValue.MemberEnd() && instancesMemberIter->value.IsObject())
+            {
+                for (auto& instanceIter : instancesMemberIter->value.GetObject())
+                {
+                    InstanceAlias instanceAlias(instanceIter.name.GetString(), instanceIter.name.GetStringLength());
+                    Instance* nestedInstance = instance->m_nestedInstances[instanceAlias].get();
+                    result.Combine(ContinueLoading(nestedInstance, azrtti_typeid<Instance>(), instanceIter.value, context));
+                }
+            }
+
+            InstanceEntityIdMapper** idMapper = context.GetMetadata().Find<InstanceEntityIdMapper*>();
+            if (idMapper && *idMapper)
+            {
+                (*idMapper)->SetLoadingInstance(*instance);
+            }
+
+            EntityList reloadedEntities;
+
+            auto containerEntityIter = inputValue.FindMember(PrefabDomUtils::ContainerEntityName);
+            auto cachedContainerEntityIter = cachedInstanceDom->FindMember(PrefabDomUtils::ContainerEntityName);
+            const bool hasContainerEntity = containerEntityIter != inputValue.MemberEnd();
+            const bool hadContainerEntity = cachedContainerEntityIter != cachedInstanceDom->MemberEnd();
+            if (hasContainerEntity != hadContainerEntity ||
+                (hasContainerEntity &&
+                 AZ::JsonSerialization::Compare(containerEntityIter->value, cachedContainerEntityIter->value) !=
+                     AZ::JsonSerializerCompareResult::Equal))
+            {
+                if (instance->m_containerEntity)
+                {
+                    instance->DetachEntity(instance->m_containerEntity->GetId());
+                    instance->m_containerEntity.reset();
+                }
+
+                result.Combine(ContinueLoadingFromJsonObjectField(
+                    &instance->m_containerEntity, azrtti_typeid<decltype(instance->m_containerEntity)>(), inputValue, "ContainerEntity",
+                    context));
+
+                if (instance->m_containerEntity && instance->m_containerEntity->GetId().IsValid())
+                {
+                    reloadedEntities.emplace_back(instance->m_containerEntity.get());
+                }
+            }
+
+            auto entitiesMemberIter = inputValue.FindMember(PrefabDomUtils::EntitiesName);
+            auto cachedEntitiesMemberIter = cachedInstanceDom->FindMember(PrefabDomUtils::EntitiesName);
+            const rapidjson::Value* entitiesValue =
+                (entitiesMemberIter != inputValue.MemberEnd() && entitiesMemberIter->value.IsObject()) ? &entitiesMemberIter->value : nullptr;
+            const rapidjson::Value* cachedEntitiesValue =
+                (cachedEntitiesMemberIter != cachedInstanceDom->MemberEnd() && cachedEntitiesMemberIter->value.IsObject())
+                ? &cachedEntitiesMemberIter->value : nullptr;
+
+            // Destroy the entities that were removed from the DOM.
+            if (cachedEntitiesValue)
+            {
+                for (auto& cachedEntityIter : cachedEntitiesValue->GetObject())
+                {
+                    if (!entitiesValue || !entitiesValue->HasMember(cachedEntityIter.name))
+                    {
+                        AZ::EntityId entityId = instance->GetEntityId(
+                            EntityAlias(cachedEntityIter.name.GetString(), cachedEntityIter.name.GetStringLength()));
+                        if (entityId.IsValid())
+                        {
+                            instance->DetachEntity(entityId);
+                        }
+                    }
+                }
+            }
+
+            // Reload the entities that were added or changed. The previous version of a changed entity is destroyed first so the reloaded
+            // entity can register the same id with the instance.
+            if (entitiesValue)
+            {
+                for (auto& entityIter : entitiesValue->GetObject())
+                {
+                    if (cachedEntitiesValue)
+                    {
+                        auto cachedEntityIter = cachedEntitiesValue->FindMember(entityIter.name);
+                        if (cachedEntityIter != cachedEntitiesValue->MemberEnd() &&
+                            AZ::JsonSerialization::Compare(entityIter.value, cachedEntityIter->value) == AZ::JsonSerializerCompareResult::Equal)
+                        {
+                            continue;
+                        }
+                    }
+
+                    EntityAlias entityAlias(entityIter.name.GetString(), entityIter.name.GetStringLength());
+                    AZ::EntityId entityId = instance->GetEntityId(entityAlias);
+                    if (entityId.IsValid())
+                    {
+                        instance->DetachEntity(entityId);
+                    }
+
+                    AZStd::unique_ptr<AZ::Entity> entity;
+                    result.Combine(ContinueLoading(&entity, azrtti_typeid<decltype(entity)>(), entityIter.value, context));
+                    if (entity)
+                    {
+                        reloadedEntities.emplace_back(entity.get());
+                        instance->m_entities.emplace(AZStd::move(entityAlias), AZStd::move(entity));
+                    }
+                }
+            }
+
+            result.Combine(ContinueLoadingFromJsonObjectField(&instance->m_linkId, azrtti_typeid<LinkId>(), inputValue, "LinkId", context));
+
+            InstanceEntityScrubber* instanceEntityScrubber = context.GetMetadata().Find<InstanceEntityScrubber>();
+            if (instanceEntityScrubber)
+            {
+                instanceEntityScrubber->AddEntitiesToScrub(reloadedEntities);
+            }
+
+            if (result.GetProcessing() == JSR::Processing::Completed)
+            {
+                instance->CacheInstanceDom(inputValue);
+            }
+
+            return result;
+        }
+
     } // namespace Prefab
 }
@@ -17,6 +17,14 @@ namespace AzToolsFramework
     {
         class Instance;
 
+        //! Metadata that makes the JsonInstanceSerializer only reload the entities of an existing instance that changed since it was
+        //! last loaded with this metadata. The loaded instance DOMs are cached in the instances to compare against.
+        //! Instances are fully reloaded when they have no cached DOM, or when anything other than their entities changed.
+        struct InstanceReloadChangedOnlySettings
+        {
+            AZ_TYPE_INFO(InstanceReloadChangedOnlySettings, "{7A1C5E93-0B2D-4F68-8E4A-C93D16B7F205}");
+        };
+
         class JsonInstanceSerializer
             : public AZ::BaseJsonSerializer
         {
@@ -35,6 +43,15 @@ namespace AzToolsFramework
             //! Adds the entities of an instance to a InstanceEntityScrubber object in the metadata of JsonDeserializerContext
             //! so that they can be scrubbed later.
             void AddEntitiesToScrub(const Instance* instance, AZ::JsonDeserializerContext& jsonDeserializercontext);
+
+            //! Checks whether the instance can be updated to the input value by only reloading its changed entities, which requires a
+            //! cached instance DOM and the same nested instances.
+            static bool CanReloadChangedOnly(const Instance* instance, const rapidjson::Value& inputValue);
+
+            //! Updates the instance to the input value by only reloading the entities that differ from the cached instance DOM.
+            //! Nested instances are updated recursively.
+            AZ::JsonSerializationResult::ResultCode ReloadChangedOnly(
+                Instance* instance, const rapidjson::Value& inputValue, AZ::JsonDeserializerContext& context);
         };
     }
 }
@@ -76,9 +76,33 @@ namespace AzToolsFramework
             {
                 if (instance != instanceToExcludePtr)
                 {
+                    // An instance that was excluded earlier is now reloaded as well, so its cached DOM doesn't need to be synced
+                    // anymore. Drop the cached DOM because it may no longer match the live state of the instance.
+                    auto syncIter = AZStd::find(m_instancesToSyncCache.begin(), m_instancesToSyncCache.end(), instance);
+                    if (syncIter != m_instancesToSyncCache.end())
+                    {
+                        m_instancesToSyncCache.erase(syncIter);
+                        instance->ClearCachedInstanceDomInHierarchy();
+                    }
                     m_instancesUpdateQueue.emplace_back(instance);
                 }
             }
+
+            // The excluded instance already has the changes, but its cached DOM doesn't. Sync the cached DOM on the next update so
+            // it can still be partially reloaded later on.
+            if (instanceToExcludePtr)
+            {
+                if (AZStd::find(m_instancesUpdateQueue.begin(), m_instancesUpdateQueue.end(), instanceToExcludePtr) !=
+                    m_instancesUpdateQueue.end())
+                {
+                    instanceToExcludePtr->ClearCachedInstanceDomInHierarchy();
+                }
+                else if (AZStd::find(m_instancesToSyncCache.begin(), m_instancesToSyncCache.end(), instanceToExcludePtr) ==
+                    m_instancesToSyncCache.end())
+                {
+                    m_instancesToSyncCache.emplace_back(instanceToExcludePtr);
+                }
+            }
         }
 
         void InstanceUpdateExecutor::RemoveTemplateInstanceFromQueue(const Instance* instance)
@@ -87,6 +111,37 @@ namespace AzToolsFramework
             {
                 return entry == instance;
             });
+            AZStd::erase_if(m_instancesToSyncCache, [instance](Instance* entry)
+            {
+                return entry == instance;
+            });
+        }
+
+        PrefabDomValue* InstanceUpdateExecutor::FindInstanceDomFromRoot(const Instance& instance)
+        {
+            // Climb up to the root of the instance hierarchy from this instance
+            InstanceOptionalConstReference rootInstance = instance;
+            AZStd::vector<InstanceOptionalConstReference> pathOfInstances;
+
+            while (rootInstance->get().GetParentInstance() != AZStd::nullopt)
+            {
+                pathOfInstances.emplace_back(rootInstance);
+                rootInstance = rootInstance->get().GetParentInstance();
+            }
+
+            AZStd::string aliasPathResult = "";
+            for (auto instanceIter = pathOfInstances.rbegin(); instanceIter != pathOfInstances.rend(); ++instanceIter)
+            {
+                aliasPathResult.append("/Instances/");
+                aliasPathResult.append((*instanceIter)->get().GetInstanceAlias());
+            }
+
+            PrefabDomPath rootPrefabDomPath(aliasPathResult.c_str());
+
+            PrefabDom& rootPrefabTemplateDom =
+                m_prefabSystemComponentInterface->FindTemplateDom(rootInstance->get().GetTemplateId());
+
+            return rootPrefabDomPath.Get(rootPrefabTemplateDom);
         }
 
         bool InstanceUpdateExecutor::UpdateTemplateInstancesInQueue()
@@ -96,6 +151,23 @@ namespace AzToolsFramework
             {
                 m_updatingTemplateInstancesInQueue = true;
 
+                // Sync the cached DOMs of instances that were excluded from propagation first. If one of their ancestors is reloaded
+                // below, the excluded instance then only gets its changed entities reloaded instead of being rebuilt.
+                while (!m_instancesToSyncCache.empty())
+                {
+                    Instance* instanceToSync = m_instancesToSyncCache.front();
+                    m_instancesToSyncCache.pop_front();
+
+                    if (PrefabDomValue* instanceDomFromRoot = FindInstanceDomFromRoot(*instanceToSync))
+                    {
+                        instanceToSync->SetCachedInstanceDom(*instanceDomFromRoot);
+                    }
+                    else
+                    {
+                        instanceToSync->ClearCachedInstanceDomInHierarchy();
+                    }
+                }
+
                 const int instanceCountToUpdateInBatch =
                     m_instanceCountToUpdateInBatch == 0 ? m_instancesUpdateQueue.size() : m_instanceCountToUpdateInBatch;
                 TemplateId currentTemplateId = InvalidTemplateId;
@@ -155,42 +227,8 @@ namespace AzToolsFramework
 
                         Instance::EntityList newEntities;
 
-                        // Climb up to the root of the instance hierarchy from this instance
-                        InstanceOptionalConstReference rootInstance = *instanceToUpdate;
-                        AZStd::vector<InstanceOptionalConstReference> pathOfInstances;
-
-                        while (rootInstance->get().GetParentInstance() != AZStd::nullopt)
-                        {
-                            pathOfInstances.emplace_back(rootInstance);
-                            rootInstance = rootInstance->get().GetParentInstance();
-                        }
-
-                        AZStd::string aliasPathResult = "";
-                        for (auto instanceIter = pathOfInstances.rbegin(); instanceIter != pathOfInstances.rend(); ++instanceIter)
-                        {
-                            aliasPathResult.append("/Instances/");
-                            aliasPathResult.append((*instanceIter)->get().GetInstanceAlias());
-                        }
-
-                        PrefabDomPath rootPrefabDomPath(aliasPathResult.c_str());
-
-                        PrefabDom& rootPrefabTemplateDom =
-                            m_prefabSystemComponentInterface->FindTemplateDom(rootInstance->get().GetTemplateId());
-
-                        auto instanceDomFromRootValue = rootPrefabDomPath.Get(rootPrefabTemplateDom);
-                        if (!instanceDomFromRootValue)
-                        {
-                            AZ_Assert(
-                                false,
-                                "InstanceUpdateExecutor::UpdateTemplateInstancesInQueue - "
-                                "Could not load Instance DOM from the top level ancestor's DOM.");
-
-                            isUpdateSuccessful = false;
-                            continue;
-                        }
-
-                        PrefabDomValueReference instanceDomFromRoot = *instanceDomFromRootValue;
-                        if (!instanceDomFromRoot.has_value())
+                        PrefabDomValue* instanceDomFromRoot = FindInstanceDomFromRoot(*instanceToUpdate);
+                        if (!instanceDomFromRoot)
                         {
                             AZ_Assert(
                                 false,
@@ -203,8 +241,10 @@ namespace AzToolsFramework
 
                         // If a link was created for a nested instance before the changes were propagated,
                         // then we associate it correctly here
-                        instanceDomFromRootDocument.CopyFrom(instanceDomFromRoot->get(), instanceDomFromRootDocument.GetAllocator());
-                        if (PrefabDomUtils::LoadInstanceFromPrefabDom(*instanceToUpdate, newEntities, instanceDomFromRootDocument))
+                        instanceDomFromRootDocument.CopyFrom(*instanceDomFromRoot, instanceDomFromRootDocument.GetAllocator());
+                        if (PrefabDomUtils::LoadInstanceFromPrefabDom(
+                                *instanceToUpdate, newEntities, instanceDomFromRootDocument,
+                                PrefabDomUtils::LoadInstanceFlags::ReloadChangedOnly))
                         {
                             Template& currentTemplate = currentTemplateReference->get();
                             instanceToUpdate->GetNestedInstances([&](AZStd::unique_ptr<Instance>& nestedInstance) 
@@ -12,6 +12,7 @@
 #include <AzCore/Serialization/Json/JsonSerialization.h>
 #include <AzCore/std/containers/deque.h>
 #include <AzToolsFramework/Prefab/Instance/InstanceUpdateExecutorInterface.h>
+#include <AzToolsFramework/Prefab/PrefabDomTypes.h>
 #include <AzToolsFramework/Prefab/PrefabIdTypes.h>
 
 namespace AzToolsFramework
@@ -39,10 +40,15 @@ namespace AzToolsFramework
             void UnregisterInstanceUpdateExecutorInterface();
 
         private:
+            //! Finds the DOM of the instance in the template DOM of the root of its instance hierarchy.
+            PrefabDomValue* FindInstanceDomFromRoot(const Instance& instance);
+
             PrefabSystemComponentInterface* m_prefabSystemComponentInterface = nullptr;
             TemplateInstanceMapperInterface* m_templateInstanceMapperInterface = nullptr;
             int m_instanceCountToUpdateInBatch = 0;
             AZStd::deque<Instance*> m_instancesUpdateQueue;
+            //! Instances that were excluded from propagation and need their cached instance DOM updated to their template.
+            AZStd::deque<Instance*> m_instancesToSyncCache;
             bool m_updatingTemplateInstancesInQueue { false };
         };
     }
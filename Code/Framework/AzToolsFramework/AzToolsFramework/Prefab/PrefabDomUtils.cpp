@@ -100,6 +100,10 @@ namespace AzToolsFramework
                 // data has strict typing and doesn't look for inheritance both have to be explicitly added so they're found both locations.
                 settings.m_metadata.Add(static_cast<AZ::JsonEntityIdSerializer::JsonEntityIdMapper*>(&entityIdMapper));
                 settings.m_metadata.Add(&entityIdMapper);
+                if ((flags & LoadInstanceFlags::ReloadChangedOnly) == LoadInstanceFlags::ReloadChangedOnly)
+                {
+                    settings.m_metadata.Create<InstanceReloadChangedOnlySettings>();
+                }
                 
                 AZ::JsonSerializationResult::ResultCode result =
                     AZ::JsonSerialization::Load(instance, prefabDom, settings);
@@ -139,6 +143,10 @@ namespace AzToolsFramework
                 // data has strict typing and doesn't look for inheritance both have to be explicitly added so they're found both locations.
                 settings.m_metadata.Add(static_cast<AZ::JsonEntityIdSerializer::JsonEntityIdMapper*>(&entityIdMapper));
                 settings.m_metadata.Add(&entityIdMapper);
+                if ((flags & LoadInstanceFlags::ReloadChangedOnly) == LoadInstanceFlags::ReloadChangedOnly)
+                {
+                    settings.m_metadata.Create<InstanceReloadChangedOnlySettings>();
+                }
                 settings.m_metadata.Create<AZ::Data::SerializedAssetTracker>();
 
                 AZ::JsonSerializationResult::ResultCode result =
@@ -181,6 +189,10 @@ namespace AzToolsFramework
                 // data has strict typing and doesn't look for inheritance both have to be explicitly added so they're found both locations.
                 settings.m_metadata.Add(static_cast<AZ::JsonEntityIdSerializer::JsonEntityIdMapper*>(&entityIdMapper));
                 settings.m_metadata.Add(&entityIdMapper);
+                if ((flags & LoadInstanceFlags::ReloadChangedOnly) == LoadInstanceFlags::ReloadChangedOnly)
+                {
+                    settings.m_metadata.Create<InstanceReloadChangedOnlySettings>();
+                }
                 settings.m_metadata.Create<InstanceEntityScrubber>(newlyAddedEntities);
 
                 AZ::JsonSerializationResult::ResultCode result = AZ::JsonSerialization::Load(instance, prefabDom, settings);
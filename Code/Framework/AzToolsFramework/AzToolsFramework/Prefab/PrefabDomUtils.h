@@ -64,7 +64,11 @@ namespace AzToolsFramework
                 None = 0,
                 //! By default entities will get a stable id when they're deserialized. In cases where the new entities need to be kept
                 //! unique, e.g. when they are duplicates of live entities, this flag will assign them a random new id.
-                AssignRandomEntityId = 1 << 0
+                AssignRandomEntityId = 1 << 0,
+                //! Only reload the entities that changed since the instance was last loaded with this flag, instead of rebuilding the
+                //! whole instance. The instance falls back to a full reload if it wasn't loaded with this flag before, or if anything
+                //! other than its entities changed.
+                ReloadChangedOnly = 1 << 1
             };
             AZ_DEFINE_ENUM_BITWISE_OPERATORS(LoadInstanceFlags);
 
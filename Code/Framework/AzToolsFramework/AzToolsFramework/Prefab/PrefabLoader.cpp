@@ -10,7 +10,12 @@
 #include <AzToolsFramework/Prefab/PrefabLoader.h>
 
 #include <AzCore/Component/Entity.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManagerBus.h>
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
 #include <AzCore/StringFunc/StringFunc.h>
 
@@ -25,6 +30,10 @@ namespace AzToolsFramework
 {
     namespace Prefab
     {
+        AZ_CVAR(
+            bool, ed_prefabParallelFileLoading, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Read and parse all prefab files referenced by a prefab in parallel before its templates are created.");
+
         void PrefabLoader::RegisterPrefabLoaderInterface()
         {
             m_prefabSystemComponentInterface = AZ::Interface<PrefabSystemComponentInterface>::Get();
@@ -52,6 +61,11 @@ namespace AzToolsFramework
 
         TemplateId PrefabLoader::LoadTemplateFromFile(AZ::IO::PathView filePath)
         {
+            if (ed_prefabParallelFileLoading)
+            {
+                PrefetchPrefabDoms(filePath);
+            }
+
             AZStd::unordered_set<AZ::IO::Path> progressedFilePathsSet;
             TemplateId newTemplateId = LoadTemplateFromFile(filePath, progressedFilePathsSet);
             return newTemplateId;
@@ -70,7 +84,32 @@ namespace AzToolsFramework
                 return InvalidTemplateId;
             }
 
-            auto readResult = AZ::Utils::ReadFile(GetFullPath(filePath).Native(), AZStd::numeric_limits<size_t>::max());
+            AZ::IO::Path relativePath = GenerateRelativePath(filePath);
+            if (HasCyclicalDependency(relativePath, filePath, progressedFilePathsSet))
+            {
+                return InvalidTemplateId;
+            }
+
+            // Directly return loaded Template id.
+            TemplateId loadedTemplateId = m_prefabSystemComponentInterface->GetTemplateIdFromFilePath(relativePath);
+            if (loadedTemplateId != InvalidTemplateId)
+            {
+                return loadedTemplateId;
+            }
+
+            AZ::IO::Path fullPath = GetFullPath(filePath);
+
+            // Use the parsed Prefab DOM from the cache if the file didn't change since it was parsed.
+            auto cachedPrefabDomIter = m_parsedPrefabDomCache.find(relativePath);
+            if (cachedPrefabDomIter != m_parsedPrefabDomCache.end() &&
+                cachedPrefabDomIter->second.m_modificationTime == AZ::IO::SystemFile::ModificationTime(fullPath.c_str()))
+            {
+                PrefabDom prefabDom;
+                prefabDom.CopyFrom(cachedPrefabDomIter->second.m_prefabDom, prefabDom.GetAllocator());
+                return LoadTemplateFromPrefabDom(AZStd::move(prefabDom), filePath, relativePath, progressedFilePathsSet);
+            }
+
+            auto readResult = AZ::Utils::ReadFile(fullPath.Native(), AZStd::numeric_limits<size_t>::max());
             if (!readResult.IsSuccess())
             {
                 AZ_Error(
@@ -86,6 +125,154 @@ namespace AzToolsFramework
             return LoadTemplateFromString(readResult.GetValue(), filePath, progressedFilePathsSet);
         }
 
+        void PrefabLoader::PrefetchPrefabDoms(AZ::IO::PathView filePath)
+        {
+            struct PrefetchedFile
+            {
+                AZ::IO::Path m_relativePath;
+                AZ::IO::Path m_fullPath;
+                PrefabDom m_prefabDom;
+                AZ::u64 m_modificationTime = 0;
+                bool m_isParsed = false;
+            };
+
+            AZStd::unordered_set<AZ::IO::Path> visitedFilePaths;
+            AZStd::vector<PrefetchedFile> filesToRead;
+            auto queueFile = [this, &visitedFilePaths, &filesToRead](AZ::IO::PathView path)
+            {
+                if (!IsValidPrefabPath(path))
+                {
+                    return;
+                }
+
+                // Files with a loaded template are skipped as the loader doesn't read them again.
+                AZ::IO::Path relativePath = GenerateRelativePath(path);
+                if (visitedFilePaths.emplace(relativePath).second &&
+                    m_prefabSystemComponentInterface->GetTemplateIdFromFilePath(relativePath) == InvalidTemplateId)
+                {
+                    PrefetchedFile& file = filesToRead.emplace_back();
+                    file.m_fullPath = GetFullPath(path);
+                    file.m_relativePath = AZStd::move(relativePath);
+                }
+            };
+
+            // The paths are resolved on this thread because that goes through the asset system. Only reading and parsing the files
+            // happens on the job threads. Errors aren't reported here, files that failed to load are read again by the loader which
+            // reports the error.
+            auto readFile = [this](PrefetchedFile& file)
+            {
+                file.m_modificationTime = AZ::IO::SystemFile::ModificationTime(file.m_fullPath.c_str());
+
+                // The cache is only modified on the calling thread after all jobs completed.
+                auto cachedPrefabDomIter = m_parsedPrefabDomCache.find(file.m_relativePath);
+                if (cachedPrefabDomIter != m_parsedPrefabDomCache.end() &&
+                    cachedPrefabDomIter->second.m_modificationTime == file.m_modificationTime)
+                {
+                    return;
+                }
+
+                auto readResult = AZ::Utils::ReadFile(file.m_fullPath.Native(), AZStd::numeric_limits<size_t>::max());
+                if (readResult.IsSuccess())
+                {
+                    AZ::Outcome<PrefabDom, AZStd::string> parseResult = AzFramework::FileFunc::ReadJsonFromString(readResult.GetValue());
+                    if (parseResult.IsSuccess())
+                    {
+                        file.m_prefabDom.Swap(parseResult.GetValue());
+                        file.m_isParsed = true;
+                    }
+                }
+            };
+
+            AZ::JobContext* jobContext = nullptr;
+            AZ::JobManagerBus::BroadcastResult(jobContext, &AZ::JobManagerEvents::GetGlobalContext);
+
+            // Read the prefab hierarchy one level of nesting at a time, as the nested prefabs are only known after parsing their parents.
+            queueFile(filePath);
+            AZStd::vector<PrefetchedFile> readFiles;
+            while (!filesToRead.empty())
+            {
+                readFiles.swap(filesToRead);
+                filesToRead.clear();
+
+                if (jobContext != nullptr && readFiles.size() > 1)
+                {
+                    AZ::JobCompletion completion(jobContext);
+                    for (size_t i = 1; i < readFiles.size(); ++i)
+                    {
+                        AZ::Job* job = AZ::CreateJobFunction([&readFile, &file = readFiles[i]]()
+                            {
+                                readFile(file);
+                            }, true, jobContext);
+                        job->SetDependent(&completion);
+                        job->Start();
+                    }
+                    readFile(readFiles[0]);
+                    completion.StartAndWaitForCompletion();
+                }
+                else
+                {
+                    for (PrefetchedFile& file : readFiles)
+                    {
+                        readFile(file);
+                    }
+                }
+
+                for (PrefetchedFile& file : readFiles)
+                {
+                    if (file.m_isParsed)
+                    {
+                        ParsedPrefabDom& cachedPrefabDom = m_parsedPrefabDomCache[file.m_relativePath];
+                        cachedPrefabDom.m_prefabDom.Swap(file.m_prefabDom);
+                        cachedPrefabDom.m_modificationTime = file.m_modificationTime;
+                    }
+
+                    auto cachedPrefabDomIter = m_parsedPrefabDomCache.find(file.m_relativePath);
+                    if (cachedPrefabDomIter == m_parsedPrefabDomCache.end() ||
+                        cachedPrefabDomIter->second.m_modificationTime != file.m_modificationTime)
+                    {
+                        continue;
+                    }
+
+                    PrefabDomValueConstReference instancesReference =
+                        PrefabDomUtils::FindPrefabDomValue(cachedPrefabDomIter->second.m_prefabDom, PrefabDomUtils::InstancesName);
+                    if (!instancesReference.has_value() || !instancesReference->get().IsObject())
+                    {
+                        continue;
+                    }
+
+                    for (auto& instance : instancesReference->get().GetObject())
+                    {
+                        PrefabDomValueConstReference sourceReference =
+                            PrefabDomUtils::FindPrefabDomValue(instance.value, PrefabDomUtils::SourceName);
+                        if (sourceReference.has_value() && sourceReference->get().IsString())
+                        {
+                            queueFile(AZStd::string_view(sourceReference->get().GetString(), sourceReference->get().GetStringLength()));
+                        }
+                    }
+                }
+                readFiles.clear();
+            }
+        }
+
+        bool PrefabLoader::HasCyclicalDependency(
+            const AZ::IO::Path& relativePath, AZ::IO::PathView originPath, const AZStd::unordered_set<AZ::IO::Path>& progressedFilePathsSet)
+        {
+            // Cyclical dependency detected if the prefab file is already part of the progressed
+            // file path set.
+            if (progressedFilePathsSet.contains(relativePath))
+            {
+                AZ_Error(
+                    "Prefab", false,
+                    "PrefabLoader::LoadTemplateFromString - "
+                    "Prefab file '%.*s' has been detected to directly or indirectly depend on itself."
+                    "Terminating any further loading of this branch of its prefab hierarchy.",
+                    AZ_STRING_ARG(originPath.Native())
+                );
+                return true;
+            }
+            return false;
+        }
+
         TemplateId PrefabLoader::LoadTemplateFromString(
             AZStd::string_view content, AZ::IO::PathView originPath)
         {
@@ -111,18 +298,8 @@ namespace AzToolsFramework
             }
 
             AZ::IO::Path relativePath = GenerateRelativePath(originPath);
-
-            // Cyclical dependency detected if the prefab file is already part of the progressed
-            // file path set.
-            if (progressedFilePathsSet.contains(relativePath))
+            if (HasCyclicalDependency(relativePath, originPath, progressedFilePathsSet))
             {
-                AZ_Error(
-                    "Prefab", false,
-                    "PrefabLoader::LoadTemplateFromString - "
-                    "Prefab file '%.*s' has been detected to directly or indirectly depend on itself."
-                    "Terminating any further loading of this branch of its prefab hierarchy.",
-                    AZ_STRING_ARG(originPath.Native())
-                );
                 return InvalidTemplateId;
             }
 
@@ -147,12 +324,21 @@ namespace AzToolsFramework
                 return InvalidTemplateId;
             }
 
+            return LoadTemplateFromPrefabDom(readPrefabFileResult.TakeValue(), originPath, relativePath, progressedFilePathsSet);
+        }
+
+        TemplateId PrefabLoader::LoadTemplateFromPrefabDom(
+            PrefabDom&& prefabDom,
+            AZ::IO::PathView originPath,
+            const AZ::IO::Path& relativePath,
+            AZStd::unordered_set<AZ::IO::Path>& progressedFilePathsSet)
+        {
             // Add or replace the Source parameter in the dom
             PrefabDomPath sourcePath = PrefabDomPath((AZStd::string("/") + PrefabDomUtils::SourceName).c_str());
-            sourcePath.Set(readPrefabFileResult.GetValue(), relativePath.Native().c_str());
+            sourcePath.Set(prefabDom, relativePath.Native().c_str());
 
             // Create new Template with the Prefab DOM.
-            TemplateId newTemplateId = m_prefabSystemComponentInterface->AddTemplate(relativePath, readPrefabFileResult.TakeValue());
+            TemplateId newTemplateId = m_prefabSystemComponentInterface->AddTemplate(relativePath, AZStd::move(prefabDom));
             if (newTemplateId == InvalidTemplateId)
             {
                 AZ_Error(
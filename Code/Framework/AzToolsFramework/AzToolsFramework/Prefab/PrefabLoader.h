@@ -12,6 +12,7 @@
 
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/std/string/string.h>
 #include <AzToolsFramework/Prefab/PrefabDomTypes.h>
@@ -142,6 +143,37 @@ namespace AzToolsFramework
                 AZ::IO::PathView filePath,
                 AZStd::unordered_set<AZ::IO::Path>& progressedFilePathsSet);
 
+            /**
+             * Create a Prefab Template from a parsed Prefab DOM and load its nested Templates.
+             * @param prefabDom The parsed Prefab DOM of the template, which is moved into the new Template.
+             * @param originPath Path that will be used for the template if saved to file.
+             * @param relativePath The originPath relative to the project.
+             * @param progressedFilePathsSet An unordered_set to track if there's any cyclical dependency between Templates.
+             * @return A unique id of the new Template. Return invalid id if creating the Template failed.
+             */
+            TemplateId LoadTemplateFromPrefabDom(
+                PrefabDom&& prefabDom,
+                AZ::IO::PathView originPath,
+                const AZ::IO::Path& relativePath,
+                AZStd::unordered_set<AZ::IO::Path>& progressedFilePathsSet);
+
+            /**
+             * Read and parse the Prefab file on the given path and all Prefab files it directly or indirectly references.
+             * The files are read and parsed in parallel, one level of nesting at a time, and the parsed Prefab DOMs are stored
+             * in the parsed Prefab DOM cache. Files whose Template is already loaded or which are already cached are skipped.
+             * @param filePath A Prefab Template file path.
+             */
+            void PrefetchPrefabDoms(AZ::IO::PathView filePath);
+
+            /**
+             * Check if the Template on the relative path is already being loaded further up the Prefab hierarchy.
+             * @return True and reports an error if a cyclical dependency was detected.
+             */
+            static bool HasCyclicalDependency(
+                const AZ::IO::Path& relativePath,
+                AZ::IO::PathView originPath,
+                const AZStd::unordered_set<AZ::IO::Path>& progressedFilePathsSet);
+
             /**
              * Load nested instance given a nested instance value iterator and target Template with its id.
              * @param instanceIterator A nested instance value iterator.
@@ -171,6 +203,16 @@ namespace AzToolsFramework
             //! Retrieves Dom content and its path from a template id
             AZStd::optional<AZStd::pair<PrefabDom, AZ::IO::Path>> StoreTemplateIntoFileFormat(TemplateId templateId);
 
+            struct ParsedPrefabDom
+            {
+                PrefabDom m_prefabDom;
+                AZ::u64 m_modificationTime = 0;
+            };
+
+            //! Parsed Prefab files as they are on disk, by path relative to the project. Entries are used as long as the modification
+            //! time of their file doesn't change, so reopening a level doesn't need to parse its Prefab files again.
+            AZStd::unordered_map<AZ::IO::Path, ParsedPrefabDom> m_parsedPrefabDomCache;
+
             PrefabSystemComponentInterface* m_prefabSystemComponentInterface = nullptr;
             AZ::IO::Path m_projectPathWithOsSeparator;
             AZ::IO::Path m_projectPathWithSlashSeparator;
@@ -107,6 +107,7 @@ namespace AzToolsFramework
                 FinalizeAll();
                 sqlite3_close(m_db);
                 m_db = NULL;
+                m_transactionDepth = 0;
             }
         }
 
@@ -217,7 +218,16 @@ namespace AzToolsFramework
             {
                 return;
             }
-            sqlite3_exec(m_db, "BEGIN TRANSACTION;", NULL, NULL, NULL);
+            if (m_transactionDepth == 0)
+            {
+                sqlite3_exec(m_db, "BEGIN TRANSACTION;", NULL, NULL, NULL);
+            }
+            else
+            {
+                AZStd::string savepoint = AZStd::string::format("SAVEPOINT nested%d;", m_transactionDepth);
+                sqlite3_exec(m_db, savepoint.c_str(), NULL, NULL, NULL);
+            }
+            ++m_transactionDepth;
         }
 
         void Connection::CommitTransaction()
@@ -227,7 +237,17 @@ namespace AzToolsFramework
             {
                 return;
             }
-            sqlite3_exec(m_db, "COMMIT TRANSACTION;", NULL, NULL, NULL);
+            AZ_Assert(m_transactionDepth > 0, "CommitTransaction:  No transaction to commit!");
+            if (m_transactionDepth <= 1)
+            {
+                sqlite3_exec(m_db, "COMMIT TRANSACTION;", NULL, NULL, NULL);
+                m_transactionDepth = 0;
+                return;
+            }
+
+            --m_transactionDepth;
+            AZStd::string release = AZStd::string::format("RELEASE SAVEPOINT nested%d;", m_transactionDepth);
+            sqlite3_exec(m_db, release.c_str(), NULL, NULL, NULL);
         }
 
         void Connection::RollbackTransaction()
@@ -237,7 +257,18 @@ namespace AzToolsFramework
             {
                 return;
             }
-            sqlite3_exec(m_db, "ROLLBACK;", NULL, NULL, NULL);
+            AZ_Assert(m_transactionDepth > 0, "RollbackTransaction:  No transaction to roll back!");
+            if (m_transactionDepth <= 1)
+            {
+                sqlite3_exec(m_db, "ROLLBACK;", NULL, NULL, NULL);
+                m_transactionDepth = 0;
+                return;
+            }
+
+            // Only undo the changes of this transaction, the outer ones can still commit theirs.
+            --m_transactionDepth;
+            AZStd::string rollback = AZStd::string::format("ROLLBACK TO SAVEPOINT nested%d; RELEASE SAVEPOINT nested%d;", m_transactionDepth, m_transactionDepth);
+            sqlite3_exec(m_db, rollback.c_str(), NULL, NULL, NULL);
         }
 
         void Connection::Vacuum()
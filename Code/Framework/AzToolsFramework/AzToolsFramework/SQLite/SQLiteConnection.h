@@ -46,6 +46,8 @@ namespace AzToolsFramework
             bool IsOpen() const;
 
             // ----- Transaction support -----
+            //! Transactions can be nested. Only the outermost transaction is committed to the database, the inner ones
+            //! are savepoints that can be rolled back on their own.
             void BeginTransaction();
             void CommitTransaction();
             void RollbackTransaction();
@@ -89,6 +91,7 @@ namespace AzToolsFramework
             sqlite3* m_db;
             typedef AZStd::unordered_map< AZStd::string, StatementPrototype* > StatementContainer;
             StatementContainer m_statementPrototypes;
+            int m_transactionDepth = 0; //!< The number of transactions currently open, including the outermost one.
         };
 
         AZStd::string GetColumnText(sqlite3_stmt* statement, int col);
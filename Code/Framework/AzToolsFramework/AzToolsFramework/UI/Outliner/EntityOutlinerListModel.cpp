@@ -33,6 +33,7 @@
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/Outcome/Outcome.h>
+#include <AzCore/std/containers/unordered_map.h>
 
 #include <AzFramework/StringFunc/StringFunc.h>
 
@@ -1171,6 +1172,12 @@ namespace AzToolsFramework
         EditorEntityInfoRequestBus::EventResult(parentId, entityId, &EditorEntityInfoRequestBus::Events::GetParent);
         for (AZ::EntityId currentId = parentId; currentId.IsValid(); currentId = parentId)
         {
+            //siblings share their ancestors, once an ancestor's chain is queued the rest of it doesn't need walking again
+            if (!m_ancestorUpdateQueue.insert(currentId).second)
+            {
+                break;
+            }
+
             QueueEntityUpdate(currentId);
             parentId.SetInvalid();
             EditorEntityInfoRequestBus::EventResult(parentId, currentId, &EditorEntityInfoRequestBus::Events::GetParent);
@@ -1197,6 +1204,7 @@ namespace AzToolsFramework
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Editor);
         m_entityChangeQueued = false;
+        m_ancestorUpdateQueue.clear();
         if (m_layoutResetQueued)
         {
             return;
@@ -1225,32 +1233,39 @@ namespace AzToolsFramework
             AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Editor, "EntityOutlinerListModel::ProcessEntityUpdates:ChangeQueue");
 
             // its faster to just do a bulk data change than to carefully pick out indices
-            // so we'll just merge all ranges into a single range rather than try to make gaps
-            QModelIndex firstChangeIndex;
-            QModelIndex lastChangeIndex;
+            // so we'll merge the rows of each parent into a single range rather than try to make gaps.
+            // A dataChanged range must not span parents, so there is one range per parent.
+            AZStd::unordered_map<AZ::EntityId, ModelIndexRange> changeRanges;
 
             for (auto entityId : m_entityChangeQueue)
             {
                 auto myIndex = GetIndexFromEntity(entityId, ColumnName);
-                if ((!firstChangeIndex.isValid())||(firstChangeIndex.row() > myIndex.row()))
+                if (!myIndex.isValid())
+                {
+                    continue;
+                }
+
+                AZ::EntityId parentId;
+                EditorEntityInfoRequestBus::EventResult(parentId, entityId, &EditorEntityInfoRequestBus::Events::GetParent);
+
+                ModelIndexRange& range = changeRanges[parentId];
+                if ((!range.m_start.isValid()) || (range.m_start.row() > myIndex.row()))
                 {
-                    firstChangeIndex = myIndex;
+                    range.m_start = myIndex;
                 }
-            
-                if ((!lastChangeIndex.isValid())||(lastChangeIndex.row() < myIndex.row()))
+
+                if ((!range.m_end.isValid()) || (range.m_end.row() < myIndex.row()))
                 {
-                    // expand it to be the last column:
-                    lastChangeIndex = myIndex;
+                    range.m_end = myIndex;
                 }
             }
 
-            if (firstChangeIndex.isValid())
+            for (const auto& [parentId, range] : changeRanges)
             {
                 // expand to cover all visible columns:
-                lastChangeIndex = createIndex(lastChangeIndex.row(), VisibleColumnCount - 1, lastChangeIndex.internalPointer());
-                emit dataChanged(firstChangeIndex, lastChangeIndex);
+                emit dataChanged(range.m_start, createIndex(range.m_end.row(), VisibleColumnCount - 1, range.m_end.internalPointer()));
             }
-        
+
             m_entityChangeQueue.clear();
         }
 
@@ -1292,6 +1307,7 @@ namespace AzToolsFramework
         m_layoutResetQueued = false;
         m_entityChangeQueued = false;
         m_entityChangeQueue.clear();
+        m_ancestorUpdateQueue.clear();
         QueueEntityUpdate(AZ::EntityId());
         emit EnableSelectionUpdates(true);
     }
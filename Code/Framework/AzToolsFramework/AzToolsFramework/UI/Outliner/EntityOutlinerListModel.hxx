@@ -180,6 +180,7 @@ namespace AzToolsFramework
         AZStd::unordered_set<AZ::EntityId> m_entitySelectQueue;
         AZStd::unordered_set<AZ::EntityId> m_entityExpandQueue;
         AZStd::unordered_set<AZ::EntityId> m_entityChangeQueue;
+        AZStd::unordered_set<AZ::EntityId> m_ancestorUpdateQueue; //entities whose ancestors are already in m_entityChangeQueue
         bool m_entityChangeQueued;
         bool m_entityLayoutQueued;
         bool m_dropOperationInProgress = false;
@@ -26,9 +26,19 @@ AZ_POP_DISABLE_WARNING
 #include <QtCore/QSet>
 #include <AzToolsFramework/UI/PropertyEditor/ComponentEditor.hxx>
 #include <AzCore/std/sort.h>
+#include <AzCore/std/chrono/clocks.h>
+#include <AzCore/Console/IConsole.h>
 
 namespace AzToolsFramework
 {
+    AZ_CVAR(
+        int,
+        ed_propertyEditorValueRefreshIntervalMs,
+        16,
+        nullptr,
+        AZ::ConsoleFunctorFlags::Null,
+        "The minimum time in milliseconds between two value refreshes of a property editor, 0 refreshes on every request");
+
     const AZ::SerializeContext::ClassData* CreateContainerElementSelectClassCallback(const AZ::Uuid& classId, const AZ::Uuid& typeId, AZ::SerializeContext* context)
     {
         AZStd::vector<const AZ::SerializeContext::ClassData*> derivedClasses;
@@ -218,6 +228,7 @@ namespace AzToolsFramework
         bool HasSavedExpandState(AZ::u32 pathKey) const;
 
         PropertyModificationRefreshLevel m_queuedRefreshLevel;
+        AZStd::chrono::system_clock::time_point m_lastRefreshTime;
         bool m_preventRefresh = false;
         bool m_lastEnabledState = true;
 
@@ -2029,9 +2040,25 @@ namespace AzToolsFramework
             // the callback told us that we need to do something more drastic than we're already scheduled to do (which might be nothing)
             bool rerequest = (m_impl->m_queuedRefreshLevel == Refresh_None); // if we haven't scheduled a refresh, then we will schedule one.
             m_impl->m_queuedRefreshLevel = level;
+
+            // value refreshes happen at most once per ed_propertyEditorValueRefreshIntervalMs, so that dragging a value or
+            // ticking in game mode doesn't refresh on every event loop pass. Structural changes are never delayed.
+            int delayMs = 0;
+            if (level <= Refresh_AttributesAndValues)
+            {
+                const auto elapsedMs = AZStd::chrono::duration_cast<AZStd::chrono::milliseconds>(
+                    AZStd::chrono::system_clock::now() - m_impl->m_lastRefreshTime).count();
+                delayMs = AZStd::max(static_cast<int>(ed_propertyEditorValueRefreshIntervalMs) - static_cast<int>(elapsedMs), 0);
+            }
+            else
+            {
+                // a delayed value refresh may already be scheduled, which then finds nothing left to do
+                rerequest = true;
+            }
+
             if (rerequest)
             {
-                QTimer::singleShot(0, this, SLOT(DoRefresh()));
+                QTimer::singleShot(delayMs, this, SLOT(DoRefresh()));
             }
         }
     }
@@ -2068,6 +2095,7 @@ namespace AzToolsFramework
         }
 
         m_impl->m_queuedRefreshLevel = Refresh_None;
+        m_impl->m_lastRefreshTime = AZStd::chrono::system_clock::now();
 
         setUpdatesEnabled(true);
     }
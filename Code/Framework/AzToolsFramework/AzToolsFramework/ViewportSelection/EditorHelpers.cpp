@@ -9,6 +9,8 @@
 #include "EditorHelpers.h"
 
 #include <AzCore/Console/Console.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/sort.h>
 #include <AzFramework/Entity/EntityDebugDisplayBus.h>
 #include <AzFramework/Viewport/CameraState.h>
 #include <AzFramework/Visibility/BoundsBus.h>
@@ -127,6 +129,9 @@ namespace AzToolsFramework
         // selecting new entities
         AZ::EntityId entityIdUnderCursor;
         float closestDistance = std::numeric_limits<float>::max();
+
+        // entities whose bounds the pick ray hits, with the distance to where the ray enters them
+        AZStd::vector<AZStd::pair<float, AZ::EntityId>> pickCandidates;
         for (size_t entityCacheIndex = 0; entityCacheIndex < m_entityDataCache->VisibleEntityDataCount(); ++entityCacheIndex)
         {
             const AZ::EntityId entityId = m_entityDataCache->GetVisibleEntityId(entityCacheIndex);
@@ -154,8 +159,8 @@ namespace AzToolsFramework
                     if (screenCoords.m_x >= screenPosition.m_x - iconRange && screenCoords.m_x <= screenPosition.m_x + iconRange &&
                         screenCoords.m_y >= screenPosition.m_y - iconRange && screenCoords.m_y <= screenPosition.m_y + iconRange)
                     {
-                        entityIdUnderCursor = entityId;
-                        break;
+                        // an icon always wins over picked geometry
+                        return entityId;
                     }
                 }
             }
@@ -165,17 +170,36 @@ namespace AzToolsFramework
             if (const AZ::Aabb aabb = CalculateEditorEntitySelectionBounds(entityId, ViewportInfo{ viewportId }); aabb.IsValid())
             {
                 // coarse grain check
-                if (AabbIntersectMouseRay(mouseInteraction.m_mouseInteraction, aabb))
+                float aabbDistance = 0.0f;
+                if (AabbIntersectMouseRay(mouseInteraction.m_mouseInteraction, aabb, aabbDistance))
                 {
-                    // if success, pick against specific component
-                    if (PickEntity(entityId, mouseInteraction.m_mouseInteraction, closestDistance, viewportId))
-                    {
-                        entityIdUnderCursor = entityId;
-                    }
+                    pickCandidates.emplace_back(aabbDistance, entityId);
                 }
             }
         }
 
+        // pick against specific components front to back - a hit can't be closer than where the ray enters the bounds,
+        // so once a candidate's bounds start beyond the closest hit, none of the remaining ones can be picked
+        AZStd::sort(
+            pickCandidates.begin(), pickCandidates.end(),
+            [](const auto& lhs, const auto& rhs)
+            {
+                return lhs.first < rhs.first;
+            });
+
+        for (const auto& [aabbDistance, entityId] : pickCandidates)
+        {
+            if (aabbDistance > closestDistance)
+            {
+                break;
+            }
+
+            if (PickEntity(entityId, mouseInteraction.m_mouseInteraction, closestDistance, viewportId))
+            {
+                entityIdUnderCursor = entityId;
+            }
+        }
+
         return entityIdUnderCursor;
     }
 
@@ -61,6 +61,12 @@ namespace AzToolsFramework
     }
 
     bool AabbIntersectMouseRay(const ViewportInteraction::MouseInteraction& mouseInteraction, const AZ::Aabb& aabb)
+    {
+        float distance;
+        return AabbIntersectMouseRay(mouseInteraction, aabb, distance);
+    }
+
+    bool AabbIntersectMouseRay(const ViewportInteraction::MouseInteraction& mouseInteraction, const AZ::Aabb& aabb, float& distance)
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzToolsFramework);
 
@@ -68,8 +74,12 @@ namespace AzToolsFramework
 
         AZ::Vector3 startNormal;
         float t, end;
-        return AZ::Intersect::IntersectRayAABB(
+        const bool intersection = AZ::Intersect::IntersectRayAABB(
                    mouseInteraction.m_mousePick.m_rayOrigin, rayScaledDir, rayScaledDir.GetReciprocal(), aabb, t, end, startNormal) > 0;
+
+        // t is a fraction of the scaled ray
+        distance = t * s_pickRayLength;
+        return intersection;
     }
 
     bool PickEntity(
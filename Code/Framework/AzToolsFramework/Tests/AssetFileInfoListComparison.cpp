@@ -259,6 +259,41 @@ namespace UnitTest
             EXPECT_EQ(expectedAssetIds.size(), 0);
         }
 
+        void AssetFileInfoValidation_DeltaComparison_KeepsSecondListOrder()
+        {
+            // First AssetFileInfoList {0,1,2,3,4} , Second AssetFileInfoList {1,2*,3,4*,5} where * indicate that hash has changed for that asset
+            AzToolsFramework::AssetFileInfoListComparison assetFileInfoListComparison;
+            AzToolsFramework::AssetFileInfoListComparison::ComparisonData comparisonData(AzToolsFramework::AssetFileInfoListComparison::ComparisonType::Delta, TempFiles[FileIndex::ResultAssetFileInfoList]);
+            comparisonData.m_firstInput = TempFiles[FileIndex::FirstAssetFileInfoList];
+            comparisonData.m_secondInput = TempFiles[FileIndex::SecondAssetFileInfoList];
+            assetFileInfoListComparison.AddComparisonStep(comparisonData);
+
+            ASSERT_TRUE(assetFileInfoListComparison.CompareAndSaveResults().IsSuccess()) << "Delta operation failed.\n";
+
+            AzToolsFramework::AssetFileInfoList assetFileInfoList;
+            ASSERT_TRUE(AZ::Utils::LoadObjectFromFileInPlace(TempFiles[FileIndex::ResultAssetFileInfoList], assetFileInfoList)) << "Unable to read the asset file info list.\n";
+
+            AzToolsFramework::AssetFileInfoList secondAssetFileInfoList;
+            ASSERT_TRUE(AZ::Utils::LoadObjectFromFileInPlace(TempFiles[FileIndex::SecondAssetFileInfoList], secondAssetFileInfoList)) << "Unable to read the asset file info list.\n";
+
+            // The changed assets must appear in the same relative order as in the second AssetFileInfoList
+            AZStd::unordered_set<AZ::Data::AssetId> changedAssetIds{ m_assets[2], m_assets[4], m_assets[5] };
+            AZStd::vector<AZ::Data::AssetId> expectedOrder;
+            for (const AzToolsFramework::AssetFileInfo& assetFileInfo : secondAssetFileInfoList.m_fileInfoList)
+            {
+                if (changedAssetIds.contains(assetFileInfo.m_assetId))
+                {
+                    expectedOrder.push_back(assetFileInfo.m_assetId);
+                }
+            }
+
+            ASSERT_EQ(assetFileInfoList.m_fileInfoList.size(), expectedOrder.size());
+            for (size_t idx = 0; idx < expectedOrder.size(); idx++)
+            {
+                EXPECT_EQ(assetFileInfoList.m_fileInfoList[idx].m_assetId, expectedOrder[idx]);
+            }
+        }
+
 
         void AssetFileInfoValidation_UnionComparison_Valid()
         {
@@ -757,6 +792,11 @@ namespace UnitTest
         AssetFileInfoValidation_DeltaComparison_Valid();
     }
 
+    TEST_F(AssetFileInfoListComparisonTest, AssetFileInfoValidation_DeltaComparison_KeepsSecondListOrder)
+    {
+        AssetFileInfoValidation_DeltaComparison_KeepsSecondListOrder();
+    }
+
     TEST_F(AssetFileInfoListComparisonTest, AssetFileInfoValidation_UnionComparison_Valid)
     {
         AssetFileInfoValidation_UnionComparison_Valid();
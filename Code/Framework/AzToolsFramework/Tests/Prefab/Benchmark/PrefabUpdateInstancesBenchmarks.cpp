@@ -78,6 +78,69 @@ namespace Benchmark
         ->Unit(benchmark::kMillisecond)
         ->Complexity();
 
+    BENCHMARK_DEFINE_F(BM_PrefabUpdateInstances, UpdateInstances_SingleChangedEntityInMultiEntityInstances)(::benchmark::State& state)
+    {
+        const unsigned int numInstances = state.range();
+        constexpr unsigned int numEntities = 10;
+
+        CreateFakePaths(1);
+        const auto& templatePath = m_paths.front();
+
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+
+            AZStd::vector<AZ::Entity*> entities;
+            for (unsigned int entityCounter = 0; entityCounter < numEntities; ++entityCounter)
+            {
+                entities.emplace_back(CreateEntity("Entity"));
+            }
+
+            AZStd::unique_ptr<Instance> instance = m_prefabSystemComponent->CreatePrefab(entities, {}, templatePath);
+
+            TemplateId templateToInstantiateId = instance->GetTemplateId();
+            {
+                AZStd::vector<AZStd::unique_ptr<Instance>> newInstances;
+                newInstances.resize(numInstances);
+                for (unsigned int instanceCounter = 0; instanceCounter < numInstances; ++instanceCounter)
+                {
+                    newInstances[instanceCounter] = m_prefabSystemComponent->InstantiatePrefab(templateToInstantiateId);
+                }
+
+                // The first update caches the instance DOMs, so the timed update only needs to reload the changed entity.
+                m_instanceUpdateExecutorInterface->AddTemplateInstancesToQueue(templateToInstantiateId);
+                m_instanceUpdateExecutorInterface->UpdateTemplateInstancesInQueue();
+
+                entities.front()->SetName("Updated Entity");
+
+                PrefabDom updatedPrefabDom;
+                PrefabDomUtils::StoreInstanceInPrefabDom(*instance, updatedPrefabDom);
+                PrefabDom& templatePrefabDom = m_prefabSystemComponent->FindTemplateDom(templateToInstantiateId);
+                templatePrefabDom.CopyFrom(updatedPrefabDom, templatePrefabDom.GetAllocator());
+
+                state.ResumeTiming();
+
+                m_instanceUpdateExecutorInterface->AddTemplateInstancesToQueue(templateToInstantiateId);
+                m_instanceUpdateExecutorInterface->UpdateTemplateInstancesInQueue();
+
+                state.PauseTiming();
+            }
+
+            instance.reset();
+
+            ResetPrefabSystem();
+
+            state.ResumeTiming();
+        }
+
+        state.SetComplexityN(numInstances);
+    }
+    BENCHMARK_REGISTER_F(BM_PrefabUpdateInstances, UpdateInstances_SingleChangedEntityInMultiEntityInstances)
+        ->RangeMultiplier(10)
+        ->Range(100, 10000)
+        ->Unit(benchmark::kMillisecond)
+        ->Complexity();
+
     BENCHMARK_DEFINE_F(BM_PrefabUpdateInstances, UpdateInstances_SingleLinearNestingOfInstances)(::benchmark::State& state)
     {
         const unsigned int maxDepth = state.range();
@@ -126,4 +126,50 @@ namespace UnitTest
         }
     }
 
+    // Transactions can be nested, inner transactions are rolled back on their own and only the outermost one commits.
+    TEST_F(SQLiteTest, NestedTransactions_InnerRollback_OnlyUndoesInnerChanges)
+    {
+        ASSERT_TRUE(m_database->IsOpen());
+
+        auto execute = [this](const char* sql)
+        {
+            return m_database->ExecuteRawSqlQuery(sql, nullptr, nullptr);
+        };
+        auto countRows = [this]()
+        {
+            int numRows = 0;
+            m_database->ExecuteRawSqlQuery("SELECT COUNT(*) FROM nestedtest;",
+                [&numRows](sqlite3_stmt* statement)
+                {
+                    numRows = SQLite::GetColumnInt(statement, 0);
+                    return true;
+                }, nullptr);
+            return numRows;
+        };
+
+        EXPECT_TRUE(execute("CREATE TABLE nestedtest(rowID INTEGER PRIMARY KEY);"));
+
+        m_database->BeginTransaction();
+        EXPECT_TRUE(execute("INSERT INTO nestedtest(rowID) VALUES(1);"));
+        {
+            SQLite::ScopedTransaction innerTransaction(m_database.get());
+            EXPECT_TRUE(execute("INSERT INTO nestedtest(rowID) VALUES(2);"));
+            // Not committed, rolls back when going out of scope.
+        }
+        {
+            SQLite::ScopedTransaction innerTransaction(m_database.get());
+            EXPECT_TRUE(execute("INSERT INTO nestedtest(rowID) VALUES(3);"));
+            innerTransaction.Commit();
+        }
+        EXPECT_EQ(countRows(), 2);
+        m_database->CommitTransaction();
+
+        EXPECT_EQ(countRows(), 2);
+
+        m_database->BeginTransaction();
+        EXPECT_TRUE(execute("INSERT INTO nestedtest(rowID) VALUES(4);"));
+        m_database->RollbackTransaction();
+        EXPECT_EQ(countRows(), 2);
+    }
+
 }
@@ -7,6 +7,7 @@
  */
 
 #include <AzCore/Component/ComponentApplication.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Math/MathUtils.h>
 #include <AzCore/Math/Matrix3x3.h>
 #include <AzCore/Math/Random.h>
@@ -16,6 +17,7 @@
 
 #include <AzFramework/Application/Application.h>
 #include <AzFramework/Components/TransformComponent.h>
+#include <AzFramework/Components/TransformHierarchyUpdateSystem.h>
 
 #include <AzToolsFramework/Application/ToolsApplication.h>
 #include <AzToolsFramework/ToolsComponents/TransformComponent.h>
@@ -723,6 +725,75 @@ namespace UnitTest
         EXPECT_TRUE(actualChildWorldPos == expectedChildLocalPos);
     }
 
+    // Fixture with batched hierarchy updates enabled, counting the notifications of the child entity.
+    class TransformComponentBatchedHierarchy
+        : public TransformComponentHierarchy
+        , public TransformNotificationBus::Handler
+    {
+    protected:
+        void SetUp() override
+        {
+            TransformComponentHierarchy::SetUp();
+
+            if (AZ::Interface<TransformHierarchyUpdateSystem>::Get() == nullptr)
+            {
+                m_updateSystem = AZStd::make_unique<TransformHierarchyUpdateSystem>();
+                m_updateSystem->Connect();
+            }
+            AZ::Interface<AZ::IConsole>::Get()->PerformCommand("cl_batchTransformHierarchyUpdates true");
+
+            TransformBus::Event(m_childId, &TransformBus::Events::SetParent, m_parentId);
+            TransformNotificationBus::Handler::BusConnect(m_childId);
+        }
+
+        void TearDown() override
+        {
+            TransformNotificationBus::Handler::BusDisconnect();
+            AZ::Interface<AZ::IConsole>::Get()->PerformCommand("cl_batchTransformHierarchyUpdates false");
+            if (m_updateSystem)
+            {
+                m_updateSystem->Disconnect();
+                m_updateSystem.reset();
+            }
+
+            TransformComponentHierarchy::TearDown();
+        }
+
+        void OnTransformChanged(const AZ::Transform& /*local*/, const AZ::Transform& world) override
+        {
+            m_childNotifications++;
+            m_notifiedChildWorldTM = world;
+        }
+
+        AZStd::unique_ptr<TransformHierarchyUpdateSystem> m_updateSystem;
+        AZ::Transform m_notifiedChildWorldTM = AZ::Transform::CreateIdentity();
+        int m_childNotifications = 0;
+    };
+
+    TEST_F(TransformComponentBatchedHierarchy, MoveParentMultipleTimes_ChildIsNotifiedOnce)
+    {
+        TransformBus::Event(m_childId, &TransformBus::Events::SetLocalTranslation, AZ::Vector3(1.0f, 0.0f, 0.0f));
+        m_childNotifications = 0;
+
+        for (float x : { 10.0f, 20.0f, 30.0f })
+        {
+            TransformBus::Event(m_parentId, &TransformBus::Events::SetWorldTranslation, AZ::Vector3(x, 0.0f, 0.0f));
+        }
+        EXPECT_EQ(0, m_childNotifications);
+
+        // Queries still see the moved parent.
+        AZ::Vector3 childWorldPos;
+        TransformBus::EventResult(childWorldPos, m_childId, &TransformBus::Events::GetWorldTranslation);
+        EXPECT_THAT(childWorldPos, IsClose(AZ::Vector3(31.0f, 0.0f, 0.0f)));
+
+        AZ::Interface<TransformHierarchyUpdateSystem>::Get()->ProcessUpdates();
+        EXPECT_EQ(1, m_childNotifications);
+        EXPECT_THAT(m_notifiedChildWorldTM.GetTranslation(), IsClose(AZ::Vector3(31.0f, 0.0f, 0.0f)));
+
+        AZ::Interface<TransformHierarchyUpdateSystem>::Get()->ProcessUpdates();
+        EXPECT_EQ(1, m_childNotifications);
+    }
+
     // Fixture provides TransformComponent that is static (or not static) on an entity that has been activated.
     template<bool IsStatic>
     class StaticOrMovableTransformComponent
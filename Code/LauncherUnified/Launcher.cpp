@@ -550,6 +550,7 @@ namespace O3DELauncher
             gameApplicationStartupParams.m_loadDynamicModules = false;
         #endif // defined(AZ_MONOLITHIC_BUILD)
 
+            gameApplication.SetHeadless(IsDedicatedServer());
             gameApplication.Start({}, gameApplicationStartupParams);
 
 #if defined(REMOTE_ASSET_PROCESSOR)
@@ -873,9 +873,14 @@ bool CSystem::UpdatePreTickBus(int updateFlags, int nPauseMode)
                 static CTimeValue sTimeLast = gEnv->pTimer->GetAsyncTime();
                 timeFrameMax.SetMilliSeconds((int64)(1000.f / ((float)maxFPS + safeMarginFPS)));
                 const CTimeValue timeLast = timeFrameMax + sTimeLast;
-                while (timeLast.GetValue() > gEnv->pTimer->GetAsyncTime().GetValue())
+                // Dedicated servers often share a host with other server processes, so they give the remaining frame time
+                // back to the OS instead of spinning on it. Clients keep yielding to avoid oversleeping past the frame.
+                const bool sleepUntilFrame = gEnv->IsDedicated();
+                for (CTimeValue timeNow = gEnv->pTimer->GetAsyncTime(); timeLast.GetValue() > timeNow.GetValue();
+                     timeNow = gEnv->pTimer->GetAsyncTime())
                 {
-                    CrySleep(0);
+                    const int64 remainingMs = (timeLast - timeNow).GetMilliSecondsAsInt64();
+                    CrySleep(sleepUntilFrame && remainingMs > 1 ? static_cast<unsigned int>(remainingMs - 1) : 0);
                 }
                 sTimeLast = gEnv->pTimer->GetAsyncTime();
             }
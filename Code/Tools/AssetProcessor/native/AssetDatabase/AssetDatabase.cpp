@@ -1332,6 +1332,22 @@ namespace AssetProcessor
         }
     }
 
+    void AssetDatabaseConnection::BeginTransaction()
+    {
+        if (m_databaseConnection)
+        {
+            m_databaseConnection->BeginTransaction();
+        }
+    }
+
+    void AssetDatabaseConnection::CommitTransaction()
+    {
+        if (m_databaseConnection)
+        {
+            m_databaseConnection->CommitTransaction();
+        }
+    }
+
     bool AssetDatabaseConnection::GetScanFolderByScanFolderID(AZ::s64 scanfolderID, ScanFolderDatabaseEntry& entry)
     {
         bool found = false;
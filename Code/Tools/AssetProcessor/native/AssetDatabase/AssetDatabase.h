@@ -44,6 +44,11 @@ namespace AssetProcessor
         } 
         void VacuumAndAnalyze();
 
+        //! Groups the queries until the matching CommitTransaction into one transaction, so that a large number of small
+        //! updates is written at once instead of each of them being committed on its own. Transactions can be nested.
+        void BeginTransaction();
+        void CommitTransaction();
+
     protected:
         void CreateStatements() override;
         bool PostOpenDatabase() override;
@@ -91,6 +91,7 @@ namespace AssetProcessor
             m_catalogIsDirty = true;
             {
                 QMutexLocker locker(&m_registriesMutex);
+                m_dirtyPlatforms.insert(assetPlatform);
                 m_registries[message.m_platform.c_str()].RegisterAsset(assetInfo.m_assetId, assetInfo);
                 for (const AZ::Data::AssetId& mapping : message.m_legacyAssetIds)
                 {
@@ -142,6 +143,7 @@ namespace AssetProcessor
             if (found != m_registries[assetPlatform].m_assetIdToInfo.end())
             {
                 m_catalogIsDirty = true;
+                m_dirtyPlatforms.insert(assetPlatform);
 
                 m_registries[assetPlatform].UnregisterAsset(message.m_assetId);
 
@@ -308,8 +310,22 @@ namespace AssetProcessor
                 AzFramework::AssetRegistry::ReflectSerialize(serializeContext);
             }
 
+            // Only the catalogs of the platforms that changed need to be written again.
+            QStringList platformsToSave;
+            {
+                QMutexLocker locker(&m_registriesMutex);
+                for (const QString& platform : m_platforms)
+                {
+                    if (m_dirtyPlatforms.isEmpty() || m_dirtyPlatforms.contains(platform))
+                    {
+                        platformsToSave.append(platform);
+                    }
+                }
+                m_dirtyPlatforms.clear();
+            }
+
             // save out a catalog for each platform
-            for (const QString& platform : m_platforms)
+            for (const QString& platform : platformsToSave)
             {
                 // Serialize out the catalog to a memory buffer, and then dump that memory buffer to stream.
                 QElapsedTimer timer;
@@ -474,6 +490,7 @@ namespace AssetProcessor
 
         AZStd::lock_guard<AZStd::mutex> lock(m_databaseMutex);
         QMutexLocker locker(&m_registriesMutex);
+        m_dirtyPlatforms.clear(); // all platforms are rebuilt
 
         for (QString platform : m_platforms)
         {
@@ -574,6 +591,7 @@ namespace AssetProcessor
         AZ::Data::ProductDependency newDependency{ AZ::Data::AssetId(entry.m_dependencySourceGuid, entry.m_dependencySubID), entry.m_dependencyFlags };
         {
             QMutexLocker locker(&m_registriesMutex);
+            m_dirtyPlatforms.insert(platform);
             m_registries[platform].RegisterAssetDependency(assetId, newDependency);
             message.m_dependencies = AZStd::move(m_registries[platform].GetAssetDependencies(assetId));
             legacyIds = m_registries[platform].GetLegacyMappingSubsetFromRealIds(AZStd::vector<AZ::Data::AssetId>{ assetId });
@@ -24,6 +24,7 @@
 #include <AzFramework/Asset/AssetRegistry.h>
 #include <QMutex>
 #include <QMultiMap>
+#include <QSet>
 #include <AzCore/IO/SystemFile.h>
 #include <AzToolsFramework/ToolsComponents/ToolsAssetCatalogBus.h>
 #endif
@@ -205,6 +206,9 @@ namespace AssetProcessor
 
         bool m_registryBuiltOnce;
         bool m_catalogIsDirty = true;
+        //! The platforms whose registry changed since the last save, guarded by m_registriesMutex.
+        //! If the catalog is dirty while this is empty, the catalogs of all platforms are saved.
+        QSet<QString> m_dirtyPlatforms;
         bool m_currentlySavingCatalog = false;
         bool m_currentlyValidatingPreloadDependency = false;
         int m_currentRegistrySaveVersion = 0;
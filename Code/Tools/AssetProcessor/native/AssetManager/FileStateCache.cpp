@@ -39,27 +39,41 @@ namespace AssetProcessor
 
     bool FileStateCache::GetHash(const QString& absolutePath, FileHash* foundHash)
     {
-        LockGuardType scopeLock(m_mapMutex);
-        auto fileInfoItr = m_fileInfoMap.find(PathToKey(absolutePath));
-
-        if(fileInfoItr == m_fileInfoMap.end())
+        const QString key = PathToKey(absolutePath);
+        FileStateInfo fileInfo;
         {
-            // No info on this file, return false
-            return false;
-        }
+            LockGuardType scopeLock(m_mapMutex);
+            auto fileInfoItr = m_fileInfoMap.find(key);
 
-        auto itr = m_fileHashMap.find(PathToKey(absolutePath));
+            if (fileInfoItr == m_fileInfoMap.end())
+            {
+                // No info on this file, return false
+                return false;
+            }
 
-        if (itr != m_fileHashMap.end())
-        {
-            *foundHash = itr.value();
-            return true;
+            auto itr = m_fileHashMap.find(key);
+
+            if (itr != m_fileHashMap.end())
+            {
+                *foundHash = itr.value();
+                return true;
+            }
+
+            fileInfo = fileInfoItr.value();
         }
 
-        // There's no hash stored yet or its been invalidated, calculate it
+        // There's no hash stored yet or its been invalidated, calculate it.
+        // This is done without holding the lock, so that multiple files can be hashed at the same time.
         *foundHash = AssetUtilities::GetFileHash(absolutePath.toUtf8().constData(), true);
 
-        m_fileHashMap[PathToKey(absolutePath)] = *foundHash;
+        LockGuardType scopeLock(m_mapMutex);
+        auto fileInfoItr = m_fileInfoMap.find(key);
+
+        // Only store the hash if the file didn't change while it was being hashed
+        if (fileInfoItr != m_fileInfoMap.end() && fileInfoItr.value() == fileInfo)
+        {
+            m_fileHashMap[key] = *foundHash;
+        }
         return true;
     }
 
@@ -21,6 +21,7 @@
 
 #include "native/AssetManager/assetProcessorManager.h"
 #include <AzCore/std/sort.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzToolsFramework/API/AssetDatabaseBus.h>
 
 #include <native/AssetManager/PathDependencyManager.h>
@@ -2825,6 +2826,14 @@ namespace AssetProcessor
     {
         int processedFileCount = 0;
 
+        if (m_allowModtimeSkippingFeature)
+        {
+            HashModifiedFilesFromScanner(filePaths);
+
+            // Skipping files updates their modtimes in the database, commit those updates together
+            m_stateData->BeginTransaction();
+        }
+
         for (const AssetFileInfo& fileInfo : filePaths)
         {
             if (m_allowModtimeSkippingFeature)
@@ -2858,10 +2867,75 @@ namespace AssetProcessor
 
         if (m_allowModtimeSkippingFeature)
         {
+            m_stateData->CommitTransaction();
+            m_scannedFileHashes.clear();
             AZ_TracePrintf(AssetProcessor::DebugChannel, "%d files reported from scanner.  %d unchanged files skipped, %d files processed\n", filePaths.size(), filePaths.size() - processedFileCount, processedFileCount);
         }
     }
 
+    void AssetProcessorManager::HashModifiedFilesFromScanner(const QSet<AssetFileInfo>& filePaths)
+    {
+        m_scannedFileHashes.clear();
+
+        if (m_buildersAddedOrRemoved)
+        {
+            // CanSkipProcessingFile won't look at the hashes
+            return;
+        }
+
+        // Collect the files CanSkipProcessingFile would hash: the ones with a recorded hash whose modtime changed
+        AZStd::vector<AZStd::string> filesToHash;
+        for (const AssetFileInfo& fileInfo : filePaths)
+        {
+            AZStd::string filePath = fileInfo.m_filePath.toUtf8().constData();
+            auto fileItr = m_fileModTimes.find(filePath);
+            if (fileItr == m_fileModTimes.end() || fileItr->second == 0
+                || fileItr->second == AssetUtilities::AdjustTimestamp(fileInfo.m_modTime))
+            {
+                continue;
+            }
+
+            auto hashItr = m_fileHashes.find(filePath);
+            if (hashItr != m_fileHashes.end() && hashItr->second != 0)
+            {
+                filesToHash.push_back(AZStd::move(filePath));
+            }
+        }
+
+        if (filesToHash.empty())
+        {
+            return;
+        }
+
+        // Each thread hashes every numThreads'th file into its own slot, so no locking is needed until the results are merged
+        AZStd::vector<AZ::u64> fileHashes(filesToHash.size(), 0);
+        const size_t numThreads = AZStd::min<size_t>(AZStd::max(AZStd::thread::hardware_concurrency(), 1u), filesToHash.size());
+        auto hashFiles = [&filesToHash, &fileHashes, numThreads](size_t threadIndex)
+        {
+            for (size_t index = threadIndex; index < filesToHash.size(); index += numThreads)
+            {
+                fileHashes[index] = AssetUtilities::GetFileHash(filesToHash[index].c_str());
+            }
+        };
+
+        AZStd::vector<AZStd::thread> hashThreads;
+        hashThreads.reserve(numThreads - 1);
+        for (size_t threadIndex = 1; threadIndex < numThreads; ++threadIndex)
+        {
+            hashThreads.emplace_back([&hashFiles, threadIndex]() { hashFiles(threadIndex); });
+        }
+        hashFiles(0);
+        for (AZStd::thread& hashThread : hashThreads)
+        {
+            hashThread.join();
+        }
+
+        for (size_t index = 0; index < filesToHash.size(); ++index)
+        {
+            m_scannedFileHashes.emplace(AZStd::move(filesToHash[index]), fileHashes[index]);
+        }
+    }
+
     bool AssetProcessorManager::CanSkipProcessingFile(const AssetFileInfo &fileInfo, AZ::u64& fileHashOut)
     {
         // Check to see if the file has changed since the last time we saw it
@@ -2917,7 +2991,11 @@ namespace AssetProcessor
                 return false;
             }
 
-            AZ::u64 fileHash = AssetUtilities::GetFileHash(fileInfo.m_filePath.toUtf8().constData());
+            // The hash has usually already been computed by HashModifiedFilesFromScanner
+            auto scannedHashItr = m_scannedFileHashes.find(fileInfo.m_filePath.toUtf8().constData());
+            AZ::u64 fileHash = scannedHashItr != m_scannedFileHashes.end()
+                ? scannedHashItr->second
+                : AssetUtilities::GetFileHash(fileInfo.m_filePath.toUtf8().constData());
                 
             if(fileHash != databaseHashValue)
             {
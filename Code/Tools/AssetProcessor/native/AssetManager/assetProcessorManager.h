@@ -362,6 +362,10 @@ namespace AssetProcessor
         // Checks whether or not a file can be skipped for processing (ie, file content hasn't changed, builders haven't been added/removed, builders for the file haven't changed)
         bool CanSkipProcessingFile(const AssetFileInfo &fileInfo, AZ::u64& fileHash);
 
+        //! Hashes the files from the scanner whose modtime changed since last run on multiple threads, so that
+        //! CanSkipProcessingFile doesn't have to hash them one at a time on this thread.
+        void HashModifiedFilesFromScanner(const QSet<AssetFileInfo>& filePaths);
+
         AZ::s64 GenerateNewJobRunKey();
         // Attempt to erase a log file.  Failing to erase it is not a critical problem, but should be logged.
         // returns true if there is no log file there after this operation completes
@@ -424,6 +428,9 @@ namespace AssetProcessor
         // this map contains hashes of all files AP processed last time it ran
         AZStd::unordered_map<AZStd::string, AZ::u64> m_fileHashes;
 
+        // this map contains the current hashes of the scanned files whose modtime changed since last run
+        AZStd::unordered_map<AZStd::string, AZ::u64> m_scannedFileHashes;
+
         QSet<QString> m_knownFolders; // a cache of all known folder names, normalized to have forward slashes.
         typedef AZStd::unordered_map<AZ::u64, AzToolsFramework::AssetSystem::JobInfo> JobRunKeyToJobInfoMap;  // for when network requests come in about the jobInfo
 
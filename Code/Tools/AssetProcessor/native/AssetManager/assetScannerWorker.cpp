@@ -8,6 +8,7 @@
 #include "native/AssetManager/assetScannerWorker.h"
 #include "native/AssetManager/assetScanner.h"
 #include "native/utilities/PlatformConfiguration.h"
+#include <AssetProcessor_Traits_Platform.h>
 #include <QDir>
 
 using namespace AssetProcessor;
@@ -27,6 +28,10 @@ void AssetScannerWorker::StartScan()
     m_folderList.clear();
     m_doScan = true;
 
+    QDir projectCacheRoot;
+    AssetUtilities::ComputeProjectCacheRoot(projectCacheRoot);
+    m_projectCacheRootPath = AssetUtilities::NormalizeDirectoryPath(projectCacheRoot.absolutePath());
+
     AZ_TracePrintf(AssetProcessor::ConsoleChannel, "Scanning file system for changes...\n");
 
     Q_EMIT ScanningStateChanged(AssetProcessor::AssetScanningStatus::Started);
@@ -102,10 +107,7 @@ void AssetScannerWorker::ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo
         AssetFileInfo assetFileInfo(absPath, modTime, fileSize, &rootScanFolder, isDirectory);
 
         // Skip over the Cache folder if the file entry is the project cache root
-        QDir projectCacheRoot;
-        AssetUtilities::ComputeProjectCacheRoot(projectCacheRoot);
-        QString relativeToProjectCacheRoot = projectCacheRoot.relativeFilePath(absPath);
-        if (QDir::isRelativePath(relativeToProjectCacheRoot) && !relativeToProjectCacheRoot.startsWith(".."))
+        if (IsInProjectCache(absPath))
         {
             // The Cache folder should not be scanned
             continue;
@@ -133,6 +135,17 @@ void AssetScannerWorker::ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo
     }
 }
 
+bool AssetScannerWorker::IsInProjectCache(const QString& absolutePath) const
+{
+    // This runs for every scanned entry, so compare the paths directly instead of building a relative path.
+    constexpr Qt::CaseSensitivity caseSensitivity = ASSETPROCESSOR_TRAIT_CASE_SENSITIVE_FILESYSTEM ? Qt::CaseSensitive : Qt::CaseInsensitive;
+    if (!absolutePath.startsWith(m_projectCacheRootPath, caseSensitivity))
+    {
+        return false;
+    }
+    return absolutePath.length() == m_projectCacheRootPath.length() || absolutePath.at(m_projectCacheRootPath.length()) == QChar('/');
+}
+
 void AssetScannerWorker::EmitFiles()
 {
     //Loop over all source asset files and send them up the chain:
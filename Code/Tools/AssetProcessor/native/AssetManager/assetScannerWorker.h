@@ -48,12 +48,16 @@ Q_SIGNALS:
         void ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo, const ScanFolderInfo& rootScanFolder);
         void EmitFiles();
 
+        //! Returns true if absolutePath is the project cache root or inside of it.
+        bool IsInProjectCache(const QString& absolutePath) const;
+
     private:
         volatile bool m_doScan = true;
         QSet<AssetFileInfo> m_fileList; // note:  neither QSet nor QString are qobject-derived
         QSet<AssetFileInfo> m_folderList;
         QSet<AssetFileInfo> m_excludedList;
         PlatformConfiguration* m_platformConfiguration;
+        QString m_projectCacheRootPath; // Computed once per scan, instead of once per scanned entry.
     };
 } // end namespace AssetProcessor
 
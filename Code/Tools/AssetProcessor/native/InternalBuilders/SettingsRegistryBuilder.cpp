@@ -8,6 +8,7 @@
 
 #include <limits>
 #include <AssetBuilderSDK/AssetBuilderSDK.h>
+#include <AzCore/IO/GenericStreams.h>
 #include <AzCore/Settings/SettingsRegistryImpl.h>
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
 #include <AzCore/Utils/Utils.h>
@@ -153,6 +154,7 @@ namespace AssetProcessor
     {
         AssetBuilderSDK::AssetBuilderDesc   builderDesc;
         builderDesc.m_name = "Settings Registry Builder";
+        builderDesc.m_version = 1; // Added the compiled settings registry product.
         builderDesc.m_patterns.emplace_back("*/engine.json", AssetBuilderSDK::AssetBuilderPattern::PatternType::Wildcard);
         builderDesc.m_builderType = AssetBuilderSDK::AssetBuilderDesc::AssetBuilderType::Internal;
         builderDesc.m_busId = m_builderId;
@@ -387,6 +389,30 @@ namespace AssetProcessor
                     response.m_outputProducts.emplace_back(outputPath, m_assetType, productSubID + aznumeric_cast<AZ::u32>(i));
                     response.m_outputProducts.back().m_dependenciesHandled = true;
 
+                    // Also store the same settings in the compiled format, which the launchers load without parsing JSON.
+                    outputPath += "bin";
+                    auto isIncluded = [&excludes](AZStd::string_view path)
+                    {
+                        return AZStd::find(excludes.begin(), excludes.end(), path) == excludes.end();
+                    };
+                    if (!file.Open(outputPath.c_str(),
+                        AZ::IO::SystemFile::OpenMode::SF_OPEN_CREATE | AZ::IO::SystemFile::OpenMode::SF_OPEN_WRITE_ONLY))
+                    {
+                        AZ_Error("Settings Registry Builder", false, R"(Failed to open file "%s" for writing.)", outputPath.c_str());
+                        return;
+                    }
+                    AZ::IO::SystemFileStream compiledStream(&file, false);
+                    if (!AZ::SettingsRegistryMergeUtils::DumpSettingsRegistryToCompiledStream(registry, "", compiledStream, isIncluded))
+                    {
+                        AZ_Error("Settings Registry Builder", false, R"(Failed to write compiled settings registry to file "%s".)", outputPath.c_str());
+                        return;
+                    }
+                    file.Close();
+
+                    response.m_outputProducts.emplace_back(outputPath, m_assetType,
+                        productSubID + aznumeric_cast<AZ::u32>(i + AZStd::size(specializations)));
+                    response.m_outputProducts.back().m_dependenciesHandled = true;
+
                     outputPath.erase(extensionOffset);
                 }
 
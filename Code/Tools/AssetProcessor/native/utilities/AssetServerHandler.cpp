@@ -29,6 +29,13 @@ namespace AssetProcessor
         return QString();
     }
 
+    QString ComputeTempArchiveFilePath(const QString& archiveFilePath)
+    {
+        QFileInfo archiveFileInfo(archiveFilePath);
+        QString tempArchiveFileName = QString("%1_%2.tmp.zip").arg(archiveFileInfo.completeBaseName(), AZ::Uuid::CreateRandom().ToString<AZStd::string>(false, false).c_str());
+        return archiveFileInfo.dir().filePath(tempArchiveFileName);
+    }
+
     AssetServerHandler::AssetServerHandler()
     {
         AssetServerBus::Handler::BusConnect();
@@ -111,15 +118,27 @@ namespace AssetProcessor
         AZ_TracePrintf(AssetProcessor::DebugChannel, "Creating archive for job (%s, %s, %s) with fingerprint (%u).\n",
             builderParams.m_rcJob->GetJobEntry().m_pathRelativeToWatchFolder.toUtf8().data(), builderParams.m_rcJob->GetJobKey().toUtf8().data(),
             builderParams.m_rcJob->GetPlatformInfo().m_identifier.c_str(), builderParams.m_rcJob->GetOriginalFingerprint());
-        AzToolsFramework::ArchiveCommands::Bus::BroadcastResult(success, &AzToolsFramework::ArchiveCommands::CreateArchiveBlocking, archiveAbsFilePath.toUtf8().data(), builderParams.GetTempJobDirectory());
+        // The archive is built under a unique name and renamed once it is complete, so that other clients looking up this job
+        // never extract a partially written archive, and multiple servers storing the same job don't write to the same file.
+        QString tempArchiveAbsFilePath = ComputeTempArchiveFilePath(archiveAbsFilePath);
+        AzToolsFramework::ArchiveCommands::Bus::BroadcastResult(success, &AzToolsFramework::ArchiveCommands::CreateArchiveBlocking, tempArchiveAbsFilePath.toUtf8().data(), builderParams.GetTempJobDirectory());
         AZ_Error(AssetProcessor::DebugChannel, success, "Creating archive operation failed. \n");
 
         if (success && sourceFileList.size())
         {
             // Check if any of our output products for this job was a source file which would not be in the temp folder
             // If so add it to the archive
-            AddSourceFilesToArchive(builderParams, archiveAbsFilePath, sourceFileList);
+            AddSourceFilesToArchive(builderParams, tempArchiveAbsFilePath, sourceFileList);
         }
+
+        if (success && !QFile::rename(tempArchiveAbsFilePath, archiveAbsFilePath))
+        {
+            // Another server may have stored the same job in the meantime, which is as good as storing it.
+            success = QFile::exists(archiveAbsFilePath);
+            AZ_Error(AssetProcessor::DebugChannel, success, "Moving archive %s to %s failed. \n", tempArchiveAbsFilePath.toUtf8().data(), archiveAbsFilePath.toUtf8().data());
+        }
+
+        QFile::remove(tempArchiveAbsFilePath);
         return success;
     }
 
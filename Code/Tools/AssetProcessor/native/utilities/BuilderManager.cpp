@@ -490,7 +490,7 @@ namespace AssetProcessor
         return builder;
     }
 
-    BuilderRef BuilderManager::GetBuilder()
+    BuilderRef BuilderManager::GetBuilder(const AZStd::string& modulePath)
     {
         AZStd::shared_ptr<Builder> newBuilder;
         BuilderRef builderRef;
@@ -498,6 +498,9 @@ namespace AssetProcessor
         {
             AZStd::unique_lock<AZStd::mutex> lock(m_buildersMutex);
 
+            // Prefer a builder that already ran a job for this module, so jobs of the same type keep going to the builders
+            // that have the module and its cached state warm.  Otherwise fall back to any idle builder.
+            AZStd::shared_ptr<Builder> idleBuilder;
             for (auto itr = m_builders.begin(); itr != m_builders.end(); )
             {
                 auto& builder = itr->second;
@@ -508,7 +511,16 @@ namespace AssetProcessor
 
                     if (builder->IsValid())
                     {
-                        return BuilderRef(builder);
+                        if (builder->m_lastModulePath == modulePath)
+                        {
+                            return BuilderRef(builder);
+                        }
+
+                        if (!idleBuilder)
+                        {
+                            idleBuilder = builder;
+                        }
+                        ++itr;
                     }
                     else
                     {
@@ -521,10 +533,17 @@ namespace AssetProcessor
                 }
             }
 
+            if (idleBuilder)
+            {
+                idleBuilder->m_lastModulePath = modulePath;
+                return BuilderRef(idleBuilder);
+            }
+
             AZ_TracePrintf("BuilderManager", "Starting new builder for job request\n");
 
             // None found, start up a new one
             newBuilder = AddNewBuilder();
+            newBuilder->m_lastModulePath = modulePath;
 
             // Grab a reference so no one else can take it while we're outside the lock
             builderRef = BuilderRef(newBuilder);
@@ -38,8 +38,9 @@ namespace AssetProcessor
 
         virtual ~BuilderManagerBusTraits() = default;
 
-        //! Returns a builder for doing work
-        virtual BuilderRef GetBuilder() = 0;
+        //! Returns a builder for doing work.
+        //! Builders that last ran a job for the builder module at modulePath are preferred, since they already have it loaded.
+        virtual BuilderRef GetBuilder(const AZStd::string& modulePath) = 0;
     };
 
     using BuilderManagerBus = AZ::EBus<BuilderManagerBusTraits>;
@@ -118,6 +119,9 @@ namespace AssetProcessor
         //! Indicates if the builder is currently in use
         bool m_busy = false;
 
+        //! The builder module of the last job handed to this builder.  Only accessed with the builder manager's lock held
+        AZStd::string m_lastModulePath;
+
         AZStd::atomic<AZ::u32> m_connectionId = 0;
 
         //! Signals the exe has successfully established a connection
@@ -169,7 +173,7 @@ namespace AssetProcessor
         void ConnectionLost(AZ::u32 connId);
 
         //BuilderManagerBus
-        BuilderRef GetBuilder() override;
+        BuilderRef GetBuilder(const AZStd::string& modulePath) override;
 
     private:
 
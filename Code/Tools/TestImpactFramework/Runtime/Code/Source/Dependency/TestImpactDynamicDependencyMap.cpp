@@ -232,14 +232,27 @@ namespace TestImpact
 
     void DynamicDependencyMap::ClearAllSourceCoverage()
     {
-        for (auto it = m_sourceDependencyMap.begin(); it != m_sourceDependencyMap.end(); ++it)
+        // With all coverage gone there is no need to unpick the coverage source by source, so the coverage maps are cleared
+        // wholesale and only the sources without parent targets are removed
+        for (auto& [testTarget, coveringSources] : m_testTargetSourceCoverage)
         {
-            const auto& [path, coverage] = *it;
-            ReplaceSourceCoverageInternal(SourceCoveringTestsList(AZStd::vector<SourceCoveringTests>{ SourceCoveringTests(RepoPath(path)) }), false);
-            if (coverage.m_coveringTestTargets.empty() && coverage.m_parentTargets.empty())
+            coveringSources.clear();
+        }
+
+        m_buildTargetCoverage.clear();
+
+        for (auto it = m_sourceDependencyMap.begin(); it != m_sourceDependencyMap.end();)
+        {
+            auto& [path, coverage] = *it;
+            coverage.m_coveringTestTargets.clear();
+            if (coverage.m_parentTargets.empty())
             {
                 it = m_sourceDependencyMap.erase(it);
             }
+            else
+            {
+                ++it;
+            }
         }
     }
 
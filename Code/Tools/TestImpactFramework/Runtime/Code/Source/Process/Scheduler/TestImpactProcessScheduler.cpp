@@ -12,8 +12,13 @@
 #include <Process/TestImpactProcessInfo.h>
 #include <Process/TestImpactProcessLauncher.h>
 
+#include <AzCore/std/parallel/thread.h>
+
 namespace TestImpact
 {
+    //! Time the scheduler yields to the processes it is monitoring between each poll of their state.
+    constexpr AZStd::chrono::milliseconds ProcessPollInterval = AZStd::chrono::milliseconds(1);
+
     struct ProcessInFlight
     {
         AZStd::unique_ptr<Process> m_process;
@@ -213,6 +218,9 @@ namespace TestImpact
             {
                 break;
             }
+
+            // Rather than spinning on the processes in flight, give the core back to them (and the other processes sharing the agent)
+            AZStd::this_thread::sleep_for(ProcessPollInterval);
         }
 
         return ProcessSchedulerResult::Graceful;
@@ -22,6 +22,41 @@
 
 namespace AWSMetrics
 {
+    namespace
+    {
+        //! Append the serialized metrics array to the array stored in the local metrics file in place, by overwriting its closing bracket.
+        //! @return Whether the metrics were appended. Fails if the file doesn't end with a JSON array.
+        bool AppendToMetricsFile(AZ::IO::FileIOBase* fileIO, const char* metricsFileFullPath, const AZStd::string& serializedMetrics)
+        {
+            AZ::u64 fileSize = 0;
+            if (serializedMetrics.size() < 2 || !fileIO->Size(metricsFileFullPath, fileSize) || fileSize < 2)
+            {
+                return false;
+            }
+
+            AZ::IO::HandleType fileHandle;
+            if (!fileIO->Open(metricsFileFullPath, AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeUpdate | AZ::IO::OpenMode::ModeBinary, fileHandle))
+            {
+                return false;
+            }
+
+            bool appended = false;
+            char arrayEnd[2] = { 0, 0 };
+            if (fileIO->Seek(fileHandle, fileSize - 2, AZ::IO::SeekType::SeekFromStart) &&
+                fileIO->Read(fileHandle, arrayEnd, sizeof(arrayEnd), true) && arrayEnd[1] == ']' &&
+                fileIO->Seek(fileHandle, fileSize - 1, AZ::IO::SeekType::SeekFromStart))
+            {
+                // Skip the opening bracket of the new array, and separate it from the existing events unless the stored array is empty.
+                AZStd::string_view newEvents(serializedMetrics.data() + 1, serializedMetrics.size() - 1);
+                appended = (arrayEnd[0] == '[' || fileIO->Write(fileHandle, ",", 1)) &&
+                    fileIO->Write(fileHandle, newEvents.data(), newEvents.size());
+            }
+            fileIO->Close(fileHandle);
+
+            return appended;
+        }
+    }
+
     MetricsManager::MetricsManager()
         : m_clientConfiguration(AZStd::make_unique<ClientConfiguration>())
         , m_clientIdProvider(IdentityProvider::CreateIdentityProvider())
@@ -317,7 +352,15 @@ namespace AWSMetrics
         {
             return AZ::Failure(AZStd::string{ "Failed to get the metrics file directory or path." });
         }
-        if (fileIO->Exists(metricsFileFullPath) && !existingMetricsEvents.ReadFromJson(metricsFileFullPath))
+
+        // Appending avoids reading, parsing and rewriting all the metrics recorded so far, which grows with every flush while offline.
+        const bool metricsFileExists = fileIO->Exists(metricsFileFullPath);
+        if (metricsFileExists && AppendToMetricsFile(fileIO, metricsFileFullPath, metricsQueue->SerializeToJson()))
+        {
+            return AZ::Success();
+        }
+
+        if (metricsFileExists && !existingMetricsEvents.ReadFromJson(metricsFileFullPath))
         {
             return AZ::Failure(AZStd::string{ "Failed to read the existing metrics on disk" });
         }
@@ -319,6 +319,28 @@ namespace AWSMetrics
         m_metricsManager->ShutdownMetrics();
     }
 
+    TEST_F(MetricsManagerTest, SendMetricsAsync_ExistingLocalFile_AppendToLocalFile)
+    {
+        AZStd::vector<MetricsAttribute> metricsAttributes;
+        metricsAttributes.emplace_back(AZStd::move(MetricsAttribute(AwsMetricsAttributeKeyEventName, AttrValue)));
+
+        for (int index = 0; index < 2; ++index)
+        {
+            bool result = false;
+            AWSMetricsRequestBus::BroadcastResult(result, &AWSMetricsRequests::SubmitMetrics, metricsAttributes, 0, "", false);
+            ASSERT_TRUE(result);
+
+            // Wait for each request so the second one appends to the local file written by the first one.
+            WaitForProcessing(index + 1);
+        }
+        ASSERT_EQ(m_notifications.m_numSuccessNotification, 2);
+        ASSERT_EQ(m_notifications.m_numFailureNotification, 0);
+
+        MetricsQueue localMetrics;
+        ASSERT_TRUE(localMetrics.ReadFromJson(m_metricsManager->GetMetricsFilePath()));
+        EXPECT_EQ(localMetrics.GetNumMetrics(), 2);
+    }
+
     TEST_F(MetricsManagerTest, SubmitMetrics_NoMetircsAttributes_Fail)
     {
         bool result = false;
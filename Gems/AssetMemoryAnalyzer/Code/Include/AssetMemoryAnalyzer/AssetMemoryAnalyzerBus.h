@@ -26,6 +26,11 @@ namespace AssetMemoryAnalyzer
         // Enables or disables the AssetMemoryAnalyzer.
         virtual void SetEnabled(bool enabled = true) = 0;
 
+        // Records one allocation every sampleInterval bytes, standing in for all of those bytes, instead of recording every allocation.
+        // This keeps the analyzer cheap enough to leave on during play sessions; byte totals become estimates and allocation counts
+        // only count the recorded allocations. 0 records every allocation.
+        virtual void SetSampleInterval(AZ::u32 sampleInterval) = 0;
+
         // Exports a CSV file that may be imported into a spreadsheet. Top-level assets only, due to the limitations of CSV. Path is optional, defaults to @log@/assetmem-<TIMESTAMP>.csv
         virtual void ExportCSVFile(const char* path = nullptr) = 0;
 
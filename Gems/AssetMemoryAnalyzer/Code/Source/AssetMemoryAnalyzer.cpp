@@ -11,6 +11,7 @@
 #include <AzCore/Memory/MemoryDrillerBus.h>
 #include <AzCore/Debug/AssetTrackingTypesImpl.h>
 #include <AzCore/Debug/AssetTracking.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -68,6 +69,7 @@ namespace AssetMemoryAnalyzer
         void ResizeAllocation(AZ::IAllocator* allocator, void* address, size_t newSize) override;
 
         AZStd::shared_ptr<FrameAnalysis> GetAnalysis();
+        void SetSampleInterval(uint32_t sampleInterval);
 
     private:
         void RegisterAllocationCommon(void* address, size_t byteSize, const char* fileName, int lineNum, Data::AllocationData::CategoryInfo categoryInfo, Data::AllocationCategories category);
@@ -87,6 +89,7 @@ namespace AssetMemoryAnalyzer
         AZ::Debug::AssetTracking m_assetTracking;
         bool m_captureUncategorizedAllocations = false;
         bool m_performingAnalysis = false;
+        AZStd::atomic<uint32_t> m_sampleInterval{ 0 };
     };
 
 
@@ -187,12 +190,31 @@ namespace AssetMemoryAnalyzer
             }
         }
 
+        uint32_t recordedSize = (uint32_t)byteSize;
+        const uint32_t sampleInterval = m_sampleInterval.load(AZStd::memory_order_relaxed);
+
+        if (sampleInterval && recordedSize < sampleInterval)
+        {
+            // Record one allocation every sampleInterval bytes, standing in for all of those bytes, so the totals stay close to
+            // the real ones while most small allocations skip the lock and the table insert. Larger allocations are always recorded.
+            static thread_local int64_t bytesUntilSample = 0;
+            bytesUntilSample -= recordedSize;
+
+            if (bytesUntilSample > 0)
+            {
+                return;
+            }
+
+            bytesUntilSample += sampleInterval;
+            recordedSize = sampleInterval;
+        }
+
         {
             // Store a record for this allocation, at this code-point
             lock_type lock(m_mutex);
             auto insertResult = m_codePoints.emplace(Data::CodePoint{ fileName ? fileName : "<unknown>", lineNum, category });
             Data::CodePoint* cp = &*insertResult.first;
-            m_allocationTable.Get().emplace(address, AllocationTable::RecordType{ activeAsset, (uint32_t)byteSize, Data::AllocationData{ cp, categoryInfo } });
+            m_allocationTable.Get().emplace(address, AllocationTable::RecordType{ activeAsset, recordedSize, Data::AllocationData{ cp, categoryInfo } });
             static_cast<typename AssetTree::NodeType*>(activeAsset)->m_data.m_totalAllocations[(int)category]++;
         }
     }
@@ -310,6 +332,11 @@ namespace AssetMemoryAnalyzer
         return result;
     }
 
+    void AnalyzerImpl::SetSampleInterval(uint32_t sampleInterval)
+    {
+        m_sampleInterval.store(sampleInterval, AZStd::memory_order_relaxed);
+    }
+
     ///////////////////////////////////////////////////////////////////////////////
     // Analyzer functions
     ///////////////////////////////////////////////////////////////////////////////
@@ -326,4 +353,9 @@ namespace AssetMemoryAnalyzer
     {
         return m_impl->GetAnalysis();
     }
+
+    void Analyzer::SetSampleInterval(uint32_t sampleInterval)
+    {
+        m_impl->SetSampleInterval(sampleInterval);
+    }
 }
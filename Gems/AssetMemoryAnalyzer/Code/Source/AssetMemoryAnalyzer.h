@@ -156,6 +156,9 @@ namespace AssetMemoryAnalyzer
 
         AZStd::shared_ptr<FrameAnalysis> GetAnalysis();
 
+        // Records one allocation every sampleInterval bytes instead of every allocation; 0 records every allocation.
+        void SetSampleInterval(uint32_t sampleInterval);
+
     private:
         AZStd::unique_ptr<AnalyzerImpl> m_impl;
     };
@@ -57,6 +57,18 @@ namespace AssetMemoryAnalyzer
                 }
             );
 
+            REGISTER_CVAR2_CB_DEV_ONLY(
+                "assetmem_sample_interval",
+                &m_cvarSampleInterval,
+                0,
+                VF_NULL,
+                "AssetMemoryAnalyzer: Record one allocation every N bytes instead of every allocation, for lower overhead during play. 0 records every allocation.",
+                [](ICVar* pArgs)
+                {
+                    EBUS_EVENT(AssetMemoryAnalyzerRequestBus, SetSampleInterval, static_cast<AZ::u32>(AZStd::max(pArgs->GetIVal(), 0)));
+                }
+            );
+
             REGISTER_COMMAND_DEV_ONLY(
                 "assetmem_export_json",
                 [](IConsoleCmdArgs*) { EBUS_EVENT(AssetMemoryAnalyzerRequestBus, ExportJSONFile, nullptr); },
@@ -69,11 +81,13 @@ namespace AssetMemoryAnalyzer
                 0,
                 "AssetMemoryAnalyzer: Export CSV analysis to @log@ directory. (Top-level assets only.)");
 
+            EBUS_EVENT(AssetMemoryAnalyzerRequestBus, SetSampleInterval, static_cast<AZ::u32>(AZStd::max(m_cvarSampleInterval, 0)));
             EBUS_EVENT(AssetMemoryAnalyzerRequestBus, SetEnabled, m_cvarEnabled != 0);
         }
 
     private:
         int m_cvarEnabled = 0;
+        int m_cvarSampleInterval = 0;
     };
 }
 
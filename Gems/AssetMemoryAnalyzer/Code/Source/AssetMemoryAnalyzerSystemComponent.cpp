@@ -73,6 +73,7 @@ namespace AssetMemoryAnalyzer
         DebugImGUI m_debugImGUI;
         ExportCSV m_exportCSV;
         ExportJSON m_exportJSON;
+        AZ::u32 m_sampleInterval = 0;
 
         friend class AssetMemoryAnalyzerSystemComponent;
     };
@@ -161,6 +162,7 @@ namespace AssetMemoryAnalyzer
             if (!m_impl->m_analyzer)
             {
                 m_impl->m_analyzer.reset(aznew Analyzer);
+                m_impl->m_analyzer->SetSampleInterval(m_impl->m_sampleInterval);
             }
         }
         else
@@ -169,6 +171,16 @@ namespace AssetMemoryAnalyzer
         }
     }
 
+    void AssetMemoryAnalyzerSystemComponent::SetSampleInterval(AZ::u32 sampleInterval)
+    {
+        m_impl->m_sampleInterval = sampleInterval;
+
+        if (m_impl->m_analyzer)
+        {
+            m_impl->m_analyzer->SetSampleInterval(sampleInterval);
+        }
+    }
+
     void AssetMemoryAnalyzerSystemComponent::ExportCSVFile(const char* path)
     {
         const char* outputPath = GetExportFile(path, "csv");
@@ -41,6 +41,7 @@ namespace AssetMemoryAnalyzer
         ////////////////////////////////////////////////////////////////////////
         // AssetMemoryAnalyzerRequestBus interface implementation
         void SetEnabled(bool enabled) override;
+        void SetSampleInterval(AZ::u32 sampleInterval) override;
         void ExportCSVFile(const char* path) override;
         void ExportJSONFile(const char* path) override;
         AZStd::shared_ptr<FrameAnalysis> GetAnalysis() override;
@@ -12,7 +12,9 @@
 #include "FormatUtils.h"
 
 #include <AzCore/Debug/AssetTracking.h>
+#include <AzCore/std/hash.h>
 #include <AzCore/std/sort.h>
+#include <AzCore/std/string/string_view.h>
 #include <imgui/imgui.h>
 #include <ImGuiBus.h>
 
@@ -44,6 +46,14 @@ namespace AssetMemoryAnalyzer
             }
 
         };
+
+        // Identifies an asset by its path from the root asset, so the same asset can be found again in a later analysis
+        size_t GetAssetKey(size_t parentKey, const char* id)
+        {
+            size_t key = parentKey;
+            AZStd::hash_combine(key, AZStd::string_view(id ? id : ""));
+            return key;
+        }
     }
 
     static const ImVec4 COLUMN_HEADER_COLOR(0.7f, 0.4f, 0.2f, 1.0f);
@@ -154,19 +164,45 @@ namespace AssetMemoryAnalyzer
                     };
                 }
 
+                // The baseline lets memory regressions be found by comparing the current analysis against an earlier one
+                if (ImGui::Button("Set Baseline"))
+                {
+                    m_baseline.clear();
+                    AddToBaseline(analysis->GetRootAsset(), 0);
+                }
+
+                if (!m_baseline.empty())
+                {
+                    ImGui::SameLine();
+
+                    if (ImGui::Button("Clear Baseline"))
+                    {
+                        m_baseline.clear();
+                    }
+                }
+
                 ImGui::Text("Asset/Allocation");
                 ImGui::SameLine();
-                ImGui::SetCursorPosX(ImGui::GetWindowWidth() - COLUMN_WIDTH * 2);
+                ImGui::SetCursorPosX(GetColumnPosX(0));
                 ImGui::Text("Heap (#/kB)");
                 ImGui::SameLine();
-                ImGui::SetCursorPosX(ImGui::GetWindowWidth() - COLUMN_WIDTH);
+                ImGui::SetCursorPosX(GetColumnPosX(1));
                 ImGui::Text("VRAM (#/kB)");
+
+                if (!m_baseline.empty())
+                {
+                    ImGui::SameLine();
+                    ImGui::SetCursorPosX(GetColumnPosX(2));
+                    ImGui::Text("Change (Heap/VRAM kB)");
+                }
+
                 ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(255, 255, 32, 1.0));
                 OutputLine("Totals", analysis->GetRootAsset().m_totalSummary[(int)AllocationCategories::HEAP], analysis->GetRootAsset().m_totalSummary[(int)AllocationCategories::VRAM]);
+                OutputBaselineChange(analysis->GetRootAsset(), 0);
                 ImGui::PopStyleColor();
 
-                AZStd::function<void(const AssetInfo*, int depth)> recurse;
-                recurse = [this, &recurse](const AssetInfo* asset, int depth)
+                AZStd::function<void(const AssetInfo*, int depth, size_t assetKey)> recurse;
+                recurse = [this, &recurse](const AssetInfo* asset, int depth, size_t assetKey)
                 {
                     AZStd::vector<const AssetInfo*, AZ::OSStdAllocator> childAssetSorter;
                     childAssetSorter.resize(asset->m_childAssets.size());
@@ -181,6 +217,7 @@ namespace AssetMemoryAnalyzer
                     {
                         float prevX = ImGui::GetCursorPosX();
                         OutputLine(nullptr, asset->m_totalSummary[(int)AllocationCategories::HEAP], asset->m_totalSummary[(int)AllocationCategories::VRAM]);
+                        OutputBaselineChange(*asset, assetKey);
                         ImGui::SameLine();
                         ImGui::SetCursorPosX(prevX);
                         if (ImGui::TreeNode(asset->m_id))
@@ -221,7 +258,7 @@ namespace AssetMemoryAnalyzer
 
                             for (auto child : childAssetSorter)
                             {
-                                recurse(child, depth + 1);
+                                recurse(child, depth + 1, GetAssetKey(assetKey, child->m_id));
                             }
 
                             ImGui::TreePop();
@@ -231,18 +268,54 @@ namespace AssetMemoryAnalyzer
                     {
                         for (auto child : childAssetSorter)
                         {
-                            recurse(child, depth + 1);
+                            recurse(child, depth + 1, GetAssetKey(assetKey, child->m_id));
                         }
                     }
                 };
 
-                recurse(&analysis->GetRootAsset(), 0);
+                recurse(&analysis->GetRootAsset(), 0, 0);
             }
 
             ImGui::End();
         }
     }
 
+    void DebugImGUI::AddToBaseline(const Data::AssetInfo& asset, size_t assetKey)
+    {
+        BaselineEntry& entry = m_baseline[assetKey];
+        entry.m_heapBytes = asset.m_totalSummary[(int)Data::AllocationCategories::HEAP].m_allocatedMemory;
+        entry.m_vramBytes = asset.m_totalSummary[(int)Data::AllocationCategories::VRAM].m_allocatedMemory;
+
+        for (const Data::AssetInfo& child : asset.m_childAssets)
+        {
+            AddToBaseline(child, GetAssetKey(assetKey, child.m_id));
+        }
+    }
+
+    void DebugImGUI::OutputBaselineChange(const Data::AssetInfo& asset, size_t assetKey)
+    {
+        if (m_baseline.empty())
+        {
+            return;
+        }
+
+        // Assets that were not loaded when the baseline was set count as having used no memory then
+        BaselineEntry baselineEntry;
+        auto baselineItr = m_baseline.find(assetKey);
+
+        if (baselineItr != m_baseline.end())
+        {
+            baselineEntry = baselineItr->second;
+        }
+
+        const int64_t heapChange = int64_t(asset.m_totalSummary[(int)Data::AllocationCategories::HEAP].m_allocatedMemory) - baselineEntry.m_heapBytes;
+        const int64_t vramChange = int64_t(asset.m_totalSummary[(int)Data::AllocationCategories::VRAM].m_allocatedMemory) - baselineEntry.m_vramBytes;
+
+        ImGui::SameLine();
+        ImGui::SetCursorPosX(GetColumnPosX(2));
+        ImGui::Text("%+0.2f / %+0.2f", heapChange / 1024.0f, vramChange / 1024.0f);
+    }
+
     void DebugImGUI::OutputLine(const char* text, const Data::Summary& heapSummary, const Data::Summary& vramSummary)
     {
         if (text)
@@ -251,10 +324,10 @@ namespace AssetMemoryAnalyzer
             ImGui::SameLine();
         }
 
-        ImGui::SetCursorPosX(ImGui::GetWindowWidth() - COLUMN_WIDTH * 2);
+        ImGui::SetCursorPosX(GetColumnPosX(0));
         OutputField(heapSummary);
         ImGui::SameLine();
-        ImGui::SetCursorPosX(ImGui::GetWindowWidth() - COLUMN_WIDTH);
+        ImGui::SetCursorPosX(GetColumnPosX(1));
         OutputField(vramSummary);
     }
 
@@ -269,4 +342,11 @@ namespace AssetMemoryAnalyzer
             ImGui::Text("-- / --");
         }
     }
+
+    float DebugImGUI::GetColumnPosX(int column) const
+    {
+        // The columns are right-aligned, with a third column for the change since the baseline when one is set
+        const int columnCount = m_baseline.empty() ? 2 : 3;
+        return ImGui::GetWindowWidth() - COLUMN_WIDTH * (columnCount - column);
+    }
 }
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <ImGuiBus.h>
 
 namespace AssetMemoryAnalyzer
@@ -39,14 +40,25 @@ namespace AssetMemoryAnalyzer
 
 
     private:
+        // Memory of an asset when the baseline was set, to show how much it changed since
+        struct BaselineEntry
+        {
+            uint32_t m_heapBytes = 0;
+            uint32_t m_vramBytes = 0;
+        };
+
+        void AddToBaseline(const Data::AssetInfo& asset, size_t assetKey);
+        void OutputBaselineChange(const Data::AssetInfo& asset, size_t assetKey);
         void OutputLine(const char* text, const Data::Summary& heapSummary, const Data::Summary& vramSummary);
         void OutputField(const Data::Summary& summary);
+        float GetColumnPosX(int column) const;
 
         AssetMemoryAnalyzerSystemComponent* m_owner;
         bool (*m_childAssetSortFn)(const Data::AssetInfo* lhs, const Data::AssetInfo* rhs) = nullptr;
         AZStd::vector<const Data::AssetInfo*, AZ::OSStdAllocator> m_childAssetSorter;
         bool (*m_allocationPointSortFn)(const Data::AllocationPoint* lhs, const Data::AllocationPoint* rhs) = nullptr;
         AZStd::vector<const Data::AllocationPoint*, AZ::OSStdAllocator> m_allocationPointSorter;
+        AZStd::unordered_map<size_t, BaselineEntry, AZStd::hash<size_t>, AZStd::equal_to<size_t>, AZ::OSStdAllocator> m_baseline;
         bool m_enabled = false;
     };
 }
@@ -67,6 +67,21 @@ TEST_F(AssetMemoryAnalyzerTest, BasicTest)
 #endif
 }
 
+TEST_F(AssetMemoryAnalyzerTest, SampledAnalysis)
+{
+    AssetMemoryAnalyzerRequestBus::Broadcast(&AssetMemoryAnalyzerRequests::SetSampleInterval, 64 * 1024);
+    AssetMemoryAnalyzerRequestBus::Broadcast(&AssetMemoryAnalyzerRequests::SetEnabled, true);
+
+    AZStd::shared_ptr<FrameAnalysis> analysis;
+    AssetMemoryAnalyzerRequestBus::BroadcastResult(analysis, &AssetMemoryAnalyzerRequests::GetAnalysis);
+    ASSERT_TRUE(analysis.get());
+
+    // Switching back to recording every allocation applies to the running analyzer
+    AssetMemoryAnalyzerRequestBus::Broadcast(&AssetMemoryAnalyzerRequests::SetSampleInterval, 0);
+    AssetMemoryAnalyzerRequestBus::BroadcastResult(analysis, &AssetMemoryAnalyzerRequests::GetAnalysis);
+    ASSERT_TRUE(analysis.get());
+}
+
 AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
 
 
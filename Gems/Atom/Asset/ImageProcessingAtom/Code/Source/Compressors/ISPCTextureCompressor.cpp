@@ -7,6 +7,9 @@
  */
 
 
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/std/function/function_template.h>
 
 #include <Atom/ImageProcessing/ImageObject.h>
@@ -19,6 +22,46 @@
 
 namespace ImageProcessingAtom
 {
+    namespace
+    {
+        // The number of block rows compressed by one job. ISPC compresses the blocks of a slice with SIMD and the jobs spread
+        // the slices of a large mip over all the cores.
+        const int32_t BlockRowsPerJob = 16;
+
+        using CompressSliceFunction = AZStd::function<void(rgba_surface* sourceSlice, AZ::u8* destinationSlice)>;
+
+        // Splits the surface in horizontal slices of whole blocks and compresses them in parallel. Small surfaces, or processes
+        // without a job manager, compress the whole surface on the calling thread.
+        void CompressSurfaceSlices(const rgba_surface& sourceSurface, AZ::u8* destinationData, uint32_t destinationPitch,
+            uint32_t blockHeight, const CompressSliceFunction& compressSlice)
+        {
+            const int32_t sliceHeight = BlockRowsPerJob * static_cast<int32_t>(blockHeight);
+            if (sourceSurface.height <= sliceHeight || !AZ::JobContext::GetGlobalContext())
+            {
+                rgba_surface surface = sourceSurface;
+                compressSlice(&surface, destinationData);
+                return;
+            }
+
+            AZ::JobCompletion jobCompletion;
+            for (int32_t y = 0; y < sourceSurface.height; y += sliceHeight)
+            {
+                rgba_surface slice = sourceSurface;
+                slice.ptr = sourceSurface.ptr + static_cast<size_t>(y) * sourceSurface.stride;
+                slice.height = AZStd::min(sliceHeight, sourceSurface.height - y);
+                AZ::u8* destinationSlice = destinationData + static_cast<size_t>(static_cast<uint32_t>(y) / blockHeight) * destinationPitch;
+
+                AZ::Job* compressJob = AZ::CreateJobFunction([slice, destinationSlice, &compressSlice]() mutable
+                    {
+                        compressSlice(&slice, destinationSlice);
+                    }, true);
+                compressJob->SetDependent(&jobCompletion);
+                compressJob->Start();
+            }
+            jobCompletion.StartAndWaitForCompletion();
+        }
+    }
+
     // Class used to store functions to specific quality profiles.
     class CompressionProfile
     {
@@ -199,7 +242,10 @@ namespace ImageProcessingAtom
             switch (destinationFormat)
             {
             case ePixelFormat_BC3:
-                CompressBlocksBC3(&sourceSurface, destinationImageData);
+                CompressSurfaceSlices(sourceSurface, destinationImageData, destinationPitch, 4, [](rgba_surface* slice, AZ::u8* destination)
+                    {
+                        CompressBlocksBC3(slice, destination);
+                    });
                 break;
             case ePixelFormat_BC6UH:
             {
@@ -209,7 +255,10 @@ namespace ImageProcessingAtom
                 setProfile(&settings);
 
                 // Compress with BC6 half precision
-                CompressBlocksBC6H(&sourceSurface, destinationImageData, &settings);
+                CompressSurfaceSlices(sourceSurface, destinationImageData, destinationPitch, 4, [&settings](rgba_surface* slice, AZ::u8* destination)
+                    {
+                        CompressBlocksBC6H(slice, destination, &settings);
+                    });
             }
             break;
             case ePixelFormat_BC7:
@@ -221,7 +270,10 @@ namespace ImageProcessingAtom
                 setProfile(&settings);
 
                 // Compress with BC7
-                CompressBlocksBC7(&sourceSurface, destinationImageData, &settings);
+                CompressSurfaceSlices(sourceSurface, destinationImageData, destinationPitch, 4, [&settings](rgba_surface* slice, AZ::u8* destination)
+                    {
+                        CompressBlocksBC7(slice, destination, &settings);
+                    });
             }
             break;
             default:
@@ -234,7 +286,11 @@ namespace ImageProcessingAtom
                     setProfile(&settings, info->blockWidth, info->blockHeight);
 
                     // Compress with ASTC
-                    CompressBlocksASTC(&sourceSurface, destinationImageData, &settings);
+                    CompressSurfaceSlices(sourceSurface, destinationImageData, destinationPitch, info->blockHeight,
+                        [&settings](rgba_surface* slice, AZ::u8* destination)
+                        {
+                            CompressBlocksASTC(slice, destination, &settings);
+                        });
                 }
                 else
                 {
@@ -27,6 +27,7 @@
 #include <CommonFiles/Preprocessor.h>
 #include <CommonFiles/GlobalBuildOptions.h>
 #include <Editor/AtomShaderCapabilitiesConfigFile.h>
+#include <Editor/ShaderCompilationCache.h>
 
 namespace AZ
 {
@@ -47,6 +48,7 @@ namespace AZ
             AtomShaderConfig::CapabilitiesConfigFile::Reflect(context);
             GlobalBuildOptions::Reflect(context);
             RHI::ShaderCompilerArguments::Reflect(context);
+            ShaderCompilationCacheEntry::Reflect(context);
         }
 
         void AzslShaderBuilderSystemComponent::GetProvidedServices(ComponentDescriptor::DependencyArrayType& provided)
@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "ShaderCompilationCache.h"
+
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Math/Sha1.h>
+#include <AzCore/Math/Uuid.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Serialization/Utils.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+
+#include <AzFramework/StringFunc/StringFunc.h>
+
+namespace AZ
+{
+    namespace ShaderBuilder
+    {
+        static constexpr char ShaderCompilationCacheName[] = "ShaderCompilationCache";
+
+        // Increment to invalidate all the entries of the cache, when the way the platform compilers are invoked changes.
+        static constexpr uint32_t CacheFormatVersion = 1;
+
+        void ShaderCompilationCacheEntry::Reflect(AZ::ReflectContext* context)
+        {
+            if (auto serializeContext = azrtti_cast<SerializeContext*>(context))
+            {
+                serializeContext->Class<ShaderCompilationCacheEntry>()
+                    ->Version(0)
+                    ->Field("stageType", &ShaderCompilationCacheEntry::m_stageType)
+                    ->Field("byteCode", &ShaderCompilationCacheEntry::m_byteCode)
+                    ->Field("sourceCode", &ShaderCompilationCacheEntry::m_sourceCode)
+                    ->Field("entryFunctionName", &ShaderCompilationCacheEntry::m_entryFunctionName)
+                    ->Field("dynamicBranchCount", &ShaderCompilationCacheEntry::m_dynamicBranchCount)
+                    ;
+            }
+        }
+
+        namespace ShaderCompilationCache
+        {
+            namespace
+            {
+                AZStd::string GetCacheFolder()
+                {
+                    AZStd::string cacheFolder = "@user@/Atom/ShaderCompilationCache";
+                    if (auto settingsRegistry = AZ::SettingsRegistry::Get())
+                    {
+                        settingsRegistry->Get(cacheFolder, CacheFolderKey);
+                    }
+                    if (cacheFolder.empty())
+                    {
+                        return {};
+                    }
+
+                    IO::FileIOBase* fileIOBase = IO::FileIOBase::GetInstance();
+                    char resolvedCacheFolder[AZ_MAX_PATH_LEN] = { 0 };
+                    if (!fileIOBase || !fileIOBase->ResolvePath(cacheFolder.c_str(), resolvedCacheFolder, AZ_MAX_PATH_LEN))
+                    {
+                        return {};
+                    }
+                    return resolvedCacheFolder;
+                }
+
+                // Entries are spread over 256 sub folders, named after the first two characters of their key.
+                AZStd::string GetEntryFolder(const AZStd::string& cacheFolder, const AZStd::string& key)
+                {
+                    AZStd::string entryFolder;
+                    AzFramework::StringFunc::Path::Join(cacheFolder.c_str(), key.substr(0, 2).c_str(), entryFolder, true, true);
+                    return entryFolder;
+                }
+
+                AZStd::string GetEntryPath(const AZStd::string& entryFolder, const AZStd::string& key)
+                {
+                    AZStd::string entryPath;
+                    AzFramework::StringFunc::Path::Join(entryFolder.c_str(), (key + ".bin").c_str(), entryPath, true, true);
+                    return entryPath;
+                }
+
+                void ProcessString(Sha1& sha1, AZStd::string_view value)
+                {
+                    // The length keeps consecutive strings from being ambiguous.
+                    const uint64_t length = value.size();
+                    sha1.ProcessBytes(&length, sizeof(length));
+                    sha1.ProcessBytes(value.data(), value.size());
+                }
+            }
+
+            AZStd::string MakeKey(
+                const RHI::ShaderPlatformInterface& shaderPlatformInterface,
+                const AssetBuilderSDK::PlatformInfo& platform,
+                AZStd::string_view hlslCode,
+                const AZStd::string& entryFunctionName,
+                RHI::ShaderHardwareStage shaderStage,
+                const RHI::ShaderCompilerArguments& shaderCompilerArguments)
+            {
+                // Debug information is written next to the intermediate files of the job, and the compilation of the platforms
+                // that need the SRG layouts depends on more than the code and the arguments.
+                if (shaderPlatformInterface.BuildHasDebugInfo(shaderCompilerArguments) ||
+                    shaderPlatformInterface.VariantCompilationRequiresSrgLayoutData())
+                {
+                    return {};
+                }
+
+                AZStd::string compilerVersion;
+                if (auto settingsRegistry = AZ::SettingsRegistry::Get())
+                {
+                    settingsRegistry->Get(compilerVersion, CompilerVersionKey);
+                }
+
+                Sha1 sha1;
+                sha1.ProcessBytes(&CacheFormatVersion, sizeof(CacheFormatVersion));
+                ProcessString(sha1, compilerVersion);
+                ProcessString(sha1, shaderPlatformInterface.GetAPIName().GetStringView());
+                ProcessString(sha1, platform.m_identifier);
+                ProcessString(sha1, shaderCompilerArguments.MakeAdditionalDxcCommandLineString());
+                ProcessString(sha1, shaderPlatformInterface.GetAzslCompilerParameters(shaderCompilerArguments));
+                ProcessString(sha1, entryFunctionName);
+                const uint32_t stage = shaderStage;
+                sha1.ProcessBytes(&stage, sizeof(stage));
+                ProcessString(sha1, hlslCode);
+
+                AZ::u32 digest[5];
+                sha1.GetDigest(digest);
+                return AZStd::string::format("%08x%08x%08x%08x%08x", digest[0], digest[1], digest[2], digest[3], digest[4]);
+            }
+
+            bool Load(const AZStd::string& key, RHI::ShaderPlatformInterface::StageDescriptor& outputDescriptor)
+            {
+                const AZStd::string cacheFolder = GetCacheFolder();
+                if (key.empty() || cacheFolder.empty())
+                {
+                    return false;
+                }
+
+                const AZStd::string entryPath = GetEntryPath(GetEntryFolder(cacheFolder, key), key);
+                if (!IO::SystemFile::Exists(entryPath.c_str()))
+                {
+                    return false;
+                }
+
+                ShaderCompilationCacheEntry entry;
+                if (!AZ::Utils::LoadObjectFromFileInPlace(entryPath, entry) || entry.m_byteCode.empty())
+                {
+                    AZ_Warning(ShaderCompilationCacheName, false, "Failed to load the shader compilation cache entry \"%s\"", entryPath.c_str());
+                    return false;
+                }
+
+                outputDescriptor.m_stageType = static_cast<RHI::ShaderHardwareStage>(entry.m_stageType);
+                outputDescriptor.m_byteCode = AZStd::move(entry.m_byteCode);
+                outputDescriptor.m_sourceCode = AZStd::move(entry.m_sourceCode);
+                outputDescriptor.m_entryFunctionName = AZStd::move(entry.m_entryFunctionName);
+                outputDescriptor.m_byProducts.m_dynamicBranchCount = entry.m_dynamicBranchCount;
+
+                AZ_TracePrintf(ShaderCompilationCacheName, "Found shader function \"%s\" in the compilation cache [%s]",
+                    outputDescriptor.m_entryFunctionName.c_str(), key.c_str());
+                return true;
+            }
+
+            void Store(const AZStd::string& key, const RHI::ShaderPlatformInterface::StageDescriptor& descriptor)
+            {
+                const AZStd::string cacheFolder = GetCacheFolder();
+                if (key.empty() || cacheFolder.empty() || descriptor.m_byteCode.empty())
+                {
+                    return;
+                }
+
+                const AZStd::string entryFolder = GetEntryFolder(cacheFolder, key);
+                if (!IO::SystemFile::Exists(entryFolder.c_str()) && !IO::SystemFile::CreateDir(entryFolder.c_str()))
+                {
+                    AZ_Warning(ShaderCompilationCacheName, false, "Failed to create the shader compilation cache folder \"%s\"", entryFolder.c_str());
+                    return;
+                }
+
+                ShaderCompilationCacheEntry entry;
+                entry.m_stageType = descriptor.m_stageType;
+                entry.m_byteCode = descriptor.m_byteCode;
+                entry.m_sourceCode = descriptor.m_sourceCode;
+                entry.m_entryFunctionName = descriptor.m_entryFunctionName;
+                entry.m_dynamicBranchCount = descriptor.m_byProducts.m_dynamicBranchCount;
+
+                const AZStd::string entryPath = GetEntryPath(entryFolder, key);
+                const AZStd::string temporaryPath = AZStd::string::format("%s.%s.tmp", entryPath.c_str(), Uuid::CreateRandom().ToString<AZStd::string>(false, false).c_str());
+                if (!AZ::Utils::SaveObjectToFile(temporaryPath, AZ::DataStream::ST_BINARY, &entry))
+                {
+                    AZ_Warning(ShaderCompilationCacheName, false, "Failed to write the shader compilation cache entry \"%s\"", temporaryPath.c_str());
+                    IO::SystemFile::Delete(temporaryPath.c_str());
+                    return;
+                }
+
+                // Another builder may have stored the same entry in the meantime, in which case both are identical.
+                if (!IO::SystemFile::Rename(temporaryPath.c_str(), entryPath.c_str(), true))
+                {
+                    IO::SystemFile::Delete(temporaryPath.c_str());
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AssetBuilderSDK/AssetBuilderSDK.h>
+
+#include <Atom/RHI.Edit/ShaderCompilerArguments.h>
+#include <Atom/RHI.Edit/ShaderPlatformInterface.h>
+
+#include <AzCore/RTTI/ReflectContext.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ
+{
+    namespace ShaderBuilder
+    {
+        //! A compiled shader stage, as stored in the shader compilation cache.
+        struct ShaderCompilationCacheEntry final
+        {
+            AZ_TYPE_INFO(ShaderCompilationCacheEntry, "{2D8F6A41-B3C7-4E15-9A02-7C5E1F4B8D63}");
+
+            static void Reflect(AZ::ReflectContext* context);
+
+            uint32_t m_stageType = RHI::ShaderHardwareStage::Invalid;
+            AZStd::vector<uint8_t> m_byteCode;
+            AZStd::vector<char> m_sourceCode;
+            AZStd::string m_entryFunctionName;
+            uint32_t m_dynamicBranchCount = RHI::ShaderPlatformInterface::ByProducts::UnknownDynamicBranchCount;
+        };
+
+        //! A content-addressed cache of compiled shader stages, so a shader stage whose code and compilation settings didn't
+        //! change is never compiled again, even when its shader or variant asset is rebuilt.
+        //! The cache lives in the folder set in the settings registry under CacheFolderKey, which can be shared between the
+        //! machines of a build farm. When the key is not set, the cache is in @user@/Atom/ShaderCompilationCache.
+        //! Entries are written to a temporary file first and then renamed, so concurrent builders never see a partial entry.
+        namespace ShaderCompilationCache
+        {
+            //! Settings registry key of the cache folder. An empty folder disables the cache.
+            static constexpr char CacheFolderKey[] = "/O3DE/Atom/Shaders/Build/CompilationCache/Folder";
+            //! Settings registry key of a string identifying the version of the shader compilers in use, which is part of
+            //! the key of every entry. Change it when the compilers are updated, to stop using the stage compiled by the old ones.
+            static constexpr char CompilerVersionKey[] = "/O3DE/Atom/Shaders/Build/CompilationCache/CompilerVersion";
+
+            //! Returns the key of the compilation of a shader stage, or an empty string if it can't be cached.
+            //! @hlslCode The complete code passed to the platform compiler, including the shader option definitions of the variant.
+            AZStd::string MakeKey(
+                const RHI::ShaderPlatformInterface& shaderPlatformInterface,
+                const AssetBuilderSDK::PlatformInfo& platform,
+                AZStd::string_view hlslCode,
+                const AZStd::string& entryFunctionName,
+                RHI::ShaderHardwareStage shaderStage,
+                const RHI::ShaderCompilerArguments& shaderCompilerArguments);
+
+            //! Fills the descriptor from the cache entry of the key. Returns false if there is no such entry.
+            bool Load(const AZStd::string& key, RHI::ShaderPlatformInterface::StageDescriptor& outputDescriptor);
+
+            //! Adds the compiled shader stage to the cache, replacing the entry of the key if there is one already.
+            void Store(const AZStd::string& key, const RHI::ShaderPlatformInterface::StageDescriptor& descriptor);
+        }
+    }
+}
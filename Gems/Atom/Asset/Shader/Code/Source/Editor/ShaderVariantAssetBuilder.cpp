@@ -49,6 +49,7 @@
 
 #include "ShaderAssetBuilder.h"
 #include "ShaderBuilderUtility.h"
+#include "ShaderCompilationCache.h"
 #include "SrgLayoutUtility.h"
 #include "AzslData.h"
 #include "AzslCompiler.h"
@@ -1062,12 +1063,13 @@ namespace AZ
             }
 
             AZStd::string variantShaderSourcePath;
+            AZStd::string variantShaderSourceString;
             // Check if we need to prepend any code prefix
             if (!hlslCodeToPrependForVariant.empty())
             {
                 // Prepend any shader code prefix that we should apply to this variant
                 // and save it back to a file.
-                AZStd::string variantShaderSourceString(hlslCodeToPrependForVariant);
+                variantShaderSourceString = hlslCodeToPrependForVariant;
                 variantShaderSourceString += creationContext.m_hlslSourceContent;
 
                 AZStd::string shaderAssetName = AZStd::string::format(
@@ -1113,15 +1115,23 @@ namespace AZ
 
                 auto assetBuilderShaderType = ShaderBuilderUtility::ToAssetBuilderShaderType(shaderStageType);
 
-                // Compile HLSL to the platform specific shader.
+                // Compile HLSL to the platform specific shader, unless the same code was compiled with the same settings before.
                 RHI::ShaderPlatformInterface::StageDescriptor descriptor;
-                bool shaderWasCompiled = creationContext.m_shaderPlatformInterface.CompilePlatformInternal(
-                    creationContext.m_platformInfo, variantShaderSourcePath, shaderEntryName, assetBuilderShaderType,
-                    creationContext.m_tempDirPath, descriptor, creationContext.m_shaderCompilerArguments);
-
-                if (!shaderWasCompiled)
+                const AZStd::string compilationCacheKey = ShaderCompilationCache::MakeKey(
+                    creationContext.m_shaderPlatformInterface, creationContext.m_platformInfo,
+                    hlslCodeToPrependForVariant.empty() ? creationContext.m_hlslSourceContent : variantShaderSourceString,
+                    shaderEntryName, assetBuilderShaderType, creationContext.m_shaderCompilerArguments);
+                if (!ShaderCompilationCache::Load(compilationCacheKey, descriptor))
                 {
-                    return AZ::Failure(AZStd::string::format("Could not compile the shader function %s", shaderEntryName.c_str()));
+                    bool shaderWasCompiled = creationContext.m_shaderPlatformInterface.CompilePlatformInternal(
+                        creationContext.m_platformInfo, variantShaderSourcePath, shaderEntryName, assetBuilderShaderType,
+                        creationContext.m_tempDirPath, descriptor, creationContext.m_shaderCompilerArguments);
+
+                    if (!shaderWasCompiled)
+                    {
+                        return AZ::Failure(AZStd::string::format("Could not compile the shader function %s", shaderEntryName.c_str()));
+                    }
+                    ShaderCompilationCache::Store(compilationCacheKey, descriptor);
                 }
                 // bubble up the byproducts to the caller by moving them to the context.
                 outputByproducts.emplace(AZStd::move(descriptor.m_byProducts));
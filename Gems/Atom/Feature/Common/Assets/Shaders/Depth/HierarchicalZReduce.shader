@@ -0,0 +1,15 @@
+{
+    "Source": "HierarchicalZReduce",
+
+    "ProgramSettings" :
+    {
+        "EntryPoints":
+        [
+        {
+            "name" : "MainCS",
+            "type" : "Compute"
+        }
+        ]
+    }
+
+}
@@ -0,0 +1,20 @@
+{
+    "Source": "LightCullingClusters",
+
+    "CompilerHints":
+    {
+        "DisableOptimizations":false
+    },
+
+    "ProgramSettings" :
+    {
+        "EntryPoints":
+        [
+        {
+            "name": "MainCS",
+            "type" : "Compute"
+        }
+        ]
+    }
+
+}
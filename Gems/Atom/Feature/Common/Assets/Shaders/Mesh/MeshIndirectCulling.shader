@@ -0,0 +1,15 @@
+{
+    "Source": "MeshIndirectCulling",
+
+    "ProgramSettings":
+    {
+      "EntryPoints":
+      [
+        {
+          "name": "MainCS",
+          "type": "Compute"
+        }
+      ]
+    }
+
+}
@@ -148,6 +148,7 @@ set(FILES
     Passes/ImGui.pass
     Passes/LightAdaptationParent.pass
     Passes/LightCulling.pass
+    Passes/LightCullingClusters.pass
     Passes/LightCullingHeatmap.pass
     Passes/LightCullingParent.pass
     Passes/LightCullingRemap.pass
@@ -160,6 +161,7 @@ set(FILES
     Passes/LuminanceHistogramGenerator.pass
     Passes/MainPipeline.pass
     Passes/MainPipelineRenderToTexture.pass
+    Passes/MeshIndirectCulling.pass
     Passes/MeshMotionVector.pass
     Passes/ModulateTexture.pass
     Passes/MorphTarget.pass
@@ -228,6 +230,7 @@ set(FILES
     ShaderLib/Atom/Features/LightCulling/LightCullingTileIterator.azsli
     ShaderLib/Atom/Features/LightCulling/NVLC.azsli
     ShaderLib/Atom/Features/Math/Filter.azsli
+    ShaderLib/Atom/Features/Mesh/MeshIndirectInstancing.azsli
     ShaderLib/Atom/Features/Math/FilterPassSrg.azsli
     ShaderLib/Atom/Features/Math/IntersectionTests.azsli
     ShaderLib/Atom/Features/MorphTargets/MorphTargetCompression.azsli
@@ -324,6 +327,8 @@ set(FILES
     Shaders/ImGui/ImGui.shader
     Shaders/LightCulling/LightCulling.azsl
     Shaders/LightCulling/LightCulling.shader
+    Shaders/LightCulling/LightCullingClusters.azsl
+    Shaders/LightCulling/LightCullingClusters.shader
     Shaders/LightCulling/LightCullingHeatmap.azsl
     Shaders/LightCulling/LightCullingHeatmap.shader
     Shaders/LightCulling/LightCullingRemap.azsl
@@ -336,6 +341,8 @@ set(FILES
     Shaders/Math/GaussianFilterFloatHorizontal.shader
     Shaders/Math/GaussianFilterFloatVertical.azsl
     Shaders/Math/GaussianFilterFloatVertical.shader
+    Shaders/Mesh/MeshIndirectCulling.azsl
+    Shaders/Mesh/MeshIndirectCulling.shader
     Shaders/MorphTargets/MorphTargetCS.azsl
     Shaders/MorphTargets/MorphTargetCS.shader
     Shaders/MorphTargets/MorphTargetSRG.azsli
@@ -15,6 +15,7 @@
 #include <Atom/Feature/Material/MaterialAssignment.h>
 #include <Atom/Feature/TransformService/TransformServiceFeatureProcessor.h>
 #include <RayTracing/RayTracingFeatureProcessor.h>
+#include <Mesh/MeshIndirectDraw.h>
 #include <AzCore/Asset/AssetCommon.h>
 #include <AtomCore/std/parallel/concurrency_checker.h>
 #include <AzCore/Console/Console.h>
@@ -30,11 +31,18 @@ namespace AZ
         {
             friend class MeshFeatureProcessor;
             friend class MeshLoader;
+            friend class MeshIndirectDraw;
 
         public:
             const Data::Instance<RPI::Model>& GetModel() { return m_model; }
             const RPI::Cullable& GetCullable() { return m_cullable; }
 
+            //! Clears the visibility flag of the cullable, which the culling jobs set again when it passes culling in any view.
+            void ResetCullingVisibility() { m_cullable.m_isVisible = false; }
+
+            //! Returns true if the mesh is culled and drawn on the gpu, in which case it isn't culled by the culling jobs.
+            bool IsDrawnIndirect() const { return m_drawIndirect; }
+
         private:
             class MeshLoader
                 : private Data::AssetBus::Handler
@@ -67,6 +75,7 @@ namespace AZ
             RPI::Cullable::LodOverride GetLodOverride();
             void UpdateDrawPackets(bool forceUpdate = false);
             void BuildCullable();
+            size_t GetPendingLodUploadCount() const;
             void UpdateCullBounds(const TransformServiceFeatureProcessor* transformService);
             void UpdateObjectSrg();
             bool MaterialRequiresForwardPassIblSpecular(Data::Instance<RPI::Material> material) const;
@@ -93,12 +102,17 @@ namespace AZ
 
             Aabb m_aabb = Aabb::CreateNull();
 
+            //! Number of lods that were still uploading when the cullable was built, and draw a coarser lod in the meantime
+            size_t m_pendingLodUploadCount = 0;
+
             bool m_cullBoundsNeedsUpdate = false;
             bool m_cullableNeedsRebuild = false;
             bool m_objectSrgNeedsUpdate = true;
             bool m_excludeFromReflectionCubeMaps = false;
             bool m_visible = true;
             bool m_hasForwardPassIblSpecularMaterial = false;
+            //! The mesh is drawn by the MeshIndirectDraw, and its cullable isn't registered with the culling scene
+            bool m_drawIndirect = false;
         };
 
         //! This feature processor handles static and dynamic non-skinned meshes.
@@ -121,6 +135,8 @@ namespace AZ
             void Deactivate() override;
             //! Updates GPU buffers with latest data from render proxies
             void Simulate(const FeatureProcessor::SimulatePacket& packet) override;
+            //! Submits the indirect mesh draws to the views
+            void Render(const FeatureProcessor::RenderPacket& packet) override;
 
             // RPI::SceneNotificationBus overrides ...
             void OnBeginPrepareRender() override;
@@ -165,6 +181,9 @@ namespace AZ
 
             // called when reflection probes are modified in the editor so that meshes can re-evaluate their probes
             void UpdateMeshReflectionProbes();
+
+            //! Returns the instanced indirect mesh draws, used by the MeshIndirectCullingPass
+            MeshIndirectDraw& GetIndirectDraw() { return m_indirectDraw; }
         private:
             void ForceRebuildDrawPackets(const AZ::ConsoleCommandContainer& arguments);
             AZ_CONSOLEFUNC(MeshFeatureProcessor,
@@ -178,12 +197,17 @@ namespace AZ
             // RPI::SceneNotificationBus::Handler overrides...
             void OnRenderPipelineAdded(RPI::RenderPipelinePtr pipeline) override;
             void OnRenderPipelineRemoved(RPI::RenderPipeline* pipeline) override;
+
+            //! Checks whether a render pipeline other than ignoredPipeline contains a MeshIndirectCullingPass
+            void UpdateIndirectCullingPassAvailable(const RPI::RenderPipeline* ignoredPipeline = nullptr);
+            void UpdateIndirectDraws();
                         
             AZStd::concurrency_checker m_meshDataChecker;
             StableDynamicArray<MeshDataInstance> m_meshData;
             TransformServiceFeatureProcessor* m_transformService;
             RayTracingFeatureProcessor* m_rayTracingFeatureProcessor = nullptr;
             AZ::RPI::ShaderSystemInterface::GlobalShaderOptionUpdatedEvent::Handler m_handleGlobalShaderOptionUpdate;
+            MeshIndirectDraw m_indirectDraw;
             bool m_forceRebuildDrawPackets = false;
         };
     } // namespace Render
@@ -44,6 +44,7 @@ namespace AZ
             void Activate() override;
             void Deactivate() override;
             void Simulate(const FeatureProcessor::SimulatePacket& packet) override;
+            void OnRenderEnd() override;
 
             // find the reflection probe volumes that contain the position
             using ReflectionProbeVector = AZStd::vector<AZStd::shared_ptr<ReflectionProbe>>;
@@ -90,6 +91,14 @@ namespace AZ
             typedef AZStd::vector<NotifyCubeMapAssetEntry> NotifyCubeMapAssetVector;
             NotifyCubeMapAssetVector m_notifyCubeMapAssets;
 
+            // list of probe bakes waiting for one of the r_reflectionProbeMaxConcurrentBakes slots, started in OnRenderEnd()
+            struct PendingBakeEntry
+            {
+                ReflectionProbeHandle m_probe;
+                BuildCubeMapCallback m_callback;
+            };
+            AZStd::vector<PendingBakeEntry> m_pendingBakes;
+
             // position structure for the box vertices
             struct Position
             {
@@ -66,5 +66,8 @@ namespace AZ::Render
         virtual void SetShadowProperties(ShadowId id, const ProjectedShadowDescriptor& descriptor) = 0;
         //! Gets the current shadow properties. Useful for updating several properties at once in SetShadowProperties() without having to set every property.
         virtual const ProjectedShadowDescriptor& GetShadowProperties(ShadowId id) = 0;
+        //! Renders the shadowmap again on the next frame when shadowmap caching is enabled. Changes of the shadow and of the cullables
+        //! inside its view already invalidate the cached shadowmap, this is for content that changes without moving, like skinned meshes.
+        virtual void InvalidateShadowmap(ShadowId id) = 0;
     };
 }
@@ -108,7 +108,7 @@ namespace AZ
             const AZStd::vector<SkinnedSubMeshProperties>& GetSubMeshProperties() const;
 
             //! Add a single morph target that can be applied to an instance of this skinned mesh
-            //! Creates a view into the larger morph target buffer to be used for applying an individual morph
+            //! The first call creates the view into the morph target buffer that is shared by all the morph targets of the lod
             //! @param metaAsset The metadata that has info such as the min/max weight, offset, and vertex count for the morph
             //! @param morphBufferAsset The the combined buffer that has all the deltas for all morph targets in the model lod
             //! @param bufferNamePrefix A prefix that can be used to identify this morph target when creating the view into the morph target buffer.
@@ -119,8 +119,9 @@ namespace AZ
             //! Get the MetaDatas for all the morph targets that can be applied to an instance of this skinned mesh
             const AZStd::vector<MorphTargetMetaData>& GetMorphTargetMetaDatas() const;
 
-            //! Get the MorphTargetInputBuffers for all the morph targets that can be applied to an instance of this skinned mesh
-            const AZStd::vector<AZStd::intrusive_ptr<MorphTargetInputBuffers>>& GetMorphTargetInputBuffers() const;
+            //! Get the MorphTargetInputBuffers with the deltas of all the morph targets that can be applied to an instance of this skinned mesh
+            //! Returns null if the lod has no morph targets
+            const AZStd::intrusive_ptr<MorphTargetInputBuffers>& GetMorphTargetInputBuffers() const;
 
             //! Sets the input vertex stream from an existing buffer asset.
             void SetSkinningInputBufferAsset(const Data::Asset<RPI::BufferAsset> bufferAsset, SkinnedMeshInputVertexStreams inputStream);
@@ -173,8 +174,9 @@ namespace AZ
             //! Container with one MorphTargetMetaData per morph target that can potentially be applied to an instance of this skinned mesh
             AZStd::vector<MorphTargetMetaData> m_morphTargetMetaDatas;
 
-            //! Container with one MorphTargetInputBuffers per morph target that can potentially be applied to an instance of this skinned mesh
-            AZStd::vector<AZStd::intrusive_ptr<MorphTargetInputBuffers>> m_morphTargetInputBuffers;
+            //! The deltas of all the morph targets that can potentially be applied to an instance of this skinned mesh
+            //! The MorphTargetMetaData of each morph target gives the range of its deltas
+            AZStd::intrusive_ptr<MorphTargetInputBuffers> m_morphTargetInputBuffers;
 
             //! Total number of indices for the entire lod
             uint32_t m_indexCount = 0;
@@ -236,8 +238,8 @@ namespace AZ
             //! Returns a vector of MorphTargetMetaData with one entry for each morph target that could be applied to this mesh
             const AZStd::vector<MorphTargetMetaData>& GetMorphTargetMetaData(size_t lodIndex) const { return m_lods[lodIndex].GetMorphTargetMetaDatas(); }
 
-            //! Returns a vector of MorphTargetInputBuffers which serve as input to the morph target pass
-            const AZStd::vector<AZStd::intrusive_ptr<MorphTargetInputBuffers>>& GetMorphTargetInputBuffers(size_t lodIndex) const { return m_lods[lodIndex].GetMorphTargetInputBuffers(); }
+            //! Returns the MorphTargetInputBuffers which serve as input to the morph target pass, null if the lod has no morph targets
+            const AZStd::intrusive_ptr<MorphTargetInputBuffers>& GetMorphTargetInputBuffers(size_t lodIndex) const { return m_lods[lodIndex].GetMorphTargetInputBuffers(); }
 
         private:
             AZStd::fixed_vector<SkinnedMeshInputLod, RPI::ModelLodAsset::LodCountMax> m_lods;
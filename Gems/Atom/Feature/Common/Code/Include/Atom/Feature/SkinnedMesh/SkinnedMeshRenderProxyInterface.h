@@ -25,6 +25,14 @@ namespace AZ
             virtual void SetTransform(const AZ::Transform& transform) = 0;
             virtual void SetSkinningMatrices(const AZStd::vector<float>& data) = 0;
             virtual void SetMorphTargetWeights(uint32_t lodIndex, const AZStd::vector<float>& weights) = 0;
+
+            //! Returns false if the skinned mesh didn't pass culling in any view during the last frame, in which case it wasn't skinned.
+            //! Animation systems can use it to stop updating the joints of the meshes nobody sees.
+            virtual bool IsVisible() const = 0;
+
+            //! Returns the number of frames between two skinning updates chosen from the screen size of the mesh during the last frame.
+            //! It is 1 when the mesh is skinned every frame.
+            virtual uint32_t GetSkinningUpdateInterval() const = 0;
         };
         using SkinnedMeshRenderProxyInterfaceHandle = StableDynamicArrayHandle<SkinnedMeshRenderProxyInterface>;
 
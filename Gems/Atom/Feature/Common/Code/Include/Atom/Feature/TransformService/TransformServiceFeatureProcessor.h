@@ -13,6 +13,7 @@
 #include <Atom/RHI/BufferPool.h>
 #include <Atom/RPI.Public/FeatureProcessor.h>
 #include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
+#include <AzCore/std/containers/array.h>
 
 namespace AZ
 {
@@ -63,11 +64,38 @@ namespace AZ
             // Flag value for when the buffers have no empty spaces.
             static const uint32_t NoAvailableTransformIndices = -1;
 
+            // The buffers are double buffered, each frame the other set is updated and bound as the current transforms, while the
+            // set of the previous frame is bound as the history transforms. So a set is never written while the previous frame reads it.
+            static constexpr uint32_t BufferSetCount = 2;
+
+            // Pending indices that are this close in the buffers are uploaded in the same range.
+            static constexpr uint32_t MaxMergedRangeGap = 16;
+
+            struct BufferSet
+            {
+                Data::Instance<RPI::Buffer> m_objectToWorldBuffer;
+                Data::Instance<RPI::Buffer> m_objectToWorldInverseTransposeBuffer;
+
+                // Indices of the transforms that changed since this set was last updated.
+                AZStd::vector<uint32_t> m_pendingIndices;
+
+                // Set when the buffers were created or resized, their content is lost.
+                bool m_needsFullUpload = true;
+            };
+
             TransformServiceFeatureProcessor(const TransformServiceFeatureProcessor&) = delete;
 
             // Prepare GPU buffers for object transformation matrices
             // Create the buffers if they don't exist. Otherwise, resize them if they are not large enough for the matrices
-            void PrepareBuffers();
+            void PrepareBuffers(BufferSet& bufferSet);
+
+            // Uploads the transforms that changed since the set was last updated, or all of them if the buffers were recreated.
+            void UpdateBuffers(uint32_t bufferSetIndex);
+
+            void UploadRange(BufferSet& bufferSet, uint32_t firstIndex, uint32_t count);
+
+            // Marks the transform as changed in all the buffer sets.
+            void MarkPending(uint32_t index);
             
             Data::Instance<RPI::ShaderResourceGroup> m_sceneSrg;
             RHI::ShaderInputBufferIndex m_objectToWorldBufferIndex;
@@ -80,18 +108,17 @@ namespace AZ
             // with an index to their transform, and updates to the transform just update the buffer, not individual mesh SRGs.
             AZStd::vector<Float4x3> m_objectToWorldTransforms;
             AZStd::vector<Float4x3> m_objectToWorldInverseTransposeTransforms;
-            AZStd::vector<Float4x3> m_objectToWorldHistoryTransforms;
+
+            // One bit per buffer set, set when the transform is in the pending indices of that set.
+            AZStd::vector<uint8_t> m_pendingBufferSetMasks;
 
             static const size_t TransformValueSize = sizeof(decltype(m_objectToWorldTransforms)::value_type);
             static const size_t NormalValueSize = sizeof(decltype(m_objectToWorldInverseTransposeTransforms)::value_type);
 
-            Data::Instance<RPI::Buffer> m_objectToWorldBuffer;
-            Data::Instance<RPI::Buffer> m_objectToWorldInverseTransposeBuffer;
-            Data::Instance<RPI::Buffer> m_objectToWorldHistoryBuffer;
+            AZStd::array<BufferSet, BufferSetCount> m_bufferSets;
+            uint32_t m_currentBufferSetIndex = 0;
 
             uint32_t m_firstAvailableTransformIndex = NoAvailableTransformIndices;
-            bool m_deviceBufferNeedsUpdate = false;
-            bool m_historyBufferNeedsUpdate = false;
             bool m_isWriteable = true;     //prevents write access during certain parts of the frame (for threadsafety)
         };
     }
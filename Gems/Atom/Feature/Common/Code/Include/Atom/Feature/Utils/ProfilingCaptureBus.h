@@ -28,8 +28,31 @@ namespace AZ
             //! Dump the Cpu Profiling Statistics to a json file.
             virtual bool CaptureCpuProfilingStatistics(const AZStd::string& outputFilePath) = 0;
 
+            //! Dump the Cpu profiler continuous capture to a json file in the Chrome trace event format.
+            //! The file contains the most recent time regions of every thread and is written right away.
+            virtual bool CaptureCpuProfilingTimeline(const AZStd::string& outputFilePath) = 0;
+
             //! Dump the benchmark metadata to a json file.
             virtual bool CaptureBenchmarkMetadata(const AZStd::string& benchmarkName, const AZStd::string& outputFilePath) = 0;
+
+            //! Dump the allocated bytes and capacity of every allocator to a json file. The file is written right away.
+            //! The peak bytes and allocation counts are only known for the allocators that have allocation records.
+            virtual bool CaptureMemoryStatistics(const AZStd::string& outputFilePath) = 0;
+
+            //! Start sampling the Timestamp of every pass once every sampleInterval frames.
+            //! The most recent samples of each pass are kept in a ring, r_gpuPassTelemetryRingSize sets how many.
+            virtual bool StartPassTimestampTelemetry(uint32_t sampleInterval) = 0;
+
+            //! Stop sampling the pass Timestamps and release the samples.
+            virtual void StopPassTimestampTelemetry() = 0;
+
+            //! Get a percentile, from 0 to 100, of the sampled durations of a pass in nanoseconds.
+            //! @param passPath The path name of the pass, for example "Root.MainPipeline_0.ForwardPass".
+            //! Returns 0 if the pass has no samples.
+            virtual uint64_t GetPassTimestampPercentile(const AZStd::string& passPath, float percentile) const = 0;
+
+            //! Dump the percentiles of the sampled pass durations to a json file. The file is written right away.
+            virtual bool CapturePassTimestampTelemetry(const AZStd::string& outputFilePath) = 0;
         };
         using ProfilingCaptureRequestBus = EBus<ProfilingCaptureRequests>;
 
@@ -651,6 +651,20 @@ namespace AZ
         {
             AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzRender);
 
+            // Build the vertices before taking the lock, so threads that draw at the same time only serialize on the copy
+            VertexBuffer vertices;
+            vertices.reserve(vertexCount);
+            AZ::Vector3 center(0.0f, 0.0f, 0.0f);
+            for (uint32_t vertexIndex = 0; vertexIndex < vertexCount; ++vertexIndex)
+            {
+                AZ::u32 packedColor = packedColorFunction(vertexIndex);
+                const AZ::Vector3& vertex = points[vertexIndex];
+                vertices.push_back(AuxGeomDynamicVertex(vertex, packedColor));
+
+                center += vertex;
+            }
+            center /= static_cast<float>(vertexCount);
+
             // grab a mutex lock for the rest of this function so that a commit cannot happen during it and
             // other threads can't add geometry during it
             AZStd::lock_guard<AZStd::recursive_mutex> lock(m_buffersWriteLock);
@@ -668,19 +682,11 @@ namespace AZ
                 return;
             }
 
-            AZ::Vector3 center(0.0f, 0.0f, 0.0f);
-            primBuffer.m_vertexBuffer.reserve(vertexCount);
-            primBuffer.m_indexBuffer.reserve(vertexCount);
+            primBuffer.m_vertexBuffer.insert(primBuffer.m_vertexBuffer.end(), vertices.begin(), vertices.end());
             for (uint32_t vertexIndex = 0; vertexIndex < vertexCount; ++vertexIndex)
             {
-                AZ::u32 packedColor = packedColorFunction(vertexIndex);
-                const AZ::Vector3& vertex = points[vertexIndex];
-                primBuffer.m_vertexBuffer.push_back(AuxGeomDynamicVertex(vertex, packedColor));
                 primBuffer.m_indexBuffer.push_back(vertexOffset + vertexIndex);
-
-                center += vertex;
             }
-            center /= static_cast<float>(vertexCount);
 
             AuxGeomBlendMode blendMode = isOpaque ? BlendMode_Off : BlendMode_Alpha;
             if (ShouldBatchDraw(primBuffer, primitiveType, blendMode, depthRead, depthWrite, faceCull, width, viewProjOverrideIndex))
@@ -727,6 +733,27 @@ namespace AZ
                 "Index count must be at least %d and must be a multiple of %d",
                 verticesPerPrimitiveType, verticesPerPrimitiveType);
 
+            // Build the vertices and indices before taking the lock, so threads that draw at the same time only serialize on the copy
+            VertexBuffer vertices;
+            vertices.reserve(vertexCount);
+            AZ::Vector3 center(0.0f, 0.0f, 0.0f);
+            for (uint32_t vertexIndex = 0; vertexIndex < vertexCount; ++vertexIndex)
+            {
+                AZ::u32 packedColor = packedColorFunction(vertexIndex);
+                const AZ::Vector3& vertex = points[vertexIndex];
+                vertices.push_back(AuxGeomDynamicVertex(vertex, packedColor));
+
+                center += vertex;
+            }
+            center /= aznumeric_cast<float>(vertexCount);
+
+            IndexBuffer indices;
+            indices.reserve(indexCount);
+            for (uint32_t index = 0; index < indexCount; ++index)
+            {
+                indices.push_back(indexFunction(index));
+            }
+
             // grab a mutex lock for the rest of this function so that a commit cannot happen during it and
             // other threads can't add geometry during it
             AZStd::lock_guard<AZStd::recursive_mutex> lock(m_buffersWriteLock);
@@ -744,22 +771,10 @@ namespace AZ
                 return;
             }
 
-            AZ::Vector3 center(0.0f, 0.0f, 0.0f);
-            primBuffer.m_vertexBuffer.reserve(vertexCount);
-            for (uint32_t vertexIndex = 0; vertexIndex < vertexCount; ++vertexIndex)
-            {
-                AZ::u32 packedColor = packedColorFunction(vertexIndex);
-                const AZ::Vector3& vertex = points[vertexIndex];
-                primBuffer.m_vertexBuffer.push_back(AuxGeomDynamicVertex(vertex, packedColor));
-
-                center += vertex;
-            }
-            center /= aznumeric_cast<float>(vertexCount);
-
-            primBuffer.m_indexBuffer.reserve(indexCount);
-            for (uint32_t index = 0; index < indexCount; ++index)
+            primBuffer.m_vertexBuffer.insert(primBuffer.m_vertexBuffer.end(), vertices.begin(), vertices.end());
+            for (AuxGeomIndex index : indices)
             {
-                primBuffer.m_indexBuffer.push_back(vertexOffset + indexFunction(index));
+                primBuffer.m_indexBuffer.push_back(vertexOffset + index);
             }
 
             AuxGeomBlendMode blendMode = isOpaque ? BlendMode_Off : BlendMode_Alpha;
@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <CoreLights/LightCullingClustersPass.h>
+
+#include <Atom/RHI/CommandList.h>
+#include <Atom/RPI.Public/Buffer/BufferSystemInterface.h>
+#include <Atom/RPI.Public/RenderPipeline.h>
+#include <Atom/RPI.Public/Scene.h>
+#include <Atom/RPI.Public/View.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/algorithm.h>
+#include <CoreLights/CapsuleLightFeatureProcessor.h>
+#include <CoreLights/DiskLightFeatureProcessor.h>
+#include <CoreLights/LightCullingConstants.h>
+#include <CoreLights/LightCullingPass.h>
+#include <CoreLights/PointLightFeatureProcessor.h>
+#include <CoreLights/QuadLightFeatureProcessor.h>
+#include <CoreLights/SimplePointLightFeatureProcessor.h>
+#include <CoreLights/SimpleSpotLightFeatureProcessor.h>
+#include <cmath>
+
+namespace AZ
+{
+    namespace Render
+    {
+        namespace
+        {
+            // The slices are spread exponentially up to this view depth, the last slice extends to the far plane
+            constexpr float MaxClusterSliceDepth = 1000.0f;
+            constexpr float MaxClusterDepth = 1000000.0f;
+            constexpr float MinClusterDepth = 0.01f;
+
+            // Returns the view depths of the near and far planes of a perspective projection
+            AZStd::array<float, 2> ComputeNearFarDepths(const Matrix4x4& viewToClip)
+            {
+                // clip z = a * view z + b and clip w = -view z, the depths are where the ndc z is 0 and 1 in either order
+                const float a = viewToClip.GetElement(2, 2);
+                const float b = viewToClip.GetElement(2, 3);
+                const float depthAtZero = (std::fabs(a) > Constants::FloatEpsilon) ? std::fabs(b / a) : MaxClusterDepth;
+                const float depthAtOne = (std::fabs(a + 1.0f) > Constants::FloatEpsilon) ? std::fabs(b / (a + 1.0f)) : MaxClusterDepth;
+
+                const float nearDepth = AZStd::clamp(AZStd::min(depthAtZero, depthAtOne), MinClusterDepth, MaxClusterDepth);
+                const float farDepth = AZStd::clamp(AZStd::max(depthAtZero, depthAtOne), nearDepth, MaxClusterDepth);
+                return { nearDepth, farDepth };
+            }
+        }
+
+        RPI::Ptr<LightCullingClustersPass> LightCullingClustersPass::Create(const RPI::PassDescriptor& descriptor)
+        {
+            RPI::Ptr<LightCullingClustersPass> pass = aznew LightCullingClustersPass(descriptor);
+            return pass;
+        }
+
+        LightCullingClustersPass::LightCullingClustersPass(const RPI::PassDescriptor& descriptor)
+            : RPI::ComputePass(descriptor)
+        {
+            m_lightdata[eLightTypes_SimplePoint].m_lightCountIndex  = Name("m_simplePointLightCount");
+            m_lightdata[eLightTypes_SimplePoint].m_lightBufferIndex = Name("m_simplePointLights");
+            m_lightdata[eLightTypes_SimpleSpot].m_lightCountIndex   = Name("m_simpleSpotLightCount");
+            m_lightdata[eLightTypes_SimpleSpot].m_lightBufferIndex  = Name("m_simpleSpotLights");
+            m_lightdata[eLightTypes_Point].m_lightCountIndex        = Name("m_pointLightCount");
+            m_lightdata[eLightTypes_Point].m_lightBufferIndex       = Name("m_pointLights");
+            m_lightdata[eLightTypes_Disk].m_lightCountIndex         = Name("m_diskLightCount");
+            m_lightdata[eLightTypes_Disk].m_lightBufferIndex        = Name("m_diskLights");
+            m_lightdata[eLightTypes_Capsule].m_lightCountIndex      = Name("m_capsuleLightCount");
+            m_lightdata[eLightTypes_Capsule].m_lightBufferIndex     = Name("m_capsuleLights");
+            m_lightdata[eLightTypes_Quad].m_lightCountIndex         = Name("m_quadLightCount");
+            m_lightdata[eLightTypes_Quad].m_lightBufferIndex        = Name("m_quadLights");
+        }
+
+        void LightCullingClustersPass::CompileResources(const RHI::FrameGraphCompileContext& context)
+        {
+            AZ_Assert(m_shaderResourceGroup != nullptr, "LightCullingClustersPass %s has a null shader resource group when calling CompileResources.", GetPathName().GetCStr());
+
+            GetLightDataFromFeatureProcessor();
+            SetLightDataToSRG();
+            SetConstantDataToSRG();
+
+            BindPassSrg(context, m_shaderResourceGroup);
+
+            m_shaderResourceGroup->Compile();
+        }
+
+        void LightCullingClustersPass::BuildCommandListInternal(const RHI::FrameGraphExecuteContext& context)
+        {
+            RHI::CommandList* commandList = context.GetCommandList();
+
+            SetSrgsForDispatch(commandList);
+
+            // One thread group per cluster
+            const RHI::Size gridSize = GetClusterGridSize();
+            m_dispatchItem.m_arguments.m_direct.m_totalNumberOfThreadsX = gridSize.m_width * m_dispatchItem.m_arguments.m_direct.m_threadsPerGroupX;
+            m_dispatchItem.m_arguments.m_direct.m_totalNumberOfThreadsY = gridSize.m_height * m_dispatchItem.m_arguments.m_direct.m_threadsPerGroupY;
+            m_dispatchItem.m_arguments.m_direct.m_totalNumberOfThreadsZ = LightCulling::NumClusterSlices * m_dispatchItem.m_arguments.m_direct.m_threadsPerGroupZ;
+
+            commandList->Submit(m_dispatchItem);
+        }
+
+        void LightCullingClustersPass::ResetInternal()
+        {
+            m_constantDataIndex.Reset();
+
+            for (auto& elem : m_lightdata)
+            {
+                elem.m_lightBufferIndex.Reset();
+                elem.m_lightBuffer = nullptr;
+                elem.m_lightCountIndex.Reset();
+                elem.m_lightCount = 0;
+            }
+            m_clusterLightList = nullptr;
+        }
+
+        void LightCullingClustersPass::BuildInternal()
+        {
+            CreateClusterLightList();
+            if (m_clusterLightList != nullptr)
+            {
+                AttachBufferToSlot(Name("ClusterLightList"), m_clusterLightList);
+            }
+        }
+
+        void LightCullingClustersPass::GetLightDataFromFeatureProcessor()
+        {
+            const auto simplePointLightFP = m_pipeline->GetScene()->GetFeatureProcessor<SimplePointLightFeatureProcessor>();
+            m_lightdata[eLightTypes_SimplePoint].m_lightBuffer = simplePointLightFP->GetLightBuffer();
+            m_lightdata[eLightTypes_SimplePoint].m_lightCount = simplePointLightFP->GetLightCount();
+
+            const auto simpleSpotLightFP = m_pipeline->GetScene()->GetFeatureProcessor<SimpleSpotLightFeatureProcessor>();
+            m_lightdata[eLightTypes_SimpleSpot].m_lightBuffer = simpleSpotLightFP->GetLightBuffer();
+            m_lightdata[eLightTypes_SimpleSpot].m_lightCount = simpleSpotLightFP->GetLightCount();
+
+            const auto pointLightFP = m_pipeline->GetScene()->GetFeatureProcessor<PointLightFeatureProcessor>();
+            m_lightdata[eLightTypes_Point].m_lightBuffer = pointLightFP->GetLightBuffer();
+            m_lightdata[eLightTypes_Point].m_lightCount = pointLightFP->GetLightCount();
+
+            const auto diskLightFP = m_pipeline->GetScene()->GetFeatureProcessor<DiskLightFeatureProcessor>();
+            m_lightdata[eLightTypes_Disk].m_lightBuffer = diskLightFP->GetLightBuffer();
+            m_lightdata[eLightTypes_Disk].m_lightCount = diskLightFP->GetLightCount();
+
+            const auto capsuleLightFP = m_pipeline->GetScene()->GetFeatureProcessor<CapsuleLightFeatureProcessor>();
+            m_lightdata[eLightTypes_Capsule].m_lightBuffer = capsuleLightFP->GetLightBuffer();
+            m_lightdata[eLightTypes_Capsule].m_lightCount = capsuleLightFP->GetLightCount();
+
+            const auto quadLightFP = m_pipeline->GetScene()->GetFeatureProcessor<QuadLightFeatureProcessor>();
+            m_lightdata[eLightTypes_Quad].m_lightBuffer = quadLightFP->GetLightBuffer();
+            m_lightdata[eLightTypes_Quad].m_lightCount = quadLightFP->GetLightCount();
+        }
+
+        void LightCullingClustersPass::SetLightDataToSRG()
+        {
+            for (auto& elem : m_lightdata)
+            {
+                m_shaderResourceGroup->SetBuffer(elem.m_lightBufferIndex, elem.m_lightBuffer.get());
+                elem.m_lightBufferIndex.AssertValid();
+                m_shaderResourceGroup->SetConstant(elem.m_lightCountIndex, elem.m_lightCount);
+                elem.m_lightCountIndex.AssertValid();
+            }
+        }
+
+        void LightCullingClustersPass::SetConstantDataToSRG()
+        {
+            struct LightCullingClustersConstants
+            {
+                AZStd::array<float, 16> m_worldToView;
+                AZStd::array<float, 4> m_screenUVToRay;
+                AZStd::array<float, 2> m_clusterUvSize;
+                uint32_t m_gridWidth;
+                uint32_t m_gridHeight;
+                float m_sliceScale;
+                float m_sliceBias;
+                float m_farDepth;
+                uint32_t m_padding;
+            } clustersConstants{};
+
+            RPI::ViewPtr view = m_pipeline->GetDefaultView();
+            view->GetWorldToViewMatrix().StoreToRowMajorFloat16(clustersConstants.m_worldToView.data());
+            clustersConstants.m_screenUVToRay = LightCullingPass::GenerateScreenUVToRayConstants(view->GetViewToClipMatrix());
+
+            const RHI::Size resolution = GetDepthBufferResolution();
+            const RHI::Size gridSize = GetClusterGridSize();
+            clustersConstants.m_clusterUvSize[0] = float(LightCulling::ClusterDimX) / float(AZStd::max(resolution.m_width, 1u));
+            clustersConstants.m_clusterUvSize[1] = float(LightCulling::ClusterDimY) / float(AZStd::max(resolution.m_height, 1u));
+            clustersConstants.m_gridWidth = gridSize.m_width;
+            clustersConstants.m_gridHeight = gridSize.m_height;
+
+            // slice = log2(depth) * scale + bias, so the first slice ends at the near plane and the last one starts at MaxClusterSliceDepth
+            const AZStd::array<float, 2> nearFarDepths = ComputeNearFarDepths(view->GetViewToClipMatrix());
+            const float sliceFarDepth = AZStd::max(AZStd::min(MaxClusterSliceDepth, nearFarDepths[1]), nearFarDepths[0] * 2.0f);
+            clustersConstants.m_sliceScale = float(LightCulling::NumClusterSlices) / std::log2(sliceFarDepth / nearFarDepths[0]);
+            clustersConstants.m_sliceBias = -std::log2(nearFarDepths[0]) * clustersConstants.m_sliceScale;
+            clustersConstants.m_farDepth = nearFarDepths[1];
+
+            m_shaderResourceGroup->SetConstant(m_constantDataIndex, clustersConstants);
+        }
+
+        RHI::Size LightCullingClustersPass::GetDepthBufferResolution() const
+        {
+            // Same as LightCullingPass, the size source of the tile light data is the depth buffer
+            const RPI::PassAttachmentBinding* tileDataBinding = FindAttachmentBinding(Name("TileLightData"));
+            if (tileDataBinding == nullptr || tileDataBinding->m_attachment == nullptr || tileDataBinding->m_attachment->m_sizeSource == nullptr)
+            {
+                return RHI::Size();
+            }
+            const RPI::PassAttachmentBinding* sizeSource = tileDataBinding->m_attachment->m_sizeSource;
+            return sizeSource->m_attachment->m_descriptor.m_image.m_size;
+        }
+
+        RHI::Size LightCullingClustersPass::GetClusterGridSize() const
+        {
+            const RHI::Size resolution = GetDepthBufferResolution();
+            return RHI::Size(
+                AZStd::max(1u, (resolution.m_width + LightCulling::ClusterDimX - 1) / LightCulling::ClusterDimX),
+                AZStd::max(1u, (resolution.m_height + LightCulling::ClusterDimY - 1) / LightCulling::ClusterDimY),
+                1);
+        }
+
+        void LightCullingClustersPass::CreateClusterLightList()
+        {
+            const RHI::Size gridSize = GetClusterGridSize();
+            const uint32_t clusterCount = gridSize.m_width * gridSize.m_height * LightCulling::NumClusterSlices;
+
+            RPI::CommonBufferDescriptor desc;
+            desc.m_poolType = RPI::CommonBufferPoolType::ReadWrite;
+            desc.m_bufferName = "ClusterLightList";
+            desc.m_elementSize = sizeof(uint32_t);
+            desc.m_byteCount = (LightCulling::ClusterListHeaderSize + clusterCount * LightCulling::MaxLightsPerCluster) * sizeof(uint32_t);
+            m_clusterLightList = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc);
+            AZ_Assert(m_clusterLightList != nullptr, "Unable to allocate buffer for the cluster light list");
+            if (m_clusterLightList != nullptr)
+            {
+                m_clusterLightList->SetAsStructured<uint32_t>();
+            }
+        }
+    }   // namespace Render
+}   // namespace AZ
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Memory/SystemAllocator.h>
+
+#include <Atom/RHI.Reflect/ShaderResourceGroupLayoutDescriptor.h>
+#include <Atom/RPI.Public/Buffer/Buffer.h>
+#include <Atom/RPI.Public/Pass/ComputePass.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        //! Compute shader that builds the cluster light list.
+        //! Clusters are screen tiles divided into exponential depth slices. Unlike the tiles of LightCullingPass they don't depend on the
+        //! depth buffer, so they are used by the surfaces that aren't in it, like blended transparent surfaces.
+        class LightCullingClustersPass final
+            : public RPI::ComputePass
+        {
+            AZ_RPI_PASS(LightCullingClustersPass);
+
+        public:
+            AZ_RTTI(AZ::Render::LightCullingClustersPass, "{4C2B7E91-3D6A-4F08-A5E2-9B1D7C03F6A4}", RPI::ComputePass);
+            AZ_CLASS_ALLOCATOR(LightCullingClustersPass, SystemAllocator, 0);
+            virtual ~LightCullingClustersPass() = default;
+
+            //! Creates a LightCullingClustersPass
+            static RPI::Ptr<LightCullingClustersPass> Create(const RPI::PassDescriptor& descriptor);
+
+        private:
+            LightCullingClustersPass(const RPI::PassDescriptor& descriptor);
+
+            // Pass behavior overrides...
+            void ResetInternal() override;
+            void BuildInternal() override;
+
+            // Scope producer functions...
+            void CompileResources(const RHI::FrameGraphCompileContext& context) override;
+            void BuildCommandListInternal(const RHI::FrameGraphExecuteContext& context) override;
+
+            void GetLightDataFromFeatureProcessor();
+            void SetLightDataToSRG();
+            void SetConstantDataToSRG();
+
+            // The resolution of the depth buffer the tile light data was built from
+            RHI::Size GetDepthBufferResolution() const;
+            RHI::Size GetClusterGridSize() const;
+            void CreateClusterLightList();
+
+            struct LightTypeData
+            {
+                Data::Instance<RPI::Buffer>     m_lightBuffer;
+                AZ::RHI::ShaderInputNameIndex   m_lightBufferIndex;
+                AZ::RHI::ShaderInputNameIndex   m_lightCountIndex;
+                int m_lightCount = 0;
+            };
+
+            enum LightTypes
+            {
+                eLightTypes_SimplePoint,
+                eLightTypes_SimpleSpot,
+                eLightTypes_Point,
+                eLightTypes_Disk,
+                eLightTypes_Capsule,
+                eLightTypes_Quad,
+                eLightTypes_Count
+            };
+
+            AZStd::array<LightTypeData, eLightTypes_Count> m_lightdata;
+
+            AZ::RHI::ShaderInputNameIndex m_constantDataIndex = "m_constantData";
+
+            Data::Instance<RPI::Buffer> m_clusterLightList;
+        };
+    }   // namespace Render
+}   // namespace AZ
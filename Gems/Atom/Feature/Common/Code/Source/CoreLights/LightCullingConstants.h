@@ -18,6 +18,12 @@ namespace AZ
             const uint32_t TileDimX = 16;
             const uint32_t TileDimY = 16;
             const uint32_t NumBinsPerTile = 32;
+
+            const uint32_t ClusterDimX = 64;
+            const uint32_t ClusterDimY = 64;
+            const uint32_t NumClusterSlices = 16;
+            const uint32_t ClusterListHeaderSize = 4;
+            const uint32_t MaxLightsPerCluster = 256;
         }
     }
 }
@@ -85,8 +85,7 @@ namespace AZ
             planes[PlaneFar].Set(f);
         }
 
-        // given a 0 to 1 screen uv position, these constants can be used to construct a view-space ray to that location
-        static AZStd::array<float, 4> GenerateScreenUVToRayConstants(const AZ::Matrix4x4& viewToClip)
+        AZStd::array<float, 4> LightCullingPass::GenerateScreenUVToRayConstants(const AZ::Matrix4x4& viewToClip)
         {
             AZStd::array<Plane, PlanesNum> planes;
             ViewProjectionMatrixToPlanes(viewToClip, planes);
@@ -7,7 +7,9 @@
  */
 #pragma once
 
+#include <AzCore/Math/Matrix4x4.h>
 #include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/array.h>
 
 #include <Atom/RHI/CommandList.h>
 #include <Atom/RHI/DrawItem.h>
@@ -40,6 +42,9 @@ namespace AZ
                 return Name("LightCullingTemplate");
             }
 
+            //! Given a 0 to 1 screen uv position, the returned constants can be used to construct a view-space ray to that location
+            static AZStd::array<float, 4> GenerateScreenUVToRayConstants(const AZ::Matrix4x4& viewToClip);
+
         private:
 
             LightCullingPass(const RPI::PassDescriptor& descriptor);
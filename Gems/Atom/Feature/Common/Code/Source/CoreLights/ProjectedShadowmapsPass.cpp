@@ -8,7 +8,11 @@
 
 #include <Atom/RHI/DrawListTagRegistry.h>
 #include <Atom/RHI/RHISystemInterface.h>
+#include <Atom/RPI.Public/Image/AttachmentImagePool.h>
+#include <Atom/RPI.Public/Image/ImageSystemInterface.h>
 #include <Atom/RPI.Public/Pass/PassAttachment.h>
+#include <Atom/RPI.Public/Pass/PassUtils.h>
+#include <Atom/RPI.Reflect/Pass/PassName.h>
 #include <Atom/RPI.Reflect/Pass/RasterPassData.h>
 #include <CoreLights/ProjectedShadowmapsPass.h>
 #include <AzCore/std/iterator.h>
@@ -152,6 +156,70 @@ namespace AZ
             return m_atlas;
         }
 
+        void ProjectedShadowmapsPass::UpdateCachedShadowmaps(const AZStd::vector<bool>& shadowmapIsDirty)
+        {
+            // The children are rebuilt before the frame is rendered, and render everything.
+            if (m_updateChildren || m_atlas.GetBaseShadowmapSize() == ShadowmapSize::None ||
+                shadowmapIsDirty.size() != m_sizes.size() || GetChildren().size() != m_sizes.size())
+            {
+                return;
+            }
+
+            AZStd::vector<bool> sliceIsDirty(m_atlas.GetArraySliceCount(), !m_atlasIsCached);
+            for (size_t index = 0; index < m_sizes.size(); ++index)
+            {
+                if (shadowmapIsDirty[index] && m_sizes[index].m_size != ShadowmapSize::None)
+                {
+                    sliceIsDirty[m_atlas.GetOrigin(m_sizes[index].m_shadowIndexInSrg).m_arraySlice] = true;
+                }
+            }
+
+            for (size_t index = 0; index < m_sizes.size(); ++index)
+            {
+                const ShadowmapAtlas::Origin origin = m_atlas.GetOrigin(m_sizes[index].m_shadowIndexInSrg);
+                GetChildren()[index]->SetEnabled(sliceIsDirty[origin.m_arraySlice]);
+            }
+            m_atlasIsCached = true;
+        }
+
+        bool ProjectedShadowmapsPass::IsShadowmapRendered(size_t index) const
+        {
+            return index >= GetChildren().size() || GetChildren()[index]->IsEnabled();
+        }
+
+        void ProjectedShadowmapsPass::UpdateAtlasImage(RPI::PassAttachment& attachment)
+        {
+            RHI::ImageDescriptor& imageDescriptor = attachment.m_descriptor.m_image;
+            const RPI::AttachmentImage* currentImage = azrtti_cast<RPI::AttachmentImage*>(attachment.m_importedResource.get());
+            if (currentImage &&
+                currentImage->GetDescriptor().m_size == imageDescriptor.m_size &&
+                currentImage->GetDescriptor().m_arraySize == imageDescriptor.m_arraySize)
+            {
+                return;
+            }
+
+            Data::Instance<RPI::AttachmentImagePool> pool = RPI::ImageSystemInterface::Get()->GetSystemAttachmentPool();
+            imageDescriptor.m_bindFlags |= RHI::ImageBindFlags::DepthStencil | RHI::ImageBindFlags::ShaderRead;
+
+            // The ImageViewDescriptor must be specified to make sure the frame graph compiler doesn't treat this as a transient image.
+            RHI::ImageViewDescriptor viewDescriptor = RHI::ImageViewDescriptor::Create(imageDescriptor.m_format, 0, 0);
+            viewDescriptor.m_aspectFlags = RHI::ImageAspectFlags::Depth;
+
+            // The full path name is needed so the atlases of different pipelines are not deduplicated.
+            const AZStd::string imageName = RPI::ConcatPassString(GetPathName(), Name("ShadowmapImage"));
+            const RHI::ClearValue clearValue = RHI::ClearValue::CreateDepth(1.f);
+            Data::Instance<RPI::AttachmentImage> atlasImage = RPI::AttachmentImage::Create(*pool.get(), imageDescriptor, Name(imageName), &clearValue, &viewDescriptor);
+            if (!atlasImage)
+            {
+                AZ_Error("ProjectedShadowmapsPass", false, "[ProjectedShadowmapsPass %s] Unable to create the shadowmap atlas image.", GetPathName().GetCStr());
+                return;
+            }
+
+            attachment.m_path = atlasImage->GetAttachmentId();
+            attachment.m_importedResource = atlasImage;
+            m_atlasIsCached = false;
+        }
+
         void ProjectedShadowmapsPass::BuildInternal()
         {
             UpdateChildren();
@@ -169,9 +237,20 @@ namespace AZ
             binding.m_attachment = attachment;
 
             RHI::ImageDescriptor& imageDescriptor = attachment->m_descriptor.m_image;
-            const uint32_t shadowmapWidth = static_cast<uint32_t>(m_atlas.GetBaseShadowmapSize());
+            const uint32_t shadowmapWidth = AZStd::max(static_cast<uint32_t>(m_atlas.GetBaseShadowmapSize()), 1u);
             imageDescriptor.m_size = RHI::Size(shadowmapWidth, shadowmapWidth, 1);
             imageDescriptor.m_arraySize = m_atlas.GetArraySliceCount();
+            if (attachment->m_lifetime == RHI::AttachmentLifetimeType::Imported)
+            {
+                UpdateAtlasImage(*attachment);
+            }
+
+            // The layout of the atlas may have changed, so every shadowmap is rendered again.
+            for (const RPI::Ptr<RPI::Pass>& child : GetChildren())
+            {
+                child->SetEnabled(true);
+            }
+            m_atlasIsCached = false;
 
             Base::BuildInternal();
         }
@@ -62,6 +62,16 @@ namespace AZ
             //! This exposes the shadowmap atlas.
             ShadowmapAtlas& GetShadowmapAtlas();
 
+            //! This enables only the shadowmap passes that have to render this frame, the others keep the content
+            //! the atlas had at the end of the previous frame.
+            //! A slice of the atlas is rendered when one of its shadowmaps is dirty, since the first pass of a slice clears it.
+            //! Everything is rendered after the atlas is rebuilt.
+            //! @param shadowmapIsDirty true for each shadowmap whose content changed, in the order given to UpdateShadowmapSizes().
+            void UpdateCachedShadowmaps(const AZStd::vector<bool>& shadowmapIsDirty);
+
+            //! This returns true if the shadowmap pass of the given shadowmap is rendered this frame.
+            bool IsShadowmapRendered(size_t index) const;
+
         private:
             ProjectedShadowmapsPass() = delete;
             explicit ProjectedShadowmapsPass(const RPI::PassDescriptor& descriptor);
@@ -75,6 +85,9 @@ namespace AZ
 
             void UpdateChildren();
             void SetChildrenCount(size_t count);
+
+            //! The atlas image is imported so that its content persists between frames.
+            void UpdateAtlasImage(RPI::PassAttachment& attachment);
             
             const Name m_slotName{ "Shadowmap" };
             Name m_pipelineViewTagBase;
@@ -85,6 +98,7 @@ namespace AZ
 
             ShadowmapAtlas m_atlas;
             bool m_updateChildren = true;
+            bool m_atlasIsCached = false; //< false until the atlas is rendered once after it is rebuilt
         };
     } // namespace Render
 } // namespace AZ
@@ -17,6 +17,7 @@
 #include <Atom/RPI.Reflect/Material/MaterialAsset.h>
 #include <Atom/RPI.Public/Material/Material.h>
 #include <Atom/RPI.Reflect/Image/StreamingImageAsset.h>
+#include <AzCore/Jobs/JobFunction.h>
 
 namespace AZ
 {
@@ -102,8 +103,8 @@ namespace AZ
         int DecalTextureArray::AddMaterial(const AZ::Data::AssetId materialAssetId)
         {
             AZ_Error("DecalTextureArray", FindMaterial(materialAssetId) == -1, "Adding material when it already exists in the array");
-            // Invalidate the existing texture array, as we need to repack it taking into account the new material.
-            m_textureArrayPacked = nullptr;
+            // The existing texture array stays in use until it is repacked taking into account the new material.
+            m_isPackedTextureStale = true;
 
             MaterialData materialData;
             materialData.m_materialAssetId = materialAssetId;
@@ -142,21 +143,43 @@ namespace AZ
             return GetStreamingImageAsset(materialAsset, AZ::Name(BaseColorTextureMapName)).IsReady();
         }
 
-        AZ::Data::Asset<AZ::RPI::ImageMipChainAsset> DecalTextureArray::BuildPackedMipChainAsset(const size_t numTexturesToCreate)
+        void DecalTextureArray::BuildPackedMipChainAssets(PackJob& packJob)
+        {
+            const RHI::ImageDescriptor& imageDescriptor = packJob.m_imageDescriptor;
+            const uint16_t mipLevels = imageDescriptor.m_mipLevels;
+
+            uint16_t tailMipBegin = 0;
+            while (tailMipBegin + 1 < mipLevels &&
+                AZStd::max(imageDescriptor.m_size.m_width >> tailMipBegin, imageDescriptor.m_size.m_height >> tailMipBegin) > MaxTailMipSize)
+            {
+                ++tailMipBegin;
+            }
+
+            for (uint16_t mipBegin = 0; mipBegin < mipLevels;)
+            {
+                const uint16_t mipEnd = mipBegin < tailMipBegin ? mipBegin + 1 : mipLevels;
+                packJob.m_mipChainAssets.push_back(BuildPackedMipChainAsset(packJob, mipBegin, mipEnd));
+                mipBegin = mipEnd;
+            }
+        }
+
+        AZ::Data::Asset<AZ::RPI::ImageMipChainAsset> DecalTextureArray::BuildPackedMipChainAsset(const PackJob& packJob, const uint16_t mipBegin, const uint16_t mipEnd)
         {
             RPI::ImageMipChainAssetCreator assetCreator;
-            const uint32_t mipLevels = GetNumMipLevels();
+            const RHI::ImageDescriptor& imageDescriptor = packJob.m_imageDescriptor;
 
-            assetCreator.Begin(Data::AssetId(AZ::Uuid::CreateRandom()), mipLevels, aznumeric_cast<uint16_t>(numTexturesToCreate));
+            assetCreator.Begin(Data::AssetId(AZ::Uuid::CreateRandom()), aznumeric_cast<uint16_t>(mipEnd - mipBegin), aznumeric_cast<uint16_t>(packJob.m_sourceImages.size()));
 
-            for (uint32_t mipLevel = 0; mipLevel < mipLevels; ++mipLevel)
+            for (uint16_t mipLevel = mipBegin; mipLevel < mipEnd; ++mipLevel)
             {
-                const auto& layout = GetLayout(mipLevel);
-                assetCreator.BeginMip(layout);
+                RHI::Size mipSize = imageDescriptor.m_size;
+                mipSize.m_width = AZStd::max(mipSize.m_width >> mipLevel, 1u);
+                mipSize.m_height = AZStd::max(mipSize.m_height >> mipLevel, 1u);
+                assetCreator.BeginMip(AZ::RHI::GetImageSubresourceLayout(mipSize, imageDescriptor.m_format));
 
-                for (int i = 0; i < m_materials.array_size(); ++i)
-                {                   
-                    const auto rawData = GetRawImageData(i, mipLevel);
+                for (const auto& sourceImage : packJob.m_sourceImages)
+                {
+                    const auto rawData = sourceImage->GetSubImageData(mipLevel, 0);
                     assetCreator.AddSubImage(rawData.data(), rawData.size());
                 }
 
@@ -179,6 +202,15 @@ namespace AZ
 
         void DecalTextureArray::Pack()
         {
+            if (m_packJob)
+            {
+                if (!m_packJob->m_isComplete)
+                {
+                    return;
+                }
+                FinishPackJob();
+            }
+
             if (!NeedsPacking())
                 return;
 
@@ -188,8 +220,40 @@ namespace AZ
                 return;
             }
 
+            StartPackJob();
+        }
+
+        void DecalTextureArray::StartPackJob()
+        {
             const size_t numTexturesToCreate = m_materials.array_size();
-            const auto mipChainAsset = BuildPackedMipChainAsset(numTexturesToCreate);
+
+            auto packJob = AZStd::make_shared<PackJob>();
+            packJob->m_imageDescriptor = CreatePackedImageDescriptor(aznumeric_cast<uint16_t>(numTexturesToCreate), GetNumMipLevels());
+            packJob->m_sourceImages.reserve(numTexturesToCreate);
+            for (int i = 0; i < m_materials.array_size(); ++i)
+            {
+                packJob->m_sourceImages.push_back(GetSourceImage(i));
+            }
+
+            m_packJob = packJob;
+            m_isPackedTextureStale = false;
+
+            // Free unused memory, the job references the images it needs
+            ClearAssets();
+
+            AZ::Job* job = AZ::CreateJobFunction(
+                [packJob]()
+                {
+                    BuildPackedMipChainAssets(*packJob);
+                    packJob->m_isComplete = true;
+                },
+                true);
+            job->Start();
+        }
+
+        void DecalTextureArray::FinishPackJob()
+        {
+            const PackJob& packJob = *m_packJob;
             RHI::ImageViewDescriptor imageViewDescriptor;
             imageViewDescriptor.m_isArray = true;
 
@@ -197,16 +261,18 @@ namespace AZ
             assetCreator.Begin(Data::AssetId(Uuid::CreateRandom()));
             assetCreator.SetPoolAssetId(GetImagePoolId());
             assetCreator.SetFlags(RPI::StreamingImageFlags::None);
-            assetCreator.SetImageDescriptor(CreatePackedImageDescriptor(aznumeric_cast<uint16_t>(numTexturesToCreate), GetNumMipLevels()));
+            assetCreator.SetImageDescriptor(packJob.m_imageDescriptor);
             assetCreator.SetImageViewDescriptor(imageViewDescriptor);
-            assetCreator.AddMipChainAsset(*mipChainAsset);
+            for (const auto& mipChainAsset : packJob.m_mipChainAssets)
+            {
+                assetCreator.AddMipChainAsset(*mipChainAsset);
+            }
             Data::Asset<RPI::StreamingImageAsset> packedAsset;
             const bool createdOk = assetCreator.End(packedAsset);
             AZ_Error("TextureArrayData", createdOk, "Pack() call failed.");
             m_textureArrayPacked = createdOk ? RPI::StreamingImage::FindOrCreate(packedAsset) : nullptr;
 
-            // Free unused memory
-            ClearAssets();
+            m_packJob = nullptr;
         }
 
         size_t DecalTextureArray::NumMaterials() const
@@ -235,19 +301,7 @@ namespace AZ
             return baseColorAsset->GetImageDescriptor().m_mipLevels;
         }
 
-        RHI::ImageSubresourceLayout DecalTextureArray::GetLayout(int mip) const
-        {
-            AZ_Assert(m_materials.size() > 0, "GetLayout() cannot be called unless at least one material has been added");
-
-            const int iter = m_materials.begin();
-            const auto& descriptor = GetBaseColorImageAsset(m_materials[iter].m_materialAssetData)->GetImageDescriptor();
-            RHI::Size mipSize = descriptor.m_size;
-            mipSize.m_width >>= mip;
-            mipSize.m_height >>= mip;
-            return AZ::RHI::GetImageSubresourceLayout(mipSize, descriptor.m_format);
-        }
-
-        AZStd::array_view<uint8_t> DecalTextureArray::GetRawImageData(int arrayLevel, const int mip) const
+        Data::Asset<RPI::StreamingImageAsset> DecalTextureArray::GetSourceImage(int arrayLevel) const
         {
             // We always want to provide valid data to the AssetCreator for each texture.
             // If this spot in the array is empty, just provide some random image as filler.
@@ -258,9 +312,7 @@ namespace AZ
                 arrayLevel = m_materials.begin();
             }
 
-            const auto image = GetBaseColorImageAsset(m_materials[arrayLevel].m_materialAssetData);
-            const auto srcData = image->GetSubImageData(mip, 0);
-            return srcData;
+            return GetBaseColorImageAsset(m_materials[arrayLevel].m_materialAssetData);
         }
 
         AZ::RHI::Format DecalTextureArray::GetFormat() const
@@ -330,7 +382,7 @@ namespace AZ
             if (m_materials.size() == 0)
                 return false;
 
-            return m_textureArrayPacked == nullptr;
+            return m_isPackedTextureStale;
         }
 
     }
@@ -15,7 +15,9 @@
 #include <Atom/RHI.Reflect/ImageSubresource.h>
 #include <AtomCore/std/containers/array_view.h>
 #include <Atom/RPI.Public/Image/StreamingImage.h>
-
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 
 namespace AZ
 {
@@ -30,6 +32,8 @@ namespace AZ
     {
         //! Helper class used by DecalTextureArrayFeatureProcessor.
         //! Given a set of images (all with the same dimensions and format), it can pack them together into a single textureArray that can be sent to the GPU.
+        //! Packing runs on a job, and the previously packed texture array stays in use until the new one is ready.
+        //! The largest mips of the packed texture array each get their own mip chain, so the streaming controller can evict them.
         class DecalTextureArray : public Data::AssetBus::MultiHandler
         {
         public:
@@ -40,6 +44,8 @@ namespace AZ
 
             AZ::Data::AssetId GetMaterialAssetId(const int index) const;
 
+            //! Starts packing the texture array if materials were added since the last pack, and swaps in the result of a
+            //! previous pack once its job is complete. Must be called regularly until no more packing is needed.
             void Pack();
             const Data::Instance<RPI::StreamingImage>& GetPackedTexture() const;
 
@@ -54,20 +60,37 @@ namespace AZ
                 AZ::Data::Asset<Data::AssetData> m_materialAssetData;
             };
 
+            //! The data shared between a DecalTextureArray and the job packing its images.
+            struct PackJob
+            {
+                RHI::ImageDescriptor m_imageDescriptor;
+                // One image per slot of the texture array, referenced so they stay loaded while the job reads them
+                AZStd::vector<Data::Asset<RPI::StreamingImageAsset>> m_sourceImages;
+                // Output of the job, from the most detailed mip chain to the tail
+                AZStd::vector<Data::Asset<RPI::ImageMipChainAsset>> m_mipChainAssets;
+                AZStd::atomic_bool m_isComplete{ false };
+            };
+
+            // Mips larger than this in either dimension get a mip chain each, the others are packed together in the tail mip chain
+            static constexpr uint32_t MaxTailMipSize = 128;
+
             void OnAssetReady(Data::Asset<Data::AssetData> asset) override;
 
             int FindMaterial(const AZ::Data::AssetId materialAssetId) const;
 
-            // packs the contents of the source images into a texture array readable by the GPU and returns it
-            AZ::Data::Asset<AZ::RPI::ImageMipChainAsset> BuildPackedMipChainAsset(const size_t numTexturesToCreate);
+            void StartPackJob();
+            void FinishPackJob();
+
+            // packs the contents of the source images into the mip chains of a texture array readable by the GPU. Called from the pack job.
+            static void BuildPackedMipChainAssets(PackJob& packJob);
+            static AZ::Data::Asset<AZ::RPI::ImageMipChainAsset> BuildPackedMipChainAsset(const PackJob& packJob, uint16_t mipBegin, uint16_t mipEnd);
 
             RHI::ImageDescriptor CreatePackedImageDescriptor(const uint16_t arraySize, const uint16_t mipLevels) const;
 
             uint16_t GetNumMipLevels() const;
             RHI::Size GetImageDimensions() const;
             RHI::Format GetFormat() const;
-            RHI::ImageSubresourceLayout GetLayout(int mip) const;
-            AZStd::array_view<uint8_t> GetRawImageData(int arrayLevel, int mip) const;
+            Data::Asset<RPI::StreamingImageAsset> GetSourceImage(int arrayLevel) const;
 
             bool AreAllAssetsReady() const;
             bool IsAssetReady(const MaterialData& materialData) const;
@@ -82,7 +105,11 @@ namespace AZ
 
             IndexableList<MaterialData> m_materials;
             Data::Instance<RPI::StreamingImage> m_textureArrayPacked;
-             
+            // Set when a material is added, cleared when a pack including it is started
+            bool m_isPackedTextureStale = false;
+            // The pack in flight, if any
+            AZStd::shared_ptr<PackJob> m_packJob;
+
             AZStd::unordered_set<AZ::Data::AssetId> m_assetsCurrentlyLoading;
         };
 
@@ -148,6 +148,12 @@ namespace AZ
             AZ_PROFILE_FUNCTION(Debug::ProfileCategory::AzRender)
             AZ_UNUSED(packet);
 
+            // Swaps in the texture arrays whose pack job completed, and starts the packs that were waiting for another one to complete
+            if (!m_materialLoadTracker.AreAnyLoadsInFlight())
+            {
+                PackTexureArrays();
+            }
+
             if (m_deviceBufferNeedsUpdate)
             {
                 [[maybe_unused]] bool success = m_decalBufferHandler.UpdateBuffer(m_decalData.GetDataVector());
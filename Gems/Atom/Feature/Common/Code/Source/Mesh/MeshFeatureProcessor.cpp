@@ -14,7 +14,9 @@
 #include <Atom/Feature/Mesh/MeshFeatureProcessor.h>
 #include <Atom/Feature/ReflectionProbe/ReflectionProbeFeatureProcessor.h>
 #include <Atom/RPI.Public/Model/ModelLodUtils.h>
+#include <Atom/RPI.Public/RenderPipeline.h>
 #include <Atom/RPI.Public/Scene.h>
+#include <Atom/RPI.Public/Pass/ParentPass.h>
 #include <Atom/RPI.Public/Culling.h>
 #include <Atom/Utils/StableDynamicArray.h>
 
@@ -59,6 +61,9 @@ namespace AZ
             };
             RPI::ShaderSystemInterface::Get()->Connect(m_handleGlobalShaderOptionUpdate);
             EnableSceneNotification();
+
+            m_indirectDraw.Activate(GetParentScene());
+            UpdateIndirectCullingPassAvailable();
         }
 
         void MeshFeatureProcessor::Deactivate()
@@ -69,6 +74,7 @@ namespace AZ
             AZ_Warning("MeshFeatureProcessor", m_meshData.size() == 0,
                 "Deactivaing the MeshFeatureProcessor, but there are still outstanding mesh handles.\n"
             );
+            m_indirectDraw.Deactivate();
             m_transformService = nullptr;
             m_forceRebuildDrawPackets = false;
         }
@@ -111,6 +117,13 @@ namespace AZ
                         // to check every one.
                         meshDataIter->UpdateDrawPackets(m_forceRebuildDrawPackets);
 
+                        // swap the lods that finished uploading back in place of their fallback
+                        if (meshDataIter->m_pendingLodUploadCount > 0 &&
+                            meshDataIter->GetPendingLodUploadCount() < meshDataIter->m_pendingLodUploadCount)
+                        {
+                            meshDataIter->m_cullableNeedsRebuild = true;
+                        }
+
                         if (meshDataIter->m_cullableNeedsRebuild)
                         {
                             meshDataIter->BuildCullable();
@@ -125,16 +138,66 @@ namespace AZ
 
             m_forceRebuildDrawPackets = false;
 
+            UpdateIndirectDraws();
+
             // CullingSystem::RegisterOrUpdateCullable() is not threadsafe, so need to do those updates in a single thread
             for (MeshDataInstance& meshDataInstance : m_meshData)
             {
-                if (meshDataInstance.m_model && meshDataInstance.m_cullBoundsNeedsUpdate)
+                if (meshDataInstance.m_model && meshDataInstance.m_cullBoundsNeedsUpdate && !meshDataInstance.m_drawIndirect)
                 {
                     meshDataInstance.UpdateCullBounds(m_transformService);
                 }
             }
         }
 
+        void MeshFeatureProcessor::UpdateIndirectDraws()
+        {
+            AZ_PROFILE_FUNCTION(Debug::ProfileCategory::AzRender);
+
+            if (!m_indirectDraw.IsEnabled())
+            {
+                // Give the meshes back to the cpu culling
+                m_indirectDraw.ReleaseBuckets();
+                for (MeshDataInstance& meshDataInstance : m_meshData)
+                {
+                    if (meshDataInstance.m_drawIndirect)
+                    {
+                        meshDataInstance.m_drawIndirect = false;
+                        meshDataInstance.m_cullBoundsNeedsUpdate = true;
+                    }
+                }
+                return;
+            }
+
+            // Meshes are gathered in a single thread so the buckets don't need to be locked
+            m_indirectDraw.BeginInstances();
+            for (MeshDataInstance& meshDataInstance : m_meshData)
+            {
+                const bool drawIndirect = meshDataInstance.m_model && !meshDataInstance.m_cullableNeedsRebuild && m_indirectDraw.AddInstance(meshDataInstance);
+                if (drawIndirect == meshDataInstance.m_drawIndirect)
+                {
+                    continue;
+                }
+
+                meshDataInstance.m_drawIndirect = drawIndirect;
+                if (drawIndirect)
+                {
+                    GetParentScene()->GetCullingScene()->UnregisterCullable(meshDataInstance.m_cullable);
+                }
+                else
+                {
+                    meshDataInstance.m_cullBoundsNeedsUpdate = true;
+                }
+            }
+            m_indirectDraw.EndInstances();
+        }
+
+        void MeshFeatureProcessor::Render(const FeatureProcessor::RenderPacket& packet)
+        {
+            AZ_PROFILE_FUNCTION(Debug::ProfileCategory::AzRender);
+            m_indirectDraw.Render(packet);
+        }
+
         void MeshFeatureProcessor::OnBeginPrepareRender()
         {
             m_meshDataChecker.soft_lock();
@@ -451,14 +514,31 @@ namespace AZ
             m_forceRebuildDrawPackets = true;
         }
 
-        void MeshFeatureProcessor::OnRenderPipelineAdded(RPI::RenderPipelinePtr pipeline)
+        void MeshFeatureProcessor::OnRenderPipelineAdded([[maybe_unused]] RPI::RenderPipelinePtr pipeline)
         {
-            m_forceRebuildDrawPackets = true;;
+            m_forceRebuildDrawPackets = true;
+            UpdateIndirectCullingPassAvailable();
         }
 
-        void MeshFeatureProcessor::OnRenderPipelineRemoved([[maybe_unused]] RPI::RenderPipeline* pipeline)
+        void MeshFeatureProcessor::OnRenderPipelineRemoved(RPI::RenderPipeline* pipeline)
         {
             m_forceRebuildDrawPackets = true;
+            UpdateIndirectCullingPassAvailable(pipeline);
+        }
+
+        void MeshFeatureProcessor::UpdateIndirectCullingPassAvailable(const RPI::RenderPipeline* ignoredPipeline)
+        {
+            bool cullingPassAvailable = false;
+            for (const RPI::RenderPipelinePtr& renderPipeline : GetParentScene()->GetRenderPipelines())
+            {
+                if (renderPipeline.get() != ignoredPipeline && renderPipeline->GetRootPass() &&
+                    renderPipeline->GetRootPass()->FindPassByNameRecursive(Name{ "MeshIndirectCullingPass" }))
+                {
+                    cullingPassAvailable = true;
+                    break;
+                }
+            }
+            m_indirectDraw.SetCullingPassAvailable(cullingPassAvailable);
         }
 
         void MeshFeatureProcessor::UpdateMeshReflectionProbes()
@@ -642,6 +722,10 @@ namespace AZ
 
             m_hasForwardPassIblSpecularMaterial = false;
 
+            // The largest screen coverage the lod is selected for, halved with each lod like in BuildCullable(), so the shader
+            // variants of the detailed lods are loaded before the ones of the coarse lods.
+            const float shaderVariantLoadPriority = 1.0f / static_cast<float>(1u << AZStd::GetMin<size_t>(modelLodIndex, 31));
+
             for (size_t meshIndex = 0; meshIndex < meshCount; ++meshIndex)
             {
                 Data::Instance<RPI::Material> material = modelLod.GetMeshes()[meshIndex].m_material;
@@ -707,6 +791,7 @@ namespace AZ
 
                 drawPacket.SetStencilRef(stencilRef);
                 drawPacket.SetSortKey(m_sortKey);
+                drawPacket.SetShaderVariantLoadPriority(shaderVariantLoadPriority);
                 drawPacket.Update(*m_scene, false);
                 drawPacketListOut.emplace_back(AZStd::move(drawPacket));
             }
@@ -1036,6 +1121,7 @@ namespace AZ
             cullData.m_drawListMask.reset();
 
             const size_t lodCount = lodAssets.size();
+            size_t pendingLodUploadCount = 0;
             for (size_t lodIndex = 0; lodIndex < lodCount; ++lodIndex)
             {
                 //initialize the lod
@@ -1064,8 +1150,24 @@ namespace AZ
                     lod.m_screenCoverageMin = MinimumScreenCoverage;
                 }
 
+                // While the buffers of a lod are still uploading, draw the closest coarser lod that has finished instead.
+                // The last lod is drawn regardless so the mesh never disappears.
+                size_t drawnLodIndex = lodIndex;
+                for (; drawnLodIndex < lodCount - 1; ++drawnLodIndex)
+                {
+                    if (!m_model->GetLods()[drawnLodIndex]->IsUploadPending())
+                    {
+                        break;
+                    }
+                }
+
+                if (drawnLodIndex != lodIndex)
+                {
+                    ++pendingLodUploadCount;
+                }
+
                 lod.m_drawPackets.clear();
-                for (const RPI::MeshDrawPacket& meshDrawPacket : m_drawPacketListsByLod[lodIndex])
+                for (const RPI::MeshDrawPacket& meshDrawPacket : m_drawPacketListsByLod[drawnLodIndex])
                 {
                     const RHI::DrawPacket* rhiDrawPacket = meshDrawPacket.GetRHIDrawPacket();
 
@@ -1091,10 +1193,22 @@ namespace AZ
             m_cullable.SetDebugName(AZ::Name(AZStd::string::format("%s - objectId: %u", m_model->GetModelAsset()->GetName().GetCStr(), m_objectId.GetIndex())));
 #endif
 
+            m_pendingLodUploadCount = pendingLodUploadCount;
             m_cullableNeedsRebuild = false;
             m_cullBoundsNeedsUpdate = true;
         }
 
+        size_t MeshDataInstance::GetPendingLodUploadCount() const
+        {
+            size_t pendingLodUploadCount = 0;
+            const AZStd::array_view<Data::Instance<RPI::ModelLod>>& modelLods = m_model->GetLods();
+            for (size_t lodIndex = 0; lodIndex + 1 < modelLods.size(); ++lodIndex)
+            {
+                pendingLodUploadCount += modelLods[lodIndex]->IsUploadPending() ? 1 : 0;
+            }
+            return pendingLodUploadCount;
+        }
+
         void MeshDataInstance::UpdateCullBounds(const TransformServiceFeatureProcessor* transformService)
         {
             AZ_PROFILE_FUNCTION(Debug::ProfileCategory::AzRender);
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Mesh/MeshIndirectCullingPass.h>
+#include <Mesh/MeshIndirectDraw.h>
+
+#include <Atom/Feature/Mesh/MeshFeatureProcessor.h>
+#include <Atom/RHI/CommandList.h>
+#include <Atom/RPI.Public/RenderPipeline.h>
+#include <Atom/RPI.Public/Scene.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        RPI::Ptr<MeshIndirectCullingPass> MeshIndirectCullingPass::Create(const RPI::PassDescriptor& descriptor)
+        {
+            RPI::Ptr<MeshIndirectCullingPass> pass = aznew MeshIndirectCullingPass(descriptor);
+            return pass;
+        }
+
+        MeshIndirectCullingPass::MeshIndirectCullingPass(const RPI::PassDescriptor& descriptor)
+            : RPI::ComputePass(descriptor)
+        {
+        }
+
+        void MeshIndirectCullingPass::FrameBeginInternal(FramePrepareParams params)
+        {
+            m_indirectDraw = nullptr;
+            m_isDispatching = false;
+
+            RPI::Scene* scene = m_pipeline ? m_pipeline->GetScene() : nullptr;
+            MeshFeatureProcessor* meshFeatureProcessor = scene ? scene->GetFeatureProcessor<MeshFeatureProcessor>() : nullptr;
+            if (meshFeatureProcessor)
+            {
+                m_indirectDraw = &meshFeatureProcessor->GetIndirectDraw();
+                m_isDispatching = m_indirectDraw->AcquireCullingDispatch();
+            }
+
+            if (m_isDispatching)
+            {
+                // One thread per instance and view
+                SetTargetThreadCounts(m_indirectDraw->GetInstanceCount(), m_indirectDraw->GetViewCount(), 1);
+            }
+
+            ComputePass::FrameBeginInternal(params);
+        }
+
+        void MeshIndirectCullingPass::SetupFrameGraphDependencies(RHI::FrameGraphInterface frameGraph)
+        {
+            ComputePass::SetupFrameGraphDependencies(frameGraph);
+
+            if (m_isDispatching)
+            {
+                m_indirectDraw->SetupCullingAttachments(frameGraph);
+            }
+        }
+
+        void MeshIndirectCullingPass::CompileResources(const RHI::FrameGraphCompileContext& context)
+        {
+            if (m_isDispatching && m_shaderResourceGroup)
+            {
+                m_indirectDraw->SetCullingShaderInputs(*m_shaderResourceGroup);
+            }
+
+            ComputePass::CompileResources(context);
+        }
+
+        void MeshIndirectCullingPass::BuildCommandListInternal(const RHI::FrameGraphExecuteContext& context)
+        {
+            if (m_isDispatching)
+            {
+                ComputePass::BuildCommandListInternal(context);
+            }
+        }
+    }   // namespace Render
+}   // namespace AZ
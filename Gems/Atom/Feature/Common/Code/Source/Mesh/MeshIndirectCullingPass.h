@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Memory/SystemAllocator.h>
+
+#include <Atom/RPI.Public/Pass/ComputePass.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        class MeshIndirectDraw;
+
+        //! Culls the instances of the MeshFeatureProcessor's indirect draws against every view and writes the draw arguments
+        //! and instance lists the indirect mesh draws read. It has to run before any pass that draws meshes.
+        class MeshIndirectCullingPass final
+            : public RPI::ComputePass
+        {
+            AZ_RPI_PASS(MeshIndirectCullingPass);
+
+        public:
+            AZ_RTTI(AZ::Render::MeshIndirectCullingPass, "{8B2E4C7A-5D13-4F0B-9C6E-2A7F1D3B8E54}", RPI::ComputePass);
+            AZ_CLASS_ALLOCATOR(MeshIndirectCullingPass, SystemAllocator, 0);
+            virtual ~MeshIndirectCullingPass() = default;
+
+            static RPI::Ptr<MeshIndirectCullingPass> Create(const RPI::PassDescriptor& descriptor);
+
+        private:
+            MeshIndirectCullingPass(const RPI::PassDescriptor& descriptor);
+
+            // Pass behavior overrides...
+            void FrameBeginInternal(FramePrepareParams params) override;
+
+            // RHI::ScopeProducer overrides...
+            void SetupFrameGraphDependencies(RHI::FrameGraphInterface frameGraph) override;
+            void CompileResources(const RHI::FrameGraphCompileContext& context) override;
+            void BuildCommandListInternal(const RHI::FrameGraphExecuteContext& context) override;
+
+            MeshIndirectDraw* m_indirectDraw = nullptr;
+            //! Only one culling pass dispatches per frame when several render pipelines contain one
+            bool m_isDispatching = false;
+        };
+    }   // namespace Render
+}   // namespace AZ
@@ -0,0 +1,847 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Mesh/MeshIndirectDraw.h>
+
+#include <RenderCommon.h>
+
+#include <Atom/Feature/Mesh/MeshFeatureProcessor.h>
+#include <Atom/Feature/TransformService/TransformServiceFeatureProcessor.h>
+#include <Atom/RHI/Factory.h>
+#include <Atom/RHI/FrameGraphAttachmentDatabase.h>
+#include <Atom/RHI/RHISystemInterface.h>
+#include <Atom/RHI.Reflect/BufferScopeAttachmentDescriptor.h>
+#include <Atom/RHI.Reflect/IndirectBufferLayout.h>
+#include <Atom/RPI.Public/Buffer/BufferSystemInterface.h>
+#include <Atom/RPI.Public/Model/ModelLodUtils.h>
+#include <Atom/RPI.Public/Scene.h>
+#include <Atom/RPI.Public/View.h>
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Math/Frustum.h>
+#include <AzCore/std/hash.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        AZ_CVAR(bool, r_meshIndirectDraw, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+            "Merges static meshes that share a model and materials into instanced indirect draws, if their materials support it. "
+            "The instances are culled on the gpu when the render pipeline contains a MeshIndirectCullingPass, and on the cpu otherwise.");
+
+        static const char* IndirectInstancingOptionName = "o_meshIndirectInstancing";
+
+        bool MeshIndirectDraw::BucketKey::operator==(const BucketKey& rhs) const
+        {
+            return m_model == rhs.m_model && m_sortKey == rhs.m_sortKey && m_materials == rhs.m_materials;
+        }
+
+        size_t MeshIndirectDraw::BucketKeyHasher::operator()(const BucketKey& key) const
+        {
+            size_t hash = AZStd::hash<const RPI::Model*>()(key.m_model);
+            AZStd::hash_combine(hash, key.m_sortKey);
+            for (const RPI::Material* material : key.m_materials)
+            {
+                AZStd::hash_combine(hash, material);
+            }
+            return hash;
+        }
+
+        void MeshIndirectDraw::Activate(RPI::Scene* scene)
+        {
+            m_scene = scene;
+            m_transformService = m_scene->GetFeatureProcessor<TransformServiceFeatureProcessor>();
+
+            RHI::Device* device = RHI::RHISystemInterface::Get()->GetDevice();
+            if (device->GetFeatures().m_indirectCommandTier != RHI::IndirectCommandTiers::Tier0)
+            {
+                RHI::IndirectBufferLayout layout;
+                layout.AddIndirectCommand(RHI::IndirectCommandDescriptor(RHI::IndirectCommandType::DrawIndexed));
+                if (layout.Finalize())
+                {
+                    RHI::IndirectBufferSignatureDescriptor signatureDescriptor;
+                    signatureDescriptor.m_layout = layout;
+
+                    m_indirectSignature = RHI::Factory::Get().CreateIndirectBufferSignature();
+                    if (m_indirectSignature->Init(*device, signatureDescriptor) == RHI::ResultCode::Success)
+                    {
+                        m_indirectByteStride = m_indirectSignature->GetByteStride();
+                        m_indirectCommandOffset = m_indirectSignature->GetOffset(RHI::IndirectCommandIndex(0));
+                    }
+                    else
+                    {
+                        AZ_Warning("MeshIndirectDraw", false, "Failed to create the indirect buffer signature, meshes won't be drawn indirectly.");
+                        m_indirectSignature = nullptr;
+                    }
+                }
+            }
+
+            AZStd::string uuidString = AZ::Uuid::CreateRandom().ToString<AZStd::string>();
+            m_drawArgumentsAttachmentId = RHI::AttachmentId(AZStd::string::format("MeshIndirectDrawArguments_%s", uuidString.c_str()));
+            m_instanceObjectIdsAttachmentId = RHI::AttachmentId(AZStd::string::format("MeshIndirectInstanceObjectIds_%s", uuidString.c_str()));
+
+            // The instance list is bound to the scene srg even when nothing is drawn indirectly, so the shader input is always valid
+            PrepareBuffer(m_instanceObjectIdBuffer, "MeshIndirectInstanceObjectIds", RPI::CommonBufferPoolType::ReadWrite, sizeof(uint32_t), sizeof(uint32_t));
+
+            m_sceneSrg = m_scene->GetShaderResourceGroup();
+            if (m_sceneSrg)
+            {
+                m_sceneInstanceObjectIdsIndex = m_sceneSrg->FindShaderInputBufferIndex(Name{ "m_indirectInstanceObjectIds" });
+            }
+        }
+
+        void MeshIndirectDraw::Deactivate()
+        {
+            ReleaseBuckets();
+
+            if (m_scene)
+            {
+                m_scene->RemoveDrawInputAttachment(m_drawArgumentsAttachmentId);
+                m_scene->RemoveDrawInputAttachment(m_instanceObjectIdsAttachmentId);
+            }
+
+            m_instanceBuffer = nullptr;
+            m_bucketBuffer = nullptr;
+            m_lodBuffer = nullptr;
+            m_viewBuffer = nullptr;
+            m_drawArgumentsBuffer = nullptr;
+            m_instanceObjectIdBuffer = nullptr;
+            m_indirectSignature = nullptr;
+            m_sceneSrg = nullptr;
+            m_transformService = nullptr;
+            m_scene = nullptr;
+        }
+
+        void MeshIndirectDraw::SetCullingPassAvailable(bool cullingPassAvailable)
+        {
+            m_cullingPassAvailable = cullingPassAvailable;
+        }
+
+        bool MeshIndirectDraw::IsEnabled() const
+        {
+            return r_meshIndirectDraw && m_indirectSignature;
+        }
+
+        bool MeshIndirectDraw::UsesGpuCulling() const
+        {
+            return m_cullingPassAvailable;
+        }
+
+        void MeshIndirectDraw::ReleaseBuckets()
+        {
+            m_bucketsByKey.clear();
+            m_buckets.clear();
+            m_instances.clear();
+            m_bucketData.clear();
+            m_lodData.clear();
+            m_drawArgumentsTemplate.clear();
+            m_instanceWorldAabbs.clear();
+            m_lodInstanceCounts.clear();
+            m_instanceObjectIds.clear();
+            m_drawArguments.clear();
+            m_indirectBufferView.reset();
+            m_drawListMask.reset();
+            m_drawCount = 0;
+            m_instanceListStride = 0;
+            m_viewSlotCount = 0;
+            m_frameViewCount = 0;
+            m_bucketsChanged = false;
+        }
+
+        void MeshIndirectDraw::BeginInstances()
+        {
+            m_instances.clear();
+            m_instanceWorldAabbs.clear();
+            m_materialSupportCache.clear();
+            for (AZStd::unique_ptr<Bucket>& bucket : m_buckets)
+            {
+                bucket->m_instanceCount = 0;
+            }
+        }
+
+        bool MeshIndirectDraw::AddInstance(MeshDataInstance& meshData)
+        {
+            if (!IsEligible(meshData))
+            {
+                return false;
+            }
+
+            if (!meshData.m_visible)
+            {
+                // Hidden meshes are still owned by the indirect draws, so they don't show up in the cpu culling either
+                return true;
+            }
+
+            Bucket* bucket = FindOrCreateBucket(meshData);
+            if (!bucket)
+            {
+                return false;
+            }
+
+            const Vector3 center = meshData.m_aabb.GetCenter();
+            const Vector3 extents = 0.5f * meshData.m_aabb.GetExtents();
+
+            InstanceData& instance = m_instances.emplace_back();
+            center.StoreToFloat3(instance.m_aabbCenter);
+            extents.StoreToFloat3(instance.m_aabbExtents);
+            instance.m_objectId = meshData.m_objectId.GetIndex();
+            instance.m_bucketIndex = bucket->m_index;
+            instance.m_lodSelectionRadius = meshData.m_cullable.m_lodData.m_lodSelectionRadius;
+
+            if (!UsesGpuCulling())
+            {
+                // Same bounds as MeshDataInstance::UpdateCullBounds
+                Aabb localAabb = meshData.m_aabb;
+                localAabb.MultiplyByScale(m_transformService->GetNonUniformScaleForId(meshData.m_objectId));
+                m_instanceWorldAabbs.push_back(localAabb.GetTransformedAabb(m_transformService->GetTransformForId(meshData.m_objectId)));
+            }
+
+            ++bucket->m_instanceCount;
+            return true;
+        }
+
+        void MeshIndirectDraw::EndInstances()
+        {
+            AZ_PROFILE_FUNCTION(Debug::ProfileCategory::AzRender);
+
+            // Release the buckets no instance uses anymore
+            AZStd::vector<uint32_t> bucketRemap(m_buckets.size());
+            uint32_t bucketCount = 0;
+            for (size_t bucketIndex = 0; bucketIndex < m_buckets.size(); ++bucketIndex)
+            {
+                if (m_buckets[bucketIndex]->m_instanceCount == 0)
+                {
+                    m_bucketsByKey.erase(m_buckets[bucketIndex]->m_key);
+                    m_buckets[bucketIndex].reset();
+                    m_bucketsChanged = true;
+                    continue;
+                }
+
+                bucketRemap[bucketIndex] = bucketCount;
+                m_buckets[bucketIndex]->m_index = bucketCount;
+                m_buckets[bucketCount++] = AZStd::move(m_buckets[bucketIndex]);
+            }
+
+            if (bucketCount != m_buckets.size())
+            {
+                m_buckets.resize(bucketCount);
+                for (InstanceData& instance : m_instances)
+                {
+                    instance.m_bucketIndex = bucketRemap[instance.m_bucketIndex];
+                }
+            }
+
+            // View slots only ever grow, so a view that shows up every other frame doesn't rebuild every draw packet
+            const uint32_t viewSlotCount = AZStd::clamp(m_requiredViewSlotCount, 1u, MaxViewCount);
+            if (viewSlotCount > m_viewSlotCount)
+            {
+                m_viewSlotCount = viewSlotCount;
+                m_bucketsChanged = true;
+            }
+
+            if (m_bucketsChanged)
+            {
+                m_bucketData.clear();
+                m_lodData.clear();
+                m_drawCount = 0;
+                for (AZStd::unique_ptr<Bucket>& bucket : m_buckets)
+                {
+                    BucketData& bucketData = m_bucketData.emplace_back();
+                    bucketData.m_firstLod = aznumeric_cast<uint32_t>(m_lodData.size());
+                    bucketData.m_lodCount = aznumeric_cast<uint32_t>(bucket->m_lods.size());
+
+                    bucket->m_firstDraw = m_drawCount;
+                    for (const LodInfo& lodInfo : bucket->m_lods)
+                    {
+                        LodData& lodData = m_lodData.emplace_back();
+                        lodData.m_screenCoverageMin = lodInfo.m_screenCoverageMin;
+                        lodData.m_screenCoverageMax = lodInfo.m_screenCoverageMax;
+                        lodData.m_firstDraw = m_drawCount;
+                        lodData.m_drawCount = aznumeric_cast<uint32_t>(lodInfo.m_drawArguments.size());
+                        m_drawCount += lodData.m_drawCount;
+                    }
+                    bucket->m_drawCount = m_drawCount - bucket->m_firstDraw;
+                }
+
+                // Every view slot has its own copy of every draw's arguments
+                const uint64_t drawArgumentsByteCount = AZStd::max<uint64_t>(uint64_t(m_viewSlotCount) * m_drawCount * m_indirectByteStride, m_indirectByteStride);
+                m_drawArgumentsTemplate.clear();
+                m_drawArgumentsTemplate.resize(drawArgumentsByteCount, 0);
+                for (uint32_t viewSlot = 0; viewSlot < m_viewSlotCount; ++viewSlot)
+                {
+                    for (AZStd::unique_ptr<Bucket>& bucket : m_buckets)
+                    {
+                        uint32_t drawIndex = viewSlot * m_drawCount + bucket->m_firstDraw;
+                        for (const LodInfo& lodInfo : bucket->m_lods)
+                        {
+                            for (const RHI::DrawIndexed& drawIndexed : lodInfo.m_drawArguments)
+                            {
+                                // Laid out as DrawIndexedIndirectCommand in IndirectRendering.azsli, with no instances until the culling adds them
+                                const uint32_t command[5] = { drawIndexed.m_indexCount, 0, drawIndexed.m_indexOffset, drawIndexed.m_vertexOffset, 0 };
+                                memcpy(m_drawArgumentsTemplate.data() + drawIndex * m_indirectByteStride + m_indirectCommandOffset, command, sizeof(command));
+                                ++drawIndex;
+                            }
+                        }
+                    }
+                }
+
+                // The draw packets reference the rhi buffer, so they are rebuilt whenever the buffer might have been replaced
+                PrepareBuffer(m_drawArgumentsBuffer, "MeshIndirectDrawArguments", RPI::CommonBufferPoolType::Indirect, m_indirectByteStride, drawArgumentsByteCount);
+                m_indirectBufferView = AZStd::make_unique<RHI::IndirectBufferView>(
+                    *m_drawArgumentsBuffer->GetRHIBuffer(), *m_indirectSignature, 0,
+                    aznumeric_cast<uint32_t>(m_drawArgumentsBuffer->GetBufferSize()), m_indirectByteStride);
+
+                m_drawListMask.reset();
+                for (AZStd::unique_ptr<Bucket>& bucket : m_buckets)
+                {
+                    BuildDrawPackets(*bucket);
+                }
+
+                m_bucketsChanged = false;
+            }
+            else
+            {
+                for (AZStd::unique_ptr<Bucket>& bucket : m_buckets)
+                {
+                    for (AZStd::vector<LodDraws>& viewSlot : bucket->m_viewSlots)
+                    {
+                        for (LodDraws& lodDraws : viewSlot)
+                        {
+                            for (RPI::MeshDrawPacket& drawPacket : lodDraws.m_drawPackets)
+                            {
+                                drawPacket.Update(*m_scene);
+                            }
+                        }
+                    }
+                }
+            }
+
+            UpdateInstanceListOffsets();
+        }
+
+        void MeshIndirectDraw::Render(const RPI::FeatureProcessor::RenderPacket& packet)
+        {
+            AZ_PROFILE_FUNCTION(Debug::ProfileCategory::AzRender);
+
+            m_cullingDispatched = true;
+            m_frameViewCount = 0;
+            m_viewData.clear();
+
+            if (IsEnabled() && !m_instances.empty())
+            {
+                uint32_t drawnViewCount = 0;
+                for (const RPI::ViewPtr& view : packet.m_views)
+                {
+                    if ((view->GetDrawListMask() & m_drawListMask).none())
+                    {
+                        continue;
+                    }
+
+                    ++drawnViewCount;
+                    if (m_viewData.size() >= m_viewSlotCount)
+                    {
+                        continue;
+                    }
+
+                    ViewData& viewData = m_viewData.emplace_back();
+                    const Frustum frustum = Frustum::CreateFromMatrixColumnMajor(view->GetWorldToClipMatrix());
+                    for (uint32_t planeIndex = 0; planeIndex < Frustum::PlaneId::MAX; ++planeIndex)
+                    {
+                        frustum.GetPlane(static_cast<Frustum::PlaneId>(planeIndex)).GetPlaneEquationCoefficients().StoreToFloat4(viewData.m_frustumPlanes[planeIndex]);
+                    }
+
+                    // Same lod metric as the cpu culling, see ModelLodUtils::ApproxScreenPercentage
+                    const Matrix4x4& viewToClip = view->GetViewToClipMatrix();
+                    viewData.m_yScale = viewToClip.GetElement(1, 1) * RPI::ModelLodUtils::GetLodScreenCoverageScale();
+                    viewData.m_isPerspective = viewToClip.GetElement(3, 3) == 0.0f ? 1 : 0;
+                    view->GetViewToWorldMatrix().GetTranslation().StoreToFloat3(viewData.m_cameraPosition);
+
+                    const size_t viewSlot = m_viewData.size() - 1;
+                    for (AZStd::unique_ptr<Bucket>& bucket : m_buckets)
+                    {
+                        for (const LodDraws& lodDraws : bucket->m_viewSlots[viewSlot])
+                        {
+                            for (const RPI::MeshDrawPacket& drawPacket : lodDraws.m_drawPackets)
+                            {
+                                if (const RHI::DrawPacket* rhiDrawPacket = drawPacket.GetRHIDrawPacket())
+                                {
+                                    view->AddDrawPacket(rhiDrawPacket);
+                                }
+                            }
+                        }
+                    }
+                }
+
+                AZ_Warning("MeshIndirectDraw", m_reportedViewOverflow || drawnViewCount <= MaxViewCount,
+                    "%u views are drawing meshes, but indirect meshes can only be drawn in %u views.", drawnViewCount, MaxViewCount);
+                m_reportedViewOverflow |= drawnViewCount > MaxViewCount;
+                m_requiredViewSlotCount = AZStd::min(drawnViewCount, MaxViewCount);
+                m_frameViewCount = aznumeric_cast<uint32_t>(m_viewData.size());
+            }
+
+            if (m_frameViewCount > 0)
+            {
+                const uint64_t instanceListByteCount = uint64_t(m_frameViewCount) * m_instanceListStride * sizeof(uint32_t);
+                const uint64_t drawArgumentsByteCount = uint64_t(m_frameViewCount) * m_drawCount * m_indirectByteStride;
+                PrepareBuffer(m_instanceObjectIdBuffer, "MeshIndirectInstanceObjectIds", RPI::CommonBufferPoolType::ReadWrite, sizeof(uint32_t), instanceListByteCount);
+
+                if (UsesGpuCulling())
+                {
+                    PrepareBuffer(m_instanceBuffer, "MeshIndirectInstances", RPI::CommonBufferPoolType::ReadOnly, sizeof(InstanceData), m_instances.size() * sizeof(InstanceData));
+                    m_instanceBuffer->UpdateData(m_instances.data(), m_instances.size() * sizeof(InstanceData));
+
+                    PrepareBuffer(m_bucketBuffer, "MeshIndirectBuckets", RPI::CommonBufferPoolType::ReadOnly, sizeof(BucketData), m_bucketData.size() * sizeof(BucketData));
+                    m_bucketBuffer->UpdateData(m_bucketData.data(), m_bucketData.size() * sizeof(BucketData));
+
+                    PrepareBuffer(m_lodBuffer, "MeshIndirectLods", RPI::CommonBufferPoolType::ReadOnly, sizeof(LodData), m_lodData.size() * sizeof(LodData));
+                    m_lodBuffer->UpdateData(m_lodData.data(), m_lodData.size() * sizeof(LodData));
+
+                    PrepareBuffer(m_viewBuffer, "MeshIndirectViews", RPI::CommonBufferPoolType::ReadOnly, sizeof(ViewData), m_viewData.size() * sizeof(ViewData));
+                    m_viewBuffer->UpdateData(m_viewData.data(), m_viewData.size() * sizeof(ViewData));
+
+                    // Reset the instance counts the culling pass accumulates into
+                    m_drawArgumentsBuffer->UpdateData(m_drawArgumentsTemplate.data(), drawArgumentsByteCount);
+
+                    UpdateDrawInputAttachments();
+                    m_cullingDispatched = false;
+                }
+                else
+                {
+                    CullInstances();
+                    m_drawArgumentsBuffer->UpdateData(m_drawArguments.data(), drawArgumentsByteCount);
+                    m_instanceObjectIdBuffer->UpdateData(m_instanceObjectIds.data(), instanceListByteCount);
+                }
+            }
+
+            if (m_sceneSrg && m_sceneInstanceObjectIdsIndex.IsValid())
+            {
+                m_sceneSrg->SetBufferView(m_sceneInstanceObjectIdsIndex, m_instanceObjectIdBuffer->GetBufferView());
+            }
+        }
+
+        bool MeshIndirectDraw::AcquireCullingDispatch()
+        {
+            if (m_cullingDispatched)
+            {
+                return false;
+            }
+
+            m_cullingDispatched = true;
+            return true;
+        }
+
+        uint32_t MeshIndirectDraw::GetInstanceCount() const
+        {
+            return aznumeric_cast<uint32_t>(m_instances.size());
+        }
+
+        uint32_t MeshIndirectDraw::GetViewCount() const
+        {
+            return m_frameViewCount;
+        }
+
+        void MeshIndirectDraw::SetupCullingAttachments(RHI::FrameGraphInterface frameGraph)
+        {
+            auto useBuffer = [&frameGraph](const RHI::AttachmentId& attachmentId, const Data::Instance<RPI::Buffer>& buffer, const RHI::BufferViewDescriptor& viewDescriptor)
+            {
+                if (!frameGraph.GetAttachmentDatabase().IsAttachmentValid(attachmentId))
+                {
+                    [[maybe_unused]] RHI::ResultCode result = frameGraph.GetAttachmentDatabase().ImportBuffer(attachmentId, buffer->GetRHIBuffer());
+                    AZ_Assert(result == RHI::ResultCode::Success, "Failed to import mesh indirect draw buffer with error %d", result);
+                }
+
+                RHI::BufferScopeAttachmentDescriptor descriptor;
+                descriptor.m_attachmentId = attachmentId;
+                descriptor.m_bufferViewDescriptor = viewDescriptor;
+                descriptor.m_loadStoreAction.m_loadAction = RHI::AttachmentLoadAction::Load;
+                frameGraph.UseShaderAttachment(descriptor, RHI::ScopeAttachmentAccess::ReadWrite);
+            };
+
+            useBuffer(m_drawArgumentsAttachmentId, m_drawArgumentsBuffer, GetDrawArgumentsViewDescriptor());
+            useBuffer(m_instanceObjectIdsAttachmentId, m_instanceObjectIdBuffer, m_instanceObjectIdBuffer->GetBufferViewDescriptor());
+        }
+
+        void MeshIndirectDraw::SetCullingShaderInputs(RPI::ShaderResourceGroup& passSrg)
+        {
+            RHI::ShaderInputNameIndex instancesIndex = "m_instances";
+            RHI::ShaderInputNameIndex bucketsIndex = "m_buckets";
+            RHI::ShaderInputNameIndex lodsIndex = "m_lods";
+            RHI::ShaderInputNameIndex viewsIndex = "m_views";
+            RHI::ShaderInputNameIndex drawArgumentsIndex = "m_drawArguments";
+            RHI::ShaderInputNameIndex instanceObjectIdsIndex = "m_instanceObjectIds";
+            RHI::ShaderInputNameIndex instanceCountIndex = "m_instanceCount";
+            RHI::ShaderInputNameIndex viewCountIndex = "m_viewCount";
+            RHI::ShaderInputNameIndex drawCountIndex = "m_drawCount";
+            RHI::ShaderInputNameIndex instanceListStrideIndex = "m_instanceListStride";
+            RHI::ShaderInputNameIndex drawArgumentsStrideIndex = "m_drawArgumentsStride";
+            RHI::ShaderInputNameIndex drawArgumentsOffsetIndex = "m_drawArgumentsOffset";
+
+            passSrg.SetBufferView(instancesIndex, m_instanceBuffer->GetBufferView());
+            passSrg.SetBufferView(bucketsIndex, m_bucketBuffer->GetBufferView());
+            passSrg.SetBufferView(lodsIndex, m_lodBuffer->GetBufferView());
+            passSrg.SetBufferView(viewsIndex, m_viewBuffer->GetBufferView());
+
+            // The draw arguments are written with atomics through a raw view
+            RHI::Buffer* drawArgumentsBuffer = m_drawArgumentsBuffer->GetRHIBuffer();
+            passSrg.SetBufferView(drawArgumentsIndex,
+                drawArgumentsBuffer->GetBufferView(GetDrawArgumentsViewDescriptor()).get());
+            passSrg.SetBufferView(instanceObjectIdsIndex, m_instanceObjectIdBuffer->GetBufferView());
+
+            passSrg.SetConstant(instanceCountIndex, GetInstanceCount());
+            passSrg.SetConstant(viewCountIndex, m_frameViewCount);
+            passSrg.SetConstant(drawCountIndex, m_drawCount);
+            passSrg.SetConstant(instanceListStrideIndex, m_instanceListStride);
+            passSrg.SetConstant(drawArgumentsStrideIndex, m_indirectByteStride);
+            passSrg.SetConstant(drawArgumentsOffsetIndex, m_indirectCommandOffset);
+        }
+
+        void MeshIndirectDraw::CullInstances()
+        {
+            AZ_PROFILE_FUNCTION(Debug::ProfileCategory::AzRender);
+
+            // Same culling and lod selection as MeshIndirectCulling.azsl
+            const size_t lodCount = m_lodData.size();
+            m_lodInstanceCounts.clear();
+            m_lodInstanceCounts.resize(m_frameViewCount * lodCount, 0);
+            m_instanceObjectIds.resize_no_construct(m_frameViewCount * m_instanceListStride);
+
+            for (uint32_t viewIndex = 0; viewIndex < m_frameViewCount; ++viewIndex)
+            {
+                const ViewData& view = m_viewData[viewIndex];
+                const Vector3 cameraPosition = Vector3::CreateFromFloat3(view.m_cameraPosition);
+                uint32_t* lodInstanceCounts = m_lodInstanceCounts.data() + viewIndex * lodCount;
+                uint32_t* instanceObjectIds = m_instanceObjectIds.data() + viewIndex * m_instanceListStride;
+
+                for (size_t instanceIndex = 0; instanceIndex < m_instances.size(); ++instanceIndex)
+                {
+                    const InstanceData& instance = m_instances[instanceIndex];
+                    const Vector3 center = m_instanceWorldAabbs[instanceIndex].GetCenter();
+                    const Vector3 extents = 0.5f * m_instanceWorldAabbs[instanceIndex].GetExtents();
+
+                    bool isOutside = false;
+                    for (uint32_t planeIndex = 0; planeIndex < Frustum::PlaneId::MAX && !isOutside; ++planeIndex)
+                    {
+                        const Vector4 plane = Vector4::CreateFromFloat4(view.m_frustumPlanes[planeIndex]);
+                        const Vector3 normal = plane.GetAsVector3();
+                        isOutside = normal.Dot(center) + plane.GetW() + normal.GetAbs().Dot(extents) < 0.0f;
+                    }
+                    if (isOutside)
+                    {
+                        continue;
+                    }
+
+                    const float screenPercentage = RPI::ModelLodUtils::ApproxScreenPercentage(
+                        center, instance.m_lodSelectionRadius, cameraPosition, view.m_yScale, view.m_isPerspective != 0);
+
+                    const BucketData& bucket = m_bucketData[instance.m_bucketIndex];
+                    for (uint32_t lodIndex = bucket.m_firstLod; lodIndex < bucket.m_firstLod + bucket.m_lodCount; ++lodIndex)
+                    {
+                        const LodData& lod = m_lodData[lodIndex];
+                        if (screenPercentage >= lod.m_screenCoverageMin && screenPercentage <= lod.m_screenCoverageMax && lod.m_drawCount > 0)
+                        {
+                            instanceObjectIds[lod.m_instanceOffset + lodInstanceCounts[lodIndex]++] = instance.m_objectId;
+                        }
+                    }
+                }
+            }
+
+            const size_t drawArgumentsByteCount = size_t(m_frameViewCount) * m_drawCount * m_indirectByteStride;
+            m_drawArguments.resize_no_construct(drawArgumentsByteCount);
+            memcpy(m_drawArguments.data(), m_drawArgumentsTemplate.data(), drawArgumentsByteCount);
+            for (uint32_t viewIndex = 0; viewIndex < m_frameViewCount; ++viewIndex)
+            {
+                for (size_t lodIndex = 0; lodIndex < lodCount; ++lodIndex)
+                {
+                    const LodData& lod = m_lodData[lodIndex];
+                    const uint32_t instanceCount = m_lodInstanceCounts[viewIndex * lodCount + lodIndex];
+                    for (uint32_t drawIndex = lod.m_firstDraw; drawIndex < lod.m_firstDraw + lod.m_drawCount; ++drawIndex)
+                    {
+                        // m_instanceCount is the second uint of the DrawIndexedIndirectCommand
+                        const size_t instanceCountOffset = (size_t(viewIndex) * m_drawCount + drawIndex) * m_indirectByteStride + m_indirectCommandOffset + sizeof(uint32_t);
+                        memcpy(m_drawArguments.data() + instanceCountOffset, &instanceCount, sizeof(uint32_t));
+                    }
+                }
+            }
+        }
+
+        RHI::BufferViewDescriptor MeshIndirectDraw::GetDrawArgumentsViewDescriptor() const
+        {
+            return RHI::BufferViewDescriptor::CreateRaw(0, aznumeric_cast<uint32_t>(m_drawArgumentsBuffer->GetBufferSize()));
+        }
+
+        void MeshIndirectDraw::UpdateDrawInputAttachments()
+        {
+            // Re-added every frame since the buffers, and so their views, change size as the scene grows.
+            // The raster passes use them as draw inputs once the culling pass has imported them.
+            RPI::Scene::DrawInputAttachment drawArgumentsInput;
+            drawArgumentsInput.m_attachmentId = m_drawArgumentsAttachmentId;
+            drawArgumentsInput.m_bufferViewDescriptor = GetDrawArgumentsViewDescriptor();
+            drawArgumentsInput.m_usage = RHI::ScopeAttachmentUsage::Indirect;
+            m_scene->AddDrawInputAttachment(drawArgumentsInput);
+
+            RPI::Scene::DrawInputAttachment instanceObjectIdsInput;
+            instanceObjectIdsInput.m_attachmentId = m_instanceObjectIdsAttachmentId;
+            instanceObjectIdsInput.m_bufferViewDescriptor = m_instanceObjectIdBuffer->GetBufferViewDescriptor();
+            instanceObjectIdsInput.m_usage = RHI::ScopeAttachmentUsage::Shader;
+            m_scene->AddDrawInputAttachment(instanceObjectIdsInput);
+        }
+
+        bool MeshIndirectDraw::IsEligible(MeshDataInstance& meshData)
+        {
+            if (!meshData.m_model || !meshData.m_shaderResourceGroup || !meshData.m_aabb.IsValid())
+            {
+                return false;
+            }
+
+            // The indirect draws don't support per mesh reflection probes, lod overrides or view exclusions
+            if (meshData.m_descriptor.m_useForwardPassIblSpecular || meshData.m_hasForwardPassIblSpecularMaterial ||
+                meshData.m_excludeFromReflectionCubeMaps || meshData.m_cullable.m_lodData.m_lodOverride != RPI::Cullable::NoLodOverride)
+            {
+                return false;
+            }
+
+            const size_t lodCount = meshData.m_model->GetLodCount();
+            if (meshData.m_drawPacketListsByLod.size() != lodCount || meshData.m_cullable.m_lodData.m_lods.size() != lodCount)
+            {
+                return false;
+            }
+
+            for (const auto& materialAssignment : meshData.m_materialAssignments)
+            {
+                if (!materialAssignment.second.m_matModUvOverrides.empty())
+                {
+                    return false;
+                }
+            }
+
+            for (size_t lodIndex = 0; lodIndex < lodCount; ++lodIndex)
+            {
+                const RPI::ModelLod& modelLod = *meshData.m_model->GetLods()[lodIndex];
+                MeshDataInstance::DrawPacketList& drawPacketList = meshData.m_drawPacketListsByLod[lodIndex];
+
+                // Every submesh needs a draw packet, otherwise the draw packets can't be matched to the submeshes
+                if (drawPacketList.size() != modelLod.GetMeshes().size())
+                {
+                    return false;
+                }
+
+                for (size_t meshIndex = 0; meshIndex < drawPacketList.size(); ++meshIndex)
+                {
+                    if (modelLod.GetMeshes()[meshIndex].m_drawArguments.m_type != RHI::DrawType::Indexed)
+                    {
+                        return false;
+                    }
+
+                    Data::Instance<RPI::Material> material = drawPacketList[meshIndex].GetMaterial();
+                    if (!material || !SupportsIndirectInstancing(*material))
+                    {
+                        return false;
+                    }
+                }
+            }
+
+            return true;
+        }
+
+        bool MeshIndirectDraw::SupportsIndirectInstancing(const RPI::Material& material)
+        {
+            auto cacheIter = m_materialSupportCache.find(&material);
+            if (cacheIter != m_materialSupportCache.end())
+            {
+                return cacheIter->second;
+            }
+
+            const Name optionName{ IndirectInstancingOptionName };
+            bool supportsIndirectInstancing = true;
+            for (const RPI::ShaderCollection::Item& shaderItem : material.GetShaderCollection())
+            {
+                if (!shaderItem.IsEnabled())
+                {
+                    continue;
+                }
+
+                RPI::ShaderOptionIndex index = shaderItem.GetShaderOptions()->GetShaderOptionLayout()->FindShaderOptionIndex(optionName);
+                if (!index.IsValid() || shaderItem.MaterialOwnsShaderOption(index))
+                {
+                    supportsIndirectInstancing = false;
+                    break;
+                }
+            }
+
+            m_materialSupportCache.emplace(&material, supportsIndirectInstancing);
+            return supportsIndirectInstancing;
+        }
+
+        MeshIndirectDraw::Bucket* MeshIndirectDraw::FindOrCreateBucket(MeshDataInstance& meshData)
+        {
+            m_scratchKey.m_model = meshData.m_model.get();
+            m_scratchKey.m_sortKey = meshData.m_sortKey;
+            m_scratchKey.m_materials.clear();
+            for (MeshDataInstance::DrawPacketList& drawPacketList : meshData.m_drawPacketListsByLod)
+            {
+                for (RPI::MeshDrawPacket& drawPacket : drawPacketList)
+                {
+                    m_scratchKey.m_materials.push_back(drawPacket.GetMaterial().get());
+                }
+            }
+
+            auto bucketIter = m_bucketsByKey.find(m_scratchKey);
+            if (bucketIter != m_bucketsByKey.end())
+            {
+                return bucketIter->second;
+            }
+
+            AZStd::unique_ptr<Bucket> bucket = AZStd::make_unique<Bucket>();
+            bucket->m_key = m_scratchKey;
+            bucket->m_index = aznumeric_cast<uint32_t>(m_buckets.size());
+            bucket->m_model = meshData.m_model;
+            bucket->m_sortKey = meshData.m_sortKey;
+
+            const size_t lodCount = meshData.m_model->GetLodCount();
+            bucket->m_lods.resize(lodCount);
+            for (size_t lodIndex = 0; lodIndex < lodCount; ++lodIndex)
+            {
+                const RPI::Cullable::LodData::Lod& cullableLod = meshData.m_cullable.m_lodData.m_lods[lodIndex];
+                LodInfo& lodInfo = bucket->m_lods[lodIndex];
+                lodInfo.m_screenCoverageMin = cullableLod.m_screenCoverageMin;
+                lodInfo.m_screenCoverageMax = cullableLod.m_screenCoverageMax;
+
+                const RPI::ModelLod& modelLod = *meshData.m_model->GetLods()[lodIndex];
+                MeshDataInstance::DrawPacketList& drawPacketList = meshData.m_drawPacketListsByLod[lodIndex];
+                for (size_t meshIndex = 0; meshIndex < drawPacketList.size(); ++meshIndex)
+                {
+                    lodInfo.m_materials.push_back(drawPacketList[meshIndex].GetMaterial());
+                    lodInfo.m_drawArguments.push_back(modelLod.GetMeshes()[meshIndex].m_drawArguments.m_indexed);
+                }
+            }
+
+            Bucket* bucketPtr = bucket.get();
+            m_bucketsByKey.emplace(bucket->m_key, bucketPtr);
+            m_buckets.emplace_back(AZStd::move(bucket));
+            m_bucketsChanged = true;
+            return bucketPtr;
+        }
+
+        void MeshIndirectDraw::BuildDrawPackets(Bucket& bucket)
+        {
+            AZ_PROFILE_FUNCTION(Debug::ProfileCategory::AzRender);
+
+            // Same stencil bits as MeshDataInstance::BuildDrawPacketList, meshes with forward pass IBL specular aren't drawn indirectly
+            const uint8_t stencilRef = Render::StencilRefs::UseIBLSpecularPass | Render::StencilRefs::UseDiffuseGIPass;
+
+            bucket.m_viewSlots.clear();
+            bucket.m_viewSlots.resize(m_viewSlotCount);
+            for (uint32_t viewSlot = 0; viewSlot < m_viewSlotCount; ++viewSlot)
+            {
+                AZStd::vector<LodDraws>& lodDrawsList = bucket.m_viewSlots[viewSlot];
+                lodDrawsList.resize(bucket.m_lods.size());
+
+                uint32_t drawIndex = viewSlot * m_drawCount + bucket.m_firstDraw;
+                for (size_t lodIndex = 0; lodIndex < bucket.m_lods.size(); ++lodIndex)
+                {
+                    const LodInfo& lodInfo = bucket.m_lods[lodIndex];
+                    LodDraws& lodDraws = lodDrawsList[lodIndex];
+                    RPI::ModelLod& modelLod = *bucket.m_model->GetLods()[lodIndex];
+
+                    for (size_t meshIndex = 0; meshIndex < lodInfo.m_materials.size(); ++meshIndex, ++drawIndex)
+                    {
+                        const Data::Instance<RPI::Material>& material = lodInfo.m_materials[meshIndex];
+
+                        // All materials of a mesh use the same ObjectSrg layout, see MeshDataInstance::BuildDrawPacketList
+                        if (!lodDraws.m_objectSrg)
+                        {
+                            auto& objectSrgLayout = material->GetAsset()->GetObjectSrgLayout();
+                            auto& shaderAsset = material->GetAsset()->GetMaterialTypeAsset()->GetShaderAssetForObjectSrg();
+                            lodDraws.m_objectSrg = RPI::ShaderResourceGroup::Create(shaderAsset, objectSrgLayout->GetName());
+                            if (!lodDraws.m_objectSrg)
+                            {
+                                AZ_Warning("MeshIndirectDraw", false, "Failed to create a new shader resource group, skipping.");
+                                break;
+                            }
+                        }
+
+                        RPI::MeshDrawPacket drawPacket(modelLod, meshIndex, material, lodDraws.m_objectSrg);
+                        drawPacket.SetShaderOption(Name{ IndirectInstancingOptionName }, RPI::ShaderOptionValue{ true });
+                        drawPacket.SetIndirectArguments(RHI::DrawIndirect(1, *m_indirectBufferView, uint64_t(drawIndex) * m_indirectByteStride));
+                        drawPacket.SetStencilRef(stencilRef);
+                        drawPacket.SetSortKey(bucket.m_sortKey);
+                        drawPacket.Update(*m_scene, true);
+
+                        if (const RHI::DrawPacket* rhiDrawPacket = drawPacket.GetRHIDrawPacket())
+                        {
+                            m_drawListMask |= rhiDrawPacket->GetDrawListMask();
+                        }
+                        lodDraws.m_drawPackets.emplace_back(AZStd::move(drawPacket));
+                    }
+
+                    lodDraws.m_instanceListOffset = InvalidInstanceListOffset;
+                }
+            }
+        }
+
+        void MeshIndirectDraw::UpdateInstanceListOffsets()
+        {
+            // Every view has an instance list for each lod of each bucket, sized for all of the bucket's instances
+            m_instanceListStride = 0;
+            for (AZStd::unique_ptr<Bucket>& bucket : m_buckets)
+            {
+                bucket->m_instanceOffset = m_instanceListStride;
+
+                const BucketData& bucketData = m_bucketData[bucket->m_index];
+                for (uint32_t lodIndex = 0; lodIndex < bucketData.m_lodCount; ++lodIndex)
+                {
+                    m_lodData[bucketData.m_firstLod + lodIndex].m_instanceOffset = m_instanceListStride;
+                    m_instanceListStride += bucket->m_instanceCount;
+                }
+            }
+
+            RHI::ShaderInputNameIndex objectIdIndex = "m_objectId";
+            for (AZStd::unique_ptr<Bucket>& bucket : m_buckets)
+            {
+                const BucketData& bucketData = m_bucketData[bucket->m_index];
+                for (uint32_t viewSlot = 0; viewSlot < bucket->m_viewSlots.size(); ++viewSlot)
+                {
+                    for (uint32_t lodIndex = 0; lodIndex < bucket->m_viewSlots[viewSlot].size(); ++lodIndex)
+                    {
+                        LodDraws& lodDraws = bucket->m_viewSlots[viewSlot][lodIndex];
+                        const uint32_t instanceListOffset = viewSlot * m_instanceListStride + m_lodData[bucketData.m_firstLod + lodIndex].m_instanceOffset;
+                        if (lodDraws.m_objectSrg && lodDraws.m_instanceListOffset != instanceListOffset)
+                        {
+                            objectIdIndex.Reset();
+                            lodDraws.m_objectSrg->SetConstant(objectIdIndex, instanceListOffset);
+                            lodDraws.m_objectSrg->Compile();
+                            lodDraws.m_instanceListOffset = instanceListOffset;
+                        }
+                    }
+                }
+            }
+        }
+
+        void MeshIndirectDraw::PrepareBuffer(
+            Data::Instance<RPI::Buffer>& buffer, const char* bufferName, RPI::CommonBufferPoolType poolType, uint32_t elementSize, uint64_t byteCount)
+        {
+            // Grow by powers of two, like the TransformServiceFeatureProcessor's buffers
+            const uint64_t elementCount = RHI::NextPowerOfTwo(AZStd::max<uint64_t>(1, (byteCount + elementSize - 1) / elementSize));
+            const uint64_t bufferByteCount = elementCount * elementSize;
+
+            if (!buffer)
+            {
+                RPI::CommonBufferDescriptor descriptor;
+                descriptor.m_poolType = poolType;
+                descriptor.m_bufferName = bufferName;
+                descriptor.m_byteCount = bufferByteCount;
+                descriptor.m_elementSize = elementSize;
+                buffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(descriptor);
+            }
+            else if (bufferByteCount > buffer->GetBufferSize())
+            {
+                buffer->Resize(bufferByteCount);
+            }
+        }
+    } // namespace Render
+} // namespace AZ
@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/RHI/FrameGraphInterface.h>
+#include <Atom/RHI/IndirectBufferSignature.h>
+#include <Atom/RHI/IndirectBufferView.h>
+#include <Atom/RHI.Reflect/AttachmentId.h>
+#include <Atom/RHI.Reflect/BufferViewDescriptor.h>
+#include <Atom/RPI.Public/Buffer/Buffer.h>
+#include <Atom/RPI.Public/FeatureProcessor.h>
+#include <Atom/RPI.Public/MeshDrawPacket.h>
+#include <Atom/RPI.Public/Model/Model.h>
+#include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AZ
+{
+    namespace Render
+    {
+        class MeshDataInstance;
+        class TransformServiceFeatureProcessor;
+
+        //! Draws static meshes with instanced indirect draws, one per submesh of every group of identical meshes.
+        //! Meshes that share a model, materials and sort key are gathered into a bucket. Every frame each instance is tested
+        //! against the frustum of every view, its lod is selected, and it is appended to the instance list of that bucket,
+        //! view and lod. Each submesh of a bucket is then drawn with a single instanced indirect draw per view and lod,
+        //! instead of one draw per mesh, and the meshes don't go through the cpu culling at all.
+        //! The culling runs on the gpu in the MeshIndirectCullingPass when a render pipeline contains one, and on the cpu
+        //! in Render otherwise, the draws and instance lists are the same either way.
+        //! Materials opt in through the o_meshIndirectInstancing shader option (see MeshIndirectInstancing.azsli), meshes that
+        //! can't be drawn this way keep using the regular draw packets.
+        class MeshIndirectDraw
+        {
+        public:
+            //! The number of views a frame can draw indirect meshes to. Views beyond this don't draw the indirect meshes.
+            static constexpr uint32_t MaxViewCount = 16;
+
+            MeshIndirectDraw() = default;
+            ~MeshIndirectDraw() = default;
+
+            void Activate(RPI::Scene* scene);
+            void Deactivate();
+
+            //! Sets whether any render pipeline of the scene contains a MeshIndirectCullingPass, the instances are culled on the cpu if none does.
+            void SetCullingPassAvailable(bool cullingPassAvailable);
+
+            //! Returns true if meshes should be drawn indirectly this frame.
+            bool IsEnabled() const;
+
+            //! Releases all buckets, used when indirect drawing is turned off.
+            void ReleaseBuckets();
+
+            //! Gathers the instances drawn this frame. Must be called from a single thread during Simulate.
+            void BeginInstances();
+            //! Adds a mesh to the indirect draws.
+            //! @return true if the mesh is drawn indirectly, false if it has to be drawn with its own draw packets
+            bool AddInstance(MeshDataInstance& meshData);
+            //! Rebuilds the buckets that changed and the draw packets that reference them.
+            void EndInstances();
+
+            //! Uploads the frame's data and submits the draw packets to the views.
+            void Render(const RPI::FeatureProcessor::RenderPacket& packet);
+
+            // Used by the MeshIndirectCullingPass...
+
+            //! Returns true the first time it is called after Render, so the culling is only dispatched once per frame
+            //! when more than one render pipeline contains a culling pass.
+            bool AcquireCullingDispatch();
+            uint32_t GetInstanceCount() const;
+            uint32_t GetViewCount() const;
+            //! Imports the buffers written by the culling pass to the frame graph and declares them as shader outputs.
+            void SetupCullingAttachments(RHI::FrameGraphInterface frameGraph);
+            //! Binds the culling inputs and outputs to the culling pass's shader resource group.
+            void SetCullingShaderInputs(RPI::ShaderResourceGroup& passSrg);
+
+        private:
+            static constexpr uint32_t InvalidInstanceListOffset = AZStd::numeric_limits<uint32_t>::max();
+
+            // These structs match the ones in MeshIndirectCulling.azsl
+            struct InstanceData
+            {
+                float m_aabbCenter[3];
+                uint32_t m_objectId;
+                float m_aabbExtents[3];
+                uint32_t m_bucketIndex;
+                float m_lodSelectionRadius;
+                uint32_t m_padding[3];
+            };
+
+            struct BucketData
+            {
+                uint32_t m_firstLod;
+                uint32_t m_lodCount;
+                uint32_t m_padding[2];
+            };
+
+            struct LodData
+            {
+                float m_screenCoverageMin;
+                float m_screenCoverageMax;
+                uint32_t m_firstDraw;
+                uint32_t m_drawCount;
+                uint32_t m_instanceOffset;
+                uint32_t m_padding[3];
+            };
+
+            struct ViewData
+            {
+                float m_frustumPlanes[6][4];
+                float m_cameraPosition[3];
+                float m_yScale;
+                uint32_t m_isPerspective;
+                uint32_t m_padding[3];
+            };
+
+            //! Identifies meshes which can be drawn with the same draw packets
+            struct BucketKey
+            {
+                const RPI::Model* m_model = nullptr;
+                AZStd::vector<const RPI::Material*> m_materials;
+                RHI::DrawItemSortKey m_sortKey = 0;
+
+                bool operator==(const BucketKey& rhs) const;
+            };
+
+            struct BucketKeyHasher
+            {
+                size_t operator()(const BucketKey& key) const;
+            };
+
+            //! The draws of one lod of a bucket for one view
+            struct LodDraws
+            {
+                //! The ObjectSrg's m_objectId holds the offset of the lod's instance list instead of an object id
+                Data::Instance<RPI::ShaderResourceGroup> m_objectSrg;
+                uint32_t m_instanceListOffset = InvalidInstanceListOffset;
+                AZStd::vector<RPI::MeshDrawPacket> m_drawPackets;
+            };
+
+            struct LodInfo
+            {
+                float m_screenCoverageMin = 0.0f;
+                float m_screenCoverageMax = 1.0f;
+                AZStd::vector<Data::Instance<RPI::Material>> m_materials;
+                AZStd::vector<RHI::DrawIndexed> m_drawArguments;
+            };
+
+            struct Bucket
+            {
+                BucketKey m_key;
+                uint32_t m_index = 0;
+                Data::Instance<RPI::Model> m_model;
+                RHI::DrawItemSortKey m_sortKey = 0;
+                AZStd::vector<LodInfo> m_lods;
+
+                //! Draw lists of every view slot, indexed by [viewSlot][lod]
+                AZStd::vector<AZStd::vector<LodDraws>> m_viewSlots;
+
+                uint32_t m_firstDraw = 0;
+                uint32_t m_drawCount = 0;
+                uint32_t m_instanceCount = 0;
+                uint32_t m_instanceOffset = 0;
+            };
+
+            bool IsEligible(MeshDataInstance& meshData);
+            bool SupportsIndirectInstancing(const RPI::Material& material);
+            Bucket* FindOrCreateBucket(MeshDataInstance& meshData);
+            void BuildDrawPackets(Bucket& bucket);
+            void UpdateInstanceListOffsets();
+            void UpdateDrawInputAttachments();
+            bool UsesGpuCulling() const;
+            //! Fills the instance lists and the draw arguments' instance counts on the cpu, used when there is no culling pass
+            void CullInstances();
+            RHI::BufferViewDescriptor GetDrawArgumentsViewDescriptor() const;
+            void PrepareBuffer(Data::Instance<RPI::Buffer>& buffer, const char* bufferName, RPI::CommonBufferPoolType poolType, uint32_t elementSize, uint64_t byteCount);
+
+            RPI::Scene* m_scene = nullptr;
+            TransformServiceFeatureProcessor* m_transformService = nullptr;
+            RHI::Ptr<RHI::IndirectBufferSignature> m_indirectSignature;
+            uint32_t m_indirectByteStride = 0;
+            uint32_t m_indirectCommandOffset = 0;
+            bool m_cullingPassAvailable = false;
+
+            AZStd::vector<AZStd::unique_ptr<Bucket>> m_buckets;
+            AZStd::unordered_map<BucketKey, Bucket*, BucketKeyHasher> m_bucketsByKey;
+            bool m_bucketsChanged = false;
+            RHI::DrawListMask m_drawListMask;
+
+            //! Reused to look up the bucket of every instance without allocating
+            BucketKey m_scratchKey;
+            //! Whether a material's shaders accept o_meshIndirectInstancing, cleared every frame since materials may change their shaders
+            AZStd::unordered_map<const RPI::Material*, bool> m_materialSupportCache;
+
+            AZStd::vector<InstanceData> m_instances;
+            AZStd::vector<BucketData> m_bucketData;
+            AZStd::vector<LodData> m_lodData;
+            AZStd::vector<ViewData> m_viewData;
+            //! The draw arguments with zero instances, copied over the indirect arguments every frame before the gpu culling
+            AZStd::vector<uint8_t> m_drawArgumentsTemplate;
+
+            // Only used when culling on the cpu...
+            AZStd::vector<Aabb> m_instanceWorldAabbs;
+            AZStd::vector<uint32_t> m_lodInstanceCounts;
+            AZStd::vector<uint32_t> m_instanceObjectIds;
+            AZStd::vector<uint8_t> m_drawArguments;
+
+            uint32_t m_drawCount = 0;
+            uint32_t m_instanceListStride = 0;
+
+            //! The number of views slots the draw packets are built for, and the number of views seen in the last frame
+            uint32_t m_viewSlotCount = 0;
+            uint32_t m_requiredViewSlotCount = 1;
+            uint32_t m_frameViewCount = 0;
+            bool m_cullingDispatched = true;
+            bool m_reportedViewOverflow = false;
+
+            Data::Instance<RPI::Buffer> m_instanceBuffer;
+            Data::Instance<RPI::Buffer> m_bucketBuffer;
+            Data::Instance<RPI::Buffer> m_lodBuffer;
+            Data::Instance<RPI::Buffer> m_viewBuffer;
+            Data::Instance<RPI::Buffer> m_drawArgumentsBuffer;
+            Data::Instance<RPI::Buffer> m_instanceObjectIdBuffer;
+            AZStd::unique_ptr<RHI::IndirectBufferView> m_indirectBufferView;
+
+            RHI::AttachmentId m_drawArgumentsAttachmentId;
+            RHI::AttachmentId m_instanceObjectIdsAttachmentId;
+
+            Data::Instance<RPI::ShaderResourceGroup> m_sceneSrg;
+            RHI::ShaderInputBufferIndex m_sceneInstanceObjectIdsIndex;
+        };
+    } // namespace Render
+} // namespace AZ
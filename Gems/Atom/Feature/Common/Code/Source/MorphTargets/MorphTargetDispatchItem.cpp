@@ -7,16 +7,21 @@
  */
 
 #include <MorphTargets/MorphTargetDispatchItem.h>
+#include <SkinnedMesh/SkinnedMeshDispatchItem.h>
 #include <SkinnedMesh/SkinnedMeshFeatureProcessor.h>
 
 #include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
 #include <Atom/RPI.Public/Shader/Shader.h>
 #include <Atom/RPI.Public/Model/ModelLod.h>
 #include <Atom/RPI.Public/Buffer/Buffer.h>
+#include <Atom/RPI.Public/Buffer/BufferSystemInterface.h>
 
 #include <Atom/RHI/Factory.h>
 #include <Atom/RHI/BufferView.h>
 
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/algorithm.h>
+
 #include <limits>
 
 namespace AZ
@@ -25,12 +30,12 @@ namespace AZ
     {
         MorphTargetDispatchItem::MorphTargetDispatchItem(
             const AZStd::intrusive_ptr<MorphTargetInputBuffers> inputBuffers,
-            const MorphTargetMetaData& morphTargetMetaData,
+            const AZStd::vector<MorphTargetMetaData>& morphTargetMetaDatas,
             SkinnedMeshFeatureProcessor* skinnedMeshFeatureProcessor,
             MorphTargetInstanceMetaData morphInstanceMetaData,
             float morphDeltaIntegerEncoding)
             : m_inputBuffers(inputBuffers)
-            , m_morphTargetMetaData(morphTargetMetaData)
+            , m_morphTargetMetaDatas(morphTargetMetaDatas)
             , m_morphInstanceMetaData(morphInstanceMetaData)
             , m_accumulatedDeltaIntegerEncoding(morphDeltaIntegerEncoding)
         {
@@ -54,7 +59,10 @@ namespace AZ
             AZ::RPI::ShaderOptionGroup shaderOptionGroup = m_morphTargetShader->CreateShaderOptionGroup();
             // In case there are several options you don't care about, it's good practice to initialize them with default values.
             shaderOptionGroup.SetUnspecifiedToDefaultValues();
-            shaderOptionGroup.SetValue(AZ::Name("o_hasColorDeltas"), RPI::ShaderOptionValue{ m_morphTargetMetaData.m_hasColorDeltas });
+            // The color deltas are only read for the morph targets that have them
+            const bool hasColorDeltas = AZStd::any_of(m_morphTargetMetaDatas.begin(), m_morphTargetMetaDatas.end(),
+                [](const MorphTargetMetaData& metaData) { return metaData.m_hasColorDeltas; });
+            shaderOptionGroup.SetValue(AZ::Name("o_hasColorDeltas"), RPI::ShaderOptionValue{ hasColorDeltas });
 
             // Get the shader variant and instance SRG
             RPI::ShaderReloadNotificationBus::Handler::BusConnect(m_morphTargetShader->GetAssetId());
@@ -90,9 +98,8 @@ namespace AZ
                 arguments.m_threadsPerGroupZ = args[2].type() == azrtti_typeid<int>() ? AZStd::any_cast<int>(args[2]) : 1;
             }
 
-            arguments.m_totalNumberOfThreadsX = m_morphTargetMetaData.m_vertexCount;
-            arguments.m_totalNumberOfThreadsY = 1;
             arguments.m_totalNumberOfThreadsZ = 1;
+            UpdateDispatchSize();
 
             return true;
         }
@@ -115,6 +122,26 @@ namespace AZ
             
             m_inputBuffers->SetBufferViewsOnShaderResourceGroup(m_instanceSrg);
 
+            // Large enough for all the morph targets to be active at once
+            if (!m_activeMorphTargetsBuffer)
+            {
+                RPI::CommonBufferDescriptor desc;
+                desc.m_poolType = RPI::CommonBufferPoolType::ReadOnly;
+                desc.m_bufferName = "MorphTargetActiveMorphTargets";
+                desc.m_elementSize = sizeof(ActiveMorphTarget);
+                desc.m_byteCount = AZStd::max<size_t>(m_morphTargetMetaDatas.size(), 1) * sizeof(ActiveMorphTarget);
+                m_activeMorphTargetsBuffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc);
+                if (!m_activeMorphTargetsBuffer)
+                {
+                    AZ_Error("MorphTargetDispatchItem", false, "Failed to create the active morph targets buffer");
+                    return false;
+                }
+            }
+
+            RHI::ShaderInputBufferIndex activeMorphTargetsIndex = m_instanceSrg->FindShaderInputBufferIndex(Name{ "m_activeMorphTargets" });
+            AZ_Error("MorphTargetDispatchItem", activeMorphTargetsIndex.IsValid(), "Failed to find shader input index for 'm_activeMorphTargets' in the morph target compute shader per-instance SRG.");
+            m_instanceSrg->SetBufferView(activeMorphTargetsIndex, m_activeMorphTargetsBuffer->GetBufferView());
+
             m_instanceSrg->Compile();
 
             m_dispatchItem.m_uniqueShaderResourceGroup = m_instanceSrg->GetRHIShaderResourceGroup();
@@ -123,8 +150,12 @@ namespace AZ
 
         void MorphTargetDispatchItem::InitRootConstants(const RHI::ConstantsLayout* rootConstantsLayout)
         {
-            auto vertexCountIndex = rootConstantsLayout->FindShaderInputIndex(AZ::Name{ "s_vertexCount" });
-            AZ_Error("MorphTargetDispatchItem", vertexCountIndex.IsValid(), "Could not find root constant 's_vertexCount' in the shader");
+            m_activeMorphTargetCountIndex = rootConstantsLayout->FindShaderInputIndex(AZ::Name{ "s_activeMorphTargetCount" });
+            AZ_Error("MorphTargetDispatchItem", m_activeMorphTargetCountIndex.IsValid(), "Could not find root constant 's_activeMorphTargetCount' in the shader");
+            m_deltaCountIndex = rootConstantsLayout->FindShaderInputIndex(AZ::Name{ "s_deltaCount" });
+            AZ_Error("MorphTargetDispatchItem", m_deltaCountIndex.IsValid(), "Could not find root constant 's_deltaCount' in the shader");
+            m_totalNumberOfThreadsXIndex = rootConstantsLayout->FindShaderInputIndex(AZ::Name{ "s_totalNumberOfThreadsX" });
+            AZ_Error("MorphTargetDispatchItem", m_totalNumberOfThreadsXIndex.IsValid(), "Could not find root constant 's_totalNumberOfThreadsX' in the shader");
             auto positionOffsetIndex = rootConstantsLayout->FindShaderInputIndex(AZ::Name{ "s_targetPositionOffset" });
             AZ_Error("MorphTargetDispatchItem", positionOffsetIndex.IsValid(), "Could not find root constant 's_targetPositionOffset' in the shader");
             auto normalOffsetIndex = rootConstantsLayout->FindShaderInputIndex(AZ::Name{ "s_targetNormalOffset" });
@@ -135,29 +166,18 @@ namespace AZ
             AZ_Error("MorphTargetDispatchItem", bitangentOffsetIndex.IsValid(), "Could not find root constant 's_targetBitangentOffset' in the shader");
             auto colorOffsetIndex = rootConstantsLayout->FindShaderInputIndex(AZ::Name{ "s_targetColorOffset" });
             AZ_Error("MorphTargetDispatchItem", colorOffsetIndex.IsValid(), "Could not find root constant 's_targetColorOffset' in the shader");
-
-            auto minIndex = rootConstantsLayout->FindShaderInputIndex(AZ::Name{ "s_min" });
-            AZ_Error("MorphTargetDispatchItem", minIndex.IsValid(), "Could not find root constant 's_min' in the shader");
-            auto maxIndex = rootConstantsLayout->FindShaderInputIndex(AZ::Name{ "s_max" });
-            AZ_Error("MorphTargetDispatchItem", maxIndex.IsValid(), "Could not find root constant 's_max' in the shader");
             auto morphDeltaIntegerEncodingIndex = rootConstantsLayout->FindShaderInputIndex(AZ::Name{ "s_accumulatedDeltaIntegerEncoding" });
             AZ_Error("MorphTargetDispatchItem", morphDeltaIntegerEncodingIndex.IsValid(), "Could not find root constant 's_accumulatedDeltaIntegerEncoding' in the shader");
-            m_weightIndex = rootConstantsLayout->FindShaderInputIndex(AZ::Name{ "s_weight" });
-            AZ_Error("MorphTargetDispatchItem", m_weightIndex.IsValid(), "Could not find root constant 's_weight' in the shader");
 
             m_rootConstantData = AZ::RHI::ConstantsData(rootConstantsLayout);
-            m_rootConstantData.SetConstant(minIndex, m_morphTargetMetaData.m_minDelta);
-            m_rootConstantData.SetConstant(maxIndex, m_morphTargetMetaData.m_maxDelta);
             m_rootConstantData.SetConstant(morphDeltaIntegerEncodingIndex, m_accumulatedDeltaIntegerEncoding);
-            m_rootConstantData.SetConstant(m_weightIndex, 0.0f);
-            m_rootConstantData.SetConstant(vertexCountIndex, m_morphTargetMetaData.m_vertexCount);
             // The buffer is using 32-bit integers, so divide the offset by 4 here so it doesn't have to be done in the shader
             m_rootConstantData.SetConstant(positionOffsetIndex, m_morphInstanceMetaData.m_accumulatedPositionDeltaOffsetInBytes / 4);
             m_rootConstantData.SetConstant(normalOffsetIndex, m_morphInstanceMetaData.m_accumulatedNormalDeltaOffsetInBytes / 4);
             m_rootConstantData.SetConstant(tangentOffsetIndex, m_morphInstanceMetaData.m_accumulatedTangentDeltaOffsetInBytes / 4);
             m_rootConstantData.SetConstant(bitangentOffsetIndex, m_morphInstanceMetaData.m_accumulatedBitangentDeltaOffsetInBytes / 4);
 
-            if (m_morphTargetMetaData.m_hasColorDeltas)
+            if (m_morphInstanceMetaData.m_accumulatedColorDeltaOffsetInBytes != MorphTargetConstants::s_invalidDeltaOffset)
             {
                 m_rootConstantData.SetConstant(colorOffsetIndex, m_morphInstanceMetaData.m_accumulatedColorDeltaOffsetInBytes / 4);
             }
@@ -166,15 +186,68 @@ namespace AZ
             m_dispatchItem.m_rootConstants = m_rootConstantData.GetConstantData().data();
         }
 
-        void MorphTargetDispatchItem::SetWeight(float weight)
+        void MorphTargetDispatchItem::SetWeights(const AZStd::vector<float>& weights)
         {
-            m_rootConstantData.SetConstant(m_weightIndex, weight);
-            m_dispatchItem.m_rootConstants = m_rootConstantData.GetConstantData().data();
+            AZ_Assert(weights.size() == m_morphTargetMetaDatas.size(), "MorphTargetDispatchItem - The weights don't align with the morph targets.");
+
+            // Each active morph target gets a contiguous range of threads, one per delta
+            m_activeMorphTargets.clear();
+            m_activeDeltaCount = 0;
+            const size_t morphTargetCount = AZStd::min(weights.size(), m_morphTargetMetaDatas.size());
+            for (size_t morphTargetIndex = 0; morphTargetIndex < morphTargetCount; ++morphTargetIndex)
+            {
+                const float weight = weights[morphTargetIndex];
+                if (std::abs(weight) <= AZ::Constants::FloatEpsilon)
+                {
+                    continue;
+                }
+
+                const MorphTargetMetaData& metaData = m_morphTargetMetaDatas[morphTargetIndex];
+                ActiveMorphTarget activeMorphTarget = {};
+                activeMorphTarget.m_firstDeltaIndex = metaData.m_positionOffset;
+                activeMorphTarget.m_firstThreadIndex = m_activeDeltaCount;
+                activeMorphTarget.m_weight = weight;
+                activeMorphTarget.m_minDelta = metaData.m_minDelta;
+                activeMorphTarget.m_maxDelta = metaData.m_maxDelta;
+                activeMorphTarget.m_hasColorDeltas = metaData.m_hasColorDeltas ? 1 : 0;
+                m_activeMorphTargets.push_back(activeMorphTarget);
+                m_activeDeltaCount += metaData.m_vertexCount;
+            }
+
+            if (!m_activeMorphTargets.empty() && m_activeMorphTargetsBuffer)
+            {
+                m_activeMorphTargetsBuffer->UpdateData(m_activeMorphTargets.data(), m_activeMorphTargets.size() * sizeof(ActiveMorphTarget), 0);
+            }
+
+            UpdateDispatchSize();
+        }
+
+        bool MorphTargetDispatchItem::HasActiveMorphTargets() const
+        {
+            return m_activeDeltaCount > 0;
         }
 
-        float MorphTargetDispatchItem::GetWeight() const
+        void MorphTargetDispatchItem::UpdateDispatchSize()
         {
-            return m_rootConstantData.GetConstant<float>(m_weightIndex);
+            // Like the skinning, the deltas are spread over two dimensions to stay within the dispatch limits
+            uint32_t xThreads = 1;
+            uint32_t yThreads = 1;
+            if (m_activeDeltaCount > 0)
+            {
+                CalculateSkinnedMeshTotalThreadsPerDimension(m_activeDeltaCount, xThreads, yThreads);
+            }
+
+            if (m_rootConstantData.GetConstantData().size() > 0)
+            {
+                m_rootConstantData.SetConstant(m_activeMorphTargetCountIndex, aznumeric_cast<uint32_t>(m_activeMorphTargets.size()));
+                m_rootConstantData.SetConstant(m_deltaCountIndex, m_activeDeltaCount);
+                m_rootConstantData.SetConstant(m_totalNumberOfThreadsXIndex, xThreads);
+                m_dispatchItem.m_rootConstants = m_rootConstantData.GetConstantData().data();
+            }
+
+            auto& arguments = m_dispatchItem.m_arguments.m_direct;
+            arguments.m_totalNumberOfThreadsX = xThreads;
+            arguments.m_totalNumberOfThreadsY = yThreads;
         }
 
         const RHI::DispatchItem& MorphTargetDispatchItem::GetRHIDispatchItem() const
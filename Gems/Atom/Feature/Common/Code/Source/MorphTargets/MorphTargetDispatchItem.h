@@ -35,7 +35,22 @@ namespace AZ
     {
         class SkinnedMeshFeatureProcessor;
 
-        //! Holds and manages an RHI DispatchItem for a specific morph target, and the resources that are needed to build and maintain it.
+        //! A morph target with a non-zero weight, as it is passed to the morph target compute shader
+        //! See MorphTargetSRG.azsli for the corresponding shader struct
+        //! It is 16-byte aligned to work with structured buffers
+        struct ActiveMorphTarget
+        {
+            uint32_t m_firstDeltaIndex;
+            uint32_t m_firstThreadIndex;
+            float m_weight;
+            float m_minDelta;
+            float m_maxDelta;
+            uint32_t m_hasColorDeltas;
+            uint32_t m_pad[2];
+        };
+
+        //! Holds and manages an RHI DispatchItem that accumulates the deltas of all the active morph targets of a skinned mesh lod,
+        //! and the resources that are needed to build and maintain it.
         class MorphTargetDispatchItem
             : private RPI::ShaderReloadNotificationBus::Handler
         {
@@ -43,10 +58,10 @@ namespace AZ
             AZ_CLASS_ALLOCATOR(MorphTargetDispatchItem, AZ::SystemAllocator, 0);
 
             MorphTargetDispatchItem() = delete;
-            //! Create one dispatch item per morph target
+            //! Create one dispatch item per skinned mesh lod with morph targets
             explicit MorphTargetDispatchItem(
                 const AZStd::intrusive_ptr<MorphTargetInputBuffers> inputBuffers,
-                const MorphTargetMetaData& morphTargetMetaData,
+                const AZStd::vector<MorphTargetMetaData>& morphTargetMetaDatas,
                 SkinnedMeshFeatureProcessor* skinnedMeshFeatureProcessor,
                 MorphTargetInstanceMetaData morphInstanceMetaData,
                 float accumulatedDeltaRange
@@ -60,11 +75,16 @@ namespace AZ
 
             const RHI::DispatchItem& GetRHIDispatchItem() const;
 
-            void SetWeight(float weight);
-            float GetWeight() const;
+            //! Set one weight per morph target, in the order of the MorphTargetMetaDatas.
+            //! Only the morph targets with a non-zero weight are dispatched.
+            void SetWeights(const AZStd::vector<float>& weights);
+
+            //! Returns true if any morph target has a non-zero weight
+            bool HasActiveMorphTargets() const;
         private:
             bool InitPerInstanceSRG();
             void InitRootConstants(const RHI::ConstantsLayout* rootConstantsLayout);
+            void UpdateDispatchSize();
 
             // ShaderInstanceNotificationBus::Handler overrides
             void OnShaderReinitialized(const RPI::Shader& shader) override;
@@ -82,8 +102,13 @@ namespace AZ
             // The per-object shader resource group
             Data::Instance<RPI::ShaderResourceGroup> m_instanceSrg;
 
-            // Metadata used to set the root constants for the shader
-            MorphTargetMetaData m_morphTargetMetaData;
+            // Metadata of each morph target, used to fill the active morph targets
+            AZStd::vector<MorphTargetMetaData> m_morphTargetMetaDatas;
+
+            // The morph targets with a non-zero weight, and the buffer they are uploaded to
+            AZStd::vector<ActiveMorphTarget> m_activeMorphTargets;
+            Data::Instance<RPI::Buffer> m_activeMorphTargetsBuffer;
+            uint32_t m_activeDeltaCount = 0;
 
             AZ::RHI::ConstantsData m_rootConstantData;
 
@@ -92,8 +117,10 @@ namespace AZ
             // A conservative value for encoding/decoding the accumulated deltas
             float m_accumulatedDeltaIntegerEncoding;
 
-            // Keep track of the constant index of m_weight since it is updated frequently
-            RHI::ShaderInputConstantIndex m_weightIndex;
+            // Keep track of the constant indices that are updated with the weights
+            RHI::ShaderInputConstantIndex m_activeMorphTargetCountIndex;
+            RHI::ShaderInputConstantIndex m_deltaCountIndex;
+            RHI::ShaderInputConstantIndex m_totalNumberOfThreadsXIndex;
         };
 
         float ComputeMorphTargetIntegerEncoding(const AZStd::vector<MorphTargetMetaData>& morphTargetMetaDatas);
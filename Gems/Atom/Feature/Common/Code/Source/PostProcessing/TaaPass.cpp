@@ -46,8 +46,11 @@ namespace AZ::Render
     {
         struct TaaConstants
         {
-            AZStd::array<uint32_t, 2> m_size = { 1, 1 };
-            AZStd::array<float, 2> m_rcpSize = { 0.0, 0.0 };
+            AZStd::array<uint32_t, 2> m_outputSize = { 1, 1 };
+            AZStd::array<float, 2> m_outputRcpSize = { 0.0, 0.0 };
+
+            AZStd::array<uint32_t, 2> m_inputColorSize = { 1, 1 };
+            AZStd::array<float, 2> m_inputColorRcpSize = { 0.0, 0.0 };
             
             AZStd::array<float, 4> m_weights1 = { 0.0 };
             AZStd::array<float, 4> m_weights2 = { 0.0 };
@@ -55,11 +58,19 @@ namespace AZ::Render
         };
 
         TaaConstants cb;
-        RHI::Size inputSize = m_lastFrameAccumulationBinding->m_attachment->m_descriptor.m_image.m_size;
-        cb.m_size[0] = inputSize.m_width;
-        cb.m_size[1] = inputSize.m_height;
-        cb.m_rcpSize[0] = 1.0f / inputSize.m_width;
-        cb.m_rcpSize[1] = 1.0f / inputSize.m_height;
+        // The accumulation images can be sized larger than the input color (through the size multipliers of the pass template)
+        // to upscale a scene rendered at a lower resolution, so the shader needs both sizes.
+        RHI::Size outputSize = m_lastFrameAccumulationBinding->m_attachment->m_descriptor.m_image.m_size;
+        cb.m_outputSize[0] = outputSize.m_width;
+        cb.m_outputSize[1] = outputSize.m_height;
+        cb.m_outputRcpSize[0] = 1.0f / outputSize.m_width;
+        cb.m_outputRcpSize[1] = 1.0f / outputSize.m_height;
+
+        RHI::Size inputSize = m_inputColorBinding->m_attachment->m_descriptor.m_image.m_size;
+        cb.m_inputColorSize[0] = inputSize.m_width;
+        cb.m_inputColorSize[1] = inputSize.m_height;
+        cb.m_inputColorRcpSize[0] = 1.0f / inputSize.m_width;
+        cb.m_inputColorRcpSize[1] = 1.0f / inputSize.m_height;
         
         Offset jitterOffset = m_subPixelOffsets.at(m_offsetIndex);
         GenerateFilterWeights(Vector2(jitterOffset.m_xOffset, jitterOffset.m_yOffset));
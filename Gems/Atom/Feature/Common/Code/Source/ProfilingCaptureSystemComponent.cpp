@@ -18,15 +18,26 @@
 
 #include <AtomCore/Serialization/Json/JsonUtils.h>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/IO/SystemFile.h>
+#include <AzCore/Memory/AllocationRecords.h>
+#include <AzCore/Memory/AllocatorManager.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/Json/JsonSerializationSettings.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/sort.h>
 
 namespace AZ
 {
     namespace Render
     {
+        AZ_CVAR(uint32_t, r_gpuPassTelemetrySampleInterval, 0, nullptr, ConsoleFunctorFlags::Null,
+            "When not 0, the pass Timestamp telemetry starts with the application and samples once every this many frames.");
+        AZ_CVAR(uint32_t, r_gpuPassTelemetryRingSize, 512, nullptr, ConsoleFunctorFlags::Null,
+            "The number of recent Timestamp samples the pass Timestamp telemetry keeps for each pass.");
+        AZ_CVAR(AZ::CVarFixedString, r_gpuPassTelemetryOutputFile, "", nullptr, ConsoleFunctorFlags::Null,
+            "When set, the pass Timestamp telemetry is saved to this json file when the application shuts down.");
+
         class ProfilingCaptureNotificationBusHandler final
             : public ProfilingCaptureNotificationBus::Handler
             , public AZ::BehaviorEBusHandler
@@ -147,6 +158,41 @@ namespace AZ
             AZStd::vector<CpuProfilingStatisticsSerializerEntry> m_cpuProfilingStatisticsSerializerEntries;
         };
 
+        // Intermediate class to serialize the Cpu continuous capture in the Chrome trace event format,
+        // which can be opened with chrome://tracing or Perfetto.
+        class CpuProfilingTimelineSerializer
+        {
+        public:
+            class TraceEvent
+            {
+            public:
+                AZ_TYPE_INFO(CpuProfilingTimelineSerializer::TraceEvent, "{7E0C6F21-9B4D-4F7A-8E53-2C1D9A6B3F40}");
+                static void Reflect(AZ::ReflectContext* context);
+
+                TraceEvent() = default;
+                TraceEvent(const RHI::CachedTimeRegion& cachedTimeRegion, AZ::u64 threadId);
+
+            private:
+                AZStd::string m_name;
+                AZStd::string m_category;
+                // Complete event, which stores the begin time and the duration in a single event
+                AZStd::string m_phase = "X";
+                double m_timestampInMicroseconds = 0.0;
+                double m_durationInMicroseconds = 0.0;
+                AZ::u64 m_processId = 0;
+                AZ::u64 m_threadId = 0;
+            };
+
+            AZ_TYPE_INFO(CpuProfilingTimelineSerializer, "{B1A4E3D8-5C62-4F0B-9D17-6E8F2A7C4B95}");
+            static void Reflect(AZ::ReflectContext* context);
+
+            CpuProfilingTimelineSerializer() = default;
+            CpuProfilingTimelineSerializer(const RHI::CpuProfiler::TimelineMap& timelineMap);
+
+            AZStd::vector<TraceEvent> m_traceEvents;
+            AZStd::string m_displayTimeUnit = "ms";
+        };
+
         // Intermediate class to serialize benchmark metadata.
         class BenchmarkMetadataSerializer
         {
@@ -175,6 +221,70 @@ namespace AZ
             GpuEntry m_gpuEntry;
         };
 
+        // Intermediate class to serialize the percentiles of the sampled pass' Timestamps.
+        class TimestampTelemetrySerializer
+        {
+        public:
+            class TimestampTelemetryEntry
+            {
+            public:
+                AZ_TYPE_INFO(TimestampTelemetrySerializer::TimestampTelemetryEntry, "{6A1E93C4-2D7B-4F58-B0E6-95C3D8F41A27}");
+                static void Reflect(AZ::ReflectContext* context);
+
+                Name m_passPath;
+                uint32_t m_sampleCount = 0;
+                uint64_t m_minInNanoseconds = 0;
+                uint64_t m_p50InNanoseconds = 0;
+                uint64_t m_p90InNanoseconds = 0;
+                uint64_t m_p99InNanoseconds = 0;
+                uint64_t m_maxInNanoseconds = 0;
+            };
+
+            AZ_TYPE_INFO(TimestampTelemetrySerializer, "{C07B5E82-4F19-4A3D-8C61-E2A9D47B3F05}");
+            static void Reflect(AZ::ReflectContext* context);
+
+            uint32_t m_sampleInterval = 0;
+            AZStd::vector<TimestampTelemetryEntry> m_passEntries;
+        };
+
+        // Intermediate class to serialize the memory usage of every allocator.
+        class MemoryStatisticsSerializer
+        {
+        public:
+            class AllocatorEntry
+            {
+            public:
+                AZ_TYPE_INFO(MemoryStatisticsSerializer::AllocatorEntry, "{5E8B2A47-C3D1-4F96-A07B-81D64E9F2C35}");
+                static void Reflect(AZ::ReflectContext* context);
+
+                AZStd::string m_name;
+                AZ::u64 m_allocatedBytes = 0;
+                AZ::u64 m_capacityBytes = 0;
+                // The following are only known when the allocator has allocation records, see AllocatorManager::SetTrackingMode.
+                bool m_hasRecords = false;
+                AZ::u64 m_peakRequestedBytes = 0;
+                AZ::u64 m_totalAllocationCount = 0;
+            };
+
+            AZ_TYPE_INFO(MemoryStatisticsSerializer, "{9B3F61D2-7A4E-4C58-BD19-E26C05A8F473}");
+            static void Reflect(AZ::ReflectContext* context);
+
+            AZStd::vector<AllocatorEntry> m_allocatorEntries;
+        };
+
+        // Returns the percentile, from 0 to 100, of samples sorted in ascending order.
+        static uint64_t GetSortedSamplesPercentile(const AZStd::vector<uint64_t>& sortedSamples, float percentile)
+        {
+            if (sortedSamples.empty())
+            {
+                return 0;
+            }
+
+            const float clampedPercentile = AZStd::clamp(percentile, 0.0f, 100.0f);
+            const size_t index = static_cast<size_t>(clampedPercentile / 100.0f * static_cast<float>(sortedSamples.size() - 1) + 0.5f);
+            return sortedSamples[index];
+        }
+
         // --- DelayedQueryCaptureHelper ---
 
         bool DelayedQueryCaptureHelper::StartCapture(CaptureCallback&& captureCallback)
@@ -348,6 +458,69 @@ namespace AZ
             }
         }
 
+        // --- CpuProfilingTimelineSerializer ---
+
+        CpuProfilingTimelineSerializer::CpuProfilingTimelineSerializer(const RHI::CpuProfiler::TimelineMap& timelineMap)
+        {
+            for (auto& threadEntry : timelineMap)
+            {
+                const AZ::u64 threadId = AZStd::hash<AZStd::thread_id>{}(threadEntry.first);
+                for (const RHI::CachedTimeRegion& cachedTimeRegion : threadEntry.second)
+                {
+                    m_traceEvents.emplace_back(cachedTimeRegion, threadId);
+                }
+            }
+        }
+
+        void CpuProfilingTimelineSerializer::Reflect(AZ::ReflectContext* context)
+        {
+            if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+            {
+                serializeContext->Class<CpuProfilingTimelineSerializer>()
+                    ->Version(1)
+                    ->Field("traceEvents", &CpuProfilingTimelineSerializer::m_traceEvents)
+                    ->Field("displayTimeUnit", &CpuProfilingTimelineSerializer::m_displayTimeUnit)
+                    ;
+            }
+
+            TraceEvent::Reflect(context);
+        }
+
+        // --- TraceEvent ---
+
+        CpuProfilingTimelineSerializer::TraceEvent::TraceEvent(const RHI::CachedTimeRegion& cachedTimeRegion, AZ::u64 threadId)
+        {
+            // Converts ticks to Microseconds, the time unit of the trace event format
+            static const auto ticksToMicroseconds = [](AZStd::sys_time_t ticks) -> double
+            {
+                const double ticksPerSecond = aznumeric_cast<double>(AZStd::GetTimeTicksPerSecond());
+                return (aznumeric_cast<double>(ticks) * 1000000.0) / ticksPerSecond;
+            };
+
+            m_name = cachedTimeRegion.m_groupRegionName->m_regionName;
+            m_category = cachedTimeRegion.m_groupRegionName->m_groupName;
+            m_timestampInMicroseconds = ticksToMicroseconds(cachedTimeRegion.m_startTick);
+            m_durationInMicroseconds = ticksToMicroseconds(cachedTimeRegion.m_endTick - cachedTimeRegion.m_startTick);
+            m_threadId = threadId;
+        }
+
+        void CpuProfilingTimelineSerializer::TraceEvent::Reflect(AZ::ReflectContext* context)
+        {
+            if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+            {
+                serializeContext->Class<TraceEvent>()
+                    ->Version(1)
+                    ->Field("name", &TraceEvent::m_name)
+                    ->Field("cat", &TraceEvent::m_category)
+                    ->Field("ph", &TraceEvent::m_phase)
+                    ->Field("ts", &TraceEvent::m_timestampInMicroseconds)
+                    ->Field("dur", &TraceEvent::m_durationInMicroseconds)
+                    ->Field("pid", &TraceEvent::m_processId)
+                    ->Field("tid", &TraceEvent::m_threadId)
+                    ;
+            }
+        }
+
         // --- BenchmarkMetadataSerializer ---
 
         BenchmarkMetadataSerializer::BenchmarkMetadataSerializer(const AZStd::string& benchmarkName, const RHI::PhysicalDeviceDescriptor& gpuDescriptor)
@@ -391,6 +564,74 @@ namespace AZ
             }
         }
 
+        // --- MemoryStatisticsSerializer ---
+
+        void MemoryStatisticsSerializer::Reflect(AZ::ReflectContext* context)
+        {
+            if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+            {
+                serializeContext->Class<MemoryStatisticsSerializer>()
+                    ->Version(1)
+                    ->Field("allocatorEntries", &MemoryStatisticsSerializer::m_allocatorEntries)
+                    ;
+            }
+
+            AllocatorEntry::Reflect(context);
+        }
+
+        // --- AllocatorEntry ---
+
+        void MemoryStatisticsSerializer::AllocatorEntry::Reflect(AZ::ReflectContext* context)
+        {
+            if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+            {
+                serializeContext->Class<AllocatorEntry>()
+                    ->Version(1)
+                    ->Field("name", &AllocatorEntry::m_name)
+                    ->Field("allocatedBytes", &AllocatorEntry::m_allocatedBytes)
+                    ->Field("capacityBytes", &AllocatorEntry::m_capacityBytes)
+                    ->Field("hasRecords", &AllocatorEntry::m_hasRecords)
+                    ->Field("peakRequestedBytes", &AllocatorEntry::m_peakRequestedBytes)
+                    ->Field("totalAllocationCount", &AllocatorEntry::m_totalAllocationCount)
+                    ;
+            }
+        }
+
+        // --- TimestampTelemetrySerializer ---
+
+        void TimestampTelemetrySerializer::Reflect(AZ::ReflectContext* context)
+        {
+            if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+            {
+                serializeContext->Class<TimestampTelemetrySerializer>()
+                    ->Version(1)
+                    ->Field("sampleInterval", &TimestampTelemetrySerializer::m_sampleInterval)
+                    ->Field("passEntries", &TimestampTelemetrySerializer::m_passEntries)
+                    ;
+            }
+
+            TimestampTelemetryEntry::Reflect(context);
+        }
+
+        // --- TimestampTelemetryEntry ---
+
+        void TimestampTelemetrySerializer::TimestampTelemetryEntry::Reflect(AZ::ReflectContext* context)
+        {
+            if (auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+            {
+                serializeContext->Class<TimestampTelemetryEntry>()
+                    ->Version(1)
+                    ->Field("passPath", &TimestampTelemetryEntry::m_passPath)
+                    ->Field("sampleCount", &TimestampTelemetryEntry::m_sampleCount)
+                    ->Field("minInNanoseconds", &TimestampTelemetryEntry::m_minInNanoseconds)
+                    ->Field("p50InNanoseconds", &TimestampTelemetryEntry::m_p50InNanoseconds)
+                    ->Field("p90InNanoseconds", &TimestampTelemetryEntry::m_p90InNanoseconds)
+                    ->Field("p99InNanoseconds", &TimestampTelemetryEntry::m_p99InNanoseconds)
+                    ->Field("maxInNanoseconds", &TimestampTelemetryEntry::m_maxInNanoseconds)
+                    ;
+            }
+        }
+
         // --- ProfilingCaptureSystemComponent ---
 
         void ProfilingCaptureSystemComponent::Reflect(AZ::ReflectContext* context)
@@ -410,7 +651,13 @@ namespace AZ
                     ->Event("CapturePassTimestamp", &ProfilingCaptureRequestBus::Events::CapturePassTimestamp)
                     ->Event("CapturePassPipelineStatistics", &ProfilingCaptureRequestBus::Events::CapturePassPipelineStatistics)
                     ->Event("CaptureCpuProfilingStatistics", &ProfilingCaptureRequestBus::Events::CaptureCpuProfilingStatistics)
+                    ->Event("CaptureCpuProfilingTimeline", &ProfilingCaptureRequestBus::Events::CaptureCpuProfilingTimeline)
                     ->Event("CaptureBenchmarkMetadata", &ProfilingCaptureRequestBus::Events::CaptureBenchmarkMetadata)
+                    ->Event("CaptureMemoryStatistics", &ProfilingCaptureRequestBus::Events::CaptureMemoryStatistics)
+                    ->Event("StartPassTimestampTelemetry", &ProfilingCaptureRequestBus::Events::StartPassTimestampTelemetry)
+                    ->Event("StopPassTimestampTelemetry", &ProfilingCaptureRequestBus::Events::StopPassTimestampTelemetry)
+                    ->Event("GetPassTimestampPercentile", &ProfilingCaptureRequestBus::Events::GetPassTimestampPercentile)
+                    ->Event("CapturePassTimestampTelemetry", &ProfilingCaptureRequestBus::Events::CapturePassTimestampTelemetry)
                     ;
 
                 ProfilingCaptureNotificationBusHandler::Reflect(context);
@@ -419,16 +666,33 @@ namespace AZ
             TimestampSerializer::Reflect(context);
             PipelineStatisticsSerializer::Reflect(context);
             CpuProfilingStatisticsSerializer::Reflect(context);
+            CpuProfilingTimelineSerializer::Reflect(context);
             BenchmarkMetadataSerializer::Reflect(context);
+            MemoryStatisticsSerializer::Reflect(context);
+            TimestampTelemetrySerializer::Reflect(context);
         }
 
         void ProfilingCaptureSystemComponent::Activate()
         {
             ProfilingCaptureRequestBus::Handler::BusConnect();
+
+            const uint32_t sampleInterval = r_gpuPassTelemetrySampleInterval;
+            if (sampleInterval > 0)
+            {
+                StartPassTimestampTelemetry(sampleInterval);
+            }
         }
 
         void ProfilingCaptureSystemComponent::Deactivate()
         {
+            const AZ::CVarFixedString outputFilePath = r_gpuPassTelemetryOutputFile;
+            if (!outputFilePath.empty() && !m_passTimestampSamples.empty())
+            {
+                CapturePassTimestampTelemetry(AZStd::string(outputFilePath.c_str()));
+            }
+            m_passTimestampSamples.clear();
+            m_telemetrySampleInterval = 0;
+
             TickBus::Handler::BusDisconnect();
 
             ProfilingCaptureRequestBus::Handler::BusDisconnect();
@@ -466,8 +730,11 @@ namespace AZ
                     AZ_Warning("ProfilingCaptureSystemComponent", false, captureInfo.c_str());
                 }
 
-                // Disable all the Timestamp queries in passes.
-                root->SetTimestampQueryEnabled(false);
+                // Disable all the Timestamp queries in passes, unless the telemetry still samples them.
+                if (m_telemetrySampleInterval == 0)
+                {
+                    root->SetTimestampQueryEnabled(false);
+                }
 
                 // Notify listeners that the pass' Timestamp queries capture has finished.
                 ProfilingCaptureNotificationBus::Broadcast(&ProfilingCaptureNotificationBus::Events::OnCaptureQueryTimestampFinished,
@@ -590,6 +857,34 @@ namespace AZ
             return captureStarted;
         }
 
+        bool ProfilingCaptureSystemComponent::CaptureCpuProfilingTimeline(const AZStd::string& outputFilePath)
+        {
+            // The continuous capture already holds the regions, so they are saved right away instead of waiting for new frames
+            if (!RHI::CpuProfiler::Get()->IsContinuousCaptureEnabled())
+            {
+                AZ_Warning("ProfilingCaptureSystemComponent", false, "The Cpu profiler continuous capture isn't enabled, set r_cpuProfilerContinuousCapture to record the timeline.");
+                return false;
+            }
+
+            JsonSerializerSettings serializationSettings;
+            serializationSettings.m_keepDefaults = true;
+
+            CpuProfilingTimelineSerializer serializer(RHI::CpuProfiler::Get()->GetContinuousCapture());
+            const auto saveResult = JsonSerializationUtils::SaveObjectToFile(&serializer,
+                outputFilePath, (CpuProfilingTimelineSerializer*)nullptr, &serializationSettings);
+
+            if (!saveResult.IsSuccess())
+            {
+                AZ_Warning("ProfilingCaptureSystemComponent", false, "Failed to save Cpu profiling timeline to file '%s'. Error: %s",
+                    outputFilePath.c_str(),
+                    saveResult.GetError().c_str());
+                return false;
+            }
+
+            AZ_Printf("ProfilingCaptureSystemComponent", "Cpu profiling timeline was saved to file [%s]\n", outputFilePath.c_str());
+            return true;
+        }
+
         bool ProfilingCaptureSystemComponent::CaptureBenchmarkMetadata(const AZStd::string& benchmarkName, const AZStd::string& outputFilePath)
         {
             const bool captureStarted = m_benchmarkMetadataCapture.StartCapture([this, benchmarkName, outputFilePath]()
@@ -627,6 +922,196 @@ namespace AZ
             return captureStarted;
         }
 
+        bool ProfilingCaptureSystemComponent::CaptureMemoryStatistics(const AZStd::string& outputFilePath)
+        {
+            MemoryStatisticsSerializer serializer;
+            {
+                AllocatorManager& allocatorManager = AllocatorManager::Instance();
+                auto allocatorLock = allocatorManager.LockAllocators();
+                const int allocatorCount = allocatorManager.GetNumAllocators();
+                serializer.m_allocatorEntries.reserve(allocatorCount);
+                for (int i = 0; i < allocatorCount; ++i)
+                {
+                    IAllocator* allocator = allocatorManager.GetAllocator(i);
+                    if (!allocator->IsReady())
+                    {
+                        continue;
+                    }
+
+                    MemoryStatisticsSerializer::AllocatorEntry& entry = serializer.m_allocatorEntries.emplace_back();
+                    entry.m_name = allocator->GetName();
+                    entry.m_allocatedBytes = allocator->GetSchema()->NumAllocatedBytes();
+                    entry.m_capacityBytes = allocator->GetSchema()->Capacity();
+                    if (const Debug::AllocationRecords* records = allocator->GetRecords())
+                    {
+                        entry.m_hasRecords = true;
+                        entry.m_peakRequestedBytes = records->RequestedBytesPeak();
+                        entry.m_totalAllocationCount = records->RequestedAllocs();
+                    }
+                }
+            }
+
+            // Sorted so the files of separate runs can be compared line by line
+            AZStd::sort(serializer.m_allocatorEntries.begin(), serializer.m_allocatorEntries.end(),
+                [](const MemoryStatisticsSerializer::AllocatorEntry& lhs, const MemoryStatisticsSerializer::AllocatorEntry& rhs)
+                {
+                    return lhs.m_name < rhs.m_name;
+                });
+
+            JsonSerializerSettings serializationSettings;
+            serializationSettings.m_keepDefaults = true;
+
+            const auto saveResult = JsonSerializationUtils::SaveObjectToFile(&serializer,
+                outputFilePath, (MemoryStatisticsSerializer*)nullptr, &serializationSettings);
+
+            if (!saveResult.IsSuccess())
+            {
+                AZ_Warning("ProfilingCaptureSystemComponent", false, "Failed to save memory statistics to file '%s'. Error: %s",
+                    outputFilePath.c_str(),
+                    saveResult.GetError().c_str());
+                return false;
+            }
+
+            AZ_Printf("ProfilingCaptureSystemComponent", "Memory statistics were saved to file [%s]\n", outputFilePath.c_str());
+            return true;
+        }
+
+        bool ProfilingCaptureSystemComponent::StartPassTimestampTelemetry(uint32_t sampleInterval)
+        {
+            if (sampleInterval == 0)
+            {
+                AZ_Warning("ProfilingCaptureSystemComponent", false, "The pass Timestamp telemetry needs a sample interval of at least one frame.");
+                return false;
+            }
+
+            // The queries are enabled when sampling, so the passes created later are sampled too
+            m_telemetrySampleInterval = sampleInterval;
+            m_framesUntilTelemetrySample = sampleInterval;
+            TickBus::Handler::BusConnect();
+            return true;
+        }
+
+        void ProfilingCaptureSystemComponent::StopPassTimestampTelemetry()
+        {
+            if (m_telemetrySampleInterval == 0)
+            {
+                return;
+            }
+
+            m_telemetrySampleInterval = 0;
+            m_passTimestampSamples.clear();
+
+            // Leave the queries to a pending capture, which disables them when it finishes
+            if (m_timestampCapture.IsIdle())
+            {
+                AZStd::vector<RPI::Pass*> passes = FindPasses({ "Root" });
+                if (!passes.empty())
+                {
+                    passes[0]->SetTimestampQueryEnabled(false);
+                }
+            }
+        }
+
+        uint64_t ProfilingCaptureSystemComponent::GetPassTimestampPercentile(const AZStd::string& passPath, float percentile) const
+        {
+            auto samplesIt = m_passTimestampSamples.find(Name(passPath));
+            if (samplesIt == m_passTimestampSamples.end())
+            {
+                return 0;
+            }
+
+            AZStd::vector<uint64_t> sortedSamples = samplesIt->second.m_durationsInNanoseconds;
+            AZStd::sort(sortedSamples.begin(), sortedSamples.end());
+            return GetSortedSamplesPercentile(sortedSamples, percentile);
+        }
+
+        bool ProfilingCaptureSystemComponent::CapturePassTimestampTelemetry(const AZStd::string& outputFilePath)
+        {
+            TimestampTelemetrySerializer serializer;
+            serializer.m_sampleInterval = m_telemetrySampleInterval;
+            serializer.m_passEntries.reserve(m_passTimestampSamples.size());
+
+            AZStd::vector<uint64_t> sortedSamples;
+            for (const auto& [passPath, samples] : m_passTimestampSamples)
+            {
+                sortedSamples = samples.m_durationsInNanoseconds;
+                AZStd::sort(sortedSamples.begin(), sortedSamples.end());
+
+                TimestampTelemetrySerializer::TimestampTelemetryEntry& entry = serializer.m_passEntries.emplace_back();
+                entry.m_passPath = passPath;
+                entry.m_sampleCount = aznumeric_cast<uint32_t>(sortedSamples.size());
+                entry.m_minInNanoseconds = GetSortedSamplesPercentile(sortedSamples, 0.0f);
+                entry.m_p50InNanoseconds = GetSortedSamplesPercentile(sortedSamples, 50.0f);
+                entry.m_p90InNanoseconds = GetSortedSamplesPercentile(sortedSamples, 90.0f);
+                entry.m_p99InNanoseconds = GetSortedSamplesPercentile(sortedSamples, 99.0f);
+                entry.m_maxInNanoseconds = GetSortedSamplesPercentile(sortedSamples, 100.0f);
+            }
+
+            // Sorted so the files of separate runs can be compared line by line
+            AZStd::sort(serializer.m_passEntries.begin(), serializer.m_passEntries.end(),
+                [](const TimestampTelemetrySerializer::TimestampTelemetryEntry& lhs, const TimestampTelemetrySerializer::TimestampTelemetryEntry& rhs)
+                {
+                    return lhs.m_passPath.GetStringView() < rhs.m_passPath.GetStringView();
+                });
+
+            JsonSerializerSettings serializationSettings;
+            serializationSettings.m_keepDefaults = true;
+
+            const auto saveResult = JsonSerializationUtils::SaveObjectToFile(&serializer,
+                outputFilePath, (TimestampTelemetrySerializer*)nullptr, &serializationSettings);
+
+            if (!saveResult.IsSuccess())
+            {
+                AZ_Warning("ProfilingCaptureSystemComponent", false, "Failed to save pass' Timestamp telemetry to file '%s'. Error: %s",
+                    outputFilePath.c_str(),
+                    saveResult.GetError().c_str());
+                return false;
+            }
+
+            AZ_Printf("ProfilingCaptureSystemComponent", "Pass' Timestamp telemetry was saved to file [%s]\n", outputFilePath.c_str());
+            return true;
+        }
+
+        void ProfilingCaptureSystemComponent::UpdatePassTimestampTelemetry()
+        {
+            if (--m_framesUntilTelemetrySample > 0)
+            {
+                return;
+            }
+            m_framesUntilTelemetrySample = m_telemetrySampleInterval;
+
+            AZStd::vector<RPI::Pass*> passes = FindPasses({ "Root" });
+            if (passes.empty())
+            {
+                return;
+            }
+
+            RPI::Pass* root = passes[0];
+            root->SetTimestampQueryEnabled(true);
+
+            const uint32_t ringSize = AZStd::max<uint32_t>(r_gpuPassTelemetryRingSize, 1);
+            for (const RPI::Pass* pass : CollectPassesRecursively(root))
+            {
+                // The results are only available a few frames after the queries were enabled
+                const uint64_t duration = pass->GetLatestTimestampResult().GetDurationInNanoseconds();
+                if (!pass->IsEnabled() || duration == 0)
+                {
+                    continue;
+                }
+
+                PassTimestampSamples& samples = m_passTimestampSamples[pass->GetPathName()];
+                if (samples.m_durationsInNanoseconds.size() < ringSize)
+                {
+                    samples.m_durationsInNanoseconds.push_back(duration);
+                }
+                else
+                {
+                    samples.m_durationsInNanoseconds[samples.m_nextSampleIndex % samples.m_durationsInNanoseconds.size()] = duration;
+                }
+                samples.m_nextSampleIndex = (samples.m_nextSampleIndex + 1) % ringSize;
+            }
+        }
+
         AZStd::vector<const RPI::Pass*> ProfilingCaptureSystemComponent::CollectPassesRecursively(const RPI::Pass* root) const
         {
             AZStd::vector<const RPI::Pass*> passes;
@@ -670,8 +1155,14 @@ namespace AZ
             m_cpuProfilingStatisticsCapture.UpdateCapture();
             m_benchmarkMetadataCapture.UpdateCapture();
 
-            // Disconnect from the TickBus if all capture states are set to idle.
-            if (m_timestampCapture.IsIdle() && m_pipelineStatisticsCapture.IsIdle() && m_cpuProfilingStatisticsCapture.IsIdle() && m_benchmarkMetadataCapture.IsIdle())
+            if (m_telemetrySampleInterval > 0)
+            {
+                UpdatePassTimestampTelemetry();
+            }
+
+            // Disconnect from the TickBus if all capture states are set to idle and the telemetry is stopped.
+            if (m_timestampCapture.IsIdle() && m_pipelineStatisticsCapture.IsIdle() && m_cpuProfilingStatisticsCapture.IsIdle() && m_benchmarkMetadataCapture.IsIdle()
+                && m_telemetrySampleInterval == 0)
             {
                 TickBus::Handler::BusDisconnect();
             }
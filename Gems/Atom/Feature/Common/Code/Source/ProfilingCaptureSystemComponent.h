@@ -10,6 +10,8 @@
 
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Name/Name.h>
+#include <AzCore/std/containers/unordered_map.h>
 
 #include <Atom/Feature/Utils/ProfilingCaptureBus.h>
 
@@ -70,9 +72,22 @@ namespace AZ
             bool CapturePassTimestamp(const AZStd::string& outputFilePath) override;
             bool CapturePassPipelineStatistics(const AZStd::string& outputFilePath) override;
             bool CaptureCpuProfilingStatistics(const AZStd::string& outputFilePath) override;
+            bool CaptureCpuProfilingTimeline(const AZStd::string& outputFilePath) override;
             bool CaptureBenchmarkMetadata(const AZStd::string& benchmarkName, const AZStd::string& outputFilePath) override;
+            bool CaptureMemoryStatistics(const AZStd::string& outputFilePath) override;
+            bool StartPassTimestampTelemetry(uint32_t sampleInterval) override;
+            void StopPassTimestampTelemetry() override;
+            uint64_t GetPassTimestampPercentile(const AZStd::string& passPath, float percentile) const override;
+            bool CapturePassTimestampTelemetry(const AZStd::string& outputFilePath) override;
 
         private:
+            // The most recent Timestamp durations of a pass, stored as a ring.
+            struct PassTimestampSamples
+            {
+                AZStd::vector<uint64_t> m_durationsInNanoseconds;
+                uint32_t m_nextSampleIndex = 0;
+            };
+
             void OnTick(float deltaTime, ScriptTimePoint time) override;
 
             // Recursively collect all the passes from the root pass.
@@ -80,10 +95,18 @@ namespace AZ
 
             AZStd::vector<AZ::RPI::Pass*> FindPasses(AZStd::vector<AZStd::string>&& passHierarchy) const;
 
+            // Records the latest Timestamp of every enabled pass once every m_telemetrySampleInterval frames.
+            void UpdatePassTimestampTelemetry();
+
             DelayedQueryCaptureHelper m_timestampCapture;
             DelayedQueryCaptureHelper m_pipelineStatisticsCapture;
             DelayedQueryCaptureHelper m_cpuProfilingStatisticsCapture;
             DelayedQueryCaptureHelper m_benchmarkMetadataCapture;
+
+            // Pass Timestamp telemetry, keyed by the path name of the passes. It's disabled when the interval is 0.
+            AZStd::unordered_map<Name, PassTimestampSamples> m_passTimestampSamples;
+            uint32_t m_telemetrySampleInterval = 0;
+            uint32_t m_framesUntilTelemetrySample = 0;
         };
     }
 }
@@ -57,6 +57,9 @@ namespace AZ
 
             if (rayTracingFeatureProcessor)
             {
+                // select the meshes whose BLAS objects are built this frame, this changes the revision if any are added to the TLAS
+                rayTracingFeatureProcessor->UpdateBlasBuildList();
+
                 if (rayTracingFeatureProcessor->GetRevision() != m_rayTracingRevision)
                 {
                     RHI::RayTracingBufferPools& rayTracingBufferPools = rayTracingFeatureProcessor->GetBufferPools();
@@ -70,6 +73,12 @@ namespace AZ
                     uint32_t blasIndex = 0;
                     for (auto& rayTracingMesh : rayTracingMeshes)
                     {
+                        // meshes are added to the TLAS once their BLAS objects are built
+                        if (rayTracingMesh.second.m_blasBuilt == false)
+                        {
+                            continue;
+                        }
+
                         for (auto& rayTracingSubMesh : rayTracingMesh.second.m_subMeshes)
                         {
                             tlasDescriptorBuild->Instance()
@@ -129,6 +138,14 @@ namespace AZ
                 return;
             }
 
+            // build the BLAS objects selected for this frame
+            AZStd::vector<RHI::Ptr<RHI::RayTracingBlas>>& blasBuildList = rayTracingFeatureProcessor->GetBlasBuildList();
+            for (const RHI::Ptr<RHI::RayTracingBlas>& blas : blasBuildList)
+            {
+                context.GetCommandList()->BuildBottomLevelAccelerationStructure(*blas);
+            }
+            blasBuildList.clear();
+
             if (!rayTracingFeatureProcessor->GetTlas()->GetTlasBuffer())
             {
                 return;
@@ -149,22 +166,6 @@ namespace AZ
                 return;
             }
 
-            // build newly added BLAS objects
-            // [GFX TODO][ATOM-14159] Add changelist for meshes in the RayTracingFeatureProcessor
-            RayTracingFeatureProcessor::MeshMap& rayTracingMeshes = rayTracingFeatureProcessor->GetMeshes();
-            for (auto& rayTracingMesh : rayTracingMeshes)
-            {
-                if (rayTracingMesh.second.m_blasBuilt == false)
-                {
-                    for (auto& rayTracingSubMesh : rayTracingMesh.second.m_subMeshes)
-                    {
-                        context.GetCommandList()->BuildBottomLevelAccelerationStructure(*rayTracingSubMesh.m_blas);
-                    }
-
-                    rayTracingMesh.second.m_blasBuilt = true;
-                }
-            }
-
             // build the TLAS object
             context.GetCommandList()->BuildTopLevelAccelerationStructure(*rayTracingFeatureProcessor->GetTlas());
         }
@@ -7,6 +7,7 @@
  */
 
 #include <RayTracing/RayTracingFeatureProcessor.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/EventTrace.h>
 #include <Atom/Feature/TransformService/TransformServiceFeatureProcessor.h>
 #include <Atom/RHI/CpuProfiler.h>
@@ -24,6 +25,9 @@
 #include <CoreLights/CapsuleLightFeatureProcessor.h>
 #include <CoreLights/QuadLightFeatureProcessor.h>
 
+AZ_CVAR(uint32_t, r_rayTracingBlasBuildBudget, 1000000, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "Maximum number of triangles in the ray tracing Blas objects built per frame, at least one mesh is built each frame. 0 builds all queued meshes at once.");
+
 namespace AZ
 {
     namespace Render
@@ -97,13 +101,17 @@ namespace AZ
             else
             {
                 // updating an existing entry
-                // decrement the mesh count by the number of meshes in the existing entry in case the number of meshes changed
-                m_subMeshCount -= aznumeric_cast<uint32_t>(itMesh->second.m_subMeshes.size());
-                m_meshes[objectIndex].m_subMeshes = subMeshes;
+                // the new Blas objects need to be built before the mesh is back in the TLAS, so remove its sub-meshes from the count
+                if (itMesh->second.m_blasBuilt)
+                {
+                    m_subMeshCount -= aznumeric_cast<uint32_t>(itMesh->second.m_subMeshes.size());
+                }
+                itMesh->second.m_subMeshes = subMeshes;
+                itMesh->second.m_blasBuilt = false;
             }
 
             // create the BLAS buffers for each sub-mesh
-            // Note: the buffer is just reserved here, the BLAS is built in the RayTracingAccelerationStructurePass
+            // Note: the buffer is just reserved here, the BLAS is queued and built in the RayTracingAccelerationStructurePass
             Mesh& mesh = m_meshes[objectIndex];
             for (auto& subMesh : mesh.m_subMeshes)
             {
@@ -126,8 +134,9 @@ namespace AZ
             mesh.m_transform = m_transformServiceFeatureProcessor->GetTransformForId(objectId);
             mesh.m_nonUniformScale = m_transformServiceFeatureProcessor->GetNonUniformScaleForId(objectId);
 
+            m_blasBuildQueue.push_back(objectIndex);
+
             m_revision++;
-            m_subMeshCount += aznumeric_cast<uint32_t>(subMeshes.size());
 
             m_meshInfoBufferNeedsUpdate = true;
             m_materialInfoBufferNeedsUpdate = true;
@@ -143,7 +152,10 @@ namespace AZ
             MeshMap::iterator itMesh = m_meshes.find(objectId.GetIndex());
             if (itMesh != m_meshes.end())
             {
-                m_subMeshCount -= aznumeric_cast<uint32_t>(itMesh->second.m_subMeshes.size());
+                if (itMesh->second.m_blasBuilt)
+                {
+                    m_subMeshCount -= aznumeric_cast<uint32_t>(itMesh->second.m_subMeshes.size());
+                }
                 m_meshes.erase(itMesh);
                 m_revision++;
             }
@@ -170,6 +182,49 @@ namespace AZ
             m_meshInfoBufferNeedsUpdate = true;
         }
 
+        void RayTracingFeatureProcessor::UpdateBlasBuildList()
+        {
+            uint32_t triangleCount = 0;
+            const uint32_t triangleBudget = r_rayTracingBlasBuildBudget;
+            while (!m_blasBuildQueue.empty())
+            {
+                MeshMap::iterator itMesh = m_meshes.find(m_blasBuildQueue.front());
+                if (itMesh == m_meshes.end() || itMesh->second.m_blasBuilt)
+                {
+                    m_blasBuildQueue.pop_front();
+                    continue;
+                }
+
+                Mesh& mesh = itMesh->second;
+                uint32_t meshTriangleCount = 0;
+                for (const auto& subMesh : mesh.m_subMeshes)
+                {
+                    const RHI::IndexBufferView& indexBufferView = subMesh.m_indexBufferView;
+                    meshTriangleCount += indexBufferView.GetByteCount() / RHI::GetIndexFormatSize(indexBufferView.GetIndexFormat()) / 3;
+                }
+
+                // always build at least one mesh per frame, even if it is larger than the budget
+                if (triangleBudget > 0 && triangleCount > 0 && triangleCount + meshTriangleCount > triangleBudget)
+                {
+                    break;
+                }
+                triangleCount += meshTriangleCount;
+
+                for (auto& subMesh : mesh.m_subMeshes)
+                {
+                    m_blasBuildList.push_back(subMesh.m_blas);
+                }
+                mesh.m_blasBuilt = true;
+                m_subMeshCount += aznumeric_cast<uint32_t>(mesh.m_subMeshes.size());
+                m_blasBuildQueue.pop_front();
+
+                // the mesh is added to the TLAS
+                m_revision++;
+                m_meshInfoBufferNeedsUpdate = true;
+                m_materialInfoBufferNeedsUpdate = true;
+            }
+        }
+
         void RayTracingFeatureProcessor::UpdateRayTracingSrgs()
         {
             if (!m_tlas->GetTlasBuffer())
@@ -229,6 +284,11 @@ namespace AZ
 
                 for (const auto& mesh : m_meshes)
                 {
+                    if (!mesh.second.m_blasBuilt)
+                    {
+                        continue;
+                    }
+
                     AZ::Transform meshTransform = transformFeatureProcessor->GetTransformForId(TransformServiceFeatureProcessorInterface::ObjectId(mesh.first));
                     AZ::Transform noScaleTransform = meshTransform;
                     noScaleTransform.ExtractUniformScale();
@@ -308,6 +368,11 @@ namespace AZ
 
                 for (const auto& mesh : m_meshes)
                 {
+                    if (!mesh.second.m_blasBuilt)
+                    {
+                        continue;
+                    }
+
                     const RayTracingFeatureProcessor::SubMeshVector& subMeshes = mesh.second.m_subMeshes;
                     for (const auto& subMesh : subMeshes)
                     {
@@ -422,6 +487,11 @@ namespace AZ
                 AZStd::vector<const RHI::BufferView*> meshBuffers;
                 for (const auto& mesh : m_meshes)
                 {
+                    if (!mesh.second.m_blasBuilt)
+                    {
+                        continue;
+                    }
+
                     const SubMeshVector& subMeshes = mesh.second.m_subMeshes;
                     for (const auto& subMesh : subMeshes)
                     {
@@ -470,6 +540,11 @@ namespace AZ
                 AZStd::vector<const RHI::ImageView*> materialTextures;
                 for (const auto& mesh : m_meshes)
                 {
+                    if (!mesh.second.m_blasBuilt)
+                    {
+                        continue;
+                    }
+
                     const SubMeshVector& subMeshes = mesh.second.m_subMeshes;
                     for (const auto& subMesh : subMeshes)
                     {
@@ -15,6 +15,7 @@
 #include <Atom/RHI/ImageView.h>
 #include <AzCore/Math/Color.h>
 #include <AzCore/Math/Transform.h>
+#include <AzCore/std/containers/deque.h>
 
 namespace AZ
 {
@@ -125,7 +126,8 @@ namespace AZ
                 // mesh non-uniform scale
                 AZ::Vector3 m_nonUniformScale = AZ::Vector3::CreateOne();
 
-                // flag indicating if the Blas objects in the sub-meshes are built
+                // flag indicating if the Blas objects in the sub-meshes are built, or scheduled to be built this frame
+                // meshes are only included in the TLAS once their Blas objects are built
                 bool m_blasBuilt = false;
             };
 
@@ -181,6 +183,15 @@ namespace AZ
             //! Updates the RayTracingSceneSrg and RayTracingMaterialSrg, called after the TLAS is allocated in the RayTracingAccelerationStructurePass
             void UpdateRayTracingSrgs();
 
+            //! Moves meshes from the Blas build queue to the Blas build list of this frame, up to the per-frame triangle budget
+            //! set by r_rayTracingBlasBuildBudget, so adding many meshes at once spreads their Blas builds over several frames.
+            //! The moved meshes are included in the TLAS from this frame on, called by the RayTracingAccelerationStructurePass
+            //! before it creates the TLAS.
+            void UpdateBlasBuildList();
+
+            //! Retrieves the Blas objects to build this frame, the RayTracingAccelerationStructurePass clears the list once they are built
+            AZStd::vector<RHI::Ptr<RHI::RayTracingBlas>>& GetBlasBuildList() { return m_blasBuildList; }
+
         private:
 
             AZ_DISABLE_COPY_MOVE(RayTracingFeatureProcessor);
@@ -197,6 +208,13 @@ namespace AZ
             // this is a map of the mesh object Id to the ray tracing data for the sub-meshes
             MeshMap m_meshes;
 
+            // object indices of the meshes waiting for their Blas objects to be built, in the order they were set
+            // entries of meshes that were removed or already built are skipped
+            AZStd::deque<uint32_t> m_blasBuildQueue;
+
+            // Blas objects to build this frame
+            AZStd::vector<RHI::Ptr<RHI::RayTracingBlas>> m_blasBuildList;
+
             // buffer pools used in ray tracing operations
             RHI::Ptr<RHI::RayTracingBufferPools> m_bufferPools;
 
@@ -211,7 +229,7 @@ namespace AZ
             // current revision number of ray tracing data
             uint32_t m_revision = 0;
 
-            // total number of ray tracing sub-meshes
+            // total number of ray tracing sub-meshes in the TLAS, meshes waiting for their Blas build aren't counted
             uint32_t m_subMeshCount = 0;
 
             // TLAS attachmentId
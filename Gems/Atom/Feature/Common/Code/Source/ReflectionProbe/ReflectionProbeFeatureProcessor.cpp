@@ -6,6 +6,7 @@
  *
  */
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <Atom/RPI.Public/RPIUtils.h>
 #include <Atom/RPI.Public/Scene.h>
@@ -24,6 +25,10 @@ namespace AZ
 {
     namespace Render
     {
+        AZ_CVAR(uint32_t, r_reflectionProbeMaxConcurrentBakes, 1, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "The number of reflection probes that bake their cubemap at the same time, the other bakes wait for a free slot. "
+            "Each bake renders one cubemap face per frame through its own render pipeline. 0 bakes all the requested probes at once.");
+
         void ReflectionProbeFeatureProcessor::Reflect(ReflectContext* context)
         {
             if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
@@ -224,6 +229,34 @@ namespace AZ
             }
         }
 
+        void ReflectionProbeFeatureProcessor::OnRenderEnd()
+        {
+            // start the pending bakes that fit in the free slots, in the order they were requested. This runs here rather than in
+            // Simulate() because starting a bake adds a render pipeline to the scene, which can't happen during the parallel simulation.
+            if (m_pendingBakes.empty())
+            {
+                return;
+            }
+
+            const uint32_t maxConcurrentBakes = r_reflectionProbeMaxConcurrentBakes;
+            size_t activeBakeCount = AZStd::count_if(m_reflectionProbes.begin(), m_reflectionProbes.end(),
+                [](const AZStd::shared_ptr<ReflectionProbe>& reflectionProbe) { return reflectionProbe->IsBuildingCubeMap(); });
+
+            size_t startedBakeCount = 0;
+            for (PendingBakeEntry& pendingBake : m_pendingBakes)
+            {
+                if (maxConcurrentBakes > 0 && activeBakeCount >= maxConcurrentBakes)
+                {
+                    break;
+                }
+
+                pendingBake.m_probe->BuildCubeMap(pendingBake.m_callback);
+                ++activeBakeCount;
+                ++startedBakeCount;
+            }
+            m_pendingBakes.erase(m_pendingBakes.begin(), m_pendingBakes.begin() + startedBakeCount);
+        }
+
         ReflectionProbeHandle ReflectionProbeFeatureProcessor::AddProbe(const AZ::Transform& transform, bool useParallaxCorrection)
         {
             AZStd::shared_ptr<ReflectionProbe> reflectionProbe = AZStd::make_shared<ReflectionProbe>();
@@ -247,6 +280,12 @@ namespace AZ
 
             AZ_Assert(itEntry != m_reflectionProbes.end(), "RemoveProbe called with a probe that is not in the probe list");
             m_reflectionProbes.erase(itEntry);
+
+            // drop the bake of the probe if it is still waiting for a slot
+            m_pendingBakes.erase(AZStd::remove_if(m_pendingBakes.begin(), m_pendingBakes.end(), [&](const PendingBakeEntry& entry)
+            {
+                return (entry.m_probe == probe);
+            }), m_pendingBakes.end());
         }
 
         void ReflectionProbeFeatureProcessor::SetProbeOuterExtents(const ReflectionProbeHandle& probe, const Vector3& outerExtents)
@@ -283,7 +322,10 @@ namespace AZ
         void ReflectionProbeFeatureProcessor::BakeProbe(const ReflectionProbeHandle& probe, BuildCubeMapCallback callback, const AZStd::string& relativePath)
         {
             AZ_Assert(probe.get(), "BakeProbe called with an invalid handle");
-            probe->BuildCubeMap(callback);
+
+            // bakes are started by OnRenderEnd() when a slot is free, which keeps baking all the probes
+            // of a level from adding a cubemap pipeline per probe in the same frame
+            m_pendingBakes.push_back({ probe, callback });
 
             // check to see if this is an existing asset
             AZ::Data::AssetId assetId;
@@ -8,10 +8,12 @@
 
 #include <Shadows/ProjectedShadowFeatureProcessor.h>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/EventTrace.h>
 #include <AzCore/Math/MatrixUtils.h>
 #include <Math/GaussianMathFilter.h>
 #include <Atom/RHI/CpuProfiler.h>
+#include <Atom/RPI.Public/Culling.h>
 #include <Atom/RPI.Public/RenderPipeline.h>
 #include <Atom/RPI.Public/RPISystemInterface.h>
 #include <Atom/RPI.Public/Scene.h>
@@ -22,6 +24,9 @@
 
 namespace AZ::Render
 {
+    AZ_CVAR(bool, r_projectedShadowmapCaching, false, nullptr, ConsoleFunctorFlags::Null,
+        "Keep the projected shadowmaps in the atlas between frames, and only render the slices of the atlas whose shadows or content changed");
+
     void ProjectedShadowFeatureProcessor::Reflect(ReflectContext* context)
     {
         if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
@@ -249,6 +254,12 @@ namespace AZ::Render
         return GetShadowPropertyFromShadowId(id).m_desc;
     }
 
+    void ProjectedShadowFeatureProcessor::InvalidateShadowmap(ShadowId id)
+    {
+        AZ_Assert(id.IsValid(), "Invalid ShadowId passed to ProjectedShadowFeatureProcessor::InvalidateShadowmap().");
+        GetShadowPropertyFromShadowId(id).m_shadowmapIsDirty = true;
+    }
+
     void ProjectedShadowFeatureProcessor::UpdateShadowView(ShadowProperty& shadowProperty)
     {
         const ProjectedShadowDescriptor& desc = shadowProperty.m_desc;
@@ -271,6 +282,7 @@ namespace AZ::Render
         RPI::ViewPtr view = shadowProperty.m_shadowmapView;
         view->SetViewToClipMatrix(viewToClipMatrix);
         view->SetCameraTransform(Matrix3x4::CreateFromTransform(desc.m_transform));
+        shadowProperty.m_shadowmapIsDirty = true;
 
         ShadowData& shadowData = m_shadowData.GetElement<ShadowDataIndex>(shadowProperty.m_shadowId.GetIndex());
 
@@ -569,8 +581,36 @@ namespace AZ::Render
         }
     }
     
+    void ProjectedShadowFeatureProcessor::UpdateCachedShadowmaps()
+    {
+        auto& shadowProperties = m_shadowProperties.GetDataVector();
+        AZStd::vector<bool> shadowmapIsDirty(shadowProperties.size(), true);
+        if (r_projectedShadowmapCaching)
+        {
+            // The cullables changed since the last culling were moved by this frame's simulation
+            RPI::CullingScene* cullingScene = GetParentScene()->GetCullingScene();
+            for (uint32_t i = 0; i < shadowProperties.size(); ++i)
+            {
+                ShadowProperty& shadowProperty = shadowProperties.at(i);
+                const Frustum frustum = Frustum::CreateFromMatrixColumnMajor(shadowProperty.m_shadowmapView->GetWorldToClipMatrix());
+                shadowmapIsDirty[i] = shadowProperty.m_shadowmapIsDirty || cullingScene->HasChangedCullables(frustum);
+            }
+        }
+
+        for (ShadowProperty& shadowProperty : shadowProperties)
+        {
+            shadowProperty.m_shadowmapIsDirty = false;
+        }
+        for (ProjectedShadowmapsPass* pass : m_projectedShadowmapsPasses)
+        {
+            pass->UpdateCachedShadowmaps(shadowmapIsDirty);
+        }
+    }
+
     void ProjectedShadowFeatureProcessor::PrepareViews(const PrepareViewsPacket&, AZStd::vector<AZStd::pair<RPI::PipelineViewTag, RPI::ViewPtr>>& outViews)
     {
+        UpdateCachedShadowmaps();
+
         for (ProjectedShadowmapsPass* pass : m_projectedShadowmapsPasses)
         {
             RPI::RenderPipeline* renderPipeline = pass->GetRenderPipeline();
@@ -587,6 +627,14 @@ namespace AZ::Render
                         continue;
                     }
 
+                    // A cached shadowmap isn't drawn, so there is no need to cull its view either
+                    const bool isRendered = AZStd::any_of(m_projectedShadowmapsPasses.begin(), m_projectedShadowmapsPasses.end(),
+                        [i](const ProjectedShadowmapsPass* shadowmapsPass) { return shadowmapsPass->IsShadowmapRendered(i); });
+                    if (!isRendered)
+                    {
+                        continue;
+                    }
+
                     const RPI::PipelineViewTag& viewTag = pass->GetPipelineViewTagOfChild(i);
                     const RHI::DrawListMask drawListMask = renderPipeline->GetDrawListMask(viewTag);
                     if (shadowProperty.m_shadowmapView->GetDrawListMask() != drawListMask)
@@ -56,6 +56,7 @@ namespace AZ::Render
         void SetFilteringSampleCount(ShadowId id, uint16_t count) override;
         void SetShadowProperties(ShadowId id, const ProjectedShadowDescriptor& descriptor) override;
         const ProjectedShadowDescriptor& GetShadowProperties(ShadowId id) override;
+        void InvalidateShadowmap(ShadowId id) override;
 
     private:
 
@@ -82,6 +83,7 @@ namespace AZ::Render
             RPI::ViewPtr m_shadowmapView;
             float m_bias = 0.1f;
             ShadowId m_shadowId;
+            bool m_shadowmapIsDirty = true; // the cached shadowmap doesn't match the view anymore.
         };
 
         using FilterParameter = EsmShadowmapsPass::FilterParameter;
@@ -95,6 +97,9 @@ namespace AZ::Render
         // Shadow specific functions
         void UpdateShadowView(ShadowProperty& shadowProperty);
         void InitializeShadow(ShadowId shadowId);
+
+        //! Decides which shadowmaps are rendered this frame, the others are kept from the previous frame.
+        void UpdateCachedShadowmaps();
             
         // Functions for caching the ProjectedShadowmapsPass and EsmShadowmapsPass.
         void CachePasses();
@@ -25,16 +25,27 @@
 #include <Atom/RHI/CpuProfiler.h>
 #include <Atom/RHI/CommandList.h>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/EventTrace.h>
 #include <AzCore/Jobs/JobCompletion.h>
 #include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/RTTI/TypeInfo.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/sort.h>
 
 namespace AZ
 {
     namespace Render
     {
+        AZ_CVAR(bool, r_skinningCulling, true, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Skips the skinning of the meshes that aren't visible in any view.");
+        AZ_CVAR(float, r_skinningHalfRateScreenPercentage, 0.05f, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Meshes covering less than this fraction of the screen height in every view are skinned every other frame.");
+        AZ_CVAR(float, r_skinningQuarterRateScreenPercentage, 0.02f, nullptr, AZ::ConsoleFunctorFlags::Null,
+            "Meshes covering less than this fraction of the screen height in every view are skinned every 4th frame.");
+
         const char* SkinnedMeshFeatureProcessor::s_featureProcessorName = "SkinnedMeshFeatureProcessor";
 
         void SkinnedMeshFeatureProcessor::Reflect(ReflectContext* context)
@@ -126,7 +137,7 @@ namespace AZ
 
                                 //the [1][1] element of a projection matrix stores cot(FovY/2) (equal to 2*nearPlaneDistance/nearPlaneHeight),
                                 //which is used to determine the (vertical) projected size in screen space            
-                                const float yScale = results->m_viewPtr->GetViewToClipMatrix().GetRow(1).GetY();
+                                const float yScale = results->m_viewPtr->GetViewToClipMatrix().GetRow(1).GetY() * RPI::ModelLodUtils::GetLodScreenCoverageScale();
                                 const Vector3 cameraPos = results->m_viewPtr->GetViewToWorldMatrix().GetTranslation();
                                 const bool isPerspective = (results->m_viewPtr->GetViewToClipMatrix().GetElement(3, 3) == 0.f);
 
@@ -152,13 +163,10 @@ namespace AZ
                                         {
                                             AZStd::lock_guard lock(m_dispatchItemMutex);
                                             m_skinningDispatches.insert(&renderProxy->m_dispatchItemsByLod[lodIndex]->GetRHIDispatchItem());
-                                            for (size_t morphTargetIndex = 0; morphTargetIndex < renderProxy->m_morphTargetDispatchItemsByLod[lodIndex].size(); morphTargetIndex++)
+                                            const MorphTargetDispatchItem* morphTargetDispatchItem = renderProxy->m_morphTargetDispatchItemsByLod[lodIndex].get();
+                                            if (morphTargetDispatchItem && morphTargetDispatchItem->HasActiveMorphTargets())
                                             {
-                                                const MorphTargetDispatchItem* dispatchItem = renderProxy->m_morphTargetDispatchItemsByLod[lodIndex][morphTargetIndex].get();
-                                                if (dispatchItem && dispatchItem->GetWeight() > AZ::Constants::FloatEpsilon)
-                                                {
-                                                    m_morphTargetDispatches.insert(&dispatchItem->GetRHIDispatchItem());
-                                                }
+                                                m_morphTargetDispatches.insert(&morphTargetDispatchItem->GetRHIDispatchItem());
                                             }
                                         }
                                     }
@@ -191,6 +199,10 @@ namespace AZ
                 MeshDataInstance& meshDataInstance = **renderProxy.m_meshHandle;
                 const RPI::Cullable& cullable = meshDataInstance.GetCullable();
 
+                // The dispatch items are added in OnEndPrepareRender, once culling tells which proxies are visible
+                renderProxy.m_selectedLodMask = 0;
+                renderProxy.m_maxScreenPercentage = 0.0f;
+
                 for (const RPI::ViewPtr& viewPtr : packet.m_views)
                 {
                     RPI::View* view = viewPtr.get();
@@ -208,7 +220,7 @@ namespace AZ
 
                     //the [1][1] element of a perspective projection matrix stores cot(FovY/2) (equal to 2*nearPlaneDistance/nearPlaneHeight),
                     //which is used to determine the (vertical) projected size in screen space
-                    const float yScale = viewToClip.GetElement(1, 1);
+                    const float yScale = viewToClip.GetElement(1, 1) * RPI::ModelLodUtils::GetLodScreenCoverageScale();
                     const bool isPerspective = viewToClip.GetElement(3, 3) == 0.f;
                     const Vector3 cameraPos = view->GetViewToWorldMatrix().GetTranslation();
 
@@ -216,6 +228,7 @@ namespace AZ
 
                     const float approxScreenPercentage = RPI::ModelLodUtils::ApproxScreenPercentage(
                         pos, cullable.m_lodData.m_lodSelectionRadius, cameraPos, yScale, isPerspective);
+                    renderProxy.m_maxScreenPercentage = AZStd::max(renderProxy.m_maxScreenPercentage, approxScreenPercentage);
 
                     for (size_t lodIndex = 0; lodIndex < cullable.m_lodData.m_lods.size(); ++lodIndex)
                     {
@@ -224,16 +237,7 @@ namespace AZ
                         //Note that this supports overlapping lod ranges (to support cross-fading lods, for example)
                         if (approxScreenPercentage >= lod.m_screenCoverageMin && approxScreenPercentage <= lod.m_screenCoverageMax)
                         {
-                            AZStd::lock_guard lock(m_dispatchItemMutex);
-                            m_skinningDispatches.insert(&renderProxy.m_dispatchItemsByLod[lodIndex]->GetRHIDispatchItem());
-                            for (size_t morphTargetIndex = 0; morphTargetIndex < renderProxy.m_morphTargetDispatchItemsByLod[lodIndex].size(); morphTargetIndex++)
-                            {
-                                const MorphTargetDispatchItem* dispatchItem = renderProxy.m_morphTargetDispatchItemsByLod[lodIndex][morphTargetIndex].get();
-                                if (dispatchItem && dispatchItem->GetWeight() > AZ::Constants::FloatEpsilon)
-                                {
-                                    m_morphTargetDispatches.insert(&dispatchItem->GetRHIDispatchItem());
-                                }
-                            }
+                            renderProxy.m_selectedLodMask |= 1u << lodIndex;
                         }
                     }
                 }
@@ -258,6 +262,58 @@ namespace AZ
             SkinnedMeshFeatureProcessorNotificationBus::Broadcast(&SkinnedMeshFeatureProcessorNotificationBus::Events::OnUpdateSkinningMatrices);
         }
 
+        void SkinnedMeshFeatureProcessor::OnEndPrepareRender()
+        {
+            AZ_PROFILE_FUNCTION(Debug::ProfileCategory::AzRender);
+
+            AZStd::lock_guard lock(m_dispatchItemMutex);
+            for (SkinnedMeshRenderProxy& renderProxy : m_renderProxies)
+            {
+                MeshDataInstance& meshDataInstance = **renderProxy.m_meshHandle;
+
+                // The meshes drawn indirectly are culled on the gpu, after the skinning
+                renderProxy.m_isVisible = !r_skinningCulling || meshDataInstance.IsDrawnIndirect() || meshDataInstance.GetCullable().m_isVisible;
+                meshDataInstance.ResetCullingVisibility();
+
+                renderProxy.m_skinningUpdateInterval = 1;
+                if (renderProxy.m_maxScreenPercentage < r_skinningQuarterRateScreenPercentage)
+                {
+                    renderProxy.m_skinningUpdateInterval = 4;
+                }
+                else if (renderProxy.m_maxScreenPercentage < r_skinningHalfRateScreenPercentage)
+                {
+                    renderProxy.m_skinningUpdateInterval = 2;
+                }
+
+                // Meshes that are skipped keep the output of their last skinning
+                if (!renderProxy.m_isVisible || renderProxy.m_selectedLodMask == 0 ||
+                    renderProxy.m_framesSinceLastSkinning < renderProxy.m_skinningUpdateInterval - 1)
+                {
+                    if (renderProxy.m_framesSinceLastSkinning < AZStd::numeric_limits<uint32_t>::max())
+                    {
+                        ++renderProxy.m_framesSinceLastSkinning;
+                    }
+                    continue;
+                }
+                renderProxy.m_framesSinceLastSkinning = 0;
+
+                for (size_t lodIndex = 0; lodIndex < renderProxy.m_dispatchItemsByLod.size(); ++lodIndex)
+                {
+                    if ((renderProxy.m_selectedLodMask & (1u << lodIndex)) == 0)
+                    {
+                        continue;
+                    }
+
+                    m_skinningDispatches.insert(&renderProxy.m_dispatchItemsByLod[lodIndex]->GetRHIDispatchItem());
+                    const MorphTargetDispatchItem* morphTargetDispatchItem = renderProxy.m_morphTargetDispatchItemsByLod[lodIndex].get();
+                    if (morphTargetDispatchItem && morphTargetDispatchItem->HasActiveMorphTargets())
+                    {
+                        m_morphTargetDispatches.insert(&morphTargetDispatchItem->GetRHIDispatchItem());
+                    }
+                }
+            }
+        }
+
         void SkinnedMeshFeatureProcessor::OnRenderEnd()
         {
             m_renderProxiesChecker.soft_unlock();
@@ -343,21 +399,37 @@ namespace AZ
         void SkinnedMeshFeatureProcessor::SubmitSkinningDispatchItems(RHI::CommandList* commandList)
         {
             AZStd::lock_guard lock(m_dispatchItemMutex);
-            for (const RHI::DispatchItem* dispatchItem : m_skinningDispatches)
-            {
-                commandList->Submit(*dispatchItem);
-            }
-            m_skinningDispatches.clear();
+            SubmitSortedDispatchItems(m_skinningDispatches, commandList);
         }
 
         void SkinnedMeshFeatureProcessor::SubmitMorphTargetDispatchItems(RHI::CommandList* commandList)
         {
             AZStd::lock_guard lock(m_dispatchItemMutex);
-            for (const RHI::DispatchItem* dispatchItem : m_morphTargetDispatches)
+            SubmitSortedDispatchItems(m_morphTargetDispatches, commandList);
+        }
+
+        void SkinnedMeshFeatureProcessor::SubmitSortedDispatchItems(AZStd::unordered_set<const RHI::DispatchItem*>& dispatchItems, RHI::CommandList* commandList)
+        {
+            // The set removes the duplicates added by several views, but iterates in the order of the hashed pointers
+            m_sortedDispatchItems.assign(dispatchItems.begin(), dispatchItems.end());
+            AZStd::sort(m_sortedDispatchItems.begin(), m_sortedDispatchItems.end(),
+                [](const RHI::DispatchItem* lhs, const RHI::DispatchItem* rhs)
+                {
+                    if (lhs->m_pipelineState != rhs->m_pipelineState)
+                    {
+                        return lhs->m_pipelineState < rhs->m_pipelineState;
+                    }
+                    return AZStd::lexicographical_compare(
+                        lhs->m_shaderResourceGroups.begin(), lhs->m_shaderResourceGroups.begin() + lhs->m_shaderResourceGroupCount,
+                        rhs->m_shaderResourceGroups.begin(), rhs->m_shaderResourceGroups.begin() + rhs->m_shaderResourceGroupCount);
+                });
+
+            for (const RHI::DispatchItem* dispatchItem : m_sortedDispatchItems)
             {
                 commandList->Submit(*dispatchItem);
             }
-            m_morphTargetDispatches.clear();
+            m_sortedDispatchItems.clear();
+            dispatchItems.clear();
         }
 
         SkinnedMeshRenderProxyInterfaceHandle SkinnedMeshFeatureProcessor::AcquireRenderProxyInterface(const SkinnedMeshRenderProxyDesc& desc)
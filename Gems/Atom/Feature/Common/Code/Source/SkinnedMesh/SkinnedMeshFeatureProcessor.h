@@ -52,6 +52,7 @@ namespace AZ
             void OnRenderPipelineAdded(RPI::RenderPipelinePtr pipeline) override;
             void OnRenderPipelinePassesChanged(RPI::RenderPipeline* renderPipeline) override;
             void OnBeginPrepareRender() override;
+            void OnEndPrepareRender() override;
 
             SkinnedMeshRenderProxyHandle AcquireRenderProxy(const SkinnedMeshRenderProxyDesc& desc);
             bool ReleaseRenderProxy(SkinnedMeshRenderProxyHandle& handle);
@@ -68,6 +69,10 @@ namespace AZ
 
             void InitSkinningAndMorphPass(const RPI::Ptr<RPI::ParentPass> pipelineRootPass);
 
+            //! Submits the dispatch items ordered by pipeline state and shader resource groups, so the items that share a shader variant
+            //! or a model are recorded back to back and the command list doesn't rebind the same state between them.
+            void SubmitSortedDispatchItems(AZStd::unordered_set<const RHI::DispatchItem*>& dispatchItems, RHI::CommandList* commandList);
+
             SkinnedMeshRenderProxyInterfaceHandle AcquireRenderProxyInterface(const SkinnedMeshRenderProxyDesc& desc) override;
             bool ReleaseRenderProxyInterface(SkinnedMeshRenderProxyInterfaceHandle& handle) override;
 
@@ -86,6 +91,7 @@ namespace AZ
             AZStd::unordered_set<const RHI::DispatchItem*> m_skinningDispatches;
             AZStd::unordered_set<const RHI::DispatchItem*> m_morphTargetDispatches;
             AZStd::mutex m_dispatchItemMutex;
+            AZStd::vector<const RHI::DispatchItem*> m_sortedDispatchItems; //!< Kept across frames to avoid reallocating it for every submit
 
         };
     } // namespace Render
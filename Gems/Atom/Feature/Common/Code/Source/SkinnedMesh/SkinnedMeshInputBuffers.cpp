@@ -242,11 +242,15 @@ namespace AZ
         {
             m_morphTargetMetaDatas.push_back(MorphTargetMetaData{ minWeight, maxWeight, morphTarget.m_minPositionDelta, morphTarget.m_maxPositionDelta, morphTarget.m_numVertices, morphTarget.m_startIndex });
             
-            // Create a view into the larger per-lod morph buffer for this particular morph
-            RHI::BufferViewDescriptor morphView = RHI::BufferViewDescriptor::CreateStructured(morphTarget.m_startIndex, morphTarget.m_numVertices, sizeof(RPI::PackedCompressedMorphTargetDelta));
-            RPI::BufferAssetView morphTargetDeltaView{ morphBufferAsset, morphView };
+            // All the morphs of the lod are applied by a single dispatch, so they share a view of the entire per-lod morph buffer
+            if (!m_morphTargetInputBuffers)
+            {
+                const uint32_t deltaCount = aznumeric_cast<uint32_t>(morphBufferAsset->GetBufferDescriptor().m_byteCount / sizeof(RPI::PackedCompressedMorphTargetDelta));
+                RHI::BufferViewDescriptor morphView = RHI::BufferViewDescriptor::CreateStructured(0, deltaCount, sizeof(RPI::PackedCompressedMorphTargetDelta));
+                RPI::BufferAssetView morphTargetDeltaView{ morphBufferAsset, morphView };
 
-            m_morphTargetInputBuffers.push_back(aznew MorphTargetInputBuffers{ morphTargetDeltaView, bufferNamePrefix });
+                m_morphTargetInputBuffers = aznew MorphTargetInputBuffers{ morphTargetDeltaView, bufferNamePrefix };
+            }
 
             // If colors are going to be morphed, the SkinnedMeshInputLod needs to know so that it allocates memory for the dynamically updated colors
             if (morphTarget.m_hasColorDeltas)
@@ -265,7 +269,7 @@ namespace AZ
             return m_morphTargetMetaDatas;
         }
 
-        const AZStd::vector<AZStd::intrusive_ptr<MorphTargetInputBuffers>>& SkinnedMeshInputLod::GetMorphTargetInputBuffers() const
+        const AZStd::intrusive_ptr<MorphTargetInputBuffers>& SkinnedMeshInputLod::GetMorphTargetInputBuffers() const
         {
             return m_morphTargetInputBuffers;
         }
@@ -91,8 +91,8 @@ namespace AZ
 
             // Get the data needed to create a morph target dispatch item
             Data::Instance<RPI::Shader> morphTargetShader = m_featureProcessor->GetMorphTargetShader();
-            const AZStd::vector<AZStd::intrusive_ptr<MorphTargetInputBuffers>>& morphTargetInputBuffersVector = m_inputBuffers->GetMorphTargetInputBuffers(modelLodIndex);
-            AZ_Assert(morphTargetMetaDatas.size() == morphTargetInputBuffersVector.size(), "Skinned Mesh Feature Processor - Mismatch in morph target metadata count and morph target input buffer count");
+            const AZStd::intrusive_ptr<MorphTargetInputBuffers>& morphTargetInputBuffers = m_inputBuffers->GetMorphTargetInputBuffers(modelLodIndex);
+            AZ_Assert(morphTargetMetaDatas.empty() || morphTargetInputBuffers, "Skinned Mesh Feature Processor - Morph targets without input buffers");
 
             if (!morphTargetShader && morphTargetMetaDatas.size() > 0)
             {
@@ -100,20 +100,20 @@ namespace AZ
                 return false;
             }
 
-            // Create one dispatch item per morph target
-            m_morphTargetDispatchItemsByLod.emplace_back(AZStd::vector<AZStd::unique_ptr<MorphTargetDispatchItem>>());
-            for (size_t morphTargetIndex = 0; morphTargetIndex < morphTargetMetaDatas.size(); ++morphTargetIndex)
+            // Create one dispatch item that accumulates all the active morph targets of the lod
+            m_morphTargetDispatchItemsByLod.emplace_back(nullptr);
+            if (morphTargetMetaDatas.size() > 0)
             {
-                m_morphTargetDispatchItemsByLod[modelLodIndex].emplace_back(
+                m_morphTargetDispatchItemsByLod[modelLodIndex].reset(
                     aznew MorphTargetDispatchItem{
-                        morphTargetInputBuffersVector[morphTargetIndex],
-                        morphTargetMetaDatas[morphTargetIndex],
+                        morphTargetInputBuffers,
+                        morphTargetMetaDatas,
                         m_featureProcessor,
                         m_instance->m_morphTargetInstanceMetaData[modelLodIndex],
                         morphDeltaIntegerEncoding });
 
                 // Initialize the MorphTargetDispatchItem we just created
-                if (!m_morphTargetDispatchItemsByLod[modelLodIndex].back()->Init())
+                if (!m_morphTargetDispatchItemsByLod[modelLodIndex]->Init())
                 {
                     return false;
                 }
@@ -138,15 +138,25 @@ namespace AZ
 
         void SkinnedMeshRenderProxy::SetMorphTargetWeights(uint32_t lodIndex, const AZStd::vector<float>& weights)
         {
-            auto& morphTargetDispatchItems = m_morphTargetDispatchItemsByLod[lodIndex];
+            MorphTargetDispatchItem* morphTargetDispatchItem = m_morphTargetDispatchItemsByLod[lodIndex].get();
 
-            AZ_Assert(morphTargetDispatchItems.size() == weights.size(), "Skinned Mesh Feature Processor - Morph target weights passed into SetMorphTargetWeight don't align with morph target dispatch items.");
-            for (size_t morphIndex = 0; morphIndex < weights.size(); ++morphIndex)
+            AZ_Assert(morphTargetDispatchItem || weights.empty(), "Skinned Mesh Feature Processor - Morph target weights passed into SetMorphTargetWeight for a lod without morph targets.");
+            if (morphTargetDispatchItem)
             {
-                morphTargetDispatchItems[morphIndex]->SetWeight(weights[morphIndex]);
+                morphTargetDispatchItem->SetWeights(weights);
             }
         }
 
+        bool SkinnedMeshRenderProxy::IsVisible() const
+        {
+            return m_isVisible;
+        }
+
+        uint32_t SkinnedMeshRenderProxy::GetSkinningUpdateInterval() const
+        {
+            return m_skinningUpdateInterval;
+        }
+
         AZStd::array_view<AZStd::unique_ptr<SkinnedMeshDispatchItem>> SkinnedMeshRenderProxy::GetDispatchItems() const
         {
             return m_dispatchItemsByLod;
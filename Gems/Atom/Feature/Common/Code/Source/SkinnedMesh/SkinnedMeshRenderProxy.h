@@ -19,6 +19,7 @@
 
 #include <AzCore/base.h>
 #include <AzCore/Math/Vector3.h>
+#include <AzCore/std/limits.h>
 
 namespace AZ
 {
@@ -44,6 +45,8 @@ namespace AZ
             void SetTransform(const Transform& transform) override;
             void SetSkinningMatrices(const AZStd::vector<float>& data) override;
             void SetMorphTargetWeights(uint32_t lodIndex, const AZStd::vector<float>& weights) override;
+            bool IsVisible() const override;
+            uint32_t GetSkinningUpdateInterval() const override;
 
             AZStd::array_view< AZStd::unique_ptr<SkinnedMeshDispatchItem>> GetDispatchItems() const;
         private:
@@ -55,7 +58,7 @@ namespace AZ
 
             Vector3 m_position = Vector3(0.0f, 0.0f, 0.0f); //!< Cached position so SkinnedMeshFeatureProcessor can make faster LOD calculations
             AZStd::fixed_vector<AZStd::unique_ptr<SkinnedMeshDispatchItem>, RPI::ModelLodAsset::LodCountMax> m_dispatchItemsByLod;
-            AZStd::fixed_vector<AZStd::vector<AZStd::unique_ptr<MorphTargetDispatchItem>>, RPI::ModelLodAsset::LodCountMax> m_morphTargetDispatchItemsByLod;
+            AZStd::fixed_vector<AZStd::unique_ptr<MorphTargetDispatchItem>, RPI::ModelLodAsset::LodCountMax> m_morphTargetDispatchItemsByLod; //!< Null for the lods without morph targets
             Data::Instance<SkinnedMeshInputBuffers> m_inputBuffers;
             Data::Instance<MorphTargetInputBuffers> m_morphTargetInputBuffers;
             AZStd::intrusive_ptr<SkinnedMeshInstance> m_instance;
@@ -66,6 +69,13 @@ namespace AZ
 
             SkinnedMeshFeatureProcessor* m_featureProcessor = nullptr;
             bool m_isQueuedForCompile = false;
+
+            // Skinning lod, updated by the SkinnedMeshFeatureProcessor during and after culling
+            uint32_t m_selectedLodMask = 0; //!< Bit per model lod selected in any view
+            float m_maxScreenPercentage = 0.0f;
+            bool m_isVisible = true;
+            uint32_t m_skinningUpdateInterval = 1;
+            uint32_t m_framesSinceLastSkinning = AZStd::numeric_limits<uint32_t>::max(); //!< So a new proxy is skinned as soon as it is visible
         };
 
         using SkinnedMeshRenderProxyHandle = StableDynamicArrayHandle<SkinnedMeshRenderProxy>;
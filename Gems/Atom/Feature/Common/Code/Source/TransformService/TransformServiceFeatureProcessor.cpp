@@ -16,6 +16,7 @@
 #include <Atom/Utils/Utils.h>
 
 #include <AzCore/Debug/EventTrace.h>
+#include <AzCore/std/sort.h>
 #include <cinttypes>
 
 namespace AZ
@@ -42,9 +43,9 @@ namespace AZ
             m_objectToWorldInverseTransposeBufferIndex = m_sceneSrg->FindShaderInputBufferIndex(Name{"m_objectToWorldInverseTransposeBuffer"});
             m_objectToWorldHistoryBufferIndex = m_sceneSrg->FindShaderInputBufferIndex(Name{"m_objectToWorldHistoryBuffer"});
 
-            m_deviceBufferNeedsUpdate = true;
             m_objectToWorldTransforms.reserve(BufferReserveCount);
-            m_objectToWorldInverseTransposeTransforms.reserve(BufferReserveCount);            
+            m_objectToWorldInverseTransposeTransforms.reserve(BufferReserveCount);
+            m_pendingBufferSetMasks.reserve(BufferReserveCount);
 
             m_isWriteable = true;
 
@@ -55,10 +56,13 @@ namespace AZ
         {
             m_objectToWorldTransforms = {};
             m_objectToWorldInverseTransposeTransforms = {};
+            m_pendingBufferSetMasks = {};
 
-            m_objectToWorldBuffer = nullptr;
-            m_objectToWorldInverseTransposeBuffer = nullptr;
-            m_objectToWorldHistoryBuffer = nullptr;
+            for (BufferSet& bufferSet : m_bufferSets)
+            {
+                bufferSet = {};
+            }
+            m_currentBufferSetIndex = 0;
 
             m_firstAvailableTransformIndex = NoAvailableTransformIndices;
 
@@ -67,39 +71,34 @@ namespace AZ
             RPI::SceneNotificationBus::Handler::BusDisconnect();
         }
         
-        void TransformServiceFeatureProcessor::PrepareBuffers()
+        void TransformServiceFeatureProcessor::PrepareBuffers(BufferSet& bufferSet)
         {
             AZ_Assert(!m_isWriteable, "Must be called between OnBeginPrepareRender() and OnEndPrepareRender()");
 
-            RHI::BufferDescriptor desc;
-            desc.m_bindFlags = RHI::BufferBindFlags::ShaderRead;
-
             {
                 const uint32_t elementCount = RHI::NextPowerOfTwo(GetMax<uint32_t>(1, static_cast<uint32_t>(m_objectToWorldTransforms.size())));
                 static const uint32_t elementSize = TransformValueSize;
                 const uint32_t byteCount = elementCount * TransformValueSize;
 
                 // Create or resize
-                if (!m_objectToWorldBuffer)
+                if (!bufferSet.m_objectToWorldBuffer)
                 {
                     // Create the transform buffer, grow by powers of two
-                    RPI::CommonBufferDescriptor desc2;
-                    desc2.m_poolType = RPI::CommonBufferPoolType::ReadOnly;
-                    desc2.m_bufferName =  "m_objectToWorldBuffer";
-                    desc2.m_byteCount = byteCount;
-                    desc2.m_elementSize = elementSize;
-
-                    m_objectToWorldBuffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc2);
-
-                    desc2.m_bufferName = "m_objectToWorldHistoryBuffer";
-                    m_objectToWorldHistoryBuffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc2);
+                    RPI::CommonBufferDescriptor desc;
+                    desc.m_poolType = RPI::CommonBufferPoolType::ReadOnly;
+                    desc.m_bufferName =  "m_objectToWorldBuffer";
+                    desc.m_byteCount = byteCount;
+                    desc.m_elementSize = elementSize;
+
+                    bufferSet.m_objectToWorldBuffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc);
+                    bufferSet.m_needsFullUpload = true;
                 }
                 else
                 {
-                    if (byteCount > m_objectToWorldBuffer->GetBufferSize())
+                    if (byteCount > bufferSet.m_objectToWorldBuffer->GetBufferSize())
                     {
-                        m_objectToWorldBuffer->Resize(byteCount);
-                        m_objectToWorldHistoryBuffer->Resize(byteCount);
+                        bufferSet.m_objectToWorldBuffer->Resize(byteCount);
+                        bufferSet.m_needsFullUpload = true;
                     }
                 }
             }
@@ -110,27 +109,98 @@ namespace AZ
                 const uint32_t byteCount = elementCount * elementSize;
 
                 // Create or resize
-                if (!m_objectToWorldInverseTransposeBuffer)
+                if (!bufferSet.m_objectToWorldInverseTransposeBuffer)
                 {
                     // Create the normal buffer, grow by powers of two
-                    RPI::CommonBufferDescriptor desc2;
-                    desc2.m_poolType = RPI::CommonBufferPoolType::ReadOnly;
-                    desc2.m_bufferName = "m_objectToWorldInverseTransposeBuffer";
-                    desc2.m_byteCount = byteCount;
-                    desc2.m_elementSize = elementSize;
-
-                    m_objectToWorldInverseTransposeBuffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc2);
+                    RPI::CommonBufferDescriptor desc;
+                    desc.m_poolType = RPI::CommonBufferPoolType::ReadOnly;
+                    desc.m_bufferName = "m_objectToWorldInverseTransposeBuffer";
+                    desc.m_byteCount = byteCount;
+                    desc.m_elementSize = elementSize;
+
+                    bufferSet.m_objectToWorldInverseTransposeBuffer = RPI::BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc);
+                    bufferSet.m_needsFullUpload = true;
                 }
                 else
                 {
-                    if (byteCount > m_objectToWorldInverseTransposeBuffer->GetBufferSize())
+                    if (byteCount > bufferSet.m_objectToWorldInverseTransposeBuffer->GetBufferSize())
                     {
-                        m_objectToWorldInverseTransposeBuffer->Resize(byteCount);
+                        bufferSet.m_objectToWorldInverseTransposeBuffer->Resize(byteCount);
+                        bufferSet.m_needsFullUpload = true;
                     }
                 }
             }
         }
 
+        void TransformServiceFeatureProcessor::UpdateBuffers(uint32_t bufferSetIndex)
+        {
+            BufferSet& bufferSet = m_bufferSets[bufferSetIndex];
+            PrepareBuffers(bufferSet);
+
+            const uint32_t transformCount = aznumeric_cast<uint32_t>(m_objectToWorldTransforms.size());
+            const uint8_t bufferSetBit = aznumeric_cast<uint8_t>(1u << bufferSetIndex);
+            for (uint32_t index : bufferSet.m_pendingIndices)
+            {
+                m_pendingBufferSetMasks[index] &= ~bufferSetBit;
+            }
+
+            if (bufferSet.m_needsFullUpload || bufferSet.m_pendingIndices.size() * 2 > transformCount)
+            {
+                UploadRange(bufferSet, 0, transformCount);
+                bufferSet.m_pendingIndices.clear();
+                bufferSet.m_needsFullUpload = false;
+                return;
+            }
+
+            if (bufferSet.m_pendingIndices.empty())
+            {
+                return;
+            }
+
+            // Static objects are never pending after their first frame, so only the ranges around the objects that moved are uploaded.
+            AZStd::sort(bufferSet.m_pendingIndices.begin(), bufferSet.m_pendingIndices.end());
+            uint32_t rangeFirst = bufferSet.m_pendingIndices.front();
+            uint32_t rangeLast = rangeFirst;
+            for (uint32_t index : bufferSet.m_pendingIndices)
+            {
+                if (index > rangeLast + MaxMergedRangeGap)
+                {
+                    UploadRange(bufferSet, rangeFirst, rangeLast - rangeFirst + 1);
+                    rangeFirst = index;
+                }
+                rangeLast = index;
+            }
+            UploadRange(bufferSet, rangeFirst, rangeLast - rangeFirst + 1);
+            bufferSet.m_pendingIndices.clear();
+        }
+
+        void TransformServiceFeatureProcessor::UploadRange(BufferSet& bufferSet, uint32_t firstIndex, uint32_t count)
+        {
+            if (count == 0)
+            {
+                return;
+            }
+
+            bufferSet.m_objectToWorldBuffer->UpdateData(
+                &m_objectToWorldTransforms[firstIndex], count * TransformValueSize, firstIndex * TransformValueSize);
+            bufferSet.m_objectToWorldInverseTransposeBuffer->UpdateData(
+                &m_objectToWorldInverseTransposeTransforms[firstIndex], count * NormalValueSize, firstIndex * NormalValueSize);
+        }
+
+        void TransformServiceFeatureProcessor::MarkPending(uint32_t index)
+        {
+            uint8_t& mask = m_pendingBufferSetMasks[index];
+            for (uint32_t bufferSetIndex = 0; bufferSetIndex < BufferSetCount; ++bufferSetIndex)
+            {
+                const uint8_t bufferSetBit = aznumeric_cast<uint8_t>(1u << bufferSetIndex);
+                if ((mask & bufferSetBit) == 0)
+                {
+                    m_bufferSets[bufferSetIndex].m_pendingIndices.push_back(index);
+                    mask |= bufferSetBit;
+                }
+            }
+        }
+
         void TransformServiceFeatureProcessor::Render([[maybe_unused]] const FeatureProcessor::RenderPacket& packet)
         {
             AZ_ATOM_PROFILE_FUNCTION("RPI", "TransformServiceFeatureProcessor: Render");
@@ -138,35 +208,27 @@ namespace AZ
 
             AZ_Assert(!m_isWriteable, "Must be called between OnBeginPrepareRender() and OnEndPrepareRender()");
 
-            m_sceneSrg->SetBufferView(m_objectToWorldBufferIndex, m_objectToWorldBuffer->GetBufferView());
-            m_sceneSrg->SetBufferView(m_objectToWorldInverseTransposeBufferIndex, m_objectToWorldInverseTransposeBuffer->GetBufferView());
-            m_sceneSrg->SetBufferView(m_objectToWorldHistoryBufferIndex, m_objectToWorldHistoryBuffer->GetBufferView());
+            const BufferSet& currentBufferSet = m_bufferSets[m_currentBufferSetIndex];
+            const BufferSet& historyBufferSet = m_bufferSets[(m_currentBufferSetIndex + BufferSetCount - 1) % BufferSetCount];
+            m_sceneSrg->SetBufferView(m_objectToWorldBufferIndex, currentBufferSet.m_objectToWorldBuffer->GetBufferView());
+            m_sceneSrg->SetBufferView(m_objectToWorldInverseTransposeBufferIndex, currentBufferSet.m_objectToWorldInverseTransposeBuffer->GetBufferView());
+            m_sceneSrg->SetBufferView(m_objectToWorldHistoryBufferIndex, historyBufferSet.m_objectToWorldBuffer->GetBufferView());
         }
 
         void TransformServiceFeatureProcessor::OnBeginPrepareRender()
         {
             m_isWriteable = false;
 
-            if (m_historyBufferNeedsUpdate || m_deviceBufferNeedsUpdate)
-            {
-                PrepareBuffers();
-                if (m_historyBufferNeedsUpdate)
-                {
-                    m_objectToWorldHistoryBuffer->UpdateData(m_objectToWorldHistoryTransforms.data(), m_objectToWorldHistoryTransforms.size() * TransformValueSize);
-                    m_historyBufferNeedsUpdate = false;
-                }
+            // The set of the previous frame keeps the previous transforms and becomes the history.
+            m_currentBufferSetIndex = (m_currentBufferSetIndex + 1) % BufferSetCount;
+            UpdateBuffers(m_currentBufferSetIndex);
 
-                if (m_deviceBufferNeedsUpdate)
-                {
-                    // copy data to the buffers
-                    m_objectToWorldBuffer->UpdateData(m_objectToWorldTransforms.data(), m_objectToWorldTransforms.size() * TransformValueSize);
-                    m_objectToWorldInverseTransposeBuffer->UpdateData(m_objectToWorldInverseTransposeTransforms.data(), m_objectToWorldInverseTransposeTransforms.size() * NormalValueSize);
-
-                    m_objectToWorldHistoryTransforms = m_objectToWorldTransforms;
-
-                    m_deviceBufferNeedsUpdate = false;
-                    m_historyBufferNeedsUpdate = true;
-                }
+            // The history buffers only need to be updated when they were recreated, a frame without motion is better than garbage.
+            const uint32_t historyBufferSetIndex = (m_currentBufferSetIndex + BufferSetCount - 1) % BufferSetCount;
+            PrepareBuffers(m_bufferSets[historyBufferSetIndex]);
+            if (m_bufferSets[historyBufferSetIndex].m_needsFullUpload)
+            {
+                UpdateBuffers(historyBufferSetIndex);
             }
         }
 
@@ -189,7 +251,7 @@ namespace AZ
                 modelIndex = aznumeric_cast<uint32_t>(m_objectToWorldTransforms.size());
                 m_objectToWorldTransforms.push_back();
                 m_objectToWorldInverseTransposeTransforms.push_back();
-                m_objectToWorldHistoryTransforms.push_back();
+                m_pendingBufferSetMasks.push_back(0);
             }
             return ObjectId(modelIndex);
         }
@@ -218,7 +280,7 @@ namespace AZ
 
                 // Inverse transpose to take the non-uniform scale out of the transform for usage with normals.
                 matrix3x4.GetInverseFull().GetTranspose3x3().StoreToRowMajorFloat12(m_objectToWorldInverseTransposeTransforms.at(id.GetIndex()).m_transform);
-                m_deviceBufferNeedsUpdate = true;
+                MarkPending(id.GetIndex());
             }
         }
 
@@ -101,6 +101,8 @@ set(FILES
     Source/CoreLights/ShadowmapPass.cpp
     Source/CoreLights/LightCullingPass.cpp
     Source/CoreLights/LightCullingPass.h
+    Source/CoreLights/LightCullingClustersPass.cpp
+    Source/CoreLights/LightCullingClustersPass.h
     Source/CoreLights/LightCullingTilePreparePass.cpp
     Source/CoreLights/LightCullingTilePreparePass.h
     Source/CoreLights/LightCullingRemap.cpp
@@ -169,6 +171,10 @@ set(FILES
     Source/Math/MathFilter.cpp
     Source/Math/MathFilterDescriptor.h
     Source/Mesh/MeshFeatureProcessor.cpp
+    Source/Mesh/MeshIndirectCullingPass.cpp
+    Source/Mesh/MeshIndirectCullingPass.h
+    Source/Mesh/MeshIndirectDraw.cpp
+    Source/Mesh/MeshIndirectDraw.h
     Source/MorphTargets/MorphTargetComputePass.cpp
     Source/MorphTargets/MorphTargetComputePass.h
     Source/MorphTargets/MorphTargetDispatchItem.cpp
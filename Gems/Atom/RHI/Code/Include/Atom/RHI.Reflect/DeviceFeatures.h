@@ -75,6 +75,12 @@ namespace AZ
             //! Whether Unbounded Array support is available.
             bool m_unboundedArrays = false;
 
+            //! Whether streaming images can be created with sparse residency, where tiles of a mip are mapped individually.
+            bool m_sparseResidency = false;
+
+            //! Whether draw items can set a coarser shading rate than one pixel shader invocation per pixel.
+            bool m_shadingRatePerDraw = false;
+
             /// Additional features here.
         };
     }
@@ -27,7 +27,9 @@ namespace AZ
             StreamingImagePoolDescriptor() = default;
             virtual ~StreamingImagePoolDescriptor() = default;
 
-            // Currently empty.
+            //! The size of the heap backing the tiles of sparse images. Sparse images can only be created
+            //! on the pool when this is not zero.
+            size_t m_tileHeapSizeInBytes = 0;
         };
     }
 }
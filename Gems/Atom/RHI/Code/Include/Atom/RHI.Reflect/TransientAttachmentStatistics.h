@@ -79,6 +79,16 @@ namespace AZ
 
                 //! The type of resources that the heap can allocate.
                 AliasedResourceTypeFlags m_resourceTypeFlags = AliasedResourceTypeFlags::RenderTarget;
+
+                //! Number of attachments of the frame placed at the offset given by the placement plan.
+                //! The other attachments were placed with a first fit.
+                uint32_t m_plannedAttachmentCount = 0;
+
+                //! Heap size needed by the current placement plan, 0 if the heap has no plan.
+                size_t m_placementPlanPeakSize = 0;
+
+                //! Number of times the placement plan was built since the heap was created.
+                uint32_t m_placementPlanBuildCount = 0;
             };
 
             struct Scope
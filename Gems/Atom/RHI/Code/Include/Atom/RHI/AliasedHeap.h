@@ -9,9 +9,9 @@
 
 #include <Atom/RHI.Reflect/AttachmentId.h>
 #include <Atom/RHI.Reflect/TransientAttachmentStatistics.h>
+#include <Atom/RHI/AliasedHeapPlacementPlan.h>
 #include <Atom/RHI/AliasingBarrierTracker.h>
 #include <Atom/RHI/BufferPool.h>
-#include <Atom/RHI/FreeListAllocator.h>
 #include <Atom/RHI/ImagePool.h>
 #include <Atom/RHI/Object.h>
 #include <Atom/RHI/ObjectCache.h>
@@ -45,6 +45,9 @@ namespace AZ
         //! Aliased Heaps are used for allocating transient attachments (resources that are valid only during the duration of a frame).
         //! and they will reuse memory whenever possible, and will also track the necessary barriers that need to be inserted when aliasing happens.
         //! Aliased Heaps do not support aliased resources being used at the same time (even if the resources are compatible).
+        //! Resources are placed with a first fit while the heap learns the lifetimes of the attachments of a frame. The lifetimes are
+        //! then packed into an AliasedHeapPlacementPlan that is used by the following frames, until the attachments or their
+        //! lifetimes change. See r_transientAttachmentPlacement.
         class AliasedHeap
             : public ResourcePool
         {
@@ -119,11 +122,30 @@ namespace AZ
         private:
             void DeactivateResourceInternal(const AttachmentId& attachmentId, Scope& scope, AliasedResourceType type);
 
+            //! Finds a range of the heap for an attachment, using the placement plan when possible.
+            //! @return false if the attachment doesn't fit in the heap.
+            bool AllocateRange(const AttachmentId& attachmentId, size_t sizeInBytes, size_t alignmentInBytes, size_t& heapOffsetInBytes);
+
+            //! Releases a range returned by AllocateRange.
+            void DeallocateRange(size_t heapOffsetInBytes);
+
+            //! Rebuilds the placement plan from the lifetimes of this frame's attachments if they changed since the last time.
+            void UpdatePlacementPlan();
+
             /// Descriptor of the heap.
             AliasedHeapDescriptor m_descriptor;
 
-            /// First fit allocator used to allocate from placed heap.
-            FreeListAllocator m_firstFitAllocator;
+            /// Ranges of the heap used by the active attachments, sorted by offset.
+            AZStd::vector<AliasedHeapRange> m_activeRanges;
+
+            /// Placement of the attachments built from the lifetimes of a previous frame.
+            AliasedHeapPlacementPlan m_placementPlan;
+
+            /// Hash of the attachment lifetimes the placement plan was last built for.
+            HashValue64 m_placementPlanHash = HashValue64{ 0 };
+
+            /// Lifetimes of the attachments deactivated this frame, in activation order.
+            AZStd::vector<AliasedHeapPlacementRequest> m_placementRequests;
 
             /// Cache of attachments.
             ObjectCache<Resource> m_cache;
@@ -148,6 +170,7 @@ namespace AZ
                 Resource* m_resource = nullptr;
                 uint32_t m_attachmentIndex = 0;
                 Scope* m_activateScope = nullptr;
+                size_t m_alignmentInBytes = 0;
             };
 
             AZStd::unordered_map<AttachmentId, AttachmentData> m_activeAttachmentLookup;
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RHI.Reflect/AttachmentId.h>
+#include <Atom/RHI.Reflect/Base.h>
+#include <AzCore/std/containers/array_view.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    namespace RHI
+    {
+        //! The lifetime and memory requirements of a transient attachment placed on an aliased heap.
+        struct AliasedHeapPlacementRequest
+        {
+            AttachmentId m_attachmentId;
+            size_t m_sizeInBytes = 0;
+            size_t m_alignmentInBytes = 1;
+            //! Index of the first scope that uses the attachment.
+            uint32_t m_scopeIndexMin = 0;
+            //! Index of the last scope that uses the attachment.
+            uint32_t m_scopeIndexMax = 0;
+        };
+
+        //! A range of bytes [m_offsetMin, m_offsetMax) of an aliased heap.
+        struct AliasedHeapRange
+        {
+            size_t m_offsetMin = 0;
+            size_t m_offsetMax = 0;
+        };
+
+        //! Assigns heap offsets to a set of transient attachments whose lifetimes are known ahead of time.
+        //! Two attachments can share memory only if their scope intervals don't overlap, which makes this an
+        //! interval graph coloring problem where colors are byte ranges. The attachments are placed from largest to smallest,
+        //! each one at the lowest offset that doesn't collide with an already placed attachment of an overlapping lifetime.
+        //! This keeps the peak heap size close to the maximum amount of memory alive at any scope, where a first fit
+        //! in activation order fragments the heap whenever a small attachment is activated before a large one.
+        class AliasedHeapPlacementPlan
+        {
+        public:
+            AliasedHeapPlacementPlan() = default;
+
+            //! Places all the requests. Requests with an attachment id that appears more than once are ignored.
+            void Build(AZStd::array_view<AliasedHeapPlacementRequest> requests);
+
+            //! Removes all placements.
+            void Clear();
+
+            //! Returns true if the plan doesn't contain any placement.
+            bool IsEmpty() const;
+
+            //! Returns the offset in bytes of the attachment, or nullptr if the attachment is not part of the plan
+            //! or was planned with a different size or alignment.
+            const size_t* FindOffset(const AttachmentId& attachmentId, size_t sizeInBytes, size_t alignmentInBytes) const;
+
+            //! Returns the size of the heap needed by the plan.
+            size_t GetPeakSize() const;
+
+            //! Returns the number of attachments placed by the plan.
+            uint32_t GetPlacementCount() const;
+
+            //! Returns a hash of the attachments, their memory requirements and their lifetimes, in the order provided.
+            //! The same hash means the same plan can be used again.
+            static HashValue64 GetTopologyHash(AZStd::array_view<AliasedHeapPlacementRequest> requests);
+
+            //! Returns the lowest aligned offset where sizeInBytes bytes fit between ranges, or heapSizeInBytes if they don't fit.
+            //! @param ranges The ranges that are in use, sorted by m_offsetMin.
+            static size_t FindFirstFitOffset(
+                AZStd::array_view<AliasedHeapRange> ranges,
+                size_t sizeInBytes,
+                size_t alignmentInBytes,
+                size_t heapSizeInBytes);
+
+        private:
+            struct Placement
+            {
+                size_t m_offset = 0;
+                size_t m_sizeInBytes = 0;
+                size_t m_alignmentInBytes = 0;
+            };
+
+            AZStd::unordered_map<AttachmentId, Placement> m_placements;
+            size_t m_peakSize = 0;
+        };
+    }
+}
@@ -50,6 +50,10 @@ namespace AZ
             using Command = AZStd::function<void(void* commandQueue)>;
             void QueueCommand(Command command);
             void FlushCommands();
+
+            //! Returns true if commands are waiting to be processed after the one being processed.
+            //! Commands use it to batch their work with the commands that follow.
+            bool HasPendingCommands();
             
             RHI::HardwareQueueClass GetHardwareQueueClass() const;
             const CommandQueueDescriptor& GetDescriptor() const;
@@ -85,6 +85,14 @@ namespace AZ
             //! Returns the constants layout.
             const ConstantsLayout* GetLayout() const;
 
+            //! Returns the range of bytes changed since the last call to ClearDirtyInterval, as a single interval covering
+            //! all the changes. The interval is empty (m_min == m_max) when no byte changed. Assigning a value that is
+            //! already stored doesn't mark it dirty. The whole data is dirty after construction.
+            Interval GetDirtyInterval() const;
+
+            //! Marks all the constant data as up to date, typically once it has been queued for compile.
+            void ClearDirtyInterval();
+
         private:
             enum class ValidateConstantAccessExpect : uint32_t
             {
@@ -107,8 +115,12 @@ namespace AZ
             template <typename T, uint32_t matrixSize>
             bool SetConstantMatrixRows(ShaderInputConstantIndex inputIndex, const T& value, uint32_t rowCount);
 
+            //! Copies bytes to the constant data at the given offset, and adds them to the dirty interval if they changed.
+            void WriteConstantBytes(size_t offsetInBytes, const void* bytes, size_t byteCount);
+
             ConstPtr<ConstantsLayout> m_layout;
             AZStd::vector<uint8_t> m_constantData;
+            Interval m_dirtyInterval;
         };
 
         template <typename T>
@@ -174,11 +186,12 @@ namespace AZ
             if (ValidateConstantAccess(inputIndex, ValidateConstantAccessExpect::Complete, 0, sizeInBytes))
             {
                 const Interval interval = GetLayout()->GetInterval(inputIndex);
-                float* row = reinterpret_cast<float*>(&m_constantData[interval.m_min]);
-                for (uint32_t i = 0; i < rowCount; i++)
+                float rows[16];
+                for (uint32_t i = 0; i < AZStd::min(rowCount, 4u); i++)
                 {
-                    value.GetRow(i).StoreToFloat4(row + i * 4);
+                    value.GetRow(i).StoreToFloat4(rows + i * 4);
                 }
+                WriteConstantBytes(interval.m_min, rows, sizeInBytes);
 
                 return true;
             }
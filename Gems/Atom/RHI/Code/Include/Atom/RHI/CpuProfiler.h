@@ -63,6 +63,8 @@ namespace AZ
         public:
             using ThreadTimeRegionMap = AZStd::unordered_map<AZStd::string, AZStd::vector<CachedTimeRegion>>;
             using TimeRegionMap = AZStd::unordered_map<AZStd::thread_id, ThreadTimeRegionMap>;
+            //! ThreadId -> time regions in the order they ended
+            using TimelineMap = AZStd::unordered_map<AZStd::thread_id, AZStd::vector<CachedTimeRegion>>;
 
             AZ_RTTI(CpuProfiler, "{127C1D0B-BE05-4E18-A8F6-24F3EED2ECA6}");
 
@@ -86,6 +88,15 @@ namespace AZ
             virtual void SetProfilerEnabled(bool enabled) = 0;
 
             virtual bool IsProfilerEnabled() const = 0 ;
+
+            //! Enable/Disable the continuous capture. While enabled each thread records its most recent time regions
+            //! into a fixed size ring buffer, which can be retrieved at any time with GetContinuousCapture.
+            virtual void SetContinuousCaptureEnabled(bool enabled) = 0;
+
+            virtual bool IsContinuousCaptureEnabled() const = 0;
+
+            //! Copies the time regions that are currently held by the continuous capture ring buffers of all threads
+            virtual TimelineMap GetContinuousCapture() = 0;
         };
 
     } // namespace RPI
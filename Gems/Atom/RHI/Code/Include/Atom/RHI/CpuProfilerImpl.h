@@ -40,11 +40,15 @@ namespace AZ
             // Maximum stack size
             static constexpr uint32_t TimeRegionStackSize = 2048u;
 
+            // Number of time regions kept by the continuous capture ring buffer
+            static constexpr uint32_t ContinuousCaptureBufferSize = 8192u;
+
             // Adds a region to the stack, gets called each time a region begins
             void RegionStackPushBack(TimeRegion& timeRegion);
 
-            // Pops a region from the stack, gets called each time a region ends
-            void RegionStackPopBack();
+            // Pops a region from the stack, gets called each time a region ends.
+            // The region is added to the cached regions and/or the continuous capture depending on which of them are enabled.
+            void RegionStackPopBack(bool addCachedRegion, bool addContinuousCaptureRegion);
 
             // Add a new cached time region. If the stack is empty, flush all entries to the cached map
             void AddCachedRegion(CachedTimeRegion&& timeRegionCached);
@@ -52,6 +56,13 @@ namespace AZ
             // Tries to flush the map to the passed parameter, only if the thread's mutex is unlocked
             void TryFlushCachedMap(CpuProfiler::ThreadTimeRegionMap& cachedRegionMap);
 
+            // Writes a region into the continuous capture ring buffer, overwriting the oldest region when the buffer is full.
+            // Only called by the executing thread, doesn't lock or allocate once the buffer is created.
+            void AddContinuousCaptureRegion(const CachedTimeRegion& timeRegionCached);
+
+            // Copies the regions of the continuous capture ring buffer, can be called from any thread while the executing thread keeps recording
+            void CopyContinuousCapture(AZStd::vector<CachedTimeRegion>& timeRegions) const;
+
             AZStd::thread_id m_executingThreadId;
             // Keeps track of the current thread's stack depth
             uint32_t m_stackLevel = 0u;
@@ -69,6 +80,11 @@ namespace AZ
             AZStd::fixed_vector<CachedTimeRegion, TimeRegionStackSize> m_cachedTimeRegions;
             AZStd::mutex m_cachedTimeRegionMutex;
 
+            // Ring buffer of the most recent regions, lazily created when the thread records its first region in continuous capture mode
+            AZStd::vector<CachedTimeRegion, AZ::OSStdAllocator> m_continuousCaptureBuffer;
+            // Total number of regions written into the ring buffer, regions below this count are safe to read
+            AZStd::atomic_uint64_t m_continuousCaptureCount = 0;
+
             // Dirty flag which is set when the CpuProfiler's enabled state is set from false to true
             AZStd::atomic_bool m_clearContainers = false;
 
@@ -111,6 +127,9 @@ namespace AZ
             const TimeRegionMap& GetTimeRegionMap() const final;
             void SetProfilerEnabled(bool enabled) final;
             bool IsProfilerEnabled() const final;
+            void SetContinuousCaptureEnabled(bool enabled) final;
+            bool IsContinuousCaptureEnabled() const final;
+            TimelineMap GetContinuousCapture() final;
 
         private:
             // Lazily create and register the local thread data
@@ -130,6 +149,9 @@ namespace AZ
             // Enable/Disables the threads from profiling
             AZStd::atomic_bool m_enabled = false;
 
+            // Enable/Disables the threads from recording into their continuous capture ring buffer
+            AZStd::atomic_bool m_continuousCaptureEnabled = false;
+
             // This lock will only be contested when the CpuProfiler's Shutdown() method has been called
             AZStd::shared_mutex m_shutdownMutex;
 
@@ -112,6 +112,19 @@ namespace AZ
             };
         };
 
+        //! The number of pixels covered by each pixel shader invocation of a draw, width x height.
+        //! Coarser rates trade shading detail for pixel shader cost, which suits draws that are blurred or barely visible.
+        enum class ShadingRate : uint8_t
+        {
+            Rate1x1 = 0,
+            Rate1x2,
+            Rate2x1,
+            Rate2x2,
+            Rate2x4,
+            Rate4x2,
+            Rate4x4
+        };
+
         struct DrawItem
         {
             DrawItem() = default;
@@ -125,6 +138,9 @@ namespace AZ
             uint8_t m_scissorsCount = 0;
             uint8_t m_viewportsCount = 0;
 
+            /// The shading rate of the draw. It is ignored when the device doesn't support DeviceFeatures::m_shadingRatePerDraw.
+            ShadingRate m_shadingRate = ShadingRate::Rate1x1;
+
             const PipelineState* m_pipelineState = nullptr;
 
             /// The index buffer used when drawing with an indexed draw call.
@@ -31,6 +31,9 @@ namespace AZ
                 //! The stencil ref value used for this draw item.
                 uint8_t m_stencilRef = 0;
 
+                //! The shading rate used for this draw item.
+                ShadingRate m_shadingRate = ShadingRate::Rate1x1;
+
                 //! The array of stream buffers to bind for this draw item.
                 AZStd::array_view<StreamBufferView> m_streamBufferViews;
 
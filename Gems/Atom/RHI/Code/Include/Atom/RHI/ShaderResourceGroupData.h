@@ -173,6 +173,13 @@ namespace AZ
             //! Different platforms might follow different packing rules for the internally-managed SRG constant buffer.
             AZStd::array_view<uint8_t> GetConstantData() const;
 
+            //! Returns the byte range of the constant data that changed since the last call to ClearConstantDataDirtyInterval.
+            //! Platforms use it to upload only the modified constants when the group is compiled.
+            Interval GetConstantDataDirtyInterval() const;
+
+            //! Marks all the constant data as uploaded. Called once the group has been queued for compile.
+            void ClearConstantDataDirtyInterval();
+
             //! Returns the shader resource layout for this group.
             const ShaderResourceGroupLayout* GetLayout() const;
 
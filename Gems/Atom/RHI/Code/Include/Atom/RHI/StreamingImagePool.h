@@ -7,6 +7,7 @@
  */
 #pragma once
 
+#include <Atom/RHI.Reflect/Origin.h>
 #include <Atom/RHI.Reflect/StreamingImagePoolDescriptor.h>
 #include <Atom/RHI/Image.h>
 #include <Atom/RHI/ImagePoolBase.h>
@@ -66,6 +67,15 @@ namespace AZ
              * its lowest resolution. The uploads is performed synchronously.
              */
             AZStd::array_view<StreamingImageMipSlice> m_tailMipSlices;
+
+            /**
+             * Creates the image with sparse residency. Only the tail mip slices are resident after initialization,
+             * and the tiles of the other mips are made resident one region at a time with StreamingImagePool::MapImageTiles.
+             * The image views cover all the mips, and sampling a tile that isn't resident returns zero.
+             * Sparse images can't be expanded or trimmed. Requires DeviceFeatures::m_sparseResidency and a pool
+             * created with a tile heap (see StreamingImagePoolDescriptor::m_tileHeapSizeInBytes).
+             */
+            bool m_isSparse = false;
         };
 
         /**
@@ -92,6 +102,69 @@ namespace AZ
             CompleteCallback m_completeCallback;
         };
 
+        /**
+         * A box of tiles in a subresource of a sparse streaming image. The origin and size are in tiles.
+         */
+        struct StreamingImageTileRegion
+        {
+            uint32_t m_mipSlice = 0;
+            uint32_t m_arraySlice = 0;
+            Origin m_tileOrigin;
+            Size m_tileCount;
+        };
+
+        /**
+         * Describes how the mips of a sparse streaming image are split into tiles.
+         * The first m_standardMipCount mips are made of tiles that can be mapped individually.
+         * The remaining mips are packed together and are always resident.
+         */
+        struct StreamingImageTileLayout
+        {
+            /// Returns whether the region is made of tiles of a standard mip of the image.
+            bool IsRegionValid(const StreamingImageTileRegion& region) const;
+
+            /// The size of a tile in texels.
+            Size m_tileSize;
+
+            /// The size of a tile in bytes.
+            uint32_t m_tileSizeInBytes = 0;
+
+            /// The number of mips that are made of individual tiles.
+            uint32_t m_standardMipCount = 0;
+
+            /// The number of array slices of the image.
+            uint32_t m_arraySize = 0;
+
+            /// The number of tiles in each dimension of every standard mip.
+            AZStd::array<Size, Limits::Image::MipCountMax> m_mipSizeInTiles;
+        };
+
+        /**
+         * A structure used as an argument to StreamingImagePool::MapImageTiles.
+         */
+        struct StreamingImageTileRequest
+        {
+            StreamingImageTileRequest() = default;
+
+            /// The sparse image with which to map tiles.
+            Image* m_image = nullptr;
+
+            /// The region of the image to make resident.
+            StreamingImageTileRegion m_region;
+
+            /**
+             * The texels of the region, laid out as described by m_dataLayout. The data *must* remain
+             * valid for the duration of the upload (until m_completeCallback is triggered).
+             */
+            const void* m_data = nullptr;
+
+            /// The layout of m_data. The size is the size of the region in texels, clamped to the size of the mip.
+            ImageSubresourceLayout m_dataLayout;
+
+            /// A function to call when the upload is complete.
+            CompleteCallback m_completeCallback;
+        };
+
         class StreamingImagePool
             : public ImagePoolBase
         {
@@ -120,6 +193,25 @@ namespace AZ
              */
             ResultCode TrimImage(Image& image, uint32_t targetMipLevel);
 
+            /**
+             * Returns the tile layout of a sparse image. Fails if the image wasn't initialized with
+             * StreamingImageInitRequest::m_isSparse.
+             */
+            ResultCode GetImageTileLayout(const Image& image, StreamingImageTileLayout& tileLayout) const;
+
+            /**
+             * Allocates tiles for a region of a sparse image and uploads their contents asynchronously.
+             * The region reads zero until m_completeCallback is triggered.
+             */
+            ResultCode MapImageTiles(const StreamingImageTileRequest& request);
+
+            /**
+             * Releases the tiles of a region of a sparse image. This occurs immediately, and sampling the region
+             * returns zero afterwards. Callers should only unmap tiles that haven't been sampled for a few frames,
+             * since the tiles are reused by the next mapping.
+             */
+            ResultCode UnmapImageTiles(Image& image, const StreamingImageTileRegion& region);
+
             const StreamingImagePoolDescriptor& GetDescriptor() const override final;
 
         protected:
@@ -131,6 +223,7 @@ namespace AZ
 
             bool ValidateInitRequest(const StreamingImageInitRequest& initRequest) const;
             bool ValidateExpandRequest(const StreamingImageExpandRequest& expandRequest) const;
+            bool ValidateTileRegion(const Image& image, const StreamingImageTileRegion& region) const;
 
             //////////////////////////////////////////////////////////////////////////
             // Platform API
@@ -147,6 +240,15 @@ namespace AZ
             /// Called when an image mips are being trimmed.
             virtual ResultCode TrimImageInternal(Image& image, uint32_t targetMipLevel);
 
+            /// Called to query the tile layout of a sparse image.
+            virtual ResultCode GetImageTileLayoutInternal(const Image& image, StreamingImageTileLayout& tileLayout) const;
+
+            /// Called when tiles of a sparse image are being mapped.
+            virtual ResultCode MapImageTilesInternal(const StreamingImageTileRequest& request);
+
+            /// Called when tiles of a sparse image are being unmapped.
+            virtual ResultCode UnmapImageTilesInternal(Image& image, const StreamingImageTileRegion& region);
+
             //////////////////////////////////////////////////////////////////////////
 
             StreamingImagePoolDescriptor m_descriptor;
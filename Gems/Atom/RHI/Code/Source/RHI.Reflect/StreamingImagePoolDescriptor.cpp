@@ -17,7 +17,8 @@ namespace AZ
             if (SerializeContext* serializeContext = azrtti_cast<SerializeContext*>(context))
             {
                 serializeContext->Class<StreamingImagePoolDescriptor, ResourcePoolDescriptor>()
-                    ->Version(1);
+                    ->Version(2)
+                    ->Field("m_tileHeapSizeInBytes", &StreamingImagePoolDescriptor::m_tileHeapSizeInBytes);
             }
         }
     }
@@ -13,6 +13,7 @@
 #include <Atom/RHI.Reflect/TransientBufferDescriptor.h>
 #include <Atom/RHI.Reflect/TransientImageDescriptor.h>
 #include <Atom/RHI/MemoryStatisticsBuilder.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Debug/EventTrace.h>
 #include <AzCore/std/sort.h>
 
@@ -20,20 +21,30 @@ namespace AZ
 {
     namespace RHI
     {
+        AZ_CVAR(uint32_t, r_transientAttachmentPlacement, 1, nullptr, ConsoleFunctorFlags::DontReplicate,
+            "How transient attachments are placed on aliased heaps. "
+            "0: first fit in activation order. "
+            "1: pack the attachment lifetimes once, and again only when the frame graph changes. "
+            "2: pack the attachment lifetimes of every frame.");
+
         void AliasedHeap::Begin(TransientAttachmentPoolCompileFlags compileFlags)
         {
             m_totalAllocations = 0;
             m_compileFlags = compileFlags;
             m_heapStats.m_watermarkSize = 0;
+            m_heapStats.m_plannedAttachmentCount = 0;
             m_heapStats.m_attachments.clear();
+            m_placementRequests.clear();
             m_barrierTracker->Reset();
         }
 
         void AliasedHeap::End()
         {
-            AZ_Assert(m_activeAttachmentLookup.empty() && m_firstFitAllocator.GetAllocationCount() == 0,
+            AZ_Assert(m_activeAttachmentLookup.empty() && m_activeRanges.empty(),
                 "There are still active allocations.");
 
+            UpdatePlacementPlan();
+
             if (RHI::CheckBitsAny(m_compileFlags, TransientAttachmentPoolCompileFlags::GatherStatistics))
             {
                 AZStd::sort(m_heapStats.m_attachments.begin(), m_heapStats.m_attachments.end(),
@@ -71,18 +82,6 @@ namespace AZ
 
                     m_cache.SetCapacity(descriptor.m_cacheSize);
 
-                    {
-                        FreeListAllocator::Descriptor allocatorDesc;
-                        allocatorDesc.m_capacityInBytes = descriptor.m_budgetInBytes;
-                        allocatorDesc.m_garbageCollectLatency = 0;
-                        allocatorDesc.m_alignmentInBytes = descriptor.m_alignment;
-
-                        // A first-fit allocator is used because it will keep a low watermark.
-                        allocatorDesc.m_policy = FreeListAllocatorPolicy::FirstFit;
-
-                        m_firstFitAllocator.Init(allocatorDesc);
-                    }
-
                     m_heapStats.m_name = GetName();
                     m_heapStats.m_heapSize = descriptor.m_budgetInBytes;
                     m_heapStats.m_resourceTypeFlags = descriptor.m_resourceTypeMask;
@@ -96,7 +95,105 @@ namespace AZ
         {
             m_barrierTracker = nullptr;
             m_cache.Clear();
-            m_firstFitAllocator.Shutdown();
+            m_activeRanges.clear();
+            m_placementPlan.Clear();
+            m_placementPlanHash = HashValue64{ 0 };
+            m_placementRequests.clear();
+        }
+
+        bool AliasedHeap::AllocateRange(const AttachmentId& attachmentId, size_t sizeInBytes, size_t alignmentInBytes, size_t& heapOffsetInBytes)
+        {
+            auto overlapsActiveRange = [this](size_t offsetMin, size_t offsetMax)
+            {
+                for (const AliasedHeapRange& range : m_activeRanges)
+                {
+                    if (range.m_offsetMin < offsetMax && offsetMin < range.m_offsetMax)
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            };
+
+            const size_t heapSizeInBytes = m_descriptor.m_budgetInBytes;
+            const size_t* plannedOffset = r_transientAttachmentPlacement ?
+                m_placementPlan.FindOffset(attachmentId, sizeInBytes, alignmentInBytes) : nullptr;
+
+            // The planned offset can collide with an attachment that is not part of the plan when the frame graph changed this frame.
+            if (plannedOffset && *plannedOffset + sizeInBytes <= heapSizeInBytes && !overlapsActiveRange(*plannedOffset, *plannedOffset + sizeInBytes))
+            {
+                heapOffsetInBytes = *plannedOffset;
+                m_heapStats.m_plannedAttachmentCount++;
+            }
+            else
+            {
+                heapOffsetInBytes = AliasedHeapPlacementPlan::FindFirstFitOffset(m_activeRanges, sizeInBytes, alignmentInBytes, heapSizeInBytes);
+                if (heapOffsetInBytes == heapSizeInBytes)
+                {
+                    return false;
+                }
+            }
+
+            const AliasedHeapRange newRange{ heapOffsetInBytes, heapOffsetInBytes + sizeInBytes };
+            auto insertIter = AZStd::upper_bound(m_activeRanges.begin(), m_activeRanges.end(), newRange,
+                [](const AliasedHeapRange& lhs, const AliasedHeapRange& rhs)
+            {
+                return lhs.m_offsetMin < rhs.m_offsetMin;
+            });
+            m_activeRanges.insert(insertIter, newRange);
+            return true;
+        }
+
+        void AliasedHeap::DeallocateRange(size_t heapOffsetInBytes)
+        {
+            auto findIter = AZStd::find_if(m_activeRanges.begin(), m_activeRanges.end(), [heapOffsetInBytes](const AliasedHeapRange& range)
+            {
+                return range.m_offsetMin == heapOffsetInBytes;
+            });
+            AZ_Assert(findIter != m_activeRanges.end(), "Failed to find the heap range at offset %zu", heapOffsetInBytes);
+            if (findIter != m_activeRanges.end())
+            {
+                m_activeRanges.erase(findIter);
+            }
+        }
+
+        void AliasedHeap::UpdatePlacementPlan()
+        {
+            if (!r_transientAttachmentPlacement)
+            {
+                m_placementPlan.Clear();
+                m_placementPlanHash = HashValue64{ 0 };
+                return;
+            }
+
+            // The requests are in deactivation order, sort them back into activation order so the hash is stable.
+            AZStd::sort(m_placementRequests.begin(), m_placementRequests.end(),
+                [](const AliasedHeapPlacementRequest& lhs, const AliasedHeapPlacementRequest& rhs)
+            {
+                if (lhs.m_scopeIndexMin == rhs.m_scopeIndexMin)
+                {
+                    return lhs.m_attachmentId.GetHash() < rhs.m_attachmentId.GetHash();
+                }
+                return lhs.m_scopeIndexMin < rhs.m_scopeIndexMin;
+            });
+
+            const HashValue64 topologyHash = AliasedHeapPlacementPlan::GetTopologyHash(m_placementRequests);
+            if (topologyHash == m_placementPlanHash && r_transientAttachmentPlacement == 1)
+            {
+                return;
+            }
+            m_placementPlanHash = topologyHash;
+
+            m_placementPlan.Build(m_placementRequests);
+            m_heapStats.m_placementPlanBuildCount++;
+
+            // Only keep the plan if it does better than what the first fit did this frame.
+            const size_t planPeakSize = m_placementPlan.GetPeakSize();
+            if (planPeakSize > m_descriptor.m_budgetInBytes || planPeakSize > m_heapStats.m_watermarkSize)
+            {
+                m_placementPlan.Clear();
+            }
+            m_heapStats.m_placementPlanPeakSize = m_placementPlan.GetPeakSize();
         }
 
         ResultCode AliasedHeap::ActivateBuffer(
@@ -106,14 +203,13 @@ namespace AZ
         {
             ResourceMemoryRequirements memRequirements = GetDevice().GetResourceMemoryRequirements(descriptor.m_bufferDescriptor);
             
-            const size_t alignmentInBytes = memRequirements.m_alignmentInBytes;
-            RHI::VirtualAddress address = m_firstFitAllocator.Allocate(memRequirements.m_sizeInBytes, alignmentInBytes);
-            if (address.IsNull())
+            const size_t alignmentInBytes = AZStd::max(static_cast<size_t>(memRequirements.m_alignmentInBytes), m_descriptor.m_alignment);
+            size_t heapOffsetInBytes = 0;
+            if (!AllocateRange(descriptor.m_attachmentId, memRequirements.m_sizeInBytes, alignmentInBytes, heapOffsetInBytes))
             {
                 return ResultCode::OutOfMemory;
             }
 
-            const size_t heapOffsetInBytes = address.m_ptr;
             m_heapStats.m_watermarkSize = AZStd::max(m_heapStats.m_watermarkSize, heapOffsetInBytes + static_cast<size_t>(memRequirements.m_sizeInBytes));
 
             Buffer* buffer = nullptr;
@@ -158,7 +254,7 @@ namespace AZ
             }
 
             const uint32_t attachmentIndex = static_cast<uint32_t>(m_heapStats.m_attachments.size());
-            m_activeAttachmentLookup.emplace(descriptor.m_attachmentId, AttachmentData{ buffer, attachmentIndex, &scope });
+            m_activeAttachmentLookup.emplace(descriptor.m_attachmentId, AttachmentData{ buffer, attachmentIndex, &scope, alignmentInBytes });
             m_heapStats.m_attachments.emplace_back();
 
             RHI::TransientAttachmentStatistics::Attachment& attachment = m_heapStats.m_attachments.back();
@@ -210,9 +306,15 @@ namespace AZ
                 m_barrierTracker->AddResource(aliasedResource);
             }
             
-            const VirtualAddress heapAddress{attachment.m_heapOffsetMin};
-            m_firstFitAllocator.DeAllocate(heapAddress);
-            m_firstFitAllocator.GarbageCollectForce();
+            AliasedHeapPlacementRequest placementRequest;
+            placementRequest.m_attachmentId = attachmentId;
+            placementRequest.m_sizeInBytes = attachment.m_sizeInBytes;
+            placementRequest.m_alignmentInBytes = attachmentData.m_alignmentInBytes;
+            placementRequest.m_scopeIndexMin = static_cast<uint32_t>(attachment.m_scopeOffsetMin);
+            placementRequest.m_scopeIndexMax = static_cast<uint32_t>(attachment.m_scopeOffsetMax);
+            m_placementRequests.push_back(placementRequest);
+
+            DeallocateRange(attachment.m_heapOffsetMin);
             m_activeAttachmentLookup.erase(findIter);
         }
 
@@ -220,13 +322,13 @@ namespace AZ
         {
             ResourceMemoryRequirements memRequirements = GetDevice().GetResourceMemoryRequirements(descriptor.m_imageDescriptor);
 
-            VirtualAddress address = m_firstFitAllocator.Allocate(memRequirements.m_sizeInBytes, memRequirements.m_alignmentInBytes);
-            if (address.IsNull())
+            const size_t alignmentInBytes = AZStd::max(static_cast<size_t>(memRequirements.m_alignmentInBytes), m_descriptor.m_alignment);
+            size_t heapOffsetInBytes = 0;
+            if (!AllocateRange(descriptor.m_attachmentId, memRequirements.m_sizeInBytes, alignmentInBytes, heapOffsetInBytes))
             {
                 return ResultCode::OutOfMemory;
             }
 
-            const size_t heapOffsetInBytes = address.m_ptr;
             m_heapStats.m_watermarkSize = AZStd::max(m_heapStats.m_watermarkSize, heapOffsetInBytes + static_cast<size_t>(memRequirements.m_sizeInBytes));
 
             Image* image = nullptr;
@@ -273,7 +375,7 @@ namespace AZ
             const size_t sizeInBytes = memRequirements.m_sizeInBytes;
 
             const uint32_t attachmentIndex = static_cast<uint32_t>(m_heapStats.m_attachments.size());
-            m_activeAttachmentLookup.emplace(descriptor.m_attachmentId, AttachmentData{ image, attachmentIndex, &scope });
+            m_activeAttachmentLookup.emplace(descriptor.m_attachmentId, AttachmentData{ image, attachmentIndex, &scope, alignmentInBytes });
             m_heapStats.m_attachments.emplace_back();
 
             RHI::TransientAttachmentStatistics::Attachment& attachment = m_heapStats.m_attachments.back();
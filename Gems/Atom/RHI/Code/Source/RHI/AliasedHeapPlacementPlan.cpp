@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <Atom/RHI/AliasedHeapPlacementPlan.h>
+#include <AzCore/Utils/TypeHash.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/sort.h>
+
+namespace AZ
+{
+    namespace RHI
+    {
+        void AliasedHeapPlacementPlan::Build(AZStd::array_view<AliasedHeapPlacementRequest> requests)
+        {
+            Clear();
+
+            AZStd::vector<const AliasedHeapPlacementRequest*> sortedRequests;
+            sortedRequests.reserve(requests.size());
+            for (const AliasedHeapPlacementRequest& request : requests)
+            {
+                sortedRequests.push_back(&request);
+            }
+
+            // Largest attachments first, so the small ones fill the gaps left between them.
+            AZStd::sort(sortedRequests.begin(), sortedRequests.end(),
+                [](const AliasedHeapPlacementRequest* lhs, const AliasedHeapPlacementRequest* rhs)
+            {
+                if (lhs->m_sizeInBytes == rhs->m_sizeInBytes)
+                {
+                    return lhs->m_scopeIndexMin < rhs->m_scopeIndexMin;
+                }
+                return lhs->m_sizeInBytes > rhs->m_sizeInBytes;
+            });
+
+            AZStd::vector<const AliasedHeapPlacementRequest*> placedRequests;
+            placedRequests.reserve(sortedRequests.size());
+            AZStd::vector<AliasedHeapRange> collidingRanges;
+            for (const AliasedHeapPlacementRequest* request : sortedRequests)
+            {
+                if (m_placements.find(request->m_attachmentId) != m_placements.end())
+                {
+                    continue;
+                }
+
+                collidingRanges.clear();
+                for (const AliasedHeapPlacementRequest* placedRequest : placedRequests)
+                {
+                    const bool lifetimesOverlap =
+                        placedRequest->m_scopeIndexMin <= request->m_scopeIndexMax &&
+                        request->m_scopeIndexMin <= placedRequest->m_scopeIndexMax;
+                    if (lifetimesOverlap)
+                    {
+                        const size_t offset = m_placements[placedRequest->m_attachmentId].m_offset;
+                        collidingRanges.push_back({ offset, offset + placedRequest->m_sizeInBytes });
+                    }
+                }
+
+                AZStd::sort(collidingRanges.begin(), collidingRanges.end(),
+                    [](const AliasedHeapRange& lhs, const AliasedHeapRange& rhs)
+                {
+                    return lhs.m_offsetMin < rhs.m_offsetMin;
+                });
+
+                const size_t offset = FindFirstFitOffset(
+                    collidingRanges, request->m_sizeInBytes, request->m_alignmentInBytes, AZStd::numeric_limits<size_t>::max());
+
+                m_placements.emplace(request->m_attachmentId, Placement{ offset, request->m_sizeInBytes, request->m_alignmentInBytes });
+                m_peakSize = AZStd::max(m_peakSize, offset + request->m_sizeInBytes);
+                placedRequests.push_back(request);
+            }
+        }
+
+        void AliasedHeapPlacementPlan::Clear()
+        {
+            m_placements.clear();
+            m_peakSize = 0;
+        }
+
+        bool AliasedHeapPlacementPlan::IsEmpty() const
+        {
+            return m_placements.empty();
+        }
+
+        const size_t* AliasedHeapPlacementPlan::FindOffset(const AttachmentId& attachmentId, size_t sizeInBytes, size_t alignmentInBytes) const
+        {
+            auto findIter = m_placements.find(attachmentId);
+            if (findIter == m_placements.end() ||
+                findIter->second.m_sizeInBytes != sizeInBytes ||
+                findIter->second.m_alignmentInBytes != alignmentInBytes)
+            {
+                return nullptr;
+            }
+            return &findIter->second.m_offset;
+        }
+
+        size_t AliasedHeapPlacementPlan::GetPeakSize() const
+        {
+            return m_peakSize;
+        }
+
+        uint32_t AliasedHeapPlacementPlan::GetPlacementCount() const
+        {
+            return static_cast<uint32_t>(m_placements.size());
+        }
+
+        HashValue64 AliasedHeapPlacementPlan::GetTopologyHash(AZStd::array_view<AliasedHeapPlacementRequest> requests)
+        {
+            HashValue64 hash = HashValue64{ 0 };
+            for (const AliasedHeapPlacementRequest& request : requests)
+            {
+                hash = TypeHash64(request.m_attachmentId.GetHash(), hash);
+                hash = TypeHash64(request.m_sizeInBytes, hash);
+                hash = TypeHash64(request.m_alignmentInBytes, hash);
+                hash = TypeHash64(request.m_scopeIndexMin, hash);
+                hash = TypeHash64(request.m_scopeIndexMax, hash);
+            }
+            return hash;
+        }
+
+        size_t AliasedHeapPlacementPlan::FindFirstFitOffset(
+            AZStd::array_view<AliasedHeapRange> ranges,
+            size_t sizeInBytes,
+            size_t alignmentInBytes,
+            size_t heapSizeInBytes)
+        {
+            size_t offset = 0;
+            for (const AliasedHeapRange& range : ranges)
+            {
+                if (offset + sizeInBytes <= range.m_offsetMin)
+                {
+                    break;
+                }
+                offset = AZStd::max(offset, RHI::AlignUp(range.m_offsetMax, alignmentInBytes));
+            }
+
+            if (sizeInBytes > heapSizeInBytes || offset > heapSizeInBytes - sizeInBytes)
+            {
+                return heapSizeInBytes;
+            }
+            return offset;
+        }
+    }
+}
@@ -90,6 +90,12 @@ namespace AZ
             }
         }
         
+        bool CommandQueue::HasPendingCommands()
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_workQueueMutex);
+            return !m_workQueue.empty();
+        }
+
         void CommandQueue::ProcessQueue()
         {
             //runs forever in a background thread
@@ -19,6 +19,7 @@ namespace AZ
             if (m_layout->GetDataSize() > 0)
             {
                 m_constantData.resize(m_layout->GetDataSize());
+                m_dirtyInterval = Interval(0, m_layout->GetDataSize());
             }
         }
 
@@ -94,6 +95,32 @@ namespace AZ
             return true;
         }
 
+        void ConstantsData::WriteConstantBytes(size_t offsetInBytes, const void* bytes, size_t byteCount)
+        {
+            if (byteCount == 0)
+            {
+                return;
+            }
+
+            uint8_t* destination = &m_constantData[offsetInBytes];
+            if (memcmp(destination, bytes, byteCount) != 0)
+            {
+                memcpy(destination, bytes, byteCount);
+
+                const uint32_t offsetMin = static_cast<uint32_t>(offsetInBytes);
+                const uint32_t offsetMax = static_cast<uint32_t>(offsetInBytes + byteCount);
+                if (m_dirtyInterval.m_min == m_dirtyInterval.m_max)
+                {
+                    m_dirtyInterval = Interval(offsetMin, offsetMax);
+                }
+                else
+                {
+                    m_dirtyInterval.m_min = AZStd::min(m_dirtyInterval.m_min, offsetMin);
+                    m_dirtyInterval.m_max = AZStd::max(m_dirtyInterval.m_max, offsetMax);
+                }
+            }
+        }
+
         bool ConstantsData::SetConstantRaw(ShaderInputConstantIndex inputIndex, const void* bytes, size_t byteCount)
         {
             return SetConstantRaw(inputIndex, bytes, 0, byteCount);
@@ -104,7 +131,7 @@ namespace AZ
             if (ValidateConstantAccess(inputIndex, ValidateConstantAccessExpect::LessThan, byteOffset, byteCount))
             {
                 const Interval interval = GetLayout()->GetInterval(inputIndex);
-                memcpy(&m_constantData[interval.m_min + byteOffset], bytes, byteCount);
+                WriteConstantBytes(interval.m_min + byteOffset, bytes, byteCount);
                 return true;
             }
             return false;
@@ -114,7 +141,7 @@ namespace AZ
         {
             if (ValidateConstantBufferAccess(0, byteCount))
             {
-                memcpy(m_constantData.data(), bytes, byteCount);
+                WriteConstantBytes(0, bytes, byteCount);
                 return true;
             }
             return false;
@@ -124,7 +151,7 @@ namespace AZ
         {
             if (ValidateConstantBufferAccess(byteOffset, byteCount))
             {
-                memcpy(&m_constantData[byteOffset], bytes, byteCount);
+                WriteConstantBytes(byteOffset, bytes, byteCount);
                 return true;
             }
             return false;
@@ -186,8 +213,9 @@ namespace AZ
             {
                 // Store the matrix into row major order
                 const Interval interval = GetLayout()->GetInterval(inputIndex);
-                float* matrixValue = reinterpret_cast<float*>(&m_constantData[interval.m_min]);
+                float matrixValue[12];
                 transform.StoreToRowMajorFloat12(matrixValue);
+                WriteConstantBytes(interval.m_min, matrixValue, sizeInBytes);
 
                 return true;
             }
@@ -202,8 +230,9 @@ namespace AZ
             {
                 // Store the matrix into row major order
                 const Interval interval = GetLayout()->GetInterval(inputIndex);
-                float* matrixValue = reinterpret_cast<float*>(&m_constantData[interval.m_min]);
+                float matrixValue[12];
                 value.StoreToRowMajorFloat12(matrixValue);
+                WriteConstantBytes(interval.m_min, matrixValue, sizeInBytes);
 
                 return true;
             }
@@ -218,8 +247,9 @@ namespace AZ
             {
                 // Store the matrix into row major order
                 const Interval interval = GetLayout()->GetInterval(inputIndex);
-                float* matrixValue = reinterpret_cast<float*>(&m_constantData[interval.m_min]);
+                float matrixValue[16];
                 value.StoreToRowMajorFloat16(matrixValue);
+                WriteConstantBytes(interval.m_min, matrixValue, sizeInBytes);
 
                 return true;
 
@@ -234,8 +264,9 @@ namespace AZ
             if (ValidateConstantAccess(inputIndex, ValidateConstantAccessExpect::Complete, 0, aznumeric_caster(sizeOfVector2)))
             {
                 const Interval interval = GetLayout()->GetInterval(inputIndex);
-                float* vectorValue = reinterpret_cast<float*>(&m_constantData[interval.m_min]);
+                float vectorValue[2];
                 value.StoreToFloat2(vectorValue);
+                WriteConstantBytes(interval.m_min, vectorValue, sizeOfVector2);
 
                 return true;
             }
@@ -250,8 +281,9 @@ namespace AZ
             if (ValidateConstantAccess(inputIndex, ValidateConstantAccessExpect::Complete, 0, sizeInBytes))
             {
                 const Interval interval = GetLayout()->GetInterval(inputIndex);
-                float* vectorValue = reinterpret_cast<float*>(&m_constantData[interval.m_min]);
+                float vectorValue[3];
                 value.StoreToFloat3(vectorValue);
+                WriteConstantBytes(interval.m_min, vectorValue, sizeInBytes);
 
                 return true;
             }
@@ -265,8 +297,9 @@ namespace AZ
             if (ValidateConstantAccess(inputIndex, ValidateConstantAccessExpect::Complete, 0, aznumeric_caster(sizeOfVector4)))
             {
                 const Interval interval = GetLayout()->GetInterval(inputIndex);
-                float* vectorValue = reinterpret_cast<float*>(&m_constantData[interval.m_min]);
+                float vectorValue[4];
                 value.StoreToFloat4(vectorValue);
+                WriteConstantBytes(interval.m_min, vectorValue, sizeOfVector4);
 
                 return true;
             }
@@ -395,6 +428,16 @@ namespace AZ
             return AZStd::array_view<uint8_t>(&m_constantData[interval.m_min], interval.m_max - interval.m_min);
         }
 
+        Interval ConstantsData::GetDirtyInterval() const
+        {
+            return m_dirtyInterval;
+        }
+
+        void ConstantsData::ClearDirtyInterval()
+        {
+            m_dirtyInterval = Interval();
+        }
+
         AZStd::array_view<uint8_t> ConstantsData::GetConstantData() const
         {
             return m_constantData;
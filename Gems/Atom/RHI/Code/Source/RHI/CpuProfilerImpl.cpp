@@ -8,6 +8,7 @@
 
 #include <Atom/RHI/CpuProfilerImpl.h>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 
@@ -20,6 +21,17 @@ namespace AZ
     {
         thread_local CpuTimingLocalStorage* CpuProfilerImpl::ms_threadLocalStorage = nullptr;
 
+        static void OnContinuousCaptureChanged(const bool& enabled)
+        {
+            if (CpuProfiler* cpuProfiler = CpuProfiler::Get())
+            {
+                cpuProfiler->SetContinuousCaptureEnabled(enabled);
+            }
+        }
+
+        AZ_CVAR(bool, r_cpuProfilerContinuousCapture, false, OnContinuousCaptureChanged, ConsoleFunctorFlags::Null,
+            "Records the most recent time regions of every thread into a ring buffer, so they can be saved after a hitch");
+
         // --- CpuProfiler ---
 
         CpuProfiler* CpuProfiler::Get()
@@ -81,6 +93,8 @@ namespace AZ
             Interface<CpuProfiler>::Register(this);
             m_initialized = true;
             SystemTickBus::Handler::BusConnect();
+
+            SetContinuousCaptureEnabled(r_cpuProfilerContinuousCapture);
         }
 
         void CpuProfilerImpl::Shutdown()
@@ -96,6 +110,7 @@ namespace AZ
             AZStd::unique_lock<AZStd::shared_mutex> shutdownLock(m_shutdownMutex);
 
             m_enabled = false;
+            m_continuousCaptureEnabled = false;
 
             // Cleanup all TLS
             m_registeredThreads.clear();
@@ -109,7 +124,7 @@ namespace AZ
             // Try to lock here, the shutdownMutex will only be contested when the CpuProfiler is shutting down.
             if (m_shutdownMutex.try_lock_shared())
             {
-                if (m_enabled)
+                if (m_enabled || m_continuousCaptureEnabled)
                 {
                     // Lazy initialization, creates an instance of the Thread local data if it's not created, and registers it
                     RegisterThreadStorage();
@@ -127,9 +142,12 @@ namespace AZ
             // Try to lock here, the shutdownMutex will only be contested when the CpuProfiler is shutting down.
             if (m_shutdownMutex.try_lock_shared())
             {
-                if (m_enabled)
+                const bool enabled = m_enabled;
+                const bool continuousCaptureEnabled = m_continuousCaptureEnabled;
+                // The thread storage doesn't exist yet when profiling was enabled while the region was running
+                if ((enabled || continuousCaptureEnabled) && ms_threadLocalStorage)
                 {
-                    ms_threadLocalStorage->RegionStackPopBack();
+                    ms_threadLocalStorage->RegionStackPopBack(enabled, continuousCaptureEnabled);
                 }
 
                 m_shutdownMutex.unlock_shared();
@@ -151,8 +169,8 @@ namespace AZ
                 return;
             }
 
-            // Set the dirty flag in all the TLS to clear the caches
-            if (enabled)
+            // Set the dirty flag in all the TLS to clear the caches, unless the continuous capture kept the threads recording
+            if (enabled && !m_continuousCaptureEnabled)
             {
                 // Iterate through all the threads, and set the clearing flag
                 for (auto& threadLocal : m_registeredThreads)
@@ -173,6 +191,44 @@ namespace AZ
             return m_enabled;
         }
 
+        void CpuProfilerImpl::SetContinuousCaptureEnabled(bool enabled)
+        {
+            AZStd::unique_lock<AZStd::mutex> lock(m_threadRegisterMutex);
+
+            if (m_continuousCaptureEnabled == enabled)
+            {
+                return;
+            }
+
+            // Threads that weren't recording might have stale regions on their stack, flag them to clear it
+            if (enabled && !m_enabled)
+            {
+                for (auto& threadLocal : m_registeredThreads)
+                {
+                    threadLocal->m_clearContainers = true;
+                }
+            }
+
+            m_continuousCaptureEnabled = enabled;
+        }
+
+        bool CpuProfilerImpl::IsContinuousCaptureEnabled() const
+        {
+            return m_continuousCaptureEnabled;
+        }
+
+        CpuProfiler::TimelineMap CpuProfilerImpl::GetContinuousCapture()
+        {
+            AZStd::unique_lock<AZStd::mutex> lock(m_threadRegisterMutex);
+
+            TimelineMap timelineMap;
+            for (auto& threadLocal : m_registeredThreads)
+            {
+                threadLocal->CopyContinuousCapture(timelineMap[threadLocal->m_executingThreadId]);
+            }
+            return timelineMap;
+        }
+
         void CpuProfilerImpl::OnSystemTick()
         {
             if (!m_enabled)
@@ -246,7 +302,7 @@ namespace AZ
             timeRegion.m_startTick = AZStd::GetTimeNowTicks();
         }
 
-        void CpuTimingLocalStorage::RegionStackPopBack()
+        void CpuTimingLocalStorage::RegionStackPopBack(bool addCachedRegion, bool addContinuousCaptureRegion)
         {
             // Early out when the stack is empty, this might happen when the profiler was enabled while the thread encountered profiling markers
             if (m_timeRegionStack.empty())
@@ -267,8 +323,18 @@ namespace AZ
             // Decrement the stack
             m_stackLevel--;
 
+            CachedTimeRegion timeRegionCached(back->m_groupRegionName, back->m_stackDepth, back->m_startTick, back->m_endTick);
+
+            if (addContinuousCaptureRegion)
+            {
+                AddContinuousCaptureRegion(timeRegionCached);
+            }
+
             // Add an entry to the cached region
-            AddCachedRegion(CachedTimeRegion(back->m_groupRegionName, back->m_stackDepth, back->m_startTick, back->m_endTick));
+            if (addCachedRegion)
+            {
+                AddCachedRegion(AZStd::move(timeRegionCached));
+            }
         }
 
         // Gets called when region ends and all data is set
@@ -323,5 +389,47 @@ namespace AZ
                 m_cachedTimeRegionMutex.unlock();
             }
         }
+
+        void CpuTimingLocalStorage::AddContinuousCaptureRegion(const CachedTimeRegion& timeRegionCached)
+        {
+            // Only threads that are profiled pay for the ring buffer
+            if (m_continuousCaptureBuffer.empty())
+            {
+                m_continuousCaptureBuffer.resize(ContinuousCaptureBufferSize);
+            }
+
+            const uint64_t count = m_continuousCaptureCount.load(AZStd::memory_order_relaxed);
+            m_continuousCaptureBuffer[count % ContinuousCaptureBufferSize] = timeRegionCached;
+
+            // Publish the region, readers only copy the regions below the count
+            m_continuousCaptureCount.store(count + 1, AZStd::memory_order_release);
+        }
+
+        void CpuTimingLocalStorage::CopyContinuousCapture(AZStd::vector<CachedTimeRegion>& timeRegions) const
+        {
+            const uint64_t endCount = m_continuousCaptureCount.load(AZStd::memory_order_acquire);
+            if (endCount == 0)
+            {
+                return;
+            }
+
+            const uint64_t beginCount = endCount > ContinuousCaptureBufferSize ? endCount - ContinuousCaptureBufferSize : 0;
+            timeRegions.reserve(timeRegions.size() + (endCount - beginCount));
+            const size_t firstCopiedIndex = timeRegions.size();
+            for (uint64_t index = beginCount; index < endCount; ++index)
+            {
+                timeRegions.push_back(m_continuousCaptureBuffer[index % ContinuousCaptureBufferSize]);
+            }
+
+            // The executing thread keeps recording while the regions are copied. Every slot up to and including the one that
+            // is currently being written might have been overwritten during the copy, so those regions are dropped.
+            AZStd::atomic_thread_fence(AZStd::memory_order_acquire);
+            const uint64_t writtenCount = m_continuousCaptureCount.load(AZStd::memory_order_relaxed);
+            if (writtenCount + 1 > beginCount + ContinuousCaptureBufferSize)
+            {
+                const uint64_t overwrittenCount = AZStd::min(writtenCount + 1 - ContinuousCaptureBufferSize - beginCount, endCount - beginCount);
+                timeRegions.erase(timeRegions.begin() + firstCopiedIndex, timeRegions.begin() + firstCopiedIndex + overwrittenCount);
+            }
+        }
     }
 }
@@ -235,6 +235,7 @@ namespace AZ
                 DrawItem& drawItem = drawItems[i];
                 drawItem.m_arguments = m_drawArguments;
                 drawItem.m_stencilRef = drawRequest.m_stencilRef;
+                drawItem.m_shadingRate = drawRequest.m_shadingRate;
                 drawItem.m_streamBufferViewCount = 0;
                 drawItem.m_shaderResourceGroupCount = drawPacket->m_shaderResourceGroupCount;
                 drawItem.m_rootConstantSize = drawPacket->m_rootConstantSize;
@@ -19,6 +19,7 @@
 #include <Atom/RHI/SwapChain.h>
 #include <Atom/RHI/SwapChainFrameAttachment.h>
 #include <AzCore/Debug/EventTrace.h>
+#include <AzCore/std/limits.h>
 #include <AzCore/std/sort.h>
 
 namespace AZ
@@ -465,6 +466,7 @@ namespace AZ
             }
 
             uint16_t groupCount = 0;
+            bool hasAsyncComputeScopes = false;
             // This loop will add all unblocked nodes, i.e. nodes that don't have any producers. This
             // includes the root node.
             for (size_t nodeIndex = 0; nodeIndex < m_graphNodes.size(); ++nodeIndex)
@@ -474,16 +476,49 @@ namespace AZ
                 {
                     unblockedNodes.push_back({ static_cast<uint16_t>(nodeIndex), groupCount++ });
                 }
+                hasAsyncComputeScopes |= graphNode.m_scope->GetHardwareQueueClass() == HardwareQueueClass::Compute;
             }
 
+            // Returns the position of the next node to sort in unblockedNodes.
+            // Compute scopes are sorted as soon as they are unblocked, so they are submitted to the compute queue ahead of the graphics
+            // scopes which don't depend on them (like shadow and depth rasterization) and run in parallel with them, instead of being
+            // fenced by graphics work that was only sorted before them by chance. Nodes that continue the group of the last sorted
+            // node are never jumped over, since the nodes of a group have to stay together.
+            uint16_t lastGroupId = AZStd::numeric_limits<uint16_t>::max();
+            const auto findNextUnblockedNode = [&]() -> size_t
+            {
+                const size_t backIndex = unblockedNodes.size() - 1;
+                if (!hasAsyncComputeScopes ||
+                    m_graphNodes[unblockedNodes[backIndex].m_nodeIndex].m_scope->GetHardwareQueueClass() == HardwareQueueClass::Compute)
+                {
+                    return backIndex;
+                }
+
+                size_t computeIndex = backIndex;
+                for (size_t index = 0; index < unblockedNodes.size(); ++index)
+                {
+                    if (unblockedNodes[index].m_groupId == lastGroupId)
+                    {
+                        return backIndex;
+                    }
+                    if (m_graphNodes[unblockedNodes[index].m_nodeIndex].m_scope->GetHardwareQueueClass() == HardwareQueueClass::Compute)
+                    {
+                        computeIndex = index;
+                    }
+                }
+                return computeIndex;
+            };
+
             // Process nodes that don't have any producers left (they have already been processed).
             // They get added to the unblockedNodes vector in a topological manner.
             while (!unblockedNodes.empty())
             {
-                const NodeId& producerNodeId = unblockedNodes.back();
+                const size_t nextIndex = findNextUnblockedNode();
+                const NodeId producerNodeId = unblockedNodes[nextIndex];
                 const uint16_t producerIndex = producerNodeId.m_nodeIndex;
                 const uint16_t producerGroupId = producerNodeId.m_groupId;
-                unblockedNodes.pop_back();
+                unblockedNodes.erase(unblockedNodes.begin() + nextIndex);
+                lastGroupId = producerGroupId;
 
                 const uint32_t scopeIndexNext = aznumeric_caster(m_scopes.size());
 
@@ -335,5 +335,15 @@ namespace AZ
             return m_constantsData.GetConstantData();
         }
 
+        Interval ShaderResourceGroupData::GetConstantDataDirtyInterval() const
+        {
+            return m_constantsData.GetDirtyInterval();
+        }
+
+        void ShaderResourceGroupData::ClearConstantDataDirtyInterval()
+        {
+            m_constantsData.ClearDirtyInterval();
+        }
+
     } // namespace RHI
 } // namespace AZ
@@ -6,6 +6,7 @@
  *
  */
 #include <Atom/RHI/StreamingImagePool.h>
+#include <Atom/RHI/Device.h>
 
 #include <AzCore/Debug/EventTrace.h>
 
@@ -21,6 +22,21 @@ namespace AZ
             , m_descriptor{descriptor}
             , m_tailMipSlices{tailMipSlices}
         {}
+
+        bool StreamingImageTileLayout::IsRegionValid(const StreamingImageTileRegion& region) const
+        {
+            if (region.m_mipSlice >= m_standardMipCount || region.m_arraySlice >= m_arraySize)
+            {
+                return false;
+            }
+
+            const Size& mipSizeInTiles = m_mipSizeInTiles[region.m_mipSlice];
+            return
+                region.m_tileCount.m_width > 0 && region.m_tileCount.m_height > 0 && region.m_tileCount.m_depth > 0 &&
+                region.m_tileOrigin.m_left + region.m_tileCount.m_width <= mipSizeInTiles.m_width &&
+                region.m_tileOrigin.m_top + region.m_tileCount.m_height <= mipSizeInTiles.m_height &&
+                region.m_tileOrigin.m_front + region.m_tileCount.m_depth <= mipSizeInTiles.m_depth;
+        }
         
         bool StreamingImagePool::ValidateInitRequest(const StreamingImageInitRequest& initRequest) const
         {
@@ -46,6 +62,12 @@ namespace AZ
                     AZ_Error("StreamingImagePool", false, "Streaming images may only contain read-only bind flags.");
                     return false;
                 }
+
+                if (initRequest.m_isSparse && !GetDevice().GetFeatures().m_sparseResidency)
+                {
+                    AZ_Error("StreamingImagePool", false, "Sparse streaming images are not supported by the device.");
+                    return false;
+                }
             }
 
             AZ_UNUSED(initRequest);
@@ -72,6 +94,34 @@ namespace AZ
             return true;
         }
 
+        bool StreamingImagePool::ValidateTileRegion(const Image& image, const StreamingImageTileRegion& region) const
+        {
+            if (Validation::IsEnabled())
+            {
+                if (!ValidateIsRegistered(&image))
+                {
+                    return false;
+                }
+
+                StreamingImageTileLayout tileLayout;
+                if (GetImageTileLayoutInternal(image, tileLayout) != ResultCode::Success)
+                {
+                    AZ_Error("StreamingImagePool", false, "Image '%s' is not a sparse image.", image.GetName().GetCStr());
+                    return false;
+                }
+
+                if (!tileLayout.IsRegionValid(region))
+                {
+                    AZ_Error("StreamingImagePool", false, "Tile region is outside of the standard mips of image '%s'.", image.GetName().GetCStr());
+                    return false;
+                }
+            }
+
+            AZ_UNUSED(image);
+            AZ_UNUSED(region);
+            return true;
+        }
+
         ResultCode StreamingImagePool::Init(Device& device, const StreamingImagePoolDescriptor& descriptor)
         {
             AZ_TRACE_METHOD();
@@ -115,8 +165,9 @@ namespace AZ
 
             if (resultCode == ResultCode::Success)
             {
-                // If initialization succeeded, assign the new resident mip level.
-                initRequest.m_image->m_residentMipLevel = static_cast<uint32_t>(initRequest.m_descriptor.m_mipLevels - initRequest.m_tailMipSlices.size());
+                // If initialization succeeded, assign the new resident mip level. The views of sparse images cover all the mips.
+                initRequest.m_image->m_residentMipLevel = initRequest.m_isSparse ? 0 :
+                    static_cast<uint32_t>(initRequest.m_descriptor.m_mipLevels - initRequest.m_tailMipSlices.size());
             }
 
             AZ_Warning("StreamingImagePool", resultCode == ResultCode::Success, "Failed to initialize image.");
@@ -171,6 +222,51 @@ namespace AZ
             return RHI::ResultCode::Success;
         }
 
+        ResultCode StreamingImagePool::GetImageTileLayout(const Image& image, StreamingImageTileLayout& tileLayout) const
+        {
+            if (!ValidateIsInitialized())
+            {
+                return ResultCode::InvalidOperation;
+            }
+
+            if (!ValidateIsRegistered(&image))
+            {
+                return ResultCode::InvalidArgument;
+            }
+
+            return GetImageTileLayoutInternal(image, tileLayout);
+        }
+
+        ResultCode StreamingImagePool::MapImageTiles(const StreamingImageTileRequest& request)
+        {
+            if (!ValidateIsInitialized())
+            {
+                return ResultCode::InvalidOperation;
+            }
+
+            if (!request.m_image || !request.m_data || !ValidateTileRegion(*request.m_image, request.m_region))
+            {
+                return ResultCode::InvalidArgument;
+            }
+
+            return MapImageTilesInternal(request);
+        }
+
+        ResultCode StreamingImagePool::UnmapImageTiles(Image& image, const StreamingImageTileRegion& region)
+        {
+            if (!ValidateIsInitialized())
+            {
+                return ResultCode::InvalidOperation;
+            }
+
+            if (!ValidateTileRegion(image, region))
+            {
+                return ResultCode::InvalidArgument;
+            }
+
+            return UnmapImageTilesInternal(image, region);
+        }
+
         const StreamingImagePoolDescriptor& StreamingImagePool::GetDescriptor() const
         {
             return m_descriptor;
@@ -195,5 +291,20 @@ namespace AZ
         {
             return ResultCode::Unimplemented;
         }
+
+        ResultCode StreamingImagePool::GetImageTileLayoutInternal(const Image&, StreamingImageTileLayout&) const
+        {
+            return ResultCode::Unimplemented;
+        }
+
+        ResultCode StreamingImagePool::MapImageTilesInternal(const StreamingImageTileRequest&)
+        {
+            return ResultCode::Unimplemented;
+        }
+
+        ResultCode StreamingImagePool::UnmapImageTilesInternal(Image&, const StreamingImageTileRegion&)
+        {
+            return ResultCode::Unimplemented;
+        }
     }
 }
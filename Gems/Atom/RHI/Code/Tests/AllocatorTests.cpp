@@ -9,6 +9,7 @@
 #include "RHITestFixture.h"
 #include <Atom/RHI/PoolAllocator.h>
 #include <Atom/RHI/FreeListAllocator.h>
+#include <Atom/RHI/AliasedHeapPlacementPlan.h>
 #include <AzCore/Math/Random.h>
 #include <AzCore/std/time.h>
 #include <AzCore/UnitTest/UnitTest.h>
@@ -275,4 +276,86 @@ namespace UnitTest
         testDescriptor.m_addressBase = descriptor.m_addressBase.m_ptr;
         run(testDescriptor);
     }
+
+    TEST_F(AllocatorTest, AliasedHeapPlacementPlan_DisjointLifetimes_ShareMemory)
+    {
+        AZStd::vector<RHI::AliasedHeapPlacementRequest> requests =
+        {
+            { RHI::AttachmentId{ "A" }, 512, 256, 0, 1 },
+            { RHI::AttachmentId{ "B" }, 512, 256, 2, 3 }
+        };
+
+        RHI::AliasedHeapPlacementPlan plan;
+        plan.Build(requests);
+
+        EXPECT_EQ(plan.GetPlacementCount(), 2);
+        EXPECT_EQ(plan.GetPeakSize(), 512);
+        ASSERT_NE(plan.FindOffset(RHI::AttachmentId{ "A" }, 512, 256), nullptr);
+        ASSERT_NE(plan.FindOffset(RHI::AttachmentId{ "B" }, 512, 256), nullptr);
+        EXPECT_EQ(*plan.FindOffset(RHI::AttachmentId{ "A" }, 512, 256), 0);
+        EXPECT_EQ(*plan.FindOffset(RHI::AttachmentId{ "B" }, 512, 256), 0);
+        EXPECT_EQ(plan.FindOffset(RHI::AttachmentId{ "B" }, 1024, 256), nullptr);
+        EXPECT_EQ(plan.FindOffset(RHI::AttachmentId{ "C" }, 512, 256), nullptr);
+    }
+
+    TEST_F(AllocatorTest, AliasedHeapPlacementPlan_OverlappingLifetimes_DontOverlapInMemory)
+    {
+        // A first fit in activation order places "Small" at 0, "Large" after it, and then "Last" can't reuse the
+        // memory of "Small" because it is too big for it, for a peak of 256 + 1024 + 1024 bytes.
+        AZStd::vector<RHI::AliasedHeapPlacementRequest> requests =
+        {
+            { RHI::AttachmentId{ "Small" }, 256, 256, 0, 0 },
+            { RHI::AttachmentId{ "Large" }, 1024, 256, 0, 1 },
+            { RHI::AttachmentId{ "Last" }, 1024, 256, 1, 1 }
+        };
+
+        RHI::AliasedHeapPlacementPlan plan;
+        plan.Build(requests);
+
+        EXPECT_EQ(plan.GetPeakSize(), 2048);
+        for (const RHI::AliasedHeapPlacementRequest& lhs : requests)
+        {
+            for (const RHI::AliasedHeapPlacementRequest& rhs : requests)
+            {
+                const bool lifetimesOverlap = lhs.m_scopeIndexMin <= rhs.m_scopeIndexMax && rhs.m_scopeIndexMin <= lhs.m_scopeIndexMax;
+                if (lhs.m_attachmentId == rhs.m_attachmentId || !lifetimesOverlap)
+                {
+                    continue;
+                }
+
+                const size_t lhsOffset = *plan.FindOffset(lhs.m_attachmentId, lhs.m_sizeInBytes, lhs.m_alignmentInBytes);
+                const size_t rhsOffset = *plan.FindOffset(rhs.m_attachmentId, rhs.m_sizeInBytes, rhs.m_alignmentInBytes);
+                EXPECT_TRUE(lhsOffset + lhs.m_sizeInBytes <= rhsOffset || rhsOffset + rhs.m_sizeInBytes <= lhsOffset);
+            }
+        }
+    }
+
+    TEST_F(AllocatorTest, AliasedHeapPlacementPlan_TopologyHash)
+    {
+        AZStd::vector<RHI::AliasedHeapPlacementRequest> requests =
+        {
+            { RHI::AttachmentId{ "A" }, 512, 256, 0, 1 },
+            { RHI::AttachmentId{ "B" }, 512, 256, 2, 3 }
+        };
+
+        const HashValue64 hash = RHI::AliasedHeapPlacementPlan::GetTopologyHash(requests);
+        EXPECT_EQ(hash, RHI::AliasedHeapPlacementPlan::GetTopologyHash(requests));
+
+        requests[1].m_scopeIndexMax = 4;
+        EXPECT_NE(hash, RHI::AliasedHeapPlacementPlan::GetTopologyHash(requests));
+    }
+
+    TEST_F(AllocatorTest, AliasedHeapPlacementPlan_FindFirstFitOffset)
+    {
+        AZStd::vector<RHI::AliasedHeapRange> ranges =
+        {
+            { 0, 256 },
+            { 512, 1024 }
+        };
+
+        EXPECT_EQ(RHI::AliasedHeapPlacementPlan::FindFirstFitOffset(ranges, 256, 256, 2048), 256);
+        EXPECT_EQ(RHI::AliasedHeapPlacementPlan::FindFirstFitOffset(ranges, 512, 256, 2048), 1024);
+        EXPECT_EQ(RHI::AliasedHeapPlacementPlan::FindFirstFitOffset(ranges, 128, 512, 2048), 1024);
+        EXPECT_EQ(RHI::AliasedHeapPlacementPlan::FindFirstFitOffset(ranges, 2048, 256, 2048), 2048);
+    }
 }
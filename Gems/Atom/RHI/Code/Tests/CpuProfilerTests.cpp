@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "RHITestFixture.h"
+#include <Atom/RHI/CpuProfilerImpl.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+
+    class CpuProfilerTests
+        : public RHITestFixture
+    {
+    public:
+        void SetUp() override
+        {
+            RHITestFixture::SetUp();
+            m_cpuProfiler.Init();
+        }
+
+        void TearDown() override
+        {
+            m_cpuProfiler.Shutdown();
+            RHITestFixture::TearDown();
+        }
+
+    protected:
+        // Records the regions on a new thread, so every test starts with a new thread local storage
+        AZStd::thread_id RecordRegions(size_t regionCount)
+        {
+            AZStd::thread_id threadId;
+            AZStd::thread thread([regionCount, &threadId]()
+            {
+                threadId = AZStd::this_thread::get_id();
+                for (size_t i = 0; i < regionCount; ++i)
+                {
+                    AZ_ATOM_PROFILE_TIME_GROUP_REGION("CpuProfilerTests", "Region");
+                }
+            });
+            thread.join();
+            return threadId;
+        }
+
+        size_t GetContinuousCaptureRegionCount(AZStd::thread_id threadId)
+        {
+            RHI::CpuProfiler::TimelineMap timelineMap = m_cpuProfiler.GetContinuousCapture();
+            auto threadIter = timelineMap.find(threadId);
+            return threadIter != timelineMap.end() ? threadIter->second.size() : 0;
+        }
+
+        RHI::CpuProfilerImpl m_cpuProfiler;
+    };
+
+    TEST_F(CpuProfilerTests, ContinuousCapture_Disabled_RecordsNothing)
+    {
+        EXPECT_FALSE(m_cpuProfiler.IsContinuousCaptureEnabled());
+
+        const AZStd::thread_id threadId = RecordRegions(10);
+        EXPECT_EQ(0, GetContinuousCaptureRegionCount(threadId));
+    }
+
+    TEST_F(CpuProfilerTests, ContinuousCapture_Enabled_RecordsRegionsWithoutEnablingProfiler)
+    {
+        m_cpuProfiler.SetContinuousCaptureEnabled(true);
+        EXPECT_TRUE(m_cpuProfiler.IsContinuousCaptureEnabled());
+        EXPECT_FALSE(m_cpuProfiler.IsProfilerEnabled());
+
+        const AZStd::thread_id threadId = RecordRegions(10);
+
+        RHI::CpuProfiler::TimelineMap timelineMap = m_cpuProfiler.GetContinuousCapture();
+        ASSERT_EQ(1, timelineMap.count(threadId));
+        const AZStd::vector<RHI::CachedTimeRegion>& timeRegions = timelineMap[threadId];
+        ASSERT_EQ(10, timeRegions.size());
+        for (const RHI::CachedTimeRegion& timeRegion : timeRegions)
+        {
+            ASSERT_NE(nullptr, timeRegion.m_groupRegionName);
+            EXPECT_STREQ("CpuProfilerTests", timeRegion.m_groupRegionName->m_groupName);
+            EXPECT_STREQ("Region", timeRegion.m_groupRegionName->m_regionName);
+            EXPECT_LE(timeRegion.m_startTick, timeRegion.m_endTick);
+        }
+    }
+
+    TEST_F(CpuProfilerTests, ContinuousCapture_MoreRegionsThanBufferSize_KeepsMostRecentRegions)
+    {
+        m_cpuProfiler.SetContinuousCaptureEnabled(true);
+
+        const AZStd::thread_id threadId = RecordRegions(20000);
+
+        RHI::CpuProfiler::TimelineMap timelineMap = m_cpuProfiler.GetContinuousCapture();
+        const AZStd::vector<RHI::CachedTimeRegion>& timeRegions = timelineMap[threadId];
+        ASSERT_FALSE(timeRegions.empty());
+        EXPECT_LT(timeRegions.size(), 20000);
+
+        // The regions are ordered from the oldest to the most recent one
+        for (size_t i = 1; i < timeRegions.size(); ++i)
+        {
+            EXPECT_LE(timeRegions[i - 1].m_endTick, timeRegions[i].m_startTick);
+        }
+    }
+}
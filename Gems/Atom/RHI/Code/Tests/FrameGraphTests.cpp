@@ -437,6 +437,53 @@ namespace UnitTest
             }
         }
 
+        void TestAsyncComputeScopeOrder()
+        {
+            RHI::FrameGraph frameGraph;
+
+            RHI::Scope& rootScope = *m_state->m_scopes[0];
+            RHI::Scope& computeScope = *m_state->m_scopes[1];
+            RHI::Scope& graphicsScope = *m_state->m_scopes[2];
+            RHI::Scope& joinScope = *m_state->m_scopes[3];
+
+            frameGraph.Begin();
+
+            frameGraph.BeginScope(rootScope);
+            frameGraph.SetHardwareQueueClass(RHI::HardwareQueueClass::Graphics);
+            frameGraph.EndScope();
+
+            frameGraph.BeginScope(computeScope);
+            frameGraph.SetHardwareQueueClass(RHI::HardwareQueueClass::Compute);
+            frameGraph.ExecuteAfter(rootScope.GetId());
+            frameGraph.EndScope();
+
+            frameGraph.BeginScope(graphicsScope);
+            frameGraph.SetHardwareQueueClass(RHI::HardwareQueueClass::Graphics);
+            frameGraph.ExecuteAfter(rootScope.GetId());
+            frameGraph.EndScope();
+
+            frameGraph.BeginScope(joinScope);
+            frameGraph.SetHardwareQueueClass(RHI::HardwareQueueClass::Graphics);
+            frameGraph.ExecuteAfter(computeScope.GetId());
+            frameGraph.ExecuteAfter(graphicsScope.GetId());
+            frameGraph.EndScope();
+
+            frameGraph.End();
+
+            {
+                RHI::FrameGraphCompileRequest request;
+                request.m_frameGraph = &frameGraph;
+                m_state->m_frameGraphCompiler->Compile(request);
+            }
+
+            // The compute scope is sorted as soon as it's unblocked, so it can run while the graphics scope executes.
+            ASSERT_TRUE(frameGraph.GetScopes().size() == 4);
+            EXPECT_EQ(rootScope.GetIndex(), 0u);
+            EXPECT_LT(computeScope.GetIndex(), graphicsScope.GetIndex());
+            EXPECT_EQ(joinScope.GetIndex(), 3u);
+            EXPECT_EQ(computeScope.GetHardwareQueueClass(), RHI::HardwareQueueClass::Compute);
+        }
+
     private:
         static const uint32_t FrameIterationCount = 32;
         static const uint32_t ImageCount = 256;
@@ -493,4 +540,9 @@ namespace UnitTest
     {
         TestScopeGraph();
     }
+
+    TEST_F(FrameGraphTests, TestAsyncComputeScopeOrder)
+    {
+        TestAsyncComputeScopeOrder();
+    }
 }
@@ -9,6 +9,7 @@
 #include "RHITestFixture.h"
 #include <Tests/Factory.h>
 #include <Tests/Device.h>
+#include <Atom/RHI/StreamingImagePool.h>
 
 namespace UnitTest
 {
@@ -44,6 +45,40 @@ namespace UnitTest
         noopImage = RHI::Factory::Get().CreateImage();
     }
 
+    TEST_F(ImageTests, StreamingImageTileLayout_IsRegionValid)
+    {
+        RHI::StreamingImageTileLayout tileLayout;
+        tileLayout.m_tileSize = RHI::Size(128, 128, 1);
+        tileLayout.m_tileSizeInBytes = 64 * 1024;
+        tileLayout.m_standardMipCount = 2;
+        tileLayout.m_arraySize = 1;
+        tileLayout.m_mipSizeInTiles[0] = RHI::Size(4, 4, 1);
+        tileLayout.m_mipSizeInTiles[1] = RHI::Size(2, 2, 1);
+
+        RHI::StreamingImageTileRegion region;
+        region.m_tileCount = RHI::Size(4, 4, 1);
+        EXPECT_TRUE(tileLayout.IsRegionValid(region));
+
+        region.m_mipSlice = 1;
+        EXPECT_FALSE(tileLayout.IsRegionValid(region));
+
+        region.m_tileOrigin = RHI::Origin(1, 1, 0);
+        region.m_tileCount = RHI::Size(1, 1, 1);
+        EXPECT_TRUE(tileLayout.IsRegionValid(region));
+
+        // Packed mips and empty regions can't be mapped.
+        region.m_mipSlice = 2;
+        EXPECT_FALSE(tileLayout.IsRegionValid(region));
+
+        region.m_mipSlice = 0;
+        region.m_tileCount = RHI::Size(0, 1, 1);
+        EXPECT_FALSE(tileLayout.IsRegionValid(region));
+
+        region.m_tileCount = RHI::Size(1, 1, 1);
+        region.m_arraySlice = 1;
+        EXPECT_FALSE(tileLayout.IsRegionValid(region));
+    }
+
     TEST_F(ImageTests, Test)
     {
         RHI::Ptr<RHI::Device> device = MakeTestDevice();
@@ -698,6 +698,38 @@ namespace UnitTest
         TestGetConstantVectorsInvalidCase(srgLayout);
     }
 
+    TEST_F(ShaderResourceGroupTests, SRGDataConstantDirtyInterval)
+    {
+        RHI::ConstPtr<RHI::ShaderResourceGroupLayout> srgLayout = CreateLayout();
+        RHI::ShaderResourceGroupData srgData = PrepareSRGData(srgLayout);
+
+        const RHI::ConstantsLayout* constantsLayout = srgLayout->GetConstantsLayout();
+        const RHI::ShaderInputConstantIndex floatValueIndex = srgLayout->FindShaderInputConstantIndex(Name("m_floatValue"));
+        const RHI::ShaderInputConstantIndex vector4Index = srgLayout->FindShaderInputConstantIndex(Name("m_vector4"));
+
+        // All the constants need an upload after creation
+        EXPECT_EQ(srgData.GetConstantDataDirtyInterval(), RHI::Interval(0, srgLayout->GetConstantDataSize()));
+
+        srgData.ClearConstantDataDirtyInterval();
+        RHI::Interval dirtyInterval = srgData.GetConstantDataDirtyInterval();
+        EXPECT_EQ(dirtyInterval.m_min, dirtyInterval.m_max);
+
+        EXPECT_TRUE(srgData.SetConstant(floatValueIndex, 1.0f));
+        EXPECT_EQ(srgData.GetConstantDataDirtyInterval(), constantsLayout->GetInterval(floatValueIndex));
+
+        // Writing the same value doesn't dirty anything
+        srgData.ClearConstantDataDirtyInterval();
+        EXPECT_TRUE(srgData.SetConstant(floatValueIndex, 1.0f));
+        dirtyInterval = srgData.GetConstantDataDirtyInterval();
+        EXPECT_EQ(dirtyInterval.m_min, dirtyInterval.m_max);
+
+        // The dirty interval covers all the modified constants
+        EXPECT_TRUE(srgData.SetConstant(floatValueIndex, 2.0f));
+        EXPECT_TRUE(srgData.SetConstant(vector4Index, Vector4(1.0f, 2.0f, 3.0f, 4.0f)));
+        EXPECT_EQ(srgData.GetConstantDataDirtyInterval(),
+            RHI::Interval(constantsLayout->GetInterval(floatValueIndex).m_min, constantsLayout->GetInterval(vector4Index).m_max));
+    }
+
     TEST_F(ShaderResourceGroupTests, TestShaderResourceGroupLayoutHash)
     {
         const Name imageName("m_image");
@@ -176,6 +176,8 @@ set(FILES
     Source/RHI/AsyncWorkQueue.cpp
     Include/Atom/RHI/AliasedHeap.h
     Source/RHI/AliasedHeap.cpp
+    Include/Atom/RHI/AliasedHeapPlacementPlan.h
+    Source/RHI/AliasedHeapPlacementPlan.cpp
     Include/Atom/RHI/AliasedAttachmentAllocator.h
     Include/Atom/RHI/AliasingBarrierTracker.h
     Source/RHI/AliasingBarrierTracker.cpp
@@ -76,6 +76,7 @@ AZ_DX12_REFCOUNTED(ID3D12Device5)
 AZ_DX12_REFCOUNTED(ID3D12Fence)
 AZ_DX12_REFCOUNTED(ID3D12GraphicsCommandList)
 AZ_DX12_REFCOUNTED(ID3D12GraphicsCommandList1)
+AZ_DX12_REFCOUNTED(ID3D12GraphicsCommandList5)
 AZ_DX12_REFCOUNTED(ID3D12Heap)
 AZ_DX12_REFCOUNTED(ID3D12Object)
 AZ_DX12_REFCOUNTED(ID3D12PipelineState)
@@ -21,6 +21,9 @@ namespace AZ
 {
     namespace DX12
     {
+        // Alignment of the buffer uploads that share the staging memory of a frame packet.
+        static constexpr size_t BatchedUploadAlignment = 16;
+
         AsyncUploadQueue::Descriptor::Descriptor(size_t stagingSizeInBytes)
         {
             m_stagingSizeInBytes = stagingSizeInBytes;
@@ -157,6 +160,51 @@ namespace AZ
                 size_t pendingByteCount = byteCount;
                 ID3D12CommandQueue* dx12CommandQueue = static_cast<ID3D12CommandQueue*>(commandQueue);
 
+                if (byteCount <= m_descriptor.m_stagingSizeInBytes)
+                {
+                    const size_t stagingOffset = m_batchingUploads ? RHI::AlignUp(m_framePackets[m_frameIndex].m_dataOffset, BatchedUploadAlignment) : 0;
+                    if (m_batchingUploads && stagingOffset + byteCount > m_descriptor.m_stagingSizeInBytes)
+                    {
+                        FlushBatchedUploads(dx12CommandQueue);
+                    }
+
+                    if (!m_batchingUploads)
+                    {
+                        BeginFramePacket();
+                        m_batchingUploads = true;
+                    }
+
+                    FramePacket* framePacket = &m_framePackets[m_frameIndex];
+                    const size_t dataOffset = RHI::AlignUp(framePacket->m_dataOffset, BatchedUploadAlignment);
+                    {
+                        AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzRender, "Copy CPU buffer");
+                        memcpy(framePacket->m_stagingResourceData + dataOffset, sourceData, byteCount);
+                    }
+
+                    m_commandList->CopyBufferRegion(
+                        dx12Buffer.get(),
+                        byteOffset,
+                        framePacket->m_stagingResource.get(),
+                        dataOffset,
+                        byteCount);
+                    framePacket->m_dataOffset = static_cast<uint32_t>(dataOffset + byteCount);
+
+                    if (dx12FenceToSignal)
+                    {
+                        m_batchedFencesToSignal.emplace_back(dx12FenceToSignal, dx12FenceToSignalValue);
+                    }
+                    m_batchedUploadFenceValue = queueValue;
+
+                    // Keep the frame packet open while more uploads are coming.
+                    if (!m_copyQueue->HasPendingCommands())
+                    {
+                        FlushBatchedUploads(dx12CommandQueue);
+                    }
+                    return;
+                }
+
+                FlushBatchedUploads(dx12CommandQueue);
+
                 while (pendingByteCount > 0)
                 {
                     AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzRender, "Upload Buffer Chunk");
@@ -226,6 +274,26 @@ namespace AZ
             m_recordingFrame = false;
         }
 
+        void AsyncUploadQueue::FlushBatchedUploads(ID3D12CommandQueue* commandQueue)
+        {
+            if (!m_batchingUploads)
+            {
+                return;
+            }
+
+            AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzRender);
+            EndFramePacket(commandQueue);
+            m_batchingUploads = false;
+
+            for (const auto& fenceToSignal : m_batchedFencesToSignal)
+            {
+                commandQueue->Signal(fenceToSignal.first.get(), fenceToSignal.second);
+            }
+            m_batchedFencesToSignal.clear();
+
+            commandQueue->Signal(m_uploadFence.Get(), m_batchedUploadFenceValue);
+        }
+
         // [GFX TODO][ATOM-4205] Stage/Upload 3D streaming images more efficiently.
         uint64_t AsyncUploadQueue::QueueUpload(const RHI::StreamingImageExpandRequest& request, uint32_t residentMip)
         {
@@ -245,6 +313,7 @@ namespace AZ
             {
                 AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzRender, "Upload Image");
                 ID3D12CommandQueue* dx12CommandQueue = static_cast<ID3D12CommandQueue*>(commandQueue);
+                FlushBatchedUploads(dx12CommandQueue);
                 FramePacket* framePacket = BeginFramePacket();
 
                 uint32_t arraySize = request.m_image->GetDescriptor().m_arraySize;
@@ -469,6 +538,101 @@ namespace AZ
             return fenceValue;
         }
 
+        uint64_t AsyncUploadQueue::QueueUpload(const RHI::StreamingImageTileRequest& request, const RHI::Origin& texelOrigin)
+        {
+            AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzRender);
+
+            uint64_t fenceValue = m_uploadFence.Increment();
+
+            Image* image = static_cast<Image*>(request.m_image);
+            image->SetUploadFenceValue(fenceValue);
+
+            const RHI::ImageDescriptor& imageDescriptor = image->GetDescriptor();
+            const uint32_t subresourceIdx = D3D12CalcSubresource(
+                request.m_region.m_mipSlice, request.m_region.m_arraySlice, 0, imageDescriptor.m_mipLevels, imageDescriptor.m_arraySize);
+            Memory* imageMemory = image->GetMemoryView().GetMemory();
+
+            m_copyQueue->QueueCommand([=](void* commandQueue)
+            {
+                AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzRender, "Upload Image Tiles");
+                ID3D12CommandQueue* dx12CommandQueue = static_cast<ID3D12CommandQueue*>(commandQueue);
+                FlushBatchedUploads(dx12CommandQueue);
+
+                const RHI::ImageSubresourceLayout& subresourceLayout = request.m_dataLayout;
+                const uint32_t stagingRowPitch = RHI::AlignUp(subresourceLayout.m_bytesPerRow, DX12_TEXTURE_DATA_PITCH_ALIGNMENT);
+                const uint32_t stagingSlicePitch = RHI::AlignUp(subresourceLayout.m_rowCount * stagingRowPitch, D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT);
+
+                // Tile regions are small, so unlike mip slices they are never split by rows.
+                if (stagingSlicePitch > m_descriptor.m_stagingSizeInBytes)
+                {
+                    AZ_Warning("RHI::DX12", false, "AsyncUploadQueue staging buffer (%dK) is not big enough"
+                        "for the size of the tile region (%dK). Please upload smaller regions.",
+                        m_descriptor.m_stagingSizeInBytes / 1024, stagingSlicePitch / 1024);
+                }
+                else
+                {
+                    FramePacket* framePacket = BeginFramePacket();
+                    CD3DX12_TEXTURE_COPY_LOCATION destLocation(imageMemory, subresourceIdx);
+
+                    for (uint32_t depth = 0; depth < subresourceLayout.m_size.m_depth; depth++)
+                    {
+                        if (stagingSlicePitch > m_descriptor.m_stagingSizeInBytes - framePacket->m_dataOffset)
+                        {
+                            EndFramePacket(dx12CommandQueue);
+                            framePacket = BeginFramePacket();
+                        }
+
+                        {
+                            AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzRender, "Copy CPU image");
+
+                            uint8_t* stagingDataStart = framePacket->m_stagingResourceData + framePacket->m_dataOffset;
+                            const uint8_t* sliceDataStart = static_cast<const uint8_t*>(request.m_data) + (depth * subresourceLayout.m_bytesPerImage);
+
+                            for (uint32_t row = 0; row < subresourceLayout.m_rowCount; row++)
+                            {
+                                memcpy(stagingDataStart + row * stagingRowPitch,
+                                    sliceDataStart + row * subresourceLayout.m_bytesPerRow,
+                                    subresourceLayout.m_bytesPerRow);
+                            }
+                        }
+
+                        D3D12_PLACED_SUBRESOURCE_FOOTPRINT footprint;
+                        footprint.Footprint.Width = subresourceLayout.m_size.m_width;
+                        footprint.Footprint.Height = subresourceLayout.m_size.m_height;
+                        footprint.Footprint.Depth = 1;
+                        footprint.Footprint.Format = GetBaseFormat(ConvertFormat(imageDescriptor.m_format));
+                        footprint.Footprint.RowPitch = stagingRowPitch;
+                        footprint.Offset = framePacket->m_dataOffset;
+                        CD3DX12_TEXTURE_COPY_LOCATION sourceLocation(framePacket->m_stagingResource.get(), footprint);
+
+                        m_commandList->CopyTextureRegion(
+                            &destLocation,
+                            texelOrigin.m_left, texelOrigin.m_top, texelOrigin.m_front + depth,
+                            &sourceLocation,
+                            nullptr);
+
+                        framePacket->m_dataOffset += stagingSlicePitch;
+                    }
+
+                    EndFramePacket(dx12CommandQueue);
+                }
+
+                dx12CommandQueue->Signal(m_uploadFence.Get(), fenceValue);
+
+                if (request.m_completeCallback)
+                {
+                    {
+                        AZStd::lock_guard<AZStd::mutex> lock(m_callbackMutex);
+                        AZ_Assert(m_callbacks.empty() || m_callbacks.back().second < fenceValue, "Callbacks should be added with increasing order of fenceValue");
+                        m_callbacks.push({ request.m_completeCallback, fenceValue });
+                    }
+                    AZ::SystemTickBus::QueueFunction([this] { ProcessCallbacks(uint64_t(-1)); });
+                }
+            });
+
+            return fenceValue;
+        }
+
         bool AsyncUploadQueue::IsUploadFinished(uint64_t fenceValue)
         {
             return m_uploadFence.GetCompletedValue() >= fenceValue;
@@ -507,6 +671,7 @@ namespace AZ
                 AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzRender, "QueueTileMapping");
 
                 ID3D12CommandQueue* dx12CommandQueue = static_cast<ID3D12CommandQueue*>(commandQueue);
+                FlushBatchedUploads(dx12CommandQueue);
                 const uint32_t tileCount = request.m_sourceRegionSize.NumTiles;
 
                 // DX12 requires that we pass the full array of range counts (even though they are all 1).
@@ -56,6 +56,11 @@ namespace AZ
             // @param residentMip is the resident mip level the expand request starts from. 
             // @return queue id which can be use to check whether upload finished or wait for upload finish
             uint64_t QueueUpload(const RHI::StreamingImageExpandRequest& request, uint32_t residentMip);
+
+            // Queue copy commands to upload a region of tiles of a sparse image. The tiles must be mapped beforehand.
+            // @param texelOrigin is the origin of the region in texels.
+            // @return queue id which can be use to check whether upload finished or wait for upload finish
+            uint64_t QueueUpload(const RHI::StreamingImageTileRequest& request, const RHI::Origin& texelOrigin);
             
             // Queue tile mapping to map tiles from allocate heap for reserved resource. This is usually required before upload data to 
             // reserved resource in this copy queue
@@ -88,6 +93,17 @@ namespace AZ
             void EndFramePacket(ID3D12CommandQueue* commandQueue);
             bool m_recordingFrame = false;
 
+            // Buffer uploads that fit in the staging memory left in the current frame packet are recorded in it, instead of
+            // using a frame packet each. The frame packet is submitted when the copy queue runs out of commands, when the next
+            // upload doesn't fit, or before any other kind of command.
+            void FlushBatchedUploads(ID3D12CommandQueue* commandQueue);
+            bool m_batchingUploads = false;
+            // The upload fence value of the last upload in the batch. The upload fence is a timeline, so signaling
+            // the last value completes all the uploads of the batch.
+            uint64_t m_batchedUploadFenceValue = 0;
+            // Fences of the buffer stream requests in the batch.
+            AZStd::vector<AZStd::pair<RHI::Ptr<ID3D12Fence>, uint64_t>> m_batchedFencesToSignal;
+
             AZStd::vector<FramePacket> m_framePackets; 
             size_t m_frameIndex = 0;
 
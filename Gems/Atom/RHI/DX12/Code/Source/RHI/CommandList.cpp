@@ -64,6 +64,11 @@ namespace AZ
             {
                 m_descriptorContext->SetDescriptorHeaps(GetCommandList());
             }
+
+            if (GetHardwareQueueClass() == RHI::HardwareQueueClass::Graphics && device.GetFeatures().m_shadingRatePerDraw)
+            {
+                m_shadingRateCommandList = DX12ResourceCast<ID3D12GraphicsCommandList5>(GetCommandList());
+            }
         }
 
         void CommandList::Shutdown()
@@ -71,6 +76,7 @@ namespace AZ
             if (IsInitialized())
             {
                 m_descriptorContext = nullptr;
+                m_shadingRateCommandList = nullptr;
             }
         }
 
@@ -405,6 +411,7 @@ namespace AZ
 
             SetStreamBuffers(drawItem.m_streamBufferViews, drawItem.m_streamBufferViewCount);
             SetStencilRef(drawItem.m_stencilRef);
+            SetShadingRate(drawItem.m_shadingRate);
 
             RHI::CommandListScissorState scissorState;
             if (drawItem.m_scissorsCount)
@@ -539,6 +546,15 @@ namespace AZ
             }
         }
 
+        void CommandList::SetShadingRate(RHI::ShadingRate shadingRate)
+        {
+            if (m_state.m_shadingRate != shadingRate && m_shadingRateCommandList)
+            {
+                m_shadingRateCommandList->RSSetShadingRate(ConvertShadingRate(shadingRate), nullptr);
+                m_state.m_shadingRate = shadingRate;
+            }
+        }
+
         void CommandList::SetTopology(RHI::PrimitiveTopology topology)
         {
             if (m_state.m_topology != topology)
@@ -189,6 +189,7 @@ namespace AZ
             void SetStreamBuffers(const RHI::StreamBufferView* descriptors, uint32_t count);
             void SetIndexBuffer(const RHI::IndexBufferView& descriptor);
             void SetStencilRef(uint8_t stencilRef);
+            void SetShadingRate(RHI::ShadingRate shadingRate);
             void SetTopology(RHI::PrimitiveTopology topology);
             void CommitViewportState();
             void CommitScissorState();
@@ -223,6 +224,8 @@ namespace AZ
                 AZStd::array<uint64_t, RHI::Limits::Pipeline::StreamCountMax> m_streamBufferHashes = {{}};
                 uint64_t m_indexBufferHash = 0;
                 uint32_t m_stencilRef = static_cast<uint32_t>(-1);
+                // The shading rate is reset to 1x1 when the command list is reset.
+                RHI::ShadingRate m_shadingRate = RHI::ShadingRate::Rate1x1;
                 RHI::PrimitiveTopology m_topology = RHI::PrimitiveTopology::Undefined;
                 RHI::CommandListViewportState m_viewportState;
                 RHI::CommandListScissorState m_scissorState;
@@ -242,6 +245,9 @@ namespace AZ
             } m_state;
 
             AZStd::shared_ptr<DescriptorContext> m_descriptorContext;
+
+            // Command list interface used to set the shading rate of draws. Null when the device doesn't support it.
+            RHI::Ptr<ID3D12GraphicsCommandList5> m_shadingRateCommandList;
         };
 
         template <RHI::PipelineStateType pipelineType>
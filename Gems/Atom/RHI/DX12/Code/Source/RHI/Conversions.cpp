@@ -101,6 +101,21 @@ namespace AZ
             return table[(uint32_t)topology];
         }
 
+        D3D12_SHADING_RATE ConvertShadingRate(RHI::ShadingRate shadingRate)
+        {
+            static const D3D12_SHADING_RATE table[] =
+            {
+                D3D12_SHADING_RATE_1X1,
+                D3D12_SHADING_RATE_1X2,
+                D3D12_SHADING_RATE_2X1,
+                D3D12_SHADING_RATE_2X2,
+                D3D12_SHADING_RATE_2X4,
+                D3D12_SHADING_RATE_4X2,
+                D3D12_SHADING_RATE_4X4,
+            };
+            return table[(uint32_t)shadingRate];
+        }
+
         AZStd::vector<D3D12_INPUT_ELEMENT_DESC> ConvertInputElements(const RHI::InputStreamLayout& layout)
         {
             AZStd::vector<D3D12_INPUT_ELEMENT_DESC> result;
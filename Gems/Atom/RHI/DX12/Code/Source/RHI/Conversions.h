@@ -36,6 +36,8 @@ namespace AZ
 
         D3D12_PRIMITIVE_TOPOLOGY ConvertTopology(RHI::PrimitiveTopology topology);
 
+        D3D12_SHADING_RATE ConvertShadingRate(RHI::ShadingRate shadingRate);
+
         AZStd::vector<D3D12_INPUT_ELEMENT_DESC> ConvertInputElements(const RHI::InputStreamLayout& layout);
 
         D3D12_RESOURCE_DIMENSION ConvertImageDimension(RHI::ImageDimension dimension);
@@ -12,6 +12,7 @@
 #include <RHI/Image.h>
 #include <Atom/RHI/CpuProfiler.h>
 #include <Atom/RHI.Reflect/DX12/PlatformLimitsDescriptor.h>
+#include <AzCore/std/containers/array.h>
 
 namespace AZ
 {
@@ -303,33 +304,63 @@ namespace AZ
             const DescriptorHandle* cpuSourceDescriptors,
             D3D12_DESCRIPTOR_HEAP_TYPE heapType)
         {
-            const uint32_t DescriptorCount = gpuDestinationTable.GetSize();
-
-            // Resolve source descriptors to platform handles.
-            AZStd::vector<D3D12_CPU_DESCRIPTOR_HANDLE> cpuSourceHandles;
-            cpuSourceHandles.reserve(DescriptorCount);
-            for (uint32_t i = 0; i < DescriptorCount; ++i)
-            {
-                cpuSourceHandles.push_back(GetCpuPlatformHandle(cpuSourceDescriptors[i]));
-            }
+            const uint32_t descriptorCount = gpuDestinationTable.GetSize();
+            const uint32_t descriptorStride = m_device->GetDescriptorHandleIncrementSize(heapType);
 
             // Resolve destination descriptor to platform handle.
             D3D12_CPU_DESCRIPTOR_HANDLE gpuDestinationHandle = GetCpuPlatformHandle(gpuDestinationTable.GetOffset());
 
-            // An array of descriptor sizes for each range. We just want N ranges with 1 descriptor each.
-            AZStd::vector<uint32_t> rangeCounts(DescriptorCount, 1);
-
             /**
-             * We are gathering N source descriptors into a contiguous destination table.
+             * We are gathering N source descriptors into a contiguous destination table. Source descriptors that are
+             * adjacent in their heap are merged into a single range, and the ranges are gathered in fixed size batches
+             * on the stack, so SRG compilation doesn't allocate per table.
              */
-            m_device->CopyDescriptors(
-                1,                      // Number of destination ranges.
-                &gpuDestinationHandle,  // Destination range array.
-                &DescriptorCount,       // Number of destination table elements in each range.
-                DescriptorCount,        // Number of source ranges.
-                cpuSourceHandles.data(),// Source range array
-                rangeCounts.data(),     // Number of elements in each source range.
-                heapType);
+            constexpr uint32_t SourceRangeBatchSize = 64;
+            AZStd::array<D3D12_CPU_DESCRIPTOR_HANDLE, SourceRangeBatchSize> sourceRangeStarts;
+            AZStd::array<uint32_t, SourceRangeBatchSize> sourceRangeCounts;
+            uint32_t sourceRangeCount = 0;
+            uint32_t batchDescriptorCount = 0;
+
+            auto copyBatch = [&]()
+            {
+                if (sourceRangeCount > 0)
+                {
+                    m_device->CopyDescriptors(
+                        1,                          // Number of destination ranges.
+                        &gpuDestinationHandle,      // Destination range array.
+                        &batchDescriptorCount,      // Number of destination table elements in each range.
+                        sourceRangeCount,           // Number of source ranges.
+                        sourceRangeStarts.data(),   // Source range array
+                        sourceRangeCounts.data(),   // Number of elements in each source range.
+                        heapType);
+                    gpuDestinationHandle.ptr += batchDescriptorCount * descriptorStride;
+                    sourceRangeCount = 0;
+                    batchDescriptorCount = 0;
+                }
+            };
+
+            for (uint32_t i = 0; i < descriptorCount; ++i)
+            {
+                const D3D12_CPU_DESCRIPTOR_HANDLE cpuSourceHandle = GetCpuPlatformHandle(cpuSourceDescriptors[i]);
+                const uint32_t lastRange = sourceRangeCount - 1;
+                if (sourceRangeCount > 0 &&
+                    cpuSourceHandle.ptr == sourceRangeStarts[lastRange].ptr + sourceRangeCounts[lastRange] * descriptorStride)
+                {
+                    ++sourceRangeCounts[lastRange];
+                }
+                else
+                {
+                    if (sourceRangeCount == SourceRangeBatchSize)
+                    {
+                        copyBatch();
+                    }
+                    sourceRangeStarts[sourceRangeCount] = cpuSourceHandle;
+                    sourceRangeCounts[sourceRangeCount] = 1;
+                    ++sourceRangeCount;
+                }
+                ++batchDescriptorCount;
+            }
+            copyBatch();
         }
 
         void DescriptorContext::CopyDescriptor(DescriptorHandle dest, DescriptorHandle source)
@@ -163,6 +163,15 @@ namespace AZ
 
             m_features.m_unboundedArrays = true;
 
+            // Sampling a tile that isn't mapped must return zero, which requires tier 2.
+            D3D12_FEATURE_DATA_D3D12_OPTIONS options;
+            GetDevice()->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS, &options, sizeof(options));
+            m_features.m_sparseResidency = options.TiledResourcesTier >= D3D12_TILED_RESOURCES_TIER_2;
+
+            D3D12_FEATURE_DATA_D3D12_OPTIONS6 options6 = {};
+            GetDevice()->CheckFeatureSupport(D3D12_FEATURE_D3D12_OPTIONS6, &options6, sizeof(options6));
+            m_features.m_shadingRatePerDraw = options6.VariableShadingRateTier != D3D12_VARIABLE_SHADING_RATE_TIER_NOT_SUPPORTED;
+
             m_limits.m_maxImageDimension1D = D3D12_REQ_TEXTURE1D_U_DIMENSION;
             m_limits.m_maxImageDimension2D = D3D12_REQ_TEXTURE2D_U_OR_V_DIMENSION;
             m_limits.m_maxImageDimension3D = D3D12_REQ_TEXTURE3D_U_V_OR_W_DIMENSION;
@@ -34,6 +34,11 @@ namespace AZ
             return !m_tiles.empty();
         }
 
+        bool Image::IsSparse() const
+        {
+            return m_isSparse;
+        }
+
         void Image::SetNameInternal(const AZStd::string_view& name)
         {
             m_memoryView.SetName(name);
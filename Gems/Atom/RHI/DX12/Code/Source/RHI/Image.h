@@ -83,6 +83,9 @@ namespace AZ
 
             // Returns whether the image is using a tiled resource.
             bool IsTiled() const;
+
+            // Returns whether the tiles of the standard mips are mapped individually by StreamingImagePool::MapImageTiles.
+            bool IsSparse() const;
             
             void SetUploadFenceValue(uint64_t fenceValue);
             uint64_t GetUploadFenceValue();
@@ -158,6 +161,9 @@ namespace AZ
             // by the tile layout. The value at each index is a tile in the backing heap.
             AZStd::vector<RHI::VirtualAddress> m_tiles;
 
+            // Whether the image was initialized as a sparse streaming image.
+            bool m_isSparse = false;
+
             // Tracking the actual mip level data uploaded. It's also used for invalidate image view. 
             uint32_t m_streamedMipLevel = 0;
 
@@ -58,6 +58,10 @@ namespace AZ
             /// The array of compiled SRG data, N buffered for CPU updates.
             AZStd::array<ShaderResourceGroupCompiledData, RHI::Limits::Device::FrameCountMax> m_compiledData;
 
+            /// The constant byte ranges written by the last compiles, one per compiled data entry. The constant buffer
+            /// of an entry is only refreshed with the union of these ranges, since it holds the data from FrameCountMax compiles ago.
+            AZStd::array<RHI::Interval, RHI::Limits::Device::FrameCountMax> m_constantDirtyIntervals;
+
             /// The mapped memory view to constant memory.
             MemoryView m_constantMemoryView;
 
@@ -131,6 +131,9 @@ namespace AZ
                     compiledData.m_gpuConstantAddress = gpuAddress + m_constantBufferSize * i;
                     compiledData.m_cpuConstantAddress = cpuAddress + m_constantBufferSize * i;
                 }
+
+                // Every copy of the constant buffer starts uninitialized.
+                group.m_constantDirtyIntervals.fill(RHI::Interval(0, static_cast<uint32_t>(m_constantBufferSize)));
             }
 
             if (m_viewsDescriptorTableSize)
@@ -217,7 +220,28 @@ namespace AZ
 
             if (m_constantBufferSize)
             {
-                memcpy(group.GetCompiledData().m_cpuConstantAddress, groupData.GetConstantData().data(), groupData.GetConstantData().size());
+                group.m_constantDirtyIntervals[group.m_compiledDataIndex] = groupData.GetConstantDataDirtyInterval();
+
+                // The buffer being written was last updated FrameCountMax compiles ago, so it needs every range modified since then.
+                const uint32_t constantDataSize = static_cast<uint32_t>(groupData.GetConstantData().size());
+                RHI::Interval copyInterval(constantDataSize, 0);
+                for (const RHI::Interval& dirtyInterval : group.m_constantDirtyIntervals)
+                {
+                    if (dirtyInterval.m_min < dirtyInterval.m_max)
+                    {
+                        copyInterval.m_min = AZStd::min(copyInterval.m_min, dirtyInterval.m_min);
+                        copyInterval.m_max = AZStd::max(copyInterval.m_max, dirtyInterval.m_max);
+                    }
+                }
+                copyInterval.m_max = AZStd::min(copyInterval.m_max, constantDataSize);
+
+                if (copyInterval.m_min < copyInterval.m_max)
+                {
+                    memcpy(
+                        group.GetCompiledData().m_cpuConstantAddress + copyInterval.m_min,
+                        groupData.GetConstantData().data() + copyInterval.m_min,
+                        copyInterval.m_max - copyInterval.m_min);
+                }
             }
 
             if (m_viewsDescriptorTableSize)
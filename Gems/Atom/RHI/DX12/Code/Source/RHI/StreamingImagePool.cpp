@@ -136,25 +136,31 @@ namespace AZ
             return allocationInfo;
         }
 
-        RHI::ResultCode StreamingImagePool::InitInternal([[maybe_unused]] RHI::Device& deviceBase, [[maybe_unused]] const RHI::StreamingImagePoolDescriptor& descriptor)
+        RHI::ResultCode StreamingImagePool::InitInternal(RHI::Device& deviceBase, const RHI::StreamingImagePoolDescriptor& descriptor)
         {
             AZ_TRACE_METHOD();
 
-
-
+            // The tile heap backs the sparse images, and all the images of the pool when tiled resources are enabled.
+            size_t tileHeapSizeInBytes = deviceBase.GetFeatures().m_sparseResidency ? descriptor.m_tileHeapSizeInBytes : 0;
 #ifdef AZ_RHI_USE_TILED_RESOURCES
+            tileHeapSizeInBytes = AZStd::max(tileHeapSizeInBytes, descriptor.m_budgetInBytes);
+#endif
+            tileHeapSizeInBytes = RHI::AlignUp(tileHeapSizeInBytes, static_cast<size_t>(D3D12_TILED_RESOURCE_TILE_SIZE_IN_BYTES));
+
+            if (tileHeapSizeInBytes)
             {
-                AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzRender, "StreamImagePool::CreateHeap");
+                {
+                    AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzRender, "StreamImagePool::CreateHeap");
 
-                CD3DX12_HEAP_DESC heapDesc(descriptor.m_budgetInBytes, D3D12_HEAP_TYPE_DEFAULT, 0, D3D12_HEAP_FLAG_DENY_BUFFERS | D3D12_HEAP_FLAG_DENY_RT_DS_TEXTURES);
+                    CD3DX12_HEAP_DESC heapDesc(tileHeapSizeInBytes, D3D12_HEAP_TYPE_DEFAULT, 0, D3D12_HEAP_FLAG_DENY_BUFFERS | D3D12_HEAP_FLAG_DENY_RT_DS_TEXTURES);
 
-                Microsoft::WRL::ComPtr<ID3D12Heap> heap;
-                AssertSuccess(device.GetDevice()->CreateHeap(&heapDesc, IID_GRAPHICS_PPV_ARGS(heap.GetAddressOf())));
-                m_heap = heap.Get();
-            }
+                    Device& device = static_cast<Device&>(deviceBase);
+                    Microsoft::WRL::ComPtr<ID3D12Heap> heap;
+                    AssertSuccess(device.GetDevice()->CreateHeap(&heapDesc, IID_GRAPHICS_PPV_ARGS(heap.GetAddressOf())));
+                    m_heap = heap.Get();
+                }
 
-            {
-                const size_t tileCountTotal = descriptor.m_budgetInBytes / D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+                const size_t tileCountTotal = tileHeapSizeInBytes / D3D12_TILED_RESOURCE_TILE_SIZE_IN_BYTES;
 
                 RHI::PoolAllocator::Descriptor allocatorDesc;
                 allocatorDesc.m_elementSize = 1;
@@ -162,7 +168,6 @@ namespace AZ
                 allocatorDesc.m_capacityInBytes = tileCountTotal;
                 m_tileAllocator.Init(allocatorDesc);
             }
-#endif
 
             SetResolver(AZStd::make_unique<StreamingImagePoolResolver>());
             return RHI::ResultCode::Success;
@@ -170,10 +175,11 @@ namespace AZ
 
         void StreamingImagePool::ShutdownInternal()
         {
-#ifdef AZ_RHI_USE_TILED_RESOURCES
-            GetDevice().QueueForRelease(AZStd::move(m_heap));
-            m_tileAllocator.Shutdown();
-#endif
+            if (m_heap)
+            {
+                GetDevice().QueueForRelease(AZStd::move(m_heap));
+                m_tileAllocator.Shutdown();
+            }
         }
 
         void StreamingImagePool::AllocateImageTilesInternal(Image& image, CommandList::TileMapRequest& request, uint32_t subresourceIndex)
@@ -307,6 +313,11 @@ namespace AZ
         {
             AZ_TRACE_METHOD();
 
+            if (request.m_isSparse)
+            {
+                return InitSparseImage(request);
+            }
+
             Image& image = static_cast<Image&>(*request.m_image);
 
             uint32_t expectedResidentMipLevel = request.m_descriptor.m_mipLevels - static_cast<uint32_t>(request.m_tailMipSlices.size());
@@ -411,7 +422,11 @@ namespace AZ
                 m_tileMutex.lock();
                 for (RHI::VirtualAddress address : image.m_tiles)
                 {
-                    m_tileAllocator.DeAllocate(address);
+                    // The tiles of sparse images that were never mapped are null.
+                    if (address.IsValid())
+                    {
+                        m_tileAllocator.DeAllocate(address);
+                    }
                 }
                 m_tileAllocator.GarbageCollect();
                 m_tileMutex.unlock();
@@ -419,6 +434,7 @@ namespace AZ
                 image.m_tiles.shrink_to_fit();
                 image.m_tileLayout = ImageTileLayout();
             }
+            image.m_isSparse = false;
 
             GetDevice().QueueForRelease(image.m_memoryView);
             image.m_memoryView = MemoryView();
@@ -428,6 +444,11 @@ namespace AZ
         RHI::ResultCode StreamingImagePool::ExpandImageInternal(const RHI::StreamingImageExpandRequest& request)
         {
             Image& image = static_cast<Image&>(*request.m_image);
+            if (image.IsSparse())
+            {
+                AZ_Error("StreamingImagePool", false, "Sparse image '%s' can't be expanded. Use MapImageTiles instead.", image.GetName().GetCStr());
+                return RHI::ResultCode::InvalidOperation;
+            }
 
             const uint32_t residentMipLevelBefore = image.GetResidentMipLevel();
             const uint32_t residentMipLevelAfter = residentMipLevelBefore - static_cast<uint32_t>(request.m_mipSlices.size());
@@ -472,6 +493,11 @@ namespace AZ
         RHI::ResultCode StreamingImagePool::TrimImageInternal(RHI::Image& image, uint32_t targetMipLevel)
         {
             Image& imageImpl = static_cast<Image&>(image);
+            if (imageImpl.IsSparse())
+            {
+                AZ_Error("StreamingImagePool", false, "Sparse image '%s' can't be trimmed. Use UnmapImageTiles instead.", image.GetName().GetCStr());
+                return RHI::ResultCode::InvalidOperation;
+            }
 
             // Wait for any upload of this image done. 
             GetDevice().GetAsyncUploadQueue().WaitForUpload(imageImpl.GetUploadFenceValue());
@@ -503,6 +529,259 @@ namespace AZ
 
             GetResolver()->AddImageTransitionBarrier(imageImpl, residentMipLevelBefore, targetMipLevel);
 
+            return RHI::ResultCode::Success;
+        }
+            RHI::ResultCode StreamingImagePool::InitSparseImage(const RHI::StreamingImageInitRequest& request)
+        {
+            AZ_TRACE_METHOD();
+
+            Image& image = static_cast<Image&>(*request.m_image);
+
+            if (!m_heap)
+            {
+                AZ_Error("StreamingImagePool", false, "Sparse images require a pool with a tile heap.");
+                return RHI::ResultCode::InvalidOperation;
+            }
+
+            // Same limitation as the tiled resources of the mip streaming.
+            if (request.m_descriptor.m_arraySize != 1)
+            {
+                AZ_Error("StreamingImagePool", false, "Sparse images don't support image arrays.");
+                return RHI::ResultCode::InvalidArgument;
+            }
+
+            MemoryView memoryView = GetDevice().CreateImageReserved(request.m_descriptor, D3D12_RESOURCE_STATE_COMMON, image.m_tileLayout);
+            if (!memoryView.IsValid())
+            {
+                return RHI::ResultCode::OutOfMemory;
+            }
+
+            const ImageTileLayout& tileLayout = image.m_tileLayout;
+            const uint32_t tailMipLevel = request.m_descriptor.m_mipLevels - static_cast<uint32_t>(request.m_tailMipSlices.size());
+
+            // Only the packed mips and the standard mips of the tail are resident.
+            uint32_t residentTileCount = tileLayout.m_tileCountPacked;
+            for (uint32_t mipIndex = tailMipLevel; mipIndex < tileLayout.m_mipCountStandard; ++mipIndex)
+            {
+                const D3D12_SUBRESOURCE_TILING& tiling = tileLayout.m_subresourceTiling[mipIndex];
+                residentTileCount += tiling.WidthInTiles * tiling.HeightInTiles * tiling.DepthInTiles;
+            }
+            const size_t residentSizeInBytes = static_cast<size_t>(residentTileCount) * D3D12_TILED_RESOURCE_TILE_SIZE_IN_BYTES;
+
+            RHI::HeapMemoryUsage& memoryUsage = m_memoryUsage.GetHeapMemoryUsage(RHI::HeapMemoryLevel::Device);
+            if (!memoryUsage.TryReserveMemory(residentSizeInBytes))
+            {
+                GetDevice().QueueForRelease(memoryView);
+                image.m_tileLayout = ImageTileLayout();
+                return RHI::ResultCode::OutOfMemory;
+            }
+
+            memoryView.SetName(image.GetName().GetStringView());
+
+            image.m_tiles.resize(tileLayout.m_tileCount);
+            image.m_residentSizeInBytes = residentSizeInBytes;
+            image.m_memoryView = AZStd::move(memoryView);
+            image.m_isSparse = true;
+            image.GenerateSubresourceLayouts();
+
+            // The views cover all the mips. Tiles that aren't mapped read zero.
+            image.m_streamedMipLevel = 0;
+
+            AllocatePackedImageTiles(image);
+            AllocateStandardImageTiles(image, RHI::Interval{ tailMipLevel, request.m_descriptor.m_mipLevels - tileLayout.m_mipCountPacked });
+
+            RHI::StreamingImageExpandRequest uploadMipRequest;
+            uploadMipRequest.m_image = &image;
+            uploadMipRequest.m_mipSlices = request.m_tailMipSlices;
+            uploadMipRequest.m_waitForUpload = true;
+            GetDevice().GetAsyncUploadQueue().QueueUpload(uploadMipRequest, request.m_descriptor.m_mipLevels);
+
+            memoryUsage.m_residentInBytes += residentSizeInBytes;
+            memoryUsage.Validate();
+
+            // No transition barriers are queued. The image stays in the common state so tiles can be uploaded on the
+            // copy queue at any time, and it's implicitly promoted to a shader resource state when sampled.
+            return RHI::ResultCode::Success;
+        }
+
+        void StreamingImagePool::GetTileRegionInfo(
+            const Image& image,
+            const RHI::StreamingImageTileRegion& region,
+            CommandList::TileMapRequest& request,
+            AZStd::vector<uint32_t>& imageTileIndices) const
+        {
+            const RHI::ImageDescriptor& descriptor = image.GetDescriptor();
+            const uint32_t subresourceIndex = RHI::GetImageSubresourceIndex(region.m_mipSlice, region.m_arraySlice, descriptor.m_mipLevels);
+            const D3D12_SUBRESOURCE_TILING& tiling = image.m_tileLayout.m_subresourceTiling[subresourceIndex];
+
+            const RHI::Origin& origin = region.m_tileOrigin;
+            const RHI::Size& count = region.m_tileCount;
+
+            request.m_sourceMemory = image.GetMemoryView().GetMemory();
+            request.m_sourceCoordinate = CD3DX12_TILED_RESOURCE_COORDINATE(origin.m_left, origin.m_top, origin.m_front, subresourceIndex);
+            request.m_sourceRegionSize = CD3DX12_TILE_REGION_SIZE(
+                count.m_width * count.m_height * count.m_depth, TRUE,
+                count.m_width, static_cast<UINT16>(count.m_height), static_cast<UINT16>(count.m_depth));
+
+            // The tiles of a box region are mapped in x, then y, then z order.
+            imageTileIndices.clear();
+            imageTileIndices.reserve(request.m_sourceRegionSize.NumTiles);
+            for (uint32_t z = origin.m_front; z < origin.m_front + count.m_depth; ++z)
+            {
+                for (uint32_t y = origin.m_top; y < origin.m_top + count.m_height; ++y)
+                {
+                    for (uint32_t x = origin.m_left; x < origin.m_left + count.m_width; ++x)
+                    {
+                        imageTileIndices.push_back(
+                            tiling.StartTileIndexInOverallResource + (z * tiling.HeightInTiles + y) * tiling.WidthInTiles + x);
+                    }
+                }
+            }
+        }
+
+        RHI::ResultCode StreamingImagePool::GetImageTileLayoutInternal(const RHI::Image& imageBase, RHI::StreamingImageTileLayout& tileLayout) const
+        {
+            const Image& image = static_cast<const Image&>(imageBase);
+            if (!image.IsSparse())
+            {
+                return RHI::ResultCode::InvalidArgument;
+            }
+
+            const RHI::ImageDescriptor& descriptor = image.GetDescriptor();
+            const ImageTileLayout& imageTileLayout = image.m_tileLayout;
+            tileLayout.m_tileSize = imageTileLayout.m_tileSize;
+            tileLayout.m_tileSizeInBytes = D3D12_TILED_RESOURCE_TILE_SIZE_IN_BYTES;
+            tileLayout.m_standardMipCount = imageTileLayout.m_mipCountStandard;
+            tileLayout.m_arraySize = descriptor.m_arraySize;
+            for (uint32_t mipIndex = 0; mipIndex < imageTileLayout.m_mipCountStandard; ++mipIndex)
+            {
+                const D3D12_SUBRESOURCE_TILING& tiling =
+                    imageTileLayout.m_subresourceTiling[RHI::GetImageSubresourceIndex(mipIndex, 0, descriptor.m_mipLevels)];
+                tileLayout.m_mipSizeInTiles[mipIndex] = RHI::Size(tiling.WidthInTiles, tiling.HeightInTiles, tiling.DepthInTiles);
+            }
+            return RHI::ResultCode::Success;
+        }
+
+        RHI::ResultCode StreamingImagePool::MapImageTilesInternal(const RHI::StreamingImageTileRequest& request)
+        {
+            AZ_TRACE_METHOD();
+
+            Image& image = static_cast<Image&>(*request.m_image);
+            if (!image.IsSparse())
+            {
+                return RHI::ResultCode::InvalidArgument;
+            }
+
+            CommandList::TileMapRequest tileMapRequest;
+            AZStd::vector<uint32_t> imageTileIndices;
+            GetTileRegionInfo(image, request.m_region, tileMapRequest, imageTileIndices);
+            tileMapRequest.m_destinationHeap = m_heap.get();
+            tileMapRequest.m_destinationTileMap.resize(imageTileIndices.size());
+
+            // Tiles of the region that are already mapped keep their allocation.
+            AZStd::vector<bool> wasMapped(imageTileIndices.size());
+            uint32_t newTileCount = 0;
+            for (size_t regionTileIndex = 0; regionTileIndex < imageTileIndices.size(); ++regionTileIndex)
+            {
+                wasMapped[regionTileIndex] = image.m_tiles[imageTileIndices[regionTileIndex]].IsValid();
+                newTileCount += wasMapped[regionTileIndex] ? 0 : 1;
+            }
+            const size_t newSizeInBytes = static_cast<size_t>(newTileCount) * D3D12_TILED_RESOURCE_TILE_SIZE_IN_BYTES;
+
+            RHI::HeapMemoryUsage& memoryUsage = m_memoryUsage.GetHeapMemoryUsage(RHI::HeapMemoryLevel::Device);
+            if (!memoryUsage.TryReserveMemory(newSizeInBytes))
+            {
+                return RHI::ResultCode::OutOfMemory;
+            }
+
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_tileMutex);
+                for (size_t regionTileIndex = 0; regionTileIndex < imageTileIndices.size(); ++regionTileIndex)
+                {
+                    RHI::VirtualAddress& tile = image.m_tiles[imageTileIndices[regionTileIndex]];
+                    if (tile.IsNull())
+                    {
+                        tile = m_tileAllocator.Allocate();
+                        if (!tile.IsValid())
+                        {
+                            // The tile heap is exhausted, release the tiles allocated by this request.
+                            tile = {};
+                            for (size_t allocatedTileIndex = 0; allocatedTileIndex < regionTileIndex; ++allocatedTileIndex)
+                            {
+                                if (!wasMapped[allocatedTileIndex])
+                                {
+                                    RHI::VirtualAddress& allocatedTile = image.m_tiles[imageTileIndices[allocatedTileIndex]];
+                                    m_tileAllocator.DeAllocate(allocatedTile);
+                                    allocatedTile = {};
+                                }
+                            }
+                            m_tileAllocator.GarbageCollect();
+                            memoryUsage.m_reservedInBytes -= newSizeInBytes;
+                            return RHI::ResultCode::OutOfMemory;
+                        }
+                    }
+                    tileMapRequest.m_destinationTileMap[regionTileIndex] = static_cast<uint32_t>(tile.m_ptr);
+                }
+                m_tileAllocator.GarbageCollect();
+            }
+
+            GetDevice().GetAsyncUploadQueue().QueueTileMapping(tileMapRequest);
+
+            memoryUsage.m_residentInBytes += newSizeInBytes;
+            memoryUsage.Validate();
+            image.m_residentSizeInBytes += newSizeInBytes;
+
+            const RHI::Size& tileSize = image.m_tileLayout.m_tileSize;
+            const RHI::Origin& tileOrigin = request.m_region.m_tileOrigin;
+            const RHI::Origin texelOrigin(
+                tileOrigin.m_left * tileSize.m_width, tileOrigin.m_top * tileSize.m_height, tileOrigin.m_front * tileSize.m_depth);
+            GetDevice().GetAsyncUploadQueue().QueueUpload(request, texelOrigin);
+
+            return RHI::ResultCode::Success;
+        }
+
+        RHI::ResultCode StreamingImagePool::UnmapImageTilesInternal(RHI::Image& imageBase, const RHI::StreamingImageTileRegion& region)
+        {
+            AZ_TRACE_METHOD();
+
+            Image& image = static_cast<Image&>(imageBase);
+            if (!image.IsSparse())
+            {
+                return RHI::ResultCode::InvalidArgument;
+            }
+
+            // Wait for any upload of this image done, it may target the tiles of the region.
+            GetDevice().GetAsyncUploadQueue().WaitForUpload(image.GetUploadFenceValue());
+
+            // A request without a destination heap maps the region to null.
+            CommandList::TileMapRequest tileMapRequest;
+            AZStd::vector<uint32_t> imageTileIndices;
+            GetTileRegionInfo(image, region, tileMapRequest, imageTileIndices);
+            GetDevice().GetAsyncUploadQueue().QueueTileMapping(tileMapRequest);
+
+            uint32_t releasedTileCount = 0;
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_tileMutex);
+                for (uint32_t imageTileIndex : imageTileIndices)
+                {
+                    RHI::VirtualAddress& tile = image.m_tiles[imageTileIndex];
+                    if (tile.IsValid())
+                    {
+                        m_tileAllocator.DeAllocate(tile);
+                        tile = {};
+                        ++releasedTileCount;
+                    }
+                }
+                m_tileAllocator.GarbageCollect();
+            }
+
+            const size_t releasedSizeInBytes = static_cast<size_t>(releasedTileCount) * D3D12_TILED_RESOURCE_TILE_SIZE_IN_BYTES;
+            RHI::HeapMemoryUsage& memoryUsage = m_memoryUsage.GetHeapMemoryUsage(RHI::HeapMemoryLevel::Device);
+            memoryUsage.m_residentInBytes -= releasedSizeInBytes;
+            memoryUsage.m_reservedInBytes -= releasedSizeInBytes;
+            memoryUsage.Validate();
+            image.m_residentSizeInBytes -= releasedSizeInBytes;
+
             return RHI::ResultCode::Success;
         }
     }
@@ -44,6 +44,9 @@ namespace AZ
             RHI::ResultCode InitImageInternal(const RHI::StreamingImageInitRequest& request) override;
             RHI::ResultCode ExpandImageInternal(const RHI::StreamingImageExpandRequest& request) override;
             RHI::ResultCode TrimImageInternal(RHI::Image& image, uint32_t targetMipLevel) override;
+            RHI::ResultCode GetImageTileLayoutInternal(const RHI::Image& image, RHI::StreamingImageTileLayout& tileLayout) const override;
+            RHI::ResultCode MapImageTilesInternal(const RHI::StreamingImageTileRequest& request) override;
+            RHI::ResultCode UnmapImageTilesInternal(RHI::Image& image, const RHI::StreamingImageTileRegion& region) override;
             //////////////////////////////////////////////////////////////////////////
 
             //////////////////////////////////////////////////////////////////////////
@@ -62,6 +65,16 @@ namespace AZ
             // Packed mips occupy a dedicated set of tiles.
             void AllocatePackedImageTiles(Image& image);
 
+            // Creates a reserved resource where only the tail mips are mapped.
+            RHI::ResultCode InitSparseImage(const RHI::StreamingImageInitRequest& request);
+
+            // Returns the tile map request covering a region of a sparse image, and the image relative index of each of its tiles.
+            void GetTileRegionInfo(
+                const Image& image,
+                const RHI::StreamingImageTileRegion& region,
+                CommandList::TileMapRequest& request,
+                AZStd::vector<uint32_t>& imageTileIndices) const;
+
             RHI::Ptr<ID3D12Heap> m_heap;
 
             AZStd::mutex m_tileMutex;
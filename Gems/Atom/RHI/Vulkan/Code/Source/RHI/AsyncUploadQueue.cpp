@@ -29,6 +29,9 @@ namespace AZ
 {
     namespace Vulkan
     {
+        // Alignment of the buffer uploads that share the staging memory of a frame packet.
+        static constexpr uint32_t BatchedUploadAlignment = 16;
+
         AsyncUploadQueue::Descriptor::Descriptor(size_t stagingSizeInBytes)
         {
             m_stagingSizeInBytes = stagingSizeInBytes;
@@ -102,6 +105,55 @@ namespace AZ
                 FramePacket* framePacket = nullptr;
                 Queue* vulkanQueue = static_cast<Queue*>(queue);
 
+                if (byteCount <= m_descriptor.m_stagingSizeInBytes)
+                {
+                    if (m_batchingUploads &&
+                        RHI::AlignUp(m_framePackets[m_frameIndex].m_dataOffset, BatchedUploadAlignment) + byteCount > m_descriptor.m_stagingSizeInBytes)
+                    {
+                        FlushBatchedUploads(vulkanQueue);
+                    }
+
+                    if (!m_batchingUploads)
+                    {
+                        BeginFramePacket(vulkanQueue);
+                        m_batchingUploads = true;
+                    }
+
+                    framePacket = &m_framePackets[m_frameIndex];
+                    const uint32_t dataOffset = RHI::AlignUp(framePacket->m_dataOffset, BatchedUploadAlignment);
+                    EmmitPrologueMemoryBarrier(*buffer, 0, byteCount);
+
+                    uint8_t* mapped = reinterpret_cast<uint8_t*>(framePacket->m_stagingBuffer->GetBufferMemoryView()->Map(RHI::HostMemoryAccess::Write));
+                    memcpy(mapped + dataOffset, sourceData, byteCount);
+                    framePacket->m_stagingBuffer->GetBufferMemoryView()->Unmap(RHI::HostMemoryAccess::Write);
+
+                    RHI::CopyBufferDescriptor copyDescriptor;
+                    copyDescriptor.m_sourceBuffer = framePacket->m_stagingBuffer.get();
+                    copyDescriptor.m_sourceOffset = dataOffset;
+                    copyDescriptor.m_destinationBuffer = buffer;
+                    copyDescriptor.m_destinationOffset = 0;
+                    copyDescriptor.m_size = static_cast<uint32_t>(byteCount);
+                    m_commandList->Submit(RHI::CopyItem(copyDescriptor));
+                    framePacket->m_dataOffset = dataOffset + static_cast<uint32_t>(byteCount);
+
+                    EmmitEpilogueMemoryBarrier(*m_commandList, *buffer, 0, byteCount);
+
+                    if (request.m_fenceToSignal)
+                    {
+                        m_batchedFencesToSignal.push_back(static_cast<Fence*>(request.m_fenceToSignal));
+                    }
+                    m_batchedFencesToSignal.push_back(uploadFence);
+
+                    // Keep the frame packet open while more uploads are coming.
+                    if (!m_queue->HasPendingCommands())
+                    {
+                        FlushBatchedUploads(vulkanQueue);
+                    }
+                    return;
+                }
+
+                FlushBatchedUploads(vulkanQueue);
+
                 // Insert a barrier to wait for anybody using this buffer range.
                 // We need to create a command list to insert the barrier.
                 BeginFramePacket(vulkanQueue);
@@ -184,6 +236,7 @@ namespace AZ
                 AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzRender, "Upload Image");
 
                 Queue* vulkanQueue = static_cast<Queue*>(queue);
+                FlushBatchedUploads(vulkanQueue);
                 FramePacket* framePacket = BeginFramePacket(vulkanQueue);
 
                 // Set pipeline barriers before copy.
@@ -498,6 +551,24 @@ namespace AZ
             m_recordingFrame = false;
         }
 
+        void AsyncUploadQueue::FlushBatchedUploads(Queue* queue)
+        {
+            if (!m_batchingUploads)
+            {
+                return;
+            }
+
+            AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzRender);
+            EndFramePacket(queue);
+            m_batchingUploads = false;
+
+            for (const RHI::Ptr<Fence>& fence : m_batchedFencesToSignal)
+            {
+                queue->GetDescriptor().m_commandQueue->Signal(*fence);
+            }
+            m_batchedFencesToSignal.clear();
+        }
+
         void AsyncUploadQueue::EmmitPrologueMemoryBarrier(const Buffer& buffer, size_t offset, size_t size)
         {
             const BufferMemoryView* memoryView = buffer.GetBufferMemoryView();
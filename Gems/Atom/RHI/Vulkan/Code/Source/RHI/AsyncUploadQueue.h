@@ -85,6 +85,11 @@ namespace AZ
             FramePacket* BeginFramePacket(Queue* queue);
             void EndFramePacket(Queue* queue, Semaphore* semaphoreToSignal = nullptr);
 
+            // Buffer uploads that fit in the staging memory left in the current frame packet are recorded in it, instead of
+            // using three frame packets each. The frame packet is submitted when the copy queue runs out of commands, when the
+            // next upload doesn't fit, or before any other kind of upload.
+            void FlushBatchedUploads(Queue* queue);
+
             void EmmitPrologueMemoryBarrier(const Buffer& buffer, size_t offset, size_t size);
             void EmmitPrologueMemoryBarrier(const RHI::StreamingImageExpandRequest& request, uint32_t residentMip);
 
@@ -115,6 +120,9 @@ namespace AZ
             AZStd::vector<FramePacket> m_framePackets;
             uint32_t m_frameIndex = 0;
             bool m_recordingFrame = false;
+            bool m_batchingUploads = false;
+            // Fences of the uploads in the batch, signaled after the frame packet is submitted.
+            AZStd::vector<RHI::Ptr<Fence>> m_batchedFencesToSignal;
             // Async queue used for waiting for an upload event to complete.
             RHI::AsyncWorkQueue m_asyncWaitQueue;
 
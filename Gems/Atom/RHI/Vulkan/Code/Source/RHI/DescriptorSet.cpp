@@ -189,14 +189,23 @@ namespace AZ
         }
 
         void DescriptorSet::UpdateConstantData(AZStd::array_view<uint8_t> rawData)
+        {
+            UpdateConstantData(rawData, RHI::Interval(0, static_cast<uint32_t>(rawData.size())));
+        }
+
+        void DescriptorSet::UpdateConstantData(AZStd::array_view<uint8_t> rawData, const RHI::Interval& copyInterval)
         {
             AZ_Assert(m_constantDataBuffer, "Null constant buffer");
             const DescriptorSetLayout& layout = *m_descriptor.m_descriptorSetLayout;
 
             BufferMemoryView* memoryView = m_constantDataBuffer->GetBufferMemoryView();
-            uint8_t* mappedData = static_cast<uint8_t*>(memoryView->Map(RHI::HostMemoryAccess::Write));
-            memcpy(mappedData, rawData.data(), rawData.size());
-            memoryView->Unmap(RHI::HostMemoryAccess::Write);
+            const size_t copyMax = AZStd::min(static_cast<size_t>(copyInterval.m_max), rawData.size());
+            if (copyInterval.m_min < copyMax)
+            {
+                uint8_t* mappedData = static_cast<uint8_t*>(memoryView->Map(RHI::HostMemoryAccess::Write));
+                memcpy(mappedData + copyInterval.m_min, rawData.data() + copyInterval.m_min, copyMax - copyInterval.m_min);
+                memoryView->Unmap(RHI::HostMemoryAccess::Write);
+            }
 
             WriteDescriptorData data;
             data.m_layoutIndex = layout.GetLayoutIndexFromGroupIndex(0, DescriptorSetLayout::ResourceType::ConstantData);
@@ -12,6 +12,7 @@
 #include <Atom/RHI/BufferView.h>
 #include <Atom/RHI/Image.h>
 #include <Atom/RHI/ImageView.h>
+#include <Atom/RHI.Reflect/Interval.h>
 #include <Atom/RHI.Reflect/SamplerState.h>
 #include <AtomCore/std/containers/array_view.h>
 #include <AzCore/Memory/PoolAllocator.h>
@@ -61,6 +62,8 @@ namespace AZ
             void UpdateImageViews(uint32_t index, const AZStd::array_view<RHI::ConstPtr<RHI::ImageView>>& imageViews, RHI::ShaderInputImageType imageType);
             void UpdateSamplers(uint32_t index, const AZStd::array_view<RHI::SamplerState>& samplers);
             void UpdateConstantData(AZStd::array_view<uint8_t> data);
+            //! Only copies the [m_min, m_max) byte range of the data to the constant buffer, the rest is expected to be up to date.
+            void UpdateConstantData(AZStd::array_view<uint8_t> data, const RHI::Interval& copyInterval);
 
             RHI::Ptr<BufferView> GetConstantDataBufferView() const;
 
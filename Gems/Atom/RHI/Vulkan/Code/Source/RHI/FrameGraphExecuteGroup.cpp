@@ -27,6 +27,7 @@ namespace AZ
             Base::InitBase(device, scope.GetFrameGraphGroupId(), scope.GetHardwareQueueClass());
             m_scope = &scope;
             m_secondaryCommands.resize(commandListCount);
+            InitRecordTimes(commandListCount);
 
             m_workRequest.m_swapChainsToPresent.reserve(scope.GetSwapChainsToPresent().size());
             for (RHI::SwapChain* swapchainBase : scope.GetSwapChainsToPresent())
@@ -57,6 +58,7 @@ namespace AZ
         {
             AZ_Assert(m_scope, "Scope is null.");
             AZ_Assert(m_scope->GetFrameGraph(), "FrameGraph is null.");            
+            BeginRecordTime(contextIndex);
 
             // Create secondary command list for this context
             RHI::Ptr<CommandList> commandList = AcquireCommandList(VK_COMMAND_BUFFER_LEVEL_SECONDARY);
@@ -70,11 +72,12 @@ namespace AZ
             m_scope->Begin(*commandList);
         }
 
-        void FrameGraphExecuteGroup::EndContextInternal(RHI::FrameGraphExecuteContext& context, [[maybe_unused]] uint32_t contextIndex)
+        void FrameGraphExecuteGroup::EndContextInternal(RHI::FrameGraphExecuteContext& context, uint32_t contextIndex)
         {
             CommandList& commandList = static_cast<CommandList&>(*context.GetCommandList());
             m_scope->End(commandList);
             commandList.EndCommandBuffer();
+            EndRecordTime(contextIndex);
         }
 
         void FrameGraphExecuteGroup::EndInternal()
@@ -7,6 +7,7 @@
  */
 #include <RHI/FrameGraphExecuteGroupBase.h>
 #include <RHI/Device.h>
+#include <AzCore/std/time.h>
 
 namespace AZ
 {
@@ -38,5 +39,35 @@ namespace AZ
         {
             return m_device->AcquireCommandList(m_hardwareQueueClass, level);
         }
+
+        AZStd::sys_time_t FrameGraphExecuteGroupBase::GetScopeRecordTime(uint32_t scopeIndex) const
+        {
+            // A group with a single scope may record it with several contexts in parallel, otherwise each context is one scope.
+            if (GetScopes().size() == 1)
+            {
+                AZStd::sys_time_t recordTime = 0;
+                for (AZStd::sys_time_t contextRecordTime : m_contextRecordTimes)
+                {
+                    recordTime += contextRecordTime;
+                }
+                return recordTime;
+            }
+            return scopeIndex < m_contextRecordTimes.size() ? m_contextRecordTimes[scopeIndex] : 0;
+        }
+
+        void FrameGraphExecuteGroupBase::InitRecordTimes(uint32_t contextCount)
+        {
+            m_contextRecordTimes.assign(contextCount, 0);
+        }
+
+        void FrameGraphExecuteGroupBase::BeginRecordTime(uint32_t contextIndex)
+        {
+            m_contextRecordTimes[contextIndex] = AZStd::GetTimeNowTicks();
+        }
+
+        void FrameGraphExecuteGroupBase::EndRecordTime(uint32_t contextIndex)
+        {
+            m_contextRecordTimes[contextIndex] = AZStd::GetTimeNowTicks() - m_contextRecordTimes[contextIndex];
+        }
     }
 }
@@ -12,6 +12,7 @@
 #include <RHI/Scope.h>
 #include <RHI/CommandQueue.h>
 #include <Atom/RHI/FrameGraphExecuteGroup.h>
+#include <AzCore/std/containers/vector.h>
 
 namespace AZ
 {
@@ -41,13 +42,26 @@ namespace AZ
 
             virtual AZStd::array_view<RHI::Ptr<CommandList>> GetCommandLists() const = 0;
 
+            //! Returns the cpu time, in ticks, spent recording the scope at scopeIndex of GetScopes().
+            //! Only valid once the group has ended. The time of a scope recorded into several command lists is the sum of all of them.
+            AZStd::sys_time_t GetScopeRecordTime(uint32_t scopeIndex) const;
+
         protected:
             RHI::Ptr<CommandList> AcquireCommandList(VkCommandBufferLevel level) const;
 
+            // Measure the time spent recording a context, contextCount must be set in Init.
+            void InitRecordTimes(uint32_t contextCount);
+            void BeginRecordTime(uint32_t contextIndex);
+            void EndRecordTime(uint32_t contextIndex);
+
             Device* m_device = nullptr;
             RHI::HardwareQueueClass m_hardwareQueueClass = RHI::HardwareQueueClass::Graphics;
             ExecuteWorkRequest m_workRequest;
             RHI::GraphGroupId m_groupId;
+
+        private:
+            // Holds the start time of a context while it's being recorded, and its duration afterwards.
+            AZStd::vector<AZStd::sys_time_t> m_contextRecordTimes;
         };
     }
 }
@@ -28,6 +28,7 @@ namespace AZ
             Base::InitBase(device, groupId, scopes.back()->GetHardwareQueueClass());
 
             m_scopes = AZStd::move(scopes);
+            InitRecordTimes(static_cast<uint32_t>(m_scopes.size()));
 
             auto& swapChainsToPresent = m_workRequest.m_swapChainsToPresent;
             AZStd::vector<RHI::ScopeId> scopeIds;
@@ -73,6 +74,7 @@ namespace AZ
         {
             AZ_Assert(static_cast<uint32_t>(m_lastCompletedScope + 1) == contextIndex, "Contexts must be recorded in order!");
 
+            BeginRecordTime(contextIndex);
             const Scope* scope = m_scopes[contextIndex];
             context.SetCommandList(*m_commandList);
 
@@ -109,6 +111,7 @@ namespace AZ
             scope->ResolveMSAAAttachments(*commandList);
             scope->End(*commandList);
             scope->EmitScopeBarriers(*m_commandList, Scope::BarrierSlot::Epilogue);
+            EndRecordTime(contextIndex);
         }
 
         AZStd::array_view<const Scope*> FrameGraphExecuteGroupMerged::GetScopes() const
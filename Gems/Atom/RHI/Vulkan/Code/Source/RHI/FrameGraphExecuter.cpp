@@ -73,17 +73,21 @@ namespace AZ
 
                 const uint32_t estimatedItemCount = scope.GetEstimatedItemCount();
 
+                // Items of some scopes, like a forward pass binding many shader resource groups per draw, take much longer
+                // to record than others. Weighting them by last frame's record times spreads those scopes over more command lists.
+                const uint32_t weightedItemCount = static_cast<uint32_t>(estimatedItemCount * GetItemCostWeight(scope));
+
                 const uint32_t CommandListCostThreshold =
                     AZStd::max(
                         m_frameGraphExecuterData.m_commandListCostThresholdMin,
-                        RHI::DivideByMultiple(estimatedItemCount, m_frameGraphExecuterData.m_commandListsPerScopeMax));
+                        RHI::DivideByMultiple(weightedItemCount, m_frameGraphExecuterData.m_commandListsPerScopeMax));
 
                 /**
                     * Computes a cost heuristic based on the number of items and number of attachments in
                     * the scope. This cost is used to partition command list generation.
                     */
                 const uint32_t totalScopeCost =
-                    estimatedItemCount * m_frameGraphExecuterData.m_itemCost +
+                    weightedItemCount * m_frameGraphExecuterData.m_itemCost +
                     static_cast<uint32_t>(scope.GetAttachments().size()) * m_frameGraphExecuterData.m_attachmentCost;
 
                 // Check if we are in a middle of a framegraph group.
@@ -169,6 +173,16 @@ namespace AZ
         void FrameGraphExecuter::ExecuteGroupInternal(RHI::FrameGraphExecuteGroup& groupBase)
         {
             FrameGraphExecuteGroupBase& group = static_cast<FrameGraphExecuteGroupBase&>(groupBase);
+
+            // Groups are executed one at a time, in order, so the costs don't need a lock.
+            AZStd::array_view<const Scope*> scopes = group.GetScopes();
+            for (uint32_t scopeIndex = 0; scopeIndex < scopes.size(); ++scopeIndex)
+            {
+                ScopeRecordCost& recordCost = m_scopeRecordCosts[scopes[scopeIndex]->GetId()];
+                recordCost.m_itemCount = scopes[scopeIndex]->GetEstimatedItemCount();
+                recordCost.m_recordTime = group.GetScopeRecordTime(scopeIndex);
+            }
+
             auto findIter = m_groupHandlers.find(group.GetGroupId());
             AZ_Assert(findIter != m_groupHandlers.end(), "Could not find group handler for groupId %d", group.GetGroupId().GetIndex());
             FrameGraphExecuteGroupHandlerBase* handler = findIter->second.get();
@@ -183,6 +197,37 @@ namespace AZ
         void FrameGraphExecuter::EndInternal()
         {
             m_groupHandlers.clear();
+
+            uint64_t itemCount = 0;
+            AZStd::sys_time_t recordTime = 0;
+            for (const auto& scopeRecordCost : m_scopeRecordCosts)
+            {
+                if (scopeRecordCost.second.m_itemCount > 0)
+                {
+                    itemCount += scopeRecordCost.second.m_itemCount;
+                    recordTime += scopeRecordCost.second.m_recordTime;
+                }
+            }
+            m_previousRecordTimePerItem = itemCount > 0 ? static_cast<float>(recordTime) / itemCount : 0.0f;
+
+            AZStd::swap(m_previousScopeRecordCosts, m_scopeRecordCosts);
+            m_scopeRecordCosts.clear();
+        }
+
+        float FrameGraphExecuter::GetItemCostWeight(const Scope& scope) const
+        {
+            // Keeps a single slow frame, like one that compiles pipeline states, from splitting a scope into too many command lists.
+            const float ItemCostWeightMin = 0.25f;
+            const float ItemCostWeightMax = 8.0f;
+
+            auto findIter = m_previousScopeRecordCosts.find(scope.GetId());
+            if (m_previousRecordTimePerItem <= 0.0f || findIter == m_previousScopeRecordCosts.end() || findIter->second.m_itemCount == 0)
+            {
+                return 1.0f;
+            }
+
+            const float recordTimePerItem = static_cast<float>(findIter->second.m_recordTime) / findIter->second.m_itemCount;
+            return AZStd::clamp(recordTimePerItem / m_previousRecordTimePerItem, ItemCostWeightMin, ItemCostWeightMax);
         }
 
         void FrameGraphExecuter::AddExecuteGroupHandler(const RHI::GraphGroupId& groupId, const AZStd::vector<RHI::FrameGraphExecuteGroup*>& groups)
@@ -9,6 +9,7 @@
 
 #include <Atom/RHI/FrameGraph.h>
 #include <Atom/RHI/FrameGraphExecuter.h>
+#include <Atom/RHI.Reflect/ScopeId.h>
 #include <RHI/CommandQueue.h>
 #include <RHI/FrameGraphExecuteGroupHandlerBase.h>
 
@@ -19,7 +20,7 @@ namespace AZ
     namespace Vulkan
     {
         class Device;
-
+        class Scope;
 
         class FrameGraphExecuter final
             : public RHI::FrameGraphExecuter
@@ -47,9 +48,24 @@ namespace AZ
             // Adds a handler for a list of execute groups.
             void AddExecuteGroupHandler(const RHI::GraphGroupId& groupId, const AZStd::vector<RHI::FrameGraphExecuteGroup*>& groups);
 
+            // Returns how expensive the items of a scope were to record last frame, relative to the average item of the frame.
+            float GetItemCostWeight(const Scope& scope) const;
+
+            struct ScopeRecordCost
+            {
+                uint32_t m_itemCount = 0;
+                AZStd::sys_time_t m_recordTime = 0;
+            };
+
             // List of handlers for execute groups.
             AZStd::unordered_map<RHI::GraphGroupId, AZStd::unique_ptr<FrameGraphExecuteGroupHandlerBase>> m_groupHandlers;
             FrameGraphExecuterData m_frameGraphExecuterData;
+
+            // Recording costs of the scopes of the frame being executed, and of the previous frame which the partitioning is based on.
+            AZStd::unordered_map<RHI::ScopeId, ScopeRecordCost> m_scopeRecordCosts;
+            AZStd::unordered_map<RHI::ScopeId, ScopeRecordCost> m_previousScopeRecordCosts;
+            // Average record time of one item in the previous frame.
+            float m_previousRecordTimePerItem = 0.0f;
         };
     }
 }
@@ -50,6 +50,8 @@ namespace AZ
             uint64_t m_lastCompileFrameIteration = 0;
             RHI::Ptr<DescriptorSetLayout> m_descriptorSetLayout;
             AZStd::vector<RHI::Ptr<DescriptorSet>> m_compiledData;
+            /// The constant byte ranges written since each compiled descriptor set stopped being the current one.
+            AZStd::vector<RHI::Interval> m_constantDirtyIntervals;
         };
     }
 }
@@ -87,6 +87,10 @@ namespace AZ
                 }
                 group.m_compiledData.push_back(descriptorSet);
             }
+
+            // The constant buffers of all the descriptor sets start uninitialized.
+            group.m_constantDirtyIntervals.assign(
+                m_descriptorSetCount, RHI::Interval(0, GetLayout()->GetConstantDataSize()));
             
             return result;
         }
@@ -104,6 +108,7 @@ namespace AZ
         RHI::ResultCode ShaderResourceGroupPool::CompileGroupInternal(RHI::ShaderResourceGroup& groupBase, const RHI::ShaderResourceGroupData& groupData)
         {
             auto& group = static_cast<ShaderResourceGroup&>(groupBase);
+            const uint32_t previousCompiledDataIndex = group.GetCompileDataIndex();
             group.UpdateCompiledDataIndex(m_currentIteration);
             DescriptorSet& descriptorSet = *group.m_compiledData[group.GetCompileDataIndex()];
 
@@ -166,7 +171,30 @@ namespace AZ
             auto constantData = groupData.GetConstantData();
             if (!constantData.empty())
             {
-                descriptorSet.UpdateConstantData(constantData);
+                // The constant buffer of the descriptor set was last written m_descriptorSetCount frames ago, so it needs
+                // every range modified since then. Compiling again in the same frame adds to the range of the current set.
+                const RHI::Interval dirtyInterval = groupData.GetConstantDataDirtyInterval();
+                RHI::Interval& currentInterval = group.m_constantDirtyIntervals[group.GetCompileDataIndex()];
+                if (group.GetCompileDataIndex() != previousCompiledDataIndex || currentInterval.m_min == currentInterval.m_max)
+                {
+                    currentInterval = dirtyInterval;
+                }
+                else if (dirtyInterval.m_min < dirtyInterval.m_max)
+                {
+                    currentInterval.m_min = AZStd::min(currentInterval.m_min, dirtyInterval.m_min);
+                    currentInterval.m_max = AZStd::max(currentInterval.m_max, dirtyInterval.m_max);
+                }
+
+                RHI::Interval copyInterval(static_cast<uint32_t>(constantData.size()), 0);
+                for (const RHI::Interval& interval : group.m_constantDirtyIntervals)
+                {
+                    if (interval.m_min < interval.m_max)
+                    {
+                        copyInterval.m_min = AZStd::min(copyInterval.m_min, interval.m_min);
+                        copyInterval.m_max = AZStd::max(copyInterval.m_max, interval.m_max);
+                    }
+                }
+                descriptorSet.UpdateConstantData(constantData, copyInterval);
             }
             descriptorSet.CommitUpdates();
 
@@ -48,6 +48,9 @@ namespace AZ
             //! Blocks until a streaming upload has completed (if one is currently in flight).
             void WaitForUpload();
 
+            //! Returns whether a streaming upload is still in flight, without blocking.
+            bool IsUploadPending() const;
+
             RHI::Buffer* GetRHIBuffer();
 
             const RHI::Buffer* GetRHIBuffer() const;
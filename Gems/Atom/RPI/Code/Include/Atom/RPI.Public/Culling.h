@@ -15,7 +15,9 @@
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/combinable.h>
 #include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/shared_mutex.h>
 
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/Console.h>
@@ -100,6 +102,9 @@ namespace AZ
             //! something that shouldn't be rendered, regardless of its actual position relative to the camera
             bool m_isHidden = false;
 
+            //! Flag indicating if the cullable is waiting in the CullingScene for its update to be applied to the visibility scene.
+            bool m_isUpdateQueued = false;
+
             void SetDebugName([[maybe_unused]] const AZ::Name& debugName)
             {
 #ifdef AZ_CULL_DEBUG_ENABLED
@@ -129,6 +134,8 @@ namespace AZ
             // UI Options
             bool m_enableStats = false;
             bool m_enableFrustumCulling = true;
+            //! Culls the objects behind the depth read back by the HierarchicalZPass, when r_hiZOcclusionCulling is enabled
+            bool m_enableHierarchicalZCulling = true;
             bool m_parallelOctreeTraversal = true;
             bool m_freezeFrustums = false;
             bool m_debugDraw = false;
@@ -161,6 +168,7 @@ namespace AZ
                     m_numJobs = 0;
                     m_numVisibleCullables = 0;
                     m_numVisibleDrawPackets = 0;
+                    m_numOccludedCullables = 0;
                 }
 
                 AZ::Name m_name;
@@ -168,6 +176,7 @@ namespace AZ
                 AZStd::atomic_uint32_t m_numJobs = 0;
                 AZStd::atomic_uint32_t m_numVisibleCullables = 0;
                 AZStd::atomic_uint32_t m_numVisibleDrawPackets = 0;
+                AZStd::atomic_uint32_t m_numOccludedCullables = 0;
             };
 
             CullingDebugContext() = default;
@@ -245,17 +254,24 @@ namespace AZ
 
             //! Adds a Cullable to the underlying visibility system(s).
             //! Must be called at least once on initialization and whenever a Cullable's position or bounds is changed.
-            //! Is not threadsafe, so call this from the main thread outside of Begin/EndCulling()
+            //! Can be called from several threads outside of Begin/EndCulling(). When r_CullDeferredUpdates is enabled the
+            //! cullable is queued, without locking the visibility scene, and the queued cullables are applied in BeginCulling().
             void RegisterOrUpdateCullable(Cullable& cullable);
 
-            //! Removes a Cullable from the underlying visibility system(s).
+            //! Removes a Cullable from the underlying visibility system(s), and cancels its queued update if it has one.
             //! Must be called once for each cullable object on de-initialization.
-            //! Is not threadsafe, so call this from the main thread outside of Begin/EndCulling()
+            //! Can be called from several threads outside of Begin/EndCulling().
             void UnregisterCullable(Cullable& cullable);
 
             //! Returns the number of cullables that have been added to the CullingScene
             uint32_t GetNumCullables() const;
 
+            //! Returns true if a cullable was registered, updated or unregistered inside the frustum since the last BeginCulling().
+            //! Lets the feature processors keep results that only depend on the content of a view, like cached shadowmaps,
+            //! until something changes in that view. Only the current bounds of an updated cullable are tested.
+            //! Is not threadsafe, so call this from the main thread outside of Begin/EndCulling()
+            bool HasChangedCullables(const Frustum& frustum);
+
             CullingDebugContext& GetDebugContext()
             {
                 return m_debugCtx;
@@ -267,11 +283,21 @@ namespace AZ
         protected:
             size_t CountObjectsInScene();
 
+            //! Applies the updates queued by RegisterOrUpdateCullable to the visibility scene.
+            void ApplyQueuedCullableUpdates();
+
             const Scene* m_parentScene = nullptr;
             AzFramework::IVisibilityScene* m_visScene = nullptr;
             CullingDebugContext m_debugCtx;
             AZStd::concurrency_checker m_cullDataConcurrencyCheck;
             OcclusionPlaneVector m_occlusionPlanes;
+
+            //! Cullables waiting for their update to be applied to the visibility scene, in one queue per thread.
+            AZStd::combinable<AZStd::vector<Cullable*>> m_queuedCullableUpdates;
+            //! Held shared while queuing a cullable, and exclusively to apply or cancel queued updates.
+            AZStd::shared_mutex m_queuedCullableUpdatesMutex;
+            //! Bounds of the cullables registered, updated or unregistered since the last BeginCulling(), in one list per thread.
+            AZStd::combinable<AZStd::vector<Aabb>> m_changedCullableBounds;
         };
         
 
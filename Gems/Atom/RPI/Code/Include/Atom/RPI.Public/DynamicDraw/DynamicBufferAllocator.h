@@ -16,6 +16,8 @@
 #include <Atom/RPI.Public/Base.h>
 #include <Atom/RPI.Public/Buffer/Buffer.h>
 
+#include <AzCore/std/parallel/atomic.h>
+
 
 namespace AZ
 {
@@ -29,6 +31,9 @@ namespace AZ
         //! Limitation: the allocation may fail if the request buffer size is larger than the ring buffer size or
         //!     there isn't enough unused memory available within the ring buffer. User may increase the input of Init(ringBufferSize)
         //!     to increase the ring buffer's size. 
+        //! Allocate can be called from several threads at the same time without locking. Each thread sub-allocates small buffers
+        //! from its own block of the ring buffer, and only fetches a new block, or a large buffer, with an atomic operation.
+        //! FrameEnd must not be called while other threads allocate.
         class DynamicBufferAllocator
         {
             AZ_RTTI(AZ::RPI::DynamicBufferAllocator, "{82B047B3-C845-4F77-9852-747E39C53081}");
@@ -43,7 +48,7 @@ namespace AZ
 
             void Shutdown();
 
-            //! Allocate a dynamic buffer with specified size and alignment
+            //! Allocate a dynamic buffer with specified size and alignment. The alignment must be a power of two.
             //! It may return nullptr if the input size is larger than ring buffer size or there isn't enough unused memory available within the ring buffer
             RHI::Ptr<DynamicBuffer> Allocate(uint32_t size, uint32_t alignment);
 
@@ -60,15 +65,33 @@ namespace AZ
             void SetEnableAllocationWarning(bool enable);
 
         private:
+            //! Size of the blocks which threads sub-allocate small buffers from.
+            static constexpr uint32_t ThreadBlockSize = 64 * 1024;
+            //! Buffers larger than this are allocated directly from the ring buffer.
+            static constexpr uint32_t MaxThreadBlockAllocationSize = ThreadBlockSize / 4;
+
             // Get buffer's offset;
             uint32_t GetBufferAddressOffset(RHI::Ptr<DynamicBuffer> dynamicBuffer);
 
+            // Reserves a range of the memory available to the current frame and returns its position in the ring buffer.
+            bool AllocateRange(uint32_t size, uint32_t& position);
+
+            // Sets the memory available to the frame that starts at m_currentPosition.
+            void BeginFrame();
+
             // The position where the buffer is available.
             uint32_t m_currentPosition = 0;
             // The upper bound limit of the allocation of current frame 
             uint32_t m_endPositionLimit = 0;
-            // The allocated buffer size of current frame
-            uint32_t m_currentAllocatedSize = 0;
+
+            // The memory available to the current frame is the range from m_currentPosition to the end of the ring buffer or to
+            // m_endPositionLimit, followed by the range from the start of the ring buffer to m_endPositionLimit when it wraps around.
+            uint32_t m_frameFirstRangeSize = 0;
+            uint32_t m_frameAvailableSize = 0;
+            // The size reserved from the memory available to the current frame
+            AZStd::atomic<uint32_t> m_frameAllocatedSize{ 0 };
+            // Unique for each frame of each allocator, so the blocks of threads are never reused across frames
+            uint32_t m_frameGeneration = 0;
 
             uint32_t m_ringBufferSize = 0;
             void* m_ringBufferStartAddress = 0;
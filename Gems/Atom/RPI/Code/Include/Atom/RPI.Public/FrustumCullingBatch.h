@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Math/Frustum.h>
+#include <AzCore/Math/Sphere.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        //! Bounding spheres stored as structure of arrays, so they can be classified against a frustum several at a time.
+        //! The culling jobs fill one batch per octree node with the cullables that pass the view filters, then classify
+        //! the whole batch with SIMD instructions instead of testing each sphere separately.
+        //! The results match ShapeIntersection::Classify(Frustum, Sphere).
+        class FrustumCullingBatch
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(FrustumCullingBatch, SystemAllocator, 0);
+
+            //! Removes all spheres, keeping the memory.
+            void Clear();
+
+            //! Adds a sphere and returns its index in the batch.
+            uint32_t AddSphere(const Sphere& sphere);
+
+            uint32_t GetSphereCount() const;
+
+            //! Classifies all spheres against the frustum. The indices of the spheres that are entirely inside the frustum
+            //! are appended to interiorIndices, and the ones that cross a plane of the frustum to overlappingIndices.
+            //! Spheres that are outside of the frustum aren't reported.
+            void Classify(const Frustum& frustum, AZStd::vector<uint32_t>& interiorIndices, AZStd::vector<uint32_t>& overlappingIndices) const;
+
+        private:
+            // Padded to a multiple of the SIMD width, the padding is never reported
+            AZStd::vector<float> m_centerX;
+            AZStd::vector<float> m_centerY;
+            AZStd::vector<float> m_centerZ;
+            AZStd::vector<float> m_radius;
+            uint32_t m_sphereCount = 0;
+        };
+    } // namespace RPI
+} // namespace AZ
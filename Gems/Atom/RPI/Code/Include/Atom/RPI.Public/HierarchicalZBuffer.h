@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Matrix4x4.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/array_view.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        //! A CPU copy of a view's depth buffer reduced to a hierarchy of farthest depths, used to cull occluded objects.
+        //! Each texel of the first mip holds the farthest depth of the screen tile it covers, as produced by the
+        //! HierarchicalZPass, and each following mip holds the farthest depth of 2x2 texels of the previous one.
+        //! Depth is reversed, so the farthest depth is the smallest value.
+        //! The buffer is only valid for the world to clip matrix the depth was rendered with. Bounds are projected with that
+        //! matrix, which keeps the test conservative for static occluders even though the data is a few frames old.
+        class HierarchicalZBuffer
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(HierarchicalZBuffer, SystemAllocator, 0);
+
+            //! @param farthestDepths width * height depths, in rows from the top of the screen
+            //! @param worldToClip The world to clip matrix the depth was rendered with
+            HierarchicalZBuffer(AZStd::array_view<float> farthestDepths, uint32_t width, uint32_t height, const Matrix4x4& worldToClip);
+
+            //! Returns true if the bounds are entirely behind the depth buffer.
+            //! Bounds that cross the near plane or leave the screen are never occluded.
+            bool IsOccluded(const Aabb& worldBounds) const;
+
+            uint32_t GetMipCount() const;
+            uint32_t GetWidth(uint32_t mip) const;
+            uint32_t GetHeight(uint32_t mip) const;
+
+            //! Returns the farthest depth of a texel of a mip.
+            float GetDepth(uint32_t mip, uint32_t x, uint32_t y) const;
+
+            const Matrix4x4& GetWorldToClipMatrix() const;
+
+        private:
+            struct Mip
+            {
+                uint32_t m_width = 0;
+                uint32_t m_height = 0;
+                AZStd::vector<float> m_depths;
+            };
+
+            AZStd::vector<Mip> m_mips;
+            Matrix4x4 m_worldToClip;
+        };
+    } // namespace RPI
+} // namespace AZ
@@ -18,6 +18,7 @@
 #include <Atom/RPI.Reflect/Asset/BuiltInAssetHandler.h>
 #include <Atom/RPI.Reflect/Image/DefaultStreamingImageControllerAsset.h>
 #include <Atom/RPI.Reflect/Image/ImageSystemDescriptor.h>
+#include <Atom/RPI.Reflect/Image/MipFeedbackStreamingImageControllerAsset.h>
 
 #include <Atom/RPI.Public/Image/ImageSystemInterface.h>
 #include <Atom/RPI.Public/Image/AttachmentImage.h>
@@ -75,6 +76,9 @@ namespace AZ
 
             Data::Asset<DefaultStreamingImageControllerAsset> m_defaultStreamingImageControllerAsset;
 
+            // Controller of the asset streaming pool when ImageSystemDescriptor::m_useMipFeedbackStreaming is set
+            Data::Asset<MipFeedbackStreamingImageControllerAsset> m_mipFeedbackStreamingImageControllerAsset;
+
             AZStd::fixed_vector<Data::Instance<Image>, static_cast<uint32_t>(SystemImage::Count)> m_systemImages;
 
             bool m_initialized = false;
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/RPI.Reflect/Image/MipFeedbackStreamingImageControllerAsset.h>
+
+#include <Atom/RPI.Public/Image/StreamingImageController.h>
+#include <Atom/RPI.Public/Image/StreamingImageContext.h>
+
+#include <AzCore/std/containers/fixed_vector.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        //! Streams the mips of each image that were requested recently, keeping the resident mips under a memory budget.
+        //! Requests come from StreamingImage::SetTargetMip and from the mip feedback of the BindlessResourceTable, which holds
+        //! the most detailed mip level the GPU sampled from each bindless image in a recent frame (see MipFeedbackPass).
+        //! Every update the controller:
+        //!  - queues the expansion of the most recently requested images to their requested mip, up to
+        //!    MipFeedbackStreamingImageControllerAsset::m_maxExpandsPerUpdate images and while the expansions fit in the budget;
+        //!  - trims the images that are more detailed than requested, least recently used first, when the budget is exceeded
+        //!    or the pending expansions don't fit;
+        //!  - trims the least recently used images by one mip chain when the budget is still exceeded.
+        //! Images that never received a request are fully expanded, like DefaultStreamingImageController does, so images that
+        //! are neither bindless nor given a target mip keep their full detail.
+        class MipFeedbackStreamingImageController final
+            : public StreamingImageController
+        {
+            friend class ImageSystem;
+        public:
+            AZ_RTTI(MipFeedbackStreamingImageController, "{2A9D47E6-0B8C-4E31-A5F7-6C3D19B2E084}", StreamingImageController)
+
+            static Data::Instance<MipFeedbackStreamingImageController> FindOrCreate(const Data::Asset<MipFeedbackStreamingImageControllerAsset>& asset);
+
+        private:
+            //! Tracks the requests of an image across updates.
+            class MipFeedbackContext final
+                : public StreamingImageContext
+            {
+            public:
+                AZ_CLASS_ALLOCATOR(MipFeedbackContext, AZ::ThreadPoolAllocator, 0);
+
+                //! Device memory used by the image when the mip chain at the same index and the less detailed ones are resident.
+                AZStd::fixed_vector<size_t, RHI::Limits::Image::MipCountMax> m_mipChainSizesInBytes;
+
+                //! The most detailed mip level requested while the request was alive.
+                uint16_t m_requestedMipLevel = RHI::Limits::Image::MipCountMax;
+
+                //! The timestamp of the last request.
+                size_t m_requestTimestamp = 0;
+
+                //! Whether the image received a request since it was attached.
+                bool m_hasRequests = false;
+            };
+
+            struct ImageEntry
+            {
+                StreamingImage* m_image = nullptr;
+                MipFeedbackContext* m_context = nullptr;
+                size_t m_targetMipChain = 0;
+                size_t m_desiredMipChain = 0;
+                bool m_trimmed = false;
+            };
+
+            // Standard init for InstanceData subclass
+            MipFeedbackStreamingImageController() = default;
+            static Data::Instance<MipFeedbackStreamingImageController> CreateInternal(Data::AssetData* assetData);
+            RHI::ResultCode Init(MipFeedbackStreamingImageControllerAsset& imageControllerAsset);
+
+            ///////////////////////////////////////////////////////////////////
+            // StreamingImageController Overrides
+            StreamingImageContextPtr CreateContextInternal() override;
+            void UpdateInternal(size_t timestamp, const StreamingImageContextList& contexts) override;
+            ///////////////////////////////////////////////////////////////////
+
+            //! Fills MipFeedbackContext::m_mipChainSizesInBytes from the image descriptor.
+            void InitMipChainSizes(const StreamingImage* image, MipFeedbackContext& context) const;
+
+            //! Returns the mip level the image was requested at in this update, or RHI::Limits::Image::MipCountMax.
+            uint16_t GetRequestedMipLevel(const StreamingImage* image, const MipFeedbackContext& context) const;
+
+            size_t m_memoryBudgetInBytes = 0;
+            uint32_t m_maxExpandsPerUpdate = 0;
+            uint32_t m_requestLifetimeInUpdates = 0;
+
+            //! Scratch lists kept to avoid reallocating them every update
+            AZStd::vector<ImageEntry> m_entries;
+            AZStd::vector<ImageEntry*> m_sortedEntries;
+            AZStd::vector<ImageEntry*> m_expansions;
+        };
+    }
+}
@@ -69,6 +69,17 @@ namespace AZ
             void QueueExpandToMipChainLevel(StreamingImage* image, size_t mipChainIndex);
             void TrimToMipChainLevel(StreamingImage* image, size_t mipChainIndex);
 
+            //! Wrapped streaming image queries used for derived StreamingImageController classes
+            size_t GetMipChainCount(const StreamingImage* image) const;
+            size_t GetMipChainIndex(const StreamingImage* image, size_t mipLevel) const;
+            size_t GetMipLevel(const StreamingImage* image, size_t mipChainIndex) const;
+
+            //! Returns the mip chain the image is streaming to, or is resident at when no expansion is in flight.
+            size_t GetTargetMipChainIndex(const StreamingImage* image) const;
+
+            //! Returns the streaming image pool the controller was created for.
+            const RHI::StreamingImagePool* GetPool() const;
+
         private:
 
             ///////////////////////////////////////////////////////////////////
@@ -23,6 +23,8 @@
 
 #include <AtomCore/Instance/InstanceData.h>
 
+#include <AzCore/std/containers/unordered_map.h>
+
 namespace AZ
 {
     namespace RHI
@@ -95,6 +97,11 @@ namespace AZ
             //! Does nothing if NeedsCompile() is false or CanCompile() is false.
             //! @return whether compilation occurred
             bool Compile();
+
+            //! Queues the material to be compiled by the MaterialSystem before the next render tick, together with the other
+            //! queued materials on multiple jobs. Prefer this to Compile() when changing many materials in a frame.
+            //! Compiles immediately if the MaterialSystem is not available.
+            void QueueCompile();
             
             //! Returns an ID that can be used to track whether the material has changed since the last time client code read it.
             //! This gets incremented every time a change is made, like by calling SetPropertyValue().
@@ -156,6 +163,12 @@ namespace AZ
             template<typename Type>
             bool SetShaderOption(ShaderOptionGroup& options, ShaderOptionIndex shaderOptionIndex, Type value);
 
+            //! Writes the bindless table index of an image to a shader constant, releasing the index previously written to it.
+            void SetBindlessImageIndex(RHI::ShaderInputConstantIndex shaderInputIndex, const Data::Instance<Image>& image);
+
+            //! Releases every bindless table index held by the material.
+            void ReleaseBindlessImageIndices();
+
             static const char* s_debugTraceName;
 
             //! The corresponding material asset that provides material type data and initial property values.
@@ -189,6 +202,12 @@ namespace AZ
 
             //! Records the m_currentChangeId when the material was last compiled.
             ChangeId m_compiledChangeId = DEFAULT_CHANGE_ID;
+
+            //! Whether the material is in the MaterialSystem compile queue. Guarded by the MaterialSystem queue mutex.
+            bool m_isQueuedForCompile = false;
+
+            //! Bindless table indices held by the material, keyed by the shader constant they were written to.
+            AZStd::unordered_map<uint32_t, uint32_t> m_bindlessImageIndices;
         };
 
     } // namespace RPI
@@ -7,23 +7,54 @@
  */
 #pragma once
 
+#include <Atom/RHI.Reflect/FrameSchedulerEnums.h>
 #include <Atom/RPI.Reflect/Asset/AssetHandler.h>
 
+#include <AtomCore/Instance/Instance.h>
+
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+
 namespace AZ
 {
     class ReflectContext;
 
     namespace RPI
     {
-        //! Manages system-wide initialization and support for material classes
+        class Material;
+
+        //! Manages system-wide initialization and support for material classes.
+        //! Also compiles the materials queued with Material::QueueCompile once per frame, spreading them over jobs.
         class MaterialSystem
         {
         public:
+            AZ_RTTI(MaterialSystem, "{6E0B5C4A-93D2-4F18-B7A1-2C8E5D9F3A64}");
+
+            MaterialSystem() = default;
+            virtual ~MaterialSystem() = default;
+
+            AZ_DISABLE_COPY_MOVE(MaterialSystem);
+
+            static MaterialSystem* Get();
+
             static void Reflect(AZ::ReflectContext* context);
             static void GetAssetHandlers(AssetHandlerPtrList& assetHandlers);
 
             void Init();
             void Shutdown();
+
+            //! Adds a material to the materials compiled by the next call to CompileQueuedMaterials. Can be called from any thread.
+            //! A material queued more than once is only compiled once.
+            void QueueMaterialCompile(const Data::Instance<Material>& material);
+
+            //! Compiles the queued materials. The materials are partitioned by shader resource group pool, and each partition
+            //! is compiled on its own job, since the materials of a same material type share their pool and their functors,
+            //! which aren't safe to run concurrently. Materials that can't compile yet stay queued for the next call.
+            void CompileQueuedMaterials(RHI::JobPolicy jobPolicy);
+
+        private:
+            AZStd::mutex m_compileQueueMutex;
+            AZStd::vector<Data::Instance<Material>> m_compileQueue;
         };
 
     } // namespace RPI
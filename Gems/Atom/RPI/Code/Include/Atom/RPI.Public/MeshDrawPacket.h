@@ -15,6 +15,7 @@
 #include <Atom/RHI/DrawPacketBuilder.h>
 
 #include <AzCore/Math/Obb.h>
+#include <AzCore/std/optional.h>
 
 
 namespace AZ
@@ -46,8 +47,15 @@ namespace AZ
 
             void SetStencilRef(uint8_t stencilRef) { m_stencilRef = stencilRef; }
             void SetSortKey(RHI::DrawItemSortKey sortKey) { m_sortKey = sortKey; };
+            //! Sets the priority of the load requests of the shader variants that aren't loaded yet when the draw packet is built.
+            //! This is the largest screen coverage the mesh is drawn with, see IShaderVariantFinder::DefaultLoadPriority.
+            void SetShaderVariantLoadPriority(float priority) { m_shaderVariantLoadPriority = priority; }
             bool SetShaderOption(const Name& shaderOptionName, RPI::ShaderOptionValue value);
 
+            //! Draws the mesh with indirect arguments instead of the mesh's own draw arguments.
+            //! The indirect buffer view referenced by the arguments must outlive the draw packet.
+            void SetIndirectArguments(const RHI::DrawIndirect& indirectArguments);
+
             Data::Instance<Material> GetMaterial();
 
         private:
@@ -88,9 +96,14 @@ namespace AZ
             // Set the stencil value for this draw packet
             uint8_t m_stencilRef = 0;
 
+            float m_shaderVariantLoadPriority = IShaderVariantFinder::DefaultLoadPriority;
+
             //! A map matches the index of UV names of this material to the custom names from the model.
             MaterialModelUvOverrideMap m_materialModelUvMap;
 
+            //! Indirect arguments replacing the mesh's draw arguments, if set
+            AZStd::optional<RHI::DrawIndirect> m_indirectArguments;
+
             //! List of shader options set for this specific draw packet
             typedef AZStd::pair<Name, RPI::ShaderOptionValue> ShaderOptionPair;
             typedef AZStd::vector<ShaderOptionPair> ShaderOptionVector;
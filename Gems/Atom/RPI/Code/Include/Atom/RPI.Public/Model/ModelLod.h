@@ -89,6 +89,9 @@ namespace AZ
             //! Blocks the CPU until pending buffer uploads have completed.
             void WaitForUpload();
 
+            //! Returns whether any buffer of the lod is still being uploaded, without blocking.
+            bool IsUploadPending() const;
+
             AZStd::array_view<Mesh> GetMeshes() const;
 
             //! Compares a ShaderInputContract to the mesh's available streams, and if any of them are optional, sets the corresponding "*_isBound" shader option.
@@ -34,6 +34,10 @@ namespace AZ
             //!   2/(top-bottom) for orthogonal frustum.
             //!   We only use the vertical scale for two reasons: speed and for more consistent behavior with ultra-widescreen views
             float ApproxScreenPercentage(const Vector3& center, float radius, const Vector3& cameraPosition, float yScale, bool isPerspective);
+
+            //! Gets the global scale applied to the yScale used for lod selection, set with the r_lodScreenCoverageScale cvar.
+            //! Values below 1.0 switch to the lower detail lods closer to the camera, trading quality for performance.
+            float GetLodScreenCoverageScale();
         } // namespace ModelLodUtils
     } // namespace RPI
 } // namespace AZ
@@ -84,6 +84,9 @@ namespace AZ
 
             void Validate(PassValidationResults& validationResults) override;
 
+            //! Returns true if this pass or any of its children has to be rebuilt when attachment sizes change.
+            bool IsRebuildRequiredOnResize() const override;
+
             //! Prints the pass and all of it's children
             void DebugPrint() const override;
 
@@ -212,6 +212,11 @@ namespace AZ
             //! Functionality compiled out if AZ_RPI_ENABLE_PASS_VALIDATION is not defined.
             virtual void Validate(PassValidationResults& validationResults);
 
+            //! Returns true if the pass has to be rebuilt when the size of the attachments it derives its sizes from changes.
+            //! Transient attachments follow their size source every frame, but imported attachments are created when the pass is
+            //! built, and attachments with a full mip chain may change their mip count, which passes can build children from.
+            virtual bool IsRebuildRequiredOnResize() const;
+
             // --- Debug and validation print functions ---
 
             //! Prints the pass
@@ -99,6 +99,7 @@ namespace AZ
             // Functions for adding individual pass templates to the library. To create a new pass template in C++,
             // add a function here, implement it in the .cpp and call it in AddCoreTemplates()
             void AddCopyPassTemplate();
+            void AddMipFeedbackPassTemplate();
 
             // Loads pass template from a pass asset
             bool LoadPassAsset(const Name& name, const Data::Asset<PassAsset>& passAsset, bool hotReloading = false);
@@ -67,6 +67,10 @@ namespace AZ
             //! It may return nullptr if this pass is independent with any views.
             ViewPtr GetView() const;
 
+            //! Returns the hardware queue the pass's scope runs on. This is the compute queue if the pass data requests
+            //! async compute, r_asyncCompute is enabled and the pass has no render attachments, and the graphics queue otherwise.
+            RHI::HardwareQueueClass GetHardwareQueueClass() const;
+
         protected:
             explicit RenderPass(const PassDescriptor& descriptor);
 
@@ -160,6 +164,9 @@ namespace AZ
             
             // View tag used to associate a pipeline view for this pass.
             PipelineViewTag m_viewTag;
+
+            // Whether the pass data requested to run this pass on the asynchronous compute queue
+            bool m_useAsyncCompute = false;
         };
     }   // namespace RPI
 }   // namespace AZ
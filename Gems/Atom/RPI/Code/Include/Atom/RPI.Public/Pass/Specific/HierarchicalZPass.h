@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RPI.Public/Pass/ComputePass.h>
+
+#include <AzCore/Memory/SystemAllocator.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        class AttachmentReadback;
+
+        //! Reduces the depth buffer of its view to the farthest depth of fixed size screen tiles and reads it back to
+        //! the view as a HierarchicalZBuffer, which the CullingScene tests the objects against in the next frames.
+        //! A new readback is started as soon as the previous one completed, so the depth used for culling is a few frames old.
+        //! The pass is disabled while r_hiZOcclusionCulling is false.
+        class HierarchicalZPass final
+            : public ComputePass
+        {
+            AZ_RPI_PASS(HierarchicalZPass);
+
+        public:
+            AZ_RTTI(HierarchicalZPass, "{8A4E2F61-3C7D-4B95-A0E8-D71C5B2F96E3}", ComputePass);
+            AZ_CLASS_ALLOCATOR(HierarchicalZPass, SystemAllocator, 0);
+
+            static constexpr const char* OutputSlotName = "Output";
+
+            static Ptr<HierarchicalZPass> Create(const PassDescriptor& descriptor);
+            ~HierarchicalZPass() = default;
+
+            // Pass overrides...
+            bool IsEnabled() const override;
+
+        private:
+            explicit HierarchicalZPass(const PassDescriptor& descriptor);
+
+            // Pass behavior overrides...
+            void FrameBeginInternal(FramePrepareParams params) override;
+
+            AZStd::shared_ptr<AttachmentReadback> m_readback;
+        };
+    }   // namespace RPI
+}   // namespace AZ
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RPI.Public/Pass/RenderPass.h>
+
+#include <AzCore/Memory/SystemAllocator.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        class AttachmentReadback;
+
+        //! Reads back and resets the mip feedback buffer of the BindlessResourceTable.
+        //! The pass imports the buffer through its "MipFeedback" slot, which clears every entry to 0xFFFFFFFF when the scope
+        //! begins. The readback is taken before the clear, so it holds the mip levels written by the passes that ran earlier in
+        //! the frame. This pass doesn't record any command and should be the last pass of the pipeline, since the shaders
+        //! writing the feedback don't declare the buffer as an attachment.
+        //! The pass is disabled while the table has no mip feedback buffer.
+        class MipFeedbackPass final
+            : public RenderPass
+        {
+            AZ_RPI_PASS(MipFeedbackPass);
+
+        public:
+            AZ_RTTI(MipFeedbackPass, "{3E0B6C1A-9E57-4B7F-8D2C-6A14F0C8B953}", RenderPass);
+            AZ_CLASS_ALLOCATOR(MipFeedbackPass, SystemAllocator, 0);
+
+            static constexpr const char* MipFeedbackSlotName = "MipFeedback";
+
+            static Ptr<MipFeedbackPass> Create(const PassDescriptor& descriptor);
+            ~MipFeedbackPass() = default;
+
+            // Pass overrides...
+            bool IsEnabled() const override;
+
+        private:
+            explicit MipFeedbackPass(const PassDescriptor& descriptor);
+
+            // Pass behavior overrides...
+            void BuildInternal() override;
+            void FrameBeginInternal(FramePrepareParams params) override;
+
+            AZStd::shared_ptr<AttachmentReadback> m_readback;
+        };
+    }   // namespace RPI
+}   // namespace AZ
@@ -70,6 +70,9 @@ namespace AZ
             // Sets up a swap chain PassAttachment using the swap chain id from the window context 
             void SetupSwapChainAttachment();
 
+            // Updates the swap chain PassAttachment, scissor and viewport to the current size of the swap chain
+            void ResizeSwapChainAttachment();
+
             // The WindowContext that owns the SwapChain this pass renders to
             const WindowContext* m_windowContext = nullptr;
 
@@ -83,6 +86,9 @@ namespace AZ
 
             bool m_postProcess = false;
 
+            // Set when the window was resized and the pass tree can follow the new size without being rebuilt
+            bool m_resizePending = false;
+
             // The child pass used to drive rendering for this swapchain
             Ptr<Pass> m_childPass = nullptr;
 
@@ -18,6 +18,8 @@
 #include <Atom/RHI/RHISystem.h>
 #include <Atom/RPI.Public/RPISystemInterface.h>
 #include <Atom/RPI.Public/Scene.h>
+#include <Atom/RPI.Public/Shader/BindlessResourceTable.h>
+#include <Atom/RPI.Public/Shader/PipelineStateWarmup.h>
 #include <Atom/RPI.Public/Shader/ShaderSystem.h>
 #include <Atom/RPI.Public/Shader/Metrics/ShaderMetricsSystem.h>
 #include <Atom/RPI.Public/GpuQuery/GpuQuerySystem.h>
@@ -109,6 +111,8 @@ namespace AZ
             ShaderMetricsSystem m_shaderMetricsSystem;
             BufferSystem m_bufferSystem;
             ImageSystem m_imageSystem;
+            BindlessResourceTable m_bindlessResourceTable;
+            PipelineStateWarmup m_pipelineStateWarmup;
             PassSystem m_passSystem;
             DynamicDrawSystem m_dynamicDraw;
             FeatureProcessorFactory m_featureProcessorFactory;
@@ -132,6 +136,8 @@ namespace AZ
             Data::Asset<ShaderAsset> m_commonShaderAssetForSrgs;
             RHI::Ptr<RHI::ShaderResourceGroupLayout> m_sceneSrgLayout;
             RHI::Ptr<RHI::ShaderResourceGroupLayout> m_viewSrgLayout;
+            // Optional, bindless images are disabled if the shader asset has no BindlessSrg
+            RHI::Ptr<RHI::ShaderResourceGroupLayout> m_bindlessSrgLayout;
 
             bool m_systemAssetsInitialized = false;
 
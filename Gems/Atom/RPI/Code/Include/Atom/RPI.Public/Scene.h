@@ -11,6 +11,9 @@
 #include <Atom/RHI/DrawList.h>
 #include <Atom/RHI/PipelineStateDescriptor.h>
 #include <Atom/RHI/DrawFilterTagRegistry.h>
+#include <Atom/RHI.Reflect/AttachmentEnums.h>
+#include <Atom/RHI.Reflect/AttachmentId.h>
+#include <Atom/RHI.Reflect/BufferViewDescriptor.h>
 #include <Atom/RHI.Reflect/FrameSchedulerEnums.h>
 #include <Atom/RHI.Reflect/ShaderResourceGroupLayoutDescriptor.h>
 #include <Atom/RPI.Reflect/System/SceneDescriptor.h>
@@ -72,6 +75,16 @@ namespace AZ
             };
             typedef AZStd::vector<PipelineStateData> PipelineStateList;
 
+            //! A buffer which is written on the gpu every frame and read by the draw items of the scene, for example indirect draw arguments.
+            //! Every raster pass declares the draw input attachments that were imported to the frame graph, so the passes that fill
+            //! the buffers are scheduled before the passes that draw with them.
+            struct DrawInputAttachment
+            {
+                RHI::AttachmentId m_attachmentId;
+                RHI::BufferViewDescriptor m_bufferViewDescriptor;
+                RHI::ScopeAttachmentUsage m_usage = RHI::ScopeAttachmentUsage::Shader;
+            };
+
             static ScenePtr CreateScene(const SceneDescriptor& sceneDescriptor);
 
             static ScenePtr CreateSceneFromAsset(Data::Asset<AnyAsset> sceneAsset);
@@ -166,6 +179,11 @@ namespace AZ
 
             RenderPipelinePtr FindRenderPipelineForWindow(AzFramework::NativeWindowHandle windowHandle);
 
+            //! Adds a buffer that raster passes read while drawing the scene. See DrawInputAttachment.
+            void AddDrawInputAttachment(const DrawInputAttachment& drawInputAttachment);
+            void RemoveDrawInputAttachment(const RHI::AttachmentId& attachmentId);
+            const AZStd::vector<DrawInputAttachment>& GetDrawInputAttachments() const;
+
         protected:
             // SceneFinder overrides...
             Scene* FindSelf();
@@ -234,6 +252,9 @@ namespace AZ
 
             // Registry which allocates draw filter tag for RenderPipeline
             RHI::Ptr<RHI::DrawFilterTagRegistry> m_drawFilterTagRegistry;
+
+            // Buffers declared by every raster pass of the scene
+            AZStd::vector<DrawInputAttachment> m_drawInputAttachments;
         };
 
         // --- Template functions ---
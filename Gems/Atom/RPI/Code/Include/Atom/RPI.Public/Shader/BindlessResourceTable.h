@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/RPI.Public/Buffer/Buffer.h>
+#include <Atom/RPI.Public/Shader/BindlessResourceTableInterface.h>
+#include <Atom/RPI.Reflect/Shader/ShaderAsset.h>
+
+#include <Atom/RHI/ImageView.h>
+#include <Atom/RHI.Reflect/ShaderResourceGroupLayout.h>
+
+#include <AtomCore/Instance/Instance.h>
+
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        class ShaderResourceGroup;
+
+        //! Owns the BindlessSrg and the image views indexed by it.
+        //! Changes to the table are gathered and written to the shader resource group once per frame in Update, so adding
+        //! thousands of materials doesn't compile the shader resource group thousands of times.
+        class BindlessResourceTable final
+            : public BindlessResourceTableInterface
+        {
+        public:
+            AZ_RTTI(BindlessResourceTable, "{1F3A3C0E-62B5-4F7A-A7C4-0D2E6C4B9A18}", BindlessResourceTableInterface);
+
+            BindlessResourceTable() = default;
+            ~BindlessResourceTable() override = default;
+
+            //! Creates the BindlessSrg from the shader asset. The table stays disabled if the layout is null.
+            //! @param shaderAsset the shader asset the BindlessSrg layout was found in
+            //! @param srgLayout   the layout of the BindlessSrg, may be null
+            //! @param mipFeedbackEnabled whether shaders should write to the mip feedback buffer
+            void Init(const Data::Asset<ShaderAsset>& shaderAsset, const RHI::ShaderResourceGroupLayout* srgLayout, bool mipFeedbackEnabled);
+            void Shutdown();
+
+            //! Writes the image views added or removed since the last update to the shader resource group and compiles it.
+            void Update();
+
+            // BindlessResourceTableInterface overrides...
+            uint32_t AcquireImageIndex(const RHI::ImageView* imageView) override;
+            void ReleaseImageIndex(uint32_t index) override;
+            uint32_t FindImageIndex(const RHI::ImageView* imageView) const override;
+            bool IsEnabled() const override;
+            const RHI::ShaderResourceGroup* GetRHIShaderResourceGroup() const override;
+            Data::Instance<Buffer> GetMipFeedbackBuffer() const override;
+            void SetMipFeedback(const AZStd::shared_ptr<AZStd::vector<uint8_t>>& readbackData) override;
+            uint16_t GetMipFeedback(uint32_t index) const override;
+
+        private:
+            struct ImageEntry
+            {
+                RHI::ConstPtr<RHI::ImageView> m_imageView;
+                uint32_t m_referenceCount = 0;
+            };
+
+            //! Creates the mip feedback buffer if the BindlessSrg declares it. Feedback is optional, so nothing is reported if it doesn't.
+            //! When feedback is disabled a single entry buffer is bound with a zero capacity, so shaders skip their writes.
+            void InitMipFeedback(bool mipFeedbackEnabled);
+
+            mutable AZStd::mutex m_mutex;
+
+            Data::Instance<ShaderResourceGroup> m_srg;
+            RHI::ShaderInputImageUnboundedArrayIndex m_texturesInputIndex;
+
+            //! Fills the default index and every released index, so every descriptor in the table stays valid.
+            RHI::ConstPtr<RHI::ImageView> m_placeholderImageView;
+
+            AZStd::vector<ImageEntry> m_images;
+            AZStd::vector<uint32_t> m_freeImageIndices;
+            AZStd::unordered_map<const RHI::ImageView*, uint32_t> m_imageIndices;
+
+            //! Scratch list of views handed to the shader resource group, kept to avoid reallocating it every update.
+            AZStd::vector<const RHI::ImageView*> m_imageViewArray;
+            bool m_isDirty = false;
+
+            //! Only set while mip feedback is enabled
+            Data::Instance<Buffer> m_mipFeedbackBuffer;
+            //! Placeholder bound to the BindlessSrg while mip feedback is disabled
+            Data::Instance<Buffer> m_unusedMipFeedbackBuffer;
+
+            //! The last readback of m_mipFeedbackBuffer, written by the readback callback
+            mutable AZStd::mutex m_mipFeedbackMutex;
+            AZStd::shared_ptr<AZStd::vector<uint8_t>> m_mipFeedback;
+        };
+    }
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AtomCore/Instance/Instance.h>
+
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+
+namespace AZ
+{
+    namespace RHI
+    {
+        class ImageView;
+        class ShaderResourceGroup;
+    }
+
+    namespace RPI
+    {
+        class Buffer;
+
+        //! Global table of image views that shaders can address by index instead of through a per draw ShaderResourceGroup.
+        //! The table is bound to every pass as the BindlessSrg (see BindlessSrg.azsli), so a shader only needs the index of an
+        //! image, which can be passed in a material constant or in root constants, to sample it.
+        //! Indices are reference counted per image view, acquiring the same view again returns the same index.
+        //! The table also holds a mip feedback buffer with one uint per index, where shaders write the most detailed mip level
+        //! they sampled with RecordMipFeedback. The buffer is read back by the MipFeedbackPass and used by the
+        //! MipFeedbackStreamingImageController to stream the mips that are actually visible.
+        class BindlessResourceTableInterface
+        {
+        public:
+            AZ_RTTI(BindlessResourceTableInterface, "{6A0C9E57-3D0B-4C1F-9F52-8B3B0B7E2D41}");
+
+            //! Index of a placeholder image which is always present in the table.
+            //! Returned for null image views, and for every image view when the bindless table is unavailable.
+            static constexpr uint32_t DefaultImageIndex = 0;
+
+            //! Number of entries in the mip feedback buffer. Images with a higher index don't get any feedback.
+            static constexpr uint32_t MipFeedbackCapacity = 16 * 1024;
+
+            BindlessResourceTableInterface() = default;
+            virtual ~BindlessResourceTableInterface() = default;
+
+            static BindlessResourceTableInterface* Get();
+
+            // Note that you have to delete these for safety reasons, you will trip a static_assert if you do not
+            AZ_DISABLE_COPY_MOVE(BindlessResourceTableInterface);
+
+            //! Returns the index of an image view in the table, adding it if it isn't in the table yet.
+            //! Every call has to be paired with a call to ReleaseImageIndex.
+            virtual uint32_t AcquireImageIndex(const RHI::ImageView* imageView) = 0;
+
+            //! Releases an index returned by AcquireImageIndex. The image view is removed from the table when the last
+            //! reference is released, and its index may be reused.
+            virtual void ReleaseImageIndex(uint32_t index) = 0;
+
+            //! Returns the index of an image view in the table, or DefaultImageIndex if the view isn't in the table.
+            virtual uint32_t FindImageIndex(const RHI::ImageView* imageView) const = 0;
+
+            //! Returns whether the bindless table is available, this requires the common SRG shader asset to contain a BindlessSrg.
+            virtual bool IsEnabled() const = 0;
+
+            //! Returns the shader resource group holding the table, nullptr if the table is unavailable.
+            virtual const RHI::ShaderResourceGroup* GetRHIShaderResourceGroup() const = 0;
+
+            //! Returns the buffer shaders write the sampled mip levels to.
+            //! Returns nullptr if mip feedback is disabled or the BindlessSrg has no m_mipFeedback buffer.
+            virtual Data::Instance<Buffer> GetMipFeedbackBuffer() const = 0;
+
+            //! Replaces the mip levels returned by GetMipFeedback with the content of a mip feedback buffer readback.
+            //! This may be called from any thread.
+            virtual void SetMipFeedback(const AZStd::shared_ptr<AZStd::vector<uint8_t>>& readbackData) = 0;
+
+            //! Returns the most detailed mip level sampled from an index in the last mip feedback readback,
+            //! or RHI::Limits::Image::MipCountMax if the index wasn't sampled.
+            virtual uint16_t GetMipFeedback(uint32_t index) const = 0;
+        };
+    }
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/RPI.Public/Shader/PipelineStateWarmupInterface.h>
+#include <Atom/RPI.Reflect/Shader/PipelineStateManifest.h>
+#include <Atom/RPI.Reflect/Shader/ShaderAsset.h>
+
+#include <AtomCore/Instance/Instance.h>
+
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        //! Records the pipeline states acquired from shaders into a PipelineStateManifest, and compiles the pipeline states
+        //! of a manifest on background jobs. See PipelineStateWarmupInterface.
+        //! The shipped manifest is read from @assets@/atom/pipelinestatemanifest/<rhi>.xml, and the recorded one is
+        //! written to and read from @user@/Atom/PipelineStateManifest/<rhi>.xml.
+        class PipelineStateWarmup final
+            : public PipelineStateWarmupInterface
+        {
+        public:
+            AZ_RTTI(PipelineStateWarmup, "{5F1C7A2D-0E83-4B69-9D4A-E2B6F9C3A158}", PipelineStateWarmupInterface);
+
+            PipelineStateWarmup() = default;
+            ~PipelineStateWarmup() override = default;
+
+            void Init();
+            //! Waits for the warmup jobs in flight and saves the recorded manifest if recording is enabled.
+            void Shutdown();
+
+            //! Starts the warmup if r_pipelineStateWarmup is enabled.
+            void OnSystemAssetsInitialized();
+
+            //! Dispatches the pipeline states whose shader variants finished loading. Called on the main thread every system tick.
+            void Update();
+
+            // PipelineStateWarmupInterface overrides...
+            void StartWarmup() override;
+            bool IsWarmingUp() const override;
+            uint32_t GetPendingPipelineStateCount() const override;
+            bool SaveManifest() override;
+            void RecordPipelineState(const Shader& shader, const RHI::PipelineStateDescriptor& descriptor) override;
+
+        private:
+            struct PendingPipelineState
+            {
+                PipelineStateManifestEntry m_entry;
+                Data::Asset<ShaderAsset> m_shaderAsset;
+                Data::Instance<Shader> m_shader;
+                uint32_t m_waitedUpdateCount = 0;
+            };
+
+            //! Adds the entries of a manifest file to the pending pipeline states, does nothing if the file doesn't exist.
+            void QueueManifest(const AZStd::string& manifestPath);
+
+            //! Dispatches a job compiling the pipeline state once its shader and shader variant are ready.
+            //! @return true if the pipeline state is done with, either dispatched or dropped because it can't be built
+            bool TryDispatchPipelineState(PendingPipelineState& pendingPipelineState);
+
+            AZStd::string GetShippedManifestPath() const;
+            AZStd::string GetRecordedManifestPath() const;
+
+            AZStd::mutex m_recordMutex;
+            AZStd::unordered_set<HashValue64> m_recordedHashes;
+            PipelineStateManifest m_recordedManifest;
+
+            //! Only accessed on the main thread
+            AZStd::vector<PendingPipelineState> m_pendingPipelineStates;
+
+            AZStd::atomic<uint32_t> m_activeJobCount{ 0 };
+            AZStd::atomic_bool m_isShuttingDown{ false };
+        };
+    }
+}
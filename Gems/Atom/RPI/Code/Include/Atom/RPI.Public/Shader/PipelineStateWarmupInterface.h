@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/RTTI/RTTI.h>
+
+namespace AZ
+{
+    namespace RHI
+    {
+        class PipelineStateDescriptor;
+    }
+
+    namespace RPI
+    {
+        class Shader;
+
+        //! Compiles the pipeline states used by previous runs of the application ahead of their first use.
+        //! While r_pipelineStateRecording is enabled, every new pipeline state acquired from an RPI::Shader is added to a
+        //! manifest, which is written to the user folder on shutdown or when SaveManifest is called. The manifest can be
+        //! shipped next to the products, and StartWarmup then builds its pipeline states on background jobs, typically
+        //! behind a loading screen, so they are found in the pipeline state cache the first time they are drawn.
+        class PipelineStateWarmupInterface
+        {
+        public:
+            AZ_RTTI(PipelineStateWarmupInterface, "{B2E4D83A-71C6-4F05-9A3E-5C8F1D6B2E90}");
+
+            PipelineStateWarmupInterface() = default;
+            virtual ~PipelineStateWarmupInterface() = default;
+
+            static PipelineStateWarmupInterface* Get();
+
+            // Note that you have to delete these for safety reasons, you will trip a static_assert if you do not
+            AZ_DISABLE_COPY_MOVE(PipelineStateWarmupInterface);
+
+            //! Loads the shipped and the recorded manifests and starts compiling their pipeline states.
+            //! Shaders and shader variants are loaded asynchronously, so the warmup continues over the next ticks.
+            virtual void StartWarmup() = 0;
+
+            //! Returns true while pipeline states of the manifests are still waiting for their shader or being compiled.
+            virtual bool IsWarmingUp() const = 0;
+
+            //! Returns the number of manifest entries that haven't been compiled yet.
+            virtual uint32_t GetPendingPipelineStateCount() const = 0;
+
+            //! Writes the pipeline states recorded so far to the manifest in the user folder.
+            virtual bool SaveManifest() = 0;
+
+            //! Called by RPI::Shader for every pipeline state it acquires while recording.
+            virtual void RecordPipelineState(const Shader& shader, const RHI::PipelineStateDescriptor& descriptor) = 0;
+        };
+    }
+}
@@ -57,6 +57,7 @@ namespace AZ
             , public ShaderReloadNotificationBus::Handler
         {
             friend class ShaderSystem;
+            friend class PipelineStateWarmup;
         public:
             AZ_INSTANCE_DATA(Shader, "{232D8BD6-3BD4-4842-ABD2-F380BD5B0863}");
             AZ_CLASS_ALLOCATOR(Shader, SystemAllocator, 0);
@@ -83,7 +84,8 @@ namespace AZ
             /// variant is loaded and available or if a variant changes, etc.
             /// This function should be your one stop shop to get a ShaderVariant from a ShaderVariantId.
             /// Alternatively: You can call FindVariantStableId() followed by GetVariant(shaderVariantStableId).
-            const ShaderVariant& GetVariant(const ShaderVariantId& shaderVariantId);
+            /// The loadPriority orders the load requests of missing variants, see IShaderVariantFinder::DefaultLoadPriority.
+            const ShaderVariant& GetVariant(const ShaderVariantId& shaderVariantId, float loadPriority = IShaderVariantFinder::DefaultLoadPriority);
 
             /// Finds the best matching shader variant asset and returns its StableId.
             /// In cases where you can't cache the ShaderVariant, and recurrently you may need
@@ -178,6 +180,9 @@ namespace AZ
             //! Returns the path to the pipeline library cache file.
             AZStd::string GetPipelineLibraryPath() const;
 
+            //! Returns the cached variant whose shader stage functions were used to configure the descriptor, or nullptr if none was.
+            const ShaderVariant* FindVariantForPipelineState(const RHI::PipelineStateDescriptor& descriptor) const;
+
             //! A strong reference to the shader asset.
             Data::Asset<ShaderAsset> m_asset;
 
@@ -195,7 +200,7 @@ namespace AZ
             RHI::PipelineLibraryHandle m_pipelineLibraryHandle;
 
             //! Used for thread safety for FindVariantStableId() and GetVariant().
-            AZStd::shared_mutex m_variantCacheMutex;
+            mutable AZStd::shared_mutex m_variantCacheMutex;
 
             //! The root variant always exist.
             ShaderVariant m_rootVariant;
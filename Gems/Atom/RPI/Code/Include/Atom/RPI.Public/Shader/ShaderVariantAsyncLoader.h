@@ -8,10 +8,14 @@
 #pragma once
 
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/string/string.h>
+#include <AzFramework/Spawnable/RootSpawnableInterface.h>
 #include <Atom/RPI.Reflect/Shader/ShaderAsset.h>
 #include <Atom/RPI.Reflect/Shader/ShaderVariantAsset.h>
 #include <Atom/RPI.Reflect/Shader/ShaderVariantTreeAsset.h>
+#include <Atom/RPI.Reflect/Shader/ShaderVariantUsageManifest.h>
 #include <Atom/RPI.Reflect/Shader/IShaderVariantFinder.h>
 
 namespace AZ
@@ -24,10 +28,16 @@ namespace AZ
          * A helper class used by ShaderSystem to manage asynchronous loading of ShaderVariantTreeAssets
          * and ShaderVariantAssets.
          * The notifications of assets being loaded & ready are dispatched via ShaderVariantFinderNotificationBus.
+         * Pending requests are serviced by priority, see IShaderVariantFinder::DefaultLoadPriority.
+         * The loader also records the shader variants in use with each level into a ShaderVariantUsageManifest, and prefetches
+         * the variants of the manifest as soon as the level is assigned. The shipped manifest of a level is read from
+         * @assets@/atom/shadervariantusage/<level>.xml, and the recorded one is written to and read from
+         * @user@/Atom/ShaderVariantUsage/<level>.xml.
          */
         class ShaderVariantAsyncLoader final
             : public AZ::Interface<IShaderVariantFinder>::Registrar
             , public AZ::Data::AssetBus::MultiHandler
+            , public AzFramework::RootSpawnableNotificationBus::Handler
         {
         public:
             static constexpr char LogName[] = "ShaderVariantAsyncLoader";
@@ -41,6 +51,8 @@ namespace AZ
                 Data::Asset<ShaderAsset> m_shaderAsset;
                 ShaderVariantId m_shaderVariantId;
                 SupervariantIndex m_supervariantIndex;
+                //! Not part of the identity of the request.
+                float m_priority = IShaderVariantFinder::DefaultLoadPriority;
 
                 bool operator==(const TupleShaderAssetAndShaderVariantId& anotherTuple) const
                 {
@@ -54,7 +66,9 @@ namespace AZ
 
             ///////////////////////////////////////////////////////////////////
             // IShaderVariantFinder overrides
-            bool QueueLoadShaderVariantAssetByVariantId(Data::Asset<ShaderAsset> shaderAsset, const ShaderVariantId& shaderVariantId, SupervariantIndex supervariantIndex) override;
+            bool QueueLoadShaderVariantAssetByVariantId(
+                Data::Asset<ShaderAsset> shaderAsset, const ShaderVariantId& shaderVariantId, SupervariantIndex supervariantIndex,
+                float priority) override;
             bool QueueLoadShaderVariantTreeAsset(const Data::AssetId& shaderAssetId) override;
             bool QueueLoadShaderVariantAsset(const Data::AssetId& shaderVariantTreeAssetId, ShaderVariantStableId variantStableId, SupervariantIndex supervariantIndex) override;
 
@@ -80,6 +94,12 @@ namespace AZ
             void OnAssetError(Data::Asset<Data::AssetData> asset) override;
             ///////////////////////////////////////////////////////////////////////
 
+            ///////////////////////////////////////////////////////////////////////
+            // AzFramework::RootSpawnableNotificationBus::Handler overrides
+            void OnRootSpawnableAssigned(AZ::Data::Asset<AzFramework::Spawnable> rootSpawnable, uint32_t generation) override;
+            void OnRootSpawnableReleased(uint32_t generation) override;
+            ///////////////////////////////////////////////////////////////////////
+
             void OnShaderVariantTreeAssetReady(Data::Asset<ShaderVariantTreeAsset> shaderVariantTreeAsset);
             void OnShaderVariantAssetReady(Data::Asset<ShaderVariantAsset> shaderVariantAsset);
             void OnShaderVariantTreeAssetError(Data::Asset<ShaderVariantTreeAsset> shaderVariantTreeAsset);
@@ -88,8 +108,8 @@ namespace AZ
             void ThreadServiceLoop();
 
             void QueueShaderVariantTreeForLoading(
-                const TupleShaderAssetAndShaderVariantId& shaderAndVariantTuple,
-                AZStd::unordered_set<Data::AssetId>& shaderVariantTreePendingRequests);
+                const TupleShaderAssetAndShaderVariantId& shaderAndVariantTuple, float priority,
+                AZStd::unordered_map<Data::AssetId, float>& shaderVariantTreePendingRequests);
 
             //! This is a helper method called from the service thread.
             //! Returns true if a valid AssetId for the corresponding ShaderVariantTreeAsset is registered
@@ -98,6 +118,18 @@ namespace AZ
 
             bool TryToLoadShaderVariantAsset(const Data::AssetId& shaderVariantAssetId);
 
+            //! Adds the variant to the usage manifest of the current level if r_shaderVariantUsageRecording is enabled.
+            void RecordShaderVariantUsage(
+                const Data::Asset<ShaderAsset>& shaderAsset, const ShaderVariantId& shaderVariantId, SupervariantIndex supervariantIndex);
+
+            //! Prefetches the variants of a usage manifest file, does nothing if the file doesn't exist.
+            void QueueManifest(const AZStd::string& manifestPath);
+
+            //! Saves the usage manifest recorded for the current level, and starts a new one.
+            void SaveRecordedManifest();
+
+            AZStd::string GetShippedManifestPath() const;
+            AZStd::string GetRecordedManifestPath() const;
 
             //! A thread that runs forever servicing shader variant and trees load requests.
             AZStd::thread m_serviceThread;
@@ -129,6 +161,14 @@ namespace AZ
             //! REMARK: To go the other way, you can use m_shaderVariantData.
             AZStd::unordered_map<Data::AssetId, Data::AssetId> m_shaderAssetIdToShaderVariantTreeAssetId;
 
+            //! The name of the level the usage manifest is recorded for, empty when no level is loaded.
+            //! Only accessed on the main thread.
+            AZStd::string m_levelName;
+
+            AZStd::mutex m_recordMutex;
+            //! The hashes of the requests in m_recordedManifest.
+            AZStd::unordered_set<size_t> m_recordedHashes;
+            ShaderVariantUsageManifest m_recordedManifest;
         };
 
 
@@ -18,6 +18,8 @@
 #include <AzCore/Math/Matrix4x4.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/Name/Name.h>
 
 class MaskedOcclusionCulling;
@@ -32,6 +34,8 @@ namespace AZ
 
     namespace RPI
     {
+        class HierarchicalZBuffer;
+
         //! Represents a view into a scene, and is the primary interface for adding DrawPackets to the draw queues.
         //! It encapsulates the world<->view<->clip transforms and the per-view shader constants.
         //! Use View::CreateView() to make new vew Objects to ensure that you have a shared ViewPtr to pass around the code.
@@ -133,6 +137,12 @@ namespace AZ
             //! Returns the masked occlusion culling interface
             MaskedOcclusionCulling* GetMaskedOcclusionCulling();
 
+            //! Sets the depth read back from the GPU that the culling tests the objects of the view against. Can be called from any thread.
+            void SetHierarchicalZBuffer(AZStd::shared_ptr<const HierarchicalZBuffer> hierarchicalZBuffer);
+
+            //! Returns the latest depth read back for the view, or nullptr if there is none.
+            AZStd::shared_ptr<const HierarchicalZBuffer> GetHierarchicalZBuffer() const;
+
         private:
             View() = delete;
             View(const AZ::Name& name, UsageFlags usage);
@@ -200,6 +210,10 @@ namespace AZ
 
             // Masked Occlusion Culling interface
             MaskedOcclusionCulling* m_maskedOcclusionCulling = nullptr;
+
+            // Depth of a previous frame used for occlusion culling, replaced by the HierarchicalZPass while culling reads it
+            mutable AZStd::mutex m_hierarchicalZBufferMutex;
+            AZStd::shared_ptr<const HierarchicalZBuffer> m_hierarchicalZBuffer;
         };
 
         AZ_DEFINE_ENUM_BITWISE_OPERATORS(View::UsageFlags);
@@ -24,6 +24,10 @@ namespace AZ
             uint64_t m_systemStreamingImagePoolSize = 128 * 1024 * 1024;
             uint64_t m_systemAttachmentImagePoolSize = 512 * 1024 * 1024;
             uint64_t m_assetStreamingImagePoolSize = 2u * 1024u * 1024u * 1024u;
+
+            //! Streams the images of the asset streaming pool from the mips the GPU reports sampling, see MipFeedbackStreamingImageController.
+            //! Requires the BindlessSrg with its mip feedback buffer.
+            bool m_useMipFeedbackStreaming = false;
         };
     } // namespace RPI
 } // namespace AZ
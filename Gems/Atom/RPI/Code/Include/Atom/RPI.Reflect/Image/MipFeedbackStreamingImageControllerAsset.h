@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/RPI.Reflect/Image/StreamingImageControllerAsset.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        //! Settings of a MipFeedbackStreamingImageController.
+        class MipFeedbackStreamingImageControllerAsset
+            : public StreamingImageControllerAsset
+        {
+        public:
+            AZ_RTTI(MipFeedbackStreamingImageControllerAsset, "{8B27E7C4-56D1-4A0E-9F3B-2C1A7E94D6F0}", StreamingImageControllerAsset);
+            AZ_CLASS_ALLOCATOR(MipFeedbackStreamingImageControllerAsset, SystemAllocator, 0);
+
+            static const Data::AssetId BuiltInAssetId;
+
+            static void Reflect(AZ::ReflectContext* context);
+
+            MipFeedbackStreamingImageControllerAsset();
+
+            //! Memory the controller keeps the resident mips under. 0 uses the budget of the streaming image pool.
+            size_t m_memoryBudgetInBytes = 0;
+
+            //! Maximum number of images queued for expansion per update.
+            uint32_t m_maxExpandsPerUpdate = 16;
+
+            //! Number of updates a mip level request, from SetTargetMip or from the GPU feedback, is kept after the image was last used.
+            uint32_t m_requestLifetimeInUpdates = 60;
+        };
+    }
+}
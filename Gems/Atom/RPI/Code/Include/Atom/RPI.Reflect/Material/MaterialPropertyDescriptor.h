@@ -27,6 +27,7 @@ namespace AZ
         {
             ShaderInput,  //!< Maps to a ShaderResourceGroup input
             ShaderOption, //!< Maps to a shader variant option
+            ShaderInputBindlessIndex, //!< Maps an image to a uint ShaderResourceGroup constant holding its index in the BindlessSrg
             Invalid,
             Count = Invalid
         };
@@ -52,6 +52,10 @@ namespace AZ
             
             //! Adds an output mapping from the current material property to a ShaderResourceGroup input.
             void ConnectMaterialPropertyToShaderInput(const Name& shaderInputName);
+
+            //! Adds an output mapping from the current image material property to a uint ShaderResourceGroup constant,
+            //! which receives the index of the image in the BindlessSrg instead of the image itself.
+            void ConnectMaterialPropertyToBindlessImageIndex(const Name& shaderInputName);
             
             //! Adds an output mapping from the current material property to a shader option in a specific shader.
             //! @param shaderIndex  Index to the material type's list of shader references, according to AddShader().
@@ -30,9 +30,10 @@ namespace AZ
                 if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
                 {
                     serializeContext->Class<RenderPassData, PassData>()
-                        ->Version(1)
+                        ->Version(2)
                         ->Field("PipelineViewTag", &RenderPassData::m_pipelineViewTag)
-                        ->Field("ShaderDataMappings", &RenderPassData::m_mappings);
+                        ->Field("ShaderDataMappings", &RenderPassData::m_mappings)
+                        ->Field("UseAsyncCompute", &RenderPassData::m_useAsyncCompute);
                 }
             }
 
@@ -40,6 +41,10 @@ namespace AZ
             RHI::ShaderDataMappings m_mappings;
 
             Name m_pipelineViewTag;
+
+            //! Hint to run the pass on the asynchronous compute queue, so it overlaps with the graphics work it doesn't depend on.
+            //! Only used by passes that don't rasterize, see r_asyncCompute.
+            bool m_useAsyncCompute = false;
         };
     } // namespace RPI
 } // namespace AZ
@@ -32,6 +32,13 @@ namespace AZ
 
             static constexpr const char* LogName = "IShaderVariantFinder";
 
+            //! The load priority of the shader variants that are needed to render right away.
+            //! Priorities are screen coverages in [0, 1], the requests with the highest priority are loaded first.
+            static constexpr float DefaultLoadPriority = 1.0f;
+            //! The load priority of the shader variants that are requested before they are needed, they are loaded after
+            //! everything else.
+            static constexpr float PrefetchLoadPriority = 0.0f;
+
             virtual ~IShaderVariantFinder() = default;
 
             //! This function should be your one stop shop.
@@ -41,8 +48,10 @@ namespace AZ
             //! from the given ShaderVariantId. If a valid ShaderVariantStableId is found, it will be queued for loading.
             //! Eventually the caller will be notified via ShaderVariantFinderNotificationBus::OnShaderVariantAssetReady()
             //! The notification will occur on the Main Thread.
+            //! When the same variant is queued several times, it is loaded with the highest of the priorities.
             virtual bool QueueLoadShaderVariantAssetByVariantId(
-                Data::Asset<ShaderAsset> shaderAsset, const ShaderVariantId& shaderVariantId, SupervariantIndex supervariantIndex) = 0;
+                Data::Asset<ShaderAsset> shaderAsset, const ShaderVariantId& shaderVariantId, SupervariantIndex supervariantIndex,
+                float priority = DefaultLoadPriority) = 0;
 
             //! This function does the first half of the work. It simply queues the loading of the ShaderVariantTreeAsset.
             //! Given the AssetId of a ShaderAsset it will try to find and load its corresponding ShaderVariantTreeAsset from
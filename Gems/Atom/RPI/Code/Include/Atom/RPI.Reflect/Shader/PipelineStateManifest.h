@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RPI.Reflect/Shader/ShaderVariantKey.h>
+
+#include <Atom/RHI.Reflect/InputStreamLayout.h>
+#include <Atom/RHI.Reflect/RenderAttachmentLayout.h>
+#include <Atom/RHI.Reflect/RenderStates.h>
+
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/Name/Name.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        //! Describes a pipeline state that was acquired from a shader, with everything needed to build it again.
+        //! The shader stage functions and the pipeline layout come from the shader variant, the rest of the
+        //! descriptor is stored as is. The input stream layout, attachment configuration and render states are only
+        //! used for draw pipeline states.
+        struct PipelineStateManifestEntry
+        {
+            AZ_TYPE_INFO(PipelineStateManifestEntry, "{3C0B5A61-9E2F-4D7A-8B14-6F2C8D9E0A37}");
+            static void Reflect(ReflectContext* context);
+
+            Data::AssetId m_shaderAssetId;
+            //! The full name of the supervariant, including the system supervariant name if one was applied.
+            Name m_supervariantName;
+            ShaderVariantId m_shaderVariantId;
+            //! The variant that was in use when the pipeline state was recorded, used to tell whether the shader
+            //! variant still has to be loaded before the pipeline state can be built.
+            ShaderVariantStableId m_shaderVariantStableId;
+
+            RHI::InputStreamLayout m_inputStreamLayout;
+            RHI::RenderAttachmentConfiguration m_renderAttachmentConfiguration;
+            RHI::RenderStates m_renderStates;
+        };
+
+        //! A list of pipeline states recorded while running the application, which can be shipped and compiled ahead of
+        //! their first use. See PipelineStateWarmupInterface.
+        struct PipelineStateManifest
+        {
+            AZ_TYPE_INFO(PipelineStateManifest, "{9A6E4F02-57C3-4B8D-A1E0-2D7B3C5F8E14}");
+            static void Reflect(ReflectContext* context);
+
+            AZStd::vector<PipelineStateManifestEntry> m_pipelineStates;
+        };
+    } // namespace RPI
+} // namespace AZ
@@ -105,6 +105,9 @@ namespace AZ
             //! Note that this will append the system supervariant name from RPI::ShaderSystem when searching.
             SupervariantIndex GetSupervariantIndex(const AZ::Name& supervariantName) const;
 
+            //! Returns the full name of a supervariant, which includes the system supervariant name if one was applied.
+            const Name& GetSupervariantName(SupervariantIndex supervariantIndex) const;
+
             //! This function should be your one stop shop to get a ShaderVariantAsset.
             //! Finds and returns the best matching ShaderVariantAsset given a ShaderVariantId.
             //! If the ShaderVariantAsset is not fully loaded and ready at the moment, this function
@@ -113,10 +116,16 @@ namespace AZ
             //! ShaderVariantAsset is loaded and ready.
             //! In the mean time, if the required variant is not available this function
             //! returns the Root Variant.
+            //! @param loadPriority The priority of the load request, see IShaderVariantFinder::DefaultLoadPriority.
             Data::Asset<ShaderVariantAsset> GetVariant(
-                const ShaderVariantId& shaderVariantId, SupervariantIndex supervariantIndex);
+                const ShaderVariantId& shaderVariantId, SupervariantIndex supervariantIndex,
+                float loadPriority = IShaderVariantFinder::DefaultLoadPriority);
             Data::Asset<ShaderVariantAsset> GetVariant(const ShaderVariantId& shaderVariantId) { return GetVariant(shaderVariantId, DefaultSupervariantIndex); }
 
+            //! Queues the load of the best matching ShaderVariantAsset for the ShaderVariantId ahead of its first use,
+            //! with IShaderVariantFinder::PrefetchLoadPriority. Unlike GetVariant(), the request isn't recorded as a variant in use.
+            void PrefetchVariant(const ShaderVariantId& shaderVariantId, SupervariantIndex supervariantIndex);
+
             //! Finds the best matching shader variant and returns its StableId.
             //! This function first loads and caches the ShaderVariantTreeAsset (if not done before).
             //! If the ShaderVariantTreeAsset is not found (either the AssetProcessor has not generated it yet, or it simply doesn't exist), then
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RPI.Reflect/Shader/ShaderVariantKey.h>
+
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        //! A shader variant that was requested while a level was running.
+        struct ShaderVariantUsageManifestEntry
+        {
+            AZ_TYPE_INFO(ShaderVariantUsageManifestEntry, "{7B2E9C14-3D5A-4F86-A0E1-95C4D2B8F630}");
+            static void Reflect(ReflectContext* context);
+
+            Data::AssetId m_shaderAssetId;
+            uint32_t m_supervariantIndex = 0;
+            ShaderVariantId m_shaderVariantId;
+        };
+
+        //! The shader variants used by a level, recorded at runtime and prefetched by the ShaderVariantAsyncLoader
+        //! as soon as the level is loaded, so the variants are ready before the materials that use them are drawn.
+        struct ShaderVariantUsageManifest
+        {
+            AZ_TYPE_INFO(ShaderVariantUsageManifest, "{E4A1F3B7-6C28-4D9E-8B05-2F7D1A9C6E43}");
+            static void Reflect(ReflectContext* context);
+
+            AZStd::vector<ShaderVariantUsageManifestEntry> m_shaderVariants;
+        };
+    } // namespace RPI
+} // namespace AZ
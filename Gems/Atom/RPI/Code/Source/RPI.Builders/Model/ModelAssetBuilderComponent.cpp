@@ -16,6 +16,7 @@
 #include <AzCore/Math/Transform.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/Utils.h>
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 
 #include <Atom/RPI.Reflect/Buffer/BufferAssetCreator.h>
@@ -58,6 +59,12 @@
   */
 #define AZ_RPI_MESHES_SHARE_COMMON_BUFFERS
 
+ /**
+  * Reorders the triangles of each mesh for the post-transform vertex cache.
+  * Comment this out to keep the triangle order of the source scene.
+  */
+#define AZ_RPI_OPTIMIZE_TRIANGLE_ORDER
+
 namespace
 {
     const uint32_t IndicesPerFace = 3;
@@ -94,6 +101,198 @@ namespace
     const char* const ShaderSemanticName_ClothData = "CLOTH_DATA";
     const uint32_t ClothDataFloatsPerVert = 4;
     const AZ::RHI::Format ClothDataFormat = AZ::RHI::Format::R32G32B32A32_FLOAT;
+
+#if defined(AZ_RPI_OPTIMIZE_TRIANGLE_ORDER)
+    // Vertex cache optimization, see Tom Forsyth's "Linear-Speed Vertex Cache Optimisation".
+    // Triangles are emitted greedily by score. A vertex scores higher when it was used recently, so it is likely still in
+    // the post-transform cache, and when few of its triangles are left, so that no isolated triangles are left behind.
+    const uint32_t VertexCacheSize = 32;
+    const uint32_t MaxValenceScore = 32;
+
+    float ComputeVertexCacheScore(uint32_t cachePosition)
+    {
+        const float LastTriangleScore = 0.75f;
+        const float CacheDecayPower = 1.5f;
+
+        if (cachePosition < 3)
+        {
+            // The vertices of the last triangle get a fixed score, so that the next triangle doesn't just reuse the same edge.
+            return LastTriangleScore;
+        }
+        const float scaler = 1.0f / static_cast<float>(VertexCacheSize - 3);
+        return powf(1.0f - static_cast<float>(cachePosition - 3) * scaler, CacheDecayPower);
+    }
+
+    float ComputeVertexValenceScore(uint32_t remainingTriangles)
+    {
+        const float ValenceBoostScale = 2.0f;
+        const float ValenceBoostPower = 0.5f;
+        return ValenceBoostScale * powf(static_cast<float>(remainingTriangles), -ValenceBoostPower);
+    }
+
+    //! Reorders the triangles of the index buffer to improve the hit rate of the post-transform vertex cache.
+    //! The vertices are not renumbered, only the order of the triangles changes.
+    void OptimizeTriangleOrderForVertexCache(AZStd::vector<uint32_t>& indices, size_t vertexCount)
+    {
+        const size_t triangleCount = indices.size() / IndicesPerFace;
+        if (triangleCount < 2 || indices.size() % IndicesPerFace != 0)
+        {
+            return;
+        }
+
+        AZStd::array<float, VertexCacheSize> cacheScores;
+        for (uint32_t i = 0; i < VertexCacheSize; ++i)
+        {
+            cacheScores[i] = ComputeVertexCacheScore(i);
+        }
+        AZStd::array<float, MaxValenceScore> valenceScores;
+        valenceScores[0] = 0.0f;
+        for (uint32_t i = 1; i < MaxValenceScore; ++i)
+        {
+            valenceScores[i] = ComputeVertexValenceScore(i);
+        }
+
+        // Build the triangles of each vertex. The triangles of a vertex are kept at the front of its range while they are
+        // not emitted, so the remaining triangle count is also the size of that part of the range.
+        AZStd::vector<uint32_t> remainingTriangleCount(vertexCount, 0);
+        for (uint32_t index : indices)
+        {
+            ++remainingTriangleCount[index];
+        }
+        AZStd::vector<uint32_t> vertexTriangleOffsets(vertexCount + 1, 0);
+        for (size_t vertex = 0; vertex < vertexCount; ++vertex)
+        {
+            vertexTriangleOffsets[vertex + 1] = vertexTriangleOffsets[vertex] + remainingTriangleCount[vertex];
+        }
+        AZStd::vector<uint32_t> vertexTriangles(indices.size());
+        {
+            AZStd::vector<uint32_t> fillCount(vertexCount, 0);
+            for (size_t triangle = 0; triangle < triangleCount; ++triangle)
+            {
+                for (uint32_t corner = 0; corner < IndicesPerFace; ++corner)
+                {
+                    const uint32_t vertex = indices[triangle * IndicesPerFace + corner];
+                    vertexTriangles[vertexTriangleOffsets[vertex] + fillCount[vertex]++] = static_cast<uint32_t>(triangle);
+                }
+            }
+        }
+
+        const auto computeVertexScore = [&](uint32_t vertex, int32_t cachePosition)
+        {
+            const uint32_t remaining = remainingTriangleCount[vertex];
+            if (remaining == 0)
+            {
+                return -1.0f;
+            }
+            const float cacheScore = cachePosition >= 0 ? cacheScores[cachePosition] : 0.0f;
+            return cacheScore + valenceScores[AZStd::min(remaining, MaxValenceScore - 1)];
+        };
+
+        AZStd::vector<float> vertexScores(vertexCount);
+        for (uint32_t vertex = 0; vertex < vertexCount; ++vertex)
+        {
+            vertexScores[vertex] = computeVertexScore(vertex, -1);
+        }
+
+        // Start with the best triangle of the mesh
+        size_t bestTriangle = 0;
+        float bestScore = -1.0f;
+        for (size_t triangle = 0; triangle < triangleCount; ++triangle)
+        {
+            const uint32_t* corners = &indices[triangle * IndicesPerFace];
+            const float score = vertexScores[corners[0]] + vertexScores[corners[1]] + vertexScores[corners[2]];
+            if (score > bestScore)
+            {
+                bestScore = score;
+                bestTriangle = triangle;
+            }
+        }
+        AZStd::vector<bool> isTriangleEmitted(triangleCount, false);
+
+        // The cache holds three extra entries for the vertices of the triangle that is being added
+        AZStd::array<uint32_t, VertexCacheSize + IndicesPerFace> cache;
+        uint32_t cacheCount = 0;
+        AZStd::array<uint32_t, VertexCacheSize + IndicesPerFace> newCache;
+
+        AZStd::vector<uint32_t> optimizedIndices;
+        optimizedIndices.reserve(indices.size());
+
+        size_t nextUnemittedTriangle = 0;
+        for (size_t emitted = 0; emitted < triangleCount; ++emitted)
+        {
+            if (bestTriangle == triangleCount)
+            {
+                // None of the vertices in the cache has triangles left, continue with the next triangle in source order
+                while (isTriangleEmitted[nextUnemittedTriangle])
+                {
+                    ++nextUnemittedTriangle;
+                }
+                bestTriangle = nextUnemittedTriangle;
+            }
+
+            const uint32_t* corners = &indices[bestTriangle * IndicesPerFace];
+            optimizedIndices.insert(optimizedIndices.end(), corners, corners + IndicesPerFace);
+            isTriangleEmitted[bestTriangle] = true;
+
+            // Move the emitted triangle out of the remaining triangles of its vertices, and put its vertices at the front of the cache
+            uint32_t newCacheCount = 0;
+            for (uint32_t corner = 0; corner < IndicesPerFace; ++corner)
+            {
+                const uint32_t vertex = corners[corner];
+                uint32_t* triangles = &vertexTriangles[vertexTriangleOffsets[vertex]];
+                uint32_t& remaining = remainingTriangleCount[vertex];
+                AZStd::swap(*AZStd::find(triangles, triangles + remaining, static_cast<uint32_t>(bestTriangle)), triangles[remaining - 1]);
+                --remaining;
+
+                // Degenerate triangles can use the same vertex more than once
+                if (AZStd::find(newCache.begin(), newCache.begin() + newCacheCount, vertex) == newCache.begin() + newCacheCount)
+                {
+                    newCache[newCacheCount++] = vertex;
+                }
+            }
+            for (uint32_t i = 0; i < cacheCount; ++i)
+            {
+                const uint32_t vertex = cache[i];
+                if (vertex != corners[0] && vertex != corners[1] && vertex != corners[2])
+                {
+                    newCache[newCacheCount++] = vertex;
+                }
+            }
+
+            // Rescore the vertices in the cache, the ones that fell off the end lose their cache score
+            for (uint32_t i = 0; i < newCacheCount; ++i)
+            {
+                const uint32_t vertex = newCache[i];
+                vertexScores[vertex] = computeVertexScore(vertex, i < VertexCacheSize ? static_cast<int32_t>(i) : -1);
+            }
+
+            // Rescore the remaining triangles of the vertices in the cache and pick the best one
+            bestTriangle = triangleCount;
+            bestScore = -1.0f;
+            for (uint32_t i = 0; i < newCacheCount; ++i)
+            {
+                const uint32_t vertex = newCache[i];
+                const uint32_t* triangles = &vertexTriangles[vertexTriangleOffsets[vertex]];
+                for (uint32_t t = 0; t < remainingTriangleCount[vertex]; ++t)
+                {
+                    const uint32_t triangle = triangles[t];
+                    const uint32_t* triangleCorners = &indices[triangle * IndicesPerFace];
+                    const float score = vertexScores[triangleCorners[0]] + vertexScores[triangleCorners[1]] + vertexScores[triangleCorners[2]];
+                    if (score > bestScore)
+                    {
+                        bestScore = score;
+                        bestTriangle = triangle;
+                    }
+                }
+            }
+
+            cacheCount = AZStd::min(newCacheCount, VertexCacheSize);
+            AZStd::copy(newCache.begin(), newCache.begin() + cacheCount, cache.begin());
+        }
+
+        indices.swap(optimizedIndices);
+    }
+#endif
 }
 
 namespace AZ
@@ -699,6 +898,11 @@ namespace AZ
                         index = oldToNewIndices[index];
                     }
 
+#if defined(AZ_RPI_OPTIMIZE_TRIANGLE_ORDER)
+                    // Only the triangle order changes, the vertices keep the order of the source mesh that morph targets rely on
+                    OptimizeTriangleOrderForVertexCache(productMesh.m_indices, oldToNewIndices.size());
+#endif
+
                     AZStd::vector<float>& positions = productMesh.m_positions;
                     AZStd::vector<float>& normals = productMesh.m_normals;
                     AZStd::vector<float>& tangents = productMesh.m_tangents;
@@ -368,6 +368,9 @@ namespace AZ
                         case MaterialPropertyOutputType::ShaderInput:
                             materialTypeAssetCreator.ConnectMaterialPropertyToShaderInput(Name{ output.m_nameId.data() });
                             break;
+                        case MaterialPropertyOutputType::ShaderInputBindlessIndex:
+                            materialTypeAssetCreator.ConnectMaterialPropertyToBindlessImageIndex(Name{ output.m_nameId.data() });
+                            break;
                         case MaterialPropertyOutputType::ShaderOption:
                             if (output.m_shaderIndex >= 0)
                             {
@@ -273,6 +273,11 @@ namespace AZ
             }
         }
 
+        bool Buffer::IsUploadPending() const
+        {
+            return m_streamFence && m_streamFence->GetFenceState() != RHI::FenceState::Signaled;
+        }
+
         bool Buffer::Orphan()
         {
             if (m_rhiBufferPool->GetDescriptor().m_heapMemoryLevel != RHI::HeapMemoryLevel::Host)
@@ -131,6 +131,11 @@ namespace AZ
                 bufferPoolDesc.m_heapMemoryLevel = RHI::HeapMemoryLevel::Device;
                 bufferPoolDesc.m_hostMemoryAccess = RHI::HostMemoryAccess::Write;
                 break;
+            case CommonBufferPoolType::Indirect:
+                bufferPoolDesc.m_bindFlags = RHI::BufferBindFlags::ShaderWrite | RHI::BufferBindFlags::ShaderRead | RHI::BufferBindFlags::Indirect;
+                bufferPoolDesc.m_heapMemoryLevel = RHI::HeapMemoryLevel::Device;
+                bufferPoolDesc.m_hostMemoryAccess = RHI::HostMemoryAccess::Write;
+                break;
             default:
                 AZ_Error("BufferSystem", false, "Unknown common buffer pool type: %d", poolType);
                 return false;
@@ -9,6 +9,8 @@
 #include <Atom/RPI.Public/AuxGeom/AuxGeomDraw.h>
 #include <Atom/RPI.Public/AuxGeom/AuxGeomFeatureProcessorInterface.h>
 #include <Atom/RPI.Public/Culling.h>
+#include <Atom/RPI.Public/FrustumCullingBatch.h>
+#include <Atom/RPI.Public/HierarchicalZBuffer.h>
 #include <Atom/RPI.Public/Model/ModelLodUtils.h>
 #include <Atom/RPI.Public/RPISystemInterface.h>
 #include <Atom/RPI.Public/Scene.h>
@@ -31,6 +33,8 @@
 #include <MaskedOcclusionCulling/MaskedOcclusionCulling.h>
 #endif
 
+AZ_CVAR_EXTERNED(bool, r_hiZOcclusionCulling);
+
 //Enables more inner-loop profiling scopes (can create high overhead in RadTelemetry if there are many-many objects in a scene)
 //#define AZ_CULL_PROFILE_DETAILED
 
@@ -44,6 +48,8 @@ namespace AZ
     {
         AZ_CVAR(bool, r_CullInParallel, true, nullptr, ConsoleFunctorFlags::Null, "");
         AZ_CVAR(uint32_t, r_CullWorkPerBatch, 500, nullptr, ConsoleFunctorFlags::Null, "");
+        AZ_CVAR(bool, r_CullDeferredUpdates, true, nullptr, ConsoleFunctorFlags::Null,
+            "Queue the cullable updates per thread and apply them to the visibility scene at the start of culling, instead of locking the scene for each update");
 
         void DebugDrawWorldCoordinateAxes(AuxGeomDraw* auxGeom)
         {
@@ -246,7 +252,21 @@ namespace AZ
             // results depending on a race condition if you happen to update before or after
             // the culling system starts Enumerating, so use soft_lock_shared here
             m_cullDataConcurrencyCheck.soft_lock_shared();
-            m_visScene->InsertOrUpdateEntry(cullable.m_cullData.m_visibilityEntry);
+            m_changedCullableBounds.local().push_back(cullable.m_cullData.m_visibilityEntry.m_boundingVolume);
+            if (r_CullDeferredUpdates)
+            {
+                // Each thread appends to its own queue, only BeginCulling and UnregisterCullable take the lock exclusively
+                AZStd::shared_lock<AZStd::shared_mutex> lock(m_queuedCullableUpdatesMutex);
+                if (!cullable.m_isUpdateQueued)
+                {
+                    cullable.m_isUpdateQueued = true;
+                    m_queuedCullableUpdates.local().push_back(&cullable);
+                }
+            }
+            else
+            {
+                m_visScene->InsertOrUpdateEntry(cullable.m_cullData.m_visibilityEntry);
+            }
             m_cullDataConcurrencyCheck.soft_unlock_shared();
         }
 
@@ -258,10 +278,55 @@ namespace AZ
             // results depending on a race condition if you happen to update before or after
             // the culling system starts Enumerating, so use soft_lock_shared here
             m_cullDataConcurrencyCheck.soft_lock_shared();
+            m_changedCullableBounds.local().push_back(cullable.m_cullData.m_visibilityEntry.m_boundingVolume);
+            if (cullable.m_isUpdateQueued)
+            {
+                // The cullable is about to be destroyed, so it can't stay in the queues
+                AZStd::unique_lock<AZStd::shared_mutex> lock(m_queuedCullableUpdatesMutex);
+                m_queuedCullableUpdates.combine_each([&cullable](AZStd::vector<Cullable*>& queuedCullables)
+                {
+                    auto queuedIter = AZStd::find(queuedCullables.begin(), queuedCullables.end(), &cullable);
+                    if (queuedIter != queuedCullables.end())
+                    {
+                        *queuedIter = queuedCullables.back();
+                        queuedCullables.pop_back();
+                    }
+                });
+                cullable.m_isUpdateQueued = false;
+            }
             m_visScene->RemoveEntry(cullable.m_cullData.m_visibilityEntry);
             m_cullDataConcurrencyCheck.soft_unlock_shared();
         }
 
+        bool CullingScene::HasChangedCullables(const Frustum& frustum)
+        {
+            bool hasChangedCullables = false;
+            m_changedCullableBounds.combine_each([&frustum, &hasChangedCullables](const AZStd::vector<Aabb>& changedBounds)
+            {
+                for (size_t i = 0; i < changedBounds.size() && !hasChangedCullables; ++i)
+                {
+                    hasChangedCullables = ShapeIntersection::Overlaps(frustum, changedBounds[i]);
+                }
+            });
+            return hasChangedCullables;
+        }
+
+        void CullingScene::ApplyQueuedCullableUpdates()
+        {
+            AZ_PROFILE_FUNCTION(Debug::ProfileCategory::AzRender);
+
+            AZStd::unique_lock<AZStd::shared_mutex> lock(m_queuedCullableUpdatesMutex);
+            m_queuedCullableUpdates.combine_each([this](AZStd::vector<Cullable*>& queuedCullables)
+            {
+                for (Cullable* cullable : queuedCullables)
+                {
+                    cullable->m_isUpdateQueued = false;
+                    m_visScene->InsertOrUpdateEntry(cullable->m_cullData.m_visibilityEntry);
+                }
+                queuedCullables.clear();
+            });
+        }
+
         uint32_t CullingScene::GetNumCullables() const
         {
             return m_visScene->GetEntryCount();
@@ -279,6 +344,7 @@ namespace AZ
                 const Scene* m_scene = nullptr;
                 View* m_view = nullptr;
                 Frustum m_frustum;
+                AZStd::shared_ptr<const HierarchicalZBuffer> m_hierarchicalZBuffer;
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
                 MaskedOcclusionCulling* m_maskedOcclusionCulling = nullptr;
 #endif
@@ -288,6 +354,12 @@ namespace AZ
             const AZStd::shared_ptr<JobData> m_jobData;
             CullingScene::WorkListType m_worklist;
 
+            //scratch data of the fine-grained culling, reused for each node of the worklist
+            FrustumCullingBatch m_sphereBatch;
+            AZStd::vector<AzFramework::VisibilityEntry*> m_cullables;
+            AZStd::vector<uint32_t> m_interiorIndices;
+            AZStd::vector<uint32_t> m_overlappingIndices;
+
         public:
             AddObjectsToViewJob(const AZStd::shared_ptr<AddObjectsToViewJob::JobData>& jobData, CullingScene::WorkListType& worklist)
                 : Job(true, nullptr)        //auto-deletes, no JobContext
@@ -305,6 +377,7 @@ namespace AZ
                 const RHI::DrawListMask drawListMask = m_jobData->m_view->GetDrawListMask();
                 uint32_t numDrawPackets = 0;
                 uint32_t numVisibleCullables = 0;
+                uint32_t numOccludedCullables = 0;
 
                 for (const AzFramework::IVisibilityScene::NodeData& nodeData : m_worklist)
                 {
@@ -334,6 +407,12 @@ namespace AZ
                                         continue;
                                     }
 
+                                    if (IsHierarchicalZOccluded(visibleEntry))
+                                    {
+                                        ++numOccludedCullables;
+                                        continue;
+                                    }
+
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
                                     if (TestOcclusionCulling(visibleEntry) == MaskedOcclusionCulling::CullingResult::VISIBLE)
 #endif
@@ -348,7 +427,10 @@ namespace AZ
                     }
                     else
                     {
-                        //Do fine-grained culling before adding objects to the view
+                        //Do fine-grained culling before adding objects to the view.
+                        //The bounding spheres of the node are classified in batches, only the ones that cross the frustum need the obb test.
+                        m_cullables.clear();
+                        m_sphereBatch.Clear();
                         for (AzFramework::VisibilityEntry* visibleEntry : nodeData.m_entries)
                         {
                             if (visibleEntry->m_typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_Cullable)
@@ -363,22 +445,42 @@ namespace AZ
                                     continue;
                                 }
 
-                                IntersectResult res = ShapeIntersection::Classify(m_jobData->m_frustum, c->m_cullData.m_boundingSphere);
-                                if (res == IntersectResult::Exterior)
-                                {
-                                    continue;
-                                }
-                                else if (res == IntersectResult::Interior || ShapeIntersection::Overlaps(m_jobData->m_frustum, c->m_cullData.m_boundingObb))
-                                {
+                                m_sphereBatch.AddSphere(c->m_cullData.m_boundingSphere);
+                                m_cullables.push_back(visibleEntry);
+                            }
+                        }
+
+                        m_interiorIndices.clear();
+                        m_overlappingIndices.clear();
+                        m_sphereBatch.Classify(m_jobData->m_frustum, m_interiorIndices, m_overlappingIndices);
+
+                        for (uint32_t index : m_overlappingIndices)
+                        {
+                            const Cullable* c = static_cast<const Cullable*>(m_cullables[index]->m_userData);
+                            if (ShapeIntersection::Overlaps(m_jobData->m_frustum, c->m_cullData.m_boundingObb))
+                            {
+                                m_interiorIndices.push_back(index);
+                            }
+                        }
+
+                        for (uint32_t index : m_interiorIndices)
+                        {
+                            AzFramework::VisibilityEntry* visibleEntry = m_cullables[index];
+                            Cullable* c = static_cast<Cullable*>(visibleEntry->m_userData);
+
+                            if (IsHierarchicalZOccluded(visibleEntry))
+                            {
+                                ++numOccludedCullables;
+                                continue;
+                            }
+
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
-                                    if (TestOcclusionCulling(visibleEntry) == MaskedOcclusionCulling::CullingResult::VISIBLE)
+                            if (TestOcclusionCulling(visibleEntry) == MaskedOcclusionCulling::CullingResult::VISIBLE)
 #endif
-                                    {
-                                        numDrawPackets += AddLodDataToView(c->m_cullData.m_boundingSphere.GetCenter(), c->m_lodData, *m_jobData->m_view);
-                                        ++numVisibleCullables;
-                                        c->m_isVisible = true;
-                                    }
-                                }
+                            {
+                                numDrawPackets += AddLodDataToView(c->m_cullData.m_boundingSphere.GetCenter(), c->m_lodData, *m_jobData->m_view);
+                                ++numVisibleCullables;
+                                c->m_isVisible = true;
                             }
                         }
                     }
@@ -443,10 +545,19 @@ namespace AZ
                     //no need for mutex here since these are all atomics
                     cullStats.m_numVisibleDrawPackets += numDrawPackets;
                     cullStats.m_numVisibleCullables += numVisibleCullables;
+                    cullStats.m_numOccludedCullables += numOccludedCullables;
                     ++cullStats.m_numJobs;
                 }
             }
 
+            bool IsHierarchicalZOccluded(const AzFramework::VisibilityEntry* visibleEntry) const
+            {
+#ifdef AZ_CULL_PROFILE_DETAILED
+                AZ_PROFILE_FUNCTION(Debug::ProfileCategory::AzRender);
+#endif
+                return m_jobData->m_hierarchicalZBuffer && m_jobData->m_hierarchicalZBuffer->IsOccluded(visibleEntry->m_boundingVolume);
+            }
+
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
             MaskedOcclusionCulling::CullingResult TestOcclusionCulling(AzFramework::VisibilityEntry* visibleEntry)
             {
@@ -585,6 +696,13 @@ namespace AZ
             }
 #endif
 
+            // The depth read back for the view, shared by all the jobs so it can be replaced while they run
+            AZStd::shared_ptr<const HierarchicalZBuffer> hierarchicalZBuffer;
+            if (r_hiZOcclusionCulling && m_debugCtx.m_enableHierarchicalZCulling)
+            {
+                hierarchicalZBuffer = view.GetHierarchicalZBuffer();
+            }
+
             WorkListType worklist;
 
             AZStd::shared_ptr<AddObjectsToViewJob::JobData> jobData = AZStd::make_shared<AddObjectsToViewJob::JobData>();
@@ -592,6 +710,7 @@ namespace AZ
             jobData->m_scene = &scene;
             jobData->m_view = &view;
             jobData->m_frustum = frustum;
+            jobData->m_hierarchicalZBuffer = hierarchicalZBuffer;
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
             jobData->m_maskedOcclusionCulling = maskedOcclusionCulling;
 #endif
@@ -632,6 +751,7 @@ namespace AZ
                 remainingJobData->m_scene = &scene;
                 remainingJobData->m_view = &view;
                 remainingJobData->m_frustum = frustum;
+                remainingJobData->m_hierarchicalZBuffer = hierarchicalZBuffer;
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
                 remainingJobData->m_maskedOcclusionCulling = maskedOcclusionCulling;
 #endif
@@ -651,7 +771,7 @@ namespace AZ
             const Matrix4x4& viewToClip = view.GetViewToClipMatrix();
             //the [1][1] element of a perspective projection matrix stores cot(FovY/2) (equal to 2*nearPlaneDistance/nearPlaneHeight),
             //which is used to determine the (vertical) projected size in screen space
-            const float yScale = viewToClip.GetElement(1, 1);
+            const float yScale = viewToClip.GetElement(1, 1) * ModelLodUtils::GetLodScreenCoverageScale();
             const bool isPerspective = viewToClip.GetElement(3, 3) == 0.f;
             const Vector3 cameraPos = view.GetViewToWorldMatrix().GetTranslation();
 
@@ -722,6 +842,12 @@ namespace AZ
         {
             m_cullDataConcurrencyCheck.soft_lock();
 
+            ApplyQueuedCullableUpdates();
+            m_changedCullableBounds.combine_each([](AZStd::vector<Aabb>& changedBounds)
+            {
+                changedBounds.clear();
+            });
+
             m_debugCtx.ResetCullStats();
             m_debugCtx.m_numCullablesInScene = GetNumCullables();
 
@@ -15,6 +15,21 @@ namespace AZ
 {
     namespace RPI
     {
+        namespace
+        {
+            // The block of the ring buffer the current thread sub-allocates from
+            struct ThreadBlock
+            {
+                uint32_t m_frameGeneration = 0;
+                uint32_t m_position = 0;
+                uint32_t m_end = 0;
+            };
+
+            thread_local ThreadBlock s_threadBlock;
+
+            AZStd::atomic<uint32_t> s_lastFrameGeneration{ 0 };
+        }
+
         void DynamicBufferAllocator::Init(uint32_t ringBufferSize)
         {
             if (m_ringBuffer)
@@ -47,6 +62,8 @@ namespace AZ
             {
                 m_frameStartPositions[frame] = 0;
             }
+
+            BeginFrame();
         }
 
         void DynamicBufferAllocator::Shutdown()
@@ -57,7 +74,7 @@ namespace AZ
         }
 
         // [GFX TODO][ATOM-13182] Add unit tests for DynamicBufferAllocator's Allocate function 
-        RHI::Ptr<DynamicBuffer> DynamicBufferAllocator::Allocate(uint32_t size, [[maybe_unused]]uint32_t alignment)
+        RHI::Ptr<DynamicBuffer> DynamicBufferAllocator::Allocate(uint32_t size, uint32_t alignment)
         {
             size = RHI::AlignUp(size, alignment);
             uint32_t allocatePosition = 0;
@@ -74,53 +91,46 @@ namespace AZ
                 return nullptr;
             }
 
-            // Return if the allocation of current frame has reached limit
-            if (m_endPositionLimit == m_currentPosition && m_currentAllocatedSize > 0)
+            bool allocated = false;
+            if (size <= MaxThreadBlockAllocationSize)
             {
-                AZ_WarningOnce("RPI", !m_enableAllocationWarning, "DynamicBufferAllocator::Allocate: no more buffer is available");
-                return nullptr;
-            }
-
-            if (m_endPositionLimit > m_currentPosition)
-            {
-                if (m_endPositionLimit - m_currentPosition >= size)
+                ThreadBlock& threadBlock = s_threadBlock;
+                if (threadBlock.m_frameGeneration != m_frameGeneration)
                 {
-                    allocatePosition = m_currentPosition;
-                    m_currentPosition += size;
+                    threadBlock = ThreadBlock{ m_frameGeneration, 0, 0 };
                 }
-                else
-                {
-                    AZ_WarningOnce("RPI", !m_enableAllocationWarning, "DynamicBufferAllocator::Allocate: requested size (%d bytes) is larger than the size left (%d bytes)", size, m_endPositionLimit - m_currentPosition);
-                    return nullptr;
-                }
-            }
-            else
-            {
-                if (m_ringBufferSize - m_currentPosition >= size)
+
+                uint32_t position = RHI::AlignUp(threadBlock.m_position, alignment);
+                if (position + size > threadBlock.m_end)
                 {
-                    allocatePosition = m_currentPosition;
-                    m_currentPosition += size;
-                    if (m_ringBufferSize == m_currentPosition)
+                    uint32_t blockPosition = 0;
+                    if (AllocateRange(ThreadBlockSize, blockPosition))
                     {
-                        m_currentPosition = 0;
+                        threadBlock.m_end = blockPosition + ThreadBlockSize;
+                        position = RHI::AlignUp(blockPosition, alignment);
                     }
                 }
-                else
+
+                if (position + size <= threadBlock.m_end)
                 {
-                    if (m_endPositionLimit >= size)
-                    {
-                        allocatePosition = 0;
-                        m_currentPosition = size;
-                    }
-                    else
-                    {
-                        AZ_WarningOnce("RPI", !m_enableAllocationWarning, "DynamicBufferAllocator::Allocate: requested size (%d bytes) is larger than the size left (%d bytes)", size, m_endPositionLimit);
-                        return nullptr;
-                    }
+                    threadBlock.m_position = position + size;
+                    allocatePosition = position;
+                    allocated = true;
                 }
             }
 
-            m_currentAllocatedSize += size;
+            if (!allocated)
+            {
+                // Padded so the buffer can be aligned within the range
+                uint32_t rangePosition = 0;
+                if (!AllocateRange(size + alignment - 1, rangePosition))
+                {
+                    AZ_WarningOnce("RPI", !m_enableAllocationWarning, "DynamicBufferAllocator::Allocate: requested size (%d bytes) is larger than the size left (%d bytes)",
+                        size, m_frameAvailableSize - m_frameAllocatedSize.load());
+                    return nullptr;
+                }
+                allocatePosition = RHI::AlignUp(rangePosition, alignment);
+            }
 
             RHI::Ptr<DynamicBuffer> allocatedBuffer = aznew DynamicBuffer();
             allocatedBuffer->m_address = (uint8_t*)m_ringBufferStartAddress + allocatePosition;
@@ -129,6 +139,30 @@ namespace AZ
             return allocatedBuffer;
         }
 
+        bool DynamicBufferAllocator::AllocateRange(uint32_t size, uint32_t& position)
+        {
+            uint32_t allocatedSize = m_frameAllocatedSize.load(AZStd::memory_order_relaxed);
+            uint32_t rangeStart = 0;
+            do
+            {
+                rangeStart = allocatedSize;
+
+                // Ranges never wrap around the end of the ring buffer, the rest of the first range is skipped instead
+                if (rangeStart < m_frameFirstRangeSize && size > m_frameFirstRangeSize - rangeStart)
+                {
+                    rangeStart = m_frameFirstRangeSize;
+                }
+
+                if (size > m_frameAvailableSize - rangeStart)
+                {
+                    return false;
+                }
+            } while (!m_frameAllocatedSize.compare_exchange_weak(allocatedSize, rangeStart + size, AZStd::memory_order_relaxed));
+
+            position = rangeStart < m_frameFirstRangeSize ? m_currentPosition + rangeStart : rangeStart - m_frameFirstRangeSize;
+            return true;
+        }
+
         RHI::IndexBufferView DynamicBufferAllocator::GetIndexBufferView(RHI::Ptr<DynamicBuffer> dynamicBuffer, RHI::IndexFormat format)
         {
             return RHI::IndexBufferView(
@@ -159,8 +193,33 @@ namespace AZ
             m_enableAllocationWarning = enable;
         }
 
+        void DynamicBufferAllocator::BeginFrame()
+        {
+            if (m_endPositionLimit > m_currentPosition)
+            {
+                m_frameFirstRangeSize = m_endPositionLimit - m_currentPosition;
+                m_frameAvailableSize = m_frameFirstRangeSize;
+            }
+            else
+            {
+                m_frameFirstRangeSize = m_ringBufferSize - m_currentPosition;
+                m_frameAvailableSize = m_frameFirstRangeSize + m_endPositionLimit;
+            }
+
+            m_frameAllocatedSize = 0;
+            m_frameGeneration = ++s_lastFrameGeneration;
+        }
+
         void DynamicBufferAllocator::FrameEnd()
         {
+            // Move to the end of the memory reserved by this frame, including the unused parts of the thread blocks
+            const uint32_t allocatedSize = m_frameAllocatedSize.load();
+            m_currentPosition = allocatedSize <= m_frameFirstRangeSize ? m_currentPosition + allocatedSize : allocatedSize - m_frameFirstRangeSize;
+            if (m_currentPosition == m_ringBufferSize)
+            {
+                m_currentPosition = 0;
+            }
+
             uint32_t nextFrame = (m_currentFrame + 1) % AZ::RHI::Limits::Device::FrameCountMax;
 
             // The saved frame start position will become available since it's old than FrameCountMax. The saved start position of next frame is the new limit
@@ -171,8 +230,7 @@ namespace AZ
 
             m_currentFrame = nextFrame;
 
-            m_currentAllocatedSize = 0;
-
+            BeginFrame();
         }
     }
 }
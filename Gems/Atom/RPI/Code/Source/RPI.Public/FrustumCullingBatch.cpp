@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/FrustumCullingBatch.h>
+
+#include <AzCore/Math/SimdMath.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        void FrustumCullingBatch::Clear()
+        {
+            m_centerX.clear();
+            m_centerY.clear();
+            m_centerZ.clear();
+            m_radius.clear();
+            m_sphereCount = 0;
+        }
+
+        uint32_t FrustumCullingBatch::AddSphere(const Sphere& sphere)
+        {
+            const uint32_t index = m_sphereCount++;
+            if (index % Simd::Vec4::ElementCount == 0)
+            {
+                const size_t paddedCount = index + Simd::Vec4::ElementCount;
+                m_centerX.resize(paddedCount, 0.0f);
+                m_centerY.resize(paddedCount, 0.0f);
+                m_centerZ.resize(paddedCount, 0.0f);
+                m_radius.resize(paddedCount, 0.0f);
+            }
+
+            const Vector3& center = sphere.GetCenter();
+            m_centerX[index] = center.GetX();
+            m_centerY[index] = center.GetY();
+            m_centerZ[index] = center.GetZ();
+            m_radius[index] = sphere.GetRadius();
+            return index;
+        }
+
+        uint32_t FrustumCullingBatch::GetSphereCount() const
+        {
+            return m_sphereCount;
+        }
+
+        void FrustumCullingBatch::Classify(const Frustum& frustum, AZStd::vector<uint32_t>& interiorIndices, AZStd::vector<uint32_t>& overlappingIndices) const
+        {
+            using Simd::Vec4;
+
+            Vec4::FloatType planeX[Frustum::PlaneId::MAX];
+            Vec4::FloatType planeY[Frustum::PlaneId::MAX];
+            Vec4::FloatType planeZ[Frustum::PlaneId::MAX];
+            Vec4::FloatType planeW[Frustum::PlaneId::MAX];
+            for (Frustum::PlaneId planeId = Frustum::PlaneId::Near; planeId < Frustum::PlaneId::MAX; ++planeId)
+            {
+                const Vec4::FloatType plane = frustum.GetPlane(planeId).GetSimdValue();
+                planeX[planeId] = Vec4::SplatFirst(plane);
+                planeY[planeId] = Vec4::SplatSecond(plane);
+                planeZ[planeId] = Vec4::SplatThird(plane);
+                planeW[planeId] = Vec4::SplatFourth(plane);
+            }
+
+            int32_t exteriorMasks[Vec4::ElementCount];
+            int32_t overlapMasks[Vec4::ElementCount];
+            for (uint32_t firstIndex = 0; firstIndex < m_sphereCount; firstIndex += Vec4::ElementCount)
+            {
+                const Vec4::FloatType centerX = Vec4::LoadUnaligned(&m_centerX[firstIndex]);
+                const Vec4::FloatType centerY = Vec4::LoadUnaligned(&m_centerY[firstIndex]);
+                const Vec4::FloatType centerZ = Vec4::LoadUnaligned(&m_centerZ[firstIndex]);
+                const Vec4::FloatType radius = Vec4::LoadUnaligned(&m_radius[firstIndex]);
+                const Vec4::FloatType negativeRadius = Vec4::Sub(Vec4::ZeroFloat(), radius);
+
+                // Same rules as Frustum::IntersectSphere: outside of any plane is exterior, closer than the radius to any plane overlaps
+                Vec4::FloatType exterior = Vec4::ZeroFloat();
+                Vec4::FloatType overlaps = Vec4::ZeroFloat();
+                for (Frustum::PlaneId planeId = Frustum::PlaneId::Near; planeId < Frustum::PlaneId::MAX; ++planeId)
+                {
+                    const Vec4::FloatType distance =
+                        Vec4::Madd(planeX[planeId], centerX, Vec4::Madd(planeY[planeId], centerY, Vec4::Madd(planeZ[planeId], centerZ, planeW[planeId])));
+                    exterior = Vec4::Or(exterior, Vec4::CmpLt(distance, negativeRadius));
+                    overlaps = Vec4::Or(overlaps, Vec4::CmpLt(Vec4::Abs(distance), radius));
+                }
+
+                Vec4::StoreUnaligned(exteriorMasks, Vec4::CastToInt(exterior));
+                Vec4::StoreUnaligned(overlapMasks, Vec4::CastToInt(overlaps));
+
+                const uint32_t laneCount = AZStd::min<uint32_t>(Vec4::ElementCount, m_sphereCount - firstIndex);
+                for (uint32_t lane = 0; lane < laneCount; ++lane)
+                {
+                    if (exteriorMasks[lane])
+                    {
+                        continue;
+                    }
+                    AZStd::vector<uint32_t>& indices = overlapMasks[lane] ? overlappingIndices : interiorIndices;
+                    indices.push_back(firstIndex + lane);
+                }
+            }
+        }
+    } // namespace RPI
+} // namespace AZ
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/HierarchicalZBuffer.h>
+
+#include <AzCore/Math/Vector4.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/limits.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        HierarchicalZBuffer::HierarchicalZBuffer(AZStd::array_view<float> farthestDepths, uint32_t width, uint32_t height, const Matrix4x4& worldToClip)
+            : m_worldToClip(worldToClip)
+        {
+            if (width == 0 || height == 0 || farthestDepths.size() < static_cast<size_t>(width) * height)
+            {
+                AZ_Assert(false, "HierarchicalZBuffer expects %u x %u depths, %zu were provided", width, height, farthestDepths.size());
+                return;
+            }
+
+            m_mips.emplace_back();
+            Mip& firstMip = m_mips.back();
+            firstMip.m_width = width;
+            firstMip.m_height = height;
+            firstMip.m_depths.assign(farthestDepths.begin(), farthestDepths.begin() + static_cast<size_t>(width) * height);
+
+            // Texel x of a mip covers the texels 2x and 2x + 1 of the previous mip. The last texel of an odd row only has one.
+            while (m_mips.back().m_width > 1 || m_mips.back().m_height > 1)
+            {
+                Mip nextMip;
+                const Mip& previousMip = m_mips.back();
+                nextMip.m_width = (previousMip.m_width + 1) / 2;
+                nextMip.m_height = (previousMip.m_height + 1) / 2;
+                nextMip.m_depths.resize(static_cast<size_t>(nextMip.m_width) * nextMip.m_height);
+
+                for (uint32_t y = 0; y < nextMip.m_height; ++y)
+                {
+                    const uint32_t y0 = y * 2;
+                    const uint32_t y1 = AZStd::min(y0 + 1, previousMip.m_height - 1);
+                    for (uint32_t x = 0; x < nextMip.m_width; ++x)
+                    {
+                        const uint32_t x0 = x * 2;
+                        const uint32_t x1 = AZStd::min(x0 + 1, previousMip.m_width - 1);
+                        const float farthestDepth = AZStd::min(
+                            AZStd::min(previousMip.m_depths[y0 * previousMip.m_width + x0], previousMip.m_depths[y0 * previousMip.m_width + x1]),
+                            AZStd::min(previousMip.m_depths[y1 * previousMip.m_width + x0], previousMip.m_depths[y1 * previousMip.m_width + x1]));
+                        nextMip.m_depths[y * nextMip.m_width + x] = farthestDepth;
+                    }
+                }
+
+                m_mips.emplace_back(AZStd::move(nextMip));
+            }
+        }
+
+        bool HierarchicalZBuffer::IsOccluded(const Aabb& worldBounds) const
+        {
+            if (m_mips.empty())
+            {
+                return false;
+            }
+
+            const Vector3& minBound = worldBounds.GetMin();
+            const Vector3& maxBound = worldBounds.GetMax();
+
+            float ndcMinX = AZStd::numeric_limits<float>::max();
+            float ndcMinY = AZStd::numeric_limits<float>::max();
+            float ndcMaxX = -AZStd::numeric_limits<float>::max();
+            float ndcMaxY = -AZStd::numeric_limits<float>::max();
+            float nearestDepth = 0.0f;
+            for (uint32_t cornerIndex = 0; cornerIndex < 8; ++cornerIndex)
+            {
+                const Vector4 corner(
+                    (cornerIndex & 1) ? maxBound.GetX() : minBound.GetX(),
+                    (cornerIndex & 2) ? maxBound.GetY() : minBound.GetY(),
+                    (cornerIndex & 4) ? maxBound.GetZ() : minBound.GetZ(),
+                    1.0f);
+                const Vector4 clipPosition = m_worldToClip * corner;
+
+                // The bounds cross the near plane
+                const float w = clipPosition.GetW();
+                if (w < 0.00000001f)
+                {
+                    return false;
+                }
+
+                const float invW = 1.0f / w;
+                const float ndcX = clipPosition.GetX() * invW;
+                const float ndcY = clipPosition.GetY() * invW;
+                ndcMinX = AZStd::min(ndcMinX, ndcX);
+                ndcMinY = AZStd::min(ndcMinY, ndcY);
+                ndcMaxX = AZStd::max(ndcMaxX, ndcX);
+                ndcMaxY = AZStd::max(ndcMaxY, ndcY);
+                nearestDepth = AZStd::max(nearestDepth, clipPosition.GetZ() * invW);
+            }
+
+            // What was outside of the screen when the depth was rendered can be visible now
+            if (ndcMinX < -1.0f || ndcMinY < -1.0f || ndcMaxX > 1.0f || ndcMaxY > 1.0f || nearestDepth >= 1.0f)
+            {
+                return false;
+            }
+
+            // NDC y points up and texture rows go down
+            const Mip& firstMip = m_mips.front();
+            const float width = static_cast<float>(firstMip.m_width);
+            const float height = static_cast<float>(firstMip.m_height);
+            uint32_t x0 = AZStd::min(static_cast<uint32_t>((ndcMinX * 0.5f + 0.5f) * width), firstMip.m_width - 1);
+            uint32_t x1 = AZStd::min(static_cast<uint32_t>((ndcMaxX * 0.5f + 0.5f) * width), firstMip.m_width - 1);
+            uint32_t y0 = AZStd::min(static_cast<uint32_t>((0.5f - ndcMaxY * 0.5f) * height), firstMip.m_height - 1);
+            uint32_t y1 = AZStd::min(static_cast<uint32_t>((0.5f - ndcMinY * 0.5f) * height), firstMip.m_height - 1);
+
+            // Use the most detailed mip where the bounds cover at most 2x2 texels
+            uint32_t mip = 0;
+            while ((x1 - x0 > 1 || y1 - y0 > 1) && mip + 1 < m_mips.size())
+            {
+                x0 >>= 1;
+                x1 >>= 1;
+                y0 >>= 1;
+                y1 >>= 1;
+                ++mip;
+            }
+
+            const Mip& testMip = m_mips[mip];
+            float farthestDepth = AZStd::numeric_limits<float>::max();
+            for (uint32_t y = y0; y <= y1; ++y)
+            {
+                for (uint32_t x = x0; x <= x1; ++x)
+                {
+                    farthestDepth = AZStd::min(farthestDepth, testMip.m_depths[y * testMip.m_width + x]);
+                }
+            }
+
+            return nearestDepth < farthestDepth;
+        }
+
+        uint32_t HierarchicalZBuffer::GetMipCount() const
+        {
+            return static_cast<uint32_t>(m_mips.size());
+        }
+
+        uint32_t HierarchicalZBuffer::GetWidth(uint32_t mip) const
+        {
+            return mip < m_mips.size() ? m_mips[mip].m_width : 0;
+        }
+
+        uint32_t HierarchicalZBuffer::GetHeight(uint32_t mip) const
+        {
+            return mip < m_mips.size() ? m_mips[mip].m_height : 0;
+        }
+
+        float HierarchicalZBuffer::GetDepth(uint32_t mip, uint32_t x, uint32_t y) const
+        {
+            AZ_Assert(mip < m_mips.size() && x < m_mips[mip].m_width && y < m_mips[mip].m_height, "Texel is out of range");
+            return m_mips[mip].m_depths[y * m_mips[mip].m_width + x];
+        }
+
+        const Matrix4x4& HierarchicalZBuffer::GetWorldToClipMatrix() const
+        {
+            return m_worldToClip;
+        }
+    } // namespace RPI
+} // namespace AZ
@@ -12,6 +12,7 @@
 #include <Atom/RPI.Public/Image/StreamingImage.h>
 #include <Atom/RPI.Public/Image/StreamingImagePool.h>
 #include <Atom/RPI.Public/Image/DefaultStreamingImageController.h>
+#include <Atom/RPI.Public/Image/MipFeedbackStreamingImageController.h>
 
 #include <Atom/RPI.Reflect/Asset/AssetHandler.h>
 #include <Atom/RPI.Reflect/Image/AttachmentImageAssetCreator.h>
@@ -52,6 +53,7 @@ namespace AZ
             StreamingImagePoolAsset::Reflect(context);
             StreamingImageControllerAsset::Reflect(context);
             DefaultStreamingImageControllerAsset::Reflect(context);
+            MipFeedbackStreamingImageControllerAsset::Reflect(context);
             AttachmentImageAsset::Reflect(context);
         }
 
@@ -64,6 +66,9 @@ namespace AZ
             assetHandlers.emplace_back(MakeAssetHandler<BuiltInAssetHandler>(
                 azrtti_typeid<DefaultStreamingImageControllerAsset>(),
                 []() { return aznew DefaultStreamingImageControllerAsset(); }));
+            assetHandlers.emplace_back(MakeAssetHandler<BuiltInAssetHandler>(
+                azrtti_typeid<MipFeedbackStreamingImageControllerAsset>(),
+                []() { return aznew MipFeedbackStreamingImageControllerAsset(); }));
         }
 
         void ImageSystem::Init(const ImageSystemDescriptor& desc)
@@ -130,7 +135,14 @@ namespace AZ
             // Register streaming image controller instance database.
             {
                 Data::InstanceHandler<StreamingImageController> handler;
-                handler.m_createFunction = DefaultStreamingImageController::CreateInternal;
+                handler.m_createFunction = [](Data::AssetData* controllerAsset) -> Data::Instance<StreamingImageController>
+                {
+                    if (azrtti_istypeof<MipFeedbackStreamingImageControllerAsset>(controllerAsset))
+                    {
+                        return MipFeedbackStreamingImageController::CreateInternal(controllerAsset);
+                    }
+                    return DefaultStreamingImageController::CreateInternal(controllerAsset);
+                };
                 Data::InstanceDatabase<StreamingImageController>::Create(azrtti_typeid<StreamingImageControllerAsset>(), handler);
             }
 
@@ -138,6 +150,13 @@ namespace AZ
                 Data::AssetManager::Instance().CreateAsset<DefaultStreamingImageControllerAsset>(
                     DefaultStreamingImageControllerAsset::BuiltInAssetId, AZ::Data::AssetLoadBehavior::PreLoad);
 
+            if (desc.m_useMipFeedbackStreaming)
+            {
+                m_mipFeedbackStreamingImageControllerAsset =
+                    Data::AssetManager::Instance().CreateAsset<MipFeedbackStreamingImageControllerAsset>(
+                        MipFeedbackStreamingImageControllerAsset::BuiltInAssetId, AZ::Data::AssetLoadBehavior::PreLoad);
+            }
+
             CreateDefaultResources(desc);
 
             Interface<ImageSystemInterface>::Register(this);
@@ -154,6 +173,7 @@ namespace AZ
             Interface<ImageSystemInterface>::Unregister(this);
 
             m_defaultStreamingImageControllerAsset.Release();
+            m_mipFeedbackStreamingImageControllerAsset.Release();
             m_systemImages.clear();
             m_systemStreamingPool = nullptr;
             m_systemAttachmentPool = nullptr;
@@ -270,7 +290,15 @@ namespace AZ
                 StreamingImagePoolAssetCreator poolAssetCreator;
                 poolAssetCreator.Begin(assetStreamingPoolDescriptor.m_assetId);
                 poolAssetCreator.SetPoolDescriptor(AZStd::move(imagePoolDescriptor));
-                poolAssetCreator.SetControllerAsset(m_defaultStreamingImageControllerAsset);
+                // The system pool holds images created from CPU data, so only the asset pool is driven by the mip feedback
+                if (m_mipFeedbackStreamingImageControllerAsset)
+                {
+                    poolAssetCreator.SetControllerAsset(m_mipFeedbackStreamingImageControllerAsset);
+                }
+                else
+                {
+                    poolAssetCreator.SetControllerAsset(m_defaultStreamingImageControllerAsset);
+                }
                 poolAssetCreator.SetPoolName(assetStreamingPoolDescriptor.m_name);
                 const bool created = poolAssetCreator.End(poolAsset);
                 AZ_Assert(created, "Failed to build streaming image pool for assets");
@@ -0,0 +1,278 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/Image/MipFeedbackStreamingImageController.h>
+#include <Atom/RPI.Public/Image/StreamingImage.h>
+#include <Atom/RPI.Public/Shader/BindlessResourceTableInterface.h>
+
+#include <Atom/RHI/StreamingImagePool.h>
+#include <Atom/RHI.Reflect/ImageSubresource.h>
+
+#include <AtomCore/Instance/InstanceDatabase.h>
+
+#include <AzCore/Debug/EventTrace.h>
+#include <AzCore/std/sort.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        Data::Instance<MipFeedbackStreamingImageController> MipFeedbackStreamingImageController::FindOrCreate(
+            const Data::Asset<MipFeedbackStreamingImageControllerAsset>& asset)
+        {
+            return azrtti_cast<MipFeedbackStreamingImageController*>(
+                Data::InstanceDatabase<StreamingImageController>::Instance().FindOrCreate(
+                    Data::InstanceId::CreateFromAssetId(asset.GetId()),
+                    asset));
+        }
+
+        Data::Instance<MipFeedbackStreamingImageController> MipFeedbackStreamingImageController::CreateInternal(Data::AssetData* assetData)
+        {
+            MipFeedbackStreamingImageControllerAsset* specificAsset = azrtti_cast<MipFeedbackStreamingImageControllerAsset*>(assetData);
+            if (!specificAsset)
+            {
+                AZ_Error("MipFeedbackStreamingImageController", false, "MipFeedbackStreamingImageController instance requires a MipFeedbackStreamingImageControllerAsset.");
+                return nullptr;
+            }
+
+            Data::Instance<MipFeedbackStreamingImageController> instance = aznew MipFeedbackStreamingImageController();
+
+            const RHI::ResultCode resultCode = instance->Init(*specificAsset);
+            if (resultCode == RHI::ResultCode::Success)
+            {
+                return instance;
+            }
+
+            return nullptr;
+        }
+
+        RHI::ResultCode MipFeedbackStreamingImageController::Init(MipFeedbackStreamingImageControllerAsset& imageControllerAsset)
+        {
+            m_memoryBudgetInBytes = imageControllerAsset.m_memoryBudgetInBytes;
+            m_maxExpandsPerUpdate = imageControllerAsset.m_maxExpandsPerUpdate;
+            m_requestLifetimeInUpdates = imageControllerAsset.m_requestLifetimeInUpdates;
+            return RHI::ResultCode::Success;
+        }
+
+        StreamingImageContextPtr MipFeedbackStreamingImageController::CreateContextInternal()
+        {
+            return aznew MipFeedbackContext();
+        }
+
+        void MipFeedbackStreamingImageController::InitMipChainSizes(const StreamingImage* image, MipFeedbackContext& context) const
+        {
+            const RHI::ImageDescriptor& imageDescriptor = image->GetRHIImage()->GetDescriptor();
+            const size_t mipChainCount = GetMipChainCount(image);
+
+            // Accumulate from the least detailed mip, so each chain includes the size of the chains after it
+            size_t sizeInBytes = 0;
+            uint16_t mipLevel = imageDescriptor.m_mipLevels;
+            context.m_mipChainSizesInBytes.resize(mipChainCount);
+            for (size_t mipChainIndex = mipChainCount; mipChainIndex-- > 0;)
+            {
+                const size_t mipChainLevel = GetMipLevel(image, mipChainIndex);
+                while (mipLevel > mipChainLevel)
+                {
+                    --mipLevel;
+                    const RHI::ImageSubresourceLayout layout = RHI::GetImageSubresourceLayout(imageDescriptor, RHI::ImageSubresource{ mipLevel, 0 });
+                    sizeInBytes += static_cast<size_t>(layout.m_bytesPerImage) * layout.m_size.m_depth * imageDescriptor.m_arraySize;
+                }
+                context.m_mipChainSizesInBytes[mipChainIndex] = sizeInBytes;
+            }
+        }
+
+        uint16_t MipFeedbackStreamingImageController::GetRequestedMipLevel(const StreamingImage* image, const MipFeedbackContext& context) const
+        {
+            // The target mip is reset after every update, so it is only set when SetTargetMip was called since the last one
+            uint16_t requestedMipLevel = context.GetTargetMip();
+
+            BindlessResourceTableInterface* bindlessTable = BindlessResourceTableInterface::Get();
+            if (bindlessTable && bindlessTable->GetMipFeedbackBuffer())
+            {
+                const uint32_t bindlessIndex = bindlessTable->FindImageIndex(image->GetImageView());
+                if (bindlessIndex != BindlessResourceTableInterface::DefaultImageIndex)
+                {
+                    requestedMipLevel = AZStd::min(requestedMipLevel, bindlessTable->GetMipFeedback(bindlessIndex));
+                }
+            }
+
+            return requestedMipLevel;
+        }
+
+        void MipFeedbackStreamingImageController::UpdateInternal(size_t timestamp, const StreamingImageContextList& contexts)
+        {
+            AZ_TRACE_METHOD();
+
+            const size_t budgetInBytes = m_memoryBudgetInBytes ? m_memoryBudgetInBytes : GetPool()->GetDescriptor().m_budgetInBytes;
+
+            // Gather the streamable images, where they are streaming to and which mip chain they need.
+            size_t usageInBytes = 0;
+            m_entries.clear();
+            for (const StreamingImageContext& streamingContext : contexts)
+            {
+                StreamingImage* image = streamingContext.TryGetImage();
+                if (!image || !image->IsStreamable())
+                {
+                    continue;
+                }
+
+                // Only contexts created by this controller are in the list
+                MipFeedbackContext& context = static_cast<MipFeedbackContext&>(const_cast<StreamingImageContext&>(streamingContext));
+                if (context.m_mipChainSizesInBytes.empty())
+                {
+                    InitMipChainSizes(image, context);
+                }
+
+                const uint16_t requestedMipLevel = GetRequestedMipLevel(image, context);
+                if (requestedMipLevel < RHI::Limits::Image::MipCountMax)
+                {
+                    // Keep the most detailed request while the image is in use, so a mip isn't trimmed because it wasn't sampled for a frame
+                    const bool requestExpired = timestamp - context.m_requestTimestamp > m_requestLifetimeInUpdates;
+                    context.m_requestedMipLevel = requestExpired ? requestedMipLevel : AZStd::min(context.m_requestedMipLevel, requestedMipLevel);
+                    context.m_requestTimestamp = timestamp;
+                    context.m_hasRequests = true;
+                }
+                else if (timestamp - context.m_requestTimestamp > m_requestLifetimeInUpdates)
+                {
+                    context.m_requestedMipLevel = RHI::Limits::Image::MipCountMax;
+                }
+
+                const size_t mipChainCount = context.m_mipChainSizesInBytes.size();
+                const size_t lastMipLevel = image->GetRHIImage()->GetDescriptor().m_mipLevels - 1;
+
+                ImageEntry& entry = m_entries.emplace_back();
+                entry.m_image = image;
+                entry.m_context = &context;
+                entry.m_targetMipChain = AZStd::min(GetTargetMipChainIndex(image), mipChainCount - 1);
+                if (!context.m_hasRequests)
+                {
+                    entry.m_desiredMipChain = 0;
+                }
+                else if (context.m_requestedMipLevel == RHI::Limits::Image::MipCountMax)
+                {
+                    entry.m_desiredMipChain = mipChainCount - 1;
+                }
+                else
+                {
+                    entry.m_desiredMipChain = GetMipChainIndex(image, AZStd::min<size_t>(context.m_requestedMipLevel, lastMipLevel));
+                }
+
+                usageInBytes += context.m_mipChainSizesInBytes[entry.m_targetMipChain];
+            }
+
+            auto getSizeInBytes = [](const ImageEntry& entry, size_t mipChainIndex)
+            {
+                return entry.m_context->m_mipChainSizesInBytes[mipChainIndex];
+            };
+
+            // Most recently requested first, then the images missing the most memory
+            m_expansions.clear();
+            for (ImageEntry& entry : m_entries)
+            {
+                if (entry.m_desiredMipChain < entry.m_targetMipChain)
+                {
+                    m_expansions.push_back(&entry);
+                }
+            }
+            AZStd::sort(m_expansions.begin(), m_expansions.end(), [&getSizeInBytes](const ImageEntry* lhs, const ImageEntry* rhs)
+            {
+                if (lhs->m_context->m_requestTimestamp != rhs->m_context->m_requestTimestamp)
+                {
+                    return lhs->m_context->m_requestTimestamp > rhs->m_context->m_requestTimestamp;
+                }
+                return getSizeInBytes(*lhs, lhs->m_desiredMipChain) - getSizeInBytes(*lhs, lhs->m_targetMipChain) >
+                    getSizeInBytes(*rhs, rhs->m_desiredMipChain) - getSizeInBytes(*rhs, rhs->m_targetMipChain);
+            });
+            if (m_expansions.size() > m_maxExpandsPerUpdate)
+            {
+                m_expansions.resize(m_maxExpandsPerUpdate);
+            }
+
+            size_t expansionSizeInBytes = 0;
+            for (const ImageEntry* entry : m_expansions)
+            {
+                expansionSizeInBytes += getSizeInBytes(*entry, entry->m_desiredMipChain) - getSizeInBytes(*entry, entry->m_targetMipChain);
+            }
+
+            // Release the mips that are more detailed than requested, least recently used first, to make room for the expansions
+            if (usageInBytes + expansionSizeInBytes > budgetInBytes)
+            {
+                m_sortedEntries.clear();
+                for (ImageEntry& entry : m_entries)
+                {
+                    if (entry.m_targetMipChain < entry.m_desiredMipChain)
+                    {
+                        m_sortedEntries.push_back(&entry);
+                    }
+                }
+                AZStd::sort(m_sortedEntries.begin(), m_sortedEntries.end(), [](const ImageEntry* lhs, const ImageEntry* rhs)
+                {
+                    return lhs->m_context->m_requestTimestamp < rhs->m_context->m_requestTimestamp;
+                });
+
+                for (ImageEntry* entry : m_sortedEntries)
+                {
+                    if (usageInBytes + expansionSizeInBytes <= budgetInBytes)
+                    {
+                        break;
+                    }
+                    usageInBytes -= getSizeInBytes(*entry, entry->m_targetMipChain) - getSizeInBytes(*entry, entry->m_desiredMipChain);
+                    entry->m_targetMipChain = entry->m_desiredMipChain;
+                    entry->m_trimmed = true;
+                    TrimToMipChainLevel(entry->m_image, entry->m_targetMipChain);
+                }
+            }
+
+            // Still over budget with requested mips only, drop one mip chain of the least recently used images
+            if (usageInBytes > budgetInBytes)
+            {
+                m_sortedEntries.clear();
+                for (ImageEntry& entry : m_entries)
+                {
+                    if (entry.m_targetMipChain + 1 < entry.m_context->m_mipChainSizesInBytes.size())
+                    {
+                        m_sortedEntries.push_back(&entry);
+                    }
+                }
+                AZStd::sort(m_sortedEntries.begin(), m_sortedEntries.end(), [](const ImageEntry* lhs, const ImageEntry* rhs)
+                {
+                    return lhs->m_context->m_requestTimestamp < rhs->m_context->m_requestTimestamp;
+                });
+
+                for (ImageEntry* entry : m_sortedEntries)
+                {
+                    if (usageInBytes <= budgetInBytes)
+                    {
+                        break;
+                    }
+                    usageInBytes -= getSizeInBytes(*entry, entry->m_targetMipChain) - getSizeInBytes(*entry, entry->m_targetMipChain + 1);
+                    ++entry->m_targetMipChain;
+                    entry->m_trimmed = true;
+                    TrimToMipChainLevel(entry->m_image, entry->m_targetMipChain);
+                }
+            }
+
+            for (const ImageEntry* entry : m_expansions)
+            {
+                // Expanding an image trimmed for being least recently used would only undo the trim
+                if (entry->m_trimmed)
+                {
+                    continue;
+                }
+
+                const size_t expansionInBytes = getSizeInBytes(*entry, entry->m_desiredMipChain) - getSizeInBytes(*entry, entry->m_targetMipChain);
+                if (usageInBytes + expansionInBytes > budgetInBytes)
+                {
+                    continue;
+                }
+                usageInBytes += expansionInBytes;
+                QueueExpandToMipChainLevel(entry->m_image, entry->m_desiredMipChain);
+            }
+        }
+    }
+}
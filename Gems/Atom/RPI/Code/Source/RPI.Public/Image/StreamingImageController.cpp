@@ -172,6 +172,31 @@ namespace AZ
             image->TrimToMipChainLevel(mipChainIndex);
         }
 
+        size_t StreamingImageController::GetMipChainCount(const StreamingImage* image) const
+        {
+            return image->m_imageAsset->GetMipChainCount();
+        }
+
+        size_t StreamingImageController::GetMipChainIndex(const StreamingImage* image, size_t mipLevel) const
+        {
+            return image->m_imageAsset->GetMipChainIndex(mipLevel);
+        }
+
+        size_t StreamingImageController::GetMipLevel(const StreamingImage* image, size_t mipChainIndex) const
+        {
+            return image->m_imageAsset->GetMipLevel(mipChainIndex);
+        }
+
+        size_t StreamingImageController::GetTargetMipChainIndex(const StreamingImage* image) const
+        {
+            return image->m_state.m_streamingTarget;
+        }
+
+        const RHI::StreamingImagePool* StreamingImageController::GetPool() const
+        {
+            return m_pool;
+        }
+
         StreamingImageContextPtr StreamingImageController::CreateContextInternal()
         {
             return aznew StreamingImageContext();
@@ -8,7 +8,9 @@
 
 #include <Atom/RPI.Public/ColorManagement/TransformColor.h>
 #include <Atom/RPI.Public/Material/Material.h>
+#include <Atom/RPI.Public/Material/MaterialSystem.h>
 #include <Atom/RPI.Public/Image/StreamingImage.h>
+#include <Atom/RPI.Public/Shader/BindlessResourceTableInterface.h>
 #include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
 #include <Atom/RPI.Public/Shader/ShaderReloadDebugTracker.h>
 #include <Atom/RPI.Public/Shader/Shader.h>
@@ -60,6 +62,9 @@ namespace AZ
 
             m_materialAsset = { &materialAsset, AZ::Data::AssetLoadBehavior::PreLoad };
 
+            // The properties are applied again below, which acquires the indices again
+            ReleaseBindlessImageIndices();
+
             // Cache off pointers to some key data structures from the material type...
             auto srgLayout = m_materialAsset->GetMaterialSrgLayout();
             if (srgLayout)
@@ -147,6 +152,19 @@ namespace AZ
 
             Compile();
 
+            // Start loading the shader variants of the material now, rather than when the first mesh using it is drawn.
+            // Meshes can still change some of the shader options, in which case they request their own variant later.
+            for (const ShaderCollection::Item& shaderItem : m_shaderCollection)
+            {
+                Data::Asset<ShaderAsset> shaderAsset = shaderItem.GetShaderAsset();
+                if (shaderItem.IsEnabled() && shaderAsset.IsReady())
+                {
+                    ShaderOptionGroup shaderOptions = *shaderItem.GetShaderOptions();
+                    shaderOptions.SetUnspecifiedToDefaultValues();
+                    shaderAsset->PrefetchVariant(shaderOptions.GetShaderVariantId(), DefaultSupervariantIndex);
+                }
+            }
+
             Data::AssetBus::Handler::BusConnect(m_materialAsset.GetId());
             MaterialReloadNotificationBus::Handler::BusConnect(m_materialAsset.GetId());
 
@@ -158,6 +176,7 @@ namespace AZ
             ShaderReloadNotificationBus::MultiHandler::BusDisconnect();
             MaterialReloadNotificationBus::Handler::BusDisconnect();
             Data::AssetBus::Handler::BusDisconnect();
+            ReleaseBindlessImageIndices();
         }
 
         const ShaderCollection& Material::GetShaderCollection() const
@@ -208,6 +227,18 @@ namespace AZ
             return m_materialAsset;
         }
 
+        void Material::QueueCompile()
+        {
+            if (MaterialSystem* materialSystem = MaterialSystem::Get())
+            {
+                materialSystem->QueueMaterialCompile(this);
+            }
+            else
+            {
+                Compile();
+            }
+        }
+
         bool Material::CanCompile() const
         {
             return !m_shaderResourceGroup || !m_shaderResourceGroup->IsQueuedForCompile();
@@ -467,6 +498,38 @@ namespace AZ
             return options.SetValue(shaderOptionIndex, ShaderOptionValue{ value });
         }
 
+        void Material::SetBindlessImageIndex(RHI::ShaderInputConstantIndex shaderInputIndex, const Data::Instance<Image>& image)
+        {
+            BindlessResourceTableInterface* bindlessTable = BindlessResourceTableInterface::Get();
+            uint32_t bindlessIndex = BindlessResourceTableInterface::DefaultImageIndex;
+            if (bindlessTable)
+            {
+                // Acquire before releasing, so setting the same image again keeps its index
+                bindlessIndex = bindlessTable->AcquireImageIndex(image ? image->GetImageView() : nullptr);
+
+                auto previousIter = m_bindlessImageIndices.find(shaderInputIndex.GetIndex());
+                if (previousIter != m_bindlessImageIndices.end())
+                {
+                    bindlessTable->ReleaseImageIndex(previousIter->second);
+                }
+                m_bindlessImageIndices[shaderInputIndex.GetIndex()] = bindlessIndex;
+            }
+
+            m_shaderResourceGroup->SetConstant(shaderInputIndex, bindlessIndex);
+        }
+
+        void Material::ReleaseBindlessImageIndices()
+        {
+            if (BindlessResourceTableInterface* bindlessTable = BindlessResourceTableInterface::Get())
+            {
+                for (const auto& [shaderInputIndex, bindlessIndex] : m_bindlessImageIndices)
+                {
+                    bindlessTable->ReleaseImageIndex(bindlessIndex);
+                }
+            }
+            m_bindlessImageIndices.clear();
+        }
+
         template<typename Type>
         bool Material::SetPropertyValue(MaterialPropertyIndex index, const Type& value)
         {
@@ -505,6 +568,13 @@ namespace AZ
                         SetShaderConstant(shaderInputIndex, value);
                     }
                 }
+                else if (outputId.m_type == MaterialPropertyOutputType::ShaderInputBindlessIndex)
+                {
+                    const Data::Instance<Image>& image = savedPropertyValue.GetValue<Data::Instance<Image>>();
+
+                    RHI::ShaderInputConstantIndex shaderInputIndex(outputId.m_itemIndex.GetIndex());
+                    SetBindlessImageIndex(shaderInputIndex, image);
+                }
                 else if (outputId.m_type == MaterialPropertyOutputType::ShaderOption)
                 {
                     ShaderCollection::Item& shaderReference = m_shaderCollection[outputId.m_containerIndex.GetIndex()];
@@ -9,6 +9,8 @@
 #include <Atom/RPI.Public/Material/Material.h>
 #include <Atom/RPI.Public/Material/MaterialSystem.h>
 
+#include <Atom/RHI/ShaderResourceGroup.h>
+
 #include <Atom/RPI.Reflect/Material/MaterialAsset.h>
 #include <Atom/RPI.Reflect/Material/MaterialFunctor.h>
 #include <Atom/RPI.Reflect/Material/MaterialPropertiesLayout.h>
@@ -16,10 +18,21 @@
 
 #include <AtomCore/Instance/InstanceDatabase.h>
 
+#include <AzCore/Debug/EventTrace.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/std/containers/unordered_map.h>
+
 namespace AZ
 {
     namespace RPI
     {
+        MaterialSystem* MaterialSystem::Get()
+        {
+            return Interface<MaterialSystem>::Get();
+        }
+
         void MaterialSystem::Reflect(AZ::ReflectContext* context)
         {
             MaterialPropertyValue::Reflect(context);
@@ -45,12 +58,100 @@ namespace AZ
                 return Material::CreateInternal(*(azrtti_cast<MaterialAsset*>(materialAsset)));
             };
             Data::InstanceDatabase<Material>::Create(azrtti_typeid<MaterialAsset>(), handler);
+
+            Interface<MaterialSystem>::Register(this);
         }
 
         void MaterialSystem::Shutdown()
         {
+            Interface<MaterialSystem>::Unregister(this);
+
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_compileQueueMutex);
+                for (const Data::Instance<Material>& material : m_compileQueue)
+                {
+                    material->m_isQueuedForCompile = false;
+                }
+                m_compileQueue.clear();
+            }
+
             Data::InstanceDatabase<Material>::Destroy();
         }
 
+        void MaterialSystem::QueueMaterialCompile(const Data::Instance<Material>& material)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_compileQueueMutex);
+            if (!material->m_isQueuedForCompile)
+            {
+                material->m_isQueuedForCompile = true;
+                m_compileQueue.push_back(material);
+            }
+        }
+
+        void MaterialSystem::CompileQueuedMaterials(RHI::JobPolicy jobPolicy)
+        {
+            AZ_TRACE_METHOD();
+
+            AZStd::vector<Data::Instance<Material>> materials;
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_compileQueueMutex);
+                AZStd::vector<Data::Instance<Material>> queuedMaterials;
+                queuedMaterials.swap(m_compileQueue);
+
+                materials.reserve(queuedMaterials.size());
+                for (Data::Instance<Material>& material : queuedMaterials)
+                {
+                    // Materials whose SRG was already compiled this frame wait for the next call.
+                    if (material->CanCompile())
+                    {
+                        material->m_isQueuedForCompile = false;
+                        materials.push_back(AZStd::move(material));
+                    }
+                    else
+                    {
+                        m_compileQueue.push_back(AZStd::move(material));
+                    }
+                }
+            }
+
+            if (materials.empty())
+            {
+                return;
+            }
+
+            if (jobPolicy == RHI::JobPolicy::Serial || materials.size() == 1)
+            {
+                for (const Data::Instance<Material>& material : materials)
+                {
+                    material->Compile();
+                }
+                return;
+            }
+
+            AZStd::unordered_map<const RHI::ShaderResourceGroupPool*, AZStd::vector<Material*>> materialsByPool;
+            for (const Data::Instance<Material>& material : materials)
+            {
+                const RHI::ShaderResourceGroup* srg = material->GetRHIShaderResourceGroup();
+                materialsByPool[srg ? srg->GetPool() : nullptr].push_back(material.get());
+            }
+
+            AZ::JobCompletion jobCompletion;
+            for (auto& poolMaterials : materialsByPool)
+            {
+                const auto compileMaterialsLambda = [&poolMaterials]()
+                {
+                    for (Material* material : poolMaterials.second)
+                    {
+                        material->Compile();
+                    }
+                };
+
+                AZ::Job* compileMaterialsJob = AZ::CreateJobFunction(AZStd::move(compileMaterialsLambda), true, nullptr);
+                compileMaterialsJob->SetDependent(&jobCompletion);
+                compileMaterialsJob->Start();
+            }
+            jobCompletion.StartAndWaitForCompletion();
+        }
+
     } // namespace RPI
 } // namespace AZ
@@ -96,6 +96,11 @@ namespace AZ
             return true;
         }
 
+        void MeshDrawPacket::SetIndirectArguments(const RHI::DrawIndirect& indirectArguments)
+        {
+            m_indirectArguments = indirectArguments;
+        }
+
         bool MeshDrawPacket::Update(const Scene& parentScene, bool forceUpdate /*= false*/)
         {
             // Why we need to check "!m_material->NeedsCompile()"...
@@ -136,7 +141,14 @@ namespace AZ
             RHI::DrawPacketBuilder drawPacketBuilder;
             drawPacketBuilder.Begin(nullptr);
 
-            drawPacketBuilder.SetDrawArguments(mesh.m_drawArguments);
+            if (m_indirectArguments)
+            {
+                drawPacketBuilder.SetDrawArguments(RHI::DrawArguments(*m_indirectArguments));
+            }
+            else
+            {
+                drawPacketBuilder.SetDrawArguments(mesh.m_drawArguments);
+            }
             drawPacketBuilder.SetIndexBufferView(mesh.m_indexBufferView);
             drawPacketBuilder.AddShaderResourceGroup(m_objectSrg->GetRHIShaderResourceGroup());
             drawPacketBuilder.AddShaderResourceGroup(m_material->GetRHIShaderResourceGroup());
@@ -225,7 +237,7 @@ namespace AZ
                 }
 
                 const ShaderVariantId finalVariantId = shaderOptions.GetShaderVariantId();
-                const ShaderVariant& variant = r_forceRootShaderVariantUsage ? shader->GetRootVariant() : shader->GetVariant(finalVariantId);
+                const ShaderVariant& variant = r_forceRootShaderVariantUsage ? shader->GetRootVariant() : shader->GetVariant(finalVariantId, m_shaderVariantLoadPriority);
 
                 RHI::PipelineStateDescriptorForDraw pipelineStateDescriptor;
                 variant.ConfigurePipelineState(pipelineStateDescriptor);
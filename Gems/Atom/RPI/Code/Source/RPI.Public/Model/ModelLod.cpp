@@ -422,6 +422,21 @@ namespace AZ
             }
         }
 
+        bool ModelLod::IsUploadPending() const
+        {
+            if (m_isUploadPending)
+            {
+                for (const Data::Instance<Buffer>& buffer : m_buffers)
+                {
+                    if (buffer->IsUploadPending())
+                    {
+                        return true;
+                    }
+                }
+            }
+            return false;
+        }
+
         uint32_t ModelLod::TrackBuffer(const Data::Instance<Buffer>& buffer)
         {
             for (uint32_t i = 0; i < m_buffers.size(); ++i)
@@ -11,6 +11,7 @@
 #include <Atom/RPI.Public/Model/Model.h>
 #include <Atom/RPI.Public/View.h>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Math/Transform.h>
 #include <AzCore/Math/Vector2.h>
 
@@ -18,6 +19,9 @@ namespace AZ
 {
     namespace RPI
     {
+        AZ_CVAR(float, r_lodScreenCoverageScale, 1.0f, nullptr, ConsoleFunctorFlags::Null,
+            "Scales the screen coverage of meshes when selecting their lods. Lower values use less detailed lods, higher values more detailed lods");
+
         namespace ModelLodUtils
         {
             ModelLodIndex SelectLod(const View* view, const Transform& entityTransform, const Model& model, ModelLodIndex lodOverride)
@@ -133,6 +137,11 @@ namespace AZ
                     return approxScreenPercentage;
                 }
             }
+
+            float GetLodScreenCoverageScale()
+            {
+                return AZStd::max(static_cast<float>(r_lodScreenCoverageScale), 0.0f);
+            }
         } // namespace ModelLodUtils
     } // namespace RPI
 } // namespace AZ
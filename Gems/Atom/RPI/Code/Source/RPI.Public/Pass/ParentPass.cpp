@@ -305,6 +305,23 @@ namespace AZ
             }
         }
 
+        bool ParentPass::IsRebuildRequiredOnResize() const
+        {
+            if (Pass::IsRebuildRequiredOnResize())
+            {
+                return true;
+            }
+
+            for (const Ptr<Pass>& child : m_children)
+            {
+                if (child->IsRebuildRequiredOnResize())
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
         void ParentPass::FrameBeginInternal(FramePrepareParams params)
         {
             for (const Ptr<Pass>& child : m_children)
@@ -1223,6 +1223,24 @@ namespace AZ
             m_state = PassState::Idle;
         }
 
+        bool Pass::IsRebuildRequiredOnResize() const
+        {
+            for (const Ptr<PassAttachment>& attachment : m_ownedAttachments)
+            {
+                if (attachment->GetAttachmentType() != RHI::AttachmentType::Image)
+                {
+                    continue;
+                }
+
+                const bool hasSizeSource = attachment->m_settingFlags.m_getSizeFromPipeline || attachment->m_sizeSource;
+                if (attachment->m_generateFullMipChain || (hasSizeSource && attachment->m_lifetime == RHI::AttachmentLifetimeType::Imported))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
         void Pass::Validate(PassValidationResults& validationResults)
         {
             if (PassValidation::IsEnabled())
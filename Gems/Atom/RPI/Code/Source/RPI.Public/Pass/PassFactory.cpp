@@ -14,6 +14,8 @@
 #include <Atom/RPI.Public/Pass/ParentPass.h>
 #include <Atom/RPI.Public/Pass/PassLibrary.h>
 #include <Atom/RPI.Public/Pass/Specific/DownsampleMipChainPass.h>
+#include <Atom/RPI.Public/Pass/Specific/HierarchicalZPass.h>
+#include <Atom/RPI.Public/Pass/Specific/MipFeedbackPass.h>
 #include <Atom/RPI.Public/Pass/Pass.h>
 #include <Atom/RPI.Public/Pass/PassFactory.h>
 #include <Atom/RPI.Public/Pass/PassFilter.h>
@@ -69,6 +71,8 @@ namespace AZ
             AddPassCreator(Name("EnvironmentCubeMapPass"), &EnvironmentCubeMapPass::Create);
             AddPassCreator(Name("RenderToTexturePass"), &RenderToTexturePass::Create);
             AddPassCreator(Name("SelectorPass"), &SelectorPass::Create);
+            AddPassCreator(Name("MipFeedbackPass"), &MipFeedbackPass::Create);
+            AddPassCreator(Name("HierarchicalZPass"), &HierarchicalZPass::Create);
         }
 
         PassFactory::CreatorIndex PassFactory::FindCreatorIndex(Name passClassName)
@@ -15,6 +15,7 @@
 #include <Atom/RPI.Public/Pass/PassFilter.h>
 #include <Atom/RPI.Public/Pass/PassSystemInterface.h>
 #include <Atom/RPI.Public/Pass/PassLibrary.h>
+#include <Atom/RPI.Public/Pass/Specific/MipFeedbackPass.h>
 #include <Atom/RPI.Reflect/Pass/PassAsset.h>
 #include <Atom/RPI.Reflect/Pass/ComputePassData.h>
 #include <Atom/RPI.Reflect/Asset/AssetUtils.h>
@@ -148,6 +149,7 @@ namespace AZ
         {
             // Put calls to pass template creation functions here...
             AddCopyPassTemplate();
+            AddMipFeedbackPassTemplate();
         }
 
         void PassLibrary::AddCopyPassTemplate()
@@ -173,6 +175,24 @@ namespace AZ
             AddPassTemplate(passTemplate->m_name, std::move(passTemplate));
         }
 
+        void PassLibrary::AddMipFeedbackPassTemplate()
+        {
+            AZStd::shared_ptr<PassTemplate> passTemplate = AZStd::make_shared<PassTemplate>();
+            passTemplate->m_passClass = "MipFeedbackPass";
+            passTemplate->m_name = "MipFeedbackPassTemplate";
+
+            // The clear resets every entry to "not sampled" after the readback of the frame's feedback
+            PassSlot feedbackSlot;
+            feedbackSlot.m_name = MipFeedbackPass::MipFeedbackSlotName;
+            feedbackSlot.m_slotType = PassSlotType::InputOutput;
+            feedbackSlot.m_scopeAttachmentUsage = RHI::ScopeAttachmentUsage::Shader;
+            feedbackSlot.m_loadStoreAction.m_loadAction = RHI::AttachmentLoadAction::Clear;
+            feedbackSlot.m_loadStoreAction.m_clearValue = RHI::ClearValue::CreateVector4Uint(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF);
+            passTemplate->m_slots.emplace_back(feedbackSlot);
+
+            AddPassTemplate(passTemplate->m_name, std::move(passTemplate));
+        }
+
         bool PassLibrary::AddPassTemplate(const Name& name, const AZStd::shared_ptr<PassTemplate>& passTemplate, bool hotReloading)
         {
             // Check if template already exists (unless we're hot reloading)
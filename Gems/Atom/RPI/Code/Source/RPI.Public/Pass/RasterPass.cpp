@@ -8,6 +8,7 @@
 
 #include <Atom/RHI/CommandList.h>
 #include <Atom/RHI/DrawListTagRegistry.h>
+#include <Atom/RHI/FrameGraphAttachmentDatabase.h>
 #include <Atom/RHI/RHISystemInterface.h>
 #include <Atom/RHI/ShaderResourceGroup.h>
 
@@ -203,6 +204,24 @@ namespace AZ
         {
             RenderPass::SetupFrameGraphDependencies(frameGraph);
             frameGraph.SetEstimatedItemCount(static_cast<u32>(m_drawListView.size()));
+
+            // Read the buffers that draw items of the scene consume, so this pass runs after the passes that write them
+            if (m_pipeline && m_pipeline->GetScene() && !m_drawListView.empty())
+            {
+                for (const Scene::DrawInputAttachment& drawInputAttachment : m_pipeline->GetScene()->GetDrawInputAttachments())
+                {
+                    if (!frameGraph.GetAttachmentDatabase().IsAttachmentValid(drawInputAttachment.m_attachmentId))
+                    {
+                        continue;
+                    }
+
+                    RHI::BufferScopeAttachmentDescriptor descriptor;
+                    descriptor.m_attachmentId = drawInputAttachment.m_attachmentId;
+                    descriptor.m_bufferViewDescriptor = drawInputAttachment.m_bufferViewDescriptor;
+                    descriptor.m_loadStoreAction.m_loadAction = RHI::AttachmentLoadAction::Load;
+                    frameGraph.UseAttachment(descriptor, RHI::ScopeAttachmentAccess::Read, drawInputAttachment.m_usage);
+                }
+            }
         }
 
         void RasterPass::CompileResources(const RHI::FrameGraphCompileContext& context)
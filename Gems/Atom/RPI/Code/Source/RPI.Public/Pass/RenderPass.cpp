@@ -23,12 +23,18 @@
 #include <Atom/RPI.Public/Pass/Specific/ImageAttachmentPreviewPass.h>
 #include <Atom/RPI.Public/RenderPipeline.h>
 #include <Atom/RPI.Public/Scene.h>
+#include <Atom/RPI.Public/Shader/BindlessResourceTableInterface.h>
 #include <Atom/RPI.Public/View.h>
 
+#include <AzCore/Console/IConsole.h>
+
 namespace AZ
 {
     namespace RPI
     {
+        AZ_CVAR(bool, r_asyncCompute, true, nullptr, ConsoleFunctorFlags::DontReplicate,
+            "Runs the passes whose pass data sets UseAsyncCompute on the asynchronous compute queue. When disabled every pass runs on the graphics queue.");
+
         RenderPass::RenderPass(const PassDescriptor& descriptor)
             : Pass(descriptor)
         {
@@ -38,6 +44,7 @@ namespace AZ
             {
                 SetPipelineViewTag(passData->m_pipelineViewTag);
             }
+            m_useAsyncCompute = passData && passData->m_useAsyncCompute;
         }
 
         RenderPass::~RenderPass()
@@ -209,8 +216,34 @@ namespace AZ
             ResetSrgs();
         }
 
+        RHI::HardwareQueueClass RenderPass::GetHardwareQueueClass() const
+        {
+            if (!m_useAsyncCompute || !r_asyncCompute)
+            {
+                return RHI::HardwareQueueClass::Graphics;
+            }
+
+            for (const PassAttachmentBinding& attachmentBinding : m_attachmentBindings)
+            {
+                switch (attachmentBinding.m_scopeAttachmentUsage)
+                {
+                case RHI::ScopeAttachmentUsage::RenderTarget:
+                case RHI::ScopeAttachmentUsage::DepthStencil:
+                case RHI::ScopeAttachmentUsage::Resolve:
+                case RHI::ScopeAttachmentUsage::SubpassInput:
+                    AZ_WarningOnce("RenderPass", false, "Pass '%s' requests async compute but has render attachments, it runs on the graphics queue.",
+                        GetPathName().GetCStr());
+                    return RHI::HardwareQueueClass::Graphics;
+                default:
+                    break;
+                }
+            }
+            return RHI::HardwareQueueClass::Compute;
+        }
+
         void RenderPass::SetupFrameGraphDependencies(RHI::FrameGraphInterface frameGraph)
         {
+            frameGraph.SetHardwareQueueClass(GetHardwareQueueClass());
             DeclareAttachmentsToFrameGraph(frameGraph);
             DeclarePassDependenciesToFrameGraph(frameGraph);
             AddScopeQueryToFrameGraph(frameGraph);
@@ -368,6 +401,15 @@ namespace AZ
                 BindSrg(view->GetRHIShaderResourceGroup());
             }
 
+            // Bindless srg, only present when the common srg shader declares it
+            if (BindlessResourceTableInterface* bindlessTable = BindlessResourceTableInterface::Get())
+            {
+                if (const RHI::ShaderResourceGroup* bindlessSrg = bindlessTable->GetRHIShaderResourceGroup())
+                {
+                    BindSrg(bindlessSrg);
+                }
+            }
+
             // Pass srg
             if (m_shaderResourceGroup)
             {
@@ -537,7 +579,7 @@ namespace AZ
                 const uint32_t TimestampResultQueryCount = 2u;
                 uint64_t timestampResult[TimestampResultQueryCount] = {0};
                 query->GetLatestResult(&timestampResult, sizeof(uint64_t) * TimestampResultQueryCount);
-                m_timestampResult = TimestampResult(timestampResult[0], timestampResult[1], RHI::HardwareQueueClass::Graphics);
+                m_timestampResult = TimestampResult(timestampResult[0], timestampResult[1], GetHardwareQueueClass());
             });
 
             ExecuteOnPipelineStatisticsQuery([this](RHI::Ptr<Query> query)
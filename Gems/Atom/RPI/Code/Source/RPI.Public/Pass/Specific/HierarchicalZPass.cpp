@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/Pass/Specific/HierarchicalZPass.h>
+#include <Atom/RPI.Public/HierarchicalZBuffer.h>
+#include <Atom/RPI.Public/Pass/AttachmentReadback.h>
+#include <Atom/RPI.Public/View.h>
+
+#include <AzCore/Console/IConsole.h>
+
+AZ_CVAR(bool, r_hiZOcclusionCulling, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+    "Reads back a reduced depth buffer of the main views and culls the objects hidden behind it.");
+
+namespace AZ
+{
+    namespace RPI
+    {
+        Ptr<HierarchicalZPass> HierarchicalZPass::Create(const PassDescriptor& descriptor)
+        {
+            Ptr<HierarchicalZPass> pass = aznew HierarchicalZPass(descriptor);
+            return pass;
+        }
+
+        HierarchicalZPass::HierarchicalZPass(const PassDescriptor& descriptor)
+            : ComputePass(descriptor)
+        {
+        }
+
+        bool HierarchicalZPass::IsEnabled() const
+        {
+            return ComputePass::IsEnabled() && r_hiZOcclusionCulling;
+        }
+
+        void HierarchicalZPass::FrameBeginInternal(FramePrepareParams params)
+        {
+            ViewPtr view = GetView();
+
+            if (!m_readback)
+            {
+                // Each pipeline has its own pass, so the scope name includes the pass path
+                m_readback = AZStd::make_shared<AttachmentReadback>(
+                    RHI::ScopeId{ AZStd::string::format("HierarchicalZReadback_%s", GetPathName().GetCStr()) });
+            }
+
+            if (view && m_readback->IsReady())
+            {
+                // The depth is only valid with the matrix it is rendered with this frame
+                const Matrix4x4 worldToClip = view->GetWorldToClipMatrix();
+                m_readback->SetCallback([view, worldToClip](const AttachmentReadback::ReadbackResult& result)
+                {
+                    const RHI::Size& size = result.m_imageDescriptor.m_size;
+                    const size_t depthCount = static_cast<size_t>(size.m_width) * size.m_height;
+                    if (result.m_state != AttachmentReadback::ReadbackState::Success ||
+                        result.m_imageDescriptor.m_format != RHI::Format::R32_FLOAT ||
+                        !result.m_dataBuffer ||
+                        result.m_dataBuffer->size() < depthCount * sizeof(float))
+                    {
+                        return;
+                    }
+
+                    AZStd::array_view<float> depths(reinterpret_cast<const float*>(result.m_dataBuffer->data()), depthCount);
+                    view->SetHierarchicalZBuffer(
+                        AZStd::make_shared<const HierarchicalZBuffer>(depths, size.m_width, size.m_height, worldToClip));
+                });
+                ReadbackAttachment(m_readback, Name(OutputSlotName), PassAttachmentReadbackOption::Output);
+            }
+
+            ComputePass::FrameBeginInternal(params);
+        }
+    }   // namespace RPI
+}   // namespace AZ
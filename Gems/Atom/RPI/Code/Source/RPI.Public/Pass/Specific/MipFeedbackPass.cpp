@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/Pass/Specific/MipFeedbackPass.h>
+#include <Atom/RPI.Public/Pass/AttachmentReadback.h>
+#include <Atom/RPI.Public/Shader/BindlessResourceTableInterface.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        Ptr<MipFeedbackPass> MipFeedbackPass::Create(const PassDescriptor& descriptor)
+        {
+            Ptr<MipFeedbackPass> pass = aznew MipFeedbackPass(descriptor);
+            return pass;
+        }
+
+        MipFeedbackPass::MipFeedbackPass(const PassDescriptor& descriptor)
+            : RenderPass(descriptor)
+        {
+        }
+
+        bool MipFeedbackPass::IsEnabled() const
+        {
+            BindlessResourceTableInterface* bindlessTable = BindlessResourceTableInterface::Get();
+            return RenderPass::IsEnabled() && bindlessTable && bindlessTable->GetMipFeedbackBuffer();
+        }
+
+        void MipFeedbackPass::BuildInternal()
+        {
+            if (BindlessResourceTableInterface* bindlessTable = BindlessResourceTableInterface::Get())
+            {
+                AttachBufferToSlot(Name(MipFeedbackSlotName), bindlessTable->GetMipFeedbackBuffer());
+            }
+        }
+
+        void MipFeedbackPass::FrameBeginInternal(FramePrepareParams params)
+        {
+            if (!m_readback)
+            {
+                // Each pipeline has its own pass, so the scope name includes the pass path
+                m_readback = AZStd::make_shared<AttachmentReadback>(
+                    RHI::ScopeId{ AZStd::string::format("MipFeedbackReadback_%s", GetPathName().GetCStr()) });
+                m_readback->SetCallback([](const AttachmentReadback::ReadbackResult& result)
+                {
+                    BindlessResourceTableInterface* bindlessTable = BindlessResourceTableInterface::Get();
+                    if (bindlessTable && result.m_state == AttachmentReadback::ReadbackState::Success)
+                    {
+                        bindlessTable->SetMipFeedback(result.m_dataBuffer);
+                    }
+                });
+            }
+
+            // A new readback is started as soon as the previous one completed, the buffer is reset every frame either way
+            if (m_readback->IsReady())
+            {
+                ReadbackAttachment(m_readback, Name(MipFeedbackSlotName), PassAttachmentReadbackOption::Input);
+            }
+
+            RenderPass::FrameBeginInternal(params);
+        }
+    }   // namespace RPI
+}   // namespace AZ
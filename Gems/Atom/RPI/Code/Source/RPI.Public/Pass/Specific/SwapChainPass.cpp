@@ -122,14 +122,20 @@ namespace AZ
 
         void SwapChainPass::FrameBeginInternal(FramePrepareParams params)
         {
-            params.m_scissorState = m_scissorState;
-            params.m_viewportState = m_viewportState;
-
             if(m_windowContext->GetSwapChain() == nullptr || m_windowContext->GetSwapChain()->GetImageCount() == 0)
             {
                 return;
             }
 
+            if (m_resizePending)
+            {
+                ResizeSwapChainAttachment();
+                m_resizePending = false;
+            }
+
+            params.m_scissorState = m_scissorState;
+            params.m_viewportState = m_viewportState;
+
             RHI::FrameGraphAttachmentInterface attachmentDatabase = params.m_frameGraphBuilder->GetAttachmentDatabase();
 
             // Import the SwapChain
@@ -140,9 +146,36 @@ namespace AZ
         
         void SwapChainPass::OnWindowResized([[maybe_unused]] uint32_t width, [[maybe_unused]] uint32_t height)
         {
+            // The attachments that derive their size from the swap chain are updated every frame, so the pass tree only needs
+            // to be rebuilt when some pass depends on the size in a way that is only resolved when it's built.
+            // The swap chain may not be resized yet, so the new size is read when the next frame begins.
+            if (m_swapChainAttachment && !IsRebuildRequiredOnResize())
+            {
+                m_resizePending = true;
+                return;
+            }
+
+            m_resizePending = false;
             QueueForBuildAndInitialization();
         }
 
+        void SwapChainPass::ResizeSwapChainAttachment()
+        {
+            const RHI::SwapChainDimensions& dimensions = m_windowContext->GetSwapChain()->GetDescriptor().m_dimensions;
+            if (dimensions.m_imageFormat != m_swapChainDimensions.m_imageFormat)
+            {
+                // The attachment formats and pipeline states depend on the format, so rebuild for the next frame
+                QueueForBuildAndInitialization();
+            }
+
+            m_swapChainDimensions = dimensions;
+            m_swapChainAttachment->m_descriptor.m_image.m_size.m_width = m_swapChainDimensions.m_imageWidth;
+            m_swapChainAttachment->m_descriptor.m_image.m_size.m_height = m_swapChainDimensions.m_imageHeight;
+
+            m_scissorState = m_windowContext->GetScissor();
+            m_viewportState = m_windowContext->GetViewport();
+        }
+
         void SwapChainPass::ReadbackSwapChain(AZStd::shared_ptr<AttachmentReadback> readback)
         {
             if (m_swapChainAttachment)
@@ -92,6 +92,7 @@ namespace AZ
             m_modelSystem.Init();
             m_shaderSystem.Init();
             m_shaderMetricsSystem.Init();
+            m_pipelineStateWarmup.Init();
             m_passSystem.Init();
             m_featureProcessorFactory.Init();
             m_querySystem.Init(m_descriptor.m_gpuQuerySystemDescriptor);
@@ -111,6 +112,7 @@ namespace AZ
             m_viewportContextManager.Shutdown();
             m_viewSrgLayout = nullptr;
             m_sceneSrgLayout = nullptr;
+            m_bindlessSrgLayout = nullptr;
             m_commonShaderAssetForSrgs.Reset();
 
 #if AZ_RPI_PRINT_GLOBAL_STATE_ON_ASSERT
@@ -121,6 +123,7 @@ namespace AZ
             Interface<RPISystemInterface>::Unregister(this);
 
             m_featureProcessorFactory.Shutdown();
+            m_pipelineStateWarmup.Shutdown();
             m_passSystem.Shutdown();
             m_dynamicDraw.Shutdown();
             m_bufferSystem.Shutdown();
@@ -128,6 +131,7 @@ namespace AZ
             m_modelSystem.Shutdown();
             m_shaderSystem.Shutdown();
             m_shaderMetricsSystem.Shutdown();
+            m_bindlessResourceTable.Shutdown();
             m_imageSystem.Shutdown();
             m_querySystem.Shutdown();
             m_rhiSystem.Shutdown();
@@ -234,6 +238,8 @@ namespace AZ
 
             // Image system update is using system tick but not game tick so it can stream images in background even game is pausing
             m_imageSystem.Update();
+
+            m_pipelineStateWarmup.Update();
         }
 
         void RPISystem::SimulationTick()
@@ -276,6 +282,9 @@ namespace AZ
             // Query system update is to increment the frame count
             m_querySystem.Update();
 
+            // Compile the materials queued since the last tick, before the scenes collect their draw packets
+            m_materialSystem.CompileQueuedMaterials(m_prepareRenderJobPolicy);
+
             // Collect draw packets for each scene and prepare RPI system SRGs
             // [GFX TODO] We may parallel scenes' prepare render.
             for (auto& scenePtr : m_scenes)
@@ -290,6 +299,9 @@ namespace AZ
                     // scope producers only can be added to the frame when frame started which cleans up previous scope producers.
                     m_passSystem.FrameUpdate(frameGraphBuilder);
 
+                    // Write the images added to the bindless table since the last frame
+                    m_bindlessResourceTable.Update();
+
                     // Update View Srgs
                     for (auto& scenePtr : m_scenes)
                     {
@@ -381,15 +393,20 @@ namespace AZ
                     m_descriptor.m_commonSrgsShaderAssetPath.c_str());
                 return;
             }
+            m_bindlessSrgLayout = m_commonShaderAssetForSrgs->FindShaderResourceGroupLayout(SrgBindingSlot::Bindless);
 
             m_rhiSystem.Init(m_descriptor.m_rhiSystemDescriptor);
             m_imageSystem.Init(m_descriptor.m_imageSystemDescriptor);
             m_bufferSystem.Init();
+            m_bindlessResourceTable.Init(
+                m_commonShaderAssetForSrgs, m_bindlessSrgLayout.get(), m_descriptor.m_imageSystemDescriptor.m_useMipFeedbackStreaming);
             m_dynamicDraw.Init(m_descriptor.m_dynamicDrawSystemDescriptor);
 
             m_passSystem.InitPassTemplates();
 
             m_systemAssetsInitialized = true;
+
+            m_pipelineStateWarmup.OnSystemAssetsInitialized();
         }
 
         bool RPISystem::IsInitialized() const
@@ -409,6 +426,7 @@ namespace AZ
             m_rhiSystem.Init(m_descriptor.m_rhiSystemDescriptor);
             m_imageSystem.Init(m_descriptor.m_imageSystemDescriptor);
             m_bufferSystem.Init();
+            m_bindlessResourceTable.Init({}, nullptr, false);
 
             // Assets aren't actually available or needed for tests, but the m_systemAssetsInitialized flag still needs to be flipped.
             m_systemAssetsInitialized = true;
@@ -800,5 +800,24 @@ namespace AZ
             }
             return nullptr;
         }
+
+        void Scene::AddDrawInputAttachment(const DrawInputAttachment& drawInputAttachment)
+        {
+            RemoveDrawInputAttachment(drawInputAttachment.m_attachmentId);
+            m_drawInputAttachments.push_back(drawInputAttachment);
+        }
+
+        void Scene::RemoveDrawInputAttachment(const RHI::AttachmentId& attachmentId)
+        {
+            AZStd::erase_if(m_drawInputAttachments, [&attachmentId](const DrawInputAttachment& drawInputAttachment)
+                {
+                    return drawInputAttachment.m_attachmentId == attachmentId;
+                });
+        }
+
+        const AZStd::vector<Scene::DrawInputAttachment>& Scene::GetDrawInputAttachments() const
+        {
+            return m_drawInputAttachments;
+        }
     }
 }
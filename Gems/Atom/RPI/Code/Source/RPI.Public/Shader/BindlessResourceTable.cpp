@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/Shader/BindlessResourceTable.h>
+#include <Atom/RPI.Public/Buffer/BufferSystemInterface.h>
+#include <Atom/RPI.Public/Shader/ShaderResourceGroup.h>
+#include <Atom/RPI.Public/Image/ImageSystemInterface.h>
+#include <Atom/RPI.Reflect/Image/Image.h>
+
+#include <Atom/RHI.Reflect/Limits.h>
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/limits.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        static const char* BindlessTableTexturesName = "m_textures";
+        static const char* BindlessTableMipFeedbackName = "m_mipFeedback";
+        static const char* BindlessTableMipFeedbackCapacityName = "m_mipFeedbackCapacity";
+
+        BindlessResourceTableInterface* BindlessResourceTableInterface::Get()
+        {
+            return Interface<BindlessResourceTableInterface>::Get();
+        }
+
+        void BindlessResourceTable::Init(const Data::Asset<ShaderAsset>& shaderAsset, const RHI::ShaderResourceGroupLayout* srgLayout, bool mipFeedbackEnabled)
+        {
+            Interface<BindlessResourceTableInterface>::Register(this);
+
+            if (!srgLayout)
+            {
+                return;
+            }
+
+            m_srg = ShaderResourceGroup::Create(shaderAsset, srgLayout->GetName());
+            if (!m_srg)
+            {
+                AZ_Error("BindlessResourceTable", false, "Failed to create the bindless shader resource group, bindless images are disabled.");
+                return;
+            }
+
+            m_texturesInputIndex = m_srg->FindShaderInputImageUnboundedArrayIndex(Name(BindlessTableTexturesName));
+            if (!m_texturesInputIndex.IsValid())
+            {
+                AZ_Error("BindlessResourceTable", false, "The bindless shader resource group has no '%s' array, bindless images are disabled.", BindlessTableTexturesName);
+                m_srg = nullptr;
+                return;
+            }
+
+            m_placeholderImageView = ImageSystemInterface::Get()->GetSystemImage(SystemImage::White)->GetImageView();
+
+            // The default index is never released, so it always reads the placeholder
+            ImageEntry& defaultEntry = m_images.emplace_back();
+            defaultEntry.m_imageView = m_placeholderImageView;
+            defaultEntry.m_referenceCount = 1;
+            m_isDirty = true;
+
+            InitMipFeedback(mipFeedbackEnabled);
+        }
+
+        void BindlessResourceTable::InitMipFeedback(bool mipFeedbackEnabled)
+        {
+            const RHI::ShaderInputBufferIndex mipFeedbackInputIndex = m_srg->FindShaderInputBufferIndex(Name(BindlessTableMipFeedbackName));
+            if (!mipFeedbackInputIndex.IsValid())
+            {
+                return;
+            }
+
+            const uint32_t capacity = mipFeedbackEnabled ? MipFeedbackCapacity : 0;
+
+            // Every entry starts unsampled, the MipFeedbackPass resets them to the same value every frame
+            AZStd::vector<uint32_t> initialData(AZStd::max(capacity, 1u), AZStd::numeric_limits<uint32_t>::max());
+
+            CommonBufferDescriptor desc;
+            desc.m_bufferName = "BindlessMipFeedback";
+            desc.m_poolType = CommonBufferPoolType::ReadWrite;
+            desc.m_elementFormat = RHI::Format::R32_UINT;
+            desc.m_byteCount = initialData.size() * sizeof(uint32_t);
+            desc.m_bufferData = initialData.data();
+            Data::Instance<Buffer> mipFeedbackBuffer = BufferSystemInterface::Get()->CreateBufferFromCommonPool(desc);
+            if (!mipFeedbackBuffer)
+            {
+                AZ_Error("BindlessResourceTable", false, "Failed to create the mip feedback buffer.");
+                return;
+            }
+
+            m_srg->SetBufferView(mipFeedbackInputIndex, mipFeedbackBuffer->GetBufferView());
+
+            const RHI::ShaderInputConstantIndex capacityInputIndex = m_srg->FindShaderInputConstantIndex(Name(BindlessTableMipFeedbackCapacityName));
+            if (capacityInputIndex.IsValid())
+            {
+                m_srg->SetConstant(capacityInputIndex, capacity);
+            }
+
+            if (mipFeedbackEnabled)
+            {
+                m_mipFeedbackBuffer = AZStd::move(mipFeedbackBuffer);
+            }
+            else
+            {
+                m_unusedMipFeedbackBuffer = AZStd::move(mipFeedbackBuffer);
+            }
+        }
+
+        void BindlessResourceTable::Shutdown()
+        {
+            if (Interface<BindlessResourceTableInterface>::Get() == this)
+            {
+                Interface<BindlessResourceTableInterface>::Unregister(this);
+            }
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            m_imageIndices.clear();
+            m_freeImageIndices.clear();
+            m_images.clear();
+            m_imageViewArray.clear();
+            m_placeholderImageView = nullptr;
+            m_mipFeedbackBuffer = nullptr;
+            m_unusedMipFeedbackBuffer = nullptr;
+            m_srg = nullptr;
+
+            AZStd::lock_guard<AZStd::mutex> mipFeedbackLock(m_mipFeedbackMutex);
+            m_mipFeedback = nullptr;
+            m_isDirty = false;
+        }
+
+        void BindlessResourceTable::Update()
+        {
+            if (!m_srg)
+            {
+                return;
+            }
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            if (!m_isDirty)
+            {
+                return;
+            }
+
+            m_imageViewArray.resize_no_construct(m_images.size());
+            for (size_t i = 0; i < m_images.size(); ++i)
+            {
+                m_imageViewArray[i] = m_images[i].m_imageView.get();
+            }
+
+            m_srg->SetImageViewUnboundedArray(m_texturesInputIndex, m_imageViewArray);
+            m_srg->Compile();
+            m_isDirty = false;
+        }
+
+        uint32_t BindlessResourceTable::AcquireImageIndex(const RHI::ImageView* imageView)
+        {
+            if (!m_srg || !imageView)
+            {
+                return DefaultImageIndex;
+            }
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            auto indexIter = m_imageIndices.find(imageView);
+            if (indexIter != m_imageIndices.end())
+            {
+                ++m_images[indexIter->second].m_referenceCount;
+                return indexIter->second;
+            }
+
+            uint32_t index = 0;
+            if (m_freeImageIndices.empty())
+            {
+                index = aznumeric_cast<uint32_t>(m_images.size());
+                m_images.emplace_back();
+            }
+            else
+            {
+                index = m_freeImageIndices.back();
+                m_freeImageIndices.pop_back();
+            }
+
+            ImageEntry& entry = m_images[index];
+            entry.m_imageView = imageView;
+            entry.m_referenceCount = 1;
+            m_imageIndices.emplace(imageView, index);
+            m_isDirty = true;
+            return index;
+        }
+
+        void BindlessResourceTable::ReleaseImageIndex(uint32_t index)
+        {
+            if (!m_srg || index == DefaultImageIndex)
+            {
+                return;
+            }
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            if (index >= m_images.size() || m_images[index].m_referenceCount == 0)
+            {
+                AZ_Assert(false, "Bindless image index %u was released more often than it was acquired.", index);
+                return;
+            }
+
+            ImageEntry& entry = m_images[index];
+            if (--entry.m_referenceCount == 0)
+            {
+                m_imageIndices.erase(entry.m_imageView.get());
+                // Released slots keep a valid descriptor in case a shader still reads them for a frame
+                entry.m_imageView = m_placeholderImageView;
+                m_freeImageIndices.push_back(index);
+                m_isDirty = true;
+            }
+        }
+
+        uint32_t BindlessResourceTable::FindImageIndex(const RHI::ImageView* imageView) const
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            auto indexIter = m_imageIndices.find(imageView);
+            return indexIter != m_imageIndices.end() ? indexIter->second : DefaultImageIndex;
+        }
+
+        bool BindlessResourceTable::IsEnabled() const
+        {
+            return m_srg != nullptr;
+        }
+
+        const RHI::ShaderResourceGroup* BindlessResourceTable::GetRHIShaderResourceGroup() const
+        {
+            return m_srg ? m_srg->GetRHIShaderResourceGroup() : nullptr;
+        }
+
+        Data::Instance<Buffer> BindlessResourceTable::GetMipFeedbackBuffer() const
+        {
+            return m_mipFeedbackBuffer;
+        }
+
+        void BindlessResourceTable::SetMipFeedback(const AZStd::shared_ptr<AZStd::vector<uint8_t>>& readbackData)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mipFeedbackMutex);
+            m_mipFeedback = readbackData;
+        }
+
+        uint16_t BindlessResourceTable::GetMipFeedback(uint32_t index) const
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mipFeedbackMutex);
+            if (!m_mipFeedback || (index + 1) * sizeof(uint32_t) > m_mipFeedback->size())
+            {
+                return RHI::Limits::Image::MipCountMax;
+            }
+
+            const uint32_t mipLevel = reinterpret_cast<const uint32_t*>(m_mipFeedback->data())[index];
+            return aznumeric_cast<uint16_t>(AZStd::min<uint32_t>(mipLevel, RHI::Limits::Image::MipCountMax));
+        }
+    }
+}
@@ -0,0 +1,314 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/Shader/PipelineStateWarmup.h>
+#include <Atom/RPI.Public/Shader/Shader.h>
+
+#include <Atom/RHI/CpuProfiler.h>
+#include <Atom/RHI/Factory.h>
+#include <Atom/RHI/PipelineStateDescriptor.h>
+
+#include <AtomCore/Instance/InstanceDatabase.h>
+
+#include <AzCore/Asset/AssetManager.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Serialization/Utils.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/thread.h>
+
+AZ_CVAR(bool, r_pipelineStateRecording, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+    "Records every new pipeline state acquired from a shader, the recorded manifest is saved to the user folder on shutdown.");
+AZ_CVAR(bool, r_pipelineStateWarmup, true, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+    "Compiles the pipeline states of the shipped and recorded manifests on background jobs once the RPI system assets are initialized.");
+
+namespace AZ
+{
+    namespace RPI
+    {
+        static constexpr char PipelineStateWarmupLog[] = "PipelineStateWarmup";
+
+        // The number of updates a pipeline state waits for its shader variant to load, before it gives up and is compiled
+        // with the variant that is available. The variant may not exist anymore if the shaders changed since it was recorded.
+        static constexpr uint32_t MaxVariantWaitUpdateCount = 600;
+
+        namespace
+        {
+            template<typename DescriptorType>
+            void StartCompileJob(Data::Instance<Shader> shader, const DescriptorType& descriptor, AZStd::atomic<uint32_t>& activeJobCount, const AZStd::atomic_bool& isShuttingDown)
+            {
+                ++activeJobCount;
+                const auto compileLambda = [shader, descriptor, &activeJobCount, &isShuttingDown]() mutable
+                {
+                    if (!isShuttingDown)
+                    {
+                        shader->AcquirePipelineState(descriptor);
+                    }
+                    // Release the shader before the job is reported as done, so Shutdown doesn't return while it's still referenced
+                    shader = nullptr;
+                    --activeJobCount;
+                };
+
+                AZ::Job* compileJob = AZ::CreateJobFunction(AZStd::move(compileLambda), true, nullptr); //auto-deletes
+                compileJob->Start();
+            }
+        }
+
+        PipelineStateWarmupInterface* PipelineStateWarmupInterface::Get()
+        {
+            return Interface<PipelineStateWarmupInterface>::Get();
+        }
+
+        void PipelineStateWarmup::Init()
+        {
+            m_isShuttingDown = false;
+            Interface<PipelineStateWarmupInterface>::Register(this);
+        }
+
+        void PipelineStateWarmup::Shutdown()
+        {
+            m_isShuttingDown = true;
+            m_pendingPipelineStates.clear();
+            while (m_activeJobCount > 0)
+            {
+                AZStd::this_thread::yield();
+            }
+
+            if (r_pipelineStateRecording)
+            {
+                SaveManifest();
+            }
+
+            if (Interface<PipelineStateWarmupInterface>::Get() == this)
+            {
+                Interface<PipelineStateWarmupInterface>::Unregister(this);
+            }
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_recordMutex);
+            m_recordedHashes.clear();
+            m_recordedManifest.m_pipelineStates.clear();
+        }
+
+        void PipelineStateWarmup::OnSystemAssetsInitialized()
+        {
+            if (r_pipelineStateWarmup)
+            {
+                StartWarmup();
+            }
+        }
+
+        void PipelineStateWarmup::Update()
+        {
+            if (m_pendingPipelineStates.empty())
+            {
+                return;
+            }
+
+            AZ_ATOM_PROFILE_FUNCTION("RPI", "PipelineStateWarmup: Update");
+
+            auto doneBegin = AZStd::remove_if(m_pendingPipelineStates.begin(), m_pendingPipelineStates.end(),
+                [this](PendingPipelineState& pendingPipelineState)
+                {
+                    return TryDispatchPipelineState(pendingPipelineState);
+                });
+            m_pendingPipelineStates.erase(doneBegin, m_pendingPipelineStates.end());
+        }
+
+        void PipelineStateWarmup::StartWarmup()
+        {
+            QueueManifest(GetShippedManifestPath());
+            QueueManifest(GetRecordedManifestPath());
+        }
+
+        bool PipelineStateWarmup::IsWarmingUp() const
+        {
+            return !m_pendingPipelineStates.empty() || m_activeJobCount > 0;
+        }
+
+        uint32_t PipelineStateWarmup::GetPendingPipelineStateCount() const
+        {
+            return aznumeric_cast<uint32_t>(m_pendingPipelineStates.size()) + m_activeJobCount;
+        }
+
+        bool PipelineStateWarmup::SaveManifest()
+        {
+            IO::FileIOBase* fileIOBase = IO::FileIOBase::GetInstance();
+            if (!fileIOBase)
+            {
+                AZ_Error(PipelineStateWarmupLog, false, "FileIOBase is not initialized");
+                return false;
+            }
+
+            const AZStd::string manifestPath = GetRecordedManifestPath();
+            char manifestPathResolved[AZ_MAX_PATH_LEN] = { 0 };
+            fileIOBase->ResolvePath(manifestPath.c_str(), manifestPathResolved, AZ_MAX_PATH_LEN);
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_recordMutex);
+            const bool saved = Utils::SaveObjectToFile(manifestPathResolved, DataStream::ST_XML, &m_recordedManifest);
+            AZ_Error(PipelineStateWarmupLog, saved, "Failed to save the pipeline state manifest to '%s'", manifestPathResolved);
+            return saved;
+        }
+
+        void PipelineStateWarmup::RecordPipelineState(const Shader& shader, const RHI::PipelineStateDescriptor& descriptor)
+        {
+            const RHI::PipelineStateType pipelineStateType = descriptor.GetType();
+            if (pipelineStateType != RHI::PipelineStateType::Draw && pipelineStateType != RHI::PipelineStateType::Dispatch)
+            {
+                return;
+            }
+
+            const HashValue64 hash = descriptor.GetHash();
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_recordMutex);
+                if (m_recordedHashes.find(hash) != m_recordedHashes.end())
+                {
+                    return;
+                }
+            }
+
+            const ShaderVariant* variant = shader.FindVariantForPipelineState(descriptor);
+            if (!variant)
+            {
+                // The descriptor wasn't configured by a variant of this shader, so it can't be built again from the manifest
+                return;
+            }
+
+            PipelineStateManifestEntry entry;
+            entry.m_shaderAssetId = shader.m_asset.GetId();
+            entry.m_supervariantName = shader.m_asset->GetSupervariantName(shader.m_supervariantIndex);
+            entry.m_shaderVariantId = variant->GetShaderVariantId();
+            entry.m_shaderVariantStableId = variant->GetStableId();
+
+            if (pipelineStateType == RHI::PipelineStateType::Draw)
+            {
+                const auto& descriptorForDraw = static_cast<const RHI::PipelineStateDescriptorForDraw&>(descriptor);
+                entry.m_inputStreamLayout = descriptorForDraw.m_inputStreamLayout;
+                entry.m_renderAttachmentConfiguration = descriptorForDraw.m_renderAttachmentConfiguration;
+                entry.m_renderStates = descriptorForDraw.m_renderStates;
+            }
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_recordMutex);
+            if (m_recordedHashes.emplace(hash).second)
+            {
+                m_recordedManifest.m_pipelineStates.emplace_back(AZStd::move(entry));
+            }
+        }
+
+        void PipelineStateWarmup::QueueManifest(const AZStd::string& manifestPath)
+        {
+            IO::FileIOBase* fileIOBase = IO::FileIOBase::GetInstance();
+            if (!fileIOBase || !fileIOBase->Exists(manifestPath.c_str()))
+            {
+                return;
+            }
+
+            PipelineStateManifest manifest;
+            if (!Utils::LoadObjectFromFileInPlace(manifestPath, manifest))
+            {
+                AZ_Warning(PipelineStateWarmupLog, false, "Failed to load the pipeline state manifest '%s'", manifestPath.c_str());
+                return;
+            }
+
+            m_pendingPipelineStates.reserve(m_pendingPipelineStates.size() + manifest.m_pipelineStates.size());
+            for (PipelineStateManifestEntry& entry : manifest.m_pipelineStates)
+            {
+                PendingPipelineState& pendingPipelineState = m_pendingPipelineStates.emplace_back();
+                // Queues the shader asset load, the pipeline state is dispatched in Update once it's ready
+                pendingPipelineState.m_shaderAsset = Data::AssetManager::Instance().GetAsset<ShaderAsset>(entry.m_shaderAssetId, Data::AssetLoadBehavior::PreLoad);
+                pendingPipelineState.m_entry = AZStd::move(entry);
+            }
+        }
+
+        bool PipelineStateWarmup::TryDispatchPipelineState(PendingPipelineState& pendingPipelineState)
+        {
+            const PipelineStateManifestEntry& entry = pendingPipelineState.m_entry;
+            Data::Asset<ShaderAsset>& shaderAsset = pendingPipelineState.m_shaderAsset;
+            if (!shaderAsset.GetId().IsValid() || shaderAsset.IsError())
+            {
+                // The shader doesn't exist anymore
+                return true;
+            }
+            if (!shaderAsset.IsReady())
+            {
+                return false;
+            }
+
+            if (!pendingPipelineState.m_shader)
+            {
+                const SupervariantIndex supervariantIndex = shaderAsset->GetSupervariantIndex(entry.m_supervariantName);
+                if (!supervariantIndex.IsValid())
+                {
+                    return true;
+                }
+
+                // Shader instances are shared between supervariants (see Shader::FindOrCreate), so a shader that is in use with
+                // another supervariant is skipped rather than switched to the recorded one.
+                Data::Instance<Shader> shader = Data::InstanceDatabase<Shader>::Instance().Find(Data::InstanceId::CreateFromAssetId(shaderAsset.GetId()));
+                if (!shader)
+                {
+                    shader = Shader::FindOrCreate(shaderAsset, entry.m_supervariantName);
+                }
+                if (!shader || shader->GetSupervariantIndex() != supervariantIndex)
+                {
+                    return true;
+                }
+                pendingPipelineState.m_shader = shader;
+            }
+
+            Shader& shader = *pendingPipelineState.m_shader;
+            const ShaderVariant* variant = &shader.GetRootVariant();
+            if (entry.m_shaderVariantStableId != ShaderAsset::RootShaderVariantStableId)
+            {
+                // GetVariant queues the load of the variant and returns the root variant until it's ready
+                const ShaderVariant& foundVariant = shader.GetVariant(entry.m_shaderVariantId);
+                if (foundVariant.IsRootVariant() && ++pendingPipelineState.m_waitedUpdateCount < MaxVariantWaitUpdateCount)
+                {
+                    return false;
+                }
+                variant = &foundVariant;
+            }
+
+            switch (shader.GetPipelineStateType())
+            {
+            case RHI::PipelineStateType::Draw:
+            {
+                RHI::PipelineStateDescriptorForDraw descriptor;
+                variant->ConfigurePipelineState(descriptor);
+                descriptor.m_inputStreamLayout = entry.m_inputStreamLayout;
+                descriptor.m_renderAttachmentConfiguration = entry.m_renderAttachmentConfiguration;
+                descriptor.m_renderStates = entry.m_renderStates;
+                StartCompileJob(pendingPipelineState.m_shader, descriptor, m_activeJobCount, m_isShuttingDown);
+                break;
+            }
+            case RHI::PipelineStateType::Dispatch:
+            {
+                RHI::PipelineStateDescriptorForDispatch descriptor;
+                variant->ConfigurePipelineState(descriptor);
+                StartCompileJob(pendingPipelineState.m_shader, descriptor, m_activeJobCount, m_isShuttingDown);
+                break;
+            }
+            default:
+                break;
+            }
+            return true;
+        }
+
+        AZStd::string PipelineStateWarmup::GetShippedManifestPath() const
+        {
+            return AZStd::string::format("@assets@/atom/pipelinestatemanifest/%s.xml", RHI::Factory::Get().GetName().GetCStr());
+        }
+
+        AZStd::string PipelineStateWarmup::GetRecordedManifestPath() const
+        {
+            return AZStd::string::format("@user@/Atom/PipelineStateManifest/%s.xml", RHI::Factory::Get().GetName().GetCStr());
+        }
+    }
+}
@@ -16,10 +16,14 @@
 
 #include <AtomCore/Instance/InstanceDatabase.h>
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Interface/Interface.h>
+#include <Atom/RPI.Public/Shader/PipelineStateWarmupInterface.h>
 #include <Atom/RPI.Public/Shader/ShaderSystemInterface.h>
 #include <Atom/RPI.Public/Shader/ShaderReloadDebugTracker.h>
 
+AZ_CVAR_EXTERNED(bool, r_pipelineStateRecording);
+
 namespace AZ
 {
     namespace RPI
@@ -295,10 +299,10 @@ namespace AZ
             return ShaderOptionGroup(m_asset->GetShaderOptionGroupLayout());
         }
 
-        const ShaderVariant& Shader::GetVariant(const ShaderVariantId& shaderVariantId)
+        const ShaderVariant& Shader::GetVariant(const ShaderVariantId& shaderVariantId, float loadPriority)
         {
             AZ_PROFILE_FUNCTION(Debug::ProfileCategory::AzRender);
-            Data::Asset<ShaderVariantAsset> shaderVariantAsset = m_asset->GetVariant(shaderVariantId, m_supervariantIndex);
+            Data::Asset<ShaderVariantAsset> shaderVariantAsset = m_asset->GetVariant(shaderVariantId, m_supervariantIndex, loadPriority);
             if (!shaderVariantAsset || shaderVariantAsset->IsRootVariant())
             {
                 return m_rootVariant;
@@ -401,9 +405,56 @@ namespace AZ
 
         const RHI::PipelineState* Shader::AcquirePipelineState(const RHI::PipelineStateDescriptor& descriptor) const
         {
+            if (r_pipelineStateRecording)
+            {
+                if (PipelineStateWarmupInterface* pipelineStateWarmup = PipelineStateWarmupInterface::Get())
+                {
+                    pipelineStateWarmup->RecordPipelineState(*this, descriptor);
+                }
+            }
+
             return m_pipelineStateCache->AcquirePipelineState(m_pipelineLibraryHandle, descriptor);
         }
 
+        const ShaderVariant* Shader::FindVariantForPipelineState(const RHI::PipelineStateDescriptor& descriptor) const
+        {
+            const RHI::ShaderStageFunction* stageFunction = nullptr;
+            RHI::ShaderStage stage = RHI::ShaderStage::Vertex;
+            switch (descriptor.GetType())
+            {
+            case RHI::PipelineStateType::Draw:
+                stageFunction = static_cast<const RHI::PipelineStateDescriptorForDraw&>(descriptor).m_vertexFunction.get();
+                stage = RHI::ShaderStage::Vertex;
+                break;
+            case RHI::PipelineStateType::Dispatch:
+                stageFunction = static_cast<const RHI::PipelineStateDescriptorForDispatch&>(descriptor).m_computeFunction.get();
+                stage = RHI::ShaderStage::Compute;
+                break;
+            default:
+                return nullptr;
+            }
+
+            if (!stageFunction)
+            {
+                return nullptr;
+            }
+
+            if (m_rootVariant.GetShaderVariantAsset()->GetShaderStageFunction(stage) == stageFunction)
+            {
+                return &m_rootVariant;
+            }
+
+            AZStd::shared_lock<decltype(m_variantCacheMutex)> lock(m_variantCacheMutex);
+            for (const auto& [stableId, variant] : m_shaderVariants)
+            {
+                if (variant.GetShaderVariantAsset()->GetShaderStageFunction(stage) == stageFunction)
+                {
+                    return &variant;
+                }
+            }
+            return nullptr;
+        }
+
         const RHI::Ptr<RHI::ShaderResourceGroupLayout>& Shader::FindShaderResourceGroupLayout(const Name& shaderResourceGroupName) const
         {
             return m_asset->FindShaderResourceGroupLayout(shaderResourceGroupName, m_supervariantIndex);
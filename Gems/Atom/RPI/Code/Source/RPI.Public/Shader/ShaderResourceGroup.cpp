@@ -114,6 +114,8 @@ namespace AZ
         void ShaderResourceGroup::Compile()
         {
             m_shaderResourceGroup->Compile(m_data);
+            // The RHI group holds a copy of the data, so the next compile only needs to upload what changes from now on.
+            m_data.ClearConstantDataDirtyInterval();
         }
 
         bool ShaderResourceGroup::IsQueuedForCompile() const
@@ -18,6 +18,8 @@
 #include <Atom/RPI.Reflect/Shader/ShaderVariantAsset.h>
 #include <Atom/RPI.Reflect/Shader/ShaderVariantTreeAsset.h>
 #include <Atom/RPI.Reflect/Shader/PrecompiledShaderAssetSourceData.h>
+#include <Atom/RPI.Reflect/Shader/PipelineStateManifest.h>
+#include <Atom/RPI.Reflect/Shader/ShaderVariantUsageManifest.h>
 
 #include <AtomCore/Instance/InstanceDatabase.h>
 
@@ -42,6 +44,8 @@ namespace AZ
             ShaderVariantTreeAsset::Reflect(context);
             ReflectShaderStageType(context);
             PrecompiledShaderAssetSourceData::Reflect(context);
+            PipelineStateManifest::Reflect(context);
+            ShaderVariantUsageManifest::Reflect(context);
         }
 
         ShaderSystemInterface* ShaderSystemInterface::Get()
@@ -9,16 +9,56 @@
 #include <Atom/RPI.Public/Shader/Metrics/ShaderMetricsSystem.h>
 
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Serialization/Utils.h>
+#include <AzCore/std/sort.h>
 
 #include <Atom/RHI/Factory.h>
 
+AZ_CVAR(uint32_t, r_shaderVariantLoadBudget, 64, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "The maximum number of shader variant loads the shader variant loader queues at once, the rest waits for the next iteration.");
+AZ_CVAR(uint32_t, r_shaderVariantLoaderRetryIntervalMs, 100, nullptr, AZ::ConsoleFunctorFlags::Null,
+    "The time in milliseconds the shader variant loader waits to retry the requests of assets that don't exist yet.");
+AZ_CVAR(bool, r_shaderVariantUsageRecording, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+    "Records the shader variants used by each level, the recorded manifest is saved to the user folder when the level is unloaded.");
+AZ_CVAR(bool, r_shaderVariantUsagePrefetch, true, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+    "Prefetches the shader variants of the shipped and recorded usage manifests of a level when it is loaded.");
+
 namespace AZ
 {
     namespace RPI
     {
+        namespace
+        {
+            template<typename Key>
+            void InsertWithHighestPriority(AZStd::unordered_map<Key, float>& pendingRequests, const Key& key, float priority)
+            {
+                auto insertResult = pendingRequests.emplace(key, priority);
+                if (!insertResult.second)
+                {
+                    insertResult.first->second = AZStd::max(insertResult.first->second, priority);
+                }
+            }
+
+            template<typename Key>
+            void SortByPriority(const AZStd::unordered_map<Key, float>& pendingRequests, AZStd::vector<AZStd::pair<Key, float>>& sortedRequests)
+            {
+                sortedRequests.assign(pendingRequests.begin(), pendingRequests.end());
+                AZStd::sort(sortedRequests.begin(), sortedRequests.end(),
+                    [](const AZStd::pair<Key, float>& lhs, const AZStd::pair<Key, float>& rhs)
+                    {
+                        return lhs.second > rhs.second;
+                    });
+            }
+        }
+
         void ShaderVariantAsyncLoader::Init()
         {
             m_isServiceShutdown.store(false);
+            AzFramework::RootSpawnableNotificationBus::Handler::BusConnect();
 
             AZStd::thread_desc threadDesc;
             threadDesc.m_name = "ShaderVariantAsyncLoader";
@@ -34,9 +74,15 @@ namespace AZ
 
         void ShaderVariantAsyncLoader::ThreadServiceLoop()
         {
-            AZStd::unordered_set<ShaderVariantAsyncLoader::TupleShaderAssetAndShaderVariantId> newShaderVariantPendingRequests;
-            AZStd::unordered_set<Data::AssetId> shaderVariantTreePendingRequests;
-            AZStd::unordered_set<Data::AssetId> shaderVariantPendingRequests;
+            // The pending requests, with the highest priority they were requested with.
+            AZStd::unordered_map<ShaderVariantAsyncLoader::TupleShaderAssetAndShaderVariantId, float> newShaderVariantPendingRequests;
+            AZStd::unordered_map<Data::AssetId, float> shaderVariantTreePendingRequests;
+            AZStd::unordered_map<Data::AssetId, float> shaderVariantPendingRequests;
+
+            // The pending requests sorted by priority, reused across iterations.
+            AZStd::vector<AZStd::pair<ShaderVariantAsyncLoader::TupleShaderAssetAndShaderVariantId, float>> sortedNewShaderVariantRequests;
+            AZStd::vector<AZStd::pair<Data::AssetId, float>> sortedAssetRequests;
+
             while (true)
             {
                 //We'll wait here until there's work to do or this service has been shutdown.
@@ -64,89 +110,113 @@ namespace AZ
                     //Move pending requests to the local lists.
                     AZStd::unique_lock<decltype(m_mutex)> lock(m_mutex);
 
-                    AZStd::for_each(
-                        m_newShaderVariantPendingRequests.begin(), m_newShaderVariantPendingRequests.end(),
-                        [&](const ShaderVariantAsyncLoader::TupleShaderAssetAndShaderVariantId& tuple) {
-                            newShaderVariantPendingRequests.insert(tuple);
-                        });
+                    for (const ShaderVariantAsyncLoader::TupleShaderAssetAndShaderVariantId& tuple : m_newShaderVariantPendingRequests)
+                    {
+                        InsertWithHighestPriority(newShaderVariantPendingRequests, tuple, tuple.m_priority);
+                    }
                     m_newShaderVariantPendingRequests.clear();
 
-                    AZStd::for_each(m_shaderVariantTreePendingRequests.begin(), m_shaderVariantTreePendingRequests.end(),
-                        [&](const Data::AssetId& assetId)
-                        {
-                            shaderVariantTreePendingRequests.insert(assetId);
-                        });
+                    for (const Data::AssetId& assetId : m_shaderVariantTreePendingRequests)
+                    {
+                        InsertWithHighestPriority(shaderVariantTreePendingRequests, assetId, IShaderVariantFinder::DefaultLoadPriority);
+                    }
                     m_shaderVariantTreePendingRequests.clear();
 
-                    AZStd::for_each(m_shaderVariantPendingRequests.begin(), m_shaderVariantPendingRequests.end(),
-                        [&](const Data::AssetId& assetId)
-                        {
-                            shaderVariantPendingRequests.insert(assetId);
-                        });
+                    for (const Data::AssetId& assetId : m_shaderVariantPendingRequests)
+                    {
+                        InsertWithHighestPriority(shaderVariantPendingRequests, assetId, IShaderVariantFinder::DefaultLoadPriority);
+                    }
                     m_shaderVariantPendingRequests.clear();
                 }
 
                 // Time to work hard.
-                auto tupleItor = newShaderVariantPendingRequests.begin();
-                while (tupleItor != newShaderVariantPendingRequests.end())
+                SortByPriority(newShaderVariantPendingRequests, sortedNewShaderVariantRequests);
+                for (const auto& [tuple, priority] : sortedNewShaderVariantRequests)
                 {
-                    auto shaderVariantTreeAsset = GetShaderVariantTreeAsset(tupleItor->m_shaderAsset.GetId());
+                    if (!tuple.m_shaderAsset.IsReady())
+                    {
+                        // Requests from usage manifests can be queued before the shader asset is loaded.
+                        if (!tuple.m_shaderAsset.GetId().IsValid() || tuple.m_shaderAsset.IsError())
+                        {
+                            newShaderVariantPendingRequests.erase(tuple);
+                        }
+                        continue;
+                    }
+
+                    auto shaderVariantTreeAsset = GetShaderVariantTreeAsset(tuple.m_shaderAsset.GetId());
                     if (shaderVariantTreeAsset)
                     {
                         AZ_Assert(shaderVariantTreeAsset.IsReady(), "shaderVariantTreeAsset is not ready!");
+                        newShaderVariantPendingRequests.erase(tuple);
+
                         // Get the stableId from the variant tree.
                         auto searchResult = shaderVariantTreeAsset->FindVariantStableId(
-                            tupleItor->m_shaderAsset->GetShaderOptionGroupLayout(), tupleItor->m_shaderVariantId);
+                            tuple.m_shaderAsset->GetShaderOptionGroupLayout(), tuple.m_shaderVariantId);
                         if (searchResult.IsRoot())
                         {
-                            tupleItor = newShaderVariantPendingRequests.erase(tupleItor);
+                            continue;
+                        }
+
+                        if (priority <= IShaderVariantFinder::PrefetchLoadPriority &&
+                            GetShaderVariantAsset(shaderVariantTreeAsset.GetId(), searchResult.GetStableId(), tuple.m_supervariantIndex))
+                        {
+                            // A prefetched variant that is loaded already doesn't need to notify anyone.
                             continue;
                         }
 
                         // Record the request for metrics.
-                        ShaderMetricsSystem::Get()->RequestShaderVariant(tupleItor->m_shaderAsset.Get(),  tupleItor->m_shaderVariantId, searchResult);
+                        ShaderMetricsSystem::Get()->RequestShaderVariant(tuple.m_shaderAsset.Get(), tuple.m_shaderVariantId, searchResult);
 
                         uint32_t shaderVariantProductSubId = ShaderVariantAsset::MakeAssetProductSubId(
-                            RHI::Factory::Get().GetAPIUniqueIndex(), tupleItor->m_supervariantIndex.GetIndex(), searchResult.GetStableId());
+                            RHI::Factory::Get().GetAPIUniqueIndex(), tuple.m_supervariantIndex.GetIndex(), searchResult.GetStableId());
                         Data::AssetId shaderVariantAssetId(shaderVariantTreeAsset.GetId().m_guid, shaderVariantProductSubId);
-                        shaderVariantPendingRequests.insert(shaderVariantAssetId);
-                        tupleItor = newShaderVariantPendingRequests.erase(tupleItor);
+                        InsertWithHighestPriority(shaderVariantPendingRequests, shaderVariantAssetId, priority);
                         continue;
                     }
                     // If we are here the shaderVariantTreeAsset is not ready, but maybe it is already queued for loading,
                     // but we try to queue it anyways.
-                    QueueShaderVariantTreeForLoading(*tupleItor, shaderVariantTreePendingRequests);
-                    tupleItor++;
+                    QueueShaderVariantTreeForLoading(tuple, priority, shaderVariantTreePendingRequests);
                 }
 
-
-                auto variantTreeItor = shaderVariantTreePendingRequests.begin();
-                while (variantTreeItor != shaderVariantTreePendingRequests.end())
+                SortByPriority(shaderVariantTreePendingRequests, sortedAssetRequests);
+                for (const auto& request : sortedAssetRequests)
                 {
-                    if (TryToLoadShaderVariantTreeAsset(*variantTreeItor))
-                    {
-                        variantTreeItor = shaderVariantTreePendingRequests.erase(variantTreeItor);
-                    }
-                    else
+                    if (TryToLoadShaderVariantTreeAsset(request.first))
                     {
-                        variantTreeItor++;
+                        shaderVariantTreePendingRequests.erase(request.first);
                     }
                 }
 
-                auto variantItor = shaderVariantPendingRequests.begin();
-                while (variantItor != shaderVariantPendingRequests.end())
+                // The number of variant loads queued per iteration is limited, so the requests with a high priority that
+                // come in later are queued before the remaining ones.
+                uint32_t remainingLoadBudget = AZStd::max<uint32_t>(r_shaderVariantLoadBudget, 1u);
+                SortByPriority(shaderVariantPendingRequests, sortedAssetRequests);
+                for (const auto& request : sortedAssetRequests)
                 {
-                    if (TryToLoadShaderVariantAsset(*variantItor))
+                    if (remainingLoadBudget == 0)
                     {
-                        variantItor = shaderVariantPendingRequests.erase(variantItor);
+                        break;
                     }
-                    else
+                    if (TryToLoadShaderVariantAsset(request.first))
                     {
-                        variantItor++;
+                        shaderVariantPendingRequests.erase(request.first);
+                        --remainingLoadBudget;
                     }
                 }
 
-                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1000));
+                if (remainingLoadBudget > 0)
+                {
+                    // What's left waits for assets that don't exist yet. Retry after a while, unless new requests come in.
+                    AZStd::unique_lock<decltype(m_mutex)> lock(m_mutex);
+                    m_workCondition.wait_for(lock, AZStd::chrono::milliseconds(static_cast<uint32_t>(r_shaderVariantLoaderRetryIntervalMs)), [&]
+                        {
+                            return m_isServiceShutdown.load() ||
+                                !m_newShaderVariantPendingRequests.empty() ||
+                                !m_shaderVariantTreePendingRequests.empty() ||
+                                !m_shaderVariantPendingRequests.empty();
+                        }
+                    );
+                }
             }
         }
 
@@ -165,6 +235,10 @@ namespace AZ
             m_workCondition.notify_one();
             m_serviceThread.join();
             Data::AssetBus::MultiHandler::BusDisconnect();
+            AzFramework::RootSpawnableNotificationBus::Handler::BusDisconnect();
+
+            SaveRecordedManifest();
+            m_levelName.clear();
 
             m_newShaderVariantPendingRequests.clear();
             m_shaderVariantTreePendingRequests.clear();
@@ -177,7 +251,8 @@ namespace AZ
         ///////////////////////////////////////////////////////////////////
         // IShaderVariantFinder overrides
         bool ShaderVariantAsyncLoader::QueueLoadShaderVariantAssetByVariantId(
-            Data::Asset<ShaderAsset> shaderAsset, const ShaderVariantId& shaderVariantId, SupervariantIndex supervariantIndex)
+            Data::Asset<ShaderAsset> shaderAsset, const ShaderVariantId& shaderVariantId, SupervariantIndex supervariantIndex,
+            float priority)
         {
             if (m_isServiceShutdown.load())
             {
@@ -186,7 +261,7 @@ namespace AZ
 
             {
                 AZStd::unique_lock<decltype(m_mutex)> lock(m_mutex);
-                TupleShaderAssetAndShaderVariantId tuple = {shaderAsset, shaderVariantId, supervariantIndex};
+                TupleShaderAssetAndShaderVariantId tuple = {shaderAsset, shaderVariantId, supervariantIndex, priority};
                 m_newShaderVariantPendingRequests.push_back(tuple);
             }
             m_workCondition.notify_one();
@@ -248,6 +323,7 @@ namespace AZ
 
             // Record the request for metrics.
             ShaderMetricsSystem::Get()->RequestShaderVariant(shaderAsset.Get(), shaderVariantId, searchResult);
+            RecordShaderVariantUsage(shaderAsset, shaderVariantId, supervariantIndex);
 
             return GetShaderVariantAsset(shaderVariantTreeAsset.GetId(), searchResult.GetStableId(), supervariantIndex);
         }
@@ -499,20 +575,22 @@ namespace AZ
 
 
         void ShaderVariantAsyncLoader::QueueShaderVariantTreeForLoading(
-            const TupleShaderAssetAndShaderVariantId& shaderAndVariantTuple,
-            AZStd::unordered_set<Data::AssetId>& shaderVariantTreePendingRequests)
+            const TupleShaderAssetAndShaderVariantId& shaderAndVariantTuple, float priority,
+            AZStd::unordered_map<Data::AssetId, float>& shaderVariantTreePendingRequests)
         {
             auto shaderAssetId = shaderAndVariantTuple.m_shaderAsset.GetId();
-            if (shaderVariantTreePendingRequests.count(shaderAndVariantTuple.m_shaderAsset.GetId()))
+            auto pendingRequestIt = shaderVariantTreePendingRequests.find(shaderAssetId);
+            if (pendingRequestIt != shaderVariantTreePendingRequests.end())
             {
                 // Already queued.
+                pendingRequestIt->second = AZStd::max(pendingRequestIt->second, priority);
                 return;
             }
 
             Data::AssetId shaderVariantTreeAssetId = ShaderVariantTreeAsset::GetShaderVariantTreeAssetIdFromShaderAssetId(shaderAssetId);
             if (!shaderVariantTreeAssetId.IsValid())
             {
-                shaderVariantTreePendingRequests.insert(shaderAssetId);
+                shaderVariantTreePendingRequests.emplace(shaderAssetId, priority);
                 return;
             }
 
@@ -525,7 +603,7 @@ namespace AZ
                     return;
                 }
             }
-            shaderVariantTreePendingRequests.insert(shaderAssetId);
+            shaderVariantTreePendingRequests.emplace(shaderAssetId, priority);
         }
 
         bool ShaderVariantAsyncLoader::TryToLoadShaderVariantTreeAsset(const Data::AssetId& shaderAssetId)
@@ -672,5 +750,103 @@ namespace AZ
             return true;
         }
 
+        void ShaderVariantAsyncLoader::OnRootSpawnableAssigned(AZ::Data::Asset<AzFramework::Spawnable> rootSpawnable, [[maybe_unused]] uint32_t generation)
+        {
+            // The root spawnable can be assigned again without being released in between.
+            SaveRecordedManifest();
+
+            m_levelName = AZ::IO::PathView(rootSpawnable.GetHint()).Stem().Native();
+            if (m_levelName.empty() || !r_shaderVariantUsagePrefetch)
+            {
+                return;
+            }
+
+            QueueManifest(GetShippedManifestPath());
+            QueueManifest(GetRecordedManifestPath());
+        }
+
+        void ShaderVariantAsyncLoader::OnRootSpawnableReleased([[maybe_unused]] uint32_t generation)
+        {
+            SaveRecordedManifest();
+            m_levelName.clear();
+        }
+
+        void ShaderVariantAsyncLoader::RecordShaderVariantUsage(
+            const Data::Asset<ShaderAsset>& shaderAsset, const ShaderVariantId& shaderVariantId, SupervariantIndex supervariantIndex)
+        {
+            if (!r_shaderVariantUsageRecording)
+            {
+                return;
+            }
+
+            const TupleShaderAssetAndShaderVariantId tuple = {shaderAsset, shaderVariantId, supervariantIndex};
+            const size_t hash = AZStd::hash<TupleShaderAssetAndShaderVariantId>()(tuple);
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_recordMutex);
+            if (m_recordedHashes.emplace(hash).second)
+            {
+                ShaderVariantUsageManifestEntry& entry = m_recordedManifest.m_shaderVariants.emplace_back();
+                entry.m_shaderAssetId = shaderAsset.GetId();
+                entry.m_supervariantIndex = supervariantIndex.GetIndex();
+                entry.m_shaderVariantId = shaderVariantId;
+            }
+        }
+
+        void ShaderVariantAsyncLoader::QueueManifest(const AZStd::string& manifestPath)
+        {
+            IO::FileIOBase* fileIOBase = IO::FileIOBase::GetInstance();
+            if (!fileIOBase || !fileIOBase->Exists(manifestPath.c_str()))
+            {
+                return;
+            }
+
+            ShaderVariantUsageManifest manifest;
+            if (!Utils::LoadObjectFromFileInPlace(manifestPath, manifest))
+            {
+                AZ_Warning(LogName, false, "Failed to load the shader variant usage manifest '%s'", manifestPath.c_str());
+                return;
+            }
+
+            for (const ShaderVariantUsageManifestEntry& entry : manifest.m_shaderVariants)
+            {
+                // The service thread waits for the shader asset to be ready before it looks for the variant.
+                Data::Asset<ShaderAsset> shaderAsset =
+                    Data::AssetManager::Instance().GetAsset<ShaderAsset>(entry.m_shaderAssetId, Data::AssetLoadBehavior::QueueLoad);
+                QueueLoadShaderVariantAssetByVariantId(
+                    shaderAsset, entry.m_shaderVariantId, SupervariantIndex{entry.m_supervariantIndex}, IShaderVariantFinder::PrefetchLoadPriority);
+            }
+        }
+
+        void ShaderVariantAsyncLoader::SaveRecordedManifest()
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_recordMutex);
+            if (r_shaderVariantUsageRecording && !m_levelName.empty() && !m_recordedManifest.m_shaderVariants.empty())
+            {
+                IO::FileIOBase* fileIOBase = IO::FileIOBase::GetInstance();
+                if (fileIOBase)
+                {
+                    const AZStd::string manifestPath = GetRecordedManifestPath();
+                    char manifestPathResolved[AZ_MAX_PATH_LEN] = { 0 };
+                    fileIOBase->ResolvePath(manifestPath.c_str(), manifestPathResolved, AZ_MAX_PATH_LEN);
+
+                    const bool saved = Utils::SaveObjectToFile(manifestPathResolved, DataStream::ST_XML, &m_recordedManifest);
+                    AZ_Error(LogName, saved, "Failed to save the shader variant usage manifest to '%s'", manifestPathResolved);
+                }
+            }
+
+            m_recordedHashes.clear();
+            m_recordedManifest.m_shaderVariants.clear();
+        }
+
+        AZStd::string ShaderVariantAsyncLoader::GetShippedManifestPath() const
+        {
+            return AZStd::string::format("@assets@/atom/shadervariantusage/%s.xml", m_levelName.c_str());
+        }
+
+        AZStd::string ShaderVariantAsyncLoader::GetRecordedManifestPath() const
+        {
+            return AZStd::string::format("@user@/Atom/ShaderVariantUsage/%s.xml", m_levelName.c_str());
+        }
+
     } // namespace RPI
 } // namespace AZ
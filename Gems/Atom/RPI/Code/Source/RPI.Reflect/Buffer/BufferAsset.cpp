@@ -26,7 +26,7 @@ namespace AZ
             if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
             {
                 serializeContext->Class<BufferAsset>()
-                    ->Version(2)
+                    ->Version(3) // Added CommonBufferPoolType::Indirect
                     ->Field("Name", &BufferAsset::m_name)
                     ->Field("Buffer", &BufferAsset::m_buffer)
                     ->Field("BufferDescriptor", &BufferAsset::m_bufferDescriptor)
@@ -43,6 +43,7 @@ namespace AZ
                     ->Value("ReadBack", CommonBufferPoolType::ReadBack)
                     ->Value("ReadWrite", CommonBufferPoolType::ReadWrite)
                     ->Value("ReadOnly", CommonBufferPoolType::ReadOnly)
+                    ->Value("Indirect", CommonBufferPoolType::Indirect)
                     ->Value("Invalid", CommonBufferPoolType::Invalid)
                     ;
             }
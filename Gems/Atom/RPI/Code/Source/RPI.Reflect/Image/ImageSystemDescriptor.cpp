@@ -24,6 +24,7 @@ namespace AZ
                     ->Field("AssetStreamingImagePoolSize", &ImageSystemDescriptor::m_assetStreamingImagePoolSize)
                     ->Field("SystemStreamingImagePoolSize", &ImageSystemDescriptor::m_systemStreamingImagePoolSize)
                     ->Field("SystemAttachmentImagePoolSize", &ImageSystemDescriptor::m_systemAttachmentImagePoolSize)
+                    ->Field("UseMipFeedbackStreaming", &ImageSystemDescriptor::m_useMipFeedbackStreaming)
                     ;
 
                 if (AZ::EditContext* ec = serializeContext->GetEditContext())
@@ -38,6 +39,8 @@ namespace AZ
                             "System streaming image pool size", "Streaming image pool size in bytes for streaming images created in memory")
                         ->DataElement(AZ::Edit::UIHandlers::Default, &ImageSystemDescriptor::m_systemAttachmentImagePoolSize,
                             "System attachment image pool size", "Default attachment image pool size in bytes")
+                        ->DataElement(AZ::Edit::UIHandlers::Default, &ImageSystemDescriptor::m_useMipFeedbackStreaming,
+                            "Use mip feedback streaming", "Stream the asset images from the mip levels sampled by the GPU")
                         ;
                 }
             }
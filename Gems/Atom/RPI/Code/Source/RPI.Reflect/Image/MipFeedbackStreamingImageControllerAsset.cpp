@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Reflect/Image/MipFeedbackStreamingImageControllerAsset.h>
+#include <AzCore/Serialization/SerializeContext.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        const Data::AssetId MipFeedbackStreamingImageControllerAsset::BuiltInAssetId("{4F6C2E91-A83B-4D57-B0E2-97C5D1A36F48}");
+
+        MipFeedbackStreamingImageControllerAsset::MipFeedbackStreamingImageControllerAsset()
+        {
+            m_status = AssetStatus::Ready;
+        }
+
+        void MipFeedbackStreamingImageControllerAsset::Reflect(ReflectContext* context)
+        {
+            if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
+            {
+                serializeContext->Class<MipFeedbackStreamingImageControllerAsset, StreamingImageControllerAsset>()
+                    ->Version(0)
+                    ->Field("MemoryBudgetInBytes", &MipFeedbackStreamingImageControllerAsset::m_memoryBudgetInBytes)
+                    ->Field("MaxExpandsPerUpdate", &MipFeedbackStreamingImageControllerAsset::m_maxExpandsPerUpdate)
+                    ->Field("RequestLifetimeInUpdates", &MipFeedbackStreamingImageControllerAsset::m_requestLifetimeInUpdates)
+                    ;
+            }
+        }
+    }
+}
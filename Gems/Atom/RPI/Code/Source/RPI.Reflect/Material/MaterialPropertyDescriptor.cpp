@@ -23,6 +23,7 @@ namespace AZ
             {
             case MaterialPropertyOutputType::ShaderInput:  return "ShaderInput";
             case MaterialPropertyOutputType::ShaderOption: return "ShaderOption";
+            case MaterialPropertyOutputType::ShaderInputBindlessIndex: return "ShaderInputBindlessIndex";
             default:
                 AZ_Assert(false, "Unhandled type");
                 return "<Unknown>";
@@ -118,6 +119,7 @@ namespace AZ
                 serializeContext->Enum<MaterialPropertyOutputType>()
                     ->Value(ToString(MaterialPropertyOutputType::ShaderInput), MaterialPropertyOutputType::ShaderInput)
                     ->Value(ToString(MaterialPropertyOutputType::ShaderOption), MaterialPropertyOutputType::ShaderOption)
+                    ->Value(ToString(MaterialPropertyOutputType::ShaderInputBindlessIndex), MaterialPropertyOutputType::ShaderInputBindlessIndex)
                     ;
 
                 serializeContext->Enum<MaterialPropertyDataType>()
@@ -319,6 +319,38 @@ namespace AZ
             m_wipMaterialProperty.m_outputConnections.push_back(outputId);
         }
 
+        void MaterialTypeAssetCreator::ConnectMaterialPropertyToBindlessImageIndex(const Name& shaderInputName)
+        {
+            if (!ValidateBeginMaterialProperty())
+            {
+                return;
+            }
+
+            if (!m_materialShaderResourceGroupLayout)
+            {
+                ReportError("Material property '%s': Could not map this property to shader input '%s' because there is no material ShaderResourceGroup.",
+                    m_wipMaterialProperty.GetName().GetCStr(), shaderInputName.GetCStr());
+                return;
+            }
+
+            if (m_wipMaterialProperty.GetDataType() != MaterialPropertyDataType::Image)
+            {
+                ReportError("Material property '%s': Only image properties can be mapped to a bindless image index.", m_wipMaterialProperty.GetName().GetCStr());
+                return;
+            }
+
+            MaterialPropertyOutputId outputId;
+            outputId.m_type = MaterialPropertyOutputType::ShaderInputBindlessIndex;
+            outputId.m_itemIndex = RHI::Handle<uint32_t>{m_materialShaderResourceGroupLayout->FindShaderInputConstantIndex(shaderInputName).GetIndex()};
+            if (outputId.m_itemIndex.IsNull())
+            {
+                ReportError("Material property '%s': Could not find shader constant input '%s'.", m_wipMaterialProperty.GetName().GetCStr(), shaderInputName.GetCStr());
+                return;
+            }
+
+            m_wipMaterialProperty.m_outputConnections.push_back(outputId);
+        }
+
         void MaterialTypeAssetCreator::ConnectMaterialPropertyToShaderOption(const Name& shaderOptionName, uint32_t shaderIndex)
         {
             if (!ValidateBeginMaterialProperty())
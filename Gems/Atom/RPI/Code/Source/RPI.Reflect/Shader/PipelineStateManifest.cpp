@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Reflect/Shader/PipelineStateManifest.h>
+#include <AzCore/Serialization/SerializeContext.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        void PipelineStateManifestEntry::Reflect(ReflectContext* context)
+        {
+            if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
+            {
+                serializeContext->Class<PipelineStateManifestEntry>()
+                    ->Version(0)
+                    ->Field("shaderAssetId", &PipelineStateManifestEntry::m_shaderAssetId)
+                    ->Field("supervariantName", &PipelineStateManifestEntry::m_supervariantName)
+                    ->Field("shaderVariantId", &PipelineStateManifestEntry::m_shaderVariantId)
+                    ->Field("shaderVariantStableId", &PipelineStateManifestEntry::m_shaderVariantStableId)
+                    ->Field("inputStreamLayout", &PipelineStateManifestEntry::m_inputStreamLayout)
+                    ->Field("renderAttachmentConfiguration", &PipelineStateManifestEntry::m_renderAttachmentConfiguration)
+                    ->Field("renderStates", &PipelineStateManifestEntry::m_renderStates)
+                    ;
+            }
+        }
+
+        void PipelineStateManifest::Reflect(ReflectContext* context)
+        {
+            PipelineStateManifestEntry::Reflect(context);
+
+            if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
+            {
+                serializeContext->Class<PipelineStateManifest>()
+                    ->Version(0)
+                    ->Field("pipelineStates", &PipelineStateManifest::m_pipelineStates)
+                    ;
+            }
+        }
+    } // namespace RPI
+} // namespace AZ
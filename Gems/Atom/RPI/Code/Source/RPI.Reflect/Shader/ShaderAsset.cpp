@@ -169,8 +169,14 @@ namespace AZ
             return supervariantIndex;
         }
 
+        const Name& ShaderAsset::GetSupervariantName(SupervariantIndex supervariantIndex) const
+        {
+            auto supervariant = GetSupervariant(supervariantIndex);
+            return supervariant->m_name;
+        }
+
         Data::Asset<ShaderVariantAsset> ShaderAsset::GetVariant(
-            const ShaderVariantId& shaderVariantId, SupervariantIndex supervariantIndex)
+            const ShaderVariantId& shaderVariantId, SupervariantIndex supervariantIndex, float loadPriority)
         {
             AZ_PROFILE_FUNCTION(Debug::ProfileCategory::AzRender);
 
@@ -182,11 +188,27 @@ namespace AZ
                 variantFinder->GetShaderVariantAssetByVariantId(thisAsset, shaderVariantId, supervariantIndex);
             if (!shaderVariantAsset)
             {
-                variantFinder->QueueLoadShaderVariantAssetByVariantId(thisAsset, shaderVariantId, supervariantIndex);
+                variantFinder->QueueLoadShaderVariantAssetByVariantId(thisAsset, shaderVariantId, supervariantIndex, loadPriority);
             }
             return shaderVariantAsset;
         }
 
+        void ShaderAsset::PrefetchVariant(const ShaderVariantId& shaderVariantId, SupervariantIndex supervariantIndex)
+        {
+            if (GetShaderOptionGroupLayout()->GetShaderOptions().empty())
+            {
+                // Only the root variant exists.
+                return;
+            }
+
+            auto variantFinder = AZ::Interface<IShaderVariantFinder>::Get();
+            AZ_Assert(variantFinder, "The IShaderVariantFinder doesn't exist");
+
+            Data::Asset<ShaderAsset> thisAsset(this, Data::AssetLoadBehavior::Default);
+            variantFinder->QueueLoadShaderVariantAssetByVariantId(
+                thisAsset, shaderVariantId, supervariantIndex, IShaderVariantFinder::PrefetchLoadPriority);
+        }
+
         ShaderVariantSearchResult ShaderAsset::FindVariantStableId(const ShaderVariantId& shaderVariantId)
         {
             AZ_PROFILE_FUNCTION(Debug::ProfileCategory::AzRender);
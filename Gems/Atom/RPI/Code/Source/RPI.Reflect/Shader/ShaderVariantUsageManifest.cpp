@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Reflect/Shader/ShaderVariantUsageManifest.h>
+#include <AzCore/Serialization/SerializeContext.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        void ShaderVariantUsageManifestEntry::Reflect(ReflectContext* context)
+        {
+            if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
+            {
+                serializeContext->Class<ShaderVariantUsageManifestEntry>()
+                    ->Version(0)
+                    ->Field("shaderAssetId", &ShaderVariantUsageManifestEntry::m_shaderAssetId)
+                    ->Field("supervariantIndex", &ShaderVariantUsageManifestEntry::m_supervariantIndex)
+                    ->Field("shaderVariantId", &ShaderVariantUsageManifestEntry::m_shaderVariantId)
+                    ;
+            }
+        }
+
+        void ShaderVariantUsageManifest::Reflect(ReflectContext* context)
+        {
+            ShaderVariantUsageManifestEntry::Reflect(context);
+
+            if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
+            {
+                serializeContext->Class<ShaderVariantUsageManifest>()
+                    ->Version(0)
+                    ->Field("shaderVariants", &ShaderVariantUsageManifest::m_shaderVariants)
+                    ;
+            }
+        }
+    } // namespace RPI
+} // namespace AZ
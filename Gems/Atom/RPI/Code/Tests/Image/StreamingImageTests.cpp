@@ -16,6 +16,7 @@
 #include <Atom/RPI.Reflect/Image/StreamingImagePoolAsset.h>
 #include <Atom/RPI.Reflect/Image/StreamingImagePoolAssetCreator.h>
 #include <Atom/RPI.Reflect/Image/DefaultStreamingImageControllerAsset.h>
+#include <Atom/RPI.Reflect/Image/MipFeedbackStreamingImageControllerAsset.h>
 #include <Atom/RPI.Reflect/Asset/BuiltInAssetHandler.h>
 
 #include <Atom/RPI.Public/Image/ImageSystemInterface.h>
@@ -409,7 +410,8 @@ namespace UnitTest
             return asset;
         }
 
-        AZ::Data::Asset<AZ::RPI::StreamingImagePoolAsset> BuildImagePoolAsset(size_t budgetInBytes)
+        AZ::Data::Asset<AZ::RPI::StreamingImagePoolAsset> BuildImagePoolAsset(
+            size_t budgetInBytes, const AZ::Data::Asset<AZ::RPI::StreamingImageControllerAsset>& controllerAsset = {})
         {
             using namespace AZ;
 
@@ -419,11 +421,18 @@ namespace UnitTest
 
             assetCreator.SetPoolDescriptor(AZStd::make_unique<TestStreamingImagePoolDescriptor>(budgetInBytes));
 
-            assetCreator.SetControllerAsset(
-                Data::AssetManager::Instance().GetAsset<RPI::DefaultStreamingImageControllerAsset>(
-                    m_testControllerAssetId,
-                    Data::AssetLoadBehavior::PreLoad)
-            );
+            if (controllerAsset)
+            {
+                assetCreator.SetControllerAsset(controllerAsset);
+            }
+            else
+            {
+                assetCreator.SetControllerAsset(
+                    Data::AssetManager::Instance().GetAsset<RPI::DefaultStreamingImageControllerAsset>(
+                        m_testControllerAssetId,
+                        Data::AssetLoadBehavior::PreLoad)
+                );
+            }
 
             Data::Asset<RPI::StreamingImagePoolAsset> poolAsset;
             EXPECT_TRUE(assetCreator.End(poolAsset));
@@ -433,7 +442,7 @@ namespace UnitTest
             return poolAsset;
         }
 
-        AZ::Data::Asset<AZ::RPI::StreamingImageAsset> BuildTestImage()
+        AZ::Data::Asset<AZ::RPI::StreamingImageAsset> BuildTestImage(const AZ::RPI::StreamingImagePool* pool = nullptr)
         {
             using namespace AZ;
 
@@ -460,7 +469,7 @@ namespace UnitTest
             assetCreator.AddMipChainAsset(*mipHead.Get());
             assetCreator.AddMipChainAsset(*mipMiddle.Get());
             assetCreator.AddMipChainAsset(*mipTail.Get());
-            assetCreator.SetPoolAssetId(m_defaultPool->GetAssetId());
+            assetCreator.SetPoolAssetId(pool ? pool->GetAssetId() : m_defaultPool->GetAssetId());
 
             Data::Asset<RPI::StreamingImageAsset> imageAsset;
             EXPECT_TRUE(assetCreator.End(imageAsset));
@@ -706,6 +715,53 @@ namespace UnitTest
         ValidateImageResidency(imageInstance.get(), imageAsset.Get());
     }
 
+    TEST_F(StreamingImageTests, MipFeedbackControllerStreamsRequestedMipsWithinBudget)
+    {
+        using namespace AZ;
+
+        // The test image has mip chains of 1, 2 and 3 mips, the tail alone uses 672 bytes, the middle chain 10912 bytes
+        // with the tail and the full image 43680 bytes. The budget fits one image at the middle chain, not two.
+        Data::Asset<RPI::MipFeedbackStreamingImageControllerAsset> controllerAsset =
+            Data::AssetManager::Instance().GetAsset<RPI::MipFeedbackStreamingImageControllerAsset>(
+                RPI::MipFeedbackStreamingImageControllerAsset::BuiltInAssetId, Data::AssetLoadBehavior::PreLoad);
+        controllerAsset->m_memoryBudgetInBytes = 20000;
+        // Requests expire on the update after they were made
+        controllerAsset->m_requestLifetimeInUpdates = 0;
+
+        Data::Instance<RPI::StreamingImagePool> pool = RPI::StreamingImagePool::FindOrCreate(BuildImagePoolAsset(16 * 1024 * 1024, controllerAsset));
+        ASSERT_NE(pool.get(), nullptr);
+
+        Data::Asset<RPI::StreamingImageAsset> imageAssetA = BuildTestImage(pool.get());
+        Data::Asset<RPI::StreamingImageAsset> imageAssetB = BuildTestImage(pool.get());
+        Data::Instance<RPI::StreamingImage> imageA = RPI::StreamingImage::FindOrCreate(imageAssetA);
+        Data::Instance<RPI::StreamingImage> imageB = RPI::StreamingImage::FindOrCreate(imageAssetB);
+
+        auto imageSystem = RPI::ImageSystemInterface::Get();
+        const uint16_t middleMipLevel = static_cast<uint16_t>(imageAssetA->GetMipLevel(1));
+        const uint16_t tailMipLevel = static_cast<uint16_t>(imageAssetA->GetMipLevel(2));
+
+        // Images without requests are fully expanded, but both don't fit in the budget
+        imageSystem->Update();
+        EXPECT_EQ(imageA->GetResidentMipLevel(), tailMipLevel);
+        EXPECT_EQ(imageB->GetResidentMipLevel(), tailMipLevel);
+
+        imageA->SetTargetMip(middleMipLevel);
+        imageSystem->Update();
+        EXPECT_EQ(imageA->GetResidentMipLevel(), middleMipLevel);
+        EXPECT_EQ(imageB->GetResidentMipLevel(), tailMipLevel);
+
+        // The most detailed chain doesn't fit in the budget
+        imageA->SetTargetMip(0);
+        imageSystem->Update();
+        EXPECT_EQ(imageA->GetResidentMipLevel(), middleMipLevel);
+
+        // A is no longer requested, so it's trimmed to make room for B
+        imageB->SetTargetMip(middleMipLevel);
+        imageSystem->Update();
+        EXPECT_EQ(imageA->GetResidentMipLevel(), tailMipLevel);
+        EXPECT_EQ(imageB->GetResidentMipLevel(), middleMipLevel);
+    }
+
     TEST_F(StreamingImageTests, ImageInternalReferenceTracking)
     {
         using namespace AZ;
@@ -14,6 +14,7 @@
 
 #include <Atom/RPI.Public/ColorManagement/TransformColor.h>
 #include <Atom/RPI.Public/Material/Material.h>
+#include <Atom/RPI.Public/Material/MaterialSystem.h>
 #include <Atom/RPI.Public/Image/ImageSystemInterface.h>
 #include <Atom/RPI.Reflect/Shader/ShaderOptionGroup.h>
 #include <Atom/RPI.Reflect/Material/MaterialAssetCreator.h>
@@ -275,6 +276,40 @@ namespace UnitTest
         EXPECT_EQ(srgData.GetConstant<uint32_t>(srgData.FindShaderInputConstantIndex(Name{ "m_enum" })), 3u);
     }
 
+    TEST_F(MaterialTests, TestQueueCompile)
+    {
+        Data::Instance<Material> material = Material::FindOrCreate(m_testMaterialAsset);
+
+        EXPECT_TRUE(material->SetPropertyValue<int32_t>(material->FindPropertyIndex(Name{ "MyInt" }), 7));
+        EXPECT_TRUE(material->SetPropertyValue<float>(material->FindPropertyIndex(Name{ "MyFloat" }), 0.5f));
+
+        ProcessQueuedSrgCompilations(m_testMaterialShaderAsset, m_testMaterialSrgLayout->GetName());
+
+        // Queuing twice only compiles once
+        material->QueueCompile();
+        material->QueueCompile();
+        EXPECT_TRUE(material->NeedsCompile());
+
+        ASSERT_NE(MaterialSystem::Get(), nullptr);
+        MaterialSystem::Get()->CompileQueuedMaterials(RHI::JobPolicy::Serial);
+        EXPECT_FALSE(material->NeedsCompile());
+
+        const RHI::ShaderResourceGroupData& srgData = material->GetRHIShaderResourceGroup()->GetData();
+        EXPECT_EQ(srgData.GetConstant<int32_t>(srgData.FindShaderInputConstantIndex(Name{ "m_int" })), 7);
+        EXPECT_EQ(srgData.GetConstant<float>(srgData.FindShaderInputConstantIndex(Name{ "m_float" })), 0.5f);
+
+        // The SRG is queued for compile by the RHI, so the next change has to wait for the next frame
+        EXPECT_TRUE(material->SetPropertyValue<int32_t>(material->FindPropertyIndex(Name{ "MyInt" }), 8));
+        material->QueueCompile();
+        MaterialSystem::Get()->CompileQueuedMaterials(RHI::JobPolicy::Serial);
+        EXPECT_TRUE(material->NeedsCompile());
+
+        ProcessQueuedSrgCompilations(m_testMaterialShaderAsset, m_testMaterialSrgLayout->GetName());
+        MaterialSystem::Get()->CompileQueuedMaterials(RHI::JobPolicy::Serial);
+        EXPECT_FALSE(material->NeedsCompile());
+        EXPECT_EQ(srgData.GetConstant<int32_t>(srgData.FindShaderInputConstantIndex(Name{ "m_int" })), 8);
+    }
+
     TEST_F(MaterialTests, TestSetPropertyValueToMultipleShaderSettings)
     {
         Data::Asset<MaterialTypeAsset> materialTypeAsset;
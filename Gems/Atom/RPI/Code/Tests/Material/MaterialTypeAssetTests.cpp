@@ -710,6 +710,41 @@ namespace UnitTest
         EXPECT_EQ(1, creator.GetErrorCount());
     }
 
+    TEST_F(MaterialTypeAssetTests, ImagePropertyMappedToBindlessIndex)
+    {
+        Data::Asset<MaterialTypeAsset> materialTypeAsset;
+
+        MaterialTypeAssetCreator creator;
+        creator.Begin(Uuid::CreateRandom());
+        creator.AddShader(m_testShaderAsset);
+
+        creator.BeginMaterialProperty(Name{ "MyImage" }, MaterialPropertyDataType::Image);
+        creator.ConnectMaterialPropertyToBindlessImageIndex(Name{ "m_uint" });
+        creator.EndMaterialProperty();
+
+        EXPECT_TRUE(creator.End(materialTypeAsset));
+
+        const MaterialPropertyDescriptor* imageDescriptor = materialTypeAsset->GetMaterialPropertiesLayout()->GetPropertyDescriptor(MaterialPropertyIndex{0});
+        EXPECT_EQ(1, imageDescriptor->GetOutputConnections().size());
+        EXPECT_EQ(MaterialPropertyOutputType::ShaderInputBindlessIndex, imageDescriptor->GetOutputConnections()[0].m_type);
+        EXPECT_EQ(4, imageDescriptor->GetOutputConnections()[0].m_itemIndex.GetIndex());
+    }
+
+    TEST_F(MaterialTypeAssetTests, Error_StandardPropertyMappedToBindlessIndex)
+    {
+        MaterialTypeAssetCreator creator;
+        creator.Begin(Uuid::CreateRandom());
+        creator.AddShader(m_testShaderAsset);
+
+        creator.BeginMaterialProperty(Name{ "MyUInt" }, MaterialPropertyDataType::UInt);
+
+        AZ_TEST_START_ASSERTTEST;
+        creator.ConnectMaterialPropertyToBindlessImageIndex(Name{ "m_uint" });
+        AZ_TEST_STOP_ASSERTTEST(1);
+
+        EXPECT_EQ(1, creator.GetErrorCount());
+    }
+
     TEST_F(MaterialTypeAssetTests, Error_EndMaterialPropertyNotCalled_BeforeEnd)
     {
         MaterialTypeAssetCreator creator;
@@ -6,8 +6,12 @@
  *
  */
 
+#include <Atom/RPI.Public/FrustumCullingBatch.h>
+#include <Atom/RPI.Public/HierarchicalZBuffer.h>
 #include <Atom/RPI.Public/View.h>
 
+#include <AzCore/Math/MatrixUtils.h>
+#include <AzCore/Math/ShapeIntersection.h>
 #include <AzCore/UnitTest/TestTypes.h>
 
 #include <Common/RPITestFixture.h>
@@ -260,4 +264,121 @@ namespace UnitTest
         }
     }
 
+    TEST_F(ViewTests, HierarchicalZBuffer_BuildsFarthestDepthMips)
+    {
+        using namespace AZ;
+        using namespace RPI;
+
+        // 5x3 so the odd rows and columns are folded into the last texels
+        AZStd::vector<float> depths(5 * 3, 0.5f);
+        depths[2 * 5 + 4] = 0.25f;
+        HierarchicalZBuffer hierarchicalZBuffer(depths, 5, 3, Matrix4x4::CreateIdentity());
+
+        ASSERT_EQ(hierarchicalZBuffer.GetMipCount(), 4u);
+        EXPECT_EQ(hierarchicalZBuffer.GetWidth(1), 3u);
+        EXPECT_EQ(hierarchicalZBuffer.GetHeight(1), 2u);
+        EXPECT_EQ(hierarchicalZBuffer.GetWidth(3), 1u);
+        EXPECT_EQ(hierarchicalZBuffer.GetHeight(3), 1u);
+
+        EXPECT_EQ(hierarchicalZBuffer.GetDepth(1, 0, 0), 0.5f);
+        EXPECT_EQ(hierarchicalZBuffer.GetDepth(1, 2, 1), 0.25f);
+        EXPECT_EQ(hierarchicalZBuffer.GetDepth(3, 0, 0), 0.25f);
+    }
+
+    TEST_F(ViewTests, HierarchicalZBuffer_IsOccluded)
+    {
+        using namespace AZ;
+        using namespace RPI;
+
+        // The camera looks down -Z, with reversed depth
+        Matrix4x4 viewToClip;
+        MakePerspectiveFovMatrixRH(viewToClip, Constants::HalfPi, 1.0f, 0.1f, 100.0f, true);
+
+        // A wall 10 meters away covers the left half of the screen, the right half is cleared to the far plane
+        const Vector4 wallClipPosition = viewToClip * Vector4(0.0f, 0.0f, -10.0f, 1.0f);
+        const float wallDepth = wallClipPosition.GetZ() / wallClipPosition.GetW();
+        const uint32_t width = 16;
+        const uint32_t height = 16;
+        AZStd::vector<float> depths(width * height, 0.0f);
+        for (uint32_t y = 0; y < height; ++y)
+        {
+            for (uint32_t x = 0; x < width / 2; ++x)
+            {
+                depths[y * width + x] = wallDepth;
+            }
+        }
+        HierarchicalZBuffer hierarchicalZBuffer(depths, width, height, viewToClip);
+
+        // Behind the wall
+        EXPECT_TRUE(hierarchicalZBuffer.IsOccluded(Aabb::CreateFromMinMax(Vector3(-6.0f, -1.0f, -21.0f), Vector3(-4.0f, 1.0f, -19.0f))));
+
+        // In front of the wall
+        EXPECT_FALSE(hierarchicalZBuffer.IsOccluded(Aabb::CreateFromMinMax(Vector3(-3.0f, -0.5f, -6.0f), Vector3(-2.0f, 0.5f, -5.0f))));
+
+        // Behind the wall but partly in the empty half of the screen
+        EXPECT_FALSE(hierarchicalZBuffer.IsOccluded(Aabb::CreateFromMinMax(Vector3(-2.0f, -1.0f, -21.0f), Vector3(2.0f, 1.0f, -19.0f))));
+
+        // Crossing the near plane
+        EXPECT_FALSE(hierarchicalZBuffer.IsOccluded(Aabb::CreateFromMinMax(Vector3(-1.0f, -1.0f, -30.0f), Vector3(-0.5f, 1.0f, 1.0f))));
+
+        // Partly outside of the screen
+        EXPECT_FALSE(hierarchicalZBuffer.IsOccluded(Aabb::CreateFromMinMax(Vector3(-40.0f, -1.0f, -21.0f), Vector3(-4.0f, 1.0f, -19.0f))));
+    }
+
+    TEST_F(ViewTests, FrustumCullingBatch_MatchesShapeIntersection)
+    {
+        using namespace AZ;
+        using namespace RPI;
+
+        Matrix4x4 viewToClip;
+        MakePerspectiveFovMatrixRH(viewToClip, Constants::HalfPi, 1.0f, 0.1f, 100.0f, true);
+        const Frustum frustum = Frustum::CreateFromMatrixColumnMajor(viewToClip, Frustum::ReverseDepth::True);
+
+        // More spheres than the SIMD width, so the last batch is partial
+        const Sphere spheres[] =
+        {
+            Sphere(Vector3(0.0f, 0.0f, -10.0f), 1.0f),      // inside
+            Sphere(Vector3(-10.0f, 0.0f, -10.0f), 1.0f),    // crossing the left plane
+            Sphere(Vector3(0.0f, 0.0f, 10.0f), 1.0f),       // behind the camera
+            Sphere(Vector3(0.0f, 0.0f, -150.0f), 1.0f),     // beyond the far plane
+            Sphere(Vector3(0.0f, 5.0f, -20.0f), 2.0f),      // inside
+            Sphere(Vector3(0.0f, 0.0f, -100.0f), 5.0f),     // crossing the far plane
+            Sphere(Vector3(30.0f, 0.0f, -10.0f), 1.0f),     // right of the frustum
+        };
+
+        FrustumCullingBatch batch;
+        AZStd::vector<uint32_t> expectedInteriorIndices;
+        AZStd::vector<uint32_t> expectedOverlappingIndices;
+        for (const Sphere& sphere : spheres)
+        {
+            const uint32_t index = batch.AddSphere(sphere);
+            const IntersectResult result = ShapeIntersection::Classify(frustum, sphere);
+            if (result == IntersectResult::Interior)
+            {
+                expectedInteriorIndices.push_back(index);
+            }
+            else if (result == IntersectResult::Overlaps)
+            {
+                expectedOverlappingIndices.push_back(index);
+            }
+        }
+        EXPECT_EQ(batch.GetSphereCount(), 7u);
+
+        AZStd::vector<uint32_t> interiorIndices;
+        AZStd::vector<uint32_t> overlappingIndices;
+        batch.Classify(frustum, interiorIndices, overlappingIndices);
+        EXPECT_EQ(interiorIndices, expectedInteriorIndices);
+        EXPECT_EQ(overlappingIndices, expectedOverlappingIndices);
+        EXPECT_EQ(interiorIndices.size(), 2u);
+        EXPECT_EQ(overlappingIndices.size(), 2u);
+
+        batch.Clear();
+        interiorIndices.clear();
+        overlappingIndices.clear();
+        batch.Classify(frustum, interiorIndices, overlappingIndices);
+        EXPECT_EQ(batch.GetSphereCount(), 0u);
+        EXPECT_TRUE(interiorIndices.empty());
+        EXPECT_TRUE(overlappingIndices.empty());
+    }
+
 }
@@ -12,6 +12,8 @@ set(FILES
     Include/Atom/RPI.Public/Culling.h
     Include/Atom/RPI.Public/FeatureProcessor.h
     Include/Atom/RPI.Public/FeatureProcessorFactory.h
+    Include/Atom/RPI.Public/FrustumCullingBatch.h
+    Include/Atom/RPI.Public/HierarchicalZBuffer.h
     Include/Atom/RPI.Public/MeshDrawPacket.h
     Include/Atom/RPI.Public/PipelineState.h
     Include/Atom/RPI.Public/RenderPipeline.h
@@ -42,6 +44,7 @@ set(FILES
     Include/Atom/RPI.Public/Image/AttachmentImage.h
     Include/Atom/RPI.Public/Image/AttachmentImagePool.h
     Include/Atom/RPI.Public/Image/DefaultStreamingImageController.h
+    Include/Atom/RPI.Public/Image/MipFeedbackStreamingImageController.h
     Include/Atom/RPI.Public/Image/ImageSystem.h
     Include/Atom/RPI.Public/Image/ImageSystemInterface.h
     Include/Atom/RPI.Public/Image/StreamingImage.h
@@ -77,9 +80,15 @@ set(FILES
     Include/Atom/RPI.Public/Pass/Specific/ImageAttachmentPreviewPass.h
     Include/Atom/RPI.Public/Pass/Specific/EnvironmentCubeMapPass.h
     Include/Atom/RPI.Public/Pass/Specific/MSAAResolveFullScreenPass.h
+    Include/Atom/RPI.Public/Pass/Specific/HierarchicalZPass.h
+    Include/Atom/RPI.Public/Pass/Specific/MipFeedbackPass.h
     Include/Atom/RPI.Public/Pass/Specific/RenderToTexturePass.h
     Include/Atom/RPI.Public/Pass/Specific/SelectorPass.h
     Include/Atom/RPI.Public/Pass/Specific/SwapChainPass.h
+    Include/Atom/RPI.Public/Shader/BindlessResourceTable.h
+    Include/Atom/RPI.Public/Shader/BindlessResourceTableInterface.h
+    Include/Atom/RPI.Public/Shader/PipelineStateWarmup.h
+    Include/Atom/RPI.Public/Shader/PipelineStateWarmupInterface.h
     Include/Atom/RPI.Public/Shader/Shader.h
     Include/Atom/RPI.Public/Shader/ShaderReloadNotificationBus.h
     Include/Atom/RPI.Public/Shader/ShaderVariant.h
@@ -101,6 +110,8 @@ set(FILES
     Source/RPI.Public/Culling.cpp
     Source/RPI.Public/FeatureProcessor.cpp
     Source/RPI.Public/FeatureProcessorFactory.cpp
+    Source/RPI.Public/FrustumCullingBatch.cpp
+    Source/RPI.Public/HierarchicalZBuffer.cpp
     Source/RPI.Public/MeshDrawPacket.cpp
     Source/RPI.Public/PipelineState.cpp
     Source/RPI.Public/RenderPipeline.cpp
@@ -122,6 +133,7 @@ set(FILES
     Source/RPI.Public/Image/AttachmentImage.cpp
     Source/RPI.Public/Image/AttachmentImagePool.cpp
     Source/RPI.Public/Image/DefaultStreamingImageController.cpp
+    Source/RPI.Public/Image/MipFeedbackStreamingImageController.cpp
     Source/RPI.Public/Image/ImageSystem.cpp
     Source/RPI.Public/Image/StreamingImage.cpp
     Source/RPI.Public/Image/StreamingImageContext.cpp
@@ -153,9 +165,13 @@ set(FILES
     Source/RPI.Public/Pass/Specific/ImageAttachmentPreviewPass.cpp
     Source/RPI.Public/Pass/Specific/EnvironmentCubeMapPass.cpp
     Source/RPI.Public/Pass/Specific/MSAAResolveFullScreenPass.cpp
+    Source/RPI.Public/Pass/Specific/HierarchicalZPass.cpp
+    Source/RPI.Public/Pass/Specific/MipFeedbackPass.cpp
     Source/RPI.Public/Pass/Specific/RenderToTexturePass.cpp
     Source/RPI.Public/Pass/Specific/SelectorPass.cpp
     Source/RPI.Public/Pass/Specific/SwapChainPass.cpp
+    Source/RPI.Public/Shader/BindlessResourceTable.cpp
+    Source/RPI.Public/Shader/PipelineStateWarmup.cpp
     Source/RPI.Public/Shader/Shader.cpp
     Source/RPI.Public/Shader/ShaderVariant.cpp
     Source/RPI.Public/Shader/ShaderReloadDebugTracker.cpp
@@ -42,6 +42,7 @@ set(FILES
     Include/Atom/RPI.Reflect/Image/ImageMipChainAsset.h
     Include/Atom/RPI.Reflect/Image/ImageMipChainAssetCreator.h
     Include/Atom/RPI.Reflect/Image/ImageSystemDescriptor.h
+    Include/Atom/RPI.Reflect/Image/MipFeedbackStreamingImageControllerAsset.h
     Include/Atom/RPI.Reflect/Image/StreamingImageAsset.h
     Include/Atom/RPI.Reflect/Image/StreamingImageAssetCreator.h
     Include/Atom/RPI.Reflect/Image/StreamingImageAssetHandler.h
@@ -86,6 +87,8 @@ set(FILES
     Include/Atom/RPI.Reflect/Shader/ShaderVariantAsset.h
     Include/Atom/RPI.Reflect/Shader/IShaderVariantFinder.h
     Include/Atom/RPI.Reflect/Shader/PrecompiledShaderAssetSourceData.h
+    Include/Atom/RPI.Reflect/Shader/PipelineStateManifest.h
+    Include/Atom/RPI.Reflect/Shader/ShaderVariantUsageManifest.h
     Include/Atom/RPI.Reflect/System/AnyAsset.h
     Include/Atom/RPI.Reflect/System/AssetAliases.h
     Include/Atom/RPI.Reflect/System/PipelineRenderSettings.h
@@ -121,6 +124,7 @@ set(FILES
     Source/RPI.Reflect/Image/ImageMipChainAsset.cpp
     Source/RPI.Reflect/Image/ImageMipChainAssetCreator.cpp
     Source/RPI.Reflect/Image/ImageSystemDescriptor.cpp
+    Source/RPI.Reflect/Image/MipFeedbackStreamingImageControllerAsset.cpp
     Source/RPI.Reflect/Image/StreamingImageAsset.cpp
     Source/RPI.Reflect/Image/StreamingImageAssetCreator.cpp
     Source/RPI.Reflect/Image/StreamingImageAssetHandler.cpp
@@ -154,6 +158,8 @@ set(FILES
     Source/RPI.Reflect/Shader/ShaderVariantTreeAsset.cpp
     Source/RPI.Reflect/Shader/ShaderVariantAsset.cpp
     Source/RPI.Reflect/Shader/PrecompiledShaderAssetSourceData.cpp
+    Source/RPI.Reflect/Shader/PipelineStateManifest.cpp
+    Source/RPI.Reflect/Shader/ShaderVariantUsageManifest.cpp
     Source/RPI.Reflect/System/AnyAsset.cpp
     Source/RPI.Reflect/System/AssetAliases.cpp
     Source/RPI.Reflect/System/RenderPipelineDescriptor.cpp
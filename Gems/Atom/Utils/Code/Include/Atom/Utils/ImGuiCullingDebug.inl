@@ -41,6 +41,7 @@ namespace AZ
                 ImGui::Separator();
 
                 ImGui::Checkbox("Enable Frustum Culling", &debugCtx.m_enableFrustumCulling);
+                ImGui::Checkbox("Enable Hi-Z Occlusion Culling", &debugCtx.m_enableHierarchicalZCulling);
                 ImGui::Checkbox("Enable Parallel Octree Traversal",  &debugCtx.m_parallelOctreeTraversal);
                 ImGui::Checkbox("Freeze Frustums", &debugCtx.m_freezeFrustums);
                 ImGui::Checkbox("Debug Draw", &debugCtx.m_debugDraw);
@@ -83,10 +84,11 @@ namespace AZ
                 for (CullStatsType* cullStats : cullStatsSorted)
                 {
                     // create formatted display strings
-                    itemStrings.push_back(AZStd::string::format("%s - %d/%d CullPackets visible, %d drawPackets visible, %d cull jobs",
+                    itemStrings.push_back(AZStd::string::format("%s - %d/%d CullPackets visible, %d occluded, %d drawPackets visible, %d cull jobs",
                         cullStats->m_name.GetCStr(),
                         static_cast<uint32_t>(cullStats->m_numVisibleCullables),
                         static_cast<uint32_t>(debugCtx.m_numCullablesInScene),
+                        static_cast<uint32_t>(cullStats->m_numOccludedCullables),
                         static_cast<uint32_t>(cullStats->m_numVisibleDrawPackets),
                         static_cast<uint32_t>(cullStats->m_numJobs)
                     ));
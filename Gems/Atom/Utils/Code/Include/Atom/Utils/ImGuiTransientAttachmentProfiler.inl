@@ -203,6 +203,9 @@ namespace AZ
                             ImGui::Text("Size: %.1f MB", static_cast<double>(heapStats.m_heapSize * BytesToMB));
                             ImGui::Text("Watermark: %.1f MB", static_cast<double>(heapStats.m_watermarkSize * BytesToMB));
                             ImGui::Text("Waste: %.1f%%", (1.0 - static_cast<double>(heapStats.m_watermarkSize) / heapStats.m_heapSize) * 100.0);
+                            ImGui::Text("Planned Attachments: %u / %zu", heapStats.m_plannedAttachmentCount, heapStats.m_attachments.size());
+                            ImGui::Text("Placement Plan Size: %.1f MB", static_cast<double>(heapStats.m_placementPlanPeakSize * BytesToMB));
+                            ImGui::Text("Placement Plan Builds: %u", heapStats.m_placementPlanBuildCount);
                             ImGui::EndTooltip();
                         }
                     }
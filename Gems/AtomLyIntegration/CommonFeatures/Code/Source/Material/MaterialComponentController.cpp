@@ -160,7 +160,7 @@ namespace AZ
                     }
                 }
 
-                materialInstance->Compile();
+                materialInstance->QueueCompile();
             }
 
             // Only disconnect from tick bus and send notification after all pending properties have been applied 
@@ -246,6 +246,13 @@ namespace AZ
             return SkinningMethod::LinearSkinning;
         }
 
+        bool AtomActorInstance::IsInCameraFrustum() const
+        {
+            // The skinned mesh feature processor doesn't skin the meshes that failed culling in every view during the last frame,
+            // so the actor doesn't need to update its joints either
+            return !m_skinnedMeshRenderProxy.IsValid() || m_skinnedMeshRenderProxy->IsVisible();
+        }
+
         void AtomActorInstance::SetIsVisible(bool isVisible)
         {
             if (IsVisible() != isVisible)
@@ -91,6 +91,7 @@ namespace AZ
             void SetSkinningMethod(EMotionFX::Integration::SkinningMethod emfxSkinningMethod);
             SkinningMethod GetAtomSkinningMethod() const;
             void SetIsVisible(bool isVisible) override;
+            bool IsInCameraFrustum() const override;
 
             // BoundsRequestBus overrides ...
             AZ::Aabb GetWorldBounds() override;
@@ -825,13 +825,20 @@ namespace Audio
 
                             auto const pPositionedObject = static_cast<CATLAudioObject*>(pObject);
 
-                            AudioSystemImplementationRequestBus::BroadcastResult(eResult, &AudioSystemImplementationRequestBus::Events::SetPosition,
-                                pPositionedObject->GetImplDataPtr(),
-                                pRequestData->oPosition);
-
-                            if (eResult == eARS_SUCCESS)
+                            if (pPositionedObject->TryDeferPosition(pRequestData->oPosition, m_oSharedData.m_oActiveListenerPosition))
+                            {
+                                eResult = eARS_SUCCESS;
+                            }
+                            else
                             {
-                                pPositionedObject->SetPosition(pRequestData->oPosition);
+                                AudioSystemImplementationRequestBus::BroadcastResult(eResult, &AudioSystemImplementationRequestBus::Events::SetPosition,
+                                    pPositionedObject->GetImplDataPtr(),
+                                    pRequestData->oPosition);
+
+                                if (eResult == eARS_SUCCESS)
+                                {
+                                    pPositionedObject->SetPosition(pRequestData->oPosition);
+                                }
                             }
                         }
                         else
@@ -27,6 +27,15 @@
 
 namespace Audio
 {
+    namespace
+    {
+        bool IsBeyondVirtualDistance(const AZ::Vector3& position, const AZ::Vector3& listenerPosition)
+        {
+            const float virtualDistance = Audio::CVars::s_AudioObjectVirtualDistance;
+            return virtualDistance > 0.f && position.GetDistanceSq(listenerPosition) > virtualDistance * virtualDistance;
+        }
+    } // namespace
+
     extern CAudioLogger g_audioLogger;
 
     ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -342,6 +351,8 @@ namespace Audio
     {
         CATLAudioObjectBase::Clear();
         m_oPosition = SATLWorldPosition();
+        m_implPosition = AZ::Vector3::CreateZero();
+        m_nFlags &= ~eAOF_POSITION_PENDING;
         m_raycastProcessor.Reset();
     }
 
@@ -361,6 +372,30 @@ namespace Audio
     void CATLAudioObject::SetPosition(const SATLWorldPosition& oNewPosition)
     {
         m_oPosition = oNewPosition;
+        m_implPosition = oNewPosition.GetPositionVec();
+        m_nFlags &= ~eAOF_POSITION_PENDING;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    bool CATLAudioObject::TryDeferPosition(const SATLWorldPosition& oNewPosition, const SATLWorldPosition& rListenerPosition)
+    {
+        const AZ::Vector3 listenerPos = rListenerPosition.GetPositionVec();
+        if (IsBeyondVirtualDistance(oNewPosition.GetPositionVec(), listenerPos) && IsBeyondVirtualDistance(m_implPosition, listenerPos))
+        {
+            m_oPosition = oNewPosition;
+            m_nFlags |= eAOF_POSITION_PENDING;
+            return true;
+        }
+
+        return false;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    bool CATLAudioObject::IsVirtual(const SATLWorldPosition& rListenerPosition) const
+    {
+        // Both positions are checked, a virtual object has to be inaudible where the implementation thinks it is, too.
+        const AZ::Vector3 listenerPos = rListenerPosition.GetPositionVec();
+        return IsBeyondVirtualDistance(m_oPosition.GetPositionVec(), listenerPos) && IsBeyondVirtualDistance(m_implPosition, listenerPos);
     }
 
     ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -384,8 +384,20 @@ namespace Audio
         void Update(const float fUpdateIntervalMS, const SATLWorldPosition& rListenerPosition) override;
         // ~CATLAudioObjectBase
 
+        //! Sets the position the audio implementation was given for this object.
         void SetPosition(const SATLWorldPosition& oNewPosition);
 
+        //! Keeps the new position without sending it to the audio implementation, when both it and the position the implementation
+        //! has are beyond s_AudioObjectVirtualDistance from the listener. Returns false when the position has to be sent.
+        bool TryDeferPosition(const SATLWorldPosition& oNewPosition, const SATLWorldPosition& rListenerPosition);
+        bool HasPendingPosition() const
+        {
+            return (m_nFlags & eAOF_POSITION_PENDING) != 0;
+        }
+
+        //! A virtual object is out of audible range, its per-frame raycasts and implementation updates are skipped.
+        bool IsVirtual(const SATLWorldPosition& rListenerPosition) const;
+
         void SetRaycastCalcType(const EAudioObjectObstructionCalcType type);
         void RunRaycasts(const SATLWorldPosition& listenerPos);
         bool CanRunRaycasts() const;
@@ -406,16 +418,18 @@ namespace Audio
         float m_fPreviousVelocity;
         SATLWorldPosition m_oPosition;
         SATLWorldPosition m_oPreviousPosition;
+        AZ::Vector3 m_implPosition = AZ::Vector3::CreateZero();
 
         RaycastProcessor m_raycastProcessor;
 
-#if !defined(AUDIO_RELEASE)
     public:
-        void DrawDebugInfo(IRenderAuxGeom& auxGeom, const AZ::Vector3& vListenerPos, const CATLDebugNameStore* const pDebugNameStore) const;
         const SATLWorldPosition& GetPosition() const
         {
             return m_oPosition;
         }
+
+#if !defined(AUDIO_RELEASE)
+        void DrawDebugInfo(IRenderAuxGeom& auxGeom, const AZ::Vector3& vListenerPos, const CATLDebugNameStore* const pDebugNameStore) const;
 #endif // !AUDIO_RELEASE
     };
 
@@ -319,6 +319,25 @@ namespace Audio
             {
                 AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Audio, "Inner Per-Object CAudioObjectManager::Update");
 
+                if (pObject->IsVirtual(rListenerPosition))
+                {
+                    continue;
+                }
+
+                if (pObject->HasPendingPosition())
+                {
+                    // The object came back in range, give the implementation the position it held back while virtual.
+                    EAudioRequestStatus eResult = eARS_FAILURE;
+                    AudioSystemImplementationRequestBus::BroadcastResult(eResult, &AudioSystemImplementationRequestBus::Events::SetPosition,
+                        pObject->GetImplDataPtr(),
+                        pObject->GetPosition());
+
+                    if (eResult == eARS_SUCCESS)
+                    {
+                        pObject->SetPosition(pObject->GetPosition());
+                    }
+                }
+
                 pObject->Update(fUpdateIntervalMS, rListenerPosition);
 
                 if (pObject->CanRunRaycasts())
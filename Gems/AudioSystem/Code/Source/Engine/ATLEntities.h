@@ -51,6 +51,7 @@ namespace Audio
     {
         eAOF_NONE = 0,
         eAOF_TRACK_VELOCITY = AUDIO_BIT(0),
+        eAOF_POSITION_PENDING = AUDIO_BIT(1),   // position changed while virtual, not yet sent to the audio implementation
     };
 
     ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -388,6 +389,7 @@ namespace Audio
             , m_dataScope(eADS_ALL)
             , m_memoryBlock(nullptr)
             , m_implData(implData)
+            , m_releaseStamp(0)
         {
         }
 
@@ -405,6 +407,9 @@ namespace Audio
 
         IATLAudioFileEntryData* m_implData;
 
+        // Order in which cached files became removable, the least recently released ones are evicted first.
+        AZ::u64 m_releaseStamp;
+
 #if !defined(AUDIO_RELEASE)
         AZStd::chrono::system_clock::time_point m_timeCached;
 #endif // !AUDIO_RELEASE
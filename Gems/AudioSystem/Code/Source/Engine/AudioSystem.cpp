@@ -102,13 +102,16 @@ namespace Audio
     ///////////////////////////////////////////////////////////////////////////////////////////////////
     void CAudioSystem::PushRequest(const SAudioRequest& audioRequestData)
     {
-        CAudioRequestInternal request(audioRequestData);
-
         AZ_Assert(g_mainThreadId == AZStd::this_thread::get_id(), "AudioSystem::PushRequest - called from non-Main thread!");
-        AZ_Assert(0 == (request.nFlags & eARF_THREAD_SAFE_PUSH), "AudioSystem::PushRequest - called with flag THREAD_SAFE_PUSH!");
-        AZ_Assert(0 == (request.nFlags & eARF_EXECUTE_BLOCKING), "AudioSystem::PushRequest - called with flag EXECUTE_BLOCKING!");
+        AZ_Assert(0 == (audioRequestData.nFlags & eARF_THREAD_SAFE_PUSH), "AudioSystem::PushRequest - called with flag THREAD_SAFE_PUSH!");
+        AZ_Assert(0 == (audioRequestData.nFlags & eARF_EXECUTE_BLOCKING), "AudioSystem::PushRequest - called with flag EXECUTE_BLOCKING!");
 
-        AudioSystemInternalRequestBus::QueueBroadcast(&AudioSystemInternalRequestBus::Events::ProcessRequestByPriority, request);
+        if (!TryCoalescePositionRequest(audioRequestData))
+        {
+            // Any other request flushes the batched positions first, so it is processed after them in push order.
+            FlushPositionRequests();
+            AudioSystemInternalRequestBus::QueueBroadcast(&AudioSystemInternalRequestBus::Events::ProcessRequestByPriority, CAudioRequestInternal(audioRequestData));
+        }
     }
 
     ///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -123,6 +126,7 @@ namespace Audio
         AZ_Assert(0 != (request.nFlags & eARF_EXECUTE_BLOCKING), "AudioSystem::PushRequestBlocking - called without EXECUTE_BLOCKING flag!");
         AZ_Assert(0 == (request.nFlags & eARF_THREAD_SAFE_PUSH), "AudioSystem::PushRequestBlocking - called with THREAD_SAFE_PUSH flag!");
 
+        FlushPositionRequests();
         ProcessRequestBlocking(request);
     }
 
@@ -174,6 +178,9 @@ namespace Audio
         // Main Thread!
         AZ_Assert(g_mainThreadId == AZStd::this_thread::get_id(), "AudioSystem::ExternalUpdate - called from non-Main thread!");
 
+        // Hand the positions set this frame to the audio thread as one batch...
+        FlushPositionRequests();
+
         // Notify callbacks on the pending callbacks queue...
         // These are requests that were completed then queued for callback processing to happen here.
         ExecuteRequestCompletionCallbacks(m_pendingCallbacksQueue, m_pendingCallbacksMutex);
@@ -663,6 +670,78 @@ namespace Audio
         }
     }
 
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    void CAudioSystem::ProcessRequestBatch(TAudioRequests requests)
+    {
+        AZ_PROFILE_SCOPE_DYNAMIC(AZ::Debug::ProfileCategory::Audio, "Request Batch: %zu requests", requests.size());
+
+        AZ_Assert(g_mainThreadId != AZStd::this_thread::get_id(), "AudioSystem::ProcessRequestBatch - called from Main thread!");
+
+        if (m_oATL.CanProcessRequests())
+        {
+            for (auto& request : requests)
+            {
+                if (request.eStatus == eARS_NONE)
+                {
+                    request.eStatus = eARS_PENDING;
+                    m_oATL.ProcessRequest(request);
+                }
+
+                AZ_Assert(request.eStatus != eARS_PENDING, "AudioSystem::ProcessRequestBatch - ATL finished processing request, but request is still in pending state!");
+            }
+
+            // push the whole batch onto the callbacks queue for main thread to process later...
+            AZStd::lock_guard<AZStd::mutex> lock(m_pendingCallbacksMutex);
+            for (auto& request : requests)
+            {
+                if (request.eStatus != eARS_PENDING)
+                {
+                    m_pendingCallbacksQueue.push_back(AZStd::move(request));
+                }
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    bool CAudioSystem::TryCoalescePositionRequest(const SAudioRequest& audioRequestData)
+    {
+        // Main Thread!
+        // Only plain set position requests are coalesced, requests that want a callback have to be processed one by one.
+        auto const requestData = audioRequestData.pData;
+        if (!requestData || requestData->eRequestType != eART_AUDIO_OBJECT_REQUEST
+            || static_cast<const SAudioObjectRequestDataBase*>(requestData)->eType != eAORT_SET_POSITION
+            || (audioRequestData.nFlags & (eARF_SYNC_CALLBACK | eARF_SYNC_FINISHED_CALLBACK)) != 0)
+        {
+            return false;
+        }
+
+        auto it = m_positionRequestIndices.find(audioRequestData.nAudioObjectID);
+        if (it != m_positionRequestIndices.end())
+        {
+            // The audio object already moved since the last flush, only its latest position is sent.
+            m_positionRequestsBatch[it->second] = CAudioRequestInternal(audioRequestData);
+        }
+        else
+        {
+            m_positionRequestIndices.emplace(audioRequestData.nAudioObjectID, m_positionRequestsBatch.size());
+            m_positionRequestsBatch.emplace_back(audioRequestData);
+        }
+
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////
+    void CAudioSystem::FlushPositionRequests()
+    {
+        // Main Thread!
+        if (!m_positionRequestsBatch.empty())
+        {
+            AudioSystemInternalRequestBus::QueueFunction(AZStd::bind(&CAudioSystem::ProcessRequestBatch, this, AZStd::move(m_positionRequestsBatch)));
+            m_positionRequestsBatch.clear();
+            m_positionRequestIndices.clear();
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////////////////////////////
     bool CAudioSystem::ProcessRequests(TAudioRequests& requestQueue)
     {
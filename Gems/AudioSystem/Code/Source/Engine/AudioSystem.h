@@ -133,6 +133,10 @@ namespace Audio
         void InternalUpdate();
         bool ProcessRequests(TAudioRequests& rRequestQueue);
         void ProcessRequestBlocking(CAudioRequestInternal& audioRequestInternalData);
+        void ProcessRequestBatch(TAudioRequests requests);
+
+        bool TryCoalescePositionRequest(const SAudioRequest& audioRequestData);
+        void FlushPositionRequests();
 
         void ExecuteRequestCompletionCallbacks(TAudioRequests& requestQueue, AZStd::mutex& requestQueueMutex, bool bTryLock = false);
         void ExtractCompletedRequests(TAudioRequests& rRequestQueue, TAudioRequests& rSyncCallbacksQueue);
@@ -149,6 +153,8 @@ namespace Audio
         TAudioRequests m_blockingRequestsQueue;     // blocking requests go here, main thread will wait for audio thread to process
         TAudioRequests m_threadSafeCallbacksQueue;  // requests coming from any thread go here.
         TAudioRequests m_pendingCallbacksQueue;     // this queue holds pending callbacks, agreggated from processed requests
+        TAudioRequests m_positionRequestsBatch;     // main thread only, set position requests coalesced per audio object until the next flush
+        ATLMapLookupType<TAudioObjectID, size_t> m_positionRequestIndices; // index of each audio object's request in the batch
 
         AZStd::mutex m_blockingRequestsMutex;
         AZStd::mutex m_threadSafeCallbacksMutex;
@@ -12,6 +12,8 @@
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/IStreamer.h>
 #include <AzCore/IO/Path/Path.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/sort.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/std/parallel/binary_semaphore.h>
 #include <AzCore/StringFunc/StringFunc.h>
@@ -314,6 +316,7 @@ namespace Audio
                 if (audioFileEntry->m_flags.AreAnyFlagsActive(eAFF_USE_COUNTED))
                 {
                     audioFileEntry->m_flags.AddFlags(eAFF_REMOVABLE);
+                    audioFileEntry->m_releaseStamp = ++m_releaseStamp;
                 }
 
                 if (now || ignoreUsedCount)
@@ -376,7 +379,8 @@ namespace Audio
             float darkish[4] = { 0.3f, 0.3f, 0.3f, originalAlpha };
 
             auxGeom.Draw2dLabel(posX, positionY, 1.6f, orange, false,
-                "FileCacheManager (%zu of %zu KiB) [Entries: %zu]", m_currentByteTotal >> 10, m_maxByteTotal >> 10, m_audioFileEntries.size());
+                "FileCacheManager (%zu of %zu KiB) [Entries: %zu] [Evicted: %zu files, %zu KiB]", m_currentByteTotal >> 10, m_maxByteTotal >> 10,
+                m_audioFileEntries.size(), m_evictedFileCount, m_evictedByteTotal >> 10);
             positionY += 15.0f;
 
             const bool displayAll = CVars::s_fcmDrawOptions.GetRawFlags() == 0;
@@ -494,7 +498,7 @@ namespace Audio
             if (requestSize <= maxAvailableSize)
             {
                 // Here we need to cleanup first before allowing the new request to be allocated.
-                TryToUncacheFiles();
+                TryToUncacheFiles(requestSize);
 
                 // We should only indicate success if there's actually really enough room for the new entry!
                 success = (m_maxByteTotal - m_currentByteTotal) >= requestSize;
@@ -655,7 +659,7 @@ namespace Audio
         if (!audioFileEntry->m_memoryBlock)
         {
             // Memory block is either full or too fragmented, let's try to throw everything out that can be removed and allocate again.
-            TryToUncacheFiles();
+            TryToUncacheFiles(m_maxByteTotal);
 
             // And try again
             audioFileEntry->m_memoryBlock = AZ::AllocatorInstance<AudioBankAllocator>::Get().Allocate(
@@ -730,15 +734,40 @@ namespace Audio
     }
 
     ///////////////////////////////////////////////////////////////////////////////////////////////
-    void CFileCacheManager::TryToUncacheFiles()
+    void CFileCacheManager::TryToUncacheFiles(const size_t requestSize)
     {
+        AZStd::vector<CATLAudioFileEntry*, Audio::AudioSystemStdAllocator> removableEntries;
         for (auto& audioFileEntryPair : m_audioFileEntries)
         {
             CATLAudioFileEntry* const audioFileEntry = audioFileEntryPair.second;
 
             if (audioFileEntry && audioFileEntry->m_flags.AreAllFlagsActive(eAFF_CACHED | eAFF_REMOVABLE))
             {
-                UncacheFileCacheEntryInternal(audioFileEntry, true);
+                removableEntries.push_back(audioFileEntry);
+            }
+        }
+
+        // Evict the least recently released files first, and only until the request fits, so recently used files stay cached
+        // for the next time they are loaded.
+        AZStd::sort(removableEntries.begin(), removableEntries.end(),
+            [](const CATLAudioFileEntry* lhs, const CATLAudioFileEntry* rhs)
+            {
+                return lhs->m_releaseStamp < rhs->m_releaseStamp;
+            });
+
+        for (CATLAudioFileEntry* const audioFileEntry : removableEntries)
+        {
+            if ((m_maxByteTotal - m_currentByteTotal) >= requestSize)
+            {
+                break;
+            }
+
+            const size_t fileSize = audioFileEntry->m_fileSize;
+            UncacheFileCacheEntryInternal(audioFileEntry, true);
+            if (!audioFileEntry->m_flags.AreAnyFlagsActive(eAFF_CACHED))
+            {
+                ++m_evictedFileCount;
+                m_evictedByteTotal += fileSize;
             }
         }
     }
@@ -90,7 +90,7 @@ namespace Audio
 
         bool AllocateMemoryBlockInternal(CATLAudioFileEntry* const audioFileEntry);
         void UncacheFile(CATLAudioFileEntry* const audioFileEntry);
-        void TryToUncacheFiles();
+        void TryToUncacheFiles(const size_t requestSize);
         void UpdateLocalizedFileEntryData(CATLAudioFileEntry* const audioFileEntry);
         bool TryCacheFileCacheEntryInternal(CATLAudioFileEntry* const audioFileEntry, const TAudioFileEntryID fileID, const bool loadSynchronously, const bool overrideUseCount = false, const size_t useCount = 0);
 
@@ -100,5 +100,10 @@ namespace Audio
 
         size_t m_currentByteTotal;
         size_t m_maxByteTotal;
+        AZ::u64 m_releaseStamp = 0;
+
+        // Stats for the debug draw.
+        size_t m_evictedFileCount = 0;
+        size_t m_evictedByteTotal = 0;
     };
 } // namespace Audio
@@ -134,6 +134,12 @@ namespace Audio::CVars
         "An audio object needs to have its velocity changed by this amount in order to issue an 'object_speed' Rtpc update to the audio system.\n"
         "Usage: s_VelocityTrackingThreshold=0.5\n");
 
+    AZ_CVAR(float, s_AudioObjectVirtualDistance, 0.f,
+        nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Audio objects further than this distance from the listener become virtual: their position updates are held back and their\n"
+        "raycasts and per-frame updates are skipped. Set it at or above the largest attenuation range. 0 disables virtualization.\n"
+        "Usage: s_AudioObjectVirtualDistance=100.0\n");
+
     AZ_CVAR(AZ::u32, s_AudioProxiesInitType, 0,
         [](const AZ::u32& initType) -> void
         {
@@ -27,6 +27,7 @@ namespace Audio::CVars
 
     AZ_CVAR_EXTERNED(float, s_PositionUpdateThreshold);
     AZ_CVAR_EXTERNED(float, s_VelocityTrackingThreshold);
+    AZ_CVAR_EXTERNED(float, s_AudioObjectVirtualDistance);
     AZ_CVAR_EXTERNED(AZ::u32, s_AudioProxiesInitType);
 
     AZ_CVAR_EXTERNED(AZ::CVarFixedString, g_languageAudio);
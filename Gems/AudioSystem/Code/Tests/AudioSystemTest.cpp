@@ -18,6 +18,7 @@
 #include <ATLComponents.h>
 #include <ATLUtils.h>
 #include <ATL.h>
+#include <SoundCVars.h>
 
 #include <Mocks/ATLEntitiesMock.h>
 #include <Mocks/IAudioSystemImplementationMock.h>
@@ -324,6 +325,56 @@ TEST_F(ATLAudioObjectTest, OnAudioRaycastResults_MultiRaycastHit_NonZeroOcclusio
 }
 
 
+TEST_F(ATLAudioObjectTest, TryDeferPosition_BeyondVirtualDistance_PositionPendingAndVirtual)
+{
+    Audio::CVars::s_AudioObjectVirtualDistance = 10.f;
+    CATLAudioObject audioObject(testAudioObjectId, nullptr);
+    const SATLWorldPosition listenerPosition(AZ::Vector3::CreateZero());
+
+    audioObject.SetPosition(SATLWorldPosition(AZ::Vector3(20.f, 0.f, 0.f)));
+    EXPECT_TRUE(audioObject.IsVirtual(listenerPosition));
+
+    EXPECT_TRUE(audioObject.TryDeferPosition(SATLWorldPosition(AZ::Vector3(0.f, 30.f, 0.f)), listenerPosition));
+    EXPECT_TRUE(audioObject.HasPendingPosition());
+    EXPECT_TRUE(audioObject.IsVirtual(listenerPosition));
+
+    // Moving back in range has to reach the implementation.
+    EXPECT_FALSE(audioObject.TryDeferPosition(SATLWorldPosition(AZ::Vector3(5.f, 0.f, 0.f)), listenerPosition));
+
+    Audio::CVars::s_AudioObjectVirtualDistance = 0.f;
+}
+
+
+TEST_F(ATLAudioObjectTest, IsVirtual_ListenerMovesInRangeOfPendingPosition_NotVirtual)
+{
+    Audio::CVars::s_AudioObjectVirtualDistance = 10.f;
+    CATLAudioObject audioObject(testAudioObjectId, nullptr);
+
+    audioObject.SetPosition(SATLWorldPosition(AZ::Vector3(20.f, 0.f, 0.f)));
+    EXPECT_TRUE(audioObject.TryDeferPosition(SATLWorldPosition(AZ::Vector3(40.f, 0.f, 0.f)), SATLWorldPosition(AZ::Vector3::CreateZero())));
+
+    const SATLWorldPosition listenerPosition(AZ::Vector3(35.f, 0.f, 0.f));
+    EXPECT_FALSE(audioObject.IsVirtual(listenerPosition));
+
+    audioObject.SetPosition(audioObject.GetPosition());
+    EXPECT_FALSE(audioObject.HasPendingPosition());
+
+    Audio::CVars::s_AudioObjectVirtualDistance = 0.f;
+}
+
+
+TEST_F(ATLAudioObjectTest, IsVirtual_VirtualDistanceDisabled_NeverVirtual)
+{
+    Audio::CVars::s_AudioObjectVirtualDistance = 0.f;
+    CATLAudioObject audioObject(testAudioObjectId, nullptr);
+    const SATLWorldPosition listenerPosition(AZ::Vector3::CreateZero());
+
+    audioObject.SetPosition(SATLWorldPosition(AZ::Vector3(1000.f, 0.f, 0.f)));
+    EXPECT_FALSE(audioObject.IsVirtual(listenerPosition));
+    EXPECT_FALSE(audioObject.TryDeferPosition(SATLWorldPosition(AZ::Vector3(2000.f, 0.f, 0.f)), listenerPosition));
+}
+
+
 class AudioRaycastManager_Test
     : public AudioRaycastManager
 {
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzFramework/Physics/Material.h>
 #include <AzFramework/Physics/Configuration/RigidBodyConfiguration.h>
 
@@ -19,6 +20,7 @@ namespace Nv::Blast
 namespace Blast
 {
     class BlastFamily;
+    class ShapesPool;
 
     //! Data required to create a BlastActor.
     struct BlastActorDesc
@@ -34,5 +36,6 @@ namespace Blast
         bool m_isStatic = false; //!< Denotes whether actor should be simulated by a static or dynamic rigid body.
         bool m_isLeafChunk = false; //!< Denotes whether this actor represented by a single leaf chunk.
         float m_scale = 1.0f; //!< Uniform scale applied to the actor.
+        AZStd::shared_ptr<ShapesPool> m_shapesPool; //!< Optional pool the actor takes its shapes from and returns them to.
     };
 } // namespace Blast
@@ -32,6 +32,7 @@ namespace Blast
     BlastActorImpl::BlastActorImpl(const BlastActorDesc& desc)
         : m_family(*desc.m_family)
         , m_tkActor(*desc.m_tkActor)
+        , m_shapesPool(desc.m_shapesPool)
         , m_entity(desc.m_entity)
         , m_chunkIndices(desc.m_chunkIndices)
         , m_isLeafChunk(desc.m_isLeafChunk)
@@ -51,6 +52,16 @@ namespace Blast
     BlastActorImpl::~BlastActorImpl()
     {
         m_tkActor.userData = nullptr;
+
+        // Return the shapes to the pool, so the actors that replace this one can reuse them.
+        if (m_shapesPool)
+        {
+            const AZStd::vector<AZStd::shared_ptr<Physics::Shape>> shapes = m_shapesProvider->GetShapes();
+            for (size_t i = 0; i < shapes.size(); ++i)
+            {
+                m_shapesPool->ReleaseShape(m_shapeSubchunkIndices[i], shapes[i]);
+            }
+        }
     }
 
     void BlastActorImpl::Spawn()
@@ -119,6 +130,15 @@ namespace Blast
                     continue;
                 }
 
+                if (m_shapesPool)
+                {
+                    if (AZStd::shared_ptr<Physics::Shape> shape = m_shapesPool->AcquireShape(subchunkIndex))
+                    {
+                        AddShape(subchunkIndex, AZStd::move(shape));
+                        continue;
+                    }
+                }
+
                 auto& subchunk = pxSubchunks[subchunkIndex];
                 AZ::Transform transform = PxMathConvert(subchunk.transform);
                 auto colliderConfiguration = CalculateColliderConfiguration(transform, material);
@@ -133,11 +153,17 @@ namespace Blast
 
                 AZ_Assert(shape, "Failed to create Shape for BlastActor");
 
-                m_shapesProvider->AddShape(shape);
+                AddShape(subchunkIndex, AZStd::move(shape));
             }
         }
     }
 
+    void BlastActorImpl::AddShape(uint32_t subchunkIndex, AZStd::shared_ptr<Physics::Shape> shape)
+    {
+        m_shapeSubchunkIndices.push_back(subchunkIndex);
+        m_shapesProvider->AddShape(AZStd::move(shape));
+    }
+
     Physics::ColliderConfiguration BlastActorImpl::CalculateColliderConfiguration(
         const AZ::Transform& transform, Physics::MaterialId material)
     {
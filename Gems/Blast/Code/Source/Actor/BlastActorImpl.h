@@ -7,6 +7,7 @@
  */
 #pragma once
 
+#include <Actor/ShapesPool.h>
 #include <Actor/ShapesProvider.h>
 #include <Blast/BlastActor.h>
 #include <Actor/BlastActorDesc.h>
@@ -59,9 +60,13 @@ namespace Blast
             const AZStd::vector<uint32_t>& chunkIndices, const Nv::Blast::ExtPxAsset& asset,
             const Physics::MaterialId& material);
 
+        void AddShape(uint32_t subchunkIndex, AZStd::shared_ptr<Physics::Shape> shape);
+
         const BlastFamily& m_family;
         Nv::Blast::TkActor& m_tkActor;
         AZStd::unique_ptr<ShapesProvider> m_shapesProvider;
+        AZStd::shared_ptr<ShapesPool> m_shapesPool;
+        AZStd::vector<uint32_t> m_shapeSubchunkIndices; //!< Subchunk index of each shape added to the shapes provider.
 
         AZStd::shared_ptr<AZ::Entity> m_entity;
         AZStd::vector<uint32_t> m_chunkIndices;
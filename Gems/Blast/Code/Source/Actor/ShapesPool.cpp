@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Actor/ShapesPool.h>
+
+namespace Blast
+{
+    AZStd::shared_ptr<Physics::Shape> ShapesPool::AcquireShape(uint32_t subchunkIndex)
+    {
+        auto shapesIt = m_shapes.find(subchunkIndex);
+        if (shapesIt == m_shapes.end())
+        {
+            return nullptr;
+        }
+
+        AZStd::vector<AZStd::shared_ptr<Physics::Shape>>& shapes = shapesIt->second;
+        for (size_t i = 0; i < shapes.size(); ++i)
+        {
+            // Rigid bodies removed from the scene are deleted at the end of the simulation step, until then they still
+            // hold their shapes. An exclusive shape can only be attached to a new body once the old one let it go.
+            if (shapes[i].use_count() == 1)
+            {
+                AZStd::shared_ptr<Physics::Shape> shape = AZStd::move(shapes[i]);
+                shapes[i] = AZStd::move(shapes.back());
+                shapes.pop_back();
+                return shape;
+            }
+        }
+
+        return nullptr;
+    }
+
+    void ShapesPool::ReleaseShape(uint32_t subchunkIndex, AZStd::shared_ptr<Physics::Shape> shape)
+    {
+        if (shape)
+        {
+            m_shapes[subchunkIndex].push_back(AZStd::move(shape));
+        }
+    }
+
+    void ShapesPool::Clear()
+    {
+        m_shapes.clear();
+    }
+
+    size_t ShapesPool::GetShapeCount() const
+    {
+        size_t shapeCount = 0;
+        for (const auto& shapes : m_shapes)
+        {
+            shapeCount += shapes.second.size();
+        }
+        return shapeCount;
+    }
+} // namespace Blast
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzFramework/Physics/Shape.h>
+
+namespace Blast
+{
+    //! Keeps the shapes of destroyed actors, so the actors created when a family splits can reuse the shapes of the
+    //! subchunks of their parent instead of creating new ones.
+    //! @note All shapes in the pool must share the same collider configuration and scale.
+    class ShapesPool
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ShapesPool, AZ::SystemAllocator, 0);
+
+        //! Returns a shape of the subchunk that is no longer used by any rigid body, or nullptr if there is none.
+        AZStd::shared_ptr<Physics::Shape> AcquireShape(uint32_t subchunkIndex);
+
+        //! Returns the shape of a subchunk to the pool.
+        //! The shape can still be attached to a rigid body that is waiting to be deleted, it won't be acquired until then.
+        void ReleaseShape(uint32_t subchunkIndex, AZStd::shared_ptr<Physics::Shape> shape);
+
+        void Clear();
+
+        size_t GetShapeCount() const;
+
+    private:
+        AZStd::unordered_map<uint32_t, AZStd::vector<AZStd::shared_ptr<Physics::Shape>>> m_shapes;
+    };
+} // namespace Blast
@@ -10,6 +10,7 @@
 #include <Family/BlastFamilyImpl.h>
 
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <Blast/BlastSystemBus.h>
 #include <Family/ActorTracker.h>
 #include <Family/BlastFamily.h>
@@ -36,6 +37,7 @@ namespace Blast
         : m_asset(desc.m_asset)
         , m_actorFactory(desc.m_actorFactory)
         , m_entityProvider(desc.m_entityProvider)
+        , m_shapesPool(AZStd::make_shared<ShapesPool>())
         , m_listener(desc.m_listener)
         , m_physicsMaterialId(desc.m_physicsMaterial)
         , m_blastMaterial(desc.m_blastMaterial)
@@ -113,6 +115,9 @@ namespace Blast
         AZStd::unordered_set<BlastActor*> toDelete = m_actorTracker.GetActors();
         DestroyActors(toDelete);
 
+        // The shapes depend on the spawn transform's scale, so they can't be reused after respawning.
+        m_shapesPool->Clear();
+
         if (m_tkFamily)
         {
             m_tkFamily->removeListener(*this);
@@ -250,6 +255,7 @@ namespace Blast
         actorDesc.m_parentLinearVelocity = AZ::Vector3::CreateZero();
         actorDesc.m_bodyConfiguration = configuration;
         actorDesc.m_scale = transform.GetUniformScale();
+        actorDesc.m_shapesPool = m_shapesPool;
 
         return actorDesc;
     }
@@ -7,6 +7,7 @@
  */
 #pragma once
 
+#include <Actor/ShapesPool.h>
 #include <Asset/BlastAsset.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/std/containers/unordered_set.h>
@@ -82,6 +83,7 @@ namespace Blast
         physx::unique_ptr<Nv::Blast::TkFamily> m_tkFamily;
         AZStd::shared_ptr<BlastActorFactory> m_actorFactory;
         AZStd::shared_ptr<EntityProvider> m_entityProvider;
+        AZStd::shared_ptr<ShapesPool> m_shapesPool; // Shapes of destroyed actors, reused by the actors they split into.
         BlastListener* m_listener;
 
         const Physics::MaterialId m_physicsMaterialId;
@@ -105,4 +105,52 @@ namespace Blast
 
         m_blastActor.reset(aznew TestableBlastActor(actorDesc));
     }
+
+    TEST_F(BlastActorTest, ReusesPooledShapes_GivenShapesPool_SUITE_sandbox)
+    {
+        // Initialize actor description
+        AZStd::vector<uint32_t> chunkIndices;
+        chunkIndices.push_back(0);
+
+        AzPhysics::RigidBodyConfiguration configuration;
+        auto entity = AZStd::make_shared<AZ::Entity>();
+        AZ::EntityId entityId = entity->GetId();
+        auto actorDesc = BlastActorDesc
+            {m_mockFamily.get(),
+             m_mockTkActor.get(),
+             Physics::MaterialId(),
+             AZ::Vector3::CreateZero(),
+             AZ::Vector3::CreateZero(),
+             configuration,
+             chunkIndices,
+             entity,
+             false,
+             false};
+        actorDesc.m_shapesPool = AZStd::make_shared<ShapesPool>();
+        actorDesc.m_shapesPool->ReleaseShape(0, AZStd::make_shared<MockShape>());
+
+        // Initialize mock asset
+        Nv::Blast::ExtPxChunk chunk{0, 1, false};
+        Nv::Blast::ExtPxSubchunk subchunk{
+            physx::PxTransform(0, 0, 0),
+            physx::PxConvexMeshGeometry(nullptr),
+        };
+        m_mockFamily->m_pxAsset.m_chunks.push_back(chunk);
+        m_mockFamily->m_pxAsset.m_subchunks.push_back(subchunk);
+
+        auto rigidBody = AZStd::make_unique<FakeRigidBody>();
+
+        // Connect mock bus handler
+        m_mockRigidBodyRequestBusHandler->Connect(entityId);
+
+        EXPECT_CALL(*m_mockPhysicsSystemRequestsHandler, CreateShape(_, _)).Times(0);
+        EXPECT_CALL(*m_mockRigidBodyRequestBusHandler, GetRigidBody()).Times(1).WillOnce(Return(rigidBody.get()));
+
+        m_blastActor.reset(aznew TestableBlastActor(actorDesc));
+        EXPECT_EQ(actorDesc.m_shapesPool->GetShapeCount(), 0);
+
+        // Destroying the actor returns its shapes to the pool.
+        m_blastActor.reset();
+        EXPECT_EQ(actorDesc.m_shapesPool->GetShapeCount(), 1);
+    }
 } // namespace Blast
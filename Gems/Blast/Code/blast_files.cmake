@@ -20,6 +20,8 @@ set(FILES
     Source/Actor/BlastActorImpl.cpp
     Source/Actor/EntityProvider.h
     Source/Actor/EntityProvider.cpp
+    Source/Actor/ShapesPool.h
+    Source/Actor/ShapesPool.cpp
     Source/Actor/ShapesProvider.h
     Source/Actor/ShapesProvider.cpp
     Source/Asset/BlastAsset.h
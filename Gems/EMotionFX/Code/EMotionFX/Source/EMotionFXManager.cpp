@@ -29,6 +29,7 @@
 #include <EMotionFX/Source/Allocators.h>
 #include <EMotionFX/Source/DebugDraw.h>
 #include <EMotionFX/Source/MotionData/MotionDataFactory.h>
+#include <EMotionFX/Source/MotionData/MotionSamplingCache.h>
 
 namespace EMotionFX
 {
@@ -75,6 +76,7 @@ namespace EMotionFX
         gEMFX.Get()->SetRecorder              (Recorder::Create());
         gEMFX.Get()->SetMotionInstancePool    (MotionInstancePool::Create());
         gEMFX.Get()->SetDebugDraw             (aznew DebugDraw());
+        gEMFX.Get()->SetMotionSamplingCache   (aznew MotionSamplingCache());
         gEMFX.Get()->SetGlobalSimulationSpeed (1.0f);
 
         // set the number of threads
@@ -124,6 +126,7 @@ namespace EMotionFX
         mRecorder               = nullptr;
         mMotionInstancePool     = nullptr;
         mDebugDraw              = nullptr;
+        mMotionSamplingCache    = nullptr;
         mUnitType               = MCore::Distance::UNITTYPE_METERS;
         mGlobalSimulationSpeed  = 1.0f;
         m_isInEditorMode        = false;
@@ -168,6 +171,9 @@ namespace EMotionFX
 
         delete mDebugDraw;
         mDebugDraw = nullptr;
+
+        delete mMotionSamplingCache;
+        mMotionSamplingCache = nullptr;
         
 
         mEventManager->Destroy();
@@ -195,6 +201,7 @@ namespace EMotionFX
         AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Animation, "EMotionFXManager::Update");
 
         mDebugDraw->Clear();
+        mMotionSamplingCache->BeginFrame();
         mRecorder->UpdatePlayMode(timePassedInSeconds);
         mActorManager->UpdateActorInstances(timePassedInSeconds);
         mEventManager->OnSimulatePhysics(timePassedInSeconds);
@@ -313,6 +320,11 @@ namespace EMotionFX
         mDebugDraw = draw;
     }
 
+    void EMotionFXManager::SetMotionSamplingCache(MotionSamplingCache* cache)
+    {
+        mMotionSamplingCache = cache;
+    }
+
     // set the motion instance pool
     void EMotionFXManager::SetMotionInstancePool(MotionInstancePool* pool)
     {
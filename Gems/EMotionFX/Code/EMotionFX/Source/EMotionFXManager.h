@@ -33,6 +33,7 @@ namespace EMotionFX
     class MotionInstancePool;
     class EventDataFactory;
     class DebugDraw;
+    class MotionSamplingCache;
 
     // versions
 #define EMFX_HIGHVERSION 4
@@ -191,6 +192,12 @@ namespace EMotionFX
          */
         MCORE_INLINE DebugDraw* GetDebugDraw() const                                { return mDebugDraw; }
 
+        /**
+         * Get the motion sampling cache, which shares the sampled motions between the motion instances that are in sync.
+         * @result A pointer to the motion sampling cache.
+         */
+        MCORE_INLINE MotionSamplingCache* GetMotionSamplingCache() const            { return mMotionSamplingCache; }
+
         /**
          * Set the path of the media root directory.
          * @param path The path of the media root folder.
@@ -354,6 +361,7 @@ namespace EMotionFX
         Recorder*                   mRecorder;              /**< The recorder. */
         MotionInstancePool*         mMotionInstancePool;    /**< The motion instance pool. */        
         DebugDraw*                  mDebugDraw;             /**< The debug drawing system. */
+        MotionSamplingCache*        mMotionSamplingCache;   /**< The motion sampling cache. */
         MCore::Array<ThreadData*>   mThreadDatas;           /**< The per thread data. */
         MCore::Distance::EUnitType  mUnitType;              /**< The unit type, on default it is MCore::Distance::UNITTYPE_METERS. */
         float                       mGlobalSimulationSpeed; /**< The global simulation speed, default is 1.0. */
@@ -425,6 +433,12 @@ namespace EMotionFX
          */
         void SetMotionInstancePool(MotionInstancePool* pool);
 
+        /**
+         * Set the motion sampling cache.
+         * @param cache The motion sampling cache.
+         */
+        void SetMotionSamplingCache(MotionSamplingCache* cache);
+
         /**
          * Set the number of threads to use.
          * @param numThreads The number of threads to use internally. This must be a value of 1 or above.
@@ -512,4 +526,5 @@ namespace EMotionFX
     MCORE_INLINE Recorder&                  GetRecorder()               { return *GetEMotionFX().GetRecorder(); }           /**< Get the recorder. */
     MCORE_INLINE MotionInstancePool&        GetMotionInstancePool()     { return *GetEMotionFX().GetMotionInstancePool(); } /**< Get the motion instance pool. */
     MCORE_INLINE DebugDraw&                 GetDebugDraw()              { return *GetEMotionFX().GetDebugDraw(); }          /**< Get the debug drawing. */
+    MCORE_INLINE MotionSamplingCache&       GetMotionSamplingCache()    { return *GetEMotionFX().GetMotionSamplingCache(); } /**< Get the motion sampling cache. */
 }   // namespace EMotionFX
@@ -20,6 +20,7 @@
 #include "MotionEventTable.h"
 #include <EMotionFX/Source/Allocators.h>
 #include <EMotionFX/Source/MotionData/MotionData.h>
+#include <EMotionFX/Source/MotionData/MotionSamplingCache.h>
 #include <EMotionFX/Source/Node.h>
 #include <EMotionFX/Source/TransformData.h>
 
@@ -308,7 +309,15 @@ namespace EMotionFX
         sampleSettings.m_retarget = instance->GetRetargetingEnabled();
         sampleSettings.m_sampleTime = instance->GetCurrentTime();
         sampleSettings.m_inputPose = inputPose ? inputPose : sampleSettings.m_actorInstance->GetTransformData()->GetBindPose();
-        
+
+        // Share the samples with the other instances playing this motion at the same time.
+        MotionSamplingCache* samplingCache = GetEMotionFX().GetMotionSamplingCache();
+        if (samplingCache && samplingCache->GetIsEnabled())
+        {
+            samplingCache->SamplePose(this, sampleSettings, outputPose);
+            return;
+        }
+
         m_motionData->SamplePose(sampleSettings, outputPose);
     }
 
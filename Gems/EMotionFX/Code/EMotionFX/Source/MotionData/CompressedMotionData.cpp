@@ -0,0 +1,1534 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Outcome/Outcome.h>
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/MorphSetup.h>
+#include <EMotionFX/Source/MorphSetupInstance.h>
+#include <EMotionFX/Source/MotionData/CompressedMotionData.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <EMotionFX/Source/Node.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/Skeleton.h>
+#include <EMotionFX/Source/TransformData.h>
+
+#include <EMotionFX/Source/Importer/SharedFileFormatStructs.h>
+#include <EMotionFX/Source/Importer/MotionFileFormat.h>
+#include <EMotionFX/Exporters/ExporterLib/Exporter/Exporter.h>
+#include <MCore/Source/LogManager.h>
+
+namespace EMotionFX
+{
+    namespace
+    {
+        AZ_FORCE_INLINE AZ::u32 GetMaxQuantizedValue(AZ::u8 bitsPerComponent)
+        {
+            return (1u << bitsPerComponent) - 1;
+        }
+
+        // The bit stream has a padding word at the end, so the word after the one holding the first bit can always be read.
+        AZ_FORCE_INLINE AZ::u32 ReadBits(const AZ::u32* words, size_t bitIndex, AZ::u8 numBits)
+        {
+            const size_t wordIndex = bitIndex >> 5;
+            const AZ::u32 shift = static_cast<AZ::u32>(bitIndex & 31);
+            const AZ::u64 value = static_cast<AZ::u64>(words[wordIndex]) | (static_cast<AZ::u64>(words[wordIndex + 1]) << 32);
+            return static_cast<AZ::u32>(value >> shift) & GetMaxQuantizedValue(numBits);
+        }
+
+        void WriteBits(AZ::u32* words, size_t bitIndex, AZ::u8 numBits, AZ::u32 value)
+        {
+            const size_t wordIndex = bitIndex >> 5;
+            const AZ::u32 shift = static_cast<AZ::u32>(bitIndex & 31);
+            words[wordIndex] |= value << shift;
+            if (shift + numBits > 32)
+            {
+                words[wordIndex + 1] |= value >> (32 - shift);
+            }
+        }
+
+        AZ::u32 Quantize(float value, float rangeMin, float rangeExtent, AZ::u8 bitsPerComponent)
+        {
+            if (rangeExtent <= 0.0f)
+            {
+                return 0;
+            }
+
+            const float normalized = AZ::GetClamp((value - rangeMin) / rangeExtent, 0.0f, 1.0f);
+            return static_cast<AZ::u32>(normalized * static_cast<float>(GetMaxQuantizedValue(bitsPerComponent)) + 0.5f);
+        }
+
+        float Dequantize(AZ::u32 quantized, float rangeMin, float rangeExtent, AZ::u8 bitsPerComponent)
+        {
+            return rangeMin + rangeExtent * (static_cast<float>(quantized) / static_cast<float>(GetMaxQuantizedValue(bitsPerComponent)));
+        }
+
+        void CalculateRange(const AZStd::vector<AZ::Vector4>& values, AZ::u8 numComponents, AZ::Vector4& outMin, AZ::Vector4& outExtent)
+        {
+            outMin = AZ::Vector4::CreateZero();
+            outExtent = AZ::Vector4::CreateZero();
+            if (values.empty())
+            {
+                return;
+            }
+
+            AZ::Vector4 minValue = values[0];
+            AZ::Vector4 maxValue = values[0];
+            for (const AZ::Vector4& value : values)
+            {
+                minValue = minValue.GetMin(value);
+                maxValue = maxValue.GetMax(value);
+            }
+
+            for (AZ::u8 c = 0; c < numComponents; ++c)
+            {
+                outMin.SetElement(c, minValue.GetElement(c));
+                outExtent.SetElement(c, maxValue.GetElement(c) - minValue.GetElement(c));
+            }
+        }
+
+        // Calculate the largest error of any component when quantizing the values with the given number of bits per component.
+        float CalculateQuantizationError(const AZStd::vector<AZ::Vector4>& values, AZ::u8 numComponents, AZ::u8 bitsPerComponent)
+        {
+            AZ::Vector4 rangeMin;
+            AZ::Vector4 rangeExtent;
+            CalculateRange(values, numComponents, rangeMin, rangeExtent);
+
+            float maxError = 0.0f;
+            for (const AZ::Vector4& value : values)
+            {
+                for (AZ::u8 c = 0; c < numComponents; ++c)
+                {
+                    const float original = value.GetElement(c);
+                    const AZ::u32 quantized = Quantize(original, rangeMin.GetElement(c), rangeExtent.GetElement(c), bitsPerComponent);
+                    const float error = AZ::GetAbs(Dequantize(quantized, rangeMin.GetElement(c), rangeExtent.GetElement(c), bitsPerComponent) - original);
+                    maxError = AZ::GetMax(maxError, error);
+                }
+            }
+
+            return maxError;
+        }
+
+        bool IsConstantTrack(const AZStd::vector<AZ::Vector4>& values, AZ::u8 numComponents, float maxError)
+        {
+            AZ::Vector4 rangeMin;
+            AZ::Vector4 rangeExtent;
+            CalculateRange(values, numComponents, rangeMin, rangeExtent);
+            for (AZ::u8 c = 0; c < numComponents; ++c)
+            {
+                if (rangeExtent.GetElement(c) > maxError)
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        // Find the smallest number of bits per component that keeps the quantization error within the given limit.
+        AZ::u8 CalculateBitsPerComponent(const AZStd::vector<AZ::Vector4>& values, AZ::u8 numComponents, float maxError)
+        {
+            for (AZ::u8 bits = CompressedMotionData::s_minBitsPerComponent; bits < CompressedMotionData::s_maxBitsPerComponent; ++bits)
+            {
+                if (CalculateQuantizationError(values, numComponents, bits) <= maxError)
+                {
+                    return bits;
+                }
+            }
+
+            return CompressedMotionData::s_maxBitsPerComponent;
+        }
+
+        AZ::Vector4 ToVector4(const AZ::Quaternion& rotation)
+        {
+            return AZ::Vector4(rotation.GetX(), rotation.GetY(), rotation.GetZ(), rotation.GetW());
+        }
+
+        AZ::Quaternion ToQuaternion(const AZ::Vector4& value)
+        {
+            return AZ::Quaternion(value.GetX(), value.GetY(), value.GetZ(), value.GetW());
+        }
+    } // namespace
+
+    CompressedMotionData::~CompressedMotionData()
+    {
+        ClearAllData();
+    }
+
+    MotionData* CompressedMotionData::CreateNew() const
+    {
+        return aznew CompressedMotionData();
+    }
+
+    const char* CompressedMotionData::GetSceneSettingsName() const
+    {
+        return "Compressed Keyframes (smallest, slower)";
+    }
+
+    void CompressedMotionData::InitFromNonUniformData(const NonUniformMotionData* motionData, bool keepSameSampleRate, float newSampleRate, [[maybe_unused]] bool updateDuration)
+    {
+        AZ_Assert(newSampleRate > 0.0f, "Expected the sample rate to be larger than zero.");
+        SetSampleRate(keepSameSampleRate ? motionData->GetSampleRate() : newSampleRate);
+
+        // Calculate the sample spacing and number of samples required.
+        float sampleSpacing = 0.0f;
+        size_t numSamples = 0;
+        MotionData::CalculateSampleInformation(motionData->GetDuration(), m_sampleRate, numSamples, sampleSpacing);
+
+        InitSettings initSettings;
+        initSettings.m_numJoints = motionData->GetNumJoints();
+        initSettings.m_numMorphs = motionData->GetNumMorphs();
+        initSettings.m_numFloats = motionData->GetNumFloats();
+        initSettings.m_sampleRate = m_sampleRate;
+        initSettings.m_numSamples = numSamples;
+        Init(initSettings);
+        CopyBaseMotionData(motionData);
+
+        // Resample the animated tracks, they are quantized at the highest precision until the data gets optimized.
+        AZStd::vector<TrackSamples> tracks;
+        const auto addTrack = [this, &tracks](AZ::u8 numComponents) -> AZ::u32
+        {
+            TrackSamples& track = tracks.emplace_back();
+            track.m_numComponents = numComponents;
+            track.m_values.resize(m_numSamples);
+            return static_cast<AZ::u32>(tracks.size() - 1);
+        };
+
+        // Joints.
+        for (size_t i = 0; i < initSettings.m_numJoints; ++i)
+        {
+            if (!motionData->IsJointAnimated(i))
+            {
+                continue;
+            }
+
+            JointData& jointData = m_jointData[i];
+            if (motionData->IsJointPositionAnimated(i)) { jointData.m_positionTrack = addTrack(3); }
+            if (motionData->IsJointRotationAnimated(i)) { jointData.m_rotationTrack = addTrack(4); }
+            EMFX_SCALECODE
+            (
+                if (motionData->IsJointScaleAnimated(i)) { jointData.m_scaleTrack = addTrack(3); }
+            )
+
+            AZ::Quaternion lastRotation = AZ::Quaternion::CreateIdentity();
+            for (size_t s = 0; s < m_numSamples; ++s)
+            {
+                const float keyTime = s * sampleSpacing;
+                const Transform transform = motionData->SampleJointTransform(keyTime, i);
+                if (jointData.m_positionTrack != InvalidIndex32)
+                {
+                    tracks[jointData.m_positionTrack].m_values[s] = AZ::Vector4::CreateFromVector3(transform.mPosition);
+                }
+
+                if (jointData.m_rotationTrack != InvalidIndex32)
+                {
+                    // Keep the rotations in the same hemisphere, so the ranges stay small and interpolation takes the shortest path.
+                    AZ::Quaternion rotation = transform.mRotation.GetNormalized();
+                    if (s > 0 && lastRotation.Dot(rotation) < 0.0f)
+                    {
+                        rotation = -rotation;
+                    }
+                    lastRotation = rotation;
+                    tracks[jointData.m_rotationTrack].m_values[s] = ToVector4(rotation);
+                }
+
+                EMFX_SCALECODE
+                (
+                    if (jointData.m_scaleTrack != InvalidIndex32)
+                    {
+                        tracks[jointData.m_scaleTrack].m_values[s] = AZ::Vector4::CreateFromVector3(transform.mScale);
+                    }
+                )
+            }
+        }
+
+        // Morphs.
+        for (size_t i = 0; i < initSettings.m_numMorphs; ++i)
+        {
+            if (!motionData->IsMorphAnimated(i))
+            {
+                continue;
+            }
+
+            m_morphData[i].m_track = addTrack(1);
+            for (size_t s = 0; s < m_numSamples; ++s)
+            {
+                const float keyTime = s * sampleSpacing;
+                tracks[m_morphData[i].m_track].m_values[s] = AZ::Vector4(motionData->SampleMorph(keyTime, i));
+            }
+        }
+
+        // Floats.
+        for (size_t i = 0; i < initSettings.m_numFloats; ++i)
+        {
+            if (!motionData->IsFloatAnimated(i))
+            {
+                continue;
+            }
+
+            m_floatData[i].m_track = addTrack(1);
+            for (size_t s = 0; s < m_numSamples; ++s)
+            {
+                const float keyTime = s * sampleSpacing;
+                tracks[m_floatData[i].m_track].m_values[s] = AZ::Vector4(motionData->SampleFloat(keyTime, i));
+            }
+        }
+
+        Encode(tracks);
+    }
+
+    void CompressedMotionData::Optimize(const OptimizeSettings& settings)
+    {
+        AZStd::vector<TrackSamples> tracks = DecodeAllTracks();
+
+        // Remove the tracks that stay close to a constant value, and pick the smallest bit rate for the others.
+        // Returns false when the track got removed.
+        const auto optimizeTrack = [&tracks](AZ::u32& trackIndex, float maxError) -> bool
+        {
+            TrackSamples& track = tracks[trackIndex];
+            if (IsConstantTrack(track.m_values, track.m_numComponents, maxError))
+            {
+                return false;
+            }
+
+            track.m_bitsPerComponent = CalculateBitsPerComponent(track.m_values, track.m_numComponents, maxError);
+            return true;
+        };
+
+        // Joints.
+        for (size_t i = 0; i < m_jointData.size(); ++i)
+        {
+            float maxPosError = settings.m_maxPosError;
+            float maxRotError = settings.m_maxRotError;
+            float maxScaleError = settings.m_maxScaleError;
+            if (AZStd::find(settings.m_jointIgnoreList.begin(), settings.m_jointIgnoreList.end(), i) != settings.m_jointIgnoreList.end())
+            {
+                maxPosError = 0.00001f;
+                maxRotError = 0.00001f;
+                maxScaleError = 0.00001f;
+            }
+
+            JointData& jointData = m_jointData[i];
+            if (jointData.m_positionTrack != InvalidIndex32 && !optimizeTrack(jointData.m_positionTrack, maxPosError))
+            {
+                SetJointStaticPosition(i, tracks[jointData.m_positionTrack].m_values[0].GetAsVector3());
+                jointData.m_positionTrack = InvalidIndex32;
+            }
+
+            // The rotation error is in degrees. An error e in each quaternion component rotates by at most about 4e radians.
+            const float maxRotComponentError = AZ::DegToRad(maxRotError) * 0.25f;
+            if (jointData.m_rotationTrack != InvalidIndex32 && !optimizeTrack(jointData.m_rotationTrack, maxRotComponentError))
+            {
+                SetJointStaticRotation(i, ToQuaternion(tracks[jointData.m_rotationTrack].m_values[0]).GetNormalized());
+                jointData.m_rotationTrack = InvalidIndex32;
+            }
+
+            EMFX_SCALECODE
+            (
+                if (jointData.m_scaleTrack != InvalidIndex32 && !optimizeTrack(jointData.m_scaleTrack, maxScaleError))
+                {
+                    SetJointStaticScale(i, tracks[jointData.m_scaleTrack].m_values[0].GetAsVector3());
+                    jointData.m_scaleTrack = InvalidIndex32;
+                }
+            )
+        }
+
+        // Morphs.
+        for (size_t i = 0; i < m_morphData.size(); ++i)
+        {
+            FloatData& morphData = m_morphData[i];
+            if (morphData.m_track == InvalidIndex32 ||
+                AZStd::find(settings.m_morphIgnoreList.begin(), settings.m_morphIgnoreList.end(), i) != settings.m_morphIgnoreList.end())
+            {
+                continue;
+            }
+
+            if (!optimizeTrack(morphData.m_track, settings.m_maxMorphError))
+            {
+                SetMorphStaticValue(i, tracks[morphData.m_track].m_values[0].GetX());
+                morphData.m_track = InvalidIndex32;
+            }
+        }
+
+        // Floats.
+        for (size_t i = 0; i < m_floatData.size(); ++i)
+        {
+            FloatData& floatData = m_floatData[i];
+            if (floatData.m_track == InvalidIndex32 ||
+                AZStd::find(settings.m_floatIgnoreList.begin(), settings.m_floatIgnoreList.end(), i) != settings.m_floatIgnoreList.end())
+            {
+                continue;
+            }
+
+            if (!optimizeTrack(floatData.m_track, settings.m_maxFloatError))
+            {
+                SetFloatStaticValue(i, tracks[floatData.m_track].m_values[0].GetX());
+                floatData.m_track = InvalidIndex32;
+            }
+        }
+
+        Encode(tracks);
+
+        if (settings.m_updateDuration)
+        {
+            UpdateDuration();
+        }
+    }
+
+    void CompressedMotionData::Encode(const AZStd::vector<TrackSamples>& tracks)
+    {
+        // Give the referenced tracks their place in the frame, in the order they get sampled in.
+        AZStd::vector<Track> newTracks;
+        AZStd::vector<const TrackSamples*> newTrackSamples;
+        size_t numBitsPerSample = 0;
+        const auto addTrack = [&](AZ::u32& trackIndex)
+        {
+            if (trackIndex == InvalidIndex32)
+            {
+                return;
+            }
+
+            const TrackSamples& samples = tracks[trackIndex];
+            AZ_Assert(samples.m_values.size() == m_numSamples, "Expected the track to have a value for each sample.");
+            Track& track = newTracks.emplace_back();
+            track.m_numComponents = samples.m_numComponents;
+            track.m_bitsPerComponent = samples.m_bitsPerComponent;
+            track.m_bitOffset = static_cast<AZ::u32>(numBitsPerSample);
+            CalculateRange(samples.m_values, samples.m_numComponents, track.m_rangeMin, track.m_rangeExtent);
+            numBitsPerSample += samples.m_numComponents * samples.m_bitsPerComponent;
+
+            trackIndex = static_cast<AZ::u32>(newTrackSamples.size());
+            newTrackSamples.emplace_back(&samples);
+        };
+
+        for (JointData& jointData : m_jointData)
+        {
+            addTrack(jointData.m_positionTrack);
+            addTrack(jointData.m_rotationTrack);
+            EMFX_SCALECODE
+            (
+                addTrack(jointData.m_scaleTrack);
+            )
+        }
+        for (FloatData& morphData : m_morphData)
+        {
+            addTrack(morphData.m_track);
+        }
+        for (FloatData& floatData : m_floatData)
+        {
+            addTrack(floatData.m_track);
+        }
+
+        // Quantize the samples, frame after frame.
+        m_numBitsPerSample = numBitsPerSample;
+        m_bits.clear();
+        m_bits.resize((m_numSamples * m_numBitsPerSample + 31) / 32 + 1, 0); // One extra word, so a read never goes past the end.
+        for (size_t trackIndex = 0; trackIndex < newTracks.size(); ++trackIndex)
+        {
+            const Track& track = newTracks[trackIndex];
+            const AZStd::vector<AZ::Vector4>& values = newTrackSamples[trackIndex]->m_values;
+            for (size_t s = 0; s < m_numSamples; ++s)
+            {
+                size_t bitIndex = s * m_numBitsPerSample + track.m_bitOffset;
+                for (AZ::u8 c = 0; c < track.m_numComponents; ++c)
+                {
+                    const AZ::u32 quantized = Quantize(values[s].GetElement(c), track.m_rangeMin.GetElement(c), track.m_rangeExtent.GetElement(c), track.m_bitsPerComponent);
+                    WriteBits(m_bits.data(), bitIndex, track.m_bitsPerComponent, quantized);
+                    bitIndex += track.m_bitsPerComponent;
+                }
+            }
+        }
+
+        m_tracks = AZStd::move(newTracks);
+    }
+
+    void CompressedMotionData::DecodeTrack(AZ::u32 trackIndex, TrackSamples& outSamples) const
+    {
+        const Track& track = m_tracks[trackIndex];
+        outSamples.m_numComponents = track.m_numComponents;
+        outSamples.m_bitsPerComponent = track.m_bitsPerComponent;
+        outSamples.m_values.resize(m_numSamples);
+        for (size_t s = 0; s < m_numSamples; ++s)
+        {
+            outSamples.m_values[s] = DecodeSample(track, s * m_numBitsPerSample);
+        }
+    }
+
+    AZStd::vector<CompressedMotionData::TrackSamples> CompressedMotionData::DecodeAllTracks() const
+    {
+        AZStd::vector<TrackSamples> tracks(m_tracks.size());
+        for (size_t i = 0; i < m_tracks.size(); ++i)
+        {
+            DecodeTrack(static_cast<AZ::u32>(i), tracks[i]);
+        }
+        return tracks;
+    }
+
+    void CompressedMotionData::Rebuild()
+    {
+        Encode(DecodeAllTracks());
+    }
+
+    AZ::Vector4 CompressedMotionData::DecodeSample(const Track& track, size_t frameBitOffset) const
+    {
+        AZ::Vector4 quantized = AZ::Vector4::CreateZero();
+        size_t bitIndex = frameBitOffset + track.m_bitOffset;
+        for (AZ::u8 c = 0; c < track.m_numComponents; ++c)
+        {
+            quantized.SetElement(c, static_cast<float>(ReadBits(m_bits.data(), bitIndex, track.m_bitsPerComponent)));
+            bitIndex += track.m_bitsPerComponent;
+        }
+
+        const float invMaxQuantizedValue = 1.0f / static_cast<float>(GetMaxQuantizedValue(track.m_bitsPerComponent));
+        return track.m_rangeMin + track.m_rangeExtent * (quantized * invMaxQuantizedValue);
+    }
+
+    AZ::Vector4 CompressedMotionData::SampleTrack(AZ::u32 trackIndex, size_t frameBitOffsetA, size_t frameBitOffsetB, float t) const
+    {
+        const Track& track = m_tracks[trackIndex];
+        return DecodeSample(track, frameBitOffsetA).Lerp(DecodeSample(track, frameBitOffsetB), t);
+    }
+
+    AZ::Quaternion CompressedMotionData::SampleRotationTrack(AZ::u32 trackIndex, size_t frameBitOffsetA, size_t frameBitOffsetB, float t) const
+    {
+        const Track& track = m_tracks[trackIndex];
+        return ToQuaternion(DecodeSample(track, frameBitOffsetA)).NLerp(ToQuaternion(DecodeSample(track, frameBitOffsetB)), t);
+    }
+
+    Transform CompressedMotionData::SampleJoint(size_t jointDataIndex, size_t frameBitOffsetA, size_t frameBitOffsetB, float t) const
+    {
+        const StaticJointData& staticJointData = m_staticJointData[jointDataIndex];
+        const JointData& jointData = m_jointData[jointDataIndex];
+
+        Transform result;
+        result.mPosition = (jointData.m_positionTrack != InvalidIndex32) ? SampleTrack(jointData.m_positionTrack, frameBitOffsetA, frameBitOffsetB, t).GetAsVector3() : staticJointData.m_staticTransform.mPosition;
+        result.mRotation = (jointData.m_rotationTrack != InvalidIndex32) ? SampleRotationTrack(jointData.m_rotationTrack, frameBitOffsetA, frameBitOffsetB, t) : staticJointData.m_staticTransform.mRotation;
+#ifndef EMFX_SCALE_DISABLED
+        result.mScale = (jointData.m_scaleTrack != InvalidIndex32) ? SampleTrack(jointData.m_scaleTrack, frameBitOffsetA, frameBitOffsetB, t).GetAsVector3() : staticJointData.m_staticTransform.mScale;
+#endif
+        return result;
+    }
+
+    void CompressedMotionData::CalculateFrameBitOffsets(float sampleTime, size_t& frameBitOffsetA, size_t& frameBitOffsetB, float& t) const
+    {
+        if (m_numSamples == 0)
+        {
+            frameBitOffsetA = 0;
+            frameBitOffsetB = 0;
+            t = 0.0f;
+            return;
+        }
+
+        size_t indexA;
+        size_t indexB;
+        CalculateInterpolationIndicesUniform(sampleTime, m_sampleSpacing, m_duration, m_numSamples, indexA, indexB, t);
+        frameBitOffsetA = indexA * m_numBitsPerSample;
+        frameBitOffsetB = indexB * m_numBitsPerSample;
+    }
+
+    Transform CompressedMotionData::SampleJointTransform(const SampleSettings& settings, AZ::u32 jointSkeletonIndex) const
+    {
+        const Actor* actor = settings.m_actorInstance->GetActor();
+        const MotionLinkData* motionLinkData = FindMotionLinkData(actor);
+
+        const AZ::u32 transformDataIndex = motionLinkData->GetJointDataLinks()[jointSkeletonIndex];
+        if (m_additive && transformDataIndex == InvalidIndex32)
+        {
+            return Transform::CreateIdentity();
+        }
+
+        // Calculate the frames to interpolate between, and the interpolation fraction.
+        float t;
+        size_t frameBitOffsetA;
+        size_t frameBitOffsetB;
+        CalculateFrameBitOffsets(settings.m_sampleTime, frameBitOffsetA, frameBitOffsetB, t);
+
+        const Skeleton* skeleton = actor->GetSkeleton();
+        const bool inPlace = (settings.m_inPlace && skeleton->GetNode(jointSkeletonIndex)->GetIsRootNode());
+
+        // Sample the interpolated data.
+        Transform result;
+        if (transformDataIndex != InvalidIndex32 && !inPlace)
+        {
+            result = SampleJoint(transformDataIndex, frameBitOffsetA, frameBitOffsetB, t);
+        }
+        else
+        {
+            if (settings.m_inputPose && !inPlace)
+            {
+                result = settings.m_inputPose->GetLocalSpaceTransform(jointSkeletonIndex);
+            }
+            else
+            {
+                result = settings.m_actorInstance->GetTransformData()->GetBindPose()->GetLocalSpaceTransform(jointSkeletonIndex);
+            }
+        }
+
+        // Apply retargeting.
+        if (settings.m_retarget)
+        {
+            BasicRetarget(settings.m_actorInstance, motionLinkData, jointSkeletonIndex, result);
+        }
+
+        // Apply runtime motion mirroring.
+        if (settings.m_mirror && actor->GetHasMirrorInfo())
+        {
+            const Pose* bindPose = settings.m_actorInstance->GetTransformData()->GetBindPose();
+            const Actor::NodeMirrorInfo& mirrorInfo = actor->GetNodeMirrorInfo(jointSkeletonIndex);
+            Transform mirrored = bindPose->GetLocalSpaceTransform(jointSkeletonIndex);
+            AZ::Vector3 mirrorAxis = AZ::Vector3::CreateZero();
+            mirrorAxis.SetElement(mirrorInfo.mAxis, 1.0f);
+            const AZ::u16 motionSource = actor->GetNodeMirrorInfo(jointSkeletonIndex).mSourceNode;
+            mirrored.ApplyDeltaMirrored(bindPose->GetLocalSpaceTransform(motionSource), result, mirrorAxis, mirrorInfo.mFlags);
+            result = mirrored;
+        }
+
+        return result;
+    }
+
+    void CompressedMotionData::SamplePose(const SampleSettings& settings, Pose* outputPose) const
+    {
+        AZ_Assert(settings.m_actorInstance, "Expecting a valid actor instance.");
+        const Actor* actor = settings.m_actorInstance->GetActor();
+        const MotionLinkData* motionLinkData = FindMotionLinkData(actor);
+
+        // The frames to interpolate between are the same for all joints, only decode the two frames of bits for each of them.
+        float t;
+        size_t frameBitOffsetA;
+        size_t frameBitOffsetB;
+        CalculateFrameBitOffsets(settings.m_sampleTime, frameBitOffsetA, frameBitOffsetB, t);
+
+        const AZStd::vector<AZ::u32>& jointLinks = motionLinkData->GetJointDataLinks();
+        const ActorInstance* actorInstance = settings.m_actorInstance;
+        const Skeleton* skeleton = actor->GetSkeleton();
+        const Pose* bindPose = actorInstance->GetTransformData()->GetBindPose();
+        const AZ::u32 numNodes = actorInstance->GetNumEnabledNodes();
+        for (AZ::u32 i = 0; i < numNodes; ++i)
+        {
+            const AZ::u32 skeletonJointIndex = actorInstance->GetEnabledNode(i);
+            const bool inPlace = (settings.m_inPlace && skeleton->GetNode(skeletonJointIndex)->GetIsRootNode());
+
+            // Sample the interpolated data.
+            Transform result;
+            const AZ::u32 jointDataIndex = jointLinks[skeletonJointIndex];
+            if (jointDataIndex != InvalidIndex32 && !inPlace)
+            {
+                result = SampleJoint(jointDataIndex, frameBitOffsetA, frameBitOffsetB, t);
+            }
+            else
+            {
+                if (m_additive && jointDataIndex == InvalidIndex32)
+                {
+                    result = Transform::CreateIdentity();
+                }
+                else
+                {
+                    if (settings.m_inputPose && !inPlace)
+                    {
+                        result = settings.m_inputPose->GetLocalSpaceTransform(skeletonJointIndex);
+                    }
+                    else
+                    {
+                        result = bindPose->GetLocalSpaceTransform(skeletonJointIndex);
+                    }
+                }
+            }
+
+            // Apply retargeting.
+            if (settings.m_retarget)
+            {
+                BasicRetarget(settings.m_actorInstance, motionLinkData, skeletonJointIndex, result);
+            }
+
+            outputPose->SetLocalSpaceTransformDirect(skeletonJointIndex, result);
+        }
+
+        // Apply runtime motion mirroring.
+        if (settings.m_mirror && actor->GetHasMirrorInfo())
+        {
+            outputPose->Mirror(motionLinkData);
+        }
+
+        // Output morph target weights.
+        const MorphSetupInstance* morphSetup = actorInstance->GetMorphSetupInstance();
+        const AZ::u32 numMorphTargets = morphSetup->GetNumMorphTargets();
+        for (AZ::u32 i = 0; i < numMorphTargets; ++i)
+        {
+            const AZ::u32 morphTargetId = morphSetup->GetMorphTarget(i)->GetID();
+            const AZ::Outcome<size_t> morphIndex = FindMorphIndexByNameId(morphTargetId);
+            if (morphIndex.IsSuccess())
+            {
+                const size_t realIndex = morphIndex.GetValue();
+                const AZ::u32 trackIndex = m_morphData[realIndex].m_track;
+                if (trackIndex != InvalidIndex32)
+                {
+                    outputPose->SetMorphWeight(i, SampleTrack(trackIndex, frameBitOffsetA, frameBitOffsetB, t).GetX());
+                }
+                else
+                {
+                    outputPose->SetMorphWeight(i, m_staticMorphData[realIndex].m_staticValue);
+                }
+            }
+            else
+            {
+                if (settings.m_inputPose)
+                {
+                    outputPose->SetMorphWeight(i, settings.m_inputPose->GetMorphWeight(i));
+                }
+                else
+                {
+                    outputPose->SetMorphWeight(i, bindPose->GetMorphWeight(i));
+                }
+            }
+        }
+
+        // Since we used the SetLocalTransformDirect, make sure we manually invalidate all model space transforms.
+        outputPose->InvalidateAllModelSpaceTransforms();
+    }
+
+    float CompressedMotionData::SampleMorph(float sampleTime, size_t morphDataIndex) const
+    {
+        const AZ::u32 trackIndex = m_morphData[morphDataIndex].m_track;
+        if (trackIndex == InvalidIndex32)
+        {
+            return m_staticMorphData[morphDataIndex].m_staticValue;
+        }
+
+        float t;
+        size_t frameBitOffsetA;
+        size_t frameBitOffsetB;
+        CalculateFrameBitOffsets(sampleTime, frameBitOffsetA, frameBitOffsetB, t);
+        return SampleTrack(trackIndex, frameBitOffsetA, frameBitOffsetB, t).GetX();
+    }
+
+    float CompressedMotionData::SampleFloat(float sampleTime, size_t floatDataIndex) const
+    {
+        const AZ::u32 trackIndex = m_floatData[floatDataIndex].m_track;
+        if (trackIndex == InvalidIndex32)
+        {
+            return m_staticFloatData[floatDataIndex].m_staticValue;
+        }
+
+        float t;
+        size_t frameBitOffsetA;
+        size_t frameBitOffsetB;
+        CalculateFrameBitOffsets(sampleTime, frameBitOffsetA, frameBitOffsetB, t);
+        return SampleTrack(trackIndex, frameBitOffsetA, frameBitOffsetB, t).GetX();
+    }
+
+    Transform CompressedMotionData::SampleJointTransform(float sampleTime, size_t jointDataIndex) const
+    {
+        float t;
+        size_t frameBitOffsetA;
+        size_t frameBitOffsetB;
+        CalculateFrameBitOffsets(sampleTime, frameBitOffsetA, frameBitOffsetB, t);
+        return SampleJoint(jointDataIndex, frameBitOffsetA, frameBitOffsetB, t);
+    }
+
+    AZ::Vector3 CompressedMotionData::SampleJointPosition(float sampleTime, size_t jointDataIndex) const
+    {
+        const AZ::u32 trackIndex = m_jointData[jointDataIndex].m_positionTrack;
+        if (trackIndex == InvalidIndex32)
+        {
+            return m_staticJointData[jointDataIndex].m_staticTransform.mPosition;
+        }
+
+        float t;
+        size_t frameBitOffsetA;
+        size_t frameBitOffsetB;
+        CalculateFrameBitOffsets(sampleTime, frameBitOffsetA, frameBitOffsetB, t);
+        return SampleTrack(trackIndex, frameBitOffsetA, frameBitOffsetB, t).GetAsVector3();
+    }
+
+    AZ::Quaternion CompressedMotionData::SampleJointRotation(float sampleTime, size_t jointDataIndex) const
+    {
+        const AZ::u32 trackIndex = m_jointData[jointDataIndex].m_rotationTrack;
+        if (trackIndex == InvalidIndex32)
+        {
+            return m_staticJointData[jointDataIndex].m_staticTransform.mRotation;
+        }
+
+        float t;
+        size_t frameBitOffsetA;
+        size_t frameBitOffsetB;
+        CalculateFrameBitOffsets(sampleTime, frameBitOffsetA, frameBitOffsetB, t);
+        return SampleRotationTrack(trackIndex, frameBitOffsetA, frameBitOffsetB, t);
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    AZ::Vector3 CompressedMotionData::SampleJointScale(float sampleTime, size_t jointDataIndex) const
+    {
+        const AZ::u32 trackIndex = m_jointData[jointDataIndex].m_scaleTrack;
+        if (trackIndex == InvalidIndex32)
+        {
+            return m_staticJointData[jointDataIndex].m_staticTransform.mScale;
+        }
+
+        float t;
+        size_t frameBitOffsetA;
+        size_t frameBitOffsetB;
+        CalculateFrameBitOffsets(sampleTime, frameBitOffsetA, frameBitOffsetB, t);
+        return SampleTrack(trackIndex, frameBitOffsetA, frameBitOffsetB, t).GetAsVector3();
+    }
+#endif
+
+    void CompressedMotionData::Init(const InitSettings& settings)
+    {
+        if (settings.m_numSamples > 0)
+        {
+            AZ_Error("EMotionFX", settings.m_sampleRate > 0.0f, "Sample rate should be larger than zero.");
+        }
+        Clear();
+        Resize(settings.m_numJoints, settings.m_numMorphs, settings.m_numFloats);
+        m_numSamples = settings.m_numSamples;
+        SetSampleRate(settings.m_sampleRate);
+        UpdateDuration();
+        Encode({});
+    }
+
+    void CompressedMotionData::ResizeSampleData(size_t numJoints, size_t numMorphs, size_t numFloats)
+    {
+        m_jointData.resize(numJoints);
+        m_morphData.resize(numMorphs);
+        m_floatData.resize(numFloats);
+        Rebuild();
+    }
+
+    void CompressedMotionData::AddJointSampleData([[maybe_unused]] size_t jointDataIndex)
+    {
+        AZ_Assert(jointDataIndex == m_jointData.size(), "Expected the size of the jointData vector to be a different size. Is it in sync with the m_staticJointData vector?");
+        m_jointData.emplace_back();
+    }
+
+    void CompressedMotionData::AddMorphSampleData([[maybe_unused]] size_t morphDataIndex)
+    {
+        AZ_Assert(morphDataIndex == m_morphData.size(), "Expected the size of the morphData vector to be a different size. Is it in sync with the m_staticMorphData vector?");
+        m_morphData.emplace_back();
+    }
+
+    void CompressedMotionData::AddFloatSampleData([[maybe_unused]] size_t floatDataIndex)
+    {
+        AZ_Assert(floatDataIndex == m_floatData.size(), "Expected the size of the floatData vector to be a different size. Is it in sync with the m_staticFloatData vector?");
+        m_floatData.emplace_back();
+    }
+
+    void CompressedMotionData::RemoveJointSampleData(size_t jointDataIndex)
+    {
+        m_jointData.erase(m_jointData.begin() + jointDataIndex);
+        Rebuild();
+    }
+
+    void CompressedMotionData::RemoveMorphSampleData(size_t morphDataIndex)
+    {
+        m_morphData.erase(m_morphData.begin() + morphDataIndex);
+        Rebuild();
+    }
+
+    void CompressedMotionData::RemoveFloatSampleData(size_t floatDataIndex)
+    {
+        m_floatData.erase(m_floatData.begin() + floatDataIndex);
+        Rebuild();
+    }
+
+    void CompressedMotionData::ClearAllData()
+    {
+        m_jointData.clear();
+        m_jointData.shrink_to_fit();
+        m_morphData.clear();
+        m_morphData.shrink_to_fit();
+        m_floatData.clear();
+        m_floatData.shrink_to_fit();
+        m_tracks.clear();
+        m_tracks.shrink_to_fit();
+        m_bits.clear();
+        m_bits.shrink_to_fit();
+
+        m_numBitsPerSample = 0;
+        m_numSamples = 0;
+    }
+
+    void CompressedMotionData::ScaleData(float scaleFactor)
+    {
+        for (const JointData& jointData : m_jointData)
+        {
+            if (jointData.m_positionTrack != InvalidIndex32)
+            {
+                Track& track = m_tracks[jointData.m_positionTrack];
+                track.m_rangeMin *= scaleFactor;
+                track.m_rangeExtent *= scaleFactor;
+            }
+        }
+    }
+
+    void CompressedMotionData::UpdateDuration()
+    {
+        m_duration = (m_numSamples > 0) ? (m_numSamples - 1) * m_sampleSpacing : 0.0f;
+    }
+
+    void CompressedMotionData::UpdateSampleSpacing()
+    {
+        if (m_sampleRate > AZ::Constants::FloatEpsilon)
+        {
+            m_sampleSpacing = 1.0f / m_sampleRate;
+        }
+        else
+        {
+            m_sampleSpacing = 0.0f;
+        }
+    }
+
+    void CompressedMotionData::SetSampleRate(float sampleRate)
+    {
+        MotionData::SetSampleRate(sampleRate);
+        UpdateSampleSpacing();
+    }
+
+    size_t CompressedMotionData::GetNumSamples() const
+    {
+        return m_numSamples;
+    }
+
+    float CompressedMotionData::GetSampleSpacing() const
+    {
+        return m_sampleSpacing;
+    }
+
+    size_t CompressedMotionData::GetNumTracks() const
+    {
+        return m_tracks.size();
+    }
+
+    AZ::u8 CompressedMotionData::GetTrackBitsPerComponent(size_t trackIndex) const
+    {
+        return m_tracks[trackIndex].m_bitsPerComponent;
+    }
+
+    size_t CompressedMotionData::GetNumBitsPerSample() const
+    {
+        return m_numBitsPerSample;
+    }
+
+    bool CompressedMotionData::IsJointPositionAnimated(size_t jointDataIndex) const
+    {
+        return m_jointData[jointDataIndex].m_positionTrack != InvalidIndex32;
+    }
+
+    bool CompressedMotionData::IsJointRotationAnimated(size_t jointDataIndex) const
+    {
+        return m_jointData[jointDataIndex].m_rotationTrack != InvalidIndex32;
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    bool CompressedMotionData::IsJointScaleAnimated(size_t jointDataIndex) const
+    {
+        return m_jointData[jointDataIndex].m_scaleTrack != InvalidIndex32;
+    }
+#endif
+
+    bool CompressedMotionData::IsJointAnimated(size_t jointDataIndex) const
+    {
+#ifndef EMFX_SCALE_DISABLED
+        return IsJointPositionAnimated(jointDataIndex) || IsJointRotationAnimated(jointDataIndex) || IsJointScaleAnimated(jointDataIndex);
+#else
+        return IsJointPositionAnimated(jointDataIndex) || IsJointRotationAnimated(jointDataIndex);
+#endif
+    }
+
+    bool CompressedMotionData::IsMorphAnimated(size_t morphDataIndex) const
+    {
+        return m_morphData[morphDataIndex].m_track != InvalidIndex32;
+    }
+
+    bool CompressedMotionData::IsFloatAnimated(size_t floatDataIndex) const
+    {
+        return m_floatData[floatDataIndex].m_track != InvalidIndex32;
+    }
+
+    void CompressedMotionData::ClearAllJointTransformSamples()
+    {
+        for (JointData& jointData : m_jointData)
+        {
+            jointData = JointData();
+        }
+        Rebuild();
+    }
+
+    void CompressedMotionData::ClearAllMorphSamples()
+    {
+        for (FloatData& morphData : m_morphData)
+        {
+            morphData.m_track = InvalidIndex32;
+        }
+        Rebuild();
+    }
+
+    void CompressedMotionData::ClearAllFloatSamples()
+    {
+        for (FloatData& floatData : m_floatData)
+        {
+            floatData.m_track = InvalidIndex32;
+        }
+        Rebuild();
+    }
+
+    void CompressedMotionData::ClearJointPositionSamples(size_t jointDataIndex)
+    {
+        m_jointData[jointDataIndex].m_positionTrack = InvalidIndex32;
+        Rebuild();
+    }
+
+    void CompressedMotionData::ClearJointRotationSamples(size_t jointDataIndex)
+    {
+        m_jointData[jointDataIndex].m_rotationTrack = InvalidIndex32;
+        Rebuild();
+    }
+
+#ifndef EMFX_SCALE_DISABLED
+    void CompressedMotionData::ClearJointScaleSamples(size_t jointDataIndex)
+    {
+        m_jointData[jointDataIndex].m_scaleTrack = InvalidIndex32;
+        Rebuild();
+    }
+#endif
+
+    void CompressedMotionData::ClearJointTransformSamples(size_t jointDataIndex)
+    {
+        m_jointData[jointDataIndex] = JointData();
+        Rebuild();
+    }
+
+    void CompressedMotionData::ClearMorphSamples(size_t morphDataIndex)
+    {
+        m_morphData[morphDataIndex].m_track = InvalidIndex32;
+        Rebuild();
+    }
+
+    void CompressedMotionData::ClearFloatSamples(size_t floatDataIndex)
+    {
+        m_floatData[floatDataIndex].m_track = InvalidIndex32;
+        Rebuild();
+    }
+
+
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // SERIALIZATION
+    ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    struct File_CompressedMotionData_Info
+    {
+        AZ::u32 m_numJoints = 0;
+        AZ::u32 m_numMorphs = 0;
+        AZ::u32 m_numFloats = 0;
+        AZ::u32 m_numSamples = 0;
+        float m_sampleRate = 30.0f;
+        AZ::u32 m_numTracks = 0;
+        AZ::u32 m_numBitsPerSample = 0;
+        AZ::u32 m_numWords = 0;
+
+        // Followed by:
+        // File_CompressedMotionData_Joint[m_numJoints]
+        // File_CompressedMotionData_Float[m_numMorphs]
+        // File_CompressedMotionData_Float[m_numFloats]
+        // File_CompressedMotionData_Track[m_numTracks]
+        // AZ::u32[m_numWords] : The quantized samples, frame after frame.
+    };
+
+    struct File_CompressedMotionData_Joint
+    {
+        FileFormat::File16BitQuaternion m_staticRot { 0, 0, 0, (1 << 15) - 1 };  // First frames rotation.
+        FileFormat::File16BitQuaternion m_bindPoseRot { 0, 0, 0, (1 << 15) - 1 };// Bind pose rotation.
+        FileFormat::FileVector3         m_staticPos { 0.0f, 0.0f, 0.0f };        // First frame position.
+        FileFormat::FileVector3         m_staticScale { 1.0f, 1.0f, 1.0f };      // First frame scale.
+        FileFormat::FileVector3         m_bindPosePos { 0.0f, 0.0f, 0.0f };      // Bind pose position.
+        FileFormat::FileVector3         m_bindPoseScale { 1.0f, 1.0f, 1.0f };    // Bind pose scale.
+        AZ::u32                         m_positionTrack = InvalidIndex32;        // The position track index, or InvalidIndex32 when not animated.
+        AZ::u32                         m_rotationTrack = InvalidIndex32;        // The rotation track index, or InvalidIndex32 when not animated.
+        AZ::u32                         m_scaleTrack = InvalidIndex32;           // The scale track index, or InvalidIndex32 when not animated.
+
+        // Followed by:
+        // string : The name of the joint.
+    };
+
+    struct File_CompressedMotionData_Float
+    {
+        float m_staticValue = 0.0f;         // The static (first frame) value.
+        AZ::u32 m_track = InvalidIndex32;   // The track index, or InvalidIndex32 when not animated.
+
+        // Followed by:
+        // String: The name of the channel.
+    };
+
+    struct File_CompressedMotionData_Track
+    {
+        float m_rangeMin[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        float m_rangeExtent[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        AZ::u32 m_bitOffset = 0;            // The offset of the track in the bits of a frame.
+        AZ::u8 m_numComponents = 0;
+        AZ::u8 m_bitsPerComponent = 0;
+        AZ::u8 m_padding[2] = { 0, 0 };
+    };
+    //---------------------------------------------------------------------------------------
+
+    namespace
+    {
+        bool SaveCompressedJoint(MCore::Stream* stream, const CompressedMotionData* motionData, size_t jointDataIndex, AZ::u32 positionTrack, AZ::u32 rotationTrack, AZ::u32 scaleTrack, const MotionData::SaveSettings& saveSettings)
+        {
+            File_CompressedMotionData_Joint jointChunk;
+            ExporterLib::CopyVector(jointChunk.m_staticPos, AZ::PackedVector3f(motionData->GetJointStaticPosition(jointDataIndex)));
+            ExporterLib::Copy16BitQuaternion(jointChunk.m_staticRot, motionData->GetJointStaticRotation(jointDataIndex));
+            ExporterLib::CopyVector(jointChunk.m_bindPosePos, AZ::PackedVector3f(motionData->GetJointBindPosePosition(jointDataIndex)));
+            ExporterLib::Copy16BitQuaternion(jointChunk.m_bindPoseRot, motionData->GetJointBindPoseRotation(jointDataIndex));
+#ifndef EMFX_SCALE_DISABLED
+            ExporterLib::CopyVector(jointChunk.m_staticScale, AZ::PackedVector3f(motionData->GetJointStaticScale(jointDataIndex)));
+            ExporterLib::CopyVector(jointChunk.m_bindPoseScale, AZ::PackedVector3f(motionData->GetJointBindPoseScale(jointDataIndex)));
+#endif
+            jointChunk.m_positionTrack = positionTrack;
+            jointChunk.m_rotationTrack = rotationTrack;
+            jointChunk.m_scaleTrack = scaleTrack;
+
+            if (saveSettings.m_logDetails)
+            {
+                MCore::LogDetailedInfo("- Motion Joint: %s", motionData->GetJointName(jointDataIndex).c_str());
+                MCore::LogDetailedInfo("   + Position Animated:     %s", (positionTrack != InvalidIndex32) ? "Yes" : "No");
+                MCore::LogDetailedInfo("   + Rotation Animated:     %s", (rotationTrack != InvalidIndex32) ? "Yes" : "No");
+                MCore::LogDetailedInfo("   + Scale Animated:        %s", (scaleTrack != InvalidIndex32) ? "Yes" : "No");
+            }
+
+            // Convert endian.
+            const MCore::Endian::EEndianType targetEndianType = saveSettings.m_targetEndianType;
+            ExporterLib::ConvertFileVector3(&jointChunk.m_staticPos, targetEndianType);
+            ExporterLib::ConvertFile16BitQuaternion(&jointChunk.m_staticRot, targetEndianType);
+            ExporterLib::ConvertFileVector3(&jointChunk.m_staticScale, targetEndianType);
+            ExporterLib::ConvertFileVector3(&jointChunk.m_bindPosePos, targetEndianType);
+            ExporterLib::ConvertFile16BitQuaternion(&jointChunk.m_bindPoseRot, targetEndianType);
+            ExporterLib::ConvertFileVector3(&jointChunk.m_bindPoseScale, targetEndianType);
+            ExporterLib::ConvertUnsignedInt(&jointChunk.m_positionTrack, targetEndianType);
+            ExporterLib::ConvertUnsignedInt(&jointChunk.m_rotationTrack, targetEndianType);
+            ExporterLib::ConvertUnsignedInt(&jointChunk.m_scaleTrack, targetEndianType);
+            if (stream->Write(&jointChunk, sizeof(File_CompressedMotionData_Joint)) == 0)
+            {
+                return false;
+            }
+
+            ExporterLib::SaveString(motionData->GetJointName(jointDataIndex), stream, targetEndianType);
+            return true;
+        }
+
+        bool SaveCompressedFloat(MCore::Stream* stream, const AZStd::string& channelName, float staticValue, AZ::u32 track, const MotionData::SaveSettings& saveSettings)
+        {
+            if (channelName.empty())
+            {
+                MCore::LogError("Cannot save float channel with empty name.");
+                return false;
+            }
+
+            if (saveSettings.m_logDetails)
+            {
+                MCore::LogDetailedInfo("    - Channel: '%s'", channelName.c_str());
+                MCore::LogDetailedInfo("       + Static Value = %f", staticValue);
+                MCore::LogDetailedInfo("       + IsAnimated   = %s", (track != InvalidIndex32) ? "Yes" : "No");
+            }
+
+            File_CompressedMotionData_Float floatChunk;
+            floatChunk.m_staticValue = staticValue;
+            floatChunk.m_track = track;
+
+            const MCore::Endian::EEndianType targetEndianType = saveSettings.m_targetEndianType;
+            ExporterLib::ConvertFloat(&floatChunk.m_staticValue, targetEndianType);
+            ExporterLib::ConvertUnsignedInt(&floatChunk.m_track, targetEndianType);
+            if (stream->Write(&floatChunk, sizeof(File_CompressedMotionData_Float)) == 0)
+            {
+                return false;
+            }
+
+            ExporterLib::SaveString(channelName, stream, targetEndianType);
+            return true;
+        }
+    } // namespace
+
+    size_t CompressedMotionData::CalcStreamSaveSizeInBytes([[maybe_unused]] const SaveSettings& saveSettings) const
+    {
+        size_t numBytes = sizeof(File_CompressedMotionData_Info);
+
+        const size_t numJoints = GetNumJoints();
+        for (size_t i = 0; i < numJoints; ++i)
+        {
+            numBytes += sizeof(File_CompressedMotionData_Joint);
+            numBytes += ExporterLib::GetStringChunkSize(GetJointName(i));
+        }
+
+        const size_t numMorphs = GetNumMorphs();
+        for (size_t i = 0; i < numMorphs; ++i)
+        {
+            numBytes += sizeof(File_CompressedMotionData_Float);
+            numBytes += ExporterLib::GetStringChunkSize(GetMorphName(i));
+        }
+
+        const size_t numFloats = GetNumFloats();
+        for (size_t i = 0; i < numFloats; ++i)
+        {
+            numBytes += sizeof(File_CompressedMotionData_Float);
+            numBytes += ExporterLib::GetStringChunkSize(GetFloatName(i));
+        }
+
+        numBytes += m_tracks.size() * sizeof(File_CompressedMotionData_Track);
+        numBytes += m_bits.size() * sizeof(AZ::u32);
+        return numBytes;
+    }
+
+    AZ::u32 CompressedMotionData::GetStreamSaveVersion() const
+    {
+        return 1;
+    }
+
+    bool CompressedMotionData::Save(MCore::Stream* stream, const SaveSettings& saveSettings) const
+    {
+        // Write the info chunk.
+        File_CompressedMotionData_Info info;
+        info.m_numJoints = static_cast<AZ::u32>(GetNumJoints());
+        info.m_numMorphs = static_cast<AZ::u32>(GetNumMorphs());
+        info.m_numFloats = static_cast<AZ::u32>(GetNumFloats());
+        info.m_numSamples = static_cast<AZ::u32>(GetNumSamples());
+        info.m_sampleRate = GetSampleRate();
+        info.m_numTracks = static_cast<AZ::u32>(m_tracks.size());
+        info.m_numBitsPerSample = static_cast<AZ::u32>(m_numBitsPerSample);
+        info.m_numWords = static_cast<AZ::u32>(m_bits.size());
+        const MCore::Endian::EEndianType targetEndianType = saveSettings.m_targetEndianType;
+        ExporterLib::ConvertUnsignedInt(&info.m_numJoints, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numMorphs, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numFloats, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numSamples, targetEndianType);
+        ExporterLib::ConvertFloat(&info.m_sampleRate, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numTracks, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numBitsPerSample, targetEndianType);
+        ExporterLib::ConvertUnsignedInt(&info.m_numWords, targetEndianType);
+        if (stream->Write(&info, sizeof(File_CompressedMotionData_Info)) == 0)
+        {
+            return false;
+        }
+
+        // Write the joints channels.
+        for (size_t i = 0; i < GetNumJoints(); ++i)
+        {
+            const JointData& jointData = m_jointData[i];
+#ifndef EMFX_SCALE_DISABLED
+            const AZ::u32 scaleTrack = jointData.m_scaleTrack;
+#else
+            const AZ::u32 scaleTrack = InvalidIndex32;
+#endif
+            if (!SaveCompressedJoint(stream, this, i, jointData.m_positionTrack, jointData.m_rotationTrack, scaleTrack, saveSettings))
+            {
+                return false;
+            }
+        }
+
+        // Write the morph channels.
+        for (size_t i = 0; i < GetNumMorphs(); ++i)
+        {
+            if (!SaveCompressedFloat(stream, GetMorphName(i), GetMorphStaticValue(i), m_morphData[i].m_track, saveSettings))
+            {
+                return false;
+            }
+        }
+
+        // Write the float channels.
+        for (size_t i = 0; i < GetNumFloats(); ++i)
+        {
+            if (!SaveCompressedFloat(stream, GetFloatName(i), GetFloatStaticValue(i), m_floatData[i].m_track, saveSettings))
+            {
+                return false;
+            }
+        }
+
+        // Write the tracks.
+        for (const Track& track : m_tracks)
+        {
+            File_CompressedMotionData_Track trackChunk;
+            track.m_rangeMin.StoreToFloat4(trackChunk.m_rangeMin);
+            track.m_rangeExtent.StoreToFloat4(trackChunk.m_rangeExtent);
+            trackChunk.m_bitOffset = track.m_bitOffset;
+            trackChunk.m_numComponents = track.m_numComponents;
+            trackChunk.m_bitsPerComponent = track.m_bitsPerComponent;
+            for (float& value : trackChunk.m_rangeMin)
+            {
+                ExporterLib::ConvertFloat(&value, targetEndianType);
+            }
+            for (float& value : trackChunk.m_rangeExtent)
+            {
+                ExporterLib::ConvertFloat(&value, targetEndianType);
+            }
+            ExporterLib::ConvertUnsignedInt(&trackChunk.m_bitOffset, targetEndianType);
+            if (stream->Write(&trackChunk, sizeof(File_CompressedMotionData_Track)) == 0)
+            {
+                return false;
+            }
+        }
+
+        // Write the quantized samples.
+        AZStd::vector<AZ::u32> words = m_bits;
+        for (AZ::u32& word : words)
+        {
+            ExporterLib::ConvertUnsignedInt(&word, targetEndianType);
+        }
+        if (!words.empty() && stream->Write(words.data(), words.size() * sizeof(AZ::u32)) == 0)
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    bool ReadCompressedVersion1(MCore::Stream* stream, CompressedMotionData* motionData, const MotionData::ReadSettings& readSettings,
+        AZStd::vector<AZ::u32>& outJointTracks, AZStd::vector<AZ::u32>& outMorphTracks, AZStd::vector<AZ::u32>& outFloatTracks,
+        File_CompressedMotionData_Info& outInfo)
+    {
+        // Read the info header.
+        File_CompressedMotionData_Info& info = outInfo;
+        if (stream->Read(&info, sizeof(File_CompressedMotionData_Info)) == 0)
+        {
+            return false;
+        }
+        const MCore::Endian::EEndianType sourceEndianType = readSettings.m_sourceEndianType;
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numJoints, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numMorphs, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numFloats, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numSamples, sourceEndianType);
+        MCore::Endian::ConvertFloat(&info.m_sampleRate, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numTracks, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numBitsPerSample, sourceEndianType);
+        MCore::Endian::ConvertUnsignedInt32(&info.m_numWords, sourceEndianType);
+
+        if (readSettings.m_logDetails)
+        {
+            MCore::LogDetailedInfo("- CompressedMotionData:");
+            MCore::LogDetailedInfo("  + NumJoints  = %d", info.m_numJoints);
+            MCore::LogDetailedInfo("  + NumMorphs  = %d", info.m_numMorphs);
+            MCore::LogDetailedInfo("  + NumFloats  = %d", info.m_numFloats);
+            MCore::LogDetailedInfo("  + NumTracks  = %d", info.m_numTracks);
+            MCore::LogDetailedInfo("  + SampleRate = %f", info.m_sampleRate);
+        }
+
+        CompressedMotionData::InitSettings initSettings;
+        initSettings.m_numJoints = info.m_numJoints;
+        initSettings.m_numMorphs = info.m_numMorphs;
+        initSettings.m_numFloats = info.m_numFloats;
+        initSettings.m_numSamples = info.m_numSamples;
+        initSettings.m_sampleRate = info.m_sampleRate;
+        motionData->Init(initSettings);
+
+        // Read all joints.
+        AZStd::string name;
+        outJointTracks.resize(motionData->GetNumJoints() * 3);
+        for (size_t i = 0; i < motionData->GetNumJoints(); ++i)
+        {
+            File_CompressedMotionData_Joint jointInfo;
+            if (stream->Read(&jointInfo, sizeof(File_CompressedMotionData_Joint)) == 0)
+            {
+                return false;
+            }
+
+            // Convert endian.
+            AZ::Vector3 staticPos(jointInfo.m_staticPos.mX, jointInfo.m_staticPos.mY, jointInfo.m_staticPos.mZ);
+            AZ::Vector3 staticScale(jointInfo.m_staticScale.mX, jointInfo.m_staticScale.mY, jointInfo.m_staticScale.mZ);
+            MCore::Compressed16BitQuaternion staticRot(jointInfo.m_staticRot.mX, jointInfo.m_staticRot.mY, jointInfo.m_staticRot.mZ, jointInfo.m_staticRot.mW);
+            AZ::Vector3 bindPosePos(jointInfo.m_bindPosePos.mX, jointInfo.m_bindPosePos.mY, jointInfo.m_bindPosePos.mZ);
+            AZ::Vector3 bindPoseScale(jointInfo.m_bindPoseScale.mX, jointInfo.m_bindPoseScale.mY, jointInfo.m_bindPoseScale.mZ);
+            MCore::Compressed16BitQuaternion bindPoseRot(jointInfo.m_bindPoseRot.mX, jointInfo.m_bindPoseRot.mY, jointInfo.m_bindPoseRot.mZ, jointInfo.m_bindPoseRot.mW);
+            MCore::Endian::ConvertVector3(&staticPos, sourceEndianType);
+            MCore::Endian::Convert16BitQuaternion(&staticRot, sourceEndianType);
+            MCore::Endian::ConvertVector3(&staticScale, sourceEndianType);
+            MCore::Endian::ConvertVector3(&bindPosePos, sourceEndianType);
+            MCore::Endian::Convert16BitQuaternion(&bindPoseRot, sourceEndianType);
+            MCore::Endian::ConvertVector3(&bindPoseScale, sourceEndianType);
+            MCore::Endian::ConvertUnsignedInt32(&jointInfo.m_positionTrack, sourceEndianType);
+            MCore::Endian::ConvertUnsignedInt32(&jointInfo.m_rotationTrack, sourceEndianType);
+            MCore::Endian::ConvertUnsignedInt32(&jointInfo.m_scaleTrack, sourceEndianType);
+
+            // Update the values.
+            motionData->SetJointStaticPosition(i, staticPos);
+            motionData->SetJointStaticRotation(i, staticRot.ToQuaternion().GetNormalized());
+            motionData->SetJointBindPosePosition(i, bindPosePos);
+            motionData->SetJointBindPoseRotation(i, bindPoseRot.ToQuaternion().GetNormalized());
+            EMFX_SCALECODE
+            (
+                motionData->SetJointStaticScale(i, staticScale);
+                motionData->SetJointBindPoseScale(i, bindPoseScale);
+            )
+
+            name = MotionData::ReadStringFromStream(stream, sourceEndianType);
+            motionData->SetJointName(i, name);
+
+            outJointTracks[i * 3 + 0] = jointInfo.m_positionTrack;
+            outJointTracks[i * 3 + 1] = jointInfo.m_rotationTrack;
+            outJointTracks[i * 3 + 2] = jointInfo.m_scaleTrack;
+
+            if (readSettings.m_logDetails)
+            {
+                MCore::LogDetailedInfo("  + [%zu] Joint = '%s'", i, name.c_str());
+                MCore::LogDetailedInfo("    - IsPosAnimated   = %s", (jointInfo.m_positionTrack != InvalidIndex32) ? "Yes" : "No");
+                MCore::LogDetailedInfo("    - IsRotAnimated   = %s", (jointInfo.m_rotationTrack != InvalidIndex32) ? "Yes" : "No");
+                MCore::LogDetailedInfo("    - IsScaleAnimated = %s", (jointInfo.m_scaleTrack != InvalidIndex32) ? "Yes" : "No");
+            }
+        }
+
+        // Read the morphs and floats.
+        const auto readFloat = [&](size_t index, bool isMorph, AZ::u32& outTrack) -> bool
+        {
+            File_CompressedMotionData_Float floatInfo;
+            if (stream->Read(&floatInfo, sizeof(File_CompressedMotionData_Float)) == 0)
+            {
+                return false;
+            }
+            MCore::Endian::ConvertFloat(&floatInfo.m_staticValue, sourceEndianType);
+            MCore::Endian::ConvertUnsignedInt32(&floatInfo.m_track, sourceEndianType);
+            name = MotionData::ReadStringFromStream(stream, sourceEndianType);
+
+            if (readSettings.m_logDetails)
+            {
+                MCore::LogDetailedInfo("  + %s: '%s'", isMorph ? "Morph" : "Float", name.c_str());
+                MCore::LogDetailedInfo("       + IsAnimated   = %s", (floatInfo.m_track != InvalidIndex32) ? "Yes" : "No");
+                MCore::LogDetailedInfo("       + Static value = %f", floatInfo.m_staticValue);
+            }
+
+            if (isMorph)
+            {
+                motionData->SetMorphName(index, name);
+                motionData->SetMorphStaticValue(index, floatInfo.m_staticValue);
+            }
+            else
+            {
+                motionData->SetFloatName(index, name);
+                motionData->SetFloatStaticValue(index, floatInfo.m_staticValue);
+            }
+            outTrack = floatInfo.m_track;
+            return true;
+        };
+
+        outMorphTracks.resize(motionData->GetNumMorphs());
+        for (size_t i = 0; i < motionData->GetNumMorphs(); ++i)
+        {
+            if (!readFloat(i, /*isMorph=*/true, outMorphTracks[i]))
+            {
+                return false;
+            }
+        }
+
+        outFloatTracks.resize(motionData->GetNumFloats());
+        for (size_t i = 0; i < motionData->GetNumFloats(); ++i)
+        {
+            if (!readFloat(i, /*isMorph=*/false, outFloatTracks[i]))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool CompressedMotionData::Read(MCore::Stream* stream, const ReadSettings& readSettings)
+    {
+        if (readSettings.m_version != 1)
+        {
+            AZ_Error("EMotionFX", false, "Unsupported CompressedMotionData version (version=%d), cannot load motion data.", readSettings.m_version);
+            return false;
+        }
+
+        File_CompressedMotionData_Info info;
+        AZStd::vector<AZ::u32> jointTracks;
+        AZStd::vector<AZ::u32> morphTracks;
+        AZStd::vector<AZ::u32> floatTracks;
+        if (!ReadCompressedVersion1(stream, this, readSettings, jointTracks, morphTracks, floatTracks, info))
+        {
+            return false;
+        }
+
+        // Read the tracks.
+        const MCore::Endian::EEndianType sourceEndianType = readSettings.m_sourceEndianType;
+        m_tracks.resize(info.m_numTracks);
+        for (Track& track : m_tracks)
+        {
+            File_CompressedMotionData_Track trackInfo;
+            if (stream->Read(&trackInfo, sizeof(File_CompressedMotionData_Track)) == 0)
+            {
+                return false;
+            }
+            MCore::Endian::ConvertFloat(trackInfo.m_rangeMin, sourceEndianType, 4);
+            MCore::Endian::ConvertFloat(trackInfo.m_rangeExtent, sourceEndianType, 4);
+            MCore::Endian::ConvertUnsignedInt32(&trackInfo.m_bitOffset, sourceEndianType);
+
+            if (trackInfo.m_numComponents == 0 || trackInfo.m_numComponents > 4 ||
+                trackInfo.m_bitsPerComponent == 0 || trackInfo.m_bitsPerComponent > s_maxBitsPerComponent ||
+                trackInfo.m_bitOffset + trackInfo.m_numComponents * trackInfo.m_bitsPerComponent > info.m_numBitsPerSample)
+            {
+                AZ_Error("EMotionFX", false, "Invalid track in CompressedMotionData, cannot load motion data.");
+                return false;
+            }
+
+            track.m_rangeMin = AZ::Vector4::CreateFromFloat4(trackInfo.m_rangeMin);
+            track.m_rangeExtent = AZ::Vector4::CreateFromFloat4(trackInfo.m_rangeExtent);
+            track.m_bitOffset = trackInfo.m_bitOffset;
+            track.m_numComponents = trackInfo.m_numComponents;
+            track.m_bitsPerComponent = trackInfo.m_bitsPerComponent;
+        }
+
+        // Link the joints, morphs and floats to their tracks.
+        const auto isValidTrack = [&info](AZ::u32 trackIndex)
+        {
+            return trackIndex == InvalidIndex32 || trackIndex < info.m_numTracks;
+        };
+        for (size_t i = 0; i < m_jointData.size(); ++i)
+        {
+            if (!isValidTrack(jointTracks[i * 3 + 0]) || !isValidTrack(jointTracks[i * 3 + 1]) || !isValidTrack(jointTracks[i * 3 + 2]))
+            {
+                AZ_Error("EMotionFX", false, "Invalid joint track index in CompressedMotionData, cannot load motion data.");
+                return false;
+            }
+            m_jointData[i].m_positionTrack = jointTracks[i * 3 + 0];
+            m_jointData[i].m_rotationTrack = jointTracks[i * 3 + 1];
+            EMFX_SCALECODE
+            (
+                m_jointData[i].m_scaleTrack = jointTracks[i * 3 + 2];
+            )
+        }
+        for (size_t i = 0; i < m_morphData.size(); ++i)
+        {
+            if (!isValidTrack(morphTracks[i]))
+            {
+                AZ_Error("EMotionFX", false, "Invalid morph track index in CompressedMotionData, cannot load motion data.");
+                return false;
+            }
+            m_morphData[i].m_track = morphTracks[i];
+        }
+        for (size_t i = 0; i < m_floatData.size(); ++i)
+        {
+            if (!isValidTrack(floatTracks[i]))
+            {
+                AZ_Error("EMotionFX", false, "Invalid float track index in CompressedMotionData, cannot load motion data.");
+                return false;
+            }
+            m_floatData[i].m_track = floatTracks[i];
+        }
+
+        // Read the quantized samples.
+        const size_t expectedNumWords = (static_cast<size_t>(info.m_numSamples) * info.m_numBitsPerSample + 31) / 32 + 1;
+        if (info.m_numWords != expectedNumWords)
+        {
+            AZ_Error("EMotionFX", false, "Expected %zu words of samples in CompressedMotionData, found %u, cannot load motion data.", expectedNumWords, info.m_numWords);
+            return false;
+        }
+        m_numBitsPerSample = info.m_numBitsPerSample;
+        m_bits.resize(info.m_numWords);
+        if (stream->Read(m_bits.data(), m_bits.size() * sizeof(AZ::u32)) == 0)
+        {
+            return false;
+        }
+        MCore::Endian::ConvertUnsignedInt32(m_bits.data(), sourceEndianType, static_cast<AZ::u32>(m_bits.size()));
+
+        return true;
+    }
+} // namespace EMotionFX
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <EMotionFX/Source/Allocators.h>
+#include <EMotionFX/Source/EMotionFXConfig.h>
+#include <EMotionFX/Source/MotionData/MotionData.h>
+#include <EMotionFX/Source/Transform.h>
+
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Math/Vector4.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace EMotionFX
+{
+    class Pose;
+
+    //! Uniformly sampled motion data, where every animated track is quantized with its own bit rate.
+    //! Each track stores its values relative to the range of values it covers, using the smallest number of bits per component
+    //! that keeps the error within the limits of the optimize settings. Tracks that stay within those limits of a constant value
+    //! are removed entirely and use their static value.
+    //! The samples of all tracks are interleaved per frame, so sampling a pose reads two contiguous blocks of bits.
+    class EMFX_API CompressedMotionData
+        : public MotionData
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(CompressedMotionData, MotionAllocator, 0)
+        AZ_RTTI(CompressedMotionData, "{6E3F2B1A-9C47-4D85-A0E6-2B7D19C53F84}", MotionData)
+
+        static constexpr AZ::u8 s_minBitsPerComponent = 3;
+        static constexpr AZ::u8 s_maxBitsPerComponent = 24;
+
+        struct EMFX_API InitSettings
+        {
+            size_t m_numJoints = 0;
+            size_t m_numMorphs = 0;
+            size_t m_numFloats = 0;
+            size_t m_numSamples = 0;
+            float m_sampleRate = 30.0f;
+        };
+
+        CompressedMotionData() = default;
+        ~CompressedMotionData() override;
+
+        void InitFromNonUniformData(const NonUniformMotionData* motionData, bool keepSameSampleRate=true, float newSampleRate=30.0f, bool updateDuration=false) override;
+        void Optimize(const OptimizeSettings& settings) override;
+        bool Read(MCore::Stream* stream, const ReadSettings& readSettings) override;
+        bool Save(MCore::Stream* stream, const SaveSettings& saveSettings) const override;
+        size_t CalcStreamSaveSizeInBytes(const SaveSettings& saveSettings) const override;
+        AZ::u32 GetStreamSaveVersion() const override;
+        const char* GetSceneSettingsName() const override;
+
+        // Overloaded.
+        Transform SampleJointTransform(const SampleSettings& settings, AZ::u32 jointSkeletonIndex) const override;
+        void SamplePose(const SampleSettings& settings, Pose* outputPose) const override;
+        float SampleMorph(float sampleTime, size_t morphDataIndex) const override;
+        float SampleFloat(float sampleTime, size_t floatDataIndex) const override;
+        Transform SampleJointTransform(float sampleTime, size_t jointDataIndex) const override;
+        AZ::Vector3 SampleJointPosition(float sampleTime, size_t jointDataIndex) const override;
+        AZ::Quaternion SampleJointRotation(float sampleTime, size_t jointDataIndex) const override;
+
+        void Init(const InitSettings& settings);
+
+        void ClearAllJointTransformSamples() override;
+        void ClearAllMorphSamples() override;
+        void ClearAllFloatSamples() override;
+        void ClearJointPositionSamples(size_t jointDataIndex) override;
+        void ClearJointRotationSamples(size_t jointDataIndex) override;
+        void ClearJointTransformSamples(size_t jointDataIndex) override;
+        void ClearMorphSamples(size_t morphDataIndex) override;
+        void ClearFloatSamples(size_t floatDataIndex) override;
+
+        bool IsJointPositionAnimated(size_t jointDataIndex) const override;
+        bool IsJointRotationAnimated(size_t jointDataIndex) const override;
+        bool IsJointAnimated(size_t jointDataIndex) const override;
+        bool IsMorphAnimated(size_t morphDataIndex) const override;
+        bool IsFloatAnimated(size_t floatDataIndex) const override;
+
+#ifndef EMFX_SCALE_DISABLED
+        void ClearJointScaleSamples(size_t jointDataIndex) override;
+        bool IsJointScaleAnimated(size_t jointDataIndex) const override;
+        AZ::Vector3 SampleJointScale(float sampleTime, size_t jointDataIndex) const override;
+#endif
+
+        size_t GetNumSamples() const;
+        float GetSampleSpacing() const;
+        void SetSampleRate(float sampleRate) override;
+        void UpdateDuration() override;
+
+        size_t GetNumTracks() const;
+        AZ::u8 GetTrackBitsPerComponent(size_t trackIndex) const;
+        size_t GetNumBitsPerSample() const; //!< The number of bits used by one frame of all the tracks.
+
+    private:
+        struct EMFX_API Track
+        {
+            AZ::Vector4 m_rangeMin = AZ::Vector4::CreateZero();
+            AZ::Vector4 m_rangeExtent = AZ::Vector4::CreateZero();
+            AZ::u32 m_bitOffset = 0; //!< The offset of the track in the bits of a frame.
+            AZ::u8 m_numComponents = 0;
+            AZ::u8 m_bitsPerComponent = s_maxBitsPerComponent;
+        };
+
+        //! The uncompressed samples of a track, used while building the compressed tracks.
+        struct EMFX_API TrackSamples
+        {
+            AZStd::vector<AZ::Vector4> m_values;
+            AZ::u8 m_numComponents = 0;
+            AZ::u8 m_bitsPerComponent = s_maxBitsPerComponent;
+        };
+
+        struct EMFX_API JointData
+        {
+            AZ::u32 m_positionTrack = InvalidIndex32;
+            AZ::u32 m_rotationTrack = InvalidIndex32;
+#ifndef EMFX_SCALE_DISABLED
+            AZ::u32 m_scaleTrack = InvalidIndex32;
+#endif
+        };
+
+        struct EMFX_API FloatData
+        {
+            AZ::u32 m_track = InvalidIndex32;
+        };
+
+        MotionData* CreateNew() const override;
+        void ResizeSampleData(size_t numJoints, size_t numMorphs, size_t numFloats) override;
+        void ClearAllData() override;
+        void AddJointSampleData(size_t jointDataIndex) override;
+        void AddMorphSampleData(size_t morphDataIndex) override;
+        void AddFloatSampleData(size_t floatDataIndex) override;
+        void RemoveJointSampleData(size_t jointDataIndex) override;
+        void RemoveMorphSampleData(size_t morphDataIndex) override;
+        void RemoveFloatSampleData(size_t floatDataIndex) override;
+        void ScaleData(float scaleFactor) override;
+
+        void UpdateSampleSpacing();
+
+        AZ::Vector4 DecodeSample(const Track& track, size_t frameBitOffset) const;
+        AZ::Vector4 SampleTrack(AZ::u32 trackIndex, size_t frameBitOffsetA, size_t frameBitOffsetB, float t) const;
+        AZ::Quaternion SampleRotationTrack(AZ::u32 trackIndex, size_t frameBitOffsetA, size_t frameBitOffsetB, float t) const;
+        Transform SampleJoint(size_t jointDataIndex, size_t frameBitOffsetA, size_t frameBitOffsetB, float t) const;
+        void CalculateFrameBitOffsets(float sampleTime, size_t& frameBitOffsetA, size_t& frameBitOffsetB, float& t) const;
+        void DecodeTrack(AZ::u32 trackIndex, TrackSamples& outSamples) const;
+
+        //! Decode all the compressed tracks, in the same order as m_tracks.
+        AZStd::vector<TrackSamples> DecodeAllTracks() const;
+
+        //! Replace the compressed data by the given tracks, quantized with their bits per component.
+        //! Only the tracks referenced by the joints, morphs and floats are kept, and the references are updated to the new track order.
+        void Encode(const AZStd::vector<TrackSamples>& tracks);
+
+        //! Re-encode the data, to release the bits of the tracks that aren't referenced anymore.
+        void Rebuild();
+
+        AZStd::vector<JointData> m_jointData;
+        AZStd::vector<FloatData> m_morphData;
+        AZStd::vector<FloatData> m_floatData;
+        AZStd::vector<Track> m_tracks;
+        AZStd::vector<AZ::u32> m_bits; //!< The quantized samples, frame after frame.
+        size_t m_numBitsPerSample = 0;
+        size_t m_numSamples = 0;
+        float m_sampleSpacing = 1.0f / 30.0f;
+    };
+} // namespace EMotionFX
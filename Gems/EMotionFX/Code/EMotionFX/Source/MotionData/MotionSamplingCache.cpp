@@ -0,0 +1,257 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Outcome/Outcome.h>
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/EMotionFXManager.h>
+#include <EMotionFX/Source/EventManager.h>
+#include <EMotionFX/Source/MorphSetup.h>
+#include <EMotionFX/Source/MorphSetupInstance.h>
+#include <EMotionFX/Source/Motion.h>
+#include <EMotionFX/Source/MotionData/MotionSamplingCache.h>
+#include <EMotionFX/Source/Node.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/Skeleton.h>
+#include <EMotionFX/Source/TransformData.h>
+
+namespace EMotionFX
+{
+    MotionSamplingCache::MotionSamplingCache()
+    {
+        GetEMotionFX().GetEventManager()->AddEventHandler(this);
+    }
+
+    MotionSamplingCache::~MotionSamplingCache()
+    {
+        GetEMotionFX().GetEventManager()->RemoveEventHandler(this);
+    }
+
+    void MotionSamplingCache::SetEnabled(bool enabled)
+    {
+        m_enabled = enabled;
+        if (!enabled)
+        {
+            Clear();
+        }
+    }
+
+    bool MotionSamplingCache::GetIsEnabled() const
+    {
+        return m_enabled;
+    }
+
+    void MotionSamplingCache::SetTimeStep(float timeStep)
+    {
+        AZ_Assert(timeStep > 0.0f, "Expected the time step to be larger than zero.");
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_timeStep = timeStep;
+
+        // The sample indices of the entries are relative to the time step.
+        m_entries.clear();
+    }
+
+    float MotionSamplingCache::GetTimeStep() const
+    {
+        return m_timeStep;
+    }
+
+    void MotionSamplingCache::BeginFrame()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_numHits = 0;
+        m_numMisses = 0;
+
+        // Keep the entries used during the previous frame, so their memory gets reused by the next sample times.
+        const size_t previousFrame = m_frame;
+        for (auto motionIt = m_entries.begin(); motionIt != m_entries.end();)
+        {
+            EntryMap& entryMap = motionIt->second;
+            for (auto entryIt = entryMap.begin(); entryIt != entryMap.end();)
+            {
+                if (entryIt->second->m_frame != previousFrame)
+                {
+                    entryIt = entryMap.erase(entryIt);
+                }
+                else
+                {
+                    ++entryIt;
+                }
+            }
+
+            if (entryMap.empty())
+            {
+                motionIt = m_entries.erase(motionIt);
+            }
+            else
+            {
+                ++motionIt;
+            }
+        }
+
+        m_frame++;
+    }
+
+    void MotionSamplingCache::Clear()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_entries.clear();
+    }
+
+    size_t MotionSamplingCache::GetNumEntries() const
+    {
+        size_t numEntries = 0;
+        for (const auto& motionEntries : m_entries)
+        {
+            numEntries += motionEntries.second.size();
+        }
+        return numEntries;
+    }
+
+    size_t MotionSamplingCache::GetNumHits() const
+    {
+        return m_numHits;
+    }
+
+    size_t MotionSamplingCache::GetNumMisses() const
+    {
+        return m_numMisses;
+    }
+
+    void MotionSamplingCache::OnDeleteMotion(Motion* motion)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_entries.erase(motion);
+    }
+
+    const MotionSamplingCache::Entry& MotionSamplingCache::FindOrSampleEntry(const Motion* motion, const MotionData* motionData, AZ::s64 sampleIndex)
+    {
+        Entry* entry = nullptr;
+        size_t frame;
+        float sampleTime;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            AZStd::unique_ptr<Entry>& entryPtr = m_entries[motion][sampleIndex];
+            if (!entryPtr)
+            {
+                entryPtr = AZStd::make_unique<Entry>();
+            }
+            entry = entryPtr.get();
+            frame = m_frame;
+            sampleTime = AZ::GetMin(static_cast<float>(sampleIndex) * m_timeStep, motionData->GetDuration());
+        }
+
+        // Only the first instance that needs the samples of this frame takes them, the others wait for it and share them.
+        AZStd::lock_guard<AZStd::mutex> entryLock(entry->m_mutex);
+        if (entry->m_frame == frame && entry->m_motionData == motionData)
+        {
+            m_numHits++;
+            return *entry;
+        }
+
+        m_numMisses++;
+        const size_t numJoints = motionData->GetNumJoints();
+        entry->m_jointTransforms.resize(numJoints);
+        for (size_t i = 0; i < numJoints; ++i)
+        {
+            entry->m_jointTransforms[i] = motionData->SampleJointTransform(sampleTime, i);
+        }
+
+        const size_t numMorphs = motionData->GetNumMorphs();
+        entry->m_morphWeights.resize(numMorphs);
+        for (size_t i = 0; i < numMorphs; ++i)
+        {
+            entry->m_morphWeights[i] = motionData->SampleMorph(sampleTime, i);
+        }
+
+        entry->m_motionData = motionData;
+        entry->m_frame = frame;
+        return *entry;
+    }
+
+    void MotionSamplingCache::SamplePose(const Motion* motion, const MotionData::SampleSettings& settings, Pose* outputPose)
+    {
+        AZ_Assert(settings.m_actorInstance, "Expecting a valid actor instance.");
+        const MotionData* motionData = motion->GetMotionData();
+        const AZ::s64 sampleIndex = static_cast<AZ::s64>(settings.m_sampleTime / m_timeStep + 0.5f);
+        const Entry& entry = FindOrSampleEntry(motion, motionData, sampleIndex);
+
+        const ActorInstance* actorInstance = settings.m_actorInstance;
+        const Actor* actor = actorInstance->GetActor();
+        const MotionLinkData* motionLinkData = motionData->FindMotionLinkData(actor);
+        const AZStd::vector<AZ::u32>& jointLinks = motionLinkData->GetJointDataLinks();
+        const Skeleton* skeleton = actor->GetSkeleton();
+        const Pose* bindPose = actorInstance->GetTransformData()->GetBindPose();
+        const bool additive = motionData->IsAdditive();
+
+        // Copy the shared transforms, and fall back to the input or bind pose for the joints that aren't in the motion.
+        const AZ::u32 numNodes = actorInstance->GetNumEnabledNodes();
+        for (AZ::u32 i = 0; i < numNodes; ++i)
+        {
+            const AZ::u32 skeletonJointIndex = actorInstance->GetEnabledNode(i);
+            const bool inPlace = (settings.m_inPlace && skeleton->GetNode(skeletonJointIndex)->GetIsRootNode());
+
+            Transform result;
+            const AZ::u32 jointDataIndex = jointLinks[skeletonJointIndex];
+            if (jointDataIndex != InvalidIndex32 && !inPlace)
+            {
+                result = entry.m_jointTransforms[jointDataIndex];
+            }
+            else if (additive && jointDataIndex == InvalidIndex32)
+            {
+                result = Transform::CreateIdentity();
+            }
+            else if (settings.m_inputPose && !inPlace)
+            {
+                result = settings.m_inputPose->GetLocalSpaceTransform(skeletonJointIndex);
+            }
+            else
+            {
+                result = bindPose->GetLocalSpaceTransform(skeletonJointIndex);
+            }
+
+            if (settings.m_retarget)
+            {
+                motionData->BasicRetarget(actorInstance, motionLinkData, skeletonJointIndex, result);
+            }
+
+            outputPose->SetLocalSpaceTransformDirect(skeletonJointIndex, result);
+        }
+
+        // Apply runtime motion mirroring.
+        if (settings.m_mirror && actor->GetHasMirrorInfo())
+        {
+            outputPose->Mirror(motionLinkData);
+        }
+
+        // Output morph target weights.
+        const MorphSetupInstance* morphSetup = actorInstance->GetMorphSetupInstance();
+        const AZ::u32 numMorphTargets = morphSetup->GetNumMorphTargets();
+        for (AZ::u32 i = 0; i < numMorphTargets; ++i)
+        {
+            const AZ::u32 morphTargetId = morphSetup->GetMorphTarget(i)->GetID();
+            const AZ::Outcome<size_t> morphIndex = motionData->FindMorphIndexByNameId(morphTargetId);
+            if (morphIndex.IsSuccess())
+            {
+                outputPose->SetMorphWeight(i, entry.m_morphWeights[morphIndex.GetValue()]);
+            }
+            else if (settings.m_inputPose)
+            {
+                outputPose->SetMorphWeight(i, settings.m_inputPose->GetMorphWeight(i));
+            }
+            else
+            {
+                outputPose->SetMorphWeight(i, bindPose->GetMorphWeight(i));
+            }
+        }
+
+        // Since we used the SetLocalTransformDirect, make sure we manually invalidate all model space transforms.
+        outputPose->InvalidateAllModelSpaceTransforms();
+    }
+} // namespace EMotionFX
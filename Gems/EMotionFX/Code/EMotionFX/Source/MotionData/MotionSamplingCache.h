@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <EMotionFX/Source/Allocators.h>
+#include <EMotionFX/Source/EMotionFXConfig.h>
+#include <EMotionFX/Source/EventHandler.h>
+#include <EMotionFX/Source/MotionData/MotionData.h>
+#include <EMotionFX/Source/Transform.h>
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace EMotionFX
+{
+    class Motion;
+    class Pose;
+
+    //! Shares the sampled motion data between the motion instances that play the same motion at the same time during a frame.
+    //! The sample times are snapped to a fixed time step, so that instances that are in sync (crowds, idles) sample the motion
+    //! data only once per frame. Each instance then only copies the shared transforms into its pose and applies its own
+    //! retargeting, mirroring and in place settings. The cache is disabled on default, as snapping changes the sampled poses.
+    class EMFX_API MotionSamplingCache
+        : public EventHandler
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(MotionSamplingCache, MotionAllocator, 0)
+
+        MotionSamplingCache();
+        MotionSamplingCache(const MotionSamplingCache&) = delete;
+        MotionSamplingCache(MotionSamplingCache&&) = delete;
+        MotionSamplingCache& operator=(const MotionSamplingCache&) = delete;
+        MotionSamplingCache& operator=(MotionSamplingCache&&) = delete;
+        ~MotionSamplingCache() override;
+
+        void SetEnabled(bool enabled);
+        bool GetIsEnabled() const;
+
+        //! Set the time step the sample times are snapped to, in seconds. Larger steps let more instances share their samples.
+        void SetTimeStep(float timeStep);
+        float GetTimeStep() const;
+
+        //! Start a new frame. The samples of the previous frame become invalid, and the entries that weren't used during the
+        //! previous frame are released. Automatically called at the start of each EMotionFXManager::Update.
+        void BeginFrame();
+        void Clear();
+
+        //! Sample the pose of the motion for the actor instance, using the shared samples of the motion at the snapped sample time.
+        //! This can be called from multiple threads at the same time.
+        void SamplePose(const Motion* motion, const MotionData::SampleSettings& settings, Pose* outputPose);
+
+        size_t GetNumEntries() const;
+        size_t GetNumHits() const;    //!< The number of poses sampled from shared samples since the last BeginFrame.
+        size_t GetNumMisses() const;  //!< The number of times the motion data got sampled since the last BeginFrame.
+
+    private:
+        //! The samples of all joints and morphs of a motion at one sample time.
+        struct Entry
+        {
+            AZStd::vector<Transform> m_jointTransforms; //!< Indexed by joint data index.
+            AZStd::vector<float> m_morphWeights; //!< Indexed by morph data index.
+            const MotionData* m_motionData = nullptr; //!< The motion data the samples were taken from.
+            size_t m_frame = 0; //!< The frame the samples were taken in.
+            AZStd::mutex m_mutex;
+        };
+
+        using EntryMap = AZStd::unordered_map<AZ::s64, AZStd::unique_ptr<Entry>>;
+
+        const AZStd::vector<EventTypes> GetHandledEventTypes() const override { return { EVENT_TYPE_ON_DELETE_MOTION }; }
+        void OnDeleteMotion(Motion* motion) override;
+
+        const Entry& FindOrSampleEntry(const Motion* motion, const MotionData* motionData, AZ::s64 sampleIndex);
+
+        AZStd::unordered_map<const Motion*, EntryMap> m_entries;
+        AZStd::mutex m_mutex;
+        AZStd::atomic<size_t> m_numHits{ 0 };
+        AZStd::atomic<size_t> m_numMisses{ 0 };
+        size_t m_frame = 1;
+        float m_timeStep = 1.0f / 60.0f;
+        bool m_enabled = false;
+    };
+} // namespace EMotionFX
@@ -20,6 +20,7 @@
 #include <AzCore/Jobs/JobCompletion.h>
 #include <AzCore/Jobs/JobManagerBus.h>
 #include <AzCore/Jobs/JobContext.h>
+#include <AzCore/std/sort.h>
 
 
 namespace EMotionFX
@@ -32,6 +33,7 @@ namespace EMotionFX
     {
         mSteps.SetMemoryCategory(EMFX_MEMCATEGORY_UPDATESCHEDULERS);
         mCleanTimer     = 0.0f; // time passed since last schedule cleanup, in seconds
+        mMaxActorInstancesPerJob = 8;
         mSteps.Reserve(1000);
     }
 
@@ -58,6 +60,13 @@ namespace EMotionFX
     }
 
 
+    void MultiThreadScheduler::SetMaxActorInstancesPerJob(uint32 maxActorInstancesPerJob)
+    {
+        MCore::LockGuardRecursive guard(mMutex);
+        mMaxActorInstancesPerJob = AZ::GetMax<uint32>(maxActorInstancesPerJob, 1);
+    }
+
+
     // add the actor instance dependencies to the schedule step
     void MultiThreadScheduler::AddDependenciesToStep(ActorInstance* instance, ScheduleStep* outStep)
     {
@@ -159,52 +168,53 @@ namespace EMotionFX
                 continue;
             }
 
-            // process the actor instances in the current step in parallel
-            AZ::JobCompletion jobCompletion;           
-            for (uint32 c = 0; c < numStepEntries; ++c)
+            // gather the enabled actor instances, grouping the ones that share an anim graph so a batch evaluates the same graph over and over
+            mBatchedActorInstances.clear();
+            for (ActorInstance* actorInstance : currentStep.mActorInstances)
             {
-                ActorInstance* actorInstance = currentStep.mActorInstances[c];
-                if (actorInstance->GetIsEnabled() == false)
+                if (actorInstance->GetIsEnabled())
                 {
-                    continue;
+                    mBatchedActorInstances.emplace_back(actorInstance);
                 }
+            }
 
-                AZ::JobContext* jobContext = nullptr;
-                AZ::Job* job = AZ::CreateJobFunction([this, timePassedInSeconds, actorInstance]()
+            AZStd::sort(mBatchedActorInstances.begin(), mBatchedActorInstances.end(),
+                [](const ActorInstance* a, const ActorInstance* b)
                 {
-                    AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Animation, "MultiThreadScheduler::Execute::ActorInstanceUpdateJob");
-
-                    const AZ::u32 threadIndex = AZ::JobContext::GetGlobalContext()->GetJobManager().GetWorkerThreadId();                    
-                    actorInstance->SetThreadIndex(threadIndex);
-
-                    const bool isVisible = actorInstance->GetIsVisible();
-                    if (isVisible)
+                    const AnimGraph* animGraphA = a->GetAnimGraphInstance() ? a->GetAnimGraphInstance()->GetAnimGraph() : nullptr;
+                    const AnimGraph* animGraphB = b->GetAnimGraphInstance() ? b->GetAnimGraphInstance()->GetAnimGraph() : nullptr;
+                    if (animGraphA != animGraphB)
                     {
-                        mNumVisible.Increment();
+                        return animGraphA < animGraphB;
                     }
+                    return a->GetActor() < b->GetActor();
+                });
 
-                    // check if we want to sample motions
-                    bool sampleMotions = false;
-                    actorInstance->SetMotionSamplingTimer(actorInstance->GetMotionSamplingTimer() + timePassedInSeconds);
-                    if (actorInstance->GetMotionSamplingTimer() >= actorInstance->GetMotionSamplingRate())
-                    {
-                        sampleMotions = true;
-                        actorInstance->SetMotionSamplingTimer(0.0f);
+            const size_t numActorInstances = mBatchedActorInstances.size();
+            mNumUpdated.SetValue(mNumUpdated.GetValue() + static_cast<uint32>(numActorInstances));
 
-                        if (isVisible)
-                        {
-                            mNumSampled.Increment();
-                        }
-                    }
+            // process the batches of actor instances in the current step in parallel
+            AZ::JobCompletion jobCompletion;
+            for (size_t batchStart = 0; batchStart < numActorInstances; batchStart += mMaxActorInstancesPerJob)
+            {
+                ActorInstance* const* batchBegin = mBatchedActorInstances.data() + batchStart;
+                ActorInstance* const* batchEnd = batchBegin + AZStd::min<size_t>(mMaxActorInstancesPerJob, numActorInstances - batchStart);
+
+                AZ::JobContext* jobContext = nullptr;
+                AZ::Job* job = AZ::CreateJobFunction([this, timePassedInSeconds, batchBegin, batchEnd]()
+                {
+                    AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Animation, "MultiThreadScheduler::Execute::ActorInstanceUpdateJob");
 
-                    // update the actor instance
-                    actorInstance->UpdateTransformations(timePassedInSeconds, isVisible, sampleMotions);
+                    const AZ::u32 threadIndex = AZ::JobContext::GetGlobalContext()->GetJobManager().GetWorkerThreadId();
+                    for (ActorInstance* const* actorInstance = batchBegin; actorInstance != batchEnd; ++actorInstance)
+                    {
+                        (*actorInstance)->SetThreadIndex(threadIndex);
+                        UpdateActorInstance(*actorInstance, timePassedInSeconds);
+                    }
                 }, true, jobContext);
 
-                job->SetDependent(&jobCompletion);               
+                job->SetDependent(&jobCompletion);
                 job->Start();
-
-                mNumUpdated.Increment();
             }
 
             jobCompletion.StartAndWaitForCompletion();
@@ -212,6 +222,33 @@ namespace EMotionFX
     }
 
 
+    void MultiThreadScheduler::UpdateActorInstance(ActorInstance* actorInstance, float timePassedInSeconds)
+    {
+        const bool isVisible = actorInstance->GetIsVisible();
+        if (isVisible)
+        {
+            mNumVisible.Increment();
+        }
+
+        // check if we want to sample motions
+        bool sampleMotions = false;
+        actorInstance->SetMotionSamplingTimer(actorInstance->GetMotionSamplingTimer() + timePassedInSeconds);
+        if (actorInstance->GetMotionSamplingTimer() >= actorInstance->GetMotionSamplingRate())
+        {
+            sampleMotions = true;
+            actorInstance->SetMotionSamplingTimer(0.0f);
+
+            if (isVisible)
+            {
+                mNumSampled.Increment();
+            }
+        }
+
+        // update the actor instance
+        actorInstance->UpdateTransformations(timePassedInSeconds, isVisible, sampleMotions);
+    }
+
+
     // find the next free spot in the schedule
     bool MultiThreadScheduler::FindNextFreeItem(ActorInstance* actorInstance, uint32 startStep, uint32* outStepNr)
     {
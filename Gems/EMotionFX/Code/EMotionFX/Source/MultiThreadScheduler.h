@@ -130,9 +130,27 @@ namespace EMotionFX
         const ScheduleStep& GetScheduleStep(uint32 index) const { return mSteps[index]; }
         uint32 GetNumScheduleSteps() const { return mSteps.GetLength(); }
 
+        /**
+         * Set the maximum number of actor instances updated by a single job.
+         * The actor instances of a step are sorted by anim graph and split into batches, so that instances sharing the same anim graph
+         * are updated one after the other by the same worker thread, which keeps the shared anim graph and motion data in its caches.
+         * Batching also removes the job overhead of updating many small actor instances, like crowds.
+         * A value of one updates each actor instance in its own job.
+         * @param maxActorInstancesPerJob The maximum number of actor instances per job, clamped to at least one.
+         */
+        void SetMaxActorInstancesPerJob(uint32 maxActorInstancesPerJob);
+
+        /**
+         * Get the maximum number of actor instances updated by a single job.
+         * @result The maximum number of actor instances per job.
+         */
+        uint32 GetMaxActorInstancesPerJob() const   { return mMaxActorInstancesPerJob; }
+
     protected:
         MCore::Array< ScheduleStep >    mSteps;         /**< An array of update steps, that together form the schedule. */
+        AZStd::vector<ActorInstance*>   mBatchedActorInstances; /**< The enabled actor instances of the step being executed, sorted by anim graph. */
         float                           mCleanTimer;    /**< The time passed since the last automatic call to the Optimize method. */
+        uint32                          mMaxActorInstancesPerJob; /**< The maximum number of actor instances updated by a single job. */
         MCore::MutexRecursive           mMutex;
 
         bool HasActorInstanceInSteps(const ActorInstance* actorInstance) const;
@@ -174,5 +192,13 @@ namespace EMotionFX
          * @param outStep The scheduler step to add the dependencies to.
          */
         void AddDependenciesToStep(ActorInstance* instance, ScheduleStep* outStep);
+
+        /**
+         * Update a given actor instance, sampling its motions when its motion sampling timer expired.
+         * This is called from the worker threads.
+         * @param actorInstance The actor instance to update.
+         * @param timePassedInSeconds The time passed, in seconds, since the last call to the update.
+         */
+        void UpdateActorInstance(ActorInstance* actorInstance, float timePassedInSeconds);
     };
 }   // namespace EMotionFX
@@ -499,7 +499,47 @@ namespace EMotionFX
         const uint32 numNodes = skeleton->GetNumNodes();
         for (uint32 i = 0; i < numNodes; ++i)
         {
-            UpdateModelSpaceTransform(i);
+            if (mFlags[i] & FLAG_MODELTRANSFORMREADY)
+            {
+                continue;
+            }
+
+            // skeletons store the parents before their children, so in a single pass in node order the parent is up to date already
+            // and the hierarchy gets concatenated without recursing
+            const uint32 parentIndex = skeleton->GetNode(i)->GetParentIndex();
+            if (parentIndex == MCORE_INVALIDINDEX32)
+            {
+                mModelSpaceTransforms[i] = mLocalSpaceTransforms[i];
+                mFlags[i] |= FLAG_MODELTRANSFORMREADY;
+            }
+            else if (mFlags[parentIndex] & FLAG_MODELTRANSFORMREADY)
+            {
+                mModelSpaceTransforms[parentIndex].PreMultiply(GetLocalSpaceTransform(i), &mModelSpaceTransforms[i]);
+                mFlags[i] |= FLAG_MODELTRANSFORMREADY;
+            }
+            else
+            {
+                UpdateModelSpaceTransform(i);
+            }
+        }
+    }
+
+
+    void Pose::UpdateLocalSpaceTransforms(const uint16* nodeIndices, uint32 numNodes) const
+    {
+        if (nodeIndices)
+        {
+            for (uint32 i = 0; i < numNodes; ++i)
+            {
+                UpdateLocalSpaceTransform(nodeIndices[i]);
+            }
+        }
+        else
+        {
+            for (uint32 i = 0; i < numNodes; ++i)
+            {
+                UpdateLocalSpaceTransform(i);
+            }
         }
     }
 
@@ -882,14 +922,12 @@ namespace EMotionFX
     {
         if (mActorInstance)
         {
-            uint32 nodeNr;
+            // blend the enabled nodes as one batch
+            const uint16* enabledNodes = mActorInstance->GetEnabledNodes().GetReadPtr();
             const uint32 numNodes = mActorInstance->GetNumEnabledNodes();
-            for (uint32 i = 0; i < numNodes; ++i)
-            {
-                nodeNr = mActorInstance->GetEnabledNode(i);
-                Transform& curTransform = const_cast<Transform&>(GetLocalSpaceTransform(nodeNr));
-                curTransform.Blend(destPose->GetLocalSpaceTransform(nodeNr), weight);
-            }
+            UpdateLocalSpaceTransforms(enabledNodes, numNodes);
+            destPose->UpdateLocalSpaceTransforms(enabledNodes, numNodes);
+            Transform::BlendTransforms(mLocalSpaceTransforms.GetPtr(), destPose->mLocalSpaceTransforms.GetReadPtr(), enabledNodes, numNodes, weight);
 
             // blend the morph weights
             const uint32 numMorphs = mMorphWeights.GetLength();
@@ -908,12 +946,11 @@ namespace EMotionFX
         }
         else
         {
+            // blend all nodes as one batch
             const uint32 numNodes = mActor->GetSkeleton()->GetNumNodes();
-            for (uint32 i = 0; i < numNodes; ++i)
-            {
-                Transform& curTransform = const_cast<Transform&>(GetLocalSpaceTransform(i));
-                curTransform.Blend(destPose->GetLocalSpaceTransform(i), weight);
-            }
+            UpdateLocalSpaceTransforms(nullptr, numNodes);
+            destPose->UpdateLocalSpaceTransforms(nullptr, numNodes);
+            Transform::BlendTransforms(mLocalSpaceTransforms.GetPtr(), destPose->mLocalSpaceTransforms.GetReadPtr(), nullptr, numNodes, weight);
 
             // blend the morph weights
             const uint32 numMorphs = mMorphWeights.GetLength();
@@ -1141,16 +1178,14 @@ namespace EMotionFX
         {
             const TransformData* transformData = mActorInstance->GetTransformData();
             Pose* bindPose = transformData->GetBindPose();
-            Transform result;
 
-            uint32 nodeNr;
+            // blend the enabled nodes as one batch
+            const uint16* enabledNodes = mActorInstance->GetEnabledNodes().GetReadPtr();
             const uint32 numNodes = mActorInstance->GetNumEnabledNodes();
-            for (uint32 i = 0; i < numNodes; ++i)
-            {
-                nodeNr = mActorInstance->GetEnabledNode(i);
-                BlendTransformAdditiveUsingBindPose(bindPose->GetLocalSpaceTransform(nodeNr), GetLocalSpaceTransform(nodeNr), destPose->GetLocalSpaceTransform(nodeNr), weight, &result);
-                SetLocalSpaceTransform(nodeNr, result, false);
-            }
+            UpdateLocalSpaceTransforms(enabledNodes, numNodes);
+            destPose->UpdateLocalSpaceTransforms(enabledNodes, numNodes);
+            bindPose->UpdateLocalSpaceTransforms(enabledNodes, numNodes);
+            Transform::BlendTransformsAdditive(mLocalSpaceTransforms.GetPtr(), destPose->mLocalSpaceTransforms.GetReadPtr(), bindPose->mLocalSpaceTransforms.GetReadPtr(), enabledNodes, numNodes, weight);
 
             // blend the morph weights
             const uint32 numMorphs = mMorphWeights.GetLength();
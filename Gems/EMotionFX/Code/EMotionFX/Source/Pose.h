@@ -204,6 +204,13 @@ namespace EMotionFX
 
         void RecursiveInvalidateModelSpaceTransforms(const Actor* actor, uint32 nodeIndex);
 
+        /**
+         * Make sure the local space transforms of the given nodes are up to date, so that they can be blended straight from the array.
+         * @param nodeIndices The indices of the nodes to update, or nullptr to update the first numNodes nodes.
+         * @param numNodes The number of node indices, or the number of nodes when nodeIndices is nullptr.
+         */
+        void UpdateLocalSpaceTransforms(const uint16* nodeIndices, uint32 numNodes) const;
+
         /**
          * Perform a non-mixed blend into the specified destination pose.
          * @param destPose The destination pose to blend into.
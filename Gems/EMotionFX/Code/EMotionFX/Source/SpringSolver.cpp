@@ -13,6 +13,7 @@
 #include <EMotionFX/Source/Node.h>
 #include <EMotionFX/Source/Pose.h>
 #include <EMotionFX/Source/SimulatedObjectSetup.h>
+#include <EMotionFX/Source/Skeleton.h>
 #include <EMotionFX/Source/SpringSolver.h>
 #include <EMotionFX/Source/TransformData.h>
 
@@ -425,10 +426,28 @@ namespace EMotionFX
 
         // Automatically add colliders to the exclusion list when joints are inside the collider etc.
         InitAutoColliderExclusion();
+        UpdateCollidersFollowSimulation();
 
         return true;
     }
 
+    void SpringSolver::UpdateCollidersFollowSimulation()
+    {
+        m_collidersFollowSimulation = false;
+        const Skeleton* skeleton = m_actorInstance->GetActor()->GetSkeleton();
+        for (const CollisionObject& colObject : m_collisionObjects)
+        {
+            for (AZ::u32 jointIndex = colObject.m_jointIndex; jointIndex != InvalidIndex32; jointIndex = skeleton->GetNode(jointIndex)->GetParentIndex())
+            {
+                if (FindParticle(jointIndex) != InvalidIndex)
+                {
+                    m_collidersFollowSimulation = true;
+                    return;
+                }
+            }
+        }
+    }
+
     void SpringSolver::DebugRender(const Pose& pose, bool renderColliders, bool renderLimits, const AZ::Color& color) const
     {
         if (!m_actorInstance)
@@ -631,6 +650,7 @@ namespace EMotionFX
             }
         }
 
+        UpdateCollidersFollowSimulation();
         return true;
     }
 
@@ -708,13 +728,14 @@ namespace EMotionFX
         #endif
     }
 
-    void SpringSolver::CalcForces(const Pose& pose, float scaleFactor)
+    void SpringSolver::CalcForces(float scaleFactor)
     {
         const float globalStiffnessFactor = m_simulatedObject->GetStiffnessFactor() * m_stiffnessFactor * scaleFactor;
         const float globalGravityFactor = m_simulatedObject->GetGravityFactor() * m_gravityFactor * scaleFactor;
 
-        for (Particle& particle : m_particles)
+        for (size_t i = 0; i < m_particles.size(); ++i)
         {
+            Particle& particle = m_particles[i];
             particle.m_force = AZ::Vector3::CreateZero();
 
             // Try to move us towards the current pose, based on a stiffness.
@@ -724,8 +745,7 @@ namespace EMotionFX
                 const float stiffnessFactor = joint->GetStiffness() * globalStiffnessFactor;
                 if (stiffnessFactor > 0.0f)
                 {
-                    const Transform jointWorldTransform = pose.GetWorldSpaceTransform(joint->GetSkeletonJointIndex());
-                    const AZ::Vector3 force = (jointWorldTransform.mPosition - particle.m_pos) + particle.m_externalForce;
+                    const AZ::Vector3 force = (m_inputPositions[i] - particle.m_pos) + particle.m_externalForce;
                     particle.m_force += force * stiffnessFactor;
                 }
 
@@ -777,16 +797,19 @@ namespace EMotionFX
         }
     }
 
-    void SpringSolver::SatisfyConstraints(const Pose& inputPose, Pose& outPose, size_t numIterations, float scaleFactor)
+    void SpringSolver::SatisfyConstraints(Pose& outPose, size_t numIterations, float scaleFactor)
     {
+        // The colliders only move during the iterations when they are attached to the simulated joints.
+        UpdateCollisionObjects(outPose, 1.0f);
+
         for (size_t n = 0; n < numIterations; ++n)
         {
             for (const Spring& spring : m_springs)
             {
                 Particle& particleA = m_particles[spring.m_particleA];
                 Particle& particleB = m_particles[spring.m_particleB];
-                const Transform& worldTransformA = inputPose.GetWorldSpaceTransform(particleA.m_joint->GetSkeletonJointIndex());
-                const Transform& worldTransformB = inputPose.GetWorldSpaceTransform(particleB.m_joint->GetSkeletonJointIndex());
+                const AZ::Vector3& inputPositionA = m_inputPositions[spring.m_particleA];
+                const AZ::Vector3& inputPositionB = m_inputPositions[spring.m_particleB];
 
                 // Try to maintain the rest length by applying correctional forces.
                 const AZ::Vector3 delta = particleB.m_pos - particleA.m_pos;
@@ -816,17 +839,17 @@ namespace EMotionFX
                 }
                 else if (pinnedA && pinnedB)
                 {
-                    particleA.m_pos = worldTransformA.mPosition;
-                    particleB.m_pos = worldTransformB.mPosition;
+                    particleA.m_pos = inputPositionA;
+                    particleB.m_pos = inputPositionB;
                 }
                 else if (pinnedB)
                 {
-                    particleB.m_pos = worldTransformB.mPosition;
+                    particleB.m_pos = inputPositionB;
                     particleA.m_pos += delta * diff;
                 }
                 else // Only particleA is pinned.
                 {
-                    particleA.m_pos = worldTransformA.mPosition;
+                    particleA.m_pos = inputPositionA;
                     particleB.m_pos -= delta * diff;
                 }
 
@@ -839,7 +862,7 @@ namespace EMotionFX
                     }
                     else
                     {
-                        particleB.m_limitDir = worldTransformA.mPosition - worldTransformB.mPosition;
+                        particleB.m_limitDir = inputPositionA - inputPositionB;
                     }
                     PerformConeLimit(particleA, particleB, particleB.m_limitDir);
                 }
@@ -847,8 +870,11 @@ namespace EMotionFX
 
             // Update the joint transforms and colliders.
             // This has to be done before the collision detection, so that the colliders are up to date.
-            UpdateJointTransforms(outPose);
-            UpdateCollisionObjects(outPose, 1.0f);
+            if (m_collidersFollowSimulation)
+            {
+                UpdateJointTransforms(outPose);
+                UpdateCollisionObjects(outPose, 1.0f);
+            }
 
             // Perform collision.
             if (m_collisionDetection)
@@ -871,11 +897,22 @@ namespace EMotionFX
         } // For all iterations.
     }
 
+    void SpringSolver::UpdateInputPositions(const Pose& inputPose)
+    {
+        m_inputPositions.resize(m_particles.size());
+        for (size_t i = 0; i < m_particles.size(); ++i)
+        {
+            m_inputPositions[i] = inputPose.GetWorldSpaceTransform(m_particles[i].m_joint->GetSkeletonJointIndex()).mPosition;
+        }
+    }
+
     void SpringSolver::Simulate(float deltaTime, const Pose& inputPose, Pose& outPose, float scaleFactor)
     {
-        CalcForces(inputPose, scaleFactor);
+        // Gather the input pose positions once, the iterations then only work on the particles.
+        UpdateInputPositions(inputPose);
+        CalcForces(scaleFactor);
         Integrate(deltaTime);
-        SatisfyConstraints(inputPose, outPose, m_numIterations, scaleFactor);
+        SatisfyConstraints(outPose, m_numIterations, scaleFactor);
         UpdateJointTransforms(outPose);
     }
 
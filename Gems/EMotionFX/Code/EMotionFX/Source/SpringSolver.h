@@ -152,8 +152,8 @@ namespace EMotionFX
         void InitCollidersFromColliderSetupShapes();
         bool RecursiveAddJoint(const SimulatedJoint* joint, size_t parentParticleIndex);
         void Integrate(float timeDelta);
-        void CalcForces(const Pose& pose, float scaleFactor);
-        void SatisfyConstraints(const Pose& inputPose, Pose& outPose, size_t numIterations, float scaleFactor);
+        void CalcForces(float scaleFactor);
+        void SatisfyConstraints(Pose& outPose, size_t numIterations, float scaleFactor);
         void Simulate(float deltaTime, const Pose& inputPose, Pose& outPose, float scaleFactor);
         void UpdateJointTransforms(Pose& pose);
         size_t AddParticle(const SimulatedJoint* joint);
@@ -168,6 +168,8 @@ namespace EMotionFX
         bool CheckIsJointInsideCollider(const CollisionObject& colObject, const Particle& particle) const;
         void CheckAndExcludeCollider(AZ::u32 colliderIndex, const SimulatedJoint* joint);
         void UpdateFixedParticles(const Pose& pose);
+        void UpdateInputPositions(const Pose& inputPose);
+        void UpdateCollidersFollowSimulation();
         void Stabilize(const Pose& inputPose, Pose& pose, size_t numFrames=5);
         void InitAutoColliderExclusion();
         void InitAutoColliderExclusion(SimulatedJoint* joint);
@@ -176,6 +178,7 @@ namespace EMotionFX
         AZStd::vector<Spring> m_springs; /**< The collection of springs in the system. */
         AZStd::vector<Particle> m_particles; /**< The particles, which are connected by springs. */
         AZStd::vector<CollisionObject> m_collisionObjects; /**< The collection of collision objects. */
+        AZStd::vector<AZ::Vector3> m_inputPositions; /**< The world space positions of the particle joints in the input pose, gathered once per simulation step. */
         AZStd::string m_name; /**< The name of the simulation. */
         AZ::Vector3 m_gravity = AZ::Vector3(0.0f, 0.0f, -9.81f); /**< The gravity force vector, which is (0.0f, 0.0f, -9.81f) on default. */
         ActorInstance* m_actorInstance = nullptr; /**< The actor instance we work on. */
@@ -188,5 +191,6 @@ namespace EMotionFX
         float m_dampingFactor = 1.0; /**< The factor that is applied to the damping. A value of 2 would make the damping twice as large. */
         bool m_collisionDetection = true; /**< Perform collision detection? Default is true. */
         bool m_stabilize = true; /**< When set to true this will stabilize/warmup the simulation. */
+        bool m_collidersFollowSimulation = false; /**< Is any collider attached to a simulated joint or one of its child joints? If not, the colliders don't move while solving the constraints. */
     };
 } // namespace EMotionFX
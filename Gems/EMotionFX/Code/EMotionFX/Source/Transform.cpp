@@ -561,6 +561,46 @@ namespace EMotionFX
     }
 
 
+    void Transform::BlendTransforms(Transform* inOutTransforms, const Transform* destTransforms, const uint16* indices, uint32 numTransforms, float weight)
+    {
+        if (indices)
+        {
+            for (uint32 i = 0; i < numTransforms; ++i)
+            {
+                const uint16 index = indices[i];
+                inOutTransforms[index].Blend(destTransforms[index], weight);
+            }
+        }
+        else
+        {
+            for (uint32 i = 0; i < numTransforms; ++i)
+            {
+                inOutTransforms[i].Blend(destTransforms[i], weight);
+            }
+        }
+    }
+
+
+    void Transform::BlendTransformsAdditive(Transform* inOutTransforms, const Transform* destTransforms, const Transform* orgTransforms, const uint16* indices, uint32 numTransforms, float weight)
+    {
+        if (indices)
+        {
+            for (uint32 i = 0; i < numTransforms; ++i)
+            {
+                const uint16 index = indices[i];
+                inOutTransforms[index].BlendAdditive(destTransforms[index], orgTransforms[index], weight);
+            }
+        }
+        else
+        {
+            for (uint32 i = 0; i < numTransforms; ++i)
+            {
+                inOutTransforms[i].BlendAdditive(destTransforms[i], orgTransforms[i], weight);
+            }
+        }
+    }
+
+
     Transform& Transform::ApplyAdditive(const Transform& additive)
     {
         mPosition += additive.mPosition;
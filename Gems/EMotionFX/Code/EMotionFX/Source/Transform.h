@@ -126,6 +126,28 @@ namespace EMotionFX
 
         static void ApplyMirrorFlags(Transform* inOutTransform, uint8 mirrorFlags);
 
+        /**
+         * Blend a set of transforms towards their destination transforms, with the same result as calling Blend() on each of them.
+         * The transforms are processed in a single loop over the arrays, so that the per transform work gets inlined.
+         * @param inOutTransforms The transforms to blend, which will contain the blended transforms.
+         * @param destTransforms The transforms to blend towards, in the same order as inOutTransforms.
+         * @param indices The indices of the transforms to blend, or nullptr to blend the first numTransforms transforms.
+         * @param numTransforms The number of indices, or the number of transforms when indices is nullptr.
+         * @param weight The blend weight, between 0 (keep the transforms) and 1 (use the destination transforms).
+         */
+        static void BlendTransforms(Transform* inOutTransforms, const Transform* destTransforms, const uint16* indices, uint32 numTransforms, float weight);
+
+        /**
+         * Additively blend a set of transforms, with the same result as calling BlendAdditive() on each of them.
+         * @param inOutTransforms The transforms to blend, which will contain the blended transforms.
+         * @param destTransforms The transforms to blend towards, in the same order as inOutTransforms.
+         * @param orgTransforms The transforms the destination transforms are relative to, in the same order as inOutTransforms.
+         * @param indices The indices of the transforms to blend, or nullptr to blend the first numTransforms transforms.
+         * @param numTransforms The number of indices, or the number of transforms when indices is nullptr.
+         * @param weight The blend weight.
+         */
+        static void BlendTransformsAdditive(Transform* inOutTransforms, const Transform* destTransforms, const Transform* orgTransforms, const uint16* indices, uint32 numTransforms, float weight);
+
         // operators
         Transform   operator +  (const Transform& right) const;
         Transform   operator -  (const Transform& right) const;
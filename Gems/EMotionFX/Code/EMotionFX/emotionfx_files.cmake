@@ -346,10 +346,14 @@ set(FILES
     Source/EventInfo.h
     Source/EventManager.cpp
     Source/EventManager.h
+    Source/MotionData/CompressedMotionData.cpp
+    Source/MotionData/CompressedMotionData.h
     Source/MotionData/MotionData.cpp
     Source/MotionData/MotionData.h
     Source/MotionData/MotionDataFactory.cpp
     Source/MotionData/MotionDataFactory.h
+    Source/MotionData/MotionSamplingCache.cpp
+    Source/MotionData/MotionSamplingCache.h
     Source/MotionData/NonUniformMotionData.cpp
     Source/MotionData/NonUniformMotionData.h
     Source/MotionData/UniformMotionData.cpp
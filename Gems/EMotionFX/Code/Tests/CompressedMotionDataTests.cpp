@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/UnitTest.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Math/Quaternion.h>
+#include <EMotionFX/Source/MotionData/CompressedMotionData.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <MCore/Source/MemoryFile.h>
+#include <Tests/ActorFixture.h>
+#include <Tests/Matchers.h>
+
+namespace EMotionFX
+{
+    class CompressedMotionDataTests
+        : public ActorFixture
+        , public UnitTest::TraceBusRedirector
+    {
+    public:
+        void SetUp()
+        {
+            UnitTest::TraceBusRedirector::BusConnect();
+            ActorFixture::SetUp();
+        }
+
+        void TearDown()
+        {
+            ActorFixture::TearDown();
+            UnitTest::TraceBusRedirector::BusDisconnect();
+        }
+
+        // Joint 0 moves along x and rotates around z, joint 1 doesn't move, the first morph goes from 0 to 1.
+        void InitSourceMotionData(NonUniformMotionData& motionData)
+        {
+            motionData.Resize(2, 1, 1);
+            motionData.SetJointName(0, "Joint1");
+            motionData.SetJointName(1, "Joint2");
+            motionData.SetMorphName(0, "Morph1");
+            motionData.SetFloatName(0, "Float1");
+
+            const size_t numSamples = 11;
+            motionData.AllocateJointPositionSamples(0, numSamples);
+            motionData.AllocateJointRotationSamples(0, numSamples);
+            motionData.AllocateJointPositionSamples(1, numSamples);
+            motionData.AllocateMorphSamples(0, numSamples);
+            for (size_t i = 0; i < numSamples; ++i)
+            {
+                const float time = static_cast<float>(i) * 0.1f;
+                motionData.SetJointPositionSample(0, i, { time, AZ::Vector3(time * 10.0f, 0.0f, 0.0f) });
+                motionData.SetJointRotationSample(0, i, { time, AZ::Quaternion::CreateRotationZ(time) });
+                motionData.SetJointPositionSample(1, i, { time, AZ::Vector3(0.0f, 1.0f, 0.0f) });
+                motionData.SetMorphSample(0, i, { time, time });
+            }
+            motionData.UpdateDuration();
+        }
+    };
+
+    TEST_F(CompressedMotionDataTests, InitFromNonUniformData)
+    {
+        NonUniformMotionData sourceData;
+        InitSourceMotionData(sourceData);
+
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(&sourceData, /*keepSameSampleRate=*/false, /*newSampleRate=*/10.0f);
+        EXPECT_EQ(motionData.GetNumJoints(), 2);
+        EXPECT_EQ(motionData.GetNumMorphs(), 1);
+        EXPECT_EQ(motionData.GetNumFloats(), 1);
+        EXPECT_EQ(motionData.GetNumSamples(), 11);
+        EXPECT_FLOAT_EQ(motionData.GetDuration(), 1.0f);
+        EXPECT_TRUE(motionData.IsJointPositionAnimated(0));
+        EXPECT_TRUE(motionData.IsJointRotationAnimated(0));
+        EXPECT_TRUE(motionData.IsJointPositionAnimated(1));
+        EXPECT_FALSE(motionData.IsJointRotationAnimated(1));
+        EXPECT_TRUE(motionData.IsMorphAnimated(0));
+        EXPECT_FALSE(motionData.IsFloatAnimated(0));
+
+        for (float time = 0.0f; time <= 1.0f; time += 0.05f)
+        {
+            EXPECT_THAT(motionData.SampleJointPosition(time, 0), IsClose(sourceData.SampleJointPosition(time, 0)));
+            EXPECT_THAT(motionData.SampleJointRotation(time, 0), IsClose(sourceData.SampleJointRotation(time, 0)));
+            EXPECT_NEAR(motionData.SampleMorph(time, 0), sourceData.SampleMorph(time, 0), 0.001f);
+        }
+    }
+
+    TEST_F(CompressedMotionDataTests, Optimize)
+    {
+        NonUniformMotionData sourceData;
+        InitSourceMotionData(sourceData);
+
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(&sourceData, /*keepSameSampleRate=*/false, /*newSampleRate=*/10.0f);
+        EXPECT_EQ(motionData.GetNumTracks(), 4);
+        const size_t numBitsPerSample = motionData.GetNumBitsPerSample();
+
+        MotionData::OptimizeSettings settings;
+        settings.m_maxPosError = 0.01f;
+        settings.m_maxRotError = 0.1f;
+        settings.m_maxMorphError = 0.01f;
+        motionData.Optimize(settings);
+
+        // The joint that doesn't move loses its track, the others use less bits.
+        EXPECT_FALSE(motionData.IsJointPositionAnimated(1));
+        EXPECT_THAT(motionData.GetJointStaticPosition(1), IsClose(AZ::Vector3(0.0f, 1.0f, 0.0f)));
+        EXPECT_EQ(motionData.GetNumTracks(), 3);
+        EXPECT_LT(motionData.GetNumBitsPerSample(), numBitsPerSample);
+        for (size_t i = 0; i < motionData.GetNumTracks(); ++i)
+        {
+            EXPECT_LT(motionData.GetTrackBitsPerComponent(i), CompressedMotionData::s_maxBitsPerComponent);
+        }
+
+        for (float time = 0.0f; time <= 1.0f; time += 0.05f)
+        {
+            EXPECT_TRUE(motionData.SampleJointPosition(time, 0).IsClose(sourceData.SampleJointPosition(time, 0), 0.01f));
+            EXPECT_NEAR(motionData.SampleMorph(time, 0), sourceData.SampleMorph(time, 0), 0.01f);
+        }
+    }
+
+    TEST_F(CompressedMotionDataTests, SaveAndRead)
+    {
+        NonUniformMotionData sourceData;
+        InitSourceMotionData(sourceData);
+
+        CompressedMotionData motionData;
+        motionData.InitFromNonUniformData(&sourceData, /*keepSameSampleRate=*/false, /*newSampleRate=*/10.0f);
+        motionData.Optimize(MotionData::OptimizeSettings());
+
+        MCore::MemoryFile file;
+        file.Open();
+        MotionData::SaveSettings saveSettings;
+        ASSERT_TRUE(motionData.Save(&file, saveSettings));
+        EXPECT_EQ(file.GetFileSize(), motionData.CalcStreamSaveSizeInBytes(saveSettings));
+
+        file.Seek(0);
+        CompressedMotionData loadedData;
+        MotionData::ReadSettings readSettings;
+        readSettings.m_version = motionData.GetStreamSaveVersion();
+        ASSERT_TRUE(loadedData.Read(&file, readSettings));
+
+        EXPECT_EQ(loadedData.GetNumJoints(), 2);
+        EXPECT_EQ(loadedData.GetJointName(1), "Joint2");
+        EXPECT_EQ(loadedData.GetMorphName(0), "Morph1");
+        EXPECT_EQ(loadedData.GetNumTracks(), motionData.GetNumTracks());
+        EXPECT_EQ(loadedData.GetNumBitsPerSample(), motionData.GetNumBitsPerSample());
+        for (float time = 0.0f; time <= 1.0f; time += 0.05f)
+        {
+            EXPECT_THAT(loadedData.SampleJointPosition(time, 0), IsClose(motionData.SampleJointPosition(time, 0)));
+            EXPECT_THAT(loadedData.SampleJointRotation(time, 0), IsClose(motionData.SampleJointRotation(time, 0)));
+            EXPECT_FLOAT_EQ(loadedData.SampleMorph(time, 0), motionData.SampleMorph(time, 0));
+        }
+    }
+} // namespace EMotionFX
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <EMotionFX/Source/ActorInstance.h>
+#include <EMotionFX/Source/Actor.h>
+#include <EMotionFX/Source/EMotionFXManager.h>
+#include <EMotionFX/Source/Motion.h>
+#include <EMotionFX/Source/MotionInstance.h>
+#include <EMotionFX/Source/MotionSystem.h>
+#include <EMotionFX/Source/MotionData/MotionSamplingCache.h>
+#include <EMotionFX/Source/MotionData/NonUniformMotionData.h>
+#include <EMotionFX/Source/Pose.h>
+#include <EMotionFX/Source/TransformData.h>
+#include <Tests/Matchers.h>
+#include <Tests/SystemComponentFixture.h>
+#include <Tests/TestAssetCode/ActorFactory.h>
+#include <Tests/TestAssetCode/SimpleActors.h>
+
+namespace EMotionFX
+{
+    class MotionSamplingCacheFixture
+        : public SystemComponentFixture
+    {
+    public:
+        void SetUp() override
+        {
+            SystemComponentFixture::SetUp();
+
+            m_actor = ActorFactory::CreateAndInit<SimpleJointChainActor>(3);
+
+            // Move joint1 along the z axis over one second.
+            NonUniformMotionData* motionData = aznew NonUniformMotionData();
+            const Transform bindTransform = m_actor->GetBindPose()->GetLocalSpaceTransform(1);
+            const size_t jointDataIndex = motionData->AddJoint("joint1", bindTransform, bindTransform);
+            motionData->AllocateJointPositionSamples(jointDataIndex, 2);
+            motionData->SetJointPositionSample(jointDataIndex, 0, { 0.0f, bindTransform.mPosition });
+            motionData->SetJointPositionSample(jointDataIndex, 1, { 1.0f, bindTransform.mPosition + AZ::Vector3(0.0f, 0.0f, 1.0f) });
+            m_motion = aznew Motion("MotionSamplingCacheTest");
+            m_motion->SetMotionData(motionData);
+            m_motion->UpdateDuration();
+
+            for (size_t i = 0; i < 2; ++i)
+            {
+                m_actorInstances[i] = ActorInstance::Create(m_actor.get());
+                m_motionInstances[i] = m_actorInstances[i]->GetMotionSystem()->PlayMotion(m_motion);
+            }
+        }
+
+        void TearDown() override
+        {
+            GetMotionSamplingCache().SetEnabled(false);
+
+            for (ActorInstance* actorInstance : m_actorInstances)
+            {
+                actorInstance->Destroy();
+            }
+            m_motion->Destroy();
+            m_actor.reset();
+
+            SystemComponentFixture::TearDown();
+        }
+
+        void SamplePose(size_t instanceIndex, float time, Pose& outPose)
+        {
+            ActorInstance* actorInstance = m_actorInstances[instanceIndex];
+            outPose.LinkToActorInstance(actorInstance);
+            outPose.InitFromBindPose(actorInstance);
+            m_motionInstances[instanceIndex]->SetCurrentTime(time, true);
+            m_motion->Update(actorInstance->GetTransformData()->GetBindPose(), &outPose, m_motionInstances[instanceIndex]);
+        }
+
+    protected:
+        AZStd::unique_ptr<Actor> m_actor;
+        Motion* m_motion = nullptr;
+        ActorInstance* m_actorInstances[2] = { nullptr, nullptr };
+        MotionInstance* m_motionInstances[2] = { nullptr, nullptr }; // Deleted together with the actor instances.
+    };
+
+    TEST_F(MotionSamplingCacheFixture, InstancesInSyncShareSamples)
+    {
+        Pose expectedPose;
+        SamplePose(0, 0.5f, expectedPose);
+
+        MotionSamplingCache& cache = GetMotionSamplingCache();
+        cache.SetEnabled(true);
+        cache.BeginFrame();
+
+        Pose poses[2];
+        SamplePose(0, 0.5f, poses[0]);
+        SamplePose(1, 0.5f, poses[1]);
+        EXPECT_EQ(cache.GetNumMisses(), 1);
+        EXPECT_EQ(cache.GetNumHits(), 1);
+        EXPECT_EQ(cache.GetNumEntries(), 1);
+        for (const Pose& pose : poses)
+        {
+            for (AZ::u32 i = 0; i < m_actor->GetNumNodes(); ++i)
+            {
+                EXPECT_THAT(pose.GetLocalSpaceTransform(i), IsClose(expectedPose.GetLocalSpaceTransform(i)));
+            }
+        }
+
+        // The samples of the previous frame aren't shared with the next one.
+        cache.BeginFrame();
+        SamplePose(1, 0.5f, poses[1]);
+        EXPECT_EQ(cache.GetNumMisses(), 1);
+        EXPECT_EQ(cache.GetNumHits(), 0);
+    }
+
+    TEST_F(MotionSamplingCacheFixture, TimesAreSnappedToTimeStep)
+    {
+        MotionSamplingCache& cache = GetMotionSamplingCache();
+        cache.SetEnabled(true);
+        cache.SetTimeStep(0.1f);
+        cache.BeginFrame();
+
+        Pose poses[2];
+        SamplePose(0, 0.49f, poses[0]);
+        SamplePose(1, 0.52f, poses[1]);
+        EXPECT_EQ(cache.GetNumMisses(), 1);
+        EXPECT_EQ(cache.GetNumHits(), 1);
+        EXPECT_THAT(poses[0].GetLocalSpaceTransform(1), IsClose(poses[1].GetLocalSpaceTransform(1)));
+        EXPECT_NEAR(poses[0].GetLocalSpaceTransform(1).mPosition.GetZ(), 0.5f, 0.001f);
+
+        // Deleting the motion releases its samples.
+        Motion* otherMotion = aznew Motion("OtherMotion");
+        otherMotion->SetMotionData(aznew NonUniformMotionData());
+        MotionInstance* otherInstance = m_actorInstances[0]->GetMotionSystem()->PlayMotion(otherMotion);
+        Pose otherPose;
+        otherPose.LinkToActorInstance(m_actorInstances[0]);
+        otherPose.InitFromBindPose(m_actorInstances[0]);
+        otherMotion->Update(&otherPose, &otherPose, otherInstance);
+        EXPECT_EQ(cache.GetNumEntries(), 2);
+        m_actorInstances[0]->GetMotionSystem()->RemoveMotionInstance(otherInstance);
+        otherMotion->Destroy();
+        EXPECT_EQ(cache.GetNumEntries(), 1);
+    }
+} // namespace EMotionFX
@@ -42,4 +42,39 @@ namespace EMotionFX
 
         actorInstance->Destroy();
     }
+
+    TEST_F(SystemComponentFixture, MultiThreadScheduler_BatchedActorInstances_AllEnabledActorInstancesUpdated)
+    {
+        ActorUpdateScheduler* baseScheduler = GetEMotionFX().GetActorManager()->GetScheduler();
+        ASSERT_EQ(baseScheduler->GetType(), MultiThreadScheduler::TYPE_ID) << "Expected multi thread scheduler.";
+        MultiThreadScheduler* scheduler = static_cast<MultiThreadScheduler*>(baseScheduler);
+        const AZ::u32 oldMaxActorInstancesPerJob = scheduler->GetMaxActorInstancesPerJob();
+
+        AZStd::unique_ptr<JackNoMeshesActor> actor = ActorFactory::CreateAndInit<JackNoMeshesActor>();
+        AZStd::vector<ActorInstance*> actorInstances;
+        for (size_t i = 0; i < 7; ++i)
+        {
+            actorInstances.emplace_back(ActorInstance::Create(actor.get()));
+        }
+        actorInstances[3]->SetIsEnabled(false);
+
+        // Batches that don't divide the number of actor instances, one actor instance per job and a single job for all of them.
+        for (const AZ::u32 maxActorInstancesPerJob : { 3, 1, 16 })
+        {
+            scheduler->SetMaxActorInstancesPerJob(maxActorInstancesPerJob);
+            EXPECT_EQ(scheduler->GetMaxActorInstancesPerJob(), maxActorInstancesPerJob);
+
+            scheduler->Execute(0.1f);
+            EXPECT_EQ(scheduler->GetNumUpdatedActorInstances(), 6) << "Expected all enabled actor instances to be updated.";
+        }
+
+        scheduler->SetMaxActorInstancesPerJob(0);
+        EXPECT_EQ(scheduler->GetMaxActorInstancesPerJob(), 1) << "Expected at least one actor instance per job.";
+
+        scheduler->SetMaxActorInstancesPerJob(oldMaxActorInstancesPerJob);
+        for (ActorInstance* actorInstance : actorInstances)
+        {
+            actorInstance->Destroy();
+        }
+    }
 } // namespace EMotionFX
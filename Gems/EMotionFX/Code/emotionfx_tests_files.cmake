@@ -77,6 +77,7 @@ set(FILES
     Tests/BlendTreeTwoLinkIKNodeTests.cpp
     Tests/BoolLogicNodeTests.cpp
     Tests/ColliderCommandTests.cpp
+    Tests/CompressedMotionDataTests.cpp
     Tests/EMotionFXTest.cpp
     Tests/EmotionFXMathLibTests.cpp
     Tests/EventManagerTests.cpp
@@ -95,6 +96,7 @@ set(FILES
     Tests/MotionExtractionBusTests.cpp
     Tests/MotionInstanceTests.cpp
     Tests/MotionLayerSystemTests.cpp
+    Tests/MotionSamplingCacheTests.cpp
     Tests/MultiThreadSchedulerTests.cpp
     Tests/PoseTests.cpp
     Tests/Printers.cpp
@@ -7,6 +7,7 @@
  */
 
 #include "FastNoiseGradientComponent.h"
+#include <AzCore/Debug/Profiler.h>
 #include <AzCore/Math/MathUtils.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
@@ -312,6 +313,27 @@ namespace FastNoiseGem
         return 0.0f;
     }
 
+    void FastNoiseGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        // Transform all the positions with a single bus call, then run the generator over the whole span
+        AZStd::vector<AZ::Vector3> uvws(positions);
+        AZStd::vector<bool> wasPointRejected(positions.size(), false);
+        const bool shouldNormalizeOutput = false;
+        GradientSignal::GradientTransformRequestBus::Event(
+            GetEntityId(), &GradientSignal::GradientTransformRequestBus::Events::TransformPositionsToUVW, positions, uvws,
+            shouldNormalizeOutput, wasPointRejected);
+
+        for (size_t index = 0; index < positions.size(); ++index)
+        {
+            // Generator returns a range between [-1, 1], map that to [0, 1]
+            outValues[index] = wasPointRejected[index]
+                ? 0.0f
+                : AZ::GetClamp((m_generator.GetNoise(uvws[index].GetX(), uvws[index].GetY(), uvws[index].GetZ()) + 1.0f) / 2.0f, 0.0f, 1.0f);
+        }
+    }
+
     template <typename TValueType, TValueType FastNoiseGradientConfig::*TConfigMember, void (FastNoise::*TMethod)(TValueType)>
     void FastNoiseGradientComponent::SetConfigValue(TValueType value)
     {
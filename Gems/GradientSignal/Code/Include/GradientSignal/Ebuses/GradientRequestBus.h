@@ -10,6 +10,7 @@
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/Component/EntityId.h>
 #include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/vector.h>
 
 namespace GradientSignal
 {
@@ -49,6 +50,22 @@ namespace GradientSignal
         */
         virtual float GetValue(const GradientSampleParams& sampleParams) const = 0;
 
+        /**
+        * Given a list of positions, generate a value for each of them. The same thread-safety requirements as GetValue apply.
+        * The default implementation calls GetValue for each position. Gradients override it to sample all the positions
+        * at once, which avoids the per-position overhead of the bus calls through the gradient chain.
+        * @param positions The positions to generate values for
+        * @param outValues The generated values, it has to be the same size as positions
+        */
+        virtual void GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+        {
+            AZ_Assert(positions.size() == outValues.size(), "The size of the positions and output values has to match.");
+            for (size_t index = 0; index < positions.size(); ++index)
+            {
+                outValues[index] = GetValue(GradientSampleParams(positions[index]));
+            }
+        }
+
         /**
         * Call to check the hierarchy to see if a given entityId exists in the gradient signal chain
         */
@@ -15,6 +15,7 @@
 #include <AzCore/RTTI/ReflectContext.h>
 #include <AzCore/RTTI/RTTI.h>
 #include <AzCore/Serialization/EditContextConstants.inl>
+#include <AzCore/std/algorithm.h>
 #include <GradientSignal/Ebuses/GradientRequestBus.h>
 #include <GradientSignal/Ebuses/GradientTransformRequestBus.h>
 #include <GradientSignal/Util.h>
@@ -33,6 +34,9 @@ namespace GradientSignal
 
         inline float GetValue(const GradientSampleParams& sampleParams) const;
 
+        //! Samples the gradient at all positions with a single request, outValues has to be the same size as positions.
+        inline void GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const;
+
         bool IsEntityInHierarchy(const AZ::EntityId& entityId) const;
 
         AZ::EntityId m_gradientId;
@@ -146,4 +150,72 @@ namespace GradientSignal
 
         return output * m_opacity;
     }
+
+    inline void GradientSampler::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        AZ_Assert(positions.size() == outValues.size(), "The size of the positions and output values has to match.");
+
+        if (m_opacity <= 0.0f || !m_gradientId.IsValid())
+        {
+            AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+            return;
+        }
+
+        //apply transform if set
+        AZStd::vector<AZ::Vector3> transformedPositions;
+        const bool applyTransform = m_enableTransform && GradientSamplerUtil::AreTransformParamsSet(*this);
+        if (applyTransform)
+        {
+            AZ::Matrix3x4 matrix3x4;
+            matrix3x4.SetFromEulerDegrees(m_rotate);
+            matrix3x4.MultiplyByScale(m_scale);
+            matrix3x4.SetTranslation(m_translate);
+
+            transformedPositions.reserve(positions.size());
+            for (const AZ::Vector3& position : positions)
+            {
+                transformedPositions.push_back(matrix3x4 * position);
+            }
+        }
+
+        {
+            // See GetValue for the reason we lock the surface data mutex before checking for cyclic dependencies.
+            auto& surfaceDataContext = SurfaceData::SurfaceDataSystemRequestBus::GetOrCreateContext(false);
+            typename SurfaceData::SurfaceDataSystemRequestBus::Context::DispatchLockGuard scopeLock(surfaceDataContext.m_contextMutex);
+
+            if (m_isRequestInProgress)
+            {
+                AZ_ErrorOnce("GradientSignal", !m_isRequestInProgress, "Detected cyclic dependences with gradient entity references");
+                AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+                return;
+            }
+
+            m_isRequestInProgress = true;
+
+            // Gradients that aren't connected to the bus leave the values untouched, so they need to start out at 0.
+            AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+            GradientRequestBus::Event(m_gradientId, &GradientRequestBus::Events::GetValues, applyTransform ? transformedPositions : positions, outValues);
+
+            m_isRequestInProgress = false;
+        }
+
+        const bool applyLevels = m_enableLevels && GradientSamplerUtil::AreLevelParamsSet(*this);
+        for (float& output : outValues)
+        {
+            if (m_invertInput)
+            {
+                output = 1.0f - output;
+            }
+
+            //apply levels if set
+            if (applyLevels)
+            {
+                output = GetLevels(output, m_inputMid, m_inputMin, m_inputMax, m_outputMin, m_outputMax);
+            }
+
+            output *= m_opacity;
+        }
+    }
 }
@@ -328,6 +328,31 @@ namespace GradientSignal
 
         AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
 
+        TransformPositionToUVWInternal(inPosition, outUVW, shouldNormalizeOutput, wasPointRejected);
+    }
+
+    void GradientTransformComponent::TransformPositionsToUVW(
+        const AZStd::vector<AZ::Vector3>& inPositions, AZStd::vector<AZ::Vector3>& outUVWs, const bool shouldNormalizeOutput,
+        AZStd::vector<bool>& wasPointRejected) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        AZ_Assert(inPositions.size() == outUVWs.size() && inPositions.size() == wasPointRejected.size(),
+            "The size of the positions and outputs has to match.");
+
+        // Lock the cached transform and bounds once for the entire list of positions
+        AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
+
+        for (size_t index = 0; index < inPositions.size(); ++index)
+        {
+            bool rejected = false;
+            TransformPositionToUVWInternal(inPositions[index], outUVWs[index], shouldNormalizeOutput, rejected);
+            wasPointRejected[index] = rejected;
+        }
+    }
+
+    void GradientTransformComponent::TransformPositionToUVWInternal(const AZ::Vector3& inPosition, AZ::Vector3& outUVW, const bool shouldNormalizeOutput, bool& wasPointRejected) const
+    {
         //transforming coordinate into "local" relative space of shape bounds
         outUVW = m_shapeTransformInverse * inPosition;
 
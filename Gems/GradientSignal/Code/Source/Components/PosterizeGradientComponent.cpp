@@ -149,9 +149,14 @@ namespace GradientSignal
     }
 
     float PosterizeGradientComponent::GetValue(const GradientSampleParams& sampleParams) const
+    {
+        return PosterizeValue(m_configuration.m_gradientSampler.GetValue(sampleParams));
+    }
+
+    float PosterizeGradientComponent::PosterizeValue(float value) const
     {
         const float bands = AZ::GetMax(static_cast<float>(m_configuration.m_bands), 2.0f);
-        const float input = AZ::GetClamp(m_configuration.m_gradientSampler.GetValue(sampleParams), 0.0f, 1.0f);
+        const float input = AZ::GetClamp(value, 0.0f, 1.0f);
         float output = 0.0f;
 
         // "quantize" the input down to a number that goes from 0 to (bands-1)
@@ -181,6 +186,16 @@ namespace GradientSignal
         return AZ::GetClamp(output, 0.0f, 1.0f);
     }
 
+    void PosterizeGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        m_configuration.m_gradientSampler.GetValues(positions, outValues);
+
+        for (float& output : outValues)
+        {
+            output = PosterizeValue(output);
+        }
+    }
+
     bool PosterizeGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
     {
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
@@ -73,6 +73,7 @@ namespace GradientSignal
         //////////////////////////////////////////////////////////////////////////
         // GradientRequestBus
         float GetValue(const GradientSampleParams& sampleParams) const override;
+        void GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const override;
         bool IsEntityInHierarchy(const AZ::EntityId& entityId) const override;
 
     protected:
@@ -86,6 +87,8 @@ namespace GradientSignal
         GradientSampler& GetGradientSampler() override;
 
     private:
+        float PosterizeValue(float value) const;
+
         PosterizeGradientConfig m_configuration;
         LmbrCentral::DependencyMonitor m_dependencyMonitor;
     };
@@ -64,6 +64,24 @@ namespace UnitTest
                     EXPECT_NEAR(actualValue, expectedValue, 0.01f);
                 }
             }
+
+            // The batch request has to produce the same values as the individual ones.
+            AZStd::vector<AZ::Vector3> positions;
+            positions.reserve(size * size);
+            for (int y = 0; y < size; ++y)
+            {
+                for (int x = 0; x < size; ++x)
+                {
+                    positions.push_back(AZ::Vector3(static_cast<float>(x), static_cast<float>(y), 0.0f));
+                }
+            }
+
+            AZStd::vector<float> actualValues(positions.size());
+            gradientSampler.GetValues(positions, actualValues);
+            for (size_t index = 0; index < positions.size(); ++index)
+            {
+                EXPECT_NEAR(actualValues[index], expectedOutput[index], 0.01f);
+            }
         }
 
         AZStd::unique_ptr<AZ::Entity> CreateEntity()
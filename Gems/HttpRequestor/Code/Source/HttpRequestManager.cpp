@@ -22,11 +22,16 @@ AZ_PUSH_DISABLE_WARNING(4251 4996, "-Wunknown-warning-option")
 AZ_POP_DISABLE_WARNING
 
 #include <AWSNativeSDKInit/AWSNativeSDKInit.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/std/string/conversions.h>
 #include "HttpRequestManager.h"
 
 namespace HttpRequestor
 {
+    AZ_CVAR(uint32_t, http_requestThreadCount, 1, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "The number of requests the HttpRequestor sends at the same time, read when the gem starts. "
+        "With more than one, requests can complete out of order.");
+
     const char* Manager::s_loggingName = "GemHttpRequestManager";
 
     Manager::Manager()
@@ -37,8 +42,20 @@ namespace HttpRequestor
         m_runThread = true;
         // Shutdown will be handled by the InitializationManager - no need to call in the destructor
         AWSNativeSDKInit::InitializationManager::InitAwsApi();
+
+        const uint32_t threadCount = AZStd::max(static_cast<uint32_t>(http_requestThreadCount), 1u);
+
+        Aws::Client::ClientConfiguration config;
+        config.enableTcpKeepAlive = AZ_TRAIT_AZFRAMEWORK_AWS_ENABLE_TCP_KEEP_ALIVE_SUPPORTED;
+        config.maxConnections = AZStd::max(config.maxConnections, static_cast<unsigned>(threadCount));
+        m_httpClient = Aws::Http::CreateHttpClient(config);
+
         auto function = AZStd::bind(&Manager::ThreadFunction, this);
-        m_thread = AZStd::thread(function, &desc);
+        m_threads.reserve(threadCount);
+        for (uint32_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+        {
+            m_threads.emplace_back(function, &desc);
+        }
     }
 
     Manager::~Manager()
@@ -46,11 +63,15 @@ namespace HttpRequestor
         // NativeSDK Shutdown does not need to be called here - will be taken care of by the InitializationManager
         m_runThread = false;
         m_requestConditionVar.notify_all();
-        if (m_thread.joinable())
+        for (AZStd::thread& thread : m_threads)
         {
-            m_thread.join();
+            if (thread.joinable())
+            {
+                thread.join();
+            }
         }
 
+        m_httpClient.reset();
     }
 
     void Manager::AddRequest(Parameters && httpRequestParameters)
@@ -59,7 +80,7 @@ namespace HttpRequestor
             AZStd::lock_guard<AZStd::mutex> lock(m_requestMutex);
             m_requestsToHandle.push(AZStd::move(httpRequestParameters));
         }
-        m_requestConditionVar.notify_all();
+        m_requestConditionVar.notify_one();
     }
 
     void Manager::AddTextRequest(TextParameters && httpTextRequestParameters)
@@ -68,7 +89,7 @@ namespace HttpRequestor
             AZStd::lock_guard<AZStd::mutex> lock(m_requestMutex);
             m_textRequestsToHandle.push(AZStd::move(httpTextRequestParameters));
         }
-        m_requestConditionVar.notify_all();
+        m_requestConditionVar.notify_one();
     }
 
     void Manager::ThreadFunction()
@@ -76,46 +97,37 @@ namespace HttpRequestor
         // Run the thread as long as directed
         while (m_runThread)
         {
-            HandleRequestBatch();
+            HandleNextRequest();
         }
     }
 
-    void Manager::HandleRequestBatch()
+    void Manager::HandleNextRequest()
     {
         // Lock mutex and wait for work to be signalled via the condition variable
         AZStd::unique_lock<AZStd::mutex> lock(m_requestMutex);
         m_requestConditionVar.wait(lock, [&] { return !m_runThread || !m_requestsToHandle.empty() || !m_textRequestsToHandle.empty(); });
 
-        // Swap queues
-        AZStd::queue<Parameters> requestsToHandle;
-        requestsToHandle.swap(m_requestsToHandle);
-
-        AZStd::queue<TextParameters> textRequestsToHandle;
-        textRequestsToHandle.swap(m_textRequestsToHandle);
-
-        // Release lock
-        lock.unlock();
-
-        // Handle requests
-        while (!requestsToHandle.empty())
+        // Take a single request and release the lock while it is in flight, so the other worker threads can send the next ones
+        if (!m_requestsToHandle.empty())
         {
-            HandleRequest(requestsToHandle.front());
-            requestsToHandle.pop();
-        }
+            Parameters requestToHandle = AZStd::move(m_requestsToHandle.front());
+            m_requestsToHandle.pop();
+            lock.unlock();
 
-        while (!textRequestsToHandle.empty())
+            HandleRequest(requestToHandle);
+        }
+        else if (!m_textRequestsToHandle.empty())
         {
-            HandleTextRequest(textRequestsToHandle.front());
-            textRequestsToHandle.pop();
+            TextParameters textRequestToHandle = AZStd::move(m_textRequestsToHandle.front());
+            m_textRequestsToHandle.pop();
+            lock.unlock();
+
+            HandleTextRequest(textRequestToHandle);
         }
     }
 
     void Manager::HandleRequest(const Parameters& httpRequestParameters)
     {
-        Aws::Client::ClientConfiguration config;
-        config.enableTcpKeepAlive = AZ_TRAIT_AZFRAMEWORK_AWS_ENABLE_TCP_KEEP_ALIVE_SUPPORTED;
-        std::shared_ptr<Aws::Http::HttpClient> httpClient = Aws::Http::CreateHttpClient(config);
-
         auto httpRequest = Aws::Http::CreateHttpRequest(httpRequestParameters.GetURI(), httpRequestParameters.GetMethod(), Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
 
         AZ_Assert(httpRequest, "HttpRequest not created!");
@@ -131,7 +143,7 @@ namespace HttpRequestor
             httpRequest->SetContentLength(AZStd::to_string(httpRequestParameters.GetBodyStream()->str().length()).c_str());
         }
         
-        auto httpResponse = httpClient->MakeRequest(httpRequest);
+        auto httpResponse = m_httpClient->MakeRequest(httpRequest);
 
         if (!httpResponse)
         {
@@ -158,10 +170,6 @@ namespace HttpRequestor
 
     void Manager::HandleTextRequest(const TextParameters & httpRequestParameters)
     {
-        Aws::Client::ClientConfiguration config;
-        config.enableTcpKeepAlive = AZ_TRAIT_AZFRAMEWORK_AWS_ENABLE_TCP_KEEP_ALIVE_SUPPORTED;
-        std::shared_ptr<Aws::Http::HttpClient> httpClient = Aws::Http::CreateHttpClient(config);
-
         auto httpRequest = Aws::Http::CreateHttpRequest(httpRequestParameters.GetURI(), httpRequestParameters.GetMethod(), Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
         
         for (const auto & it : httpRequestParameters.GetHeaders())
@@ -174,7 +182,7 @@ namespace HttpRequestor
             httpRequest->AddContentBody(httpRequestParameters.GetBodyStream());
         }
 
-        auto httpResponse = httpClient->MakeRequest(httpRequest);
+        auto httpResponse = m_httpClient->MakeRequest(httpRequest);
 
         if (!httpResponse)
         {
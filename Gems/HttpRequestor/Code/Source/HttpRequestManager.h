@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzCore/std/containers/queue.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/mutex.h>
@@ -18,6 +19,13 @@
 #include <HttpRequestor/HttpRequestParameters.h>
 #include <HttpRequestor/HttpTextRequestParameters.h>
 
+#include <memory>
+
+namespace Aws::Http
+{
+    class HttpClient;
+}
+
 namespace HttpRequestor
 {
     class Manager
@@ -36,8 +44,8 @@ namespace HttpRequestor
         // RequestManager thread loop.
         void ThreadFunction();
 
-        // Called by ThreadFunction. Waits for timeout or until notified and processes any requests queued up.
-        void HandleRequestBatch();
+        // Called by ThreadFunction. Waits until notified and processes the oldest request queued up, so every worker thread can take one.
+        void HandleNextRequest();
 
         // Perform an HTTP request, block until a response is received, then give the returned JSON to the callback to parse. Returns the HTTPResponseCode to the callback to handle any errors.
         void HandleRequest(const Parameters & httpRequestParameters);
@@ -51,7 +59,8 @@ namespace HttpRequestor
         AZStd::mutex                            m_requestMutex;                     // Member variables for synchronization
         AZStd::condition_variable               m_requestConditionVar;
         AZStd::atomic<bool>                     m_runThread;                        // Run flag used to signal the worker thread
-        AZStd::thread                           m_thread;                           // This is the thread that will be used for all async operations
+        AZStd::vector<AZStd::thread>            m_threads;                          // These are the worker threads that will be used for all async operations
+        std::shared_ptr<Aws::Http::HttpClient>  m_httpClient;                       // Shared by all requests so their connections are pooled and kept alive
         static const char*                      s_loggingName;                      // Name to use for log messages etc...
     };
 
@@ -300,6 +300,16 @@ void ImGuiManager::Render()
 
     ImGui::ImGuiContextScope contextScope(m_imguiContext);
 
+    // Debug UI does not need to update at the game frame rate. Between updates, re-submit the draw data of the last update,
+    // which ImGui keeps alive until the next NewFrame(), instead of running every listener and rebuilding the draw lists.
+    m_timeSinceLastUpdate += gEnv->pTimer->GetFrameTime();
+    const float updateInterval = m_updateIntervalCVar ? m_updateIntervalCVar->GetFVal() : 0.0f;
+    if (m_hasLastDrawData && m_timeSinceLastUpdate < updateInterval)
+    {
+        RenderLastImGuiBuffers();
+        return;
+    }
+
     // Update Display Size
     ImGuiIO& io = ImGui::GetIO();
     io.DisplaySize = m_lastRenderResolution;
@@ -384,8 +394,9 @@ void ImGuiManager::Render()
         m_editorWindowState = DisplayState::Hidden;
     }
 
-    // Advance ImGui by Elapsed Frame Time
-    io.DeltaTime = gEnv->pTimer->GetFrameTime();
+    // Advance ImGui by the time elapsed since its last update, which spans several frames when imgui_UpdateInterval is set
+    io.DeltaTime = m_timeSinceLastUpdate;
+    m_timeSinceLastUpdate = 0.0f;
     //// END FROM PREUPDATE
 
     AZ::u32 backBufferWidth = m_windowSize.m_width;
@@ -753,6 +764,7 @@ void ImGuiManager::RenderImGuiBuffers(const ImVec2& scaleRects)
     // Run imgui's internal render and retrieve resulting draw data
     ImGui::Render();
     ImDrawData* drawData = ImGui::GetDrawData();
+    m_hasLastDrawData = (drawData != nullptr);
     if (!drawData)
     {
         return;
@@ -768,6 +780,16 @@ void ImGuiManager::RenderImGuiBuffers(const ImVec2& scaleRects)
     }
 }
 
+void ImGuiManager::RenderLastImGuiBuffers()
+{
+    // The clip rects of the last draw data are already scaled, so it is submitted as is.
+    ImDrawData* drawData = ImGui::GetDrawData();
+    if (drawData && m_clientMenuBarState != DisplayState::Hidden)
+    {
+        OtherActiveImGuiRequestBus::Broadcast(&OtherActiveImGuiRequestBus::Events::RenderImGuiBuffers, *drawData);
+    }
+}
+
 void ImGuiManager::OnWindowResized(uint32_t width, uint32_t height)
 {
     m_windowSize.m_width = width;
@@ -805,6 +827,7 @@ namespace ImGuiCVARNames
     static const char* s_imgui_EnableController_Name =              "imgui_EnableController";
     static const char* s_imgui_EnableControllerMouse_Name =         "imgui_EnableControllerMouse";
     static const char* s_imgui_ControllerMouseSensitivity_Name =    "imgui_ControllerMouseSensitivity";
+    static const char* s_imgui_UpdateInterval_Name =                "imgui_UpdateInterval";
 }
 
 void OnAutoEnableComponentsCBFunc(ICVar* pArgs)
@@ -884,6 +907,7 @@ void ImGuiManager::RegisterImGuiCVARs()
     gEnv->pConsole->RegisterInt(ImGuiCVARNames::s_imgui_EnableController_Name, (m_hardwardeMouseConnected ? 0 : 1), VF_DEV_ONLY, CVARHELP("Enable ImGui Controller support. Default to Off on PC, On on Console."), OnEnableControllerCBFunc);
     gEnv->pConsole->RegisterInt(ImGuiCVARNames::s_imgui_EnableControllerMouse_Name, 0, VF_DEV_ONLY, CVARHELP("Enable ImGui Controller Mouse support. Default to Off on PC, On on Console."), OnEnableControllerMouseCBFunc);
     gEnv->pConsole->RegisterFloat(ImGuiCVARNames::s_imgui_ControllerMouseSensitivity_Name, 5.0f, VF_DEV_ONLY, CVARHELP("ImGui Controller Mouse Sensitivty. Frame Multiplier for stick mouse sensitivity"), OnControllerMouseSensitivityCBFunc);
+    m_updateIntervalCVar = gEnv->pConsole->RegisterFloat(ImGuiCVARNames::s_imgui_UpdateInterval_Name, 0.0f, VF_DEV_ONLY, CVARHELP("Minimum time in seconds between ImGui updates. The last update is drawn again on the frames in between. 0 updates every frame."));
 
     // Init CVARs to current values
     OnAutoEnableComponentsCBFunc(gEnv->pConsole->GetCVar(ImGuiCVARNames::s_imgui_AutoEnableComponents_Name));
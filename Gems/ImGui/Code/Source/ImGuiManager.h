@@ -40,6 +40,7 @@ namespace ImGui
         void RegisterImGuiCVARs();
     protected:
         void RenderImGuiBuffers(const ImVec2& scaleRects);
+        void RenderLastImGuiBuffers();
 
         // -- ImGuiManagerBus Interface -------------------------------------------------------------------
         DisplayState GetEditorWindowState() const override { return m_editorWindowState; }
@@ -110,6 +111,11 @@ namespace ImGui
         bool m_useLastPrimaryTouchPosition = false;
         bool m_simulateBackspaceKeyPressed = false;
 
+        // Update rate limiting, see imgui_UpdateInterval
+        ICVar* m_updateIntervalCVar = nullptr;
+        float m_timeSinceLastUpdate = 0.0f;
+        bool m_hasLastDrawData = false;
+
 #if defined(LOAD_IMGUI_LIB_DYNAMICALLY)  && !defined(AZ_MONOLITHIC_BUILD)
         AZStd::unique_ptr<AZ::DynamicModuleHandle>  m_imgSharedLib;
 #endif // defined(LOAD_IMGUI_LIB_DYNAMICALLY)  && !defined(AZ_MONOLITHIC_BUILD)
@@ -171,14 +171,17 @@ namespace LyShine
 
         drawSrg->Compile();
 
-        // Add the indexed primitives to the dynamic draw context for drawing
-        //
-        // [LYSHINE_ATOM_TODO][ATOM-15073] - need to combine into a single DrawIndexed call to take advantage of the draw call
-        // optimization done by this RenderGraph. This option will be added to DynamicDrawContext. For
-        // now we could combine the vertices ourselves
-        for (const IRenderer::DynUiPrimitive& primitive : m_primitives)
+        // Add the indexed primitives to the dynamic draw context for drawing. The primitives are combined into one
+        // DrawIndexed call to take advantage of the draw call optimization done by this RenderGraph
+        if (!m_isMerged)
+        {
+            MergePrimitives();
+        }
+
+        if (!m_mergedIndices.empty())
         {
-            dynamicDraw->DrawIndexed(primitive.m_vertices, primitive.m_numVertices, primitive.m_indices, primitive.m_numIndices, AZ::RHI::IndexFormat::Uint16, drawSrg);
+            dynamicDraw->DrawIndexed(m_mergedVertices.data(), static_cast<uint32_t>(m_mergedVertices.size()),
+                m_mergedIndices.data(), static_cast<uint32_t>(m_mergedIndices.size()), AZ::RHI::IndexFormat::Uint16, drawSrg);
         }
     }
 
@@ -191,6 +194,8 @@ namespace LyShine
 
         m_totalNumVertices += primitive->m_numVertices;
         m_totalNumIndices += primitive->m_numIndices;
+
+        m_isMerged = false;
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -223,6 +228,28 @@ namespace LyShine
         return primitive->m_numVertices + m_totalNumVertices < std::numeric_limits<uint16>::max();
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    void PrimitiveListRenderNode::MergePrimitives()
+    {
+        m_mergedVertices.clear();
+        m_mergedIndices.clear();
+        m_mergedVertices.reserve(m_totalNumVertices);
+        m_mergedIndices.reserve(m_totalNumIndices);
+
+        // HasSpaceToAddPrimitive keeps the total number of vertices in range of 16 bit indices
+        for (const IRenderer::DynUiPrimitive& primitive : m_primitives)
+        {
+            const uint16 baseVertex = static_cast<uint16>(m_mergedVertices.size());
+            m_mergedVertices.insert(m_mergedVertices.end(), primitive.m_vertices, primitive.m_vertices + primitive.m_numVertices);
+            for (int i = 0; i < primitive.m_numIndices; ++i)
+            {
+                m_mergedIndices.push_back(static_cast<uint16>(primitive.m_indices[i] + baseVertex));
+            }
+        }
+
+        m_isMerged = true;
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     int PrimitiveListRenderNode::FindTexture(const AZ::Data::Instance<AZ::RPI::Image>& texture, bool isClampTextureMode) const
     {
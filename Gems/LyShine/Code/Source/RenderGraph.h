@@ -13,6 +13,7 @@
 #include <AzCore/Memory/PoolAllocator.h>
 #include <AzCore/std/containers/stack.h>
 #include <AzCore/std/containers/set.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/Math/Color.h>
 
 #include <Atom/RPI.Reflect/Image/Image.h>
@@ -90,6 +91,10 @@ namespace LyShine
         // Search to see if this texture is already used by this texture unit, returns -1 if not used
         int FindTexture(const AZ::Data::Instance<AZ::RPI::Image>& texture, bool isClampTextureMode) const;
 
+        //! Merges the vertices and indices of all the primitives into one buffer so that they can be drawn with one DrawIndexed.
+        //! The render graph is only rebuilt when it is dirty, so the merged buffer is reused until the graph is rebuilt.
+        void MergePrimitives();
+
 #ifndef _RELEASE
         // A debug-only function useful for debugging
         void ValidateNode() override;
@@ -116,6 +121,10 @@ namespace LyShine
         int             m_totalNumIndices;
 
         IRenderer::DynUiPrimitiveList   m_primitives;
+
+        AZStd::vector<SVF_P2F_C4B_T2F_F4B>  m_mergedVertices;
+        AZStd::vector<uint16>               m_mergedIndices;
+        bool                                m_isMerged = false;
     };
 
     // A mask render node handles using one set of render nodes to mask another set of render nodes
@@ -75,6 +75,7 @@ void UiLayoutManager::MarkToRecomputeLayoutsAffectedByLayoutCellChange(AZ::Entit
 void UiLayoutManager::UnmarkAllLayouts()
 {
     m_elementsToRecomputeLayout.clear();
+    m_markedElements.clear();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -120,43 +121,33 @@ void UiLayoutManager::ComputeLayoutForElementAndDescendants(AZ::EntityId entityI
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 void UiLayoutManager::AddToRecomputeLayoutList(AZ::EntityId entityId)
 {
-    // Check if element is already in the list
-    auto iter = AZStd::find(m_elementsToRecomputeLayout.begin(), m_elementsToRecomputeLayout.end(), entityId);
-    if (iter == m_elementsToRecomputeLayout.end())
+    // Check if element or one of its ancestors is already in the list. This only walks up the parent chain, so marking
+    // an element stays cheap however many descendants it has (e.g. the content of a large scrolling list)
+    if (m_markedElements.count(entityId) > 0 || HasMarkedAncestor(entityId))
     {
-        // Check if element's parent is already in the list
-        for (iter = m_elementsToRecomputeLayout.begin(); iter != m_elementsToRecomputeLayout.end(); ++iter)
-        {
-            if (IsParentOfElement(*iter, entityId))
-            {
-                // Don't need to add this element
-                return;
-            }
-        }
-
-        // Remove element's children from the list
-        LyShine::EntityArray descendants;
-        EBUS_EVENT_ID(entityId, UiElementBus, FindDescendantElements,
-            []([[maybe_unused]] const AZ::Entity* entity) { return true; },
-            descendants);
+        // Don't need to add this element
+        return;
+    }
 
+    // Remove element's descendants from the list, their layouts are recomputed along with the element's
+    if (!m_elementsToRecomputeLayout.empty())
+    {
         m_elementsToRecomputeLayout.remove_if(
-            [descendants](const AZ::EntityId& e)
+            [this, entityId](const AZ::EntityId& e)
             {
-                for (auto descendant : descendants)
+                if (IsParentOfElement(entityId, e))
                 {
-                    if (descendant->GetId() == e)
-                    {
-                        return true;
-                    }
+                    m_markedElements.erase(e);
+                    return true;
                 }
                 return false;
             }
             );
-
-        // Add element to list
-        m_elementsToRecomputeLayout.push_back(entityId);
     }
+
+    // Add element to list
+    m_elementsToRecomputeLayout.push_back(entityId);
+    m_markedElements.insert(entityId);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -179,3 +170,27 @@ bool UiLayoutManager::IsParentOfElement(AZ::EntityId checkParentEntity, AZ::Enti
     return false;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+bool UiLayoutManager::HasMarkedAncestor(AZ::EntityId entityId)
+{
+    if (m_markedElements.empty())
+    {
+        return false;
+    }
+
+    AZ::EntityId parent;
+    EBUS_EVENT_ID_RESULT(parent, entityId, UiElementBus, GetParentEntityId);
+    while (parent.IsValid())
+    {
+        if (m_markedElements.count(parent) > 0)
+        {
+            return true;
+        }
+
+        AZ::EntityId newParent = parent;
+        parent.SetInvalid();
+        EBUS_EVENT_ID_RESULT(parent, newParent, UiElementBus, GetParentEntityId);
+    }
+
+    return false;
+}
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <LyShine/Bus/UiLayoutManagerBus.h>
+#include <AzCore/std/containers/unordered_set.h>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 class UiLayoutManager
@@ -34,9 +35,13 @@ private: // member functions
 
     void AddToRecomputeLayoutList(AZ::EntityId entityId);
     bool IsParentOfElement(AZ::EntityId checkParentEntity, AZ::EntityId checkChildEntity);
+    bool HasMarkedAncestor(AZ::EntityId entityId);
 
 private: // data
 
     //! Elements that need to recompute their layouts. Parents should be ahead of their children
     AZStd::list<AZ::EntityId> m_elementsToRecomputeLayout;
+
+    //! The same elements as m_elementsToRecomputeLayout, for fast lookups while marking
+    AZStd::unordered_set<AZ::EntityId> m_markedElements;
 };
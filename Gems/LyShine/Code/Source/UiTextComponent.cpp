@@ -1055,6 +1055,34 @@ namespace
         return maxLinesElementCanHold;
     }
 
+    //! Returns true if the two font contexts write the same quads for the same text, font, position and color.
+    //!
+    //! The color override is not compared since each cached batch overrides it with its own color.
+    bool AreTextQuadsSettingsEqual(const STextDrawContext& lhs, const STextDrawContext& rhs)
+    {
+        return lhs.m_fxIdx == rhs.m_fxIdx
+            && lhs.m_size == rhs.m_size
+            && lhs.m_requestSize == rhs.m_requestSize
+            && lhs.m_widthScale == rhs.m_widthScale
+            && lhs.m_lineSpacing == rhs.m_lineSpacing
+            && lhs.m_clipX == rhs.m_clipX
+            && lhs.m_clipY == rhs.m_clipY
+            && lhs.m_clipWidth == rhs.m_clipWidth
+            && lhs.m_clipHeight == rhs.m_clipHeight
+            && lhs.m_drawTextFlags == rhs.m_drawTextFlags
+            && lhs.m_proportional == rhs.m_proportional
+            && lhs.m_sizeIn800x600 == rhs.m_sizeIn800x600
+            && lhs.m_clippingEnabled == rhs.m_clippingEnabled
+            && lhs.m_framed == rhs.m_framed
+            && Matrix34::IsEquivalent(lhs.m_transform, rhs.m_transform, 0.0f)
+            && lhs.m_baseState == rhs.m_baseState
+            && lhs.m_overrideViewProjMatrices == rhs.m_overrideViewProjMatrices
+            && lhs.m_kerningEnabled == rhs.m_kerningEnabled
+            && lhs.m_processSpecialChars == rhs.m_processSpecialChars
+            && lhs.m_pixelAligned == rhs.m_pixelAligned
+            && lhs.m_tracking == rhs.m_tracking;
+    }
+
 }   // anonymous namespace
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1649,6 +1677,7 @@ UiTextComponent::UiTextComponent()
 UiTextComponent::~UiTextComponent()
 {
     FreeRenderCacheMemory();
+    FreeRetiredRenderCacheBatches();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -3274,6 +3303,7 @@ void UiTextComponent::Deactivate()
 
     // reduce memory use when deactivated
     ClearRenderCache();
+    FreeRetiredRenderCacheBatches();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -4011,9 +4041,17 @@ void UiTextComponent::RenderToCache(float alpha)
             elemSize.GetY());
     }
 
+    // the retired text batches can only be reused if their quads were written with the same settings
+    if (!AreTextQuadsSettingsEqual(m_renderCache.m_fontContext, fontContext))
+    {
+        FreeRetiredRenderCacheBatches();
+    }
+
     m_renderCache.m_fontContext = fontContext;
     AZ::Vector2 pos = CalculateAlignedPositionWithYOffset(points);
     RenderDrawBatchLines(drawBatchLines, pos, points, transform, fontContext);
+
+    FreeRetiredRenderCacheBatches();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -4071,12 +4109,23 @@ void UiTextComponent::RenderDrawBatchLines(
 
                 fontContext.m_colorOverride = batchColor;
 
+                AZ::Vector2 batchPosition = alignedPosition;
+                batchPosition.SetY(batchPosition.GetY() + drawBatch.yOffset);
+
+                // If only part of the text changed (e.g. a number in its own markup batch), the batches that
+                // did not change keep the quads they already have
+                RenderCacheBatch* retiredBatch = ReuseRetiredRenderCacheBatch(batchPosition, drawBatch.text, drawBatch.font, batchColor);
+                if (retiredBatch)
+                {
+                    m_renderCache.m_batches.push_back(retiredBatch);
+                    continue;
+                }
+
                 uint32 numQuads = drawBatch.font->GetNumQuadsForText(drawBatch.text.c_str(), true, fontContext);
                 if (numQuads > 0)
                 {
                     RenderCacheBatch* cacheBatch = new RenderCacheBatch;
-                    cacheBatch->m_position = alignedPosition;
-                    cacheBatch->m_position.SetY(cacheBatch->m_position.GetY() + drawBatch.yOffset);
+                    cacheBatch->m_position = batchPosition;
                     cacheBatch->m_text = drawBatch.text;
                     cacheBatch->m_font = drawBatch.font;
                     cacheBatch->m_color = batchColor;
@@ -5195,6 +5244,9 @@ void UiTextComponent::ClearRenderCache()
 
     // As mentioned above it is ONLY valid to clear this and delete the image batches when the render graph
     // has been cleared. Otherwise the graph intrusive lists will have pointers to deleted structures.
+    // The text batches are retired rather than deleted, so that RenderToCache can reuse the ones that did not change.
+    FreeRetiredRenderCacheBatches();
+    m_renderCache.m_retiredBatches.swap(m_renderCache.m_batches);
     FreeRenderCacheMemory();
 
     m_renderCache.m_isDirty = true;
@@ -5219,6 +5271,37 @@ void UiTextComponent::FreeRenderCacheMemory()
     m_renderCache.m_imageBatches.clear();
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+void UiTextComponent::FreeRetiredRenderCacheBatches()
+{
+    for (RenderCacheBatch* textBatch : m_renderCache.m_retiredBatches)
+    {
+        delete [] textBatch->m_cachedPrimitive.m_vertices;
+        delete [] textBatch->m_cachedPrimitive.m_indices;
+        delete textBatch;
+    }
+
+    m_renderCache.m_retiredBatches.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+UiTextComponent::RenderCacheBatch* UiTextComponent::ReuseRetiredRenderCacheBatch(
+    const AZ::Vector2& position, const AZStd::string& text, IFFont* font, ColorB color)
+{
+    for (auto iter = m_renderCache.m_retiredBatches.begin(); iter != m_renderCache.m_retiredBatches.end(); ++iter)
+    {
+        RenderCacheBatch* textBatch = *iter;
+        if (textBatch->m_font == font && textBatch->m_color == color && textBatch->m_position == position && textBatch->m_text == text &&
+            textBatch->m_fontTextureVersion == font->GetFontTextureVersion())
+        {
+            m_renderCache.m_retiredBatches.erase(iter);
+            return textBatch;
+        }
+    }
+
+    return nullptr;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 bool UiTextComponent::ShouldClip()
 {
@@ -590,6 +590,13 @@ private: // member functions
     //! Clear the render cache memory allocations
     void FreeRenderCacheMemory();
 
+    //! Free the retired text batches that were not reused by the last RenderToCache
+    void FreeRetiredRenderCacheBatches();
+
+    //! Find a retired text batch with the same quads as the given settings, and take it out of the retired list.
+    //! Returns nullptr if there is none.
+    RenderCacheBatch* ReuseRetiredRenderCacheBatch(const AZ::Vector2& position, const AZStd::string& text, IFFont* font, ColorB color);
+
     //! Checks if clipping is enabled for handling overflow, or if specific conditions are met when using ellipsis.
     //!
     //! When ellipsis overflow handling is enabled, content will become clipped when the text
@@ -623,6 +630,10 @@ private: // types
         STextDrawContext                        m_fontContext;
         AZStd::vector<RenderCacheBatch*>        m_batches;
         AZStd::vector<RenderCacheImageBatch*>   m_imageBatches;
+
+        //! Text batches of the previous cache. When the cache is regenerated with the same font context, the batches
+        //! whose text, font, position and color did not change keep their quads instead of writing them again
+        AZStd::vector<RenderCacheBatch*>        m_retiredBatches;
     };
 
 private: // data
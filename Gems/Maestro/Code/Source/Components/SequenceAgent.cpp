@@ -131,14 +131,23 @@ namespace Maestro
         auto findIter = m_addressToBehaviorVirtualPropertiesMap.find(animatableAddress);
         if (findIter != m_addressToBehaviorVirtualPropertiesMap.end())
         {
-            if (findIter->second->m_getter->m_event)
-            {
-                retTypeUuid = findIter->second->m_getter->m_event->GetResult()->m_typeId;
-            }
-            else if(findIter->second->m_getter->m_broadcast)
-            {
-                retTypeUuid = findIter->second->m_getter->m_broadcast->GetResult()->m_typeId;
-            }
+            retTypeUuid = GetVirtualPropertyTypeId(findIter->second);
+        }
+        return retTypeUuid;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////
+    AZ::Uuid SequenceAgent::GetVirtualPropertyTypeId(const AZ::BehaviorEBus::VirtualProperty* virtualProperty)
+    {
+        AZ::Uuid retTypeUuid = AZ::Uuid::CreateNull();
+
+        if (virtualProperty->m_getter->m_event)
+        {
+            retTypeUuid = virtualProperty->m_getter->m_event->GetResult()->m_typeId;
+        }
+        else if (virtualProperty->m_getter->m_broadcast)
+        {
+            retTypeUuid = virtualProperty->m_getter->m_broadcast->GetResult()->m_typeId;
         }
         return retTypeUuid;
     }
@@ -147,11 +156,12 @@ namespace Maestro
     bool SequenceAgent::SetAnimatedPropertyValue(AZ::EntityId entityId, const Maestro::SequenceComponentRequests::AnimatablePropertyAddress& animatableAddress, const Maestro::SequenceComponentRequests::AnimatedValue& value)
     {
         bool changed = false;
-        const AZ::Uuid propertyTypeId = GetVirtualPropertyTypeId(animatableAddress);
-
         auto findIter = m_addressToBehaviorVirtualPropertiesMap.find(animatableAddress);
         if (findIter != m_addressToBehaviorVirtualPropertiesMap.end())
         {
+            // the address is looked up once, the type comes from the property it maps to
+            const AZ::Uuid propertyTypeId = GetVirtualPropertyTypeId(findIter->second);
+
             if (propertyTypeId == AZ::Vector3::TYPEINFO_Uuid())
             {
                 AZ::Vector3 vector3Value(.0f, .0f, .0f);
@@ -217,11 +227,12 @@ namespace Maestro
     ///////////////////////////////////////////////////////////////////////////////////////////////////////
     void SequenceAgent::GetAnimatedPropertyValue(Maestro::SequenceComponentRequests::AnimatedValue& returnValue, AZ::EntityId entityId, const Maestro::SequenceComponentRequests::AnimatablePropertyAddress& animatableAddress)
     {
-        const AZ::Uuid propertyTypeId = GetVirtualPropertyTypeId(animatableAddress);
-
         auto findIter = m_addressToBehaviorVirtualPropertiesMap.find(animatableAddress);
         if (findIter != m_addressToBehaviorVirtualPropertiesMap.end())
         {
+            // the address is looked up once, the type comes from the property it maps to
+            const AZ::Uuid propertyTypeId = GetVirtualPropertyTypeId(findIter->second);
+
             if (propertyTypeId == AZ::Vector3::TYPEINFO_Uuid())
             {
                 AZ::Vector3 vector3Value(AZ::Vector3::CreateZero());
@@ -32,6 +32,7 @@ namespace Maestro
         void CacheAllVirtualPropertiesFromBehaviorContext();
 
         AZ::Uuid GetVirtualPropertyTypeId(const Maestro::SequenceComponentRequests::AnimatablePropertyAddress& animatedAddress) const;
+        static AZ::Uuid GetVirtualPropertyTypeId(const AZ::BehaviorEBus::VirtualProperty* virtualProperty);
 
         void GetAnimatedPropertyValue(Maestro::SequenceComponentRequests::AnimatedValue& returnValue, AZ::EntityId entityId, const Maestro::SequenceComponentRequests::AnimatablePropertyAddress& animatableAddress);
         bool SetAnimatedPropertyValue(AZ::EntityId entityId, const Maestro::SequenceComponentRequests::AnimatablePropertyAddress& animatableAddress, const Maestro::SequenceComponentRequests::AnimatedValue& value);
@@ -369,10 +369,17 @@ namespace Metastream
     {
         AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
 
-        if (m_jsonDoc.HasMember(key.c_str()))
-            m_jsonDoc.RemoveMember(ToJson(key));
-
-        m_jsonDoc.AddMember(ToJson(key), value, m_allocator);
+        // Keys are usually updated every frame, so overwrite the value in place. Removing and re-adding the member scans the
+        // members twice and allocates a new copy of the key from the document's pool allocator, which never frees it.
+        rapidjson::Value::MemberIterator member = m_jsonDoc.FindMember(key.c_str());
+        if (member != m_jsonDoc.MemberEnd())
+        {
+            member->value = value;
+        }
+        else
+        {
+            m_jsonDoc.AddMember(ToJson(key), value, m_allocator);
+        }
     }
 
     void DataCache::Document::AddToArray(const std::string& arrayName, rapidjson::Value& value)
@@ -388,10 +395,15 @@ namespace Metastream
         AZStd::lock_guard<AZStd::mutex> lock(m_mutexJsonArray);
         rapidJsonValuePtr rapidValue(FindValue(objectName, ValueType::Object));
 
-        if (rapidValue->HasMember(key.c_str()))
-            rapidValue->RemoveMember(ToJson(key));
-
-        rapidValue->AddMember(ToJson(key), value, m_allocator);
+        rapidjson::Value::MemberIterator member = rapidValue->FindMember(key.c_str());
+        if (member != rapidValue->MemberEnd())
+        {
+            member->value = value;
+        }
+        else
+        {
+            rapidValue->AddMember(ToJson(key), value, m_allocator);
+        }
     }
 
     void DataCache::Document::AddArray(const std::string& key, const std::string& arrayName)
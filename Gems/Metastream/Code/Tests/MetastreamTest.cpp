@@ -18,6 +18,7 @@
 
 #include <Metastream_Traits_Platform.h>
 #include "MetastreamGem.h"
+#include "DataCache.h"
 
 using ::testing::NiceMock;
 using ::testing::Return;
@@ -149,3 +150,18 @@ TEST_F(MetastreamTest, ServerStartupShutdownTest_FT)
     EXPECT_EQ(server.GetDatabasesJSON(), "{\"tables\":[]}");
     EXPECT_FALSE(server.IsServerEnabled());
 }
+
+TEST_F(MetastreamTest, DataCache_UpdatingKey_ReplacesValue)
+{
+    Metastream::DataCache cache;
+
+    cache.AddToCache("testtable", "first", AZ::s64(1));
+    cache.AddToCache("testtable", "second", AZ::s64(2));
+    cache.AddToCache("testtable", "first", AZ::s64(3));
+    EXPECT_EQ(cache.GetTableKeyValuesJSON("testtable", { "*" }), "{\"first\":3,\"second\":2}");
+
+    cache.AddToObject("testtable", "obj", "value", true);
+    cache.AddToObject("testtable", "obj", "value", false);
+    cache.AddObjectToCache("testtable", "second", "obj");
+    EXPECT_EQ(cache.GetTableKeyValuesJSON("testtable", { "second" }), "{\"second\":{\"value\":false}}");
+}
@@ -76,6 +76,7 @@ namespace Multiplayer
 
         void OnMigrateStart(ClientInputId migratedInputId);
         void OnMigrateEnd();
+        void ApplyPendingCorrection();
         void UpdateAutonomous(AZ::TimeMs deltaTimeMs);
         void UpdateBankedTime(AZ::TimeMs deltaTimeMs);
 
@@ -88,6 +89,11 @@ namespace Multiplayer
         AZ::ScheduledEvent m_autonomousUpdateEvent; // Drives autonomous input collection
         AZ::ScheduledEvent m_updateBankedTimeEvent; // Drives authority bank time updates
 
+        // Newest correction received since the last autonomous update
+        AzNetworking::PacketEncodingBuffer m_pendingCorrection;
+        AzNetworking::ConnectionId m_pendingCorrectionConnectionId = AzNetworking::InvalidConnectionId;
+        bool m_hasPendingCorrection = false;
+
         CorrectionEvent m_correctionEvent;
         EntityMigrationStartEvent::Handler m_migrateStartHandler;
         EntityMigrationEndEvent::Handler m_migrateEndHandler;
@@ -28,6 +28,7 @@ namespace Multiplayer
     class NetworkInput;
     class ReplicationRecord;
     class MultiplayerComponent;
+    struct MultiplayerStats;
 
     using EntityStopEvent = AZ::Event<const ConstNetworkEntityHandle&>;
     using EntityDirtiedEvent = AZ::Event<>;
@@ -128,6 +129,9 @@ namespace Multiplayer
     private:
         void PreInit(AZ::Entity* entity, const PrefabEntityId& prefabEntityId, NetEntityId netEntityId, NetEntityRole netEntityRole);
 
+        //! SerializeStateDeltaMessage that records the time spent in each component, used while benchmarking.
+        bool SerializeStateDeltaMessageTimed(ReplicationRecord& replicationRecord, AzNetworking::ISerializer& serializer, MultiplayerStats& stats);
+
         void ConstructControllers();
         void DestructControllers();
         void ActivateControllers(EntityIsMigrating entityIsMigrating);
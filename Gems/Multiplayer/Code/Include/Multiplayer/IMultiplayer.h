@@ -140,8 +140,13 @@ namespace Multiplayer
         virtual IFilterEntityManager* GetFilterEntityManager() = 0;
 
         //! Retrieve the stats object bound to this multiplayer instance.
+        //! Threads that have redirected their stats with MultiplayerStats::SetThreadStats get their own stats instead.
         //! @return the stats object bound to this multiplayer instance
-        MultiplayerStats& GetStats() { return m_stats; }
+        MultiplayerStats& GetStats()
+        {
+            MultiplayerStats* threadStats = MultiplayerStats::GetThreadStats();
+            return (threadStats != nullptr) ? *threadStats : m_stats;
+        }
 
     private:
         MultiplayerStats m_stats;
@@ -11,6 +11,7 @@
 #include <AzCore/Time/ITime.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/array.h>
+#include <AzCore/std/time.h>
 #include <Multiplayer/MultiplayerTypes.h>
 
 namespace AzNetworking
@@ -46,16 +47,45 @@ namespace Multiplayer
             AZStd::vector<Metric> m_propertyUpdatesRecv;
             AZStd::vector<Metric> m_rpcsSent;
             AZStd::vector<Metric> m_rpcsRecv;
+
+            //! Time spent serializing and deserializing the component's network properties, only recorded while
+            //! m_recordSerializeTime is set.
+            AZStd::sys_time_t m_serializeTimeTicks = 0;
+            AZStd::sys_time_t m_deserializeTimeTicks = 0;
+            uint64_t m_serializeCalls = 0;
+            uint64_t m_deserializeCalls = 0;
         };
         AZStd::vector<ComponentStats> m_componentStats;
 
+        //! Enables timing of component network property serialization, which costs a clock read per component per entity update.
+        bool m_recordSerializeTime = false;
+
         void ReserveComponentStats(NetComponentId netComponentId, uint16_t propertyCount, uint16_t rpcCount);
         void RecordPropertySent(NetComponentId netComponentId, PropertyIndex propertyId, uint32_t totalBytes);
         void RecordPropertyReceived(NetComponentId netComponentId, PropertyIndex propertyId, uint32_t totalBytes);
         void RecordRpcSent(NetComponentId netComponentId, RpcIndex rpcId, uint32_t totalBytes);
         void RecordRpcReceived(NetComponentId netComponentId, RpcIndex rpcId, uint32_t totalBytes);
+        void RecordSerializeTime(NetComponentId netComponentId, AZStd::sys_time_t timeTicks);
+        void RecordDeserializeTime(NetComponentId netComponentId, AZStd::sys_time_t timeTicks);
+        void ResetSerializeTimes();
         void TickStats(AZ::TimeMs metricFrameTimeMs);
 
+        //! Redirects the stats recorded on the calling thread through IMultiplayer::GetStats into threadStats.
+        //! Used by jobs that serialize entity updates in parallel, nullptr goes back to the shared stats.
+        //! @param threadStats the stats to record into on the calling thread, or nullptr
+        static void SetThreadStats(MultiplayerStats* threadStats);
+
+        //! @return the stats the calling thread records into, or nullptr if it records into the shared stats
+        static MultiplayerStats* GetThreadStats();
+
+        //! Matches the component layout and current sample of the shared stats, so this can record on their behalf.
+        //! @param sharedStats the stats that will be merged into
+        void PrepareThreadStats(const MultiplayerStats& sharedStats);
+
+        //! Adds everything recorded since PrepareThreadStats into the shared stats and clears it from this instance.
+        //! @param sharedStats the stats to merge into
+        void MergeThreadStats(MultiplayerStats& sharedStats);
+
         Metric CalculateComponentPropertyUpdateSentMetrics(NetComponentId netComponentId) const;
         Metric CalculateComponentPropertyUpdateRecvMetrics(NetComponentId netComponentId) const;
         Metric CalculateComponentRpcsSentMetrics(NetComponentId netComponentId) const;
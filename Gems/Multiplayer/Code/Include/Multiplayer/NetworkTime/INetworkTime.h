@@ -11,6 +11,7 @@
 #include <AzCore/Time/ITime.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <Multiplayer/MultiplayerTypes.h>
+#include <Multiplayer/NetworkTime/TransformHistory.h>
 
 namespace Multiplayer
 {
@@ -67,6 +68,13 @@ namespace Multiplayer
         //! Restores all rewound entities to the current application time.
         virtual void ClearRewoundEntities() = 0;
 
+        //! Records the transforms of all networked entities at the current host frame into the transform history.
+        virtual void RecordTransformHistory() = 0;
+
+        //! Returns the recorded transforms of networked entities, used to rewind every entity to a frame at once.
+        //! @return the transform history
+        virtual const TransformHistory& GetTransformHistory() const = 0;
+
         AZ_DISABLE_COPY_MOVE(INetworkTime);
     };
 
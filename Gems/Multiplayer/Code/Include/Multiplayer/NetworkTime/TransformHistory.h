@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Multiplayer/MultiplayerTypes.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+
+namespace Multiplayer
+{
+    //! @class TransformHistory
+    //! @brief A history of networked entity transforms, one snapshot of every recorded entity per host frame.
+    //! Each snapshot is stored as a structure of arrays so rewinding a whole scene to a frame is a linear walk over a few
+    //! contiguous arrays, rather than a rewindable property lookup per entity. Snapshots reuse their storage, so recording
+    //! doesn't allocate once the history has warmed up.
+    class TransformHistory
+    {
+    public:
+
+        //! A snapshot of entity transforms for a single host frame.
+        //! Entries in each array share an index, entries are in the order they were recorded.
+        struct Frame
+        {
+            HostFrameId m_frameId = InvalidHostFrameId;
+            AZStd::vector<NetEntityId> m_netEntityIds;
+            AZStd::vector<AZ::Vector3> m_translations;
+            AZStd::vector<AZ::Quaternion> m_rotations;
+            AZStd::vector<float> m_scales;
+
+            //! Returns the number of entities recorded in this frame.
+            //! @return the number of entities recorded in this frame
+            AZStd::size_t GetEntityCount() const;
+
+            //! Returns the transform of the entity at the provided index.
+            //! @param index the index of the entity, must be less than GetEntityCount()
+            //! @return the transform of the entity at the provided index
+            AZ::Transform GetTransform(AZStd::size_t index) const;
+
+            //! Finds the transform of an entity in this frame.
+            //! @param netEntityId  the entity to look up
+            //! @param outTransform the transform of the entity if found
+            //! @return boolean true if the entity was recorded in this frame
+            bool FindTransform(NetEntityId netEntityId, AZ::Transform& outTransform) const;
+
+            //! Removes all entities from this frame, keeping the allocated storage.
+            void Clear();
+        };
+
+        using RewindCallback = AZStd::function<void(NetEntityId, const AZ::Transform&)>;
+
+        //! @param historySize the number of frames to keep, frames older than this are overwritten
+        explicit TransformHistory(uint32_t historySize = RewindHistorySize);
+
+        //! Starts recording a new frame, replacing the oldest frame in the history.
+        //! @param frameId             the host frame being recorded
+        //! @param expectedEntityCount the number of entities expected to be recorded, to reserve storage
+        void BeginFrame(HostFrameId frameId, AZStd::size_t expectedEntityCount);
+
+        //! Records the transform of an entity in the frame started by BeginFrame.
+        //! @param netEntityId the entity being recorded
+        //! @param transform   the world transform of the entity
+        void AddSample(NetEntityId netEntityId, const AZ::Transform& transform);
+
+        //! Finishes recording the frame started by BeginFrame.
+        void EndFrame();
+
+        //! Returns the snapshot for a host frame.
+        //! @param frameId the host frame to retrieve
+        //! @return the snapshot for the host frame, nullptr if the frame was never recorded or has been overwritten
+        const Frame* GetFrame(HostFrameId frameId) const;
+
+        //! Looks up the transform of a single entity at a host frame.
+        //! @param frameId      the host frame to rewind to
+        //! @param netEntityId  the entity to look up
+        //! @param outTransform the transform of the entity at that frame
+        //! @return boolean true if the entity was recorded at that frame
+        bool GetTransform(HostFrameId frameId, NetEntityId netEntityId, AZ::Transform& outTransform) const;
+
+        //! Rewinds every entity recorded at a host frame at once.
+        //! @param frameId  the host frame to rewind to
+        //! @param callback invoked with the transform of each entity recorded at that frame
+        //! @return boolean true if the frame is in the history
+        bool RewindAll(HostFrameId frameId, const RewindCallback& callback) const;
+
+        //! Returns the oldest host frame that can still be rewound to.
+        //! @return the oldest recorded host frame, InvalidHostFrameId if nothing has been recorded
+        HostFrameId GetOldestFrameId() const;
+
+        //! Discards all recorded frames.
+        void Clear();
+
+    private:
+
+        AZStd::vector<Frame> m_frames;
+        Frame* m_recordingFrame = nullptr;
+        HostFrameId m_newestFrameId = InvalidHostFrameId;
+    };
+}
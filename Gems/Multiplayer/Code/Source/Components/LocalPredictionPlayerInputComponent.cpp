@@ -351,8 +351,24 @@ namespace Multiplayer
 
         m_lastCorrectionInputId = inputId;
 
+        // Replaying is deferred to the next autonomous update, so a burst of corrections arriving together after packet loss
+        // only replays the input history once, starting from the newest correction
+        m_pendingCorrection = correction;
+        m_pendingCorrectionConnectionId = invokingConnection->GetConnectionId();
+        m_hasPendingCorrection = true;
+    }
+
+    void LocalPredictionPlayerInputComponentController::ApplyPendingCorrection()
+    {
+        if (!m_hasPendingCorrection)
+        {
+            return;
+        }
+        m_hasPendingCorrection = false;
+        const ClientInputId inputId = m_lastCorrectionInputId;
+
         // Apply the correction
-        AzNetworking::TrackChangedSerializer<AzNetworking::NetworkOutputSerializer> serializer(correction.GetBuffer(), correction.GetSize());
+        AzNetworking::TrackChangedSerializer<AzNetworking::NetworkOutputSerializer> serializer(m_pendingCorrection.GetBuffer(), m_pendingCorrection.GetSize());
         GetNetBindComponent()->SerializeEntityCorrection(serializer);
         m_correctionEvent.Signal();
 
@@ -391,7 +407,7 @@ namespace Multiplayer
         {
             // Reprocess the input for this frame
             NetworkInput& input = m_inputHistory[replayIndex];
-            ScopedAlterTime scopedTime(input.GetHostFrameId(), input.GetHostTimeMs(), invokingConnection->GetConnectionId());
+            ScopedAlterTime scopedTime(input.GetHostFrameId(), input.GetHostTimeMs(), m_pendingCorrectionConnectionId);
             GetNetBindComponent()->ProcessInput(input, clientInputRateSec);
 
             AZLOG
@@ -486,6 +502,11 @@ namespace Multiplayer
 
         const uint32_t maxClientInputs = inputRate > 0.0 ? static_cast<uint32_t>(maxRewindHistory / inputRate) : 0;
 
+        // Preallocate the whole rewind window, each new input is pushed before the oldest is discarded
+        m_inputHistory.Reserve(maxClientInputs + 1);
+
+        ApplyPendingCorrection();
+
         IMultiplayer* multiplayer = GetMultiplayer();
         INetworkTime* networkTime = GetNetworkTime();
         while (m_moveAccumulator >= inputRate)
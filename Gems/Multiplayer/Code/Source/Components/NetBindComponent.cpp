@@ -447,6 +447,12 @@ namespace Multiplayer
 
     bool NetBindComponent::SerializeStateDeltaMessage(ReplicationRecord& replicationRecord, AzNetworking::ISerializer& serializer)
     {
+        IMultiplayer* multiplayer = GetMultiplayer();
+        if ((multiplayer != nullptr) && multiplayer->GetStats().m_recordSerializeTime)
+        {
+            return SerializeStateDeltaMessageTimed(replicationRecord, serializer, multiplayer->GetStats());
+        }
+
         bool success = true;
         for (auto iter = m_multiplayerSerializationComponentVector.begin(); iter != m_multiplayerSerializationComponentVector.end(); ++iter)
         {
@@ -456,6 +462,28 @@ namespace Multiplayer
         return success;
     }
 
+    bool NetBindComponent::SerializeStateDeltaMessageTimed(ReplicationRecord& replicationRecord, AzNetworking::ISerializer& serializer, MultiplayerStats& stats)
+    {
+        const bool isDeserializing = (serializer.GetSerializerMode() == AzNetworking::SerializerMode::WriteToObject);
+        bool success = true;
+        for (auto iter = m_multiplayerSerializationComponentVector.begin(); iter != m_multiplayerSerializationComponentVector.end(); ++iter)
+        {
+            const AZStd::sys_time_t startTimeTicks = AZStd::GetTimeNowTicks();
+            success &= (*iter)->SerializeStateDeltaMessage(replicationRecord, serializer);
+            const AZStd::sys_time_t elapsedTimeTicks = AZStd::GetTimeNowTicks() - startTimeTicks;
+            if (isDeserializing)
+            {
+                stats.RecordDeserializeTime((*iter)->GetNetComponentId(), elapsedTimeTicks);
+            }
+            else
+            {
+                stats.RecordSerializeTime((*iter)->GetNetComponentId(), elapsedTimeTicks);
+            }
+        }
+
+        return success;
+    }
+
     void NetBindComponent::NotifyStateDeltaChanges(ReplicationRecord& replicationRecord)
     {
         for (auto iter = m_multiplayerSerializationComponentVector.begin(); iter != m_multiplayerSerializationComponentVector.end(); ++iter)
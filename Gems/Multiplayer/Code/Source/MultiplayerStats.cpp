@@ -69,6 +69,31 @@ namespace Multiplayer
         m_componentStats[netComponentIndex].m_rpcsRecv[rpcIndex].m_byteHistory[m_recordMetricIndex] += totalBytes;
     }
 
+    void MultiplayerStats::RecordSerializeTime(NetComponentId netComponentId, AZStd::sys_time_t timeTicks)
+    {
+        const uint16_t netComponentIndex = aznumeric_cast<uint16_t>(netComponentId);
+        m_componentStats[netComponentIndex].m_serializeTimeTicks += timeTicks;
+        m_componentStats[netComponentIndex].m_serializeCalls++;
+    }
+
+    void MultiplayerStats::RecordDeserializeTime(NetComponentId netComponentId, AZStd::sys_time_t timeTicks)
+    {
+        const uint16_t netComponentIndex = aznumeric_cast<uint16_t>(netComponentId);
+        m_componentStats[netComponentIndex].m_deserializeTimeTicks += timeTicks;
+        m_componentStats[netComponentIndex].m_deserializeCalls++;
+    }
+
+    void MultiplayerStats::ResetSerializeTimes()
+    {
+        for (ComponentStats& componentStats : m_componentStats)
+        {
+            componentStats.m_serializeTimeTicks = 0;
+            componentStats.m_deserializeTimeTicks = 0;
+            componentStats.m_serializeCalls = 0;
+            componentStats.m_deserializeCalls = 0;
+        }
+    }
+
     void MultiplayerStats::TickStats(AZ::TimeMs metricFrameTimeMs)
     {
         m_totalHistoryTimeMs = metricFrameTimeMs * static_cast<AZ::TimeMs>(RingbufferSamples);
@@ -98,6 +123,79 @@ namespace Multiplayer
         }
     }
 
+    static thread_local MultiplayerStats* s_threadStats = nullptr;
+
+    void MultiplayerStats::SetThreadStats(MultiplayerStats* threadStats)
+    {
+        s_threadStats = threadStats;
+    }
+
+    MultiplayerStats* MultiplayerStats::GetThreadStats()
+    {
+        return s_threadStats;
+    }
+
+    void MultiplayerStats::PrepareThreadStats(const MultiplayerStats& sharedStats)
+    {
+        m_recordMetricIndex = sharedStats.m_recordMetricIndex;
+        m_recordSerializeTime = sharedStats.m_recordSerializeTime;
+        m_componentStats.resize(sharedStats.m_componentStats.size());
+        for (AZStd::size_t index = 0; index < m_componentStats.size(); ++index)
+        {
+            const ComponentStats& sharedComponentStats = sharedStats.m_componentStats[index];
+            m_componentStats[index].m_propertyUpdatesSent.resize(sharedComponentStats.m_propertyUpdatesSent.size());
+            m_componentStats[index].m_propertyUpdatesRecv.resize(sharedComponentStats.m_propertyUpdatesRecv.size());
+            m_componentStats[index].m_rpcsSent.resize(sharedComponentStats.m_rpcsSent.size());
+            m_componentStats[index].m_rpcsRecv.resize(sharedComponentStats.m_rpcsRecv.size());
+        }
+    }
+
+    static void MergeAndClearMetrics(AZStd::vector<MultiplayerStats::Metric>& sharedMetrics, AZStd::vector<MultiplayerStats::Metric>& threadMetrics, uint64_t recordMetricIndex)
+    {
+        for (AZStd::size_t index = 0; index < threadMetrics.size(); ++index)
+        {
+            MultiplayerStats::Metric& threadMetric = threadMetrics[index];
+            if (threadMetric.m_totalCalls == 0)
+            {
+                continue;
+            }
+
+            // Thread stats only ever record into the current sample, so that's the only history entry to merge
+            MultiplayerStats::Metric& sharedMetric = sharedMetrics[index];
+            sharedMetric.m_totalCalls += threadMetric.m_totalCalls;
+            sharedMetric.m_totalBytes += threadMetric.m_totalBytes;
+            sharedMetric.m_callHistory[recordMetricIndex] += threadMetric.m_callHistory[recordMetricIndex];
+            sharedMetric.m_byteHistory[recordMetricIndex] += threadMetric.m_byteHistory[recordMetricIndex];
+            threadMetric.m_totalCalls = 0;
+            threadMetric.m_totalBytes = 0;
+            threadMetric.m_callHistory[recordMetricIndex] = 0;
+            threadMetric.m_byteHistory[recordMetricIndex] = 0;
+        }
+    }
+
+    void MultiplayerStats::MergeThreadStats(MultiplayerStats& sharedStats)
+    {
+        AZ_Assert(m_recordMetricIndex == sharedStats.m_recordMetricIndex, "Thread stats were prepared for a different sample");
+        const AZStd::size_t componentCount = AZStd::min(m_componentStats.size(), sharedStats.m_componentStats.size());
+        for (AZStd::size_t index = 0; index < componentCount; ++index)
+        {
+            ComponentStats& threadComponentStats = m_componentStats[index];
+            ComponentStats& sharedComponentStats = sharedStats.m_componentStats[index];
+            MergeAndClearMetrics(sharedComponentStats.m_propertyUpdatesSent, threadComponentStats.m_propertyUpdatesSent, m_recordMetricIndex);
+            MergeAndClearMetrics(sharedComponentStats.m_propertyUpdatesRecv, threadComponentStats.m_propertyUpdatesRecv, m_recordMetricIndex);
+            MergeAndClearMetrics(sharedComponentStats.m_rpcsSent, threadComponentStats.m_rpcsSent, m_recordMetricIndex);
+            MergeAndClearMetrics(sharedComponentStats.m_rpcsRecv, threadComponentStats.m_rpcsRecv, m_recordMetricIndex);
+            sharedComponentStats.m_serializeTimeTicks += threadComponentStats.m_serializeTimeTicks;
+            sharedComponentStats.m_deserializeTimeTicks += threadComponentStats.m_deserializeTimeTicks;
+            sharedComponentStats.m_serializeCalls += threadComponentStats.m_serializeCalls;
+            sharedComponentStats.m_deserializeCalls += threadComponentStats.m_deserializeCalls;
+            threadComponentStats.m_serializeTimeTicks = 0;
+            threadComponentStats.m_deserializeTimeTicks = 0;
+            threadComponentStats.m_serializeCalls = 0;
+            threadComponentStats.m_deserializeCalls = 0;
+        }
+    }
+
     static void CombineMetrics(MultiplayerStats::Metric& outArg1, const MultiplayerStats::Metric& arg2)
     {
         outArg1.m_totalCalls += arg2.m_totalCalls;
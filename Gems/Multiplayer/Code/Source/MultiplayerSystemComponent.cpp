@@ -23,6 +23,7 @@
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
 #include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Memory/AllocatorManager.h>
 #include <AzCore/Asset/AssetCommon.h>
 #include <AzCore/Asset/AssetManagerBus.h>
 #include <AzCore/Utils/Utils.h>
@@ -82,6 +83,8 @@ namespace Multiplayer
     AZ_CVAR(AZ::TimeMs, cl_defaultNetworkEntityActivationTimeSliceMs, AZ::TimeMs{ 0 }, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
         "Max Ms to use to activate entities coming from the network, 0 means instantiate everything");
     AZ_CVAR(AZ::TimeMs, sv_serverSendRateMs, AZ::TimeMs{ 50 }, nullptr, AZ::ConsoleFunctorFlags::Null, "Minimum number of milliseconds between each network update");
+    AZ_CVAR(bool, sv_recordTransformHistory, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "If true, the server records the transforms of all networked entities every network update, for lag compensated queries");
     AZ_CVAR(AZ::CVarFixedString, sv_defaultPlayerSpawnAsset, "prefabs/player.network.spawnable", nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
         "The default spawnable to use when a new player connects");
     AZ_CVAR(float, cl_renderTickBlendBase, 0.15f, nullptr, AZ::ConsoleFunctorFlags::Null,
@@ -328,6 +331,11 @@ namespace Multiplayer
             m_networkTime.IncrementHostFrameId();
         }
 
+        if (m_benchmark.m_isRunning)
+        {
+            ++m_benchmark.m_tickCount;
+        }
+
         // Handle deferred local rpc messages that were generated during the updates
         m_networkEntityManager.DispatchLocalDeferredRpcMessages();
 
@@ -339,6 +347,13 @@ namespace Multiplayer
         m_networkEntityManager.NotifyEntitiesChanged();
         m_networkEntityManager.NotifyEntitiesDirtied();
 
+        if (sv_recordTransformHistory
+         && (GetAgentType() == MultiplayerAgentType::ClientServer || GetAgentType() == MultiplayerAgentType::DedicatedServer))
+        {
+            // Snapshot the final state of this frame so later lag compensated queries can rewind every entity to it at once
+            m_networkTime.RecordTransformHistory();
+        }
+
         MultiplayerStats& stats = GetStats();
         stats.TickStats(deltaTimeMs);
         stats.m_entityCount = GetNetworkEntityManager()->GetEntityCount();
@@ -852,6 +867,80 @@ namespace Multiplayer
         AZLOG_INFO("Total RPCs received bytes: %llu", aznumeric_cast<AZ::u64>(rpcsRecv.m_totalBytes));
     }
 
+    static size_t GetAllocatedBytes()
+    {
+        size_t allocatedBytes = 0;
+        size_t capacityBytes = 0;
+        AZ::AllocatorManager::Instance().GetAllocatorStats(allocatedBytes, capacityBytes);
+        return allocatedBytes;
+    }
+
+    void MultiplayerSystemComponent::StartBenchmark([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        MultiplayerStats& stats = GetStats();
+        stats.ResetSerializeTimes();
+        stats.m_recordSerializeTime = true;
+
+        m_benchmark.m_isRunning = true;
+        m_benchmark.m_startTimeMs = AZ::GetElapsedTimeMs();
+        m_benchmark.m_tickCount = 0;
+        m_benchmark.m_startAllocatedBytes = GetAllocatedBytes();
+        AZLOG_INFO("Multiplayer benchmark started");
+    }
+
+    void MultiplayerSystemComponent::ReportBenchmark([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (!m_benchmark.m_isRunning)
+        {
+            AZLOG_WARN("No multiplayer benchmark is running, use StartBenchmark first");
+            return;
+        }
+
+        MultiplayerStats& stats = GetStats();
+        stats.m_recordSerializeTime = false;
+        m_benchmark.m_isRunning = false;
+
+        const AZ::TimeMs durationMs = AZ::GetElapsedTimeMs() - m_benchmark.m_startTimeMs;
+        const double durationSeconds = AZStd::max(static_cast<double>(durationMs) / 1000.0, 0.001);
+        const uint64_t tickCount = AZStd::max<uint64_t>(m_benchmark.m_tickCount, 1);
+        const int64_t allocatedBytesDelta = static_cast<int64_t>(GetAllocatedBytes()) - static_cast<int64_t>(m_benchmark.m_startAllocatedBytes);
+
+        AZLOG_INFO("Benchmark duration in milliseconds: %lld", aznumeric_cast<AZ::s64>(durationMs));
+        AZLOG_INFO("Benchmark ticks: %llu (%.2f ticks/sec)", aznumeric_cast<AZ::u64>(m_benchmark.m_tickCount), static_cast<double>(m_benchmark.m_tickCount) / durationSeconds);
+        AZLOG_INFO("Benchmark networked entities: %llu", aznumeric_cast<AZ::u64>(stats.m_entityCount));
+        AZLOG_INFO("Benchmark allocated bytes change per tick: %.2f", static_cast<double>(allocatedBytesDelta) / static_cast<double>(tickCount));
+
+        if (m_networkInterface != nullptr)
+        {
+            m_networkInterface->GetConnectionSet().VisitConnections([](IConnection& connection)
+            {
+                const ConnectionMetrics& metrics = connection.GetMetrics();
+                AZLOG_INFO(" - Connection %u (%s): sent %.2f bytes/sec, received %.2f bytes/sec",
+                    aznumeric_cast<uint32_t>(connection.GetConnectionId()), connection.GetRemoteAddress().GetString().c_str(),
+                    metrics.m_sendDatarate.GetBytesPerSecond(), metrics.m_recvDatarate.GetBytesPerSecond());
+            });
+        }
+
+        const MultiplayerComponentRegistry* componentRegistry = GetMultiplayerComponentRegistry();
+        const double ticksPerMicrosecond = static_cast<double>(AZStd::GetTimeTicksPerSecond()) / 1000000.0;
+        for (AZStd::size_t index = 0; index < stats.m_componentStats.size(); ++index)
+        {
+            const MultiplayerStats::ComponentStats& componentStats = stats.m_componentStats[index];
+            if ((componentStats.m_serializeCalls == 0) && (componentStats.m_deserializeCalls == 0))
+            {
+                continue;
+            }
+
+            const NetComponentId netComponentId = aznumeric_cast<NetComponentId>(index);
+            const char* componentName = (componentRegistry != nullptr) ? componentRegistry->GetComponentName(netComponentId) : "Unknown";
+            const double serializeTimeUs = static_cast<double>(componentStats.m_serializeTimeTicks) / ticksPerMicrosecond;
+            const double deserializeTimeUs = static_cast<double>(componentStats.m_deserializeTimeTicks) / ticksPerMicrosecond;
+            AZLOG_INFO(" - %s: serialized %llu times in %.2f us (%.3f us avg), deserialized %llu times in %.2f us (%.3f us avg)", componentName,
+                aznumeric_cast<AZ::u64>(componentStats.m_serializeCalls), serializeTimeUs, serializeTimeUs / static_cast<double>(AZStd::max<uint64_t>(componentStats.m_serializeCalls, 1)),
+                aznumeric_cast<AZ::u64>(componentStats.m_deserializeCalls), deserializeTimeUs, deserializeTimeUs / static_cast<double>(AZStd::max<uint64_t>(componentStats.m_deserializeCalls, 1)));
+        }
+    }
+
     void MultiplayerSystemComponent::TickVisibleNetworkEntities(float deltaTime, float serverRateSeconds)
     {
         m_tickFactor += deltaTime / serverRateSeconds;
@@ -122,6 +122,8 @@ namespace Multiplayer
         //! Console commands.
         //! @{
         void DumpStats(const AZ::ConsoleCommandContainer& arguments);
+        void StartBenchmark(const AZ::ConsoleCommandContainer& arguments);
+        void ReportBenchmark(const AZ::ConsoleCommandContainer& arguments);
         //! @}
 
     private:
@@ -132,6 +134,8 @@ namespace Multiplayer
         NetworkEntityHandle SpawnDefaultPlayerPrefab();
         
         AZ_CONSOLEFUNC(MultiplayerSystemComponent, DumpStats, AZ::ConsoleFunctorFlags::Null, "Dumps stats for the current multiplayer session");
+        AZ_CONSOLEFUNC(MultiplayerSystemComponent, StartBenchmark, AZ::ConsoleFunctorFlags::DontReplicate, "Starts measuring multiplayer throughput, pair with ReplayUdpCapture for a reproducible load");
+        AZ_CONSOLEFUNC(MultiplayerSystemComponent, ReportBenchmark, AZ::ConsoleFunctorFlags::DontReplicate, "Reports multiplayer throughput since StartBenchmark and stops measuring");
 
         AzNetworking::INetworkInterface* m_networkInterface = nullptr;
         AzNetworking::INetworkInterface* m_networkEditorInterface = nullptr;
@@ -155,6 +159,16 @@ namespace Multiplayer
         HostFrameId m_lastReplicatedHostFrameId = HostFrameId(0);
 
         double m_serverSendAccumulator = 0.0;
+
+        //! Throughput measured between StartBenchmark and ReportBenchmark.
+        struct BenchmarkState
+        {
+            bool m_isRunning = false;
+            AZ::TimeMs m_startTimeMs = AZ::TimeMs{ 0 };
+            uint64_t m_tickCount = 0;
+            size_t m_startAllocatedBytes = 0;
+        };
+        BenchmarkState m_benchmark;
         float m_tickFactor = 0.0f;
 
 #if !defined(AZ_RELEASE_BUILD)
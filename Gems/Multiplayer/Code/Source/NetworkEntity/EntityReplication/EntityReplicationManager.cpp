@@ -27,6 +27,11 @@
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/ILogger.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Jobs/JobManagerBus.h>
 #include <AzCore/Math/Transform.h>
 
 namespace Multiplayer
@@ -37,6 +42,10 @@ namespace Multiplayer
     constexpr uint32_t ReplicationManagerPacketOverhead = 16;
 
     AZ_CVAR(bool, bg_replicationWindowImmediateAddRemove, true, nullptr, AZ::ConsoleFunctorFlags::Null, "Update replication windows immediately on visibility Add/Removes.");
+    AZ_CVAR(uint32_t, sv_ParallelEntityUpdateMinEntities, 128, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "The number of entity updates a connection needs to send in a tick before they are serialized on the job system, 0 to always serialize serially.");
+    AZ_CVAR(uint32_t, sv_ParallelEntityUpdateBatchSize, 32, nullptr, AZ::ConsoleFunctorFlags::DontReplicate,
+        "The number of entity updates serialized by each job when entity updates are serialized in parallel.");
 
     EntityReplicationManager::EntityReplicationManager(AzNetworking::IConnection& connection, AzNetworking::IConnectionListener& connectionListener, Mode updateMode)
         : m_updateMode(updateMode)
@@ -119,7 +128,8 @@ namespace Multiplayer
     void EntityReplicationManager::SendEntityUpdatesPacketHelper
     (
         AZ::TimeMs hostTimeMs,
-        EntityReplicatorList& toSendList,
+        const EntityReplicatorList& toSendList,
+        AZStd::size_t& nextMessageIndex,
         uint32_t maxPayloadSize,
         AzNetworking::IConnection& connection
     )
@@ -130,10 +140,10 @@ namespace Multiplayer
         entityUpdatePacket.SetHostTimeMs(hostTimeMs);
         entityUpdatePacket.SetHostFrameId(GetNetworkTime()->GetHostFrameId());
         // Serialize everything
-        while (!toSendList.empty())
+        while (nextMessageIndex < toSendList.size())
         {
-            EntityReplicator* replicator = toSendList.front();
-            NetworkEntityUpdateMessage updateMessage(replicator->GenerateUpdatePacket());
+            EntityReplicator* replicator = toSendList[nextMessageIndex];
+            NetworkEntityUpdateMessage& updateMessage = m_pendingUpdateMessages[nextMessageIndex];
 
             const uint32_t nextMessageSize = updateMessage.GetEstimatedSerializeSize();
 
@@ -147,9 +157,9 @@ namespace Multiplayer
             }
 
             pendingPacketSize += nextMessageSize;
-            entityUpdatePacket.ModifyEntityMessages().push_back(updateMessage);
+            entityUpdatePacket.ModifyEntityMessages().emplace_back(AZStd::move(updateMessage));
             replicatorUpdatedList.push_back(replicator);
-            toSendList.pop_front();
+            ++nextMessageIndex;
 
             if (largeEntityDetected)
             {
@@ -258,11 +268,79 @@ namespace Multiplayer
             replicator->GetPropertyPublisher()->PrepareSerialization();
         }
     
-        // While our to send list is not empty, build up another packet to send
+        GenerateEntityUpdateMessages(toSendList);
+
+        // While we have messages left to send, build up another packet to send
+        AZStd::size_t nextMessageIndex = 0;
         do
         {
-            SendEntityUpdatesPacketHelper(hostTimeMs, toSendList, m_maxPayloadSize, m_connection);
-        } while (!toSendList.empty());
+            SendEntityUpdatesPacketHelper(hostTimeMs, toSendList, nextMessageIndex, m_maxPayloadSize, m_connection);
+        } while (nextMessageIndex < toSendList.size());
+
+        m_pendingUpdateMessages.clear();
+    }
+
+    void EntityReplicationManager::GenerateEntityUpdateMessages(const EntityReplicatorList& toSendList)
+    {
+        const AZStd::size_t messageCount = toSendList.size();
+        m_pendingUpdateMessages.resize(messageCount);
+
+        AZ::JobContext* jobContext = nullptr;
+        if ((sv_ParallelEntityUpdateMinEntities > 0) && (messageCount >= sv_ParallelEntityUpdateMinEntities))
+        {
+            AZ::JobManagerBus::BroadcastResult(jobContext, &AZ::JobManagerEvents::GetGlobalContext);
+        }
+
+        const AZStd::size_t batchSize = AZStd::max<AZStd::size_t>(sv_ParallelEntityUpdateBatchSize, 1);
+        if ((jobContext == nullptr) || (messageCount <= batchSize))
+        {
+            for (AZStd::size_t index = 0; index < messageCount; ++index)
+            {
+                m_pendingUpdateMessages[index] = toSendList[index]->GenerateUpdatePacket();
+            }
+            return;
+        }
+
+        // Replicators only touch their own publisher and entity while serializing, the only shared state is the network
+        // property stats, so every job records into its own stats which are merged back once all the jobs are done
+        MultiplayerStats& stats = GetMultiplayer()->GetStats();
+        const AZStd::size_t batchCount = (messageCount + batchSize - 1) / batchSize;
+        m_serializationJobStats.resize(batchCount);
+        for (AZStd::size_t batchIndex = 1; batchIndex < batchCount; ++batchIndex)
+        {
+            m_serializationJobStats[batchIndex].PrepareThreadStats(stats);
+        }
+
+        auto generateBatch = [this, &toSendList, batchSize, messageCount](AZStd::size_t batchIndex)
+        {
+            const AZStd::size_t endIndex = AZStd::min(messageCount, (batchIndex + 1) * batchSize);
+            for (AZStd::size_t index = batchIndex * batchSize; index < endIndex; ++index)
+            {
+                m_pendingUpdateMessages[index] = toSendList[index]->GenerateUpdatePacket();
+            }
+        };
+
+        AZ::JobCompletion completion(jobContext);
+        for (AZStd::size_t batchIndex = 1; batchIndex < batchCount; ++batchIndex)
+        {
+            AZ::Job* job = AZ::CreateJobFunction([this, &generateBatch, batchIndex]()
+            {
+                MultiplayerStats::SetThreadStats(&m_serializationJobStats[batchIndex]);
+                generateBatch(batchIndex);
+                MultiplayerStats::SetThreadStats(nullptr);
+            }, true, jobContext);
+            job->SetDependent(&completion);
+            job->Start();
+        }
+
+        // The first batch is serialized on this thread and records straight into the shared stats
+        generateBatch(0);
+        completion.StartAndWaitForCompletion();
+
+        for (AZStd::size_t batchIndex = 1; batchIndex < batchCount; ++batchIndex)
+        {
+            m_serializationJobStats[batchIndex].MergeThreadStats(stats);
+        }
     }
 
     void EntityReplicationManager::SendEntityRpcs(RpcMessages& deferredRpcs, bool reliable)
@@ -11,6 +11,7 @@
 #include <Source/NetworkEntity/EntityReplication/EntityReplicator.h>
 #include <Multiplayer/Components/NetBindComponent.h>
 #include <Multiplayer/EntityDomains/IEntityDomain.h>
+#include <Multiplayer/MultiplayerStats.h>
 #include <Multiplayer/NetworkEntity/INetworkEntityManager.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityUpdateMessage.h>
@@ -117,7 +118,11 @@ namespace Multiplayer
         using EntityReplicatorList = AZStd::deque<EntityReplicator*>;
         EntityReplicatorList GenerateEntityUpdateList();
 
-        void SendEntityUpdatesPacketHelper(AZ::TimeMs hostTimeMs, EntityReplicatorList& toSendList, uint32_t maxPayloadSize, AzNetworking::IConnection& connection);
+        //! Generates the update message of every replicator in the send list into m_pendingUpdateMessages.
+        //! Large send lists are split into batches that are serialized on the job system.
+        void GenerateEntityUpdateMessages(const EntityReplicatorList& toSendList);
+
+        void SendEntityUpdatesPacketHelper(AZ::TimeMs hostTimeMs, const EntityReplicatorList& toSendList, AZStd::size_t& nextMessageIndex, uint32_t maxPayloadSize, AzNetworking::IConnection& connection);
 
         void SendEntityUpdates(AZ::TimeMs hostTimeMs);
         void SendEntityRpcs(RpcMessages& deferredRpcs, bool reliable);
@@ -188,6 +193,10 @@ namespace Multiplayer
         RpcMessages m_deferredRpcMessagesReliable;
         RpcMessages m_deferredRpcMessagesUnreliable;
 
+        // Scratch storage for entity update serialization, kept between sends to avoid reallocating every tick
+        AZStd::vector<NetworkEntityUpdateMessage> m_pendingUpdateMessages;
+        AZStd::vector<MultiplayerStats> m_serializationJobStats;
+
         AZ::Event<NetEntityId> m_autonomousEntityReplicatorCreated;
         EntityExitDomainEvent::Handler m_entityExitDomainEventHandler;
 
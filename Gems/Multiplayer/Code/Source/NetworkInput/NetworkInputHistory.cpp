@@ -10,33 +10,76 @@
 
 namespace Multiplayer
 {
+    static constexpr AZStd::size_t MinHistoryCapacity = 16;
+
     AZStd::size_t NetworkInputHistory::Size() const
+    {
+        return m_size;
+    }
+
+    AZStd::size_t NetworkInputHistory::Capacity() const
     {
         return m_history.size();
     }
 
+    void NetworkInputHistory::Reserve(AZStd::size_t capacity)
+    {
+        if (capacity <= m_history.size())
+        {
+            return;
+        }
+
+        // Unroll the ring so the oldest input is in the first slot, then append the new empty slots after the newest input
+        AZStd::vector<Wrapper> history;
+        history.reserve(capacity);
+        for (AZStd::size_t i = 0; i < m_size; ++i)
+        {
+            history.emplace_back(m_history[GetSlotIndex(i)].m_networkInput);
+        }
+        history.resize(capacity);
+        m_history.swap(history);
+        m_head = 0;
+    }
+
     const NetworkInput& NetworkInputHistory::operator[](AZStd::size_t index) const
     {
-        return m_history[index].m_networkInput;
+        AZ_Assert(index < m_size, "Index is out of range of the input history");
+        return m_history[GetSlotIndex(index)].m_networkInput;
     }
 
     NetworkInput& NetworkInputHistory::operator[](AZStd::size_t index)
     {
-        return m_history[index].m_networkInput;
+        AZ_Assert(index < m_size, "Index is out of range of the input history");
+        return m_history[GetSlotIndex(index)].m_networkInput;
     }
 
     void NetworkInputHistory::PushBack(NetworkInput& networkInput)
     {
-        m_history.push_back(Wrapper(networkInput));
+        if (m_size == m_history.size())
+        {
+            Reserve(AZStd::max(m_history.size() * 2, MinHistoryCapacity));
+        }
+
+        // Copy assignment reuses the component inputs already allocated in the slot
+        m_history[GetSlotIndex(m_size)].m_networkInput = networkInput;
+        ++m_size;
     }
 
     void NetworkInputHistory::PopFront()
     {
-        m_history.pop_front();
+        AZ_Assert(m_size > 0, "Cannot pop from an empty input history");
+        m_head = GetSlotIndex(1);
+        --m_size;
     }
 
     const NetworkInput& NetworkInputHistory::Front() const
     {
-        return m_history.front().m_networkInput;
+        AZ_Assert(m_size > 0, "Cannot access the front of an empty input history");
+        return m_history[m_head].m_networkInput;
+    }
+
+    AZStd::size_t NetworkInputHistory::GetSlotIndex(AZStd::size_t index) const
+    {
+        return (m_head + index) % m_history.size();
     }
 }
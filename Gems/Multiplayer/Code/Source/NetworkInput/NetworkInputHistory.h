@@ -9,17 +9,27 @@
 #pragma once
 
 #include <Multiplayer/NetworkInput/NetworkInput.h>
-#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
 
 namespace Multiplayer
 {
     //! @class NetworkInputHistory
     //! @brief A list of input commands, used for bookkeeping on the client.
+    //! Inputs are stored in a ring of preallocated slots. Popped slots keep their component inputs, so once the ring has
+    //! warmed up pushing an input copies into existing storage instead of allocating.
     class NetworkInputHistory final
     {
     public:
         AZStd::size_t Size() const;
 
+        //! Returns the number of inputs the history can hold before it has to grow.
+        //! @return the number of preallocated input slots
+        AZStd::size_t Capacity() const;
+
+        //! Preallocates slots for the requested number of inputs.
+        //! @param capacity the number of inputs to preallocate slots for
+        void Reserve(AZStd::size_t capacity);
+
         const NetworkInput& operator[](AZStd::size_t index) const;
         NetworkInput& operator[](AZStd::size_t index);
 
@@ -36,6 +46,10 @@ namespace Multiplayer
             NetworkInput m_networkInput;
         };
 
-        AZStd::deque<Wrapper> m_history;
+        AZStd::size_t GetSlotIndex(AZStd::size_t index) const;
+
+        AZStd::vector<Wrapper> m_history;
+        AZStd::size_t m_head = 0;
+        AZStd::size_t m_size = 0;
     };
 }
@@ -10,6 +10,7 @@
 #include <Multiplayer/IMultiplayer.h>
 #include <Multiplayer/Components/NetBindComponent.h>
 #include <Multiplayer/Components/NetworkTransformComponent.h>
+#include <Source/NetworkEntity/NetworkEntityTracker.h>
 #include <AzCore/Math/ShapeIntersection.h>
 #include <AzFramework/Visibility/IVisibilitySystem.h>
 #include <AzFramework/Visibility/EntityBoundsUnionBus.h>
@@ -131,4 +132,31 @@ namespace Multiplayer
         }
         m_rewoundEntities.clear();
     }
+
+    void NetworkTime::RecordTransformHistory()
+    {
+        AZ_Assert(!IsTimeRewound(), "Cannot record transform history while within scoped rewind");
+
+        NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();
+        if (networkEntityTracker == nullptr)
+        {
+            return;
+        }
+
+        m_transformHistory.BeginFrame(m_unalteredFrameId, networkEntityTracker->size());
+        for (const auto& iter : *networkEntityTracker)
+        {
+            const AZ::Entity* entity = iter.second;
+            if ((entity != nullptr) && (entity->GetState() == AZ::Entity::State::Active) && (entity->FindComponent<NetworkTransformComponent>() != nullptr))
+            {
+                m_transformHistory.AddSample(iter.first, entity->GetTransform()->GetWorldTM());
+            }
+        }
+        m_transformHistory.EndFrame();
+    }
+
+    const TransformHistory& NetworkTime::GetTransformHistory() const
+    {
+        return m_transformHistory;
+    }
 }
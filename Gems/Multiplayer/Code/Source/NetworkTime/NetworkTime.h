@@ -35,11 +35,14 @@ namespace Multiplayer
         void AlterTime(HostFrameId frameId, AZ::TimeMs timeMs, AzNetworking::ConnectionId rewindConnectionId) override;
         void SyncEntitiesToRewindState(const AZ::Aabb& rewindVolume) override;
         void ClearRewoundEntities() override;
+        void RecordTransformHistory() override;
+        const TransformHistory& GetTransformHistory() const override;
         //! @}
 
     private:
 
         AZStd::vector<NetworkEntityHandle> m_rewoundEntities;
+        TransformHistory m_transformHistory;
 
         HostFrameId m_hostFrameId = HostFrameId{ 0 };
         HostFrameId m_unalteredFrameId = HostFrameId{ 0 };
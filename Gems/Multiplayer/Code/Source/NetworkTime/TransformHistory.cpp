@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/NetworkTime/TransformHistory.h>
+
+namespace Multiplayer
+{
+    AZStd::size_t TransformHistory::Frame::GetEntityCount() const
+    {
+        return m_netEntityIds.size();
+    }
+
+    AZ::Transform TransformHistory::Frame::GetTransform(AZStd::size_t index) const
+    {
+        return AZ::Transform(m_translations[index], m_rotations[index], m_scales[index]);
+    }
+
+    bool TransformHistory::Frame::FindTransform(NetEntityId netEntityId, AZ::Transform& outTransform) const
+    {
+        // The id array is scanned on its own, so even large frames only touch a few cache lines per entity
+        const auto iter = AZStd::find(m_netEntityIds.begin(), m_netEntityIds.end(), netEntityId);
+        if (iter == m_netEntityIds.end())
+        {
+            return false;
+        }
+
+        outTransform = GetTransform(AZStd::distance(m_netEntityIds.begin(), iter));
+        return true;
+    }
+
+    void TransformHistory::Frame::Clear()
+    {
+        m_frameId = InvalidHostFrameId;
+        m_netEntityIds.clear();
+        m_translations.clear();
+        m_rotations.clear();
+        m_scales.clear();
+    }
+
+    TransformHistory::TransformHistory(uint32_t historySize)
+        : m_frames(AZStd::max<uint32_t>(historySize, 1))
+    {
+        ;
+    }
+
+    void TransformHistory::BeginFrame(HostFrameId frameId, AZStd::size_t expectedEntityCount)
+    {
+        AZ_Assert(m_recordingFrame == nullptr, "BeginFrame called while already recording a frame");
+        AZ_Assert(frameId != InvalidHostFrameId, "Cannot record the invalid host frame");
+
+        m_recordingFrame = &m_frames[static_cast<uint32_t>(frameId) % m_frames.size()];
+        m_recordingFrame->Clear();
+        m_recordingFrame->m_netEntityIds.reserve(expectedEntityCount);
+        m_recordingFrame->m_translations.reserve(expectedEntityCount);
+        m_recordingFrame->m_rotations.reserve(expectedEntityCount);
+        m_recordingFrame->m_scales.reserve(expectedEntityCount);
+        m_recordingFrame->m_frameId = frameId;
+    }
+
+    void TransformHistory::AddSample(NetEntityId netEntityId, const AZ::Transform& transform)
+    {
+        AZ_Assert(m_recordingFrame != nullptr, "AddSample called without a frame being recorded");
+        m_recordingFrame->m_netEntityIds.push_back(netEntityId);
+        m_recordingFrame->m_translations.push_back(transform.GetTranslation());
+        m_recordingFrame->m_rotations.push_back(transform.GetRotation());
+        m_recordingFrame->m_scales.push_back(transform.GetUniformScale());
+    }
+
+    void TransformHistory::EndFrame()
+    {
+        AZ_Assert(m_recordingFrame != nullptr, "EndFrame called without a frame being recorded");
+        m_newestFrameId = m_recordingFrame->m_frameId;
+        m_recordingFrame = nullptr;
+    }
+
+    const TransformHistory::Frame* TransformHistory::GetFrame(HostFrameId frameId) const
+    {
+        if (frameId == InvalidHostFrameId)
+        {
+            return nullptr;
+        }
+
+        const Frame& frame = m_frames[static_cast<uint32_t>(frameId) % m_frames.size()];
+        if ((frame.m_frameId != frameId) || (&frame == m_recordingFrame))
+        {
+            return nullptr;
+        }
+        return &frame;
+    }
+
+    bool TransformHistory::GetTransform(HostFrameId frameId, NetEntityId netEntityId, AZ::Transform& outTransform) const
+    {
+        const Frame* frame = GetFrame(frameId);
+        return (frame != nullptr) && frame->FindTransform(netEntityId, outTransform);
+    }
+
+    bool TransformHistory::RewindAll(HostFrameId frameId, const RewindCallback& callback) const
+    {
+        const Frame* frame = GetFrame(frameId);
+        if (frame == nullptr)
+        {
+            return false;
+        }
+
+        const AZStd::size_t entityCount = frame->GetEntityCount();
+        for (AZStd::size_t index = 0; index < entityCount; ++index)
+        {
+            callback(frame->m_netEntityIds[index], frame->GetTransform(index));
+        }
+        return true;
+    }
+
+    HostFrameId TransformHistory::GetOldestFrameId() const
+    {
+        HostFrameId oldestFrameId = InvalidHostFrameId;
+        for (const Frame& frame : m_frames)
+        {
+            if ((frame.m_frameId == InvalidHostFrameId) || (&frame == m_recordingFrame))
+            {
+                continue;
+            }
+
+            // Only frames at or before the newest recorded frame are part of the current history
+            if ((frame.m_frameId <= m_newestFrameId) && ((oldestFrameId == InvalidHostFrameId) || (frame.m_frameId < oldestFrameId)))
+            {
+                oldestFrameId = frame.m_frameId;
+            }
+        }
+        return oldestFrameId;
+    }
+
+    void TransformHistory::Clear()
+    {
+        AZ_Assert(m_recordingFrame == nullptr, "Cannot clear the history while recording a frame");
+        for (Frame& frame : m_frames)
+        {
+            frame.Clear();
+        }
+        m_newestFrameId = InvalidHostFrameId;
+    }
+}
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/ReplicationWindows/NetworkEntityInterestGrid.h>
+#include <Multiplayer/Components/NetBindComponent.h>
+#include <AzFramework/Visibility/IVisibilitySystem.h>
+#include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/smart_ptr/weak_ptr.h>
+
+namespace Multiplayer
+{
+    AZ_CVAR(float, sv_InterestGridCellSize, 100.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "The width in meters of a cell of the grid replication windows gather network entities from");
+    AZ_CVAR(AZ::TimeMs, sv_InterestGridRebuildMs, AZ::TimeMs{ 100 }, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum age of the network entity interest grid before a replication window update rebuilds it");
+
+    // Entries overlapping more cells than this are kept in a separate list instead of being added to every cell
+    static constexpr int32_t MaxCellsPerEntry = 16;
+
+    AZStd::shared_ptr<NetworkEntityInterestGrid> NetworkEntityInterestGrid::Acquire()
+    {
+        static AZStd::weak_ptr<NetworkEntityInterestGrid> s_sharedGrid;
+        AZStd::shared_ptr<NetworkEntityInterestGrid> grid = s_sharedGrid.lock();
+        if (!grid)
+        {
+            grid = AZStd::make_shared<NetworkEntityInterestGrid>();
+            s_sharedGrid = grid;
+        }
+        return grid;
+    }
+
+    NetworkEntityInterestGrid::NetworkEntityInterestGrid()
+        : m_entityActivatedEventHandler([this](AZ::Entity*) { Invalidate(); })
+        , m_entityDeactivatedEventHandler([this](AZ::Entity*) { Invalidate(); })
+    {
+        if (AZ::ComponentApplicationRequests* componentApplication = AZ::Interface<AZ::ComponentApplicationRequests>::Get())
+        {
+            componentApplication->RegisterEntityActivatedEventHandler(m_entityActivatedEventHandler);
+            componentApplication->RegisterEntityDeactivatedEventHandler(m_entityDeactivatedEventHandler);
+        }
+    }
+
+    uint32_t NetworkEntityInterestGrid::GetEntryCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_entries.size());
+    }
+
+    void NetworkEntityInterestGrid::Invalidate()
+    {
+        // Entries hold raw entity and component pointers, they may not be used past an entity activating or deactivating
+        m_isStale = true;
+    }
+
+    void NetworkEntityInterestGrid::RebuildIfStale()
+    {
+        const AZ::TimeMs currentTimeMs = AZ::GetElapsedTimeMs();
+        if (m_isStale || (currentTimeMs - m_lastRebuildTimeMs) >= sv_InterestGridRebuildMs)
+        {
+            Rebuild();
+            m_lastRebuildTimeMs = currentTimeMs;
+            m_isStale = false;
+        }
+    }
+
+    void NetworkEntityInterestGrid::Rebuild()
+    {
+        m_entries.clear();
+        m_largeEntries.clear();
+        for (auto& cell : m_cells)
+        {
+            // Keep the cell storage around, most cells stay populated from one rebuild to the next
+            cell.second.clear();
+        }
+        m_cellSize = AZStd::max(static_cast<float>(sv_InterestGridCellSize), 1.0f);
+
+        AzFramework::IVisibilitySystem* visibilitySystem = AZ::Interface<AzFramework::IVisibilitySystem>::Get();
+        if (visibilitySystem == nullptr)
+        {
+            return;
+        }
+
+        visibilitySystem->GetDefaultVisibilityScene()->EnumerateNoCull([this](const AzFramework::IVisibilityScene::NodeData& nodeData)
+            {
+                for (AzFramework::VisibilityEntry* visEntry : nodeData.m_entries)
+                {
+                    if (visEntry->m_typeFlags & AzFramework::VisibilityEntry::TypeFlags::TYPE_Entity)
+                    {
+                        AZ::Entity* entity = static_cast<AZ::Entity*>(visEntry->m_userData);
+                        NetBindComponent* netBindComponent = entity->template FindComponent<NetBindComponent>();
+                        if (netBindComponent != nullptr)
+                        {
+                            m_entries.push_back({ entity, netBindComponent, visEntry->m_boundingVolume });
+                        }
+                    }
+                }
+            }
+        );
+
+        m_visitedStamps.clear();
+        m_visitedStamps.resize(m_entries.size(), 0u);
+        m_queryStamp = 0;
+
+        for (uint32_t entryIndex = 0; entryIndex < m_entries.size(); ++entryIndex)
+        {
+            InsertEntry(entryIndex);
+        }
+    }
+
+    void NetworkEntityInterestGrid::InsertEntry(uint32_t entryIndex)
+    {
+        int32_t cellMin[2];
+        int32_t cellMax[2];
+        GetCellRange(m_entries[entryIndex].m_boundingVolume, cellMin, cellMax);
+        if ((cellMax[0] - cellMin[0] + 1) * (cellMax[1] - cellMin[1] + 1) > MaxCellsPerEntry)
+        {
+            m_largeEntries.push_back(entryIndex);
+            return;
+        }
+
+        for (int32_t x = cellMin[0]; x <= cellMax[0]; ++x)
+        {
+            for (int32_t y = cellMin[1]; y <= cellMax[1]; ++y)
+            {
+                m_cells[GetCellKey(x, y)].push_back(entryIndex);
+            }
+        }
+    }
+
+    NetworkEntityInterestGrid::CellKey NetworkEntityInterestGrid::GetCellKey(int32_t x, int32_t y) const
+    {
+        return (static_cast<CellKey>(static_cast<uint32_t>(x)) << 32) | static_cast<CellKey>(static_cast<uint32_t>(y));
+    }
+
+    void NetworkEntityInterestGrid::GetCellRange(const AZ::Aabb& aabb, int32_t* outMin, int32_t* outMax) const
+    {
+        // Clamp so far away entities collapse onto the outermost cells instead of overflowing the cell coordinates
+        constexpr float MaxCellCoordinate = 1000000.0f;
+        const float invCellSize = 1.0f / m_cellSize;
+        for (int32_t axis = 0; axis < 2; ++axis)
+        {
+            const float minCoordinate = AZStd::clamp(aabb.GetMin().GetElement(axis) * invCellSize, -MaxCellCoordinate, MaxCellCoordinate);
+            const float maxCoordinate = AZStd::clamp(aabb.GetMax().GetElement(axis) * invCellSize, -MaxCellCoordinate, MaxCellCoordinate);
+            outMin[axis] = static_cast<int32_t>(AZStd::floor(minCoordinate));
+            outMax[axis] = static_cast<int32_t>(AZStd::floor(maxCoordinate));
+        }
+    }
+}
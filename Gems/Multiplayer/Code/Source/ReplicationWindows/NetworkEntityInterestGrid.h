@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/EntityBus.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Sphere.h>
+#include <AzCore/Time/ITime.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+
+namespace Multiplayer
+{
+    class NetBindComponent;
+
+    //! @class NetworkEntityInterestGrid
+    //! @brief Spatial hash grid of network entities shared by all server to client replication windows.
+    //!
+    //! Every replication window needs the network entities within its awareness radius. Querying the visibility system and
+    //! looking up the NetBindComponent of every entry per connection costs connections x entities, so the grid gathers the
+    //! network entities once and buckets them into columns on the horizontal plane. Windows then only visit the columns their
+    //! awareness sphere overlaps.
+    //! The grid is rebuilt lazily when it's older than sv_InterestGridRebuildMs or when a network entity activates or deactivates.
+    class NetworkEntityInterestGrid
+    {
+    public:
+
+        struct Entry
+        {
+            AZ::Entity* m_entity = nullptr;
+            NetBindComponent* m_netBindComponent = nullptr;
+            AZ::Aabb m_boundingVolume = AZ::Aabb::CreateNull();
+        };
+
+        //! Returns the grid shared by all replication windows, creating it if no window holds it.
+        //! @return shared pointer to the grid, the grid is destroyed with the last window that holds it
+        static AZStd::shared_ptr<NetworkEntityInterestGrid> Acquire();
+
+        NetworkEntityInterestGrid();
+        ~NetworkEntityInterestGrid() = default;
+
+        //! Calls the visitor once for every network entity whose bounding volume overlaps the sphere.
+        //! Rebuilds the grid first if it's out of date.
+        //! @param sphere  the sphere to gather entities in
+        //! @param visitor callable taking a const Entry&
+        template <typename VISITOR>
+        void Enumerate(const AZ::Sphere& sphere, VISITOR&& visitor);
+
+        //! Returns the number of network entities in the grid.
+        //! @return the number of network entities in the grid
+        uint32_t GetEntryCount() const;
+
+        //! Marks the grid out of date so the next query rebuilds it.
+        void Invalidate();
+
+    private:
+
+        using CellKey = uint64_t;
+
+        void RebuildIfStale();
+        void Rebuild();
+        void InsertEntry(uint32_t entryIndex);
+        CellKey GetCellKey(int32_t x, int32_t y) const;
+        void GetCellRange(const AZ::Aabb& aabb, int32_t* outMin, int32_t* outMax) const;
+
+        AZ::EntityActivatedEvent::Handler m_entityActivatedEventHandler;
+        AZ::EntityDeactivatedEvent::Handler m_entityDeactivatedEventHandler;
+
+        AZStd::vector<Entry> m_entries;
+        AZStd::unordered_map<CellKey, AZStd::vector<uint32_t>> m_cells;
+        AZStd::vector<uint32_t> m_largeEntries; //!< Entries overlapping too many cells to bucket, tested by every query
+        AZStd::vector<uint32_t> m_visitedStamps; //!< Per entry query stamp, so entries spanning several cells are visited once
+        uint32_t m_queryStamp = 0;
+        float m_cellSize = 0.0f;
+        AZ::TimeMs m_lastRebuildTimeMs = AZ::TimeMs{ 0 };
+        bool m_isStale = true;
+    };
+}
+
+#include <Source/ReplicationWindows/NetworkEntityInterestGrid.inl>
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/std/algorithm.h>
+
+namespace Multiplayer
+{
+    template <typename VISITOR>
+    inline void NetworkEntityInterestGrid::Enumerate(const AZ::Sphere& sphere, VISITOR&& visitor)
+    {
+        RebuildIfStale();
+
+        if (++m_queryStamp == 0)
+        {
+            // The stamp wrapped around, clear it so stale stamps can't match
+            AZStd::fill(m_visitedStamps.begin(), m_visitedStamps.end(), 0u);
+            m_queryStamp = 1;
+        }
+
+        auto visitEntry = [this, &sphere, &visitor](uint32_t entryIndex)
+        {
+            if (m_visitedStamps[entryIndex] == m_queryStamp)
+            {
+                return;
+            }
+            m_visitedStamps[entryIndex] = m_queryStamp;
+
+            const Entry& entry = m_entries[entryIndex];
+            if (AZ::ShapeIntersection::Overlaps(sphere, entry.m_boundingVolume))
+            {
+                visitor(entry);
+            }
+        };
+
+        for (const uint32_t entryIndex : m_largeEntries)
+        {
+            visitEntry(entryIndex);
+        }
+
+        int32_t cellMin[2];
+        int32_t cellMax[2];
+        const AZ::Vector3 radius = AZ::Vector3(sphere.GetRadius());
+        GetCellRange(AZ::Aabb::CreateFromMinMax(sphere.GetCenter() - radius, sphere.GetCenter() + radius), cellMin, cellMax);
+        for (int32_t x = cellMin[0]; x <= cellMax[0]; ++x)
+        {
+            for (int32_t y = cellMin[1]; y <= cellMax[1]; ++y)
+            {
+                auto cellIter = m_cells.find(GetCellKey(x, y));
+                if (cellIter != m_cells.end())
+                {
+                    for (const uint32_t entryIndex : cellIter->second)
+                    {
+                        visitEntry(entryIndex);
+                    }
+                }
+            }
+        }
+    }
+}
@@ -8,7 +8,6 @@
 
 #include <Source/ReplicationWindows/ServerToClientReplicationWindow.h>
 #include <Multiplayer/Components/NetBindComponent.h>
-#include <AzFramework/Visibility/IVisibilitySystem.h>
 #include <AzCore/Component/TransformBus.h>
 #include <AzCore/Console/ILogger.h>
 #include <AzCore/std/sort.h>
@@ -58,6 +57,7 @@ namespace Multiplayer
         , m_lastCheckedSentPackets(connection->GetMetrics().m_packetsSent)
         , m_lastCheckedLostPackets(connection->GetMetrics().m_packetsLost)
         , m_updateWindowEvent([this]() { UpdateWindow(); }, AZ::Name("Server to client replication window update event"))
+        , m_interestGrid(NetworkEntityInterestGrid::Acquire())
     {
         AZ::Entity* entity = m_controlledEntity.GetEntity();
         AZ_Assert(entity, "Invalid controlled entity provided to replication window");
@@ -124,47 +124,28 @@ namespace Multiplayer
         AZ::TransformInterface* transformInterface = m_controlledEntity.GetEntity()->GetTransform();
         const AZ::Vector3 controlledEntityPosition = transformInterface->GetWorldTranslation();
 
-        AZStd::vector<AzFramework::VisibilityEntry*> gatheredEntries;
-        AZ::Sphere awarenessSphere = AZ::Sphere(controlledEntityPosition, sv_ClientAwarenessRadius);
-        AZ::Interface<AzFramework::IVisibilitySystem>::Get()->GetDefaultVisibilityScene()->Enumerate(awarenessSphere, [&gatheredEntries](const AzFramework::IVisibilityScene::NodeData& nodeData)
-            {
-                gatheredEntries.reserve(gatheredEntries.size() + nodeData.m_entries.size());
-                for (AzFramework::VisibilityEntry* visEntry : nodeData.m_entries)
-                {
-                    if (visEntry->m_typeFlags & AzFramework::VisibilityEntry::TypeFlags::TYPE_Entity)
-                    {
-                        gatheredEntries.push_back(visEntry);
-                    }
-                }
-            }
-        );
-
-        NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();        
+        NetworkEntityTracker* networkEntityTracker = GetNetworkEntityTracker();
         IFilterEntityManager* filterEntityManager = GetMultiplayer()->GetFilterEntityManager();
 
         // Add all the neighbors
-        for (AzFramework::VisibilityEntry* visEntry : gatheredEntries)
-        {
-            AZ::Entity* entity = static_cast<AZ::Entity*>(visEntry->m_userData);
-
-            if (filterEntityManager && filterEntityManager->IsEntityFiltered(entity, m_controlledEntity, m_connection->GetConnectionId()))
+        AZ::Sphere awarenessSphere = AZ::Sphere(controlledEntityPosition, sv_ClientAwarenessRadius);
+        m_interestGrid->Enumerate(awarenessSphere, [this, &controlledEntityPosition, networkEntityTracker, filterEntityManager](const NetworkEntityInterestGrid::Entry& entry)
             {
-                continue;
-            }
+                if (filterEntityManager && filterEntityManager->IsEntityFiltered(entry.m_entity, m_controlledEntity, m_connection->GetConnectionId()))
+                {
+                    return;
+                }
 
-            NetBindComponent* entryNetBindComponent = entity->template FindComponent<NetBindComponent>();
-            if (entryNetBindComponent != nullptr)
-            {
                 // We want to find the closest extent to the player and prioritize using that distance
-                const AZ::Vector3 supportNormal = controlledEntityPosition - visEntry->m_boundingVolume.GetCenter();
-                const AZ::Vector3 closestPosition = visEntry->m_boundingVolume.GetSupport(supportNormal);
+                const AZ::Vector3 supportNormal = controlledEntityPosition - entry.m_boundingVolume.GetCenter();
+                const AZ::Vector3 closestPosition = entry.m_boundingVolume.GetSupport(supportNormal);
                 const float gatherDistanceSquared = controlledEntityPosition.GetDistanceSq(closestPosition);
                 const float priority = (gatherDistanceSquared > 0.0f) ? 1.0f / gatherDistanceSquared : 0.0f;
 
-                NetworkEntityHandle entityHandle(entryNetBindComponent, networkEntityTracker);
+                NetworkEntityHandle entityHandle(entry.m_netBindComponent, networkEntityTracker);
                 AddEntityToReplicationSet(entityHandle, priority, gatherDistanceSquared);
             }
-        }
+        );
 
         // Add in Autonomous Entities
         // Note: Do not add any Client entities after this point, otherwise you stomp over the Autonomous mode
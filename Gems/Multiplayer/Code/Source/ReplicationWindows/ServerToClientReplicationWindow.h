@@ -11,6 +11,7 @@
 #include <Multiplayer/IMultiplayer.h>
 #include <Multiplayer/NetworkEntity/NetworkEntityHandle.h>
 #include <Multiplayer/ReplicationWindows/IReplicationWindow.h>
+#include <Source/ReplicationWindows/NetworkEntityInterestGrid.h>
 #include <AzNetworking/ConnectionLayer/IConnection.h>
 #include <AzCore/Component/EntityBus.h>
 #include <AzCore/EBus/ScheduledEvent.h>
@@ -66,6 +67,7 @@ namespace Multiplayer
         ReplicationSet m_replicationSet;
 
         AZ::ScheduledEvent m_updateWindowEvent;
+        AZStd::shared_ptr<NetworkEntityInterestGrid> m_interestGrid;
 
         NetworkEntityHandle m_controlledEntity;
         AZ::TransformInterface* m_controlledEntityTransform = nullptr;
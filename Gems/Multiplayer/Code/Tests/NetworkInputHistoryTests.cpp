@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/NetworkInput/NetworkInputArray.h>
+#include <Source/NetworkInput/NetworkInputHistory.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    class NetworkInputHistoryTests
+        : public AllocatorsFixture
+    {
+    public:
+        void PushInput(Multiplayer::NetworkInputHistory& history, uint32_t inputId)
+        {
+            m_inputArray[0].SetClientInputId(Multiplayer::ClientInputId{ inputId });
+            history.PushBack(m_inputArray[0]);
+        }
+
+        Multiplayer::NetworkInputArray m_inputArray;
+    };
+
+    TEST_F(NetworkInputHistoryTests, WrapsWithoutGrowing)
+    {
+        Multiplayer::NetworkInputHistory history;
+        history.Reserve(4);
+        EXPECT_EQ(history.Capacity(), 4u);
+
+        for (uint32_t inputId = 0; inputId < 20; ++inputId)
+        {
+            PushInput(history, inputId);
+            while (history.Size() > 3)
+            {
+                history.PopFront();
+            }
+        }
+
+        EXPECT_EQ(history.Capacity(), 4u);
+        ASSERT_EQ(history.Size(), 3u);
+        EXPECT_EQ(history.Front().GetClientInputId(), Multiplayer::ClientInputId{ 17 });
+        for (uint32_t index = 0; index < 3; ++index)
+        {
+            EXPECT_EQ(history[index].GetClientInputId(), Multiplayer::ClientInputId{ 17 + index });
+        }
+    }
+
+    TEST_F(NetworkInputHistoryTests, GrowingKeepsOrder)
+    {
+        Multiplayer::NetworkInputHistory history;
+        history.Reserve(4);
+
+        // Offset the ring so growing has to unroll it
+        PushInput(history, 0);
+        PushInput(history, 1);
+        history.PopFront();
+        history.PopFront();
+
+        for (uint32_t inputId = 2; inputId < 12; ++inputId)
+        {
+            PushInput(history, inputId);
+        }
+
+        EXPECT_GE(history.Capacity(), 10u);
+        ASSERT_EQ(history.Size(), 10u);
+        for (uint32_t index = 0; index < 10; ++index)
+        {
+            EXPECT_EQ(history[index].GetClientInputId(), Multiplayer::ClientInputId{ 2 + index });
+        }
+    }
+}
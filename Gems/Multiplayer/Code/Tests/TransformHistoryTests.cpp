@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Multiplayer/NetworkTime/TransformHistory.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    class TransformHistoryTests
+        : public AllocatorsFixture
+    {
+    public:
+        static AZ::Transform CreateTransform(uint32_t frame, uint32_t entity)
+        {
+            return AZ::Transform::CreateTranslation(AZ::Vector3(static_cast<float>(frame), static_cast<float>(entity), 0.0f));
+        }
+
+        static void RecordFrame(Multiplayer::TransformHistory& history, uint32_t frame, uint32_t entityCount)
+        {
+            history.BeginFrame(Multiplayer::HostFrameId{ frame }, entityCount);
+            for (uint32_t entity = 0; entity < entityCount; ++entity)
+            {
+                history.AddSample(Multiplayer::NetEntityId{ entity }, CreateTransform(frame, entity));
+            }
+            history.EndFrame();
+        }
+    };
+
+    TEST_F(TransformHistoryTests, RewindAllReturnsRecordedFrame)
+    {
+        Multiplayer::TransformHistory history(8);
+        for (uint32_t frame = 0; frame < 4; ++frame)
+        {
+            RecordFrame(history, frame, 16);
+        }
+
+        uint32_t rewoundCount = 0;
+        EXPECT_TRUE(history.RewindAll(Multiplayer::HostFrameId{ 2 }, [&rewoundCount](Multiplayer::NetEntityId netEntityId, const AZ::Transform& transform)
+        {
+            EXPECT_TRUE(transform.IsClose(CreateTransform(2, static_cast<uint32_t>(netEntityId))));
+            ++rewoundCount;
+        }));
+        EXPECT_EQ(rewoundCount, 16u);
+
+        AZ::Transform transform;
+        EXPECT_TRUE(history.GetTransform(Multiplayer::HostFrameId{ 3 }, Multiplayer::NetEntityId{ 5 }, transform));
+        EXPECT_TRUE(transform.IsClose(CreateTransform(3, 5)));
+        EXPECT_FALSE(history.GetTransform(Multiplayer::HostFrameId{ 3 }, Multiplayer::NetEntityId{ 16 }, transform));
+    }
+
+    TEST_F(TransformHistoryTests, OldFramesAreOverwritten)
+    {
+        Multiplayer::TransformHistory history(8);
+        EXPECT_EQ(history.GetOldestFrameId(), Multiplayer::InvalidHostFrameId);
+
+        for (uint32_t frame = 0; frame < 20; ++frame)
+        {
+            RecordFrame(history, frame, 4);
+        }
+
+        EXPECT_EQ(history.GetFrame(Multiplayer::HostFrameId{ 11 }), nullptr);
+        EXPECT_NE(history.GetFrame(Multiplayer::HostFrameId{ 12 }), nullptr);
+        EXPECT_EQ(history.GetFrame(Multiplayer::HostFrameId{ 20 }), nullptr);
+        EXPECT_EQ(history.GetOldestFrameId(), Multiplayer::HostFrameId{ 12 });
+        EXPECT_FALSE(history.RewindAll(Multiplayer::HostFrameId{ 4 }, [](Multiplayer::NetEntityId, const AZ::Transform&) {}));
+
+        history.Clear();
+        EXPECT_EQ(history.GetFrame(Multiplayer::HostFrameId{ 19 }), nullptr);
+    }
+}
@@ -37,6 +37,7 @@ set(FILES
     Include/Multiplayer/NetworkTime/RewindableFixedVector.inl
     Include/Multiplayer/NetworkTime/RewindableObject.h
     Include/Multiplayer/NetworkTime/RewindableObject.inl
+    Include/Multiplayer/NetworkTime/TransformHistory.h
     Include/Multiplayer/Physics/PhysicsUtils.h
     Include/Multiplayer/ReplicationWindows/IReplicationWindow.h
     Source/MultiplayerSystemComponent.cpp
@@ -100,11 +101,15 @@ set(FILES
     Source/NetworkInput/NetworkInputMigrationVector.h
     Source/NetworkTime/NetworkTime.cpp
     Source/NetworkTime/NetworkTime.h
+    Source/NetworkTime/TransformHistory.cpp
     Source/Pipeline/NetBindMarkerComponent.cpp
     Source/Pipeline/NetBindMarkerComponent.h
     Source/Pipeline/NetworkSpawnableHolderComponent.cpp
     Source/Pipeline/NetworkSpawnableHolderComponent.h
     Source/Physics/PhysicsUtils.cpp
+    Source/ReplicationWindows/NetworkEntityInterestGrid.cpp
+    Source/ReplicationWindows/NetworkEntityInterestGrid.h
+    Source/ReplicationWindows/NetworkEntityInterestGrid.inl
     Source/ReplicationWindows/NullReplicationWindow.cpp
     Source/ReplicationWindows/NullReplicationWindow.h
     Source/ReplicationWindows/ServerToClientReplicationWindow.cpp
@@ -8,11 +8,17 @@
 
 #include "MultiplayerCompressionFactory.h"
 #include "LZ4Compressor.h"
+#include "ZstdCompressor.h"
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
 namespace MultiplayerCompression
 {
+    AZ_CVAR(AZ::CVarFixedString, net_ZstdDictionaryPath, "", nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The zstd dictionary used by MultiplayerZstdCompressor, empty to compress without a dictionary. Must be set before the first network interface is created.");
+    AZ_CVAR(int32_t, net_ZstdCompressionLevel, 3, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The zstd compression level used by MultiplayerZstdCompressor.");
+    AZ_CVAR(bool, net_ZstdCaptureSamples, false, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "Captures uncompressed packets sent through MultiplayerZstdCompressor for training with MultiplayerCompressionSystemComponent.TrainZstdDictionary. Must be set before compressors are created.");
+
     AZStd::unique_ptr<AzNetworking::ICompressor> MultiplayerCompressionFactory::Create()
     {
         return AZStd::make_unique<LZ4Compressor>();
@@ -22,4 +28,31 @@ namespace MultiplayerCompression
     {
         return m_name;
     }
+
+    MultiplayerZstdCompressionFactory::MultiplayerZstdCompressionFactory(ZstdDictionaryTrainer& trainer)
+        : m_trainer(trainer)
+    {
+        ;
+    }
+
+    AZStd::unique_ptr<AzNetworking::ICompressor> MultiplayerZstdCompressionFactory::Create()
+    {
+        if (!m_dictionaryLoaded)
+        {
+            const AZ::CVarFixedString dictionaryPath = static_cast<AZ::CVarFixedString>(net_ZstdDictionaryPath);
+            if (!dictionaryPath.empty())
+            {
+                m_dictionary = ZstdDictionary::LoadFromFile(dictionaryPath.c_str(), net_ZstdCompressionLevel);
+            }
+            m_dictionaryLoaded = true;
+        }
+
+        ZstdDictionaryTrainer* trainer = net_ZstdCaptureSamples ? &m_trainer : nullptr;
+        return AZStd::make_unique<ZstdCompressor>(m_dictionary, net_ZstdCompressionLevel, trainer);
+    }
+
+    AZ::Name MultiplayerZstdCompressionFactory::GetFactoryName() const
+    {
+        return m_name;
+    }
 }
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzNetworking/Framework/ICompressor.h>
 
@@ -29,4 +30,31 @@ namespace MultiplayerCompression
     private:
         const AZ::Name m_name = AZ::Name("MultiplayerCompressor");
     };
+
+    class ZstdDictionary;
+    class ZstdDictionaryTrainer;
+
+    //! Creates zstd compressors, select it by setting net_UdpCompressor or net_TcpCompressor to MultiplayerZstdCompressor.
+    //! The dictionary set by net_ZstdDictionaryPath is loaded on the first Create and shared by every compressor.
+    class MultiplayerZstdCompressionFactory
+        : public AzNetworking::ICompressorFactory
+    {
+    public:
+        //! @param trainer the trainer compressors capture samples into while net_ZstdCaptureSamples is enabled
+        explicit MultiplayerZstdCompressionFactory(ZstdDictionaryTrainer& trainer);
+
+        //! Instantiate a new compressor
+        //! @return A unique_ptr to a new Compressor
+        AZStd::unique_ptr<AzNetworking::ICompressor> Create() override;
+
+        //! Gets the AZ Name of this compressor factory
+        //! @return the AZ Name of this compressor factory
+        AZ::Name GetFactoryName() const override;
+
+    private:
+        const AZ::Name m_name = AZ::Name("MultiplayerZstdCompressor");
+        ZstdDictionaryTrainer& m_trainer;
+        AZStd::shared_ptr<const ZstdDictionary> m_dictionary;
+        bool m_dictionaryLoaded = false;
+    };
 }
@@ -6,7 +6,9 @@
  *
  */
 
+#include <AzCore/Console/ILogger.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/IO/FileIO.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
@@ -18,6 +20,8 @@
 
 namespace MultiplayerCompression
 {
+    AZ_CVAR(uint32_t, net_ZstdDictionarySize, 16 * 1024, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The maximum size of a zstd dictionary trained by TrainZstdDictionary.");
+
     void MultiplayerCompressionSystemComponent::Reflect(AZ::ReflectContext* context)
     {
         if (AZ::SerializeContext* serialize = azrtti_cast<AZ::SerializeContext*>(context))
@@ -51,11 +55,73 @@ namespace MultiplayerCompression
     {
         m_multiplayerCompressionFactory = new MultiplayerCompressionFactory();
         AZ::Interface<AzNetworking::INetworking>::Get()->RegisterCompressorFactory(m_multiplayerCompressionFactory);
+
+        // INetworking owns registered factories and deletes them when they are unregistered
+        m_multiplayerZstdCompressionFactory = new MultiplayerZstdCompressionFactory(m_zstdDictionaryTrainer);
+        AZ::Interface<AzNetworking::INetworking>::Get()->RegisterCompressorFactory(m_multiplayerZstdCompressionFactory);
     }
 
     MultiplayerCompressionSystemComponent::~MultiplayerCompressionSystemComponent()
     {
+        AZ::Interface<AzNetworking::INetworking>::Get()->UnregisterCompressorFactory(m_multiplayerZstdCompressionFactory->GetFactoryName());
         AZ::Interface<AzNetworking::INetworking>::Get()->UnregisterCompressorFactory(m_multiplayerCompressionFactory->GetFactoryName());
         delete m_multiplayerCompressionFactory;
     }
+
+    void MultiplayerCompressionSystemComponent::SaveZstdCapture(const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (arguments.size() < 1)
+        {
+            AZLOG_INFO("SaveZstdCapture requires the path of the capture file to write");
+            return;
+        }
+
+        const AZ::CVarFixedString path{ arguments.front() };
+        if (m_zstdDictionaryTrainer.SaveSamples(path.c_str()))
+        {
+            AZLOG_INFO("Saved %zu zstd samples to %s", m_zstdDictionaryTrainer.GetSampleCount(), path.c_str());
+        }
+    }
+
+    void MultiplayerCompressionSystemComponent::LoadZstdCapture(const AZ::ConsoleCommandContainer& arguments)
+    {
+        for (const AZStd::string_view& argument : arguments)
+        {
+            const AZ::CVarFixedString path{ argument };
+            m_zstdDictionaryTrainer.LoadSamples(path.c_str());
+        }
+        AZLOG_INFO("%zu zstd samples are available for training", m_zstdDictionaryTrainer.GetSampleCount());
+    }
+
+    void MultiplayerCompressionSystemComponent::ClearZstdCapture([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        m_zstdDictionaryTrainer.Clear();
+    }
+
+    void MultiplayerCompressionSystemComponent::TrainZstdDictionary(const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (arguments.size() < 1)
+        {
+            AZLOG_INFO("TrainZstdDictionary requires the path of the dictionary file to write");
+            return;
+        }
+
+        AZStd::vector<uint8_t> dictionary;
+        uint32_t dictionaryId = 0;
+        if (!m_zstdDictionaryTrainer.TrainDictionary(net_ZstdDictionarySize, dictionary, dictionaryId))
+        {
+            return;
+        }
+
+        const AZ::CVarFixedString path{ arguments.front() };
+        AZ::IO::FileIOStream stream(path.c_str(), AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeBinary);
+        if (!stream.IsOpen() || (stream.Write(dictionary.size(), dictionary.data()) != dictionary.size()))
+        {
+            AZLOG_WARN("Failed to write the zstd dictionary to %s", path.c_str());
+            return;
+        }
+
+        // The dictionary id is written into every compressed packet, peers using a dictionary with a different id reject the packets
+        AZLOG_INFO("Trained zstd dictionary %s from %zu samples (%zu B, id %u)", path.c_str(), m_zstdDictionaryTrainer.GetSampleCount(), dictionary.size(), dictionaryId);
+    }
 }
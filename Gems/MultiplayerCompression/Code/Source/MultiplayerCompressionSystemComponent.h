@@ -9,9 +9,11 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/std/containers/unordered_set.h>
 
 #include <MultiplayerCompressionFactory.h>
+#include <ZstdDictionaryTrainer.h>
 
 namespace MultiplayerCompression
 {
@@ -39,7 +41,23 @@ namespace MultiplayerCompression
         void Activate() override {}
         void Deactivate() override {}
         ////////////////////////////////////////////////////////////////////////
+
+        //! Console commands.
+        //! @{
+        void SaveZstdCapture(const AZ::ConsoleCommandContainer& arguments);
+        void LoadZstdCapture(const AZ::ConsoleCommandContainer& arguments);
+        void ClearZstdCapture(const AZ::ConsoleCommandContainer& arguments);
+        void TrainZstdDictionary(const AZ::ConsoleCommandContainer& arguments);
+        //! @}
+
     private:
+        AZ_CONSOLEFUNC(MultiplayerCompressionSystemComponent, SaveZstdCapture, AZ::ConsoleFunctorFlags::DontReplicate, "Saves the packets captured while net_ZstdCaptureSamples is enabled to the given file");
+        AZ_CONSOLEFUNC(MultiplayerCompressionSystemComponent, LoadZstdCapture, AZ::ConsoleFunctorFlags::DontReplicate, "Adds the packets of a saved capture file to the zstd training samples");
+        AZ_CONSOLEFUNC(MultiplayerCompressionSystemComponent, ClearZstdCapture, AZ::ConsoleFunctorFlags::DontReplicate, "Discards all zstd training samples");
+        AZ_CONSOLEFUNC(MultiplayerCompressionSystemComponent, TrainZstdDictionary, AZ::ConsoleFunctorFlags::DontReplicate, "Trains a zstd dictionary from the captured samples and writes it to the given file, for use with net_ZstdDictionaryPath");
+
         MultiplayerCompressionFactory* m_multiplayerCompressionFactory;
+        MultiplayerZstdCompressionFactory* m_multiplayerZstdCompressionFactory;
+        ZstdDictionaryTrainer m_zstdDictionaryTrainer;
     };
 }
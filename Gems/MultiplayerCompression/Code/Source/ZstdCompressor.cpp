@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "ZstdCompressor.h"
+#include "ZstdDictionaryTrainer.h"
+
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+#define ZSTD_STATIC_LINKING_ONLY
+#include <zstd.h>
+
+namespace MultiplayerCompression
+{
+    ZstdDictionary::ZstdDictionary(const void* dictionaryData, size_t dictionarySize, int compressionLevel)
+    {
+        m_compressionDictionary = ZSTD_createCDict(dictionaryData, dictionarySize, compressionLevel);
+        m_decompressionDictionary = ZSTD_createDDict(dictionaryData, dictionarySize);
+        if (m_decompressionDictionary != nullptr)
+        {
+            m_id = ZSTD_getDictID_fromDDict(m_decompressionDictionary);
+        }
+    }
+
+    ZstdDictionary::~ZstdDictionary()
+    {
+        ZSTD_freeCDict(m_compressionDictionary);
+        ZSTD_freeDDict(m_decompressionDictionary);
+    }
+
+    AZStd::shared_ptr<const ZstdDictionary> ZstdDictionary::LoadFromFile(const char* path, int compressionLevel)
+    {
+        AZ::IO::FileIOStream stream(path, AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary);
+        if (!stream.IsOpen())
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to open zstd dictionary %s", path);
+            return nullptr;
+        }
+
+        AZStd::vector<uint8_t> dictionaryData(stream.GetLength());
+        if (dictionaryData.empty() || (stream.Read(dictionaryData.size(), dictionaryData.data()) != dictionaryData.size()))
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to read zstd dictionary %s", path);
+            return nullptr;
+        }
+
+        AZStd::shared_ptr<ZstdDictionary> dictionary = AZStd::make_shared<ZstdDictionary>(dictionaryData.data(), dictionaryData.size(), compressionLevel);
+        if (!dictionary->IsValid())
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to create a zstd dictionary from %s", path);
+            return nullptr;
+        }
+
+        AZ_TracePrintf("Multiplayer Compressor", "Loaded zstd dictionary %s (%zu B, id %u)\n", path, dictionaryData.size(), dictionary->GetId());
+        return dictionary;
+    }
+
+    bool ZstdDictionary::IsValid() const
+    {
+        return (m_compressionDictionary != nullptr) && (m_decompressionDictionary != nullptr);
+    }
+
+    uint32_t ZstdDictionary::GetId() const
+    {
+        return m_id;
+    }
+
+    const ZSTD_CDict_s* ZstdDictionary::GetCompressionDictionary() const
+    {
+        return m_compressionDictionary;
+    }
+
+    const ZSTD_DDict_s* ZstdDictionary::GetDecompressionDictionary() const
+    {
+        return m_decompressionDictionary;
+    }
+
+    ZstdCompressor::ZstdCompressor(AZStd::shared_ptr<const ZstdDictionary> dictionary, int compressionLevel, ZstdDictionaryTrainer* trainer)
+        : m_dictionary(AZStd::move(dictionary))
+        , m_trainer(trainer)
+        , m_compressionContext(ZSTD_createCCtx())
+        , m_decompressionContext(ZSTD_createDCtx())
+        , m_compressionLevel(compressionLevel)
+    {
+        ;
+    }
+
+    ZstdCompressor::~ZstdCompressor()
+    {
+        ZSTD_freeCCtx(m_compressionContext);
+        ZSTD_freeDCtx(m_decompressionContext);
+    }
+
+    bool ZstdCompressor::Init()
+    {
+        return (m_compressionContext != nullptr) && (m_decompressionContext != nullptr);
+    }
+
+    size_t ZstdCompressor::GetMaxChunkSize(size_t maxCompSize) const
+    {
+        return maxCompSize;
+    }
+
+    size_t ZstdCompressor::GetMaxCompressedBufferSize(size_t uncompSize) const
+    {
+        return ZSTD_compressBound(uncompSize);
+    }
+
+    AzNetworking::CompressorError ZstdCompressor::Compress
+    (
+        const void* uncompData,
+        size_t uncompSize,
+        void* compData,
+        size_t compDataSize,
+        size_t& compSize
+    )
+    {
+        if ((uncompData == nullptr) || (compData == nullptr) || !Init())
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Compressor or buffers are uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        if (m_trainer != nullptr)
+        {
+            m_trainer->AddSample(uncompData, uncompSize);
+        }
+
+        size_t result = 0;
+        if (m_dictionary != nullptr)
+        {
+            // Packets are small, so skip the content size and checksum, the dictionary id is kept to detect mismatched dictionaries
+            ZSTD_frameParameters frameParameters;
+            frameParameters.contentSizeFlag = 0;
+            frameParameters.checksumFlag = 0;
+            frameParameters.noDictIDFlag = 0;
+            result = ZSTD_compress_usingCDict_advanced(m_compressionContext, compData, compDataSize, uncompData, uncompSize, m_dictionary->GetCompressionDictionary(), frameParameters);
+        }
+        else
+        {
+            result = ZSTD_compressCCtx(m_compressionContext, compData, compDataSize, uncompData, uncompSize, m_compressionLevel);
+        }
+
+        if (ZSTD_isError(result))
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Compression failed for uncompSize:(%lu B) compDataSize:(%lu B): %s", uncompSize, compDataSize, ZSTD_getErrorName(result));
+            return (compDataSize < ZSTD_compressBound(uncompSize)) ? AzNetworking::CompressorError::InsufficientBuffer : AzNetworking::CompressorError::CorruptData;
+        }
+
+        compSize = result;
+        return AzNetworking::CompressorError::Ok;
+    }
+
+    AzNetworking::CompressorError ZstdCompressor::Decompress(const void* compData, size_t compDataSize, void* uncompData, size_t uncompDataSize, size_t& consumedSizeOut, size_t& uncompSizeOut)
+    {
+        if ((uncompData == nullptr) || (compData == nullptr) || !Init())
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Compressor or buffers are uninitialized");
+            return AzNetworking::CompressorError::Uninitialized;
+        }
+
+        size_t result = 0;
+        if (m_dictionary != nullptr)
+        {
+            const uint32_t frameDictionaryId = ZSTD_getDictID_fromFrame(compData, compDataSize);
+            if (frameDictionaryId != m_dictionary->GetId())
+            {
+                AZ_Warning("Multiplayer Compressor", false, "Packet was compressed with dictionary id %u, expected dictionary id %u", frameDictionaryId, m_dictionary->GetId());
+                return AzNetworking::CompressorError::CorruptData;
+            }
+            result = ZSTD_decompress_usingDDict(m_decompressionContext, uncompData, uncompDataSize, compData, compDataSize, m_dictionary->GetDecompressionDictionary());
+        }
+        else
+        {
+            result = ZSTD_decompressDCtx(m_decompressionContext, uncompData, uncompDataSize, compData, compDataSize);
+        }
+        consumedSizeOut = compDataSize;
+
+        if (ZSTD_isError(result))
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Decompression failed for compDataSize:(%lu B) uncompDataSize:(%lu B): %s", compDataSize, uncompDataSize, ZSTD_getErrorName(result));
+            return AzNetworking::CompressorError::CorruptData;
+        }
+
+        uncompSizeOut = result;
+        return AzNetworking::CompressorError::Ok;
+    }
+}
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzNetworking/Framework/ICompressor.h>
+
+struct ZSTD_CCtx_s;
+struct ZSTD_DCtx_s;
+struct ZSTD_CDict_s;
+struct ZSTD_DDict_s;
+
+namespace MultiplayerCompression
+{
+    static const char* ZstdCompressorName = "Zstd";
+    static const AzNetworking::CompressorType ZstdCompressorType = aznumeric_cast<AzNetworking::CompressorType>(static_cast<AZ::u32>(AZ::Crc32(ZstdCompressorName)));
+
+    class ZstdDictionaryTrainer;
+
+    /**
+    * A zstd dictionary prepared for compression and decompression.
+    * Dictionaries are immutable once built and are shared by every ZstdCompressor, zstd allows a prepared
+    * dictionary to be used by multiple contexts on different threads at once.
+    */
+    class ZstdDictionary
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ZstdDictionary, AZ::SystemAllocator, 0);
+
+        //! Builds a dictionary from either a trained dictionary or raw content.
+        //! @param dictionaryData    the dictionary bytes, copied by zstd
+        //! @param dictionarySize    the number of dictionary bytes
+        //! @param compressionLevel  the zstd compression level the dictionary is digested for
+        ZstdDictionary(const void* dictionaryData, size_t dictionarySize, int compressionLevel);
+        ~ZstdDictionary();
+
+        //! Loads a dictionary file written by MultiplayerCompressionSystemComponent.TrainZstdDictionary.
+        //! @param path              the path to the dictionary file, aliases are resolved
+        //! @param compressionLevel  the zstd compression level the dictionary is digested for
+        //! @return the loaded dictionary, or nullptr if the file could not be read or is not a dictionary
+        static AZStd::shared_ptr<const ZstdDictionary> LoadFromFile(const char* path, int compressionLevel);
+
+        bool IsValid() const;
+
+        //! Trained dictionaries carry an id that is written into every compressed packet and acts as the dictionary version.
+        //! @return the dictionary id, 0 for raw content dictionaries
+        uint32_t GetId() const;
+
+        const ZSTD_CDict_s* GetCompressionDictionary() const;
+        const ZSTD_DDict_s* GetDecompressionDictionary() const;
+
+    private:
+        AZ_DISABLE_COPY_MOVE(ZstdDictionary);
+
+        ZSTD_CDict_s* m_compressionDictionary = nullptr;
+        ZSTD_DDict_s* m_decompressionDictionary = nullptr;
+        uint32_t m_id = 0;
+    };
+
+    /**
+    * Implements a zstd Compressor for use with the Multiplayer Gem.
+    * Game packets are small and compress poorly on their own, so the compressor can use a dictionary trained from captured
+    * traffic. Peers must use the same dictionary, packets compressed with a different dictionary version are rejected.
+    */
+    class ZstdCompressor
+        : public AzNetworking::ICompressor
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ZstdCompressor, AZ::SystemAllocator, 0);
+
+        //! @param dictionary        the shared dictionary to compress with, nullptr to compress without a dictionary
+        //! @param compressionLevel  the zstd compression level to use when there is no dictionary
+        //! @param trainer           if set, uncompressed packets are captured into it for dictionary training
+        ZstdCompressor(AZStd::shared_ptr<const ZstdDictionary> dictionary, int compressionLevel, ZstdDictionaryTrainer* trainer);
+        ~ZstdCompressor() override;
+
+        const char* GetName() const { return ZstdCompressorName; }
+        AzNetworking::CompressorType GetType() const { return ZstdCompressorType; };
+
+        bool Init();
+        size_t GetMaxChunkSize(size_t maxCompSize) const;
+        size_t GetMaxCompressedBufferSize(size_t uncompSize) const;
+
+        AzNetworking::CompressorError Compress(const void* uncompData, size_t uncompSize, void* compData, size_t compDataSize, size_t& compSize);
+        AzNetworking::CompressorError Decompress(const void* compData, size_t compDataSize, void* uncompData, size_t uncompDataSize, size_t& consumedSize, size_t& uncompSize);
+
+    private:
+        AZ_DISABLE_COPY_MOVE(ZstdCompressor);
+
+        AZStd::shared_ptr<const ZstdDictionary> m_dictionary;
+        ZstdDictionaryTrainer* m_trainer = nullptr;
+        ZSTD_CCtx_s* m_compressionContext = nullptr;
+        ZSTD_DCtx_s* m_decompressionContext = nullptr;
+        int m_compressionLevel = 0;
+    };
+}
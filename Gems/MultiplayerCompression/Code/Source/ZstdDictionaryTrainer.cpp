@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "ZstdDictionaryTrainer.h"
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/IO/FileIO.h>
+
+#include <zdict.h>
+
+namespace MultiplayerCompression
+{
+    AZ_CVAR(uint32_t, net_ZstdCaptureMaxBytes, 16 * 1024 * 1024, nullptr, AZ::ConsoleFunctorFlags::DontReplicate, "The maximum number of uncompressed packet bytes captured for zstd dictionary training.");
+
+    // Capture files start with a magic number and version, followed by the sample count and each sample as a size and its bytes
+    static const uint32_t CaptureFileMagic = 0x5053545A; // "ZTSP"
+    static const uint32_t CaptureFileVersion = 1;
+
+    void ZstdDictionaryTrainer::AddSample(const void* data, size_t size)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        if (m_sampleData.size() + size > net_ZstdCaptureMaxBytes)
+        {
+            return;
+        }
+
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+        m_sampleData.insert(m_sampleData.end(), bytes, bytes + size);
+        m_sampleSizes.push_back(size);
+    }
+
+    size_t ZstdDictionaryTrainer::GetSampleCount() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        return m_sampleSizes.size();
+    }
+
+    void ZstdDictionaryTrainer::Clear()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_sampleData.clear();
+        m_sampleSizes.clear();
+    }
+
+    bool ZstdDictionaryTrainer::SaveSamples(const char* path) const
+    {
+        AZ::IO::FileIOStream stream(path, AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeBinary);
+        if (!stream.IsOpen())
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to open %s to save the zstd sample capture", path);
+            return false;
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        const uint32_t header[] = { CaptureFileMagic, CaptureFileVersion, aznumeric_cast<uint32_t>(m_sampleSizes.size()) };
+        bool success = (stream.Write(sizeof(header), header) == sizeof(header));
+
+        const uint8_t* sampleData = m_sampleData.data();
+        for (size_t sampleSize : m_sampleSizes)
+        {
+            const uint32_t size = aznumeric_cast<uint32_t>(sampleSize);
+            success = success && (stream.Write(sizeof(size), &size) == sizeof(size));
+            success = success && (stream.Write(sampleSize, sampleData) == sampleSize);
+            sampleData += sampleSize;
+        }
+
+        AZ_Warning("Multiplayer Compressor", success, "Failed to write the zstd sample capture to %s", path);
+        return success;
+    }
+
+    bool ZstdDictionaryTrainer::LoadSamples(const char* path)
+    {
+        AZ::IO::FileIOStream stream(path, AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary);
+        if (!stream.IsOpen())
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to open zstd sample capture %s", path);
+            return false;
+        }
+
+        uint32_t header[3] = {};
+        if ((stream.Read(sizeof(header), header) != sizeof(header)) || (header[0] != CaptureFileMagic) || (header[1] != CaptureFileVersion))
+        {
+            AZ_Warning("Multiplayer Compressor", false, "%s is not a zstd sample capture", path);
+            return false;
+        }
+
+        AZStd::vector<uint8_t> sampleData;
+        AZStd::vector<size_t> sampleSizes;
+        sampleSizes.reserve(header[2]);
+        const size_t fileLength = stream.GetLength();
+        for (uint32_t sampleIndex = 0; sampleIndex < header[2]; ++sampleIndex)
+        {
+            uint32_t size = 0;
+            if ((stream.Read(sizeof(size), &size) != sizeof(size)) || (stream.GetCurPos() + size > fileLength))
+            {
+                AZ_Warning("Multiplayer Compressor", false, "zstd sample capture %s is truncated", path);
+                return false;
+            }
+
+            const size_t offset = sampleData.size();
+            sampleData.resize(offset + size);
+            if (stream.Read(size, sampleData.data() + offset) != size)
+            {
+                AZ_Warning("Multiplayer Compressor", false, "zstd sample capture %s is truncated", path);
+                return false;
+            }
+            sampleSizes.push_back(size);
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_sampleData.insert(m_sampleData.end(), sampleData.begin(), sampleData.end());
+        m_sampleSizes.insert(m_sampleSizes.end(), sampleSizes.begin(), sampleSizes.end());
+        return true;
+    }
+
+    bool ZstdDictionaryTrainer::TrainDictionary(size_t dictionaryCapacity, AZStd::vector<uint8_t>& outDictionary, uint32_t& outDictionaryId) const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        if (m_sampleSizes.empty())
+        {
+            AZ_Warning("Multiplayer Compressor", false, "No samples have been captured to train a zstd dictionary from");
+            return false;
+        }
+
+        // zstd recommends roughly 100 times the dictionary size in samples, training will still work with less but compress worse
+        AZ_Warning("Multiplayer Compressor", m_sampleData.size() >= dictionaryCapacity * 100,
+            "Training a %zu B zstd dictionary from only %zu B of samples", dictionaryCapacity, m_sampleData.size());
+
+        outDictionary.resize(dictionaryCapacity);
+        const size_t result = ZDICT_trainFromBuffer(outDictionary.data(), outDictionary.size(), m_sampleData.data(), m_sampleSizes.data(), aznumeric_cast<unsigned>(m_sampleSizes.size()));
+        if (ZDICT_isError(result))
+        {
+            AZ_Warning("Multiplayer Compressor", false, "Failed to train a zstd dictionary from %zu samples: %s", m_sampleSizes.size(), ZDICT_getErrorName(result));
+            outDictionary.clear();
+            return false;
+        }
+
+        outDictionary.resize(result);
+        outDictionaryId = ZDICT_getDictID(outDictionary.data(), outDictionary.size());
+        return true;
+    }
+}
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace MultiplayerCompression
+{
+    /**
+    * Captures uncompressed packets and trains zstd dictionaries from them.
+    * Samples are added by compressors on any thread, captures can be saved to disk so a dictionary can be trained from
+    * traffic recorded across several sessions.
+    */
+    class ZstdDictionaryTrainer
+    {
+    public:
+        //! Adds a packet to the captured samples, does nothing once the capture size limit set by the net_ZstdCaptureMaxBytes cvar is reached.
+        //! @param data the uncompressed packet
+        //! @param size the size of the uncompressed packet
+        void AddSample(const void* data, size_t size);
+
+        //! @return the number of captured samples
+        size_t GetSampleCount() const;
+
+        //! Discards all captured samples.
+        void Clear();
+
+        //! Writes the captured samples to a capture file.
+        //! @param path the file to write
+        //! @return true if the capture file was written
+        bool SaveSamples(const char* path) const;
+
+        //! Appends the samples of a capture file written by SaveSamples.
+        //! @param path the file to read
+        //! @return true if the capture file was read
+        bool LoadSamples(const char* path);
+
+        //! Trains a dictionary from the captured samples.
+        //! @param dictionaryCapacity   the maximum size of the trained dictionary
+        //! @param outDictionary        the trained dictionary
+        //! @param outDictionaryId      the id zstd assigned to the dictionary, packets carry this id to version the dictionary
+        //! @return true if a dictionary was trained
+        bool TrainDictionary(size_t dictionaryCapacity, AZStd::vector<uint8_t>& outDictionary, uint32_t& outDictionaryId) const;
+
+    private:
+        mutable AZStd::mutex m_mutex;
+        AZStd::vector<uint8_t> m_sampleData;
+        AZStd::vector<size_t> m_sampleSizes;
+    };
+}
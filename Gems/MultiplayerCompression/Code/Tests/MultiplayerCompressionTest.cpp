@@ -10,6 +10,7 @@
 #include <AzCore/UnitTest/TestTypes.h>
 
 #include <LZ4Compressor.h>
+#include <ZstdCompressor.h>
 
 #include <AzCore/Compression/Compression.h>
 #include <AzNetworking/DataStructures/ByteBuffer.h>
@@ -127,4 +128,85 @@ TEST_F(MultiplayerCompressionTest, MultiplayerCompressionTest_NullTest)
     EXPECT_TRUE(decompressStatus == AzNetworking::CompressorError::Uninitialized);
 }
 
+TEST_F(MultiplayerCompressionTest, MultiplayerCompression_ZstdCompressTest)
+{
+    AzNetworking::UdpPacketEncodingBuffer buffer;
+    buffer.Resize(buffer.GetCapacity());
+    memset(buffer.GetBuffer(), 255, buffer.GetCapacity());
+
+    MultiplayerCompression::ZstdCompressor zstdCompressor(nullptr, 3, nullptr);
+    ASSERT_TRUE(zstdCompressor.Init());
+
+    AZStd::vector<char> compressedBuffer(zstdCompressor.GetMaxCompressedBufferSize(buffer.GetSize()));
+    AZStd::vector<char> decompressedBuffer(buffer.GetSize());
+    size_t compressedSize = 0;
+    size_t consumedSize = 0;
+    size_t uncompressedSize = 0;
+
+    AzNetworking::CompressorError compressStatus = zstdCompressor.Compress(buffer.GetBuffer(), buffer.GetSize(), compressedBuffer.data(), compressedBuffer.size(), compressedSize);
+    ASSERT_TRUE(compressStatus == AzNetworking::CompressorError::Ok);
+    EXPECT_TRUE(compressedSize < buffer.GetSize());
+
+    AzNetworking::CompressorError decompressStatus = zstdCompressor.Decompress(compressedBuffer.data(), compressedSize, decompressedBuffer.data(), decompressedBuffer.size(), consumedSize, uncompressedSize);
+    ASSERT_TRUE(decompressStatus == AzNetworking::CompressorError::Ok);
+    EXPECT_EQ(consumedSize, compressedSize);
+    EXPECT_EQ(uncompressedSize, buffer.GetSize());
+    EXPECT_TRUE(memcmp(decompressedBuffer.data(), buffer.GetBuffer(), uncompressedSize) == 0);
+}
+
+TEST_F(MultiplayerCompressionTest, MultiplayerCompression_ZstdDictionaryTest)
+{
+    // A raw content dictionary holding a typical packet, packets that only differ slightly from it should compress far better
+    uint8_t dictionaryContent[256];
+    for (uint32_t index = 0; index < sizeof(dictionaryContent); ++index)
+    {
+        dictionaryContent[index] = static_cast<uint8_t>((index * 37) ^ (index >> 3));
+    }
+    uint8_t packet[sizeof(dictionaryContent)];
+    memcpy(packet, dictionaryContent, sizeof(packet));
+    packet[10] ^= 0x5A;
+    packet[100] ^= 0xA5;
+
+    AZStd::shared_ptr<const MultiplayerCompression::ZstdDictionary> dictionary = AZStd::make_shared<MultiplayerCompression::ZstdDictionary>(dictionaryContent, sizeof(dictionaryContent), 3);
+    ASSERT_TRUE(dictionary->IsValid());
+
+    MultiplayerCompression::ZstdCompressor dictionaryCompressor(dictionary, 3, nullptr);
+    MultiplayerCompression::ZstdCompressor plainCompressor(nullptr, 3, nullptr);
+
+    AZStd::vector<char> compressedBuffer(dictionaryCompressor.GetMaxCompressedBufferSize(sizeof(packet)));
+    AZStd::vector<char> decompressedBuffer(sizeof(packet));
+    size_t plainCompressedSize = 0;
+    size_t compressedSize = 0;
+    size_t consumedSize = 0;
+    size_t uncompressedSize = 0;
+
+    ASSERT_TRUE(plainCompressor.Compress(packet, sizeof(packet), compressedBuffer.data(), compressedBuffer.size(), plainCompressedSize) == AzNetworking::CompressorError::Ok);
+    ASSERT_TRUE(dictionaryCompressor.Compress(packet, sizeof(packet), compressedBuffer.data(), compressedBuffer.size(), compressedSize) == AzNetworking::CompressorError::Ok);
+    EXPECT_LT(compressedSize * 2, plainCompressedSize);
+
+    AzNetworking::CompressorError decompressStatus = dictionaryCompressor.Decompress(compressedBuffer.data(), compressedSize, decompressedBuffer.data(), decompressedBuffer.size(), consumedSize, uncompressedSize);
+    ASSERT_TRUE(decompressStatus == AzNetworking::CompressorError::Ok);
+    EXPECT_EQ(uncompressedSize, sizeof(packet));
+    EXPECT_TRUE(memcmp(decompressedBuffer.data(), packet, sizeof(packet)) == 0);
+
+    // A peer without the dictionary can't decode the packet
+    decompressStatus = plainCompressor.Decompress(compressedBuffer.data(), compressedSize, decompressedBuffer.data(), decompressedBuffer.size(), consumedSize, uncompressedSize);
+    EXPECT_TRUE(decompressStatus == AzNetworking::CompressorError::CorruptData);
+}
+
+TEST_F(MultiplayerCompressionTest, MultiplayerCompressionTest_ZstdNullTest)
+{
+    size_t compressedSize = 0;
+    size_t consumedSize = 0;
+    size_t uncompressedSize = 0;
+
+    MultiplayerCompression::ZstdCompressor zstdCompressor(nullptr, 3, nullptr);
+
+    AzNetworking::CompressorError compressStatus = zstdCompressor.Compress(nullptr, 4, nullptr, 4, compressedSize);
+    EXPECT_TRUE(compressStatus == AzNetworking::CompressorError::Uninitialized);
+
+    AzNetworking::CompressorError decompressStatus = zstdCompressor.Decompress(nullptr, 4, nullptr, 4, consumedSize, uncompressedSize);
+    EXPECT_TRUE(decompressStatus == AzNetworking::CompressorError::Uninitialized);
+}
+
 AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
@@ -13,4 +13,8 @@ set(FILES
     Source/MultiplayerCompressionFactory.h
     Source/MultiplayerCompressionSystemComponent.cpp
     Source/MultiplayerCompressionSystemComponent.h
+    Source/ZstdCompressor.cpp
+    Source/ZstdCompressor.h
+    Source/ZstdDictionaryTrainer.cpp
+    Source/ZstdDictionaryTrainer.h
 )
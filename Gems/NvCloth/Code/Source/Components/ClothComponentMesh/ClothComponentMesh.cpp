@@ -173,7 +173,7 @@ namespace NvCloth
             renderData.m_bitangents = m_meshClothInfo.m_bitangents;
             renderData.m_normals = m_meshClothInfo.m_normals;
         }
-        UpdateRenderData(m_cloth->GetParticles());
+        UpdateRenderData(m_cloth->GetParticles(), GetRenderData());
         // Copy the first initialized element to the rest of the buffer
         for (AZ::u32 i = 1; i < RenderDataBufferSize; ++i)
         {
@@ -269,10 +269,13 @@ namespace NvCloth
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Cloth);
 
-        // Next buffer index of the render data
-        m_renderDataBufferIndex = (m_renderDataBufferIndex + 1) % RenderDataBufferSize;
+        // Fill the next buffer of the render data and only publish it once it's complete,
+        // so the render data can be copied to the model while the simulation is still running.
+        const AZ::u32 nextBufferIndex = (m_renderDataBufferIndex + 1) % RenderDataBufferSize;
 
-        UpdateRenderData(updatedParticles);
+        UpdateRenderData(updatedParticles, m_renderDataBuffer[nextBufferIndex]);
+
+        m_renderDataBufferIndex = nextBufferIndex;
     }
 
     void ClothComponentMesh::OnTransformChanged([[maybe_unused]] const AZ::Transform& local, const AZ::Transform& world)
@@ -394,7 +397,7 @@ namespace NvCloth
         }
     }
 
-    void ClothComponentMesh::UpdateRenderData(const AZStd::vector<SimParticleFormat>& particles)
+    void ClothComponentMesh::UpdateRenderData(const AZStd::vector<SimParticleFormat>& particles, RenderData& renderData)
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Cloth);
 
@@ -403,8 +406,6 @@ namespace NvCloth
             return;
         }
 
-        auto& renderData = GetRenderData();
-
         if (m_actorClothSkinning)
         {
             // Apply skinning to the non-simulated part of the mesh.
@@ -451,15 +452,16 @@ namespace NvCloth
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Cloth);
 
-        // Previous buffer index of the render data
-        const AZ::u32 previousBufferIndex = (m_renderDataBufferIndex + RenderDataBufferSize - 1) % RenderDataBufferSize;
+        // Current and previous buffer index of the render data
+        const AZ::u32 currentBufferIndex = m_renderDataBufferIndex;
+        const AZ::u32 previousBufferIndex = (currentBufferIndex + RenderDataBufferSize - 1) % RenderDataBufferSize;
 
         // Workaround to sync debug drawing with cloth rendering as
         // the Entity Debug Display Bus renders on the next frame.
         const bool isDebugDrawEnabled = m_clothDebugDisplay && m_clothDebugDisplay->IsDebugDrawEnabled();
         const RenderData& renderData = (isDebugDrawEnabled)
             ? m_renderDataBuffer[previousBufferIndex]
-            : m_renderDataBuffer[m_renderDataBufferIndex];
+            : m_renderDataBuffer[currentBufferIndex];
 
         const auto& renderParticles = renderData.m_particles;
         const auto& renderNormals = renderData.m_normals;
@@ -11,6 +11,7 @@
 #include <AzCore/Component/TransformBus.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Math/Aabb.h>
+#include <AzCore/std/parallel/atomic.h>
 
 #include <AzFramework/Physics/WindBus.h>
 
@@ -83,7 +84,7 @@ namespace NvCloth
         void UpdateSimulationCollisions();
         void UpdateSimulationSkinning(float deltaTime);
         void UpdateSimulationConstraints();
-        void UpdateRenderData(const AZStd::vector<SimParticleFormat>& particles);
+        void UpdateRenderData(const AZStd::vector<SimParticleFormat>& particles, RenderData& renderData);
 
         bool CreateCloth();
         void ApplyConfigurationToCloth();
@@ -108,10 +109,12 @@ namespace NvCloth
         ICloth::PreSimulationEvent::Handler m_preSimulationEventHandler;
         ICloth::PostSimulationEvent::Handler m_postSimulationEventHandler;
 
-        // Use a double buffer of render data to always have access to the previous frame's data.
+        // Use a triple buffer of render data to always have access to the previous frame's data.
         // The previous frame's data is used to workaround that debug draw is one frame delayed.
-        static const AZ::u32 RenderDataBufferSize = 2;
-        AZ::u32 m_renderDataBufferIndex = 0;
+        // The third buffer is the one written by the simulation, which can still be running
+        // while the render data is copied to the model when the simulation is asynchronous.
+        static const AZ::u32 RenderDataBufferSize = 3;
+        AZStd::atomic<AZ::u32> m_renderDataBufferIndex{ 0 };
         AZStd::array<RenderData, RenderDataBufferSize> m_renderDataBuffer;
 
         // Vertex mapping between full mesh and simplified mesh used in cloth simulation.
@@ -6,6 +6,7 @@
  *
  */
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/EditContext.h>
@@ -22,6 +23,10 @@
 
 namespace NvCloth
 {
+    AZ_CVAR(bool, cloth_AsyncSimulation, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "When enabled the cloth simulation runs across the frame boundary and it's finished at the start of the next frame. "
+        "It lets the simulation overlap with rendering at the cost of one frame of latency.");
+
     namespace
     {
         // Implementation of the memory allocation callback interface using nvcloth allocator.
@@ -253,6 +258,8 @@ namespace NvCloth
 
             if (solverIt != m_solvers.end())
             {
+                (*solverIt)->FinishSimulation();
+
                 // The solver will remove all its remaining cloths from it when destroyed
                 m_solvers.erase(solverIt);
                 solver = nullptr;
@@ -338,6 +345,8 @@ namespace NvCloth
         {
             FabricId fabricId = cloth->GetFabricCookedData().m_id;
 
+            RemoveCloth(cloth);
+
             // Cloth will decrement its fabric's counter on destruction.
             // In addition, if the cloth still remains added into a solver, it will remove itself from it.
             m_cloths.erase(cloth->GetId());
@@ -376,6 +385,12 @@ namespace NvCloth
             Solver* solverInstance = azdynamic_cast<Solver*>(solver);
             AZ_Assert(solverInstance, "Dynamic casting from ISolver to Solver failed.");
 
+            // The cloth might be moving from another solver.
+            if (Solver* previousSolverInstance = clothInstance->GetSolver())
+            {
+                previousSolverInstance->FinishSimulation();
+            }
+            solverInstance->FinishSimulation();
             solverInstance->AddCloth(clothInstance);
 
             return true;
@@ -394,6 +409,7 @@ namespace NvCloth
             Solver* solverInstance = clothInstance->GetSolver();
             if (solverInstance)
             {
+                solverInstance->FinishSimulation();
                 solverInstance->RemoveCloth(clothInstance);
             }
         }
@@ -405,19 +421,62 @@ namespace NvCloth
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Cloth);
 
+        // Finish the simulation left running when the asynchronous mode has been disabled this frame.
+        FinishSimulation();
+
+        StartSimulation(deltaTime);
+
+        if (!cloth_AsyncSimulation)
+        {
+            FinishSimulation();
+        }
+    }
+
+    int SystemComponent::GetTickOrder()
+    {
+        return AZ::TICK_PHYSICS;
+    }
+
+    void SystemComponent::StartSimulation(float deltaTime)
+    {
+        // Start all the solvers before waiting for any of them, so their simulation jobs run in parallel.
         for (auto& solverIt : m_solvers)
         {
             if (!solverIt->IsUserSimulated())
             {
                 solverIt->StartSimulation(deltaTime);
+            }
+        }
+    }
+
+    void SystemComponent::FinishSimulation()
+    {
+        for (auto& solverIt : m_solvers)
+        {
+            if (!solverIt->IsUserSimulated())
+            {
                 solverIt->FinishSimulation();
             }
         }
     }
 
-    int SystemComponent::GetTickOrder()
+    SystemComponent::FrameStartHandler::FrameStartHandler(SystemComponent& systemComponent)
+        : m_systemComponent(systemComponent)
     {
-        return AZ::TICK_PHYSICS;
+    }
+
+    void SystemComponent::FrameStartHandler::OnTick(
+        [[maybe_unused]] float deltaTime,
+        [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Cloth);
+
+        m_systemComponent.FinishSimulation();
+    }
+
+    int SystemComponent::FrameStartHandler::GetTickOrder()
+    {
+        return AZ::TICK_FIRST;
     }
 
     void SystemComponent::InitializeSystem()
@@ -432,13 +491,17 @@ namespace NvCloth
 
         AZ::Interface<IClothSystem>::Register(this);
         AZ::TickBus::Handler::BusConnect();
+        m_frameStartHandler.BusConnect();
     }
 
     void SystemComponent::DestroySystem()
     {
+        m_frameStartHandler.BusDisconnect();
         AZ::TickBus::Handler::BusDisconnect();
         AZ::Interface<IClothSystem>::Unregister(this);
 
+        FinishSimulation();
+
         // Destroy Cloths
         m_cloths.clear();
 
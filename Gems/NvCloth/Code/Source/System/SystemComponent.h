@@ -27,6 +27,8 @@ namespace NvCloth
     //! This class has the responsibility to initialize and tear down NvCloth library.
     //! It owns all Solvers, Cloths and Fabrics, and it manages their creation and destruction.
     //! It's also the responsible for updating (on Physics Tick) all the solvers that are not flagged as "user simulated".
+    //! All solvers are simulated in parallel. When cloth_AsyncSimulation is enabled their simulation continues
+    //! across the frame boundary and it's finished at the start of the next frame, adding one frame of latency.
     class SystemComponent
         : public AZ::Component
         , protected IClothSystem
@@ -78,6 +80,27 @@ namespace NvCloth
         FabricId FindOrCreateFabric(const FabricCookedData& fabricCookedData);
         void DestroyFabric(FabricId fabricId);
 
+        void StartSimulation(float deltaTime);
+        void FinishSimulation();
+
+        // Finishes the asynchronous simulation at the start of the frame,
+        // before any other system has the chance to modify the cloths.
+        class FrameStartHandler
+            : public AZ::TickBus::Handler
+        {
+        public:
+            explicit FrameStartHandler(SystemComponent& systemComponent);
+
+            // AZ::TickBus::Handler overrides ...
+            void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+            int GetTickOrder() override;
+
+        private:
+            SystemComponent& m_systemComponent;
+        };
+
+        FrameStartHandler m_frameStartHandler{ *this };
+
         // Factory that creates all the solvers, fabric and cloths.
         AZStd::unique_ptr<Factory> m_factory;
 
@@ -35,4 +35,9 @@ namespace PhysX
     /// The type ID of runtime component PhysX::StaticRigidBodyComponent.
     ///
     static const AZ::TypeId StaticRigidBodyComponentTypeId("{A2CCCD3D-FB31-4D65-8DCD-2CD7E1D09538}");
+
+    ///
+    /// The type ID of runtime component PhysX::HeightFieldTileStreamingComponent.
+    ///
+    static const AZ::TypeId HeightFieldTileStreamingComponentTypeId("{3F7B9E21-6C4D-4A8E-B5F2-D19A0C6E7B43}");
 }
@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/ComponentBus.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace PhysX
+{
+    //! Bus for requests to the height field tile streaming component.
+    class HeightFieldTileStreamingRequests
+        : public AZ::ComponentBus
+    {
+    public:
+        //! Sets the world positions around which tiles are streamed in, like the positions of the players or the
+        //! interest areas of a server. They replace the points of interest set before.
+        virtual void SetPointsOfInterest(const AZStd::vector<AZ::Vector3>& pointsOfInterest) = 0;
+
+        //! Returns the number of tiles that currently have a collider in the scene.
+        virtual size_t GetLoadedTileCount() const = 0;
+    };
+    using HeightFieldTileStreamingRequestBus = AZ::EBus<HeightFieldTileStreamingRequests>;
+} // namespace PhysX
@@ -17,6 +17,7 @@
 #include <Source/ShapeColliderComponent.h>
 #include <Source/ForceRegionComponent.h>
 #include <Source/StaticRigidBodyComponent.h>
+#include <Source/HeightFieldTileStreamingComponent.h>
 #include <Source/PhysXCharacters/Components/CharacterControllerComponent.h>
 #include <Source/PhysXCharacters/Components/CharacterGameplayComponent.h>
 #include <Source/PhysXCharacters/Components/RagdollComponent.h>
@@ -41,6 +42,7 @@ namespace PhysX
             ShapeColliderComponent::CreateDescriptor(),
             ForceRegionComponent::CreateDescriptor(),
             StaticRigidBodyComponent::CreateDescriptor(),
+            HeightFieldTileStreamingComponent::CreateDescriptor(),
             CharacterControllerComponent::CreateDescriptor(),
             CharacterGameplayComponent::CreateDescriptor(),
             RagdollComponent::CreateDescriptor(),
@@ -0,0 +1,279 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Source/HeightFieldTileStreamingComponent.h>
+
+#include <AzCore/Asset/AssetManager.h>
+#include <AzCore/Component/Entity.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzFramework/Physics/PhysicsScene.h>
+#include <AzFramework/Physics/SystemBus.h>
+#include <AzFramework/Physics/Configuration/StaticRigidBodyConfiguration.h>
+
+#include <PxPhysicsAPI.h>
+
+namespace PhysX
+{
+    void HeightFieldTile::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<HeightFieldTile>()
+                ->Version(1)
+                ->Field("Column", &HeightFieldTile::m_column)
+                ->Field("Row", &HeightFieldTile::m_row)
+                ->Field("Asset", &HeightFieldTile::m_asset)
+                ;
+        }
+    }
+
+    void HeightFieldTileStreamingConfiguration::Reflect(AZ::ReflectContext* context)
+    {
+        HeightFieldTile::Reflect(context);
+
+        if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<HeightFieldTileStreamingConfiguration>()
+                ->Version(1)
+                ->Field("Tiles", &HeightFieldTileStreamingConfiguration::m_tiles)
+                ->Field("TileSize", &HeightFieldTileStreamingConfiguration::m_tileSize)
+                ->Field("SampleScale", &HeightFieldTileStreamingConfiguration::m_sampleScale)
+                ->Field("StreamInDistance", &HeightFieldTileStreamingConfiguration::m_streamInDistance)
+                ->Field("StreamOutDistance", &HeightFieldTileStreamingConfiguration::m_streamOutDistance)
+                ->Field("ColliderConfig", &HeightFieldTileStreamingConfiguration::m_colliderConfig)
+                ;
+        }
+    }
+
+    HeightFieldTileStreamingComponent::HeightFieldTileStreamingComponent(const HeightFieldTileStreamingConfiguration& configuration)
+        : m_configuration(configuration)
+    {
+    }
+
+    void HeightFieldTileStreamingComponent::Reflect(AZ::ReflectContext* context)
+    {
+        HeightFieldTileStreamingConfiguration::Reflect(context);
+
+        if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<HeightFieldTileStreamingComponent, AZ::Component>()
+                ->Version(1)
+                ->Field("Configuration", &HeightFieldTileStreamingComponent::m_configuration)
+                ;
+        }
+    }
+
+    void HeightFieldTileStreamingComponent::GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided)
+    {
+        provided.push_back(AZ_CRC_CE("PhysXHeightFieldTileStreamingService"));
+    }
+
+    void HeightFieldTileStreamingComponent::GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required)
+    {
+        required.push_back(AZ_CRC("TransformService", 0x8ee22c50));
+    }
+
+    void HeightFieldTileStreamingComponent::GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible)
+    {
+        incompatible.push_back(AZ_CRC_CE("PhysXHeightFieldTileStreamingService"));
+    }
+
+    void HeightFieldTileStreamingComponent::Activate()
+    {
+        AZ::TransformBus::EventResult(m_gridOrigin, GetEntityId(), &AZ::TransformInterface::GetWorldTranslation);
+        Physics::DefaultWorldBus::BroadcastResult(m_attachedSceneHandle, &Physics::DefaultWorldRequests::GetDefaultSceneHandle);
+
+        AZ_Warning("PhysX HeightField Tile Streaming", m_configuration.m_streamOutDistance >= m_configuration.m_streamInDistance,
+            "The stream out distance (%f) is smaller than the stream in distance (%f), tiles will be streamed in and out every update.",
+            m_configuration.m_streamOutDistance, m_configuration.m_streamInDistance);
+
+        m_tileStates.clear();
+        m_tileStates.resize(m_configuration.m_tiles.size());
+
+        HeightFieldTileStreamingRequestBus::Handler::BusConnect(GetEntityId());
+        AZ::TickBus::Handler::BusConnect();
+    }
+
+    void HeightFieldTileStreamingComponent::Deactivate()
+    {
+        AZ::TickBus::Handler::BusDisconnect();
+        HeightFieldTileStreamingRequestBus::Handler::BusDisconnect();
+
+        for (size_t tileIndex = 0; tileIndex < m_tileStates.size(); ++tileIndex)
+        {
+            StreamOutTile(tileIndex);
+        }
+        m_tileStates.clear();
+        AZ::Data::AssetBus::MultiHandler::BusDisconnect();
+    }
+
+    void HeightFieldTileStreamingComponent::SetPointsOfInterest(const AZStd::vector<AZ::Vector3>& pointsOfInterest)
+    {
+        m_pointsOfInterest = pointsOfInterest;
+        m_pointsOfInterestChanged = true;
+    }
+
+    size_t HeightFieldTileStreamingComponent::GetLoadedTileCount() const
+    {
+        return AZStd::count_if(m_tileStates.begin(), m_tileStates.end(),
+            [](const TileState& tileState)
+            {
+                return tileState.m_bodyHandle != AzPhysics::InvalidSimulatedBodyHandle;
+            });
+    }
+
+    void HeightFieldTileStreamingComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        // tiles only need to be streamed when the points of interest move
+        if (!m_pointsOfInterestChanged)
+        {
+            return;
+        }
+        m_pointsOfInterestChanged = false;
+
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Physics);
+
+        for (size_t tileIndex = 0; tileIndex < m_configuration.m_tiles.size(); ++tileIndex)
+        {
+            const float distance = GetDistanceToClosestPointOfInterest(m_configuration.m_tiles[tileIndex]);
+            if (distance <= m_configuration.m_streamInDistance)
+            {
+                StreamInTile(tileIndex);
+            }
+            else if (distance > m_configuration.m_streamOutDistance)
+            {
+                StreamOutTile(tileIndex);
+            }
+        }
+    }
+
+    void HeightFieldTileStreamingComponent::OnAssetReady(AZ::Data::Asset<AZ::Data::AssetData> asset)
+    {
+        AZ::Data::AssetBus::MultiHandler::BusDisconnect(asset.GetId());
+
+        for (size_t tileIndex = 0; tileIndex < m_tileStates.size(); ++tileIndex)
+        {
+            // a tile streamed out while it was loading no longer holds the asset
+            if (m_tileStates[tileIndex].m_asset.GetId() == asset.GetId())
+            {
+                CreateTileBody(tileIndex);
+            }
+        }
+    }
+
+    float HeightFieldTileStreamingComponent::GetDistanceToClosestPointOfInterest(const HeightFieldTile& tile) const
+    {
+        const float tileSize = m_configuration.m_tileSize;
+        const float minX = m_gridOrigin.GetX() + static_cast<float>(tile.m_column) * tileSize;
+        const float minY = m_gridOrigin.GetY() + static_cast<float>(tile.m_row) * tileSize;
+
+        float closestDistanceSq = AZStd::numeric_limits<float>::max();
+        for (const AZ::Vector3& point : m_pointsOfInterest)
+        {
+            const float dx = AZ::GetMax(AZ::GetMax(minX - point.GetX(), point.GetX() - (minX + tileSize)), 0.0f);
+            const float dy = AZ::GetMax(AZ::GetMax(minY - point.GetY(), point.GetY() - (minY + tileSize)), 0.0f);
+            closestDistanceSq = AZStd::min(closestDistanceSq, dx * dx + dy * dy);
+        }
+        return sqrtf(closestDistanceSq);
+    }
+
+    void HeightFieldTileStreamingComponent::StreamInTile(size_t tileIndex)
+    {
+        TileState& tileState = m_tileStates[tileIndex];
+        if (tileState.m_asset.GetId().IsValid())
+        {
+            // already loading or loaded
+            return;
+        }
+
+        const AZ::Data::AssetId assetId = m_configuration.m_tiles[tileIndex].m_asset.GetId();
+        if (!assetId.IsValid())
+        {
+            return;
+        }
+
+        // the asset manager reads the tile through the streamer, the collider is created when the asset is ready
+        tileState.m_asset = AZ::Data::AssetManager::Instance().GetAsset<Pipeline::HeightFieldAsset>(
+            assetId, AZ::Data::AssetLoadBehavior::Default);
+        if (tileState.m_asset.IsReady())
+        {
+            CreateTileBody(tileIndex);
+        }
+        else
+        {
+            AZ::Data::AssetBus::MultiHandler::BusConnect(assetId);
+        }
+    }
+
+    void HeightFieldTileStreamingComponent::StreamOutTile(size_t tileIndex)
+    {
+        TileState& tileState = m_tileStates[tileIndex];
+        if (tileState.m_bodyHandle != AzPhysics::InvalidSimulatedBodyHandle)
+        {
+            if (auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get())
+            {
+                sceneInterface->RemoveSimulatedBody(m_attachedSceneHandle, tileState.m_bodyHandle);
+            }
+            tileState.m_bodyHandle = AzPhysics::InvalidSimulatedBodyHandle;
+        }
+
+        if (tileState.m_asset.GetId().IsValid())
+        {
+            AZ::Data::AssetBus::MultiHandler::BusDisconnect(tileState.m_asset.GetId());
+            tileState.m_asset.Reset();
+        }
+    }
+
+    void HeightFieldTileStreamingComponent::CreateTileBody(size_t tileIndex)
+    {
+        TileState& tileState = m_tileStates[tileIndex];
+        if (tileState.m_bodyHandle != AzPhysics::InvalidSimulatedBodyHandle)
+        {
+            return;
+        }
+
+        physx::PxHeightField* heightField = tileState.m_asset.IsReady() ? tileState.m_asset->GetHeightField() : nullptr;
+        if (!heightField)
+        {
+            AZ_Warning("PhysX HeightField Tile Streaming", false, "Tile %zu has no height field.", tileIndex);
+            return;
+        }
+
+        // PhysX height fields have their rows along x, their columns along z and their heights along y, so the shape is rotated
+        // to put the heights along z. The columns then go along -y, and are offset to cover the tile from its lower y bound.
+        auto colliderConfig = AZStd::make_shared<Physics::ColliderConfiguration>(m_configuration.m_colliderConfig);
+        colliderConfig->m_rotation = AZ::Quaternion::CreateRotationX(AZ::Constants::HalfPi);
+        colliderConfig->m_position = AZ::Vector3::CreateAxisY(
+            static_cast<float>(heightField->getNbColumns() - 1) * m_configuration.m_sampleScale.GetY());
+
+        auto shapeConfig = AZStd::make_shared<Physics::NativeShapeConfiguration>();
+        shapeConfig->m_nativeShapePtr = heightField;
+        shapeConfig->m_nativeShapeScale = m_configuration.m_sampleScale;
+
+        const HeightFieldTile& tile = m_configuration.m_tiles[tileIndex];
+        AzPhysics::StaticRigidBodyConfiguration configuration;
+        configuration.m_position = m_gridOrigin + AZ::Vector3(
+            static_cast<float>(tile.m_column) * m_configuration.m_tileSize,
+            static_cast<float>(tile.m_row) * m_configuration.m_tileSize,
+            0.0f);
+        configuration.m_entityId = GetEntityId();
+        configuration.m_debugName = GetEntity()->GetName();
+        configuration.m_colliderAndShapeData = AzPhysics::ShapeColliderPair(colliderConfig, shapeConfig);
+
+        if (auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get())
+        {
+            tileState.m_bodyHandle = sceneInterface->AddSimulatedBody(m_attachedSceneHandle, &configuration);
+        }
+    }
+} // namespace PhysX
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/Component/Component.h>
+#include <AzCore/Component/TickBus.h>
+#include <AzFramework/Physics/Common/PhysicsTypes.h>
+#include <AzFramework/Physics/Shape.h>
+#include <AzFramework/Physics/ShapeConfiguration.h>
+#include <PhysX/ComponentTypeIds.h>
+#include <PhysX/HeightFieldAsset.h>
+#include <PhysX/HeightFieldTileStreamingBus.h>
+
+namespace PhysX
+{
+    //! A tile of a tiled height field, holding the cooked height field of one cell of the tile grid.
+    struct HeightFieldTile
+    {
+        AZ_TYPE_INFO(HeightFieldTile, "{0E6A2C55-4B8D-4E0F-9C3B-7A1D5F2E8B64}");
+        static void Reflect(AZ::ReflectContext* context);
+
+        AZ::s32 m_column = 0; //!< Index of the tile along the x axis.
+        AZ::s32 m_row = 0; //!< Index of the tile along the y axis.
+        //! Only loaded while a point of interest is close to the tile.
+        AZ::Data::Asset<Pipeline::HeightFieldAsset> m_asset{ AZ::Data::AssetLoadBehavior::NoLoad };
+    };
+
+    //! Configuration of a tiled height field collider.
+    struct HeightFieldTileStreamingConfiguration
+    {
+        AZ_TYPE_INFO(HeightFieldTileStreamingConfiguration, "{8C41F7D2-3E95-4A6B-B1D0-54E2F9A73C18}");
+        static void Reflect(AZ::ReflectContext* context);
+
+        AZStd::vector<HeightFieldTile> m_tiles;
+        float m_tileSize = 256.0f; //!< Size of the tiles along the x and y axes, in meters.
+        //! Distance between samples along the x axis (x), between samples along the y axis (y), and height of one height unit (z).
+        AZ::Vector3 m_sampleScale = AZ::Vector3(1.0f, 1.0f, 0.01f);
+        float m_streamInDistance = 256.0f; //!< Tiles closer than this to a point of interest are streamed in.
+        float m_streamOutDistance = 384.0f; //!< Tiles further than this from all the points of interest are streamed out.
+        Physics::ColliderConfiguration m_colliderConfig; //!< Used for the collider of every tile.
+    };
+
+    //! Streams the colliders of a tiled height field in and out around points of interest, to bound the memory used by the
+    //! collision of large terrains which would otherwise be cooked and loaded as a single shape.
+    //! The tiles are height field assets cooked by the asset pipeline, loaded through the asset manager when a point of interest
+    //! gets close to them and released when all the points of interest are far enough.
+    //! Tile (column, row) covers the square of the tile grid starting at the entity position plus (column, row) * tile size.
+    class HeightFieldTileStreamingComponent
+        : public AZ::Component
+        , public HeightFieldTileStreamingRequestBus::Handler
+        , private AZ::Data::AssetBus::MultiHandler
+        , private AZ::TickBus::Handler
+    {
+    public:
+        AZ_COMPONENT(HeightFieldTileStreamingComponent, HeightFieldTileStreamingComponentTypeId);
+
+        HeightFieldTileStreamingComponent() = default;
+        explicit HeightFieldTileStreamingComponent(const HeightFieldTileStreamingConfiguration& configuration);
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        static void GetProvidedServices(AZ::ComponentDescriptor::DependencyArrayType& provided);
+        static void GetRequiredServices(AZ::ComponentDescriptor::DependencyArrayType& required);
+        static void GetIncompatibleServices(AZ::ComponentDescriptor::DependencyArrayType& incompatible);
+
+        // HeightFieldTileStreamingRequestBus
+        void SetPointsOfInterest(const AZStd::vector<AZ::Vector3>& pointsOfInterest) override;
+        size_t GetLoadedTileCount() const override;
+
+    private:
+        //! Streaming state of a tile, in the same order as the tiles of the configuration.
+        struct TileState
+        {
+            AZ::Data::Asset<Pipeline::HeightFieldAsset> m_asset; //!< Holds the asset while the tile is streamed in.
+            AzPhysics::SimulatedBodyHandle m_bodyHandle = AzPhysics::InvalidSimulatedBodyHandle;
+        };
+
+        // AZ::Component
+        void Activate() override;
+        void Deactivate() override;
+
+        // AZ::TickBus
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+
+        // AZ::Data::AssetBus
+        void OnAssetReady(AZ::Data::Asset<AZ::Data::AssetData> asset) override;
+
+        //! Returns the distance on the xy plane from the tile to the closest point of interest.
+        float GetDistanceToClosestPointOfInterest(const HeightFieldTile& tile) const;
+
+        void StreamInTile(size_t tileIndex);
+        void StreamOutTile(size_t tileIndex);
+        void CreateTileBody(size_t tileIndex);
+
+        HeightFieldTileStreamingConfiguration m_configuration;
+        AZStd::vector<TileState> m_tileStates;
+        AZStd::vector<AZ::Vector3> m_pointsOfInterest;
+        AZ::Vector3 m_gridOrigin = AZ::Vector3::CreateZero();
+        AzPhysics::SceneHandle m_attachedSceneHandle = AzPhysics::InvalidSceneHandle;
+        bool m_pointsOfInterestChanged = false;
+    };
+} // namespace PhysX
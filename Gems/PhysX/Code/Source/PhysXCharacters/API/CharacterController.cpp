@@ -6,7 +6,11 @@
  *
  */
 
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Serialization/EditContext.h>
+#include <AzCore/std/sort.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzFramework/Physics/CollisionBus.h>
 #include <AzFramework/Physics/PhysicsScene.h>
@@ -600,26 +604,102 @@ namespace PhysX
 
     void CharacterController::ApplyRequestedVelocity(float deltaTime)
     {
-        const AZ::Vector3 oldPosition = GetBasePosition();
+        if (m_pxController)
+        {
+            PHYSX_SCENE_WRITE_LOCK(m_pxController->getScene());
+            MoveByRequestedVelocity(deltaTime);
+        }
+
+        m_requestedVelocity = AZ::Vector3::CreateZero();
+    }
+
+    void CharacterController::ApplyRequestedVelocities(const AZStd::vector<CharacterController*>& controllers, float deltaTime)
+    {
+        AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Physics, "CharacterController::ApplyRequestedVelocities");
+
+        // group the controllers by scene, so each scene is locked once
+        AZStd::vector<AZStd::pair<physx::PxScene*, CharacterController*>> sceneControllers;
+        sceneControllers.reserve(controllers.size());
+        for (CharacterController* controller : controllers)
+        {
+            if (controller == nullptr)
+            {
+                continue;
+            }
+            if (controller->m_pxController)
+            {
+                sceneControllers.emplace_back(controller->m_pxController->getScene(), controller);
+            }
+            else
+            {
+                controller->m_requestedVelocity = AZ::Vector3::CreateZero();
+            }
+        }
+        AZStd::sort(sceneControllers.begin(), sceneControllers.end(),
+            [](const auto& lhs, const auto& rhs)
+            {
+                return lhs.first < rhs.first;
+            });
+
+        AZStd::vector<size_t> sceneBegins;
+        for (size_t i = 0; i < sceneControllers.size(); ++i)
+        {
+            if (i == 0 || sceneControllers[i].first != sceneControllers[i - 1].first)
+            {
+                sceneBegins.push_back(i);
+            }
+        }
+        sceneBegins.push_back(sceneControllers.size());
+
+        auto moveSceneControllers = [&sceneControllers, deltaTime](size_t begin, size_t end)
+        {
+            PHYSX_SCENE_WRITE_LOCK(sceneControllers[begin].first);
+            for (size_t i = begin; i < end; ++i)
+            {
+                sceneControllers[i].second->MoveByRequestedVelocity(deltaTime);
+            }
+        };
+
+        const size_t sceneCount = sceneBegins.size() - 1;
+        if (sceneCount == 1)
+        {
+            moveSceneControllers(sceneBegins[0], sceneBegins[1]);
+        }
+        else if (sceneCount > 1)
+        {
+            AZ::JobCompletion jobCompletion;
+            for (size_t sceneIndex = 0; sceneIndex < sceneCount; ++sceneIndex)
+            {
+                AZ::Job* job = AZ::CreateJobFunction(
+                    [&moveSceneControllers, begin = sceneBegins[sceneIndex], end = sceneBegins[sceneIndex + 1]]()
+                    {
+                        AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Physics, "CharacterController::ApplyRequestedVelocities Job");
+                        moveSceneControllers(begin, end);
+                    },
+                    true);
+                job->SetDependent(&jobCompletion);
+                job->Start();
+            }
+            jobCompletion.StartAndWaitForCompletion();
+        }
+    }
+
+    void CharacterController::MoveByRequestedVelocity(float deltaTime)
+    {
+        const AZ::Vector3 oldPosition = PxMathConvertExtended(m_pxController->getFootPosition());
         const AZ::Vector3 clampedVelocity = m_requestedVelocity.GetLength() > m_maximumSpeed
             ? m_maximumSpeed * m_requestedVelocity.GetNormalized()
             : m_requestedVelocity;
         const AZ::Vector3 deltaPosition = clampedVelocity * deltaTime;
 
-        if (m_pxController)
+        m_pxController->move(PxMathConvert(deltaPosition), m_minimumMovementDistance, deltaTime, m_pxControllerFilters);
+
+        const AZ::Vector3 newPosition = PxMathConvertExtended(m_pxController->getFootPosition());
+        if (m_shadowBody)
         {
-            {
-                PHYSX_SCENE_WRITE_LOCK(m_pxController->getScene());
-                m_pxController->move(PxMathConvert(deltaPosition), m_minimumMovementDistance, deltaTime, m_pxControllerFilters);
-                if (m_shadowBody)
-                {
-                    m_shadowBody->SetKinematicTarget(AZ::Transform::CreateTranslation(GetBasePosition()));
-                }
-            }
-            const AZ::Vector3 newPosition = GetBasePosition();
-            m_observedVelocity = deltaTime > 0.0f ? (newPosition - oldPosition) / deltaTime : AZ::Vector3::CreateZero();
+            m_shadowBody->SetKinematicTarget(AZ::Transform::CreateTranslation(newPosition));
         }
-
+        m_observedVelocity = deltaTime > 0.0f ? (newPosition - oldPosition) / deltaTime : AZ::Vector3::CreateZero();
         m_requestedVelocity = AZ::Vector3::CreateZero();
     }
 
@@ -219,7 +219,17 @@ namespace PhysX
         float GetHalfForwardExtent() const;
         void SetHalfForwardExtent(float halfForwardExtent);
 
+        //! Applies the requested velocity of each controller, with the same result as calling ApplyRequestedVelocity on each of them.
+        //! The scene of the controllers is locked once for all its controllers rather than once per controller.
+        //! Moves through the same controller manager can't run concurrently, so the controllers of a scene are moved one after
+        //! the other, but the controllers of different scenes are moved in parallel on the job system.
+        static void ApplyRequestedVelocities(const AZStd::vector<CharacterController*>& controllers, float deltaTime);
+
     private:
+        //! Moves the controller by its requested velocity and clears the request.
+        //! The caller must hold the write lock of the scene and make sure the PhysX controller is valid.
+        void MoveByRequestedVelocity(float deltaTime);
+
         void SetFilterDataAndShape(const Physics::CharacterConfiguration& characterConfig);
         void SetUserData(const Physics::CharacterConfiguration& characterConfig);
         void SetActorName(const AZStd::string& name = "Character Controller");
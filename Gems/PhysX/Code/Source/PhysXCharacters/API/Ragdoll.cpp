@@ -183,6 +183,8 @@ namespace PhysX
             return;
         }
 
+        BuildNodeDrives();
+
         PHYSX_SCENE_WRITE_LOCK(pxScene);
 
         for (size_t nodeIndex = 0; nodeIndex < numNodes; nodeIndex++)
@@ -311,10 +313,17 @@ namespace PhysX
             return;
         }
 
+        if (m_nodeDrives.m_joints.size() != m_nodes.size())
+        {
+            BuildNodeDrives();
+        }
+
+        PHYSX_SCENE_WRITE_LOCK(Internal::GetPxScene(m_sceneOwner));
+
         const size_t numNodes = m_nodes.size();
         for (size_t nodeIndex = 0; nodeIndex < numNodes; nodeIndex++)
         {
-            SetNodeState(nodeIndex, ragdollState[nodeIndex]);
+            SetNodeStateInternal(nodeIndex, ragdollState[nodeIndex]);
         }
     }
 
@@ -354,6 +363,17 @@ namespace PhysX
             return;
         }
 
+        if (m_nodeDrives.m_joints.size() != m_nodes.size())
+        {
+            BuildNodeDrives();
+        }
+
+        PHYSX_SCENE_WRITE_LOCK(Internal::GetPxScene(m_sceneOwner));
+        SetNodeStateInternal(nodeIndex, nodeState);
+    }
+
+    void Ragdoll::SetNodeStateInternal(size_t nodeIndex, const Physics::RagdollNodeState& nodeState)
+    {
         physx::PxRigidDynamic* actor = GetPxRigidDynamic(nodeIndex);
         if (!actor)
         {
@@ -361,8 +381,6 @@ namespace PhysX
             return;
         }
 
-        PHYSX_SCENE_WRITE_LOCK(actor->getScene());
-
         if (nodeState.m_simulationType == Physics::SimulationType::Kinematic)
         {
             actor->setRigidBodyFlag(physx::PxRigidBodyFlag::eKINEMATIC, true);
@@ -375,18 +393,47 @@ namespace PhysX
         {
             actor->setRigidBodyFlag(physx::PxRigidBodyFlag::eKINEMATIC, false);
 
-            if (AzPhysics::Joint* joint = m_nodes[nodeIndex]->GetJoint())
+            if (physx::PxD6Joint* pxJoint = m_nodeDrives.m_joints[nodeIndex])
             {
-                if (physx::PxD6Joint* pxJoint = static_cast<physx::PxD6Joint*>(joint->GetNativePointer()))
+                // setting a drive wakes up the actors, so it is only set when it changes
+                if (m_nodeDrives.m_strengths[nodeIndex] != nodeState.m_strength ||
+                    m_nodeDrives.m_dampingRatios[nodeIndex] != nodeState.m_dampingRatio)
                 {
                     float forceLimit = std::numeric_limits<float>::max();
                     physx::PxD6JointDrive jointDrive = Utils::Characters::CreateD6JointDrive(nodeState.m_strength,
                         nodeState.m_dampingRatio, forceLimit);
                     pxJoint->setDrive(physx::PxD6Drive::eSWING, jointDrive);
                     pxJoint->setDrive(physx::PxD6Drive::eTWIST, jointDrive);
-                    physx::PxQuat targetRotation = pxJoint->getLocalPose(physx::PxJointActorIndex::eACTOR0).q.getConjugate() *
-                        PxMathConvert(nodeState.m_orientation) * pxJoint->getLocalPose(physx::PxJointActorIndex::eACTOR1).q;
-                    pxJoint->setDrivePosition(physx::PxTransform(targetRotation));
+                    m_nodeDrives.m_strengths[nodeIndex] = nodeState.m_strength;
+                    m_nodeDrives.m_dampingRatios[nodeIndex] = nodeState.m_dampingRatio;
+                }
+                physx::PxQuat targetRotation = m_nodeDrives.m_inverseParentLocalRotations[nodeIndex] *
+                    PxMathConvert(nodeState.m_orientation) * m_nodeDrives.m_childLocalRotations[nodeIndex];
+                pxJoint->setDrivePosition(physx::PxTransform(targetRotation));
+            }
+        }
+    }
+
+    void Ragdoll::BuildNodeDrives()
+    {
+        const size_t numNodes = m_nodes.size();
+        m_nodeDrives.m_joints.assign(numNodes, nullptr);
+        m_nodeDrives.m_inverseParentLocalRotations.assign(numNodes, physx::PxQuat(physx::PxIdentity));
+        m_nodeDrives.m_childLocalRotations.assign(numNodes, physx::PxQuat(physx::PxIdentity));
+        m_nodeDrives.m_strengths.assign(numNodes, -1.0f);
+        m_nodeDrives.m_dampingRatios.assign(numNodes, -1.0f);
+
+        PHYSX_SCENE_READ_LOCK(Internal::GetPxScene(m_sceneOwner));
+        for (size_t nodeIndex = 0; nodeIndex < numNodes; nodeIndex++)
+        {
+            if (AzPhysics::Joint* joint = m_nodes[nodeIndex]->GetJoint())
+            {
+                if (physx::PxD6Joint* pxJoint = static_cast<physx::PxD6Joint*>(joint->GetNativePointer()))
+                {
+                    m_nodeDrives.m_joints[nodeIndex] = pxJoint;
+                    m_nodeDrives.m_inverseParentLocalRotations[nodeIndex] =
+                        pxJoint->getLocalPose(physx::PxJointActorIndex::eACTOR0).q.getConjugate();
+                    m_nodeDrives.m_childLocalRotations[nodeIndex] = pxJoint->getLocalPose(physx::PxJointActorIndex::eACTOR1).q;
                 }
             }
         }
@@ -13,6 +13,7 @@
 #include <AzFramework/Physics/Ragdoll.h>
 #include <AzFramework/Physics/Common/PhysicsEvents.h>
 #include <PhysXCharacters/API/RagdollNode.h>
+#include <PxPhysicsAPI.h>
 
 namespace PhysX
 {
@@ -69,9 +70,26 @@ namespace PhysX
         void ApplyQueuedSetState();
         void ApplyQueuedDisableSimulation();
 
+        //! Caches the joint data used to write node states, for all the nodes.
+        void BuildNodeDrives();
+        //! Writes the state of a node. The caller must hold the write lock of the scene and have built the node drives.
+        void SetNodeStateInternal(size_t nodeIndex, const Physics::RagdollNodeState& nodeState);
+
         AZStd::vector<AZStd::unique_ptr<RagdollNode>> m_nodes;
         Physics::ParentIndices m_parentIndices;
         AZ::Outcome<size_t> m_rootIndex = AZ::Failure();
+
+        //! Joint data used to write the drive targets of the nodes, stored as structure of arrays in the same order as the nodes,
+        //! so setting the state of the whole ragdoll doesn't go back to the joint of each node.
+        struct NodeDrives
+        {
+            AZStd::vector<physx::PxD6Joint*> m_joints; //!< Null for nodes without a joint.
+            AZStd::vector<physx::PxQuat> m_inverseParentLocalRotations;
+            AZStd::vector<physx::PxQuat> m_childLocalRotations;
+            AZStd::vector<float> m_strengths; //!< Strength of the drive last set on each joint, negative if none was set.
+            AZStd::vector<float> m_dampingRatios; //!< Damping ratio of the drive last set on each joint.
+        };
+        NodeDrives m_nodeDrives;
         
         /// Queued initial state for the ragdoll, for EnableSimulationQueued, to be applied prior to the world update.
         Physics::RagdollState m_queuedInitialState;
@@ -10,6 +10,7 @@
 #include <AzCore/Component/TransformBus.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <PhysXCharacters/API/CharacterController.h>
 #include <PhysXCharacters/Components/CharacterControllerComponent.h>
@@ -432,13 +433,84 @@ namespace PhysX
         }
     }
 
+    namespace Internal
+    {
+        //! The components that apply their move on the physics tick, and the single handler moving all of them.
+        struct PhysicsTickComponents
+        {
+            AZStd::vector<CharacterControllerComponent*> m_components;
+            AZStd::vector<CharacterController*> m_controllers; //!< Kept to avoid reallocating it every tick.
+            AzPhysics::SystemEvents::OnPresimulateEvent::Handler m_preSimulateHandler;
+        };
+
+        PhysicsTickComponents& GetPhysicsTickComponents()
+        {
+            static PhysicsTickComponents physicsTickComponents;
+            return physicsTickComponents;
+        }
+    } // namespace Internal
+
     void CharacterControllerComponent::OnPreSimulate(float deltaTime)
     {
-        if (auto* controller = GetController())
+        Internal::PhysicsTickComponents& physicsTickComponents = Internal::GetPhysicsTickComponents();
+
+        physicsTickComponents.m_controllers.clear();
+        for (CharacterControllerComponent* component : physicsTickComponents.m_components)
+        {
+            physicsTickComponents.m_controllers.push_back(component->GetController());
+        }
+        CharacterController::ApplyRequestedVelocities(physicsTickComponents.m_controllers, deltaTime);
+
+        for (size_t i = 0; i < physicsTickComponents.m_components.size(); ++i)
         {
-            controller->ApplyRequestedVelocity(deltaTime);
-            const AZ::Vector3 newPosition = controller->GetBasePosition();
-            AZ::TransformBus::Event(GetEntityId(), &AZ::TransformBus::Events::SetWorldTranslation, newPosition);
+            CharacterControllerComponent* component = physicsTickComponents.m_components[i];
+            if (auto* controller = component->GetController())
+            {
+                const AZ::Vector3 newPosition = controller->GetBasePosition();
+                AZ::TransformBus::Event(component->GetEntityId(), &AZ::TransformBus::Events::SetWorldTranslation, newPosition);
+            }
+        }
+    }
+
+    void CharacterControllerComponent::RegisterForPhysicsTick()
+    {
+        Internal::PhysicsTickComponents& physicsTickComponents = Internal::GetPhysicsTickComponents();
+        if (AZStd::find(physicsTickComponents.m_components.begin(), physicsTickComponents.m_components.end(), this) !=
+            physicsTickComponents.m_components.end())
+        {
+            return;
+        }
+
+        physicsTickComponents.m_components.push_back(this);
+        if (!physicsTickComponents.m_preSimulateHandler.IsConnected())
+        {
+            physicsTickComponents.m_preSimulateHandler = AzPhysics::SystemEvents::OnPresimulateEvent::Handler(
+                [](float deltaTime)
+                {
+                    OnPreSimulate(deltaTime);
+                }
+            );
+
+            if (auto* physXSystem = GetPhysXSystem())
+            {
+                physXSystem->RegisterPreSimulateEvent(physicsTickComponents.m_preSimulateHandler);
+            }
+        }
+    }
+
+    void CharacterControllerComponent::UnregisterFromPhysicsTick()
+    {
+        Internal::PhysicsTickComponents& physicsTickComponents = Internal::GetPhysicsTickComponents();
+        auto it = AZStd::find(physicsTickComponents.m_components.begin(), physicsTickComponents.m_components.end(), this);
+        if (it == physicsTickComponents.m_components.end())
+        {
+            return;
+        }
+
+        physicsTickComponents.m_components.erase(it);
+        if (physicsTickComponents.m_components.empty())
+        {
+            physicsTickComponents.m_preSimulateHandler.Disconnect();
         }
     }
 
@@ -521,17 +593,7 @@ namespace PhysX
 
         if (m_characterConfig->m_applyMoveOnPhysicsTick)
         {
-            m_preSimulateHandler = AzPhysics::SystemEvents::OnPresimulateEvent::Handler(
-                [this](float deltaTime)
-                {
-                    OnPreSimulate(deltaTime);
-                }
-            );
-
-            if (auto* physXSystem = GetPhysXSystem())
-            {
-                physXSystem->RegisterPreSimulateEvent(m_preSimulateHandler);
-            }
+            RegisterForPhysicsTick();
         }
     }
 
@@ -554,7 +616,7 @@ namespace PhysX
     {
         m_controllerBodyHandle = AzPhysics::InvalidSimulatedBodyHandle;
         m_attachedSceneHandle = AzPhysics::InvalidSceneHandle;
-        m_preSimulateHandler.Disconnect();
+        UnregisterFromPhysicsTick();
         m_onSimulatedBodyRemovedHandler.Disconnect();
         CharacterControllerRequestBus::Handler::BusDisconnect();
     }
@@ -8,8 +8,11 @@
 #include <Scene/PhysXScene.h>
 
 #include <AzCore/Debug/ProfilerBus.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/std/containers/variant.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzFramework/Physics/Character.h>
 #include <AzFramework/Physics/Collision/CollisionEvents.h>
@@ -41,6 +44,9 @@ namespace PhysX
 
     namespace Internal
     {
+        //! Number of requests a job of QuerySceneBatch runs, smaller batches run on the calling thread.
+        static constexpr size_t SceneQueryBatchJobSize = 32;
+
         physx::PxScene* CreatePxScene(const AzPhysics::SceneConfiguration& config,
             SceneSimulationFilterCallback* filterCallback,
             SceneSimulationEventCallback* simEventCallback)
@@ -244,6 +250,42 @@ namespace PhysX
         }
 
         //helper to perform a ray cast
+        //! Returns true if the request calls back into user code while it runs.
+        bool HasSceneQueryCallbacks(const AzPhysics::SceneQueryRequest* request)
+        {
+            if (const auto* raycastRequest = azdynamic_cast<const AzPhysics::RayCastRequest*>(request))
+            {
+                return raycastRequest->m_filterCallback != nullptr;
+            }
+            if (const auto* shapecastRequest = azdynamic_cast<const AzPhysics::ShapeCastRequest*>(request))
+            {
+                return shapecastRequest->m_filterCallback != nullptr;
+            }
+            if (const auto* overlapRequest = azdynamic_cast<const AzPhysics::OverlapRequest*>(request))
+            {
+                return overlapRequest->m_filterCallback != nullptr || overlapRequest->m_unboundedOverlapHitCallback != nullptr;
+            }
+            return false;
+        }
+
+        //! Copies the request so it can outlive the call issuing it.
+        AZStd::shared_ptr<AzPhysics::SceneQueryRequest> CloneSceneQueryRequest(const AzPhysics::SceneQueryRequest* request)
+        {
+            if (const auto* raycastRequest = azdynamic_cast<const AzPhysics::RayCastRequest*>(request))
+            {
+                return AZStd::make_shared<AzPhysics::RayCastRequest>(*raycastRequest);
+            }
+            if (const auto* shapecastRequest = azdynamic_cast<const AzPhysics::ShapeCastRequest*>(request))
+            {
+                return AZStd::make_shared<AzPhysics::ShapeCastRequest>(*shapecastRequest);
+            }
+            if (const auto* overlapRequest = azdynamic_cast<const AzPhysics::OverlapRequest*>(request))
+            {
+                return AZStd::make_shared<AzPhysics::OverlapRequest>(*overlapRequest);
+            }
+            return nullptr;
+        }
+
         AzPhysics::SceneQueryHits RayCast(const AzPhysics::RayCastRequest* raycastRequest,
             AZStd::vector<physx::PxRaycastHit>& raycastBuffer,
             physx::PxScene* physxScene,
@@ -493,6 +535,13 @@ namespace PhysX
     {
         m_physicsSystemConfigChanged.Disconnect();
 
+        // The async query jobs use the scene, the results that weren't dispatched yet are dropped
+        while (m_asyncQueriesInFlight > 0)
+        {
+            AZStd::this_thread::yield();
+        }
+        m_asyncQueryResults.clear();
+
         s_overlapBuffer.swap({});
         s_rayCastBuffer.swap({});
         s_sweepBuffer.swap({});
@@ -543,6 +592,8 @@ namespace PhysX
 
         m_currentDeltaTime = deltatime;
 
+        DispatchAsyncQueryResults();
+
         PHYSX_SCENE_WRITE_LOCK(m_pxScene);
         m_pxScene->simulate(deltatime);
     }
@@ -600,6 +651,7 @@ namespace PhysX
 
         FlushQueuedEvents();
         ClearDeferedDeletions();
+        DispatchAsyncQueryResults();
 
         {
             AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Physics, "OnSceneSimulationFinishedEvent::Signaled");
@@ -647,78 +699,112 @@ namespace PhysX
 
     AzPhysics::SimulatedBodyHandle PhysXScene::AddSimulatedBody(const AzPhysics::SimulatedBodyConfiguration* simulatedBodyConfig)
     {
-        AzPhysics::SimulatedBody* newBody = nullptr;
         AZ::Crc32 newBodyCrc;
-        if (azrtti_istypeof<AzPhysics::RigidBodyConfiguration>(simulatedBodyConfig))
+        AzPhysics::SimulatedBody* newBody = CreateSimulatedBodyInternal(simulatedBodyConfig, newBodyCrc);
+        if (newBody == nullptr)
         {
-            newBody = Internal::CreateRigidBody(
-                azdynamic_cast<const AzPhysics::RigidBodyConfiguration*>(simulatedBodyConfig), newBodyCrc);
-        }
-        else if (azrtti_istypeof<AzPhysics::StaticRigidBodyConfiguration>(simulatedBodyConfig))
-        {
-            newBody = Internal::CreateSimulatedBody<StaticRigidBody, AzPhysics::StaticRigidBodyConfiguration>(
-                azdynamic_cast<const AzPhysics::StaticRigidBodyConfiguration*>(simulatedBodyConfig), newBodyCrc);
-        }
-        else if (azrtti_istypeof<Physics::CharacterConfiguration>(simulatedBodyConfig))
-        {
-            newBody = Internal::CreateCharacterBody(this, azdynamic_cast<const Physics::CharacterConfiguration*>(simulatedBodyConfig));
+            return AzPhysics::InvalidSimulatedBodyHandle;
         }
-        else if (azrtti_istypeof<Physics::RagdollConfiguration>(simulatedBodyConfig))
+
+        const AzPhysics::SimulatedBodyHandle newBodyHandle = RegisterSimulatedBodyInternal(newBody, newBodyCrc);
+
+        // Enable simulation by default (not signaling OnSimulationBodySimulationEnabled event)
+        if (simulatedBodyConfig->m_startSimulationEnabled)
         {
-            newBody = Internal::CreateRagdollBody(this, azdynamic_cast<const Physics::RagdollConfiguration*>(simulatedBodyConfig));
+            EnableSimulationOfBodyInternal(*newBody);
         }
-        else
+
+        return newBodyHandle;
+    }
+
+    AzPhysics::SimulatedBodyHandleList PhysXScene::AddSimulatedBodies(const AzPhysics::SimulatedBodyConfigurationList& simulatedBodyConfigs)
+    {
+        AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Physics, "PhysXScene::AddSimulatedBodies");
+
+        AzPhysics::SimulatedBodyHandleList newBodyHandles;
+        newBodyHandles.reserve(simulatedBodyConfigs.size());
+
+        const size_t freeSlotCount = m_freeSceneSlots.size();
+        if (simulatedBodyConfigs.size() > freeSlotCount)
         {
-            AZ_Warning("PhysXScene", false, "Unknown SimulatedBodyConfiguration.");
-            return AzPhysics::InvalidSimulatedBodyHandle;
+            m_simulatedBodies.reserve(m_simulatedBodies.size() + simulatedBodyConfigs.size() - freeSlotCount);
         }
 
-        if (newBody != nullptr)
+        // The bodies that start simulating are added to the PhysX scene together once they are all created
+        AZStd::vector<AzPhysics::SimulatedBody*> bodiesToEnable;
+        bodiesToEnable.reserve(simulatedBodyConfigs.size());
+        for (auto* config : simulatedBodyConfigs)
         {
-            AzPhysics::SimulatedBodyIndex index;
-
-            if (m_freeSceneSlots.empty())
+            AZ::Crc32 newBodyCrc;
+            AzPhysics::SimulatedBody* newBody = CreateSimulatedBodyInternal(config, newBodyCrc);
+            if (newBody == nullptr)
             {
-                m_simulatedBodies.emplace_back(newBodyCrc, newBody);
-                index = m_simulatedBodies.size() - 1;
+                newBodyHandles.emplace_back(AzPhysics::InvalidSimulatedBodyHandle);
+                continue;
             }
-            else
-            {
-                //fill any free slots first before increasing the size of the simulatedBodies vector.
-                index = m_freeSceneSlots.front();
-                m_freeSceneSlots.pop();
-                AZ_Assert(index < m_simulatedBodies.size(), "PhysXScene::AddSimulatedBody: Free simulated body index is out of bounds");
-                AZ_Assert(m_simulatedBodies[index].second == nullptr, "PhysXScene::AddSimulatedBody: Free simulated body index is not free");
-
-                m_simulatedBodies[index] = AZStd::make_pair(newBodyCrc, newBody);
-            }
-
-            const AzPhysics::SimulatedBodyHandle newBodyHandle(newBodyCrc, index);
-            newBody->m_sceneOwner = m_sceneHandle;
-            newBody->m_bodyHandle = newBodyHandle;
-            m_simulatedBodyAddedEvent.Signal(m_sceneHandle, newBodyHandle);
 
-            // Enable simulation by default (not signaling OnSimulationBodySimulationEnabled event)
-            if (simulatedBodyConfig->m_startSimulationEnabled)
+            newBodyHandles.emplace_back(RegisterSimulatedBodyInternal(newBody, newBodyCrc));
+            if (config->m_startSimulationEnabled)
             {
-                EnableSimulationOfBodyInternal(*newBody);
+                bodiesToEnable.push_back(newBody);
             }
+        }
 
-            return newBodyHandle;
+        EnableSimulationOfBodiesInternal(bodiesToEnable);
+        return newBodyHandles;
+    }
+
+    AzPhysics::SimulatedBody* PhysXScene::CreateSimulatedBodyInternal(const AzPhysics::SimulatedBodyConfiguration* simulatedBodyConfig, AZ::Crc32& crc)
+    {
+        if (azrtti_istypeof<AzPhysics::RigidBodyConfiguration>(simulatedBodyConfig))
+        {
+            return Internal::CreateRigidBody(
+                azdynamic_cast<const AzPhysics::RigidBodyConfiguration*>(simulatedBodyConfig), crc);
+        }
+        else if (azrtti_istypeof<AzPhysics::StaticRigidBodyConfiguration>(simulatedBodyConfig))
+        {
+            return Internal::CreateSimulatedBody<StaticRigidBody, AzPhysics::StaticRigidBodyConfiguration>(
+                azdynamic_cast<const AzPhysics::StaticRigidBodyConfiguration*>(simulatedBodyConfig), crc);
+        }
+        else if (azrtti_istypeof<Physics::CharacterConfiguration>(simulatedBodyConfig))
+        {
+            return Internal::CreateCharacterBody(this, azdynamic_cast<const Physics::CharacterConfiguration*>(simulatedBodyConfig));
+        }
+        else if (azrtti_istypeof<Physics::RagdollConfiguration>(simulatedBodyConfig))
+        {
+            return Internal::CreateRagdollBody(this, azdynamic_cast<const Physics::RagdollConfiguration*>(simulatedBodyConfig));
         }
 
-        return AzPhysics::InvalidSimulatedBodyHandle;
+        AZ_Warning("PhysXScene", false, "Unknown SimulatedBodyConfiguration.");
+        return nullptr;
     }
 
-    AzPhysics::SimulatedBodyHandleList PhysXScene::AddSimulatedBodies(const AzPhysics::SimulatedBodyConfigurationList& simulatedBodyConfigs)
+    AzPhysics::SimulatedBodyHandle PhysXScene::RegisterSimulatedBodyInternal(AzPhysics::SimulatedBody* newBody, AZ::Crc32 newBodyCrc)
     {
-        AzPhysics::SimulatedBodyHandleList newBodyHandles;
-        newBodyHandles.reserve(simulatedBodyConfigs.size());
-        for (auto* config : simulatedBodyConfigs)
+        AzPhysics::SimulatedBodyIndex index;
+
+        if (m_freeSceneSlots.empty())
         {
-            newBodyHandles.emplace_back(AddSimulatedBody(config));
+            m_simulatedBodies.emplace_back(newBodyCrc, newBody);
+            index = m_simulatedBodies.size() - 1;
         }
-        return newBodyHandles;
+        else
+        {
+            //fill any free slots first before increasing the size of the simulatedBodies vector.
+            index = m_freeSceneSlots.front();
+            m_freeSceneSlots.pop();
+            AZ_Assert(index < m_simulatedBodies.size(), "PhysXScene::AddSimulatedBody: Free simulated body index is out of bounds");
+            AZ_Assert(m_simulatedBodies[index].second == nullptr, "PhysXScene::AddSimulatedBody: Free simulated body index is not free");
+
+            m_simulatedBodies[index] = AZStd::make_pair(newBodyCrc, newBody);
+        }
+
+        const AzPhysics::SimulatedBodyHandle newBodyHandle(newBodyCrc, index);
+        newBody->m_sceneOwner = m_sceneHandle;
+        newBody->m_bodyHandle = newBodyHandle;
+        m_simulatedBodyAddedEvent.Signal(m_sceneHandle, newBodyHandle);
+
+        return newBodyHandle;
     }
 
     AzPhysics::SimulatedBody* PhysXScene::GetSimulatedBodyFromHandle(AzPhysics::SimulatedBodyHandle bodyHandle)
@@ -776,6 +862,23 @@ namespace PhysX
 
     void PhysXScene::RemoveSimulatedBodies(AzPhysics::SimulatedBodyHandleList& bodyHandles)
     {
+        AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Physics, "PhysXScene::RemoveSimulatedBodies");
+
+        m_deferredDeletions.reserve(m_deferredDeletions.size() + bodyHandles.size());
+
+        // The simulating bodies are removed from the PhysX scene together before their removal is signaled
+        AZStd::vector<AzPhysics::SimulatedBody*> bodiesToDisable;
+        bodiesToDisable.reserve(bodyHandles.size());
+        for (const auto& handle : bodyHandles)
+        {
+            AzPhysics::SimulatedBody* body = GetSimulatedBodyFromHandle(handle);
+            if (body != nullptr && body->m_simulating)
+            {
+                bodiesToDisable.push_back(body);
+            }
+        }
+        DisableSimulationOfBodiesInternal(bodiesToDisable);
+
         for (auto& handle: bodyHandles)
         {
             RemoveSimulatedBody(handle);
@@ -949,27 +1052,137 @@ namespace PhysX
 
     AzPhysics::SceneQueryHitsList PhysXScene::QuerySceneBatch(const AzPhysics::SceneQueryRequests& requests)
     {
-        AzPhysics::SceneQueryHitsList results;
-        results.reserve(requests.size());
-        for (auto& request : requests)
+        AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Physics, "PhysXScene::QuerySceneBatch");
+
+        // Every request writes the result at its own index, so the jobs never share anything but the scene,
+        // which each query read locks. The hit buffers are thread local.
+        AzPhysics::SceneQueryHitsList results(requests.size());
+
+        // Requests with callbacks run on the calling thread, the callbacks don't expect to be called from job threads.
+        AZStd::vector<size_t> parallelRequestIndices;
+        parallelRequestIndices.reserve(requests.size());
+        for (size_t requestIndex = 0; requestIndex < requests.size(); ++requestIndex)
+        {
+            if (Internal::HasSceneQueryCallbacks(requests[requestIndex].get()))
+            {
+                results[requestIndex] = QueryScene(requests[requestIndex].get());
+            }
+            else
+            {
+                parallelRequestIndices.push_back(requestIndex);
+            }
+        }
+
+        if (parallelRequestIndices.size() <= Internal::SceneQueryBatchJobSize)
+        {
+            for (const size_t requestIndex : parallelRequestIndices)
+            {
+                results[requestIndex] = QueryScene(requests[requestIndex].get());
+            }
+            return results;
+        }
+
+        AZ::JobCompletion jobCompletion;
+        for (size_t first = 0; first < parallelRequestIndices.size(); first += Internal::SceneQueryBatchJobSize)
         {
-            results.emplace_back(QueryScene(request.get()));
+            const size_t last = AZStd::min(first + Internal::SceneQueryBatchJobSize, parallelRequestIndices.size());
+            AZ::Job* job = AZ::CreateJobFunction(
+                [this, &requests, &results, &parallelRequestIndices, first, last]()
+                {
+                    AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Physics, "PhysXScene::QuerySceneBatch Job");
+                    for (size_t i = first; i < last; ++i)
+                    {
+                        const size_t requestIndex = parallelRequestIndices[i];
+                        results[requestIndex] = QueryScene(requests[requestIndex].get());
+                    }
+                },
+                true);
+            job->SetDependent(&jobCompletion);
+            job->Start();
         }
+        jobCompletion.StartAndWaitForCompletion();
         return results;
     }
 
-    [[nodiscard]] bool PhysXScene::QuerySceneAsync([[maybe_unused]] AzPhysics::SceneQuery::AsyncRequestId requestId,
-        [[maybe_unused]] const AzPhysics::SceneQueryRequest* request, [[maybe_unused]] AzPhysics::SceneQuery::AsyncCallback callback)
+    [[nodiscard]] bool PhysXScene::QuerySceneAsync(AzPhysics::SceneQuery::AsyncRequestId requestId,
+        const AzPhysics::SceneQueryRequest* request, AzPhysics::SceneQuery::AsyncCallback callback)
+    {
+        AZStd::shared_ptr<AzPhysics::SceneQueryRequest> requestCopy = Internal::CloneSceneQueryRequest(request);
+        if (requestCopy == nullptr || !callback)
+        {
+            AZ_Warning("Physx", false, "QuerySceneAsync requires a valid request and callback.");
+            return false;
+        }
+
+        StartAsyncQuery(
+            [this, requestId, requestCopy, callback]() -> AZStd::function<void()>
+            {
+                return [requestId, callback, hits = QueryScene(requestCopy.get())]() mutable
+                {
+                    callback(requestId, AZStd::move(hits));
+                };
+            });
+        return true;
+    }
+
+    [[nodiscard]] bool PhysXScene::QuerySceneAsyncBatch(AzPhysics::SceneQuery::AsyncRequestId requestId,
+        const AzPhysics::SceneQueryRequests& requests, AzPhysics::SceneQuery::AsyncBatchCallback callback)
+    {
+        if (!callback)
+        {
+            AZ_Warning("Physx", false, "QuerySceneAsyncBatch requires a valid callback.");
+            return false;
+        }
+
+        AzPhysics::SceneQueryRequests requestsCopy;
+        requestsCopy.reserve(requests.size());
+        for (const auto& request : requests)
+        {
+            requestsCopy.emplace_back(Internal::CloneSceneQueryRequest(request.get()));
+        }
+
+        StartAsyncQuery(
+            [this, requestId, requestsCopy = AZStd::move(requestsCopy), callback]() -> AZStd::function<void()>
+            {
+                return [requestId, callback, hits = QuerySceneBatch(requestsCopy)]() mutable
+                {
+                    callback(requestId, AZStd::move(hits));
+                };
+            });
+        return true;
+    }
+
+    void PhysXScene::StartAsyncQuery(AZStd::function<AZStd::function<void()>()> query)
     {
-        AZ_Warning("Physx", false, "Currently unimplemented."); // LYN-2306
-        return false;
+        ++m_asyncQueriesInFlight;
+        AZ::Job* job = AZ::CreateJobFunction(
+            [this, query = AZStd::move(query)]()
+            {
+                AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::Physics, "PhysXScene::AsyncQuery");
+                AZStd::function<void()> dispatchResult = query();
+                {
+                    AZStd::lock_guard<AZStd::mutex> lock(m_asyncQueryResultsMutex);
+                    m_asyncQueryResults.emplace_back(AZStd::move(dispatchResult));
+                }
+                --m_asyncQueriesInFlight;
+            },
+            true);
+        job->Start();
     }
 
-    [[nodiscard]] bool PhysXScene::QuerySceneAsyncBatch([[maybe_unused]] AzPhysics::SceneQuery::AsyncRequestId requestId,
-        [[maybe_unused]] const AzPhysics::SceneQueryRequests& requests, [[maybe_unused]] AzPhysics::SceneQuery::AsyncBatchCallback callback)
+    void PhysXScene::DispatchAsyncQueryResults()
     {
-        AZ_Warning("Physx", false, "Currently unimplemented."); // LYN-2306
-        return false;
+        AZStd::vector<AZStd::function<void()>> results;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_asyncQueryResultsMutex);
+            results.swap(m_asyncQueryResults);
+        }
+
+        // The callbacks can issue new async queries
+        for (auto& dispatchResult : results)
+        {
+            dispatchResult();
+        }
     }
 
     void PhysXScene::SuppressCollisionEvents(
@@ -1058,6 +1271,65 @@ namespace PhysX
         body.m_simulating = false;
     }
 
+    void PhysXScene::EnableSimulationOfBodiesInternal(const AZStd::vector<AzPhysics::SimulatedBody*>& bodies)
+    {
+        AZStd::vector<physx::PxActor*> pxActors;
+        pxActors.reserve(bodies.size());
+        for (AzPhysics::SimulatedBody* body : bodies)
+        {
+            //character controller is a special actor and only needs the m_simulating flag set,
+            if (!azrtti_istypeof<PhysX::CharacterController>(body) &&
+                !azrtti_istypeof<PhysX::Ragdoll>(body))
+            {
+                auto pxActor = static_cast<physx::PxActor*>(body->GetNativePointer());
+                AZ_Assert(pxActor, "Simulated Body doesn't have a valid physx actor");
+                pxActors.push_back(pxActor);
+            }
+        }
+
+        if (!pxActors.empty())
+        {
+            PHYSX_SCENE_WRITE_LOCK(m_pxScene);
+            m_pxScene->addActors(pxActors.data(), aznumeric_cast<physx::PxU32>(pxActors.size()));
+        }
+
+        for (AzPhysics::SimulatedBody* body : bodies)
+        {
+            if (auto rigidBody = azdynamic_cast<PhysX::RigidBody*>(body))
+            {
+                if (rigidBody->ShouldStartAsleep())
+                {
+                    rigidBody->ForceAsleep();
+                }
+            }
+            body->m_simulating = true;
+        }
+    }
+
+    void PhysXScene::DisableSimulationOfBodiesInternal(const AZStd::vector<AzPhysics::SimulatedBody*>& bodies)
+    {
+        AZStd::vector<physx::PxActor*> pxActors;
+        pxActors.reserve(bodies.size());
+        for (AzPhysics::SimulatedBody* body : bodies)
+        {
+            //character controller is a special actor and only needs the m_simulating flag set,
+            if (!azrtti_istypeof<PhysX::CharacterController>(body) &&
+                !azrtti_istypeof<PhysX::Ragdoll>(body))
+            {
+                auto pxActor = static_cast<physx::PxActor*>(body->GetNativePointer());
+                AZ_Assert(pxActor, "Simulated Body doesn't have a valid physx actor");
+                pxActors.push_back(pxActor);
+            }
+            body->m_simulating = false;
+        }
+
+        if (!pxActors.empty())
+        {
+            PHYSX_SCENE_WRITE_LOCK(m_pxScene);
+            m_pxScene->removeActors(pxActors.data(), aznumeric_cast<physx::PxU32>(pxActors.size()));
+        }
+    }
+
     physx::PxControllerManager* PhysXScene::GetOrCreateControllerManager()
     {
         if (m_controllerManager)
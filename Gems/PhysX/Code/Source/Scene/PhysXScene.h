@@ -13,6 +13,10 @@
 #include <AzFramework/Physics/Common/PhysicsSimulatedBody.h>
 #include <AzFramework/Physics/Configuration/SceneConfiguration.h>
 
+#include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+
 #include <Scene/PhysXSceneSimulationEventCallback.h>
 #include <Scene/PhysXSceneSimulationFilterCallback.h>
 
@@ -59,6 +63,9 @@ namespace PhysX
         void RemoveJoint(AzPhysics::JointHandle jointHandle) override;
         AzPhysics::SceneQueryHits QueryScene(const AzPhysics::SceneQueryRequest* request) override;
         AzPhysics::SceneQueryHitsList QuerySceneBatch(const AzPhysics::SceneQueryRequests& requests) override;
+        //! Async queries run on a job against the scene query structures of the last completed step, so they can be issued
+        //! while the scene simulates. Their filter callbacks are invoked from the job, and their result callbacks are invoked
+        //! from StartSimulation and FinishSimulation, on the thread simulating the scene.
         [[nodiscard]] bool QuerySceneAsync(AzPhysics::SceneQuery::AsyncRequestId requestId,
             const AzPhysics::SceneQueryRequest* request, AzPhysics::SceneQuery::AsyncCallback callback) override;
         [[nodiscard]] bool QuerySceneAsyncBatch(AzPhysics::SceneQuery::AsyncRequestId requestId,
@@ -80,8 +87,17 @@ namespace PhysX
         physx::PxControllerManager* GetOrCreateControllerManager();
 
     private:
+        AzPhysics::SimulatedBody* CreateSimulatedBodyInternal(const AzPhysics::SimulatedBodyConfiguration* simulatedBodyConfig, AZ::Crc32& crc);
+        //! Stores the body in a free slot of the scene and signals that it was added.
+        AzPhysics::SimulatedBodyHandle RegisterSimulatedBodyInternal(AzPhysics::SimulatedBody* newBody, AZ::Crc32 newBodyCrc);
+
         void EnableSimulationOfBodyInternal(AzPhysics::SimulatedBody& body);
         void DisableSimulationOfBodyInternal(AzPhysics::SimulatedBody& body);
+        //! Same as EnableSimulationOfBodyInternal and DisableSimulationOfBodyInternal, with a single PhysX scene update for all the bodies.
+        //! @{
+        void EnableSimulationOfBodiesInternal(const AZStd::vector<AzPhysics::SimulatedBody*>& bodies);
+        void DisableSimulationOfBodiesInternal(const AZStd::vector<AzPhysics::SimulatedBody*>& bodies);
+        //! @}
 
         void FlushQueuedEvents();
         void ClearDeferedDeletions();
@@ -90,6 +106,10 @@ namespace PhysX
 
         void UpdateAzProfilerDataPoints();
 
+        //! Runs the query on a job. The query returns the function invoking the result callback, which is queued for DispatchAsyncQueryResults.
+        void StartAsyncQuery(AZStd::function<AZStd::function<void()>()> query);
+        void DispatchAsyncQueryResults();
+
         bool m_isEnabled = true;
         AzPhysics::SceneConfiguration m_config;
         AzPhysics::SceneHandle m_sceneHandle;
@@ -112,6 +132,10 @@ namespace PhysX
         AZ::u64 m_shapecastBufferSize = 32; //!< Maximum number of hits that can be returned from a shapecast.
         AZ::u64 m_overlapBufferSize = 32; //!< Maximum number of overlaps that can be returned from an overlap query.
 
+        AZStd::mutex m_asyncQueryResultsMutex;
+        AZStd::vector<AZStd::function<void()>> m_asyncQueryResults; //!< Result callbacks of the completed async queries, guarded by m_asyncQueryResultsMutex.
+        AZStd::atomic_int m_asyncQueriesInFlight{ 0 }; //!< Number of async query jobs that didn't complete yet.
+
         SceneSimulationFilterCallback m_collisionFilterCallback; //!< Handles the filtering of collision pairs reported from PhysX.
         SceneSimulationEventCallback m_simulationEventCallback; //!< Handles the collision and trigger events reported from PhysX.
         physx::PxScene* m_pxScene = nullptr; //!< The physx scene
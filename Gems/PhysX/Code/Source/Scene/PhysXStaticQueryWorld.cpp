@@ -0,0 +1,332 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <Scene/PhysXStaticQueryWorld.h>
+
+#include <AzCore/std/sort.h>
+#include <AzFramework/Physics/Shape.h>
+
+#include <Common/PhysXSceneQueryHelpers.h>
+#include <PhysX/MathConversion.h>
+#include <System/PhysXSystem.h>
+#include <Utils.h>
+
+namespace PhysX
+{
+    namespace Internal
+    {
+        //! A hit, and whether it blocks the query, as decided by the filter callback of the request.
+        struct StaticQueryHit
+        {
+            AzPhysics::SceneQueryHit m_hit;
+            bool m_isBlocking = true;
+        };
+
+        AzPhysics::SceneQueryHit GetHitFromPxLocationHit(const physx::PxLocationHit& pxHit, Physics::Shape* shape, AZ::EntityId entityId)
+        {
+            AzPhysics::SceneQueryHit hit;
+
+            hit.m_distance = pxHit.distance;
+            hit.m_resultFlags |= AzPhysics::SceneQuery::ResultFlags::Distance;
+
+            if (pxHit.flags & physx::PxHitFlag::ePOSITION)
+            {
+                hit.m_position = PxMathConvert(pxHit.position);
+                hit.m_resultFlags |= AzPhysics::SceneQuery::ResultFlags::Position;
+            }
+
+            if (pxHit.flags & physx::PxHitFlag::eNORMAL)
+            {
+                hit.m_normal = PxMathConvert(pxHit.normal);
+                hit.m_resultFlags |= AzPhysics::SceneQuery::ResultFlags::Normal;
+            }
+
+            hit.m_entityId = entityId;
+            if (hit.m_entityId.IsValid())
+            {
+                hit.m_resultFlags |= AzPhysics::SceneQuery::ResultFlags::EntityId;
+            }
+
+            hit.m_shape = shape;
+            hit.m_resultFlags |= AzPhysics::SceneQuery::ResultFlags::Shape;
+
+            hit.m_material = shape->GetMaterial().get();
+            if (hit.m_material != nullptr)
+            {
+                hit.m_resultFlags |= AzPhysics::SceneQuery::ResultFlags::Material;
+            }
+
+            return hit;
+        }
+
+        //! Sorts the hits by distance, then keeps the hits up to the first blocking one and at most maxResults of them,
+        //! or only the closest hit when the request doesn't report multiple hits.
+        AzPhysics::SceneQueryHits ResolveHits(AZStd::vector<StaticQueryHit>& hits, bool reportMultipleHits, AZ::u64 maxResults)
+        {
+            AZStd::sort(hits.begin(), hits.end(),
+                [](const StaticQueryHit& lhs, const StaticQueryHit& rhs)
+                {
+                    return lhs.m_hit.m_distance < rhs.m_hit.m_distance;
+                });
+
+            AzPhysics::SceneQueryHits results;
+            const size_t resultCount = reportMultipleHits ? aznumeric_cast<size_t>(maxResults) : 1;
+            for (const StaticQueryHit& hit : hits)
+            {
+                if (results.m_hits.size() >= resultCount)
+                {
+                    break;
+                }
+                results.m_hits.push_back(hit.m_hit);
+                if (hit.m_isBlocking)
+                {
+                    break;
+                }
+            }
+            return results;
+        }
+
+        //! Returns the indices of the entries whose bounds the query crosses, in a buffer reused by the queries of the thread.
+        template<typename BvhQuery>
+        AZStd::vector<physx::PxU32>& GetCandidates(size_t entryCount, BvhQuery&& bvhQuery)
+        {
+            static thread_local AZStd::vector<physx::PxU32> candidates;
+            candidates.resize(entryCount);
+            const physx::PxU32 candidateCount = bvhQuery(aznumeric_cast<physx::PxU32>(entryCount), candidates.data());
+            candidates.resize(candidateCount);
+            return candidates;
+        }
+    } // namespace Internal
+
+    AZStd::shared_ptr<const StaticQueryWorld> StaticQueryWorld::Create(const AZStd::vector<ShapeDesc>& shapeDescs)
+    {
+        AZStd::shared_ptr<StaticQueryWorld> world(aznew StaticQueryWorld());
+        world->m_entries.reserve(shapeDescs.size());
+
+        AZStd::vector<physx::PxBounds3> bounds;
+        bounds.reserve(shapeDescs.size());
+        for (const ShapeDesc& shapeDesc : shapeDescs)
+        {
+            auto* pxShape = shapeDesc.m_shape ? static_cast<physx::PxShape*>(shapeDesc.m_shape->GetNativePointer()) : nullptr;
+            if (pxShape == nullptr)
+            {
+                AZ_Warning("PhysX", false, "StaticQueryWorld::Create: Skipping a shape without PhysX shape.");
+                continue;
+            }
+
+            Entry entry;
+            entry.m_shape = shapeDesc.m_shape;
+            entry.m_geometry = pxShape->getGeometry();
+            entry.m_pose = PxMathConvert(shapeDesc.m_worldTransform) * pxShape->getLocalPose();
+            entry.m_collisionLayer = shapeDesc.m_shape->GetCollisionLayer();
+            entry.m_entityId = shapeDesc.m_entityId;
+
+            bounds.push_back(physx::PxGeometryQuery::getWorldBounds(entry.m_geometry.any(), entry.m_pose));
+            world->m_entries.emplace_back(AZStd::move(entry));
+        }
+
+        if (!world->m_entries.empty())
+        {
+            physx::PxBVHStructureDesc bvhStructureDesc;
+            bvhStructureDesc.bounds.count = aznumeric_cast<physx::PxU32>(bounds.size());
+            bvhStructureDesc.bounds.stride = sizeof(physx::PxBounds3);
+            bvhStructureDesc.bounds.data = bounds.data();
+
+            PhysXSystem* physXSystem = GetPhysXSystem();
+            world->m_bvhStructure = physXSystem->GetPxCooking()->createBVHStructure(
+                bvhStructureDesc, physXSystem->GetPxPhysics()->getPhysicsInsertionCallback());
+            if (world->m_bvhStructure == nullptr)
+            {
+                AZ_Error("PhysX", false, "StaticQueryWorld::Create: Unable to build the bounding volume hierarchy of %zu shapes.", bounds.size());
+                return nullptr;
+            }
+        }
+
+        return world;
+    }
+
+    StaticQueryWorld::~StaticQueryWorld()
+    {
+        if (m_bvhStructure)
+        {
+            m_bvhStructure->release();
+            m_bvhStructure = nullptr;
+        }
+    }
+
+    AzPhysics::SceneQueryHits StaticQueryWorld::QueryWorld(const AzPhysics::SceneQueryRequest* request) const
+    {
+        // The world only has static shapes
+        if (request == nullptr || m_bvhStructure == nullptr || request->m_queryType == AzPhysics::SceneQuery::QueryType::Dynamic)
+        {
+            return {};
+        }
+
+        if (const auto* raycastRequest = azdynamic_cast<const AzPhysics::RayCastRequest*>(request))
+        {
+            return RayCast(*raycastRequest);
+        }
+        if (const auto* shapecastRequest = azdynamic_cast<const AzPhysics::ShapeCastRequest*>(request))
+        {
+            return ShapeCast(*shapecastRequest);
+        }
+        if (const auto* overlapRequest = azdynamic_cast<const AzPhysics::OverlapRequest*>(request))
+        {
+            return Overlap(*overlapRequest);
+        }
+
+        AZ_Warning("PhysX", false, "Unknown Scene Query request type.");
+        return {};
+    }
+
+    size_t StaticQueryWorld::GetShapeCount() const
+    {
+        return m_entries.size();
+    }
+
+    AzPhysics::SceneQueryHits StaticQueryWorld::RayCast(const AzPhysics::RayCastRequest& request) const
+    {
+        const physx::PxVec3 start = PxMathConvert(request.m_start);
+        const physx::PxVec3 unitDir = PxMathConvert(request.m_direction.GetNormalized());
+        const physx::PxHitFlags hitFlags = SceneQueryHelpers::GetPxHitFlags(request.m_hitFlags);
+
+        const AZStd::vector<physx::PxU32>& candidates = Internal::GetCandidates(m_entries.size(),
+            [this, &start, &unitDir, &request](physx::PxU32 maxHits, physx::PxU32* hits)
+            {
+                return m_bvhStructure->raycast(start, unitDir, request.m_distance, maxHits, hits);
+            });
+
+        AZStd::vector<Internal::StaticQueryHit> hits;
+        for (const physx::PxU32 candidate : candidates)
+        {
+            const Entry& entry = m_entries[candidate];
+            if (!request.m_collisionGroup.IsSet(entry.m_collisionLayer))
+            {
+                continue;
+            }
+
+            // Like the scene, all hits are touches when reporting multiple hits without filter callback
+            bool isBlocking = !request.m_reportMultipleHits;
+            if (request.m_filterCallback)
+            {
+                const AzPhysics::SceneQuery::QueryHitType hitType = request.m_filterCallback(nullptr, entry.m_shape.get());
+                if (hitType == AzPhysics::SceneQuery::QueryHitType::None)
+                {
+                    continue;
+                }
+                isBlocking = hitType == AzPhysics::SceneQuery::QueryHitType::Block;
+            }
+
+            physx::PxRaycastHit pxHit;
+            if (physx::PxGeometryQuery::raycast(start, unitDir, entry.m_geometry.any(), entry.m_pose, request.m_distance, hitFlags, 1, &pxHit))
+            {
+                hits.push_back({ Internal::GetHitFromPxLocationHit(pxHit, entry.m_shape.get(), entry.m_entityId), isBlocking });
+            }
+        }
+
+        return Internal::ResolveHits(hits, request.m_reportMultipleHits, request.m_maxResults);
+    }
+
+    AzPhysics::SceneQueryHits StaticQueryWorld::ShapeCast(const AzPhysics::ShapeCastRequest& request) const
+    {
+        physx::PxGeometryHolder pxGeometry;
+        Utils::CreatePxGeometryFromConfig(*request.m_shapeConfiguration, pxGeometry);
+        const physx::PxGeometryType::Enum geometryType = pxGeometry.any().getType();
+        if (geometryType != physx::PxGeometryType::eSPHERE && geometryType != physx::PxGeometryType::eBOX &&
+            geometryType != physx::PxGeometryType::eCAPSULE && geometryType != physx::PxGeometryType::eCONVEXMESH)
+        {
+            AZ_Warning("PhysX", false, "Invalid geometry type passed to shape cast. Only sphere, box, capsule or convex mesh is supported");
+            return {};
+        }
+
+        const physx::PxTransform pose = PxMathConvert(request.m_start);
+        const physx::PxVec3 unitDir = PxMathConvert(request.m_direction.GetNormalized());
+        const physx::PxHitFlags hitFlags = SceneQueryHelpers::GetPxHitFlags(request.m_hitFlags);
+        const physx::PxBounds3 castBounds = physx::PxGeometryQuery::getWorldBounds(pxGeometry.any(), pose);
+
+        const AZStd::vector<physx::PxU32>& candidates = Internal::GetCandidates(m_entries.size(),
+            [this, &castBounds, &unitDir, &request](physx::PxU32 maxHits, physx::PxU32* hits)
+            {
+                return m_bvhStructure->sweep(castBounds, unitDir, request.m_distance, maxHits, hits);
+            });
+
+        AZStd::vector<Internal::StaticQueryHit> hits;
+        for (const physx::PxU32 candidate : candidates)
+        {
+            const Entry& entry = m_entries[candidate];
+            if (!request.m_collisionGroup.IsSet(entry.m_collisionLayer))
+            {
+                continue;
+            }
+
+            bool isBlocking = !request.m_reportMultipleHits;
+            if (request.m_filterCallback)
+            {
+                const AzPhysics::SceneQuery::QueryHitType hitType = request.m_filterCallback(nullptr, entry.m_shape.get());
+                if (hitType == AzPhysics::SceneQuery::QueryHitType::None)
+                {
+                    continue;
+                }
+                isBlocking = hitType == AzPhysics::SceneQuery::QueryHitType::Block;
+            }
+
+            physx::PxSweepHit pxHit;
+            if (physx::PxGeometryQuery::sweep(unitDir, request.m_distance, pxGeometry.any(), pose, entry.m_geometry.any(), entry.m_pose, pxHit, hitFlags))
+            {
+                hits.push_back({ Internal::GetHitFromPxLocationHit(pxHit, entry.m_shape.get(), entry.m_entityId), isBlocking });
+            }
+        }
+
+        return Internal::ResolveHits(hits, request.m_reportMultipleHits, request.m_maxResults);
+    }
+
+    AzPhysics::SceneQueryHits StaticQueryWorld::Overlap(const AzPhysics::OverlapRequest& request) const
+    {
+        AZ_Warning("PhysX", request.m_unboundedOverlapHitCallback == nullptr, "StaticQueryWorld doesn't support unbounded overlaps.");
+
+        physx::PxGeometryHolder pxGeometry;
+        Utils::CreatePxGeometryFromConfig(*request.m_shapeConfiguration, pxGeometry);
+        const physx::PxTransform pose = PxMathConvert(request.m_pose);
+        const physx::PxBounds3 overlapBounds = physx::PxGeometryQuery::getWorldBounds(pxGeometry.any(), pose);
+
+        const AZStd::vector<physx::PxU32>& candidates = Internal::GetCandidates(m_entries.size(),
+            [this, &overlapBounds](physx::PxU32 maxHits, physx::PxU32* hits)
+            {
+                return m_bvhStructure->overlap(overlapBounds, maxHits, hits);
+            });
+
+        AzPhysics::SceneQueryHits results;
+        for (const physx::PxU32 candidate : candidates)
+        {
+            if (results.m_hits.size() >= request.m_maxResults)
+            {
+                break;
+            }
+
+            const Entry& entry = m_entries[candidate];
+            if (!request.m_collisionGroup.IsSet(entry.m_collisionLayer) ||
+                (request.m_filterCallback && !request.m_filterCallback(nullptr, entry.m_shape.get())))
+            {
+                continue;
+            }
+
+            if (physx::PxGeometryQuery::overlap(pxGeometry.any(), pose, entry.m_geometry.any(), entry.m_pose))
+            {
+                AzPhysics::SceneQueryHit hit;
+                hit.m_shape = entry.m_shape.get();
+                hit.m_resultFlags |= AzPhysics::SceneQuery::ResultFlags::Shape;
+                hit.m_entityId = entry.m_entityId;
+                if (hit.m_entityId.IsValid())
+                {
+                    hit.m_resultFlags |= AzPhysics::SceneQuery::ResultFlags::EntityId;
+                }
+                results.m_hits.push_back(hit);
+            }
+        }
+        return results;
+    }
+} // namespace PhysX
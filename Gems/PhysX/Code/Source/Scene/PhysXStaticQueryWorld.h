@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzFramework/Physics/Collision/CollisionLayers.h>
+#include <AzFramework/Physics/Common/PhysicsSceneQueries.h>
+
+#include <PxPhysicsAPI.h>
+
+namespace Physics
+{
+    class Shape;
+}
+
+namespace PhysX
+{
+    //! Query only collision world for static shapes.
+    //! The shapes are kept with their world pose in a PhysX bounding volume hierarchy, without any actor or PxScene,
+    //! which costs far less than static rigid bodies in a simulated scene when the shapes are only used by scene queries,
+    //! like the level geometry of a dedicated server.
+    //! The world can't be changed once built. Queries are const and thread safe, so one world can be shared by all the
+    //! scenes of a process.
+    class StaticQueryWorld
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(StaticQueryWorld, AZ::SystemAllocator, 0);
+        AZ_DISABLE_COPY_MOVE(StaticQueryWorld);
+
+        struct ShapeDesc
+        {
+            AZStd::shared_ptr<Physics::Shape> m_shape; //!< A PhysX::Shape, which must not be modified once the world is built.
+            AZ::Transform m_worldTransform = AZ::Transform::CreateIdentity(); //!< Transform of the body the shape belongs to.
+            AZ::EntityId m_entityId; //!< Reported in the hits against the shape.
+        };
+
+        //! Builds a world from the shapes.
+        //! @return The world, or nullptr if the bounding volume hierarchy couldn't be built.
+        static AZStd::shared_ptr<const StaticQueryWorld> Create(const AZStd::vector<ShapeDesc>& shapeDescs);
+
+        ~StaticQueryWorld();
+
+        //! Makes a blocking query into the world, with the same results as a query into a scene that only holds these shapes.
+        //! The hits have no body handle, and filter callbacks are called with a null body.
+        //! Unbounded overlaps aren't supported.
+        //! @param request One of RayCastRequest || ShapeCastRequest || OverlapRequest.
+        AzPhysics::SceneQueryHits QueryWorld(const AzPhysics::SceneQueryRequest* request) const;
+
+        size_t GetShapeCount() const;
+
+    private:
+        struct Entry
+        {
+            AZStd::shared_ptr<Physics::Shape> m_shape;
+            physx::PxGeometryHolder m_geometry;
+            physx::PxTransform m_pose; //!< World pose of the shape, including its local pose.
+            AzPhysics::CollisionLayer m_collisionLayer;
+            AZ::EntityId m_entityId;
+        };
+
+        StaticQueryWorld() = default;
+
+        AzPhysics::SceneQueryHits RayCast(const AzPhysics::RayCastRequest& request) const;
+        AzPhysics::SceneQueryHits ShapeCast(const AzPhysics::ShapeCastRequest& request) const;
+        AzPhysics::SceneQueryHits Overlap(const AzPhysics::OverlapRequest& request) const;
+
+        AZStd::vector<Entry> m_entries;
+        physx::PxBVHStructure* m_bvhStructure = nullptr; //!< Bounds of m_entries, in the same order. Null when the world is empty.
+    };
+} // namespace PhysX
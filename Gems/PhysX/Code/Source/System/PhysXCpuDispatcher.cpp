@@ -9,21 +9,51 @@
 #include <System/PhysXCpuDispatcher.h>
 #include <System/PhysXJob.h>
 
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/std/algorithm.h>
+
 namespace PhysX
 {
+    AZ_CVAR(int32_t, physx_jobPriority, 64, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Priority of the jobs running PhysX tasks, from -128 to 127. Jobs default to 0, higher priority jobs are run first.");
+    AZ_CVAR(uint32_t, physx_dedicatedWorkerThreadCount, 0, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "When not 0, PhysX tasks run on this many worker threads of their own instead of the global job manager. "
+        "Read when the PhysX system initializes.");
+
     PhysXCpuDispatcher* PhysXCpuDispatcherCreate()
     {
         return aznew PhysXCpuDispatcher();
     }
 
+    PhysXCpuDispatcher::PhysXCpuDispatcher()
+    {
+        const uint32_t workerThreadCount = physx_dedicatedWorkerThreadCount;
+        if (workerThreadCount > 0)
+        {
+            AZ::JobManagerDesc jobManagerDesc;
+            const uint32_t maxWorkerThreadCount = aznumeric_cast<uint32_t>(jobManagerDesc.m_workerThreads.capacity());
+            for (uint32_t i = 0; i < AZStd::min(workerThreadCount, maxWorkerThreadCount); ++i)
+            {
+                jobManagerDesc.m_workerThreads.push_back(AZ::JobManagerThreadDesc());
+            }
+            m_dedicatedJobManager = AZStd::make_unique<AZ::JobManager>(jobManagerDesc);
+            m_dedicatedJobContext = AZStd::make_unique<AZ::JobContext>(*m_dedicatedJobManager);
+        }
+    }
+
     void PhysXCpuDispatcher::submitTask(physx::PxBaseTask& task)
     {
-        auto azJob = aznew PhysXJob(task);
+        const AZ::s8 priority = aznumeric_cast<AZ::s8>(AZStd::clamp<int32_t>(physx_jobPriority, -128, 127));
+        auto azJob = aznew PhysXJob(task, m_dedicatedJobContext.get(), priority);
         azJob->Start();
     }
 
     physx::PxU32 PhysXCpuDispatcher::getWorkerCount() const
     {
+        if (m_dedicatedJobManager)
+        {
+            return m_dedicatedJobManager->GetNumWorkerThreads();
+        }
         return AZ::JobContext::GetGlobalContext()->GetJobManager().GetNumWorkerThreads();
     }
 } // namespace PhysX
@@ -7,25 +7,33 @@
  */
 
 #pragma once
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <PxPhysicsAPI.h>
 #include <System/PhysXAllocator.h>
 
 namespace PhysX
 {
     //! CPU dispatcher which directs tasks submitted by PhysX to the Open 3D Engine scheduling system.
+    //! The tasks run as jobs with the priority set by physx_jobPriority, so the simulation step is scheduled ahead of other jobs.
+    //! When physx_dedicatedWorkerThreadCount isn't 0, they run on a job manager of their own instead of the global one.
     class PhysXCpuDispatcher
         : public physx::PxCpuDispatcher
     {
     public:
         AZ_CLASS_ALLOCATOR(PhysXCpuDispatcher, PhysXAllocator, 0);
 
-        PhysXCpuDispatcher() = default;
+        PhysXCpuDispatcher();
         ~PhysXCpuDispatcher() = default;
         
     private:
         // PxCpuDispatcher implementation
         void submitTask(physx::PxBaseTask& task) override;
         physx::PxU32 getWorkerCount() const override;
+
+        AZStd::unique_ptr<AZ::JobManager> m_dedicatedJobManager;
+        AZStd::unique_ptr<AZ::JobContext> m_dedicatedJobContext; //!< Context of the jobs on m_dedicatedJobManager, null when PhysX uses the global job context.
     };
 
     //! Creates a CPU dispatcher which directs tasks submitted by PhysX to the Open 3D Engine scheduling system.
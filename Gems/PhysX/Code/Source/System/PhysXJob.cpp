@@ -11,8 +11,8 @@
 
 namespace PhysX
 {
-    PhysXJob::PhysXJob(physx::PxBaseTask& pxTask, AZ::JobContext* context)
-        : AZ::Job(true, context)
+    PhysXJob::PhysXJob(physx::PxBaseTask& pxTask, AZ::JobContext* context, AZ::s8 priority)
+        : AZ::Job(true, context, false, priority)
         , m_pxTask(pxTask)
     {
     }
@@ -20,7 +20,7 @@ namespace PhysX
     public:
         AZ_CLASS_ALLOCATOR(PhysXJob, AZ::ThreadPoolAllocator, 0);
 
-        PhysXJob(physx::PxBaseTask& pxTask, AZ::JobContext* context = nullptr);
+        PhysXJob(physx::PxBaseTask& pxTask, AZ::JobContext* context = nullptr, AZ::s8 priority = 0);
         ~PhysXJob() = default;
 
     protected:
@@ -541,6 +541,12 @@ namespace PhysX
                 {
                     pxGeometry.storeAny(physx::PxTriangleMeshGeometry(reinterpret_cast<physx::PxTriangleMesh*>(meshData), physx::PxMeshScale(PxMathConvert(scale))));
                 }
+                else if (meshData->is<physx::PxHeightField>())
+                {
+                    // the scale holds the row scale, the column scale and the height scale
+                    pxGeometry.storeAny(physx::PxHeightFieldGeometry(reinterpret_cast<physx::PxHeightField*>(meshData),
+                        physx::PxMeshGeometryFlags(), scale.GetZ(), scale.GetX(), scale.GetY()));
+                }
                 else
                 {
                     pxGeometry.storeAny(physx::PxConvexMeshGeometry(reinterpret_cast<physx::PxConvexMesh*>(meshData), physx::PxMeshScale(PxMathConvert(scale))));
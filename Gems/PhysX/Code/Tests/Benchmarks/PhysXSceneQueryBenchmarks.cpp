@@ -28,6 +28,7 @@ namespace PhysX::Benchmarks
         static const float SphereShapeRadius = 2.0f;
         static const AZ::u32 MinRadius = 2u;
         static const int Seed = 100;
+        static const size_t BatchSize = 1024;
 
         static const std::vector<std::vector<std::pair<int64_t, int64_t>>> BenchmarkConfigs =
         {
@@ -209,6 +210,40 @@ namespace PhysX::Benchmarks
         Utils::ReportStandardDeviationAndMeanCounters(state, executionTimes);
     }
 
+    BENCHMARK_DEFINE_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastBatchRandomBoxes)(benchmark::State& state)
+    {
+        AzPhysics::SceneQueryRequests requests;
+        requests.reserve(SceneQueryConstants::BatchSize);
+        for (size_t i = 0; i < SceneQueryConstants::BatchSize; ++i)
+        {
+            auto request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_start = AZ::Vector3::CreateZero();
+            request->m_direction = m_boxes[i % m_numBoxes].GetNormalized();
+            request->m_distance = 2000.0f;
+            requests.emplace_back(AZStd::move(request));
+        }
+
+        AZStd::vector<int64_t> executionTimes;
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        for (auto _ : state)
+        {
+            auto start = std::chrono::system_clock::now(); //AZStd::chrono::system_clock wont messeare below 1000ns
+
+            AzPhysics::SceneQueryHitsList results = sceneInterface->QuerySceneBatch(m_testSceneHandle, requests);
+
+            auto timeElasped = std::chrono::nanoseconds(std::chrono::system_clock::now() - start);
+            executionTimes.emplace_back(timeElasped.count());
+
+            benchmark::DoNotOptimize(results);
+        }
+
+        //get the P50, P90, P99 percentiles of each batch and the standard deviation and mean
+        Utils::ReportPercentiles(state, executionTimes);
+        Utils::ReportStandardDeviationAndMeanCounters(state, executionTimes);
+        state.SetItemsProcessed(state.iterations() * SceneQueryConstants::BatchSize);
+    }
+
     BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastRandomBoxes)
         ->RangeMultiplier(2)
         ->Ranges(SceneQueryConstants::BenchmarkConfigs[0])
@@ -217,6 +252,14 @@ namespace PhysX::Benchmarks
         ->Ranges(SceneQueryConstants::BenchmarkConfigs[3])
         ->Unit(::benchmark::kNanosecond)
         ;
+    BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastBatchRandomBoxes)
+        ->RangeMultiplier(2)
+        ->Ranges(SceneQueryConstants::BenchmarkConfigs[0])
+        ->Ranges(SceneQueryConstants::BenchmarkConfigs[1])
+        ->Ranges(SceneQueryConstants::BenchmarkConfigs[2])
+        ->Ranges(SceneQueryConstants::BenchmarkConfigs[3])
+        ->Unit(::benchmark::kMicrosecond)
+        ;
     BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_ShapecastRandomBoxes)
         ->RangeMultiplier(2)
         ->Ranges(SceneQueryConstants::BenchmarkConfigs[0])
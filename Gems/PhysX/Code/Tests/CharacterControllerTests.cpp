@@ -159,6 +159,36 @@ namespace PhysX
         }
     }
 
+    TEST_F(PhysXDefaultWorldTest, CharacterController_ApplyRequestedVelocities_MovesAllControllersAtDesiredVelocity)
+    {
+        ControllerTestBasis basis1(m_testSceneHandle);
+        ControllerTestBasis basis2(m_testSceneHandle);
+        basis2.m_controller->SetBasePosition(AZ::Vector3::CreateAxisY(5.0f));
+        basis1.Update(AZ::Vector3::CreateZero());
+
+        AZStd::vector<CharacterController*> controllers = {
+            static_cast<CharacterController*>(basis1.m_controller), static_cast<CharacterController*>(basis2.m_controller) };
+        const AZ::Vector3 initialPosition1 = basis1.m_controller->GetBasePosition();
+        const AZ::Vector3 initialPosition2 = basis2.m_controller->GetBasePosition();
+        const AZ::Vector3 desiredVelocity = AZ::Vector3::CreateAxisX();
+
+        constexpr int numMoves = 10;
+        for (int i = 0; i < numMoves; i++)
+        {
+            for (CharacterController* controller : controllers)
+            {
+                controller->AddVelocity(desiredVelocity);
+            }
+            CharacterController::ApplyRequestedVelocities(controllers, basis1.m_timeStep);
+        }
+
+        const AZ::Vector3 expectedDisplacement = desiredVelocity * basis1.m_timeStep * static_cast<float>(numMoves);
+        EXPECT_TRUE(basis1.m_controller->GetBasePosition().IsClose(initialPosition1 + expectedDisplacement));
+        EXPECT_TRUE(basis2.m_controller->GetBasePosition().IsClose(initialPosition2 + expectedDisplacement));
+        EXPECT_TRUE(basis1.m_controller->GetVelocity().IsClose(desiredVelocity));
+        EXPECT_TRUE(basis2.m_controller->GetVelocity().IsClose(desiredVelocity));
+    }
+
     TEST_F(PhysXDefaultWorldTest, CharacterController_MovingDirectlyTowardsStaticBox_StoppedByBox)
     {
         ControllerTestBasis basis(m_testSceneHandle);
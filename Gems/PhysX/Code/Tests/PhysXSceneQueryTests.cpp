@@ -19,6 +19,7 @@
 #include <AzFramework/Physics/Configuration/RigidBodyConfiguration.h>
 
 #include <RigidBodyComponent.h>
+#include <Scene/PhysXStaticQueryWorld.h>
 #include <SphereColliderComponent.h>
 
 namespace PhysX
@@ -1009,4 +1010,134 @@ namespace PhysX
             }
         }
     }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneAsync_DuringSimulation_ReturnsHitWhenSimulationFinishes)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        auto* physicsSystem = AZ::Interface<AzPhysics::SystemInterface>::Get();
+        AzPhysics::Scene* scene = physicsSystem->GetScene(m_testSceneHandle);
+
+        const AzPhysics::SimulatedBodyHandle sphereHandle = TestUtils::AddSphereToScene(m_testSceneHandle, AZ::Vector3(10.0f, 0.0f, 0.0f), 1.0f);
+
+        AzPhysics::RayCastRequest request;
+        request.m_start = AZ::Vector3::CreateZero();
+        request.m_direction = AZ::Vector3::CreateAxisX(1.0f);
+        request.m_distance = 200.0f;
+
+        static constexpr AzPhysics::SceneQuery::AsyncRequestId RequestId = 7;
+        bool callbackInvoked = false;
+        AzPhysics::SceneQueryHits result;
+        auto callback = [&callbackInvoked, &result](AzPhysics::SceneQuery::AsyncRequestId requestId, AzPhysics::SceneQueryHits hits)
+        {
+            EXPECT_EQ(requestId, RequestId);
+            callbackInvoked = true;
+            result = AZStd::move(hits);
+        };
+
+        // Issue the query while the scene simulates, the result is dispatched by a later simulation step
+        scene->StartSimulation(0.0001f);
+        EXPECT_TRUE(sceneInterface->QuerySceneAsync(m_testSceneHandle, RequestId, &request, callback));
+        EXPECT_FALSE(callbackInvoked);
+        scene->FinishSimulation();
+
+        for (int step = 0; step < 100 && !callbackInvoked; ++step)
+        {
+            TestUtils::UpdateScene(scene, 0.0001f, 1);
+        }
+
+        ASSERT_TRUE(callbackInvoked);
+        ASSERT_EQ(result.m_hits.size(), 1);
+        EXPECT_EQ(result.m_hits[0].m_bodyHandle, sphereHandle);
+    }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneBatch_ManyRequests_ReturnsHitsInRequestOrder)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        const AZStd::vector<AZ::Vector3> positions = {
+            AZ::Vector3(10.0f, 0.0f, 0.0f),
+            AZ::Vector3(-10.0f, 0.0f, 0.0f),
+            AZ::Vector3(0.0f, 10.0f, 0.0f),
+            AZ::Vector3(0.0f, -10.0f, 0.0f),
+            AZ::Vector3(0.0f, 0.0f, 10.0f),
+            AZ::Vector3(0.0f, 0.0f, -10.0f)
+        };
+
+        AZStd::vector<AzPhysics::SimulatedBodyHandle> simBodies;
+        for (const AZ::Vector3& pos : positions)
+        {
+            simBodies.emplace_back(TestUtils::AddSphereToScene(m_testSceneHandle, pos, 1.0f));
+        }
+
+        // Enough requests to be split across several jobs
+        constexpr size_t RequestCount = 200;
+        AzPhysics::SceneQueryRequests requests;
+        for (size_t i = 0; i < RequestCount; ++i)
+        {
+            AZStd::shared_ptr<AzPhysics::RayCastRequest> request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_start = AZ::Vector3::CreateZero();
+            request->m_direction = positions[i % positions.size()].GetNormalized();
+            request->m_distance = 200.0f;
+            requests.emplace_back(AZStd::move(request));
+        }
+
+        AzPhysics::SceneQueryHitsList results = sceneInterface->QuerySceneBatch(m_testSceneHandle, requests);
+
+        ASSERT_EQ(results.size(), requests.size());
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            ASSERT_EQ(results[i].m_hits.size(), 1);
+            EXPECT_EQ(results[i].m_hits[0].m_bodyHandle, simBodies[i % simBodies.size()]);
+        }
+    }
+
+    TEST_F(PhysXSceneQueryFixture, StaticQueryWorld_RayCastAndOverlap_ReturnHitsAgainstShapes)
+    {
+        auto* physics = AZ::Interface<Physics::System>::Get();
+        Physics::ColliderConfiguration colliderConfig;
+
+        AZStd::vector<StaticQueryWorld::ShapeDesc> shapeDescs;
+        constexpr int shapeCount = 10;
+        for (int i = 0; i < shapeCount; ++i)
+        {
+            StaticQueryWorld::ShapeDesc shapeDesc;
+            shapeDesc.m_shape = physics->CreateShape(colliderConfig, Physics::BoxShapeConfiguration());
+            shapeDesc.m_worldTransform = AZ::Transform::CreateTranslation(AZ::Vector3(10.0f * static_cast<float>(i), 0.0f, 0.0f));
+            shapeDesc.m_entityId = AZ::EntityId(i + 1);
+            shapeDescs.push_back(shapeDesc);
+        }
+
+        AZStd::shared_ptr<const StaticQueryWorld> world = StaticQueryWorld::Create(shapeDescs);
+        ASSERT_NE(world, nullptr);
+        EXPECT_EQ(world->GetShapeCount(), shapeCount);
+
+        // closest hit along the row of boxes
+        AzPhysics::RayCastRequest rayCastRequest;
+        rayCastRequest.m_start = AZ::Vector3(-10.0f, 0.0f, 0.0f);
+        rayCastRequest.m_direction = AZ::Vector3::CreateAxisX(1.0f);
+        rayCastRequest.m_distance = 200.0f;
+        AzPhysics::SceneQueryHits hits = world->QueryWorld(&rayCastRequest);
+        ASSERT_EQ(hits.m_hits.size(), 1);
+        EXPECT_EQ(hits.m_hits[0].m_entityId, shapeDescs[0].m_entityId);
+        EXPECT_NEAR(hits.m_hits[0].m_distance, 9.5f, 0.01f);
+
+        // all hits, sorted by distance
+        rayCastRequest.m_reportMultipleHits = true;
+        hits = world->QueryWorld(&rayCastRequest);
+        ASSERT_EQ(hits.m_hits.size(), shapeCount);
+        for (int i = 0; i < shapeCount; ++i)
+        {
+            EXPECT_EQ(hits.m_hits[i].m_entityId, shapeDescs[i].m_entityId);
+        }
+
+        // the world only has static shapes
+        rayCastRequest.m_queryType = AzPhysics::SceneQuery::QueryType::Dynamic;
+        EXPECT_FALSE(world->QueryWorld(&rayCastRequest));
+
+        AzPhysics::OverlapRequest overlapRequest = AzPhysics::OverlapRequestHelpers::CreateSphereOverlapRequest(
+            1.0f, AZ::Transform::CreateTranslation(AZ::Vector3(30.0f, 0.0f, 0.0f)));
+        hits = world->QueryWorld(&overlapRequest);
+        ASSERT_EQ(hits.m_hits.size(), 1);
+        EXPECT_EQ(hits.m_hits[0].m_entityId, shapeDescs[3].m_entityId);
+    }
 }
@@ -11,6 +11,7 @@
 #include <AzFramework/Physics/PhysicsSystem.h>
 #include <AzFramework/Physics/Configuration/StaticRigidBodyConfiguration.h>
 #include <AzFramework/Physics/PhysicsScene.h>
+#include <AzFramework/Physics/Common/PhysicsSceneQueries.h>
 
 namespace PhysX
 {
@@ -196,6 +197,55 @@ namespace PhysX
         configs.clear();
     }
 
+    TEST_F(PhysXSceneFixture, AddRemoveSimulatedBodies_BodiesAreSimulatedUntilRemoved)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        AzPhysics::ShapeColliderPair shapeColliderData(
+            AZStd::make_shared<Physics::ColliderConfiguration>(),
+            AZStd::make_shared<Physics::BoxShapeConfiguration>(AZ::Vector3::CreateOne()));
+
+        constexpr const int numberOfBodies = 50;
+        AZStd::vector<AzPhysics::StaticRigidBodyConfiguration> staticConfigs(numberOfBodies);
+        AzPhysics::SimulatedBodyConfigurationList configs;
+        for (int i = 0; i < numberOfBodies; i++)
+        {
+            staticConfigs[i].m_colliderAndShapeData = shapeColliderData;
+            staticConfigs[i].m_position = AZ::Vector3::CreateAxisX(2.0f * static_cast<float>(i));
+            // every other body starts with simulation disabled
+            staticConfigs[i].m_startSimulationEnabled = (i % 2) == 0;
+            configs.emplace_back(&staticConfigs[i]);
+        }
+
+        AzPhysics::SimulatedBodyHandleList newBodies = sceneInterface->AddSimulatedBodies(m_testSceneHandle, configs);
+        ASSERT_EQ(newBodies.size(), configs.size());
+
+        AzPhysics::SimulatedBodyList bodies = sceneInterface->GetSimulatedBodiesFromHandle(m_testSceneHandle, newBodies);
+        for (int i = 0; i < numberOfBodies; i++)
+        {
+            ASSERT_NE(bodies[i], nullptr);
+            EXPECT_EQ(bodies[i]->m_simulating, staticConfigs[i].m_startSimulationEnabled);
+        }
+
+        // only the simulated bodies are hit
+        AzPhysics::RayCastRequest request;
+        request.m_start = AZ::Vector3(0.0f, 0.0f, 10.0f);
+        request.m_direction = AZ::Vector3(0.0f, 0.0f, -1.0f);
+        request.m_distance = 20.0f;
+        EXPECT_TRUE(sceneInterface->QueryScene(m_testSceneHandle, &request));
+        request.m_start = AZ::Vector3(2.0f, 0.0f, 10.0f);
+        EXPECT_FALSE(sceneInterface->QueryScene(m_testSceneHandle, &request));
+
+        sceneInterface->RemoveSimulatedBodies(m_testSceneHandle, newBodies);
+        for (const AzPhysics::SimulatedBodyHandle& handle : newBodies)
+        {
+            EXPECT_EQ(handle, AzPhysics::InvalidSimulatedBodyHandle);
+        }
+
+        request.m_start = AZ::Vector3(0.0f, 0.0f, 10.0f);
+        EXPECT_FALSE(sceneInterface->QueryScene(m_testSceneHandle, &request));
+    }
+
     TEST_F(PhysXSceneFixture, RemovedSimulatedBody_IsRemoved)
     {
         auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
@@ -11,8 +11,10 @@
 
 #include <AzTest/AzTest.h>
 #include <AzCore/Asset/AssetManager.h>
+#include <AzCore/Component/TickBus.h>
 #include <AzCore/UnitTest/UnitTest.h>
 
+#include <AzFramework/Components/TransformComponent.h>
 #include <AzFramework/Physics/SystemBus.h>
 #include <AzFramework/Physics/Collision/CollisionGroups.h>
 #include <AzFramework/Physics/Collision/CollisionLayers.h>
@@ -23,6 +25,7 @@
 #include <AzFramework/Physics/Configuration/RigidBodyConfiguration.h>
 #include <AzFramework/Physics/Configuration/StaticRigidBodyConfiguration.h>
 
+#include <HeightFieldTileStreamingComponent.h>
 #include <RigidBodyStatic.h>
 #include <SphereColliderComponent.h>
 #include <Utils.h>
@@ -30,6 +33,7 @@
 #include <PhysX/MathConversion.h>
 #include <PhysX/PhysXLocks.h>
 #include <PhysX/SystemComponentBus.h>
+#include <System/PhysXSystem.h>
 #include <Tests/PhysXTestCommon.h>
 
 namespace PhysX
@@ -1488,5 +1492,90 @@ namespace PhysX
         ::testing::ValuesIn(possibleMassComputeFlags),
         ::testing::Bool()));
 
+    TEST_F(PhysXSpecificTest, HeightFieldTileStreaming_PointOfInterestNearTile_TileColliderStreamedInAndOut)
+    {
+        // a flat height field with all its samples at height 100
+        constexpr physx::PxU32 sampleCount = 5;
+        AZStd::vector<physx::PxHeightFieldSample> samples(sampleCount * sampleCount);
+        for (physx::PxHeightFieldSample& sample : samples)
+        {
+            sample.height = 100;
+            sample.materialIndex0 = 0;
+            sample.materialIndex1 = 0;
+        }
+        physx::PxHeightFieldDesc heightFieldDesc;
+        heightFieldDesc.format = physx::PxHeightFieldFormat::eS16_TM;
+        heightFieldDesc.nbColumns = sampleCount;
+        heightFieldDesc.nbRows = sampleCount;
+        heightFieldDesc.samples.data = samples.data();
+        heightFieldDesc.samples.stride = sizeof(physx::PxHeightFieldSample);
+        physx::PxHeightField* heightField = GetPhysXSystem()->GetPxCooking()->createHeightField(
+            heightFieldDesc, PxGetPhysics().getPhysicsInsertionCallback());
+        ASSERT_NE(heightField, nullptr);
+
+        AZ::Data::Asset<Pipeline::HeightFieldAsset> heightFieldAsset =
+            AZ::Data::AssetManager::Instance().CreateAsset<Pipeline::HeightFieldAsset>(AZ::Data::AssetId(AZ::Uuid::CreateRandom()));
+        heightFieldAsset->SetHeightField(heightField);
+
+        // tile (1, 0) of a grid of 4 meter tiles, with one sample per meter and 1 centimeter height units
+        HeightFieldTileStreamingConfiguration configuration;
+        configuration.m_tileSize = 4.0f;
+        configuration.m_sampleScale = AZ::Vector3(1.0f, 1.0f, 0.01f);
+        configuration.m_streamInDistance = 2.0f;
+        configuration.m_streamOutDistance = 4.0f;
+        HeightFieldTile tile;
+        tile.m_column = 1;
+        tile.m_asset = heightFieldAsset;
+        configuration.m_tiles.push_back(tile);
+
+        AZ::Entity entity("HeightFieldTiles");
+        entity.CreateComponent<AzFramework::TransformComponent>();
+        entity.CreateComponent<HeightFieldTileStreamingComponent>(configuration);
+        entity.Init();
+        entity.Activate();
+
+        auto setPointOfInterest = [&entity](const AZ::Vector3& pointOfInterest)
+        {
+            HeightFieldTileStreamingRequestBus::Event(entity.GetId(), &HeightFieldTileStreamingRequests::SetPointsOfInterest,
+                AZStd::vector<AZ::Vector3>{ pointOfInterest });
+            AZ::TickBus::Broadcast(&AZ::TickEvents::OnTick, 0.01f, AZ::ScriptTimePoint(AZStd::chrono::system_clock::now()));
+        };
+        auto getLoadedTileCount = [&entity]()
+        {
+            size_t loadedTileCount = 0;
+            HeightFieldTileStreamingRequestBus::EventResult(loadedTileCount, entity.GetId(),
+                &HeightFieldTileStreamingRequests::GetLoadedTileCount);
+            return loadedTileCount;
+        };
+
+        setPointOfInterest(AZ::Vector3(-2.0f, 2.0f, 0.0f));
+        EXPECT_EQ(getLoadedTileCount(), 0);
+
+        setPointOfInterest(AZ::Vector3(3.0f, 2.0f, 0.0f));
+        EXPECT_EQ(getLoadedTileCount(), 1);
+
+        // the tile covers x in [4, 8] and y in [0, 4], with its surface at 100 height units
+        AzPhysics::RayCastRequest request;
+        request.m_start = AZ::Vector3(6.0f, 1.0f, 10.0f);
+        request.m_direction = -AZ::Vector3::CreateAxisZ();
+        request.m_distance = 20.0f;
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        AzPhysics::SceneQueryHits hits = sceneInterface->QueryScene(m_testSceneHandle, &request);
+        ASSERT_TRUE(hits);
+        EXPECT_NEAR(hits.m_hits[0].m_position.GetZ(), 1.0f, tolerance);
+
+        request.m_start = AZ::Vector3(2.0f, 1.0f, 10.0f);
+        EXPECT_FALSE(sceneInterface->QueryScene(m_testSceneHandle, &request));
+
+        // within the stream out distance the tile stays, beyond it the tile is streamed out
+        setPointOfInterest(AZ::Vector3(1.0f, 2.0f, 0.0f));
+        EXPECT_EQ(getLoadedTileCount(), 1);
+
+        setPointOfInterest(AZ::Vector3(-1.0f, 2.0f, 0.0f));
+        EXPECT_EQ(getLoadedTileCount(), 0);
+
+        entity.Deactivate();
+    }
+
 } // namespace PhysX
 
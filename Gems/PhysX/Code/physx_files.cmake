@@ -27,6 +27,7 @@ set(FILES
     Include/PhysX/PhysXLocks.h
     Include/PhysX/CharacterControllerBus.h
     Include/PhysX/CharacterGameplayBus.h
+    Include/PhysX/HeightFieldTileStreamingBus.h
     Source/RigidBodyComponent.cpp
     Source/RigidBodyComponent.h
     Source/BaseColliderComponent.cpp
@@ -45,6 +46,8 @@ set(FILES
     Source/ForceRegionComponent.h
     Source/StaticRigidBodyComponent.cpp
     Source/StaticRigidBodyComponent.h
+    Source/HeightFieldTileStreamingComponent.cpp
+    Source/HeightFieldTileStreamingComponent.h
     Source/BallJointComponent.cpp
     Source/BallJointComponent.h
     Source/FixedJointComponent.cpp
@@ -120,6 +123,8 @@ set(FILES
     Source/Scene/PhysXSceneSimulationEventCallback.cpp
     Source/Scene/PhysXSceneSimulationFilterCallback.h
     Source/Scene/PhysXSceneSimulationFilterCallback.cpp
+    Source/Scene/PhysXStaticQueryWorld.h
+    Source/Scene/PhysXStaticQueryWorld.cpp
     Source/System/PhysXAllocator.h
     Source/System/PhysXAllocator.cpp
     Source/System/PhysXCookingParams.h
@@ -29,6 +29,9 @@
 
 #include <AzToolsFramework/Debug/TraceContext.h>
 
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Math/Vector4.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 
@@ -91,16 +94,46 @@ namespace AZ::SceneGenerationComponents
         }
 
         // Iterate over them. We had to build the array before as this method can insert new nodes, so using the iterator directly would fail.
-        for (auto& [mesh, nodeIndex] : meshes)
+        AZStd::vector<MeshTangentGeneration> generations(meshes.size());
+        for (size_t meshIndex = 0; meshIndex < meshes.size(); ++meshIndex)
         {
-            // Generate tangents for the mesh (if this is desired or needed).
-            if (!GenerateTangentsForMesh(context.GetScene(), nodeIndex, mesh))
+            // Add the tangent layers the mesh needs (if generating is desired or needed).
+            PrepareTangentsForMesh(context.GetScene(), meshes[meshIndex].second, meshes[meshIndex].first, generations[meshIndex]);
+        }
+
+        // Generate the tangents of the meshes in parallel. The scene graph is not modified anymore, and each mesh only writes to its own data.
+        if (generations.size() > 1 && AZ::JobContext::GetGlobalContext())
+        {
+            AZ::JobCompletion jobCompletion;
+            for (MeshTangentGeneration& generation : generations)
+            {
+                AZ::Job* generateJob = AZ::CreateJobFunction([&generation]()
+                    {
+                        GenerateTangentsForMesh(generation);
+                    }, true);
+                generateJob->SetDependent(&jobCompletion);
+                generateJob->Start();
+            }
+            jobCompletion.StartAndWaitForCompletion();
+        }
+        else
+        {
+            for (MeshTangentGeneration& generation : generations)
+            {
+                GenerateTangentsForMesh(generation);
+            }
+        }
+
+        // Handle the results in mesh order, so the result doesn't depend on the order in which the jobs ran.
+        for (size_t meshIndex = 0; meshIndex < meshes.size(); ++meshIndex)
+        {
+            if (!generations[meshIndex].m_succeeded)
             {
                 return AZ::SceneAPI::Events::ProcessingResult::Failure;
             }
 
             // Now that we have the tangents and bitangents, calculate the tangent w values for the ones that we imported from the scene file, as they only have xyz.
-            UpdateFbxTangentWValues(graph, nodeIndex, mesh);
+            UpdateFbxTangentWValues(graph, meshes[meshIndex].second, meshes[meshIndex].first);
         }
 
         return AZ::SceneAPI::Events::ProcessingResult::Success;
@@ -175,27 +208,27 @@ namespace AZ::SceneGenerationComponents
         }
     }
 
-    bool TangentGenerateComponent::GenerateTangentsForMesh(AZ::SceneAPI::Containers::Scene& scene, const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex, AZ::SceneAPI::DataTypes::IMeshData* meshData)
+    void TangentGenerateComponent::PrepareTangentsForMesh(AZ::SceneAPI::Containers::Scene& scene, const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex, AZ::SceneAPI::DataTypes::IMeshData* meshData,
+        MeshTangentGeneration& outGeneration)
     {
         AZ::SceneAPI::Containers::SceneGraph& graph = scene.GetGraph();
+        outGeneration.m_meshData = meshData;
 
         // Check if we have any UV data, if not, we cannot possibly generate the tangents.
         const size_t uvSetCount = CalcUvSetCount(graph, nodeIndex);
         if (uvSetCount == 0)
         {
             AZ_Warning(AZ::SceneAPI::Utilities::WarningWindow, false, "Cannot generate tangents for this mesh, as it has no UV coordinates.\n");
-            return true; // No fatal error
+            return; // No fatal error
         }
 
         const AZ::SceneAPI::SceneData::TangentsRule* tangentsRule = GetTangentRule(scene);
         const AZ::SceneAPI::DataTypes::TangentGenerationMethod ruleGenerationMethod = tangentsRule ? tangentsRule->GetGenerationMethod() : AZ::SceneAPI::DataTypes::TangentGenerationMethod::FromSourceScene;
 
         // Find all blend shape data under the mesh. We need to generate the tangent and bitangent for blend shape as well.
-        AZStd::vector<AZ::SceneData::GraphData::BlendShapeData*> blendShapes;
-        FindBlendShapes(graph, nodeIndex, blendShapes);
+        FindBlendShapes(graph, nodeIndex, outGeneration.m_blendShapes);
 
-        // Generate tangents/bitangents for all uv sets.
-        bool allSuccess = true;
+        // Prepare tangents/bitangents for all uv sets.
         for (size_t uvSetIndex = 0; uvSetIndex < uvSetCount; ++uvSetIndex)
         {
             AZ::SceneAPI::DataTypes::IMeshVertexUVData* uvData = FindUvData(graph, nodeIndex, uvSetIndex);
@@ -260,26 +293,38 @@ namespace AZ::SceneGenerationComponents
             // Generate using MikkT space.
             case AZ::SceneAPI::DataTypes::TangentGenerationMethod::MikkT:
             {
-                const AZ::SceneAPI::DataTypes::MikkTSpaceMethod tSpaceMethod = tangentsRule ? tangentsRule->GetMikkTSpaceMethod() : AZ::SceneAPI::DataTypes::MikkTSpaceMethod::TSpace;
-
-                allSuccess &= AZ::TangentGeneration::Mesh::MikkT::GenerateTangents(meshData, uvData, tangentData, bitangentData, tSpaceMethod);
-
-                for (AZ::SceneData::GraphData::BlendShapeData* blendShape : blendShapes)
-                {
-                    allSuccess &= AZ::TangentGeneration::BlendShape::MikkT::GenerateTangents(blendShape, uvSetIndex, tSpaceMethod);
-                }
+                UvSetTangentGeneration uvSetGeneration;
+                uvSetGeneration.m_uvSetIndex = uvSetIndex;
+                uvSetGeneration.m_uvData = uvData;
+                uvSetGeneration.m_tangentData = tangentData;
+                uvSetGeneration.m_bitangentData = bitangentData;
+                uvSetGeneration.m_tSpaceMethod = tangentsRule ? tangentsRule->GetMikkTSpaceMethod() : AZ::SceneAPI::DataTypes::MikkTSpaceMethod::TSpace;
+                outGeneration.m_uvSets.push_back(uvSetGeneration);
             }
             break;
 
             default:
             {
                 AZ_Assert(false, "Unknown tangent generation method selected (%d) for UV set %d, cannot generate tangents.\n", static_cast<AZ::u32>(generationMethod), uvSetIndex);
-                allSuccess = false;
+                outGeneration.m_succeeded = false;
             }
             }
         }
+    }
 
-        return allSuccess;
+    void TangentGenerateComponent::GenerateTangentsForMesh(MeshTangentGeneration& generation)
+    {
+        // Generate tangents/bitangents for all uv sets, in order, since the blend shapes of the mesh are shared by all of them.
+        for (const UvSetTangentGeneration& uvSet : generation.m_uvSets)
+        {
+            generation.m_succeeded &= AZ::TangentGeneration::Mesh::MikkT::GenerateTangents(
+                generation.m_meshData, uvSet.m_uvData, uvSet.m_tangentData, uvSet.m_bitangentData, uvSet.m_tSpaceMethod);
+
+            for (AZ::SceneData::GraphData::BlendShapeData* blendShape : generation.m_blendShapes)
+            {
+                generation.m_succeeded &= AZ::TangentGeneration::BlendShape::MikkT::GenerateTangents(blendShape, uvSet.m_uvSetIndex, uvSet.m_tSpaceMethod);
+            }
+        }
     }
 
     size_t TangentGenerateComponent::CalcUvSetCount(AZ::SceneAPI::Containers::SceneGraph& graph, const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex) const
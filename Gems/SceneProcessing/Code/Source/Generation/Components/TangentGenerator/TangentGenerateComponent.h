@@ -55,10 +55,32 @@ namespace AZ::SceneGenerationComponents
         AZ::SceneAPI::Events::ProcessingResult GenerateTangentData(TangentGenerateContext& context);
 
     private:
+        //! The tangents to generate for one uv set of a mesh.
+        struct UvSetTangentGeneration
+        {
+            size_t m_uvSetIndex = 0;
+            AZ::SceneAPI::DataTypes::IMeshVertexUVData* m_uvData = nullptr;
+            AZ::SceneAPI::DataTypes::IMeshVertexTangentData* m_tangentData = nullptr;
+            AZ::SceneAPI::DataTypes::IMeshVertexBitangentData* m_bitangentData = nullptr;
+            AZ::SceneAPI::DataTypes::MikkTSpaceMethod m_tSpaceMethod = AZ::SceneAPI::DataTypes::MikkTSpaceMethod::TSpace;
+        };
+
+        //! The tangents to generate for one mesh. The tangent layers are added to the scene graph first, one mesh at a time, and the
+        //! generation of the meshes then runs in parallel since each one only writes to its own layers and blend shapes.
+        struct MeshTangentGeneration
+        {
+            AZ::SceneAPI::DataTypes::IMeshData* m_meshData = nullptr;
+            AZStd::vector<AZ::SceneData::GraphData::BlendShapeData*> m_blendShapes;
+            AZStd::vector<UvSetTangentGeneration> m_uvSets;
+            bool m_succeeded = true;
+        };
+
         void FindBlendShapes(
             AZ::SceneAPI::Containers::SceneGraph& graph, const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex,
             AZStd::vector<AZ::SceneData::GraphData::BlendShapeData*>& outBlendShapes) const;
-        bool GenerateTangentsForMesh(AZ::SceneAPI::Containers::Scene& scene, const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex, AZ::SceneAPI::DataTypes::IMeshData* meshData);
+        void PrepareTangentsForMesh(AZ::SceneAPI::Containers::Scene& scene, const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex, AZ::SceneAPI::DataTypes::IMeshData* meshData,
+            MeshTangentGeneration& outGeneration);
+        static void GenerateTangentsForMesh(MeshTangentGeneration& generation);
         void UpdateFbxTangentWValues(AZ::SceneAPI::Containers::SceneGraph& graph, const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex, const AZ::SceneAPI::DataTypes::IMeshData* meshData);
         const AZ::SceneAPI::SceneData::TangentsRule* GetTangentRule(const AZ::SceneAPI::Containers::Scene& scene) const;
 
@@ -686,6 +686,26 @@ namespace ScriptCanvasBuilder
     ScriptCanvas::Translation::Result TranslateToLua(ScriptCanvas::Grammar::Request& request)
     {
         request.translationTargetFlags = ScriptCanvas::Translation::TargetFlags::Lua;
-        return ScriptCanvas::Translation::ParseAndTranslateGraph(request);
+
+        if (ScriptCanvas::Grammar::g_translateToNativeCode)
+        {
+            request.translationTargetFlags |= ScriptCanvas::Translation::TargetFlags::Cpp | ScriptCanvas::Translation::TargetFlags::Hpp;
+        }
+
+        ScriptCanvas::Translation::Result result = ScriptCanvas::Translation::ParseAndTranslateGraph(request);
+
+        // the Lua translation is always used when there is no native one, so this never fails the job
+        auto nativeErrors = result.m_errors.find(ScriptCanvas::Translation::TargetFlags::Cpp);
+        if (nativeErrors != result.m_errors.end())
+        {
+            AZ_TracePrintf(s_scriptCanvasBuilder, "%.*s was not translated to C++, it will run its Lua translation:\n"
+                , aznumeric_cast<int>(request.name.size()), request.name.data());
+            for (const AZStd::string& error : nativeErrors->second)
+            {
+                AZ_TracePrintf(s_scriptCanvasBuilder, "* %s\n", error.data());
+            }
+        }
+
+        return result;
     }
 }
@@ -76,6 +76,20 @@ namespace ScriptCanvas
             PerformanceReportByAsset byAsset;
         };
 
+        //! The time, executions and Lua allocations of a node, recorded while the node profiling of the PerformanceTracker is on.
+        struct NodePerformanceReport
+        {
+            AZ_TYPE_INFO(NodePerformanceReport, "{CC8A4F62-B2C2-46BC-A1F7-B9157EAB4A47}");
+            AZ_CLASS_ALLOCATOR(NodePerformanceReport, AZ::SystemAllocator, 0);
+
+            AZ::Data::AssetId assetId;
+            AZ::EntityId nodeId;
+            AZStd::string nodeName;
+            AZStd::sys_time_t executionTime = 0; // microseconds
+            AZ::u32 executionCount = 0;
+            AZ::u64 allocatedBytes = 0;
+        };
+
         void FinalizePerformanceReport(PerformanceKey key, const AZ::Data::AssetId& assetId);
 
         class PerformanceScope
@@ -6,6 +6,7 @@
  *
  */
 
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <ScriptCanvas/Core/Core.h>
 #include <ScriptCanvas/Execution/RuntimeComponent.h>
@@ -14,11 +15,14 @@
 #include "Interpreted/ExecutionStateInterpretedPure.h"
 #include "Interpreted/ExecutionStateInterpretedPerActivation.h"
 #include "Interpreted/ExecutionStateInterpretedSingleton.h"
+#include "Native/ExecutionStateNative.h"
 
 #include "ExecutionState.h"
 
 namespace ScriptCanvas
 {
+    AZ_CVAR(bool, g_disableNativeGraphExecution, false, {}, AZ::ConsoleFunctorFlags::Null, "Run the Lua translation of graphs even if they were compiled to C++, for debugging.");
+
     ExecutionStateConfig::ExecutionStateConfig(AZ::Data::Asset<RuntimeAsset> runtimeAsset, RuntimeComponent& component)
         : asset(runtimeAsset)
         , component(component)
@@ -39,6 +43,14 @@ namespace ScriptCanvas
             return AZStd::make_shared<ExecutionStateInterpretedPure>(config);
 
         case Grammar::ExecutionStateSelection::InterpretedPureOnGraphStart:
+            if (!g_disableNativeGraphExecution)
+            {
+                // graphs compiled to C++ register under the guid of their source
+                if (GraphStartFunction onGraphStart = FindNativeGraphStart(config.asset.GetId().m_guid.ToString<AZStd::string>()))
+                {
+                    return AZStd::make_shared<ExecutionStateNative>(config, onGraphStart);
+                }
+            }
             return AZStd::make_shared<ExecutionStateInterpretedPureOnGraphStart>(config);
 
         case Grammar::ExecutionStateSelection::InterpretedObject:
@@ -108,6 +120,7 @@ namespace ScriptCanvas
         ExecutionStateInterpretedPure::Reflect(reflectContext);
         ExecutionStateInterpretedPureOnGraphStart::Reflect(reflectContext);
         ExecutionStateInterpretedSingleton::Reflect(reflectContext);
+        ExecutionStateNative::Reflect(reflectContext);
     }
 
     ExecutionStatePtr ExecutionState::SharedFromThis()
@@ -33,6 +33,10 @@ namespace ScriptCanvas
     using ExecutionStateInterpretedSingletonConstPtr = AZStd::shared_ptr<const ExecutionStateInterpretedSingleton>;
     using ExecutionStateInterpretedSingletonPtr = AZStd::shared_ptr<ExecutionStateInterpretedSingleton>;
     
+    class ExecutionStateNative;
+    using ExecutionStateNativeConstPtr = AZStd::shared_ptr<const ExecutionStateNative>;
+    using ExecutionStateNativePtr = AZStd::shared_ptr<ExecutionStateNative>;
+    
     struct ExecutionStateConfig;
 
 } 
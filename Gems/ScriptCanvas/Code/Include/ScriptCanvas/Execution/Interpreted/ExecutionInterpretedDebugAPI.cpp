@@ -16,6 +16,8 @@
 #include <ScriptCanvas/Grammar/DebugMap.h>
 #include <ScriptCanvas/Execution/ExecutionState.h>
 #include <ScriptCanvas/Execution/Interpreted/ExecutionStateInterpreted.h>
+#include <ScriptCanvas/PerformanceTracker.h>
+#include <ScriptCanvas/SystemComponent.h>
 
 #include <Libraries/UnitTesting/UnitTestBus.h>
 
@@ -24,6 +26,50 @@ namespace ExecutionInterpretedDebugAPIcpp
     using namespace ScriptCanvas;
     using namespace ScriptCanvas::Execution;
 
+    bool IsGraphObserved(const ExecutionStateInterpreted& executionState)
+    {
+        bool isObserved{};
+        ExecutionNotificationsBus::BroadcastResult(isObserved, &ExecutionNotifications::IsGraphObserved, executionState.GetEntityId(), executionState.GetGraphIdentifier());
+        return isObserved;
+    }
+
+    // The tracker, while it profiles the nodes
+    PerformanceTracker* GetNodeProfiler()
+    {
+        PerformanceTracker* tracker = SystemComponent::ModPerformanceTracker();
+        return tracker && tracker->IsNodeProfiling() ? tracker : nullptr;
+    }
+
+    AZ::u64 GetAllocatedBytes(AZ::ScriptContext* scriptContext)
+    {
+        return scriptContext ? scriptContext->GetMemoryStatistics().m_allocatedBytes : 0;
+    }
+
+    // Reports the signal to the node profiler, and returns whether it still needs to go to the observers of the graph
+    bool ProfileSignalIn(lua_State* lua, const ExecutionStateInterpreted& executionState, const AZ::Data::AssetId& assetId, const Grammar::DebugExecution& debugIn)
+    {
+        if (PerformanceTracker* profiler = GetNodeProfiler())
+        {
+            AZ::ScriptContext* scriptContext = AZ::ScriptContext::FromNativeContext(lua);
+            profiler->ReportNodeInput(scriptContext, assetId, debugIn.m_namedEndpoint, GetAllocatedBytes(scriptContext));
+            return IsGraphObserved(executionState);
+        }
+
+        return true;
+    }
+
+    bool ProfileSignalOut(lua_State* lua, const ExecutionStateInterpreted& executionState)
+    {
+        if (PerformanceTracker* profiler = GetNodeProfiler())
+        {
+            AZ::ScriptContext* scriptContext = AZ::ScriptContext::FromNativeContext(lua);
+            profiler->ReportNodeOutput(scriptContext, GetAllocatedBytes(scriptContext));
+            return IsGraphObserved(executionState);
+        }
+
+        return true;
+    }
+
     void PopulateSignalDatum(lua_State* lua, int stackIndex, DatumValue& datumValue, const ScriptCanvas::Grammar::DebugDataSource* debugDatumSource)
     {
         if (debugDatumSource->m_fromStack)
@@ -61,9 +107,8 @@ namespace ScriptCanvas
             AZ_Assert(executionState, "Error in compiled lua file, 1st argument to DebugIsTraced is not an ExecutionStateInterpreted");
             if (executionState)
             {
-                bool isObserved{};
-                ExecutionNotificationsBus::BroadcastResult(isObserved, &ExecutionNotifications::IsGraphObserved, executionState->GetEntityId(), executionState->GetGraphIdentifier());
-                lua_pushboolean(lua, isObserved);
+                // the node profiler relies on the traced execution too
+                lua_pushboolean(lua, ExecutionInterpretedDebugAPIcpp::GetNodeProfiler() || ExecutionInterpretedDebugAPIcpp::IsGraphObserved(*executionState));
             }
             else
             {
@@ -97,6 +142,11 @@ namespace ScriptCanvas
 
             if (const Grammar::DebugExecution* debugIn = executionState->GetDebugSymbolIn(debugExecutionIndex))
             {
+                if (!ExecutionInterpretedDebugAPIcpp::ProfileSignalIn(lua, *executionState, executionState->GetAssetId(), *debugIn))
+                {
+                    return 0;
+                }
+
                 InputSignal inSignal(GraphInfo(executionState->GetEntityId(), executionState->GetGraphIdentifier()));
                 inSignal.m_endpoint = debugIn->m_namedEndpoint;
                 ExecutionInterpretedDebugAPIcpp::PopulateSignalData(lua, 3, inSignal, debugIn->m_data);
@@ -121,6 +171,11 @@ namespace ScriptCanvas
 
             if (const Grammar::DebugExecution* debugIn = executionState->GetDebugSymbolIn(debugExecutionIndex, subgraphId))
             {
+                if (!ExecutionInterpretedDebugAPIcpp::ProfileSignalIn(lua, *executionState, subgraphId, *debugIn))
+                {
+                    return 0;
+                }
+
                 InputSignal inSignal(GraphInfo(executionState->GetEntityId(), executionState->GetGraphIdentifier(subgraphId)));
                 inSignal.m_endpoint = debugIn->m_namedEndpoint;
                 ExecutionInterpretedDebugAPIcpp::PopulateSignalData(lua, 4, inSignal, debugIn->m_data);
@@ -142,6 +197,11 @@ namespace ScriptCanvas
 
             if (const Grammar::DebugExecution* debugOut = executionState->GetDebugSymbolOut(debugExecutionIndex))
             {
+                if (!ExecutionInterpretedDebugAPIcpp::ProfileSignalOut(lua, *executionState))
+                {
+                    return 0;
+                }
+
                 OutputSignal outSignal(GraphInfo(executionState->GetEntityId(), executionState->GetGraphIdentifier()));
                 outSignal.m_endpoint = debugOut->m_namedEndpoint;
                 ExecutionInterpretedDebugAPIcpp::PopulateSignalData(lua, 3, outSignal, debugOut->m_data);
@@ -166,6 +226,11 @@ namespace ScriptCanvas
 
             if (const Grammar::DebugExecution* debugOut = executionState->GetDebugSymbolOut(debugExecutionIndex, subgraphId))
             {
+                if (!ExecutionInterpretedDebugAPIcpp::ProfileSignalOut(lua, *executionState))
+                {
+                    return 0;
+                }
+
                 OutputSignal outSignal(GraphInfo(executionState->GetEntityId(), executionState->GetGraphIdentifier(subgraphId)));
                 outSignal.m_endpoint = debugOut->m_namedEndpoint;
                 ExecutionInterpretedDebugAPIcpp::PopulateSignalData(lua, 4, outSignal, debugOut->m_data);
@@ -218,6 +283,11 @@ namespace ScriptCanvas
 
             if (const Grammar::DebugDataSource* variableChangeSymbol = executionState->GetDebugSymbolVariableChange(debugVariableChangeIndex))
             {
+                if (ExecutionInterpretedDebugAPIcpp::GetNodeProfiler() && !ExecutionInterpretedDebugAPIcpp::IsGraphObserved(*executionState))
+                {
+                    return 0;
+                }
+
                 DatumValue value;
                 ExecutionInterpretedDebugAPIcpp::PopulateSignalDatum(lua, 3, value, variableChangeSymbol);
                 VariableChange variableChangeSignal(GraphInfo(executionState->GetEntityId(), executionState->GetGraphIdentifier()), value);
@@ -243,6 +313,11 @@ namespace ScriptCanvas
 
             if (const Grammar::DebugDataSource* variableChangeSymbol = executionState->GetDebugSymbolVariableChange(debugVariableChangeIndex, subgraphId))
             {
+                if (ExecutionInterpretedDebugAPIcpp::GetNodeProfiler() && !ExecutionInterpretedDebugAPIcpp::IsGraphObserved(*executionState))
+                {
+                    return 0;
+                }
+
                 DatumValue value;
                 ExecutionInterpretedDebugAPIcpp::PopulateSignalDatum(lua, 4, value, variableChangeSymbol);
                 VariableChange variableChangeSignal(GraphInfo(executionState->GetEntityId(), executionState->GetGraphIdentifier(subgraphId)), value);
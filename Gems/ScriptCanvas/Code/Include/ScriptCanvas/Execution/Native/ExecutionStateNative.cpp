@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "ExecutionStateNative.h"
+
+#include <AzCore/RTTI/BehaviorContext.h>
+
+#include "Execution/ExecutionContext.h"
+#include "Execution/RuntimeComponent.h"
+
+namespace ScriptCanvas
+{
+    ExecutionStateNative::ExecutionStateNative(const ExecutionStateConfig& config, GraphStartFunction onGraphStart)
+        : ExecutionState(config)
+        , m_onGraphStart(onGraphStart)
+    {}
+
+    void ExecutionStateNative::Execute()
+    {
+        // the same activation inputs the Lua translation receives, in the same order
+        Execution::ActivationInputArray storage;
+        Execution::ActivationData data(m_component->GetRuntimeDataOverrides(), storage);
+        Execution::ActivationInputRange range = Execution::Context::CreateActivateInputRange(data, m_component->GetEntityId());
+        const RuntimeContext context(GetScriptCanvasId(), GetEntityId(), range.inputs, range.totalCount);
+        m_onGraphStart(context);
+    }
+
+    ExecutionMode ExecutionStateNative::GetExecutionMode() const
+    {
+        return ExecutionMode::Native;
+    }
+
+    void ExecutionStateNative::Initialize()
+    {}
+
+    void ExecutionStateNative::StopExecution()
+    {}
+
+    void ExecutionStateNative::Reflect(AZ::ReflectContext* reflectContext)
+    {
+        if (auto behaviorContext = azrtti_cast<AZ::BehaviorContext*>(reflectContext))
+        {
+            behaviorContext->Class<ExecutionStateNative>()
+                ;
+        }
+    }
+}
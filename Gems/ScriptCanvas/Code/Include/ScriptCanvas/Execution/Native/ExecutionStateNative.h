@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include "Execution/ExecutionState.h"
+#include "Execution/NativeHostDefinitions.h"
+
+namespace ScriptCanvas
+{
+    //! Runs a pure graph with an OnGraphStart through the C++ it was translated to, instead of through its Lua translation.
+    class ExecutionStateNative
+        : public ExecutionState
+    {
+    public:
+        AZ_RTTI(ExecutionStateNative, "{AB004F86-E810-472F-B20E-B269E20586B9}", ExecutionState);
+        AZ_CLASS_ALLOCATOR(ExecutionStateNative, AZ::SystemAllocator, 0);
+
+        static void Reflect(AZ::ReflectContext* reflectContext);
+
+        ExecutionStateNative(const ExecutionStateConfig& config, GraphStartFunction onGraphStart);
+
+        void Execute() override;
+
+        ExecutionMode GetExecutionMode() const override;
+
+        void Initialize() override;
+
+        void StopExecution() override;
+
+    private:
+        GraphStartFunction m_onGraphStart = nullptr;
+    };
+}
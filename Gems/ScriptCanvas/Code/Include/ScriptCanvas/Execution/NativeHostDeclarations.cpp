@@ -8,9 +8,24 @@
 
 #include "NativeHostDeclarations.h"
 
+#include <AzCore/RTTI/BehaviorContext.h>
+
 namespace ScriptCanvas
 {
     RuntimeContext::RuntimeContext(AZ::EntityId graphId)
         : m_graphId(graphId)
     {}
+
+    RuntimeContext::RuntimeContext(AZ::EntityId graphId, AZ::EntityId entityId, const AZ::BehaviorValueParameter* inputs, size_t inputCount)
+        : m_graphId(graphId)
+        , m_entityId(entityId)
+        , m_inputs(inputs)
+        , m_inputCount(inputCount)
+    {}
+
+    const AZ::BehaviorValueParameter& RuntimeContext::GetInput(size_t index) const
+    {
+        AZ_Assert(index < m_inputCount, "RuntimeContext input index %zu out of range, the graph received %zu inputs", index, m_inputCount);
+        return m_inputs[index];
+    }
 }
@@ -10,16 +10,34 @@
 
 #include <AzCore/Component/EntityId.h>
 
+namespace AZ
+{
+    struct BehaviorValueParameter;
+}
+
 namespace ScriptCanvas
 {
+    //! The arguments of a graph compiled to C++, the same ones the Lua translation of the graph receives on activation.
     class RuntimeContext
     {
     public:
-        RuntimeContext(AZ::EntityId graphId);      
-        
+        RuntimeContext(AZ::EntityId graphId);
+
+        RuntimeContext(AZ::EntityId graphId, AZ::EntityId entityId, const AZ::BehaviorValueParameter* inputs, size_t inputCount);
+
         AZ_INLINE AZ::EntityId GetGraphId() const { return m_graphId; }
 
+        AZ_INLINE AZ::EntityId GetEntityId() const { return m_entityId; }
+
+        //! The activation inputs of the graph, nodeables first, then variables, then entity ids.
+        const AZ::BehaviorValueParameter& GetInput(size_t index) const;
+
+        AZ_INLINE size_t GetInputCount() const { return m_inputCount; }
+
     protected:
         AZ::EntityId m_graphId;
+        AZ::EntityId m_entityId;
+        const AZ::BehaviorValueParameter* m_inputs = nullptr;
+        size_t m_inputCount = 0;
     };
 }
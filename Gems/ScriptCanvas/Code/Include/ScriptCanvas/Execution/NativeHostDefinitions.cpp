@@ -8,39 +8,109 @@
 
 #include "NativeHostDefinitions.h"
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <ScriptCanvas/Utils/BehaviorContextUtils.h>
 
 namespace NativeHostDefinitionsCPP
 {
     using namespace ScriptCanvas;
 
-    using FunctionMap = AZStd::unordered_map<AZStd::string, GraphStartFunction>;
-    FunctionMap s_functionMap;
+    enum class InitializeStatus
+    {
+        Pending,
+        Succeeded,
+        Failed,
+    };
+
+    struct GraphStartEntry
+    {
+        GraphStartFunction m_function = nullptr;
+        GraphInitializeFunction m_initialize = nullptr;
+        InitializeStatus m_status = InitializeStatus::Pending;
+    };
+
+    using FunctionMap = AZStd::unordered_map<AZStd::string, GraphStartEntry>;
+
+    // generated graphs register from static initializers of other modules, so the map has to exist before them
+    FunctionMap& GetFunctionMap()
+    {
+        static FunctionMap s_functionMap;
+        return s_functionMap;
+    }
+
+    AZStd::mutex& GetFunctionMapMutex()
+    {
+        static AZStd::mutex s_functionMapMutex;
+        return s_functionMapMutex;
+    }
 }
 
 namespace ScriptCanvas
 {
     bool CallNativeGraphStart(AZStd::string_view name, const RuntimeContext& context)
     {
-        using namespace NativeHostDefinitionsCPP;
-
-        auto iter = s_functionMap.find(name);
-        if (iter != s_functionMap.end())
+        if (GraphStartFunction function = FindNativeGraphStart(name))
         {
-            iter->second(context);
+            function(context);
             return true;
         }
 
         return false;
     }
 
+    GraphStartFunction FindNativeGraphStart(AZStd::string_view name)
+    {
+        using namespace NativeHostDefinitionsCPP;
+
+        AZStd::lock_guard<AZStd::mutex> lock(GetFunctionMapMutex());
+        FunctionMap& functionMap = GetFunctionMap();
+
+        auto iter = functionMap.find(name);
+        if (iter == functionMap.end())
+        {
+            return nullptr;
+        }
+
+        GraphStartEntry& entry = iter->second;
+        if (entry.m_status == InitializeStatus::Pending)
+        {
+            entry.m_status = (!entry.m_initialize || entry.m_initialize()) ? InitializeStatus::Succeeded : InitializeStatus::Failed;
+            AZ_Warning("ScriptCanvas", entry.m_status == InitializeStatus::Succeeded
+                , "Native graph %.*s failed to find the methods it calls, it will run the Lua translation instead"
+                , aznumeric_cast<int>(name.size()), name.data());
+        }
+
+        return entry.m_status == InitializeStatus::Succeeded ? entry.m_function : nullptr;
+    }
+
+    const AZ::BehaviorMethod* FindNativeMethod(MethodType methodType, AZStd::string_view className, AZStd::string_view methodName)
+    {
+        const AZ::BehaviorMethod* method = nullptr;
+        const AZ::BehaviorClass* behaviorClass = nullptr;
+        EventType eventType = EventType::Count;
+        return BehaviorContextUtils::FindMethod(method, behaviorClass, eventType, methodType, className, methodName) ? method : nullptr;
+    }
+
     bool RegisterNativeGraphStart(AZStd::string_view name, GraphStartFunction function)
+    {
+        return RegisterNativeGraphStart(name, function, nullptr);
+    }
+
+    bool RegisterNativeGraphStart(AZStd::string_view name, GraphStartFunction function, GraphInitializeFunction initialize)
     {
         using namespace NativeHostDefinitionsCPP;
-        
-        auto iter = s_functionMap.find(name);
-        if (iter == s_functionMap.end())
+
+        AZStd::lock_guard<AZStd::mutex> lock(GetFunctionMapMutex());
+        FunctionMap& functionMap = GetFunctionMap();
+
+        auto iter = functionMap.find(name);
+        if (iter == functionMap.end())
         {
-            s_functionMap.insert({ name, function });
+            GraphStartEntry entry;
+            entry.m_function = function;
+            entry.m_initialize = initialize;
+            functionMap.insert({ name, entry });
             return true;
         }
         
@@ -52,10 +122,13 @@ namespace ScriptCanvas
     {
         using namespace NativeHostDefinitionsCPP;
         
-        auto iter = s_functionMap.find(name);
-        if (iter != s_functionMap.end())
+        AZStd::lock_guard<AZStd::mutex> lock(GetFunctionMapMutex());
+        FunctionMap& functionMap = GetFunctionMap();
+
+        auto iter = functionMap.find(name);
+        if (iter != functionMap.end())
         {
-            s_functionMap.erase(iter);
+            functionMap.erase(iter);
             return true;
         }
 
@@ -6,18 +6,50 @@
  *
  */
 
+#pragma once
+
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/std/string/string_view.h>
+#include <ScriptCanvas/Core/MethodConfiguration.h>
+
 #include "NativeHostDeclarations.h"
 
 namespace ScriptCanvas
 {
-    typedef void (*GraphStartFunction)(const RuntimeContext&);
-
     using GraphStartFunction = void(*)(const RuntimeContext&);
 
+    // resolves everything the graph calls before it first starts, a failure leaves the graph to its Lua translation
+    using GraphInitializeFunction = bool(*)();
+
     bool CallNativeGraphStart(AZStd::string_view name, const RuntimeContext& context);
-    
+
+    //! Returns the native start function registered under the name, running its initialization the first time it is found.
+    //! Returns nullptr if there is no such function or if the initialization failed.
+    GraphStartFunction FindNativeGraphStart(AZStd::string_view name);
+
+    //! Finds the BehaviorContext method a Method node calls, so code generated from a graph looks it up once instead of per call.
+    const AZ::BehaviorMethod* FindNativeMethod(MethodType methodType, AZStd::string_view className, AZStd::string_view methodName);
+
+    //! Calls a method found with FindNativeMethod. A call that fails, like an event nobody handles, returns a default constructed value.
+    template<typename t_Return, typename... t_Args>
+    t_Return InvokeNativeMethod(const AZ::BehaviorMethod* method, t_Args&&... args)
+    {
+        if constexpr (AZStd::is_void_v<t_Return>)
+        {
+            method->Invoke(AZStd::forward<t_Args>(args)...);
+        }
+        else
+        {
+            t_Return result{};
+            method->InvokeResult(result, AZStd::forward<t_Args>(args)...);
+            return result;
+        }
+    }
+
     bool RegisterNativeGraphStart(AZStd::string_view name, GraphStartFunction function);
-    
+
+    bool RegisterNativeGraphStart(AZStd::string_view name, GraphStartFunction function, GraphInitializeFunction initialize);
+
     // this may never have to be necessary
     bool UnregisterNativeGraphStart(AZStd::string_view name);
 
@@ -17,5 +17,6 @@ namespace ScriptCanvas
         AZ_CVAR(bool, g_printAbstractCodeModelAtPrefabTime, false, {}, AZ::ConsoleFunctorFlags::Null, "Print out the Abstract Code Model at the end of parsing (at prefab time) for debug purposes.");
         AZ_CVAR(bool, g_saveRawTranslationOuputToFile, true, {}, AZ::ConsoleFunctorFlags::Null, "Save out the raw result of translation for debug purposes.");
         AZ_CVAR(bool, g_saveRawTranslationOuputToFileAtPrefabTime, false, {}, AZ::ConsoleFunctorFlags::Null, "Save out the raw result of translation (at prefab time) for debug purposes.");
+        AZ_CVAR(bool, g_translateToNativeCode, false, {}, AZ::ConsoleFunctorFlags::Null, "Also translate pure graphs to C++ source, saved to @usercache@/ScriptCanvasNative/ for compiling into a gem module.");
     }
 }
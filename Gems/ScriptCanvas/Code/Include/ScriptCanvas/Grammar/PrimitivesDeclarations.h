@@ -247,6 +247,7 @@ namespace ScriptCanvas
         AZ_CVAR_EXTERNED(bool, g_printAbstractCodeModelAtPrefabTime);
         AZ_CVAR_EXTERNED(bool, g_saveRawTranslationOuputToFile);
         AZ_CVAR_EXTERNED(bool, g_saveRawTranslationOuputToFileAtPrefabTime);
+        AZ_CVAR_EXTERNED(bool, g_translateToNativeCode);
 
         struct DependencyInfo
         {
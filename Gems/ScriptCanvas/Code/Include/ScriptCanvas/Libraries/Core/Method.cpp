@@ -653,71 +653,7 @@ namespace ScriptCanvas
 
             bool Method::GetBehaviorContextClassMethod(const AZStd::string&, const AZ::BehaviorClass*& outClass, const AZ::BehaviorMethod*& outMethod, EventType& outType) const
             {
-                AZStd::string prettyClassName;
-                AZStd::string methodName = m_lookupName;
-
-                const AZ::BehaviorClass* bcClass{};
-                const AZ::BehaviorMethod* method{};
-
-                if (BehaviorContextUtils::FindExplicitOverload(method, bcClass, m_className, methodName, &prettyClassName))
-                {
-                    outClass = bcClass;
-                    outMethod = method;
-                    outType = EventType::Count;
-                    return true;
-                }
-                else
-                {
-                    switch (m_methodType)
-                    {
-                    case MethodType::Event:
-                    {
-                        EventType eventType;
-                        if (BehaviorContextUtils::FindEvent(method, m_className, methodName, &eventType))
-                        {
-                            outClass = bcClass;
-                            outMethod = method;
-                            outType = eventType;
-                            return true;
-                        }
-                    }
-                    break;
-
-                    case MethodType::Free:
-                    {
-                        if (BehaviorContextUtils::FindFree(method, methodName))
-                        {
-                            outClass = bcClass;
-                            outMethod = method;
-                            outType = EventType::Count;
-                            return true;
-                        }
-                    }
-                    break;
-
-                    case MethodType::Member:
-                    case MethodType::Getter:
-                    case MethodType::Setter:
-                    {
-                        PropertyStatus status = m_methodType == MethodType::Getter ? PropertyStatus::Getter : m_methodType == MethodType::Setter ? PropertyStatus::Setter : PropertyStatus::None;
-
-                        if (BehaviorContextUtils::FindClass(method, bcClass, m_className, methodName, status, nullptr, m_warnOnMissingFunction))
-                        {
-                            outClass = bcClass;
-                            outMethod = method;
-                            outType = EventType::Count;
-                            return true;
-                        }
-                    }
-                    break;
-
-                    default:
-                        AZ_Warning("Script Canvas", !m_warnOnMissingFunction, "unsupported method type in method");
-                        break;
-                    }
-                }
-
-                return false;
+                return BehaviorContextUtils::FindMethod(outMethod, outClass, outType, m_methodType, m_className, m_lookupName, m_warnOnMissingFunction);
             }
 
             AZStd::tuple<const AZ::BehaviorMethod*, MethodType, EventType, const AZ::BehaviorClass*> Method::LookupMethod() const
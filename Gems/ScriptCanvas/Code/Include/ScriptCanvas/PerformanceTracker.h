@@ -7,11 +7,14 @@
  */
 #pragma once
 
+#include <AzCore/std/parallel/atomic.h>
 #include <ScriptCanvas/Execution/ExecutionBus.h>
 #include <ScriptCanvas/Execution/ExecutionPerformanceTimer.h>
 
 namespace ScriptCanvas
 {
+    class NamedEndpoint;
+
     namespace Execution
     {
         class PerformanceTimer;
@@ -52,6 +55,27 @@ namespace ScriptCanvas
             // Not thread safe
             const PerformanceReport& GetSnapshotReportFull() const;
 
+            //! Records the time, executions and allocations of every node of the graphs built with the debug configuration.
+            //! While it is off the graphs only pay for a check of the flag when they start executing.
+            void StartNodeProfiling();
+
+            void StopNodeProfiling();
+
+            bool IsNodeProfiling() const;
+
+            //! The nodes recorded since the profiling started, the slowest first.
+            AZStd::vector<NodePerformanceReport> GetNodeReports() const;
+
+            //! Saves every node execution recorded since the profiling started in the Chrome trace event format, on the same clock as
+            //! the Cpu profiler timeline, so the two can be opened side by side in chrome://tracing or Perfetto.
+            bool SaveNodeTimeline(const AZStd::string& outputFilePath) const;
+
+            //! The time from the input of a node to its output, or to the next input on the same context, is the time of the node.
+            //! The context is whatever runs the nodes one at a time, the Lua VM for interpreted graphs.
+            void ReportNodeInput(const void* executionContext, const AZ::Data::AssetId& assetId, const NamedEndpoint& endpoint, AZ::u64 allocatedBytes);
+
+            void ReportNodeOutput(const void* executionContext, AZ::u64 allocatedBytes);
+
         private:
             static PerformanceTrackingReport* ModOrCreateReport(PerformanceReportByAsset& reports, AZ::Data::AssetId key);
             static PerformanceTrackingReport GetReportByAsset(const PerformanceReportByAsset& report, AZ::Data::AssetId key);
@@ -88,6 +112,39 @@ namespace ScriptCanvas
             void ReportLatentTime(PerformanceKey key, const AZ::Data::AssetId& assetId, AZStd::sys_time_t);
 
             void ReportInitializationTime(PerformanceKey key, const AZ::Data::AssetId& assetId, AZStd::sys_time_t);
+
+            struct NodeRecord
+            {
+                NodePerformanceReport report;
+                AZStd::sys_time_t ticks = 0;
+            };
+
+            struct NodeSample
+            {
+                size_t nodeIndex;
+                AZStd::sys_time_t startTicks;
+                AZ::u64 startAllocatedBytes;
+            };
+
+            struct NodeTimelineEvent
+            {
+                size_t nodeIndex;
+                AZStd::sys_time_t startTicks;
+                AZStd::sys_time_t durationTicks;
+                AZ::u64 threadId;
+            };
+
+            // the timeline stops growing past this, the reports keep counting
+            static constexpr size_t k_maxNodeTimelineEvents = 1 << 20;
+
+            void CloseNodeSample(const void* executionContext, AZStd::sys_time_t nowTicks, AZ::u64 allocatedBytes);
+
+            AZStd::atomic_bool m_isNodeProfiling{ false };
+            mutable AZStd::mutex m_nodeProfilingMutex;
+            AZStd::vector<NodeRecord> m_nodeRecords;
+            AZStd::unordered_map<AZ::Data::AssetId, AZStd::unordered_map<AZ::EntityId, size_t>> m_nodeRecordIndices;
+            AZStd::unordered_map<const void*, NodeSample> m_openNodeSamples;
+            AZStd::vector<NodeTimelineEvent> m_nodeTimeline;
         };
     }
 }
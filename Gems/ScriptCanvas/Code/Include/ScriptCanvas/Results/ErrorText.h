@@ -88,6 +88,7 @@ namespace ScriptCanvas
         constexpr const char* SubgraphReturnValues = "Subgraph with Latent Outs do not support variables with Scope In or Scope InOut";
         constexpr const char* TooManyBranchesForReturn = "Too many branches for standard return values.";
         constexpr const char* UnexpectedSlotTypeFromNodeling = "unexpected slot type from nodeling";
+        constexpr const char* UnsupportedInNativeTranslationFormat = "The C++ translation does not support %s, the graph will run its Lua translation";
         constexpr const char* UntranslatedArithmetic = "Arithmetic operator added and not yet parsed";
         constexpr const char* UnusableVariableInFunctionDefinition = "Unusable variable in function definition.";
         constexpr const char* UserOutCallInLoop = "A subgraph Execution Out call was found in a loop. Execution Out must always be the last thing to happen in a Subgraph execution path";
@@ -8,8 +8,206 @@
 
 #include "GraphToCPlusPlus.h"
 
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <ScriptCanvas/Debugger/ValidationEvents/ParsingValidation/ParsingValidations.h>
 #include <ScriptCanvas/Grammar/AbstractCodeModel.h>
+#include <ScriptCanvas/Grammar/ParsingUtilities.h>
 #include <ScriptCanvas/Grammar/Primitives.h>
+#include <ScriptCanvas/Libraries/Core/Method.h>
+#include <ScriptCanvas/Results/ErrorText.h>
+
+#include <cmath>
+
+namespace GraphToCPlusPlusCPP
+{
+    using namespace ScriptCanvas;
+
+    // the names the generated start function uses itself, on top of the C++ keywords
+    const char* k_reservedWords[] =
+    {
+        "alignas", "alignof", "and", "and_eq", "asm", "auto", "bitand", "bitor", "bool", "break", "case", "catch", "char", "char16_t",
+        "char32_t", "class", "compl", "const", "constexpr", "const_cast", "continue", "decltype", "default", "delete", "do", "double",
+        "dynamic_cast", "else", "enum", "explicit", "export", "extern", "false", "float", "for", "friend", "goto", "if", "inline", "int",
+        "long", "mutable", "namespace", "new", "noexcept", "not", "not_eq", "nullptr", "operator", "or", "or_eq", "private", "protected",
+        "public", "register", "reinterpret_cast", "return", "short", "signed", "sizeof", "static", "static_assert", "static_cast",
+        "struct", "switch", "template", "this", "thread_local", "throw", "true", "try", "typedef", "typeid", "typename", "union",
+        "unsigned", "using", "virtual", "void", "volatile", "wchar_t", "while", "xor", "xor_eq",
+        "AZ", "AZStd", "context", "Data", "s_methods", "ScriptCanvas",
+    };
+
+    bool IsReservedWord(AZStd::string_view name)
+    {
+        for (const char* reservedWord : k_reservedWords)
+        {
+            if (name == reservedWord)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    AZStd::string_view ToTypeName(const Data::Type& type)
+    {
+        switch (type.GetType())
+        {
+        case Data::eType::AABB:
+            return "Data::AABBType";
+        case Data::eType::AssetId:
+            return "Data::AssetIdType";
+        case Data::eType::Boolean:
+            return "Data::BooleanType";
+        case Data::eType::Color:
+            return "Data::ColorType";
+        case Data::eType::CRC:
+            return "Data::CRCType";
+        case Data::eType::EntityID:
+            return "Data::EntityIDType";
+        case Data::eType::Matrix3x3:
+            return "Data::Matrix3x3Type";
+        case Data::eType::Matrix4x4:
+            return "Data::Matrix4x4Type";
+        case Data::eType::Number:
+            return "Data::NumberType";
+        case Data::eType::OBB:
+            return "Data::OBBType";
+        case Data::eType::Plane:
+            return "Data::PlaneType";
+        case Data::eType::Quaternion:
+            return "Data::QuaternionType";
+        case Data::eType::String:
+            return "Data::StringType";
+        case Data::eType::Transform:
+            return "Data::TransformType";
+        case Data::eType::Vector2:
+            return "Data::Vector2Type";
+        case Data::eType::Vector3:
+            return "Data::Vector3Type";
+        case Data::eType::Vector4:
+            return "Data::Vector4Type";
+        default:
+            return {};
+        }
+    }
+
+    // the types the arguments and results of the called methods are cast to, everything else stays behind the Lua translation
+    AZStd::string_view ToTypeName(const AZ::TypeId& typeId)
+    {
+        static const AZStd::pair<AZ::TypeId, AZStd::string_view> k_typeNames[] =
+        {
+            { azrtti_typeid<bool>(), "bool" },
+            { azrtti_typeid<float>(), "float" },
+            { azrtti_typeid<double>(), "double" },
+            { azrtti_typeid<AZ::s8>(), "AZ::s8" },
+            { azrtti_typeid<AZ::u8>(), "AZ::u8" },
+            { azrtti_typeid<AZ::s16>(), "AZ::s16" },
+            { azrtti_typeid<AZ::u16>(), "AZ::u16" },
+            { azrtti_typeid<AZ::s32>(), "AZ::s32" },
+            { azrtti_typeid<AZ::u32>(), "AZ::u32" },
+            { azrtti_typeid<AZ::s64>(), "AZ::s64" },
+            { azrtti_typeid<AZ::u64>(), "AZ::u64" },
+            { azrtti_typeid<AZStd::string>(), "AZStd::string" },
+            { azrtti_typeid<AZStd::string_view>(), "AZStd::string_view" },
+            { azrtti_typeid<AZ::EntityId>(), "AZ::EntityId" },
+            { azrtti_typeid<AZ::Vector2>(), "AZ::Vector2" },
+            { azrtti_typeid<AZ::Vector3>(), "AZ::Vector3" },
+            { azrtti_typeid<AZ::Vector4>(), "AZ::Vector4" },
+            { azrtti_typeid<AZ::Quaternion>(), "AZ::Quaternion" },
+            { azrtti_typeid<AZ::Transform>(), "AZ::Transform" },
+            { azrtti_typeid<AZ::Color>(), "AZ::Color" },
+            { azrtti_typeid<AZ::Crc32>(), "AZ::Crc32" },
+            { azrtti_typeid<AZ::Aabb>(), "AZ::Aabb" },
+            { azrtti_typeid<AZ::Matrix3x3>(), "AZ::Matrix3x3" },
+            { azrtti_typeid<AZ::Matrix4x4>(), "AZ::Matrix4x4" },
+            { azrtti_typeid<AZ::Obb>(), "AZ::Obb" },
+            { azrtti_typeid<AZ::Plane>(), "AZ::Plane" },
+            { azrtti_typeid<AZ::Data::AssetId>(), "AZ::Data::AssetId" },
+        };
+
+        for (const auto& typeName : k_typeNames)
+        {
+            if (typeName.first == typeId)
+            {
+                return typeName.second;
+            }
+        }
+
+        return {};
+    }
+
+    AZStd::string_view ToMethodTypeName(MethodType methodType)
+    {
+        switch (methodType)
+        {
+        case MethodType::Event:
+            return "MethodType::Event";
+        case MethodType::Free:
+            return "MethodType::Free";
+        case MethodType::Member:
+            return "MethodType::Member";
+        case MethodType::Getter:
+            return "MethodType::Getter";
+        case MethodType::Setter:
+            return "MethodType::Setter";
+        default:
+            return {};
+        }
+    }
+
+    AZStd::string ToFloatString(float value)
+    {
+        AZStd::string result = AZStd::string::format("%.9g", value);
+        if (result.find_first_of(".en") == AZStd::string::npos)
+        {
+            result += ".0";
+        }
+        result += "f";
+        return result;
+    }
+
+    AZStd::string ToStringLiteral(AZStd::string_view value)
+    {
+        AZStd::string result = "\"";
+
+        for (char character : value)
+        {
+            switch (character)
+            {
+            case '\\':
+                result += "\\\\";
+                break;
+            case '"':
+                result += "\\\"";
+                break;
+            case '\n':
+                result += "\\n";
+                break;
+            case '\r':
+                result += "\\r";
+                break;
+            case '\t':
+                result += "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(character) < 0x20)
+                {
+                    // octal escapes are always 3 digits, unlike hex escapes they can't swallow the characters after them
+                    result += AZStd::string::format("\\%03o", static_cast<unsigned char>(character));
+                }
+                else
+                {
+                    result += character;
+                }
+                break;
+            }
+        }
+
+        result += "\"";
+        return result;
+    }
+}
 
 namespace ScriptCanvas
 {
@@ -20,6 +218,8 @@ namespace ScriptCanvas
             Configuration configuration;
             configuration.m_blockCommentClose = "*/";
             configuration.m_blockCommentOpen = "/*";
+            configuration.m_executionStateEntityIdRef = "context.GetEntityId()";
+            configuration.m_executionStateScriptCanvasIdRef = "context.GetGraphId()";
             configuration.m_namespaceClose = "}";
             configuration.m_namespaceOpen = "{";
             configuration.m_namespaceOpenPrefix = "namespace";
@@ -30,30 +230,129 @@ namespace ScriptCanvas
         }
 
         GraphToCPlusPlus::GraphToCPlusPlus(const Grammar::AbstractCodeModel& model)
-            : GraphToX(CreateCPlusPluseConfig(), model) 
+            : GraphToX(CreateCPlusPluseConfig(), model)
+            , m_className(GetNativeClassName(model.GetSource()))
+        {
+            MarkTranslationStart();
+
+            if (IsSupported())
+            {
+                // inside the ScriptCanvas and AutoNative namespaces, and the start function
+                m_declarations.SetIndent(3);
+                m_body.SetIndent(3);
+                TranslateStartNode();
+                TranslateVariables();
+            }
+
+            if (IsSuccessfull())
+            {
+                WriteHeaderDotH();
+                WriteHeaderDotCPP();
+                TranslateDependenciesDotCPP();
+
+                TranslateNamespaceOpen();
+                {
+                    TranslateClassOpen();
+                    TranslateClassClose();
+                    TranslateInitialize();
+                    TranslateRegister();
+
+                    m_dotCPP.WriteLineIndented("void %s::%s([[maybe_unused]] const RuntimeContext& context)", m_className.data(), Grammar::k_OnGraphStartFunctionName);
+                    OpenScope(m_dotCPP);
+                    {
+                        if (!m_methods.empty())
+                        {
+                            m_dotCPP.WriteLineIndented("using namespace %sCPP;", m_className.data());
+                        }
+
+                        m_dotCPP.Write(AZStd::string_view(m_declarations.GetOutput()));
+                        m_dotCPP.Write(AZStd::string_view(m_body.GetOutput()));
+                    }
+                    CloseScope(m_dotCPP);
+                }
+                TranslateNamespaceClose();
+            }
+
+            MarkTranslationStop();
+        }
+
+        size_t GraphToCPlusPlus::AddMethod(const Nodes::Core::Method& method)
         {
-            WriteHeaderDotH();
-            WriteHeaderDotCPP();
-            
-            TranslateDependenciesDotH();
-            TranslateDependenciesDotCPP();
-                        
-            TranslateNamespaceOpen();
+            const MethodType methodType = method.GetMethodType();
+            const AZStd::string& className = method.GetRawMethodClassName();
+            const AZStd::string& methodName = method.GetName();
+
+            for (size_t index = 0; index < m_methods.size(); ++index)
             {
-                TranslateClassOpen();
+                const NativeMethod& nativeMethod = m_methods[index];
+                if (nativeMethod.m_methodType == methodType && nativeMethod.m_className == className && nativeMethod.m_methodName == methodName)
                 {
-                    TranslateVariables();
-                    TranslateHandlers();
-                    TranslateConstruction();
-                    TranslateDestruction();
-                    TranslateStartNode();
+                    return index;
                 }
-                TranslateClassClose();
             }
-            TranslateNamespaceClose();
+
+            m_methods.push_back({ methodType, className, methodName });
+            return m_methods.size() - 1;
+        }
+
+        void GraphToCPlusPlus::AddUnsupportedError(Grammar::ExecutionTreeConstPtr execution, AZStd::string_view unsupported)
+        {
+            const AZ::EntityId nodeId = execution ? execution->GetNodeId() : AZ::EntityId();
+            const AZStd::string description = AZStd::string::format(ParseErrors::UnsupportedInNativeTranslationFormat, AZStd::string(unsupported).data());
+            AddError(execution, aznew Internal::ParseError(nodeId, description));
+        }
+
+        AZStd::string GraphToCPlusPlus::GetVariableName(Grammar::VariableConstPtr variable)
+        {
+            AZStd::string name = variable->m_name;
+
+            if (GraphToCPlusPlusCPP::IsReservedWord(name))
+            {
+                Grammar::ProtectReservedWords(name);
+            }
+
+            return name;
         }
 
-        AZ::Outcome<void, AZStd::pair<AZStd::string, AZStd::string>> GraphToCPlusPlus::Translate(const Grammar::AbstractCodeModel& model, AZStd::string& dotH, AZStd::string& dotCPP)
+        bool GraphToCPlusPlus::IsSupported()
+        {
+            if (m_model.GetExecutionCharacteristics() != Grammar::ExecutionCharacteristics::Pure)
+            {
+                AddUnsupportedError(nullptr, "graphs that keep state between calls");
+            }
+            else if (!m_model.GetInterface().HasOnGraphStart() || !m_model.GetStart())
+            {
+                AddUnsupportedError(nullptr, "graphs without On Graph Start");
+            }
+            else if (m_model.GetStart()->HasReturnValues())
+            {
+                AddUnsupportedError(m_model.GetStart(), "On Graph Start with return values");
+            }
+            else if (!m_model.GetFunctions().empty())
+            {
+                AddUnsupportedError(nullptr, "graphs with functions");
+            }
+            else if (!m_model.GetRuntimeInputs().m_nodeables.empty() || !m_model.GetNodeableParse().empty())
+            {
+                AddUnsupportedError(nullptr, "nodes that keep state between calls");
+            }
+            else if (!m_model.GetRuntimeInputs().m_staticVariables.empty() || !m_model.GetStaticVariablesNames().empty())
+            {
+                AddUnsupportedError(nullptr, "variables that can't be constructed in code");
+            }
+            else if (!m_model.GetEBusHandlings().empty() || !m_model.GetEventHandlings().empty())
+            {
+                AddUnsupportedError(nullptr, "event handlers");
+            }
+            else if (m_model.GetInterface().RequiresConstructionParametersForDependencies())
+            {
+                AddUnsupportedError(nullptr, "graphs that depend on other graphs");
+            }
+
+            return IsSuccessfull();
+        }
+
+        AZ::Outcome<void, ErrorList> GraphToCPlusPlus::Translate(const Grammar::AbstractCodeModel& model, AZStd::string& dotH, AZStd::string& dotCPP)
         {
             GraphToCPlusPlus translation(model);
 
@@ -65,7 +364,14 @@ namespace ScriptCanvas
             }
             else
             {
-                return AZ::Failure(AZStd::make_pair(AZStd::string(".h errors"), AZStd::string(".cpp errors")));
+                ErrorList errors;
+
+                for (const auto& error : translation.GetErrors())
+                {
+                    errors.emplace_back(error->GetDescription());
+                }
+
+                return AZ::Failure(AZStd::move(errors));
             }
         }
 
@@ -77,47 +383,277 @@ namespace ScriptCanvas
             m_dotH.WriteSpace();
             SingleLineComment(m_dotH);
             m_dotH.WriteSpace();
-            m_dotH.WriteLine("class %s", GetGraphName().data());
+            m_dotH.WriteLine("class %s", m_className.data());
         }
 
         void GraphToCPlusPlus::TranslateClassOpen()
         {
-            m_dotH.WriteIndent();
-            m_dotH.WriteLine("class %s", GetGraphName().data());
-            m_dotH.WriteIndent();
-            m_dotH.WriteLine("{");
+            m_dotH.WriteLineIndented("class %s", m_className.data());
+            m_dotH.WriteLineIndented("{");
+            m_dotH.WriteLineIndented("public:");
+            m_dotH.Indent();
+            {
+                m_dotH.WriteLineIndented("// call once when the module that compiles this file is loaded");
+                m_dotH.WriteLineIndented("static bool Register();");
+                m_dotH.WriteNewLine();
+                m_dotH.WriteLineIndented("static void %s(const RuntimeContext& context);", Grammar::k_OnGraphStartFunctionName);
+            }
+            m_dotH.Outdent();
+            m_dotH.WriteNewLine();
+            m_dotH.WriteLineIndented("private:");
             m_dotH.Indent();
+            m_dotH.WriteLineIndented("static bool Initialize();");
         }
 
-        void GraphToCPlusPlus::TranslateConstruction()
+        void GraphToCPlusPlus::TranslateDependenciesDotCPP()
         {
+            m_dotCPP.WriteLine("#include <AzCore/Math/MathUtils.h>");
+            m_dotCPP.WriteLine("#include <AzCore/RTTI/BehaviorContext.h>");
+            m_dotCPP.WriteLine("#include <ScriptCanvas/Data/Data.h>");
+            m_dotCPP.WriteLine("#include <ScriptCanvas/Execution/NativeHostDefinitions.h>");
+            m_dotCPP.WriteNewLine();
 
+            if (!m_methods.empty())
+            {
+                // named after the class, so the array doesn't collide with the ones of other graphs in unity builds
+                m_dotCPP.WriteLine("namespace %sCPP", m_className.data());
+                m_dotCPP.WriteLine("{");
+                m_dotCPP.Indent();
+                m_dotCPP.WriteLineIndented("const AZ::BehaviorMethod* s_methods[%zu] = {};", m_methods.size());
+                m_dotCPP.Outdent();
+                m_dotCPP.WriteLine("}");
+                m_dotCPP.WriteNewLine();
+            }
         }
 
-        void GraphToCPlusPlus::TranslateDependencies()
+        void GraphToCPlusPlus::TranslateExecutionTreeEntry(Grammar::ExecutionTreeConstPtr execution)
         {
-            TranslateDependenciesDotH();
-            TranslateDependenciesDotCPP();
+            if (!IsSuccessfull())
+            {
+                return;
+            }
+
+            switch (execution->GetSymbol())
+            {
+            case Grammar::Symbol::CompareEqual:
+            case Grammar::Symbol::CompareGreater:
+            case Grammar::Symbol::CompareGreaterEqual:
+            case Grammar::Symbol::CompareLess:
+            case Grammar::Symbol::CompareLessEqual:
+            case Grammar::Symbol::CompareNotEqual:
+            case Grammar::Symbol::LogicalAND:
+            case Grammar::Symbol::LogicalNOT:
+            case Grammar::Symbol::LogicalOR:
+            case Grammar::Symbol::FunctionCall:
+            case Grammar::Symbol::OperatorAddition:
+            case Grammar::Symbol::OperatorDivision:
+            case Grammar::Symbol::OperatorMultiplication:
+            case Grammar::Symbol::OperatorSubraction:
+            case Grammar::Symbol::VariableAssignment:
+                TranslateExecutionTreeFunctionCall(execution);
+                break;
+
+            case Grammar::Symbol::IfCondition:
+                // writes its own children, the branches need a scope each even if they are empty
+                TranslateIfCondition(execution);
+                return;
+
+            case Grammar::Symbol::VariableDeclaration:
+            {
+                auto variable = execution->GetInput(0).m_value;
+                const AZStd::string_view typeName = GraphToCPlusPlusCPP::ToTypeName(variable->m_datum.GetType());
+                const AZStd::string value = ToValueString(execution, variable->m_datum);
+
+                if (typeName.empty())
+                {
+                    AddUnsupportedError(execution, AZStd::string::format("variables of type %s", Data::GetName(variable->m_datum.GetType()).data()));
+                }
+                else if (!value.empty())
+                {
+                    m_body.WriteLineIndented("[[maybe_unused]] %.*s %s = %s;", aznumeric_cast<int>(typeName.size()), typeName.data(), GetVariableName(variable).data(), value.data());
+                    m_declaredVariables.insert(variable);
+                }
+                break;
+            }
+
+            case Grammar::Symbol::DebugInfoEmptyStatement:
+            case Grammar::Symbol::PlaceHolderDuringParsing:
+            case Grammar::Symbol::Sequence:
+                break;
+
+            default:
+                AddUnsupportedError(execution, AZStd::string::format("%s nodes", Grammar::GetSymbolName(execution->GetSymbol())));
+                return;
+            }
+
+            for (size_t childIndex = 0; childIndex < execution->GetChildrenCount(); ++childIndex)
+            {
+                const auto& child = execution->GetChild(childIndex);
+
+                if (child.m_execution && !child.m_execution->IsInternalOut())
+                {
+                    TranslateExecutionTreeEntry(child.m_execution);
+                }
+            }
         }
 
-        void GraphToCPlusPlus::TranslateDependenciesDotH()
+        void GraphToCPlusPlus::TranslateExecutionTreeFunctionCall(Grammar::ExecutionTreeConstPtr execution)
         {
+            if (execution->GetNodeable())
+            {
+                AddUnsupportedError(execution, "nodes that keep state between calls");
+                return;
+            }
+            else if (Grammar::IsUserFunctionCall(execution))
+            {
+                AddUnsupportedError(execution, "function calls");
+                return;
+            }
+            else if (execution->GetChildrenCount() == 1 && execution->GetChild(0).m_output.size() > 1)
+            {
+                AddUnsupportedError(execution, "nodes with multiple results");
+                return;
+            }
+            else if (Grammar::IsExecutedPropertyExtraction(execution) || !execution->GetPropertyExtractionSources().empty())
+            {
+                AddUnsupportedError(execution, "property extraction");
+                return;
+            }
+            else if (Grammar::IsWrittenMathExpression(execution))
+            {
+                AddUnsupportedError(execution, "math expressions");
+                return;
+            }
+            else if (Grammar::IsEventConnectCall(execution) || Grammar::IsEventDisconnectCall(execution))
+            {
+                AddUnsupportedError(execution, "event connections");
+                return;
+            }
+            else if (Grammar::IsGlobalPropertyRead(execution) || Grammar::IsClassPropertyRead(execution) || Grammar::IsClassPropertyWrite(execution))
+            {
+                AddUnsupportedError(execution, "properties");
+                return;
+            }
+
+            const bool isWrittenOutputPossible = execution->GetChildrenCount() == 1 && !execution->GetChild(0).m_output.empty();
+            const bool isValueExpression = Grammar::IsLogicalExpression(execution)
+                || Grammar::IsVariableGet(execution)
+                || Grammar::IsVariableSet(execution)
+                || execution->GetSymbol() == Grammar::Symbol::VariableAssignment
+                || Grammar::IsOperatorArithmetic(execution);
+
+            // an expression without an output has no effect
+            if (!isValueExpression || isWrittenOutputPossible)
+            {
+                m_body.WriteIndent();
 
+                if (isWrittenOutputPossible)
+                {
+                    WriteVariableWrite(execution);
+                }
+
+                if (Grammar::IsLogicalExpression(execution))
+                {
+                    WriteLogicalExpression(execution);
+                }
+                else if (Grammar::IsVariableGet(execution) || Grammar::IsVariableSet(execution) || execution->GetSymbol() == Grammar::Symbol::VariableAssignment)
+                {
+                    WriteFunctionCallInput(execution, 0);
+                }
+                else if (Grammar::IsOperatorArithmetic(execution))
+                {
+                    WriteArithmeticExpression(execution);
+                }
+                else
+                {
+                    WriteFunctionCallOfNode(execution);
+                }
+
+                m_body.WriteLine(";");
+            }
+
+            WriteOutputAssignments(execution);
         }
 
-        void GraphToCPlusPlus::TranslateDependenciesDotCPP()
+        void GraphToCPlusPlus::TranslateIfCondition(Grammar::ExecutionTreeConstPtr execution)
         {
+            if (execution->GetInputCount() != 1)
+            {
+                AddUnsupportedError(execution, "If nodes without a condition");
+                return;
+            }
+
+            m_body.WriteIndented("if (");
+            WriteFunctionCallInput(execution, 0);
+            m_body.WriteLine(")");
+
+            for (size_t childIndex = 0; childIndex < AZStd::min(execution->GetChildrenCount(), size_t(2)); ++childIndex)
+            {
+                if (childIndex == 1)
+                {
+                    m_body.WriteLineIndented("else");
+                }
 
+                OpenScope(m_body);
+                {
+                    const auto& child = execution->GetChild(childIndex);
+
+                    if (child.m_execution && !child.m_execution->IsInternalOut())
+                    {
+                        TranslateExecutionTreeEntry(child.m_execution);
+                    }
+                }
+                CloseScope(m_body);
+            }
         }
 
-        void GraphToCPlusPlus::TranslateDestruction()
+        void GraphToCPlusPlus::TranslateInitialize()
         {
+            m_dotCPP.WriteLineIndented("bool %s::Initialize()", m_className.data());
+            OpenScope(m_dotCPP);
+            {
+                if (!m_methods.empty())
+                {
+                    m_dotCPP.WriteLineIndented("using namespace %sCPP;", m_className.data());
+                    m_dotCPP.WriteNewLine();
+
+                    for (size_t index = 0; index < m_methods.size(); ++index)
+                    {
+                        const NativeMethod& method = m_methods[index];
+                        const AZStd::string_view methodType = GraphToCPlusPlusCPP::ToMethodTypeName(method.m_methodType);
+                        m_dotCPP.WriteLineIndented("s_methods[%zu] = FindNativeMethod(%.*s, %s, %s);", index
+                            , aznumeric_cast<int>(methodType.size()), methodType.data()
+                            , GraphToCPlusPlusCPP::ToStringLiteral(method.m_className).data()
+                            , GraphToCPlusPlusCPP::ToStringLiteral(method.m_methodName).data());
+                    }
+
+                    m_dotCPP.WriteNewLine();
+                    m_dotCPP.WriteLineIndented("for (const AZ::BehaviorMethod* method : s_methods)");
+                    OpenScope(m_dotCPP);
+                    {
+                        m_dotCPP.WriteLineIndented("if (!method)");
+                        OpenScope(m_dotCPP);
+                        {
+                            m_dotCPP.WriteLineIndented("return false;");
+                        }
+                        CloseScope(m_dotCPP);
+                    }
+                    CloseScope(m_dotCPP);
+                    m_dotCPP.WriteNewLine();
+                }
 
+                m_dotCPP.WriteLineIndented("return true;");
+            }
+            CloseScope(m_dotCPP);
+            m_dotCPP.WriteNewLine();
         }
-                
-        void GraphToCPlusPlus::TranslateHandlers()
-        {
 
+        void GraphToCPlusPlus::TranslateNamespaceClose()
+        {
+            CloseNamespace(m_dotH, GetAutoNativeNamespace());
+            CloseNamespace(m_dotH, "ScriptCanvas");
+            CloseNamespace(m_dotCPP, GetAutoNativeNamespace());
+            CloseNamespace(m_dotCPP, "ScriptCanvas");
         }
 
         void GraphToCPlusPlus::TranslateNamespaceOpen()
@@ -128,51 +664,372 @@ namespace ScriptCanvas
             OpenNamespace(m_dotCPP, GetAutoNativeNamespace());
         }
 
-        void GraphToCPlusPlus::TranslateNamespaceClose()
+        void GraphToCPlusPlus::TranslateRegister()
         {
-            CloseNamespace(m_dotH, "ScriptCanvas");
-            CloseNamespace(m_dotH, GetAutoNativeNamespace());
-            CloseNamespace(m_dotCPP, "ScriptCanvas");
-            CloseNamespace(m_dotCPP, GetAutoNativeNamespace());
+            // the runtime finds the native start function by the id of the source graph, see ExecutionStateNative
+            const AZStd::string graphId = m_model.GetSource().m_assetId.m_guid.ToString<AZStd::string>();
+            m_dotCPP.WriteLineIndented("bool %s::Register()", m_className.data());
+            OpenScope(m_dotCPP);
+            {
+                m_dotCPP.WriteLineIndented("return RegisterNativeGraphStart(\"%s\", &%s::%s, &%s::Initialize);"
+                    , graphId.data(), m_className.data(), Grammar::k_OnGraphStartFunctionName, m_className.data());
+            }
+            CloseScope(m_dotCPP);
+            m_dotCPP.WriteNewLine();
         }
 
         void GraphToCPlusPlus::TranslateStartNode()
         {
-            // write a start function
-            const Node* startNode = nullptr;
-            
-            if (startNode)
+            auto start = m_model.GetStart();
+
+            WriteOutputAssignments(start);
+
+            if (start->GetChildrenCount() > 0 && start->GetChild(0).m_execution)
             {
-                { // .h
-                    m_dotH.WriteIndent();
-                    m_dotH.WriteLine("public: static void %s(const RuntimeContext& context);", Grammar::k_OnGraphStartFunctionName);
+                TranslateExecutionTreeEntry(start->GetChild(0).m_execution);
+            }
+        }
+
+        void GraphToCPlusPlus::TranslateVariables()
+        {
+            if (!IsSuccessfull())
+            {
+                return;
+            }
+
+            // the activation inputs, in the order the execution state passes them in
+            const auto& runtimeInputs = m_model.GetRuntimeInputs();
+            const AZStd::vector<Grammar::VariableConstPtr> inputs = m_model.CombineVariableLists(runtimeInputs.m_nodeables, runtimeInputs.m_variables, runtimeInputs.m_entityIds);
+
+            for (size_t index = 0; index < inputs.size(); ++index)
+            {
+                const auto& input = inputs[index];
+
+                if (m_usedVariables.contains(input))
+                {
+                    const AZStd::string_view typeName = GraphToCPlusPlusCPP::ToTypeName(input->m_datum.GetType());
+                    if (typeName.empty())
+                    {
+                        AddUnsupportedError(nullptr, AZStd::string::format("variables of type %s", Data::GetName(input->m_datum.GetType()).data()));
+                        return;
+                    }
+
+                    m_declarations.WriteLineIndented("[[maybe_unused]] %.*s %s = *context.GetInput(%zu).GetAsUnsafe<%.*s>();"
+                        , aznumeric_cast<int>(typeName.size()), typeName.data(), GetVariableName(input).data(), index
+                        , aznumeric_cast<int>(typeName.size()), typeName.data());
+                    m_declaredVariables.insert(input);
                 }
-                
-                { // .cpp
-                    m_dotCPP.WriteIndent();
-                    m_dotCPP.WriteLine("void %s::%s(const RuntimeContext& context)", GetGraphName().data(), Grammar::k_OnGraphStartFunctionName);
-                    OpenScope(m_dotCPP);
+            }
+
+            if (const auto localVariables = m_model.GetLocalVariables(m_model.GetStart()))
+            {
+                for (const auto& variable : *localVariables)
+                {
+                    if (m_usedVariables.contains(variable) && !m_declaredVariables.contains(variable)
+                        && Grammar::ParseConstructionRequirement(variable) == Grammar::VariableConstructionRequirement::None)
                     {
-                        m_dotCPP.WriteIndent();
-                        m_dotCPP.WriteLine("AZ_TracePrintf(\"ScriptCanvas\", \"This call wasn't generated from parsing a print node!\");");
-                        m_dotCPP.WriteLine("LogNotificationBus::Event(context.GetGraphId(), &LogNotifications::LogMessage, \"This call wasn't generated from parsing a print node!\");");
-                        // get the related function call and call it
-                        // with possible appropriate variables
+                        const AZStd::string_view typeName = GraphToCPlusPlusCPP::ToTypeName(variable->m_datum.GetType());
+                        if (typeName.empty())
+                        {
+                            AddUnsupportedError(nullptr, AZStd::string::format("variables of type %s", Data::GetName(variable->m_datum.GetType()).data()));
+                            return;
+                        }
+
+                        const AZStd::string value = ToValueString(nullptr, variable->m_datum);
+                        if (value.empty())
+                        {
+                            return;
+                        }
+
+                        m_declarations.WriteLineIndented("[[maybe_unused]] %.*s %s = %s;"
+                            , aznumeric_cast<int>(typeName.size()), typeName.data(), GetVariableName(variable).data(), value.data());
+                        m_declaredVariables.insert(variable);
                     }
-                    CloseScope(m_dotCPP);
                 }
             }
+
+            for (const auto& variable : m_usedVariables)
+            {
+                if (!m_declaredVariables.contains(variable))
+                {
+                    AddUnsupportedError(variable->m_source, AZStd::string::format("the initialization of variable %s", variable->m_name.data()));
+                    return;
+                }
+            }
+
+            if (!m_declarations.GetOutput().empty() && !m_body.GetOutput().empty())
+            {
+                m_declarations.WriteNewLine();
+            }
         }
 
-        void GraphToCPlusPlus::TranslateVariables()
+        AZStd::string GraphToCPlusPlus::ToValueString(Grammar::ExecutionTreeConstPtr execution, const Datum& datum)
         {
+            using namespace GraphToCPlusPlusCPP;
+
+            switch (datum.GetType().GetType())
+            {
+            case Data::eType::Boolean:
+                return *datum.GetAs<Data::BooleanType>() ? "true" : "false";
+
+            case Data::eType::Number:
+            {
+                const Data::NumberType number = *datum.GetAs<Data::NumberType>();
+                if (!std::isfinite(number))
+                {
+                    break;
+                }
+
+                AZStd::string result = AZStd::string::format("%.17g", number);
+                if (result.find_first_of(".e") == AZStd::string::npos)
+                {
+                    result += ".0";
+                }
+                return result;
+            }
+
+            case Data::eType::String:
+                // a string type, so two literals can be added together
+                return AZStd::string::format("Data::StringType(%s)", ToStringLiteral(*datum.GetAs<Data::StringType>()).data());
+
+            case Data::eType::Vector2:
+            {
+                const Data::Vector2Type& vector = *datum.GetAs<Data::Vector2Type>();
+                return AZStd::string::format("Data::Vector2Type(%s, %s)", ToFloatString(vector.GetX()).data(), ToFloatString(vector.GetY()).data());
+            }
+
+            case Data::eType::Vector3:
+            {
+                const Data::Vector3Type& vector = *datum.GetAs<Data::Vector3Type>();
+                return AZStd::string::format("Data::Vector3Type(%s, %s, %s)", ToFloatString(vector.GetX()).data(), ToFloatString(vector.GetY()).data()
+                    , ToFloatString(vector.GetZ()).data());
+            }
+
+            case Data::eType::Vector4:
+            {
+                const Data::Vector4Type& vector = *datum.GetAs<Data::Vector4Type>();
+                return AZStd::string::format("Data::Vector4Type(%s, %s, %s, %s)", ToFloatString(vector.GetX()).data(), ToFloatString(vector.GetY()).data()
+                    , ToFloatString(vector.GetZ()).data(), ToFloatString(vector.GetW()).data());
+            }
+
+            case Data::eType::Quaternion:
+            {
+                const Data::QuaternionType& quaternion = *datum.GetAs<Data::QuaternionType>();
+                return AZStd::string::format("Data::QuaternionType(%s, %s, %s, %s)", ToFloatString(quaternion.GetX()).data(), ToFloatString(quaternion.GetY()).data()
+                    , ToFloatString(quaternion.GetZ()).data(), ToFloatString(quaternion.GetW()).data());
+            }
+
+            case Data::eType::Color:
+            {
+                const Data::ColorType& color = *datum.GetAs<Data::ColorType>();
+                return AZStd::string::format("Data::ColorType(%s, %s, %s, %s)", ToFloatString(color.GetR()).data(), ToFloatString(color.GetG()).data()
+                    , ToFloatString(color.GetB()).data(), ToFloatString(color.GetA()).data());
+            }
+
+            case Data::eType::Transform:
+            {
+                const Data::TransformType& transform = *datum.GetAs<Data::TransformType>();
+                const AZ::Vector3 translation = transform.GetTranslation();
+                const AZ::Quaternion rotation = transform.GetRotation();
+                return AZStd::string::format("Data::TransformType(Data::Vector3Type(%s, %s, %s), Data::QuaternionType(%s, %s, %s, %s), %s)"
+                    , ToFloatString(translation.GetX()).data(), ToFloatString(translation.GetY()).data(), ToFloatString(translation.GetZ()).data()
+                    , ToFloatString(rotation.GetX()).data(), ToFloatString(rotation.GetY()).data(), ToFloatString(rotation.GetZ()).data()
+                    , ToFloatString(rotation.GetW()).data(), ToFloatString(transform.GetUniformScale()).data());
+            }
+
+            case Data::eType::CRC:
+                return AZStd::string::format("Data::CRCType(%uu)", static_cast<AZ::u32>(*datum.GetAs<Data::CRCType>()));
+
+            case Data::eType::EntityID:
+            {
+                const Data::EntityIDType& entityId = *datum.GetAs<Data::EntityIDType>();
+                if (entityId == GraphOwnerId || entityId == UniqueId)
+                {
+                    return EntityIdValueToString(entityId, m_configuration);
+                }
 
+                return AZStd::string::format("Data::EntityIDType(%lluull)", static_cast<unsigned long long>(static_cast<AZ::u64>(entityId)));
+            }
+
+            default:
+                break;
+            }
+
+            AddUnsupportedError(execution, AZStd::string::format("values of type %s", Data::GetName(datum.GetType()).data()));
+            return {};
         }
 
-        void GraphToCPlusPlus::WriteHeader()
+        void GraphToCPlusPlus::WriteArithmeticExpression(Grammar::ExecutionTreeConstPtr execution)
         {
-            WriteHeaderDotH();
-            WriteHeaderDotCPP();
+            const auto count = execution->GetInputCount();
+
+            if (count < 2)
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), ParseErrors::NotEnoughInputForArithmeticOperator));
+                return;
+            }
+
+            const Data::Type type = execution->GetInput(0).m_value->m_datum.GetType();
+            const bool isStringAddition = type == Data::Type::String() && execution->GetSymbol() == Grammar::Symbol::OperatorAddition;
+
+            if (type != Data::Type::Number() && !isStringAddition)
+            {
+                AddUnsupportedError(execution, AZStd::string::format("arithmetic on values of type %s", Data::GetName(type).data()));
+                return;
+            }
+
+            AZStd::string_view operatorString;
+
+            switch (execution->GetSymbol())
+            {
+            case Grammar::Symbol::OperatorAddition:
+                operatorString = " + ";
+                break;
+            case Grammar::Symbol::OperatorDivision:
+                operatorString = " / ";
+                break;
+            case Grammar::Symbol::OperatorMultiplication:
+                operatorString = " * ";
+                break;
+            case Grammar::Symbol::OperatorSubraction:
+                operatorString = " - ";
+                break;
+            default:
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), ParseErrors::UntranslatedArithmetic));
+                return;
+            }
+
+            for (size_t i(0); i < (count - 1); ++i)
+            {
+                m_body.Write("(");
+            }
+
+            // write operand 0 + operand 1
+            WriteFunctionCallInput(execution, 0);
+            m_body.Write(operatorString);
+            WriteFunctionCallInput(execution, 1);
+            m_body.Write(")");
+
+            for (size_t i(2); i < count; ++i)
+            {
+                m_body.Write(operatorString);
+                WriteFunctionCallInput(execution, i);
+                m_body.Write(")");
+            }
+        }
+
+        void GraphToCPlusPlus::WriteFunctionCallInput(Grammar::ExecutionTreeConstPtr execution, size_t index)
+        {
+            if (index >= execution->GetInputCount())
+            {
+                AddUnsupportedError(execution, "nodes with missing input");
+                return;
+            }
+
+            if (execution->GetConversions().find(index) != execution->GetConversions().end())
+            {
+                AddUnsupportedError(execution, "type conversions");
+                return;
+            }
+
+            auto input = execution->GetInput(index).m_value;
+
+            if (input->m_source != execution || input->m_requiresCreationFunction)
+            {
+                WriteVariableReference(input);
+            }
+            else
+            {
+                m_body.Write(AZStd::string_view(ToValueString(execution, input->m_datum)));
+            }
+        }
+
+        void GraphToCPlusPlus::WriteFunctionCallOfNode(Grammar::ExecutionTreeConstPtr execution)
+        {
+            using namespace GraphToCPlusPlusCPP;
+
+            const auto* methodNode = azrtti_cast<const Nodes::Core::Method*>(execution->GetId().m_node);
+            if (!methodNode)
+            {
+                AddUnsupportedError(execution, AZStd::string::format("%s nodes", execution->GetName().data()));
+                return;
+            }
+
+            if (methodNode->IsMethodOverloaded() || methodNode->IsCheckedOperation() || methodNode->BranchesOnResult()
+                || Grammar::IsFunctionCallNullCheckRequired(execution))
+            {
+                AddUnsupportedError(execution, "overloaded, checked or branching methods");
+                return;
+            }
+
+            const AZ::BehaviorMethod* method = methodNode->GetMethod();
+            if (!method || ToMethodTypeName(methodNode->GetMethodType()).empty())
+            {
+                AddUnsupportedError(execution, AZStd::string::format("the method %s", execution->GetName().data()));
+                return;
+            }
+
+            if (method->GetNumArguments() != execution->GetInputCount())
+            {
+                AddUnsupportedError(execution, "methods with default or hidden arguments");
+                return;
+            }
+
+            AZStd::vector<AZStd::string_view> argumentTypes;
+
+            for (size_t index = 0; index < method->GetNumArguments(); ++index)
+            {
+                const AZ::BehaviorParameter* argument = method->GetArgument(index);
+                const bool isThisPointer = index == 0 && methodNode->GetMethodType() == MethodType::Member;
+                const bool isByValue = (argument->m_traits & AZ::BehaviorParameter::TR_POINTER) == 0
+                    && ((argument->m_traits & AZ::BehaviorParameter::TR_REFERENCE) == 0 || (argument->m_traits & AZ::BehaviorParameter::TR_CONST) != 0);
+                const AZStd::string_view typeName = ToTypeName(argument->m_typeId);
+
+                if ((!isByValue && !isThisPointer) || typeName.empty())
+                {
+                    AddUnsupportedError(execution, AZStd::string::format("the arguments of method %s", execution->GetName().data()));
+                    return;
+                }
+
+                argumentTypes.push_back(typeName);
+            }
+
+            const bool isResultWritten = execution->GetChildrenCount() == 1 && !execution->GetChild(0).m_output.empty();
+            AZStd::string_view resultType = "void";
+            AZStd::string_view outputType;
+
+            if (isResultWritten)
+            {
+                const AZ::BehaviorParameter* result = method->HasResult() ? method->GetResult() : nullptr;
+                outputType = ToTypeName(execution->GetChild(0).m_output[0].second->m_source->m_datum.GetType());
+                resultType = result ? ToTypeName(result->m_typeId) : AZStd::string_view();
+
+                if (!result || (result->m_traits & (AZ::BehaviorParameter::TR_POINTER | AZ::BehaviorParameter::TR_REFERENCE)) != 0
+                    || resultType.empty() || outputType.empty())
+                {
+                    AddUnsupportedError(execution, AZStd::string::format("the result of method %s", execution->GetName().data()));
+                    return;
+                }
+
+                m_body.Write("static_cast<%.*s>(", aznumeric_cast<int>(outputType.size()), outputType.data());
+            }
+
+            const size_t methodIndex = AddMethod(*methodNode);
+            m_body.Write("InvokeNativeMethod<%.*s>(s_methods[%zu]", aznumeric_cast<int>(resultType.size()), resultType.data(), methodIndex);
+
+            for (size_t index = 0; index < argumentTypes.size(); ++index)
+            {
+                m_body.Write(", static_cast<%.*s>(", aznumeric_cast<int>(argumentTypes[index].size()), argumentTypes[index].data());
+                WriteFunctionCallInput(execution, index);
+                m_body.Write(")");
+            }
+
+            m_body.Write(")");
+
+            if (isResultWritten)
+            {
+                m_body.Write(")");
+            }
         }
 
         void GraphToCPlusPlus::WriteHeaderDotCPP()
@@ -181,7 +1038,7 @@ namespace ScriptCanvas
             m_dotCPP.WriteNewLine();
             WriteDoNotModify(m_dotCPP);
             m_dotCPP.WriteNewLine();
-            m_dotCPP.WriteLine("#include \"%s.h\"", GetGraphName().data());
+            m_dotCPP.WriteLine("#include \"%s.h\"", m_className.data());
             m_dotCPP.WriteNewLine();
         }
 
@@ -193,9 +1050,140 @@ namespace ScriptCanvas
             m_dotH.WriteNewLine();
             WriteDoNotModify(m_dotH);
             m_dotH.WriteNewLine();
-            m_dotH.WriteLine("#include <Execution/NativeHostDeclarations.h>");
+            m_dotH.WriteLine("#include <ScriptCanvas/Execution/NativeHostDeclarations.h>");
             m_dotH.WriteNewLine();
         }
 
-    } 
-} 
+        void GraphToCPlusPlus::WriteLogicalExpression(Grammar::ExecutionTreeConstPtr execution)
+        {
+            if (execution->GetSymbol() == Grammar::Symbol::LogicalNOT)
+            {
+                m_body.Write("!(");
+                WriteFunctionCallInput(execution, 0);
+                m_body.Write(")");
+            }
+            else if (Grammar::IsFloatingPointNumberEqualityComparison(execution))
+            {
+                // AZ::GetAbs(lhs - rhs) <= 0.000001, the same tolerance the Lua translation uses
+                m_body.Write("AZ::GetAbs(");
+                WriteFunctionCallInput(execution, 0);
+                m_body.Write(" - ");
+                WriteFunctionCallInput(execution, 1);
+                m_body.Write(execution->GetSymbol() == Grammar::Symbol::CompareEqual ? ") <= %s" : ") > %s", Grammar::k_LuaEpsilonString);
+            }
+            else
+            {
+                AZStd::string_view operatorString;
+
+                switch (execution->GetSymbol())
+                {
+                case Grammar::Symbol::CompareEqual:
+                    operatorString = " == ";
+                    break;
+                case Grammar::Symbol::CompareGreater:
+                    operatorString = " > ";
+                    break;
+                case Grammar::Symbol::CompareGreaterEqual:
+                    operatorString = " >= ";
+                    break;
+                case Grammar::Symbol::CompareLess:
+                    operatorString = " < ";
+                    break;
+                case Grammar::Symbol::CompareLessEqual:
+                    operatorString = " <= ";
+                    break;
+                case Grammar::Symbol::CompareNotEqual:
+                    operatorString = " != ";
+                    break;
+                case Grammar::Symbol::LogicalAND:
+                    operatorString = " && ";
+                    break;
+                case Grammar::Symbol::LogicalOR:
+                    operatorString = " || ";
+                    break;
+                default:
+                    AddUnsupportedError(execution, AZStd::string::format("%s nodes", Grammar::GetSymbolName(execution->GetSymbol())));
+                    return;
+                }
+
+                m_body.Write("(");
+                WriteFunctionCallInput(execution, 0);
+                m_body.Write(operatorString);
+                WriteFunctionCallInput(execution, 1);
+                m_body.Write(")");
+            }
+        }
+
+        void GraphToCPlusPlus::WriteOutputAssignments(Grammar::ExecutionTreeConstPtr execution)
+        {
+            if (const auto output = execution->GetLocalOutput())
+            {
+                for (const auto& outputIter : *output)
+                {
+                    if (outputIter.second->m_assignments.empty())
+                    {
+                        continue;
+                    }
+
+                    if (!outputIter.second->m_sourceConversions.empty())
+                    {
+                        AddUnsupportedError(execution, "type conversions");
+                        return;
+                    }
+
+                    for (const auto& assignment : outputIter.second->m_assignments)
+                    {
+                        if (!m_model.GetVariableHandling(assignment).empty())
+                        {
+                            AddUnsupportedError(execution, "variable change handlers");
+                            return;
+                        }
+
+                        m_body.WriteIndent();
+                        WriteVariableReference(assignment);
+                        m_body.Write(" = ");
+                        WriteVariableReference(outputIter.second->m_source);
+                        m_body.WriteLine(";");
+                    }
+                }
+            }
+        }
+
+        void GraphToCPlusPlus::WriteVariableReference(Grammar::VariableConstPtr variable)
+        {
+            AZ_Assert(variable, "non valid variable");
+
+            m_usedVariables.insert(variable);
+            m_body.Write(AZStd::string_view(GetVariableName(variable)));
+        }
+
+        void GraphToCPlusPlus::WriteVariableWrite(Grammar::ExecutionTreeConstPtr execution)
+        {
+            auto output = execution->GetChild(0).m_output[0].second->m_source;
+
+            if (!m_model.GetVariableHandling(output).empty())
+            {
+                AddUnsupportedError(execution, "variable change handlers");
+                return;
+            }
+
+            if (output->m_source == execution)
+            {
+                const AZStd::string_view typeName = GraphToCPlusPlusCPP::ToTypeName(output->m_datum.GetType());
+                if (typeName.empty())
+                {
+                    AddUnsupportedError(execution, AZStd::string::format("variables of type %s", Data::GetName(output->m_datum.GetType()).data()));
+                    return;
+                }
+
+                m_body.Write("[[maybe_unused]] %.*s %s = ", aznumeric_cast<int>(typeName.size()), typeName.data(), GetVariableName(output).data());
+                m_declaredVariables.insert(output);
+            }
+            else
+            {
+                WriteVariableReference(output);
+                m_body.Write(" = ");
+            }
+        }
+    }
+}
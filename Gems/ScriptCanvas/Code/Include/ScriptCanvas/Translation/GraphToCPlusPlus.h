@@ -9,9 +9,12 @@
 #pragma once
 
 #include <AzCore/Outcome/Outcome.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <ScriptCanvas/Core/MethodConfiguration.h>
 
-#include "TranslationUtilities.h"
 #include "GraphToX.h"
+#include "TranslationResult.h"
+#include "TranslationUtilities.h"
 
 namespace ScriptCanvas
 {
@@ -22,39 +25,74 @@ namespace ScriptCanvas
         class AbstractCodeModel;
     }
 
+    namespace Nodes
+    {
+        namespace Core
+        {
+            class Method;
+        }
+    }
+
     namespace Translation
     {
+        //! Translates pure graphs that only run On Graph Start to a C++ class, which a gem module compiles and registers with
+        //! RegisterNativeGraphStart. The methods the graph calls are looked up in the BehaviorContext once, when the graph first runs,
+        //! and called directly after that, without the Lua VM in between. Any graph, or node, that is not supported fails the
+        //! translation, and the graph keeps running its Lua translation.
         class GraphToCPlusPlus
             : public GraphToX
         {
         public:
-            static AZ::Outcome<void, AZStd::pair<AZStd::string, AZStd::string>> Translate(const Grammar::AbstractCodeModel& model, AZStd::string& dotH, AZStd::string& dotCPP);
-            
-            AZ_INLINE bool IsSuccessfull() const { return false;  }
-        private:         
+            static AZ::Outcome<void, ErrorList> Translate(const Grammar::AbstractCodeModel& model, AZStd::string& dotH, AZStd::string& dotCPP);
+
+        private:
+            struct NativeMethod
+            {
+                MethodType m_methodType;
+                AZStd::string m_className;
+                AZStd::string m_methodName;
+            };
+
             // cpp only
             Writer m_dotH;
             Writer m_dotCPP;
-            
+            // the local variable declarations and the statements of the start function, written first and inserted in the .cpp at the end
+            Writer m_declarations;
+            Writer m_body;
+            AZStd::string m_className;
+            AZStd::vector<NativeMethod> m_methods;
+            AZStd::unordered_set<Grammar::VariableConstPtr> m_usedVariables;
+            AZStd::unordered_set<Grammar::VariableConstPtr> m_declaredVariables;
+
             GraphToCPlusPlus(const Grammar::AbstractCodeModel& model);
 
+            size_t AddMethod(const Nodes::Core::Method& method);
+            void AddUnsupportedError(Grammar::ExecutionTreeConstPtr execution, AZStd::string_view unsupported);
+            AZStd::string GetVariableName(Grammar::VariableConstPtr variable);
+            bool IsSupported();
+            AZStd::string ToValueString(Grammar::ExecutionTreeConstPtr execution, const Datum& datum);
             void TranslateClassClose();
             void TranslateClassOpen();
-            void TranslateConstruction();
-            void TranslateDependencies();
-            void TranslateDependenciesDotH();
             void TranslateDependenciesDotCPP();
-            void TranslateDestruction();
-            void TranslateFunctions();
-            void TranslateHandlers();
-            void TranslateNamespaceOpen();
+            void TranslateExecutionTreeEntry(Grammar::ExecutionTreeConstPtr execution);
+            void TranslateExecutionTreeFunctionCall(Grammar::ExecutionTreeConstPtr execution);
+            void TranslateIfCondition(Grammar::ExecutionTreeConstPtr execution);
+            void TranslateInitialize();
             void TranslateNamespaceClose();
+            void TranslateNamespaceOpen();
+            void TranslateRegister();
             void TranslateStartNode();
             void TranslateVariables();
-            void WriteHeader(); // Write, not translate, because this should be less dependent on the contents of the graph
-            void WriteHeaderDotH(); // Write, not translate, because this should be less dependent on the contents of the graph
+            void WriteArithmeticExpression(Grammar::ExecutionTreeConstPtr execution);
+            void WriteFunctionCallInput(Grammar::ExecutionTreeConstPtr execution, size_t index);
+            void WriteFunctionCallOfNode(Grammar::ExecutionTreeConstPtr execution);
             void WriteHeaderDotCPP(); // Write, not translate, because this should be less dependent on the contents of the graph
+            void WriteHeaderDotH(); // Write, not translate, because this should be less dependent on the contents of the graph
+            void WriteLogicalExpression(Grammar::ExecutionTreeConstPtr execution);
+            void WriteOutputAssignments(Grammar::ExecutionTreeConstPtr execution);
+            void WriteVariableReference(Grammar::VariableConstPtr variable);
+            void WriteVariableWrite(Grammar::ExecutionTreeConstPtr execution);
         };
-    } 
+    }
 
 }
@@ -48,6 +48,7 @@ namespace ScriptCanvas
             void CloseFunctionBlock(Writer& writer);
             void CloseScope(Writer& writer);
             void CloseNamespace(Writer& writer, AZStd::string_view ns);
+            const AZStd::vector<ValidationConstPtr>& GetErrors() const;
             AZStd::string_view GetGraphName() const;
             AZStd::string_view GetFullPath() const;
             AZStd::sys_time_t GetTranslationDuration() const;
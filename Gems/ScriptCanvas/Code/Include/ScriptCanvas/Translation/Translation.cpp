@@ -27,8 +27,7 @@ namespace TranslationCPP
     using namespace ScriptCanvas;
     using namespace ScriptCanvas::Translation;
 
-    /*
-    AZ::Outcome<AZStd::pair<AZStd::string, AZStd::string>, AZStd::pair<AZStd::string, AZStd::string>> ToCPlusPlus(const Grammar::AbstractCodeModel& model, bool rawSave = false)
+    AZ::Outcome<AZStd::pair<AZStd::string, AZStd::string>, ErrorList> ToCPlusPlus(const Grammar::AbstractCodeModel& model, bool rawSave = false)
     {
         AZStd::string dotH, dotCPP;
         auto outcome = GraphToCPlusPlus::Translate(model, dotH, dotCPP);
@@ -53,6 +52,18 @@ namespace TranslationCPP
                     AZ_TracePrintf("Save failed %s", saveOutcome.GetError().data());
                 }
             }
+
+            // the files a gem module compiles to run the graph natively, see ExecutionStateNative
+            auto saveOutcome = SaveNativeDotH(model.GetSource(), dotH);
+            if (saveOutcome.IsSuccess())
+            {
+                saveOutcome = SaveNativeDotCPP(model.GetSource(), dotCPP);
+            }
+            if (!saveOutcome.IsSuccess())
+            {
+                AZ_TracePrintf("ScriptCanvas", "Save failed %s", saveOutcome.GetError().data());
+            }
+
             return AZ::Success(AZStd::make_pair(AZStd::move(dotH), AZStd::move(dotCPP)));
         }
         else
@@ -60,7 +71,6 @@ namespace TranslationCPP
             return AZ::Failure(outcome.TakeError());
         }
     }
-    */
 
     AZ::Outcome<TargetResult, ErrorList> ToLua(const Grammar::AbstractCodeModel& model, bool rawSave = false)
     {
@@ -134,32 +144,26 @@ namespace ScriptCanvas
                     }
                 }
 
-                // Translation to C++ (executed via BehaviorContext calls) has been demonstrated in the past and is partially in progress.
-                // These calls allow for users to execute multiple translations from the same abstract code model.
-                // More work is required to complete all the latest features of the ACM, and do integrate output files into the build.
-                // 
-                //                 if (targetFlags & (TargetFlags::Cpp | TargetFlags::Hpp))
-                //                 {
-                //                     auto outcomeCPP = TranslationCPP::ToCPlusPlus(*model.get(), rawSave);
-                //                     if (outcomeCPP.IsSuccess())
-                //                     {
-                //                         auto hppAndCpp = outcomeCPP.TakeValue();
-                //                         
-                //                         TargetResult cppResult;
-                //                         cppResult.m_text = AZStd::move(hppAndCpp.first);
-                //                         translations.emplace(TargetFlags::Hpp, AZStd::move(cppResult));
-                //                         TargetResult hppResult;
-                //                         hppResult.m_text = AZStd::move(hppAndCpp.second);
-                //                         translations.emplace(TargetFlags::Cpp, AZStd::move(hppResult));
-                //                     }
-                //                     else
-                //                     {
-                //                         auto hppAndCpp = outcomeCPP.TakeError();
-                //                         errors.emplace(TargetFlags::Hpp, AZStd::move(hppAndCpp.first));
-                //                         errors.emplace(TargetFlags::Cpp, AZStd::move(hppAndCpp.second));
-                //                     }
-                //                 }
-
+                // Translation to C++ only supports a subset of graphs, a failure leaves the graph to its Lua translation.
+                if (request.translationTargetFlags & (TargetFlags::Cpp | TargetFlags::Hpp))
+                {
+                    auto outcomeCPP = TranslationCPP::ToCPlusPlus(*model.get(), request.rawSaveDebugOutput);
+                    if (outcomeCPP.IsSuccess())
+                    {
+                        auto hppAndCpp = outcomeCPP.TakeValue();
+
+                        TargetResult hppResult;
+                        hppResult.m_text = AZStd::move(hppAndCpp.first);
+                        translations.emplace(TargetFlags::Hpp, AZStd::move(hppResult));
+                        TargetResult cppResult;
+                        cppResult.m_text = AZStd::move(hppAndCpp.second);
+                        translations.emplace(TargetFlags::Cpp, AZStd::move(cppResult));
+                    }
+                    else
+                    {
+                        errors.emplace(TargetFlags::Cpp, outcomeCPP.TakeError());
+                    }
+                }
             }
 
             return Result(model, AZStd::move(translations), AZStd::move(errors));
@@ -24,6 +24,7 @@ namespace TranslationUtilitiesCPP
     
     const char* k_namespaceNameNative = "AutoNative";
     const char* k_fileDirectoryPathLua = "@usercache@/DebugScriptCanvas2LuaOutput/";
+    const char* k_fileDirectoryPathNative = "@usercache@/ScriptCanvasNative/";
     const char* k_space = " ";
     
     const size_t k_maxTabs = 20;
@@ -71,6 +72,11 @@ namespace TranslationUtilitiesCPP
         return AZStd::string::format("%s%s_VM.%s", TranslationUtilitiesCPP::k_fileDirectoryPathLua, source.m_name.data(), extension.data());
     }
 
+    AZStd::string GetNativeFilePath(const Grammar::Source& source, AZStd::string_view extension)
+    {
+        return AZStd::string::format("%s%s.%s", TranslationUtilitiesCPP::k_fileDirectoryPathNative, GetNativeClassName(source).data(), extension.data());
+    }
+
     class FileEventHandler
         : public AZ::IO::FileIOEventBus::Handler
     {
@@ -99,7 +105,7 @@ namespace TranslationUtilitiesCPP
         }
     };
 
-    AZ::Outcome<void, AZStd::string> SaveFile(const Grammar::Source& source, AZStd::string_view text, AZStd::string_view extension)
+    AZ::Outcome<void, AZStd::string> SaveFile(const AZStd::string& filePath, AZStd::string_view text)
     {
         AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
 
@@ -108,9 +114,6 @@ namespace TranslationUtilitiesCPP
             return AZ::Failure(AZStd::string("FileIOBase unavailable"));
         }
 
-        // \todo get a (debug) file path based on the extension
-        const AZStd::string filePath = TranslationUtilitiesCPP::GetDebugLuaFilePath(source, extension);
-
         FileEventHandler eventHandler;
 
         AZ::IO::HandleType fileHandle = AZ::IO::InvalidHandle;
@@ -135,6 +138,11 @@ namespace TranslationUtilitiesCPP
         return AZ::Success();
     }
 
+    AZ::Outcome<void, AZStd::string> SaveFile(const Grammar::Source& source, AZStd::string_view text, AZStd::string_view extension)
+    {
+        // \todo get a (debug) file path based on the extension
+        return SaveFile(TranslationUtilitiesCPP::GetDebugLuaFilePath(source, extension), text);
+    }
 }
 
 namespace ScriptCanvas
@@ -167,6 +175,11 @@ namespace ScriptCanvas
             return TranslationUtilitiesCPP::k_namespaceNameNative;
         }
 
+        AZStd::string GetNativeClassName(const Grammar::Source& source)
+        {
+            return Grammar::ToSafeName(source.m_name);
+        }
+
         AZStd::string_view GetCopyright()
         {
             return
@@ -195,6 +208,16 @@ namespace ScriptCanvas
             return TranslationUtilitiesCPP::SaveFile(source, dotH, "h");
         }
 
+        AZ::Outcome<void, AZStd::string> SaveNativeDotCPP(const Grammar::Source& source, AZStd::string_view dotCPP)
+        {
+            return TranslationUtilitiesCPP::SaveFile(TranslationUtilitiesCPP::GetNativeFilePath(source, "cpp"), dotCPP);
+        }
+
+        AZ::Outcome<void, AZStd::string> SaveNativeDotH(const Grammar::Source& source, AZStd::string_view dotH)
+        {
+            return TranslationUtilitiesCPP::SaveFile(TranslationUtilitiesCPP::GetNativeFilePath(source, "h"), dotH);
+        }
+
         AZ::Outcome<void, AZStd::string> SaveDotLua(const Grammar::Source& source, AZStd::string_view dotLua)
         {
             return TranslationUtilitiesCPP::SaveFile(source, dotLua, "lua");
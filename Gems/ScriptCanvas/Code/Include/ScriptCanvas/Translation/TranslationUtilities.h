@@ -41,12 +41,19 @@ namespace ScriptCanvas
 
         AZStd::string_view GetDoNotModifyCommentText();
 
+        //! The name of the class, and the files, the C++ translation of the graph is written to.
+        AZStd::string GetNativeClassName(const Grammar::Source& source);
+
         AZ::Outcome<void, AZStd::string> SaveDotCPP(const Grammar::Source& source, AZStd::string_view dotCPP);
 
         AZ::Outcome<void, AZStd::string> SaveDotH(const Grammar::Source& source, AZStd::string_view dotH);
 
         AZ::Outcome<void, AZStd::string> SaveDotLua(const Grammar::Source& source, AZStd::string_view dotLua);
 
+        AZ::Outcome<void, AZStd::string> SaveNativeDotCPP(const Grammar::Source& source, AZStd::string_view dotCPP);
+
+        AZ::Outcome<void, AZStd::string> SaveNativeDotH(const Grammar::Source& source, AZStd::string_view dotH);
+
         class Writer
         {
             friend class ScopedIndent;
@@ -283,6 +283,70 @@ namespace ScriptCanvas
         return true;
     }
 
+    bool BehaviorContextUtils::FindMethod(const AZ::BehaviorMethod*& outMethod, const AZ::BehaviorClass*& outClass, EventType& outEventType, MethodType methodType, AZStd::string_view className, AZStd::string_view methodName, bool warnOnMissing)
+    {
+        const AZ::BehaviorClass* bcClass{};
+        const AZ::BehaviorMethod* method{};
+
+        if (FindExplicitOverload(method, bcClass, className, methodName))
+        {
+            outClass = bcClass;
+            outMethod = method;
+            outEventType = EventType::Count;
+            return true;
+        }
+
+        switch (methodType)
+        {
+        case MethodType::Event:
+        {
+            EventType eventType;
+            if (FindEvent(method, className, methodName, &eventType, warnOnMissing))
+            {
+                outClass = bcClass;
+                outMethod = method;
+                outEventType = eventType;
+                return true;
+            }
+        }
+        break;
+
+        case MethodType::Free:
+        {
+            if (FindFree(method, methodName, warnOnMissing))
+            {
+                outClass = bcClass;
+                outMethod = method;
+                outEventType = EventType::Count;
+                return true;
+            }
+        }
+        break;
+
+        case MethodType::Member:
+        case MethodType::Getter:
+        case MethodType::Setter:
+        {
+            PropertyStatus status = methodType == MethodType::Getter ? PropertyStatus::Getter : methodType == MethodType::Setter ? PropertyStatus::Setter : PropertyStatus::None;
+
+            if (FindClass(method, bcClass, className, methodName, status, nullptr, warnOnMissing))
+            {
+                outClass = bcClass;
+                outMethod = method;
+                outEventType = EventType::Count;
+                return true;
+            }
+        }
+        break;
+
+        default:
+            AZ_Warning("Script Canvas", !warnOnMissing, "unsupported method type in method");
+            break;
+        }
+
+        return false;
+    }
+
     size_t BehaviorContextUtils::GenerateFingerprintForBehaviorContext()
     {
         size_t fingerprint = 0;
@@ -24,6 +24,7 @@ namespace ScriptCanvas
         static bool FindEvent(const AZ::BehaviorMethod*& outMethod, AZStd::string_view ebusName, AZStd::string_view eventName, EventType* outEventType = nullptr, bool warnOnMissing = true);
         static bool FindEvent(const AZ::BehaviorMethod*& outMethod, const AZ::BehaviorEBus* const ebus, AZStd::string_view eventName, EventType* outEventType = nullptr, bool warnOnMissing = true);
         static bool FindFree(const AZ::BehaviorMethod*& outMethod, AZStd::string_view methodName, bool warnOnMissing = true);
+        static bool FindMethod(const AZ::BehaviorMethod*& outMethod, const AZ::BehaviorClass*& outClass, EventType& outEventType, MethodType methodType, AZStd::string_view className, AZStd::string_view methodName, bool warnOnMissing = true);
 
         static size_t GenerateFingerprintForBehaviorContext();
         static size_t GenerateFingerprintForMethod(const MethodType& methodType, const AZStd::string& className, const AZStd::string& methodName);
@@ -6,9 +6,66 @@
  *
  */
 
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/TextStreamWriters.h>
+#include <AzCore/JSON/writer.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/sort.h>
+#include <ScriptCanvas/Core/Endpoint.h>
 #include <ScriptCanvas/Execution/ExecutionPerformanceTimer.h>
 
 #include <ScriptCanvas/PerformanceTracker.h>
+#include <ScriptCanvas/SystemComponent.h>
+
+namespace PerformanceTrackerCpp
+{
+    using namespace ScriptCanvas::Execution;
+
+    double TicksToMicroseconds(AZStd::sys_time_t ticks)
+    {
+        const double ticksPerSecond = aznumeric_cast<double>(AZStd::GetTimeTicksPerSecond());
+        return (aznumeric_cast<double>(ticks) * 1000000.0) / ticksPerSecond;
+    }
+
+    void sc_StartNodeProfiling([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (PerformanceTracker* tracker = ScriptCanvas::SystemComponent::ModPerformanceTracker())
+        {
+            tracker->StartNodeProfiling();
+        }
+    }
+
+    void sc_StopNodeProfiling(const AZ::ConsoleCommandContainer& arguments)
+    {
+        PerformanceTracker* tracker = ScriptCanvas::SystemComponent::ModPerformanceTracker();
+        if (!tracker || !tracker->IsNodeProfiling())
+        {
+            AZ_Warning("ScriptCanvas", false, "The node profiling isn't running, start it with sc_StartNodeProfiling.");
+            return;
+        }
+
+        tracker->StopNodeProfiling();
+
+        const AZStd::vector<NodePerformanceReport> reports = tracker->GetNodeReports();
+        AZ_TracePrintf("ScriptCanvas", "Slowest ScriptCanvas nodes:\n");
+        for (size_t i = 0; i < AZStd::GetMin(reports.size(), size_t(20)); ++i)
+        {
+            const NodePerformanceReport& report = reports[i];
+            AZ_TracePrintf("ScriptCanvas", "%9.3f ms %8u calls %10llu bytes  %s (%s)\n", aznumeric_cast<double>(report.executionTime) / 1000.0
+                , report.executionCount, aznumeric_cast<unsigned long long>(report.allocatedBytes), report.nodeName.c_str(), report.assetId.ToString<AZStd::string>().c_str());
+        }
+
+        if (!arguments.empty())
+        {
+            tracker->SaveNodeTimeline(AZStd::string(arguments.front()));
+        }
+    }
+
+    AZ_CONSOLEFREEFUNC(sc_StartNodeProfiling, AZ::ConsoleFunctorFlags::Null, "Starts recording the time, executions and allocations of every ScriptCanvas node, for graphs built with the debug configuration.");
+    AZ_CONSOLEFREEFUNC(sc_StopNodeProfiling, AZ::ConsoleFunctorFlags::Null, "Stops the ScriptCanvas node profiling and prints the slowest nodes. Pass a path to also save the timeline in the Chrome trace event format.");
+}
 
 namespace ScriptCanvas
 {
@@ -188,6 +245,158 @@ namespace ScriptCanvas
             }
         }
 
+        void PerformanceTracker::StartNodeProfiling()
+        {
+            AZStd::lock_guard lock(m_nodeProfilingMutex);
+            m_nodeRecords.clear();
+            m_nodeRecordIndices.clear();
+            m_openNodeSamples.clear();
+            m_nodeTimeline.clear();
+            m_isNodeProfiling = true;
+        }
+
+        void PerformanceTracker::StopNodeProfiling()
+        {
+            AZStd::lock_guard lock(m_nodeProfilingMutex);
+            m_isNodeProfiling = false;
+            m_openNodeSamples.clear();
+        }
+
+        bool PerformanceTracker::IsNodeProfiling() const
+        {
+            return m_isNodeProfiling;
+        }
+
+        AZStd::vector<NodePerformanceReport> PerformanceTracker::GetNodeReports() const
+        {
+            AZStd::vector<NodePerformanceReport> reports;
+            {
+                AZStd::lock_guard lock(m_nodeProfilingMutex);
+                reports.reserve(m_nodeRecords.size());
+                for (const NodeRecord& record : m_nodeRecords)
+                {
+                    reports.push_back(record.report);
+                    reports.back().executionTime = aznumeric_cast<AZStd::sys_time_t>(PerformanceTrackerCpp::TicksToMicroseconds(record.ticks));
+                }
+            }
+
+            AZStd::sort(reports.begin(), reports.end(), [](const NodePerformanceReport& lhs, const NodePerformanceReport& rhs)
+            {
+                return lhs.executionTime > rhs.executionTime;
+            });
+
+            return reports;
+        }
+
+        bool PerformanceTracker::SaveNodeTimeline(const AZStd::string& outputFilePath) const
+        {
+            AZ::IO::FileIOStream fileStream(outputFilePath.c_str(), AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeCreatePath);
+            if (!fileStream.IsOpen())
+            {
+                AZ_Warning("ScriptCanvas", false, "Failed to save the ScriptCanvas node timeline to file '%s'.", outputFilePath.c_str());
+                return false;
+            }
+
+            AZ::IO::RapidJSONStreamWriter stream(&fileStream);
+            rapidjson::Writer<AZ::IO::RapidJSONStreamWriter> writer(stream);
+
+            AZStd::lock_guard lock(m_nodeProfilingMutex);
+            writer.StartObject();
+            writer.Key("traceEvents");
+            writer.StartArray();
+            for (const NodeTimelineEvent& event : m_nodeTimeline)
+            {
+                const NodePerformanceReport& node = m_nodeRecords[event.nodeIndex].report;
+                // a complete event, which stores the begin time and the duration in a single event
+                writer.StartObject();
+                writer.Key("name");
+                writer.String(node.nodeName.c_str(), aznumeric_cast<rapidjson::SizeType>(node.nodeName.size()));
+                writer.Key("cat");
+                writer.String("ScriptCanvas");
+                writer.Key("ph");
+                writer.String("X");
+                writer.Key("ts");
+                writer.Double(PerformanceTrackerCpp::TicksToMicroseconds(event.startTicks));
+                writer.Key("dur");
+                writer.Double(PerformanceTrackerCpp::TicksToMicroseconds(event.durationTicks));
+                writer.Key("pid");
+                writer.Uint64(0);
+                writer.Key("tid");
+                writer.Uint64(event.threadId);
+                writer.Key("args");
+                writer.StartObject();
+                writer.Key("asset");
+                writer.String(node.assetId.ToString<AZStd::string>().c_str());
+                writer.EndObject();
+                writer.EndObject();
+            }
+            writer.EndArray();
+            writer.Key("displayTimeUnit");
+            writer.String("ms");
+            writer.EndObject();
+
+            AZ_TracePrintf("ScriptCanvas", "ScriptCanvas node timeline was saved to file [%s]\n", outputFilePath.c_str());
+            return true;
+        }
+
+        void PerformanceTracker::CloseNodeSample(const void* executionContext, AZStd::sys_time_t nowTicks, AZ::u64 allocatedBytes)
+        {
+            auto iter = m_openNodeSamples.find(executionContext);
+            if (iter == m_openNodeSamples.end())
+            {
+                return;
+            }
+
+            const NodeSample& sample = iter->second;
+            const AZStd::sys_time_t durationTicks = nowTicks - sample.startTicks;
+            NodeRecord& record = m_nodeRecords[sample.nodeIndex];
+            record.ticks += durationTicks;
+            record.report.allocatedBytes += allocatedBytes - sample.startAllocatedBytes;
+
+            if (m_nodeTimeline.size() < k_maxNodeTimelineEvents)
+            {
+                m_nodeTimeline.push_back({ sample.nodeIndex, sample.startTicks, durationTicks, AZStd::hash<AZStd::thread_id>{}(AZStd::this_thread::get_id()) });
+            }
+
+            m_openNodeSamples.erase(iter);
+        }
+
+        void PerformanceTracker::ReportNodeInput(const void* executionContext, const AZ::Data::AssetId& assetId, const NamedEndpoint& endpoint, AZ::u64 allocatedBytes)
+        {
+            const AZStd::sys_time_t nowTicks = AZStd::GetTimeNowTicks();
+            AZStd::lock_guard lock(m_nodeProfilingMutex);
+            if (!m_isNodeProfiling)
+            {
+                return;
+            }
+
+            CloseNodeSample(executionContext, nowTicks, allocatedBytes);
+
+            auto& nodeIndices = m_nodeRecordIndices[assetId];
+            auto indexIter = nodeIndices.find(endpoint.GetNodeId());
+            if (indexIter == nodeIndices.end())
+            {
+                indexIter = nodeIndices.insert({ endpoint.GetNodeId(), m_nodeRecords.size() }).first;
+                NodeRecord& record = m_nodeRecords.emplace_back();
+                record.report.assetId = assetId;
+                record.report.nodeId = endpoint.GetNodeId();
+                record.report.nodeName = endpoint.GetNodeName();
+            }
+
+            ++m_nodeRecords[indexIter->second].report.executionCount;
+            m_openNodeSamples[executionContext] = { indexIter->second, nowTicks, allocatedBytes };
+        }
+
+        void PerformanceTracker::ReportNodeOutput(const void* executionContext, AZ::u64 allocatedBytes)
+        {
+            const AZStd::sys_time_t nowTicks = AZStd::GetTimeNowTicks();
+            AZStd::lock_guard lock(m_nodeProfilingMutex);
+            if (m_isNodeProfiling)
+            {
+                CloseNodeSample(executionContext, nowTicks, allocatedBytes);
+            }
+        }
+
         void PerformanceTracker::ReportExecutionTime(PerformanceKey key, const AZ::Data::AssetId& assetId, AZStd::sys_time_t time)
         {
             GetOrCreateTimer(key)->AddExecutionTime(time);
@@ -32,6 +32,18 @@ namespace SurfaceData
         using MutexType = AZStd::recursive_mutex;
 
         virtual void ModifySurfacePoints(SurfacePointList& surfacePointList) const = 0;
+
+        //! Modify the surface points of a list of positions in one request. Positions without any surface points are skipped.
+        virtual void ModifySurfacePointsFromList(SurfacePointListPerPosition& surfacePointListPerPosition) const
+        {
+            for (auto& surfacePointListAndPoint : surfacePointListPerPosition)
+            {
+                if (!surfacePointListAndPoint.second.empty())
+                {
+                    ModifySurfacePoints(surfacePointListAndPoint.second);
+                }
+            }
+        }
     };
 
     typedef AZ::EBus<SurfaceDataModifierRequests> SurfaceDataModifierRequestBus;
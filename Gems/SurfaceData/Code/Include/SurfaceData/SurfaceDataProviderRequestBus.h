@@ -31,6 +31,17 @@ namespace SurfaceData
         using MutexType = AZStd::recursive_mutex;
 
         virtual void GetSurfacePoints(const AZ::Vector3& inPosition, SurfacePointList& surfacePointList) const = 0;
+
+        //! Get the surface points for a list of positions in one request, appending the points of each position to its list.
+        //! Only the XY components of the positions are used, and positions outside of the provider's bounds are expected to be
+        //! ignored. Providers that can lock their data or query it in bulk can override this to avoid the per point overhead.
+        virtual void GetSurfacePointsFromList(SurfacePointListPerPosition& surfacePointListPerPosition) const
+        {
+            for (auto& surfacePointListAndPoint : surfacePointListPerPosition)
+            {
+                GetSurfacePoints(surfacePointListAndPoint.first, surfacePointListAndPoint.second);
+            }
+        }
     };
 
     typedef AZ::EBus<SurfaceDataProviderRequests> SurfaceDataProviderRequestBus;
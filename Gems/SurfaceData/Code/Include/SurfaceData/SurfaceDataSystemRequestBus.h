@@ -41,6 +41,12 @@ namespace SurfaceData
         virtual void GetSurfacePointsFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, const SurfaceTagVector& desiredTags,
                                                 SurfacePointListPerPosition& surfacePointListPerPosition) const = 0;
 
+        // Get all surface points for every position in inPositions that match one or more of the desiredTags.  Only the XY components of the
+        // positions are used.  The providers and modifiers are queried once for the whole list, instead of once per position.  The lists in
+        // surfacePointListPerPosition are reused between calls, so callers that keep it around avoid reallocating them.
+        virtual void GetSurfacePointsFromList(const AZStd::vector<AZ::Vector3>& inPositions, const SurfaceTagVector& desiredTags,
+                                              SurfacePointListPerPosition& surfacePointListPerPosition) const = 0;
+
         virtual SurfaceDataRegistryHandle RegisterSurfaceDataProvider(const SurfaceDataRegistryEntry& entry) = 0;
         virtual void UnregisterSurfaceDataProvider(const SurfaceDataRegistryHandle& handle) = 0;
         virtual void UpdateSurfaceDataProvider(const SurfaceDataRegistryHandle& handle, const SurfaceDataRegistryEntry& entry) = 0;
@@ -204,6 +204,11 @@ namespace UnitTest
         {
         }
 
+        void GetSurfacePointsFromList([[maybe_unused]] const AZStd::vector<AZ::Vector3>& inPositions, [[maybe_unused]] const SurfaceData::SurfaceTagVector& desiredTags,
+            [[maybe_unused]] SurfaceData::SurfacePointListPerPosition& surfacePointListPerPosition) const override
+        {
+        }
+
         SurfaceData::SurfaceDataRegistryHandle RegisterSurfaceDataProvider(const SurfaceData::SurfaceDataRegistryEntry& entry) override
         {
             return RegisterEntry(entry, m_providers);
@@ -247,6 +247,25 @@ namespace SurfaceData
         }
     }
 
+    void SurfaceDataColliderComponent::GetSurfacePointsFromList(SurfacePointListPerPosition& surfacePointListPerPosition) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        // Lock the cache once for the whole list, and skip the positions outside of the collider before casting any rays.
+        AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
+
+        if (m_colliderBounds.IsValid())
+        {
+            for (auto& surfacePointListAndPoint : surfacePointListPerPosition)
+            {
+                if (AabbContains2D(m_colliderBounds, surfacePointListAndPoint.first))
+                {
+                    GetSurfacePoints(surfacePointListAndPoint.first, surfacePointListAndPoint.second);
+                }
+            }
+        }
+    }
+
     void SurfaceDataColliderComponent::ModifySurfacePoints(SurfacePointList& surfacePointList) const
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
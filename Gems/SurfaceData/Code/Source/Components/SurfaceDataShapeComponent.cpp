@@ -166,6 +166,25 @@ namespace SurfaceData
         }
     }
 
+    void SurfaceDataShapeComponent::GetSurfacePointsFromList(SurfacePointListPerPosition& surfacePointListPerPosition) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        // Lock the cache once for the whole list, and skip the positions outside of the shape before casting any rays.
+        AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
+
+        if (m_shapeBoundsIsValid)
+        {
+            for (auto& surfacePointListAndPoint : surfacePointListPerPosition)
+            {
+                if (AabbContains2D(m_shapeBounds, surfacePointListAndPoint.first))
+                {
+                    GetSurfacePoints(surfacePointListAndPoint.first, surfacePointListAndPoint.second);
+                }
+            }
+        }
+    }
+
     void SurfaceDataShapeComponent::ModifySurfacePoints(SurfacePointList& surfacePointList) const
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
@@ -190,6 +209,24 @@ namespace SurfaceData
         }
     }
 
+    void SurfaceDataShapeComponent::ModifySurfacePointsFromList(SurfacePointListPerPosition& surfacePointListPerPosition) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
+
+        if (m_shapeBoundsIsValid && !m_configuration.m_modifierTags.empty())
+        {
+            for (auto& surfacePointListAndPoint : surfacePointListPerPosition)
+            {
+                if (!surfacePointListAndPoint.second.empty() && AabbContains2D(m_shapeBounds, surfacePointListAndPoint.first))
+                {
+                    ModifySurfacePoints(surfacePointListAndPoint.second);
+                }
+            }
+        }
+    }
+
     void SurfaceDataShapeComponent::OnTransformChanged(const AZ::Transform& /*local*/, const AZ::Transform& /*world*/)
     {
         OnCompositionChanged();
@@ -65,10 +65,12 @@ namespace SurfaceData
         //////////////////////////////////////////////////////////////////////////
         // SurfaceDataProviderRequestBus
         void GetSurfacePoints(const AZ::Vector3& inPosition, SurfacePointList& surfacePointList) const;
+        void GetSurfacePointsFromList(SurfacePointListPerPosition& surfacePointListPerPosition) const override;
 
         //////////////////////////////////////////////////////////////////////////
         // SurfaceDataModifierRequestBus
         void ModifySurfacePoints(SurfacePointList& surfacePointList) const override;
+        void ModifySurfacePointsFromList(SurfacePointListPerPosition& surfacePointListPerPosition) const override;
 
         //////////////////////////////////////////////////////////////////////////
         // AZ::TransformNotificationBus
@@ -232,44 +232,75 @@ namespace SurfaceData
 
         AZStd::lock_guard<decltype(m_registrationMutex)> registrationLock(m_registrationMutex);
 
-        surfacePointListPerPosition.clear();
         surfacePointListPerPosition.reserve(aznumeric_cast<uint32_t>(ceil(inRegion.GetXExtent() / stepSize.GetX())) * aznumeric_cast<uint32_t>(ceil(inRegion.GetYExtent() / stepSize.GetY())));
 
         // Initialize our list-per-position list with every input position to query from the region.
         // This is inclusive on the min sides of inRegion, and exclusive on the max sides.
+        // The lists that are already in surfacePointListPerPosition are reused, so that their memory doesn't get reallocated on every query.
+        size_t numPositions = 0;
         for (float y = inRegion.GetMin().GetY(); y < inRegion.GetMax().GetY(); y += stepSize.GetY())
         {
             for (float x = inRegion.GetMin().GetX(); x < inRegion.GetMax().GetX(); x += stepSize.GetX())
             {
-                surfacePointListPerPosition.emplace_back(AZ::Vector3(x, y, AZ::Constants::FloatMax), SurfaceData::SurfacePointList{});
+                const AZ::Vector3 position(x, y, AZ::Constants::FloatMax);
+                if (numPositions < surfacePointListPerPosition.size())
+                {
+                    surfacePointListPerPosition[numPositions].first = position;
+                    surfacePointListPerPosition[numPositions].second.clear();
+                }
+                else
+                {
+                    surfacePointListPerPosition.emplace_back(position, SurfaceData::SurfacePointList{});
+                }
+                ++numPositions;
             }
         }
+        surfacePointListPerPosition.resize(numPositions);
+
+        GetSurfacePointsFromListInternal(inRegion, desiredTags, surfacePointListPerPosition);
+    }
+
+    void SurfaceDataSystemComponent::GetSurfacePointsFromList(const AZStd::vector<AZ::Vector3>& inPositions, const SurfaceTagVector& desiredTags, SurfacePointListPerPosition& surfacePointListPerPosition) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        AZStd::lock_guard<decltype(m_registrationMutex)> registrationLock(m_registrationMutex);
+
+        // Reuse the lists that are already in surfacePointListPerPosition, so that their memory doesn't get reallocated on every query.
+        surfacePointListPerPosition.resize(inPositions.size());
+
+        AZ::Aabb inBounds = AZ::Aabb::CreateNull();
+        for (size_t index = 0; index < inPositions.size(); ++index)
+        {
+            surfacePointListPerPosition[index].first = inPositions[index];
+            surfacePointListPerPosition[index].second.clear();
+            inBounds.AddPoint(inPositions[index]);
+        }
 
+        if (inBounds.IsValid())
+        {
+            GetSurfacePointsFromListInternal(inBounds, desiredTags, surfacePointListPerPosition);
+        }
+    }
+
+    void SurfaceDataSystemComponent::GetSurfacePointsFromListInternal(const AZ::Aabb& inBounds, const SurfaceTagVector& desiredTags, SurfacePointListPerPosition& surfacePointListPerPosition) const
+    {
         const bool hasDesiredTags = HasValidTags(desiredTags);
         const bool hasModifierTags = hasDesiredTags && HasMatchingTags(desiredTags, m_registeredModifierTags);
 
         // Loop through each data provider, and query all the points for each one.  This allows us to check the tags and the overall
-        // AABB bounds just once per provider, instead of once per point.  It also allows for an eventual optimization in which we could send
-        // the list of points directly into each SurfaceDataProvider.
+        // AABB bounds just once per provider, instead of once per point.  It also lets each SurfaceDataProvider process the whole list
+        // in one request, so the bus dispatch and any locking the provider does happen once per provider instead of once per point.
         for (const auto& entryPair : m_registeredSurfaceDataProviders)
         {
             const SurfaceDataRegistryEntry& entry = entryPair.second;
             bool alwaysApplies = !entry.m_bounds.IsValid();
 
             if ((!hasDesiredTags || hasModifierTags || HasMatchingTags(desiredTags, entry.m_tags)) &&
-                ( alwaysApplies || AabbOverlaps2D(entry.m_bounds, inRegion) )
+                ( alwaysApplies || AabbOverlaps2D(entry.m_bounds, inBounds) )
                 )
             {
-                for (auto& surfacePointListAndPoint : surfacePointListPerPosition)
-                {
-                    const auto& point2d = surfacePointListAndPoint.first;
-                    SurfacePointList& surfacePointList = surfacePointListAndPoint.second;
-                    AZ::Vector3 point3d(point2d.GetX(), point2d.GetY(), entry.m_bounds.GetMax().GetZ());
-                    if (alwaysApplies || entry.m_bounds.Contains(point3d))
-                    {
-                        SurfaceDataProviderRequestBus::Event(entryPair.first, &SurfaceDataProviderRequestBus::Events::GetSurfacePoints, point3d, surfacePointList);
-                    }
-                }
+                SurfaceDataProviderRequestBus::Event(entryPair.first, &SurfaceDataProviderRequestBus::Events::GetSurfacePointsFromList, surfacePointListPerPosition);
             }
         }
 
@@ -283,21 +314,9 @@ namespace SurfaceData
             const SurfaceDataRegistryEntry& entry = entryPair.second;
             bool alwaysApplies = !entry.m_bounds.IsValid();
 
-            if (alwaysApplies || AabbOverlaps2D(entry.m_bounds, inRegion))
+            if (alwaysApplies || AabbOverlaps2D(entry.m_bounds, inBounds))
             {
-                for (auto& surfacePointListAndPoint : surfacePointListPerPosition)
-                {
-                    const auto& point2d = surfacePointListAndPoint.first;
-                    SurfacePointList& surfacePointList = surfacePointListAndPoint.second;
-                    if (!surfacePointList.empty())
-                    {
-                        AZ::Vector3 point3d(point2d.GetX(), point2d.GetY(), entry.m_bounds.GetMax().GetZ());
-                        if (alwaysApplies || entry.m_bounds.Contains(point3d))
-                        {
-                            SurfaceDataModifierRequestBus::Event(entryPair.first, &SurfaceDataModifierRequestBus::Events::ModifySurfacePoints, surfacePointList);
-                        }
-                    }
-                }
+                SurfaceDataModifierRequestBus::Event(entryPair.first, &SurfaceDataModifierRequestBus::Events::ModifySurfacePointsFromList, surfacePointListPerPosition);
             }
         }
 
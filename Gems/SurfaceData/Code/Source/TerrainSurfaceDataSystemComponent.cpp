@@ -183,6 +183,42 @@ namespace SurfaceData
         }
     }
 
+    void TerrainSurfaceDataSystemComponent::GetSurfacePointsFromList(SurfacePointListPerPosition& surfacePointListPerPosition) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        if (m_terrainBoundsIsValid)
+        {
+            // Look up the terrain once for the whole list, instead of once per position.
+            auto enumerationCallback = [&](AzFramework::Terrain::TerrainDataRequests* terrain) -> bool
+            {
+                const AZ::Aabb terrainAabb = terrain->GetTerrainAabb();
+                for (auto& surfacePointListAndPoint : surfacePointListPerPosition)
+                {
+                    const AZ::Vector3& inPosition = surfacePointListAndPoint.first;
+                    if (AabbContains2D(terrainAabb, inPosition))
+                    {
+                        const AZ::Vector3 terrainPosition(inPosition.GetX(), inPosition.GetY(), terrainAabb.GetMax().GetZ());
+                        bool isTerrainValidAtPoint = false;
+                        const float terrainHeight = terrain->GetHeight(terrainPosition, AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR, &isTerrainValidAtPoint);
+                        const bool isHole = !isTerrainValidAtPoint;
+
+                        SurfacePoint point;
+                        point.m_entityId = GetEntityId();
+                        point.m_position = AZ::Vector3(inPosition.GetX(), inPosition.GetY(), terrainHeight);
+                        point.m_normal = terrain->GetNormal(terrainPosition);
+                        const AZ::Crc32 terrainTag = isHole ? Constants::s_terrainHoleTagCrc : Constants::s_terrainTagCrc;
+                        AddMaxValueForMasks(point.m_masks, terrainTag, 1.0f);
+                        surfacePointListAndPoint.second.push_back(point);
+                    }
+                }
+                // Only one handler should exist.
+                return false;
+            };
+            AzFramework::Terrain::TerrainDataRequestBus::EnumerateHandlers(enumerationCallback);
+        }
+    }
+
     AZ::Aabb TerrainSurfaceDataSystemComponent::GetSurfaceAabb() const
     {
         auto terrain = AzFramework::Terrain::TerrainDataRequestBus::FindFirstHandler();
@@ -59,6 +59,7 @@ namespace SurfaceData
         //////////////////////////////////////////////////////////////////////////
         // SurfaceDataProviderRequestBus
         void GetSurfacePoints(const AZ::Vector3& inPosition, SurfacePointList& surfacePointList) const;
+        void GetSurfacePointsFromList(SurfacePointListPerPosition& surfacePointListPerPosition) const override;
 
         ////////////////////////////////////////////////////////////////////////////
         // CrySystemEvents
@@ -743,4 +743,57 @@ TEST_F(SurfaceDataTestApp, SurfaceData_TestSurfacePointsFromRegion_DissimilarPoi
     }
 }
 
+TEST_F(SurfaceDataTestApp, SurfaceData_TestSurfacePointsFromList)
+{
+    // This tests the basic functionality of GetSurfacePointsFromList:
+    // - The output has one list entry per input position, in the same order as the input positions
+    // - The output matches the points returned by GetSurfacePoints for each position
+    // - Positions outside of the surface provider don't get any points
+    // - Querying again with fewer positions reuses the output lists and doesn't leave any stale points behind
+
+    // Create a mock Surface Provider that covers from (0, 0) - (8, 8) in space.
+    // It defines points spaced 0.25 apart, with heights of 0 and 4, and with the tags "test_surface1" and "test_surface2".
+    SurfaceData::SurfaceTagVector providerTags = { SurfaceData::SurfaceTag(m_testSurface1Crc), SurfaceData::SurfaceTag(m_testSurface2Crc) };
+    MockSurfaceProvider mockProvider(MockSurfaceProvider::ProviderType::SURFACE_PROVIDER, providerTags,
+                                     AZ::Vector3(0.0f), AZ::Vector3(8.0f), AZ::Vector3(0.25f, 0.25f, 4.0f));
+
+    AZStd::vector<AZ::Vector3> positions = { AZ::Vector3(1.0f, 2.0f, 0.0f), AZ::Vector3(16.0f, 16.0f, 0.0f), AZ::Vector3(3.5f, 0.25f, 16.0f) };
+    SurfaceData::SurfacePointListPerPosition availablePointsPerPosition;
+    SurfaceData::SurfaceTagVector testTags = providerTags;
+
+    SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+        &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointsFromList,
+        positions, testTags, availablePointsPerPosition);
+
+    ASSERT_EQ(availablePointsPerPosition.size(), positions.size());
+    for (size_t index = 0; index < positions.size(); ++index)
+    {
+        SurfaceData::SurfacePointList expectedPoints;
+        SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+            &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePoints,
+            positions[index], testTags, expectedPoints);
+
+        const SurfaceData::SurfacePointList& pointList = availablePointsPerPosition[index].second;
+        EXPECT_TRUE(availablePointsPerPosition[index].first == positions[index]);
+        ASSERT_EQ(pointList.size(), expectedPoints.size());
+        for (size_t pointIndex = 0; pointIndex < pointList.size(); ++pointIndex)
+        {
+            EXPECT_TRUE(pointList[pointIndex].m_position == expectedPoints[pointIndex].m_position);
+            EXPECT_TRUE(pointList[pointIndex].m_masks.size() == expectedPoints[pointIndex].m_masks.size());
+        }
+    }
+    EXPECT_TRUE(availablePointsPerPosition[0].second.size() == 2);
+    EXPECT_TRUE(availablePointsPerPosition[1].second.empty());
+    EXPECT_TRUE(availablePointsPerPosition[2].second.size() == 2);
+
+    // Query again with only the position outside of the provider.
+    positions = { AZ::Vector3(16.0f, 16.0f, 0.0f) };
+    SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+        &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointsFromList,
+        positions, testTags, availablePointsPerPosition);
+
+    ASSERT_EQ(availablePointsPerPosition.size(), positions.size());
+    EXPECT_TRUE(availablePointsPerPosition[0].second.empty());
+}
+
 AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
@@ -14,7 +14,9 @@
 #include <CryCommon/IConsole.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Component/Entity.h>
+#include <AzCore/Component/ScheduledTick.h>
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Interface/Interface.h>
 #include <AzCore/Module/ModuleManager.h>
 #include <AzCore/std/string/conversions.h>
 
@@ -120,6 +122,74 @@ namespace TickBusOrderViewer
         });
     }
 
+    /**
+    * Returns a readable name for the importance of a scheduled tick handler.
+    */
+    const char* GetImportanceName(AZ::ScheduledTickImportance importance)
+    {
+        switch (importance)
+        {
+        case AZ::ScheduledTickImportance::Low:
+            return "low";
+        case AZ::ScheduledTickImportance::Normal:
+            return "normal";
+        case AZ::ScheduledTickImportance::High:
+            return "high";
+        case AZ::ScheduledTickImportance::Critical:
+            return "critical";
+        default:
+            return "unknown";
+        }
+    }
+
+    /**
+    * Prints out all connected scheduled tick handlers with their frequency and importance.
+    * @param entityId An optional entity ID used to only display handlers for components on this entity.
+    *                 displays all handlers if this is null.
+    */
+    void PrintScheduledTickHandlers(AZ::EntityId* entityId)
+    {
+        AZ::IScheduledTickSystem* scheduledTickSystem = AZ::Interface<AZ::IScheduledTickSystem>::Get();
+        if (scheduledTickSystem == nullptr)
+        {
+            AZ_Warning("TickBusOrderViewer", false, "The scheduled tick system isn't available.");
+            return;
+        }
+
+        // Scheduled ticks are spread over frames, so show how many handlers ticked in the last frame to help spot spikes.
+        AZ_Printf("TickBusOrderViewer", "Scheduled tick handlers, dispatched at tick order %d. %u ticked and %u were postponed last frame",
+            AZ::TICK_GAME,
+            scheduledTickSystem->GetNumTickedLastFrame(),
+            scheduledTickSystem->GetNumPostponedLastFrame());
+
+        scheduledTickSystem->EnumerateHandlers([entityId](const AZ::ScheduledTickHandler& handler)
+        {
+            const AZ::Component* component = azrtti_cast<const AZ::Component*>(&handler);
+            if (component && (entityId == nullptr || component->GetEntityId() == *entityId))
+            {
+                AZStd::string entityName = component->GetEntity() != nullptr ?
+                    component->GetEntity()->GetName() : "[No entity found]";
+                AZ_Printf("TickBusOrderViewer", "\t%.1f Hz, %s importance - Entity \"%s\" %s, component %s %s with ID %u",
+                    handler.GetScheduledTickFrequency(),
+                    GetImportanceName(handler.GetScheduledTickImportance()),
+                    entityName.c_str(),
+                    component->GetEntityId().ToString().c_str(),
+                    component->RTTI_GetTypeName(),
+                    component->RTTI_GetType().ToString<AZStd::string>().c_str(),
+                    component->GetId());
+            }
+            else if (entityId == nullptr)
+            {
+                AZ_Printf("TickBusOrderViewer", "\t%.1f Hz, %s importance - Object with type %s %s",
+                    handler.GetScheduledTickFrequency(),
+                    GetImportanceName(handler.GetScheduledTickImportance()),
+                    handler.RTTI_GetTypeName(),
+                    handler.RTTI_GetType().ToString<AZStd::string>().c_str());
+            }
+            return true;
+        });
+    }
+
     /**
     * Console command to print the handlers for the tickbus, in the order they are ticked.
     */
@@ -147,6 +217,20 @@ namespace TickBusOrderViewer
         PrintTickbusHandlers(&entityId);
     }
 
+    /**
+    * Console command to print the handlers of the scheduled tick system.
+    */
+    void PrintScheduledTickHandlerList(IConsoleCmdArgs* args)
+    {
+        if (args == nullptr || args->GetArgCount() == 1 || args->GetArg(1) == nullptr)
+        {
+            PrintScheduledTickHandlers(nullptr);
+            return;
+        }
+        AZ::EntityId entityId(AZStd::stoull(AZStd::string(args->GetArg(1))));
+        PrintScheduledTickHandlers(&entityId);
+    }
+
     class TickBusOrderViewerModule
         : public CryHooksModule
     {
@@ -183,6 +267,9 @@ namespace TickBusOrderViewer
             // Register the command to print the tickbus handlers out.
             REGISTER_COMMAND("print_tickbus_handlers", &PrintTickbusHandlerOrder, 0, "Prints out the handlers for the tickbus in tick order. "
             "With zero parameters, prints all handlers. With one parameter, it converts that to an entity ID and only prints components for that entity.");
+            REGISTER_COMMAND("print_scheduled_tick_handlers", &PrintScheduledTickHandlerList, 0, "Prints out the handlers of the scheduled tick system "
+            "with their frequency and importance. With zero parameters, prints all handlers. With one parameter, it converts that to an entity ID "
+            "and only prints components for that entity.");
         }
     };
 }
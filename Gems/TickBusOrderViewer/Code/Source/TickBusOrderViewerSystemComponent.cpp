@@ -24,7 +24,7 @@ namespace TickBusOrderViewer
             {
                 ec->Class<TickBusOrderViewerSystemComponent>(
                     "TickBusOrderViewer", 
-                    "Provides a console command for viewing tick bus order, print_tickbus_handlers.")
+                    "Provides console commands for viewing tick bus order, print_tickbus_handlers, and scheduled tick handlers, print_scheduled_tick_handlers.")
                     ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
                         ->Attribute(AZ::Edit::Attributes::AppearsInAddComponentMenu, AZ_CRC("System"))
                         ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
@@ -90,6 +90,10 @@ namespace Vegetation
                 m_instanceSpawner->DestroyInstance(id, instance);
             }
         }
+        AZ_INLINE bool ReuseInstance(InstancePtr instance, const InstanceData& instanceData)
+        {
+            return m_instanceSpawner ? m_instanceSpawner->ReuseInstance(instance, instanceData) : false;
+        }
 
         // We use the InstanceSpawner pointer as the notification bus ID since the InstanceSpawner is
         // the one that will actually broadcast out the notifications.  Multiple Descriptors can point to
@@ -84,6 +84,10 @@ namespace Vegetation
         //! Destroy a single instance.
         virtual void DestroyInstance(InstanceId id, InstancePtr instance) = 0;
 
+        //! Move an instance that is being destroyed to the placement of a new instance, so that it can be reused instead of
+        //! destroying it and creating a new one.  Returns false if the spawner can't reuse its instances.
+        virtual bool ReuseInstance([[maybe_unused]] InstancePtr instance, [[maybe_unused]] const InstanceData& instanceData) { return false; }
+
         //! Check for data equivalency.  Subclasses are expected to implement this.
         bool operator==(const InstanceSpawner& rhs) const { return DataIsEquivalent(rhs); };
 
@@ -59,6 +59,9 @@ namespace Vegetation
         //! Destroy a single instance.
         void DestroyInstance(InstanceId id, InstancePtr instance) override;
 
+        //! Move the root entity of an existing instance to the placement of a new instance.
+        bool ReuseInstance(InstancePtr instance, const InstanceData& instanceData) override;
+
         AZStd::string GetSpawnableAssetPath() const;
         void SetSpawnableAssetPath(const AZStd::string& assetPath);
 
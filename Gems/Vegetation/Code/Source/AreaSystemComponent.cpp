@@ -1101,7 +1101,7 @@ namespace Vegetation
         // 0 = lower left corner, 0.5 = center
         const float texelOffset = (sectorPointSnapMode == SnapMode::Center) ? 0.5f : 0.0f;
 
-        SurfaceData::SurfacePointListPerPosition availablePointsPerPosition;
+        SurfaceData::SurfacePointListPerPosition& availablePointsPerPosition = m_availablePointsPerPosition;
         AZ::Vector2 stepSize(vegStep, vegStep);
         AZ::Vector3 regionOffset(texelOffset * vegStep, texelOffset * vegStep, 0.0f);
         AZ::Aabb regionBounds = sectorInfo.m_bounds;
@@ -1611,6 +1611,27 @@ namespace Vegetation
             m_updateWorkList.clear();
         }
 
+        // Index the pending update requests by sector.  The view rectangle changes whenever the camera moves, and searching
+        // the update work list for every sector in the view rectangle made rebuilding the work lists quadratic in the number of
+        // sectors, which delayed the sector updates themselves.
+        m_updateWorkListIndices.clear();
+        for (size_t index = 0; index < m_updateWorkList.size(); ++index)
+        {
+            m_updateWorkListIndices.emplace(m_updateWorkList[index].first, index);
+        }
+
+        auto findUpdateEntry = [this](const SectorId& sectorId) -> AZStd::pair<SectorId, UpdateMode>*
+        {
+            auto found = m_updateWorkListIndices.find(sectorId);
+            return (found != m_updateWorkListIndices.end()) ? &m_updateWorkList[found->second] : nullptr;
+        };
+
+        auto addUpdateEntry = [this](const SectorId& sectorId, UpdateMode mode)
+        {
+            m_updateWorkListIndices.emplace(sectorId, m_updateWorkList.size());
+            m_updateWorkList.emplace_back(sectorId, mode);
+        };
+
         // Run through our list of active sectors and determine which ones need adding / updating / deleting
         {
             AZStd::lock_guard<decltype(vegTasks->m_sectorRollingWindowMutex)> lock(vegTasks->m_sectorRollingWindowMutex);
@@ -1631,8 +1652,8 @@ namespace Vegetation
                         {
                             // If the sector doesn't currently exist and it belongs in the view rect, request a creation.
                             // (This will either create a new entry or overwrite an existing pending Create request)
-                            auto found = AZStd::find_if(m_updateWorkList.begin(), m_updateWorkList.end(), [sectorId](auto& entry) { return (entry.first == sectorId); });
-                            if (found != m_updateWorkList.end())
+                            auto found = findUpdateEntry(sectorId);
+                            if (found)
                             {
                                 // If the update entry already exists, overwrite the state.  We don't need to check or
                                 // preserve the existing state because Create is the most comprehensive update we can do.
@@ -1640,7 +1661,7 @@ namespace Vegetation
                             }
                             else
                             {
-                                m_updateWorkList.emplace_back(sectorId, UpdateMode::Create);
+                                addUpdateEntry(sectorId, UpdateMode::Create);
                             }
 
                             // Since we've already removed entries that aren't in the view rect, and these loops are only
@@ -1666,8 +1687,8 @@ namespace Vegetation
                 {
                     // Active sector has new surface point information, so rebuild surface cache and fill
                     // (This will either create a new entry, or overwrite an existing fill or rebuild request)
-                    auto found = AZStd::find_if(m_updateWorkList.begin(), m_updateWorkList.end(), [sectorId](auto& entry) { return (entry.first == sectorId); });
-                    if (found != m_updateWorkList.end())
+                    auto found = findUpdateEntry(sectorId);
+                    if (found)
                     {
                         // If the update entry already exists, overwrite the state.  We don't need to check or
                         // preserve the state since it should only contain either Rebuild or Fill, and Rebuild
@@ -1677,7 +1698,7 @@ namespace Vegetation
                     }
                     else
                     {
-                        m_updateWorkList.emplace_back(sectorId, UpdateMode::RebuildSurfaceCacheAndFill);
+                        addUpdateEntry(sectorId, UpdateMode::RebuildSurfaceCacheAndFill);
                     }
 
                     // We shouldn't ever have an update list that's larger than the set of sectors in the view rect.
@@ -1686,14 +1707,12 @@ namespace Vegetation
                 else if (threadData->m_dirtySectorContents.IsDirty(sectorId))
                 {
                     // Active sector has new veg area information, so refill it.
-                    auto found = AZStd::find_if(m_updateWorkList.begin(), m_updateWorkList.end(), [sectorId](auto& entry)
-                    { return (entry.first == sectorId); });
-                    if (found == m_updateWorkList.end())
+                    if (!findUpdateEntry(sectorId))
                     {
                         // Only add Fill entries if no update request exists for this sector.  We don't
                         // overwrite existing entries because an existing entry might have previously
                         // requested "RebuildSurfaceCacheAndFill", which is more comprehensive than this request.
-                        m_updateWorkList.emplace_back(sectorId, UpdateMode::Fill);
+                        addUpdateEntry(sectorId, UpdateMode::Fill);
 
                         // We shouldn't ever have an update list that's larger than the set of sectors in the view rect.
                         AZ_Assert(m_updateWorkList.size() <= m_viewRectSectorCount, "Too many update requests added");
@@ -17,6 +17,7 @@
 #include <AzCore/std/parallel/thread.h>
 #include <GradientSignal/Ebuses/SectorDataRequestBus.h>
 #include <SurfaceData/SurfaceDataSystemNotificationBus.h>
+#include <SurfaceData/SurfaceDataTypes.h>
 #include <CrySystemBus.h>
 #include <StatObjBus.h>
 #include <ISystem.h>
@@ -339,6 +340,10 @@ namespace Vegetation
             //! Note: This is only updated from the vegetation thread when processing vegetation tasks.
             UnregisteredVegetationAreaMap m_unregisteredVegetationAreaSet;
 
+            //! Surface points queried for the sector that is being updated, kept around so its lists get reused by the next sector.
+            //! Note: This is only used from the vegetation thread when updating the sector points.
+            SurfaceData::SurfacePointListPerPosition m_availablePointsPerPosition;
+
             //! Cached pointer to the debug data.
             //! Note: This doesn't have an associated mutex because DebugData itself consists purely of atomics
             DebugData* m_debugData = nullptr;
@@ -447,6 +452,10 @@ namespace Vegetation
             // be recalculated.
             AZStd::vector<AZStd::pair<SectorId, UpdateMode>> m_updateWorkList;
 
+            // The index of each sector in m_updateWorkList.  This is effectively a local variable in UpdateSectorWorkLists(),
+            // but is kept persistent to avoid potentially frequent reallocation.
+            AZStd::unordered_map<SectorId, size_t> m_updateWorkListIndices;
+
             // Sector counts of the number of expected sectors in the view rectangle vs the number of sectors
             // currently active.  These are used to "load balance" sector deletes and creates so that we don't have
             // too many sectors active at any one point in time.
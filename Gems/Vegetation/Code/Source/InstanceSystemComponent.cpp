@@ -289,10 +289,19 @@ namespace Vegetation
         VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::CreateInstance, instanceData.m_instanceId, instanceData.m_position, instanceData.m_id));
 
         //queue render node related tasks to process on the main thread
-        AddTask([this, instanceData]() {
-            CreateInstanceNode(instanceData);
-            m_createTaskCount--;
-        });
+        //the surface masks are only needed while claiming, so they aren't copied into the task
+        Task task;
+        task.m_type = Task::Type::Create;
+        task.m_instanceData.m_id = instanceData.m_id;
+        task.m_instanceData.m_instanceId = instanceData.m_instanceId;
+        task.m_instanceData.m_changeIndex = instanceData.m_changeIndex;
+        task.m_instanceData.m_position = instanceData.m_position;
+        task.m_instanceData.m_normal = instanceData.m_normal;
+        task.m_instanceData.m_rotation = instanceData.m_rotation;
+        task.m_instanceData.m_alignment = instanceData.m_alignment;
+        task.m_instanceData.m_scale = instanceData.m_scale;
+        task.m_instanceData.m_descriptorPtr = instanceData.m_descriptorPtr;
+        AddTask(AZStd::move(task));
 
         m_createTaskCount++;
     }
@@ -310,13 +319,10 @@ namespace Vegetation
         VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::DeleteInstance, instanceId));
 
         //queue render node related tasks to process on the main thread
-        AddTask([this, instanceId]() {
-            ReleaseInstanceNode(instanceId);
-
-            AZStd::lock_guard<decltype(m_instanceDeletionSetMutex)> instanceDeletionSet(m_instanceDeletionSetMutex);
-            m_instanceDeletionSet.erase(instanceId);
-            m_destroyTaskCount--;
-        });
+        Task task;
+        task.m_type = Task::Type::Destroy;
+        task.m_instanceData.m_instanceId = instanceId;
+        AddTask(AZStd::move(task));
 
         AZStd::lock_guard<decltype(m_instanceDeletionSetMutex)> instanceDeletionSet(m_instanceDeletionSetMutex);
         m_instanceDeletionSet.insert(instanceId);
@@ -476,7 +482,11 @@ namespace Vegetation
             }
         }
 
-        InstancePtr opaqueInstanceData = instanceData.m_descriptorPtr->CreateInstance(instanceData);
+        InstancePtr opaqueInstanceData = ReuseInstanceNode(instanceData);
+        if (!opaqueInstanceData)
+        {
+            opaqueInstanceData = instanceData.m_descriptorPtr->CreateInstance(instanceData);
+        }
 
         if (opaqueInstanceData)
         {
@@ -508,18 +518,67 @@ namespace Vegetation
 
         if (opaqueInstanceData)
         {
-            descriptor->DestroyInstance(instanceId, opaqueInstanceData);
+            // Keep the instance around until the end of the task execution, in case a new instance of the same descriptor can reuse it.
+            // The instance id stays in use until then, in case the spawner tracks its instances by id.
+            m_reusableInstances[descriptor].push_back({ instanceId, opaqueInstanceData });
+            return;
         }
         ReleaseInstanceId(instanceId);
     }
 
+    InstancePtr InstanceSystemComponent::ReuseInstanceNode(const InstanceData& instanceData)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        auto reusableItr = m_reusableInstances.find(instanceData.m_descriptorPtr);
+        if (reusableItr == m_reusableInstances.end() || reusableItr->second.empty())
+        {
+            return nullptr;
+        }
+
+        const ReusableInstance reusable = reusableItr->second.back();
+        reusableItr->second.pop_back();
+        if (!instanceData.m_descriptorPtr->ReuseInstance(reusable.m_instance, instanceData))
+        {
+            // The spawner can't reuse its instances, so destroy this one and don't hold on to the others either.
+            instanceData.m_descriptorPtr->DestroyInstance(reusable.m_instanceId, reusable.m_instance);
+            ReleaseInstanceId(reusable.m_instanceId);
+            for (const ReusableInstance& other : reusableItr->second)
+            {
+                instanceData.m_descriptorPtr->DestroyInstance(other.m_instanceId, other.m_instance);
+                ReleaseInstanceId(other.m_instanceId);
+            }
+            m_reusableInstances.erase(reusableItr);
+            return nullptr;
+        }
+
+        ReleaseInstanceId(reusable.m_instanceId);
+        return reusable.m_instance;
+    }
+
+    void InstanceSystemComponent::DestroyReusableInstances()
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        for (const auto& reusablePair : m_reusableInstances)
+        {
+            const DescriptorPtr& descriptor = reusablePair.first;
+            for (const ReusableInstance& reusable : reusablePair.second)
+            {
+                descriptor->DestroyInstance(reusable.m_instanceId, reusable.m_instance);
+                ReleaseInstanceId(reusable.m_instanceId);
+            }
+        }
+        m_reusableInstances.clear();
+    }
+
     bool InstanceSystemComponent::HasTasks() const
     {
         AZStd::lock_guard<decltype(m_mainThreadTaskMutex)> mainThreadTaskLock(m_mainThreadTaskMutex);
         return !m_mainThreadTaskQueue.empty();
     }
 
-    void InstanceSystemComponent::AddTask(const Task& task)
+    void InstanceSystemComponent::AddTask(Task&& task)
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
 
@@ -529,7 +588,31 @@ namespace Vegetation
             m_mainThreadTaskQueue.push_back();
             m_mainThreadTaskQueue.back().reserve(m_configuration.m_maxInstanceTaskBatchSize);
         }
-        m_mainThreadTaskQueue.back().emplace_back(task);
+        m_mainThreadTaskQueue.back().emplace_back(AZStd::move(task));
+    }
+
+    void InstanceSystemComponent::ExecuteTask(const Task& task)
+    {
+        switch (task.m_type)
+        {
+        case Task::Type::Create:
+        {
+            CreateInstanceNode(task.m_instanceData);
+            m_createTaskCount--;
+            break;
+        }
+
+        case Task::Type::Destroy:
+        {
+            const InstanceId instanceId = task.m_instanceData.m_instanceId;
+            ReleaseInstanceNode(instanceId);
+
+            AZStd::lock_guard<decltype(m_instanceDeletionSetMutex)> instanceDeletionSet(m_instanceDeletionSetMutex);
+            m_instanceDeletionSet.erase(instanceId);
+            m_destroyTaskCount--;
+            break;
+        }
+        }
     }
 
     void InstanceSystemComponent::ClearTasks()
@@ -567,20 +650,32 @@ namespace Vegetation
         AZStd::chrono::system_clock::time_point currentTime = initialTime;
 
         auto removedTasksPtr = AZStd::make_shared<TaskList>();
-        while (GetTasks(*removedTasksPtr))
+        bool outOfTime = false;
+        while (!outOfTime && GetTasks(*removedTasksPtr))
         {
-            for (const auto& task : (*removedTasksPtr).back())
+            // Check the time budget after every task instead of every batch, since a single batch of prefab spawns can take
+            // several frames worth of time.
+            TaskBatch& tasks = (*removedTasksPtr).back();
+            size_t numExecutedTasks = 0;
+            while (!outOfTime && numExecutedTasks < tasks.size())
             {
-                task();
+                ExecuteTask(tasks[numExecutedTasks++]);
+
+                currentTime = AZStd::chrono::system_clock::now();
+                outOfTime = AZStd::chrono::microseconds(currentTime - initialTime).count() > m_configuration.m_maxInstanceProcessTimeMicroseconds;
             }
 
-            currentTime = AZStd::chrono::system_clock::now();
-            if (AZStd::chrono::microseconds(currentTime - initialTime).count() > m_configuration.m_maxInstanceProcessTimeMicroseconds)
+            if (numExecutedTasks < tasks.size())
             {
-                break;
+                // Put the rest of the batch back at the front of the queue for the next frame.
+                tasks.erase(tasks.begin(), tasks.begin() + numExecutedTasks);
+                AZStd::lock_guard<decltype(m_mainThreadTaskMutex)> mainThreadTaskLock(m_mainThreadTaskMutex);
+                m_mainThreadTaskQueue.splice(m_mainThreadTaskQueue.begin(), *removedTasksPtr, AZStd::prev((*removedTasksPtr).end()));
             }
         }
 
+        DestroyReusableInstances();
+
         //offloading garbage collection to job to save time deallocating tasks on main thread
         auto garbageCollectionJob = AZ::CreateJobFunction([removedTasksPtr]() mutable {}, true);
         garbageCollectionJob->Start();
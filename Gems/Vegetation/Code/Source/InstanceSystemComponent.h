@@ -128,6 +128,20 @@ namespace Vegetation
 
         void ReleaseInstanceNode(InstanceId instanceId);
 
+        //! Take an instance of the descriptor that was released during the current task execution, and move it to the new placement.
+        InstancePtr ReuseInstanceNode(const InstanceData& instanceData);
+        void DestroyReusableInstances();
+
+        //! Instances released by the destroy tasks of the current ExecuteTasks call, per descriptor.  Create tasks of the same
+        //! call reuse them, which avoids a full destroy and create when vegetation moves between sectors.  Whatever isn't reused
+        //! gets destroyed at the end of the call.  This is only accessed while executing tasks on the main thread.
+        struct ReusableInstance
+        {
+            InstanceId m_instanceId = InvalidInstanceId;
+            InstancePtr m_instance = nullptr;
+        };
+        AZStd::map<DescriptorPtr, AZStd::vector<ReusableInstance>> m_reusableInstances;
+
         mutable AZStd::recursive_mutex m_instanceMapMutex;
         AZStd::unordered_map<InstanceId, AZStd::pair<DescriptorPtr, InstancePtr>> m_instanceMap;
 
@@ -136,7 +150,19 @@ namespace Vegetation
 
         ////////////////////////////////////////////////////////////////
         // Task management
-        using Task = AZStd::function<void(void)>;
+        // Tasks are stored by value instead of as functions, so queueing the create and destroy requests of dense vegetation
+        // doesn't allocate memory per instance.
+        struct Task
+        {
+            enum class Type
+            {
+                Create,
+                Destroy
+            };
+
+            Type m_type = Type::Create;
+            InstanceData m_instanceData; //!< The instance to create, or only the id of the instance to destroy.
+        };
         using TaskBatch = AZStd::vector<Task>;
         using TaskList = AZStd::list<TaskBatch>;
         TaskList m_mainThreadTaskQueue;
@@ -144,7 +170,8 @@ namespace Vegetation
         mutable AZStd::recursive_mutex m_mainThreadTaskInProgressMutex;
 
         bool HasTasks() const;
-        void AddTask(const Task& task);
+        void AddTask(Task&& task);
+        void ExecuteTask(const Task& task);
         void ClearTasks();
         bool GetTasks(TaskList& removedTasks);
         void ExecuteTasks();
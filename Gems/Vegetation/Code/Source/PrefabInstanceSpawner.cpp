@@ -9,6 +9,7 @@
 #include <Vegetation/PrefabInstanceSpawner.h>
 
 #include <AzCore/Asset/AssetManager.h>
+#include <AzCore/Component/TransformBus.h>
 #include <AzCore/Math/Transform.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
@@ -363,6 +364,34 @@ namespace Vegetation
         return opaqueInstanceData;
     }
 
+    bool PrefabInstanceSpawner::ReuseInstance(InstancePtr instance, const InstanceData& instanceData)
+    {
+        auto ticket = reinterpret_cast<AzFramework::EntitySpawnTicket*>(instance);
+        if (!ticket || !ticket->IsValid())
+        {
+            return false;
+        }
+
+        AZ::Transform world = AZ::Transform::CreateFromQuaternionAndTranslation(
+            instanceData.m_alignment * instanceData.m_rotation, instanceData.m_position);
+        world.MultiplyByUniformScale(instanceData.m_scale);
+
+        // Requests on a ticket are processed in order, so if the instance is still spawning, the root entity gets moved
+        // once it has been spawned.
+        auto moveRootEntityCB = [world](
+            [[maybe_unused]] AzFramework::EntitySpawnTicket::Id ticketId, AzFramework::SpawnableConstEntityContainerView view)
+        {
+            if (view.size() > 0)
+            {
+                const AZ::Entity* rootEntity = *view.begin();
+                AZ::TransformBus::Event(rootEntity->GetId(), &AZ::TransformBus::Events::SetWorldTM, world);
+            }
+        };
+        AzFramework::SpawnableEntitiesInterface::Get()->ListEntities(*ticket, AZStd::move(moveRootEntityCB));
+
+        return true;
+    }
+
     void PrefabInstanceSpawner::DespawnAssetInstance(AzFramework::EntitySpawnTicket* ticket)
     {
         if (ticket->IsValid())
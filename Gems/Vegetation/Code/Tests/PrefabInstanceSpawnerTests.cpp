@@ -303,6 +303,28 @@ namespace UnitTest
         instanceSpawner.OnReleaseUniqueDescriptor();
     }
 
+    TEST_F(PrefabInstanceSpawnerTests, ReuseInstance)
+    {
+        // The spawner should be able to move a previously created instance instead of spawning a new one.
+
+        Vegetation::PrefabInstanceSpawner instanceSpawner;
+
+        CreateAndSetMockAsset(instanceSpawner, AZ::Uuid::CreateRandom(), "test");
+
+        instanceSpawner.OnRegisterUniqueDescriptor();
+
+        Vegetation::InstanceData instanceData;
+        Vegetation::InstancePtr instance = instanceSpawner.CreateInstance(instanceData);
+        EXPECT_TRUE(instance);
+
+        instanceData.m_position = AZ::Vector3(1.0f, 2.0f, 3.0f);
+        EXPECT_TRUE(instanceSpawner.ReuseInstance(instance, instanceData));
+        EXPECT_FALSE(instanceSpawner.ReuseInstance(nullptr, instanceData));
+        instanceSpawner.DestroyInstance(0, instance);
+
+        instanceSpawner.OnReleaseUniqueDescriptor();
+    }
+
     TEST_F(PrefabInstanceSpawnerTests, SpawnerRegisteredWithDescriptor)
     {
         // Validate that the Descriptor successfully gets PrefabInstanceSpawner registered with it,
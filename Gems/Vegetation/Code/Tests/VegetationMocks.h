@@ -421,6 +421,11 @@ namespace UnitTest
         {
         }
 
+        void GetSurfacePointsFromList([[maybe_unused]] const AZStd::vector<AZ::Vector3>& inPositions, [[maybe_unused]] const SurfaceData::SurfaceTagVector& desiredTags,
+            [[maybe_unused]] SurfaceData::SurfacePointListPerPosition& surfacePointListPerPosition) const override
+        {
+        }
+
         SurfaceData::SurfaceDataRegistryHandle RegisterSurfaceDataProvider([[maybe_unused]] const SurfaceData::SurfaceDataRegistryEntry& entry) override
         {
             ++m_count;
@@ -76,6 +76,10 @@ namespace WhiteBox
         //! Notify the component the mesh has been modified.
         virtual void OnWhiteBoxMeshModified() {}
 
+        //! Notify the component the mesh is being modified by a manipulator that is still held.
+        //! @note Only the render mesh is updated, OnWhiteBoxMeshModified must follow once the manipulator is released.
+        virtual void OnWhiteBoxMeshManipulated() {}
+
         //! Notify listeners when the default shape of the white box mesh changes.
         virtual void OnDefaultShapeTypeChanged([[maybe_unused]] DefaultShapeType defaultShape) {}
 
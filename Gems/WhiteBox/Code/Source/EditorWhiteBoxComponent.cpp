@@ -405,6 +405,13 @@ namespace WhiteBox
         }
     }
 
+    void EditorWhiteBoxComponent::OnWhiteBoxMeshManipulated()
+    {
+        // only the render mesh follows the manipulator, cooking the physics mesh on every mouse move makes
+        // dragging large meshes lag, it (and other components sharing the asset) catch up in OnWhiteBoxMeshModified
+        RebuildRenderMesh();
+    }
+
     void EditorWhiteBoxComponent::RebuildRenderMesh()
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzToolsFramework);
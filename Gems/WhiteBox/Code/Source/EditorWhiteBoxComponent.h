@@ -102,6 +102,7 @@ namespace WhiteBox
 
         // EditorWhiteBoxComponentNotificationBus overrides ...
         void OnWhiteBoxMeshModified() override;
+        void OnWhiteBoxMeshManipulated() override;
 
         void ShowRenderMesh();
         void HideRenderMesh();
@@ -178,7 +178,7 @@ namespace WhiteBox
 
                     EditorWhiteBoxComponentNotificationBus::Event(
                         m_entityComponentIdPair,
-                        &EditorWhiteBoxComponentNotificationBus::Events::OnWhiteBoxMeshModified);
+                        &EditorWhiteBoxComponentNotificationBus::Events::OnWhiteBoxMeshManipulated);
                 });
 
             manipulator->InstallLeftMouseUpCallback(
@@ -186,6 +186,9 @@ namespace WhiteBox
                 {
                     EditorWhiteBoxComponentRequestBus::Event(
                         m_entityComponentIdPair, &EditorWhiteBoxComponentRequests::SerializeWhiteBox);
+
+                    EditorWhiteBoxComponentNotificationBus::Event(
+                        m_entityComponentIdPair, &EditorWhiteBoxComponentNotificationBus::Events::OnWhiteBoxMeshModified);
                 });
 
             m_scaleManipulators[vertexIndex] = AZStd::move(manipulator);
@@ -252,7 +252,7 @@ namespace WhiteBox
                 Api::CalculatePlanarUVs(*whiteBox);
 
                 EditorWhiteBoxComponentNotificationBus::Event(
-                    m_entityComponentIdPair, &EditorWhiteBoxComponentNotificationBus::Events::OnWhiteBoxMeshModified);
+                    m_entityComponentIdPair, &EditorWhiteBoxComponentNotificationBus::Events::OnWhiteBoxMeshManipulated);
             });
 
         m_translationManipulator->InstallLeftMouseUpCallback(
@@ -273,6 +273,9 @@ namespace WhiteBox
                 {
                     EditorWhiteBoxComponentRequestBus::Event(
                         m_entityComponentIdPair, &EditorWhiteBoxComponentRequests::SerializeWhiteBox);
+
+                    EditorWhiteBoxComponentNotificationBus::Event(
+                        m_entityComponentIdPair, &EditorWhiteBoxComponentNotificationBus::Events::OnWhiteBoxMeshModified);
                 }
             });
     }
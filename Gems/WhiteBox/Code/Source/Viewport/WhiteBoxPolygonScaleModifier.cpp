@@ -115,6 +115,10 @@ namespace WhiteBox
                     {
                         EditorWhiteBoxComponentRequestBus::Event(
                             m_entityComponentIdPair, &EditorWhiteBoxComponentRequests::SerializeWhiteBox);
+
+                        EditorWhiteBoxComponentNotificationBus::Event(
+                            m_entityComponentIdPair,
+                            &EditorWhiteBoxComponentNotificationBus::Events::OnWhiteBoxMeshModified);
                     });
 
                 m_scaleManipulators.push_back(manipulator);
@@ -213,7 +217,7 @@ namespace WhiteBox
                 m_entityComponentIdPair, &EditorWhiteBoxDefaultModeRequestBus::Events::RefreshVertexSelectionModifier);
 
             EditorWhiteBoxComponentNotificationBus::Event(
-                m_entityComponentIdPair, &EditorWhiteBoxComponentNotificationBus::Events::OnWhiteBoxMeshModified);
+                m_entityComponentIdPair, &EditorWhiteBoxComponentNotificationBus::Events::OnWhiteBoxMeshManipulated);
         }
     }
 
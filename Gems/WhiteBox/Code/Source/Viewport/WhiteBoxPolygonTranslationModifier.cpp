@@ -209,9 +209,9 @@ namespace WhiteBox
                 Api::CalculateNormals(*whiteBox);
                 Api::CalculatePlanarUVs(*whiteBox);
 
-                // inefficient but easy/effective - just rebuild the whole mesh after every change
+                // the render mesh is rebuilt after every change, the physics mesh once the manipulator is released
                 EditorWhiteBoxComponentNotificationBus::Event(
-                    m_entityComponentIdPair, &EditorWhiteBoxComponentNotificationBus::Events::OnWhiteBoxMeshModified);
+                    m_entityComponentIdPair, &EditorWhiteBoxComponentNotificationBus::Events::OnWhiteBoxMeshManipulated);
             });
 
         m_translationManipulator->InstallLeftMouseUpCallback(
@@ -233,6 +233,9 @@ namespace WhiteBox
                 {
                     EditorWhiteBoxComponentRequestBus::Event(
                         entityComponentIdPair, &EditorWhiteBoxComponentRequests::SerializeWhiteBox);
+
+                    EditorWhiteBoxComponentNotificationBus::Event(
+                        entityComponentIdPair, &EditorWhiteBoxComponentNotificationBus::Events::OnWhiteBoxMeshModified);
                 }
             });
     }
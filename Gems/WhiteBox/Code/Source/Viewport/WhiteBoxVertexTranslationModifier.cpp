@@ -201,7 +201,7 @@ namespace WhiteBox
 
                     EditorWhiteBoxComponentNotificationBus::Event(
                         m_entityComponentIdPair,
-                        &EditorWhiteBoxComponentNotificationBus::Events::OnWhiteBoxMeshModified);
+                        &EditorWhiteBoxComponentNotificationBus::Events::OnWhiteBoxMeshManipulated);
                 }
 
                 Api::CalculateNormals(*whiteBox);
@@ -235,6 +235,9 @@ namespace WhiteBox
 
                     EditorWhiteBoxComponentRequestBus::Event(
                         m_entityComponentIdPair, &EditorWhiteBoxComponentRequests::SerializeWhiteBox);
+
+                    EditorWhiteBoxComponentNotificationBus::Event(
+                        m_entityComponentIdPair, &EditorWhiteBoxComponentNotificationBus::Events::OnWhiteBoxMeshModified);
                 }
 
                 m_pressTime = 0.0f;